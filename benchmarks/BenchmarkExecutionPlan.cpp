@@ -0,0 +1,85 @@
+#include "BenchmarkGraphs.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Synthetic graphs from 10 to 10k nodes in both shapes
+    void GraphSizes(benchmark::internal::Benchmark *benchmark)
+    {
+        for (const auto shape : { Benchmarks::GraphShape::Chain, Benchmarks::GraphShape::Layered })
+        {
+            for (const int64_t nodeCount : { 10, 100, 1'000, 10'000 })
+            {
+                benchmark->Args({ nodeCount, static_cast<int64_t>(shape) });
+            }
+        }
+        benchmark->ArgNames({ "nodes", "layered" })->Unit(benchmark::kMicrosecond);
+    }
+
+    void BuildGraph(Nodes::NodeEditor &editor, const benchmark::State &state)
+    {
+        Benchmarks::BuildSyntheticGraph(
+            editor, static_cast<size_t>(state.range(0)), static_cast<Benchmarks::GraphShape>(state.range(1)));
+    }
+
+    void BM_TopologicalSort(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        BuildGraph(editor, state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::TopologicalSort(editor));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_TopologicalSort)->Apply(GraphSizes);
+
+    void BM_BuildExecutionPlan(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        BuildGraph(editor, state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::BuildExecutionPlan(editor));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_BuildExecutionPlan)->Apply(GraphSizes);
+
+    // One data wire added and removed per iteration, each edit followed by the plan the next run needs
+    void BM_PatchExecutionPlan(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        BuildGraph(editor, state);
+        const auto last = static_cast<Nodes::NodeId>(state.range(0));
+        benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::AcquirePlan(editor));
+        for (auto _ : state)
+        {
+            editor.AddConnection(1, "Output", last, "B");
+            benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::AcquirePlan(editor));
+            benchmark::DoNotOptimize(editor.RemoveConnection(1, "Output", last, "B"));
+            benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::AcquirePlan(editor));
+        }
+        state.SetItemsProcessed(state.iterations() * 2);
+    }
+    BENCHMARK(BM_PatchExecutionPlan)->Apply(GraphSizes);
+
+    // Whole runs of trivial nodes: the engine's fixed cost per node
+    void BM_ExecuteAllDirty(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        BuildGraph(editor, state);
+        editor.SetOutputCacheEnabled(false);
+        for (auto _ : state)
+        {
+            editor.MarkAllNodesDirty();
+            benchmark::DoNotOptimize(editor.Execute());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_ExecuteAllDirty)->Apply(GraphSizes);
+
+} // namespace
@@ -0,0 +1,96 @@
+#include "BenchmarkGraphs.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "UI/Canvas/CanvasController.h"
+#include "UI/Canvas/ConnectionManager.h"
+#include "UI/Canvas/NodeSpatialIndex.h"
+#include "Vision/Factory/GraphGenerator.h"
+#include "Vision/Factory/NodeFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Random graphs of every registered node type, from 10 to 100k nodes
+    void GeneratedSizes(benchmark::internal::Benchmark *benchmark)
+    {
+        for (const int64_t nodeCount : { 10, 100, 1'000, 10'000, 100'000 })
+        {
+            benchmark->Args({ nodeCount });
+        }
+        benchmark->ArgNames({ "nodes" })->Unit(benchmark::kMicrosecond);
+    }
+
+    Vision::GraphGeneratorOptions MakeOptions(const benchmark::State &state)
+    {
+        Vision::NodeFactory::RegisterAllNodes();
+        return { .nodeCount = static_cast<size_t>(state.range(0)) };
+    }
+
+    void BM_GeneratedBuildExecutionPlan(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        (void)Vision::GraphGenerator::Generate(editor, MakeOptions(state));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(Nodes::NodeEditorBenchmarkAccess::BuildExecutionPlan(editor));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_GeneratedBuildExecutionPlan)->Apply(GeneratedSizes);
+
+    void BM_GeneratedLoadFromFile(benchmark::State &state)
+    {
+        auto path = std::filesystem::temp_directory_path() / "vc_bench_generated";
+        path += Constants::Persistence::kBinaryGraphExtension;
+        (void)Vision::GraphGenerator::GenerateFile(path, MakeOptions(state));
+
+        Nodes::NodeEditor editor;
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(editor.LoadFromFile(path, positions));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+    BENCHMARK(BM_GeneratedLoadFromFile)->Apply(GeneratedSizes);
+
+    // One pin lookup per iteration at a node pin spread over the canvas, through the spatial index
+    void BM_GeneratedPinHitTest(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        const auto generated = Vision::GraphGenerator::Generate(editor, MakeOptions(state));
+
+        UI::Canvas::CanvasController canvas;
+        UI::Canvas::ConnectionManager connectionManager;
+        UI::Canvas::NodeSpatialIndex nodeIndex;
+        std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> nodePositions;
+        std::vector<ImVec2> probes;
+        for (const auto &[id, position] : generated->positions)
+        {
+            nodePositions[id] = { position.first, position.second };
+            nodeIndex.Update(id,
+                ImVec2(position.first, position.second),
+                ImVec2(Constants::Node::kWidth, Constants::Node::kMinHeight * 2.0f));
+            probes.push_back(canvas.WorldToScreen(ImVec2(position.first + Constants::Node::kPadding,
+                position.second + Constants::Node::kTitleHeight + Constants::Node::kPadding)));
+        }
+
+        size_t probe = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(
+                connectionManager.FindPinAtPosition(probes[probe], editor, nodePositions, nodeIndex, canvas));
+            probe = (probe + 1) % probes.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK(BM_GeneratedPinHitTest)->Apply(GeneratedSizes);
+
+} // namespace
@@ -0,0 +1,65 @@
+#include "BenchmarkGraphs.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Vision/Factory/NodeFactory.h"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Layered graphs up to the JSON node limit, saved in both formats
+    void GraphFileSizes(benchmark::internal::Benchmark *benchmark)
+    {
+        for (const int64_t binary : { 0, 1 })
+        {
+            for (const int64_t nodeCount : { 100, 1'000, 10'000 })
+            {
+                benchmark->Args({ nodeCount, binary });
+            }
+        }
+        benchmark->ArgNames({ "nodes", "binary" })->Unit(benchmark::kMillisecond);
+    }
+
+    // Saves a layered synthetic graph with one position per node and returns the file
+    std::filesystem::path SaveSyntheticGraph(const benchmark::State &state)
+    {
+        Vision::NodeFactory::Register("PassThroughNode", [](Nodes::NodeId id, std::string_view name) {
+            return std::make_unique<Benchmarks::PassThroughNode>(id, std::string(name));
+        });
+
+        Nodes::NodeEditor editor;
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        Benchmarks::BuildSyntheticGraph(editor, nodeCount, Benchmarks::GraphShape::Layered);
+
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+        for (const auto id : editor.GetNodeIds())
+        {
+            positions[id] = { static_cast<float>(id % 100) * 200.0f, static_cast<float>(id / 100) * 150.0f };
+        }
+
+        auto path = std::filesystem::temp_directory_path() / "vc_bench_graph";
+        path += state.range(1) != 0 ? Constants::Persistence::kBinaryGraphExtension : ".json";
+        (void)editor.SaveToFile(path, positions);
+        return path;
+    }
+
+    void BM_LoadGraphFile(benchmark::State &state)
+    {
+        const auto path = SaveSyntheticGraph(state);
+        Nodes::NodeEditor editor;
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(editor.LoadFromFile(path, positions));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        std::filesystem::remove(path);
+    }
+    BENCHMARK(BM_LoadGraphFile)->Apply(GraphFileSizes);
+
+} // namespace
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Nodes/Core/NodeEditor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Exposes NodeEditor internals that benchmarks time in isolation.
+     */
+    struct NodeEditorBenchmarkAccess
+    {
+        /**
+         * @brief Runs the topological sort of the current graph.
+         * @param editor Editor holding the graph
+         * @return Node IDs in execution order
+         */
+        [[nodiscard]] static std::vector<NodeId> TopologicalSort(const NodeEditor &editor)
+        {
+            return editor.TopologicalSort();
+        }
+
+        /**
+         * @brief Compiles the current graph into an execution plan.
+         * @param editor Editor holding the graph
+         * @return Number of plan steps
+         */
+        [[nodiscard]] static size_t BuildExecutionPlan(const NodeEditor &editor)
+        {
+            return editor.BuildExecutionPlan().size();
+        }
+
+        /**
+         * @brief Takes the snapshot the next run would execute, patching or compiling its plan as needed.
+         * @param editor Editor holding the graph
+         * @return Number of plan steps
+         */
+        [[nodiscard]] static size_t AcquirePlan(NodeEditor &editor)
+        {
+            return editor.AcquireSnapshot()->plan.size();
+        }
+
+        /**
+         * @brief Follows every resolved data connection of the compiled plan once.
+         * @param editor Editor holding the graph
+         * @return Number of data passes performed
+         */
+        static size_t PassAllData(NodeEditor &editor)
+        {
+            const auto graph = editor.AcquireSnapshot();
+            size_t passes = 0;
+            for (size_t stepIndex = 0; stepIndex < graph->plan.size(); ++stepIndex)
+            {
+                for (const auto &binding : graph->plan[stepIndex].inputs)
+                {
+                    const auto &connection = graph->connections[binding.connectionIndex];
+                    NodeEditor::PassDataBetweenNodes(
+                        *graph->nodes.at(connection.from), *graph->stepNodes[stepIndex], connection, binding);
+                    ++passes;
+                }
+            }
+            return passes;
+        }
+    };
+
+} // namespace VisionCraft::Nodes
+
+namespace VisionCraft::Benchmarks
+{
+    /**
+     * @brief Cheapest possible node, so graph benchmarks measure the engine rather than the work.
+     */
+    class PassThroughNode : public Nodes::Node
+    {
+    public:
+        PassThroughNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("A", 0.0);
+            CreateInputSlot("B", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "PassThroughNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData(
+                "Output", GetInputValue<double>("A").value_or(0.0) + GetInputValue<double>("B").value_or(0.0));
+        }
+    };
+
+    /**
+     * @brief Shape of a synthetic benchmark graph.
+     */
+    enum class GraphShape
+    {
+        Chain,  ///< Every node feeds the next one (plan depth equals node count)
+        Layered ///< Roughly square grid; each node reads two nodes of the previous layer
+    };
+
+    /**
+     * @brief Fills an editor with a synthetic graph of pass-through nodes.
+     * @param editor Empty editor to fill
+     * @param nodeCount Number of nodes
+     * @param shape Graph topology
+     */
+    inline void BuildSyntheticGraph(Nodes::NodeEditor &editor, size_t nodeCount, GraphShape shape)
+    {
+        const size_t width =
+            shape == GraphShape::Chain
+                ? 1
+                : std::max<size_t>(1, static_cast<size_t>(std::sqrt(static_cast<double>(nodeCount))));
+
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            const auto id = static_cast<Nodes::NodeId>(i + 1);
+            editor.AddNode(std::make_unique<PassThroughNode>(id, "Node " + std::to_string(id)));
+            if (i < width)
+            {
+                continue;
+            }
+
+            // Node i sits below node i - width; the second input comes from that node's neighbour
+            const size_t column = i % width;
+            const auto above = static_cast<Nodes::NodeId>(i - width + 1);
+            editor.AddConnection(above, "Output", id, "A");
+            if (width > 1)
+            {
+                const auto diagonal = static_cast<Nodes::NodeId>(i - width - column + (column + 1) % width + 1);
+                editor.AddConnection(diagonal, "Output", id, "B");
+            }
+        }
+    }
+
+} // namespace VisionCraft::Benchmarks
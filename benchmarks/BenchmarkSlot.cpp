@@ -0,0 +1,120 @@
+#include "BenchmarkGraphs.h"
+#include "Nodes/Core/Slot.h"
+
+#include <benchmark/benchmark.h>
+#include <opencv2/opencv.hpp>
+#include <filesystem>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // ============================================================================
+    // Slot Access
+    // ============================================================================
+
+    void BM_SlotSetDataDouble(benchmark::State &state)
+    {
+        Nodes::Slot slot;
+        double value = 0.0;
+        for (auto _ : state)
+        {
+            slot.SetData(value);
+            value += 1.0;
+        }
+    }
+    BENCHMARK(BM_SlotSetDataDouble);
+
+    void BM_SlotSetDataMat(benchmark::State &state)
+    {
+        Nodes::Slot slot;
+        const cv::Mat image(1080, 1920, CV_8UC3, cv::Scalar(0, 0, 0));
+        for (auto _ : state)
+        {
+            slot.SetData(image);
+        }
+    }
+    BENCHMARK(BM_SlotSetDataMat);
+
+    void BM_SlotGetValueOrDefaultData(benchmark::State &state)
+    {
+        Nodes::Slot slot(Nodes::NodeData{ 1.0 });
+        slot.SetData(2.0);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slot.GetValueOrDefault<double>());
+        }
+    }
+    BENCHMARK(BM_SlotGetValueOrDefaultData);
+
+    void BM_SlotGetValueOrDefaultFallback(benchmark::State &state)
+    {
+        Nodes::Slot slot(Nodes::NodeData{ 1.0 });
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slot.GetValueOrDefault<double>());
+        }
+    }
+    BENCHMARK(BM_SlotGetValueOrDefaultFallback);
+
+    void BM_SlotGetValueOrDefaultIfMat(benchmark::State &state)
+    {
+        Nodes::Slot slot;
+        slot.SetData(cv::Mat(1080, 1920, CV_8UC3, cv::Scalar(0, 0, 0)));
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slot.GetValueOrDefaultIf<cv::Mat>());
+        }
+    }
+    BENCHMARK(BM_SlotGetValueOrDefaultIfMat);
+
+    // Path long enough to defeat the small-string optimization, as real file paths do
+    const std::filesystem::path kLongPath = "/data/projects/vision_craft/inputs/session_0042/frame_000123.png";
+
+    void BM_SlotGetValueOrDefaultPath(benchmark::State &state)
+    {
+        Nodes::Slot slot(Nodes::NodeData{ kLongPath });
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(slot.GetValueOrDefault<std::filesystem::path>());
+        }
+    }
+    BENCHMARK(BM_SlotGetValueOrDefaultPath);
+
+    void BM_SlotGetValueOrDefaultViewPath(benchmark::State &state)
+    {
+        Nodes::Slot slot(Nodes::NodeData{ kLongPath });
+        for (auto _ : state)
+        {
+            const auto view = slot.GetValueOrDefaultView<std::filesystem::path>();
+            benchmark::DoNotOptimize(&view.ValueOrEmpty());
+        }
+    }
+    BENCHMARK(BM_SlotGetValueOrDefaultViewPath);
+
+    // ============================================================================
+    // Data Passing
+    // ============================================================================
+
+    // Range: node count; reports the cost of one PassDataBetweenNodes call
+    void BM_PassDataBetweenNodes(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        Benchmarks::BuildSyntheticGraph(
+            editor, static_cast<size_t>(state.range(0)), Benchmarks::GraphShape::Layered);
+        if (!editor.Execute())
+        {
+            state.SkipWithError("Synthetic graph failed to execute");
+            return;
+        }
+
+        size_t passes = 0;
+        for (auto _ : state)
+        {
+            passes += Nodes::NodeEditorBenchmarkAccess::PassAllData(editor);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(passes));
+    }
+    BENCHMARK(BM_PassDataBetweenNodes)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
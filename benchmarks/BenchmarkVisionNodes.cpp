@@ -0,0 +1,159 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/Factory/NodeFactory.h"
+
+#include <benchmark/benchmark.h>
+#include <opencv2/opencv.hpp>
+#include <string_view>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // 1080p and 4K frames
+    void Resolutions(benchmark::internal::Benchmark *benchmark)
+    {
+        benchmark->Args({ 1920, 1080 })->Args({ 3840, 2160 })->ArgNames({ "width", "height" });
+        benchmark->Unit(benchmark::kMillisecond);
+    }
+
+    // Noise keeps data-dependent filters (blur, edges, thresholds) from taking shortcuts
+    cv::Mat MakeInputImage(const benchmark::State &state, int type)
+    {
+        cv::Mat image(static_cast<int>(state.range(1)), static_cast<int>(state.range(0)), type);
+        cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(256));
+        return image;
+    }
+
+    std::unique_ptr<Nodes::Node> CreateNode(std::string_view type, Nodes::NodeId id = 1)
+    {
+        static const bool registered = [] {
+            Vision::NodeFactory::RegisterAllNodes();
+            return true;
+        }();
+        (void)registered;
+        return Vision::NodeFactory::CreateNode(type, id, std::string(type));
+    }
+
+    // Times Process() of a node reading one BGR frame from its "Input" slot with default parameters
+    void BM_NodeProcess(benchmark::State &state, std::string_view type)
+    {
+        auto node = CreateNode(type);
+        if (!node)
+        {
+            state.SkipWithError("Node type is not registered");
+            return;
+        }
+
+        node->SetInputSlotData("Input", MakeInputImage(state, CV_8UC3));
+        if (type == "Resize")
+        {
+            node->SetInputSlotData("ScaleX", 0.5);
+            node->SetInputSlotData("ScaleY", 0.5);
+        }
+
+        for (auto _ : state)
+        {
+            node->Process();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    }
+    BENCHMARK_CAPTURE(BM_NodeProcess, CannyEdge, "CannyEdge")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, CvtColor, "CvtColor")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Grayscale, "Grayscale")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, ImageOutput, "ImageOutput")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, MedianBlur, "MedianBlur")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Morphology, "Morphology")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Preview, "Preview")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Resize, "Resize")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Sobel, "Sobel")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, SplitChannels, "SplitChannels")->Apply(Resolutions);
+    BENCHMARK_CAPTURE(BM_NodeProcess, Threshold, "Threshold")->Apply(Resolutions);
+
+    // MergeChannels reads single-channel planes instead of a BGR frame
+    void BM_MergeChannelsProcess(benchmark::State &state)
+    {
+        auto node = CreateNode("MergeChannels");
+        for (const auto *slotName : { "Channel 1", "Channel 2", "Channel 3" })
+        {
+            node->SetInputSlotData(slotName, MakeInputImage(state, CV_8UC1));
+        }
+
+        for (auto _ : state)
+        {
+            node->Process();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    }
+    BENCHMARK(BM_MergeChannelsProcess)->Apply(Resolutions);
+
+    // Range 2: tile size (0 = whole images); runs Grayscale -> MedianBlur -> Morphology -> Threshold per iteration
+    void BM_TiledChainExecute(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        editor.SetIncrementalExecution(false);
+        editor.SetOutputCacheEnabled(false);
+        const int tileSize = static_cast<int>(state.range(2));
+        editor.SetTilingOptions({ .enabled = tileSize > 0, .tileSize = tileSize, .minImagePixels = 0 });
+
+        Nodes::NodeId id = 0;
+        for (const auto *type : { "Grayscale", "MedianBlur", "Morphology", "Threshold" })
+        {
+            editor.AddNode(CreateNode(type, ++id));
+            if (id > 1)
+            {
+                editor.AddConnection(id - 1, "Output", id, "Input");
+            }
+        }
+        editor.GetNode(1)->SetInputSlotData("Input", MakeInputImage(state, CV_8UC3));
+
+        for (auto _ : state)
+        {
+            if (!editor.Execute())
+            {
+                state.SkipWithError("Chain failed to execute");
+                return;
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    }
+    BENCHMARK(BM_TiledChainExecute)
+        ->ArgsProduct({ { 3840 }, { 2160 }, { 0, 256, 512 } })
+        ->ArgNames({ "width", "height", "tile" })
+        ->Unit(benchmark::kMillisecond);
+
+    // Range 2: 1 to fuse; runs CvtColor -> Grayscale -> Threshold per iteration
+    void BM_FusedPointwiseExecute(benchmark::State &state)
+    {
+        Nodes::NodeEditor editor;
+        editor.SetIncrementalExecution(false);
+        editor.SetOutputCacheEnabled(false);
+        editor.SetTilingOptions({ .enabled = false, .fusePointwise = state.range(2) != 0 });
+
+        Nodes::NodeId id = 0;
+        for (const auto *type : { "CvtColor", "Grayscale", "Threshold" })
+        {
+            editor.AddNode(CreateNode(type, ++id));
+            if (id > 1)
+            {
+                editor.AddConnection(id - 1, "Output", id, "Input");
+            }
+        }
+        editor.GetNode(1)->SetInputSlotData("Input", MakeInputImage(state, CV_8UC3));
+        editor.GetNode(1)->SetInputSlotData("Conversion", 2); // BGR2RGB keeps three channels for Grayscale
+
+        for (auto _ : state)
+        {
+            if (!editor.Execute())
+            {
+                state.SkipWithError("Chain failed to execute");
+                return;
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    }
+    BENCHMARK(BM_FusedPointwiseExecute)
+        ->ArgsProduct({ { 3840 }, { 2160 }, { 0, 1 } })
+        ->ArgNames({ "width", "height", "fused" })
+        ->Unit(benchmark::kMillisecond);
+
+} // namespace
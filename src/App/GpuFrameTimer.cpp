@@ -0,0 +1,81 @@
+#include "App/GpuFrameTimer.h"
+
+#include <glad/glad.h>
+
+#include "UI/Rendering/FrameProfiler.h"
+
+#include <chrono>
+
+namespace VisionCraft::App
+{
+    GpuFrameTimer::~GpuFrameTimer()
+    {
+        Release();
+    }
+
+    void GpuFrameTimer::Begin(uint64_t frame)
+    {
+        auto &slot = slots[next];
+        if (slot.pending)
+        {
+            return;
+        }
+        if (slot.query == 0)
+        {
+            glGenQueries(1, &slot.query);
+        }
+
+        glBeginQuery(GL_TIME_ELAPSED, slot.query);
+        slot.frame = frame;
+        active = &slot;
+        next = (next + 1) % slots.size();
+    }
+
+    void GpuFrameTimer::End()
+    {
+        if (!active)
+        {
+            return;
+        }
+        glEndQuery(GL_TIME_ELAPSED);
+        active->pending = true;
+        active = nullptr;
+    }
+
+    void GpuFrameTimer::Collect(UI::Rendering::FrameProfiler &profiler)
+    {
+        for (auto &slot : slots)
+        {
+            if (!slot.pending)
+            {
+                continue;
+            }
+            GLint available = GL_FALSE;
+            glGetQueryObjectiv(slot.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available == GL_FALSE)
+            {
+                continue;
+            }
+
+            GLuint64 elapsedNanoseconds = 0;
+            glGetQueryObjectui64v(slot.query, GL_QUERY_RESULT, &elapsedNanoseconds);
+            slot.pending = false;
+            profiler.RecordGpuTime(slot.frame,
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::nanoseconds(elapsedNanoseconds)));
+        }
+    }
+
+    void GpuFrameTimer::Release()
+    {
+        for (auto &slot : slots)
+        {
+            if (slot.query != 0)
+            {
+                glDeleteQueries(1, &slot.query);
+            }
+            slot = Slot{};
+        }
+        active = nullptr;
+        next = 0;
+    }
+} // namespace VisionCraft::App
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <array>
+#include <cstdint>
+
+namespace VisionCraft::UI::Rendering
+{
+    class FrameProfiler;
+}
+
+namespace VisionCraft::App
+{
+    /**
+     * @brief Measures the GPU time of each frame's draw submission with OpenGL timer queries.
+     *
+     * Queries rotate through a small ring and are only read once GL reports the result available, so the
+     * CPU never waits on the GPU; a frame whose slot is still busy goes untimed. Results are handed to the
+     * UI::Rendering::FrameProfiler under the frame number they were started for. Requires a current
+     * OpenGL 3.3+ context on the calling thread.
+     */
+    class GpuFrameTimer
+    {
+    public:
+        GpuFrameTimer() = default;
+
+        ~GpuFrameTimer();
+
+        GpuFrameTimer(const GpuFrameTimer &) = delete;
+        GpuFrameTimer &operator=(const GpuFrameTimer &) = delete;
+
+        /**
+         * @brief Starts timing GPU work for a frame, unless every query is still in flight.
+         * @param frame Frame number the timing belongs to
+         */
+        void Begin(uint64_t frame);
+
+        /**
+         * @brief Stops timing the GPU work started by Begin().
+         */
+        void End();
+
+        /**
+         * @brief Passes every resolved query to the profiler without blocking.
+         * @param profiler Profiler receiving the timings
+         */
+        void Collect(UI::Rendering::FrameProfiler &profiler);
+
+        /**
+         * @brief Deletes the query objects (the context must still be current).
+         */
+        void Release();
+
+    private:
+        /**
+         * @brief One timer query and the frame it measures.
+         */
+        struct Slot
+        {
+            unsigned int query = 0; ///< GL query object (0 until created)
+            uint64_t frame = 0;     ///< Frame the query was started for
+            bool pending = false;   ///< Issued and not yet read back
+        };
+
+        std::array<Slot, Constants::FrameProfiler::kGpuQueryCount> slots{}; ///< Query ring
+        size_t next = 0;                                                    ///< Slot Begin() uses next
+        Slot *active = nullptr;                                             ///< Slot between Begin() and End()
+    };
+} // namespace VisionCraft::App
@@ -7,31 +7,64 @@
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
+#include <opencv2/core/ocl.hpp>
+#include <opencv2/opencv.hpp>
 
+#include "Nodes/Core/StartupProfile.h"
 #include "UI/Layers/DockSpaceLayer.h"
 #include "UI/Layers/GraphExecutionLayer.h"
 #include "UI/Layers/NodeEditorLayer.h"
 #include "UI/Layers/PropertyPanelLayer.h"
+#include "UI/Rendering/FramePacer.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "Logger.h"
 #include "WindowStatePersistence.h"
 
+#include <optional>
+#include <vector>
+
 namespace VisionCraft::App
 {
     VisionCraftApplication::VisionCraftApplication(const Kappa::ApplicationSpecification &specification)
-        : Kappa::Application(specification)
+        : Kappa::Application(specification), executor(std::make_shared<Nodes::ExecutorService>())
     {
         LOG_INFO("VisionCraftApplication: Starting initialization");
+        nodeEditor.SetExecutorService(executor);
+        nodeEditor.SetDuplicateElimination(true);
+
+        {
+            Nodes::StartupScope scope("Window state");
+            Kappa::WindowStatePersistence::LoadAndApply(GetWindow(), "window_state.json");
+        }
+
+        // Nothing on the first frame needs OpenCV; its thread pool, OpenCL probe and codec tables load
+        // here so the first run does not pay for them
+        executor->Post(&VisionCraftApplication::WarmUpOpenCv);
 
-        Kappa::WindowStatePersistence::LoadAndApply(GetWindow(), "window_state.json");
+        // Sleep between frames until input or a worker's wake (glfwPostEmptyEvent is thread-safe)
+        UI::Rendering::FramePacer::Get().SetPlatform(
+            { [](double timeoutSeconds) { glfwWaitEventsTimeout(timeoutSeconds); }, []() { glfwPostEmptyEvent(); } });
 
         LOG_INFO("VisionCraftApplication: Pushing DockSpaceLayer");
-        PushLayer<UI::Layers::DockSpaceLayer>();
+        {
+            Nodes::StartupScope scope("DockSpaceLayer");
+            PushLayer<UI::Layers::DockSpaceLayer>();
+        }
         LOG_INFO("VisionCraftApplication: Pushing NodeEditorLayer");
-        PushLayer<UI::Layers::NodeEditorLayer>(nodeEditor);
+        {
+            Nodes::StartupScope scope("NodeEditorLayer");
+            PushLayer<UI::Layers::NodeEditorLayer>(nodeEditor);
+        }
         LOG_INFO("VisionCraftApplication: Pushing PropertyPanelLayer");
-        PushLayer<UI::Layers::PropertyPanelLayer>();
+        {
+            Nodes::StartupScope scope("PropertyPanelLayer");
+            PushLayer<UI::Layers::PropertyPanelLayer>();
+        }
         LOG_INFO("VisionCraftApplication: Pushing GraphExecutionLayer");
-        PushLayer<UI::Layers::GraphExecutionLayer>(nodeEditor);
+        {
+            Nodes::StartupScope scope("GraphExecutionLayer");
+            PushLayer<UI::Layers::GraphExecutionLayer>(nodeEditor);
+        }
         LOG_INFO("VisionCraftApplication: Initialization complete");
     }
 
@@ -60,11 +93,24 @@ namespace VisionCraft::App
         if (!imguiInitialized)
         {
             LOG_INFO("VisionCraftApplication: Initializing ImGui");
+            Nodes::StartupScope scope("ImGui setup");
             InitializeImGui();
             imguiInitialized = true;
             LOG_INFO("VisionCraftApplication: ImGui initialized successfully");
         }
+        else
+        {
+            // Events received while waiting reach ImGui through the GLFW callbacks before NewFrame()
+            UI::Rendering::FramePacer::Get().WaitForNextFrame();
+        }
+        UI::Rendering::FrameProfiler::Get().BeginFrame();
 
+        // The first NewFrame() builds the font atlas and uploads it
+        std::optional<Nodes::StartupScope> fontScope;
+        if (!firstFramePresented)
+        {
+            fontScope.emplace("ImGui fonts");
+        }
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
@@ -78,8 +124,27 @@ namespace VisionCraft::App
             auto framebufferSize = GetFramebufferSize();
             io.DisplaySize = ImVec2(framebufferSize.x, framebufferSize.y);
 
+            // Held widgets (text cursors, dragged sliders) animate without new events
+            if (ImGui::IsAnyItemActive())
+            {
+                UI::Rendering::FramePacer::Get().RequestFrames();
+            }
+
             ImGui::Render();
+
+            auto &profiler = UI::Rendering::FrameProfiler::Get();
+            const bool profiling = profiler.IsEnabled();
+            UI::Rendering::DrawStats drawStats;
+            if (profiling)
+            {
+                drawStats = UI::Rendering::FrameProfiler::MeasureDrawData();
+                gpuTimer.Begin(profiler.GetCurrentFrame());
+            }
             ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            if (profiling)
+            {
+                gpuTimer.End();
+            }
 
             if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
             {
@@ -88,6 +153,18 @@ namespace VisionCraft::App
                 ImGui::RenderPlatformWindowsDefault();
                 glfwMakeContextCurrent(backup_current_context);
             }
+
+            if (profiling)
+            {
+                gpuTimer.Collect(profiler);
+                profiler.EndFrame(drawStats);
+            }
+
+            if (!firstFramePresented)
+            {
+                firstFramePresented = true;
+                Nodes::StartupProfile::Get().MarkReady();
+            }
         }
     }
 
@@ -127,9 +204,32 @@ namespace VisionCraft::App
         LOG_INFO("InitializeImGui: Complete");
     }
 
+    void VisionCraftApplication::WarmUpOpenCv()
+    {
+        Nodes::StartupScope scope("OpenCV warm-up");
+        try
+        {
+            // Each call pays a one-time cost: thread pool start, OpenCL device probe, IPP/SIMD dispatch
+            // tables and the PNG encoder
+            (void)cv::getNumThreads();
+            (void)cv::ocl::haveOpenCL();
+            cv::Mat color(64, 64, CV_8UC3, cv::Scalar(32, 64, 128));
+            cv::Mat gray, blurred;
+            cv::cvtColor(color, gray, cv::COLOR_BGR2GRAY);
+            cv::GaussianBlur(gray, blurred, cv::Size(5, 5), 0);
+            std::vector<uchar> encoded;
+            (void)cv::imencode(".png", blurred, encoded);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_WARN("VisionCraftApplication: OpenCV warm-up failed: {}", e.what());
+        }
+    }
+
     void VisionCraftApplication::ShutdownImGui()
     {
         // TODO: Fix GLFW shutdown order - ImGui backends are calling GLFW functions after glfwTerminate()
+        gpuTimer.Release();
         ImGui_ImplOpenGL3_Shutdown();
         ImGui_ImplGlfw_Shutdown();
         ImGui::DestroyContext();
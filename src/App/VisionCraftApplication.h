@@ -1,5 +1,6 @@
 #pragma once
 
+#include "App/GpuFrameTimer.h"
 #include "Application.h"
 #include "Nodes/Core/NodeEditor.h"
 
@@ -42,7 +43,7 @@ namespace VisionCraft::App
 
     protected:
         /**
-         * @brief Initializes ImGui frame.
+         * @brief Waits until the next frame is due (see UI::Rendering::FramePacer), then starts an ImGui frame.
          */
         void BeginFrame() override;
 
@@ -62,7 +63,15 @@ namespace VisionCraft::App
          */
         void ShutdownImGui();
 
-        bool imguiInitialized = false; ///< Flag indicating if ImGui has been initialized
-        Nodes::NodeEditor nodeEditor;  ///< Shared node editor instance accessed by all layers
+        /**
+         * @brief Pays OpenCV's first-use costs on a worker so the first graph run does not.
+         */
+        static void WarmUpOpenCv();
+
+        bool imguiInitialized = false;                    ///< Flag indicating if ImGui has been initialized
+        bool firstFramePresented = false;                 ///< Set once the first frame is on screen
+        std::shared_ptr<Nodes::ExecutorService> executor; ///< Threads for runs, parallel steps and batches
+        Nodes::NodeEditor nodeEditor;                     ///< Shared node editor instance accessed by all layers
+        GpuFrameTimer gpuTimer;                           ///< GPU time of each frame for the frame profiler
     };
 } // namespace VisionCraft::App
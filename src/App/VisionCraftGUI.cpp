@@ -1,15 +1,25 @@
 #include "App/VisionCraftApplication.h"
+#include "Nodes/Core/StartupProfile.h"
+
+#include <optional>
 
 int main()
 {
+    // Startup phases are timed from here
+    (void)VisionCraft::Nodes::StartupProfile::Get();
+
     Kappa::ApplicationSpecification appSpec;
     appSpec.name = "VisionCraft";
     appSpec.windowSpecification.title = "VisionCraft - Computer Vision Node Editor";
     appSpec.windowSpecification.width = 1920;
     appSpec.windowSpecification.height = 1080;
 
-    VisionCraft::App::VisionCraftApplication app(appSpec);
-    app.Run();
+    std::optional<VisionCraft::App::VisionCraftApplication> app;
+    {
+        VisionCraft::Nodes::StartupScope scope("Application construction");
+        app.emplace(appSpec);
+    }
+    app->Run();
 
     return 0;
 }
@@ -0,0 +1,817 @@
+#include "CLI/CommandLineOptions.h"
+#include "Nodes/Core/NodeTypeRegistry.h"
+
+#include <algorithm>
+#include <charconv>
+
+namespace VisionCraft::CLI
+{
+    namespace
+    {
+        constexpr std::string_view kImageInputType = "ImageInputNode";
+        constexpr std::string_view kImageOutputType = "ImageOutputNode";
+        constexpr std::string_view kVideoInputType = "VideoInputNode";
+
+        template<typename T> std::optional<T> ParseNumber(std::string_view text)
+        {
+            T value{};
+            const auto *end = text.data() + text.size();
+            const auto [ptr, ec] = std::from_chars(text.data(), end, value);
+            if (ec != std::errc{} || ptr != end || text.empty())
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        std::optional<bool> ParseBool(std::string_view text)
+        {
+            if (text == "true" || text == "1" || text == "on")
+            {
+                return true;
+            }
+            if (text == "false" || text == "0" || text == "off")
+            {
+                return false;
+            }
+            return std::nullopt;
+        }
+
+        // Accepts "PATH" or "ID=PATH"; a prefix that is not a number belongs to the path
+        PathOverride ParsePathOverride(std::string_view text)
+        {
+            if (const auto separator = text.find('='); separator != std::string_view::npos)
+            {
+                if (const auto id = ParseNumber<Nodes::NodeId>(text.substr(0, separator)))
+                {
+                    return { id, std::filesystem::path(text.substr(separator + 1)) };
+                }
+            }
+            return { std::nullopt, std::filesystem::path(text) };
+        }
+
+        // Converts text to the type the slot currently holds (connected data or default)
+        std::optional<Nodes::NodeData> ConvertToSlotType(const Nodes::NodeData &current, const std::string &text)
+        {
+            if (std::holds_alternative<int>(current))
+            {
+                return ParseNumber<int>(text);
+            }
+            if (std::holds_alternative<double>(current))
+            {
+                return ParseNumber<double>(text);
+            }
+            if (std::holds_alternative<float>(current))
+            {
+                return ParseNumber<float>(text);
+            }
+            if (std::holds_alternative<bool>(current))
+            {
+                return ParseBool(text);
+            }
+            if (std::holds_alternative<std::string>(current))
+            {
+                return Nodes::NodeData{ text };
+            }
+            if (std::holds_alternative<std::filesystem::path>(current))
+            {
+                return Nodes::NodeData{ std::filesystem::path(text) };
+            }
+            return std::nullopt;
+        }
+
+        // Resolves the override target: the given node, or the graph's only node of the requested type
+        Nodes::Node *FindPathTarget(Nodes::NodeEditor &editor,
+            const PathOverride &pathOverride,
+            std::string_view nodeType,
+            std::string &error)
+        {
+            const auto typeId = Nodes::NodeTypeRegistry::Intern(nodeType);
+            if (pathOverride.nodeId)
+            {
+                auto *node = editor.GetNode(*pathOverride.nodeId);
+                if (!node || node->GetTypeId() != typeId)
+                {
+                    error = "Node " + std::to_string(*pathOverride.nodeId) + " is not a " + std::string(nodeType);
+                    return nullptr;
+                }
+                return node;
+            }
+
+            Nodes::Node *match = nullptr;
+            for (const auto id : editor.GetNodeIds())
+            {
+                auto *node = editor.GetNode(id);
+                if (node && node->GetTypeId() == typeId)
+                {
+                    if (match)
+                    {
+                        error = "Graph has several " + std::string(nodeType) + "s; use ID=PATH to pick one";
+                        return nullptr;
+                    }
+                    match = node;
+                }
+            }
+
+            if (!match)
+            {
+                error = "Graph has no " + std::string(nodeType);
+            }
+            return match;
+        }
+    } // namespace
+
+    std::optional<ParameterOverride> ParseParameterOverride(std::string_view text)
+    {
+        const auto dot = text.find('.');
+        const auto equals = text.find('=', dot == std::string_view::npos ? 0 : dot);
+        if (dot == std::string_view::npos || equals == std::string_view::npos || equals == dot + 1)
+        {
+            return std::nullopt;
+        }
+
+        const auto id = ParseNumber<Nodes::NodeId>(text.substr(0, dot));
+        if (!id)
+        {
+            return std::nullopt;
+        }
+
+        return ParameterOverride{ .nodeId = *id,
+            .slotName = std::string(text.substr(dot + 1, equals - dot - 1)),
+            .value = std::string(text.substr(equals + 1)) };
+    }
+
+    std::optional<CommandLineOptions> ParseCommandLine(std::span<const std::string_view> args, std::string &error)
+    {
+        CommandLineOptions options;
+        std::optional<size_t> instances;
+
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+            const auto arg = args[i];
+            const auto nextValue = [&]() -> std::optional<std::string_view> {
+                if (i + 1 >= args.size())
+                {
+                    error = "Option " + std::string(arg) + " requires a value";
+                    return std::nullopt;
+                }
+                return args[++i];
+            };
+
+            if (arg == "-h" || arg == "--help")
+            {
+                options.showHelp = true;
+                return options;
+            }
+            else if (arg == "-i" || arg == "--input")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.inputs.push_back(ParsePathOverride(*value));
+            }
+            else if (arg == "-o" || arg == "--output")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.outputs.push_back(ParsePathOverride(*value));
+            }
+            else if (arg == "-s" || arg == "--set")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                auto parameter = ParseParameterOverride(*value);
+                if (!parameter)
+                {
+                    error = "Invalid parameter '" + std::string(*value) + "', expected ID.SLOT=VALUE";
+                    return std::nullopt;
+                }
+                options.parameters.push_back(std::move(*parameter));
+            }
+            else if (arg == "-p" || arg == "--parallel")
+            {
+                options.parallel = true;
+            }
+            else if (arg == "-j" || arg == "--workers")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                const auto count = ParseNumber<size_t>(*value);
+                if (!count)
+                {
+                    error = "Invalid worker count '" + std::string(*value) + "'";
+                    return std::nullopt;
+                }
+                options.workerCount = *count;
+                options.parallel = true;
+            }
+            else if (arg == "--pin-threads")
+            {
+                options.pinThreads = true;
+            }
+            else if (arg == "--numa")
+            {
+                options.numaAware = true;
+            }
+            else if (arg == "--max-cores")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                const auto cores = ParseNumber<size_t>(*value);
+                if (!cores || *cores == 0)
+                {
+                    error = "Invalid core count '" + std::string(*value) + "'";
+                    return std::nullopt;
+                }
+                options.maxCores = *cores;
+            }
+            else if (arg == "--memory-budget")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                const auto megabytes = ParseNumber<size_t>(*value);
+                if (!megabytes || *megabytes == 0)
+                {
+                    error = "Invalid memory budget '" + std::string(*value) + "'";
+                    return std::nullopt;
+                }
+                options.memoryBudgetBytes = *megabytes * 1024 * 1024;
+            }
+            else if (arg == "--scratch-dir")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.scratchDirectory = std::filesystem::path(*value);
+            }
+            else if (arg == "-b" || arg == "--batch" || arg == "--batch-output")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                (arg == "--batch-output" ? options.batchOutput : options.batchInput) = ParsePathOverride(*value);
+            }
+            else if (arg == "--video")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.videos.push_back(ParsePathOverride(*value));
+                options.stream = true;
+            }
+            else if (arg == "--stream")
+            {
+                options.stream = true;
+            }
+            else if (arg == "--frames")
+            {
+                const auto value = nextValue();
+                const auto count = value ? ParseNumber<size_t>(*value) : std::nullopt;
+                if (!count || *count == 0)
+                {
+                    error = "Invalid frame count";
+                    return std::nullopt;
+                }
+                options.maxFrames = *count;
+                options.stream = true;
+            }
+            else if (arg == "-r" || arg == "--recursive")
+            {
+                options.recursive = true;
+            }
+            else if (arg == "--format")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.outputFormat = std::string(*value);
+            }
+            else if (arg == "--io-workers")
+            {
+                const auto value = nextValue();
+                const auto count = value ? ParseNumber<size_t>(*value) : std::nullopt;
+                if (!count || *count == 0)
+                {
+                    error = "Invalid I/O worker count";
+                    return std::nullopt;
+                }
+                options.ioWorkers = *count;
+            }
+            else if (arg == "--manifest")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.manifestPath = std::filesystem::path(*value);
+            }
+            else if (arg == "--farm-coordinator" || arg == "--farm-worker")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                (arg == "--farm-worker" ? options.farmWorker : options.farmCoordinator) = std::filesystem::path(*value);
+            }
+            else if (arg == "--shard-size")
+            {
+                const auto value = nextValue();
+                const auto count = value ? ParseNumber<size_t>(*value) : std::nullopt;
+                if (!count || *count == 0)
+                {
+                    error = "Invalid shard size";
+                    return std::nullopt;
+                }
+                options.shardFiles = *count;
+            }
+            else if (arg == "--worker-name")
+            {
+                const auto value = nextValue();
+                if (!value || value->empty())
+                {
+                    error = "Option --worker-name requires a value";
+                    return std::nullopt;
+                }
+                options.workerName = std::string(*value);
+            }
+            else if (arg == "--serve")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                const auto colon = value->rfind(':');
+                const auto port = ParseNumber<uint16_t>(colon == std::string_view::npos ? *value
+                                                                                         : value->substr(colon + 1));
+                if (!port || colon == 0)
+                {
+                    error = "Invalid server address '" + std::string(*value) + "', expected [HOST:]PORT";
+                    return std::nullopt;
+                }
+                options.server = ServerOptions{ .port = *port };
+                if (colon != std::string_view::npos)
+                {
+                    options.server->address = std::string(value->substr(0, colon));
+                }
+            }
+            else if (arg == "--instances")
+            {
+                const auto value = nextValue();
+                instances = value ? ParseNumber<size_t>(*value) : std::nullopt;
+                if (!instances || *instances == 0)
+                {
+                    error = "Invalid instance count";
+                    return std::nullopt;
+                }
+            }
+            else if (arg == "--tile-size")
+            {
+                const auto value = nextValue();
+                const auto size = value ? ParseNumber<int>(*value) : std::nullopt;
+                if (!size || *size <= 0)
+                {
+                    error = "Invalid tile size";
+                    return std::nullopt;
+                }
+                options.tileSize = *size;
+            }
+            else if (arg == "--opencl")
+            {
+                options.opencl = true;
+            }
+            else if (arg == "--cuda")
+            {
+                options.cuda = true;
+            }
+            else if (arg == "--precision")
+            {
+                const auto value = nextValue();
+                const auto policy = value ? Nodes::ParsePrecisionPolicy(*value) : std::nullopt;
+                if (!policy)
+                {
+                    error = "Invalid precision policy, expected native, 8u, 16 or 32f";
+                    return std::nullopt;
+                }
+                options.precision = *policy;
+            }
+            else if (arg == "--timeout")
+            {
+                const auto value = nextValue();
+                const auto milliseconds = value ? ParseNumber<int64_t>(*value) : std::nullopt;
+                if (!milliseconds || *milliseconds <= 0)
+                {
+                    error = "Invalid timeout";
+                    return std::nullopt;
+                }
+                options.timeout = std::chrono::milliseconds(*milliseconds);
+            }
+            else if (arg == "--trace")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.tracePath = std::filesystem::path(*value);
+            }
+            else if (arg == "--metrics-file")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.metricsPath = std::filesystem::path(*value);
+            }
+            else if (arg == "--metrics-interval")
+            {
+                const auto value = nextValue();
+                const auto seconds = value ? ParseNumber<int64_t>(*value) : std::nullopt;
+                if (!seconds || *seconds <= 0)
+                {
+                    error = "Invalid metrics interval";
+                    return std::nullopt;
+                }
+                options.metricsInterval = std::chrono::seconds(*seconds);
+            }
+            else if (arg == "--cache-dir")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.cacheDirectory = std::filesystem::path(*value);
+            }
+            else if (arg == "--record" || arg == "--replay")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                (arg == "--replay" ? options.replayBundle : options.recordBundle) = std::filesystem::path(*value);
+            }
+            else if (arg == "--runs")
+            {
+                const auto value = nextValue();
+                const auto count = value ? ParseNumber<size_t>(*value) : std::nullopt;
+                if (!count || *count == 0)
+                {
+                    error = "Invalid run count";
+                    return std::nullopt;
+                }
+                options.timedRuns = *count;
+            }
+            else if (arg == "--slowdown")
+            {
+                const auto value = nextValue();
+                const auto percent = value ? ParseNumber<double>(*value) : std::nullopt;
+                if (!percent || *percent <= 0.0)
+                {
+                    error = "Invalid slowdown percentage";
+                    return std::nullopt;
+                }
+                options.slowdownPercent = *percent;
+            }
+            else if (arg == "--hash-inputs")
+            {
+                options.hashInputsOnly = true;
+            }
+            else if (arg == "--autotune")
+            {
+                options.autotune = true;
+            }
+            else if (arg == "--tuning-profile")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.tuningProfile = std::filesystem::path(*value);
+            }
+            else if (arg == "--no-tuning-profile")
+            {
+                options.ignoreTuningProfile = true;
+            }
+            else if (arg == "--export-cpp")
+            {
+                const auto value = nextValue();
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                options.exportDirectory = std::filesystem::path(*value);
+            }
+            else if (arg.starts_with("-"))
+            {
+                error = "Unknown option " + std::string(arg);
+                return std::nullopt;
+            }
+            else if (options.graphPath.empty())
+            {
+                options.graphPath = std::filesystem::path(arg);
+            }
+            else
+            {
+                error = "Unexpected argument '" + std::string(arg) + "'";
+                return std::nullopt;
+            }
+        }
+
+        if (options.metricsInterval.count() != 0 && options.metricsPath.empty())
+        {
+            error = "--metrics-interval requires --metrics-file";
+            return std::nullopt;
+        }
+
+        if (!options.scratchDirectory.empty() && options.memoryBudgetBytes == 0)
+        {
+            error = "--scratch-dir requires --memory-budget";
+            return std::nullopt;
+        }
+
+        if ((options.timedRuns != 0 && options.recordBundle.empty() && options.replayBundle.empty()
+                && !options.autotune)
+            || (options.slowdownPercent != 0.0 && options.replayBundle.empty())
+            || (options.hashInputsOnly && options.recordBundle.empty()))
+        {
+            error = "--runs needs --record, --replay or --autotune, --slowdown needs --replay, --hash-inputs needs "
+                    "--record";
+            return std::nullopt;
+        }
+
+        if (options.ignoreTuningProfile && (options.autotune || !options.tuningProfile.empty()))
+        {
+            error = "--no-tuning-profile cannot be combined with --autotune or --tuning-profile";
+            return std::nullopt;
+        }
+
+        // Replays take the graph, its parameters and its inputs from the bundle
+        if (!options.replayBundle.empty())
+        {
+            if (!options.graphPath.empty() || !options.recordBundle.empty() || !options.inputs.empty()
+                || !options.parameters.empty() || options.batchInput || options.stream || options.server
+                || !options.farmCoordinator.empty() || !options.farmWorker.empty() || options.autotune
+                || !options.exportDirectory.empty())
+            {
+                error = "--replay takes the graph, parameters and inputs from the bundle; give no GRAPH or mode";
+                return std::nullopt;
+            }
+            return options;
+        }
+
+        if (!options.farmCoordinator.empty() && !options.farmWorker.empty())
+        {
+            error = "--farm-coordinator and --farm-worker cannot be combined";
+            return std::nullopt;
+        }
+
+        // Workers take the graph and batch settings from the job directory
+        if (!options.farmWorker.empty())
+        {
+            if (!options.graphPath.empty() || options.batchInput || options.batchOutput || options.stream
+                || options.server || options.autotune || !options.exportDirectory.empty())
+            {
+                error = "--farm-worker takes the graph and batch settings from the job; give no GRAPH or mode";
+                return std::nullopt;
+            }
+            return options;
+        }
+
+        if (options.graphPath.empty())
+        {
+            error = "No graph file given";
+            return std::nullopt;
+        }
+
+        if (!options.farmCoordinator.empty() && !options.batchInput)
+        {
+            error = "--farm-coordinator requires --batch and --batch-output";
+            return std::nullopt;
+        }
+
+        // Farm jobs keep their own per-shard state
+        if (!options.manifestPath.empty() && (!options.batchInput || !options.farmCoordinator.empty()))
+        {
+            error = "--manifest requires --batch and cannot be combined with --farm-coordinator";
+            return std::nullopt;
+        }
+
+        if (options.batchInput.has_value() != options.batchOutput.has_value())
+        {
+            error = "--batch and --batch-output must be used together";
+            return std::nullopt;
+        }
+
+        if (options.stream && options.batchInput)
+        {
+            error = "Stream and batch modes cannot be combined";
+            return std::nullopt;
+        }
+
+        // Every timed run executes the whole graph once, which only single-run mode does
+        if (!options.recordBundle.empty()
+            && (options.stream || options.batchInput || options.server || !options.farmCoordinator.empty()))
+        {
+            error = "--record cannot be combined with batch, stream, farm or server modes";
+            return std::nullopt;
+        }
+
+        if (options.autotune
+            && (!options.recordBundle.empty() || options.stream || options.batchInput || options.server
+                || !options.farmCoordinator.empty()))
+        {
+            error = "--autotune cannot be combined with --record or batch, stream, farm or server modes";
+            return std::nullopt;
+        }
+
+        // Exporting only reads the graph; nothing is executed
+        if (!options.exportDirectory.empty()
+            && (!options.recordBundle.empty() || options.autotune || options.stream || options.batchInput
+                || options.server || !options.farmCoordinator.empty()))
+        {
+            error = "--export-cpp cannot be combined with --record, --autotune or batch, stream, farm or server modes";
+            return std::nullopt;
+        }
+
+        if (instances && !options.server)
+        {
+            error = "--instances requires --serve";
+            return std::nullopt;
+        }
+
+        // Requests bring the images and receive the results; every request would miss a result cache
+        if (options.server)
+        {
+            if (options.stream || options.batchInput || !options.farmCoordinator.empty() || !options.outputs.empty()
+                || !options.cacheDirectory.empty())
+            {
+                error = "--serve cannot be combined with batch, stream or farm modes, --output or --cache-dir";
+                return std::nullopt;
+            }
+            options.server->instances = instances.value_or(options.server->instances);
+        }
+
+        return options;
+    }
+
+    bool ApplyOverrides(Nodes::NodeEditor &editor, const CommandLineOptions &options, std::string &error)
+    {
+        for (const auto &input : options.inputs)
+        {
+            auto *node = FindPathTarget(editor, input, kImageInputType, error);
+            if (!node)
+            {
+                return false;
+            }
+            node->SetInputSlotDefault("FilePath", input.path);
+        }
+
+        for (const auto &video : options.videos)
+        {
+            auto *node = FindPathTarget(editor, video, kVideoInputType, error);
+            if (!node)
+            {
+                return false;
+            }
+            node->SetInputSlotDefault("FilePath", video.path);
+        }
+
+        for (const auto &output : options.outputs)
+        {
+            auto *node = FindPathTarget(editor, output, kImageOutputType, error);
+            if (!node)
+            {
+                return false;
+            }
+            node->SetInputSlotDefault("SavePath", output.path);
+            node->SetInputSlotDefault("AutoSave", true);
+        }
+
+        return std::ranges::all_of(options.parameters, [&](const ParameterOverride &parameter) {
+            return ApplyParameterOverride(editor, parameter, error);
+        });
+    }
+
+    bool ApplyParameterOverride(Nodes::NodeEditor &editor, const ParameterOverride &parameter, std::string &error)
+    {
+        auto *node = editor.GetNode(parameter.nodeId);
+        if (!node || !node->HasInputSlot(parameter.slotName))
+        {
+            error = "Node " + std::to_string(parameter.nodeId) + " has no input slot '" + parameter.slotName + "'";
+            return false;
+        }
+
+        const auto &current = node->GetInputSlot(parameter.slotName).GetResolvedVariantData();
+        auto value = ConvertToSlotType(current, parameter.value);
+        if (!value)
+        {
+            error = "Cannot assign '" + parameter.value + "' to slot '" + parameter.slotName + "' of node "
+                    + std::to_string(parameter.nodeId);
+            return false;
+        }
+        node->SetInputSlotDefault(parameter.slotName, std::move(*value));
+        return true;
+    }
+
+    std::string GetUsage(std::string_view programName)
+    {
+        return "Usage: " + std::string(programName)
+               + " GRAPH [options]\n"
+                 "\n"
+                 "Loads a saved VisionCraft graph and executes it without a window.\n"
+                 "\n"
+                 "Options:\n"
+                 "  -i, --input [ID=]PATH    Image file for ImageInputNode ID (or the only input node)\n"
+                 "  -o, --output [ID=]PATH   Save path for ImageOutputNode ID (or the only output node)\n"
+                 "  -s, --set ID.SLOT=VALUE  Override an input slot default (converted to the slot's type)\n"
+                 "  -p, --parallel           Run independent branches concurrently\n"
+                 "  -j, --workers N          Worker threads for parallel execution (implies --parallel)\n"
+                 "      --pin-threads        Pin each parallel worker to its own CPU core\n"
+                 "      --numa               Bind workers and runs to NUMA nodes, keeping each run on one socket\n"
+                 "      --max-cores N        Use at most N cores for graph workers and OpenCV together\n"
+                 "      --memory-budget MB   Spill intermediate images to disk beyond MB megabytes of slot data\n"
+                 "      --scratch-dir DIR    Directory for spilled images (default: system temporary directory)\n"
+                 "      --tile-size N        Process large images in NxN tiles on all cores\n"
+                 "      --opencl             Keep images in OpenCL device memory between supporting nodes\n"
+                 "      --cuda               Run nodes with a CUDA variant on the GPU (CUDA builds)\n"
+                 "      --precision P        Intermediate depth: native, 8u, 16 (16-bit/half floats) or 32f\n"
+                 "      --trace FILE         Record a Chrome trace of the run (open in ui.perfetto.dev)\n"
+                 "      --metrics-file FILE  Keep Prometheus metrics in FILE (node_exporter textfile format)\n"
+                 "      --metrics-interval S Seconds between rewrites of the metrics file (default: 15)\n"
+                 "      --cache-dir DIR      Reuse node results from earlier runs stored in DIR\n"
+                 "      --timeout MS         Stop a run (in batch mode: a file) that takes longer than MS ms\n"
+                 "\n"
+                 "Performance regression (compare a new build against a recorded run):\n"
+                 "      --record BUNDLE    Run the graph several times and save it, its inputs and timings\n"
+                 "      --hash-inputs      Record only hashes of the input images, not copies\n"
+                 "      --replay BUNDLE    Run a recorded graph and report nodes slower than recorded (no GRAPH)\n"
+                 "      --runs N           Timed runs; node times are medians (default: 5)\n"
+                 "      --slowdown PCT     Report nodes more than PCT percent slower (default: 20)\n"
+                 "\n"
+                 "Tuning (the profile is loaded at startup; explicit options above take precedence):\n"
+                 "      --autotune              Benchmark GRAPH under different execution settings and save the\n"
+                 "                              fastest to the tuning profile (--runs sets runs per setting)\n"
+                 "      --tuning-profile FILE   Profile to load or write (default: per-user config directory)\n"
+                 "      --no-tuning-profile     Start without loading the tuning profile\n"
+                 "\n"
+                 "Export (parameters, including --set overrides, are baked in; nothing is executed):\n"
+                 "      --export-cpp DIR   Compile GRAPH into a C++ library (header, source, CMakeLists.txt) in DIR\n"
+                 "\n"
+                 "Batch mode (decode, execute and encode overlap as pipeline stages):\n"
+                 "  -b, --batch [ID=]DIR         Process every image in DIR through ImageInputNode ID\n"
+                 "      --batch-output [ID=]DIR  Write ImageOutputNode ID results to DIR (required with --batch)\n"
+                 "  -r, --recursive              Include subdirectories\n"
+                 "      --format EXT             Output file format (default: the output node's Format)\n"
+                 "      --io-workers N           Decode and encode threads per stage\n"
+                 "      --manifest FILE          Record progress in FILE; rerun with it to resume\n"
+                 "\n"
+                 "Farm mode (a batch shared by workers on machines that mount the same storage):\n"
+                 "      --farm-coordinator JOB  Create job directory JOB for the batch and wait until it is done\n"
+                 "      --shard-size N          Files per shard a worker claims (default: 64)\n"
+                 "      --farm-worker JOB       Process shards of JOB until none are left (no GRAPH needed)\n"
+                 "      --worker-name NAME      Worker name in JOB (default: host name and process ID)\n"
+                 "\n"
+                 "Stream mode (the graph runs once per frame; parallel mode overlaps frames):\n"
+                 "      --video [ID=]PATH  Video file for VideoInputNode ID (implies --stream)\n"
+                 "      --stream           Run until the graph's stream source runs out of frames\n"
+                 "      --frames N         Stop after N frames (implies --stream)\n"
+                 "\n"
+                 "Server mode (the graph stays loaded; each HTTP request runs it on one image):\n"
+                 "      --serve [HOST:]PORT  Listen on HOST (default: 127.0.0.1) for /run, /health and /metrics\n"
+                 "      --instances N        Graph copies executing requests at once (default: 2)\n"
+                 "\n"
+                 "  -h, --help               Show this message\n";
+    }
+
+} // namespace VisionCraft::CLI
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CLI/GraphServer.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace VisionCraft::CLI
+{
+    /**
+     * @brief File path assigned to an image input or output node.
+     */
+    struct PathOverride
+    {
+        std::optional<Nodes::NodeId> nodeId; ///< Target node (empty = the graph's only node of that kind)
+        std::filesystem::path path;          ///< Path to assign
+    };
+
+    /**
+     * @brief Replacement for an input slot default.
+     */
+    struct ParameterOverride
+    {
+        Nodes::NodeId nodeId = 0; ///< Target node
+        std::string slotName;     ///< Input slot name
+        std::string value;        ///< Unparsed value, converted to the slot's current type
+    };
+
+    /**
+     * @brief Parsed command line of the headless runner.
+     */
+    struct CommandLineOptions
+    {
+        std::filesystem::path graphPath;           ///< Graph file to load
+        std::vector<PathOverride> inputs;          ///< ImageInputNode file paths
+        std::vector<PathOverride> outputs;         ///< ImageOutputNode save paths (enable AutoSave)
+        std::vector<ParameterOverride> parameters; ///< Arbitrary slot default overrides
+        std::vector<PathOverride> videos;          ///< VideoInputNode file paths (imply stream)
+        bool parallel = false;                     ///< Use ExecutionMode::Parallel
+        size_t workerCount = 0;                    ///< Parallel worker count (0 = hardware)
+        bool pinThreads = false;                   ///< Pin parallel workers to CPU cores
+        bool numaAware = false;                    ///< Bind workers and job threads to NUMA nodes
+        size_t maxCores = 0;                       ///< Cores for workers and OpenCV together (0 = all)
+        size_t memoryBudgetBytes = 0;              ///< Slot data and cache limit before spilling (0 = none)
+        std::filesystem::path scratchDirectory;    ///< Spill directory parent (empty = system temporary)
+        int tileSize = 0;                          ///< Tile edge for large images (0 = no tiling)
+        bool opencl = false;                       ///< Keep images on the OpenCL device between nodes
+        bool cuda = false;                         ///< Create CUDA variants of the graph's nodes
+        Nodes::PrecisionPolicy precision{};        ///< Depth of intermediate images (Native = each node's own)
+        std::optional<PathOverride> batchInput;    ///< Directory to batch process (ID selects the input node)
+        std::optional<PathOverride> batchOutput;   ///< Batch result directory (ID selects the output node)
+        bool recursive = false;                    ///< Include subdirectories in batch mode
+        std::string outputFormat;                  ///< Batch output extension (empty = output node's Format)
+        size_t ioWorkers = 0;                      ///< Decode/encode threads each (0 = defaults)
+        std::filesystem::path manifestPath;        ///< Batch checkpoint manifest (empty = none)
+        std::filesystem::path farmCoordinator;     ///< Job directory to create and coordinate (empty = off)
+        std::filesystem::path farmWorker;          ///< Job directory to work on (empty = off; no GRAPH needed)
+        size_t shardFiles = 0;                     ///< Files per farm shard (0 = default)
+        std::string workerName;                    ///< Farm worker name (empty = host name and process ID)
+        std::optional<ServerOptions> server;       ///< Serve the graph over HTTP (empty = run once)
+        bool stream = false;                       ///< Run frame after frame until the stream source ends
+        size_t maxFrames = 0;                      ///< Stream frame limit (0 = until the source ends)
+        std::filesystem::path tracePath;           ///< Chrome trace output file (empty = no tracing)
+        std::filesystem::path metricsPath;         ///< Prometheus metrics file kept updated (empty = none)
+        std::chrono::seconds metricsInterval{ 0 }; ///< Metrics file rewrite period (zero = default)
+        std::filesystem::path cacheDirectory;      ///< Persistent result cache (empty = memory only)
+        std::filesystem::path recordBundle;        ///< Bundle to record the run into (empty = off)
+        std::filesystem::path replayBundle;        ///< Bundle to replay against its baseline (empty = off; no GRAPH)
+        size_t timedRuns = 0;                      ///< Runs recorded or replayed (0 = default)
+        double slowdownPercent = 0.0;              ///< Replay slowdown reported as a regression (0 = default)
+        bool hashInputsOnly = false;               ///< Record input hashes instead of copies
+        bool autotune = false;                     ///< Tune execution settings on GRAPH and save the profile
+        std::filesystem::path tuningProfile;       ///< Profile to load or write (empty = per-machine default)
+        bool ignoreTuningProfile = false;          ///< Start without loading a tuning profile
+        std::filesystem::path exportDirectory;     ///< Write GRAPH compiled to C++ into it (empty = off)
+        std::chrono::milliseconds timeout{ 0 };    ///< Execution limit per run or batch file (zero = none)
+        bool showHelp = false;                     ///< Print usage and exit
+    };
+
+    /**
+     * @brief Parses runner arguments.
+     * @param args Arguments without the program name
+     * @param error Receives a description of the first problem on failure
+     * @return Parsed options, or std::nullopt on invalid input
+     */
+    [[nodiscard]] std::optional<CommandLineOptions> ParseCommandLine(std::span<const std::string_view> args,
+        std::string &error);
+
+    /**
+     * @brief Applies path and parameter overrides to a loaded graph.
+     * @param editor Node editor holding the loaded graph
+     * @param options Parsed options
+     * @param error Receives a description of the first problem on failure
+     * @return True if every override found its target slot
+     */
+    [[nodiscard]] bool ApplyOverrides(Nodes::NodeEditor &editor, const CommandLineOptions &options, std::string &error);
+
+    /**
+     * @brief Parses an "ID.SLOT=VALUE" slot override.
+     * @param text Override text
+     * @return Override, or std::nullopt if malformed
+     */
+    [[nodiscard]] std::optional<ParameterOverride> ParseParameterOverride(std::string_view text);
+
+    /**
+     * @brief Sets one input slot default, converting the value to the slot's current type.
+     * @param editor Node editor holding the graph
+     * @param parameter Override to apply
+     * @param error Receives a description of the problem on failure
+     * @return True if the slot exists and the value converts
+     */
+    [[nodiscard]] bool ApplyParameterOverride(Nodes::NodeEditor &editor,
+        const ParameterOverride &parameter,
+        std::string &error);
+
+    /**
+     * @brief Returns usage text.
+     * @param programName Executable name shown in the synopsis
+     * @return Multi-line help message
+     */
+    [[nodiscard]] std::string GetUsage(std::string_view programName);
+
+} // namespace VisionCraft::CLI
@@ -0,0 +1,949 @@
+#include "CLI/GraphServer.h"
+#include "CLI/CommandLineOptions.h"
+#include "Logger.h"
+#include "Nodes/Core/NodeTypeRegistry.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <nlohmann/json.hpp>
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
+#include <optional>
+#include <ranges>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace VisionCraft::CLI
+{
+    namespace
+    {
+#if defined(_WIN32)
+        using NativeSocket = SOCKET;
+        using IoSize = int;
+        const std::intptr_t kInvalidSocket = static_cast<std::intptr_t>(INVALID_SOCKET);
+#else
+        using NativeSocket = int;
+        using IoSize = size_t;
+        constexpr std::intptr_t kInvalidSocket = -1;
+#endif
+
+#if defined(MSG_NOSIGNAL)
+        constexpr int kSendFlags = MSG_NOSIGNAL; // A client hanging up must not raise SIGPIPE
+#else
+        constexpr int kSendFlags = 0;
+#endif
+
+        NativeSocket Native(std::intptr_t socket)
+        {
+            return static_cast<NativeSocket>(socket);
+        }
+
+        std::string LastSocketError()
+        {
+#if defined(_WIN32)
+            return std::system_category().message(WSAGetLastError());
+#else
+            return std::generic_category().message(errno);
+#endif
+        }
+
+        void CloseSocket(std::intptr_t socket)
+        {
+#if defined(_WIN32)
+            closesocket(Native(socket));
+#else
+            close(Native(socket));
+#endif
+        }
+
+        // Short waits let the accept and receive loops notice a stop request
+        bool WaitReadable(std::intptr_t socket, int milliseconds)
+        {
+#if defined(_WIN32)
+            WSAPOLLFD descriptor{ .fd = Native(socket), .events = POLLRDNORM, .revents = 0 };
+            return WSAPoll(&descriptor, 1, milliseconds) > 0;
+#else
+            pollfd descriptor{ .fd = Native(socket), .events = POLLIN, .revents = 0 };
+            return poll(&descriptor, 1, milliseconds) > 0;
+#endif
+        }
+
+        // Appends what the socket has; returns false once the peer closed or the connection failed
+        bool Receive(std::intptr_t socket, std::string &buffer)
+        {
+            char chunk[16 * 1024];
+            const auto received = recv(Native(socket), chunk, static_cast<IoSize>(sizeof(chunk)), 0);
+            if (received <= 0)
+            {
+                return false;
+            }
+            buffer.append(chunk, static_cast<size_t>(received));
+            return true;
+        }
+
+        bool SendAll(std::intptr_t socket, std::string_view data)
+        {
+            while (!data.empty())
+            {
+                const auto chunk = static_cast<IoSize>(std::min<size_t>(data.size(), 1 << 30));
+                const auto sent = send(Native(socket), data.data(), chunk, kSendFlags);
+                if (sent <= 0)
+                {
+                    return false;
+                }
+                data.remove_prefix(static_cast<size_t>(sent));
+            }
+            return true;
+        }
+
+        std::string_view GetStatusText(int status)
+        {
+            switch (status)
+            {
+            case 100:
+                return "Continue";
+            case 200:
+                return "OK";
+            case 400:
+                return "Bad Request";
+            case 404:
+                return "Not Found";
+            case 405:
+                return "Method Not Allowed";
+            case 411:
+                return "Length Required";
+            case 413:
+                return "Payload Too Large";
+            case 500:
+                return "Internal Server Error";
+            case 503:
+                return "Service Unavailable";
+            case 504:
+                return "Gateway Timeout";
+            default:
+                return "Unknown";
+            }
+        }
+
+        std::string FormatResponse(const HttpResponse &response, bool keepAlive)
+        {
+            std::string text = "HTTP/1.1 " + std::to_string(response.status) + ' '
+                               + std::string(GetStatusText(response.status)) + "\r\n";
+            text += "Content-Type: " + response.contentType + "\r\n";
+            text += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+            text += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+            text += response.body;
+            return text;
+        }
+
+        HttpResponse MakeError(int status, const std::string &message)
+        {
+            return { .status = status, .body = nlohmann::json{ { "error", message } }.dump() };
+        }
+
+        std::string ToLower(std::string_view text)
+        {
+            std::string lower(text);
+            std::ranges::transform(
+                lower, lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return lower;
+        }
+
+        std::string_view Trim(std::string_view text)
+        {
+            while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+            {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r'))
+            {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+        template<typename T> std::optional<T> ParseNumber(std::string_view text)
+        {
+            T value{};
+            const auto [end, errc] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (errc != std::errc{} || end != text.data() + text.size())
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        // Decodes %XX escapes and '+' (form encoding); malformed escapes are kept as written
+        std::string PercentDecode(std::string_view text)
+        {
+            std::string decoded;
+            decoded.reserve(text.size());
+            for (size_t i = 0; i < text.size(); ++i)
+            {
+                int byte = 0;
+                const char *escapeEnd = text.data() + std::min(i + 3, text.size());
+                if (text[i] == '+')
+                {
+                    decoded += ' ';
+                }
+                else if (text[i] == '%' && escapeEnd == text.data() + i + 3
+                         && std::from_chars(text.data() + i + 1, escapeEnd, byte, 16).ptr == escapeEnd)
+                {
+                    decoded += static_cast<char>(byte);
+                    i += 2;
+                }
+                else
+                {
+                    decoded += text[i];
+                }
+            }
+            return decoded;
+        }
+
+        std::vector<std::pair<std::string, std::string>> ParseQuery(std::string_view query)
+        {
+            std::vector<std::pair<std::string, std::string>> parameters;
+            while (!query.empty())
+            {
+                const auto end = query.find('&');
+                const auto item = query.substr(0, end);
+                if (!item.empty())
+                {
+                    const auto equals = item.find('=');
+                    parameters.emplace_back(PercentDecode(item.substr(0, equals)),
+                        equals == std::string_view::npos ? std::string{} : PercentDecode(item.substr(equals + 1)));
+                }
+                query = end == std::string_view::npos ? std::string_view{} : query.substr(end + 1);
+            }
+            return parameters;
+        }
+
+        /**
+         * @brief Request line and headers of a request being received.
+         */
+        struct RequestHead
+        {
+            HttpRequest request;          ///< Method, path and query (body not yet received)
+            size_t contentLength = 0;     ///< Announced body size
+            bool chunked = false;         ///< Body uses chunked transfer encoding (unsupported)
+            bool expectContinue = false;  ///< Client waits for "100 Continue" before sending the body
+            bool keepAlive = true;        ///< Connection stays open after the response
+        };
+
+        std::optional<RequestHead> ParseHead(std::string_view text)
+        {
+            RequestHead head;
+            const auto lineEnd = text.find("\r\n");
+            const auto requestLine = text.substr(0, lineEnd);
+            const auto firstSpace = requestLine.find(' ');
+            const auto secondSpace = requestLine.find(' ', firstSpace + 1);
+            if (firstSpace == std::string_view::npos || secondSpace == std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            head.request.method = std::string(requestLine.substr(0, firstSpace));
+            const auto target = requestLine.substr(firstSpace + 1, secondSpace - firstSpace - 1);
+            const auto version = requestLine.substr(secondSpace + 1);
+            if (!version.starts_with("HTTP/1."))
+            {
+                return std::nullopt;
+            }
+            head.keepAlive = version != "HTTP/1.0";
+
+            const auto question = target.find('?');
+            head.request.path = PercentDecode(target.substr(0, question));
+            if (question != std::string_view::npos)
+            {
+                head.request.query = ParseQuery(target.substr(question + 1));
+            }
+
+            for (auto rest = lineEnd == std::string_view::npos ? std::string_view{} : text.substr(lineEnd + 2);
+                !rest.empty();)
+            {
+                const auto end = rest.find("\r\n");
+                const auto line = rest.substr(0, end);
+                rest = end == std::string_view::npos ? std::string_view{} : rest.substr(end + 2);
+
+                const auto colon = line.find(':');
+                if (colon == std::string_view::npos)
+                {
+                    continue;
+                }
+                const auto name = ToLower(Trim(line.substr(0, colon)));
+                const auto value = ToLower(Trim(line.substr(colon + 1)));
+                if (name == "content-length")
+                {
+                    const auto length = ParseNumber<size_t>(value);
+                    if (!length)
+                    {
+                        return std::nullopt;
+                    }
+                    head.contentLength = *length;
+                }
+                else if (name == "transfer-encoding")
+                {
+                    head.chunked = value != "identity";
+                }
+                else if (name == "expect")
+                {
+                    head.expectContinue = value == "100-continue";
+                }
+                else if (name == "connection")
+                {
+                    head.keepAlive = value == "keep-alive" || (head.keepAlive && value != "close");
+                }
+            }
+            return head;
+        }
+
+        // Reads ID.SLOT as used by value=
+        std::optional<std::pair<Nodes::NodeId, std::string>> ParseSlotReference(std::string_view text)
+        {
+            const auto dot = text.find('.');
+            if (dot == std::string_view::npos || dot + 1 == text.size())
+            {
+                return std::nullopt;
+            }
+            const auto id = ParseNumber<Nodes::NodeId>(text.substr(0, dot));
+            if (!id)
+            {
+                return std::nullopt;
+            }
+            return std::pair{ *id, std::string(text.substr(dot + 1)) };
+        }
+
+        // Scalars as JSON values; images as their shape, since pixels belong in an image response
+        nlohmann::json ToJson(const Nodes::NodeData &data)
+        {
+            if (const auto *value = std::get_if<double>(&data))
+            {
+                return *value;
+            }
+            if (const auto *value = std::get_if<float>(&data))
+            {
+                return *value;
+            }
+            if (const auto *value = std::get_if<int>(&data))
+            {
+                return *value;
+            }
+            if (const auto *value = std::get_if<bool>(&data))
+            {
+                return *value;
+            }
+            if (const auto *value = std::get_if<std::string>(&data))
+            {
+                return *value;
+            }
+            if (const auto *value = std::get_if<std::filesystem::path>(&data))
+            {
+                return value->string();
+            }
+            if (const auto *value = std::get_if<std::vector<cv::Point>>(&data))
+            {
+                auto points = nlohmann::json::array();
+                for (const auto &point : *value)
+                {
+                    points.push_back({ point.x, point.y });
+                }
+                return points;
+            }
+            if (const auto *value = std::get_if<Nodes::ContourSet>(&data))
+            {
+                auto contours = nlohmann::json::array();
+                for (size_t i = 0; i < value->GetCount(); ++i)
+                {
+                    auto points = nlohmann::json::array();
+                    for (const auto &point : value->GetContour(i))
+                    {
+                        points.push_back({ point.x, point.y });
+                    }
+                    contours.push_back(std::move(points));
+                }
+                return contours;
+            }
+            if (const auto *value = std::get_if<cv::Mat>(&data))
+            {
+                return { { "rows", value->rows }, { "cols", value->cols }, { "channels", value->channels() } };
+            }
+            if (const auto *value = std::get_if<Nodes::ImageBatch>(&data))
+            {
+                const cv::Size size = value->GetImageSize();
+                return { { "count", value->GetCount() }, { "rows", size.height }, { "cols", size.width },
+                    { "channels", CV_MAT_CN(value->GetType()) } };
+            }
+            return nullptr;
+        }
+
+        std::string GetContentType(const std::string &format)
+        {
+            const auto lower = ToLower(format);
+            if (lower == "jpg" || lower == "jpeg")
+            {
+                return "image/jpeg";
+            }
+            if (lower == "tif" || lower == "tiff")
+            {
+                return "image/tiff";
+            }
+            if (lower == "png" || lower == "webp" || lower == "bmp")
+            {
+                return "image/" + lower;
+            }
+            return "application/octet-stream";
+        }
+
+        // Finds the node of a type with the given ID, or the graph's only node of that type
+        Nodes::Node *FindNode(Nodes::NodeEditor &editor,
+            std::optional<Nodes::NodeId> nodeId,
+            const std::string &nodeType,
+            std::string &error)
+        {
+            const auto typeId = Nodes::NodeTypeRegistry::Intern(nodeType);
+            if (nodeId)
+            {
+                auto *node = editor.GetNode(*nodeId);
+                if (!node || node->GetTypeId() != typeId)
+                {
+                    error = "Node " + std::to_string(*nodeId) + " is not a " + nodeType;
+                    return nullptr;
+                }
+                return node;
+            }
+
+            Nodes::Node *match = nullptr;
+            for (const auto id : editor.GetNodeIds())
+            {
+                auto *node = editor.GetNode(id);
+                if (node && node->GetTypeId() == typeId)
+                {
+                    if (match)
+                    {
+                        error = "Graph has several " + nodeType + "s, choose one explicitly";
+                        return nullptr;
+                    }
+                    match = node;
+                }
+            }
+            if (!match)
+            {
+                error = "Graph has no " + nodeType;
+            }
+            return match;
+        }
+
+        /**
+         * @brief Puts back the input slot defaults a request changed, so the next request sees the loaded graph.
+         */
+        class DefaultRestorer
+        {
+        public:
+            DefaultRestorer() = default;
+
+            ~DefaultRestorer()
+            {
+                for (auto &[node, slotName, value] : std::views::reverse(saved))
+                {
+                    node->SetInputSlotDefault(slotName, value ? *value : Nodes::NodeData{});
+                }
+            }
+
+            DefaultRestorer(const DefaultRestorer &) = delete;
+            DefaultRestorer &operator=(const DefaultRestorer &) = delete;
+
+            void Save(Nodes::Node &node, const std::string &slotName)
+            {
+                saved.emplace_back(&node, slotName, node.GetInputSlot(slotName).GetSharedDefaultValue());
+            }
+
+        private:
+            std::vector<std::tuple<Nodes::Node *, std::string, std::shared_ptr<const Nodes::NodeData>>> saved;
+        };
+    } // namespace
+
+    std::unique_ptr<GraphServer> GraphServer::Create(const ServerOptions &options,
+        std::shared_ptr<Nodes::ExecutorService> executor,
+        const EditorSetup &setup,
+        std::string &error)
+    {
+        std::unique_ptr<GraphServer> server(new GraphServer(options, std::move(executor)));
+        for (size_t i = 0; i < std::max<size_t>(1, options.instances); ++i)
+        {
+            auto editor = std::make_unique<Nodes::NodeEditor>();
+            editor->SetExecutorService(server->executor);
+            if (!setup(*editor, error))
+            {
+                return nullptr;
+            }
+
+            // Responses carry the results: concurrent copies must not race each other to the same file
+            editor->SetOutputCacheEnabled(false);
+            const auto outputTypeId = Nodes::NodeTypeRegistry::Intern("ImageOutputNode");
+            for (const auto id : editor->GetNodeIds())
+            {
+                if (auto *node = editor->GetNode(id); node && node->GetTypeId() == outputTypeId)
+                {
+                    node->SetInputSlotDefault("AutoSave", false);
+                }
+            }
+
+            server->idleEditors.push_back(editor.get());
+            server->editors.push_back(std::move(editor));
+        }
+        return server;
+    }
+
+    GraphServer::GraphServer(const ServerOptions &options, std::shared_ptr<Nodes::ExecutorService> executor)
+        : options(options), executor(std::move(executor))
+    {
+    }
+
+    GraphServer::~GraphServer()
+    {
+        if (listener != kInvalidSocket)
+        {
+            CloseSocket(listener);
+        }
+    }
+
+    bool GraphServer::Start(std::string &error)
+    {
+#if defined(_WIN32)
+        static const bool winsockReady = []() {
+            WSADATA data;
+            return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+        }();
+        if (!winsockReady)
+        {
+            error = "Winsock is unavailable";
+            return false;
+        }
+#endif
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(options.port);
+        if (inet_pton(AF_INET, options.address.c_str(), &address.sin_addr) != 1)
+        {
+            error = "Invalid listen address '" + options.address + "'";
+            return false;
+        }
+
+        const auto socketHandle = static_cast<std::intptr_t>(socket(AF_INET, SOCK_STREAM, IPPROTO_TCP));
+        if (socketHandle == kInvalidSocket)
+        {
+            error = "Cannot create socket: " + LastSocketError();
+            return false;
+        }
+#if !defined(_WIN32)
+        // Restarting the server must not wait for the previous instance's connections to time out
+        const int reuse = 1;
+        setsockopt(Native(socketHandle), SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+#endif
+
+        socklen_t length = sizeof(address);
+        if (bind(Native(socketHandle), reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0
+            || listen(Native(socketHandle), SOMAXCONN) != 0
+            || getsockname(Native(socketHandle), reinterpret_cast<sockaddr *>(&address), &length) != 0)
+        {
+            error = "Cannot listen on " + options.address + ':' + std::to_string(options.port) + ": "
+                    + LastSocketError();
+            CloseSocket(socketHandle);
+            return false;
+        }
+
+        listener = socketHandle;
+        port = ntohs(address.sin_port);
+        return true;
+    }
+
+    void GraphServer::Serve(std::stop_token stopToken)
+    {
+        while (!stopToken.stop_requested())
+        {
+            if (!WaitReadable(listener, Constants::Server::kPollMilliseconds))
+            {
+                continue;
+            }
+            const auto connection = static_cast<std::intptr_t>(accept(Native(listener), nullptr, nullptr));
+            if (connection == kInvalidSocket)
+            {
+                continue;
+            }
+
+            // Responses are small next to the work behind them; send each as soon as it is ready
+            const int noDelay = 1;
+            setsockopt(Native(connection),
+                IPPROTO_TCP,
+                TCP_NODELAY,
+                reinterpret_cast<const char *>(&noDelay),
+                sizeof(noDelay));
+
+            {
+                std::scoped_lock lock(mutex);
+                if (openConnections >= Constants::Server::kMaxConnections)
+                {
+                    SendAll(connection, FormatResponse(MakeError(503, "Too many connections"), false));
+                    CloseSocket(connection);
+                    continue;
+                }
+                ++openConnections;
+            }
+
+            executor->Post([this, connection, stopToken]() {
+                ServeConnection(connection, stopToken);
+                std::scoped_lock lock(mutex);
+                --openConnections;
+                changed.notify_all();
+            });
+        }
+
+        std::unique_lock lock(mutex);
+        changed.wait(lock, [this]() { return openConnections == 0; });
+    }
+
+    void GraphServer::ServeConnection(std::intptr_t socket, std::stop_token stopToken)
+    {
+        std::string buffer;
+        const auto idleTimeout = std::chrono::milliseconds(Constants::Server::kIdleTimeoutMilliseconds);
+
+        // Receives until predicate holds; false on close, error, stop or idle timeout
+        const auto receiveUntil = [&](const auto &predicate) {
+            auto deadline = std::chrono::steady_clock::now() + idleTimeout;
+            while (!predicate())
+            {
+                if (stopToken.stop_requested() || std::chrono::steady_clock::now() >= deadline)
+                {
+                    return false;
+                }
+                if (WaitReadable(socket, Constants::Server::kPollMilliseconds))
+                {
+                    if (!Receive(socket, buffer))
+                    {
+                        return false;
+                    }
+                    deadline = std::chrono::steady_clock::now() + idleTimeout;
+                }
+            }
+            return true;
+        };
+
+        for (bool keepAlive = true; keepAlive;)
+        {
+            size_t headEnd = std::string::npos;
+            const bool headReceived = receiveUntil([&]() {
+                headEnd = buffer.find("\r\n\r\n");
+                return headEnd != std::string::npos || buffer.size() > Constants::Server::kMaxHeaderBytes;
+            });
+            if (!headReceived)
+            {
+                break;
+            }
+
+            auto head = headEnd != std::string::npos ? ParseHead(std::string_view(buffer).substr(0, headEnd))
+                                                     : std::nullopt;
+            std::optional<HttpResponse> rejection;
+            if (!head)
+            {
+                rejection = MakeError(400, "Malformed request head");
+            }
+            else if (head->chunked)
+            {
+                rejection = MakeError(411, "Chunked bodies are not supported; send Content-Length");
+            }
+            else if (head->contentLength > Constants::Server::kMaxBodyBytes)
+            {
+                rejection =
+                    MakeError(413, "Body exceeds " + std::to_string(Constants::Server::kMaxBodyBytes) + " bytes");
+            }
+            if (rejection)
+            {
+                // The rest of the stream cannot be framed, so the connection ends here
+                SendAll(socket, FormatResponse(*rejection, false));
+                break;
+            }
+
+            buffer.erase(0, headEnd + 4);
+            if (head->expectContinue && buffer.size() < head->contentLength
+                && !SendAll(socket, "HTTP/1.1 100 Continue\r\n\r\n"))
+            {
+                break;
+            }
+            if (!receiveUntil([&]() { return buffer.size() >= head->contentLength; }))
+            {
+                break;
+            }
+
+            head->request.body = buffer.substr(0, head->contentLength);
+            buffer.erase(0, head->contentLength);
+
+            const auto response = Handle(head->request, stopToken);
+            keepAlive = head->keepAlive && !stopToken.stop_requested();
+            if (!SendAll(socket, FormatResponse(response, keepAlive)))
+            {
+                break;
+            }
+        }
+        CloseSocket(socket);
+    }
+
+    HttpResponse GraphServer::Handle(const HttpRequest &request, std::stop_token stopToken)
+    {
+        // Scrapes are not counted, so a monitoring interval does not show up as traffic
+        if (request.path == "/metrics" && request.method == "GET")
+        {
+            return { .contentType = "text/plain; version=0.0.4", .body = FormatMetrics() };
+        }
+
+        HttpResponse response;
+        if (request.path == "/health")
+        {
+            const auto statisticsNow = GetStatistics();
+            response.body = nlohmann::json{ { "instances", editors.size() },
+                { "busy", statisticsNow.busyInstances },
+                { "requests", statisticsNow.requests },
+                { "failed", statisticsNow.failed } }
+                                .dump();
+        }
+        else if (request.path != "/run")
+        {
+            response = MakeError(404, "Unknown path '" + request.path + "'; use /run, /health or /metrics");
+        }
+        else if (request.method != "POST")
+        {
+            response = MakeError(405, "/run expects POST");
+        }
+        else
+        {
+            Nodes::NodeEditor *editor = nullptr;
+            {
+                std::unique_lock lock(mutex);
+                ++statistics.waitingRequests;
+                if (changed.wait(lock, stopToken, [this]() { return !idleEditors.empty(); }))
+                {
+                    editor = idleEditors.back();
+                    idleEditors.pop_back();
+                    ++statistics.busyInstances;
+                }
+                --statistics.waitingRequests;
+            }
+
+            if (!editor)
+            {
+                response = MakeError(503, "Server is shutting down");
+            }
+            else
+            {
+                response = Run(*editor, request, stopToken);
+                std::scoped_lock lock(mutex);
+                idleEditors.push_back(editor);
+                --statistics.busyInstances;
+                changed.notify_all();
+            }
+        }
+
+        std::scoped_lock lock(mutex);
+        ++statistics.requests;
+        if (response.status >= 400)
+        {
+            ++statistics.failed;
+        }
+        return response;
+    }
+
+    ServerStatistics GraphServer::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return statistics;
+    }
+
+    std::string GraphServer::FormatMetrics() const
+    {
+        const auto statisticsNow = GetStatistics();
+        std::string text = Nodes::RuntimeMetrics::Get().FormatPrometheus();
+        const auto appendGauge = [&text](std::string_view name, std::string_view type, std::string_view help,
+                                     size_t value) {
+            text.append("# HELP ").append(name).append(" ").append(help).append("\n");
+            text.append("# TYPE ").append(name).append(" ").append(type).append("\n");
+            text.append(name).append(" ").append(std::to_string(value)).append("\n");
+        };
+        appendGauge("visioncraft_server_requests_total", "counter", "Requests handled", statisticsNow.requests);
+        appendGauge("visioncraft_server_failed_requests_total", "counter", "Requests answered with an error status",
+            statisticsNow.failed);
+        appendGauge("visioncraft_server_instances", "gauge", "Loaded graph copies", editors.size());
+        appendGauge("visioncraft_server_busy_instances", "gauge", "Graph copies executing a request",
+            statisticsNow.busyInstances);
+        appendGauge("visioncraft_server_waiting_requests", "gauge", "Requests waiting for a free graph copy",
+            statisticsNow.waitingRequests);
+        return text;
+    }
+
+    HttpResponse GraphServer::Run(Nodes::NodeEditor &editor, const HttpRequest &request, std::stop_token stopToken)
+    {
+        std::optional<Nodes::NodeId> inputId;
+        std::optional<Nodes::NodeId> outputId;
+        std::string format;
+        std::vector<ParameterOverride> overrides;
+        std::vector<std::pair<Nodes::NodeId, std::string>> values;
+        for (const auto &[key, value] : request.query)
+        {
+            if (key == "set")
+            {
+                auto parameter = ParseParameterOverride(value);
+                if (!parameter)
+                {
+                    return MakeError(400, "Malformed override '" + value + "'; expected ID.SLOT=VALUE");
+                }
+                overrides.push_back(std::move(*parameter));
+            }
+            else if (key == "value")
+            {
+                auto reference = ParseSlotReference(value);
+                if (!reference)
+                {
+                    return MakeError(400, "Malformed value '" + value + "'; expected ID.SLOT");
+                }
+                values.push_back(std::move(*reference));
+            }
+            else if (key == "input" || key == "output")
+            {
+                const auto id = ParseNumber<Nodes::NodeId>(value);
+                if (!id)
+                {
+                    return MakeError(400, "Malformed node ID '" + value + "'");
+                }
+                (key == "input" ? inputId : outputId) = *id;
+            }
+            else if (key == "format")
+            {
+                format = value;
+            }
+            else
+            {
+                return MakeError(400, "Unknown parameter '" + key + "'");
+            }
+        }
+
+        std::string error;
+        DefaultRestorer restorer;
+        if (!request.body.empty())
+        {
+            auto *inputNode = dynamic_cast<Vision::IO::ImageInputNode *>(
+                FindNode(editor, inputId, "ImageInputNode", error));
+            if (!inputNode)
+            {
+                return MakeError(400, error);
+            }
+
+            const cv::Mat encoded(1, static_cast<int>(request.body.size()), CV_8UC1,
+                const_cast<char *>(request.body.data()));
+            cv::Mat image = cv::imdecode(encoded, cv::IMREAD_COLOR);
+            if (image.empty())
+            {
+                return MakeError(400, "Body is not a decodable image");
+            }
+            restorer.Save(*inputNode, "FilePath");
+            inputNode->SetPreloadedImage("request", std::move(image));
+        }
+
+        for (const auto &parameter : overrides)
+        {
+            if (auto *node = editor.GetNode(parameter.nodeId); node && node->HasInputSlot(parameter.slotName))
+            {
+                restorer.Save(*node, parameter.slotName);
+            }
+            if (!ApplyParameterOverride(editor, parameter, error))
+            {
+                return MakeError(400, error);
+            }
+        }
+
+        for (const auto &[nodeId, slotName] : values)
+        {
+            if (const auto *node = editor.GetNode(nodeId); !node || !node->HasOutputSlot(slotName))
+            {
+                return MakeError(400, "Node " + std::to_string(nodeId) + " has no output slot '" + slotName + "'");
+            }
+        }
+
+        Vision::IO::ImageOutputNode *outputNode = nullptr;
+        std::vector<int> encodeParams;
+        if (values.empty())
+        {
+            outputNode = dynamic_cast<Vision::IO::ImageOutputNode *>(
+                FindNode(editor, outputId, "ImageOutputNode", error));
+            if (!outputNode)
+            {
+                return MakeError(400, error);
+            }
+            if (format.empty())
+            {
+                format = outputNode->GetInputValue<std::string>("Format").value_or("png");
+            }
+            if (!cv::haveImageWriter("." + format))
+            {
+                return MakeError(400, "Cannot encode format '" + format + "'");
+            }
+            const auto profile = Vision::IO::ImageOutputNode::ParseEncodeProfile(
+                outputNode->GetInputValue<std::string>("Profile").value_or(""));
+            encodeParams = Vision::IO::ImageOutputNode::GetEncodeParams(
+                format, profile.value_or(Vision::IO::EncodeProfile::Balanced));
+        }
+
+        if (!editor.ExecuteFullResolution(nullptr, stopToken))
+        {
+            const auto run = editor.GetExecutionStatistics().GetLatest();
+            if (run && run->timedOut)
+            {
+                return MakeError(504, "Graph execution timed out");
+            }
+            return MakeError(500, "Graph execution failed");
+        }
+
+        if (!outputNode)
+        {
+            nlohmann::json result = nlohmann::json::object();
+            for (const auto &[nodeId, slotName] : values)
+            {
+                result[std::to_string(nodeId) + '.' + slotName] =
+                    ToJson(editor.GetNode(nodeId)->GetOutputSlot(slotName).GetVariantData());
+            }
+            return { .body = result.dump() };
+        }
+
+        const cv::Mat &image = outputNode->GetDisplayImage();
+        std::vector<uchar> encoded;
+        if (image.empty() || !cv::imencode("." + format, image, encoded, encodeParams))
+        {
+            return MakeError(500, "Output node " + std::to_string(outputNode->GetId()) + " produced no image");
+        }
+        return { .contentType = GetContentType(format), .body = std::string(encoded.begin(), encoded.end()) };
+    }
+
+} // namespace VisionCraft::CLI
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/ExecutorService.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::CLI
+{
+    /**
+     * @brief Settings of a GraphServer.
+     */
+    struct ServerOptions
+    {
+        std::string address = "127.0.0.1";                       ///< IPv4 address to listen on ("0.0.0.0" = all)
+        uint16_t port = Constants::Server::kDefaultPort;         ///< Port to listen on (0 = any free port)
+        size_t instances = Constants::Server::kDefaultInstances; ///< Graph copies, i.e. concurrent executions
+    };
+
+    /**
+     * @brief One parsed HTTP request.
+     */
+    struct HttpRequest
+    {
+        std::string method;                                     ///< "GET", "POST", ...
+        std::string path;                                       ///< Target without the query string
+        std::vector<std::pair<std::string, std::string>> query; ///< Decoded query parameters, in order
+        std::string body;                                       ///< Request body (e.g. encoded image bytes)
+    };
+
+    /**
+     * @brief Response to an HttpRequest.
+     */
+    struct HttpResponse
+    {
+        int status = 200;                             ///< HTTP status code
+        std::string contentType = "application/json"; ///< Content-Type header
+        std::string body;                             ///< Response body
+    };
+
+    /**
+     * @brief Request counters of a GraphServer.
+     */
+    struct ServerStatistics
+    {
+        size_t requests = 0;        ///< Requests handled
+        size_t failed = 0;          ///< Requests answered with an error status
+        size_t busyInstances = 0;   ///< Graph copies executing a request now
+        size_t waitingRequests = 0; ///< Requests waiting for a free graph copy
+    };
+
+    /**
+     * @brief Long-lived HTTP server running a loaded graph per request.
+     *
+     * The server loads the graph into ServerOptions::instances editors once and keeps them: plans stay
+     * compiled, and buffer pools and decoded-image caches stay warm across requests. Each request checks
+     * out one editor, so concurrent requests never share slot state; requests beyond the instance count
+     * wait for a free editor. Connections run as jobs on the shared ExecutorService, and keep-alive
+     * connections skip a TCP handshake per image.
+     *
+     * Endpoints:
+     * - `GET /health`: JSON with instance and request counters.
+     * - `GET /metrics`: Nodes::RuntimeMetrics and the request counters in the Prometheus text format.
+     *   Scrapes are not counted as requests.
+     * - `POST /run`: the body is an encoded image for the graph's ImageInputNode (or none). Query
+     *   parameters: `set=ID.SLOT=VALUE` (repeatable) overrides a slot default for this request only,
+     *   `input=ID` and `output=ID` pick among several image nodes, `format=EXT` selects the response
+     *   encoding (default: the output node's Format), and `value=ID.SLOT` (repeatable) returns output slot
+     *   values as JSON instead of the image.
+     *
+     * Errors are answered with a JSON body `{"error": "..."}`: 400 for bad requests, 404 for unknown
+     * paths, 405 for a wrong method, 411 for chunked bodies, 413 for bodies over
+     * Constants::Server::kMaxBodyBytes, 500 if the graph fails, 503 while shutting down or when
+     * Constants::Server::kMaxConnections are open, and 504 when a run exceeds the editors' execution
+     * timeout. The output cache and AutoSave are off: every request brings a new image, and concurrent
+     * copies must not write the same file.
+     */
+    class GraphServer
+    {
+    public:
+        /**
+         * @brief Loads a graph into a fresh editor and configures it.
+         */
+        using EditorSetup = std::function<bool(Nodes::NodeEditor &editor, std::string &error)>;
+
+        /**
+         * @brief Creates a server with its graph copies loaded.
+         * @param options Address, port and instance count
+         * @param executor Service running connections and graph work
+         * @param setup Loads and configures each editor (called once per instance)
+         * @param error Receives a description of the first problem on failure
+         * @return Server ready to Start(), or nullptr if an editor could not be set up
+         */
+        [[nodiscard]] static std::unique_ptr<GraphServer> Create(const ServerOptions &options,
+            std::shared_ptr<Nodes::ExecutorService> executor,
+            const EditorSetup &setup,
+            std::string &error);
+
+        /**
+         * @brief Closes the listening socket.
+         * @note Serve() must have returned.
+         */
+        ~GraphServer();
+
+        GraphServer(const GraphServer &) = delete;
+        GraphServer &operator=(const GraphServer &) = delete;
+
+        /**
+         * @brief Binds and listens.
+         * @param error Receives a description of the problem on failure
+         * @return True if listening
+         */
+        [[nodiscard]] bool Start(std::string &error);
+
+        /**
+         * @brief Returns the port being listened on.
+         * @return Port (the chosen one when ServerOptions::port was 0), or 0 before Start()
+         */
+        [[nodiscard]] uint16_t GetPort() const
+        {
+            return port;
+        }
+
+        /**
+         * @brief Accepts connections until stopped, then waits for open connections to finish.
+         * @param stopToken Token to stop serving
+         */
+        void Serve(std::stop_token stopToken);
+
+        /**
+         * @brief Handles one request on a free graph copy.
+         * @param request Parsed request
+         * @param stopToken Token that stops waiting for a free copy and the run
+         * @return Response
+         */
+        [[nodiscard]] HttpResponse Handle(const HttpRequest &request, std::stop_token stopToken = {});
+
+        /**
+         * @brief Returns request counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] ServerStatistics GetStatistics() const;
+
+    private:
+        GraphServer(const ServerOptions &options, std::shared_ptr<Nodes::ExecutorService> executor);
+
+        /**
+         * @brief Formats the /metrics response.
+         * @return Process metrics followed by the server's own
+         */
+        [[nodiscard]] std::string FormatMetrics() const;
+
+        /**
+         * @brief Runs the /run endpoint on a checked-out editor.
+         * @param editor Editor for this request alone
+         * @param request Parsed request
+         * @param stopToken Token that stops the run
+         * @return Response
+         */
+        HttpResponse Run(Nodes::NodeEditor &editor, const HttpRequest &request, std::stop_token stopToken);
+
+        /**
+         * @brief Reads requests from one connection and answers them until it closes or the server stops.
+         * @param socket Accepted socket (closed on return)
+         * @param stopToken Token of Serve()
+         */
+        void ServeConnection(std::intptr_t socket, std::stop_token stopToken);
+
+        ServerOptions options;                            ///< Address, port and instance count
+        std::shared_ptr<Nodes::ExecutorService> executor; ///< Runs connections and graph work
+        std::intptr_t listener = -1;                      ///< Listening socket (-1 = not started)
+        uint16_t port = 0;                                ///< Port being listened on
+
+        mutable std::mutex mutex;                                ///< Guards everything below
+        std::condition_variable_any changed;                     ///< An editor or a connection was released
+        std::vector<std::unique_ptr<Nodes::NodeEditor>> editors; ///< Every graph copy
+        std::vector<Nodes::NodeEditor *> idleEditors;            ///< Copies not running a request
+        size_t openConnections = 0;                              ///< Connections being served
+        ServerStatistics statistics;                             ///< Request counters
+    };
+
+} // namespace VisionCraft::CLI
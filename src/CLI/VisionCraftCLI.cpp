@@ -0,0 +1,698 @@
+#include "CLI/CommandLineOptions.h"
+#include "CLI/GraphServer.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/MemoryBudget.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Nodes/Core/ThreadBudget.h"
+#include "Nodes/Core/Tracer.h"
+#include "Nodes/Core/WriteBehindQueue.h"
+#include "Vision/Factory/NodeFactory.h"
+#include "Vision/IO/Autotuner.h"
+#include "Vision/IO/BatchFarm.h"
+#include "Vision/IO/BatchProcessor.h"
+#include "Vision/IO/ImageOutputNode.h"
+#include "Vision/IO/RunRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    constexpr int kExitSuccess = 0;
+    constexpr int kExitUsage = 1;
+    constexpr int kExitLoadFailed = 2;
+    constexpr int kExitExecutionFailed = 3;
+    constexpr int kExitRegression = 4;
+
+    volatile std::sig_atomic_t interrupted = 0; // Set by SIGINT/SIGTERM while serving
+
+    void OnInterrupt(int)
+    {
+        interrupted = 1;
+    }
+
+    // Records a Chrome trace for its lifetime, so every exit path after loading writes the file
+    class TraceSession
+    {
+    public:
+        explicit TraceSession(std::filesystem::path path) : path(std::move(path))
+        {
+            if (!this->path.empty())
+            {
+                Nodes::Tracer::Get().SetCurrentThreadName("Main");
+                Nodes::Tracer::Get().Start();
+            }
+        }
+
+        ~TraceSession()
+        {
+            if (!path.empty())
+            {
+                Nodes::Tracer::Get().Stop();
+                if (Nodes::Tracer::Get().WriteChromeTrace(path))
+                {
+                    std::cout << "Trace written to " << path.string() << '\n';
+                }
+            }
+        }
+
+        TraceSession(const TraceSession &) = delete;
+        TraceSession &operator=(const TraceSession &) = delete;
+
+    private:
+        std::filesystem::path path;
+    };
+
+    // Collects service metrics for its lifetime and rewrites the metrics file every interval and once at the end
+    class MetricsSession
+    {
+    public:
+        MetricsSession(std::filesystem::path path, std::chrono::seconds interval, bool serving) : path(std::move(path))
+        {
+            if (this->path.empty() && !serving)
+            {
+                return;
+            }
+            Nodes::RuntimeMetrics::Get().SetEnabled(true);
+            if (this->path.empty())
+            {
+                return;
+            }
+
+            if (interval.count() == 0)
+            {
+                interval = std::chrono::seconds(Constants::Metrics::kDefaultFileIntervalSeconds);
+            }
+            writer = std::jthread([this, interval](std::stop_token stopToken) {
+                std::mutex mutex;
+                std::condition_variable_any wake;
+                std::unique_lock lock(mutex);
+                while (!wake.wait_for(lock, stopToken, interval, [&stopToken]() { return stopToken.stop_requested(); }))
+                {
+                    Nodes::RuntimeMetrics::Get().WriteFile(this->path);
+                }
+            });
+        }
+
+        ~MetricsSession()
+        {
+            if (writer.joinable())
+            {
+                writer.request_stop();
+                writer.join();
+                if (Nodes::RuntimeMetrics::Get().WriteFile(path))
+                {
+                    std::cout << "Metrics written to " << path.string() << '\n';
+                }
+            }
+        }
+
+        MetricsSession(const MetricsSession &) = delete;
+        MetricsSession &operator=(const MetricsSession &) = delete;
+
+    private:
+        std::filesystem::path path;
+        std::jthread writer;
+    };
+
+    // Explicitly named profiles must load; a broken per-machine default only costs the tuned settings
+    bool LoadTuningProfile(const CLI::CommandLineOptions &options, std::optional<Vision::IO::TuningProfile> &profile)
+    {
+        if (options.autotune || options.ignoreTuningProfile)
+        {
+            return true;
+        }
+
+        const bool named = !options.tuningProfile.empty();
+        const auto path = named ? options.tuningProfile : Vision::IO::Autotuner::GetDefaultProfilePath();
+        std::error_code fileError;
+        if (!named && (path.empty() || !std::filesystem::exists(path, fileError)))
+        {
+            return true;
+        }
+
+        std::string error;
+        profile = Vision::IO::Autotuner::LoadProfile(path, error);
+        if (!profile)
+        {
+            if (named)
+            {
+                std::cerr << error << '\n';
+                return false;
+            }
+            LOG_WARN("Ignoring tuning profile: {}", error);
+            return true;
+        }
+        LOG_INFO("Loaded tuning profile {}", path.string());
+        return true;
+    }
+
+    // Settings every editor of the run gets once its graph is loaded; explicit options override the profile
+    void ConfigureEditor(Nodes::NodeEditor &editor,
+        const CLI::CommandLineOptions &options,
+        const std::optional<Vision::IO::TuningProfile> &profile)
+    {
+        if (profile)
+        {
+            Vision::IO::Autotuner::Apply(*profile, editor);
+        }
+        if (options.workerCount != 0)
+        {
+            editor.SetWorkerCount(options.workerCount);
+        }
+
+        if (options.parallel)
+        {
+            editor.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+        }
+
+        if (options.tileSize > 0)
+        {
+            auto tiling = editor.GetTilingOptions();
+            tiling.enabled = true;
+            tiling.tileSize = options.tileSize;
+            editor.SetTilingOptions(tiling);
+        }
+        if (options.opencl)
+        {
+            editor.SetDeviceExecution(true);
+        }
+        editor.SetPrecisionPolicy(options.precision);
+        editor.SetIntermediateRelease(true); // Nothing inspects intermediate images after a headless run
+        editor.SetDuplicateElimination(true);
+        editor.SetExecutionTimeout(options.timeout);
+        if (!options.cacheDirectory.empty())
+        {
+            editor.GetOutputCache().SetPersistentStore(std::make_shared<Nodes::PersistentOutputStore>(
+                options.cacheDirectory, Constants::Cache::kDefaultPersistentCacheBytes));
+        }
+    }
+
+    Vision::IO::BatchOptions MakeBatchOptions(const CLI::CommandLineOptions &options)
+    {
+        Vision::IO::BatchOptions batchOptions;
+        batchOptions.inputDirectory = options.batchInput->path;
+        batchOptions.inputNodeId = options.batchInput->nodeId;
+        batchOptions.outputDirectory = options.batchOutput->path;
+        batchOptions.outputNodeId = options.batchOutput->nodeId;
+        batchOptions.outputFormat = options.outputFormat;
+        batchOptions.recursive = options.recursive;
+        batchOptions.fileTimeout = options.timeout;
+        batchOptions.manifestPath = options.manifestPath;
+        if (options.ioWorkers > 0)
+        {
+            batchOptions.decodeWorkers = options.ioWorkers;
+            batchOptions.encodeWorkers = options.ioWorkers;
+        }
+        return batchOptions;
+    }
+
+    Vision::IO::FarmOptions MakeFarmOptions(const CLI::CommandLineOptions &options)
+    {
+        Vision::IO::FarmOptions farmOptions;
+        if (options.shardFiles > 0)
+        {
+            farmOptions.shardFiles = options.shardFiles;
+        }
+        farmOptions.ioWorkers = options.ioWorkers;
+        return farmOptions;
+    }
+
+    int RunBatch(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        Vision::IO::BatchProcessor processor(editor);
+        const auto result = processor.Run(MakeBatchOptions(options), [](size_t completed, size_t total, const auto &) {
+            // Report roughly every percent so huge batches do not flood the terminal
+            const size_t step = std::max<size_t>(1, total / 100);
+            if (completed % step == 0 || completed == total)
+            {
+                std::cout << "\r" << completed << '/' << total << std::flush;
+            }
+        });
+
+        if (!result)
+        {
+            std::cerr << "Batch could not start; see log for details\n";
+            return kExitUsage;
+        }
+
+        std::cout << "\n"
+                  << result->succeeded << " written, " << result->failed << " failed (" << result->timedOut
+                  << " timed out), " << result->skipped << " done before in " << result->elapsed.count() << " ms\n";
+        return result->failed == 0 ? kExitSuccess : kExitExecutionFailed;
+    }
+
+    // Creates the job, then waits for workers (this process does no image work) and reports their totals
+    int RunFarmCoordinator(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        const auto farmOptions = MakeFarmOptions(options);
+        if (!Vision::IO::BatchFarm::CreateJob(editor, options.farmCoordinator, MakeBatchOptions(options), farmOptions))
+        {
+            std::cerr << "Farm job could not be created; see log for details\n";
+            return kExitUsage;
+        }
+        std::cout << "Job ready; start workers with --farm-worker " << options.farmCoordinator.string() << '\n';
+
+        const auto result = Vision::IO::BatchFarm::Coordinate(
+            options.farmCoordinator, farmOptions, [](const Vision::IO::FarmProgress &progress) {
+                std::cout << "\r" << progress.succeededFiles + progress.failedFiles << '/' << progress.totalFiles
+                          << " (" << progress.activeWorkers << " workers, " << progress.runningShards
+                          << " shards running)" << std::flush;
+            });
+        if (!result)
+        {
+            std::cerr << "\nFarm job is unreadable; see log for details\n";
+            return kExitExecutionFailed;
+        }
+
+        std::cout << "\n"
+                  << result->succeeded << " written, " << result->failed << " failed in " << result->elapsed.count()
+                  << " ms\n";
+        return result->failed == 0 ? kExitSuccess : kExitExecutionFailed;
+    }
+
+    int RunFarmWorker(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        const auto workerName =
+            options.workerName.empty() ? Vision::IO::BatchFarm::GetDefaultWorkerName() : options.workerName;
+        std::cout << "Worker " << workerName << " waiting for shards in " << options.farmWorker.string() << '\n';
+
+        const auto shards =
+            Vision::IO::BatchFarm::Work(editor, options.farmWorker, workerName, MakeFarmOptions(options));
+        if (!shards)
+        {
+            std::cerr << "Farm job or its graph is unusable; see log for details\n";
+            return kExitLoadFailed;
+        }
+        std::cout << *shards << " shards processed\n";
+        return kExitSuccess;
+    }
+
+    // Every instance loads the graph itself, so requests on different instances share no node state
+    int RunServer(const std::shared_ptr<Nodes::ExecutorService> &executor,
+        const CLI::CommandLineOptions &options,
+        const std::optional<Vision::IO::TuningProfile> &profile)
+    {
+        std::string error;
+        auto server = CLI::GraphServer::Create(
+            *options.server,
+            executor,
+            [&options, &profile](Nodes::NodeEditor &editor, std::string &setupError) {
+                std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+                if (!editor.LoadFromFile(options.graphPath, nodePositions))
+                {
+                    setupError = "Failed to load graph: " + options.graphPath.string();
+                    return false;
+                }
+                if (!CLI::ApplyOverrides(editor, options, setupError))
+                {
+                    return false;
+                }
+                ConfigureEditor(editor, options, profile);
+                return true;
+            },
+            error);
+        if (!server)
+        {
+            std::cerr << error << '\n';
+            return kExitLoadFailed;
+        }
+        if (!server->Start(error))
+        {
+            std::cerr << error << '\n';
+            return kExitUsage;
+        }
+        std::cout << "Serving " << options.graphPath.string() << " on http://" << options.server->address << ':'
+                  << server->GetPort() << " with " << options.server->instances << " instances; Ctrl+C stops\n";
+
+        std::signal(SIGINT, OnInterrupt);
+        std::signal(SIGTERM, OnInterrupt);
+        std::jthread serving([&server](std::stop_token stopToken) { server->Serve(stopToken); });
+        while (!interrupted)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(Constants::Server::kPollMilliseconds));
+        }
+        serving.request_stop();
+        serving.join();
+
+        const auto statistics = server->GetStatistics();
+        std::cout << statistics.requests << " requests, " << statistics.failed << " failed\n";
+        return kExitSuccess;
+    }
+
+    int RunStream(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        auto &writeQueue = Nodes::WriteBehindQueue::Get();
+        const size_t failedWritesBefore = writeQueue.GetStatistics().failed;
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto frames = editor.ExecuteStream(nullptr, options.maxFrames);
+        writeQueue.Flush().wait(); // Frames are only done once their AutoSave writes are
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+        if (!frames)
+        {
+            std::cerr << "Stream execution failed; see log for details\n";
+            return kExitExecutionFailed;
+        }
+
+        const double seconds = static_cast<double>(elapsed.count()) / 1000.0;
+        std::cout << *frames << " frames in " << elapsed.count() << " ms";
+        if (seconds > 0.0)
+        {
+            std::cout << " (" << static_cast<double>(*frames) / seconds << " fps)";
+        }
+        std::cout << '\n';
+
+        if (const size_t failedWrites = writeQueue.GetStatistics().failed - failedWritesBefore; failedWrites > 0)
+        {
+            std::cerr << failedWrites << " frame saves failed; see log for details\n";
+            return kExitExecutionFailed;
+        }
+        return kExitSuccess;
+    }
+
+    int RunRecord(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        Vision::IO::RecordOptions recordOptions;
+        if (options.timedRuns > 0)
+        {
+            recordOptions.runs = options.timedRuns;
+        }
+        recordOptions.embedInputs = !options.hashInputsOnly;
+
+        std::string error;
+        if (!Vision::IO::RunRecorder::Record(editor, options.recordBundle, recordOptions, error))
+        {
+            std::cerr << error << '\n';
+            return kExitExecutionFailed;
+        }
+        std::cout << "Recorded " << recordOptions.runs << " runs into " << options.recordBundle.string() << '\n';
+        return kExitSuccess;
+    }
+
+    // Tunes from the settings the command line gave, then saves the winner where later runs look for it
+    int RunAutotune(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        const auto path =
+            !options.tuningProfile.empty() ? options.tuningProfile : Vision::IO::Autotuner::GetDefaultProfilePath();
+        if (path.empty())
+        {
+            std::cerr << "No configuration directory for the tuning profile; give --tuning-profile\n";
+            return kExitUsage;
+        }
+
+        Vision::IO::AutotuneOptions tuneOptions;
+        if (options.timedRuns > 0)
+        {
+            tuneOptions.runs = options.timedRuns;
+        }
+
+        std::string error;
+        auto profile = Vision::IO::Autotuner::Tune(
+            editor, tuneOptions, error, [](size_t done, size_t planned, const std::string &setting) {
+                std::cout << '[' << done + 1 << '/' << planned << "] " << setting << '\n';
+            });
+        if (!profile)
+        {
+            std::cerr << error << '\n';
+            return kExitExecutionFailed;
+        }
+        profile->graphName = options.graphPath.filename().string();
+        if (!Vision::IO::Autotuner::SaveProfile(*profile, path, error))
+        {
+            std::cerr << error << '\n';
+            return kExitExecutionFailed;
+        }
+
+        std::cout << "Run: " << profile->baselineTime.count() << " us before, " << profile->tunedTime.count()
+                  << " us tuned\n"
+                  << "Workers: " << profile->workerCount << ", OpenCV threads per task: " << profile->openCvThreads
+                  << ", tiles: " << (profile->tiling.enabled ? std::to_string(profile->tiling.tileSize) : "off")
+                  << ", fusion: " << (profile->tiling.fusePointwise ? "on" : "off")
+                  << ", OpenCL: " << (profile->deviceExecution ? "on" : "off");
+        for (const auto &type : profile->hostOnlyNodeTypes)
+        {
+            std::cout << ' ' << type << "=CPU";
+        }
+        std::cout << "\nSaved tuning profile to " << path.string() << '\n';
+        return kExitSuccess;
+    }
+
+    // Compiles the graph as loaded, overrides included, without executing it
+    int RunExport(const Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        Nodes::PipelineCompileOptions compileOptions;
+        compileOptions.name = options.graphPath.stem().string();
+        compileOptions.source = options.graphPath.filename().string();
+
+        std::string error;
+        const auto pipeline = Nodes::PipelineCompiler::Compile(editor, compileOptions, error);
+        if (!pipeline)
+        {
+            std::cerr << error << '\n';
+            return kExitExecutionFailed;
+        }
+        if (!Nodes::PipelineCompiler::WriteFiles(*pipeline, options.exportDirectory, error))
+        {
+            std::cerr << error << '\n';
+            return kExitExecutionFailed;
+        }
+
+        std::cout << "Compiled " << pipeline->nodes.size() << " nodes (" << pipeline->fusedChains
+                  << " fused pointwise runs, " << pipeline->skipped.size() << " unused nodes left out) into "
+                  << (options.exportDirectory / (pipeline->name + ".cpp")).string() << '\n';
+        return kExitSuccess;
+    }
+
+    // Lists every node that ran, slowest change first, so the regressions head the report
+    int RunReplay(Nodes::NodeEditor &editor, const CLI::CommandLineOptions &options)
+    {
+        Vision::IO::ReplayOptions replayOptions;
+        if (options.timedRuns > 0)
+        {
+            replayOptions.runs = options.timedRuns;
+        }
+        if (options.slowdownPercent > 0.0)
+        {
+            replayOptions.slowdownThreshold = options.slowdownPercent / 100.0;
+        }
+
+        std::string error;
+        const auto report = Vision::IO::RunRecorder::Replay(editor, options.replayBundle, replayOptions, error);
+        if (!report)
+        {
+            std::cerr << error << '\n';
+            return kExitLoadFailed;
+        }
+
+        std::cout << "Run: " << report->baselineTotal.count() << " us recorded, " << report->replayTotal.count()
+                  << " us now; peak slot memory " << report->baselinePeakBytes / 1024 << " KB recorded, "
+                  << report->replayPeakBytes / 1024 << " KB now\n";
+        for (const auto &node : report->nodes)
+        {
+            std::cout << (node.regressed ? "SLOWER " : "       ") << std::setw(6) << node.nodeId << ' '
+                      << std::left << std::setw(24) << node.nodeType << std::right << std::setw(10)
+                      << node.baselineTime.count() << " us -> ";
+            if (node.processed)
+            {
+                std::cout << std::setw(10) << node.replayTime.count() << " us";
+            }
+            else
+            {
+                std::cout << std::setw(13) << "not run";
+            }
+            std::cout << "  (" << node.nodeName << ")\n";
+        }
+
+        if (report->regressions > 0)
+        {
+            std::cerr << report->regressions << " nodes regressed\n";
+            return kExitRegression;
+        }
+        return kExitSuccess;
+    }
+
+    // AutoSave outputs report failure through their status rather than through Execute()
+    bool AllAutoSavesSucceeded(const Nodes::NodeEditor &editor)
+    {
+        bool succeeded = true;
+        for (const auto id : editor.GetNodeIds())
+        {
+            const auto *output = dynamic_cast<const Vision::IO::ImageOutputNode *>(editor.GetNode(id));
+            if (output && output->GetInputValue<bool>("AutoSave").value_or(false) && !output->GetLastSaveStatus())
+            {
+                std::cerr << "Output node " << id << " failed to save its image\n";
+                succeeded = false;
+            }
+        }
+        return succeeded;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::string_view programName = argc > 0 ? argv[0] : "vision_craft_cli";
+    const std::vector<std::string_view> args(argv + (argc > 0 ? 1 : 0), argv + argc);
+
+    std::string error;
+    const auto options = CLI::ParseCommandLine(args, error);
+    if (!options)
+    {
+        std::cerr << error << "\n\n" << CLI::GetUsage(programName);
+        return kExitUsage;
+    }
+    if (options->showHelp)
+    {
+        std::cout << CLI::GetUsage(programName);
+        return kExitSuccess;
+    }
+
+    std::optional<Vision::IO::TuningProfile> tuningProfile;
+    if (!LoadTuningProfile(*options, tuningProfile))
+    {
+        return kExitLoadFailed;
+    }
+
+    Vision::NodeFactory::RegisterAllNodes();
+    if (options->cuda)
+    {
+        Vision::NodeFactory::SetBackend(Vision::NodeBackend::Cuda);
+    }
+
+    if (options->maxCores != 0)
+    {
+        Nodes::ThreadBudget::Get().SetMaxCores(options->maxCores);
+    }
+    if (options->memoryBudgetBytes != 0)
+    {
+        Nodes::MemoryBudget::Get().SetScratchDirectory(options->scratchDirectory);
+        Nodes::MemoryBudget::Get().SetLimit(options->memoryBudgetBytes);
+    }
+
+    // One executor for the whole run: graph runs, parallel steps and batch I/O all reuse its threads
+    const size_t workerCount =
+        options->workerCount == 0 && tuningProfile ? tuningProfile->workerCount : options->workerCount;
+    const auto executor = std::make_shared<Nodes::ExecutorService>(Nodes::ExecutorService::Options{
+        .workerCount = workerCount, .pinWorkers = options->pinThreads, .numaAware = options->numaAware });
+    const MetricsSession metricsSession(options->metricsPath, options->metricsInterval, options->server.has_value());
+    if (options->server)
+    {
+        const TraceSession traceSession(options->tracePath);
+        return RunServer(executor, *options, tuningProfile);
+    }
+
+    Nodes::NodeEditor editor;
+    editor.SetExecutorService(executor);
+    std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+    // Farm workers and replays load the job's or bundle's graph, with overrides already applied
+    if (options->farmWorker.empty() && options->replayBundle.empty())
+    {
+        if (!editor.LoadFromFile(options->graphPath, nodePositions))
+        {
+            std::cerr << "Failed to load graph: " << options->graphPath.string() << '\n';
+            return kExitLoadFailed;
+        }
+
+        if (!CLI::ApplyOverrides(editor, *options, error))
+        {
+            std::cerr << error << '\n';
+            return kExitUsage;
+        }
+    }
+
+    ConfigureEditor(editor, *options, tuningProfile);
+
+    const TraceSession traceSession(options->tracePath);
+
+    if (!options->replayBundle.empty())
+    {
+        return RunReplay(editor, *options);
+    }
+
+    if (!options->recordBundle.empty())
+    {
+        return RunRecord(editor, *options);
+    }
+
+    if (options->autotune)
+    {
+        return RunAutotune(editor, *options);
+    }
+
+    if (!options->exportDirectory.empty())
+    {
+        return RunExport(editor, *options);
+    }
+
+    if (!options->farmWorker.empty())
+    {
+        return RunFarmWorker(editor, *options);
+    }
+
+    if (!options->farmCoordinator.empty())
+    {
+        return RunFarmCoordinator(editor, *options);
+    }
+
+    if (options->batchInput)
+    {
+        return RunBatch(editor, *options);
+    }
+
+    if (options->stream)
+    {
+        return RunStream(editor, *options);
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const bool executed = editor.Execute();
+    // Saves finish behind execution; the run is not done until they are on disk
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    if (run && run->writesFlushed.valid())
+    {
+        run->writesFlushed.wait();
+    }
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+    // Logged for failed runs too: the node holding the most memory is the first suspect
+    if (run)
+    {
+        LOG_INFO("Peak slot memory {} KB after node {}, {} KB retained",
+            run->peakSlotBytes / 1024,
+            run->peakNodeId,
+            run->retainedSlotBytes / 1024);
+        if (run->spilledOutputs > 0)
+        {
+            LOG_INFO("Spilled {} intermediate results to stay under the memory budget", run->spilledOutputs);
+        }
+    }
+
+    if (!executed)
+    {
+        std::cerr << "Graph execution failed\n";
+        return kExitExecutionFailed;
+    }
+
+    LOG_INFO("Executed {} in {} ms", options->graphPath.string(), elapsed.count());
+    return AllAutoSavesSucceeded(editor) ? kExitSuccess : kExitExecutionFailed;
+}
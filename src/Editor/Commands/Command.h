@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -41,6 +42,38 @@ namespace VisionCraft::Editor::Commands
          */
         [[nodiscard]] virtual std::string GetDescription() const = 0;
 
+        /**
+         * @brief Returns the bytes of editor state this command keeps alive for undo/redo.
+         * @return Retained bytes (0 for commands that only store IDs and positions)
+         */
+        [[nodiscard]] virtual size_t GetMemoryFootprint() const
+        {
+            return 0;
+        }
+
+        /**
+         * @brief Drops retained state that can be recomputed, keeping the command undoable.
+         *
+         * Called by CommandHistory when retained state exceeds its budget. Undo afterwards may be
+         * slower (e.g. a restored node runs again) but restores the same graph.
+         */
+        virtual void ReleaseMemory()
+        {
+        }
+
+        /**
+         * @brief Absorbs a compatible command executed right after this one into the same history entry.
+         * @param next Command that has just been executed
+         * @return True if this command now also covers next (next is then discarded); false by default
+         * @note Called by CommandHistory while this is the newest command and no gesture ended since
+         *       (see CommandHistory::SealLastCommand()). Undo() must then revert both.
+         */
+        [[nodiscard]] virtual bool MergeWith(const Command &next)
+        {
+            (void)next;
+            return false;
+        }
+
     protected:
         /**
          * @brief Protected constructor - only derived classes can instantiate.
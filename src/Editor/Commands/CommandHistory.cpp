@@ -1,8 +1,11 @@
 #include "CommandHistory.h"
 
+#include <algorithm>
+
 namespace VisionCraft::Editor::Commands
 {
-    CommandHistory::CommandHistory(size_t maxHistorySize) : maxHistorySize(maxHistorySize)
+    CommandHistory::CommandHistory(size_t maxHistorySize, size_t retainedBytesBudget)
+        : ring(maxHistorySize), maxHistorySize(maxHistorySize), retainedBytesBudget(retainedBytesBudget)
     {
     }
 
@@ -14,16 +17,45 @@ namespace VisionCraft::Editor::Commands
         }
 
         command->Execute();
+        ++revision;
 
-        if (currentIndex < history.size())
+        if (!lastCommandSealed && count > 0 && currentIndex == count)
         {
-            history.erase(history.begin() + currentIndex, history.end());
+            auto &newest = At(count - 1);
+            if (newest.command->MergeWith(*command))
+            {
+                Remeasure(newest);
+                EnforceRetainedBytesBudget();
+                return;
+            }
         }
 
-        history.push_back(std::move(command));
-        ++currentIndex;
+        // Drop the redo steps
+        while (count > currentIndex)
+        {
+            auto &entry = At(count - 1);
+            retainedBytes -= entry.footprint;
+            entry = {};
+            --count;
+        }
+
+        if (maxHistorySize == 0)
+        {
+            return;
+        }
+        if (count == maxHistorySize)
+        {
+            PopOldest();
+        }
 
-        TrimHistory();
+        auto &entry = At(count);
+        entry.command = std::move(command);
+        ++count;
+        currentIndex = count;
+        lastCommandSealed = false;
+        Remeasure(entry);
+
+        EnforceRetainedBytesBudget();
     }
 
     bool CommandHistory::Undo()
@@ -34,7 +66,11 @@ namespace VisionCraft::Editor::Commands
         }
 
         --currentIndex;
-        history[currentIndex]->Undo();
+        ++revision;
+        lastCommandSealed = true;
+        auto &entry = At(currentIndex);
+        entry.command->Undo();
+        Remeasure(entry);
 
         return true;
     }
@@ -46,8 +82,13 @@ namespace VisionCraft::Editor::Commands
             return false;
         }
 
-        history[currentIndex]->Execute();
+        lastCommandSealed = true;
+        ++revision;
+        auto &entry = At(currentIndex);
+        entry.command->Execute();
         ++currentIndex;
+        Remeasure(entry);
+        EnforceRetainedBytesBudget();
 
         return true;
     }
@@ -59,7 +100,7 @@ namespace VisionCraft::Editor::Commands
 
     bool CommandHistory::CanRedo() const
     {
-        return currentIndex < history.size();
+        return currentIndex < count;
     }
 
     std::string CommandHistory::GetUndoDescription() const
@@ -69,7 +110,7 @@ namespace VisionCraft::Editor::Commands
             return "";
         }
 
-        return history[currentIndex - 1]->GetDescription();
+        return At(currentIndex - 1).command->GetDescription();
     }
 
     std::string CommandHistory::GetRedoDescription() const
@@ -79,32 +120,94 @@ namespace VisionCraft::Editor::Commands
             return "";
         }
 
-        return history[currentIndex]->GetDescription();
+        return At(currentIndex).command->GetDescription();
     }
 
     void CommandHistory::Clear()
     {
-        history.clear();
+        for (auto &entry : ring)
+        {
+            entry = {};
+        }
+        head = 0;
+        count = 0;
         currentIndex = 0;
+        retainedBytes = 0;
+        lastCommandSealed = true;
+    }
+
+    void CommandHistory::SetRetainedBytesBudget(size_t bytes)
+    {
+        retainedBytesBudget = bytes;
+        EnforceRetainedBytesBudget();
     }
 
-    void CommandHistory::TrimHistory()
+    CommandHistory::Entry &CommandHistory::At(size_t index)
     {
-        if (history.size() <= maxHistorySize)
+        return ring[(head + index) % ring.size()];
+    }
+
+    const CommandHistory::Entry &CommandHistory::At(size_t index) const
+    {
+        return ring[(head + index) % ring.size()];
+    }
+
+    void CommandHistory::Remeasure(Entry &entry)
+    {
+        retainedBytes -= entry.footprint;
+        entry.footprint = entry.command->GetMemoryFootprint();
+        retainedBytes += entry.footprint;
+    }
+
+    void CommandHistory::PopOldest()
+    {
+        auto &entry = At(0);
+        retainedBytes -= entry.footprint;
+        entry = {};
+        head = (head + 1) % ring.size();
+        --count;
+        currentIndex = currentIndex > 0 ? currentIndex - 1 : 0;
+    }
+
+    void CommandHistory::EnforceRetainedBytesBudget()
+    {
+        if (retainedBytes <= retainedBytesBudget)
         {
             return;
         }
 
-        const size_t toRemove = history.size() - maxHistorySize;
-        history.erase(history.begin(), history.begin() + toRemove);
+        // Heaviest first: one large retained image frees more than many small ones, and the step stays
+        // undoable. Ties go to the oldest step, the least likely to be undone.
+        std::vector<size_t> order;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (At(i).footprint > 0)
+            {
+                order.push_back(i);
+            }
+        }
+        std::ranges::stable_sort(order, [this](size_t a, size_t b) { return At(a).footprint > At(b).footprint; });
+        for (const auto index : order)
+        {
+            if (retainedBytes <= retainedBytesBudget)
+            {
+                return;
+            }
+            auto &entry = At(index);
+            entry.command->ReleaseMemory();
+            Remeasure(entry);
+        }
 
-        if (currentIndex > toRemove)
+        // State the commands cannot release: forget undo steps from the oldest up to the ones holding it
+        size_t undoBytes = 0;
+        for (size_t i = 0; i < currentIndex; ++i)
         {
-            currentIndex -= toRemove;
+            undoBytes += At(i).footprint;
         }
-        else
+        while (retainedBytes > retainedBytesBudget && undoBytes > 0)
         {
-            currentIndex = 0;
+            undoBytes -= At(0).footprint;
+            PopOldest();
         }
     }
 
@@ -2,6 +2,7 @@
 
 #include "Command.h"
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -13,15 +14,27 @@ namespace VisionCraft::Editor::Commands
      * Maintains a stack of executed commands and supports undo/redo operations.
      * Uses a linear history model - executing a new command after undo
      * clears the redo stack.
+     *
+     * Commands live in a fixed-capacity ring buffer, so dropping the oldest command when the history
+     * is full is O(1) instead of shifting every entry.
+     *
+     * Commands may keep editor state alive for undo (e.g. a deleted node with its outputs). Their
+     * GetMemoryFootprint() is cached per entry and summed as commands execute, undo and redo. When the
+     * sum exceeds the retained-bytes budget, the heaviest commands are asked to ReleaseMemory() first;
+     * if state that cannot be released still exceeds the budget, the oldest undo steps are dropped.
      */
     class CommandHistory
     {
     public:
+        /** @brief Default budget for state retained by commands (256 MiB) */
+        static constexpr size_t kDefaultRetainedBytesBudget = size_t{ 256 } << 20;
+
         /**
          * @brief Default constructor.
          * @param maxHistorySize Maximum number of commands to keep (default: 100)
+         * @param retainedBytesBudget Maximum bytes commands may retain before the oldest release theirs
          */
-        explicit CommandHistory(size_t maxHistorySize = 100);
+        explicit CommandHistory(size_t maxHistorySize = 100, size_t retainedBytesBudget = kDefaultRetainedBytesBudget);
 
         /**
          * @brief Executes a command and adds it to history.
@@ -29,9 +42,21 @@ namespace VisionCraft::Editor::Commands
          *
          * Executes the command immediately, then stores it in history.
          * Clears any redo history if we're not at the end of the stack.
+         * If the newest command is unsealed and MergeWith() accepts the new one, no entry is added.
          */
         void ExecuteCommand(std::unique_ptr<Command> command);
 
+        /**
+         * @brief Ends the current edit gesture, so the newest command absorbs no further commands.
+         *
+         * Call when a drag or slider scrub finishes; the next command then starts a new history entry.
+         * Undo(), Redo() and Clear() also seal.
+         */
+        void SealLastCommand()
+        {
+            lastCommandSealed = true;
+        }
+
         /**
          * @brief Undoes the most recent command.
          * @return True if undo was performed, false if nothing to undo
@@ -82,7 +107,7 @@ namespace VisionCraft::Editor::Commands
          */
         [[nodiscard]] size_t GetHistorySize() const
         {
-            return history.size();
+            return count;
         }
 
         /**
@@ -94,15 +119,81 @@ namespace VisionCraft::Editor::Commands
             return currentIndex;
         }
 
+        /**
+         * @brief Sets the budget for state retained by commands.
+         * @param bytes Maximum retained bytes (applied immediately)
+         */
+        void SetRetainedBytesBudget(size_t bytes);
+
+        /**
+         * @brief Returns the bytes currently retained by commands in history.
+         * @return Sum of GetMemoryFootprint() over all commands
+         */
+        [[nodiscard]] size_t GetRetainedBytes() const
+        {
+            return retainedBytes;
+        }
+
+        /**
+         * @brief Returns a counter bumped whenever a command changes the document.
+         * @return Revision, advanced by every execute (merged or not), undo and redo; Clear() keeps it
+         * @note Lets autosave skip documents that have not changed since the last save.
+         */
+        [[nodiscard]] uint64_t GetRevision() const
+        {
+            return revision;
+        }
+
     private:
-        std::vector<std::unique_ptr<Command>> history; ///< Command history stack
-        size_t currentIndex = 0;                       ///< Current position in history (0 = nothing executed)
-        size_t maxHistorySize;                         ///< Maximum number of commands to keep
+        /**
+         * @brief A command in history with its last measured footprint.
+         */
+        struct Entry
+        {
+            std::unique_ptr<Command> command; ///< Stored command
+            size_t footprint = 0;             ///< GetMemoryFootprint() when last measured
+        };
+
+        std::vector<Entry> ring;       ///< Ring buffer of maxHistorySize entries
+        size_t head = 0;               ///< Ring position of the oldest command
+        size_t count = 0;              ///< Number of commands in history
+        size_t currentIndex = 0;       ///< Current position in history (0 = nothing executed)
+        size_t maxHistorySize;         ///< Maximum number of commands to keep
+        size_t retainedBytesBudget;    ///< Maximum bytes retained by commands
+        size_t retainedBytes = 0;      ///< Sum of entry footprints
+        bool lastCommandSealed = true; ///< Newest command may not absorb the next one
+        uint64_t revision = 0;         ///< Bumped by every document change
+
+        /**
+         * @brief Returns a history entry.
+         * @param index Position in history (0 = oldest)
+         * @return Entry
+         */
+        [[nodiscard]] Entry &At(size_t index);
+
+        /**
+         * @brief Returns a history entry.
+         * @param index Position in history (0 = oldest)
+         * @return Entry
+         */
+        [[nodiscard]] const Entry &At(size_t index) const;
+
+        /**
+         * @brief Re-measures an entry's footprint and updates the retained total.
+         * @param entry Entry whose command just executed, undid or released memory
+         */
+        void Remeasure(Entry &entry);
+
+        /**
+         * @brief Destroys the oldest command.
+         */
+        void PopOldest();
 
         /**
-         * @brief Removes oldest commands if history exceeds max size.
+         * @brief Releases retained state, heaviest commands first, then drops old undo steps until the
+         *        total fits the budget.
          */
-        void TrimHistory();
+        void EnforceRetainedBytesBudget();
     };
 
 } // namespace VisionCraft::Editor::Commands
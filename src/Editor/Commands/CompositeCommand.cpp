@@ -0,0 +1,67 @@
+#include "CompositeCommand.h"
+
+#include <numeric>
+#include <ranges>
+
+namespace VisionCraft::Editor::Commands
+{
+    CompositeCommand::CompositeCommand(std::string description,
+        std::vector<std::unique_ptr<Command>> parts,
+        BatchScope batchScope)
+        : description(std::move(description)), parts(std::move(parts)), batchScope(std::move(batchScope))
+    {
+    }
+
+    void CompositeCommand::Execute()
+    {
+        RunBatched([this] {
+            for (auto &part : parts)
+            {
+                part->Execute();
+            }
+        });
+    }
+
+    void CompositeCommand::Undo()
+    {
+        RunBatched([this] {
+            for (auto &part : parts | std::views::reverse)
+            {
+                part->Undo();
+            }
+        });
+    }
+
+    std::string CompositeCommand::GetDescription() const
+    {
+        return description;
+    }
+
+    size_t CompositeCommand::GetMemoryFootprint() const
+    {
+        return std::accumulate(parts.begin(), parts.end(), size_t{ 0 }, [](size_t sum, const auto &part) {
+            return sum + part->GetMemoryFootprint();
+        });
+    }
+
+    void CompositeCommand::ReleaseMemory()
+    {
+        for (auto &part : parts)
+        {
+            part->ReleaseMemory();
+        }
+    }
+
+    void CompositeCommand::RunBatched(const std::function<void()> &body) const
+    {
+        if (batchScope)
+        {
+            batchScope(body);
+        }
+        else
+        {
+            body();
+        }
+    }
+
+} // namespace VisionCraft::Editor::Commands
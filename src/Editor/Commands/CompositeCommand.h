@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Command.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace VisionCraft::Editor::Commands
+{
+    /**
+     * @brief Several commands undone and redone as one history entry.
+     *
+     * Execute() runs the parts in order and Undo() reverts them in reverse order. Both run inside the
+     * batch scope, so a NodeEditor transaction can cover every part at once.
+     */
+    class CompositeCommand : public Command
+    {
+    public:
+        /** @brief Runs the given body, e.g. inside a NodeEditor transaction */
+        using BatchScope = std::function<void(const std::function<void()> &)>;
+
+        /**
+         * @brief Creates a composite command.
+         * @param description Description shown for the whole step (e.g. "Paste 12 Nodes")
+         * @param parts Commands in execution order
+         * @param batchScope Wraps every Execute() and Undo(); nullptr runs the parts directly
+         */
+        CompositeCommand(std::string description,
+            std::vector<std::unique_ptr<Command>> parts,
+            BatchScope batchScope = nullptr);
+
+        void Execute() override;
+
+        void Undo() override;
+
+        [[nodiscard]] std::string GetDescription() const override;
+
+        [[nodiscard]] size_t GetMemoryFootprint() const override;
+
+        void ReleaseMemory() override;
+
+    private:
+        /**
+         * @brief Runs body inside the batch scope, or directly if there is none.
+         * @param body Work to run
+         */
+        void RunBatched(const std::function<void()> &body) const;
+
+        std::string description;                     ///< Description of the whole step
+        std::vector<std::unique_ptr<Command>> parts; ///< Commands in execution order
+        BatchScope batchScope;                       ///< Wraps Execute() and Undo()
+    };
+
+} // namespace VisionCraft::Editor::Commands
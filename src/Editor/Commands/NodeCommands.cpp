@@ -1,4 +1,5 @@
 #include "NodeCommands.h"
+#include "Nodes/Core/NodeOutputCache.h"
 
 namespace VisionCraft::Editor::Commands
 {
@@ -40,12 +41,12 @@ namespace VisionCraft::Editor::Commands
 
     DeleteNodeCommand::DeleteNodeCommand(Nodes::NodeId nodeId,
         NodeGetter nodeGetter,
-        NodeRemover nodeRemover,
+        NodeDetacher nodeDetacher,
         NodeAdder nodeAdder,
         PositionGetter positionGetter,
         PositionSetter positionSetter,
         NodeRecreator nodeRecreator)
-        : nodeId(nodeId), nodeGetter(std::move(nodeGetter)), nodeRemover(std::move(nodeRemover)),
+        : nodeId(nodeId), nodeGetter(std::move(nodeGetter)), nodeDetacher(std::move(nodeDetacher)),
           nodeAdder(std::move(nodeAdder)), positionGetter(std::move(positionGetter)),
           positionSetter(std::move(positionSetter)), nodeRecreator(std::move(nodeRecreator))
     {
@@ -64,7 +65,7 @@ namespace VisionCraft::Editor::Commands
             }
         }
 
-        nodeRemover(nodeId);
+        removedNode = nodeDetacher(nodeId);
         executed = true;
     }
 
@@ -75,7 +76,7 @@ namespace VisionCraft::Editor::Commands
             return;
         }
 
-        auto node = nodeRecreator(nodeType, nodeId, nodeName);
+        auto node = removedNode ? std::move(removedNode) : nodeRecreator(nodeType, nodeId, nodeName);
         if (node)
         {
             nodeAdder(std::move(node));
@@ -83,6 +84,38 @@ namespace VisionCraft::Editor::Commands
         }
     }
 
+    size_t DeleteNodeCommand::GetMemoryFootprint() const
+    {
+        if (!removedNode)
+        {
+            return 0;
+        }
+
+        size_t bytes = 0;
+        for (Nodes::SlotIndex slot = 0; slot < removedNode->GetOutputSlotCount(); ++slot)
+        {
+            if (const auto data = removedNode->GetOutputSlot(slot).GetSharedData())
+            {
+                bytes += Nodes::NodeOutputCache::EstimateBytes(*data);
+            }
+        }
+        return bytes;
+    }
+
+    void DeleteNodeCommand::ReleaseMemory()
+    {
+        if (!removedNode)
+        {
+            return;
+        }
+
+        for (Nodes::SlotIndex slot = 0; slot < removedNode->GetOutputSlotCount(); ++slot)
+        {
+            removedNode->ClearOutputSlot(slot);
+        }
+        removedNode->MarkDirty();
+    }
+
     std::string DeleteNodeCommand::GetDescription() const
     {
         if (!nodeName.empty())
@@ -94,10 +127,11 @@ namespace VisionCraft::Editor::Commands
 
     // MoveNodesCommand
 
-    MoveNodesCommand::MoveNodesCommand(const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &oldPositions,
-        const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &newPositions,
+    MoveNodesCommand::MoveNodesCommand(std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> oldPositions,
+        std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> newPositions,
         PositionSetter positionSetter)
-        : oldPositions(oldPositions), newPositions(newPositions), positionSetter(std::move(positionSetter))
+        : oldPositions(std::move(oldPositions)), newPositions(std::move(newPositions)),
+          positionSetter(std::move(positionSetter))
     {
     }
 
@@ -126,4 +160,47 @@ namespace VisionCraft::Editor::Commands
         return "Move " + std::to_string(newPositions.size()) + " Nodes";
     }
 
+    // SetParameterCommand
+
+    SetParameterCommand::SetParameterCommand(Nodes::NodeId nodeId,
+        std::string parameterName,
+        Nodes::NodeData oldValue,
+        Nodes::NodeData newValue,
+        ParameterSetter parameterSetter)
+        : nodeId(nodeId), parameterName(std::move(parameterName)), oldValue(std::move(oldValue)),
+          newValue(std::move(newValue)), parameterSetter(std::move(parameterSetter))
+    {
+    }
+
+    void SetParameterCommand::Execute()
+    {
+        parameterSetter(nodeId, parameterName, newValue);
+    }
+
+    void SetParameterCommand::Undo()
+    {
+        parameterSetter(nodeId, parameterName, oldValue);
+    }
+
+    std::string SetParameterCommand::GetDescription() const
+    {
+        return "Set " + parameterName;
+    }
+
+    size_t SetParameterCommand::GetMemoryFootprint() const
+    {
+        return Nodes::NodeOutputCache::EstimateBytes(oldValue) + Nodes::NodeOutputCache::EstimateBytes(newValue);
+    }
+
+    bool SetParameterCommand::MergeWith(const Command &next)
+    {
+        const auto *edit = dynamic_cast<const SetParameterCommand *>(&next);
+        if (!edit || edit->nodeId != nodeId || edit->parameterName != parameterName)
+        {
+            return false;
+        }
+        newValue = edit->newValue;
+        return true;
+    }
+
 } // namespace VisionCraft::Editor::Commands
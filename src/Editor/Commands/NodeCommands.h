@@ -51,14 +51,19 @@ namespace VisionCraft::Editor::Commands
 
     /**
      * @brief Command for deleting a node.
+     *
+     * The removed node is kept detached inside the command, so undo reinserts the same instance with
+     * its parameters and output data and nothing has to run again. ReleaseMemory() drops the kept
+     * output data; the node then runs again after undo. If no node was kept, undo falls back to
+     * recreating a fresh node from its type and name.
      */
     class DeleteNodeCommand : public Command
     {
     public:
         /** @brief Function that retrieves a node pointer */
         using NodeGetter = std::function<Nodes::Node *(Nodes::NodeId)>;
-        /** @brief Function that removes a node from the editor */
-        using NodeRemover = std::function<void(Nodes::NodeId)>;
+        /** @brief Function that removes a node from the editor and returns it */
+        using NodeDetacher = std::function<std::unique_ptr<Nodes::Node>(Nodes::NodeId)>;
         /** @brief Function that adds a node to the editor */
         using NodeAdder = std::function<void(std::unique_ptr<Nodes::Node>)>;
         /** @brief Function that retrieves a node's position */
@@ -71,7 +76,7 @@ namespace VisionCraft::Editor::Commands
 
         DeleteNodeCommand(Nodes::NodeId nodeId,
             NodeGetter nodeGetter,
-            NodeRemover nodeRemover,
+            NodeDetacher nodeDetacher,
             NodeAdder nodeAdder,
             PositionGetter positionGetter,
             PositionSetter positionSetter,
@@ -83,19 +88,31 @@ namespace VisionCraft::Editor::Commands
 
         [[nodiscard]] std::string GetDescription() const override;
 
+        /**
+         * @brief Returns the bytes held by the detached node's output slots.
+         * @return Output bytes, or 0 while the node is in the editor
+         */
+        [[nodiscard]] size_t GetMemoryFootprint() const override;
+
+        /**
+         * @brief Clears the detached node's output slots and marks it dirty.
+         */
+        void ReleaseMemory() override;
+
     private:
         Nodes::NodeId nodeId;          ///< ID of node to delete
         NodeGetter nodeGetter;         ///< Gets node pointer
-        NodeRemover nodeRemover;       ///< Removes node from editor
+        NodeDetacher nodeDetacher;     ///< Removes node from editor
         NodeAdder nodeAdder;           ///< Adds node to editor
         PositionGetter positionGetter; ///< Gets node position
         PositionSetter positionSetter; ///< Sets node position
-        NodeRecreator nodeRecreator;   ///< Recreates node from saved data
+        NodeRecreator nodeRecreator;   ///< Recreates node when none was kept
 
-        std::string nodeType;                   ///< Saved node type for undo
-        std::string nodeName;                   ///< Saved node name for undo
-        UI::Widgets::NodePosition nodePosition; ///< Saved node position for undo
-        bool executed = false;                  ///< Tracks whether command has been executed
+        std::string nodeType;                     ///< Saved node type for undo
+        std::string nodeName;                     ///< Saved node name for undo
+        UI::Widgets::NodePosition nodePosition;   ///< Saved node position for undo
+        std::unique_ptr<Nodes::Node> removedNode; ///< Node detached by Execute() (reinserted by Undo())
+        bool executed = false;                    ///< Tracks whether command has been executed
     };
 
     /**
@@ -107,8 +124,8 @@ namespace VisionCraft::Editor::Commands
         /** @brief Function that sets a node's position */
         using PositionSetter = std::function<void(Nodes::NodeId, const UI::Widgets::NodePosition &)>;
 
-        MoveNodesCommand(const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &oldPositions,
-            const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &newPositions,
+        MoveNodesCommand(std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> oldPositions,
+            std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> newPositions,
             PositionSetter positionSetter);
 
         void Execute() override;
@@ -123,4 +140,49 @@ namespace VisionCraft::Editor::Commands
         PositionSetter positionSetter;                                             ///< Sets node positions
     };
 
+    /**
+     * @brief Command for setting a parameter (an input slot default) of a node.
+     *
+     * Consecutive edits of the same parameter merge into one command that keeps the first old value
+     * and the latest new value, so scrubbing a slider leaves a single undo step.
+     */
+    class SetParameterCommand : public Command
+    {
+    public:
+        /** @brief Function that sets a node's input slot default */
+        using ParameterSetter = std::function<void(Nodes::NodeId, const std::string &, const Nodes::NodeData &)>;
+
+        SetParameterCommand(Nodes::NodeId nodeId,
+            std::string parameterName,
+            Nodes::NodeData oldValue,
+            Nodes::NodeData newValue,
+            ParameterSetter parameterSetter);
+
+        void Execute() override;
+
+        void Undo() override;
+
+        [[nodiscard]] std::string GetDescription() const override;
+
+        /**
+         * @brief Returns the bytes held by the old and new values (non-zero only for images and text).
+         * @return Value bytes
+         */
+        [[nodiscard]] size_t GetMemoryFootprint() const override;
+
+        /**
+         * @brief Takes the new value of a following edit of the same node parameter.
+         * @param next Command that has just been executed
+         * @return True if next is a SetParameterCommand for the same node and parameter
+         */
+        [[nodiscard]] bool MergeWith(const Command &next) override;
+
+    private:
+        Nodes::NodeId nodeId;            ///< Node whose parameter is set
+        std::string parameterName;       ///< Input slot name
+        Nodes::NodeData oldValue;        ///< Default before the first merged edit
+        Nodes::NodeData newValue;        ///< Default after the latest merged edit
+        ParameterSetter parameterSetter; ///< Sets the input slot default
+    };
+
 } // namespace VisionCraft::Editor::Commands
@@ -1,5 +1,6 @@
 #include "Editor/Persistence/RecentFilesManager.h"
 #include "Logger.h"
+#include "Nodes/Core/StartupProfile.h"
 
 #include <nlohmann/json.hpp>
 #include <algorithm>
@@ -13,6 +14,7 @@ namespace VisionCraft::Editor::Persistence
 
     std::vector<std::string> RecentFilesManager::Load() const
     {
+        Nodes::StartupScope scope("Recent files");
         std::vector<std::string> files;
 
         try
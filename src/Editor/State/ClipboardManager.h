@@ -30,8 +30,8 @@ namespace VisionCraft::Editor::State
     {
         Nodes::NodeId fromNodeId; ///< Source node original ID
         Nodes::NodeId toNodeId;   ///< Destination node original ID
-        std::string fromSlot;     ///< Source slot name
-        std::string toSlot;       ///< Destination slot name
+        Nodes::SlotName fromSlot; ///< Source slot name
+        Nodes::SlotName toSlot;   ///< Destination slot name
     };
 
     /**
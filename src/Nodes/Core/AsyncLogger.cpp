@@ -0,0 +1,160 @@
+#include "Nodes/Core/AsyncLogger.h"
+#include "Logger.h"
+
+#include <chrono>
+#include <cstddef>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        constexpr size_t kCapacity = Constants::Logging::kAsyncQueueCapacity;
+        constexpr size_t kIndexMask = kCapacity - 1;
+    } // namespace
+
+    AsyncLogger &AsyncLogger::Get()
+    {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    AsyncLogger::AsyncLogger() : cells(std::make_unique<Cell[]>(kCapacity))
+    {
+        for (size_t i = 0; i < kCapacity; ++i)
+        {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        // Creates the application logger before this singleton, so it is destroyed after the final drain
+        LOG_DEBUG("Async log sink started ({} slots)", kCapacity);
+        sinkThread = std::jthread([this](std::stop_token stopToken) { Drain(stopToken); });
+    }
+
+    AsyncLogger::~AsyncLogger()
+    {
+        sinkThread.request_stop();
+        pending.store(true, std::memory_order_release);
+        pending.notify_one();
+        sinkThread.join();
+    }
+
+    // Bounded multi-producer queue (Vyukov): a slot is free for position p when its sequence equals p,
+    // and holds a message for the sink when its sequence equals p + 1
+    AsyncLogger::Cell *AsyncLogger::ClaimCell()
+    {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell &cell = cells[position & kIndexMask];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    return &cell;
+                }
+            }
+            else if (difference < 0)
+            {
+                droppedCount.fetch_add(1, std::memory_order_relaxed);
+                unreportedDrops.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void AsyncLogger::PublishCell(Cell &cell)
+    {
+        const size_t position = cell.sequence.load(std::memory_order_relaxed);
+        cell.sequence.store(position + 1, std::memory_order_release);
+
+        // Only the first producer after the sink went idle pays for the wake-up
+        if (!pending.exchange(true, std::memory_order_acq_rel))
+        {
+            pending.notify_one();
+        }
+    }
+
+    void AsyncLogger::Drain(std::stop_token stopToken)
+    {
+        while (true)
+        {
+            pending.store(false, std::memory_order_release);
+
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+            while (true)
+            {
+                Cell &cell = cells[position & kIndexMask];
+                if (cell.sequence.load(std::memory_order_acquire) != position + 1)
+                {
+                    break;
+                }
+
+                Emit(cell.level, std::string_view(cell.text.data(), cell.length));
+                cell.sequence.store(position + kCapacity, std::memory_order_release);
+                dequeuePosition.store(++position, std::memory_order_release);
+            }
+
+            if (const auto dropped = unreportedDrops.exchange(0, std::memory_order_relaxed); dropped > 0)
+            {
+                Emit(LogLevel::Warn, fmt::format("Async log buffer full, dropped {} messages", dropped));
+            }
+
+            // Exit only once nothing is left, so messages logged before shutdown are not lost
+            if (stopToken.stop_requested() && cells[position & kIndexMask].sequence.load() != position + 1)
+            {
+                return;
+            }
+            pending.wait(false, std::memory_order_acquire);
+        }
+    }
+
+    void AsyncLogger::Emit(LogLevel level, std::string_view message)
+    {
+        std::scoped_lock lock(sinkMutex);
+        if (sink)
+        {
+            sink(level, message);
+            return;
+        }
+
+        switch (level)
+        {
+        case LogLevel::Debug:
+            LOG_DEBUG("{}", message);
+            break;
+        case LogLevel::Info:
+            LOG_INFO("{}", message);
+            break;
+        case LogLevel::Warn:
+            LOG_WARN("{}", message);
+            break;
+        }
+    }
+
+    void AsyncLogger::Flush()
+    {
+        const size_t target = enqueuePosition.load(std::memory_order_acquire);
+        while (dequeuePosition.load(std::memory_order_acquire) < target)
+        {
+            // A producer may have claimed a slot but not published it yet; the sink needs no wake-up then
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    void AsyncLogger::SetSink(Sink newSink)
+    {
+        std::scoped_lock lock(sinkMutex);
+        sink = std::move(newSink);
+    }
+
+    uint64_t AsyncLogger::GetDroppedCount() const
+    {
+        return droppedCount.load(std::memory_order_relaxed);
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,185 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+
+// Hot-path log levels, comparable in the preprocessor
+#define VISION_CRAFT_LOG_LEVEL_DEBUG 1
+#define VISION_CRAFT_LOG_LEVEL_INFO 2
+#define VISION_CRAFT_LOG_LEVEL_WARN 3
+#define VISION_CRAFT_LOG_LEVEL_OFF 4
+
+// Minimum level compiled into LOG_HOT_* calls (set by the VISION_CRAFT_HOT_LOG_LEVEL CMake cache variable)
+#ifndef VISION_CRAFT_HOT_LOG_LEVEL
+#define VISION_CRAFT_HOT_LOG_LEVEL VISION_CRAFT_LOG_LEVEL_WARN
+#endif
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Severity of a hot-path log message.
+     */
+    enum class LogLevel : uint8_t
+    {
+        Debug, ///< Per-connection and per-step details
+        Info,  ///< Per-node progress
+        Warn   ///< Recoverable problems (bad parameters, missing inputs)
+    };
+
+    /**
+     * @brief Logger for messages emitted while nodes execute.
+     *
+     * Producers format into a slot of a fixed-size lock-free ring buffer and return; a background
+     * sink thread forwards messages to the application logger. Producers never wait: when the
+     * buffer is full the message is dropped and counted, and the sink reports the loss.
+     *
+     * Use it through the LOG_HOT_* macros, which compile to nothing below VISION_CRAFT_HOT_LOG_LEVEL.
+     * Errors keep using LOG_ERROR so they are written synchronously.
+     */
+    class AsyncLogger
+    {
+    public:
+        /**
+         * @brief Receives messages on the sink thread.
+         */
+        using Sink = std::function<void(LogLevel level, std::string_view message)>;
+
+        /**
+         * @brief Returns the process-wide logger, starting its sink thread on first use.
+         * @return Logger instance
+         */
+        [[nodiscard]] static AsyncLogger &Get();
+
+        /**
+         * @brief Drains remaining messages and stops the sink thread.
+         */
+        ~AsyncLogger();
+
+        AsyncLogger(const AsyncLogger &) = delete;
+        AsyncLogger &operator=(const AsyncLogger &) = delete;
+
+        /**
+         * @brief Formats a message into the ring buffer without blocking.
+         * @param level Message severity
+         * @param format fmt format string
+         * @param args Format arguments
+         * @return False if the buffer was full and the message was dropped
+         */
+        template<typename... Args> bool Log(LogLevel level, fmt::format_string<Args...> format, Args &&...args)
+        {
+            Cell *cell = ClaimCell();
+            if (!cell)
+            {
+                return false;
+            }
+
+            const auto result =
+                fmt::format_to_n(cell->text.data(), cell->text.size(), format, std::forward<Args>(args)...);
+            cell->level = level;
+            cell->length = static_cast<uint16_t>(std::min(result.size, cell->text.size()));
+            PublishCell(*cell);
+            return true;
+        }
+
+        /**
+         * @brief Waits until every message logged before the call reached the sink.
+         */
+        void Flush();
+
+        /**
+         * @brief Replaces the message sink (tests capture messages with it).
+         * @param sink New sink, or nullptr to restore forwarding to the application logger
+         */
+        void SetSink(Sink sink);
+
+        /**
+         * @brief Returns the number of messages dropped because the buffer was full.
+         * @return Dropped message count since start
+         */
+        [[nodiscard]] uint64_t GetDroppedCount() const;
+
+    private:
+        static_assert((Constants::Logging::kAsyncQueueCapacity & (Constants::Logging::kAsyncQueueCapacity - 1)) == 0,
+            "Async log queue capacity must be a power of two");
+
+        /**
+         * @brief Ring buffer slot; its sequence number tells producers and the consumer who owns it.
+         */
+        struct Cell
+        {
+            std::atomic<size_t> sequence{ 0 };                            ///< Ownership ticket
+            LogLevel level = LogLevel::Info;                              ///< Message severity
+            uint16_t length = 0;                                          ///< Bytes used in text
+            std::array<char, Constants::Logging::kMaxMessageLength> text; ///< Formatted message (not terminated)
+        };
+
+        AsyncLogger();
+
+        /**
+         * @brief Reserves the next free slot for a producer.
+         * @return Slot to fill, or nullptr if the buffer is full
+         */
+        Cell *ClaimCell();
+
+        /**
+         * @brief Hands a filled slot to the sink thread.
+         * @param cell Slot returned by ClaimCell()
+         */
+        void PublishCell(Cell &cell);
+
+        /**
+         * @brief Sink thread loop.
+         * @param stopToken Requested by the destructor
+         */
+        void Drain(std::stop_token stopToken);
+
+        /**
+         * @brief Forwards one message to the current sink.
+         * @param level Message severity
+         * @param message Message text
+         */
+        void Emit(LogLevel level, std::string_view message);
+
+        std::unique_ptr<Cell[]> cells;                        ///< Ring buffer of kAsyncQueueCapacity slots
+        alignas(64) std::atomic<size_t> enqueuePosition{ 0 }; ///< Next slot producers claim
+        alignas(64) std::atomic<size_t> dequeuePosition{ 0 }; ///< Next slot the sink reads (sink thread writes)
+        std::atomic<bool> pending{ false };                   ///< Set by producers to wake the sink thread
+        std::atomic<uint64_t> droppedCount{ 0 };              ///< Messages lost to a full buffer
+        std::atomic<uint64_t> unreportedDrops{ 0 };           ///< Drops the sink has not reported yet
+        std::mutex sinkMutex;                                 ///< Guards sink
+        Sink sink;                                            ///< Custom sink (empty = application logger)
+        std::jthread sinkThread;                              ///< Drains the ring buffer
+    };
+
+} // namespace VisionCraft::Nodes
+
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_DEBUG
+#define LOG_HOT_DEBUG(...)                                                                                             \
+    static_cast<void>(::VisionCraft::Nodes::AsyncLogger::Get().Log(::VisionCraft::Nodes::LogLevel::Debug, __VA_ARGS__))
+#else
+#define LOG_HOT_DEBUG(...) static_cast<void>(0)
+#endif
+
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_INFO
+#define LOG_HOT_INFO(...)                                                                                              \
+    static_cast<void>(::VisionCraft::Nodes::AsyncLogger::Get().Log(::VisionCraft::Nodes::LogLevel::Info, __VA_ARGS__))
+#else
+#define LOG_HOT_INFO(...) static_cast<void>(0)
+#endif
+
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_WARN
+#define LOG_HOT_WARN(...)                                                                                              \
+    static_cast<void>(::VisionCraft::Nodes::AsyncLogger::Get().Log(::VisionCraft::Nodes::LogLevel::Warn, __VA_ARGS__))
+#else
+#define LOG_HOT_WARN(...) static_cast<void>(0)
+#endif
@@ -0,0 +1,169 @@
+#include "Nodes/Core/BitMask.h"
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        constexpr int kWordBits = 64;
+
+        // Eight 0/255 bytes for each value of eight mask bits, bit i becoming byte i
+        constexpr std::array<uint64_t, 256> kSpreadBits = [] {
+            std::array<uint64_t, 256> table{};
+            for (size_t bits = 0; bits < table.size(); ++bits)
+            {
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    if ((bits >> i) & 1u)
+                    {
+                        table[bits] |= uint64_t{ 0xFF } << (8 * i);
+                    }
+                }
+            }
+            return table;
+        }();
+
+        // Eight mask bytes to eight bits, byte i becoming bit i (little-endian load)
+        uint64_t GatherBits(const uint8_t *bytes)
+        {
+            constexpr uint64_t kLow7 = 0x7F7F7F7F7F7F7F7Full;
+            uint64_t value = 0;
+            std::memcpy(&value, bytes, sizeof(value));
+            // High bit of each byte set iff the byte is nonzero
+            const uint64_t nonzero = (((value & kLow7) + kLow7) | value) & ~kLow7;
+            return ((nonzero >> 7) * 0x0102040810204080ull) >> 56;
+        }
+
+        int WordsPerRow(int cols)
+        {
+            return (cols + kWordBits - 1) / kWordBits;
+        }
+    } // namespace
+
+    BitMask::BitMask(cv::Size size) : cols(size.width)
+    {
+        if (size.width > 0 && size.height > 0)
+        {
+            words = cv::Mat::zeros(size.height, WordsPerRow(size.width) * static_cast<int>(sizeof(uint64_t)), CV_8UC1);
+        }
+        else
+        {
+            cols = 0;
+        }
+    }
+
+    BitMask BitMask::FromWords(cv::Mat words, int cols)
+    {
+        if (words.empty())
+        {
+            return {};
+        }
+        if (words.type() != CV_8UC1 || cols <= 0
+            || words.cols != WordsPerRow(cols) * static_cast<int>(sizeof(uint64_t)))
+        {
+            throw std::invalid_argument("BitMask words must be CV_8UC1 rows of whole words covering the width");
+        }
+
+        BitMask mask;
+        mask.words = std::move(words);
+        mask.cols = cols;
+        const uint64_t tail = ~GetLastWordMask(cols);
+        const int last = mask.GetWordsPerRow() - 1;
+        for (int y = 0; y < mask.words.rows; ++y)
+        {
+            if (mask.GetRow(y)[last] & tail)
+            {
+                throw std::invalid_argument("BitMask words have bits set past the last column");
+            }
+        }
+        return mask;
+    }
+
+    BitMask BitMask::FromImage(const cv::Mat &image)
+    {
+        if (image.empty())
+        {
+            return {};
+        }
+        if (image.type() != CV_8UC1)
+        {
+            throw std::invalid_argument("Only single-channel 8-bit images can be packed into a BitMask");
+        }
+
+        BitMask mask(image.size());
+        const int fullWords = image.cols / kWordBits;
+        cv::parallel_for_(cv::Range(0, image.rows), [&](const cv::Range &range) {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                const uint8_t *source = image.ptr<uint8_t>(y);
+                uint64_t *row = mask.GetRow(y);
+                for (int w = 0; w < fullWords; ++w)
+                {
+                    uint64_t word = 0;
+                    for (int byte = 0; byte < 8; ++byte)
+                    {
+                        word |= GatherBits(source + w * kWordBits + byte * 8) << (byte * 8);
+                    }
+                    row[w] = word;
+                }
+                if (fullWords * kWordBits < image.cols)
+                {
+                    uint64_t word = 0;
+                    for (int x = fullWords * kWordBits; x < image.cols; ++x)
+                    {
+                        word |= uint64_t{ source[x] != 0 } << (x % kWordBits);
+                    }
+                    row[fullWords] = word;
+                }
+            }
+        });
+        return mask;
+    }
+
+    void BitMask::ToImage(cv::Mat &destination) const
+    {
+        if (words.empty())
+        {
+            destination.release();
+            return;
+        }
+
+        destination.create(words.rows, cols, CV_8UC1);
+        const int fullBytes = cols / 8;
+        cv::parallel_for_(cv::Range(0, words.rows), [&](const cv::Range &range) {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                const auto *bits = reinterpret_cast<const uint8_t *>(GetRow(y)); // Little-endian: byte i = bits 8i..
+                uint8_t *target = destination.ptr<uint8_t>(y);
+                for (int b = 0; b < fullBytes; ++b)
+                {
+                    std::memcpy(target + b * 8, &kSpreadBits[bits[b]], sizeof(uint64_t));
+                }
+                for (int x = fullBytes * 8; x < cols; ++x)
+                {
+                    target[x] = Get(x, y) ? 255 : 0;
+                }
+            }
+        });
+    }
+
+    cv::Mat BitMask::ToImage() const
+    {
+        cv::Mat image;
+        ToImage(image);
+        return image;
+    }
+
+    BitMask BitMask::Clone() const
+    {
+        BitMask copy;
+        copy.words = words.clone();
+        copy.cols = cols;
+        return copy;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Binary mask stored one bit per pixel, 64 pixels per word.
+     *
+     * A 0/255 CV_8UC1 mask spends eight bits on each pixel's one bit of information; chains that combine and
+     * erode masks are bound by moving those bytes. Bit x of a row is bit (x % 64) of word x / 64, and each row
+     * starts on a new word. Bits past the last column are always zero, so word-wise operations need no tail
+     * handling. The words live in a cv::Mat (one byte row of GetWordsPerRow() * 8 bytes per mask row) that
+     * copies share, like cv::Mat itself.
+     *
+     * Only nodes returning true from Node::AcceptsBitMasks() receive masks; NodeEditor unpacks them to 0/255
+     * CV_8UC1 for every other consumer. Vision::Kernels::BitMaskOps combines and erodes them word by word.
+     */
+    class BitMask
+    {
+    public:
+        BitMask() = default;
+
+        /**
+         * @brief Allocates a mask with every bit clear.
+         * @param size Mask size in pixels
+         */
+        explicit BitMask(cv::Size size);
+
+        /**
+         * @brief Wraps packed words without copying them.
+         * @param words CV_8UC1 image of mask rows by words-per-row * 8 bytes
+         * @param cols Mask width in pixels
+         * @return Mask over words
+         * @throws std::invalid_argument if words does not fit cols or has bits set past the last column
+         */
+        [[nodiscard]] static BitMask FromWords(cv::Mat words, int cols);
+
+        /**
+         * @brief Packs a byte mask; every nonzero pixel becomes a set bit.
+         * @param image CV_8UC1 image
+         * @return Packed mask
+         * @throws std::invalid_argument if image is not single-channel 8-bit
+         */
+        [[nodiscard]] static BitMask FromImage(const cv::Mat &image);
+
+        /**
+         * @brief Unpacks the mask to 0/255 bytes.
+         * @param destination Output CV_8UC1 image; its buffer is reused when size and type match
+         */
+        void ToImage(cv::Mat &destination) const;
+
+        /**
+         * @brief Unpacks the mask to a new 0/255 image.
+         * @return CV_8UC1 image
+         */
+        [[nodiscard]] cv::Mat ToImage() const;
+
+        /**
+         * @brief Returns deep copy with freshly allocated words.
+         * @return Copy that shares no buffer with this mask
+         */
+        [[nodiscard]] BitMask Clone() const;
+
+        /**
+         * @brief Returns whether the mask has no pixels.
+         * @return True if empty
+         */
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return words.empty();
+        }
+
+        /**
+         * @brief Returns mask size.
+         * @return Size in pixels
+         */
+        [[nodiscard]] cv::Size GetSize() const
+        {
+            return { cols, words.rows };
+        }
+
+        /**
+         * @brief Returns the number of 64-bit words in each row.
+         * @return (cols + 63) / 64
+         */
+        [[nodiscard]] int GetWordsPerRow() const
+        {
+            return words.cols / static_cast<int>(sizeof(uint64_t));
+        }
+
+        /**
+         * @brief Returns the bytes of packed words.
+         * @return Rows * words per row * 8
+         */
+        [[nodiscard]] size_t GetByteSize() const
+        {
+            return words.total();
+        }
+
+        /**
+         * @brief Returns one row of words.
+         * @param row Row index
+         * @return GetWordsPerRow() words
+         */
+        [[nodiscard]] const uint64_t *GetRow(int row) const
+        {
+            return reinterpret_cast<const uint64_t *>(words.ptr(row));
+        }
+
+        /**
+         * @brief Returns one row of words for writing; only for masks not yet shared.
+         * @param row Row index
+         * @return GetWordsPerRow() words (keep bits past the last column clear)
+         */
+        [[nodiscard]] uint64_t *GetRow(int row)
+        {
+            return reinterpret_cast<uint64_t *>(words.ptr(row));
+        }
+
+        /**
+         * @brief Returns one pixel.
+         * @param x Column
+         * @param y Row
+         * @return True if the bit is set
+         */
+        [[nodiscard]] bool Get(int x, int y) const
+        {
+            return ((GetRow(y)[x / 64] >> (x % 64)) & 1u) != 0;
+        }
+
+        /**
+         * @brief Returns the word storage.
+         * @return CV_8UC1 image of rows by GetWordsPerRow() * 8 bytes (shared)
+         */
+        [[nodiscard]] const cv::Mat &GetWords() const
+        {
+            return words;
+        }
+
+        /**
+         * @brief Returns the bits of a row's last word that lie inside the mask.
+         * @param cols Mask width in pixels
+         * @return Word with the valid low bits set (all bits if cols is a multiple of 64)
+         */
+        [[nodiscard]] static uint64_t GetLastWordMask(int cols)
+        {
+            const int used = cols % 64;
+            return used == 0 ? ~uint64_t{ 0 } : (uint64_t{ 1 } << used) - 1;
+        }
+
+    private:
+        cv::Mat words; ///< Packed rows (CV_8UC1, 8 * words per row bytes wide)
+        int cols = 0;  ///< Width in pixels
+    };
+
+} // namespace VisionCraft::Nodes
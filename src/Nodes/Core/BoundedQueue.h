@@ -0,0 +1,121 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Blocking multi-producer/multi-consumer FIFO with fixed capacity.
+     *
+     * Used between pipeline stages so a fast stage applies back-pressure instead of buffering
+     * unbounded amounts of image data. Closing the queue wakes every waiter: producers stop,
+     * consumers drain the remaining items and then receive std::nullopt.
+     *
+     * @tparam T Item type (moved in and out)
+     */
+    template<typename T> class BoundedQueue
+    {
+    public:
+        /**
+         * @brief Constructs queue.
+         * @param capacity Maximum queued items (at least 1)
+         */
+        explicit BoundedQueue(size_t capacity) : capacity(capacity > 0 ? capacity : 1)
+        {
+        }
+
+        /**
+         * @brief Appends item, waiting while the queue is full.
+         * @param item Item to enqueue
+         * @return False if the queue was closed (item is dropped)
+         */
+        bool Push(T item)
+        {
+            std::unique_lock lock(mutex);
+            notFull.wait(lock, [this]() { return closed || items.size() < capacity; });
+            if (closed)
+            {
+                return false;
+            }
+
+            items.push_back(std::move(item));
+            lock.unlock();
+            notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Appends item if there is room, without waiting.
+         * @param item Item to enqueue (moved from only on success)
+         * @return False if the queue was full or closed
+         */
+        bool TryPush(T &item)
+        {
+            std::unique_lock lock(mutex);
+            if (closed || items.size() >= capacity)
+            {
+                return false;
+            }
+
+            items.push_back(std::move(item));
+            lock.unlock();
+            notEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * @brief Removes oldest item, waiting while the queue is empty.
+         * @return Item, or std::nullopt once the queue is closed and drained
+         */
+        std::optional<T> Pop()
+        {
+            std::unique_lock lock(mutex);
+            notEmpty.wait(lock, [this]() { return closed || !items.empty(); });
+            if (items.empty())
+            {
+                return std::nullopt;
+            }
+
+            T item = std::move(items.front());
+            items.pop_front();
+            lock.unlock();
+            notFull.notify_one();
+            return item;
+        }
+
+        /**
+         * @brief Returns the number of queued items.
+         * @return Item count (may change as soon as it returns)
+         */
+        [[nodiscard]] size_t Size() const
+        {
+            std::scoped_lock lock(mutex);
+            return items.size();
+        }
+
+        /**
+         * @brief Rejects further pushes and wakes all waiting threads.
+         */
+        void Close()
+        {
+            {
+                std::scoped_lock lock(mutex);
+                closed = true;
+            }
+            notFull.notify_all();
+            notEmpty.notify_all();
+        }
+
+    private:
+        mutable std::mutex mutex;         ///< Guards items and closed
+        std::condition_variable notFull;  ///< Signalled when space frees up
+        std::condition_variable notEmpty; ///< Signalled when an item arrives
+        std::deque<T> items;              ///< Queued items, oldest first
+        size_t capacity;                  ///< Maximum queued items
+        bool closed = false;              ///< Whether Close() was called
+    };
+
+} // namespace VisionCraft::Nodes
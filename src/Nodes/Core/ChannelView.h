@@ -0,0 +1,67 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief One channel of an interleaved image, read in place.
+     *
+     * Shares the source image's buffer, so handing a channel to the next node costs no copy. Nodes that
+     * override Node::AcceptsChannelViews() read the strided channel directly; NodeEditor extracts a
+     * single-channel cv::Mat for every other consumer.
+     */
+    struct ChannelView
+    {
+        cv::Mat source;  ///< Interleaved image (shared, never written through the view)
+        int channel = 0; ///< Channel index within source
+
+        /**
+         * @brief Returns whether the view has no pixels.
+         * @return True if source is empty
+         */
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return source.empty();
+        }
+
+        /**
+         * @brief Returns image size.
+         * @return Size of source
+         */
+        [[nodiscard]] cv::Size GetSize() const
+        {
+            return source.size();
+        }
+
+        /**
+         * @brief Returns element depth.
+         * @return OpenCV depth of source (CV_8U, CV_32F, ...)
+         */
+        [[nodiscard]] int GetDepth() const
+        {
+            return source.depth();
+        }
+
+        /**
+         * @brief Copies the channel into a single-channel image.
+         * @param destination Output image; its buffer is reused when size and type match
+         */
+        void ExtractTo(cv::Mat &destination) const
+        {
+            cv::extractChannel(source, destination, channel);
+        }
+
+        /**
+         * @brief Returns the channel as a new single-channel image.
+         * @return Deinterleaved copy of the channel
+         */
+        [[nodiscard]] cv::Mat Extract() const
+        {
+            cv::Mat plane;
+            ExtractTo(plane);
+            return plane;
+        }
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,233 @@
+#include "Nodes/Core/ColorLut.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // 2^24 colors as a square image, so strips of rows can be converted in parallel
+        constexpr int kColorGridEdge = 4096;
+        constexpr int kBuildStripRows = 64;
+
+        // Every input color once, in table index order
+        cv::Mat MakeColorGrid(int inputType)
+        {
+            if (CV_MAT_CN(inputType) == 1)
+            {
+                cv::Mat levels(1, 256, CV_8UC1);
+                for (int level = 0; level < 256; ++level)
+                {
+                    levels.at<uint8_t>(0, level) = static_cast<uint8_t>(level);
+                }
+                return levels;
+            }
+
+            cv::Mat colors(kColorGridEdge, kColorGridEdge, CV_8UC3);
+            cv::parallel_for_(cv::Range(0, kColorGridEdge), [&colors](const cv::Range &rows) {
+                for (int y = rows.start; y < rows.end; ++y)
+                {
+                    auto *pixel = colors.ptr<uint8_t>(y);
+                    for (int x = 0; x < kColorGridEdge; ++x, pixel += 3)
+                    {
+                        const auto index = static_cast<uint32_t>(y) * kColorGridEdge + static_cast<uint32_t>(x);
+                        pixel[0] = static_cast<uint8_t>(index);
+                        pixel[1] = static_cast<uint8_t>(index >> 8);
+                        pixel[2] = static_cast<uint8_t>(index >> 16);
+                    }
+                }
+            });
+            return colors;
+        }
+
+        // Entry sizes of the common outputs get fixed-size copies the compiler can inline
+        template <int Channels, size_t Bytes>
+        void LookupRow(const uint8_t *source, uint8_t *destination, int width, const uint8_t *table)
+        {
+            for (int x = 0; x < width; ++x, source += Channels, destination += Bytes)
+            {
+                size_t index = source[0];
+                if constexpr (Channels == 3)
+                {
+                    index |= (static_cast<size_t>(source[1]) << 8) | (static_cast<size_t>(source[2]) << 16);
+                }
+                std::memcpy(destination, table + index * Bytes, Bytes);
+            }
+        }
+
+        template <int Channels>
+        void LookupRow(const uint8_t *source, uint8_t *destination, int width, const uint8_t *table, size_t bytes)
+        {
+            switch (bytes)
+            {
+            case 1:
+                LookupRow<Channels, 1>(source, destination, width, table);
+                return;
+            case 3:
+                LookupRow<Channels, 3>(source, destination, width, table);
+                return;
+            default:
+                for (int x = 0; x < width; ++x, source += Channels, destination += bytes)
+                {
+                    size_t index = source[0];
+                    if constexpr (Channels == 3)
+                    {
+                        index |= (static_cast<size_t>(source[1]) << 8) | (static_cast<size_t>(source[2]) << 16);
+                    }
+                    std::memcpy(destination, table + index * bytes, bytes);
+                }
+            }
+        }
+    } // namespace
+
+    ColorLut::ColorLut(int inputType, cv::Mat table) : inputType(inputType), table(std::move(table))
+    {
+    }
+
+    bool ColorLut::SupportsInput(int inputType)
+    {
+        return inputType == CV_8UC1 || inputType == CV_8UC3;
+    }
+
+    bool ColorLut::IsColorTransformRun(std::span<const TileOperation> operations)
+    {
+        return std::ranges::all_of(operations, [](const TileOperation &operation) {
+            return operation.apply && operation.halo == 0 && !operation.colorTransform.empty();
+        });
+    }
+
+    std::shared_ptr<const ColorLut> ColorLut::Build(int inputType, std::span<const TileOperation> operations)
+    {
+        if (!SupportsInput(inputType) || operations.empty() || !IsColorTransformRun(operations))
+        {
+            return nullptr;
+        }
+
+        const cv::Mat colors = MakeColorGrid(inputType);
+        cv::Mat table(colors.size(), operations.back().outputType);
+        std::atomic<bool> failed{ false };
+        const int strips = std::max(1, colors.rows / kBuildStripRows);
+        cv::parallel_for_(
+            cv::Range(0, colors.rows),
+            [&](const cv::Range &rows) {
+                try
+                {
+                    cv::Mat strip = colors.rowRange(rows.start, rows.end);
+                    for (const auto &operation : operations)
+                    {
+                        strip = operation.apply(strip);
+                        if (strip.rows != rows.size() || strip.cols != colors.cols
+                            || strip.type() != operation.outputType)
+                        {
+                            failed = true;
+                            return;
+                        }
+                    }
+                    strip.copyTo(table.rowRange(rows.start, rows.end));
+                }
+                catch (const std::exception &)
+                {
+                    failed = true;
+                }
+            },
+            strips);
+
+        if (failed)
+        {
+            return nullptr;
+        }
+        return std::shared_ptr<const ColorLut>(new ColorLut(inputType, std::move(table)));
+    }
+
+    std::string ColorLut::Describe(int inputType, std::span<const TileOperation> operations)
+    {
+        std::string description = std::to_string(inputType);
+        for (const auto &operation : operations)
+        {
+            description += '|';
+            description += operation.colorTransform;
+        }
+        return description;
+    }
+
+    cv::Mat ColorLut::Apply(const cv::Mat &image) const
+    {
+        CV_Assert(image.type() == inputType);
+
+        cv::Mat result(image.size(), table.type());
+        const auto *entries = table.ptr<uint8_t>();
+        const size_t bytes = table.elemSize();
+        for (int y = 0; y < image.rows; ++y)
+        {
+            const auto *source = image.ptr<uint8_t>(y);
+            auto *destination = result.ptr<uint8_t>(y);
+            if (CV_MAT_CN(inputType) == 3)
+            {
+                LookupRow<3>(source, destination, image.cols, entries, bytes);
+            }
+            else
+            {
+                LookupRow<1>(source, destination, image.cols, entries, bytes);
+            }
+        }
+        return result;
+    }
+
+    ColorLutCache::ColorLutCache(size_t capacity) : capacity(capacity)
+    {
+    }
+
+    std::shared_ptr<const ColorLut> ColorLutCache::Get(int inputType, std::span<const TileOperation> operations)
+    {
+        std::string key = ColorLut::Describe(inputType, operations);
+        {
+            std::scoped_lock lock(mutex);
+            const auto it = std::ranges::find(entries, key, &Entry::first);
+            if (it != entries.end())
+            {
+                entries.splice(entries.begin(), entries, it);
+                return it->second;
+            }
+        }
+
+        // Built without the lock, so chains of other runs are not held up by a 2^24-color table
+        auto table = ColorLut::Build(inputType, operations);
+        if (!table)
+        {
+            return nullptr;
+        }
+
+        std::scoped_lock lock(mutex);
+        ++builds;
+        if (capacity == 0)
+        {
+            return table;
+        }
+        if (const auto it = std::ranges::find(entries, key, &Entry::first); it != entries.end())
+        {
+            entries.erase(it);
+        }
+        entries.emplace_front(std::move(key), table);
+        while (entries.size() > capacity)
+        {
+            entries.pop_back();
+        }
+        return table;
+    }
+
+    size_t ColorLutCache::GetBuildCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return builds;
+    }
+
+    void ColorLutCache::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        entries.clear();
+    }
+} // namespace VisionCraft::Nodes
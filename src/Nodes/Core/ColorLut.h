@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Lookup table collapsing a run of per-pixel color transforms into one pass.
+     *
+     * The table is built by running the operations (see TileOperation::colorTransform) once over every
+     * possible input color: 256 gray levels, or all 2^24 BGR triples laid out as a 4096x4096 image. Applying
+     * it then reads each pixel's result with one lookup instead of running every conversion, so a chain such
+     * as BGR->HSV->BGR costs a single pass and produces exactly the pixels the operations would.
+     *
+     * Only 8-bit images with one or three channels are supported; the result may have any type. Tables are
+     * immutable once built and can be applied from any number of threads.
+     */
+    class ColorLut
+    {
+    public:
+        /**
+         * @brief Checks if a table can be indexed by images of a type.
+         * @param inputType cv::Mat type of the run's input
+         * @return True for CV_8UC1 and CV_8UC3
+         */
+        [[nodiscard]] static bool SupportsInput(int inputType);
+
+        /**
+         * @brief Checks if every operation of a run maps pixels by value alone.
+         * @param operations Operations in the order they run
+         * @return True if each names a color transform and reads no context
+         */
+        [[nodiscard]] static bool IsColorTransformRun(std::span<const TileOperation> operations);
+
+        /**
+         * @brief Builds the table of a run of color transforms.
+         * @param inputType cv::Mat type of the run's input (see SupportsInput())
+         * @param operations Run to collapse, each a color transform (see IsColorTransformRun())
+         * @return Table, or nullptr if the input type is unsupported or an operation failed or broke its
+         *         declared output type
+         * @note Runs the operations over the table's colors in parallel strips.
+         */
+        [[nodiscard]] static std::shared_ptr<const ColorLut> Build(int inputType,
+            std::span<const TileOperation> operations);
+
+        /**
+         * @brief Returns the name identifying a run, equal for runs with equal tables.
+         * @param inputType cv::Mat type of the run's input
+         * @param operations Run of color transforms
+         * @return Input type and every operation's colorTransform
+         */
+        [[nodiscard]] static std::string Describe(int inputType, std::span<const TileOperation> operations);
+
+        /**
+         * @brief Maps every pixel of an image through the table.
+         * @param image Image of the table's input type (may be a region of a larger image)
+         * @return New image of the table's output type
+         * @throws cv::Exception if the image type differs from the input type
+         */
+        [[nodiscard]] cv::Mat Apply(const cv::Mat &image) const;
+
+        /**
+         * @brief Returns the type of the images Apply() returns.
+         * @return Output type of the run's last operation
+         */
+        [[nodiscard]] int GetOutputType() const
+        {
+            return table.type();
+        }
+
+        /**
+         * @brief Returns the memory the table holds.
+         * @return Bytes of table entries
+         */
+        [[nodiscard]] size_t GetBytes() const
+        {
+            return table.total() * table.elemSize();
+        }
+
+    private:
+        /**
+         * @brief Wraps a built table.
+         * @param inputType Type the table is indexed by
+         * @param table One entry per input color, in index order
+         */
+        ColorLut(int inputType, cv::Mat table);
+
+        int inputType; ///< Type the table is indexed by
+        cv::Mat table; ///< Entry c0 | c1 << 8 | c2 << 16 holds the result of color (c0, c1, c2)
+    };
+
+    /**
+     * @brief Keeps the tables of recent color transform runs, so a table is rebuilt only when a run changes.
+     *
+     * Runs are looked up by ColorLut::Describe(), which changes with any parameter of any operation in the
+     * run. The least recently used tables are dropped beyond the capacity. All methods are thread-safe; two
+     * threads missing the same run at once may both build it.
+     */
+    class ColorLutCache
+    {
+    public:
+        /**
+         * @brief Constructs cache.
+         * @param capacity Maximum tables held at once
+         */
+        explicit ColorLutCache(size_t capacity);
+
+        ColorLutCache(const ColorLutCache &) = delete;
+        ColorLutCache &operator=(const ColorLutCache &) = delete;
+
+        /**
+         * @brief Returns the table of a run, building it on first request.
+         * @param inputType cv::Mat type of the run's input
+         * @param operations Run of color transforms
+         * @return Shared table, or nullptr if it cannot be built (see ColorLut::Build())
+         */
+        [[nodiscard]] std::shared_ptr<const ColorLut> Get(int inputType, std::span<const TileOperation> operations);
+
+        /**
+         * @brief Returns how many tables were built.
+         * @return Cache misses that built a table
+         */
+        [[nodiscard]] size_t GetBuildCount() const;
+
+        /**
+         * @brief Drops every table.
+         */
+        void Clear();
+
+    private:
+        using Entry = std::pair<std::string, std::shared_ptr<const ColorLut>>;
+
+        mutable std::mutex mutex; ///< Guards entries and builds
+        std::list<Entry> entries; ///< Tables by run, most recently used first
+        size_t capacity;          ///< Maximum entries
+        size_t builds = 0;        ///< Tables built
+    };
+} // namespace VisionCraft::Nodes
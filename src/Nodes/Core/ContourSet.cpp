@@ -0,0 +1,173 @@
+#include "Nodes/Core/ContourSet.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Header ints before the offsets: the contour count
+        constexpr size_t kHeaderInts = 1;
+    } // namespace
+
+    ContourSet ContourSet::FromContours(const std::vector<std::vector<cv::Point>> &contours, cv::Mat storage)
+    {
+        size_t pointCount = 0;
+        for (const auto &contour : contours)
+        {
+            pointCount += contour.size();
+        }
+
+        // One allocation for the whole set, however many contours it has
+        const size_t length = kHeaderInts + contours.size() + 1 + 2 * pointCount;
+        storage.create(1, static_cast<int>(length), CV_32SC1);
+        auto *ints = storage.ptr<int>(0);
+        ints[0] = static_cast<int>(contours.size());
+        int *offsets = ints + kHeaderInts;
+        auto *points = reinterpret_cast<cv::Point *>(offsets + contours.size() + 1);
+
+        size_t offset = 0;
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            offsets[i] = static_cast<int>(offset);
+            std::ranges::copy(contours[i], points + offset);
+            offset += contours[i].size();
+        }
+        offsets[contours.size()] = static_cast<int>(offset);
+        return FromStorage(std::move(storage));
+    }
+
+    ContourSet ContourSet::FromStorage(cv::Mat storage)
+    {
+        ContourSet set;
+        if (storage.empty())
+        {
+            return set;
+        }
+        if (storage.type() != CV_32SC1 || storage.rows != 1 || !storage.isContinuous())
+        {
+            throw std::invalid_argument("Contour storage must be a continuous CV_32SC1 row");
+        }
+
+        const auto length = storage.total();
+        const auto *ints = storage.ptr<int>(0);
+        if (ints[0] < 0 || kHeaderInts + static_cast<size_t>(ints[0]) + 1 > length)
+        {
+            throw std::invalid_argument("Contour storage is too short for its contour count");
+        }
+        const auto count = static_cast<size_t>(ints[0]);
+        const int *offsets = ints + kHeaderInts;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (offsets[i] < 0 || offsets[i] > offsets[i + 1])
+            {
+                throw std::invalid_argument("Contour offsets are not ascending");
+            }
+        }
+        if (offsets[0] != 0 || kHeaderInts + count + 1 + 2 * static_cast<size_t>(offsets[count]) != length)
+        {
+            throw std::invalid_argument("Contour storage does not match its point count");
+        }
+
+        set.offsets = offsets;
+        set.points = reinterpret_cast<const cv::Point *>(offsets + count + 1);
+        set.storedCount = count;
+        set.storage = std::move(storage);
+        return set;
+    }
+
+    ContourSet ContourSet::Select(std::span<const int> indices, cv::Mat selection) const
+    {
+        ContourSet set = *this;
+        set.selective = true;
+        set.selection = {};
+        if (indices.empty())
+        {
+            return set;
+        }
+
+        selection.create(1, static_cast<int>(indices.size()), CV_32SC1);
+        auto *stored = selection.ptr<int>(0);
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            if (indices[i] < 0 || static_cast<size_t>(indices[i]) >= GetCount())
+            {
+                throw std::out_of_range("Contour index " + std::to_string(indices[i]) + " is out of range");
+            }
+            stored[i] = static_cast<int>(ToStored(static_cast<size_t>(indices[i])));
+        }
+        set.selection = std::move(selection);
+        return set;
+    }
+
+    ContourSet ContourSet::Compact() const
+    {
+        if (!selective)
+        {
+            return *this;
+        }
+
+        const size_t count = GetCount();
+        const size_t pointCount = GetPointCount();
+        cv::Mat storage(1, static_cast<int>(kHeaderInts + count + 1 + 2 * pointCount), CV_32SC1);
+        auto *ints = storage.ptr<int>(0);
+        ints[0] = static_cast<int>(count);
+        int *offsets = ints + kHeaderInts;
+        auto *points = reinterpret_cast<cv::Point *>(offsets + count + 1);
+
+        size_t offset = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto contour = GetContour(i);
+            offsets[i] = static_cast<int>(offset);
+            std::ranges::copy(contour, points + offset);
+            offset += contour.size();
+        }
+        offsets[count] = static_cast<int>(offset);
+        return FromStorage(std::move(storage));
+    }
+
+    std::span<const cv::Point> ContourSet::GetContour(size_t index) const
+    {
+        const size_t stored = ToStored(index);
+        return { points + offsets[stored], static_cast<size_t>(offsets[stored + 1] - offsets[stored]) };
+    }
+
+    cv::Mat ContourSet::GetContourMat(size_t index) const
+    {
+        const auto contour = GetContour(index);
+        if (contour.empty())
+        {
+            return {};
+        }
+        // OpenCV shape functions only read their input, so the const buffer is never written through
+        return cv::Mat(static_cast<int>(contour.size()), 1, CV_32SC2, const_cast<cv::Point *>(contour.data()));
+    }
+
+    size_t ContourSet::GetPointCount() const
+    {
+        if (!selective)
+        {
+            return storedCount > 0 ? static_cast<size_t>(offsets[storedCount]) : 0;
+        }
+        size_t pointCount = 0;
+        for (size_t i = 0; i < GetCount(); ++i)
+        {
+            pointCount += GetContour(i).size();
+        }
+        return pointCount;
+    }
+
+    void ContourSet::ToContours(std::vector<std::vector<cv::Point>> &contours) const
+    {
+        contours.resize(GetCount());
+        for (size_t i = 0; i < contours.size(); ++i)
+        {
+            const auto contour = GetContour(i);
+            contours[i].assign(contour.begin(), contour.end());
+        }
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Contours of one image stored flat: every point in one buffer, indexed by per-contour offsets.
+     *
+     * cv::findContours returns a vector per contour, so a frame with ten thousand specks costs ten thousand
+     * heap blocks, each freed again when the frame is dropped. Here a set is a single CV_32SC1 row holding
+     * the contour count, count + 1 point offsets and then the x,y pairs, so it is one allocation; written
+     * into an image from Node::CreateOutputImage(), its buffer is recycled by the ImageBufferPool from frame
+     * to frame. Copies share the buffer, like cv::Mat itself, and it is never written after construction.
+     *
+     * Filtering never moves points: Select() returns a set over the same buffer that lists the indices of
+     * the contours it keeps. Compact() copies only the selected contours into a buffer of their own.
+     */
+    class ContourSet
+    {
+    public:
+        ContourSet() = default;
+
+        /**
+         * @brief Flattens contours into one buffer.
+         * @param contours Contours, e.g. from cv::findContours
+         * @param storage Image to write the buffer into (e.g. from Node::CreateOutputImage()); allocated
+         *                through its allocator, so pass an empty image that shares no buffer
+         * @return Set over storage
+         */
+        [[nodiscard]] static ContourSet FromContours(const std::vector<std::vector<cv::Point>> &contours,
+            cv::Mat storage = {});
+
+        /**
+         * @brief Wraps a buffer written by FromContours() without copying it.
+         * @param storage CV_32SC1 row as returned by GetStorage()
+         * @return Set over storage, every contour selected
+         * @throws std::invalid_argument if storage is not a consistent contour buffer
+         */
+        [[nodiscard]] static ContourSet FromStorage(cv::Mat storage);
+
+        /**
+         * @brief Returns a set over the same buffer keeping some of this set's contours.
+         * @param indices Positions in this set, in the order to keep them
+         * @param selection Image to write the index list into (e.g. from Node::CreateOutputImage())
+         * @return Set sharing this set's points
+         * @throws std::out_of_range if an index is not below GetCount()
+         */
+        [[nodiscard]] ContourSet Select(std::span<const int> indices, cv::Mat selection = {}) const;
+
+        /**
+         * @brief Copies the selected contours into a buffer of their own.
+         * @return Set without a selection (this set itself if it has none)
+         */
+        [[nodiscard]] ContourSet Compact() const;
+
+        /**
+         * @brief Returns the number of contours.
+         * @return Selected contours
+         */
+        [[nodiscard]] size_t GetCount() const
+        {
+            return selective ? selection.total() : storedCount;
+        }
+
+        /**
+         * @brief Returns whether the set has no contours.
+         * @return True if GetCount() is zero
+         */
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return GetCount() == 0;
+        }
+
+        /**
+         * @brief Returns one contour's points, straight from the buffer.
+         * @param index Position in this set
+         * @return Points, valid as long as the set (or a copy of it) lives
+         */
+        [[nodiscard]] std::span<const cv::Point> GetContour(size_t index) const;
+
+        /**
+         * @brief Returns one contour as a cv::Mat header over the buffer, for OpenCV shape functions.
+         * @param index Position in this set
+         * @return N x 1 CV_32SC2 image sharing the points (empty for a contour without points)
+         */
+        [[nodiscard]] cv::Mat GetContourMat(size_t index) const;
+
+        /**
+         * @brief Returns the total number of points of the selected contours.
+         * @return Point count
+         */
+        [[nodiscard]] size_t GetPointCount() const;
+
+        /**
+         * @brief Copies the contours into per-contour vectors, e.g. for APIs that need them.
+         * @param contours Receives the contours; its vectors are reused
+         */
+        void ToContours(std::vector<std::vector<cv::Point>> &contours) const;
+
+        /**
+         * @brief Returns the contour buffer.
+         * @return CV_32SC1 row: count, count + 1 offsets, x,y pairs (shared; empty for a default set)
+         */
+        [[nodiscard]] const cv::Mat &GetStorage() const
+        {
+            return storage;
+        }
+
+        /**
+         * @brief Returns the selected buffer positions.
+         * @return CV_32SC1 row of contour indices into the buffer (empty if every contour is, or none is)
+         */
+        [[nodiscard]] const cv::Mat &GetSelection() const
+        {
+            return selection;
+        }
+
+        /**
+         * @brief Returns the bytes of the buffer and the selection.
+         * @return Byte count
+         */
+        [[nodiscard]] size_t GetByteSize() const
+        {
+            return storage.total() * storage.elemSize() + selection.total() * selection.elemSize();
+        }
+
+    private:
+        /**
+         * @brief Maps a position in this set to a contour index in the buffer.
+         * @param index Position in this set
+         * @return Buffer contour index
+         */
+        [[nodiscard]] size_t ToStored(size_t index) const
+        {
+            return selective ? static_cast<size_t>(selection.at<int>(static_cast<int>(index))) : index;
+        }
+
+        cv::Mat storage;           ///< CV_32SC1 row: count, offsets, x,y pairs
+        cv::Mat selection;         ///< CV_32SC1 row of selected buffer indices (if selective)
+        const int *offsets{};      ///< count + 1 point offsets inside storage
+        const cv::Point *points{}; ///< First point inside storage
+        size_t storedCount = 0;    ///< Contours in the buffer
+        bool selective = false;    ///< Only the contours in selection belong to the set
+    };
+
+} // namespace VisionCraft::Nodes
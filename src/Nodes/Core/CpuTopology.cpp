@@ -0,0 +1,169 @@
+#include "Nodes/Core/CpuTopology.h"
+#include "Logger.h"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#elif defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        thread_local std::optional<size_t> currentNode; ///< Node the calling thread was bound to
+
+        // Parses one unsigned number; false unless the whole text is a number
+        bool ParseIndex(std::string_view text, size_t &value)
+        {
+            const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return error == std::errc{} && end == text.data() + text.size() && !text.empty();
+        }
+    } // namespace
+
+    CpuTopology::CpuTopology(std::vector<NumaNode> nodes) : nodes(std::move(nodes))
+    {
+        std::erase_if(this->nodes, [](const NumaNode &node) { return node.cores.empty(); });
+        if (this->nodes.empty())
+        {
+            NumaNode all;
+            all.cores.resize(std::max<size_t>(1, std::thread::hardware_concurrency()));
+            std::iota(all.cores.begin(), all.cores.end(), size_t{ 0 });
+            this->nodes.push_back(std::move(all));
+        }
+        std::ranges::sort(this->nodes, {}, &NumaNode::id);
+    }
+
+    const CpuTopology &CpuTopology::Get()
+    {
+        static const CpuTopology topology = Detect();
+        return topology;
+    }
+
+    CpuTopology CpuTopology::Detect()
+    {
+        std::vector<NumaNode> nodes;
+#if defined(__linux__)
+        std::error_code error;
+        for (const auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", error))
+        {
+            const auto name = entry.path().filename().string();
+            NumaNode node;
+            if (!name.starts_with("node") || !ParseIndex(std::string_view(name).substr(4), node.id))
+            {
+                continue;
+            }
+            std::ifstream file(entry.path() / "cpulist");
+            std::string list;
+            if (std::getline(file, list))
+            {
+                node.cores = ParseCpuList(list);
+                nodes.push_back(std::move(node));
+            }
+        }
+#endif
+        CpuTopology topology(std::move(nodes));
+        if (topology.GetNodeCount() > 1)
+        {
+            LOG_INFO("Detected {} NUMA nodes", topology.GetNodeCount());
+        }
+        return topology;
+    }
+
+    std::vector<size_t> CpuTopology::ParseCpuList(std::string_view list)
+    {
+        while (!list.empty() && (list.back() == '\n' || list.back() == ' '))
+        {
+            list.remove_suffix(1);
+        }
+
+        std::vector<size_t> cores;
+        while (!list.empty())
+        {
+            const auto comma = list.find(',');
+            const auto range = list.substr(0, comma);
+            list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+            const auto dash = range.find('-');
+            size_t first = 0;
+            size_t last = 0;
+            if (!ParseIndex(range.substr(0, dash), first) ||
+                !ParseIndex(dash == std::string_view::npos ? range : range.substr(dash + 1), last) || last < first)
+            {
+                return {};
+            }
+            for (size_t core = first; core <= last; ++core)
+            {
+                cores.push_back(core);
+            }
+        }
+        std::ranges::sort(cores);
+        cores.erase(std::ranges::unique(cores).begin(), cores.end());
+        return cores;
+    }
+
+    const std::vector<CpuTopology::NumaNode> &CpuTopology::GetNodes() const
+    {
+        return nodes;
+    }
+
+    size_t CpuTopology::GetNodeCount() const
+    {
+        return nodes.size();
+    }
+
+    bool CpuTopology::BindCurrentThread(size_t node) const
+    {
+        currentNode = node;
+        return PinCurrentThread(nodes.at(node).cores);
+    }
+
+    std::optional<size_t> CpuTopology::GetCurrentNode()
+    {
+        return currentNode;
+    }
+
+    bool CpuTopology::PinCurrentThread(std::span<const size_t> cores)
+    {
+#if defined(__linux__)
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for (const auto core : cores)
+        {
+            if (core < CPU_SETSIZE)
+            {
+                CPU_SET(core, &cpus);
+            }
+        }
+        return !cores.empty() && pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#elif defined(_WIN32)
+        DWORD_PTR mask = 0;
+        for (const auto core : cores)
+        {
+            mask |= core < 64 ? DWORD_PTR{ 1 } << core : 0;
+        }
+        return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+        (void)cores;
+        return false;
+#endif
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief NUMA layout of the machine: which CPU cores share which memory node.
+     *
+     * On multi-socket servers a thread reading memory attached to the other socket gets a fraction of the
+     * bandwidth, which halves throughput of bandwidth-bound nodes such as CvtColor or Threshold. ThreadPool
+     * and ExecutorService use the topology to bind threads to nodes, and bound threads record their node so
+     * ImageBufferPool can hand them buffers first touched on the same node.
+     *
+     * Detected from /sys/devices/system/node on Linux; elsewhere, or where that is unavailable, the machine
+     * is one node holding every core, and NUMA placement degrades to no placement.
+     */
+    class CpuTopology
+    {
+    public:
+        /**
+         * @brief One memory node and the cores attached to it.
+         */
+        struct NumaNode
+        {
+            size_t id = 0;             ///< Node number as reported by the OS
+            std::vector<size_t> cores; ///< Logical CPU indices, ascending
+        };
+
+        /**
+         * @brief Builds a topology from known nodes (used by tests and Detect()).
+         * @param nodes Nodes with at least one core each; empty selects one node with every core
+         */
+        explicit CpuTopology(std::vector<NumaNode> nodes);
+
+        /**
+         * @brief Returns the machine's topology, detected on first call.
+         * @return Process-wide topology
+         */
+        [[nodiscard]] static const CpuTopology &Get();
+
+        /**
+         * @brief Reads the topology from the OS.
+         * @return Detected topology (one node if detection is unsupported)
+         */
+        [[nodiscard]] static CpuTopology Detect();
+
+        /**
+         * @brief Parses a Linux CPU list such as "0-3,8-11".
+         * @param list CPU list
+         * @return Listed cores, ascending; empty if the list is malformed
+         */
+        [[nodiscard]] static std::vector<size_t> ParseCpuList(std::string_view list);
+
+        /**
+         * @brief Returns the memory nodes.
+         * @return Nodes ordered by id, never empty
+         */
+        [[nodiscard]] const std::vector<NumaNode> &GetNodes() const;
+
+        /**
+         * @brief Returns the number of memory nodes.
+         * @return Node count, at least 1
+         */
+        [[nodiscard]] size_t GetNodeCount() const;
+
+        /**
+         * @brief Binds the calling thread to every core of one node and records the node for it.
+         * @param node Index into GetNodes()
+         * @return True if the OS accepted the affinity (the node is recorded either way)
+         */
+        bool BindCurrentThread(size_t node) const;
+
+        /**
+         * @brief Returns the node the calling thread was bound to.
+         * @return Index into GetNodes(), or std::nullopt for unbound threads
+         */
+        [[nodiscard]] static std::optional<size_t> GetCurrentNode();
+
+        /**
+         * @brief Restricts the calling thread to a set of cores.
+         * @param cores Logical CPU indices
+         * @return False where affinity is unsupported or refused
+         */
+        static bool PinCurrentThread(std::span<const size_t> cores);
+
+    private:
+        std::vector<NumaNode> nodes; ///< Memory nodes, never empty
+    };
+
+} // namespace VisionCraft::Nodes
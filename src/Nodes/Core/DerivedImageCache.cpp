@@ -0,0 +1,109 @@
+#include "Nodes/Core/DerivedImageCache.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    DerivedImageCache::DerivedImageCache(size_t capacity) : capacity(capacity)
+    {
+    }
+
+    cv::Mat DerivedImageCache::Get(const cv::Mat &source, DerivedImage kind)
+    {
+        if (capacity == 0 || source.empty() || (kind == DerivedImage::Gray && source.channels() == 1) ||
+            (kind == DerivedImage::Float && source.depth() == CV_32F))
+        {
+            return Compute(source, kind);
+        }
+
+        std::promise<cv::Mat> promise;
+        std::shared_future<cv::Mat> image;
+        bool computes = false;
+        {
+            std::scoped_lock lock(mutex);
+            const auto entry = std::ranges::find_if(
+                entries, [&](const Entry &candidate) { return Matches(candidate, source, kind); });
+            if (entry != entries.end())
+            {
+                ++hits;
+                image = entry->image;
+            }
+            else
+            {
+                ++misses;
+                computes = true;
+                image = promise.get_future().share();
+                if (entries.size() >= capacity)
+                {
+                    entries.erase(entries.begin());
+                }
+                entries.push_back(Entry{ .source = source, .kind = kind, .image = image });
+            }
+        }
+
+        if (computes)
+        {
+            try
+            {
+                promise.set_value(Compute(source, kind));
+            }
+            catch (...)
+            {
+                promise.set_exception(std::current_exception());
+                std::scoped_lock lock(mutex);
+                std::erase_if(entries, [&](const Entry &entry) { return Matches(entry, source, kind); });
+            }
+        }
+        return image.get();
+    }
+
+    cv::Mat DerivedImageCache::Compute(const cv::Mat &source, DerivedImage kind)
+    {
+        cv::Mat image;
+        switch (kind)
+        {
+        case DerivedImage::Gray:
+            if (source.channels() == 1)
+            {
+                return source;
+            }
+            cv::cvtColor(source, image, cv::COLOR_BGR2GRAY);
+            break;
+        case DerivedImage::Float:
+            if (source.depth() == CV_32F)
+            {
+                return source;
+            }
+            source.convertTo(image, CV_32F);
+            break;
+        case DerivedImage::Integral:
+            cv::integral(source, image);
+            break;
+        }
+        return image;
+    }
+
+    void DerivedImageCache::Clear()
+    {
+        std::vector<Entry> released;
+        {
+            std::scoped_lock lock(mutex);
+            released.swap(entries);
+        }
+    }
+
+    DerivedImageCache::Statistics DerivedImageCache::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return Statistics{ .hits = hits, .misses = misses, .entries = entries.size() };
+    }
+
+    bool DerivedImageCache::Matches(const Entry &entry, const cv::Mat &source, DerivedImage kind)
+    {
+        return entry.kind == kind && entry.source.data == source.data && entry.source.size() == source.size() &&
+               entry.source.type() == source.type() && entry.source.step1() == source.step1();
+    }
+
+} // namespace VisionCraft::Nodes
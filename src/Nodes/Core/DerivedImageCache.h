@@ -0,0 +1,104 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Representations nodes derive from an input image before processing it.
+     */
+    enum class DerivedImage
+    {
+        Gray,    ///< Single-channel luma (cv::COLOR_BGR2GRAY); single-channel images are their own
+        Float,   ///< Same channels converted to CV_32F without scaling; CV_32F images are their own
+        Integral ///< cv::integral() sums (one row and column larger than the image)
+    };
+
+    /**
+     * @brief Shares derived images among the nodes of one run.
+     *
+     * Entries are keyed by the source image's buffer, so every node reading the same output - each branch
+     * of a fan-out - gets the gray, float or integral image computed by the first one to ask. An entry holds
+     * its source, which keeps the buffer from being reused for another image while the key is live.
+     * NodeEditor clears the cache after every run and stream segment; within one, the oldest entries are
+     * dropped beyond the capacity.
+     *
+     * All methods are thread-safe. A node asking for an image another thread is computing waits for it
+     * instead of computing it again.
+     */
+    class DerivedImageCache
+    {
+    public:
+        /**
+         * @brief Cache counters.
+         */
+        struct Statistics
+        {
+            size_t hits = 0;    ///< Requests served by an earlier computation
+            size_t misses = 0;  ///< Requests that computed the image
+            size_t entries = 0; ///< Images currently held
+        };
+
+        /**
+         * @brief Constructs cache.
+         * @param capacity Maximum entries held at once (0 disables sharing)
+         */
+        explicit DerivedImageCache(size_t capacity);
+
+        DerivedImageCache(const DerivedImageCache &) = delete;
+        DerivedImageCache &operator=(const DerivedImageCache &) = delete;
+
+        /**
+         * @brief Returns a derived image, computing it on first request.
+         * @param source Image the representation is derived from (must not be written while cached)
+         * @param kind Representation to return
+         * @return Derived image shared with other callers (read-only), or source if it already is one
+         * @throws cv::Exception if the representation cannot be computed (e.g. gray from two channels)
+         */
+        [[nodiscard]] cv::Mat Get(const cv::Mat &source, DerivedImage kind);
+
+        /**
+         * @brief Computes a derived image without caching it.
+         * @param source Image the representation is derived from
+         * @param kind Representation to compute
+         * @return Derived image, or source if it already is one
+         */
+        [[nodiscard]] static cv::Mat Compute(const cv::Mat &source, DerivedImage kind);
+
+        /**
+         * @brief Drops every entry, releasing the images it held.
+         */
+        void Clear();
+
+        /**
+         * @brief Returns cache counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        /**
+         * @brief Derived image of one source buffer.
+         */
+        struct Entry
+        {
+            cv::Mat source;                   ///< Keeps the keyed buffer alive
+            DerivedImage kind;                ///< Representation
+            std::shared_future<cv::Mat> image; ///< Ready once the first requester has computed it
+        };
+
+        [[nodiscard]] static bool Matches(const Entry &entry, const cv::Mat &source, DerivedImage kind);
+
+        mutable std::mutex mutex;   ///< Guards entries and counters
+        std::vector<Entry> entries; ///< Oldest first
+        size_t capacity;            ///< Maximum entries
+        size_t hits = 0;            ///< Requests served from entries
+        size_t misses = 0;          ///< Requests that computed the image
+    };
+
+} // namespace VisionCraft::Nodes
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 /**
  * @file EngineConstants.h
@@ -19,8 +20,470 @@ namespace VisionCraft::Constants
     {
         /// @brief Buffer size for file path input widgets
         constexpr size_t kFilePathBufferSize = 512;
+
+        /// @brief Memory kept in idle pooled image buffers for reuse by later runs (256 MB)
+        constexpr size_t kDefaultIdleImageBytes = 256ull * 1024 * 1024;
+
+        /// @brief First chunk a NodeArena reserves; later chunks grow geometrically (64 KB)
+        constexpr size_t kNodeArenaInitialChunk = 64 * 1024;
+
+        /// @brief Idle NodeData handle blocks kept for reuse; blocks returned beyond it go back to the heap
+        constexpr size_t kMaxIdleNodeDataBlocks = 4096;
+
+        /// @brief Alignment of images placed in a memory plan's slab (a cache line, as cv::fastMalloc aligns)
+        constexpr size_t kSlabAlignment = 64;
     } // namespace Buffers
 
+    /**
+     * @brief Node output cache constants.
+     */
+    namespace Cache
+    {
+        /// @brief Default memory budget for cached node outputs (512 MB)
+        constexpr size_t kDefaultOutputCacheBytes = 512ull * 1024 * 1024;
+
+        /// @brief Compressed tier budget of each editor's output cache (128 MB)
+        constexpr size_t kDefaultCompressedCacheBytes = 128ull * 1024 * 1024;
+
+        /// @brief Evicted entries must shrink at least this many times to be kept in the compressed tier
+        constexpr size_t kMinCompressionRatio = 2;
+
+        /// @brief Default disk budget for persisted node outputs (4 GB)
+        constexpr size_t kDefaultPersistentCacheBytes = 4ull * 1024 * 1024 * 1024;
+
+        /// @brief Default memory budget for decoded image files shared by image input nodes (1 GB)
+        constexpr size_t kDefaultDecodedImageBytes = 1024ull * 1024 * 1024;
+
+        /// @brief Threads decoding prefetched image files (disk and decoder bound, so a few suffice)
+        constexpr size_t kPrefetchThreads = 2;
+
+        /// @brief Derived images (gray, float, integral) a run's nodes share before the oldest are dropped
+        constexpr size_t kDerivedImageEntries = 16;
+    } // namespace Cache
+
+    /**
+     * @brief Batch processing pipeline constants.
+     */
+    namespace Batch
+    {
+        /// @brief Images buffered between pipeline stages (bounds memory use)
+        constexpr size_t kDefaultQueueCapacity = 8;
+
+        /// @brief Threads decoding input files
+        constexpr size_t kDefaultDecodeWorkers = 2;
+
+        /// @brief Threads encoding output files
+        constexpr size_t kDefaultEncodeWorkers = 2;
+
+        /// @brief Files a process claims from a checkpoint manifest at once
+        constexpr size_t kManifestChunkFiles = 32;
+
+        /// @brief Manifest silence after which another process takes over a process's unfinished files
+        constexpr int kManifestLeaseMilliseconds = 30'000;
+
+        /// @brief Period of the liveness record a process appends to a manifest while it works
+        constexpr int kManifestHeartbeatMilliseconds = 5'000;
+
+        /// @brief Period at which a process with nothing to claim checks the manifest again
+        constexpr int kManifestPollMilliseconds = 500;
+    } // namespace Batch
+
+    /**
+     * @brief Distributed batch (render farm) constants.
+     */
+    namespace Farm
+    {
+        /// @brief Files per shard a worker claims at once (a few minutes of work, so retries stay cheap)
+        constexpr size_t kDefaultShardFiles = 64;
+
+        /// @brief Tries per shard before its remaining files count as failed
+        constexpr size_t kDefaultMaxAttempts = 3;
+
+        /// @brief Heartbeat silence after which the coordinator hands a worker's shards to others
+        constexpr int kDefaultLeaseMilliseconds = 60'000;
+
+        /// @brief Period of a worker's heartbeat and progress report
+        constexpr int kHeartbeatMilliseconds = 2'000;
+
+        /// @brief Period at which the coordinator scans the job and idle workers look for shards
+        constexpr int kPollMilliseconds = 1'000;
+    } // namespace Farm
+
+    /**
+     * @brief Shared-memory frame transport constants (Vision::IO::SharedFrameRing and its nodes).
+     */
+    namespace SharedMemory
+    {
+        /// @brief Frames a ring holds (the stream pipeline depth plus frames nodes still hold, plus one being written)
+        constexpr size_t kDefaultSlots = 6;
+
+        /// @brief Longest single wait on a ring, so waiters notice a closed ring and stopped runs
+        constexpr int kWaitSliceMilliseconds = 50;
+
+        /// @brief Interval between slot state checks where no cross-process futex is available
+        constexpr int kPollMicroseconds = 200;
+
+        /// @brief Time a shared-memory input node waits for its writer to create the ring
+        constexpr int kAttachTimeoutMilliseconds = 5'000;
+    } // namespace SharedMemory
+
+    /**
+     * @brief Graph server constants (CLI --serve).
+     */
+    namespace Server
+    {
+        /// @brief Port the server listens on when none is given
+        constexpr uint16_t kDefaultPort = 8080;
+
+        /// @brief Loaded copies of the graph, i.e. requests executed at once
+        constexpr size_t kDefaultInstances = 2;
+
+        /// @brief Connections served at once; more are answered 503 and closed
+        constexpr size_t kMaxConnections = 64;
+
+        /// @brief Largest request header block in bytes
+        constexpr size_t kMaxHeaderBytes = 64 * 1024;
+
+        /// @brief Largest request body in bytes (an encoded image of a few hundred megapixels)
+        constexpr size_t kMaxBodyBytes = 256ull * 1024 * 1024;
+
+        /// @brief Silence after which an idle keep-alive connection is closed
+        constexpr int kIdleTimeoutMilliseconds = 30'000;
+
+        /// @brief Longest single wait of the accept and receive loops, so they notice a shutdown
+        constexpr int kPollMilliseconds = 200;
+    } // namespace Server
+
+    /**
+     * @brief Service metrics constants (Nodes::RuntimeMetrics, CLI --metrics-file).
+     */
+    namespace Metrics
+    {
+        /// @brief Upper bounds in seconds of the per-node Process() time histogram buckets (+Inf is implied)
+        constexpr double kLatencyBucketsSeconds[] = { 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25,
+            0.5, 1.0, 2.5, 5.0, 10.0 };
+
+        /// @brief Seconds the throughput gauge averages over (the current, partial second included)
+        constexpr size_t kThroughputWindowSeconds = 10;
+
+        /// @brief Seconds between rewrites of the metrics file when none is given
+        constexpr int kDefaultFileIntervalSeconds = 15;
+    } // namespace Metrics
+
+    /**
+     * @brief Memory budget and spill-to-disk constants (Nodes::MemoryBudget, CLI --memory-budget).
+     */
+    namespace Spill
+    {
+        /// @brief Prefix of the per-process spill directory created under the scratch directory
+        constexpr const char *kDirectoryPrefix = "visioncraft-spill-";
+
+        /// @brief Disk budget of spilled intermediates; spills are deleted as they are read back, so this only
+        /// bounds a run whose live intermediates all sit on disk at once (64 GB)
+        constexpr size_t kScratchBytes = 64ull * 1024 * 1024 * 1024;
+    } // namespace Spill
+
+    /**
+     * @brief Write-behind output constants.
+     */
+    namespace Output
+    {
+        /// @brief Threads running queued writes (image encoding is CPU bound, so a couple overlap well)
+        constexpr size_t kWriteBehindThreads = 2;
+
+        /// @brief Writes queued before submitters wait (each holds an image, so this bounds memory)
+        constexpr size_t kWriteBehindCapacity = 8;
+
+        /// @brief ImageOutputNode ThumbnailSize default: longest thumbnail edge in pixels
+        constexpr int kDefaultThumbnailEdge = 256;
+    } // namespace Output
+
+    /**
+     * @brief Image codec constants.
+     */
+    namespace Codec
+    {
+        /// @brief Smallest JPEG decoded with nvJPEG; below about a megapixel the host-device copies cost more
+        /// than the GPU saves over TurboJPEG
+        constexpr size_t kMinGpuJpegPixels = 1024 * 1024;
+    } // namespace Codec
+
+    /**
+     * @brief Streaming execution constants.
+     */
+    namespace Stream
+    {
+        /// @brief Frames allowed in flight at once when stream steps are pipelined
+        constexpr size_t kPipelineDepth = 3;
+
+        /// @brief Frames run per graph lock hold; the pipeline drains and the lock is released in between
+        constexpr size_t kFramesPerSegment = 8;
+    } // namespace Stream
+
+    /**
+     * @brief Tiled execution constants.
+     */
+    namespace Tiling
+    {
+        /// @brief Output tile edge in pixels (a 512x512 BGR tile and its intermediates stay cache-resident)
+        constexpr int kDefaultTileSize = 512;
+
+        /// @brief Images with fewer pixels run whole; below this, splitting costs more than it saves
+        constexpr size_t kDefaultMinImagePixels = 4096ull * 4096;
+
+        /// @brief Approximate input bytes per row strip of a fused pointwise chain (fits in L2 with its outputs)
+        constexpr size_t kFusedStripBytes = 256 * 1024;
+
+        /// @brief Smallest 3-channel image whose color transform run is collapsed into a 2^24-entry lookup table
+        constexpr size_t kMinColorLutPixels = 1024 * 1024;
+
+        /// @brief Color lookup tables kept for later runs (a 3-channel table holds up to 48 MiB)
+        constexpr size_t kColorLutCacheEntries = 2;
+
+        /// @brief Input slot tileable nodes read their image from
+        constexpr const char *kInputSlot = "Input";
+
+        /// @brief Output slot tileable nodes write their result to
+        constexpr const char *kOutputSlot = "Output";
+
+        /// @brief Decoded TIFF tiles TiledImageInputNode keeps resident (a few hundred 512x512 BGR tiles)
+        constexpr size_t kDefaultTileCacheBytes = 256ull * 1024 * 1024;
+
+        /// @brief Largest TIFF level TiledImageInputNode loads whole; larger levels are read by region
+        constexpr size_t kMaxWholeImagePixels = 16384ull * 16384;
+    } // namespace Tiling
+
+    /**
+     * @brief Proxy-resolution execution constants.
+     */
+    namespace Proxy
+    {
+        /// @brief Scale the editor offers for proxy runs (a 50 MP scan becomes about 3 MP)
+        constexpr double kDefaultScale = 0.25;
+
+        /// @brief Smallest accepted proxy scale; lower values are clamped
+        constexpr double kMinScale = 0.05;
+
+        /// @brief Width of the editor's proxy scale slider
+        constexpr float kScaleSliderWidth = 80.0f;
+    } // namespace Proxy
+
+    /**
+     * @brief Precision policy constants.
+     */
+    namespace Precision
+    {
+        /// @brief Width of the editor's precision policy combo
+        constexpr float kComboWidth = 80.0f;
+    } // namespace Precision
+
+    /**
+     * @brief Core budget constants.
+     */
+    namespace Cores
+    {
+        /// @brief Width of the editor's max cores field
+        constexpr float kFieldWidth = 90.0f;
+    } // namespace Cores
+
+    /**
+     * @brief Editor auto-run constants.
+     */
+    namespace AutoRun
+    {
+        /// @brief Quiet time after the last edit before an automatic run starts, in milliseconds
+        constexpr int kDebounceMilliseconds = 250;
+    } // namespace AutoRun
+
+    /**
+     * @brief Parallel step scheduling constants.
+     */
+    namespace Scheduling
+    {
+        /// @brief Weight of the latest Process() time in a node's moving-average cost (0..1)
+        constexpr double kCostSmoothing = 0.3;
+
+        /// @brief Cost assumed for a node that has not been timed yet, in microseconds
+        constexpr double kUnknownCostMicroseconds = 1000.0;
+    } // namespace Scheduling
+
+    /**
+     * @brief Cooperative cancellation constants.
+     */
+    namespace Cancellation
+    {
+        /// @brief Pixels per row strip that long-running nodes process between stop checks
+        constexpr size_t kStripPixels = 1024ull * 1024;
+    } // namespace Cancellation
+
+    /**
+     * @brief Median filter constants.
+     */
+    namespace Median
+    {
+        /// @brief Smallest 8-bit kernel filtered with column histograms; cv::medianBlur is faster below it
+        constexpr int kHistogramMinKernel = 15;
+
+        /// @brief Largest kernel cv::medianBlur accepts for 16-bit and float images
+        constexpr int kMaxOpenCvWideKernel = 5;
+
+        /// @brief Fewest rows per parallel strip; strips are at least two kernels tall
+        constexpr int kMinStripRows = 32;
+    } // namespace Median
+
+    /**
+     * @brief Morphology constants.
+     */
+    namespace Morphology
+    {
+        /// @brief Smallest element filtered with van Herk/Gil-Werman; cv::morphologyEx is faster below it
+        constexpr int kLargeKernel = 15;
+    } // namespace Morphology
+
+    /**
+     * @brief Threshold constants.
+     */
+    namespace Threshold
+    {
+        /// @brief Most output levels of THRESH_MULTI (multi-level Otsu cost grows with the square of levels)
+        constexpr int kMaxLevels = 16;
+    } // namespace Threshold
+
+    /**
+     * @brief Execution profiling constants.
+     */
+    namespace Profiling
+    {
+        /// @brief Execute() runs kept in NodeEditor's statistics history
+        constexpr size_t kRunHistoryCapacity = 32;
+    } // namespace Profiling
+
+    /**
+     * @brief Run recording and regression replay constants.
+     */
+    namespace Replay
+    {
+        /// @brief Runs timed when recording or replaying; per-node medians of these are compared
+        constexpr size_t kDefaultRuns = 5;
+
+        /// @brief Fraction a node may be slower than its recorded time before replay reports it
+        constexpr double kDefaultSlowdownThreshold = 0.2;
+
+        /// @brief Slowdowns below this many microseconds are timer noise, whatever their ratio
+        constexpr int64_t kMinimumSlowdownMicroseconds = 200;
+    } // namespace Replay
+
+    /**
+     * @brief Execution autotuning constants (Vision::IO::Autotuner).
+     */
+    namespace Autotune
+    {
+        /// @brief Timed runs per candidate setting; candidates are compared by their median
+        constexpr size_t kDefaultRuns = 3;
+
+        /// @brief Fraction a candidate must beat the best setting so far by to replace it (timer noise margin)
+        constexpr double kMinimumGain = 0.03;
+
+        /// @brief Tile edges swept, in pixels
+        constexpr int kTileSizes[] = { 256, 512, 1024, 2048 };
+
+        /// @brief Profile file name inside the per-user configuration directory
+        constexpr const char *kProfileFile = "tuning.json";
+
+        /// @brief Application directory inside the platform's configuration directory
+        constexpr const char *kConfigDirectory = "visioncraft";
+    } // namespace Autotune
+
+    /**
+     * @brief Synthetic graph generator constants.
+     */
+    namespace Generator
+    {
+        /// @brief Connections one generated node feeds at most, unless the options say otherwise
+        constexpr size_t kDefaultMaxFanOut = 4;
+
+        /// @brief Share of edges made execution edges where both ends have execution pins
+        constexpr double kDefaultExecutionEdgeRatio = 0.25;
+
+        /// @brief Canvas distance between generated layers
+        constexpr float kLayerSpacing = 250.0f;
+
+        /// @brief Canvas distance between generated nodes of one layer
+        constexpr float kRowSpacing = 150.0f;
+    } // namespace Generator
+
+    /**
+     * @brief Chrome trace recording constants.
+     */
+    namespace Tracing
+    {
+        /// @brief Events kept per thread before new ones are dropped (bounds memory of long captures)
+        constexpr size_t kMaxEventsPerThread = 1'000'000;
+
+        /// @brief File the editor writes when trace recording is switched off (relative to the working directory)
+        constexpr const char *kDefaultTraceFile = "vision_craft_trace.json";
+    } // namespace Tracing
+
+    /**
+     * @brief Asynchronous hot-path logging constants.
+     */
+    namespace Logging
+    {
+        /// @brief Messages the ring buffer holds before new ones are dropped (power of two)
+        constexpr size_t kAsyncQueueCapacity = 8192;
+
+        /// @brief Longest formatted message in bytes; longer ones are truncated
+        constexpr size_t kMaxMessageLength = 256;
+    } // namespace Logging
+
+    /**
+     * @brief Graph file constants.
+     */
+    namespace Persistence
+    {
+        /// @brief Extension that makes NodeEditor::SaveToFile() write the binary graph format
+        constexpr const char *kBinaryGraphExtension = ".vcgb";
+
+        /// @brief Inserted before the extension of the file NodeEditor::SaveToFileAsync() writes and renames
+        constexpr const char *kPartialFileMarker = ".partial";
+
+        /// @brief Largest node ID accepted when loading a graph
+        constexpr int kMaxNodeId = 1000000;
+
+        /// @brief Longest node name accepted when loading a graph
+        constexpr size_t kMaxNameLength = 256;
+
+        /// @brief Longest slot name accepted when loading a graph
+        constexpr size_t kMaxSlotNameLength = 128;
+
+        /// @brief Largest absolute node coordinate accepted when loading a graph
+        constexpr float kMaxCoordinate = 1000000.0f;
+    } // namespace Persistence
+
+    /**
+     * @brief Node plugin pack constants.
+     */
+    namespace Plugins
+    {
+        /// @brief Extension of plugin manifest files (JSON)
+        constexpr const char *kManifestExtension = ".vcplugin";
+
+        /// @brief Plugin directory searched below the working directory
+        constexpr const char *kDirectoryName = "plugins";
+
+        /// @brief Environment variable listing more plugin directories (separated like PATH)
+        constexpr const char *kPathVariable = "VISION_CRAFT_PLUGIN_PATH";
+    } // namespace Plugins
+
+    /**
+     * @brief Application startup constants (Nodes::StartupProfile).
+     */
+    namespace Startup
+    {
+        /// @brief Time from launch to the first presented frame above which startup logs a warning
+        constexpr int kReadyBudgetMs = 1000;
+    } // namespace Startup
+
     /**
      * @brief ImageInputNode-specific constants.
      */
@@ -54,6 +517,9 @@ namespace VisionCraft::Constants
 
             /// @brief Center alignment factor (0.5 = 50%)
             constexpr float kCenterAlignFactor = 0.5f;
+
+            /// @brief Downscale of the first-paint decode shown while the full-resolution decode runs
+            constexpr int kFirstPaintReduction = 4;
         } // namespace Preview
 
         /**
@@ -69,4 +535,34 @@ namespace VisionCraft::Constants
         } // namespace StatusColors
     }     // namespace ImageInputNode
 
+    /**
+     * @brief Preview texture constants (Vision::IO::StreamingTexture and PreviewTexture).
+     */
+    namespace PreviewTexture
+    {
+        /// @brief Pixel buffer objects uploads rotate through, so a new upload rarely waits for the previous one
+        constexpr size_t kUploadBuffers = 3;
+
+        /// @brief Longest wait in nanoseconds for an upload buffer the driver still reads
+        constexpr uint64_t kFenceTimeoutNs = 100'000'000;
+
+        /// @brief Longest edge of in-canvas preview thumbnails (a node's preview is about 300 pixels wide at 100%)
+        constexpr int kThumbnailEdge = 512;
+
+        /// @brief Video memory preview textures may hold before the least recently drawn off-screen ones are freed
+        constexpr size_t kVideoMemoryBudget = 256ull * 1024 * 1024;
+    } // namespace PreviewTexture
+
+    namespace Gallery
+    {
+        /// @brief Longest edge of results gallery thumbnails in pixels
+        constexpr int kThumbnailEdge = 96;
+
+        /// @brief Thumbnail textures kept; the least recently drawn is freed beyond this
+        constexpr size_t kMaxTextures = 256;
+
+        /// @brief Thumbnail requests waiting for the decode thread before the oldest are dropped
+        constexpr size_t kMaxPendingThumbnails = 64;
+    } // namespace Gallery
+
 } // namespace VisionCraft::Constants
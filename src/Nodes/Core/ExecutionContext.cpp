@@ -0,0 +1,109 @@
+#include "Nodes/Core/ExecutionContext.h"
+#include "Nodes/Core/Node.h"
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        thread_local ExecutionContext *currentContext = nullptr;
+    } // namespace
+
+    ExecutionContext::Scope::Scope(ExecutionContext &context, const StopCondition &stop) : previous(currentContext)
+    {
+        context.stopCondition = stop;
+        currentContext = &context;
+    }
+
+    ExecutionContext::Scope::~Scope()
+    {
+        currentContext = previous;
+    }
+
+    ExecutionContext *ExecutionContext::Current()
+    {
+        return currentContext;
+    }
+
+    void ExecutionContext::SetInputDefault(const Node &node, const std::string &slotName, NodeData value)
+    {
+        SetDefault(node.GetInputSlot(slotName), std::make_shared<const NodeData>(std::move(value)));
+    }
+
+    void ExecutionContext::SupplyOutput(const Node &node, const std::string &slotName, NodeData value)
+    {
+        SetData(node.GetOutputSlot(slotName),
+            value.index() == 0 ? nullptr : std::make_shared<const NodeData>(std::move(value)));
+        suppliedNodes.insert(&node);
+    }
+
+    bool ExecutionContext::IsSupplied(const Node &node) const
+    {
+        return suppliedNodes.contains(&node);
+    }
+
+    std::shared_ptr<const NodeData> ExecutionContext::GetOutputData(const Node &node,
+        const std::string &slotName) const
+    {
+        return GetData(node.GetOutputSlot(slotName));
+    }
+
+    std::shared_ptr<const NodeData> ExecutionContext::GetInputData(const Node &node,
+        const std::string &slotName) const
+    {
+        const Slot &slot = node.GetInputSlot(slotName);
+        if (auto handle = GetData(slot))
+        {
+            return handle;
+        }
+
+        bool found = false;
+        auto value = FindDefault(slot, found);
+        return found ? value : slot.GetSharedDefaultValue();
+    }
+
+    void ExecutionContext::Reset()
+    {
+        data.clear();
+        defaults.clear();
+        suppliedNodes.clear();
+        error.clear();
+        timedOut = false;
+    }
+
+    void ExecutionContext::SetFailure(std::string message, bool stoppedAtDeadline)
+    {
+        error = std::move(message);
+        timedOut = stoppedAtDeadline;
+    }
+
+    std::shared_ptr<const NodeData> ExecutionContext::GetData(const Slot &slot) const
+    {
+        const auto entry = data.find(&slot);
+        return entry != data.end() ? entry->second : nullptr;
+    }
+
+    void ExecutionContext::SetData(const Slot &slot, std::shared_ptr<const NodeData> value)
+    {
+        if (value)
+        {
+            data.insert_or_assign(&slot, std::move(value));
+        }
+        else
+        {
+            data.erase(&slot);
+        }
+    }
+
+    std::shared_ptr<const NodeData> ExecutionContext::FindDefault(const Slot &slot, bool &found) const
+    {
+        const auto entry = defaults.find(&slot);
+        found = entry != defaults.end();
+        return found ? entry->second : nullptr;
+    }
+
+    void ExecutionContext::SetDefault(const Slot &slot, std::shared_ptr<const NodeData> value)
+    {
+        defaults.insert_or_assign(&slot, std::move(value));
+    }
+
+} // namespace VisionCraft::Nodes
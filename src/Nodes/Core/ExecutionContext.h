@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Nodes/Core/NodeData.h"
+#include "Nodes/Core/StopCondition.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace VisionCraft::Nodes
+{
+    class Node;
+    class Slot;
+
+    /**
+     * @brief Slot values of one run, kept apart from the graph that defines them.
+     *
+     * The nodes, connections, slot defaults and compiled plan of a NodeEditor describe the graph; slot data
+     * is what one execution computes from it. While a context is bound to a thread, every Slot accessed on
+     * that thread reads and writes the context's entries instead of its own: outputs land here, inputs are
+     * pulled from here, and unset slots read empty. Defaults fall back to the graph's unless the context
+     * overrides them, and defaults a node writes during the run stay in the context too.
+     *
+     * NodeEditor::ExecuteInContext() binds a context for the duration of one run, so any number of threads
+     * can push their own image through one loaded graph at the same time, each with its own context, while
+     * the graph itself stays untouched. A context is used by one run at a time; reuse it with Reset().
+     *
+     * @note Nodes must touch their slots on the thread running Process(); helper threads they start see the
+     *       graph's slots, not the context's.
+     */
+    class ExecutionContext
+    {
+    public:
+        /**
+         * @brief Binds a context to the calling thread until destroyed.
+         */
+        class Scope
+        {
+        public:
+            /**
+             * @brief Binds context and the condition that stops its run.
+             * @param context Context slots read and write from now on
+             * @param stop Stop condition nodes poll through Node::ThrowIfStopRequested()
+             */
+            Scope(ExecutionContext &context, const StopCondition &stop);
+
+            /**
+             * @brief Restores whatever was bound before.
+             */
+            ~Scope();
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            ExecutionContext *previous; ///< Context bound when this scope began (nullptr = none)
+        };
+
+        ExecutionContext() = default;
+
+        ExecutionContext(const ExecutionContext &) = delete;
+        ExecutionContext &operator=(const ExecutionContext &) = delete;
+
+        /**
+         * @brief Returns the context bound to the calling thread.
+         * @return Context, or nullptr when slots use their own state
+         */
+        [[nodiscard]] static ExecutionContext *Current();
+
+        /**
+         * @brief Overrides an input default for runs in this context.
+         * @param node Node of the slot
+         * @param slotName Input slot name
+         * @param value Default the node reads when the slot is not connected
+         * @throws std::out_of_range if node has no such input
+         */
+        void SetInputDefault(const Node &node, const std::string &slotName, NodeData value);
+
+        /**
+         * @brief Supplies a node's output, so the run uses it instead of executing the node.
+         * @param node Node whose Process() is skipped in this context (typically a source)
+         * @param slotName Output slot name
+         * @param value Value downstream nodes receive
+         * @throws std::out_of_range if node has no such output
+         */
+        void SupplyOutput(const Node &node, const std::string &slotName, NodeData value);
+
+        /**
+         * @brief Checks whether a node's outputs are supplied by the caller.
+         * @param node Node to check
+         * @return True if SupplyOutput() was called for node
+         */
+        [[nodiscard]] bool IsSupplied(const Node &node) const;
+
+        /**
+         * @brief Returns an output value the run computed or was supplied.
+         * @param node Node of the slot
+         * @param slotName Output slot name
+         * @return Shared handle, or nullptr if the slot is empty in this context
+         * @throws std::out_of_range if node has no such output
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetOutputData(const Node &node,
+            const std::string &slotName) const;
+
+        /**
+         * @brief Returns an input value as the node read it in this context.
+         * @param node Node of the slot
+         * @param slotName Input slot name
+         * @return Pulled data, else the effective default, else nullptr
+         * @throws std::out_of_range if node has no such input
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetInputData(const Node &node,
+            const std::string &slotName) const;
+
+        /**
+         * @brief Drops slot data, overrides, supplied outputs and the last error, so the context can run again.
+         */
+        void Reset();
+
+        /**
+         * @brief Records why the run failed.
+         * @param message Error description
+         * @param timedOut True if the run stopped at its deadline
+         */
+        void SetFailure(std::string message, bool timedOut);
+
+        /**
+         * @brief Returns why the last run failed.
+         * @return Error description (empty if the run succeeded)
+         */
+        [[nodiscard]] const std::string &GetError() const
+        {
+            return error;
+        }
+
+        /**
+         * @brief Checks whether the last run stopped at its deadline.
+         * @return True if timed out
+         */
+        [[nodiscard]] bool IsTimedOut() const
+        {
+            return timedOut;
+        }
+
+        /**
+         * @brief Returns the stop condition of the bound run.
+         * @return Condition given to Scope
+         */
+        [[nodiscard]] const StopCondition &GetStopCondition() const
+        {
+            return stopCondition;
+        }
+
+        /**
+         * @brief Returns a slot's data in this context.
+         * @param slot Graph slot
+         * @return Shared handle, or nullptr if the slot is empty here
+         * @note Called by Slot; nodes go through their slots as usual.
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetData(const Slot &slot) const;
+
+        /**
+         * @brief Replaces a slot's data in this context.
+         * @param slot Graph slot
+         * @param data Handle to share (nullptr clears the slot)
+         */
+        void SetData(const Slot &slot, std::shared_ptr<const NodeData> data);
+
+        /**
+         * @brief Looks up a default override.
+         * @param slot Graph slot
+         * @param found Set to true if the context overrides the slot's default
+         * @return Override handle (meaningful only when found)
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> FindDefault(const Slot &slot, bool &found) const;
+
+        /**
+         * @brief Overrides a slot's default in this context.
+         * @param slot Graph slot
+         * @param value Default handle
+         */
+        void SetDefault(const Slot &slot, std::shared_ptr<const NodeData> value);
+
+    private:
+        std::unordered_map<const Slot *, std::shared_ptr<const NodeData>> data;     ///< Slot data of this run
+        std::unordered_map<const Slot *, std::shared_ptr<const NodeData>> defaults; ///< Default overrides
+        std::unordered_set<const Node *> suppliedNodes;                              ///< Nodes not executed
+        StopCondition stopCondition;                                                 ///< Bound run's condition
+        std::string error;                                                           ///< Last run's failure
+        bool timedOut = false;                                                       ///< Last run hit deadline
+    };
+
+} // namespace VisionCraft::Nodes
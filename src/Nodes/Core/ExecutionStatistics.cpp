@@ -0,0 +1,228 @@
+#include "Nodes/Core/ExecutionStatistics.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    ExecutionStatisticsHistory::ExecutionStatisticsHistory(size_t capacity) : capacity(std::max<size_t>(1, capacity))
+    {
+    }
+
+    uint64_t ExecutionStatisticsHistory::Record(RunStatistics run)
+    {
+        std::scoped_lock lock(mutex);
+        run.runNumber = ++runCount;
+        if (runs.size() < capacity)
+        {
+            runs.push_back(std::move(run));
+            return runCount;
+        }
+
+        // Full: the new run takes the oldest one's place, whose buffers are kept for Recycle()
+        std::swap(runs[oldest], run);
+        oldest = (oldest + 1) % runs.size();
+        spareNodes = std::move(run.nodes);
+        spareVersion = run.graphVersion;
+        return runCount;
+    }
+
+    RunStatistics ExecutionStatisticsHistory::Recycle(size_t steps, uint64_t graphVersion)
+    {
+        RunStatistics run;
+        bool sameGraph = false;
+        {
+            std::scoped_lock lock(mutex);
+            run.nodes = std::move(spareNodes);
+            sameGraph = spareVersion == graphVersion;
+        }
+
+        // Clearing keeps the strings' capacity; a type is only kept for a node of an unchanged graph
+        run.nodes.resize(steps);
+        for (auto &record : run.nodes)
+        {
+            if (!sameGraph)
+            {
+                record.nodeId = 0;
+                record.nodeType.clear();
+            }
+            record.outcome = StepOutcome::NotRun;
+            record.duration = std::chrono::microseconds::zero();
+            record.dataPassOperations = 0;
+            record.inputBytes = 0;
+            record.outputBytes = 0;
+        }
+        return run;
+    }
+
+    std::optional<RunStatistics> ExecutionStatisticsHistory::GetLatest() const
+    {
+        std::scoped_lock lock(mutex);
+        if (runs.empty())
+        {
+            return std::nullopt;
+        }
+        return At(runs.size() - 1);
+    }
+
+    std::vector<RunStatistics> ExecutionStatisticsHistory::GetRuns() const
+    {
+        std::scoped_lock lock(mutex);
+        std::vector<RunStatistics> ordered;
+        ordered.reserve(runs.size());
+        for (size_t age = 0; age < runs.size(); ++age)
+        {
+            ordered.push_back(At(age));
+        }
+        return ordered;
+    }
+
+    std::vector<NodeTimingSummary> ExecutionStatisticsHistory::SummarizeNodes() const
+    {
+        std::scoped_lock lock(mutex);
+
+        std::vector<NodeTimingSummary> summaries;
+        std::unordered_map<NodeId, size_t> summaryIndices;
+        std::vector<std::chrono::microseconds> totals;
+        std::vector<std::vector<std::chrono::microseconds>> durations; // Processed times, for the median
+        for (size_t age = 0; age < runs.size(); ++age)
+        {
+            for (const auto &record : At(age).nodes)
+            {
+                auto [it, inserted] = summaryIndices.try_emplace(record.nodeId, summaries.size());
+                if (inserted)
+                {
+                    summaries.emplace_back().nodeId = record.nodeId;
+                    totals.emplace_back(0);
+                    durations.emplace_back();
+                }
+
+                // Later runs overwrite, so name and last values come from the newest run
+                auto &summary = summaries[it->second];
+                summary.nodeName = record.nodeName;
+                summary.nodeType = record.nodeType;
+                summary.lastOutcome = record.outcome;
+                summary.lastTime = record.duration;
+                summary.lastInputBytes = record.inputBytes;
+                summary.lastOutputBytes = record.outputBytes;
+                summary.maxOutputBytes = std::max(summary.maxOutputBytes, record.outputBytes);
+                if (record.outcome == StepOutcome::Processed)
+                {
+                    ++summary.samples;
+                    totals[it->second] += record.duration;
+                    durations[it->second].push_back(record.duration);
+                    summary.maxTime = std::max(summary.maxTime, record.duration);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < summaries.size(); ++i)
+        {
+            if (summaries[i].samples > 0)
+            {
+                summaries[i].averageTime = totals[i] / static_cast<int64_t>(summaries[i].samples);
+
+                // Even counts average the two middle samples
+                auto &times = durations[i];
+                const auto middle = times.begin() + static_cast<std::ptrdiff_t>(times.size() / 2);
+                std::ranges::nth_element(times, middle);
+                summaries[i].medianTime = *middle;
+                if (times.size() % 2 == 0)
+                {
+                    const auto lower = *std::max_element(times.begin(), middle);
+                    summaries[i].medianTime = (lower + *middle) / 2;
+                }
+            }
+        }
+        return summaries;
+    }
+
+    uint64_t ExecutionStatisticsHistory::GetRunCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return runCount;
+    }
+
+    void ExecutionStatisticsHistory::SetCapacity(size_t newCapacity)
+    {
+        std::scoped_lock lock(mutex);
+        capacity = std::max<size_t>(1, newCapacity);
+        std::ranges::rotate(runs, runs.begin() + static_cast<std::ptrdiff_t>(oldest));
+        oldest = 0;
+        if (runs.size() > capacity)
+        {
+            runs.erase(runs.begin(), runs.end() - static_cast<std::ptrdiff_t>(capacity));
+        }
+    }
+
+    size_t ExecutionStatisticsHistory::GetCapacity() const
+    {
+        std::scoped_lock lock(mutex);
+        return capacity;
+    }
+
+    void ExecutionStatisticsHistory::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        runs.clear();
+        oldest = 0;
+        spareNodes.clear();
+        runCount = 0;
+    }
+
+    const RunStatistics &ExecutionStatisticsHistory::At(size_t age) const
+    {
+        return runs[(oldest + age) % runs.size()];
+    }
+
+    void NodeCostModel::Record(NodeId nodeId, std::chrono::microseconds duration)
+    {
+        const auto sample = static_cast<double>(duration.count());
+        std::scoped_lock lock(mutex);
+        const auto [entry, inserted] = estimates.try_emplace(nodeId, sample);
+        if (!inserted)
+        {
+            entry->second += Constants::Scheduling::kCostSmoothing * (sample - entry->second);
+        }
+    }
+
+    std::optional<double> NodeCostModel::GetEstimate(NodeId nodeId) const
+    {
+        std::scoped_lock lock(mutex);
+        const auto entry = estimates.find(nodeId);
+        return entry != estimates.end() ? std::optional(entry->second) : std::nullopt;
+    }
+
+    void NodeCostModel::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        estimates.clear();
+    }
+
+    const char *ToString(StepOutcome outcome)
+    {
+        switch (outcome)
+        {
+        case StepOutcome::Processed:
+            return "Processed";
+        case StepOutcome::CacheHit:
+            return "Cache hit";
+        case StepOutcome::Aliased:
+            return "Aliased";
+        case StepOutcome::Skipped:
+            return "Skipped";
+        case StepOutcome::Bypassed:
+            return "Bypassed";
+        case StepOutcome::Failed:
+            return "Failed";
+        case StepOutcome::Cancelled:
+            return "Cancelled";
+        case StepOutcome::NotRun:
+            return "Not run";
+        }
+        return "Unknown";
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief What happened to a plan step during a run.
+     */
+    enum class StepOutcome
+    {
+        Processed, ///< Process() ran
+        CacheHit,  ///< Outputs restored from the output cache
+        Aliased,   ///< Outputs shared with an identical node (NodeEditor::SetDuplicateElimination())
+        Skipped,   ///< Clean node skipped by incremental execution
+        Bypassed,  ///< On an execution path no branch took (see Node::BranchesExecution())
+        Failed,    ///< Process() threw
+        Cancelled, ///< Stopped early by cancellation or the run's deadline
+        NotRun     ///< Not reached (cancelled or stopped by a failure)
+    };
+
+    /**
+     * @brief Timing of one node within a run.
+     */
+    struct NodeExecutionRecord
+    {
+        NodeId nodeId = 0;                         ///< Node the step ran
+        std::string nodeName;                      ///< Node name at the time of the run
+        std::string nodeType;                      ///< Node::GetType()
+        StepOutcome outcome = StepOutcome::NotRun; ///< Result of the step
+        std::chrono::microseconds duration{ 0 };   ///< Time spent in Process() (zero unless processed)
+        size_t dataPassOperations = 0;             ///< Inputs shared from upstream nodes
+        size_t inputBytes = 0;                     ///< Bytes held in input slots when the step finished
+        size_t outputBytes = 0;                    ///< Bytes held in output slots when the step finished
+    };
+
+    /**
+     * @brief Statistics of one Execute() run.
+     */
+    struct RunStatistics
+    {
+        uint64_t runNumber = 0;                   ///< Sequence number, starting at 1
+        uint64_t graphVersion = 0;                ///< Graph version the run executed
+        bool parallel = false;                    ///< Ran in ExecutionMode::Parallel
+        bool succeeded = false;                   ///< Execute() returned true
+        bool timedOut = false;                    ///< Stopped by NodeEditor::SetExecutionTimeout()
+        std::optional<NodeId> targetNode;         ///< Node a NodeEditor::ExecuteUpTo() run was pruned to
+        double proxyScale = 1.0;                  ///< Resolution the run processed at (NodeEditor::SetProxyScale())
+        std::chrono::microseconds totalTime{ 0 }; ///< Wall-clock time of the whole run
+        size_t nodesExecuted = 0;                 ///< Steps that called Process()
+        size_t cacheHits = 0;                     ///< Steps restored from the output cache
+        size_t nodesAliased = 0;                  ///< Steps that shared an identical step's outputs
+        size_t nodesSkipped = 0;                  ///< Clean steps skipped
+        size_t nodesBypassed = 0;                 ///< Steps on execution paths no branch took
+        size_t dataPassOperations = 0;            ///< Inputs shared across all steps
+        size_t peakSlotBytes = 0;                 ///< High-water mark of bytes held in all slots of the graph
+        NodeId peakNodeId = 0;                    ///< Step whose completion reached the peak (0 if none)
+        size_t retainedSlotBytes = 0;             ///< Bytes still held in slots after the run
+        size_t spilledOutputs = 0;                ///< Intermediates spilled to disk to stay under the MemoryBudget
+        std::vector<NodeExecutionRecord> nodes;   ///< Per-node records in plan order
+        std::shared_future<void> writesFlushed;   ///< Ready once writes queued by the run (WriteBehindQueue) are done
+    };
+
+    /**
+     * @brief Per-node timings aggregated over the retained runs.
+     */
+    struct NodeTimingSummary
+    {
+        NodeId nodeId = 0;                             ///< Node ID
+        std::string nodeName;                          ///< Name from the latest run containing the node
+        std::string nodeType;                          ///< Node::GetType()
+        StepOutcome lastOutcome = StepOutcome::NotRun; ///< Outcome in the latest run containing the node
+        std::chrono::microseconds lastTime{ 0 };       ///< Process() time in that run
+        std::chrono::microseconds averageTime{ 0 };    ///< Mean over runs in which Process() ran
+        std::chrono::microseconds medianTime{ 0 };     ///< Median over runs in which Process() ran
+        std::chrono::microseconds maxTime{ 0 };        ///< Slowest Process() call
+        size_t samples = 0;                            ///< Runs in which Process() ran
+        size_t lastInputBytes = 0;                     ///< Input slot bytes in the latest run containing the node
+        size_t lastOutputBytes = 0;                    ///< Output slot bytes in that run
+        size_t maxOutputBytes = 0;                     ///< Largest output slot bytes over retained runs
+    };
+
+    /**
+     * @brief Rolling history of run statistics.
+     *
+     * Keeps the most recent runs up to a fixed capacity. Execution threads record runs while the
+     * UI reads them, so all methods are thread-safe and return copies.
+     *
+     * Runs are kept in a ring, and once it is full the buffers of the run each Record() drops are handed
+     * back by Recycle(), so a steady stream of runs over the same graph allocates nothing here.
+     */
+    class ExecutionStatisticsHistory
+    {
+    public:
+        /**
+         * @brief Constructs history.
+         * @param capacity Runs retained (at least 1)
+         */
+        explicit ExecutionStatisticsHistory(size_t capacity);
+
+        /**
+         * @brief Appends a run, dropping the oldest one when full.
+         * @param run Statistics to store (runNumber is assigned here)
+         * @return Assigned run number
+         */
+        uint64_t Record(RunStatistics run);
+
+        /**
+         * @brief Returns a run to fill for the next Record(), reusing the buffers of the last run dropped.
+         * @param steps Records the run needs
+         * @param graphVersion Graph version the run executes
+         * @return Run with steps records. If the dropped run executed the same graph version, its record IDs,
+         *         names and types are left for the caller to compare against; every other field is reset.
+         */
+        [[nodiscard]] RunStatistics Recycle(size_t steps, uint64_t graphVersion);
+
+        /**
+         * @brief Returns the most recent run.
+         * @return Latest statistics, or std::nullopt if nothing was recorded
+         */
+        [[nodiscard]] std::optional<RunStatistics> GetLatest() const;
+
+        /**
+         * @brief Returns retained runs.
+         * @return Runs, oldest first
+         */
+        [[nodiscard]] std::vector<RunStatistics> GetRuns() const;
+
+        /**
+         * @brief Aggregates per-node timings over retained runs.
+         * @return One summary per node, in order of first appearance
+         */
+        [[nodiscard]] std::vector<NodeTimingSummary> SummarizeNodes() const;
+
+        /**
+         * @brief Returns the number of runs recorded since construction or Clear().
+         * @return Run count (also the latest run number); changes whenever a run is recorded
+         */
+        [[nodiscard]] uint64_t GetRunCount() const;
+
+        /**
+         * @brief Changes retained run count, dropping the oldest runs if needed.
+         * @param capacity Runs retained (at least 1)
+         */
+        void SetCapacity(size_t capacity);
+
+        /**
+         * @brief Returns retained run count.
+         * @return Capacity
+         */
+        [[nodiscard]] size_t GetCapacity() const;
+
+        /**
+         * @brief Removes all runs and restarts numbering.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Returns a retained run by age.
+         * @param age 0 for the oldest run
+         * @return Run (mutex must be held)
+         */
+        [[nodiscard]] const RunStatistics &At(size_t age) const;
+
+        mutable std::mutex mutex;                    ///< Guards all members below
+        std::vector<RunStatistics> runs;             ///< Retained runs, a ring starting at oldest
+        size_t oldest = 0;                           ///< Index of the oldest run
+        std::vector<NodeExecutionRecord> spareNodes; ///< Records of the run last dropped, for Recycle()
+        uint64_t spareVersion = 0;                   ///< Graph version that run executed
+        size_t capacity;                             ///< Maximum retained runs
+        uint64_t runCount = 0;                       ///< Runs recorded so far
+    };
+
+    /**
+     * @brief Moving-average Process() time of each node, which the parallel scheduler ranks steps by.
+     *
+     * Each processed run moves a node's estimate toward its latest time by Constants::Scheduling::kCostSmoothing,
+     * so one slow outlier does not dominate and a node that became slower is noticed within a few runs.
+     * All methods are thread-safe.
+     */
+    class NodeCostModel
+    {
+    public:
+        /**
+         * @brief Folds one Process() time into a node's estimate.
+         * @param nodeId Node that ran
+         * @param duration Time spent in Process()
+         */
+        void Record(NodeId nodeId, std::chrono::microseconds duration);
+
+        /**
+         * @brief Returns a node's estimated Process() time.
+         * @param nodeId Node to look up
+         * @return Estimate in microseconds, or std::nullopt if the node was never timed
+         */
+        [[nodiscard]] std::optional<double> GetEstimate(NodeId nodeId) const;
+
+        /**
+         * @brief Forgets every estimate.
+         */
+        void Clear();
+
+    private:
+        mutable std::mutex mutex;                     ///< Guards estimates
+        std::unordered_map<NodeId, double> estimates; ///< Smoothed microseconds per node
+    };
+
+    /**
+     * @brief Returns display name of a step outcome.
+     * @param outcome Outcome to describe
+     * @return Short label (e.g. "Cache hit")
+     */
+    [[nodiscard]] const char *ToString(StepOutcome outcome);
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,147 @@
+#include "Nodes/Core/ExecutorService.h"
+#include "Logger.h"
+#include "Nodes/Core/CpuTopology.h"
+#include "Nodes/Core/ThreadBudget.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <algorithm>
+#include <string>
+
+namespace VisionCraft::Nodes
+{
+    ExecutorService::ExecutorService() : ExecutorService(Options{})
+    {
+    }
+
+    ExecutorService::ExecutorService(const Options &options) : options(options)
+    {
+    }
+
+    ExecutorService::~ExecutorService()
+    {
+        std::vector<std::jthread> threads;
+        {
+            std::scoped_lock lock(mutex);
+            threads = std::move(jobThreads);
+        }
+        for (auto &thread : threads)
+        {
+            thread.request_stop();
+        }
+        jobCondition.notify_all();
+        threads.clear(); // jthread joins on destruction
+    }
+
+    void ExecutorService::Post(Job job)
+    {
+        Enqueue(std::move(job), nullptr);
+    }
+
+    void ExecutorService::Enqueue(Job run, Job complete)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            jobs.push_back({ std::move(run), std::move(complete) });
+            ++statistics.jobsLaunched;
+
+            // Every parked thread already has a queued job to take, so this one needs a new thread
+            if (jobs.size() > idleJobThreads)
+            {
+                const size_t index = jobThreads.size();
+                const bool bind = options.numaAware;
+                jobThreads.emplace_back([this, index, bind](std::stop_token stopToken) {
+                    Tracer::Get().SetCurrentThreadName("Job " + std::to_string(index));
+                    if (bind)
+                    {
+                        const auto &topology = CpuTopology::Get();
+                        const size_t node = index % topology.GetNodeCount();
+                        if (!topology.BindCurrentThread(node))
+                        {
+                            LOG_WARN(
+                                "Could not bind job thread {} to NUMA node {}", index, topology.GetNodes()[node].id);
+                        }
+                    }
+                    JobLoop(stopToken);
+                });
+                ++statistics.jobThreadsStarted;
+                return;
+            }
+        }
+        jobCondition.notify_one();
+    }
+
+    void ExecutorService::JobLoop(std::stop_token stopToken)
+    {
+        std::unique_lock lock(mutex);
+        ++idleJobThreads;
+        while (true)
+        {
+            jobCondition.wait(lock, stopToken, [this]() { return !jobs.empty(); });
+            if (jobs.empty())
+            {
+                return; // Stop requested and nothing left to run
+            }
+
+            QueuedJob job = std::move(jobs.front());
+            jobs.pop_front();
+            --idleJobThreads;
+            lock.unlock();
+            job.run();
+
+            // Count as idle before the caller can see the result, so a follow-up Launch() reuses this thread
+            lock.lock();
+            ++idleJobThreads;
+            if (job.complete)
+            {
+                lock.unlock();
+                job.complete();
+                lock.lock();
+            }
+        }
+    }
+
+    std::shared_ptr<ThreadPool> ExecutorService::AcquireWorkerPool()
+    {
+        // Never more workers than a core limit allows; a changed limit takes effect on next use
+        const size_t maxCores = ThreadBudget::Get().GetMaxCores();
+        std::scoped_lock lock(mutex);
+        if (!workerPool || workerPoolCores != maxCores)
+        {
+            size_t workerCount = options.workerCount;
+            if (maxCores != 0)
+            {
+                workerCount = workerCount == 0 ? maxCores : std::min(workerCount, maxCores);
+            }
+            workerPool = options.numaAware ? std::make_shared<ThreadPool>(workerCount, CpuTopology::Get())
+                                           : std::make_shared<ThreadPool>(workerCount, options.pinWorkers);
+            workerPoolCores = maxCores;
+            LOG_INFO("Started execution thread pool with {} workers{}",
+                workerPool->GetWorkerCount(),
+                options.numaAware ? " (NUMA placed)" : (options.pinWorkers ? " (pinned)" : ""));
+        }
+        return workerPool;
+    }
+
+    void ExecutorService::SetWorkerCount(size_t count)
+    {
+        std::scoped_lock lock(mutex);
+        if (count != options.workerCount)
+        {
+            options.workerCount = count;
+            workerPool.reset();
+        }
+    }
+
+    size_t ExecutorService::GetWorkerCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return options.workerCount;
+    }
+
+    ExecutorService::Statistics ExecutorService::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return statistics;
+    }
+
+} // namespace VisionCraft::Nodes
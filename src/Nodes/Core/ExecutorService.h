@@ -0,0 +1,218 @@
+#pragma once
+
+#include "Nodes/Core/ThreadPool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Long-lived threads for all graph work, shared by the editor and the batch pipeline.
+     *
+     * Work goes to one of two lanes:
+     * - **Jobs** (Launch()/Post()): blocking work such as one graph run, a batch, or a batch decode or encode
+     *   loop. Each queued job gets a job thread of its own; threads that finish park and take the next job, so
+     *   steady repeated runs create no threads. Job threads are never retired, so their count is the peak
+     *   number of concurrent jobs.
+     * - **Workers** (AcquireWorkerPool()): the work-stealing ThreadPool that runs parallel plan steps and
+     *   pipelined stream stages. Jobs never occupy it, so a run waiting on its steps cannot starve them.
+     *
+     * With Options::numaAware, workers are spread over the CpuTopology's memory nodes and job thread i is
+     * bound to node i (modulo the node count). A run started by a job submits its steps to its own node's
+     * workers, and its images are allocated and first touched there, so a frame stays on one socket.
+     *
+     * Everything is started lazily; a service nobody uses owns no threads.
+     */
+    class ExecutorService
+    {
+    public:
+        /**
+         * @brief Job executed on a job thread.
+         */
+        using Job = std::function<void()>;
+
+        /**
+         * @brief Worker pool configuration.
+         */
+        struct Options
+        {
+            size_t workerCount = 0;  ///< Worker pool size (0 = hardware concurrency; capped by ThreadBudget)
+            bool pinWorkers = false; ///< Pin worker i to CPU core i (modulo the core count)
+            bool numaAware = false;  ///< Bind workers and job threads to NUMA nodes (overrides pinWorkers)
+        };
+
+        /**
+         * @brief Job lane counters.
+         */
+        struct Statistics
+        {
+            size_t jobsLaunched = 0;      ///< Jobs queued since construction
+            size_t jobThreadsStarted = 0; ///< Job threads created (the rest were reused)
+        };
+
+        /**
+         * @brief Creates service with hardware-sized, unpinned workers; no threads start until work arrives.
+         */
+        ExecutorService();
+
+        /**
+         * @brief Creates service; no threads are started until work arrives.
+         * @param options Worker pool configuration
+         */
+        explicit ExecutorService(const Options &options);
+
+        /**
+         * @brief Finishes queued jobs, then joins all threads.
+         */
+        ~ExecutorService();
+
+        ExecutorService(const ExecutorService &) = delete;
+        ExecutorService &operator=(const ExecutorService &) = delete;
+
+        /**
+         * @brief Queues job on the job lane.
+         * @param job Job to run
+         * @note Starts a job thread only when every existing one is busy.
+         */
+        void Post(Job job);
+
+        /**
+         * @brief Queues callable on the job lane and returns its result.
+         * @param function Callable taking no arguments
+         * @return Future holding the result, or the exception it threw
+         * @note The future becomes ready only after the job thread is available again, so a caller that
+         *       waits for one run before launching the next keeps reusing the same thread.
+         */
+        template <typename Function>
+        [[nodiscard]] auto Launch(Function function) -> std::shared_future<std::invoke_result_t<Function &>>
+        {
+            auto job = std::make_shared<LaunchedJob<Function>>(std::move(function));
+            auto future = job->promise.get_future().share();
+            Enqueue([job]() { job->Run(); }, [job]() { job->Deliver(); });
+            return future;
+        }
+
+        /**
+         * @brief Returns the worker pool, creating it on first use or after the ThreadBudget limit changed.
+         * @return Shared handle; keeps the pool alive across a concurrent SetWorkerCount()
+         */
+        [[nodiscard]] std::shared_ptr<ThreadPool> AcquireWorkerPool();
+
+        /**
+         * @brief Resizes the worker pool.
+         * @param count Worker count (0 selects hardware concurrency; a ThreadBudget core limit caps it)
+         * @note The new pool is created on next use; work already holding the old pool finishes on it.
+         */
+        void SetWorkerCount(size_t count);
+
+        /**
+         * @brief Returns the configured worker count.
+         * @return Worker count (0 = hardware concurrency)
+         */
+        [[nodiscard]] size_t GetWorkerCount() const;
+
+        /**
+         * @brief Returns job lane counters.
+         * @return Counters since construction
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        /**
+         * @brief Launch() state: runs the callable, then hands its outcome to the future.
+         */
+        template <typename Function>
+        struct LaunchedJob
+        {
+            using Result = std::invoke_result_t<Function &>;
+
+            explicit LaunchedJob(Function function) : function(std::move(function))
+            {
+            }
+
+            void Run()
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<Result>)
+                    {
+                        function();
+                    }
+                    else
+                    {
+                        result.emplace(function());
+                    }
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            void Deliver()
+            {
+                if (error)
+                {
+                    promise.set_exception(error);
+                }
+                else if constexpr (std::is_void_v<Result>)
+                {
+                    promise.set_value();
+                }
+                else
+                {
+                    promise.set_value(std::move(*result));
+                }
+            }
+
+            Function function;                                                              ///< Callable to run
+            std::promise<Result> promise;                                                   ///< Feeds the future
+            std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>> result; ///< Value once run
+            std::exception_ptr error;                                                       ///< Exception once run
+        };
+
+        /**
+         * @brief Queued job and the completion run after its thread counts as idle again.
+         */
+        struct QueuedJob
+        {
+            Job run;      ///< Work
+            Job complete; ///< Optional; makes results visible
+        };
+
+        /**
+         * @brief Queues job, starting a job thread when none is idle.
+         * @param run Work
+         * @param complete Called after run once the thread is counted idle (may be empty)
+         */
+        void Enqueue(Job run, Job complete);
+
+        /**
+         * @brief Job thread main loop.
+         * @param stopToken Token signalled on destruction; queued jobs still run
+         */
+        void JobLoop(std::stop_token stopToken);
+
+        Options options;                          ///< Worker pool configuration (mutex)
+        mutable std::mutex mutex;                 ///< Guards every member below
+        std::condition_variable_any jobCondition; ///< Signalled when jobs are queued
+        std::deque<QueuedJob> jobs;               ///< Jobs waiting for a thread
+        std::vector<std::jthread> jobThreads;     ///< Started job threads
+        size_t idleJobThreads = 0;                ///< Job threads waiting for work
+        Statistics statistics;                    ///< Job lane counters
+        std::shared_ptr<ThreadPool> workerPool;   ///< Lazy worker pool
+        size_t workerPoolCores = 0;               ///< ThreadBudget core limit workerPool was sized for
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,325 @@
+#include "Nodes/Core/GraphBinaryFormat.h"
+#include "Logger.h"
+
+#include <fstream>
+#include <limits>
+#include <type_traits>
+#include <variant>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Stores a fixed-size value in the record's scalar field
+        template<typename T> std::array<std::byte, 8> PackScalar(T value)
+        {
+            static_assert(sizeof(T) <= 8 && std::is_trivially_copyable_v<T>);
+            std::array<std::byte, 8> scalar{};
+            std::memcpy(scalar.data(), &value, sizeof(T));
+            return scalar;
+        }
+
+        template<typename T> T UnpackScalar(const std::array<std::byte, 8> &scalar)
+        {
+            T value;
+            std::memcpy(&value, scalar.data(), sizeof(T));
+            return value;
+        }
+
+        // Appends a record array to the output file
+        template<typename Record> void WriteRecords(std::ofstream &file, const std::vector<Record> &records)
+        {
+            file.write(reinterpret_cast<const char *>(records.data()),
+                static_cast<std::streamsize>(records.size() * sizeof(Record)));
+        }
+    } // namespace
+
+    void GraphBinaryWriter::AddNode(NodeId id, std::string_view type, std::string_view name)
+    {
+        nodes.push_back({ .id = id, .type = AddString(type), .name = AddString(name) });
+    }
+
+    void GraphBinaryWriter::AddConnection(NodeId from,
+        std::string_view fromSlot,
+        NodeId to,
+        std::string_view toSlot,
+        bool execution)
+    {
+        connections.push_back({ .from = from,
+            .to = to,
+            .fromSlot = AddString(fromSlot),
+            .toSlot = AddString(toSlot),
+            .execution = execution ? 1u : 0u });
+    }
+
+    void GraphBinaryWriter::AddPosition(NodeId id, float x, float y)
+    {
+        positions.push_back({ .id = id, .x = x, .y = y });
+    }
+
+    bool GraphBinaryWriter::AddDefault(NodeId node, std::string_view slot, const NodeData &value)
+    {
+        using GraphBinary::ValueType;
+        GraphBinary::DefaultRecord record;
+        record.node = node;
+
+        const bool encoded = std::visit(
+            [&](const auto &alternative) {
+                using T = std::decay_t<decltype(alternative)>;
+                if constexpr (std::is_same_v<T, double>)
+                {
+                    record.type = ValueType::Double;
+                    record.scalar = PackScalar(alternative);
+                }
+                else if constexpr (std::is_same_v<T, float>)
+                {
+                    record.type = ValueType::Float;
+                    record.scalar = PackScalar(alternative);
+                }
+                else if constexpr (std::is_same_v<T, int>)
+                {
+                    record.type = ValueType::Int;
+                    record.scalar = PackScalar(static_cast<int32_t>(alternative));
+                }
+                else if constexpr (std::is_same_v<T, bool>)
+                {
+                    record.type = ValueType::Bool;
+                    record.scalar = PackScalar(static_cast<uint8_t>(alternative ? 1 : 0));
+                }
+                else if constexpr (std::is_same_v<T, std::string>)
+                {
+                    record.type = ValueType::String;
+                    record.bytes = AddString(alternative);
+                }
+                else if constexpr (std::is_same_v<T, std::filesystem::path>)
+                {
+                    const auto utf8 = alternative.u8string();
+                    record.type = ValueType::Path;
+                    record.bytes = AddBytes(std::as_bytes(std::span(utf8)));
+                }
+                else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+                {
+                    std::vector<int32_t> coordinates;
+                    coordinates.reserve(alternative.size() * 2);
+                    for (const auto &point : alternative)
+                    {
+                        coordinates.push_back(point.x);
+                        coordinates.push_back(point.y);
+                    }
+                    record.type = ValueType::Points;
+                    record.bytes = AddBytes(std::as_bytes(std::span(coordinates)));
+                }
+                else
+                {
+                    return false; // Images and empty values are runtime data, not parameters
+                }
+                return true;
+            },
+            value);
+
+        if (!encoded)
+        {
+            return false;
+        }
+        record.slot = AddString(slot);
+        defaults.push_back(record);
+        return true;
+    }
+
+    bool GraphBinaryWriter::WriteTo(const std::filesystem::path &filepath) const
+    {
+        constexpr auto kMaxCount = std::numeric_limits<uint32_t>::max();
+        if (blobOverflow || nodes.size() > kMaxCount || connections.size() > kMaxCount
+            || positions.size() > kMaxCount || defaults.size() > kMaxCount)
+        {
+            LOG_ERROR("Graph is too large for the binary format: {}", filepath.string());
+            return false;
+        }
+
+        const GraphBinary::Header header{ .magic = GraphBinary::kMagic,
+            .version = GraphBinary::kVersion,
+            .byteOrder = GraphBinary::kByteOrderMark,
+            .nodeCount = static_cast<uint32_t>(nodes.size()),
+            .connectionCount = static_cast<uint32_t>(connections.size()),
+            .positionCount = static_cast<uint32_t>(positions.size()),
+            .defaultCount = static_cast<uint32_t>(defaults.size()),
+            .blobSize = blob.size() };
+
+        std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOG_ERROR("Failed to open file for writing: {}", filepath.string());
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        WriteRecords(file, nodes);
+        WriteRecords(file, connections);
+        WriteRecords(file, positions);
+        WriteRecords(file, defaults);
+        WriteRecords(file, blob);
+        file.close();
+
+        if (!file)
+        {
+            LOG_ERROR("Failed to write file: {}", filepath.string());
+            return false;
+        }
+        return true;
+    }
+
+    GraphBinary::BlobRef GraphBinaryWriter::AddBytes(std::span<const std::byte> bytes)
+    {
+        if (blob.size() + bytes.size() > std::numeric_limits<uint32_t>::max())
+        {
+            blobOverflow = true;
+            return {};
+        }
+
+        const GraphBinary::BlobRef ref{ .offset = static_cast<uint32_t>(blob.size()),
+            .length = static_cast<uint32_t>(bytes.size()) };
+        blob.insert(blob.end(), bytes.begin(), bytes.end());
+        return ref;
+    }
+
+    GraphBinary::BlobRef GraphBinaryWriter::AddString(std::string_view text)
+    {
+        const auto [it, inserted] = strings.try_emplace(std::string(text));
+        if (inserted)
+        {
+            it->second = AddBytes(std::as_bytes(std::span(text)));
+        }
+        return it->second;
+    }
+
+    bool GraphBinaryReader::IsBinaryGraph(std::span<const std::byte> bytes)
+    {
+        return bytes.size() >= GraphBinary::kMagic.size()
+               && std::memcmp(bytes.data(), GraphBinary::kMagic.data(), GraphBinary::kMagic.size()) == 0;
+    }
+
+    bool GraphBinaryReader::Open(std::span<const std::byte> fileBytes)
+    {
+        bytes = {};
+        if (!IsBinaryGraph(fileBytes) || fileBytes.size() < sizeof(GraphBinary::Header))
+        {
+            LOG_ERROR("Binary graph header is missing or truncated");
+            return false;
+        }
+
+        std::memcpy(&header, fileBytes.data(), sizeof(header));
+        if (header.byteOrder != GraphBinary::kByteOrderMark)
+        {
+            LOG_ERROR("Binary graph was written on a machine with a different byte order");
+            return false;
+        }
+        if (header.version != GraphBinary::kVersion)
+        {
+            LOG_ERROR("Unsupported binary graph version {} (expected {})", header.version, GraphBinary::kVersion);
+            return false;
+        }
+
+        // Counts are 32-bit, so none of these sums can overflow a 64-bit size_t
+        nodesOffset = sizeof(GraphBinary::Header);
+        connectionsOffset = nodesOffset + size_t{ header.nodeCount } * sizeof(GraphBinary::NodeRecord);
+        positionsOffset = connectionsOffset + size_t{ header.connectionCount } * sizeof(GraphBinary::ConnectionRecord);
+        defaultsOffset = positionsOffset + size_t{ header.positionCount } * sizeof(GraphBinary::PositionRecord);
+        blobOffset = defaultsOffset + size_t{ header.defaultCount } * sizeof(GraphBinary::DefaultRecord);
+        if (blobOffset > fileBytes.size() || header.blobSize != fileBytes.size() - blobOffset)
+        {
+            LOG_ERROR("Binary graph sections do not match the file size ({} bytes)", fileBytes.size());
+            return false;
+        }
+
+        bytes = fileBytes;
+        return true;
+    }
+
+    const GraphBinary::Header &GraphBinaryReader::GetHeader() const
+    {
+        return header;
+    }
+
+    GraphBinary::NodeRecord GraphBinaryReader::GetNode(size_t index) const
+    {
+        return RecordAt<GraphBinary::NodeRecord>(nodesOffset, index);
+    }
+
+    GraphBinary::ConnectionRecord GraphBinaryReader::GetConnection(size_t index) const
+    {
+        return RecordAt<GraphBinary::ConnectionRecord>(connectionsOffset, index);
+    }
+
+    GraphBinary::PositionRecord GraphBinaryReader::GetPosition(size_t index) const
+    {
+        return RecordAt<GraphBinary::PositionRecord>(positionsOffset, index);
+    }
+
+    GraphBinary::DefaultRecord GraphBinaryReader::GetDefault(size_t index) const
+    {
+        return RecordAt<GraphBinary::DefaultRecord>(defaultsOffset, index);
+    }
+
+    std::optional<std::span<const std::byte>> GraphBinaryReader::GetBytes(GraphBinary::BlobRef ref) const
+    {
+        if (uint64_t{ ref.offset } + ref.length > header.blobSize)
+        {
+            return std::nullopt;
+        }
+        return bytes.subspan(blobOffset + ref.offset, ref.length);
+    }
+
+    std::optional<std::string_view> GraphBinaryReader::GetString(GraphBinary::BlobRef ref) const
+    {
+        const auto range = GetBytes(ref);
+        if (!range)
+        {
+            return std::nullopt;
+        }
+        return std::string_view(reinterpret_cast<const char *>(range->data()), range->size());
+    }
+
+    std::optional<NodeData> GraphBinaryReader::GetValue(const GraphBinary::DefaultRecord &record) const
+    {
+        using GraphBinary::ValueType;
+        switch (record.type)
+        {
+        case ValueType::Double:
+            return UnpackScalar<double>(record.scalar);
+        case ValueType::Float:
+            return UnpackScalar<float>(record.scalar);
+        case ValueType::Int:
+            return static_cast<int>(UnpackScalar<int32_t>(record.scalar));
+        case ValueType::Bool:
+            return UnpackScalar<uint8_t>(record.scalar) != 0;
+        case ValueType::String:
+            if (const auto text = GetString(record.bytes))
+            {
+                return std::string(*text);
+            }
+            return std::nullopt;
+        case ValueType::Path:
+            if (const auto range = GetBytes(record.bytes))
+            {
+                const auto *text = reinterpret_cast<const char8_t *>(range->data());
+                return std::filesystem::path(std::u8string(text, text + range->size()));
+            }
+            return std::nullopt;
+        case ValueType::Points:
+            if (const auto range = GetBytes(record.bytes); range && range->size() % (2 * sizeof(int32_t)) == 0)
+            {
+                std::vector<cv::Point> points(range->size() / (2 * sizeof(int32_t)));
+                for (size_t i = 0; i < points.size(); ++i)
+                {
+                    std::array<int32_t, 2> coordinates{};
+                    std::memcpy(coordinates.data(), range->data() + i * sizeof(coordinates), sizeof(coordinates));
+                    points[i] = { coordinates[0], coordinates[1] };
+                }
+                return points;
+            }
+            return std::nullopt;
+        }
+        return std::nullopt;
+    }
+
+} // namespace VisionCraft::Nodes
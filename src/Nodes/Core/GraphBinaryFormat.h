@@ -0,0 +1,306 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include "Nodes/Core/NodeData.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief On-disk records of the binary graph format (NodeEditor::SaveToFile() with a ".vcgb" path).
+     *
+     * A file is a Header, then the NodeRecord, ConnectionRecord, PositionRecord and DefaultRecord arrays back
+     * to back, then one blob holding every string, path and point list, referenced by BlobRef. All records
+     * are fixed-size and padding-free in host byte order (Header::byteOrder rejects files from the other
+     * order), so a mapped file is read by indexing: nothing is tokenized and strings are views into the blob.
+     * Readers reject any version other than their own kVersion.
+     */
+    namespace GraphBinary
+    {
+        /// @brief First bytes of every binary graph file
+        constexpr std::array<char, 4> kMagic{ 'V', 'C', 'G', 'B' };
+
+        /// @brief Format version written by GraphBinaryWriter
+        constexpr uint32_t kVersion = 1;
+
+        /// @brief Reads back as a different value when the file was written in the other byte order
+        constexpr uint32_t kByteOrderMark = 0x01020304;
+
+        /**
+         * @brief Byte range in the blob.
+         */
+        struct BlobRef
+        {
+            uint32_t offset = 0; ///< First byte, relative to the blob start
+            uint32_t length = 0; ///< Byte count
+        };
+
+        /**
+         * @brief File header; the section sizes follow from the counts.
+         */
+        struct Header
+        {
+            std::array<char, 4> magic{};  ///< kMagic
+            uint32_t version = 0;         ///< kVersion of the writer
+            uint32_t byteOrder = 0;       ///< kByteOrderMark in the writer's byte order
+            uint32_t nodeCount = 0;       ///< NodeRecord entries
+            uint32_t connectionCount = 0; ///< ConnectionRecord entries
+            uint32_t positionCount = 0;   ///< PositionRecord entries
+            uint32_t defaultCount = 0;    ///< DefaultRecord entries
+            uint32_t reserved = 0;        ///< Zero
+            uint64_t blobSize = 0;        ///< Bytes after the last record array
+        };
+
+        /**
+         * @brief One node.
+         */
+        struct NodeRecord
+        {
+            NodeId id = 0; ///< Node ID
+            BlobRef type;  ///< Node::GetType()
+            BlobRef name;  ///< Node::GetName()
+        };
+
+        /**
+         * @brief One connection.
+         */
+        struct ConnectionRecord
+        {
+            NodeId from = 0;        ///< Source node ID
+            NodeId to = 0;          ///< Destination node ID
+            BlobRef fromSlot;       ///< Source slot name
+            BlobRef toSlot;         ///< Destination slot name
+            uint32_t execution = 0; ///< 1 for an execution connection, 0 for data
+        };
+
+        /**
+         * @brief Canvas position of one node.
+         */
+        struct PositionRecord
+        {
+            NodeId id = 0;  ///< Node ID
+            float x = 0.0f; ///< Horizontal coordinate
+            float y = 0.0f; ///< Vertical coordinate
+        };
+
+        /**
+         * @brief NodeData alternative stored in a DefaultRecord.
+         */
+        enum class ValueType : uint32_t
+        {
+            Double = 1, ///< double in DefaultRecord::scalar
+            Float,      ///< float in DefaultRecord::scalar
+            Int,        ///< int in DefaultRecord::scalar
+            Bool,       ///< bool in DefaultRecord::scalar
+            String,     ///< std::string bytes in DefaultRecord::bytes
+            Path,       ///< UTF-8 std::filesystem::path in DefaultRecord::bytes
+            Points      ///< std::vector<cv::Point> as int32 x,y pairs in DefaultRecord::bytes
+        };
+
+        /**
+         * @brief Default value of one input slot.
+         */
+        struct DefaultRecord
+        {
+            NodeId node = 0;                    ///< Node ID
+            BlobRef slot;                       ///< Input slot name
+            ValueType type = ValueType::Double; ///< Stored alternative
+            BlobRef bytes;                      ///< Variable-length value (String, Path, Points)
+            std::array<std::byte, 8> scalar{};  ///< Fixed-size value (Double, Float, Int, Bool)
+        };
+
+        static_assert(sizeof(Header) == 40);
+        static_assert(sizeof(NodeRecord) == 20);
+        static_assert(sizeof(ConnectionRecord) == 28);
+        static_assert(sizeof(PositionRecord) == 12);
+        static_assert(sizeof(DefaultRecord) == 32);
+    } // namespace GraphBinary
+
+    /**
+     * @brief Collects a graph and writes it in the binary graph format.
+     *
+     * Strings repeated across records (node types, slot names) are stored once.
+     */
+    class GraphBinaryWriter
+    {
+    public:
+        /**
+         * @brief Adds node record.
+         * @param id Node ID
+         * @param type Node type
+         * @param name Node name
+         */
+        void AddNode(NodeId id, std::string_view type, std::string_view name);
+
+        /**
+         * @brief Adds connection record.
+         * @param from Source node ID
+         * @param fromSlot Source slot name
+         * @param to Destination node ID
+         * @param toSlot Destination slot name
+         * @param execution True for an execution connection
+         */
+        void AddConnection(NodeId from, std::string_view fromSlot, NodeId to, std::string_view toSlot, bool execution);
+
+        /**
+         * @brief Adds node position record.
+         * @param id Node ID
+         * @param x Horizontal coordinate
+         * @param y Vertical coordinate
+         */
+        void AddPosition(NodeId id, float x, float y);
+
+        /**
+         * @brief Adds slot default record.
+         * @param node Node ID
+         * @param slot Input slot name
+         * @param value Default value
+         * @return False if the value's type has no binary encoding (images, empty values); nothing is added
+         */
+        bool AddDefault(NodeId node, std::string_view slot, const NodeData &value);
+
+        /**
+         * @brief Writes header, records and blob.
+         * @param filepath Destination file (replaced)
+         * @return True if written
+         */
+        bool WriteTo(const std::filesystem::path &filepath) const;
+
+    private:
+        /**
+         * @brief Appends bytes to the blob.
+         * @param bytes Bytes to store
+         * @return Reference to the stored copy
+         */
+        GraphBinary::BlobRef AddBytes(std::span<const std::byte> bytes);
+
+        /**
+         * @brief Stores string once, returning the earlier reference for repeats.
+         * @param text String to store
+         * @return Reference to the stored bytes
+         */
+        GraphBinary::BlobRef AddString(std::string_view text);
+
+        std::vector<GraphBinary::NodeRecord> nodes;                    ///< Node records
+        std::vector<GraphBinary::ConnectionRecord> connections;        ///< Connection records
+        std::vector<GraphBinary::PositionRecord> positions;            ///< Position records
+        std::vector<GraphBinary::DefaultRecord> defaults;              ///< Slot default records
+        std::vector<std::byte> blob;                                   ///< Strings, paths and point lists
+        std::unordered_map<std::string, GraphBinary::BlobRef> strings; ///< Stored strings, for reuse
+        bool blobOverflow = false;                                     ///< Blob outgrew 32-bit offsets
+    };
+
+    /**
+     * @brief Reads records of a binary graph held in memory, typically a MappedFile.
+     *
+     * Open() validates the header and that every record array lies inside the buffer; record accessors
+     * then only copy fixed-size records out. Blob references are checked on access. The buffer must
+     * outlive the reader and every string view it returns.
+     */
+    class GraphBinaryReader
+    {
+    public:
+        /**
+         * @brief Checks if buffer starts with the binary graph magic.
+         * @param bytes File contents
+         * @return True for a binary graph, false for JSON or anything else
+         */
+        [[nodiscard]] static bool IsBinaryGraph(std::span<const std::byte> bytes);
+
+        /**
+         * @brief Validates header and section bounds.
+         * @param bytes File contents
+         * @return True if the records can be read; reasons for rejection are logged
+         */
+        bool Open(std::span<const std::byte> bytes);
+
+        /**
+         * @brief Returns validated header.
+         * @return Header of the opened buffer
+         */
+        [[nodiscard]] const GraphBinary::Header &GetHeader() const;
+
+        /**
+         * @brief Returns node record.
+         * @param index Record index, below Header::nodeCount
+         * @return Record copy
+         */
+        [[nodiscard]] GraphBinary::NodeRecord GetNode(size_t index) const;
+
+        /**
+         * @brief Returns connection record.
+         * @param index Record index, below Header::connectionCount
+         * @return Record copy
+         */
+        [[nodiscard]] GraphBinary::ConnectionRecord GetConnection(size_t index) const;
+
+        /**
+         * @brief Returns position record.
+         * @param index Record index, below Header::positionCount
+         * @return Record copy
+         */
+        [[nodiscard]] GraphBinary::PositionRecord GetPosition(size_t index) const;
+
+        /**
+         * @brief Returns slot default record.
+         * @param index Record index, below Header::defaultCount
+         * @return Record copy
+         */
+        [[nodiscard]] GraphBinary::DefaultRecord GetDefault(size_t index) const;
+
+        /**
+         * @brief Resolves string in the blob.
+         * @param ref Reference from a record
+         * @return View into the buffer, or std::nullopt if the reference leaves the blob
+         */
+        [[nodiscard]] std::optional<std::string_view> GetString(GraphBinary::BlobRef ref) const;
+
+        /**
+         * @brief Decodes slot default value.
+         * @param record Record from GetDefault()
+         * @return Value, or std::nullopt for an unknown type or an out-of-range reference
+         */
+        [[nodiscard]] std::optional<NodeData> GetValue(const GraphBinary::DefaultRecord &record) const;
+
+    private:
+        /**
+         * @brief Copies one record out of the buffer.
+         * @param offset Section start
+         * @param index Record index in the section
+         * @return Record copy (memcpy, so the buffer needs no particular alignment)
+         */
+        template<typename Record> [[nodiscard]] Record RecordAt(size_t offset, size_t index) const
+        {
+            Record record;
+            std::memcpy(&record, bytes.data() + offset + index * sizeof(Record), sizeof(Record));
+            return record;
+        }
+
+        /**
+         * @brief Resolves byte range in the blob.
+         * @param ref Reference from a record
+         * @return Bytes, or std::nullopt if the reference leaves the blob
+         */
+        [[nodiscard]] std::optional<std::span<const std::byte>> GetBytes(GraphBinary::BlobRef ref) const;
+
+        std::span<const std::byte> bytes; ///< Whole file
+        GraphBinary::Header header;       ///< Validated header
+        size_t nodesOffset = 0;           ///< Start of NodeRecord array
+        size_t connectionsOffset = 0;     ///< Start of ConnectionRecord array
+        size_t positionsOffset = 0;       ///< Start of PositionRecord array
+        size_t defaultsOffset = 0;        ///< Start of DefaultRecord array
+        size_t blobOffset = 0;            ///< Start of blob
+    };
+
+} // namespace VisionCraft::Nodes
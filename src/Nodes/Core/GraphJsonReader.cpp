@@ -0,0 +1,439 @@
+#include "Nodes/Core/GraphJsonReader.h"
+#include "Logger.h"
+
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Fields of the element being read (bit per required field)
+        constexpr unsigned kFirstField = 1u << 0;
+        constexpr unsigned kSecondField = 1u << 1;
+        constexpr unsigned kThirdField = 1u << 2;
+        constexpr unsigned kAllFields = kFirstField | kSecondField | kThirdField;
+
+        std::optional<int64_t> AsInteger(const nlohmann::json &value)
+        {
+            if (value.is_number_unsigned())
+            {
+                const auto unsignedValue = value.get<uint64_t>();
+                if (unsignedValue > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+                {
+                    return std::nullopt;
+                }
+                return static_cast<int64_t>(unsignedValue);
+            }
+            if (value.is_number_integer())
+            {
+                return value.get<int64_t>();
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief nlohmann::json SAX consumer tracking where in the graph file each token belongs.
+         *
+         * Every container pushes a frame; containers the format does not define push Skip frames, so
+         * their contents are dropped without being stored. Values under "defaults" are captured into
+         * a small nlohmann::json each.
+         */
+        class GraphSaxHandler
+        {
+        public:
+            using number_integer_t = nlohmann::json::number_integer_t;
+            using number_unsigned_t = nlohmann::json::number_unsigned_t;
+            using number_float_t = nlohmann::json::number_float_t;
+            using string_t = nlohmann::json::string_t;
+            using binary_t = nlohmann::json::binary_t;
+
+            GraphSaxHandler(const GraphJsonReader::NodeHandler &onNode,
+                const GraphJsonReader::ConnectionHandler &onConnection,
+                const GraphJsonReader::PositionHandler &onPosition)
+                : onNode(onNode), onConnection(onConnection), onPosition(onPosition)
+            {
+            }
+
+            bool null()
+            {
+                return Value(nullptr);
+            }
+
+            bool boolean(bool value)
+            {
+                return Value(value);
+            }
+
+            bool number_integer(number_integer_t value)
+            {
+                return Value(value);
+            }
+
+            bool number_unsigned(number_unsigned_t value)
+            {
+                return Value(value);
+            }
+
+            bool number_float(number_float_t value, const string_t &)
+            {
+                return Value(value);
+            }
+
+            bool string(string_t &value)
+            {
+                return Value(std::move(value));
+            }
+
+            bool binary(binary_t &)
+            {
+                return Fail("binary values are not part of the format");
+            }
+
+            bool key(string_t &name)
+            {
+                (capture.empty() ? currentKey : captureKey) = std::move(name);
+                return true;
+            }
+
+            bool start_object(std::size_t)
+            {
+                if (!capture.empty())
+                {
+                    return CaptureOpen(nlohmann::json::object());
+                }
+                if (frames.empty())
+                {
+                    frames.push_back(Frame::Root);
+                    return true;
+                }
+
+                switch (frames.back())
+                {
+                case Frame::Nodes:
+                    node = {};
+                    seen = 0;
+                    frames.push_back(Frame::Node);
+                    return true;
+                case Frame::Connections:
+                    connection = {};
+                    seen = 0;
+                    frames.push_back(Frame::Connection);
+                    return true;
+                case Frame::Positions:
+                    position = {};
+                    seen = 0;
+                    frames.push_back(Frame::Position);
+                    return true;
+                case Frame::Node:
+                    frames.push_back(currentKey == "defaults" ? Frame::Defaults : Frame::Skip);
+                    return true;
+                case Frame::Defaults:
+                    return CaptureBegin(nlohmann::json::object());
+                case Frame::Root:
+                    if (IsSection(currentKey))
+                    {
+                        return Fail("'" + currentKey + "' must be an array");
+                    }
+                    frames.push_back(Frame::Skip);
+                    return true;
+                default:
+                    frames.push_back(Frame::Skip);
+                    return true;
+                }
+            }
+
+            bool end_object()
+            {
+                if (!capture.empty())
+                {
+                    return CaptureClose();
+                }
+
+                const auto frame = frames.back();
+                frames.pop_back();
+                switch (frame)
+                {
+                case Frame::Node:
+                    if (seen != kAllFields)
+                    {
+                        return Fail("node entries need an integer 'id' and string 'type' and 'name'");
+                    }
+                    return onNode(std::move(node));
+                case Frame::Connection:
+                    if ((seen & (kFirstField | kSecondField)) != (kFirstField | kSecondField))
+                    {
+                        return Fail("connection entries need integer 'from' and 'to'");
+                    }
+                    return onConnection(std::move(connection));
+                case Frame::Position:
+                    if (seen != kAllFields)
+                    {
+                        return Fail("position entries need an integer 'id' and numeric 'x' and 'y'");
+                    }
+                    return onPosition(position);
+                default:
+                    return true;
+                }
+            }
+
+            bool start_array(std::size_t)
+            {
+                if (!capture.empty())
+                {
+                    return CaptureOpen(nlohmann::json::array());
+                }
+                if (frames.empty())
+                {
+                    return Fail("the file must hold a JSON object");
+                }
+
+                switch (frames.back())
+                {
+                case Frame::Root:
+                    frames.push_back(currentKey == "nodes"           ? Frame::Nodes
+                                     : currentKey == "connections"   ? Frame::Connections
+                                     : currentKey == "nodePositions" ? Frame::Positions
+                                                                     : Frame::Skip);
+                    return true;
+                case Frame::Defaults:
+                    return CaptureBegin(nlohmann::json::array());
+                case Frame::Nodes:
+                case Frame::Connections:
+                case Frame::Positions:
+                    return Fail("entries of '" + currentKey + "' must be objects");
+                default:
+                    frames.push_back(Frame::Skip);
+                    return true;
+                }
+            }
+
+            bool end_array()
+            {
+                if (!capture.empty())
+                {
+                    return CaptureClose();
+                }
+                frames.pop_back();
+                return true;
+            }
+
+            bool parse_error(std::size_t position, const std::string &, const nlohmann::json::exception &error)
+            {
+                LOG_ERROR("Failed to parse graph file at byte {}: {}", position, error.what());
+                return false;
+            }
+
+        private:
+            enum class Frame
+            {
+                Root,        ///< Top-level object
+                Nodes,       ///< "nodes" array
+                Node,        ///< One node object
+                Defaults,    ///< A node's "defaults" object
+                Connections, ///< "connections" array
+                Connection,  ///< One connection object
+                Positions,   ///< "nodePositions" array
+                Position,    ///< One position object
+                Skip         ///< Container outside the format
+            };
+
+            static bool IsSection(std::string_view name)
+            {
+                return name == "nodes" || name == "connections" || name == "nodePositions";
+            }
+
+            static bool Fail(const std::string &reason)
+            {
+                LOG_ERROR("Invalid graph file: {}", reason);
+                return false;
+            }
+
+            // Scalars outside "defaults" fill the field named by the current key
+            bool Value(nlohmann::json value)
+            {
+                if (!capture.empty())
+                {
+                    return CaptureValue(std::move(value));
+                }
+                if (frames.empty())
+                {
+                    return Fail("the file must hold a JSON object");
+                }
+
+                switch (frames.back())
+                {
+                case Frame::Node:
+                    if (currentKey == "id")
+                    {
+                        return SetInteger(node.id, value, kFirstField, "node 'id'");
+                    }
+                    if (currentKey == "type")
+                    {
+                        return SetString(node.type, value, kSecondField, "node 'type'");
+                    }
+                    if (currentKey == "name")
+                    {
+                        return SetString(node.name, value, kThirdField, "node 'name'");
+                    }
+                    return true;
+                case Frame::Connection:
+                    if (currentKey == "from")
+                    {
+                        return SetInteger(connection.from, value, kFirstField, "connection 'from'");
+                    }
+                    if (currentKey == "to")
+                    {
+                        return SetInteger(connection.to, value, kSecondField, "connection 'to'");
+                    }
+                    if (currentKey == "fromSlot")
+                    {
+                        return SetString(connection.fromSlot, value, 0, "connection 'fromSlot'");
+                    }
+                    if (currentKey == "toSlot")
+                    {
+                        return SetString(connection.toSlot, value, 0, "connection 'toSlot'");
+                    }
+                    return true;
+                case Frame::Position:
+                    if (currentKey == "id")
+                    {
+                        return SetInteger(position.id, value, kFirstField, "position 'id'");
+                    }
+                    if (currentKey == "x")
+                    {
+                        return SetFloat(position.x, value, kSecondField, "position 'x'");
+                    }
+                    if (currentKey == "y")
+                    {
+                        return SetFloat(position.y, value, kThirdField, "position 'y'");
+                    }
+                    return true;
+                case Frame::Defaults:
+                    node.defaults.emplace_back(currentKey, std::move(value));
+                    return true;
+                case Frame::Root:
+                    if (IsSection(currentKey))
+                    {
+                        return Fail("'" + currentKey + "' must be an array");
+                    }
+                    return true;
+                case Frame::Nodes:
+                case Frame::Connections:
+                case Frame::Positions:
+                    return Fail("entries of '" + currentKey + "' must be objects");
+                case Frame::Skip:
+                    return true;
+                }
+                return true;
+            }
+
+            bool SetInteger(int64_t &field, const nlohmann::json &value, unsigned bit, const char *what)
+            {
+                const auto integer = AsInteger(value);
+                if (!integer)
+                {
+                    return Fail(std::string(what) + " must be an integer");
+                }
+                field = *integer;
+                seen |= bit;
+                return true;
+            }
+
+            bool SetString(std::string &field, nlohmann::json &value, unsigned bit, const char *what)
+            {
+                if (!value.is_string())
+                {
+                    return Fail(std::string(what) + " must be a string");
+                }
+                field = std::move(value.get_ref<std::string &>());
+                seen |= bit;
+                return true;
+            }
+
+            bool SetFloat(float &field, const nlohmann::json &value, unsigned bit, const char *what)
+            {
+                if (!value.is_number())
+                {
+                    return Fail(std::string(what) + " must be a number");
+                }
+                field = value.get<float>();
+                seen |= bit;
+                return true;
+            }
+
+            // Starts capturing one "defaults" container value for the slot named by the current key
+            bool CaptureBegin(nlohmann::json container)
+            {
+                captured = std::move(container);
+                captureSlot = currentKey;
+                capture.push_back(&captured);
+                return true;
+            }
+
+            bool CaptureOpen(nlohmann::json container)
+            {
+                auto &parent = *capture.back();
+                // The parent is not touched again until this child closes, so the pointer stays valid
+                auto &child = parent.is_array() ? parent.emplace_back(std::move(container))
+                                                : (parent[captureKey] = std::move(container));
+                capture.push_back(&child);
+                return true;
+            }
+
+            bool CaptureValue(nlohmann::json value)
+            {
+                auto &parent = *capture.back();
+                if (parent.is_array())
+                {
+                    parent.push_back(std::move(value));
+                }
+                else
+                {
+                    parent[captureKey] = std::move(value);
+                }
+                return true;
+            }
+
+            bool CaptureClose()
+            {
+                capture.pop_back();
+                if (capture.empty())
+                {
+                    node.defaults.emplace_back(std::move(captureSlot), std::move(captured));
+                }
+                return true;
+            }
+
+            const GraphJsonReader::NodeHandler &onNode;
+            const GraphJsonReader::ConnectionHandler &onConnection;
+            const GraphJsonReader::PositionHandler &onPosition;
+
+            std::vector<Frame> frames;              ///< Open containers, outermost first
+            std::string currentKey;                 ///< Last key outside a captured value
+            GraphJson::NodeRecord node;             ///< Node being read
+            GraphJson::ConnectionRecord connection; ///< Connection being read
+            GraphJson::PositionRecord position;     ///< Position being read
+            unsigned seen = 0;                      ///< Required fields of the current element already read
+
+            nlohmann::json captured;               ///< "defaults" container value being captured
+            std::vector<nlohmann::json *> capture; ///< Open containers of the captured value
+            std::string captureKey;                ///< Last key inside the captured value
+            std::string captureSlot;               ///< Slot the captured value belongs to
+        };
+    } // namespace
+
+    GraphJsonReader::GraphJsonReader(NodeHandler onNode, ConnectionHandler onConnection, PositionHandler onPosition)
+        : onNode(std::move(onNode)), onConnection(std::move(onConnection)), onPosition(std::move(onPosition))
+    {
+    }
+
+    bool GraphJsonReader::Parse(std::span<const std::byte> bytes)
+    {
+        GraphSaxHandler handler(onNode, onConnection, onPosition);
+        const auto *text = reinterpret_cast<const char *>(bytes.data());
+        return nlohmann::json::sax_parse(text, text + bytes.size(), &handler);
+    }
+
+} // namespace VisionCraft::Nodes
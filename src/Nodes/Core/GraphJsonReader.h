@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Elements of a JSON graph file (NodeEditor::SaveToFile() with any path but ".vcgb").
+     */
+    namespace GraphJson
+    {
+        /**
+         * @brief One entry of "nodes".
+         */
+        struct NodeRecord
+        {
+            int64_t id = 0;                                               ///< "id" (range checked by the caller)
+            std::string type;                                             ///< "type"
+            std::string name;                                             ///< "name"
+            std::vector<std::pair<std::string, nlohmann::json>> defaults; ///< "defaults" by slot name, in file order
+        };
+
+        /**
+         * @brief One entry of "connections".
+         */
+        struct ConnectionRecord
+        {
+            int64_t from = 0;                ///< "from"
+            std::string fromSlot = "Output"; ///< "fromSlot" (older files omit it)
+            int64_t to = 0;                  ///< "to"
+            std::string toSlot = "Input";    ///< "toSlot" (older files omit it)
+        };
+
+        /**
+         * @brief One entry of "nodePositions".
+         */
+        struct PositionRecord
+        {
+            int64_t id = 0; ///< "id"
+            float x = 0.0f; ///< "x"
+            float y = 0.0f; ///< "y"
+        };
+    } // namespace GraphJson
+
+    /**
+     * @brief Streams a JSON graph file into per-element callbacks without building a document.
+     *
+     * The file is tokenized straight from the buffer (typically a MappedFile) and every node, connection
+     * and position is handed over as soon as its object closes, so memory use is bounded by the largest
+     * element rather than the file. Only the small "defaults" values are materialized as nlohmann::json.
+     * Elements arrive in file order; saved files list "connections" before "nodes" (keys are sorted), so
+     * callers should not resolve connections until Parse() returns.
+     *
+     * Unknown keys are skipped. A missing or mistyped required field, malformed JSON, or a callback
+     * returning false stops the parse.
+     */
+    class GraphJsonReader
+    {
+    public:
+        using NodeHandler = std::function<bool(GraphJson::NodeRecord &&)>;              ///< False aborts
+        using ConnectionHandler = std::function<bool(GraphJson::ConnectionRecord &&)>;  ///< False aborts
+        using PositionHandler = std::function<bool(const GraphJson::PositionRecord &)>; ///< False aborts
+
+        /**
+         * @brief Constructs reader.
+         * @param onNode Called for every complete node entry
+         * @param onConnection Called for every complete connection entry
+         * @param onPosition Called for every complete position entry
+         */
+        GraphJsonReader(NodeHandler onNode, ConnectionHandler onConnection, PositionHandler onPosition);
+
+        /**
+         * @brief Parses whole file, invoking the callbacks along the way.
+         * @param bytes File contents
+         * @return True if the file was valid and no callback aborted; reasons for rejection are logged
+         */
+        bool Parse(std::span<const std::byte> bytes);
+
+    private:
+        NodeHandler onNode;             ///< Node callback
+        ConnectionHandler onConnection; ///< Connection callback
+        PositionHandler onPosition;     ///< Position callback
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,92 @@
+#include "Nodes/Core/ImageBatch.h"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    ImageBatch ImageBatch::Create(size_t count, cv::Size size, int type, cv::Mat storage)
+    {
+        if (count == 0 || size.empty())
+        {
+            throw std::invalid_argument("A batch needs at least one image of non-zero size");
+        }
+        if (count > static_cast<size_t>(std::numeric_limits<int>::max() / size.height))
+        {
+            throw std::invalid_argument("Batch of " + std::to_string(count) + " images is too tall for one buffer");
+        }
+
+        // One allocation for the whole batch, however many images it has
+        storage.create(static_cast<int>(count) * size.height, size.width, type);
+        return FromStorage(std::move(storage), count);
+    }
+
+    ImageBatch ImageBatch::FromImages(std::span<const cv::Mat> images, cv::Mat storage)
+    {
+        if (images.empty())
+        {
+            return {};
+        }
+        const cv::Size size = images.front().size();
+        const int type = images.front().type();
+        for (const auto &image : images)
+        {
+            if (image.empty() || image.dims > 2 || image.size() != size || image.type() != type)
+            {
+                throw std::invalid_argument("Batched images must all be non-empty with the same size and type");
+            }
+        }
+
+        ImageBatch batch = Create(images.size(), size, type, std::move(storage));
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            cv::Mat destination = batch.GetImage(i);
+            images[i].copyTo(destination);
+        }
+        return batch;
+    }
+
+    ImageBatch ImageBatch::FromStorage(cv::Mat storage, size_t count)
+    {
+        ImageBatch batch;
+        if (storage.empty() && count == 0)
+        {
+            return batch;
+        }
+        if (storage.empty() || count == 0 || storage.dims > 2 || static_cast<size_t>(storage.rows) % count != 0)
+        {
+            throw std::invalid_argument("Batch storage must hold a whole number of rows per image");
+        }
+
+        batch.storage = std::move(storage);
+        batch.count = count;
+        return batch;
+    }
+
+    cv::Mat ImageBatch::GetImage(size_t index) const
+    {
+        if (index >= count)
+        {
+            throw std::out_of_range("Batch image " + std::to_string(index) + " is out of range");
+        }
+        const int height = storage.rows / static_cast<int>(count);
+        const int first = static_cast<int>(index) * height;
+        cv::Mat image = storage.rowRange(first, first + height);
+
+        // OpenCV filters read past a region into its parent for their borders; ending the header's bounds at
+        // the image keeps them from reading the neighbouring images
+        const size_t rowBytes = static_cast<size_t>(image.cols) * image.elemSize();
+        image.datastart = image.data;
+        image.dataend = image.data + image.step[0] * static_cast<size_t>(height - 1) + rowBytes;
+        return image;
+    }
+
+    ImageBatch ImageBatch::Clone() const
+    {
+        ImageBatch batch = *this;
+        batch.storage = storage.clone();
+        return batch;
+    }
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <span>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Any number of same-shaped images in one allocation, processed by one node call.
+     *
+     * The images are stacked top to bottom in a single buffer of count * height rows, so image i is rows
+     * [i * height, (i + 1) * height). Written into an image from Node::CreateOutputImage(), the buffer is
+     * recycled by the ImageBufferPool like any other output. A node given a batch in its "Input" slot runs
+     * once for all of them (see Node::ProcessBatch()) instead of once per image, which pays the per-node
+     * costs (slot lookups, parameter parsing, scheduling) once for the whole batch.
+     *
+     * Copies share the buffer, like cv::Mat itself, and it is never written after construction.
+     */
+    class ImageBatch
+    {
+    public:
+        ImageBatch() = default;
+
+        /**
+         * @brief Allocates a batch for a producer to fill.
+         * @param count Number of images
+         * @param size Size of every image
+         * @param type cv::Mat type of every image
+         * @param storage Image to allocate the buffer in (e.g. from Node::CreateOutputImage()); pass an empty
+         *                image that shares no buffer
+         * @return Batch with uninitialized pixels; write them through GetImage() before sharing it
+         * @throws std::invalid_argument if count is zero or size is empty
+         */
+        [[nodiscard]] static ImageBatch Create(size_t count, cv::Size size, int type, cv::Mat storage = {});
+
+        /**
+         * @brief Copies images into one batch.
+         * @param images Images of the same size and type
+         * @param storage Image to allocate the buffer in (e.g. from Node::CreateOutputImage())
+         * @return Batch holding copies of the images (empty if there are none)
+         * @throws std::invalid_argument if the images differ in size or type or one is empty
+         */
+        [[nodiscard]] static ImageBatch FromImages(std::span<const cv::Mat> images, cv::Mat storage = {});
+
+        /**
+         * @brief Wraps a buffer holding stacked images without copying it.
+         * @param storage Images stacked top to bottom, as returned by GetStorage()
+         * @param count Number of images in storage
+         * @return Batch over storage
+         * @throws std::invalid_argument if storage cannot be split into count images of equal height
+         */
+        [[nodiscard]] static ImageBatch FromStorage(cv::Mat storage, size_t count);
+
+        /**
+         * @brief Returns the number of images.
+         * @return Images in the batch
+         */
+        [[nodiscard]] size_t GetCount() const
+        {
+            return count;
+        }
+
+        /**
+         * @brief Returns whether the batch has no images.
+         * @return True if GetCount() is zero
+         */
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return count == 0;
+        }
+
+        /**
+         * @brief Returns the size every image has.
+         * @return Width and height of one image
+         */
+        [[nodiscard]] cv::Size GetImageSize() const
+        {
+            return count > 0 ? cv::Size(storage.cols, storage.rows / static_cast<int>(count)) : cv::Size();
+        }
+
+        /**
+         * @brief Returns the type every image has.
+         * @return cv::Mat type of the images (0 for an empty batch)
+         */
+        [[nodiscard]] int GetType() const
+        {
+            return storage.type();
+        }
+
+        /**
+         * @brief Returns one image as a cv::Mat header over the buffer.
+         * @param index Position in the batch
+         * @return Image sharing the buffer, bounded as a whole image (filters do not read the neighbours)
+         * @throws std::out_of_range if index is not below GetCount()
+         */
+        [[nodiscard]] cv::Mat GetImage(size_t index) const;
+
+        /**
+         * @brief Returns the buffer holding every image.
+         * @return Images stacked top to bottom (shared; empty for an empty batch)
+         */
+        [[nodiscard]] const cv::Mat &GetStorage() const
+        {
+            return storage;
+        }
+
+        /**
+         * @brief Copies the batch into a buffer of its own.
+         * @return Batch with equal pixels and no shared memory
+         */
+        [[nodiscard]] ImageBatch Clone() const;
+
+        /**
+         * @brief Returns the memory held by the buffer.
+         * @return Bytes of pixels of all images
+         */
+        [[nodiscard]] size_t GetByteSize() const
+        {
+            return storage.total() * storage.elemSize();
+        }
+
+    private:
+        cv::Mat storage;  ///< Images stacked top to bottom
+        size_t count = 0; ///< Number of images in storage
+    };
+} // namespace VisionCraft::Nodes
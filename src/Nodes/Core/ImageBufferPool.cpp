@@ -0,0 +1,220 @@
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/CpuTopology.h"
+
+#include <iterator>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Held in UMatData::userdata, so the allocator outlives every buffer it handed out
+        struct KeepAlive
+        {
+            std::shared_ptr<const ImageBufferPool> pool; ///< Pool the buffer returns to
+            size_t node = 0;                             ///< NUMA node the buffer was first touched on
+        };
+
+        // Node of the calling thread; unbound threads share node 0
+        size_t CurrentNode()
+        {
+            return CpuTopology::GetCurrentNode().value_or(0);
+        }
+    } // namespace
+
+    ImageBufferPool::ImageBufferPool(size_t idleByteBudget) : idleByteBudget(idleByteBudget)
+    {
+    }
+
+    ImageBufferPool::~ImageBufferPool()
+    {
+        Clear();
+    }
+
+    cv::Mat ImageBufferPool::CreateImage()
+    {
+        cv::Mat image;
+        image.allocator = this;
+        return image;
+    }
+
+    size_t ImageBufferPool::Reserve(size_t bytes, size_t count)
+    {
+        std::scoped_lock lock(mutex);
+        auto &idleBuffers = IdleBuffersOf(CurrentNode());
+        auto &buffers = idleBuffers[bytes];
+        size_t added = 0;
+        while (buffers.size() < count && stats.idleBytes + bytes <= idleByteBudget)
+        {
+            buffers.push_back(cv::fastMalloc(bytes));
+            ++added;
+            ++stats.allocated;
+            ++stats.idleBuffers;
+            stats.idleBytes += bytes;
+        }
+        if (buffers.empty())
+        {
+            idleBuffers.erase(bytes);
+        }
+        return added;
+    }
+
+    void ImageBufferPool::SetIdleByteBudget(size_t newIdleByteBudget)
+    {
+        std::scoped_lock lock(mutex);
+        idleByteBudget = newIdleByteBudget;
+        TrimToBudget();
+    }
+
+    size_t ImageBufferPool::GetIdleByteBudget() const
+    {
+        std::scoped_lock lock(mutex);
+        return idleByteBudget;
+    }
+
+    ImageBufferPool::Statistics ImageBufferPool::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void ImageBufferPool::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        for (auto &idleBuffers : idleBuffersByNode)
+        {
+            for (auto &[bytes, buffers] : idleBuffers)
+            {
+                for (void *buffer : buffers)
+                {
+                    cv::fastFree(buffer);
+                }
+            }
+        }
+        idleBuffersByNode.clear();
+        stats = Statistics{};
+    }
+
+    // Same layout as OpenCV's default allocator, with the buffer taken from the idle list when one fits
+    cv::UMatData *ImageBufferPool::allocate(int dims,
+        const int *sizes,
+        int type,
+        void *data,
+        size_t *step,
+        [[maybe_unused]] cv::AccessFlag flags,
+        [[maybe_unused]] cv::UMatUsageFlags usageFlags) const
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; --i)
+        {
+            if (step)
+            {
+                if (data && step[i] != CV_AUTOSTEP)
+                {
+                    total = step[i];
+                }
+                else
+                {
+                    step[i] = total;
+                }
+            }
+            total *= static_cast<size_t>(sizes[i]);
+        }
+
+        void *buffer = data;
+        const size_t node = CurrentNode();
+        if (!buffer)
+        {
+            std::scoped_lock lock(mutex);
+            auto &idleBuffers = IdleBuffersOf(node);
+            if (auto found = idleBuffers.find(total); found != idleBuffers.end() && !found->second.empty())
+            {
+                buffer = found->second.back();
+                found->second.pop_back();
+                --stats.idleBuffers;
+                stats.idleBytes -= total;
+                ++stats.reused;
+            }
+            else
+            {
+                ++stats.allocated;
+            }
+        }
+        if (!buffer)
+        {
+            buffer = cv::fastMalloc(total);
+        }
+
+        auto *u = new cv::UMatData(this);
+        u->data = u->origdata = static_cast<uchar *>(buffer);
+        u->size = total;
+        u->userdata = new KeepAlive{ .pool = shared_from_this(), .node = node };
+        if (data)
+        {
+            u->flags |= cv::UMatData::USER_ALLOCATED;
+        }
+        return u;
+    }
+
+    bool ImageBufferPool::allocate(cv::UMatData *data,
+        [[maybe_unused]] cv::AccessFlag accessFlags,
+        [[maybe_unused]] cv::UMatUsageFlags usageFlags) const
+    {
+        return data != nullptr;
+    }
+
+    void ImageBufferPool::deallocate(cv::UMatData *u) const
+    {
+        if (!u)
+        {
+            return;
+        }
+
+        // Released last: dropping it may destroy this pool
+        std::unique_ptr<KeepAlive> keepAlive(static_cast<KeepAlive *>(u->userdata));
+        if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+        {
+            std::scoped_lock lock(mutex);
+            if (stats.idleBytes + u->size <= idleByteBudget)
+            {
+                IdleBuffersOf(keepAlive->node)[u->size].push_back(u->origdata);
+                ++stats.idleBuffers;
+                stats.idleBytes += u->size;
+            }
+            else
+            {
+                cv::fastFree(u->origdata);
+            }
+            u->origdata = nullptr;
+        }
+        delete u;
+    }
+
+    void ImageBufferPool::TrimToBudget() const
+    {
+        for (auto &idleBuffers : idleBuffersByNode)
+        {
+            for (auto it = idleBuffers.begin(); it != idleBuffers.end() && stats.idleBytes > idleByteBudget;)
+            {
+                auto &[bytes, buffers] = *it;
+                while (!buffers.empty() && stats.idleBytes > idleByteBudget)
+                {
+                    cv::fastFree(buffers.back());
+                    buffers.pop_back();
+                    --stats.idleBuffers;
+                    stats.idleBytes -= bytes;
+                }
+                it = buffers.empty() ? idleBuffers.erase(it) : std::next(it);
+            }
+        }
+    }
+
+    ImageBufferPool::IdleBuffers &ImageBufferPool::IdleBuffersOf(size_t node) const
+    {
+        if (node >= idleBuffersByNode.size())
+        {
+            idleBuffersByNode.resize(node + 1);
+        }
+        return idleBuffersByNode[node];
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Recycles the pixel buffers of node output images across runs and frames.
+     *
+     * Plugged into OpenCV as a cv::MatAllocator: a cv::Mat from CreateImage() allocates through the pool
+     * when an OpenCV function first writes to it, and its buffer returns to the pool when the last cv::Mat
+     * sharing it is released. The next allocation of the same byte size reuses the buffer instead of
+     * calling malloc and faulting fresh pages in.
+     *
+     * Idle buffers are kept up to a byte budget; buffers returned beyond it are freed. Images may outlive
+     * the pool handle: every live buffer keeps the pool alive until it is released.
+     *
+     * Buffers remember the NUMA node of the thread that allocated them (see CpuTopology::BindCurrentThread()),
+     * where their pages were first touched, and are only reused by threads on that node. Unbound threads all
+     * count as node 0, so single-socket machines see one shared idle list.
+     *
+     * All methods are thread-safe; images may be released from any thread.
+     */
+    class ImageBufferPool : public cv::MatAllocator, public std::enable_shared_from_this<ImageBufferPool>
+    {
+    public:
+        /**
+         * @brief Pool counters.
+         */
+        struct Statistics
+        {
+            size_t reused = 0;      ///< Allocations served from an idle buffer
+            size_t allocated = 0;   ///< Allocations that needed fresh memory
+            size_t idleBuffers = 0; ///< Buffers waiting for reuse
+            size_t idleBytes = 0;   ///< Memory held by idle buffers
+        };
+
+        /**
+         * @brief Constructs pool.
+         * @param idleByteBudget Maximum bytes kept in idle buffers (0 disables reuse)
+         * @note Must be owned by a std::shared_ptr before CreateImage() is called.
+         */
+        explicit ImageBufferPool(size_t idleByteBudget);
+
+        /**
+         * @brief Frees idle buffers.
+         */
+        ~ImageBufferPool() override;
+
+        ImageBufferPool(const ImageBufferPool &) = delete;
+        ImageBufferPool &operator=(const ImageBufferPool &) = delete;
+
+        /**
+         * @brief Returns an empty image that allocates from this pool.
+         * @return cv::Mat to pass as an OpenCV output argument (or to create())
+         * @note Assigning another cv::Mat to it replaces the allocator; let OpenCV write into it instead.
+         */
+        [[nodiscard]] cv::Mat CreateImage();
+
+        /**
+         * @brief Allocates idle buffers ahead of the images that will need them.
+         * @param bytes Buffer size (image rows times step)
+         * @param count Idle buffers of that size to have
+         * @return Buffers allocated; fewer than requested once the idle byte budget is reached
+         * @note Buffers go to the calling thread's NUMA node; call it from a thread on the node that will use them.
+         */
+        size_t Reserve(size_t bytes, size_t count);
+
+        /**
+         * @brief Changes idle byte budget, freeing idle buffers if needed.
+         * @param idleByteBudget New budget in bytes
+         */
+        void SetIdleByteBudget(size_t idleByteBudget);
+
+        /**
+         * @brief Returns idle byte budget.
+         * @return Budget in bytes
+         */
+        [[nodiscard]] size_t GetIdleByteBudget() const;
+
+        /**
+         * @brief Returns pool counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        /**
+         * @brief Frees idle buffers and resets counters; buffers in use return to the pool as usual.
+         */
+        void Clear();
+
+        // cv::MatAllocator interface
+        cv::UMatData *allocate(int dims,
+            const int *sizes,
+            int type,
+            void *data,
+            size_t *step,
+            cv::AccessFlag flags,
+            cv::UMatUsageFlags usageFlags) const override;
+        bool allocate(cv::UMatData *data, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override;
+        void deallocate(cv::UMatData *data) const override;
+
+    private:
+        /**
+         * @brief Idle buffers of one NUMA node, by byte size.
+         */
+        using IdleBuffers = std::unordered_map<size_t, std::vector<void *>>;
+
+        /**
+         * @brief Frees idle buffers until they fit in the budget.
+         * @note Caller must hold mutex.
+         */
+        void TrimToBudget() const;
+
+        /**
+         * @brief Returns the idle buffers of a NUMA node, adding the node on first use.
+         * @param node Node index
+         * @return Idle buffers by byte size
+         * @note Caller must hold mutex.
+         */
+        IdleBuffers &IdleBuffersOf(size_t node) const;
+
+        mutable std::mutex mutex;                           ///< Guards all state below
+        mutable std::vector<IdleBuffers> idleBuffersByNode; ///< Idle buffers by NUMA node, then byte size
+        mutable Statistics stats;                           ///< Counters and idle totals
+        size_t idleByteBudget;                              ///< Maximum bytes kept idle
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,166 @@
+#include "Nodes/Core/ImagePyramid.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    ImagePyramid::ImagePyramid(cv::Mat base, Filter filter)
+    {
+        if (base.empty())
+        {
+            return;
+        }
+        levels = std::make_shared<Levels>();
+        levels->built.push_back(std::move(base));
+        levels->filter = filter;
+    }
+
+    bool ImagePyramid::IsEmpty() const
+    {
+        return !levels;
+    }
+
+    cv::Mat ImagePyramid::GetBase() const
+    {
+        if (!levels)
+        {
+            return {};
+        }
+        std::scoped_lock lock(levels->mutex);
+        return levels->built.front();
+    }
+
+    ImagePyramid::Filter ImagePyramid::GetFilter() const
+    {
+        return levels ? levels->filter : Filter::Gaussian;
+    }
+
+    size_t ImagePyramid::GetLevelCount() const
+    {
+        if (!levels)
+        {
+            return 0;
+        }
+        cv::Size size = GetBase().size();
+        size_t count = 1;
+        while (size.width > 1 || size.height > 1)
+        {
+            size = GetLevelSize(size, 1);
+            ++count;
+        }
+        return count;
+    }
+
+    cv::Size ImagePyramid::GetLevelSize(const cv::Size &base, size_t level)
+    {
+        cv::Size size = base;
+        for (size_t k = 0; k < level; ++k)
+        {
+            size = cv::Size((size.width + 1) / 2, (size.height + 1) / 2); // cv::pyrDown's default size
+        }
+        return size;
+    }
+
+    cv::Mat ImagePyramid::GetLevel(size_t level) const
+    {
+        if (level >= GetLevelCount())
+        {
+            throw std::out_of_range("pyramid level " + std::to_string(level) + " does not exist");
+        }
+
+        std::scoped_lock lock(levels->mutex);
+        auto &built = levels->built;
+        if (level < built.size())
+        {
+            return built[level];
+        }
+
+        TraceScope trace("pyramid", "Build levels");
+        while (built.size() <= level)
+        {
+            const cv::Mat &above = built.back();
+            cv::Mat next;
+            if (levels->filter == Filter::Gaussian)
+            {
+                cv::pyrDown(above, next);
+            }
+            else
+            {
+                cv::resize(above, next, GetLevelSize(above.size(), 1), 0.0, 0.0, cv::INTER_AREA);
+            }
+            built.push_back(std::move(next));
+        }
+        return built[level];
+    }
+
+    size_t ImagePyramid::SelectLevel(const cv::Size &size) const
+    {
+        if (!levels)
+        {
+            return 0;
+        }
+        const cv::Size base = GetBase().size();
+        const size_t count = GetLevelCount();
+        size_t level = 0;
+        while (level + 1 < count)
+        {
+            const cv::Size next = GetLevelSize(base, level + 1);
+            if (next.width < size.width || next.height < size.height)
+            {
+                break;
+            }
+            ++level;
+        }
+        return level;
+    }
+
+    cv::Mat ImagePyramid::Sample(const cv::Size &size, int interpolation) const
+    {
+        if (!levels)
+        {
+            throw std::out_of_range("cannot sample an empty pyramid");
+        }
+        const cv::Mat level = GetLevel(SelectLevel(size));
+        if (level.size() == size)
+        {
+            return level;
+        }
+        cv::Mat sampled;
+        cv::resize(level, sampled, size, 0.0, 0.0, interpolation);
+        return sampled;
+    }
+
+    size_t ImagePyramid::GetBuiltLevelCount() const
+    {
+        if (!levels)
+        {
+            return 0;
+        }
+        std::scoped_lock lock(levels->mutex);
+        return levels->built.size();
+    }
+
+    size_t ImagePyramid::GetByteSize() const
+    {
+        if (!levels)
+        {
+            return 0;
+        }
+        std::scoped_lock lock(levels->mutex);
+        size_t bytes = 0;
+        for (const auto &level : levels->built)
+        {
+            bytes += level.total() * level.elemSize();
+        }
+        return bytes;
+    }
+
+    ImagePyramid ImagePyramid::Clone() const
+    {
+        return levels ? ImagePyramid(GetBase().clone(), levels->filter) : ImagePyramid();
+    }
+
+} // namespace VisionCraft::Nodes
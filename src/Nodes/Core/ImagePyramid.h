@@ -0,0 +1,132 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Image with successively halved levels, built lazily and shared by every reader.
+     *
+     * Level 0 is the image itself; level k + 1 halves level k, rounding up, until the image is 1x1. A level
+     * is built from the one above it the first time someone asks for it or for a coarser one, so a consumer
+     * that only needs a quarter-size image pays for two halvings, and the next consumer asking for an
+     * eighth pays for one more. Copies share the levels, so thumbnails, proxy runs and coarse-to-fine nodes
+     * reading one pyramid never resize the same image twice.
+     *
+     * All methods are thread-safe; threads asking for a level another thread is building wait for it.
+     */
+    class ImagePyramid
+    {
+    public:
+        /**
+         * @brief How each level is reduced from the one above it.
+         */
+        enum class Filter
+        {
+            Gaussian, ///< cv::pyrDown: 5x5 Gaussian, then every other pixel
+            Area      ///< cv::INTER_AREA: mean of each 2x2 block (matches a direct INTER_AREA downscale)
+        };
+
+        ImagePyramid() = default;
+
+        /**
+         * @brief Wraps an image as level 0 without building any other level.
+         * @param base Full-resolution image (shared, not copied)
+         * @param filter Reduction used for every further level
+         */
+        explicit ImagePyramid(cv::Mat base, Filter filter = Filter::Gaussian);
+
+        /**
+         * @brief Returns whether the pyramid has no image.
+         * @return True if level 0 is empty
+         */
+        [[nodiscard]] bool IsEmpty() const;
+
+        /**
+         * @brief Returns the full-resolution image.
+         * @return Level 0 (empty for an empty pyramid)
+         */
+        [[nodiscard]] cv::Mat GetBase() const;
+
+        /**
+         * @brief Returns the reduction used between levels.
+         * @return Filter
+         */
+        [[nodiscard]] Filter GetFilter() const;
+
+        /**
+         * @brief Returns the number of levels down to 1x1, built or not.
+         * @return Level count (0 for an empty pyramid)
+         */
+        [[nodiscard]] size_t GetLevelCount() const;
+
+        /**
+         * @brief Returns the size of one level without building it.
+         * @param base Size of level 0
+         * @param level Level index
+         * @return Size of that level
+         */
+        [[nodiscard]] static cv::Size GetLevelSize(const cv::Size &base, size_t level);
+
+        /**
+         * @brief Returns one level, building it and the levels above it that are missing.
+         * @param level Level index (below GetLevelCount())
+         * @return Level image (shared with the pyramid; do not write to it)
+         * @throws std::out_of_range if the level does not exist
+         */
+        [[nodiscard]] cv::Mat GetLevel(size_t level) const;
+
+        /**
+         * @brief Returns the coarsest level at least as large as a size in both dimensions.
+         * @param size Size the caller will sample
+         * @return Level index (0 if even level 0 is smaller)
+         */
+        [[nodiscard]] size_t SelectLevel(const cv::Size &size) const;
+
+        /**
+         * @brief Returns the image at an arbitrary size, resampled from the nearest level above it.
+         * @param size Output size
+         * @param interpolation cv::resize flag used from the selected level to @p size
+         * @return Image of @p size (a level itself, shared, when the size matches one exactly)
+         * @throws std::out_of_range if the pyramid is empty
+         */
+        [[nodiscard]] cv::Mat Sample(const cv::Size &size, int interpolation = cv::INTER_AREA) const;
+
+        /**
+         * @brief Returns the number of levels built so far.
+         * @return Built level count, including level 0
+         */
+        [[nodiscard]] size_t GetBuiltLevelCount() const;
+
+        /**
+         * @brief Returns the pixel bytes of the levels built so far.
+         * @return Sum of built level sizes in bytes
+         */
+        [[nodiscard]] size_t GetByteSize() const;
+
+        /**
+         * @brief Returns a pyramid over a deep copy of level 0 that shares nothing with this one.
+         * @return Copy with only level 0 built
+         */
+        [[nodiscard]] ImagePyramid Clone() const;
+
+    private:
+        /**
+         * @brief Levels shared by every copy of a pyramid.
+         */
+        struct Levels
+        {
+            std::mutex mutex;                 ///< Guards built
+            std::vector<cv::Mat> built;       ///< Levels built so far, level 0 first
+            Filter filter = Filter::Gaussian; ///< Reduction between levels
+        };
+
+        std::shared_ptr<Levels> levels; ///< Null for an empty pyramid
+    };
+
+} // namespace VisionCraft::Nodes
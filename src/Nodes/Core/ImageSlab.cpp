@@ -0,0 +1,137 @@
+#include "Nodes/Core/ImageSlab.h"
+
+#include <algorithm>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Held in UMatData::userdata, so the slab outlives every image placed in it
+        using KeepAlive = std::shared_ptr<const ImageSlab>;
+    } // namespace
+
+    ImageSlab::ImageSlab(const MemoryPlan &plan, std::shared_ptr<ImageBufferPool> fallback)
+        : memory(static_cast<uchar *>(cv::fastMalloc(std::max<size_t>(plan.slabBytes, 1)))), bytes(plan.slabBytes),
+          fallback(std::move(fallback))
+    {
+        for (const auto &[id, placement] : plan.placements)
+        {
+            placements.emplace(id, std::make_unique<Placement>(*this, placement));
+        }
+    }
+
+    ImageSlab::~ImageSlab()
+    {
+        cv::fastFree(memory);
+    }
+
+    std::shared_ptr<cv::MatAllocator> ImageSlab::GetAllocator(NodeId id)
+    {
+        const auto found = placements.find(id);
+        if (found == placements.end())
+        {
+            return nullptr;
+        }
+        return std::shared_ptr<cv::MatAllocator>(shared_from_this(), found->second.get());
+    }
+
+    size_t ImageSlab::GetBytes() const
+    {
+        return bytes;
+    }
+
+    ImageSlab::Statistics ImageSlab::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    bool ImageSlab::Claim(size_t offset, size_t length)
+    {
+        std::scoped_lock lock(mutex);
+        const bool overlaps = std::ranges::any_of(
+            live, [&](const auto &range) { return range.first < offset + length && offset < range.second; });
+        if (overlaps)
+        {
+            ++stats.fellBack;
+            return false;
+        }
+        live.emplace_back(offset, offset + length);
+        ++stats.placed;
+        return true;
+    }
+
+    void ImageSlab::Release(size_t offset)
+    {
+        std::scoped_lock lock(mutex);
+        if (const auto found = std::ranges::find(live, offset, &std::pair<size_t, size_t>::first); found != live.end())
+        {
+            *found = live.back();
+            live.pop_back();
+        }
+    }
+
+    ImageSlab::Placement::Placement(ImageSlab &slab, BufferPlacement placement) : slab(slab), placement(placement)
+    {
+    }
+
+    // Same layout as OpenCV's default allocator, with the buffer at the planned offset when it fits and is free
+    cv::UMatData *ImageSlab::Placement::allocate(int dims,
+        const int *sizes,
+        int type,
+        void *data,
+        size_t *step,
+        cv::AccessFlag flags,
+        cv::UMatUsageFlags usageFlags) const
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; --i)
+        {
+            total *= static_cast<size_t>(sizes[i]);
+        }
+
+        if (data || total > placement.bytes || !slab.Claim(placement.offset, total))
+        {
+            cv::MatAllocator *other = slab.fallback ? slab.fallback.get() : cv::Mat::getDefaultAllocator();
+            return other->allocate(dims, sizes, type, data, step, flags, usageFlags);
+        }
+
+        if (step)
+        {
+            size_t stride = CV_ELEM_SIZE(type);
+            for (int i = dims - 1; i >= 0; --i)
+            {
+                step[i] = stride;
+                stride *= static_cast<size_t>(sizes[i]);
+            }
+        }
+
+        auto *u = new cv::UMatData(this);
+        u->data = u->origdata = slab.memory + placement.offset;
+        u->size = total;
+        u->userdata = new KeepAlive(slab.shared_from_this());
+        return u;
+    }
+
+    bool ImageSlab::Placement::allocate(cv::UMatData *data,
+        [[maybe_unused]] cv::AccessFlag accessFlags,
+        [[maybe_unused]] cv::UMatUsageFlags usageFlags) const
+    {
+        return data != nullptr;
+    }
+
+    void ImageSlab::Placement::deallocate(cv::UMatData *u) const
+    {
+        if (!u)
+        {
+            return;
+        }
+
+        // Released last: dropping it may destroy the slab and this placement
+        std::unique_ptr<KeepAlive> keepAlive(static_cast<KeepAlive *>(u->userdata));
+        slab.Release(placement.offset);
+        u->origdata = nullptr;
+        delete u;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/MemoryPlanner.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief One preallocated buffer that a MemoryPlan's images are placed in.
+     *
+     * Each planned node gets an allocator (see Node::SetOutputAllocator()) that places its output image at
+     * the node's offset instead of allocating. The plan assumes the editor's sequential step order, so the
+     * slab checks every placement at run time: an image larger than planned, or one whose range is still
+     * held by a live image (a parallel run, a cached or previewed output, a second output image), goes to
+     * the fallback pool instead. Planned memory is thus never overwritten while in use.
+     *
+     * Images may outlive the slab handle: every placed image keeps the slab alive until it is released.
+     * All methods are thread-safe.
+     */
+    class ImageSlab : public std::enable_shared_from_this<ImageSlab>
+    {
+    public:
+        /**
+         * @brief Placement counters.
+         */
+        struct Statistics
+        {
+            size_t placed = 0;   ///< Images written into the slab
+            size_t fellBack = 0; ///< Planned images that went to the fallback pool
+        };
+
+        /**
+         * @brief Allocates the slab.
+         * @param plan Placements and slab size
+         * @param fallback Pool for images that cannot be placed (nullptr = OpenCV's default allocator)
+         * @note Must be owned by a std::shared_ptr before GetAllocator() is called.
+         */
+        ImageSlab(const MemoryPlan &plan, std::shared_ptr<ImageBufferPool> fallback);
+
+        /**
+         * @brief Frees the slab.
+         */
+        ~ImageSlab();
+
+        ImageSlab(const ImageSlab &) = delete;
+        ImageSlab &operator=(const ImageSlab &) = delete;
+
+        /**
+         * @brief Returns the allocator placing a node's output image.
+         * @param id Node ID
+         * @return Allocator keeping the slab alive, or nullptr if the node is not in the plan
+         */
+        [[nodiscard]] std::shared_ptr<cv::MatAllocator> GetAllocator(NodeId id);
+
+        /**
+         * @brief Returns the slab size.
+         * @return Bytes allocated up front
+         */
+        [[nodiscard]] size_t GetBytes() const;
+
+        /**
+         * @brief Returns placement counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        /**
+         * @brief cv::MatAllocator placing images at one node's offset.
+         */
+        class Placement : public cv::MatAllocator
+        {
+        public:
+            Placement(ImageSlab &slab, BufferPlacement placement);
+
+            // cv::MatAllocator interface
+            cv::UMatData *allocate(int dims,
+                const int *sizes,
+                int type,
+                void *data,
+                size_t *step,
+                cv::AccessFlag flags,
+                cv::UMatUsageFlags usageFlags) const override;
+            bool allocate(cv::UMatData *data, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override;
+            void deallocate(cv::UMatData *data) const override;
+
+        private:
+            ImageSlab &slab;           ///< Slab the placement is in
+            BufferPlacement placement; ///< Offset and reserved bytes
+        };
+
+        /**
+         * @brief Marks a range as held, unless a live image overlaps it.
+         * @param offset Start of the range
+         * @param length Length of the range
+         * @return True if the range was free
+         */
+        bool Claim(size_t offset, size_t length);
+
+        /**
+         * @brief Frees a range claimed by Claim().
+         * @param offset Start of the range
+         */
+        void Release(size_t offset);
+
+        uchar *memory = nullptr;                                           ///< Slab buffer
+        size_t bytes = 0;                                                  ///< Size of memory
+        std::shared_ptr<ImageBufferPool> fallback;                         ///< Pool for unplaceable images
+        std::unordered_map<NodeId, std::unique_ptr<Placement>> placements; ///< Allocator of each planned node
+
+        mutable std::mutex mutex;                    ///< Guards the members below
+        std::vector<std::pair<size_t, size_t>> live; ///< Held ranges (start, end)
+        Statistics stats;                            ///< Counters
+    };
+
+} // namespace VisionCraft::Nodes
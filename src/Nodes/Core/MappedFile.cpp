@@ -0,0 +1,240 @@
+#include "Nodes/Core/MappedFile.h"
+#include "Logger.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace VisionCraft::Nodes
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)),
+          open(std::exchange(other.open, false)), writable(std::exchange(other.writable, false))
+    {
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Close();
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+            open = std::exchange(other.open, false);
+            writable = std::exchange(other.writable, false);
+        }
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::filesystem::path &filepath, bool copyOnWrite)
+    {
+        Close();
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(filepath.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            FILE_FLAG_SEQUENTIAL_SCAN,
+            nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            LOG_ERROR("Failed to open file for reading: {}", filepath.string());
+            return false;
+        }
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            LOG_ERROR("Failed to query size of file: {}", filepath.string());
+            return false;
+        }
+
+        if (fileSize.QuadPart > 0)
+        {
+            // The view keeps the mapping object and file alive, so both handles can be closed right away
+            HANDLE mapping =
+                CreateFileMappingW(file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+            void *view = mapping ? MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0)
+                                 : nullptr;
+            if (mapping)
+            {
+                CloseHandle(mapping);
+            }
+            if (!view)
+            {
+                CloseHandle(file);
+                LOG_ERROR("Failed to map file: {}", filepath.string());
+                return false;
+            }
+            data = static_cast<std::byte *>(view);
+            size = static_cast<size_t>(fileSize.QuadPart);
+        }
+        CloseHandle(file);
+#else
+        const int file = ::open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            LOG_ERROR("Failed to open file for reading: {}", filepath.string());
+            return false;
+        }
+
+        struct stat status{};
+        if (fstat(file, &status) != 0)
+        {
+            ::close(file);
+            LOG_ERROR("Failed to query size of file: {}", filepath.string());
+            return false;
+        }
+
+        if (status.st_size > 0)
+        {
+            // The mapping keeps its own reference to the file, so the descriptor can be closed right away
+            const int protection = copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+            void *view = mmap(nullptr, static_cast<size_t>(status.st_size), protection, MAP_PRIVATE, file, 0);
+            if (view == MAP_FAILED)
+            {
+                ::close(file);
+                LOG_ERROR("Failed to map file: {}", filepath.string());
+                return false;
+            }
+            data = static_cast<std::byte *>(view);
+            size = static_cast<size_t>(status.st_size);
+        }
+        ::close(file);
+#endif
+
+        open = true;
+        writable = copyOnWrite;
+        return true;
+    }
+
+    bool MappedFile::Create(const std::filesystem::path &filepath, size_t fileSize)
+    {
+        Close();
+        if (fileSize == 0)
+        {
+            LOG_ERROR("Cannot map an empty file for writing: {}", filepath.string());
+            return false;
+        }
+
+#if defined(_WIN32)
+        HANDLE file = CreateFileW(filepath.c_str(),
+            GENERIC_READ | GENERIC_WRITE,
+            0,
+            nullptr,
+            CREATE_ALWAYS,
+            FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            LOG_ERROR("Failed to open file for writing: {}", filepath.string());
+            return false;
+        }
+
+        // Creating the mapping with an explicit size extends the file to that size
+        const auto size64 = static_cast<uint64_t>(fileSize);
+        HANDLE mapping = CreateFileMappingW(file,
+            nullptr,
+            PAGE_READWRITE,
+            static_cast<DWORD>(size64 >> 32),
+            static_cast<DWORD>(size64 & 0xFFFFFFFFu),
+            nullptr);
+        void *view = mapping ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        if (!view)
+        {
+            LOG_ERROR("Failed to map file for writing: {}", filepath.string());
+            return false;
+        }
+#else
+        const int file = ::open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (file < 0)
+        {
+            LOG_ERROR("Failed to open file for writing: {}", filepath.string());
+            return false;
+        }
+
+        if (ftruncate(file, static_cast<off_t>(fileSize)) != 0)
+        {
+            ::close(file);
+            LOG_ERROR("Failed to resize file: {}", filepath.string());
+            return false;
+        }
+
+        void *view = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        ::close(file);
+        if (view == MAP_FAILED)
+        {
+            LOG_ERROR("Failed to map file for writing: {}", filepath.string());
+            return false;
+        }
+#endif
+
+        data = static_cast<std::byte *>(view);
+        size = fileSize;
+        open = true;
+        writable = true;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (data)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data);
+#else
+            munmap(data, size);
+#endif
+        }
+        data = nullptr;
+        size = 0;
+        open = false;
+        writable = false;
+    }
+
+    bool MappedFile::IsOpen() const
+    {
+        return open;
+    }
+
+    std::span<const std::byte> MappedFile::GetBytes() const
+    {
+        return { data, size };
+    }
+
+    std::span<std::byte> MappedFile::GetWritableBytes()
+    {
+        if (!writable)
+        {
+            return {};
+        }
+        return { data, size };
+    }
+
+} // namespace VisionCraft::Nodes
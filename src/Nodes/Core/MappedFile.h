@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Memory mapping of a whole file, read-only (Open()) or freshly created for writing (Create()).
+     *
+     * Loaders read records straight out of the page cache instead of copying the file into a stream buffer
+     * first; pages are faulted in only as they are touched. Writers fill the mapped pages directly and
+     * leave write-back to the OS. The mapping stays valid until Close(), the destructor, or a move; views
+     * into GetBytes() must not outlive it.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        /**
+         * @brief Maps file for reading, replacing any current mapping.
+         * @param filepath File to map
+         * @param copyOnWrite Also allow writes to the mapping; they go to private page copies, never to the file
+         * @return True if mapped (an empty file maps to an empty span)
+         */
+        bool Open(const std::filesystem::path &filepath, bool copyOnWrite = false);
+
+        /**
+         * @brief Creates (or truncates) file of the given size and maps it for writing.
+         * @param filepath File to create
+         * @param size File size in bytes (must be non-zero)
+         * @return True if mapped; GetWritableBytes() then covers the whole file
+         * @note Contents reach the file once written to the mapping; Close() before renaming or reopening it.
+         */
+        bool Create(const std::filesystem::path &filepath, size_t size);
+
+        /**
+         * @brief Unmaps the file; GetBytes() is empty afterwards.
+         */
+        void Close();
+
+        /**
+         * @brief Checks if a file is mapped.
+         * @return True after a successful Open() or Create()
+         */
+        [[nodiscard]] bool IsOpen() const;
+
+        /**
+         * @brief Returns mapped contents.
+         * @return Whole file, valid while the mapping is open
+         */
+        [[nodiscard]] std::span<const std::byte> GetBytes() const;
+
+        /**
+         * @brief Returns mapped contents for writing.
+         * @return Whole file after Create() or a copy-on-write Open(), empty for read-only mappings
+         */
+        [[nodiscard]] std::span<std::byte> GetWritableBytes();
+
+    private:
+        std::byte *data = nullptr; ///< Start of mapping (nullptr for an empty file)
+        size_t size = 0;           ///< Mapped bytes
+        bool open = false;         ///< Open() or Create() succeeded
+        bool writable = false;     ///< Mapped by Create() or copy-on-write
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,190 @@
+#include "Nodes/Core/MemoryBudget.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <random>
+#include <system_error>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Removes a spill directory along with any files left in it
+        void RemoveSpillDirectory(const std::shared_ptr<PersistentOutputStore> &store)
+        {
+            if (!store)
+            {
+                return;
+            }
+            std::error_code error;
+            std::filesystem::remove_all(store->GetDirectory(), error);
+            if (error)
+            {
+                LOG_WARN("Failed to remove spill directory {}: {}", store->GetDirectory().string(), error.message());
+            }
+        }
+    } // namespace
+
+    MemoryBudget &MemoryBudget::Get()
+    {
+        static MemoryBudget budget;
+        return budget;
+    }
+
+    MemoryBudget::~MemoryBudget()
+    {
+        RemoveSpillDirectory(store);
+    }
+
+    void MemoryBudget::SetLimit(size_t bytes)
+    {
+        limit.store(bytes, std::memory_order_relaxed);
+        if (bytes > 0)
+        {
+            LOG_INFO("Memory budget set to {} MB", bytes / (1024 * 1024));
+        }
+    }
+
+    void MemoryBudget::SetScratchDirectory(std::filesystem::path directory)
+    {
+        std::scoped_lock lock(mutex);
+        scratchDirectory = std::move(directory);
+    }
+
+    std::filesystem::path MemoryBudget::GetScratchDirectory() const
+    {
+        std::scoped_lock lock(mutex);
+        return scratchDirectory;
+    }
+
+    size_t MemoryBudget::UpdateUsage(size_t previous, size_t current)
+    {
+        // Wraps around modulo 2^64 in between, but every graph only ever removes what it added
+        if (current >= previous)
+        {
+            return usedBytes.fetch_add(current - previous, std::memory_order_relaxed) + (current - previous);
+        }
+        return usedBytes.fetch_sub(previous - current, std::memory_order_relaxed) - (previous - current);
+    }
+
+    size_t MemoryBudget::GetUsedBytes() const
+    {
+        return usedBytes.load(std::memory_order_relaxed);
+    }
+
+    std::optional<uint64_t> MemoryBudget::Spill(const std::vector<std::shared_ptr<const NodeData>> &outputs,
+        size_t bytes)
+    {
+        std::shared_ptr<PersistentOutputStore> target;
+        uint64_t ticket = 0;
+        {
+            std::scoped_lock lock(mutex);
+            target = OpenStore() ? store : nullptr;
+            ticket = nextTicket++;
+            ++spillsOnDisk;
+        }
+
+        // Written outside the lock, so workers spilling at once write their files in parallel
+        const bool saved = target && target->Save(ticket, outputs);
+
+        std::scoped_lock lock(mutex);
+        if (!saved)
+        {
+            --spillsOnDisk;
+            ++stats.failures;
+            return std::nullopt;
+        }
+        ++stats.spills;
+        stats.spilledBytes += bytes;
+        return ticket;
+    }
+
+    std::optional<std::vector<std::shared_ptr<const NodeData>>> MemoryBudget::Restore(uint64_t ticket)
+    {
+        std::shared_ptr<PersistentOutputStore> source;
+        {
+            std::scoped_lock lock(mutex);
+            source = store;
+        }
+
+        auto outputs = source ? source->Load(ticket) : std::nullopt;
+        if (source)
+        {
+            source->Erase(ticket);
+        }
+
+        std::scoped_lock lock(mutex);
+        --spillsOnDisk;
+        ++(outputs ? stats.restores : stats.failures);
+        return outputs;
+    }
+
+    void MemoryBudget::Discard(uint64_t ticket)
+    {
+        std::shared_ptr<PersistentOutputStore> source;
+        {
+            std::scoped_lock lock(mutex);
+            source = store;
+            --spillsOnDisk;
+        }
+        if (source)
+        {
+            source->Erase(ticket);
+        }
+    }
+
+    void MemoryBudget::RecordCacheTrim(size_t bytes)
+    {
+        std::scoped_lock lock(mutex);
+        stats.cacheTrimBytes += bytes;
+    }
+
+    MemoryBudget::Statistics MemoryBudget::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void MemoryBudget::ResetStatistics()
+    {
+        std::scoped_lock lock(mutex);
+        stats = {};
+    }
+
+    PersistentOutputStore *MemoryBudget::OpenStore()
+    {
+        std::error_code error;
+        const auto parent = scratchDirectory.empty() ? std::filesystem::temp_directory_path(error) : scratchDirectory;
+        if (error)
+        {
+            LOG_ERROR("No scratch directory to spill to: {}", error.message());
+            return nullptr;
+        }
+        if (store && store->GetDirectory().parent_path() == parent
+            && std::filesystem::is_directory(store->GetDirectory(), error))
+        {
+            return store.get();
+        }
+        if (store && spillsOnDisk > 0)
+        {
+            return store.get(); // Moves to the new scratch directory once the current spills are read back
+        }
+
+        // A random name keeps processes sharing a scratch directory apart
+        RemoveSpillDirectory(store);
+        std::mt19937_64 random(std::random_device{}());
+        const auto directory = parent / fmt::format("{}{:016x}", Constants::Spill::kDirectoryPrefix, random());
+        store = std::make_shared<PersistentOutputStore>(directory, Constants::Spill::kScratchBytes);
+        if (!std::filesystem::is_directory(directory))
+        {
+            store.reset();
+            return nullptr;
+        }
+        LOG_INFO("Spilling intermediates to {}", directory.string());
+        return store.get();
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Nodes/Core/NodeData.h"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    class PersistentOutputStore;
+
+    /**
+     * @brief Process-wide byte budget for the slot data and output caches of running graphs, with a scratch
+     *        directory intermediates are spilled to when it is exceeded.
+     *
+     * While intermediate release is on (see NodeEditor::SetIntermediateRelease()), every NodeEditor run reports
+     * the bytes its slots and output cache hold after each step. Once the process total passes the limit, the
+     * editor first trims its output cache (least recently used entries), then spills finished intermediates that
+     * later steps still read, the one needed furthest ahead first, and faults them back in right before their
+     * next consumer pulls its inputs. A graph that branches wide on very large images then slows down instead
+     * of exhausting memory.
+     *
+     * Spills are written uncompressed in the PersistentOutputStore format to a private directory under the
+     * scratch directory, removed again as they are read back, and the directory itself when the process exits.
+     * All methods are thread-safe.
+     */
+    class MemoryBudget
+    {
+    public:
+        /**
+         * @brief Spill counters.
+         */
+        struct Statistics
+        {
+            size_t spills = 0;         ///< Outputs written to the scratch directory
+            size_t restores = 0;       ///< Outputs read back before a consumer ran
+            size_t spilledBytes = 0;   ///< In-memory bytes of spilled outputs
+            size_t failures = 0;       ///< Spills that could not be written or read back
+            size_t cacheTrimBytes = 0; ///< Output cache bytes evicted to stay under the limit
+        };
+
+        /**
+         * @brief Returns the process-wide budget.
+         * @return Budget instance
+         */
+        [[nodiscard]] static MemoryBudget &Get();
+
+        ~MemoryBudget();
+
+        MemoryBudget(const MemoryBudget &) = delete;
+        MemoryBudget &operator=(const MemoryBudget &) = delete;
+
+        /**
+         * @brief Sets the byte limit for slot data and output caches of running graphs.
+         * @param bytes Limit (0 = no limit, nothing is spilled)
+         */
+        void SetLimit(size_t bytes);
+
+        /**
+         * @brief Returns the byte limit.
+         * @return Limit (0 = none)
+         */
+        [[nodiscard]] size_t GetLimit() const
+        {
+            return limit.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Sets the directory spill files are written under.
+         * @param directory Scratch directory (empty = the system temporary directory)
+         * @note Takes effect for spills after the current ones are read back; pick a fast local disk.
+         */
+        void SetScratchDirectory(std::filesystem::path directory);
+
+        /**
+         * @brief Returns the directory spill files are written under.
+         * @return Scratch directory (empty = the system temporary directory)
+         */
+        [[nodiscard]] std::filesystem::path GetScratchDirectory() const;
+
+        /**
+         * @brief Replaces one graph's share of the process total.
+         * @param previous Bytes the graph reported last (0 at the start of a run)
+         * @param current Bytes it holds now
+         * @return Process total after the update
+         */
+        size_t UpdateUsage(size_t previous, size_t current);
+
+        /**
+         * @brief Returns the bytes all running graphs reported.
+         * @return Process total
+         */
+        [[nodiscard]] size_t GetUsedBytes() const;
+
+        /**
+         * @brief Writes outputs to the scratch directory.
+         * @param outputs Values by output SlotIndex (null entries are stored as empty)
+         * @param bytes In-memory size of the values, for the statistics
+         * @return Ticket for Restore() or Discard(), or std::nullopt if they could not be written
+         */
+        [[nodiscard]] std::optional<uint64_t> Spill(const std::vector<std::shared_ptr<const NodeData>> &outputs,
+            size_t bytes);
+
+        /**
+         * @brief Reads spilled outputs back and deletes their file.
+         * @param ticket Ticket returned by Spill()
+         * @return Values by output SlotIndex, or std::nullopt if the file is gone or unreadable
+         */
+        [[nodiscard]] std::optional<std::vector<std::shared_ptr<const NodeData>>> Restore(uint64_t ticket);
+
+        /**
+         * @brief Deletes spilled outputs no consumer will read.
+         * @param ticket Ticket returned by Spill()
+         */
+        void Discard(uint64_t ticket);
+
+        /**
+         * @brief Counts output cache bytes evicted to make room.
+         * @param bytes Bytes evicted
+         */
+        void RecordCacheTrim(size_t bytes);
+
+        /**
+         * @brief Returns spill counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        /**
+         * @brief Resets counters (for tests).
+         */
+        void ResetStatistics();
+
+    private:
+        MemoryBudget() = default;
+
+        /**
+         * @brief Opens the spill store on first use (mutex must be held).
+         * @return Store, or nullptr if the directory cannot be created
+         */
+        PersistentOutputStore *OpenStore();
+
+        std::atomic<size_t> limit = 0;                ///< Byte limit (0 = none)
+        std::atomic<size_t> usedBytes = 0;            ///< Sum of the running graphs' reports
+        mutable std::mutex mutex;                     ///< Guards the members below
+        std::filesystem::path scratchDirectory;       ///< Parent of the spill directory (empty = temporary)
+        std::shared_ptr<PersistentOutputStore> store; ///< Spill files (opened on first spill)
+        size_t spillsOnDisk = 0;                      ///< Spills not yet restored or discarded
+        uint64_t nextTicket = 1;                      ///< Key of the next spill
+        Statistics stats;                             ///< Spill counters
+    };
+
+} // namespace VisionCraft::Nodes
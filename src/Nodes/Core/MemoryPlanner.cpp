@@ -0,0 +1,55 @@
+#include "Nodes/Core/MemoryPlanner.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    MemoryPlan MemoryPlanner::Plan(const std::vector<BufferLifetime> &lifetimes, size_t alignment)
+    {
+        std::vector<size_t> order(lifetimes.size());
+        std::iota(order.begin(), order.end(), size_t{ 0 });
+        std::ranges::stable_sort(order, [&](size_t a, size_t b) { return lifetimes[a].bytes > lifetimes[b].bytes; });
+
+        MemoryPlan plan;
+        std::vector<size_t> placed;
+        std::vector<std::pair<size_t, size_t>> occupied;
+        for (const auto index : order)
+        {
+            const auto &lifetime = lifetimes[index];
+            const size_t bytes = (lifetime.bytes + alignment - 1) & ~(alignment - 1);
+
+            // Ranges taken by images alive during any step of this one, by offset
+            occupied.clear();
+            for (const auto other : placed)
+            {
+                const auto &otherLifetime = lifetimes[other];
+                if (otherLifetime.firstStep <= lifetime.lastStep && lifetime.firstStep <= otherLifetime.lastStep)
+                {
+                    const auto &placement = plan.placements.at(otherLifetime.nodeId);
+                    occupied.emplace_back(placement.offset, placement.offset + placement.bytes);
+                }
+            }
+            std::ranges::sort(occupied);
+
+            // First gap that fits
+            size_t offset = 0;
+            for (const auto &[start, end] : occupied)
+            {
+                if (start >= offset + bytes)
+                {
+                    break;
+                }
+                offset = std::max(offset, end);
+            }
+
+            plan.placements[lifetime.nodeId] = BufferPlacement{ .offset = offset, .bytes = bytes };
+            plan.slabBytes = std::max(plan.slabBytes, offset + bytes);
+            plan.unsharedBytes += bytes;
+            placed.push_back(index);
+        }
+        return plan;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief When one intermediate image exists during a run, in plan steps.
+     */
+    struct BufferLifetime
+    {
+        NodeId nodeId = 0;    ///< Node whose output image this is
+        size_t bytes = 0;     ///< Image size in bytes
+        size_t firstStep = 0; ///< Plan index of the step writing it
+        size_t lastStep = 0;  ///< Plan index of the last step reading it (inclusive)
+    };
+
+    /**
+     * @brief Where one planned image lives in the slab.
+     */
+    struct BufferPlacement
+    {
+        size_t offset = 0; ///< Byte offset into the slab (aligned)
+        size_t bytes = 0;  ///< Bytes reserved at offset
+    };
+
+    /**
+     * @brief Offline assignment of intermediate images to one shared slab.
+     */
+    struct MemoryPlan
+    {
+        std::unordered_map<NodeId, BufferPlacement> placements; ///< Placement of each planned node's output
+        size_t slabBytes = 0;                                   ///< Slab size, the peak of the planned images
+        size_t unsharedBytes = 0;                               ///< Total if every image had its own buffer
+    };
+
+    /**
+     * @brief Packs intermediate images whose lifetimes do not overlap into the same memory.
+     *
+     * Works like a register allocator over the plan's step order: images are placed largest first, each at
+     * the lowest offset that no already placed image alive at the same time occupies. The slab then only
+     * needs the largest set of images alive together (plus fragmentation), instead of the sum of all.
+     */
+    class MemoryPlanner
+    {
+    public:
+        /**
+         * @brief Computes a plan.
+         * @param lifetimes Images to place (sizes and step ranges)
+         * @param alignment Alignment of every offset, a power of two
+         * @return Placements and slab size
+         * @note Quadratic in the number of images; meant to run once when a graph is set up, not per run.
+         */
+        [[nodiscard]] static MemoryPlan Plan(const std::vector<BufferLifetime> &lifetimes, size_t alignment);
+    };
+
+} // namespace VisionCraft::Nodes
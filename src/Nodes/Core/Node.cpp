@@ -1,9 +1,65 @@
 #include "Nodes/Core/Node.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 namespace VisionCraft::Nodes
 {
-    Node::Node(NodeId id, std::string name) : name(std::move(name)), id(id)
+    namespace
+    {
+        // Each node is preceded by the arena it came from (nullptr = heap); keeps the node max-aligned
+        constexpr size_t kArenaHeaderSize = alignof(std::max_align_t);
+        static_assert(kArenaHeaderSize >= sizeof(NodeArena *));
+
+        // Returns the named slot, appending it on first use so indices follow creation order
+        Slot &FindOrAppendSlot(std::pmr::vector<Slot> &slots,
+            SlotNameTable &names,
+            SlotKind kind,
+            const std::string &slotName)
+        {
+            const auto [index, inserted] = names.Insert(kind, slotName, slots.size());
+            if (inserted)
+            {
+                slots.emplace_back();
+            }
+            return slots[index];
+        }
+    } // namespace
+
+    Node::Node(NodeId id, std::string name)
+        : name(std::move(name)), id(id), inputSlots(NodeArena::GetCurrentResource()),
+          outputSlots(NodeArena::GetCurrentResource())
+    {
+    }
+
+    void *Node::operator new(size_t size)
     {
+        auto *arena = NodeArena::GetCurrent();
+        void *block = arena ? arena->allocate(size + kArenaHeaderSize, alignof(std::max_align_t))
+                            : ::operator new(size + kArenaHeaderSize);
+        *static_cast<NodeArena **>(block) = arena;
+        return static_cast<std::byte *>(block) + kArenaHeaderSize;
+    }
+
+    void Node::operator delete(void *pointer, size_t size) noexcept
+    {
+        if (!pointer)
+        {
+            return;
+        }
+        void *block = static_cast<std::byte *>(pointer) - kArenaHeaderSize;
+        if (auto *arena = *static_cast<NodeArena **>(block))
+        {
+            arena->deallocate(block, size + kArenaHeaderSize, alignof(std::max_align_t));
+        }
+        else
+        {
+            ::operator delete(block);
+        }
     }
 
     NodeId Node::GetId() const
@@ -16,6 +72,339 @@ namespace VisionCraft::Nodes
         return name;
     }
 
+    NodeTypeId Node::GetTypeId() const
+    {
+        auto cached = typeId.load(std::memory_order_relaxed);
+        if (cached == kNoNodeTypeId)
+        {
+            cached = NodeTypeRegistry::Intern(GetType());
+            typeId.store(cached, std::memory_order_relaxed);
+        }
+        return cached;
+    }
+
+    bool Node::IsCacheable() const
+    {
+        return true;
+    }
+
+    bool Node::IsStreamSource() const
+    {
+        return false;
+    }
+
+    bool Node::HasStreamEnded() const
+    {
+        return false;
+    }
+
+    bool Node::IsSink() const
+    {
+        return GetOutputSlotCount() == 0;
+    }
+
+    bool Node::BranchesExecution() const
+    {
+        return false;
+    }
+
+    bool Node::IsExecutionOutputTaken([[maybe_unused]] const std::string &pinName) const
+    {
+        return true;
+    }
+
+    std::optional<std::string> Node::GetLoopBodyPin() const
+    {
+        return std::nullopt;
+    }
+
+    LoopElements Node::GetLoopElements() const
+    {
+        return {};
+    }
+
+    void Node::BeginLoopIteration([[maybe_unused]] size_t index,
+        [[maybe_unused]] const std::shared_ptr<const NodeData> &element)
+    {
+    }
+
+    void Node::FinishLoop([[maybe_unused]] std::vector<std::shared_ptr<const NodeData>> results)
+    {
+    }
+
+    std::optional<TileOperation> Node::PrepareTileOperation([[maybe_unused]] int inputType) const
+    {
+        return std::nullopt;
+    }
+
+    std::optional<RegionOperation> Node::PrepareRegionOperation(int inputType,
+        [[maybe_unused]] const cv::Size &inputSize) const
+    {
+        auto tile = PrepareTileOperation(inputType);
+        if (!tile)
+        {
+            return std::nullopt;
+        }
+        return RegionOperation{ .halo = tile->halo, .outputType = tile->outputType, .apply = std::move(tile->apply) };
+    }
+
+    std::optional<cv::Rect> Node::GetInputRegion([[maybe_unused]] const cv::Size &inputSize) const
+    {
+        return std::nullopt;
+    }
+
+    std::optional<ImageBatch> Node::ProcessBatch(const ImageBatch &inputs)
+    {
+        const auto operation = PrepareTileOperation(inputs.GetType());
+        if (!operation || !operation->apply || operation->halo < 0)
+        {
+            return std::nullopt;
+        }
+        const auto apply = [&operation](const cv::Mat &image) {
+            cv::Mat result = operation->apply(image);
+            if (result.size() != image.size() || result.type() != operation->outputType)
+            {
+                throw std::runtime_error("tile operation changed the image size or type");
+            }
+            return result;
+        };
+
+        // Pixels that depend on their own value alone cannot tell the images apart, so one pass covers all
+        if (operation->halo == 0)
+        {
+            return ImageBatch::FromStorage(apply(inputs.GetStorage()), inputs.GetCount());
+        }
+
+        // Context must not be read across image boundaries
+        ImageBatch outputs =
+            ImageBatch::Create(inputs.GetCount(), inputs.GetImageSize(), operation->outputType, CreateOutputImage());
+        for (size_t i = 0; i < inputs.GetCount(); ++i)
+        {
+            ThrowIfStopRequested();
+            cv::Mat destination = outputs.GetImage(i);
+            apply(inputs.GetImage(i)).copyTo(destination);
+        }
+        return outputs;
+    }
+
+    bool Node::ProcessInputBatch()
+    {
+        const auto inputIndex = FindInputSlotIndex("Input");
+        const auto outputIndex = FindOutputSlotIndex("Output");
+        if (!inputIndex || !outputIndex)
+        {
+            return false;
+        }
+        const auto batchData = GetInputSlot(*inputIndex).GetSharedData();
+        const auto *inputs = batchData ? std::get_if<ImageBatch>(batchData.get()) : nullptr;
+        if (!inputs)
+        {
+            return false;
+        }
+
+        if (inputs->IsEmpty())
+        {
+            SetOutputSlotData(*outputIndex, ImageBatch{});
+            return true;
+        }
+        if (auto outputs = ProcessBatch(*inputs))
+        {
+            SetOutputSlotData(*outputIndex, std::move(*outputs));
+            return true;
+        }
+
+        // Without a batched form each image runs through Process(); consumers still receive one batch
+        ImageBatch outputs;
+        try
+        {
+            for (size_t i = 0; i < inputs->GetCount(); ++i)
+            {
+                ThrowIfStopRequested();
+                ShareInputSlotData(*inputIndex, std::make_shared<const NodeData>(inputs->GetImage(i)));
+                Process();
+
+                const auto result = GetOutputSlot(*outputIndex).GetDataIf<cv::Mat>();
+                if (!result || result->empty())
+                {
+                    throw std::runtime_error(GetName() + " produced no image for batch image " + std::to_string(i));
+                }
+                if (i == 0)
+                {
+                    outputs =
+                        ImageBatch::Create(inputs->GetCount(), result->size(), result->type(), CreateOutputImage());
+                }
+                else if (result->size() != outputs.GetImageSize() || result->type() != outputs.GetType())
+                {
+                    throw std::runtime_error(GetName() + " produced images of different sizes or types for one batch");
+                }
+                cv::Mat destination = outputs.GetImage(i);
+                result->copyTo(destination);
+            }
+        }
+        catch (...)
+        {
+            ShareInputSlotData(*inputIndex, batchData);
+            throw;
+        }
+        ShareInputSlotData(*inputIndex, batchData);
+        SetOutputSlotData(*outputIndex, std::move(outputs));
+        return true;
+    }
+
+    std::optional<ImageShape> Node::InferOutputShape([[maybe_unused]] const std::optional<ImageShape> &input) const
+    {
+        return std::nullopt;
+    }
+
+    std::optional<ImageShape> Node::GetDeferredOutputShape() const
+    {
+        return std::nullopt;
+    }
+
+    cv::Mat Node::ReadOutputRegion([[maybe_unused]] const cv::Rect &region) const
+    {
+        throw std::runtime_error("node " + GetName() + " does not read output regions");
+    }
+
+    bool Node::GeneratePipelineCode([[maybe_unused]] PipelineCodeWriter &writer) const
+    {
+        return false;
+    }
+
+    bool Node::SupportsDeviceImages() const
+    {
+        return false;
+    }
+
+    bool Node::UsesCudaImages() const
+    {
+        return false;
+    }
+
+    bool Node::AcceptsChannelViews() const
+    {
+        return false;
+    }
+
+    bool Node::AcceptsImagePyramids() const
+    {
+        return false;
+    }
+
+    bool Node::AcceptsHalfFloatImages() const
+    {
+        return false;
+    }
+
+    bool Node::AcceptsBitMasks() const
+    {
+        return false;
+    }
+
+    ImageLayout Node::GetPreferredImageLayout() const
+    {
+        return ImageLayout::Interleaved;
+    }
+
+    void Node::SetImageBufferPool(std::shared_ptr<ImageBufferPool> pool)
+    {
+        imagePool = std::move(pool);
+    }
+
+    void Node::SetOutputAllocator(std::shared_ptr<cv::MatAllocator> allocator)
+    {
+        outputAllocator = std::move(allocator);
+    }
+
+    cv::Mat Node::CreateOutputImage() const
+    {
+        // Memory plans assume the editor's step order; concurrent context runs stay on the pool
+        if (!ExecutionContext::Current() && outputAllocator)
+        {
+            cv::Mat image;
+            image.allocator = outputAllocator.get();
+            return image;
+        }
+        return imagePool ? imagePool->CreateImage() : cv::Mat{};
+    }
+
+    void Node::SetDerivedImageCache(std::shared_ptr<DerivedImageCache> cache)
+    {
+        derivedImages = std::move(cache);
+    }
+
+    cv::Mat Node::GetDerivedImage(const cv::Mat &image, DerivedImage kind) const
+    {
+        // The editor clears its cache after its own runs only; context runs would fill it without bound
+        if (!derivedImages || ExecutionContext::Current())
+        {
+            return DerivedImageCache::Compute(image, kind);
+        }
+        return derivedImages->Get(image, kind);
+    }
+
+    void Node::SetStopCondition(StopCondition condition)
+    {
+        stopCondition = std::move(condition);
+    }
+
+    const StopCondition &Node::GetActiveStopCondition() const
+    {
+        const auto *context = ExecutionContext::Current();
+        return context ? context->GetStopCondition() : stopCondition;
+    }
+
+    bool Node::IsStopRequested() const
+    {
+        return GetActiveStopCondition().IsStopRequested();
+    }
+
+    void Node::ThrowIfStopRequested() const
+    {
+        const auto &stop = GetActiveStopCondition();
+        if (stop.IsCancelled())
+        {
+            throw ExecutionStopped("execution cancelled");
+        }
+        if (stop.IsDeadlineExceeded())
+        {
+            throw ExecutionStopped("execution deadline exceeded");
+        }
+    }
+
+    void Node::SetProxyScale(double scale)
+    {
+        proxyScale = scale;
+    }
+
+    double Node::GetProxyScale() const
+    {
+        // Context runs always render at full resolution, whatever the editor's last run used
+        return ExecutionContext::Current() ? 1.0 : proxyScale;
+    }
+
+    void Node::SetPrecisionPolicy(PrecisionPolicy policy)
+    {
+        precisionPolicy = policy;
+    }
+
+    PrecisionPolicy Node::GetPrecisionPolicy() const
+    {
+        return precisionPolicy;
+    }
+
+    int Node::ScaleKernelSize(int size, int minimum) const
+    {
+        const double scale = GetProxyScale();
+        if (scale >= 1.0 || size <= minimum)
+        {
+            return size;
+        }
+
+        const auto scaled = 2 * static_cast<int>(std::lround((size * scale - 1.0) / 2.0)) + 1;
+        return std::clamp(scaled, minimum, size);
+    }
+
     float Node::CalculateExtraHeight([[maybe_unused]] float nodeContentWidth, [[maybe_unused]] float zoomLevel) const
     {
         return 0.0f;
@@ -23,99 +412,244 @@ namespace VisionCraft::Nodes
 
     Slot &Node::CreateInputSlot(const std::string &slotName)
     {
-        return inputSlots[slotName];
+        return FindOrAppendSlot(inputSlots, slotNames, SlotKind::Input, slotName);
     }
 
     Slot &Node::CreateOutputSlot(const std::string &slotName)
     {
-        return outputSlots[slotName];
+        return FindOrAppendSlot(outputSlots, slotNames, SlotKind::Output, slotName);
     }
 
     const Slot &Node::GetInputSlot(const std::string &slotName) const
     {
-        return inputSlots.at(slotName);
+        return inputSlots[GetSlotIndex(SlotKind::Input, slotName)];
     }
 
     const Slot &Node::GetOutputSlot(const std::string &slotName) const
     {
-        return outputSlots.at(slotName);
+        return outputSlots[GetSlotIndex(SlotKind::Output, slotName)];
+    }
+
+    const Slot &Node::GetInputSlot(SlotIndex slotIndex) const
+    {
+        return inputSlots.at(slotIndex);
+    }
+
+    const Slot &Node::GetOutputSlot(SlotIndex slotIndex) const
+    {
+        return outputSlots.at(slotIndex);
+    }
+
+    std::optional<SlotIndex> Node::FindInputSlotIndex(const std::string &slotName) const
+    {
+        return slotNames.Find(SlotKind::Input, slotName);
+    }
+
+    std::optional<SlotIndex> Node::FindOutputSlotIndex(const std::string &slotName) const
+    {
+        return slotNames.Find(SlotKind::Output, slotName);
+    }
+
+    size_t Node::GetInputSlotCount() const
+    {
+        return inputSlots.size();
+    }
+
+    size_t Node::GetOutputSlotCount() const
+    {
+        return outputSlots.size();
     }
 
     void Node::SetInputSlotData(const std::string &slotName, NodeData data)
     {
-        inputSlots.at(slotName).SetData(std::move(data));
+        auto &slot = inputSlots[GetSlotIndex(SlotKind::Input, slotName)];
+        slot.SetData(std::move(data));
+        if (slot.HasDefaultValue())
+        {
+            InvalidatePreparation();
+        }
     }
 
     void Node::SetOutputSlotData(const std::string &slotName, NodeData data)
     {
-        outputSlots.at(slotName).SetData(std::move(data));
+        outputSlots[GetSlotIndex(SlotKind::Output, slotName)].SetData(std::move(data));
+    }
+
+    void Node::SetOutputSlotData(SlotIndex slotIndex, NodeData data)
+    {
+        outputSlots.at(slotIndex).SetData(std::move(data));
+    }
+
+    void Node::ShareInputSlotData(const std::string &slotName, std::shared_ptr<const NodeData> data)
+    {
+        ShareInputSlotData(GetSlotIndex(SlotKind::Input, slotName), std::move(data));
+    }
+
+    void Node::ShareOutputSlotData(const std::string &slotName, std::shared_ptr<const NodeData> data)
+    {
+        outputSlots[GetSlotIndex(SlotKind::Output, slotName)].SetSharedData(std::move(data));
+    }
+
+    void Node::ShareInputSlotData(SlotIndex slotIndex, std::shared_ptr<const NodeData> data)
+    {
+        auto &slot = inputSlots.at(slotIndex);
+        // Image inputs change every run; only a parameter input reaching a new value invalidates Prepare()
+        if (slot.HasDefaultValue() && slot.GetSharedData() != data)
+        {
+            InvalidatePreparation();
+        }
+        slot.SetSharedData(std::move(data));
+    }
+
+    void Node::ShareOutputSlotData(SlotIndex slotIndex, std::shared_ptr<const NodeData> data)
+    {
+        outputSlots.at(slotIndex).SetSharedData(std::move(data));
     }
 
     void Node::ClearInputSlot(const std::string &slotName)
     {
-        inputSlots.at(slotName).Clear();
+        auto &slot = inputSlots[GetSlotIndex(SlotKind::Input, slotName)];
+        slot.Clear();
+        if (slot.HasDefaultValue())
+        {
+            InvalidatePreparation();
+        }
     }
 
     void Node::ClearOutputSlot(const std::string &slotName)
     {
-        outputSlots.at(slotName).Clear();
+        outputSlots[GetSlotIndex(SlotKind::Output, slotName)].Clear();
+    }
+
+    void Node::ClearOutputSlot(SlotIndex slotIndex)
+    {
+        outputSlots.at(slotIndex).Clear();
     }
 
     void Node::SetInputSlotDefault(const std::string &slotName, NodeData defaultValue)
     {
-        inputSlots.at(slotName).SetDefaultValue(std::move(defaultValue));
+        inputSlots[GetSlotIndex(SlotKind::Input, slotName)].SetDefaultValue(std::move(defaultValue));
+        InvalidatePreparation();
+        MarkDirty();
+    }
+
+    void Node::MarkDirty()
+    {
+        dirty.store(true, std::memory_order_release);
+    }
+
+    void Node::ClearDirty()
+    {
+        dirty.store(false, std::memory_order_release);
+    }
+
+    bool Node::IsDirty() const
+    {
+        return dirty.load(std::memory_order_acquire);
+    }
+
+    void Node::PrepareIfNeeded()
+    {
+        if (ExecutionContext::Current() || prepared.exchange(true, std::memory_order_acq_rel))
+        {
+            return;
+        }
+        try
+        {
+            Prepare();
+        }
+        catch (...)
+        {
+            InvalidatePreparation();
+            throw;
+        }
+    }
+
+    void Node::InvalidatePreparation()
+    {
+        prepared.store(false, std::memory_order_release);
+    }
+
+    void Node::Prepare()
+    {
+    }
+
+    bool Node::IsPrepared() const
+    {
+        return !ExecutionContext::Current() && prepared.load(std::memory_order_acquire);
     }
 
     bool Node::IsInputSlotConnected(const std::string &slotName) const
     {
-        return inputSlots.at(slotName).IsConnected();
+        return inputSlots[GetSlotIndex(SlotKind::Input, slotName)].IsConnected();
     }
 
     bool Node::HasInputSlot(const std::string &slotName) const
     {
-        return inputSlots.find(slotName) != inputSlots.end();
+        return slotNames.Contains(SlotKind::Input, slotName);
     }
 
     bool Node::HasOutputSlot(const std::string &slotName) const
     {
-        return outputSlots.find(slotName) != outputSlots.end();
+        return slotNames.Contains(SlotKind::Output, slotName);
+    }
+
+    std::vector<std::string> Node::GetInputSlotNames() const
+    {
+        return slotNames.GetNames(SlotKind::Input);
+    }
+
+    std::vector<std::string> Node::GetOutputSlotNames() const
+    {
+        return slotNames.GetNames(SlotKind::Output);
     }
 
     void Node::CreateExecutionInputPin(const std::string &pinName)
     {
-        executionInputPins.insert(pinName);
+        slotNames.Insert(SlotKind::ExecutionInput, pinName, 0);
     }
 
     void Node::CreateExecutionOutputPin(const std::string &pinName)
     {
-        executionOutputPins.insert(pinName);
+        slotNames.Insert(SlotKind::ExecutionOutput, pinName, 0);
     }
 
     bool Node::HasExecutionInputPin(const std::string &pinName) const
     {
-        return executionInputPins.count(pinName) > 0;
+        return slotNames.Contains(SlotKind::ExecutionInput, pinName);
     }
 
     bool Node::HasExecutionOutputPin(const std::string &pinName) const
     {
-        return executionOutputPins.count(pinName) > 0;
+        return slotNames.Contains(SlotKind::ExecutionOutput, pinName);
     }
 
     std::vector<std::string> Node::GetExecutionInputPins() const
     {
-        return std::vector<std::string>(executionInputPins.begin(), executionInputPins.end());
+        return slotNames.GetNames(SlotKind::ExecutionInput);
     }
 
     std::vector<std::string> Node::GetExecutionOutputPins() const
     {
-        return std::vector<std::string>(executionOutputPins.begin(), executionOutputPins.end());
+        return slotNames.GetNames(SlotKind::ExecutionOutput);
+    }
+
+    SlotIndex Node::GetSlotIndex(SlotKind kind, const std::string &slotName) const
+    {
+        if (const auto index = slotNames.Find(kind, slotName))
+        {
+            return *index;
+        }
+        throw std::out_of_range("Node " + name + " has no " + (kind == SlotKind::Input ? "input" : "output")
+                                + " slot '" + slotName + "'");
     }
 
     template<typename T> Slot &Node::CreateInputSlot(const std::string &slotName, T defaultValue)
     {
         NodeData nodeData = std::move(defaultValue);
-        inputSlots[slotName] = Slot(std::optional<NodeData>(std::move(nodeData)));
-        return inputSlots[slotName];
+        auto &slot = FindOrAppendSlot(inputSlots, slotNames, SlotKind::Input, slotName);
+        slot = Slot(std::optional<NodeData>(std::move(nodeData)));
+        return slot;
     }
     template Slot &Node::CreateInputSlot<double>(const std::string &, double);
     template Slot &Node::CreateInputSlot<float>(const std::string &, float);
@@ -1,22 +1,95 @@
 #pragma once
+#include <atomic>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 #include <string>
-#include <unordered_map>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "Nodes/Core/DerivedImageCache.h"
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/NodeArena.h"
+#include "Nodes/Core/NodeTypeRegistry.h"
+#include "Nodes/Core/PrecisionPolicy.h"
 #include "Nodes/Core/Slot.h"
+#include "Nodes/Core/SlotNameTable.h"
+#include "Nodes/Core/StopCondition.h"
 
 
 namespace VisionCraft::Nodes
 {
+    class PipelineCodeWriter;
+
     /**
      * @brief Alias for a Node ID.
      */
     using NodeId = int;
 
+    /**
+     * @brief Dense position of a slot among its node's inputs or outputs.
+     * @note Assigned in creation order and stable for the node's lifetime.
+     */
+    using SlotIndex = size_t;
+
+    /**
+     * @brief Per-tile form of a node's image operation, used by tiled execution.
+     *
+     * Output pixels may depend on input pixels up to halo pixels away, so a tile is processed with that
+     * much extra context on each side. Tile operations preserve the image size.
+     *
+     * An operation that maps every pixel by its value alone, the same way at every position (a color
+     * conversion, not a threshold computed from the histogram), names that mapping in colorTransform. Runs of
+     * such operations on 8-bit images may be collapsed into one lookup table (see ColorLut), so equal names
+     * must always mean equal mappings: include every parameter that changes the result.
+     */
+    struct TileOperation
+    {
+        int halo = 0;                                      ///< Input context needed on each side, in pixels
+        int outputType = 0;                                ///< cv::Mat type apply() returns
+        std::function<cv::Mat(const cv::Mat &tile)> apply; ///< Processes one tile (called concurrently)
+        std::string colorTransform;                        ///< Names a per-pixel mapping; empty for other operations
+    };
+
+    /**
+     * @brief Size and type of an image, known before the image is computed.
+     */
+    struct ImageShape
+    {
+        cv::Size size;      ///< Width and height
+        int type = CV_8UC3; ///< cv::Mat type (depth and channel count)
+
+        bool operator==(const ImageShape &) const = default;
+    };
+
+    /**
+     * @brief Elements a loop node runs its body for (see Node::GetLoopBodyPin()).
+     */
+    struct LoopElements
+    {
+        std::vector<std::shared_ptr<const NodeData>> values; ///< One value per iteration, in order
+        bool parallel = true;                                ///< Iterations may run at the same time
+    };
+
+    /**
+     * @brief Form of a node's image operation that computes only part of its output, used by region chains.
+     *
+     * Output pixel (x, y) depends on input pixels around (x / scaleX, y / scaleY), up to halo input pixels
+     * away. The output is scale times the input size, rounded. A scale below 1 must be the reciprocal of an
+     * integer and a scale above 1 an integer, so a region starting on a whole input step starts on a whole
+     * output pixel and apply() gives the same pixels as processing the full image.
+     */
+    struct RegionOperation
+    {
+        int halo = 0;                                        ///< Input context needed on each side, in pixels
+        double scaleX = 1.0;                                 ///< Output pixels per input pixel horizontally
+        double scaleY = 1.0;                                 ///< Output pixels per input pixel vertically
+        int outputType = 0;                                  ///< cv::Mat type apply() returns
+        std::function<cv::Mat(const cv::Mat &region)> apply; ///< Processes an input region
+    };
+
     /**
      * @brief Abstract base class for all nodes in the editor.
      */
@@ -35,6 +108,21 @@ namespace VisionCraft::Nodes
          */
         virtual ~Node() = default;
 
+        /**
+         * @brief Allocates a node from the calling thread's NodeArena, or from the heap outside any scope.
+         * @param size Size of the node type
+         * @return Memory for the node
+         * @note Node types must not be over-aligned. Nodes created with std::make_shared bypass the arena.
+         */
+        [[nodiscard]] static void *operator new(size_t size);
+
+        /**
+         * @brief Returns a node's memory to the arena or heap it came from.
+         * @param pointer Node memory
+         * @param size Size of the node type
+         */
+        static void operator delete(void *pointer, size_t size) noexcept;
+
         /**
          * @brief Returns the node's unique ID.
          * @return Node ID
@@ -53,11 +141,280 @@ namespace VisionCraft::Nodes
          */
         [[nodiscard]] virtual std::string GetType() const = 0;
 
+        /**
+         * @brief Returns the interned ID of GetType().
+         * @return Type ID, equal for every node with the same GetType() in this process
+         * @note Interned on the first call and cached, so later calls do not build the type string.
+         */
+        [[nodiscard]] NodeTypeId GetTypeId() const;
+
         /**
          * @brief Processes node data. Must be implemented by derived classes.
          */
         virtual void Process() = 0;
 
+        /**
+         * @brief Returns whether outputs depend only on input slot values.
+         * @return True if results may be served from the output cache
+         * @note Override to return false for nodes with side effects or external inputs (files, GPU textures).
+         */
+        [[nodiscard]] virtual bool IsCacheable() const;
+
+        /**
+         * @brief Returns whether node produces new data on every execution (video file, camera).
+         * @return True if NodeEditor::ExecuteStream() must re-run the node for each frame
+         */
+        [[nodiscard]] virtual bool IsStreamSource() const;
+
+        /**
+         * @brief Returns whether a stream source has run out of frames.
+         * @return True once the last Process() call produced no frame
+         */
+        [[nodiscard]] virtual bool HasStreamEnded() const;
+
+        /**
+         * @brief Returns whether running the node has an effect outside the graph (file written, image shown).
+         * @return True if pull-based evaluation keeps the node and everything it reads (see
+         *         NodeEditor::SetPullEvaluation()); by default only nodes without output slots are sinks
+         */
+        [[nodiscard]] virtual bool IsSink() const;
+
+        /**
+         * @brief Returns whether the node decides at runtime which of its execution outputs continue the flow.
+         * @return True if IsExecutionOutputTaken() may return false; steps wired after such a node are planned
+         *         as conditional and bypassed when no taken wire reaches them
+         */
+        [[nodiscard]] virtual bool BranchesExecution() const;
+
+        /**
+         * @brief Returns whether the last Process() call continued the flow through an execution output.
+         * @param pinName Execution output pin
+         * @return True if steps wired to the pin should run (always true unless BranchesExecution())
+         * @note Read right after the node finished, on the thread (or ExecutionContext) that ran it.
+         */
+        [[nodiscard]] virtual bool IsExecutionOutputTaken(const std::string &pinName) const;
+
+        /**
+         * @brief Returns the execution output pin whose chain runs once per element of the node's list.
+         * @return Pin name, or std::nullopt for nodes that are not loops
+         * @note Steps reached only through the pin form the loop body. NodeEditor runs the node, then the body
+         *       once per GetLoopElements() entry, each iteration in its own ExecutionContext, then FinishLoop().
+         */
+        [[nodiscard]] virtual std::optional<std::string> GetLoopBodyPin() const;
+
+        /**
+         * @brief Splits the node's list input into the elements its body runs for.
+         * @return Elements in order (none unless the node is a loop)
+         * @note Called right after Process(), on the same thread and ExecutionContext.
+         */
+        [[nodiscard]] virtual LoopElements GetLoopElements() const;
+
+        /**
+         * @brief Publishes one element on the node's outputs before the body runs for it.
+         * @param index Position of the element
+         * @param element Element value
+         * @note Called on the iteration's thread, with the iteration's ExecutionContext bound.
+         */
+        virtual void BeginLoopIteration(size_t index, const std::shared_ptr<const NodeData> &element);
+
+        /**
+         * @brief Receives the body's result for every element once the last iteration finished.
+         * @param results Per element, the value the node's input wired from inside the body read (nullptr if none)
+         */
+        virtual void FinishLoop(std::vector<std::shared_ptr<const NodeData>> results);
+
+        /**
+         * @brief Returns the node's operation in per-tile form, so large images can be split across cores.
+         * @param inputType cv::Mat type of the image the node will receive in its "Input" slot
+         * @return Operation with current parameters, or std::nullopt if the node must see the whole image
+         * @note Called after inputs are pulled. The returned function must not touch the node; capture
+         *       parameters by value. Tileable nodes read "Input" and write "Output".
+         */
+        [[nodiscard]] virtual std::optional<TileOperation> PrepareTileOperation(int inputType) const;
+
+        /**
+         * @brief Returns the node's operation in a form that processes only a region of the input.
+         * @param inputType cv::Mat type of the image the node will receive in its "Input" slot
+         * @param inputSize Size of that image
+         * @return Operation with current parameters, or std::nullopt if the node must see the whole image
+         * @note Defaults to the tile operation at scale 1. Same contract as PrepareTileOperation().
+         */
+        [[nodiscard]] virtual std::optional<RegionOperation> PrepareRegionOperation(int inputType,
+            const cv::Size &inputSize) const;
+
+        /**
+         * @brief Returns the part of its "Input" image the node reads, so upstream nodes compute only that.
+         * @param inputSize Size of the image the node will receive
+         * @return Non-empty region inside the image, or std::nullopt if the node reads all of it
+         * @note Ends a region chain (see TilingOptions::propagateRegions); the chain then sets the node's
+         *       "Output" to the region's pixels instead of calling Process(), so Process() must output exactly
+         *       the region too.
+         */
+        [[nodiscard]] virtual std::optional<cv::Rect> GetInputRegion(const cv::Size &inputSize) const;
+
+        /**
+         * @brief Processes every image of a batch in one call.
+         * @param inputs Batch the node received in its "Input" slot
+         * @return Batch to write to "Output", or std::nullopt to run Process() once per image instead
+         * @note Called after inputs are pulled, like Process(). The default runs the tile operation (see
+         *       PrepareTileOperation()) over the batch: once over the whole buffer if it reads no context,
+         *       otherwise once per image. Override to hand a backend the whole batch, e.g. one inference call.
+         */
+        [[nodiscard]] virtual std::optional<ImageBatch> ProcessBatch(const ImageBatch &inputs);
+
+        /**
+         * @brief Runs the node for the batch in its "Input" slot, if it holds one.
+         * @return True if "Input" held a batch and "Output" now holds the batch of results; false if the caller
+         *         should call Process() as usual
+         * @throws std::runtime_error if Process() results cannot be batched (not a cv::Mat, or shapes differ)
+         * @note Tries ProcessBatch() first, then falls back to Process() once per image with each image shared
+         *       into "Input"; outputs other than "Output" then keep the last image's values.
+         */
+        bool ProcessInputBatch();
+
+        /**
+         * @brief Infers the shape of the image Process() writes to "Output", without processing.
+         * @param input Shape of the image in "Input", or std::nullopt if unknown or the node has no such slot
+         * @return Shape with current parameters, or std::nullopt if unknown (the default)
+         * @throws std::invalid_argument if Process() cannot handle an input of that shape
+         * @note Used by NodeEditor::InferImageShapes() to reject connections and preallocate buffers before
+         *       a run. Must agree with Process() for every input it accepts.
+         */
+        [[nodiscard]] virtual std::optional<ImageShape> InferOutputShape(const std::optional<ImageShape> &input) const;
+
+        /**
+         * @brief Returns the shape of an "Output" image the node left empty because it reads it by region.
+         * @return Shape of the deferred image, or std::nullopt if Process() writes "Output" (the default)
+         * @note A source too large to load (e.g. a gigapixel TIFF) then serves region chains it feeds through
+         *       ReadOutputRegion(), so only the pixels a downstream region reads are ever decoded.
+         */
+        [[nodiscard]] virtual std::optional<ImageShape> GetDeferredOutputShape() const;
+
+        /**
+         * @brief Reads part of the image whose shape GetDeferredOutputShape() reports.
+         * @param region Region inside that image
+         * @return Region pixels
+         * @throws std::runtime_error if the region cannot be read (the default)
+         * @note Called on the executing thread while the node is not processing.
+         */
+        [[nodiscard]] virtual cv::Mat ReadOutputRegion(const cv::Rect &region) const;
+
+        /**
+         * @brief Writes the node's operation as C++ for an ahead-of-time compiled pipeline (see PipelineCompiler).
+         * @param writer Receives statements, constants and pipeline input/output bindings
+         * @return True if the node has a compiled form with its current parameters; false (the default)
+         *         otherwise, with PipelineCodeWriter::Fail() giving the reason where there is a specific one
+         * @note Parameters are baked in as read now. Connected data inputs must be read through
+         *       PipelineCodeWriter::Input(); the generated statements must not depend on the node itself.
+         */
+        [[nodiscard]] virtual bool GeneratePipelineCode(PipelineCodeWriter &writer) const;
+
+        /**
+         * @brief Returns whether Process() accepts cv::UMat inputs and keeps its output on the device.
+         * @return False unless overridden
+         * @note With NodeEditor::SetDeviceExecution() on, such nodes receive images as cv::UMat; every other
+         *       node receives a cv::Mat copied back from the device.
+         */
+        [[nodiscard]] virtual bool SupportsDeviceImages() const;
+
+        /**
+         * @brief Returns whether Process() reads images as cv::cuda::GpuMat and keeps its output in CUDA memory.
+         * @return False unless overridden
+         * @note Unlike SupportsDeviceImages(), this does not depend on an editor setting: the node is a CUDA
+         *       implementation, and its inputs are uploaded whenever they arrive from host memory.
+         */
+        [[nodiscard]] virtual bool UsesCudaImages() const;
+
+        /**
+         * @brief Returns whether Process() reads ChannelView inputs in place.
+         * @return False unless overridden
+         * @note Every other node receives each channel view as a single-channel cv::Mat extracted by NodeEditor.
+         */
+        [[nodiscard]] virtual bool AcceptsChannelViews() const;
+
+        /**
+         * @brief Returns whether Process() reads ImagePyramid inputs and samples the levels it needs.
+         * @return False unless overridden
+         * @note Every other node receives a pyramid's full-resolution image as a cv::Mat, without a copy.
+         */
+        [[nodiscard]] virtual bool AcceptsImagePyramids() const;
+
+        /**
+         * @brief Returns whether Process() reads CV_16F images (PrecisionPolicy::Prefer16 float storage).
+         * @return False unless overridden
+         * @note Every other node receives half-float images widened to CV_32F by NodeEditor.
+         */
+        [[nodiscard]] virtual bool AcceptsHalfFloatImages() const;
+
+        /**
+         * @brief Returns whether Process() reads BitMask inputs word by word.
+         * @return False unless overridden
+         * @note Every other node receives a mask unpacked to a 0/255 CV_8UC1 image by NodeEditor.
+         */
+        [[nodiscard]] virtual bool AcceptsBitMasks() const;
+
+        /**
+         * @brief Returns the channel layout Process() reads images in.
+         * @return ImageLayout::Interleaved unless overridden
+         * @note NodeEditor converts an input only when its layout differs from this one; ImageLayout::Any
+         *       nodes read cv::Mat and PlanarImage alike and never trigger a conversion.
+         */
+        [[nodiscard]] virtual ImageLayout GetPreferredImageLayout() const;
+
+        /**
+         * @brief Sets the pool CreateOutputImage() allocates from.
+         * @param pool Graph's buffer pool (nullptr allocates with OpenCV's default allocator)
+         * @note NodeEditor::AddNode() hands every node the editor's pool.
+         */
+        void SetImageBufferPool(std::shared_ptr<ImageBufferPool> pool);
+
+        /**
+         * @brief Sets the allocator CreateOutputImage() uses instead of the pool, e.g. a planned slab placement.
+         * @param allocator Allocator to use (nullptr returns to the pool)
+         * @note Ignored on threads running an ExecutionContext, which use the pool. See NodeEditor::PlanImageMemory().
+         */
+        void SetOutputAllocator(std::shared_ptr<cv::MatAllocator> allocator);
+
+        /**
+         * @brief Sets the cache GetDerivedImage() shares derived images through.
+         * @param cache Graph's derived image cache (nullptr computes every request)
+         * @note NodeEditor::AddNode() hands every node the editor's cache.
+         */
+        void SetDerivedImageCache(std::shared_ptr<DerivedImageCache> cache);
+
+        /**
+         * @brief Sets the stop condition Process() polls through ThrowIfStopRequested().
+         * @param condition Condition of the current run (default-constructed = never stops)
+         * @note NodeEditor sets it before each Process() call and resets it afterwards.
+         */
+        void SetStopCondition(StopCondition condition);
+
+        /**
+         * @brief Sets the scale of the proxy run processing this node.
+         * @param scale Fraction of full resolution source images are reduced to (1 = full resolution)
+         * @note NodeEditor sets it on every node before a run, see NodeEditor::SetProxyScale().
+         */
+        void SetProxyScale(double scale);
+
+        /**
+         * @brief Returns the scale of the run processing this node.
+         * @return Fraction of full resolution (1 = full resolution, always inside an ExecutionContext)
+         */
+        [[nodiscard]] double GetProxyScale() const;
+
+        /**
+         * @brief Sets the depth policy this node stores intermediate results under.
+         * @param policy Graph's policy
+         * @note NodeEditor sets it on every node before a run, see NodeEditor::SetPrecisionPolicy().
+         */
+        void SetPrecisionPolicy(PrecisionPolicy policy);
+
+        /**
+         * @brief Returns the depth policy of the graph processing this node.
+         * @return Policy (PrecisionPolicy::Native unless the editor set another)
+         */
+        [[nodiscard]] PrecisionPolicy GetPrecisionPolicy() const;
+
         /**
          * @brief Calculates extra height for node-specific content.
          * @param nodeContentWidth Available content width
@@ -69,7 +426,7 @@ namespace VisionCraft::Nodes
         /**
          * @brief Creates input slot without default value.
          * @param slotName Slot name
-         * @return Created slot
+         * @return Created slot (reference valid until the next slot is created)
          */
         Slot &CreateInputSlot(const std::string &slotName);
 
@@ -77,14 +434,14 @@ namespace VisionCraft::Nodes
          * @brief Creates input slot with default value.
          * @param slotName Slot name
          * @param defaultValue Default value when not connected
-         * @return Created slot
+         * @return Created slot (reference valid until the next slot is created)
          */
         template<typename T> Slot &CreateInputSlot(const std::string &slotName, T defaultValue);
 
         /**
          * @brief Creates output slot.
          * @param slotName Slot name
-         * @return Created slot
+         * @return Created slot (reference valid until the next slot is created)
          */
         Slot &CreateOutputSlot(const std::string &slotName);
 
@@ -102,6 +459,48 @@ namespace VisionCraft::Nodes
          */
         [[nodiscard]] const Slot &GetOutputSlot(const std::string &slotName) const;
 
+        /**
+         * @brief Returns input slot by index, skipping the name lookup.
+         * @param slotIndex Index from FindInputSlotIndex()
+         * @return Input slot
+         * @throws std::out_of_range if index is invalid
+         */
+        [[nodiscard]] const Slot &GetInputSlot(SlotIndex slotIndex) const;
+
+        /**
+         * @brief Returns output slot by index, skipping the name lookup.
+         * @param slotIndex Index from FindOutputSlotIndex()
+         * @return Output slot
+         * @throws std::out_of_range if index is invalid
+         */
+        [[nodiscard]] const Slot &GetOutputSlot(SlotIndex slotIndex) const;
+
+        /**
+         * @brief Resolves input slot name to its index.
+         * @param slotName Slot name
+         * @return Slot index, or std::nullopt if the slot doesn't exist
+         */
+        [[nodiscard]] std::optional<SlotIndex> FindInputSlotIndex(const std::string &slotName) const;
+
+        /**
+         * @brief Resolves output slot name to its index.
+         * @param slotName Slot name
+         * @return Slot index, or std::nullopt if the slot doesn't exist
+         */
+        [[nodiscard]] std::optional<SlotIndex> FindOutputSlotIndex(const std::string &slotName) const;
+
+        /**
+         * @brief Returns number of input slots (valid indices are 0 to count - 1).
+         * @return Input slot count
+         */
+        [[nodiscard]] size_t GetInputSlotCount() const;
+
+        /**
+         * @brief Returns number of output slots (valid indices are 0 to count - 1).
+         * @return Output slot count
+         */
+        [[nodiscard]] size_t GetOutputSlotCount() const;
+
         /**
          * @brief Sets data in input slot.
          * @param slotName Slot name
@@ -118,6 +517,46 @@ namespace VisionCraft::Nodes
          */
         void SetOutputSlotData(const std::string &slotName, NodeData data);
 
+        /**
+         * @brief Sets data in output slot by index.
+         * @param slotIndex Index from FindOutputSlotIndex()
+         * @param data Data to set
+         * @throws std::out_of_range if index is invalid
+         */
+        void SetOutputSlotData(SlotIndex slotIndex, NodeData data);
+
+        /**
+         * @brief Makes input slot share an existing data handle (no copy of the value).
+         * @param slotName Slot name
+         * @param data Handle to share, typically an upstream output's Slot::GetSharedData()
+         * @throws std::out_of_range if slot doesn't exist
+         */
+        void ShareInputSlotData(const std::string &slotName, std::shared_ptr<const NodeData> data);
+
+        /**
+         * @brief Makes output slot share an existing data handle (no copy of the value).
+         * @param slotName Slot name
+         * @param data Handle to share
+         * @throws std::out_of_range if slot doesn't exist
+         */
+        void ShareOutputSlotData(const std::string &slotName, std::shared_ptr<const NodeData> data);
+
+        /**
+         * @brief Makes input slot share an existing data handle, addressed by index.
+         * @param slotIndex Index from FindInputSlotIndex()
+         * @param data Handle to share
+         * @throws std::out_of_range if index is invalid
+         */
+        void ShareInputSlotData(SlotIndex slotIndex, std::shared_ptr<const NodeData> data);
+
+        /**
+         * @brief Makes output slot share an existing data handle, addressed by index.
+         * @param slotIndex Index from FindOutputSlotIndex()
+         * @param data Handle to share
+         * @throws std::out_of_range if index is invalid
+         */
+        void ShareOutputSlotData(SlotIndex slotIndex, std::shared_ptr<const NodeData> data);
+
         /**
          * @brief Clears input slot data.
          * @param slotName Slot name
@@ -132,6 +571,13 @@ namespace VisionCraft::Nodes
          */
         void ClearOutputSlot(const std::string &slotName);
 
+        /**
+         * @brief Clears output slot data by index.
+         * @param slotIndex Index from FindOutputSlotIndex()
+         * @throws std::out_of_range if index is invalid
+         */
+        void ClearOutputSlot(SlotIndex slotIndex);
+
         /**
          * @brief Returns input value with automatic fallback to default.
          * @param slotName Slot name
@@ -143,6 +589,68 @@ namespace VisionCraft::Nodes
             return GetInputSlot(slotName).GetValueOrDefault<T>();
         }
 
+        /**
+         * @brief Returns input value (connected data or default) without copying it.
+         * @tparam T Value type
+         * @param slotName Slot name
+         * @return Handle to the value, or nullptr if neither value holds T
+         * @note Prefer this over GetInputValue() for large values such as contour vectors.
+         */
+        template<ValidNodeDataType T>
+        [[nodiscard]] std::shared_ptr<const T> GetInputValueIf(const std::string &slotName) const
+        {
+            return GetInputSlot(slotName).GetValueOrDefaultIf<T>();
+        }
+
+        /**
+         * @brief Returns a view of the input value (connected data or default) without copying it.
+         * @tparam T Value type
+         * @param slotName Slot name
+         * @return View of the value, empty if neither value holds T
+         * @throws std::out_of_range if slot doesn't exist
+         * @note Use for strings, paths and images read in Process(): `GetInputView<std::string>("Method")
+         *       .ValueOr(kDefault)` reads the parameter without copying or touching a cv::Mat refcount.
+         */
+        template<ValidNodeDataType T> [[nodiscard]] SlotView<T> GetInputView(const std::string &slotName) const
+        {
+            return GetInputSlot(slotName).GetValueOrDefaultView<T>();
+        }
+
+        /**
+         * @brief Returns input value by index with automatic fallback to default.
+         * @param slotIndex Index from FindInputSlotIndex()
+         * @return Connected value if available, otherwise default value
+         * @throws std::out_of_range if index is invalid
+         */
+        template<typename T> [[nodiscard]] std::optional<T> GetInputValue(SlotIndex slotIndex) const
+        {
+            return GetInputSlot(slotIndex).GetValueOrDefault<T>();
+        }
+
+        /**
+         * @brief Returns input value by index without copying it.
+         * @tparam T Value type
+         * @param slotIndex Index from FindInputSlotIndex()
+         * @return Handle to the value, or nullptr if neither value holds T
+         * @throws std::out_of_range if index is invalid
+         */
+        template<ValidNodeDataType T> [[nodiscard]] std::shared_ptr<const T> GetInputValueIf(SlotIndex slotIndex) const
+        {
+            return GetInputSlot(slotIndex).GetValueOrDefaultIf<T>();
+        }
+
+        /**
+         * @brief Returns a view of the input value by index without copying it.
+         * @tparam T Value type
+         * @param slotIndex Index from FindInputSlotIndex()
+         * @return View of the value, empty if neither value holds T
+         * @throws std::out_of_range if index is invalid
+         */
+        template<ValidNodeDataType T> [[nodiscard]] SlotView<T> GetInputView(SlotIndex slotIndex) const
+        {
+            return GetInputSlot(slotIndex).GetValueOrDefaultView<T>();
+        }
+
         /**
          * @brief Sets default value for input slot.
          * @param slotName Slot name
@@ -151,6 +659,37 @@ namespace VisionCraft::Nodes
          */
         void SetInputSlotDefault(const std::string &slotName, NodeData defaultValue);
 
+        /**
+         * @brief Flags node for re-execution on the next incremental run.
+         * @note Called automatically when a slot default changes. NodeEditor also marks nodes whose
+         *       connections or upstream outputs change.
+         */
+        void MarkDirty();
+
+        /**
+         * @brief Clears dirty flag after the node has processed its current inputs.
+         */
+        void ClearDirty();
+
+        /**
+         * @brief Checks if node needs re-execution.
+         * @return True if inputs or parameters changed since the last successful Process()
+         */
+        [[nodiscard]] bool IsDirty() const;
+
+        /**
+         * @brief Calls Prepare() if parameters changed since it last ran.
+         * @note NodeEditor calls it before Process() and the Prepare*Operation() methods. Does nothing on a
+         *       thread running an ExecutionContext, whose parameters may differ from the graph's.
+         */
+        void PrepareIfNeeded();
+
+        /**
+         * @brief Marks the prepared state stale, so the next PrepareIfNeeded() calls Prepare() again.
+         * @note Called automatically when a slot default or the value of a parameter input changes.
+         */
+        void InvalidatePreparation();
+
         /**
          * @brief Checks if input slot is connected.
          * @param slotName Slot name
@@ -172,6 +711,18 @@ namespace VisionCraft::Nodes
          */
         [[nodiscard]] bool HasOutputSlot(const std::string &slotName) const;
 
+        /**
+         * @brief Returns input slot names in sorted order.
+         * @return Vector of slot names
+         */
+        [[nodiscard]] std::vector<std::string> GetInputSlotNames() const;
+
+        /**
+         * @brief Returns output slot names in sorted order.
+         * @return Vector of slot names
+         */
+        [[nodiscard]] std::vector<std::string> GetOutputSlotNames() const;
+
         /**
          * @brief Creates execution input pin (white wire input).
          *
@@ -210,23 +761,115 @@ namespace VisionCraft::Nodes
 
         /**
          * @brief Returns all execution input pin names.
-         * @return Vector of pin names
+         * @return Vector of pin names in sorted order
          */
         [[nodiscard]] std::vector<std::string> GetExecutionInputPins() const;
 
         /**
          * @brief Returns all execution output pin names.
-         * @return Vector of pin names
+         * @return Vector of pin names in sorted order
          */
         [[nodiscard]] std::vector<std::string> GetExecutionOutputPins() const;
 
     protected:
-        std::string name;                                    ///< Name of the node
-        NodeId id;                                           ///< Unique identifier of the node
-        std::unordered_map<std::string, Slot> inputSlots;    ///< Input data slots
-        std::unordered_map<std::string, Slot> outputSlots;   ///< Output data slots
-        std::unordered_set<std::string> executionInputPins;  ///< Execution input pins (O(1) lookup)
-        std::unordered_set<std::string> executionOutputPins; ///< Execution output pins (O(1) lookup)
+        /**
+         * @brief Resolves a slot name to its index.
+         * @param kind SlotKind::Input or SlotKind::Output
+         * @param slotName Slot name
+         * @return Slot index
+         * @throws std::out_of_range if the slot doesn't exist
+         */
+        [[nodiscard]] SlotIndex GetSlotIndex(SlotKind kind, const std::string &slotName) const;
+
+        /**
+         * @brief Returns an empty output image whose buffer comes from the graph's pool.
+         * @return cv::Mat to pass as an OpenCV output argument; reuses a buffer released by earlier runs
+         * @note Let OpenCV write into the image rather than assigning another cv::Mat to it, which would
+         *       bypass the pool.
+         */
+        [[nodiscard]] cv::Mat CreateOutputImage() const;
+
+        /**
+         * @brief Returns a representation of an input image, shared with other nodes reading the same buffer.
+         * @param image Input image (e.g. from GetInputValueIf<cv::Mat>())
+         * @param kind Representation to return
+         * @return Read-only derived image; computed by the first node of the run to ask for it
+         * @note Use instead of converting privately (e.g. cv::cvtColor to gray before filtering).
+         */
+        [[nodiscard]] cv::Mat GetDerivedImage(const cv::Mat &image, DerivedImage kind) const;
+
+        /**
+         * @brief Checks whether the current run was cancelled or passed its deadline.
+         * @return True if Process() should stop
+         * @note A node returning early must not leave partial results in its outputs; prefer ThrowIfStopRequested().
+         */
+        [[nodiscard]] bool IsStopRequested() const;
+
+        /**
+         * @brief Abandons Process() if the current run was cancelled or passed its deadline.
+         * @throws ExecutionStopped when stopping; the editor then keeps the node dirty and stops the run
+         * @note Call between units of work of long-running processing (e.g. row strips or iterations).
+         */
+        void ThrowIfStopRequested() const;
+
+        /**
+         * @brief Scales a kernel size to the current proxy run, so filters keep their extent in the scene.
+         * @param size Kernel size in full-resolution pixels
+         * @param minimum Smallest size to return (a size already below it is kept)
+         * @return size at full resolution; otherwise size times the proxy scale, rounded to the nearest odd
+         *         value and at least minimum
+         */
+        [[nodiscard]] int ScaleKernelSize(int size, int minimum = 1) const;
+
+        /**
+         * @brief Resolves parameters (enum names, kernels, validated values) into members, so Process() only
+         *        computes.
+         * @note Runs outside Process() and only after a parameter changed. Read the members through
+         *       GetPrepared(), as Process() may also be called without preparation. Does nothing by default.
+         */
+        virtual void Prepare();
+
+        /**
+         * @brief Returns state resolved by Prepare() if it matches the current parameters.
+         * @tparam T State type
+         * @tparam Resolve Callable returning T
+         * @param state Member set by Prepare()
+         * @param resolve Computes the state from the slots instead
+         * @return state, or resolve() if preparation is stale or the thread runs an ExecutionContext
+         */
+        template<typename T, typename Resolve> [[nodiscard]] T GetPrepared(const T &state, Resolve &&resolve) const
+        {
+            return IsPrepared() ? state : std::forward<Resolve>(resolve)();
+        }
+
+        /**
+         * @brief Checks whether members set by Prepare() hold the parameters of the calling thread's run.
+         * @return False if preparation is stale or the thread runs an ExecutionContext
+         */
+        [[nodiscard]] bool IsPrepared() const;
+
+        std::string name;                   ///< Name of the node
+        NodeId id;                          ///< Unique identifier of the node
+        std::pmr::vector<Slot> inputSlots;  ///< Input data slots, by SlotIndex
+        std::pmr::vector<Slot> outputSlots; ///< Output data slots, by SlotIndex
+        SlotNameTable slotNames;            ///< Slot names to SlotIndex, and execution pin names
+
+    private:
+        /**
+         * @brief Returns the stop condition of the run processing this node on the calling thread.
+         * @return Bound ExecutionContext's condition, otherwise the one from SetStopCondition()
+         */
+        [[nodiscard]] const StopCondition &GetActiveStopCondition() const;
+
+        std::atomic<bool> dirty{ true };                   ///< Needs re-execution (atomic: set by parallel workers)
+        std::atomic<bool> prepared{ false };               ///< Prepare() saw the current parameters
+        std::shared_ptr<ImageBufferPool> imagePool;        ///< Output image allocator (nullptr = OpenCV default)
+        std::shared_ptr<cv::MatAllocator> outputAllocator; ///< Replaces imagePool outside contexts (nullptr = none)
+        std::shared_ptr<DerivedImageCache> derivedImages;  ///< Shared derived images (nullptr = not shared)
+        StopCondition stopCondition;                       ///< Condition of the run processing this node
+        double proxyScale = 1.0;                           ///< Scale of the run processing this node
+        PrecisionPolicy precisionPolicy{};                 ///< Depth policy of the graph processing this node
+        mutable std::atomic<NodeTypeId> typeId{};          ///< Cached GetTypeId() (atomic: read by workers)
     };
 
     /**
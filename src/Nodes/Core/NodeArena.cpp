@@ -0,0 +1,81 @@
+#include "Nodes/Core/NodeArena.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        thread_local NodeArena *currentArena = nullptr;
+    } // namespace
+
+    NodeArena::Scope::Scope(std::shared_ptr<NodeArena> arena)
+        : arena(std::move(arena)), previous(std::exchange(currentArena, this->arena.get()))
+    {
+    }
+
+    NodeArena::Scope::~Scope()
+    {
+        currentArena = previous;
+    }
+
+    NodeArena::NodeArena() : chunks(Constants::Buffers::kNodeArenaInitialChunk), pool(&chunks)
+    {
+    }
+
+    std::shared_ptr<NodeArena> NodeArena::Create()
+    {
+        return std::shared_ptr<NodeArena>(new NodeArena(), [](NodeArena *arena) { arena->Release(); });
+    }
+
+    NodeArena *NodeArena::GetCurrent()
+    {
+        return currentArena;
+    }
+
+    std::pmr::memory_resource *NodeArena::GetCurrentResource()
+    {
+        return currentArena ? static_cast<std::pmr::memory_resource *>(currentArena)
+                            : std::pmr::new_delete_resource();
+    }
+
+    size_t NodeArena::GetLiveAllocations() const
+    {
+        // The owner handle holds one reference until the arena is dropped
+        return references.load(std::memory_order_acquire) - 1;
+    }
+
+    void *NodeArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        void *pointer = nullptr;
+        {
+            std::scoped_lock lock(mutex);
+            pointer = pool.allocate(bytes, alignment);
+        }
+        references.fetch_add(1, std::memory_order_relaxed);
+        return pointer;
+    }
+
+    void NodeArena::do_deallocate(void *pointer, size_t bytes, size_t alignment)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            pool.deallocate(pointer, bytes, alignment);
+        }
+        Release();
+    }
+
+    bool NodeArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    {
+        return this == &other;
+    }
+
+    void NodeArena::Release()
+    {
+        if (references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Per-graph memory for node objects and their slot and name containers.
+     *
+     * Building a graph otherwise allocates every node, slot vector and name table as its own small heap
+     * block. While a Scope is active on a thread, Node::operator new and the node's containers take memory
+     * from the scope's arena instead: a pool over large chunks, so allocations are carved from a few
+     * blocks and freed nodes' memory is reused by later ones.
+     *
+     * Nodes may outlive the graph that created them (undo history, run snapshots), so every live
+     * allocation keeps the arena alive, like ImageBufferPool keeps its buffers' pool alive. Once the owner
+     * handle and the last allocation are gone, all chunks are released at once.
+     *
+     * All methods are thread-safe; allocations may be freed from any thread.
+     */
+    class NodeArena final : public std::pmr::memory_resource
+    {
+    public:
+        /**
+         * @brief Makes a thread allocate nodes from an arena until the scope ends.
+         * @note Scopes nest; the previous arena is active again afterwards.
+         */
+        class Scope
+        {
+        public:
+            /**
+             * @brief Activates arena on the calling thread.
+             * @param arena Arena to allocate from (nullptr allocates from the heap)
+             */
+            explicit Scope(std::shared_ptr<NodeArena> arena);
+
+            /**
+             * @brief Restores the arena active before this scope.
+             */
+            ~Scope();
+
+            Scope(const Scope &) = delete;
+            Scope &operator=(const Scope &) = delete;
+
+        private:
+            std::shared_ptr<NodeArena> arena; ///< Kept alive while active
+            NodeArena *previous;              ///< Arena active before this scope
+        };
+
+        /**
+         * @brief Creates an arena.
+         * @return Owner handle; the arena lives until it and every allocation from it are released
+         */
+        [[nodiscard]] static std::shared_ptr<NodeArena> Create();
+
+        /**
+         * @brief Returns the arena of the innermost Scope on the calling thread.
+         * @return Arena, or nullptr outside any scope
+         */
+        [[nodiscard]] static NodeArena *GetCurrent();
+
+        /**
+         * @brief Returns the resource node containers created on the calling thread allocate from.
+         * @return Current arena, or std::pmr::new_delete_resource() outside any scope
+         */
+        [[nodiscard]] static std::pmr::memory_resource *GetCurrentResource();
+
+        /**
+         * @brief Returns the number of allocations not freed yet.
+         * @return Live allocation count
+         */
+        [[nodiscard]] size_t GetLiveAllocations() const;
+
+        NodeArena(const NodeArena &) = delete;
+        NodeArena &operator=(const NodeArena &) = delete;
+
+    private:
+        NodeArena();
+        ~NodeArena() override = default;
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *pointer, size_t bytes, size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+        /**
+         * @brief Drops one reference (the owner handle or an allocation), deleting the arena after the last.
+         */
+        void Release();
+
+        mutable std::mutex mutex;                    ///< Guards the pool and its chunks
+        std::pmr::monotonic_buffer_resource chunks;  ///< Large blocks the pool carves (freed all at once)
+        std::pmr::unsynchronized_pool_resource pool; ///< Size-class free lists over chunks
+        std::atomic<size_t> references{ 1 };         ///< Owner handle plus live allocations
+    };
+} // namespace VisionCraft::Nodes
@@ -1,8 +1,20 @@
 #pragma once
 
+#include "Nodes/Core/BitMask.h"
+#include "Nodes/Core/ChannelView.h"
+#include "Nodes/Core/ContourSet.h"
+#include "Nodes/Core/ImageBatch.h"
+#include "Nodes/Core/ImagePyramid.h"
+#include "Nodes/Core/PlanarImage.h"
 #include <opencv2/opencv.hpp>
+#if VISION_CRAFT_WITH_CUDA
+#include <opencv2/core/cuda.hpp>
+#endif
+#include <cstdint>
 #include <filesystem>
+#include <iterator>
 #include <string>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -22,7 +34,15 @@ namespace VisionCraft::Nodes
      * - bool: Boolean values (flags, toggles, etc.)
      * - std::string: Text data (filenames, labels, etc.)
      * - std::filesystem::path: File paths
-     * - std::vector<cv::Point>: Future support for contours, keypoints, etc.
+     * - std::vector<cv::Point>: A single point list (one polygon, keypoints)
+     * - cv::UMat: Images kept in device memory between nodes (see NodeEditor::SetDeviceExecution())
+     * - ChannelView: One channel of an interleaved image, shared without a copy (SplitChannelsNode)
+     * - PlanarImage: Multi-channel image stored as one plane per channel (see Node::GetPreferredImageLayout())
+     * - ImagePyramid: Image with lazily built half-size levels (see Node::AcceptsImagePyramids())
+     * - BitMask: Binary mask packed one bit per pixel (see Node::AcceptsBitMasks())
+     * - ContourSet: Any number of contours in one flat point buffer (FindContoursNode)
+     * - ImageBatch: Same-shaped images in one buffer, processed by one node call (see Node::ProcessBatch())
+     * - cv::cuda::GpuMat: Images in CUDA memory, read by CUDA nodes (only with VISION_CRAFT_WITH_CUDA)
      *
      * @note std::variant is stack-allocated and has zero runtime overhead compared to dynamic_cast
      * @note Adding types here requires recompilation but does NOT require modifying NodeEditor
@@ -35,7 +55,123 @@ namespace VisionCraft::Nodes
         bool,                                     // Boolean values
         std::string,                              // Text data
         std::filesystem::path,                    // File paths
-        std::vector<cv::Point>                    // Contours, keypoints (future)
+        std::vector<cv::Point>,                   // Single point lists
+        cv::UMat,                                 // Device-resident images (OpenCL T-API)
+        ChannelView,                              // Single channel of an interleaved image
+        PlanarImage,                              // Images stored one plane per channel
+        ImagePyramid,                             // Images with lazily built reduced levels
+        BitMask,                                  // Binary masks packed one bit per pixel
+        ContourSet,                               // Contours sharing one point buffer
+        ImageBatch                                // Same-shaped images in one buffer
+#if VISION_CRAFT_WITH_CUDA
+        ,
+        cv::cuda::GpuMat // Images in CUDA memory
+#endif
         >;
 
+    /**
+     * @brief Memory a node reads its input images from.
+     */
+    enum class ImageMemory
+    {
+        Host,   ///< cv::Mat
+        OpenCL, ///< cv::UMat (NodeEditor::SetDeviceExecution())
+        Cuda    ///< cv::cuda::GpuMat (CUDA nodes)
+    };
+
+    /**
+     * @brief Channel layout a node reads its input images in.
+     */
+    enum class ImageLayout
+    {
+        Interleaved, ///< cv::Mat with channels interleaved per pixel (BGRBGR...)
+        Planar,      ///< PlanarImage with one plane per channel
+        Any          ///< Either; images arrive in the layout their producer wrote
+    };
+
+    /**
+     * @brief Kind of value a slot declares it carries, checked across connections when a plan is compiled.
+     *
+     * Every image representation (cv::Mat, cv::UMat, ChannelView, PlanarImage, ImagePyramid, BitMask,
+     * cv::cuda::GpuMat) is one kind, since NodeEditor converts between them while passing data; an ImageBatch
+     * is an image too, since any image node runs for it (see Node::ProcessBatch()). Numbers are distinct
+     * kinds: a node reading an int falls back to its default when a double arrives.
+     */
+    enum class SlotDataType : uint8_t
+    {
+        Any,      ///< Undeclared or accepts several kinds; matches everything
+        Image,    ///< Any image representation
+        Double,   ///< double
+        Float,    ///< float
+        Int,      ///< int
+        Bool,     ///< bool
+        String,   ///< std::string
+        Path,     ///< std::filesystem::path
+        Points,   ///< std::vector<cv::Point>
+        Contours  ///< ContourSet
+    };
+
+    /**
+     * @brief Returns the slot data kind of a NodeData alternative.
+     * @tparam T Alternative of NodeData
+     * @return Kind values of T belong to (Any for std::monostate)
+     */
+    template<typename T> [[nodiscard]] constexpr SlotDataType SlotDataTypeOf()
+    {
+        if constexpr (std::is_same_v<T, double>)
+            return SlotDataType::Double;
+        else if constexpr (std::is_same_v<T, float>)
+            return SlotDataType::Float;
+        else if constexpr (std::is_same_v<T, int>)
+            return SlotDataType::Int;
+        else if constexpr (std::is_same_v<T, bool>)
+            return SlotDataType::Bool;
+        else if constexpr (std::is_same_v<T, std::string>)
+            return SlotDataType::String;
+        else if constexpr (std::is_same_v<T, std::filesystem::path>)
+            return SlotDataType::Path;
+        else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+            return SlotDataType::Points;
+        else if constexpr (std::is_same_v<T, ContourSet>)
+            return SlotDataType::Contours;
+        else if constexpr (std::is_same_v<T, std::monostate>)
+            return SlotDataType::Any;
+        else
+            return SlotDataType::Image;
+    }
+
+    /**
+     * @brief Returns the slot data kind of a value.
+     * @param data Value to classify
+     * @return Kind of the held alternative (Any if empty)
+     */
+    [[nodiscard]] inline SlotDataType GetSlotDataType(const NodeData &data)
+    {
+        return std::visit([](const auto &value) { return SlotDataTypeOf<std::decay_t<decltype(value)>>(); }, data);
+    }
+
+    /**
+     * @brief Checks if an output of one kind can feed an input of another.
+     * @param from Kind the producer's output declares
+     * @param to Kind the consumer's input declares
+     * @return True if either side is Any or both are the same kind
+     */
+    [[nodiscard]] constexpr bool AreSlotDataTypesCompatible(SlotDataType from, SlotDataType to)
+    {
+        return from == SlotDataType::Any || to == SlotDataType::Any || from == to;
+    }
+
+    /**
+     * @brief Returns the display name of a slot data kind.
+     * @param type Kind to name
+     * @return Lower-case name, e.g. "image"
+     */
+    [[nodiscard]] constexpr const char *GetSlotDataTypeName(SlotDataType type)
+    {
+        constexpr const char *kNames[] = { "any", "image", "double", "float", "int", "bool", "string", "path",
+            "points", "contours" };
+        const auto index = static_cast<size_t>(type);
+        return index < std::size(kNames) ? kNames[index] : "unknown";
+    }
+
 } // namespace VisionCraft::Nodes
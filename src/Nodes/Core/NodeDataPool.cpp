@@ -0,0 +1,70 @@
+#include "Nodes/Core/NodeDataPool.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <new>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    NodeDataPool &NodeDataPool::Get()
+    {
+        static auto *pool = new NodeDataPool();
+        return *pool;
+    }
+
+    std::shared_ptr<const NodeData> NodeDataPool::Make(NodeData data)
+    {
+        return std::allocate_shared<const NodeData>(Allocator<NodeData>(this), std::move(data));
+    }
+
+    size_t NodeDataPool::GetIdleBlocks() const
+    {
+        std::scoped_lock lock(mutex);
+        return idleCount;
+    }
+
+    void *NodeDataPool::Take(size_t bytes, size_t alignment)
+    {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return ::operator new(bytes, std::align_val_t(alignment));
+        }
+
+        {
+            std::scoped_lock lock(mutex);
+            if (blockSize == 0 && bytes >= sizeof(FreeBlock))
+            {
+                blockSize = bytes;
+            }
+            if (bytes == blockSize && idle)
+            {
+                auto *block = idle;
+                idle = block->next;
+                --idleCount;
+                return block;
+            }
+        }
+        return ::operator new(bytes);
+    }
+
+    void NodeDataPool::Return(void *block, size_t bytes, size_t alignment)
+    {
+        if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            ::operator delete(block, std::align_val_t(alignment));
+            return;
+        }
+
+        {
+            std::scoped_lock lock(mutex);
+            if (bytes == blockSize && idleCount < Constants::Buffers::kMaxIdleNodeDataBlocks)
+            {
+                idle = new (block) FreeBlock{ idle };
+                ++idleCount;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+} // namespace VisionCraft::Nodes
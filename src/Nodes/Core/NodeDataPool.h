@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Nodes/Core/NodeData.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Recycles the memory behind NodeData handles.
+     *
+     * Every value written to a slot gets a new handle, since the previous one may still be read downstream.
+     * Handles from Make() hold their control block and value in one fixed-size block taken from a free list
+     * instead of the heap, and the block returns to the list when the last reference goes. A graph running
+     * over and over thus cycles through the same few blocks, and its runs do not allocate for slot values.
+     *
+     * Idle blocks are kept up to Constants::Buffers::kMaxIdleNodeDataBlocks; blocks returned beyond it are
+     * freed. All methods are thread-safe; handles may be released from any thread.
+     */
+    class NodeDataPool
+    {
+    public:
+        /**
+         * @brief Returns the process-wide pool.
+         * @return Pool (never destroyed, as handles may be released during static destruction)
+         */
+        [[nodiscard]] static NodeDataPool &Get();
+
+        /**
+         * @brief Makes a handle whose block comes from the pool.
+         * @param data Value to store
+         * @return Handle, released to the pool with its last reference
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> Make(NodeData data);
+
+        /**
+         * @brief Returns the number of idle blocks.
+         * @return Blocks waiting for reuse
+         */
+        [[nodiscard]] size_t GetIdleBlocks() const;
+
+        NodeDataPool(const NodeDataPool &) = delete;
+        NodeDataPool &operator=(const NodeDataPool &) = delete;
+
+    private:
+        /**
+         * @brief Allocator std::allocate_shared() rebinds to its control block type.
+         * @tparam T Type allocated
+         */
+        template<typename T> struct Allocator
+        {
+            using value_type = T;
+
+            NodeDataPool *pool; ///< Pool the blocks come from
+
+            explicit Allocator(NodeDataPool *pool) : pool(pool)
+            {
+            }
+
+            template<typename U> Allocator(const Allocator<U> &other) : pool(other.pool)
+            {
+            }
+
+            T *allocate(size_t count)
+            {
+                return static_cast<T *>(pool->Take(sizeof(T) * count, alignof(T)));
+            }
+
+            void deallocate(T *block, size_t count)
+            {
+                pool->Return(block, sizeof(T) * count, alignof(T));
+            }
+
+            template<typename U> bool operator==(const Allocator<U> &other) const
+            {
+                return pool == other.pool;
+            }
+        };
+
+        /**
+         * @brief Idle block, linked through its own memory.
+         */
+        struct FreeBlock
+        {
+            FreeBlock *next; ///< Next idle block
+        };
+
+        NodeDataPool() = default;
+
+        /**
+         * @brief Takes an idle block, or allocates one.
+         * @param bytes Size requested
+         * @param alignment Alignment requested
+         * @return Block of at least bytes
+         */
+        void *Take(size_t bytes, size_t alignment);
+
+        /**
+         * @brief Returns a block from Take().
+         * @param block Block to return
+         * @param bytes Size it was taken with
+         * @param alignment Alignment it was taken with
+         */
+        void Return(void *block, size_t bytes, size_t alignment);
+
+        mutable std::mutex mutex;  ///< Guards members below
+        size_t blockSize = 0;      ///< Size of pooled blocks (fixed by the first request, as all handles match)
+        FreeBlock *idle = nullptr; ///< Idle blocks
+        size_t idleCount = 0;      ///< Blocks in idle
+    };
+
+} // namespace VisionCraft::Nodes
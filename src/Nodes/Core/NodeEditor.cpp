@@ -1,20 +1,455 @@
 #include "Nodes/Core/NodeEditor.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/ColorLut.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/GraphBinaryFormat.h"
+#include "Nodes/Core/GraphJsonReader.h"
+#include "Nodes/Core/MappedFile.h"
+#include "Nodes/Core/MemoryBudget.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Nodes/Core/ThreadBudget.h"
+#include "Nodes/Core/Tracer.h"
+#include "Nodes/Core/WriteBehindQueue.h"
 #include "Vision/Factory/NodeFactory.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <queue>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <variant>
 
 namespace VisionCraft::Nodes
 {
+    namespace
+    {
+        // Bytes held by the slot's data (defaults and empty slots hold none)
+        size_t SlotBytes(const Slot &slot)
+        {
+            const auto data = slot.GetSharedData();
+            return data ? NodeOutputCache::EstimateBytes(*data) : 0;
+        }
+
+        // Folds the next edit into a transaction's delta; a wire added and removed again cancels out
+        void AppendConnectionDelta(ConnectionDelta &pending, const ConnectionDelta &next)
+        {
+            if (next.reset)
+            {
+                pending = { .reset = true };
+            }
+            for (const auto &c : next.removed)
+            {
+                if (const auto it = std::ranges::find(pending.added, c); it != pending.added.end())
+                {
+                    pending.added.erase(it);
+                }
+                else if (!pending.reset)
+                {
+                    pending.removed.push_back(c);
+                }
+            }
+            for (const auto &c : next.added)
+            {
+                if (const auto it = std::ranges::find(pending.removed, c); it != pending.removed.end())
+                {
+                    pending.removed.erase(it);
+                }
+                else
+                {
+                    pending.added.push_back(c);
+                }
+            }
+        }
+
+        void LogStopped(const StopCondition &stop, const char *what)
+        {
+            if (stop.IsCancelled())
+            {
+                LOG_WARN("{} cancelled by user", what);
+            }
+            else
+            {
+                LOG_WARN("{} stopped at its deadline", what);
+            }
+        }
+
+        // Locks mutex, tracing the wait only when another thread holds it
+        template<typename Mutex> std::unique_lock<Mutex> LockTraced(Mutex &mutex, const char *name)
+        {
+            std::unique_lock lock(mutex, std::try_to_lock);
+            if (!lock.owns_lock())
+            {
+                TraceScope wait("lock", name);
+                lock.lock();
+            }
+            return lock;
+        }
+
+        // Grows rect by margin on every side, clipped to the image
+        cv::Rect ExpandRect(const cv::Rect &rect, int margin, const cv::Size &size)
+        {
+            const int left = std::max(0, rect.x - margin);
+            const int top = std::max(0, rect.y - margin);
+            const int right = std::min(size.width, rect.x + rect.width + margin);
+            const int bottom = std::min(size.height, rect.y + rect.height + margin);
+            return cv::Rect(left, top, right - left, bottom - top);
+        }
+
+        // Replaces runs of two or more color transforms by one table lookup each; returns the steps each
+        // remaining operation stands for
+        std::vector<size_t> CollapseColorTransforms(
+            ColorLutCache &tables, int inputType, size_t pixels, std::vector<TileOperation> &operations)
+        {
+            std::vector<TileOperation> collapsed;
+            std::vector<size_t> steps;
+            int type = inputType;
+            for (size_t k = 0; k < operations.size();)
+            {
+                size_t end = k;
+                while (end < operations.size() && ColorLut::IsColorTransformRun(std::span(&operations[end], 1)))
+                {
+                    ++end;
+                }
+
+                // A 2^24-entry table only pays for itself on large images; 256 gray levels always do
+                const bool worthwhile = CV_MAT_CN(type) == 1 || pixels >= Constants::Tiling::kMinColorLutPixels;
+                const auto table = end - k >= 2 && ColorLut::SupportsInput(type) && worthwhile
+                                       ? tables.Get(type, std::span(operations).subspan(k, end - k))
+                                       : nullptr;
+                if (table)
+                {
+                    type = table->GetOutputType();
+                    collapsed.push_back(TileOperation{ .halo = 0,
+                        .outputType = type,
+                        .apply = [table](const cv::Mat &tile) { return table->Apply(tile); } });
+                    steps.push_back(end - k);
+                    k = end;
+                    continue;
+                }
+
+                type = operations[k].outputType;
+                collapsed.push_back(std::move(operations[k]));
+                steps.push_back(1);
+                ++k;
+            }
+            operations = std::move(collapsed);
+            return steps;
+        }
+
+        // Whether a region operation's scale keeps whole input steps on whole output pixels
+        bool IsRegionScale(double scale)
+        {
+            if (!(scale > 0.0))
+            {
+                return false;
+            }
+            const double steps = scale >= 1.0 ? scale : 1.0 / scale;
+            return steps == std::round(steps);
+        }
+
+        // Image size after a region operation (rounded as cv::resize rounds)
+        cv::Size ScaleSize(const cv::Size &size, const RegionOperation &operation)
+        {
+            return cv::Size(static_cast<int>(std::lrint(size.width * operation.scaleX)),
+                static_cast<int>(std::lrint(size.height * operation.scaleY)));
+        }
+
+        // Input span one axis of a region operation reads for output span [first, last), and the output
+        // coordinate its result starts at; the span starts on a whole input step so the result lines up
+        // with the operation's full-image output
+        struct RegionSpan
+        {
+            int begin = 0;  ///< First input pixel
+            int end = 0;    ///< One past the last input pixel
+            int origin = 0; ///< Output pixel the result starts at
+        };
+
+        RegionSpan MapRegionSpan(int first, int last, double scale, int halo, int length)
+        {
+            if (scale >= 1.0)
+            {
+                const int factor = static_cast<int>(scale);
+                const int begin = std::max(0, first / factor - halo);
+                return { begin, std::min(length, (last + factor - 1) / factor + halo), begin * factor };
+            }
+            const int step = static_cast<int>(std::lround(1.0 / scale));
+            const int begin = std::max(0, first * step - halo) / step * step;
+            return { begin, std::min(length, last * step + halo), begin / step };
+        }
+
+        // Host copy of a device image; host images and other data are returned as is
+        std::shared_ptr<const NodeData> DownloadImage(std::shared_ptr<const NodeData> data)
+        {
+            if (const auto *umat = std::get_if<cv::UMat>(data.get()))
+            {
+                TraceScope trace("gpu", "Download");
+                cv::Mat image;
+                umat->copyTo(image);
+                return std::make_shared<const NodeData>(std::move(image));
+            }
+#if VISION_CRAFT_WITH_CUDA
+            if (const auto *gpuMat = std::get_if<cv::cuda::GpuMat>(data.get()))
+            {
+                TraceScope trace("gpu", "Download");
+                cv::Mat image;
+                gpuMat->download(image);
+                return std::make_shared<const NodeData>(std::move(image));
+            }
+#endif
+            return data;
+        }
+
+        // Converts an image to the channel layout the consumer reads; images already in it are shared as is
+        std::shared_ptr<const NodeData> ArrangeChannels(std::shared_ptr<const NodeData> data, ImageLayout layout)
+        {
+            if (const auto *planar = std::get_if<PlanarImage>(data.get()); planar && layout == ImageLayout::Interleaved)
+            {
+                TraceScope trace("layout", "Interleave");
+                return std::make_shared<const NodeData>(planar->ToInterleaved());
+            }
+            if (const auto *mat = std::get_if<cv::Mat>(data.get()); mat && layout == ImageLayout::Planar)
+            {
+                TraceScope trace("layout", "Deinterleave");
+                return std::make_shared<const NodeData>(PlanarImage::FromInterleaved(*mat));
+            }
+            return data;
+        }
+
+        // Moves an image to the memory and layout the consumer reads; other data is shared as is. Channel
+        // views reach only consumers that read them in place; everyone else gets the channel as its own image.
+        // Pyramids likewise reach only consumers that sample them; everyone else gets the full-resolution image.
+        // Half-float images (PrecisionPolicy::Prefer16) are widened to CV_32F for consumers that cannot read them,
+        // and bit masks unpacked to 0/255 bytes for consumers that do not read them packed.
+        std::shared_ptr<const NodeData> PlaceImage(std::shared_ptr<const NodeData> data,
+            ImageMemory memory,
+            ImageLayout layout,
+            bool acceptsChannelViews,
+            bool acceptsImagePyramids,
+            bool acceptsHalfFloatImages,
+            bool acceptsBitMasks)
+        {
+            if (const auto *view = std::get_if<ChannelView>(data.get()); view && !acceptsChannelViews)
+            {
+                data = std::make_shared<const NodeData>(view->Extract());
+            }
+            if (const auto *pyramid = std::get_if<ImagePyramid>(data.get()); pyramid && !acceptsImagePyramids)
+            {
+                data = std::make_shared<const NodeData>(pyramid->GetBase());
+            }
+            if (const auto *mask = std::get_if<BitMask>(data.get()); mask && !acceptsBitMasks)
+            {
+                TraceScope trace("mask", "Unpack");
+                data = std::make_shared<const NodeData>(mask->ToImage());
+            }
+            if (const auto *mat = std::get_if<cv::Mat>(data.get());
+                mat && mat->depth() == CV_16F && !acceptsHalfFloatImages)
+            {
+                TraceScope trace("precision", "Widen half floats");
+                cv::Mat widened;
+                mat->convertTo(widened, CV_32F);
+                data = std::make_shared<const NodeData>(std::move(widened));
+            }
+            data = ArrangeChannels(std::move(data), layout);
+
+            switch (memory)
+            {
+            case ImageMemory::OpenCL:
+                if (!std::holds_alternative<cv::UMat>(*data))
+                {
+                    data = DownloadImage(std::move(data));
+                    if (const auto *mat = std::get_if<cv::Mat>(data.get()))
+                    {
+                        TraceScope trace("gpu", "Upload");
+                        cv::UMat image;
+                        mat->copyTo(image);
+                        return std::make_shared<const NodeData>(std::move(image));
+                    }
+                }
+                return data;
+#if VISION_CRAFT_WITH_CUDA
+            case ImageMemory::Cuda:
+                if (!std::holds_alternative<cv::cuda::GpuMat>(*data))
+                {
+                    data = DownloadImage(std::move(data));
+                    if (const auto *mat = std::get_if<cv::Mat>(data.get()))
+                    {
+                        TraceScope trace("gpu", "Upload");
+                        cv::cuda::GpuMat image;
+                        image.upload(*mat);
+                        return std::make_shared<const NodeData>(std::move(image));
+                    }
+                }
+                return data;
+#endif
+            default:
+                return DownloadImage(std::move(data));
+            }
+        }
+
+        // Converts a slot default to JSON; images and empty values are runtime data and are not saved
+        std::optional<nlohmann::json> DefaultToJson(const NodeData &value)
+        {
+            return std::visit(
+                [](const auto &alternative) -> std::optional<nlohmann::json> {
+                    using T = std::decay_t<decltype(alternative)>;
+                    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float> || std::is_same_v<T, int>
+                                  || std::is_same_v<T, bool> || std::is_same_v<T, std::string>)
+                    {
+                        return nlohmann::json(alternative);
+                    }
+                    else if constexpr (std::is_same_v<T, std::filesystem::path>)
+                    {
+                        return nlohmann::json(alternative.string());
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+                    {
+                        nlohmann::json points = nlohmann::json::array();
+                        for (const auto &point : alternative)
+                        {
+                            points.push_back({ point.x, point.y });
+                        }
+                        return points;
+                    }
+                    else
+                    {
+                        return std::nullopt;
+                    }
+                },
+                value);
+        }
+
+        // Converts a saved JSON default to the alternative the slot's current default holds
+        std::optional<NodeData> DefaultFromJson(const nlohmann::json &value, const NodeData &current)
+        {
+            return std::visit(
+                [&value](const auto &alternative) -> std::optional<NodeData> {
+                    using T = std::decay_t<decltype(alternative)>;
+                    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float> || std::is_same_v<T, int>)
+                    {
+                        return value.is_number() ? std::optional<NodeData>(value.get<T>()) : std::nullopt;
+                    }
+                    else if constexpr (std::is_same_v<T, bool>)
+                    {
+                        return value.is_boolean() ? std::optional<NodeData>(value.get<bool>()) : std::nullopt;
+                    }
+                    else if constexpr (std::is_same_v<T, std::string>)
+                    {
+                        return value.is_string() ? std::optional<NodeData>(value.get<std::string>()) : std::nullopt;
+                    }
+                    else if constexpr (std::is_same_v<T, std::filesystem::path>)
+                    {
+                        return value.is_string() ? std::optional<NodeData>(T(value.get<std::string>())) : std::nullopt;
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+                    {
+                        if (!value.is_array())
+                        {
+                            return std::nullopt;
+                        }
+                        T points;
+                        points.reserve(value.size());
+                        for (const auto &point : value)
+                        {
+                            if (!point.is_array() || point.size() != 2 || !point[0].is_number_integer()
+                                || !point[1].is_number_integer())
+                            {
+                                return std::nullopt;
+                            }
+                            points.emplace_back(point[0].get<int>(), point[1].get<int>());
+                        }
+                        return points;
+                    }
+                    else
+                    {
+                        return std::nullopt;
+                    }
+                },
+                current);
+        }
 
-    NodeEditor::NodeEditor() : nextId(1)
+        // Restores a saved slot default; values whose type no longer matches the slot's default are dropped
+        void RestoreSlotDefault(Node &node, const std::string &slotName, NodeData value)
+        {
+            if (!node.HasInputSlot(slotName))
+            {
+                LOG_WARN("Node {} has no input slot '{}' - skipping saved default", node.GetName(), slotName);
+                return;
+            }
+
+            const auto current = node.GetInputSlot(slotName).GetSharedDefaultValue();
+            if (current && current->index() != value.index())
+            {
+                LOG_WARN("Saved default of {}.{} has a different type - skipping", node.GetName(), slotName);
+                return;
+            }
+            node.SetInputSlotDefault(slotName, std::move(value));
+        }
+
+        // Slot of one node
+        using SlotKey = std::pair<NodeId, SlotName>;
+
+        struct SlotKeyHash
+        {
+            size_t operator()(const SlotKey &key) const noexcept
+            {
+                return std::hash<SlotName>{}(key.second) * 31 + std::hash<NodeId>{}(key.first);
+            }
+        };
+
+        // AddConnection() removes earlier connections that a new one conflicts with, so a connection survives
+        // exactly when no later one conflicts: data wires claim their input slot from every connection,
+        // execution wires claim both ends from other execution wires
+        std::vector<bool> FindSurvivingConnections(const std::vector<Connection> &connections)
+        {
+            std::unordered_set<SlotKey, SlotKeyHash> dataInputs;
+            std::unordered_set<SlotKey, SlotKeyHash> executionInputs;
+            std::unordered_set<SlotKey, SlotKeyHash> executionOutputs;
+            std::vector<bool> keep(connections.size());
+            for (size_t i = connections.size(); i-- > 0;)
+            {
+                const auto &connection = connections[i];
+                const SlotKey input{ connection.to, connection.toSlot };
+                const SlotKey output{ connection.from, connection.fromSlot };
+                if (connection.type == ConnectionType::Execution)
+                {
+                    keep[i] = !dataInputs.contains(input) && !executionInputs.contains(input)
+                              && !executionOutputs.contains(output);
+                    executionInputs.insert(input);
+                    executionOutputs.insert(output);
+                }
+                else
+                {
+                    keep[i] = !dataInputs.contains(input);
+                    dataInputs.insert(input);
+                }
+            }
+            return keep;
+        }
+    } // namespace
+
+    NodeEditor::NodeEditor()
+        : nextId(1), outputCache(Constants::Cache::kDefaultOutputCacheBytes),
+          colorLuts(Constants::Tiling::kColorLutCacheEntries),
+          imagePool(std::make_shared<ImageBufferPool>(Constants::Buffers::kDefaultIdleImageBytes)),
+          derivedImages(std::make_shared<DerivedImageCache>(Constants::Cache::kDerivedImageEntries)),
+          nodeArena(NodeArena::Create()), executionStatistics(Constants::Profiling::kRunHistoryCapacity),
+          executor(std::make_shared<ExecutorService>())
     {
+        outputCache.SetCompressedTierBudget(Constants::Cache::kDefaultCompressedCacheBytes);
     }
 
     NodeEditor::~NodeEditor()
@@ -35,29 +470,52 @@ namespace VisionCraft::Nodes
             nextId = id + 1;
         }
 
+        const bool replaced = nodes.contains(id);
+        node->SetImageBufferPool(imagePool);
+        node->SetDerivedImageCache(derivedImages);
         nodes[id] = std::move(node);
-        InvalidateExecutionPlan(); // Graph structure changed
+        PatchPlanForAddedNode(id, replaced); // Graph structure changed
 
         return id;
     }
 
     bool NodeEditor::RemoveNode(NodeId id)
     {
-        std::scoped_lock lock(graphMutex);
+        return DetachNode(id) != nullptr;
+    }
+
+    NodePtr NodeEditor::DetachNode(NodeId id)
+    {
+        std::unique_lock lock(graphMutex);
         auto it = nodes.find(id);
         if (it == nodes.end())
         {
-            return false;
+            return nullptr;
         }
 
+        NodePtr node = std::move(it->second);
         nodes.erase(it);
+        ConnectionDelta delta;
+        for (const auto &c : connections)
+        {
+            if (c.from == id)
+            {
+                MarkNodeDirty(c.to); // Lost an upstream input
+            }
+            if (c.from == id || c.to == id)
+            {
+                delta.removed.push_back(c);
+            }
+        }
         connections.erase(std::remove_if(connections.begin(),
                               connections.end(),
                               [id](const Connection &c) { return c.from == id || c.to == id; }),
             connections.end());
 
         InvalidateExecutionPlan(); // Graph structure changed
-        return true;
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
+        return node;
     }
 
     Node *NodeEditor::GetNode(NodeId id)
@@ -82,60 +540,115 @@ namespace VisionCraft::Nodes
         return std::vector<NodeId>(keys.begin(), keys.end());
     }
 
-    void NodeEditor::AddConnection(NodeId from,
-        const std::string &fromSlot,
-        NodeId to,
-        const std::string &toSlot,
-        ConnectionType type)
+    std::shared_ptr<const GraphView> NodeEditor::GetGraphView() const
     {
         std::scoped_lock lock(graphMutex);
+        if (view && view->version == graphVersion)
+        {
+            return view;
+        }
+
+        auto next = std::make_shared<GraphView>();
+        next->version = graphVersion;
+        next->nodeIds.reserve(nodes.size());
+        std::ranges::copy(nodes | std::views::keys, std::back_inserter(next->nodeIds));
+        std::ranges::sort(next->nodeIds);
+        next->connections = connections;
+        view = std::move(next);
+        return view;
+    }
+
+    void NodeEditor::AddConnection(NodeId from, SlotName fromSlot, NodeId to, SlotName toSlot, ConnectionType type)
+    {
+        std::unique_lock lock(graphMutex);
+        std::optional<size_t> erased;
+        Connection erasedConnection{};
+        bool patchable = type == ConnectionType::Data;
+        ConnectionDelta delta;
 
         // Enforce 1:1 for execution connections to prevent cycles
         if (type == ConnectionType::Execution)
         {
-            connections.erase(std::remove_if(connections.begin(),
-                                  connections.end(),
-                                  [&](const Connection &c) {
-                                      return c.type == ConnectionType::Execution
-                                             && (c.from == from && c.fromSlot == fromSlot);
-                                  }),
-                connections.end());
-
-            connections.erase(std::remove_if(connections.begin(),
-                                  connections.end(),
-                                  [&](const Connection &c) {
-                                      return c.type == ConnectionType::Execution && (c.to == to && c.toSlot == toSlot);
-                                  }),
-                connections.end());
+            const auto sharesEnd = [&](const Connection &c) {
+                return c.type == ConnectionType::Execution
+                       && ((c.from == from && c.fromSlot == fromSlot) || (c.to == to && c.toSlot == toSlot));
+            };
+
+            // The node losing its incoming execution wire changes position in the flow
+            for (const auto &c : connections)
+            {
+                if (c.type == ConnectionType::Execution && c.from == from && c.fromSlot == fromSlot)
+                {
+                    MarkNodeDirty(c.to);
+                }
+                if (sharesEnd(c))
+                {
+                    delta.removed.push_back(c);
+                }
+            }
+
+            std::erase_if(connections, sharesEnd);
         }
         else
         {
             // Data connections: 1:N (one input, many outputs)
-            connections.erase(std::remove_if(connections.begin(),
-                                  connections.end(),
-                                  [&](const Connection &c) { return c.to == to && c.toSlot == toSlot; }),
-                connections.end());
+            const auto feedsSlot = [&](const Connection &c) { return c.to == to && c.toSlot == toSlot; };
+            const auto replaced = std::ranges::find_if(connections, feedsSlot);
+            if (replaced != connections.end())
+            {
+                erased = static_cast<size_t>(replaced - connections.begin());
+                erasedConnection = *replaced;
+            }
+            std::ranges::copy_if(connections, std::back_inserter(delta.removed), feedsSlot);
+            patchable = std::erase_if(connections, feedsSlot) <= 1;
         }
 
         connections.push_back({ .from = from, .fromSlot = fromSlot, .to = to, .toSlot = toSlot, .type = type });
-        InvalidateExecutionPlan();
+        delta.added.push_back(connections.back());
+        MarkNodeDirty(to);
+        if (patchable)
+        {
+            PatchPlanForDataConnection(erased, erasedConnection, true);
+        }
+        else
+        {
+            InvalidateExecutionPlan();
+        }
+
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
     }
 
-    bool NodeEditor::RemoveConnection(NodeId from, const std::string &fromSlot, NodeId to, const std::string &toSlot)
+    bool NodeEditor::RemoveConnection(NodeId from, SlotName fromSlot, NodeId to, SlotName toSlot)
     {
-        std::scoped_lock lock(graphMutex);
-        auto it = std::remove_if(connections.begin(), connections.end(), [&](const Connection &c) {
+        std::unique_lock lock(graphMutex);
+        const auto matches = [&](const Connection &c) {
             return c.from == from && c.fromSlot == fromSlot && c.to == to && c.toSlot == toSlot;
-        });
-
+        };
+        const auto it = std::ranges::find_if(connections, matches);
         if (it == connections.end())
         {
             return false;
         }
 
-        connections.erase(it, connections.end());
-        InvalidateExecutionPlan(); // Graph structure changed
+        // A single removed data connection is patched into the plan; duplicates are rebuilt
+        const auto erased = static_cast<size_t>(it - connections.begin());
+        const auto erasedConnection = *it;
+        ConnectionDelta delta;
+        std::ranges::copy_if(connections, std::back_inserter(delta.removed), matches);
+        const bool patchable = std::erase_if(connections, matches) == 1;
+        MarkNodeDirty(to);
+        if (patchable)
+        {
+            PatchPlanForDataConnection(erased, erasedConnection, false);
+        }
+        else
+        {
+            InvalidateExecutionPlan(); // Graph structure changed
+        }
 
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
         return true;
     }
 
@@ -145,449 +658,4355 @@ namespace VisionCraft::Nodes
         return connections; // Returns a copy for thread safety
     }
 
-    void NodeEditor::Clear()
-    {
-        std::scoped_lock lock(graphMutex);
-        nodes.clear();
-        connections.clear();
-        nextId = 1;
-        InvalidateExecutionPlan(); // Graph structure changed
-    }
-
-    bool NodeEditor::Execute(const ExecutionProgressCallback &progressCallback, std::stop_token stopToken)
+    size_t NodeEditor::InsertGraph(std::vector<NodePtr> newNodes, std::vector<Connection> newConnections)
     {
         std::unique_lock lock(graphMutex);
-
-        // If running synchronously (no external token), reset stopSource to allow fresh cancellation
-        if (!stopToken.stop_possible())
-        {
-            stopSource = std::stop_source();
-        }
-
-        LOG_INFO("Executing graph with {} nodes", nodes.size());
-
-        // Use cached execution plan (compilation phase)
-        if (!executionPlanValid)
+        nodes.reserve(nodes.size() + newNodes.size());
+        for (auto &node : newNodes)
         {
-            cachedExecutionPlan = BuildExecutionPlan();
-            if (cachedExecutionPlan.empty() && !nodes.empty())
+            if (!node)
             {
-                LOG_ERROR("Failed to build execution plan (cycle detected)");
-                return false;
+                continue;
             }
-            executionPlanValid = true;
+            const NodeId id = node->GetId();
+            nextId = std::max(nextId, id + 1);
+            node->SetImageBufferPool(imagePool);
+            node->SetDerivedImageCache(derivedImages);
+            nodes[id] = std::move(node);
         }
 
-        LOG_INFO("Executing {} steps from cached plan", cachedExecutionPlan.size());
-
-        // Create execution frame
-        ExecutionFrame frame;
-        frame.startTime = std::chrono::high_resolution_clock::now();
-        int totalNodes = static_cast<int>(cachedExecutionPlan.size());
+        std::erase_if(newConnections,
+            [this](const Connection &c) { return !nodes.contains(c.from) || !nodes.contains(c.to); });
+        const size_t existingCount = connections.size();
+        connections.reserve(existingCount + newConnections.size());
+        std::ranges::move(newConnections, std::back_inserter(connections));
 
-        // Execute using frame with lookahead advancement
-        while (!frame.IsFinished(cachedExecutionPlan))
+        // New wires change their target's inputs, and so do replaced ones, as after AddConnection()
+        const auto keep = FindSurvivingConnections(connections);
+        ConnectionDelta delta;
+        size_t added = 0;
+        size_t kept = 0;
+        for (size_t i = 0; i < connections.size(); ++i)
         {
-            if (stopToken.stop_requested() || stopSource.stop_requested())
+            const bool inserted = i >= existingCount;
+            if (inserted == keep[i])
             {
-                LOG_WARN("Graph execution cancelled by user");
-                return false;
-            }
-
-            // LOOKAHEAD ADVANCEMENT: Advance instruction pointer BEFORE execution
-            frame.AdvanceToNext(cachedExecutionPlan);
-
-            const auto &step = *frame.currentStep;
-
-            // Direct node lookup (no function call overhead)
-            auto it = nodes.find(step.nodeId);
-            if (it == nodes.end())
-                continue;
-            Node *node = it->second.get();
-
-            if (progressCallback)
-            {
-                progressCallback(static_cast<int>(frame.nextInstructionIndex), totalNodes, node->GetName());
+                MarkNodeDirty(connections[i].to);
+                (inserted ? delta.added : delta.removed).push_back(connections[i]);
             }
-
-            try
+            if (keep[i])
             {
-                // Use precomputed incoming connections (no search overhead)
-                for (const auto connIndex : step.incomingConnectionIndices)
+                added += inserted ? 1 : 0;
+                if (kept != i)
                 {
-                    const auto &conn = connections[connIndex];
-                    auto fromIt = nodes.find(conn.from);
-                    if (fromIt != nodes.end())
-                    {
-                        PassDataBetweenNodes(fromIt->second.get(), node, conn.fromSlot, conn.toSlot);
-                        frame.stats.dataPassOperations++;
-                    }
+                    connections[kept] = std::move(connections[i]);
                 }
-
-                LOG_INFO("Processing node: {} (ID: {})", node->GetName(), step.nodeId);
-
-                // Time the node execution for profiling
-                auto nodeStartTime = std::chrono::high_resolution_clock::now();
-                node->Process();
-                auto nodeEndTime = std::chrono::high_resolution_clock::now();
-
-                auto nodeDuration = std::chrono::duration_cast<std::chrono::microseconds>(nodeEndTime - nodeStartTime);
-                frame.RecordNodeExecution(nodeDuration);
-            }
-            catch (const std::exception &e)
-            {
-                LOG_ERROR("Node {} (ID: {}) failed during execution: {}", node->GetName(), step.nodeId, e.what());
-                return false;
-            }
-            catch (...)
-            {
-                LOG_ERROR("Node {} (ID: {}) failed with unknown exception", node->GetName(), step.nodeId);
-                return false;
+                ++kept;
             }
         }
+        connections.resize(kept);
 
-        LOG_INFO("Graph execution completed successfully");
-        return true;
+        InvalidateExecutionPlan(); // Graph structure changed
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
+        return added;
     }
 
-    std::shared_future<bool> NodeEditor::ExecuteAsync(const ExecutionProgressCallback &progressCallback)
+    void NodeEditor::Clear()
     {
-        // Create a new stop source for this execution
-        stopSource = std::stop_source();
-        std::stop_token stopToken = stopSource.get_token();
+        std::unique_lock lock(graphMutex);
+        nodes.clear();
+        connections.clear();
+        nextId = 1;
+        nodeArena = NodeArena::Create(); // The old arena goes once undo history drops its nodes
+        InvalidateExecutionPlan();       // Graph structure changed
+        lock.unlock();
+        NotifyConnectionsChanged({ .reset = true });
+    }
+
+    std::shared_ptr<NodeArena> NodeEditor::GetNodeArena() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return nodeArena;
+    }
+
+    void NodeEditor::BeginTransaction()
+    {
+        graphMutex.lock(); // Released by the matching CommitTransaction()
+        ++transactionDepth;
+    }
+
+    void NodeEditor::CommitTransaction()
+    {
+        std::unique_lock lock(graphMutex);
+        if (transactionDepth == 0)
+        {
+            return;
+        }
+        graphMutex.unlock(); // The hold taken by BeginTransaction(); lock keeps the mutex owned
+        if (--transactionDepth > 0)
+        {
+            return;
+        }
+
+        if (std::exchange(transactionInvalidated, false))
+        {
+            LOG_DEBUG("Execution plan invalidated (transaction committed)");
+        }
+        const auto delta = std::exchange(transactionDelta, {});
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
+    }
+
+    void NodeEditor::SetConnectionObserver(ConnectionObserver observer)
+    {
+        std::scoped_lock lock(graphMutex);
+        connectionObserver = std::move(observer);
+    }
+
+    void NodeEditor::NotifyConnectionsChanged(const ConnectionDelta &delta)
+    {
+        if (delta.Empty())
+        {
+            return;
+        }
+
+        ConnectionObserver observer;
+        {
+            std::scoped_lock lock(graphMutex);
+            if (transactionDepth > 0)
+            {
+                AppendConnectionDelta(transactionDelta, delta);
+                return;
+            }
+            observer = connectionObserver;
+        }
+        if (observer)
+        {
+            observer(delta);
+        }
+    }
+
+    void NodeEditor::SetRunFinishedObserver(RunFinishedObserver observer)
+    {
+        std::scoped_lock lock(graphMutex);
+        runFinishedObserver = std::move(observer);
+    }
+
+    bool NodeEditor::NotifyRunFinished(bool succeeded) const
+    {
+        RunFinishedObserver observer;
+        {
+            std::scoped_lock lock(graphMutex);
+            observer = runFinishedObserver;
+        }
+        if (observer)
+        {
+            observer(succeeded);
+        }
+        return succeeded;
+    }
+
+    bool NodeEditor::Execute(const ExecutionProgressCallback &progressCallback, std::stop_token stopToken)
+    {
+        return ExecuteAtScale(progressCallback, stopToken, proxyScale.load());
+    }
+
+    bool NodeEditor::ExecuteFullResolution(const ExecutionProgressCallback &progressCallback, std::stop_token stopToken)
+    {
+        return ExecuteAtScale(progressCallback, stopToken, 1.0);
+    }
+
+    bool NodeEditor::ExecuteAtScale(const ExecutionProgressCallback &progressCallback,
+        std::stop_token stopToken,
+        double scale)
+    {
+        const auto executionLock = LockTraced(executionMutex, "Wait executionMutex");
+        TraceScope trace("graph", scale < 1.0 ? "Execute (proxy)" : "Execute");
+
+        // If running synchronously (no external token), reset a cancelled stopSource to allow fresh cancellation
+        if (!stopToken.stop_possible() && stopSource.stop_requested())
+        {
+            stopSource = std::stop_source();
+        }
+
+        // Use cached snapshot (compilation phase); the graph lock is not held while nodes run
+        const auto graph = PullFromSinks(AcquireSnapshot());
+        if (!graph)
+        {
+            return false;
+        }
+
+        LOG_HOT_INFO("Executing graph with {} nodes", graph->nodes.size());
+        LOG_HOT_INFO("Executing {} steps from cached plan (graph version {})", graph->plan.size(), graph->version);
+        return RunSnapshot(*graph, progressCallback, stopToken, std::nullopt, scale);
+    }
+
+    bool NodeEditor::ExecuteInContext(ExecutionContext &context, std::stop_token stopToken)
+    {
+        TraceScope trace("graph", "Execute (context)");
+        context.SetFailure({}, false);
+
+        const auto graph = PullFromSinks(AcquireSnapshot());
+        if (!graph)
+        {
+            context.SetFailure("graph has no execution plan", false);
+            return false;
+        }
+
+        // CancelExecution() swaps stopSource under executionMutex, which context runs do not take
+        const auto timeout = executionTimeout.load();
+        const StopCondition stop(stopToken,
+            {},
+            timeout > std::chrono::milliseconds::zero()
+                ? std::optional(std::chrono::steady_clock::now() + timeout)
+                : std::nullopt);
+        const ExecutionContext::Scope scope(context, stop);
+
+        // Bypassed steps only drop their outputs in the context; dirty flags belong to the graph's own runs
+        std::vector<uint8_t> bypassed(graph->plan.size());
+        const std::function<bool(size_t)> isBypassed = [&bypassed](size_t step) { return bypassed[step] != 0; };
+        for (size_t index = 0; index < graph->plan.size(); ++index)
+        {
+            Node *node = graph->stepNodes[index];
+            if (!node || context.IsSupplied(*node))
+            {
+                continue;
+            }
+            const auto &step = graph->plan[index];
+            if (step.loopOwner && !bypassed[*step.loopOwner])
+            {
+                continue; // Ran inside its loop step
+            }
+            if (IsStepBypassed(*graph, index, isBypassed))
+            {
+                bypassed[index] = 1;
+                for (SlotIndex slot = 0; slot < node->GetOutputSlotCount(); ++slot)
+                {
+                    node->ClearOutputSlot(slot);
+                }
+                continue;
+            }
+
+            std::string error;
+            if (stop.IsStopRequested())
+            {
+                LogStopped(stop, "Context execution");
+                error = stop.IsCancelled() ? "execution cancelled" : "execution deadline exceeded";
+            }
+            else if (RunContextStep(*graph, step, *node, error)
+                     && (step.loopBody.empty() || RunLoopIterations(*graph, index, *node, stop, error)))
+            {
+                continue;
+            }
+            context.SetFailure(std::move(error), !stop.IsCancelled() && stop.IsDeadlineExceeded());
+            return false;
+        }
+        return true;
+    }
+
+    bool NodeEditor::RunContextStep(const GraphSnapshot &graph,
+        const ExecutionStep &step,
+        Node &node,
+        std::string &error)
+    {
+        try
+        {
+            PullStepInputs(graph, step, node, nullptr);
+
+            LOG_HOT_INFO("Processing node in context: {} (ID: {})", node.GetName(), step.nodeId);
+            TraceScope processTrace("node", node.GetName());
+            const ThreadBudget::ActiveTask budgetTask(ThreadBudget::Get());
+            if (!node.ProcessInputBatch())
+            {
+                node.Process();
+            }
+            return true;
+        }
+        catch (const ExecutionStopped &e)
+        {
+            LOG_WARN("Node {} (ID: {}) stopped early: {}", node.GetName(), step.nodeId, e.what());
+            error = e.what();
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("Node {} (ID: {}) failed during execution: {}", node.GetName(), step.nodeId, e.what());
+            error = "node " + node.GetName() + " failed: " + e.what();
+        }
+        catch (...)
+        {
+            LOG_ERROR("Node {} (ID: {}) failed with unknown exception", node.GetName(), step.nodeId);
+            error = "node " + node.GetName() + " failed";
+        }
+        return false;
+    }
+
+    bool NodeEditor::ExecuteUpTo(NodeId target,
+        const ExecutionProgressCallback &progressCallback,
+        std::stop_token stopToken)
+    {
+        const auto executionLock = LockTraced(executionMutex, "Wait executionMutex");
+        TraceScope trace("graph", "ExecuteUpTo");
+
+        if (!stopToken.stop_possible())
+        {
+            stopSource = std::stop_source();
+        }
+
+        const auto graph = AcquireSnapshot();
+        if (!graph)
+        {
+            return false;
+        }
+
+        const auto targetStep = std::ranges::find(graph->plan, target, &ExecutionStep::nodeId);
+        if (targetStep == graph->plan.end())
+        {
+            LOG_ERROR("Node {} is not part of the execution plan; connect its execution pins to run it", target);
+            return false;
+        }
+
+        const auto pruned = PruneSnapshot(*graph, { static_cast<size_t>(targetStep - graph->plan.begin()) });
+        LOG_HOT_INFO("Executing {} of {} steps up to node {} (graph version {})",
+            pruned->plan.size(),
+            graph->plan.size(),
+            target,
+            graph->version);
+        return RunSnapshot(*pruned, progressCallback, stopToken, target, proxyScale.load());
+    }
+
+    std::shared_ptr<const NodeEditor::GraphSnapshot> NodeEditor::PruneSnapshot(const GraphSnapshot &graph,
+        const std::vector<size_t> &targets)
+    {
+        // Upstream cones along data edges, plus the execution wires that decide whether conditional steps run
+        std::vector<bool> inCone(graph.plan.size());
+        std::vector<size_t> pending = targets;
+        for (const auto target : targets)
+        {
+            inCone[target] = true;
+        }
+        const auto addToCone = [&inCone, &pending](size_t producer) {
+            if (!inCone[producer])
+            {
+                inCone[producer] = true;
+                pending.push_back(producer);
+            }
+        };
+        while (!pending.empty())
+        {
+            const auto index = pending.back();
+            pending.pop_back();
+            const auto &step = graph.plan[index];
+            std::ranges::for_each(step.dataProducerSteps, addToCone);
+            if (step.conditional)
+            {
+                std::ranges::for_each(step.executionInputs, addToCone, &ExecutionWire::producerStep);
+            }
+            // A loop runs its whole body, and a body step only runs inside its loop
+            std::ranges::for_each(step.loopBody, addToCone);
+            if (step.loopOwner)
+            {
+                addToCone(*step.loopOwner);
+            }
+        }
+
+        auto pruned = std::make_shared<GraphSnapshot>();
+        pruned->version = graph.version;
+        pruned->nodes = graph.nodes;
+        pruned->connections = graph.connections;
+        pruned->followsExecutionFlow = graph.followsExecutionFlow;
+
+        constexpr auto kDropped = std::numeric_limits<size_t>::max();
+        std::vector<size_t> prunedIndex(graph.plan.size(), kDropped);
+        for (size_t i = 0; i < graph.plan.size(); ++i)
+        {
+            if (inCone[i])
+            {
+                prunedIndex[i] = pruned->plan.size();
+                pruned->plan.push_back(graph.plan[i]);
+                pruned->stepNodes.push_back(graph.stepNodes[i]);
+            }
+        }
+
+        const auto keepInCone = [&prunedIndex](std::vector<size_t> &indices) {
+            std::erase_if(indices, [&prunedIndex](size_t index) { return prunedIndex[index] == kDropped; });
+            for (auto &index : indices)
+            {
+                index = prunedIndex[index];
+            }
+        };
+        for (auto &step : pruned->plan)
+        {
+            step.dependencyCount = 0;
+        }
+        for (auto &step : pruned->plan)
+        {
+            for (const auto consumer : step.dataConsumerSteps)
+            {
+                if (prunedIndex[consumer] == kDropped)
+                {
+                    step.prunedConsumers.push_back(graph.plan[consumer].nodeId);
+                }
+            }
+            step.releasableOutputs = step.releasableOutputs && step.prunedConsumers.empty();
+            keepInCone(step.dependentSteps);
+            keepInCone(step.dataConsumerSteps);
+            keepInCone(step.dataProducerSteps);
+            std::erase_if(step.executionInputs,
+                [&prunedIndex](const ExecutionWire &wire) { return prunedIndex[wire.producerStep] == kDropped; });
+            for (auto &wire : step.executionInputs)
+            {
+                wire.producerStep = prunedIndex[wire.producerStep];
+            }
+            keepInCone(step.loopBody); // Kept whole with their loop
+            if (step.loopOwner)
+            {
+                step.loopOwner = prunedIndex[*step.loopOwner];
+            }
+            if (step.aliasOf)
+            {
+                step.aliasOf = prunedIndex[*step.aliasOf]; // Read by the step, so never dropped
+            }
+            if (step.tileSuccessor && prunedIndex[*step.tileSuccessor] != kDropped)
+            {
+                step.tileSuccessor = prunedIndex[*step.tileSuccessor];
+            }
+            else
+            {
+                step.tileSuccessor.reset();
+            }
+            for (const auto dependent : step.dependentSteps)
+            {
+                pruned->plan[dependent].dependencyCount++;
+            }
+        }
+        return pruned;
+    }
+
+    std::shared_ptr<const NodeEditor::GraphSnapshot> NodeEditor::PullFromSinks(
+        std::shared_ptr<const GraphSnapshot> graph) const
+    {
+        const auto mode = pullEvaluation.load();
+        if (!graph || mode == PullEvaluation::Off
+            || (mode == PullEvaluation::DataFlowGraphs && graph->followsExecutionFlow))
+        {
+            return graph;
+        }
+
+        // The pruned copy is kept, so repeated runs of an unchanged graph neither prune nor allocate again
+        std::unordered_set<NodeId> explicitOutputs;
+        {
+            std::scoped_lock lock(graphMutex);
+            if (pulled.source == graph && pulled.outputs == outputNodes)
+            {
+                return pulled.result;
+            }
+            explicitOutputs.insert(outputNodes.begin(), outputNodes.end());
+        }
+
+        auto result = PruneToSinks(graph, explicitOutputs);
+        std::scoped_lock lock(graphMutex);
+        pulled = { .source = graph, .outputs = outputNodes, .result = result };
+        return result;
+    }
+
+    std::shared_ptr<const NodeEditor::GraphSnapshot> NodeEditor::PruneToSinks(
+        const std::shared_ptr<const GraphSnapshot> &graph,
+        const std::unordered_set<NodeId> &explicitOutputs)
+    {
+        // Stream sources stay so a stream run still advances and ends, but only sinks declare results
+        std::vector<size_t> roots;
+        bool hasSink = false;
+        for (size_t i = 0; i < graph->plan.size(); ++i)
+        {
+            const auto *node = graph->stepNodes[i];
+            if (!node)
+            {
+                continue;
+            }
+            const bool sink = node->IsSink() || explicitOutputs.contains(graph->plan[i].nodeId);
+            hasSink = hasSink || sink;
+            if (sink || node->IsStreamSource())
+            {
+                roots.push_back(i);
+            }
+        }
+        if (!hasSink)
+        {
+            return graph; // Nothing declares a result, so every node might be the one the caller reads
+        }
+
+        auto pruned = PruneSnapshot(*graph, roots);
+        if (pruned->plan.size() == graph->plan.size())
+        {
+            return graph;
+        }
+        LOG_HOT_INFO("Pull-based evaluation: running {} of {} steps read by {} sinks",
+            pruned->plan.size(),
+            graph->plan.size(),
+            roots.size());
+        return pruned;
+    }
+
+    bool NodeEditor::RunSnapshot(const GraphSnapshot &graph,
+        const ExecutionProgressCallback &progressCallback,
+        std::stop_token stopToken,
+        std::optional<NodeId> targetNode,
+        double scale)
+    {
+        ApplyProxyScale(graph, scale);
+        ApplyPrecisionPolicy(graph, precisionPolicy.load());
+
+        // Buffers are reused from earlier runs (callers hold executionMutex), so a warm graph allocates none
+        RunStatistics run = executionStatistics.Recycle(graph.plan.size(), graph.version);
+        run.graphVersion = graph.version;
+        run.parallel = executionMode.load() == ExecutionMode::Parallel;
+        run.targetNode = targetNode;
+        run.proxyScale = scale;
+
+        TiledRun &tiled = tiledRun;
+        {
+            std::scoped_lock lock(graphMutex);
+            tiled.options = tilingOptions;
+        }
+        tiled.roles.assign(graph.plan.size(), TileRole::None);
+        tiled.regionSteps.assign(graph.plan.size(), 0);
+        ReleaseDiscardedTileOutputs(graph, tiled.RunsChains(), tiled.options.propagateRegions);
+
+        LivenessRun &liveness = livenessRun;
+        liveness.enabled = intermediateRelease.load();
+        if (liveness.enabled)
+        {
+            if (liveness.pendingReaders.size() != graph.plan.size())
+            {
+                liveness.pendingReaders = std::vector<std::atomic<size_t>>(graph.plan.size());
+            }
+            for (size_t i = 0; i < graph.plan.size(); ++i)
+            {
+                liveness.pendingReaders[i].store(graph.plan[i].dataConsumerSteps.size(), std::memory_order_relaxed);
+            }
+        }
+        liveness.spilling = liveness.enabled && MemoryBudget::Get().GetLimit() > 0;
+        if (liveness.spilling)
+        {
+            liveness.spillTickets.assign(graph.plan.size(), 0);
+            liveness.pins.assign(graph.plan.size(), 0);
+            liveness.started.assign(graph.plan.size(), 0);
+            liveness.finished.assign(graph.plan.size(), 0);
+            liveness.pinned.resize(graph.plan.size());
+            for (auto &producers : liveness.pinned)
+            {
+                producers.clear();
+            }
+            liveness.reportedBytes = 0;
+            liveness.spills = 0;
+        }
+
+        MemoryRun memory;
+        progressChannel.BeginRun(static_cast<int>(graph.plan.size()));
+        const auto runStart = std::chrono::steady_clock::now();
+        const auto timeout = executionTimeout.load();
+        const StopCondition stop(stopToken,
+            stopSource.get_token(),
+            timeout > std::chrono::milliseconds::zero() ? std::optional(runStart + timeout) : std::nullopt);
+        const bool success =
+            run.parallel ? ExecuteParallel(graph, progressCallback, stop, run.nodes, tiled, liveness, memory)
+                         : ExecuteSequential(graph, progressCallback, stop, run.nodes, tiled, liveness, memory);
+        derivedImages->Clear(); // Derived images live for one run; held sources return to the pool
+        DiscardSpilledOutputs(graph, liveness);
+        run.totalTime =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - runStart);
+        run.succeeded = success;
+        run.timedOut = !success && !stop.IsCancelled() && stop.IsDeadlineExceeded();
+        run.peakSlotBytes = memory.peakBytes;
+        run.peakNodeId = memory.peakNodeId;
+        run.retainedSlotBytes = MeasureSlotBytes(graph);
+        run.spilledOutputs = liveness.spilling ? liveness.spills : 0;
+        TrackDiscardedTileOutputs(graph, tiled, run.nodes);
+        RecordRunStatistics(graph, std::move(run));
+
+        MarkNodesEditedDuringRun(graph);
+        if (success)
+        {
+            LOG_HOT_INFO("Graph execution completed successfully");
+        }
+        return success;
+    }
+
+    void NodeEditor::ApplyProxyScale(const GraphSnapshot &graph, double scale)
+    {
+        for (Node *node : graph.stepNodes)
+        {
+            if (node && node->GetProxyScale() != scale)
+            {
+                node->SetProxyScale(scale);
+                node->MarkDirty();
+            }
+        }
+    }
+
+    void NodeEditor::ApplyPrecisionPolicy(const GraphSnapshot &graph, PrecisionPolicy policy)
+    {
+        for (Node *node : graph.stepNodes)
+        {
+            if (node && node->GetPrecisionPolicy() != policy)
+            {
+                node->SetPrecisionPolicy(policy);
+                node->MarkDirty();
+            }
+        }
+    }
+
+    bool NodeEditor::ExecuteSequential(const GraphSnapshot &graph,
+        const ExecutionProgressCallback &progressCallback,
+        const StopCondition &stop,
+        std::vector<NodeExecutionRecord> &records,
+        TiledRun &tiled,
+        LivenessRun &liveness,
+        MemoryRun &memory)
+    {
+        // Create execution frame
+        ExecutionFrame frame;
+        frame.startTime = std::chrono::high_resolution_clock::now();
+        int totalNodes = static_cast<int>(graph.plan.size());
+        const std::function<bool(size_t)> isBypassed = [&records](size_t step) {
+            return records[step].outcome == StepOutcome::Bypassed;
+        };
+
+        // Execute using frame with lookahead advancement
+        while (!frame.IsFinished(graph.plan))
+        {
+            if (stop.IsStopRequested())
+            {
+                LogStopped(stop, "Graph execution");
+                return false;
+            }
+
+            // LOOKAHEAD ADVANCEMENT: Advance instruction pointer BEFORE execution
+            frame.AdvanceToNext(graph.plan);
+
+            const auto &step = *frame.currentStep;
+            const size_t index = frame.nextInstructionIndex - 1;
+
+            // Direct node lookup (resolved when the snapshot was taken)
+            Node *node = graph.stepNodes[index];
+            if (!node)
+                continue;
+
+            progressChannel.Advance(node->GetId());
+            if (progressCallback)
+            {
+                progressCallback(static_cast<int>(frame.nextInstructionIndex), totalNodes, node->GetName());
+            }
+
+            if (!FaultInProducers(graph, index, liveness))
+            {
+                return false;
+            }
+
+            if (step.loopOwner && records[*step.loopOwner].outcome != StepOutcome::Bypassed)
+            {
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue; // Ran inside its loop step
+            }
+
+            if (IsStepBypassed(graph, index, isBypassed))
+            {
+                BypassStep(graph, step, *node);
+                records[index].outcome = StepOutcome::Bypassed;
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue;
+            }
+
+            if (tiled.IsFused(index))
+            {
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue; // Ran inside an earlier step's tiled chain
+            }
+
+            if (const auto chainSucceeded = RunTiledChain(graph, index, tiled, stop, records))
+            {
+                if (!*chainSucceeded)
+                {
+                    return false;
+                }
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue;
+            }
+
+            if (!step.loopBody.empty())
+            {
+                if (!RunLoopStep(graph, index, *node, stop, &records))
+                {
+                    return false;
+                }
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue;
+            }
+
+            if (CanSkipStep(*node))
+            {
+                LOG_HOT_DEBUG("Skipping clean node: {} (ID: {})", node->GetName(), step.nodeId);
+                records[index].outcome = StepOutcome::Skipped;
+                FinishStep(graph, index, records[index], liveness, memory);
+                continue;
+            }
+
+            if (!RunExecutionStep(graph, step, *node, stop, nullptr, &records[index]))
+            {
+                return false;
+            }
+            FinishStep(graph, index, records[index], liveness, memory);
+        }
+
+        return true;
+    }
+
+    bool NodeEditor::ExecuteParallel(const GraphSnapshot &graph,
+        const ExecutionProgressCallback &progressCallback,
+        const StopCondition &stop,
+        std::vector<NodeExecutionRecord> &records,
+        TiledRun &tiled,
+        LivenessRun &liveness,
+        MemoryRun &memory)
+    {
+        const auto workerPool = executor->AcquireWorkerPool();
+        auto &pool = *workerPool;
+        const auto &plan = graph.plan;
+        const auto &stepNodes = graph.stepNodes;
+        const int totalNodes = static_cast<int>(plan.size());
+
+        std::vector<std::atomic<size_t>> remainingDependencies(plan.size());
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            remainingDependencies[i].store(plan[i].dependencyCount, std::memory_order_relaxed);
+        }
+
+        std::atomic<bool> failed{ false };
+        std::atomic<bool> cancelled{ false };
+        std::atomic<int> startedSteps{ 0 };
+        std::mutex progressMutex;
+
+        std::mutex completionMutex;
+        std::condition_variable completionCondition;
+        size_t tasksInFlight = 0;
+
+        // Ranked runs keep ready steps in a heap, and each submitted task starts whichever ready step ranks
+        // highest when a worker gets to it, so the longest remaining chain is never left for last
+        const auto priorities = RankSteps(graph);
+        const auto ranksLower = [&priorities](size_t a, size_t b) {
+            return priorities[a] != priorities[b] ? priorities[a] < priorities[b] : a > b;
+        };
+        std::mutex readyMutex;
+        std::vector<size_t> readySteps;
+
+        // Execution producers finish before their successors are scheduled, which publishes their outcomes
+        const std::function<bool(size_t)> isBypassed = [&records](size_t step) {
+            return records[step].outcome == StepOutcome::Bypassed;
+        };
+
+        // Steps are submitted once their last dependency finishes; the acq_rel decrement publishes
+        // the upstream output slots to the worker that picks up the dependent step.
+        auto schedule = [&](auto &self, size_t ready) -> void {
+            {
+                std::scoped_lock lock(completionMutex);
+                ++tasksInFlight;
+            }
+            if (!priorities.empty())
+            {
+                std::scoped_lock lock(readyMutex);
+                readySteps.push_back(ready);
+                std::ranges::push_heap(readySteps, ranksLower);
+            }
+
+            pool.Submit([&, ready]() {
+                size_t index = ready;
+                if (!priorities.empty())
+                {
+                    std::scoped_lock lock(readyMutex);
+                    std::ranges::pop_heap(readySteps, ranksLower);
+                    index = readySteps.back();
+                    readySteps.pop_back();
+                }
+
+                if (stop.IsStopRequested())
+                {
+                    cancelled.store(true, std::memory_order_relaxed);
+                }
+
+                if (!failed.load(std::memory_order_relaxed) && !cancelled.load(std::memory_order_relaxed))
+                {
+                    bool succeeded = true;
+                    if (Node *node = stepNodes[index])
+                    {
+                        progressChannel.Advance(node->GetId());
+                        if (progressCallback)
+                        {
+                            std::scoped_lock lock(progressMutex);
+                            progressCallback(++startedSteps, totalNodes, node->GetName());
+                        }
+                        if (!FaultInProducers(graph, index, liveness))
+                        {
+                            succeeded = false;
+                        }
+                        else if (const auto owner = plan[index].loopOwner;
+                                 owner && records[*owner].outcome != StepOutcome::Bypassed)
+                        {
+                            // Ran inside its loop step
+                        }
+                        else if (IsStepBypassed(graph, index, isBypassed))
+                        {
+                            BypassStep(graph, plan[index], *node);
+                            records[index].outcome = StepOutcome::Bypassed;
+                        }
+                        else if (tiled.IsFused(index))
+                        {
+                            // Ran inside an earlier step's tiled chain
+                        }
+                        else if (const auto chainSucceeded = RunTiledChain(graph, index, tiled, stop, records))
+                        {
+                            succeeded = *chainSucceeded;
+                        }
+                        else if (!plan[index].loopBody.empty())
+                        {
+                            succeeded = RunLoopStep(graph, index, *node, stop, &records);
+                        }
+                        else if (!CanSkipStep(*node))
+                        {
+                            succeeded = RunExecutionStep(graph, plan[index], *node, stop, nullptr, &records[index])
+                                            .has_value();
+                        }
+                        else
+                        {
+                            records[index].outcome = StepOutcome::Skipped;
+                        }
+                    }
+
+                    if (succeeded)
+                    {
+                        FinishStep(graph, index, records[index], liveness, memory);
+                        for (const auto dependent : plan[index].dependentSteps)
+                        {
+                            if (remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                            {
+                                self(self, dependent);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+
+                std::scoped_lock lock(completionMutex);
+                if (--tasksInFlight == 0)
+                {
+                    completionCondition.notify_all();
+                }
+            });
+        };
+
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            if (plan[i].dependencyCount == 0)
+            {
+                schedule(schedule, i);
+            }
+        }
+
+        {
+            std::unique_lock lock(completionMutex);
+            completionCondition.wait(lock, [&]() { return tasksInFlight == 0; });
+        }
+
+        if (cancelled)
+        {
+            LogStopped(stop, "Graph execution");
+            return false;
+        }
+
+        return !failed;
+    }
+
+    std::optional<std::chrono::microseconds> NodeEditor::RunExecutionStep(const GraphSnapshot &graph,
+        const ExecutionStep &step,
+        Node &node,
+        const StopCondition &stop,
+        const std::function<void()> &inputsPulled,
+        NodeExecutionRecord *record) const
+    {
+        try
+        {
+            PullStepInputs(graph, step, node, record);
+
+            // Clear before processing so parameter edits made while Process() runs are not lost
+            node.ClearDirty();
+
+            // Done before the producers are released: a pipelined copied step may start its next frame after that
+            const bool shared = step.aliasOf && ShareDuplicateOutputs(graph, step, node);
+            if (inputsPulled)
+            {
+                inputsPulled();
+            }
+            if (shared)
+            {
+                LOG_HOT_INFO("Shared outputs of an identical node with node: {} (ID: {})", node.GetName(), step.nodeId);
+                MarkDataConsumersDirty(graph, step);
+                if (record)
+                {
+                    record->outcome = StepOutcome::Aliased;
+                }
+                return std::chrono::microseconds::zero();
+            }
+
+            const bool useCache = outputCacheEnabled.load(std::memory_order_relaxed) && node.IsCacheable();
+            uint64_t cacheKey = 0;
+            if (useCache)
+            {
+                TraceScope keyTrace("cache", "Cache key");
+                cacheKey = NodeOutputCache::ComputeKey(node);
+            }
+            if (useCache && outputCache.TryRestore(cacheKey, node))
+            {
+                LOG_HOT_INFO("Restored cached outputs for node: {} (ID: {})", node.GetName(), step.nodeId);
+                MarkDataConsumersDirty(graph, step);
+                if (record)
+                {
+                    record->outcome = StepOutcome::CacheHit;
+                }
+                return std::chrono::microseconds::zero();
+            }
+
+            LOG_HOT_INFO("Processing node: {} (ID: {})", node.GetName(), step.nodeId);
+            node.PrepareIfNeeded(); // Parameters changed since the last run are resolved outside the timed Process()
+
+            // Time the node execution for profiling
+            auto nodeStartTime = std::chrono::high_resolution_clock::now();
+            {
+                TraceScope processTrace("node", node.GetName());
+                if (processTrace.IsActive())
+                {
+                    processTrace.SetDetail(node.GetType() + " (ID: " + std::to_string(step.nodeId) + ")");
+                }
+                const ThreadBudget::ActiveTask budgetTask(ThreadBudget::Get());
+                node.SetStopCondition(stop);
+                if (!node.ProcessInputBatch())
+                {
+                    node.Process();
+                }
+                node.SetStopCondition({});
+            }
+            auto nodeEndTime = std::chrono::high_resolution_clock::now();
+
+            if (useCache)
+            {
+                TraceScope storeTrace("cache", "Cache store");
+                outputCache.Store(cacheKey, node);
+            }
+
+            MarkDataConsumersDirty(graph, step);
+            const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(nodeEndTime - nodeStartTime);
+            if (record)
+            {
+                record->outcome = StepOutcome::Processed;
+                record->duration = duration;
+            }
+            return duration;
+        }
+        catch (const ExecutionStopped &e)
+        {
+            LOG_WARN("Node {} (ID: {}) stopped early: {}", node.GetName(), step.nodeId, e.what());
+            node.SetStopCondition({});
+            node.MarkDirty();
+            if (record)
+            {
+                record->outcome = StepOutcome::Cancelled;
+            }
+            return std::nullopt;
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("Node {} (ID: {}) failed during execution: {}", node.GetName(), step.nodeId, e.what());
+        }
+        catch (...)
+        {
+            LOG_ERROR("Node {} (ID: {}) failed with unknown exception", node.GetName(), step.nodeId);
+        }
+
+        node.SetStopCondition({});
+        node.MarkDirty();
+        if (record)
+        {
+            record->outcome = StepOutcome::Failed;
+        }
+        return std::nullopt;
+    }
+
+    void NodeEditor::PullStepInputs(const GraphSnapshot &graph,
+        const ExecutionStep &step,
+        Node &node,
+        NodeExecutionRecord *record)
+    {
+        // Producers, slot indices and types were resolved when the plan was compiled and the snapshot taken
+        for (const auto &binding : step.inputs)
+        {
+            if (binding.producer)
+            {
+                const auto &conn = graph.connections[binding.connectionIndex];
+                TraceScope passTrace("data", conn.toSlot.Str());
+                if (passTrace.IsActive())
+                {
+                    passTrace.SetDetail(
+                        binding.producer->GetName() + "." + conn.fromSlot.Str() + " -> " + node.GetName());
+                }
+                PassDataBetweenNodes(*binding.producer, node, conn, binding);
+                if (record)
+                {
+                    ++record->dataPassOperations;
+                }
+            }
+        }
+    }
+
+    std::optional<bool> NodeEditor::RunTiledChain(const GraphSnapshot &graph,
+        size_t index,
+        TiledRun &tiled,
+        const StopCondition &stop,
+        std::vector<NodeExecutionRecord> &records) const
+    {
+        const auto &options = tiled.options;
+        Node *head = graph.stepNodes[index];
+        if ((!tiled.RunsChains() && !options.propagateRegions) || !head)
+        {
+            return std::nullopt;
+        }
+
+        // Tiles are host images; a node reading device images runs whole, and a duplicate does not run at all
+        if (graph.plan[index].readsDeviceImages || graph.plan[index].aliasOf)
+        {
+            return std::nullopt;
+        }
+
+        const auto inputSlot = head->FindInputSlotIndex(Constants::Tiling::kInputSlot);
+        if (!inputSlot || !head->FindOutputSlotIndex(Constants::Tiling::kOutputSlot))
+        {
+            return std::nullopt;
+        }
+
+        // Steps the chain may reach; the nodes decide below how far it actually goes
+        std::vector<size_t> chain{ index };
+        while (const auto next = graph.plan[chain.back()].tileSuccessor)
+        {
+            chain.push_back(*next);
+        }
+
+        // A clean first node is skipped as usual, unless a dirty node further down needs the output it did not keep
+        const bool headClean = CanSkipStep(*head);
+        if (headClean)
+        {
+            const bool outputKept =
+                !discardedTileOutputs.contains(head->GetId()) && !discardedRegionOutputs.contains(head->GetId());
+            const bool laterNodeDirty = std::any_of(chain.begin() + 1, chain.end(), [&](size_t step) {
+                return graph.stepNodes[step] && graph.stepNodes[step]->IsDirty();
+            });
+            if (outputKept || !laterNodeDirty)
+            {
+                return std::nullopt;
+            }
+        }
+
+        // The first node has to run from here on, tiled or not
+        auto runNormally = [&]() -> std::optional<bool> {
+            head->MarkDirty();
+            records[index].dataPassOperations = 0;
+            return std::nullopt;
+        };
+
+        try
+        {
+            // Peek at the image without passing data, so steps without one pull their inputs once
+            std::shared_ptr<const cv::Mat> input;
+            const Node *deferringProducer = nullptr;
+            const auto &inputs = graph.plan[index].inputs;
+            if (const auto binding = std::ranges::find(inputs, *inputSlot, &InputBinding::toSlot);
+                binding != inputs.end())
+            {
+                if (const Node *producer = binding->producer)
+                {
+                    input = producer->GetOutputSlot(binding->fromSlot).GetDataIf<cv::Mat>();
+                    if (producer->FindOutputSlotIndex(Constants::Tiling::kOutputSlot) == binding->fromSlot)
+                    {
+                        deferringProducer = producer;
+                    }
+                }
+            }
+            else
+            {
+                input = head->GetInputSlot(*inputSlot).GetValueOrDefaultIf<cv::Mat>();
+            }
+
+            // A producer too large to load left its output empty and reads the chain's region itself
+            if (!input || input->empty())
+            {
+                const auto deferred = deferringProducer ? deferringProducer->GetDeferredOutputShape() : std::nullopt;
+                if (!deferred || !options.propagateRegions)
+                {
+                    return runNormally();
+                }
+                PullStepInputs(graph, graph.plan[index], *head, &records[index]);
+                const RegionInput source{ .shape = *deferred,
+                    .read = [deferringProducer](const cv::Rect &region) {
+                        return deferringProducer->ReadOutputRegion(region);
+                    },
+                    .deferred = true };
+                if (const auto regionSucceeded = RunRegionChain(graph, chain, source, tiled, stop, records))
+                {
+                    return regionSucceeded;
+                }
+                return runNormally();
+            }
+            if (!tiled.TilesImages() && chain.size() < 2)
+            {
+                return std::nullopt; // Nothing to fuse with
+            }
+            PullStepInputs(graph, graph.plan[index], *head, &records[index]); // Parameters may be connected too
+
+            if (options.propagateRegions)
+            {
+                const RegionInput whole{ .shape = { .size = input->size(), .type = input->type() },
+                    .read = [&input](const cv::Rect &region) { return (*input)(region); } };
+                if (const auto regionSucceeded = RunRegionChain(graph, chain, whole, tiled, stop, records))
+                {
+                    return regionSucceeded;
+                }
+            }
+
+            // Below the tiling threshold only pointwise nodes are worth chaining, as one pass over row strips
+            const bool tiling = tiled.TilesImages() && input->total() >= options.minImagePixels;
+            if (!tiling && !options.fusePointwise)
+            {
+                return runNormally();
+            }
+
+            std::vector<TileOperation> operations;
+            int type = input->type();
+            for (const auto step : chain)
+            {
+                Node *node = graph.stepNodes[step];
+                if (node)
+                {
+                    node->PrepareIfNeeded();
+                }
+                auto operation = node ? node->PrepareTileOperation(type) : std::nullopt;
+                if (!operation || !operation->apply || operation->halo < 0 || (!tiling && operation->halo != 0))
+                {
+                    break;
+                }
+                type = operation->outputType;
+                operations.push_back(std::move(*operation));
+            }
+            if (operations.empty() || (!tiling && operations.size() < 2))
+            {
+                return runNormally();
+            }
+            chain.resize(operations.size());
+            const std::vector<size_t> operationSteps = options.collapseColorTransforms
+                ? CollapseColorTransforms(colorLuts, input->type(), input->total(), operations)
+                : std::vector<size_t>(operations.size(), 1);
+
+            // Clear before processing so parameter edits made while tiles run are not lost
+            std::string chainNames;
+            for (const auto step : chain)
+            {
+                graph.stepNodes[step]->ClearDirty();
+                chainNames += (chainNames.empty() ? "" : " -> ") + graph.stepNodes[step]->GetName();
+            }
+
+            TraceScope chainTrace("node", tiling ? "Tiled chain" : "Fused chain");
+            if (chainTrace.IsActive())
+            {
+                chainTrace.SetDetail(chainNames);
+            }
+
+            int totalHalo = 0;
+            for (const auto &operation : operations)
+            {
+                totalHalo += operation.halo;
+            }
+
+            // Fused pointwise runs use full-width strips, so each tile reads contiguous rows
+            const cv::Size size = input->size();
+            const size_t rowBytes = std::max<size_t>(static_cast<size_t>(size.width) * input->elemSize(), 1);
+            const size_t stripRows =
+                std::clamp<size_t>(Constants::Tiling::kFusedStripBytes / rowBytes, 1, static_cast<size_t>(size.height));
+            const int tileWidth = tiling ? options.tileSize : size.width;
+            const int tileHeight = tiling ? options.tileSize : static_cast<int>(stripRows);
+            const int tileColumns = (size.width + tileWidth - 1) / tileWidth;
+            const int tileRows = (size.height + tileHeight - 1) / tileHeight;
+            cv::Mat output = imagePool->CreateImage();
+            output.create(size, type);
+
+            std::vector<std::atomic<int64_t>> busyMicroseconds(operations.size());
+            std::mutex errorMutex;
+            std::string tileError;
+            std::atomic<bool> stopped{ false };
+
+            const ThreadBudget::ActiveTask budgetTask(ThreadBudget::Get());
+            cv::parallel_for_(cv::Range(0, tileColumns * tileRows), [&](const cv::Range &range) {
+                for (int tileIndex = range.start; tileIndex < range.end; ++tileIndex)
+                {
+                    if (stopped.load(std::memory_order_relaxed) || stop.IsStopRequested())
+                    {
+                        stopped.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    TraceScope tileTrace("tile", "Tile");
+                    try
+                    {
+                        const int x = (tileIndex % tileColumns) * tileWidth;
+                        const int y = (tileIndex / tileColumns) * tileHeight;
+                        const cv::Rect target(
+                            x, y, std::min(tileWidth, size.width - x), std::min(tileHeight, size.height - y));
+
+                        cv::Rect region = ExpandRect(target, totalHalo, size);
+                        cv::Mat tile = (*input)(region);
+                        int remainingHalo = totalHalo;
+                        for (size_t k = 0; k < operations.size(); ++k)
+                        {
+                            const auto start = std::chrono::steady_clock::now();
+                            const cv::Mat result = operations[k].apply(tile);
+                            const auto elapsed = std::chrono::steady_clock::now() - start;
+                            busyMicroseconds[k] +=
+                                std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+                            if (result.rows != tile.rows || result.cols != tile.cols
+                                || result.type() != operations[k].outputType)
+                            {
+                                throw std::runtime_error("tile operation changed the tile size or type");
+                            }
+
+                            // Pixels near the tile edge were computed from missing context; drop what later
+                            // operations no longer need
+                            remainingHalo -= operations[k].halo;
+                            const cv::Rect needed = ExpandRect(target, remainingHalo, size);
+                            tile = result(
+                                cv::Rect(needed.x - region.x, needed.y - region.y, needed.width, needed.height));
+                            region = needed;
+                        }
+
+                        cv::Mat destination = output(target);
+                        tile.copyTo(destination);
+                    }
+                    catch (const std::exception &e)
+                    {
+                        std::scoped_lock lock(errorMutex);
+                        tileError = e.what();
+                    }
+                    catch (...)
+                    {
+                        std::scoped_lock lock(errorMutex);
+                        tileError = "unknown exception";
+                    }
+                }
+            });
+
+            if (stopped.load())
+            {
+                LogStopped(stop, ("Chained run of " + chainNames).c_str());
+                for (const auto step : chain)
+                {
+                    graph.stepNodes[step]->MarkDirty();
+                    records[step].outcome = StepOutcome::Cancelled;
+                }
+                return false;
+            }
+
+            if (!tileError.empty())
+            {
+                LOG_HOT_WARN("Chained run of {} failed ({}), processing whole images", chainNames, tileError);
+                for (const auto step : chain)
+                {
+                    graph.stepNodes[step]->MarkDirty();
+                }
+                return runNormally();
+            }
+
+            // A lookup table's time is shared by the steps it replaced
+            std::vector<std::chrono::microseconds> durations;
+            for (size_t k = 0; k < operations.size(); ++k)
+            {
+                const auto steps = static_cast<int64_t>(operationSteps[k]);
+                const std::chrono::microseconds busy(busyMicroseconds[k].load());
+                durations.insert(durations.end(), operationSteps[k], busy / steps);
+            }
+            CompleteChain(graph, chain, durations, tiled, records, std::move(output));
+            LOG_HOT_INFO("Processed {} in {} tiles of {}x{} px",
+                chainNames,
+                tileColumns * tileRows,
+                tileWidth,
+                tileHeight);
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("Tiled run from node {} (ID: {}) failed: {}", head->GetName(), head->GetId(), e.what());
+        }
+        catch (...)
+        {
+            LOG_ERROR("Tiled run from node {} (ID: {}) failed with unknown exception", head->GetName(), head->GetId());
+        }
+
+        for (const auto step : chain)
+        {
+            graph.stepNodes[step]->MarkDirty();
+        }
+        records[index].outcome = StepOutcome::Failed;
+        return false;
+    }
+
+    std::optional<bool> NodeEditor::RunRegionChain(const GraphSnapshot &graph,
+        const std::vector<size_t> &chain,
+        const RegionInput &input,
+        TiledRun &tiled,
+        const StopCondition &stop,
+        std::vector<NodeExecutionRecord> &records) const
+    {
+        // Follow the chain to the first node declaring the region it reads, tracking each image's size
+        std::vector<RegionOperation> operations;
+        std::vector<cv::Size> sizes{ input.shape.size };
+        std::optional<cv::Rect> region;
+        int type = input.shape.type;
+        for (const auto step : chain)
+        {
+            Node *node = graph.stepNodes[step];
+            if (!node)
+            {
+                return std::nullopt;
+            }
+            // A lone region node is only worth it when the input is not in memory
+            if (!operations.empty() || input.deferred)
+            {
+                region = node->GetInputRegion(sizes.back());
+                if (region)
+                {
+                    break;
+                }
+            }
+
+            node->PrepareIfNeeded();
+            auto operation = node->PrepareRegionOperation(type, sizes.back());
+            if (!operation || !operation->apply || operation->halo < 0 || !IsRegionScale(operation->scaleX)
+                || !IsRegionScale(operation->scaleY))
+            {
+                return std::nullopt;
+            }
+            type = operation->outputType;
+            sizes.push_back(ScaleSize(sizes.back(), *operation));
+            operations.push_back(std::move(*operation));
+        }
+
+        const cv::Rect frame(cv::Point(0, 0), sizes.back());
+        if (!region || region->empty() || (*region & frame) != *region)
+        {
+            return std::nullopt;
+        }
+
+        // Map the region back through the chain: needed[k] is the part of operation k's input it must read
+        std::vector<cv::Rect> needed(operations.size() + 1);
+        std::vector<cv::Point> origins(operations.size());
+        needed.back() = *region;
+        for (size_t k = operations.size(); k-- > 0;)
+        {
+            const auto &operation = operations[k];
+            const cv::Rect &target = needed[k + 1];
+            const auto columns = MapRegionSpan(
+                target.x, target.x + target.width, operation.scaleX, operation.halo, sizes[k].width);
+            const auto rows = MapRegionSpan(
+                target.y, target.y + target.height, operation.scaleY, operation.halo, sizes[k].height);
+            needed[k] = cv::Rect(columns.begin, rows.begin, columns.end - columns.begin, rows.end - rows.begin);
+            origins[k] = cv::Point(columns.origin, rows.origin);
+        }
+
+        const auto stepCount = static_cast<std::ptrdiff_t>(operations.size() + 1); // Operations and the region node
+        const std::vector<size_t> steps(chain.begin(), chain.begin() + stepCount);
+        std::string chainNames;
+        for (const auto step : steps)
+        {
+            graph.stepNodes[step]->ClearDirty(); // Before processing, so edits made meanwhile are not lost
+            chainNames += (chainNames.empty() ? "" : " -> ") + graph.stepNodes[step]->GetName();
+        }
+
+        TraceScope chainTrace("node", "Region chain");
+        if (chainTrace.IsActive())
+        {
+            chainTrace.SetDetail(chainNames);
+        }
+
+        try
+        {
+            std::vector<std::chrono::microseconds> durations(steps.size());
+            cv::Mat image = input.read(needed.front());
+            if (image.size() != needed.front().size() || image.type() != input.shape.type)
+            {
+                throw std::runtime_error("region source did not return the requested region");
+            }
+            const ThreadBudget::ActiveTask budgetTask(ThreadBudget::Get());
+            for (size_t k = 0; k < operations.size(); ++k)
+            {
+                if (stop.IsStopRequested())
+                {
+                    LogStopped(stop, ("Region run of " + chainNames).c_str());
+                    for (const auto step : steps)
+                    {
+                        graph.stepNodes[step]->MarkDirty();
+                        records[step].outcome = StepOutcome::Cancelled;
+                    }
+                    return false;
+                }
+
+                const auto start = std::chrono::steady_clock::now();
+                const cv::Mat result = operations[k].apply(image);
+                durations[k] = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start);
+
+                // Keep only what the next operation reads
+                const cv::Rect produced(origins[k], result.size());
+                const cv::Rect &target = needed[k + 1];
+                if (result.type() != operations[k].outputType || (produced & target) != target)
+                {
+                    throw std::runtime_error("region operation did not produce the requested region");
+                }
+                image = result(target - origins[k]);
+            }
+
+            cv::Mat output = imagePool->CreateImage();
+            image.copyTo(output);
+            for (const auto step : steps)
+            {
+                tiled.regionSteps[step] = 1;
+            }
+            CompleteChain(graph, steps, durations, tiled, records, std::move(output));
+            LOG_HOT_INFO("Processed {} on {}x{} of {}x{} px",
+                chainNames,
+                needed.front().width,
+                needed.front().height,
+                input.shape.size.width,
+                input.shape.size.height);
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            LOG_HOT_WARN("Region run of {} failed ({}), processing whole images", chainNames, e.what());
+        }
+        catch (...)
+        {
+            LOG_HOT_WARN("Region run of {} failed with unknown exception, processing whole images", chainNames);
+        }
+
+        for (const auto step : steps)
+        {
+            graph.stepNodes[step]->MarkDirty();
+        }
+        return std::nullopt;
+    }
+
+    void NodeEditor::CompleteChain(const GraphSnapshot &graph,
+        const std::vector<size_t> &chain,
+        const std::vector<std::chrono::microseconds> &durations,
+        TiledRun &tiled,
+        std::vector<NodeExecutionRecord> &records,
+        cv::Mat output)
+    {
+        for (size_t k = 0; k < chain.size(); ++k)
+        {
+            Node &node = *graph.stepNodes[chain[k]];
+            const bool last = k + 1 == chain.size();
+            if (!last)
+            {
+                node.ClearOutputSlot(Constants::Tiling::kOutputSlot); // Drop full-size images of earlier runs
+            }
+            if (k > 0)
+            {
+                node.ClearInputSlot(Constants::Tiling::kInputSlot);
+            }
+
+            records[chain[k]].outcome = StepOutcome::Processed;
+            records[chain[k]].duration = durations[k];
+            tiled.roles[chain[k]] = k == 0 ? (last ? TileRole::None : TileRole::First)
+                                           : (last ? TileRole::Last : TileRole::Middle);
+        }
+
+        graph.stepNodes[chain.back()]->SetOutputSlotData(Constants::Tiling::kOutputSlot, std::move(output));
+        MarkDataConsumersDirty(graph, graph.plan[chain.back()]);
+    }
+
+    void NodeEditor::ReleaseDiscardedTileOutputs(const GraphSnapshot &graph, bool chainsEnabled, bool regionsEnabled)
+    {
+        if (discardedTileOutputs.empty() && discardedRegionOutputs.empty())
+        {
+            return;
+        }
+
+        std::unordered_set<NodeId> chainNodes;
+        for (const auto &step : graph.plan)
+        {
+            if (step.tileSuccessor)
+            {
+                chainNodes.insert(step.nodeId);
+            }
+        }
+
+        const auto release = [&](std::unordered_set<NodeId> &discarded, bool enabled) {
+            std::erase_if(discarded, [&](NodeId id) {
+                if (enabled && chainNodes.contains(id))
+                {
+                    return false;
+                }
+                if (const auto it = graph.nodes.find(id); it != graph.nodes.end())
+                {
+                    it->second->MarkDirty();
+                }
+                return true;
+            });
+        };
+        release(discardedTileOutputs, chainsEnabled);
+        release(discardedRegionOutputs, regionsEnabled);
+    }
+
+    void NodeEditor::TrackDiscardedTileOutputs(const GraphSnapshot &graph,
+        const TiledRun &tiled,
+        const std::vector<NodeExecutionRecord> &records)
+    {
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            const NodeId id = graph.plan[i].nodeId;
+            if (tiled.roles[i] == TileRole::First || tiled.roles[i] == TileRole::Middle)
+            {
+                const bool region = tiled.regionSteps[i] != 0;
+                (region ? discardedRegionOutputs : discardedTileOutputs).insert(id);
+                (region ? discardedTileOutputs : discardedRegionOutputs).erase(id);
+            }
+            else if (records[i].outcome == StepOutcome::Processed || records[i].outcome == StepOutcome::CacheHit
+                     || records[i].outcome == StepOutcome::Aliased)
+            {
+                discardedTileOutputs.erase(id);
+                discardedRegionOutputs.erase(id);
+            }
+        }
+    }
+
+    std::vector<double> NodeEditor::RankSteps(const GraphSnapshot &graph) const
+    {
+        if (!criticalPathScheduling.load(std::memory_order_relaxed))
+        {
+            return {};
+        }
+
+        std::unordered_set<NodeId> visible;
+        {
+            std::scoped_lock lock(graphMutex);
+            visible = visibleNodes;
+        }
+
+        // Dependents come later in the plan, so one backward pass sees every chain below a step; clean steps
+        // that will be skipped cost nothing
+        const auto &plan = graph.plan;
+        std::vector<double> remaining(plan.size(), 0.0);
+        std::vector<uint8_t> feedsVisible(plan.size(), 0);
+        double totalCost = 0.0;
+        for (size_t i = plan.size(); i-- > 0;)
+        {
+            const Node *node = graph.stepNodes[i];
+            double cost = 0.0;
+            if (node && !CanSkipStep(*node))
+            {
+                cost = nodeCosts.GetEstimate(plan[i].nodeId).value_or(Constants::Scheduling::kUnknownCostMicroseconds);
+            }
+            double below = 0.0;
+            for (const auto dependent : plan[i].dependentSteps)
+            {
+                below = std::max(below, remaining[dependent]);
+            }
+            remaining[i] = cost + below;
+            totalCost += cost;
+
+            if (feedsVisible[i] || visible.contains(plan[i].nodeId))
+            {
+                feedsVisible[i] = 1;
+                for (const auto producer : plan[i].dataProducerSteps)
+                {
+                    feedsVisible[producer] = 1;
+                }
+            }
+        }
+
+        // Any step feeding a visible node outranks every other, however long their chains
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            if (feedsVisible[i])
+            {
+                remaining[i] += totalCost + 1.0;
+            }
+        }
+        return remaining;
+    }
+
+    bool NodeEditor::CanSkipStep(const Node &node) const
+    {
+        return incrementalExecution.load(std::memory_order_relaxed) && !node.IsDirty();
+    }
+
+    bool NodeEditor::IsStepBypassed(const GraphSnapshot &graph,
+        size_t index,
+        const std::function<bool(size_t)> &bypassed)
+    {
+        const auto &step = graph.plan[index];
+        if (!step.conditional)
+        {
+            return false;
+        }
+        return std::ranges::none_of(step.executionInputs, [&](const ExecutionWire &wire) {
+            if (bypassed(wire.producerStep))
+            {
+                return false;
+            }
+            const Node *producer = graph.stepNodes[wire.producerStep];
+            return !graph.plan[wire.producerStep].branches || (producer && producer->IsExecutionOutputTaken(wire.pin));
+        });
+    }
+
+    void NodeEditor::BypassStep(const GraphSnapshot &graph, const ExecutionStep &step, Node &node)
+    {
+        LOG_HOT_DEBUG("Bypassing node on an untaken branch: {} (ID: {})", node.GetName(), step.nodeId);
+        bool hadOutputs = false;
+        for (SlotIndex slot = 0; slot < node.GetOutputSlotCount(); ++slot)
+        {
+            hadOutputs = hadOutputs || node.GetOutputSlot(slot).HasData();
+            node.ClearOutputSlot(slot);
+        }
+        if (hadOutputs)
+        {
+            MarkDataConsumersDirty(graph, step);
+        }
+        node.MarkDirty();
+    }
+
+    bool NodeEditor::RunLoopStep(const GraphSnapshot &graph,
+        size_t index,
+        Node &node,
+        const StopCondition &stop,
+        std::vector<NodeExecutionRecord> *records)
+    {
+        const auto &loop = graph.plan[index];
+        const auto setOutcome = [records](size_t step, StepOutcome outcome) {
+            if (records)
+            {
+                (*records)[step].outcome = outcome;
+            }
+        };
+
+        const bool bodyClean = std::ranges::all_of(loop.loopBody, [&](size_t step) {
+            const Node *bodyNode = graph.stepNodes[step];
+            return !bodyNode || CanSkipStep(*bodyNode);
+        });
+        if (bodyClean && CanSkipStep(node))
+        {
+            LOG_HOT_DEBUG("Skipping clean loop: {} (ID: {})", node.GetName(), loop.nodeId);
+            setOutcome(index, StepOutcome::Skipped);
+            for (const auto step : loop.loopBody)
+            {
+                setOutcome(step, StepOutcome::Skipped);
+            }
+            return true;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        if (!RunExecutionStep(graph, loop, node, stop, nullptr, records ? &(*records)[index] : nullptr))
+        {
+            return false;
+        }
+
+        // Cleared before the iterations, so parameter edits made while they run are not lost
+        for (const auto step : loop.loopBody)
+        {
+            if (Node *bodyNode = graph.stepNodes[step])
+            {
+                bodyNode->ClearDirty();
+            }
+        }
+
+        std::string error;
+        const auto iterations = RunLoopIterations(graph, index, node, stop, error);
+        if (!iterations)
+        {
+            LOG_ERROR("Loop node {} (ID: {}) stopped: {}", node.GetName(), loop.nodeId, error);
+            node.MarkDirty();
+            setOutcome(index, stop.IsStopRequested() ? StepOutcome::Cancelled : StepOutcome::Failed);
+            return false;
+        }
+        LOG_HOT_INFO("Loop node {} ran its body for {} elements", node.GetName(), *iterations);
+
+        // Readers after the loop see the last element's outputs; the body itself reran anyway
+        for (const auto step : loop.loopBody)
+        {
+            for (const auto consumer : graph.plan[step].dataConsumerSteps)
+            {
+                Node *consumerNode = graph.stepNodes[consumer];
+                if (consumerNode && consumer != index && !std::ranges::binary_search(loop.loopBody, consumer))
+                {
+                    consumerNode->MarkDirty();
+                }
+            }
+            for (const auto id : graph.plan[step].prunedConsumers)
+            {
+                if (const auto it = graph.nodes.find(id); it != graph.nodes.end())
+                {
+                    it->second->MarkDirty();
+                }
+            }
+            setOutcome(step, *iterations > 0 ? StepOutcome::Processed : StepOutcome::Bypassed);
+        }
+        if (records)
+        {
+            (*records)[index].duration =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        }
+        return true;
+    }
+
+    std::optional<size_t> NodeEditor::RunLoopIterations(const GraphSnapshot &graph,
+        size_t index,
+        Node &node,
+        const StopCondition &stop,
+        std::string &error)
+    {
+        const auto &plan = graph.plan;
+        const auto &loop = plan[index];
+        const auto elements = node.GetLoopElements();
+        const size_t count = elements.values.size();
+
+        std::unordered_set<NodeId> bodyNodes;
+        for (const auto step : loop.loopBody)
+        {
+            bodyNodes.insert(plan[step].nodeId);
+        }
+        const auto producerOf = [](const InputBinding &binding) -> const Slot * {
+            return binding.producer ? &binding.producer->GetOutputSlot(binding.fromSlot) : nullptr;
+        };
+
+        // Outputs from outside the body are read once here, where the loop runs, and shared into each iteration
+        std::vector<std::pair<const Slot *, std::shared_ptr<const NodeData>>> captured;
+        for (const auto step : loop.loopBody)
+        {
+            for (const auto &binding : plan[step].inputs)
+            {
+                const auto *slot = producerOf(binding);
+                if (slot && !bodyNodes.contains(graph.connections[binding.connectionIndex].from))
+                {
+                    captured.emplace_back(slot, slot->GetSharedData());
+                }
+            }
+        }
+
+        // The loop node's inputs wired from inside the body carry each iteration's result
+        const Slot *resultSlot = nullptr;
+        for (const auto &binding : loop.inputs)
+        {
+            if (bodyNodes.contains(graph.connections[binding.connectionIndex].from))
+            {
+                resultSlot = producerOf(binding);
+                break;
+            }
+        }
+
+        std::vector<std::shared_ptr<const NodeData>> results(count);
+        std::vector<std::vector<std::shared_ptr<const NodeData>>> lastOutputs(loop.loopBody.size());
+        std::atomic<bool> failed{ false };
+        std::mutex errorMutex;
+        const auto fail = [&](std::string message) {
+            std::scoped_lock lock(errorMutex);
+            if (!failed.exchange(true))
+            {
+                error = std::move(message);
+            }
+        };
+
+        const auto runIteration = [&](size_t element) {
+            if (failed.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            ExecutionContext iteration;
+            for (const auto &[slot, data] : captured)
+            {
+                iteration.SetData(*slot, data);
+            }
+            const ExecutionContext::Scope scope(iteration, stop);
+            node.BeginLoopIteration(element, elements.values[element]);
+
+            std::vector<uint8_t> bypassed(plan.size());
+            const std::function<bool(size_t)> isBypassed = [&bypassed](size_t step) { return bypassed[step] != 0; };
+            for (const auto step : loop.loopBody)
+            {
+                Node *bodyNode = graph.stepNodes[step];
+                if (!bodyNode || plan[step].loopOwner != index)
+                {
+                    continue; // Nested loop bodies run inside their own loop step
+                }
+                if (stop.IsStopRequested())
+                {
+                    fail(stop.IsCancelled() ? "execution cancelled" : "execution deadline exceeded");
+                    return;
+                }
+                if (IsStepBypassed(graph, step, isBypassed))
+                {
+                    bypassed[step] = 1;
+                    for (SlotIndex slot = 0; slot < bodyNode->GetOutputSlotCount(); ++slot)
+                    {
+                        bodyNode->ClearOutputSlot(slot);
+                    }
+                    continue;
+                }
+
+                std::string stepError;
+                if (!RunContextStep(graph, plan[step], *bodyNode, stepError)
+                    || (!plan[step].loopBody.empty() && !RunLoopIterations(graph, step, *bodyNode, stop, stepError)))
+                {
+                    fail("element " + std::to_string(element) + ": " + stepError);
+                    return;
+                }
+            }
+
+            results[element] = resultSlot ? resultSlot->GetSharedData() : nullptr;
+            if (element + 1 == count)
+            {
+                for (size_t k = 0; k < loop.loopBody.size(); ++k)
+                {
+                    const Node *bodyNode = graph.stepNodes[loop.loopBody[k]];
+                    for (SlotIndex slot = 0; bodyNode && slot < bodyNode->GetOutputSlotCount(); ++slot)
+                    {
+                        lastOutputs[k].push_back(bodyNode->GetOutputSlot(slot).GetSharedData());
+                    }
+                }
+            }
+        };
+
+        if (elements.parallel && count > 1)
+        {
+            cv::parallel_for_(cv::Range(0, static_cast<int>(count)), [&](const cv::Range &range) {
+                for (int element = range.start; element < range.end; ++element)
+                {
+                    runIteration(static_cast<size_t>(element));
+                }
+            });
+        }
+        else
+        {
+            for (size_t element = 0; element < count; ++element)
+            {
+                runIteration(element);
+            }
+        }
+        if (failed)
+        {
+            return std::nullopt;
+        }
+
+        // Body nodes keep the last element's outputs where the loop runs, e.g. for previews
+        for (size_t k = 0; k < loop.loopBody.size(); ++k)
+        {
+            if (Node *bodyNode = graph.stepNodes[loop.loopBody[k]])
+            {
+                for (SlotIndex slot = 0; slot < bodyNode->GetOutputSlotCount(); ++slot)
+                {
+                    bodyNode->ShareOutputSlotData(slot, count > 0 ? lastOutputs[k][slot] : nullptr);
+                }
+            }
+        }
+        node.FinishLoop(std::move(results));
+        return count;
+    }
+
+    void NodeEditor::ReleaseConsumedData(const GraphSnapshot &graph, size_t index, LivenessRun &liveness)
+    {
+        if (!liveness.enabled)
+        {
+            return;
+        }
+
+        // Result nodes keep their inputs along with their outputs, and so do nodes a duplicate compares against
+        const auto &step = graph.plan[index];
+        Node *finished = graph.stepNodes[index];
+        if (finished && step.releasableOutputs && !step.aliased)
+        {
+            for (const auto &binding : step.inputs)
+            {
+                finished->ShareInputSlotData(binding.toSlot, nullptr); // Pulled again before the node next runs
+            }
+        }
+
+        // The acq_rel countdown makes the last consumer, on whichever worker, see every earlier read finished
+        for (const auto producer : step.dataProducerSteps)
+        {
+            Node *node = graph.stepNodes[producer];
+            if (liveness.pendingReaders[producer].fetch_sub(1, std::memory_order_acq_rel) != 1 || !node
+                || !graph.plan[producer].releasableOutputs)
+            {
+                continue;
+            }
+
+            for (SlotIndex slot = 0; slot < node->GetOutputSlotCount(); ++slot)
+            {
+                node->ClearOutputSlot(slot);
+            }
+            node->MarkDirty();
+            LOG_HOT_DEBUG("Released outputs of node: {} (ID: {})", node->GetName(), node->GetId());
+        }
+    }
+
+    void NodeEditor::FinishStep(const GraphSnapshot &graph,
+        size_t index,
+        NodeExecutionRecord &record,
+        LivenessRun &liveness,
+        MemoryRun &memory) const
+    {
+        if (const Node *node = graph.stepNodes[index])
+        {
+            record.inputBytes = 0;
+            for (SlotIndex slot = 0; slot < node->GetInputSlotCount(); ++slot)
+            {
+                record.inputBytes += SlotBytes(node->GetInputSlot(slot));
+            }
+            record.outputBytes = 0;
+            for (SlotIndex slot = 0; slot < node->GetOutputSlotCount(); ++slot)
+            {
+                record.outputBytes += SlotBytes(node->GetOutputSlot(slot));
+            }
+
+            // Other workers may change slots meanwhile; the total is a snapshot taken after this step
+            const size_t total = MeasureSlotBytes(graph);
+            std::scoped_lock lock(memory.mutex);
+            if (total > memory.peakBytes)
+            {
+                memory.peakBytes = total;
+                memory.peakNodeId = node->GetId();
+            }
+        }
+
+        if (liveness.spilling)
+        {
+            std::scoped_lock lock(liveness.spillMutex);
+            for (const auto producer : liveness.pinned[index])
+            {
+                --liveness.pins[producer];
+            }
+            liveness.pinned[index].clear();
+            liveness.finished[index] = 1;
+        }
+
+        ReleaseConsumedData(graph, index, liveness);
+        if (liveness.spilling)
+        {
+            EnforceMemoryBudget(graph, liveness);
+        }
+    }
+
+    bool NodeEditor::FaultInProducers(const GraphSnapshot &graph, size_t index, LivenessRun &liveness)
+    {
+        if (!liveness.spilling)
+        {
+            return true;
+        }
+
+        // Read back under the lock, so no worker spills the outputs again before this step pulls them
+        std::scoped_lock lock(liveness.spillMutex);
+        liveness.started[index] = 1;
+        auto &pinned = liveness.pinned[index];
+        bool restored = true;
+        for (std::optional<size_t> step = index; step; step = graph.plan[*step].tileSuccessor)
+        {
+            // A tiled chain started here also pulls the inputs of its later steps
+            for (const auto producer : graph.plan[*step].dataProducerSteps)
+            {
+                ++liveness.pins[producer];
+                pinned.push_back(producer);
+                const uint64_t ticket = std::exchange(liveness.spillTickets[producer], 0);
+                Node *node = graph.stepNodes[producer];
+                if (ticket == 0 || !node)
+                {
+                    continue;
+                }
+
+                const auto outputs = MemoryBudget::Get().Restore(ticket);
+                if (!outputs)
+                {
+                    LOG_ERROR("Lost the spilled outputs of node: {} (ID: {})", node->GetName(), node->GetId());
+                    node->MarkDirty();
+                    restored = false;
+                    continue;
+                }
+                for (SlotIndex slot = 0; slot < outputs->size() && slot < node->GetOutputSlotCount(); ++slot)
+                {
+                    node->ShareOutputSlotData(slot, (*outputs)[slot]);
+                }
+                LOG_HOT_DEBUG("Restored spilled outputs of node: {} (ID: {})", node->GetName(), node->GetId());
+            }
+        }
+        return restored;
+    }
+
+    void NodeEditor::EnforceMemoryBudget(const GraphSnapshot &graph, LivenessRun &liveness) const
+    {
+        auto &budget = MemoryBudget::Get();
+        const size_t limit = budget.GetLimit();
+        std::scoped_lock lock(liveness.spillMutex);
+
+        // Slot data and cached outputs are measured apart, so an image in both counts twice until the cache
+        // is trimmed; the budget then errs toward freeing memory early
+        const auto report = [&]() {
+            const size_t held =
+                MeasureSlotBytes(graph) + outputCache.GetUsedBytes() + outputCache.GetCompressedBytes();
+            return budget.UpdateUsage(std::exchange(liveness.reportedBytes, held), held);
+        };
+        const size_t used = report();
+        if (limit == 0 || used <= limit)
+        {
+            return;
+        }
+
+        // Cached outputs go first: they only save recomputation, while spilled intermediates must be read back
+        size_t excess = used - limit;
+        const size_t cached = outputCache.GetUsedBytes() + outputCache.GetCompressedBytes();
+        const size_t trimmed = outputCache.Trim(cached - std::min(cached, excess));
+        budget.RecordCacheTrim(trimmed);
+        excess -= std::min(excess, trimmed);
+
+        // Finished outputs still awaited by steps that have not started, the one needed furthest ahead first
+        thread_local std::vector<std::pair<size_t, size_t>> candidates; // Next consumer, producer
+        candidates.clear();
+        for (size_t producer = 0; excess > 0 && producer < graph.plan.size(); ++producer)
+        {
+            const auto &step = graph.plan[producer];
+            if (!liveness.finished[producer] || liveness.pins[producer] > 0 || liveness.spillTickets[producer] != 0
+                || !step.releasableOutputs || step.aliased || step.aliasOf
+                || liveness.pendingReaders[producer].load(std::memory_order_acquire) == 0)
+            {
+                continue;
+            }
+            size_t nextConsumer = graph.plan.size();
+            for (const auto consumer : step.dataConsumerSteps)
+            {
+                if (!liveness.started[consumer])
+                {
+                    nextConsumer = std::min(nextConsumer, consumer);
+                }
+            }
+            if (nextConsumer < graph.plan.size())
+            {
+                candidates.emplace_back(nextConsumer, producer);
+            }
+        }
+        std::ranges::sort(candidates, std::greater{});
+
+        for (const auto &[nextConsumer, producer] : candidates)
+        {
+            if (excess == 0)
+            {
+                break;
+            }
+            excess -= std::min(excess, SpillStepOutputs(graph, producer, liveness));
+        }
+        if (trimmed > 0 || !candidates.empty())
+        {
+            report();
+        }
+    }
+
+    size_t NodeEditor::SpillStepOutputs(const GraphSnapshot &graph, size_t index, LivenessRun &liveness)
+    {
+        Node *node = graph.stepNodes[index];
+        if (!node)
+        {
+            return 0;
+        }
+
+        std::vector<std::shared_ptr<const NodeData>> outputs(node->GetOutputSlotCount());
+        size_t bytes = 0;
+        for (SlotIndex slot = 0; slot < outputs.size(); ++slot)
+        {
+            outputs[slot] = node->GetOutputSlot(slot).GetSharedData();
+            if (outputs[slot])
+            {
+                if (!PersistentOutputStore::CanPersist(*outputs[slot]))
+                {
+                    return 0;
+                }
+                bytes += NodeOutputCache::EstimateBytes(*outputs[slot]);
+            }
+        }
+        if (bytes == 0)
+        {
+            return 0;
+        }
+
+        const auto ticket = MemoryBudget::Get().Spill(outputs, bytes);
+        if (!ticket)
+        {
+            return 0;
+        }
+        for (SlotIndex slot = 0; slot < outputs.size(); ++slot)
+        {
+            node->ClearOutputSlot(slot);
+        }
+        liveness.spillTickets[index] = *ticket;
+        ++liveness.spills;
+        LOG_HOT_DEBUG("Spilled {} KB of outputs of node: {} (ID: {})", bytes / 1024, node->GetName(), node->GetId());
+        return bytes;
+    }
+
+    void NodeEditor::DiscardSpilledOutputs(const GraphSnapshot &graph, LivenessRun &liveness)
+    {
+        if (!liveness.spilling)
+        {
+            return;
+        }
+
+        std::scoped_lock lock(liveness.spillMutex);
+        for (size_t index = 0; index < liveness.spillTickets.size(); ++index)
+        {
+            if (const uint64_t ticket = std::exchange(liveness.spillTickets[index], 0))
+            {
+                MemoryBudget::Get().Discard(ticket);
+                if (Node *node = graph.stepNodes[index])
+                {
+                    node->MarkDirty();
+                }
+            }
+        }
+        MemoryBudget::Get().UpdateUsage(std::exchange(liveness.reportedBytes, 0), 0);
+    }
+
+    size_t NodeEditor::MeasureSlotBytes(const GraphSnapshot &graph)
+    {
+        // Connected inputs share their upstream output's handle, so each handle is counted once. This runs after
+        // every step, so the handles are gathered in a per-thread buffer that keeps its capacity between calls.
+        thread_local std::vector<std::shared_ptr<const NodeData>> handles;
+        handles.clear();
+        for (const auto &[id, node] : graph.nodes)
+        {
+            for (SlotIndex slot = 0; slot < node->GetInputSlotCount(); ++slot)
+            {
+                if (auto data = node->GetInputSlot(slot).GetSharedData())
+                {
+                    handles.push_back(std::move(data));
+                }
+            }
+            for (SlotIndex slot = 0; slot < node->GetOutputSlotCount(); ++slot)
+            {
+                if (auto data = node->GetOutputSlot(slot).GetSharedData())
+                {
+                    handles.push_back(std::move(data));
+                }
+            }
+        }
+
+        std::ranges::sort(handles, std::less{}, [](const auto &data) { return data.get(); });
+        size_t total = 0;
+        for (size_t i = 0; i < handles.size(); ++i)
+        {
+            if (i == 0 || handles[i] != handles[i - 1])
+            {
+                total += NodeOutputCache::EstimateBytes(*handles[i]);
+            }
+        }
+        handles.clear(); // Holding the handles would keep released slot data alive
+        return total;
+    }
+
+    void NodeEditor::MarkDataConsumersDirty(const GraphSnapshot &graph, const ExecutionStep &step)
+    {
+        for (const auto consumer : step.dataConsumerSteps)
+        {
+            if (Node *node = graph.stepNodes[consumer])
+            {
+                node->MarkDirty();
+            }
+        }
+        for (const auto id : step.prunedConsumers)
+        {
+            if (const auto it = graph.nodes.find(id); it != graph.nodes.end())
+            {
+                it->second->MarkDirty();
+            }
+        }
+    }
+
+    void NodeEditor::MarkNodesEditedDuringRun(const GraphSnapshot &graph)
+    {
+        std::scoped_lock lock(graphMutex);
+        if (graph.version == graphVersion)
+        {
+            return;
+        }
+
+        auto markChanged = [this](const std::vector<Connection> &from, const std::vector<Connection> &against) {
+            for (const auto &connection : from)
+            {
+                if (std::ranges::find(against, connection) == against.end())
+                {
+                    MarkNodeDirty(connection.to);
+                }
+            }
+        };
+        markChanged(connections, graph.connections); // Added
+        markChanged(graph.connections, connections); // Removed
+    }
+
+    std::shared_future<bool> NodeEditor::ExecuteAsync(const ExecutionProgressCallback &progressCallback)
+    {
+        // Create a new stop source for this execution
+        stopSource = std::stop_source();
+        std::stop_token stopToken = stopSource.get_token();
+
+        // Run on a parked job thread instead of starting one per call
+        currentExecution = executor->Launch([this, progressCallback, stopToken]() {
+            return NotifyRunFinished(Execute(progressCallback, stopToken));
+        });
+
+        return currentExecution;
+    }
+
+    std::shared_future<bool> NodeEditor::ExecuteFullResolutionAsync(const ExecutionProgressCallback &progressCallback)
+    {
+        stopSource = std::stop_source();
+        std::stop_token stopToken = stopSource.get_token();
+        currentExecution = executor->Launch([this, progressCallback, stopToken]() {
+            return NotifyRunFinished(ExecuteFullResolution(progressCallback, stopToken));
+        });
+
+        return currentExecution;
+    }
+
+    std::shared_future<bool> NodeEditor::ExecuteUpToAsync(NodeId target,
+        const ExecutionProgressCallback &progressCallback)
+    {
+        stopSource = std::stop_source();
+        std::stop_token stopToken = stopSource.get_token();
+        currentExecution = executor->Launch([this, target, progressCallback, stopToken]() {
+            return NotifyRunFinished(ExecuteUpTo(target, progressCallback, stopToken));
+        });
+
+        return currentExecution;
+    }
+
+    std::optional<size_t> NodeEditor::ExecuteStream(const StreamFrameCallback &frameCallback,
+        size_t maxFrames,
+        std::stop_token stopToken)
+    {
+        if (!stopToken.stop_possible())
+        {
+            std::scoped_lock lock(executionMutex);
+            stopSource = std::stop_source();
+        }
+        const StopCondition stop(stopToken, stopSource.get_token());
+
+        LOG_INFO("Starting stream execution");
+
+        size_t framesCompleted = 0;
+        bool streamEnded = false;
+        while (!streamEnded && (maxFrames == 0 || framesCompleted < maxFrames))
+        {
+            if (stop.IsStopRequested())
+            {
+                LogStopped(stop, "Stream execution");
+                break;
+            }
+
+            std::optional<size_t> segmentFrames;
+            {
+                // Edits made between segments are picked up by the next snapshot
+                const auto executionLock = LockTraced(executionMutex, "Wait executionMutex");
+                TraceScope trace("graph", "Stream segment");
+                const auto graph = PullFromSinks(AcquireSnapshot());
+                if (!graph)
+                {
+                    return std::nullopt;
+                }
+                ReleaseDiscardedTileOutputs(*graph, false, false);
+                ApplyProxyScale(*graph, 1.0);
+                ApplyPrecisionPolicy(*graph, precisionPolicy.load());
+
+                const bool hasSource = std::ranges::any_of(
+                    graph->stepNodes, [](const Node *node) { return node && node->IsStreamSource(); });
+                if (!hasSource)
+                {
+                    LOG_ERROR("Stream execution needs a stream source node (e.g. Video Input) in the execution flow");
+                    return std::nullopt;
+                }
+
+                const size_t remaining = maxFrames == 0 ? Constants::Stream::kFramesPerSegment
+                                                        : maxFrames - framesCompleted;
+                const size_t frameCount = std::min(remaining, Constants::Stream::kFramesPerSegment);
+                // Loop bodies run inside their loop step, which the pipelined scheduler does not model
+                const bool hasLoops =
+                    std::ranges::any_of(graph->plan, [](const ExecutionStep &step) { return !step.loopBody.empty(); });
+                segmentFrames =
+                    executionMode.load() == ExecutionMode::Parallel && !hasLoops
+                        ? ExecuteStreamSegmentPipelined(
+                              *graph, framesCompleted, frameCount, frameCallback, stop, streamEnded)
+                        : ExecuteStreamSegmentSequential(
+                              *graph, framesCompleted, frameCount, frameCallback, stop, streamEnded);
+                derivedImages->Clear();
+                MarkNodesEditedDuringRun(*graph);
+            }
+
+            if (!segmentFrames && stop.IsStopRequested())
+            {
+                LogStopped(stop, "Stream execution"); // A node stopped early; its frame is dropped
+                break;
+            }
+            if (!segmentFrames)
+            {
+                LOG_ERROR("Stream execution failed after {} frames", framesCompleted);
+                return std::nullopt;
+            }
+            framesCompleted += *segmentFrames;
+
+            // Let a queued Execute() or batch run take its turn between segments
+            std::this_thread::yield();
+        }
+
+        LOG_INFO("Stream execution finished after {} frames", framesCompleted);
+        return framesCompleted;
+    }
+
+    std::optional<size_t> NodeEditor::ExecuteStreamSegmentSequential(const GraphSnapshot &graph,
+        size_t firstFrame,
+        size_t frameCount,
+        const StreamFrameCallback &frameCallback,
+        const StopCondition &stop,
+        bool &streamEnded)
+    {
+        std::vector<uint8_t> bypassed(graph.plan.size());
+        const std::function<bool(size_t)> isBypassed = [&bypassed](size_t step) { return bypassed[step] != 0; };
+        for (size_t frame = 0; frame < frameCount; ++frame)
+        {
+            for (size_t index = 0; index < graph.plan.size(); ++index)
+            {
+                if (stop.IsStopRequested())
+                {
+                    LogStopped(stop, "Stream execution");
+                    return frame;
+                }
+
+                Node *node = graph.stepNodes[index];
+                if (!node)
+                    continue;
+
+                const auto &step = graph.plan[index];
+                if (step.loopOwner && !bypassed[*step.loopOwner])
+                {
+                    continue; // Ran inside its loop step
+                }
+
+                // Each frame takes its own path through the branches
+                bypassed[index] = IsStepBypassed(graph, index, isBypassed) ? 1 : 0;
+                if (bypassed[index])
+                {
+                    BypassStep(graph, step, *node);
+                    continue;
+                }
+
+                const bool isSource = node->IsStreamSource();
+                if (isSource)
+                {
+                    node->MarkDirty();
+                }
+
+                if (!step.loopBody.empty() ? !RunLoopStep(graph, index, *node, stop, nullptr)
+                                           : !CanSkipStep(*node) && !RunExecutionStep(graph, step, *node, stop))
+                {
+                    return std::nullopt;
+                }
+
+                // Later steps would only see stale inputs, so the frame ends here
+                if (isSource && node->HasStreamEnded())
+                {
+                    streamEnded = true;
+                    return frame;
+                }
+            }
+
+            if (frameCallback && !frameCallback(firstFrame + frame))
+            {
+                streamEnded = true;
+                return frame + 1;
+            }
+        }
+
+        return frameCount;
+    }
+
+    std::optional<size_t> NodeEditor::ExecuteStreamSegmentPipelined(const GraphSnapshot &graph,
+        size_t firstFrame,
+        size_t frameCount,
+        const StreamFrameCallback &frameCallback,
+        const StopCondition &stop,
+        bool &streamEnded)
+    {
+        const auto workerPool = executor->AcquireWorkerPool();
+        auto &pool = *workerPool;
+        const auto &plan = graph.plan;
+        const auto &stepNodes = graph.stepNodes;
+        const size_t stepCount = plan.size();
+
+        // Split plan edges by direction; data wires running against the flow read the previous frame
+        std::vector<std::vector<size_t>> dependencies(stepCount);
+        std::vector<std::vector<size_t>> laterProducers(stepCount);
+        std::vector<std::vector<size_t>> laterConsumers(stepCount);
+        for (size_t i = 0; i < stepCount; ++i)
+        {
+            for (const auto dependent : plan[i].dependentSteps)
+            {
+                dependencies[dependent].push_back(i);
+            }
+            for (const auto consumer : plan[i].dataConsumerSteps)
+            {
+                if (consumer > i)
+                {
+                    laterConsumers[i].push_back(consumer);
+                }
+                else
+                {
+                    laterProducers[consumer].push_back(i);
+                }
+            }
+        }
+
+        // Frame counters per step, all guarded by schedulerMutex
+        std::vector<size_t> started(stepCount, 0);
+        std::vector<size_t> pulled(stepCount, 0);
+        std::vector<size_t> completed(stepCount, 0);
+        size_t frameLimit = frameCount;
+        size_t reported = 0;
+        size_t tasksInFlight = 0;
+        bool reporting = false;
+        bool failed = false;
+
+        std::mutex schedulerMutex;
+        std::condition_variable idleCondition;
+
+        auto canStart = [&](size_t index) {
+            const size_t frame = completed[index];
+            if (started[index] != frame || frame >= frameLimit || frame >= reported + Constants::Stream::kPipelineDepth)
+            {
+                return false;
+            }
+
+            // Terminal steps keep the reported frame visible to the callback
+            if (plan[index].dependentSteps.empty() && frame > reported)
+            {
+                return false;
+            }
+
+            return std::ranges::all_of(dependencies[index], [&](size_t d) { return completed[d] > frame; })
+                   && std::ranges::all_of(laterProducers[index], [&](size_t p) { return completed[p] >= frame; })
+                   && std::ranges::all_of(laterConsumers[index], [&](size_t c) { return pulled[c] >= frame; });
+        };
+
+        // Called with schedulerMutex held
+        auto dispatch = [&](auto &self) -> void {
+            if (failed || stop.IsStopRequested())
+            {
+                return;
+            }
+
+            for (size_t index = 0; index < stepCount; ++index)
+            {
+                if (!canStart(index))
+                {
+                    continue;
+                }
+
+                const size_t frame = started[index]++;
+                ++tasksInFlight;
+                pool.Submit([&, index, frame]() {
+                    bool succeeded = true;
+                    Node *node = stepNodes[index];
+                    if (node)
+                    {
+                        if (node->IsStreamSource())
+                        {
+                            node->MarkDirty();
+                        }
+
+                        if (!CanSkipStep(*node))
+                        {
+                            // Releasing producers as soon as inputs are copied lets them overlap with this step
+                            succeeded = RunExecutionStep(graph, plan[index], *node, stop, [&]() {
+                                std::scoped_lock lock(schedulerMutex);
+                                pulled[index] = frame + 1;
+                                self(self);
+                            }).has_value();
+                        }
+                    }
+
+                    std::unique_lock lock(schedulerMutex);
+                    pulled[index] = frame + 1;
+                    completed[index] = frame + 1;
+                    if (!succeeded)
+                    {
+                        failed = true;
+                    }
+                    else if (node && node->IsStreamSource() && node->HasStreamEnded())
+                    {
+                        // Frame never existed; drop it and everything after
+                        frameLimit = std::min(frameLimit, frame);
+                        streamEnded = true;
+                    }
+
+                    // Report whole frames in order; terminal steps cannot move on until this happens
+                    while (!reporting && !failed && reported < frameLimit
+                           && *std::ranges::min_element(completed) > reported)
+                    {
+                        reporting = true;
+                        const size_t frameIndex = reported;
+                        lock.unlock();
+                        const bool keepStreaming = !frameCallback || frameCallback(firstFrame + frameIndex);
+                        lock.lock();
+                        reporting = false;
+                        ++reported;
+                        if (!keepStreaming)
+                        {
+                            frameLimit = std::min(frameLimit, reported);
+                            streamEnded = true;
+                        }
+                    }
+
+                    self(self);
+                    if (--tasksInFlight == 0)
+                    {
+                        idleCondition.notify_all();
+                    }
+                });
+            }
+        };
+
+        std::unique_lock lock(schedulerMutex);
+        dispatch(dispatch);
+        idleCondition.wait(lock, [&]() { return tasksInFlight == 0; });
+
+        if (failed)
+        {
+            return std::nullopt;
+        }
+        return reported;
+    }
+
+    void NodeEditor::CancelExecution()
+    {
+        stopSource.request_stop();
+    }
+
+    void NodeEditor::SetExecutionMode(ExecutionMode mode)
+    {
+        executionMode.store(mode);
+    }
+
+    ExecutionMode NodeEditor::GetExecutionMode() const
+    {
+        return executionMode.load();
+    }
+
+    void NodeEditor::SetWorkerCount(size_t count)
+    {
+        executor->SetWorkerCount(count);
+    }
+
+    void NodeEditor::SetCriticalPathScheduling(bool enabled)
+    {
+        criticalPathScheduling.store(enabled);
+    }
+
+    bool NodeEditor::IsCriticalPathSchedulingEnabled() const
+    {
+        return criticalPathScheduling.load();
+    }
+
+    void NodeEditor::SetVisibleNodes(std::vector<NodeId> nodeIds)
+    {
+        std::scoped_lock lock(graphMutex);
+        visibleNodes = std::unordered_set<NodeId>(nodeIds.begin(), nodeIds.end());
+    }
+
+    const NodeCostModel &NodeEditor::GetNodeCosts() const
+    {
+        return nodeCosts;
+    }
+
+    void NodeEditor::SetExecutorService(std::shared_ptr<ExecutorService> service)
+    {
+        // A running execution holds the current service's pool and job thread
+        std::shared_ptr<ExecutorService> previous;
+        {
+            std::scoped_lock lock(executionMutex);
+            previous = std::exchange(executor, std::move(service));
+        }
+        // Released unlocked: if this was the last reference, its queued runs must still take executionMutex
+    }
+
+    ExecutorService &NodeEditor::GetExecutorService()
+    {
+        return *executor;
+    }
+
+    void NodeEditor::SetTilingOptions(const TilingOptions &options)
+    {
+        std::scoped_lock lock(graphMutex);
+        tilingOptions = options;
+    }
+
+    TilingOptions NodeEditor::GetTilingOptions() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return tilingOptions;
+    }
+
+    void NodeEditor::SetDeviceExecution(bool enabled)
+    {
+        std::scoped_lock lock(graphMutex);
+        if (deviceExecution == enabled)
+            return;
+
+        if (enabled && !cv::ocl::haveOpenCL())
+        {
+            LOG_WARN("No OpenCL device available, device images are processed on the CPU");
+        }
+        deviceExecution = enabled;
+        InvalidateExecutionPlan();
+    }
+
+    bool NodeEditor::IsDeviceExecutionEnabled() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return deviceExecution;
+    }
+
+    void NodeEditor::SetHostOnlyNodeTypes(std::vector<std::string> nodeTypes)
+    {
+        std::unordered_set<std::string> types(
+            std::make_move_iterator(nodeTypes.begin()), std::make_move_iterator(nodeTypes.end()));
+        std::scoped_lock lock(graphMutex);
+        if (hostOnlyNodeTypes == types)
+            return;
+
+        hostOnlyNodeTypes = std::move(types);
+        InvalidateExecutionPlan();
+    }
+
+    std::vector<std::string> NodeEditor::GetHostOnlyNodeTypes() const
+    {
+        std::vector<std::string> types;
+        {
+            std::scoped_lock lock(graphMutex);
+            types.assign(hostOnlyNodeTypes.begin(), hostOnlyNodeTypes.end());
+        }
+        std::ranges::sort(types);
+        return types;
+    }
+
+    void NodeEditor::SetProxyScale(double scale)
+    {
+        proxyScale.store(std::isfinite(scale) ? std::clamp(scale, Constants::Proxy::kMinScale, 1.0) : 1.0);
+    }
+
+    double NodeEditor::GetProxyScale() const
+    {
+        return proxyScale.load();
+    }
+
+    void NodeEditor::SetPrecisionPolicy(PrecisionPolicy policy)
+    {
+        precisionPolicy.store(policy);
+    }
+
+    PrecisionPolicy NodeEditor::GetPrecisionPolicy() const
+    {
+        return precisionPolicy.load();
+    }
+
+    void NodeEditor::SetIncrementalExecution(bool enabled)
+    {
+        incrementalExecution.store(enabled);
+    }
+
+    bool NodeEditor::IsIncrementalExecution() const
+    {
+        return incrementalExecution.load();
+    }
+
+    void NodeEditor::SetOutputCacheEnabled(bool enabled)
+    {
+        outputCacheEnabled.store(enabled);
+    }
+
+    bool NodeEditor::IsOutputCacheEnabled() const
+    {
+        return outputCacheEnabled.load();
+    }
+
+    void NodeEditor::SetIntermediateRelease(bool enabled)
+    {
+        intermediateRelease.store(enabled);
+    }
+
+    bool NodeEditor::IsIntermediateReleaseEnabled() const
+    {
+        return intermediateRelease.load();
+    }
+
+    void NodeEditor::SetPullEvaluation(PullEvaluation mode)
+    {
+        pullEvaluation.store(mode);
+    }
+
+    PullEvaluation NodeEditor::GetPullEvaluation() const
+    {
+        return pullEvaluation.load();
+    }
+
+    void NodeEditor::SetOutputNodes(std::vector<NodeId> ids)
+    {
+        std::scoped_lock lock(graphMutex);
+        outputNodes = std::move(ids);
+    }
+
+    std::vector<NodeId> NodeEditor::GetOutputNodes() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return outputNodes;
+    }
+
+    void NodeEditor::SetDuplicateElimination(bool enabled)
+    {
+        std::scoped_lock lock(graphMutex);
+        duplicateElimination = enabled;
+        snapshot.reset(); // Duplicates are marked when the snapshot is taken
+    }
+
+    bool NodeEditor::IsDuplicateEliminationEnabled() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return duplicateElimination;
+    }
+
+    void NodeEditor::SetExecutionTimeout(std::chrono::milliseconds timeout)
+    {
+        executionTimeout.store(std::max(timeout, std::chrono::milliseconds::zero()));
+    }
+
+    std::chrono::milliseconds NodeEditor::GetExecutionTimeout() const
+    {
+        return executionTimeout.load();
+    }
+
+    NodeOutputCache &NodeEditor::GetOutputCache()
+    {
+        return outputCache;
+    }
+
+    const ProgressChannel &NodeEditor::GetProgressChannel() const
+    {
+        return progressChannel;
+    }
+
+    ImageBufferPool &NodeEditor::GetImageBufferPool()
+    {
+        return *imagePool;
+    }
+
+    ShapeInference NodeEditor::InferImageShapes(const std::unordered_map<NodeId, ImageShape> &sourceShapes) const
+    {
+        std::unordered_map<NodeId, std::shared_ptr<Node>> graphNodes;
+        std::unordered_map<NodeId, NodeId> producers; // Node feeding each node's "Input" from its "Output"
+        {
+            std::scoped_lock lock(graphMutex);
+            graphNodes = nodes;
+            for (const auto &connection : connections)
+            {
+                if (connection.type == ConnectionType::Data
+                    && connection.toSlot.Str() == Constants::Tiling::kInputSlot
+                    && connection.fromSlot.Str() == Constants::Tiling::kOutputSlot)
+                {
+                    producers.emplace(connection.to, connection.from);
+                }
+            }
+        }
+
+        ShapeInference inference;
+        std::unordered_set<NodeId> visited;
+        std::vector<NodeId> chain;
+        for (const auto &[id, node] : graphNodes)
+        {
+            // Walk up to a node already visited or a source, then infer back down (no recursion on long chains)
+            chain.clear();
+            for (NodeId current = id; !visited.contains(current) && chain.size() <= graphNodes.size();)
+            {
+                chain.push_back(current);
+                const auto producer = producers.find(current);
+                if (producer == producers.end() || !graphNodes.contains(producer->second))
+                {
+                    break;
+                }
+                current = producer->second;
+            }
+
+            for (auto step = chain.rbegin(); step != chain.rend(); ++step)
+            {
+                if (!visited.insert(*step).second)
+                {
+                    continue;
+                }
+                if (const auto given = sourceShapes.find(*step); given != sourceShapes.end())
+                {
+                    inference.shapes.emplace(*step, given->second);
+                    continue;
+                }
+
+                std::optional<ImageShape> input;
+                if (const auto producer = producers.find(*step); producer != producers.end())
+                {
+                    if (const auto shape = inference.shapes.find(producer->second); shape != inference.shapes.end())
+                    {
+                        input = shape->second;
+                    }
+                }
+                try
+                {
+                    if (const auto shape = graphNodes.at(*step)->InferOutputShape(input))
+                    {
+                        inference.shapes.emplace(*step, *shape);
+                        if (input)
+                        {
+                            inference.derived.push_back(*step);
+                        }
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    inference.mismatches.emplace_back(*step, e.what());
+                }
+            }
+        }
+        return inference;
+    }
+
+    std::optional<std::string> NodeEditor::CheckConnectionShapes(const Connection &connection) const
+    {
+        if (connection.type != ConnectionType::Data || connection.toSlot.Str() != Constants::Tiling::kInputSlot
+            || connection.fromSlot.Str() != Constants::Tiling::kOutputSlot)
+        {
+            return std::nullopt;
+        }
+
+        const auto *consumer = GetNode(connection.to);
+        const auto inference = InferImageShapes();
+        const auto shape = inference.shapes.find(connection.from);
+        if (!consumer || shape == inference.shapes.end())
+        {
+            return std::nullopt;
+        }
+        try
+        {
+            (void)consumer->InferOutputShape(shape->second);
+        }
+        catch (const std::exception &e)
+        {
+            return e.what();
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::string> NodeEditor::CheckConnectionTypes(const Connection &connection) const
+    {
+        if (connection.type != ConnectionType::Data)
+        {
+            return std::nullopt;
+        }
+
+        std::scoped_lock lock(graphMutex);
+        return DescribeTypeMismatch(connection);
+    }
+
+    std::vector<std::pair<Connection, std::string>> NodeEditor::FindTypeMismatches() const
+    {
+        std::vector<std::pair<Connection, std::string>> mismatches;
+        std::scoped_lock lock(graphMutex);
+        for (const auto &connection : connections)
+        {
+            if (connection.type != ConnectionType::Data)
+            {
+                continue;
+            }
+            if (auto reason = DescribeTypeMismatch(connection))
+            {
+                mismatches.emplace_back(connection, std::move(*reason));
+            }
+        }
+        return mismatches;
+    }
+
+    std::optional<std::string> NodeEditor::DescribeTypeMismatch(const Connection &connection) const
+    {
+        const auto *fromNode = GetNode(connection.from);
+        const auto *toNode = GetNode(connection.to);
+        if (!fromNode || !toNode)
+        {
+            return std::nullopt;
+        }
+        const auto fromSlot = fromNode->FindOutputSlotIndex(connection.fromSlot);
+        const auto toSlot = toNode->FindInputSlotIndex(connection.toSlot);
+        if (!fromSlot || !toSlot)
+        {
+            return std::nullopt;
+        }
+
+        const auto outputType = fromNode->GetOutputSlot(*fromSlot).GetDataType();
+        const auto inputType = toNode->GetInputSlot(*toSlot).GetDataType();
+        if (AreSlotDataTypesCompatible(outputType, inputType))
+        {
+            return std::nullopt;
+        }
+        return fromNode->GetName() + "." + connection.fromSlot.Str() + " outputs " + GetSlotDataTypeName(outputType)
+               + " but " + toNode->GetName() + "." + connection.toSlot.Str() + " reads "
+               + GetSlotDataTypeName(inputType);
+    }
+
+    size_t NodeEditor::PreallocateImages(const std::unordered_map<NodeId, ImageShape> &sourceShapes)
+    {
+        const auto inference = InferImageShapes(sourceShapes);
+
+        // Sources decode into buffers of their own; only derived images come from the pool
+        std::unordered_map<size_t, size_t> buffersBySize;
+        for (const auto id : inference.derived)
+        {
+            const auto &shape = inference.shapes.at(id);
+            if (!shape.size.empty())
+            {
+                ++buffersBySize[static_cast<size_t>(shape.size.area()) * CV_ELEM_SIZE(shape.type)];
+            }
+        }
+
+        size_t allocatedBytes = 0;
+        for (const auto &[bytes, count] : buffersBySize)
+        {
+            allocatedBytes += imagePool->Reserve(bytes, count) * bytes;
+        }
+        LOG_INFO("Preallocated {} bytes for {} intermediate images", allocatedBytes, inference.derived.size());
+        return allocatedBytes;
+    }
+
+    MemoryPlan NodeEditor::PlanImageMemory(const std::unordered_map<NodeId, ImageShape> &sourceShapes)
+    {
+        std::scoped_lock lock(executionMutex);
+        const auto inference = InferImageShapes(sourceShapes);
+        const auto graph = AcquireSnapshot();
+        const auto &plan = graph->plan;
+
+        // Only outputs released within the run have a known last step; retained or aliased ones are left out
+        const auto releasedInRun = [&](const ExecutionStep &step) { return step.releasableOutputs && !step.aliased; };
+        std::vector<BufferLifetime> lifetimes;
+        if (IsIntermediateReleaseEnabled())
+        {
+            for (size_t index = 0; index < plan.size(); ++index)
+            {
+                const auto &step = plan[index];
+                const auto shape = inference.shapes.find(step.nodeId);
+                const bool derived = std::ranges::find(inference.derived, step.nodeId) != inference.derived.end();
+                if (!releasedInRun(step) || step.dataConsumerSteps.empty() || !derived || shape->second.size.empty())
+                {
+                    continue;
+                }
+                // Consumers clear their inputs only if they release too; otherwise the image outlives its step
+                if (!std::ranges::all_of(
+                        step.dataConsumerSteps, [&](size_t consumer) { return releasedInRun(plan[consumer]); }))
+                {
+                    continue;
+                }
+                lifetimes.push_back({ .nodeId = step.nodeId,
+                    .bytes = static_cast<size_t>(shape->second.size.area()) * CV_ELEM_SIZE(shape->second.type),
+                    .firstStep = index,
+                    .lastStep = std::ranges::max(step.dataConsumerSteps) });
+            }
+        }
+
+        auto memoryPlan = MemoryPlanner::Plan(lifetimes, Constants::Buffers::kSlabAlignment);
+        std::scoped_lock graphLock(graphMutex);
+        imageSlab = memoryPlan.placements.empty() ? nullptr : std::make_shared<ImageSlab>(memoryPlan, imagePool);
+        for (const auto &[id, node] : nodes)
+        {
+            node->SetOutputAllocator(imageSlab ? imageSlab->GetAllocator(id) : nullptr);
+        }
+        LOG_INFO("Planned {} intermediate images into a {} byte slab ({} bytes unshared)",
+            memoryPlan.placements.size(),
+            memoryPlan.slabBytes,
+            memoryPlan.unsharedBytes);
+        return memoryPlan;
+    }
+
+    void NodeEditor::ClearImageMemoryPlan()
+    {
+        std::scoped_lock lock(executionMutex, graphMutex);
+        for (const auto &[id, node] : nodes)
+        {
+            node->SetOutputAllocator(nullptr);
+        }
+        imageSlab.reset();
+    }
+
+    std::optional<ImageSlab::Statistics> NodeEditor::GetImageSlabStatistics() const
+    {
+        std::scoped_lock lock(graphMutex);
+        if (!imageSlab)
+        {
+            return std::nullopt;
+        }
+        return imageSlab->GetStatistics();
+    }
+
+    DerivedImageCache &NodeEditor::GetDerivedImageCache()
+    {
+        return *derivedImages;
+    }
+
+    ExecutionStatisticsHistory &NodeEditor::GetExecutionStatistics()
+    {
+        return executionStatistics;
+    }
+
+    const ExecutionStatisticsHistory &NodeEditor::GetExecutionStatistics() const
+    {
+        return executionStatistics;
+    }
+
+    void NodeEditor::RecordRunStatistics(const GraphSnapshot &graph, RunStatistics run)
+    {
+        // Records are compacted in place and names only copied into the recycled strings, so nothing allocates
+        size_t kept = 0;
+        for (size_t i = 0; i < run.nodes.size(); ++i)
+        {
+            const Node *node = graph.stepNodes[i];
+            if (!node)
+            {
+                continue;
+            }
+
+            if (kept != i)
+            {
+                std::swap(run.nodes[kept], run.nodes[i]);
+            }
+            auto &record = run.nodes[kept++];
+            if (record.nodeId != node->GetId() || record.nodeType.empty())
+            {
+                record.nodeId = node->GetId();
+                record.nodeType = node->GetType(); // Kept from a recycled record of the same node
+            }
+            record.nodeName = node->GetName();
+            run.dataPassOperations += record.dataPassOperations;
+            run.nodesExecuted += record.outcome == StepOutcome::Processed ? 1 : 0;
+            if (record.outcome == StepOutcome::Processed)
+            {
+                nodeCosts.Record(record.nodeId, record.duration);
+            }
+            run.cacheHits += record.outcome == StepOutcome::CacheHit ? 1 : 0;
+            run.nodesAliased += record.outcome == StepOutcome::Aliased ? 1 : 0;
+            run.nodesSkipped += record.outcome == StepOutcome::Skipped ? 1 : 0;
+            run.nodesBypassed += record.outcome == StepOutcome::Bypassed ? 1 : 0;
+        }
+        run.nodes.resize(kept);
+        // Saves run behind execution; the signal covers every write submitted up to now, this run's included
+        run.writesFlushed = WriteBehindQueue::Get().Flush();
+
+        RuntimeMetrics::Get().RecordRun(run);
+        [[maybe_unused]] const auto runNumber = executionStatistics.Record(std::move(run));
+        LOG_HOT_DEBUG("Recorded execution statistics for run {}", runNumber);
+    }
+
+    void NodeEditor::MarkNodeDirty(NodeId id)
+    {
+        std::scoped_lock lock(graphMutex);
+        auto it = nodes.find(id);
+        if (it != nodes.end())
+        {
+            it->second->MarkDirty();
+        }
+    }
+
+    void NodeEditor::MarkAllNodesDirty()
+    {
+        std::scoped_lock lock(graphMutex);
+        for (auto &[id, node] : nodes)
+        {
+            node->MarkDirty();
+        }
+    }
+
+    std::vector<NodeId> NodeEditor::TopologicalSort() const
+    {
+        const auto nodeIds = GetNodeIds();
+
+        std::unordered_map<NodeId, std::vector<NodeId>> adjList;
+        std::unordered_map<NodeId, int> inDegree;
+
+        for (const auto nodeId : nodeIds)
+        {
+            inDegree[nodeId] = 0;
+            adjList[nodeId] = {};
+        }
+
+        for (const auto &conn : connections)
+        {
+            adjList[conn.from].push_back(conn.to);
+            inDegree[conn.to]++;
+        }
+
+        // Kahn's algorithm for topological sort
+        std::queue<NodeId> queue;
+        std::vector<NodeId> executionOrder;
+
+        for (const auto nodeId : nodeIds)
+        {
+            if (inDegree[nodeId] == 0)
+            {
+                queue.push(nodeId);
+            }
+        }
+
+        while (!queue.empty())
+        {
+            const auto currentNode = queue.front();
+            queue.pop();
+            executionOrder.push_back(currentNode);
+
+            for (const auto neighbor : adjList[currentNode])
+            {
+                inDegree[neighbor]--;
+                if (inDegree[neighbor] == 0)
+                {
+                    queue.push(neighbor);
+                }
+            }
+        }
+
+        if (executionOrder.size() != nodeIds.size())
+        {
+            LOG_ERROR("Cycle detected in node graph! Cannot execute.");
+            return {};
+        }
+
+        return executionOrder;
+    }
+
+    std::vector<NodeEditor::ExecutionStep> NodeEditor::BuildExecutionPlan() const
+    {
+        std::scoped_lock lock(graphMutex);
+        LOG_INFO("Building execution plan (compilation phase - execution flow)");
+
+        const auto nodeIds = GetNodeIds();
+        if (nodeIds.empty())
+        {
+            return {};
+        }
+
+        // Separate execution and data connections
+        std::vector<Connection> executionConnections;
+        std::unordered_map<NodeId, std::vector<size_t>> incomingDataConnections;
+
+        for (size_t i = 0; i < connections.size(); ++i)
+        {
+            const auto &conn = connections[i];
+            if (conn.type == ConnectionType::Execution)
+            {
+                executionConnections.push_back(conn);
+                LOG_HOT_DEBUG(
+                    "Execution connection: {} ({}) -> {} ({})", conn.from, conn.fromSlot, conn.to, conn.toSlot);
+            }
+            else
+            {
+                incomingDataConnections[conn.to].push_back(i);
+                LOG_HOT_DEBUG("Data connection: {} ({}) -> {} ({})", conn.from, conn.fromSlot, conn.to, conn.toSlot);
+            }
+        }
+
+        LOG_INFO("Total connections: {} execution, {} data",
+            executionConnections.size(),
+            connections.size() - executionConnections.size());
+
+        // Determine which nodes have execution pins
+        std::unordered_set<NodeId> nodesWithExecutionPins;
+        for (const auto nodeId : nodeIds)
+        {
+            const auto *node = GetNode(nodeId);
+            if (node && (!node->GetExecutionInputPins().empty() || !node->GetExecutionOutputPins().empty()))
+            {
+                nodesWithExecutionPins.insert(nodeId);
+                LOG_HOT_DEBUG("Node {} (type: {}) has execution pins", nodeId, node->GetType());
+            }
+        }
+
+        LOG_INFO("Nodes with execution pins: {}", nodesWithExecutionPins.size());
+
+        std::vector<NodeId> executionOrder;
+
+        // If there are execution connections, follow execution flow
+        if (!executionConnections.empty())
+        {
+            LOG_INFO("Building execution order from {} execution flow connections", executionConnections.size());
+
+            // Build adjacency list for execution connections only
+            std::unordered_map<NodeId, std::vector<NodeId>> execAdjList;
+            std::unordered_map<NodeId, int> execInDegree;
+
+            for (const auto nodeId : nodeIds)
+            {
+                execInDegree[nodeId] = 0;
+                execAdjList[nodeId] = {};
+            }
+
+            for (const auto &conn : executionConnections)
+            {
+                execAdjList[conn.from].push_back(conn.to);
+                execInDegree[conn.to]++;
+            }
+
+            // Find entry points: nodes with execution outputs but no execution inputs
+            // Entry points are starter nodes (e.g., ImageInput with only output execution pin)
+            std::queue<NodeId> queue;
+            for (const auto nodeId : nodeIds)
+            {
+                const auto *node = GetNode(nodeId);
+                if (!node)
+                    continue;
 
-        // Launch async task and store in shared_future
-        // Note: std::async returns std::future, which is movable to std::shared_future
-        currentExecution = std::async(
-            std::launch::async, [this, progressCallback, stopToken]() { return Execute(progressCallback, stopToken); });
+                // Entry point must have:
+                // 1. Execution output pin(s)
+                // 2. NO execution input pin (it's a starter)
+                const bool hasExecutionOutput = !node->GetExecutionOutputPins().empty();
+                const bool hasExecutionInput = !node->GetExecutionInputPins().empty();
 
-        return currentExecution;
+                if (hasExecutionOutput && !hasExecutionInput)
+                {
+                    queue.push(nodeId);
+                    LOG_HOT_DEBUG("Entry point node found: {} (type: {})", nodeId, node->GetType());
+                }
+            }
+
+            // Traverse execution flow graph (simple linear traversal, 1:1 connections prevent cycles)
+            while (!queue.empty())
+            {
+                const auto currentNode = queue.front();
+                queue.pop();
+                executionOrder.push_back(currentNode);
+
+                for (const auto neighbor : execAdjList[currentNode])
+                {
+                    execInDegree[neighbor]--;
+                    if (execInDegree[neighbor] == 0)
+                    {
+                        queue.push(neighbor);
+                    }
+                }
+            }
+
+            // Defensive: verify no cycles (should never fail if 1:1 enforcement works correctly)
+            if (executionOrder.size() != nodesWithExecutionPins.size())
+            {
+                LOG_ERROR("Execution flow cycle or disconnection detected: expected {} nodes but got {} in order",
+                    nodesWithExecutionPins.size(),
+                    executionOrder.size());
+                return {};
+            }
+
+            // Verify all nodes with execution pins are in execution order
+            std::unordered_set<NodeId> nodesInExecutionOrder(executionOrder.begin(), executionOrder.end());
+
+            for (const auto nodeId : nodesWithExecutionPins)
+            {
+                if (nodesInExecutionOrder.count(nodeId) == 0)
+                {
+                    const auto *node = GetNode(nodeId);
+                    LOG_ERROR(
+                        "Node {} (type: {}) has execution pins but is not connected to execution flow. "
+                        "Please connect its execution pins (white arrows).",
+                        nodeId,
+                        node ? node->GetType() : "unknown");
+                    return {};
+                }
+            }
+
+            LOG_INFO("Execution flow order: {} nodes", executionOrder.size());
+        }
+        else
+        {
+            // No execution connections - check if any nodes have execution pins
+            if (!nodesWithExecutionPins.empty())
+            {
+                LOG_ERROR(
+                    "Graph contains {} nodes with execution pins but no execution connections. "
+                    "Please connect execution pins (white arrows) to define execution flow.",
+                    nodesWithExecutionPins.size());
+                return {};
+            }
+
+            // No execution pins at all - fall back to pure data dependency order (legacy graphs)
+            LOG_INFO("No execution connections found, using data dependency order (legacy mode)");
+            executionOrder = TopologicalSort();
+            if (executionOrder.empty() && !nodes.empty())
+            {
+                LOG_ERROR("Failed to build execution plan (cycle detected in data dependencies)");
+                return {};
+            }
+        }
+
+        // Build execution steps with precomputed incoming data connections
+        std::vector<ExecutionStep> plan;
+        plan.reserve(executionOrder.size());
+
+        for (const auto nodeId : executionOrder)
+        {
+            ExecutionStep step;
+            step.nodeId = nodeId;
+
+            // Precompute all incoming DATA connections for this node
+            // (execution connections control flow, data connections pass parameters)
+            if (incomingDataConnections.count(nodeId))
+            {
+                ResolveStepInputs(step, incomingDataConnections[nodeId]);
+            }
+
+            plan.push_back(std::move(step));
+        }
+
+        LinkExecutionBranches(plan);
+        LinkLoopBodies(plan);
+        BuildStepDependencies(plan);
+        LinkTileChains(plan);
+        AnalyzeLiveness(plan);
+
+        LOG_INFO("Execution plan compiled: {} steps", plan.size());
+        return plan;
+    }
+
+    void NodeEditor::ResolveStepInputs(ExecutionStep &step, const std::vector<size_t> &connectionIndices) const
+    {
+        const auto *toNode = GetNode(step.nodeId);
+        if (!toNode)
+            return;
+
+        auto imageMemory = ImageMemory::Host;
+        if (toNode->UsesCudaImages())
+        {
+            imageMemory = ImageMemory::Cuda;
+        }
+        else if (deviceExecution && toNode->SupportsDeviceImages() && !hostOnlyNodeTypes.contains(toNode->GetType()))
+        {
+            imageMemory = ImageMemory::OpenCL;
+        }
+        step.readsDeviceImages = imageMemory != ImageMemory::Host;
+        const bool acceptsChannelViews = imageMemory == ImageMemory::Host && toNode->AcceptsChannelViews();
+        const bool acceptsImagePyramids = imageMemory == ImageMemory::Host && toNode->AcceptsImagePyramids();
+        const bool acceptsHalfFloatImages = imageMemory == ImageMemory::Host && toNode->AcceptsHalfFloatImages();
+        const bool acceptsBitMasks = imageMemory == ImageMemory::Host && toNode->AcceptsBitMasks();
+        // Device images are always interleaved
+        const auto imageLayout =
+            imageMemory == ImageMemory::Host ? toNode->GetPreferredImageLayout() : ImageLayout::Interleaved;
+        step.inputs.reserve(connectionIndices.size());
+        for (const auto connIndex : connectionIndices)
+        {
+            const auto &conn = connections[connIndex];
+            const auto *fromNode = GetNode(conn.from);
+            if (!fromNode)
+                continue;
+
+            const auto fromSlot = fromNode->FindOutputSlotIndex(conn.fromSlot);
+            if (!fromSlot)
+            {
+                LOG_WARN("Node {} has no output slot '{}'", fromNode->GetName(), conn.fromSlot);
+                continue;
+            }
+
+            const auto toSlot = toNode->FindInputSlotIndex(conn.toSlot);
+            if (!toSlot)
+            {
+                LOG_WARN("Node {} has no input slot '{}'", toNode->GetName(), conn.toSlot);
+                continue;
+            }
+
+            // Checked once here instead of by the node on every run; an unbound input reads its default
+            if (const auto mismatch = DescribeTypeMismatch(conn))
+            {
+                LOG_WARN("Connection not bound: {}", *mismatch);
+                continue;
+            }
+
+            step.inputs.push_back({ .connectionIndex = connIndex,
+                .fromSlot = *fromSlot,
+                .toSlot = *toSlot,
+                .imageMemory = imageMemory,
+                .imageLayout = imageLayout,
+                .acceptsChannelViews = acceptsChannelViews,
+                .acceptsImagePyramids = acceptsImagePyramids,
+                .acceptsHalfFloatImages = acceptsHalfFloatImages,
+                .acceptsBitMasks = acceptsBitMasks });
+        }
+    }
+
+    void NodeEditor::BuildStepDependencies(std::vector<ExecutionStep> &plan) const
+    {
+        std::unordered_map<NodeId, size_t> stepIndexByNode;
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            stepIndexByNode[plan[i].nodeId] = i;
+        }
+
+        std::vector<std::unordered_set<size_t>> dependents(plan.size());
+        for (const auto &conn : connections)
+        {
+            const auto fromIt = stepIndexByNode.find(conn.from);
+            const auto toIt = stepIndexByNode.find(conn.to);
+            if (fromIt == stepIndexByNode.end() || toIt == stepIndexByNode.end())
+                continue;
+
+            const auto [first, second] = std::minmax(fromIt->second, toIt->second);
+            if (first != second)
+            {
+                dependents[first].insert(second);
+            }
+
+            if (conn.type == ConnectionType::Data && fromIt->second != toIt->second)
+            {
+                auto &consumers = plan[fromIt->second].dataConsumerSteps;
+                if (std::ranges::find(consumers, toIt->second) == consumers.end())
+                {
+                    consumers.push_back(toIt->second);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            plan[i].dependentSteps.assign(dependents[i].begin(), dependents[i].end());
+            std::ranges::sort(plan[i].dependentSteps);
+            for (const auto dependent : plan[i].dependentSteps)
+            {
+                plan[dependent].dependencyCount++;
+            }
+        }
+    }
+
+    void NodeEditor::AnalyzeLiveness(std::vector<ExecutionStep> &plan) const
+    {
+        std::unordered_set<NodeId> planned;
+        for (const auto &step : plan)
+        {
+            planned.insert(step.nodeId);
+        }
+
+        // A node outside the execution flow may still read an output after the run
+        std::unordered_set<NodeId> readOutsidePlan;
+        for (const auto &conn : connections)
+        {
+            if (conn.type == ConnectionType::Data && !planned.contains(conn.to))
+            {
+                readOutsidePlan.insert(conn.from);
+            }
+        }
+
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            for (const auto consumer : plan[i].dataConsumerSteps)
+            {
+                plan[consumer].dataProducerSteps.push_back(i);
+            }
+            plan[i].releasableOutputs =
+                !plan[i].dataConsumerSteps.empty() && !readOutsidePlan.contains(plan[i].nodeId);
+        }
+    }
+
+    void NodeEditor::LinkTileChains(std::vector<ExecutionStep> &plan) const
+    {
+        std::unordered_map<NodeId, size_t> stepIndexByNode;
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            stepIndexByNode[plan[i].nodeId] = i;
+        }
+
+        std::unordered_map<NodeId, size_t> dataOutputCount;
+        for (const auto &conn : connections)
+        {
+            if (conn.type == ConnectionType::Data)
+            {
+                ++dataOutputCount[conn.from];
+            }
+        }
+
+        for (size_t consumer = 0; consumer < plan.size(); ++consumer)
+        {
+            const auto &step = plan[consumer];
+            if (step.inputs.size() != 1)
+            {
+                continue;
+            }
+
+            const auto &conn = connections[step.inputs.front().connectionIndex];
+            const auto producer = stepIndexByNode.find(conn.from);
+            if (producer != stepIndexByNode.end()
+                && CanChainTiles(plan, producer->second, consumer, conn, dataOutputCount[conn.from]))
+            {
+                plan[producer->second].tileSuccessor = consumer;
+            }
+        }
     }
 
-    void NodeEditor::CancelExecution()
-    {
-        stopSource.request_stop();
+    void NodeEditor::LinkExecutionBranches(std::vector<ExecutionStep> &plan) const
+    {
+        std::unordered_map<NodeId, size_t> stepIndexByNode;
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            stepIndexByNode[plan[i].nodeId] = i;
+        }
+
+        for (const auto &conn : connections)
+        {
+            if (conn.type != ConnectionType::Execution)
+            {
+                continue;
+            }
+            const auto fromIt = stepIndexByNode.find(conn.from);
+            const auto toIt = stepIndexByNode.find(conn.to);
+            if (fromIt != stepIndexByNode.end() && toIt != stepIndexByNode.end())
+            {
+                plan[toIt->second].executionInputs.push_back({ .producerStep = fromIt->second, .pin = conn.fromSlot });
+            }
+        }
+
+        size_t conditionalSteps = 0;
+        for (auto &step : plan)
+        {
+            const auto *node = GetNode(step.nodeId);
+            step.branches = node && node->BranchesExecution();
+            step.conditional = std::ranges::any_of(step.executionInputs, [&plan](const ExecutionWire &wire) {
+                return plan[wire.producerStep].branches || plan[wire.producerStep].conditional;
+            });
+            conditionalSteps += step.conditional ? 1 : 0;
+        }
+        if (conditionalSteps > 0)
+        {
+            LOG_INFO("{} of {} steps run only on the execution paths a branch takes", conditionalSteps, plan.size());
+        }
+    }
+
+    void NodeEditor::LinkLoopBodies(std::vector<ExecutionStep> &plan) const
+    {
+        std::vector<std::optional<std::string>> bodyPins(plan.size());
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            const auto *node = GetNode(plan[i].nodeId);
+            bodyPins[i] = node ? node->GetLoopBodyPin() : std::nullopt;
+        }
+
+        // Innermost loop a wire runs in: the loop itself for its body pin, else whatever runs the wire's source
+        const auto wireOwner = [&plan, &bodyPins](const ExecutionWire &wire) {
+            const auto &pin = bodyPins[wire.producerStep];
+            return pin && wire.pin.Str() == *pin ? std::optional(wire.producerStep) : plan[wire.producerStep].loopOwner;
+        };
+
+        size_t bodySteps = 0;
+        for (size_t i = 0; i < plan.size(); ++i)
+        {
+            auto &step = plan[i];
+            if (step.executionInputs.empty())
+            {
+                continue;
+            }
+            const auto owner = wireOwner(step.executionInputs.front());
+            if (!owner || !std::ranges::all_of(step.executionInputs, [&](const ExecutionWire &wire) {
+                    return wireOwner(wire) == owner;
+                }))
+            {
+                continue;
+            }
+
+            step.loopOwner = owner;
+            for (auto loop = step.loopOwner; loop; loop = plan[*loop].loopOwner)
+            {
+                plan[*loop].loopBody.push_back(i);
+            }
+            ++bodySteps;
+        }
+        if (bodySteps > 0)
+        {
+            LOG_INFO("{} of {} steps run once per loop element", bodySteps, plan.size());
+        }
+    }
+
+    bool NodeEditor::CanChainTiles(const std::vector<ExecutionStep> &plan,
+        size_t producer,
+        size_t consumer,
+        const Connection &connection,
+        size_t producerDataOutputs)
+    {
+        const auto &step = plan[consumer];
+        return step.inputs.size() == 1 && step.dependencyCount == 1 && !step.readsDeviceImages && producer < consumer
+               && producerDataOutputs == 1 && connection.fromSlot == Constants::Tiling::kOutputSlot
+               && connection.toSlot == Constants::Tiling::kInputSlot && !plan[producer].readsDeviceImages
+               && !(step.conditional && plan[producer].branches) // The branch decides before the consumer runs
+               && !step.loopOwner && !plan[producer].loopOwner && step.loopBody.empty();
+    }
+
+    void NodeEditor::EliminateDuplicateSteps(GraphSnapshot &graph)
+    {
+        // Node whose outputs a merged node's outputs really are, so duplicates of duplicates match too
+        std::unordered_map<NodeId, NodeId> representative;
+        const auto resolve = [&representative](NodeId id) {
+            const auto it = representative.find(id);
+            return it != representative.end() ? it->second : id;
+        };
+
+        std::map<std::pair<NodeTypeId, std::vector<uint64_t>>, size_t> firstStepBySignature;
+        size_t merged = 0;
+        for (size_t i = 0; i < graph.plan.size(); ++i)
+        {
+            auto &step = graph.plan[i];
+            const Node *node = graph.stepNodes[i];
+            // A conditional step may be bypassed and a loop body runs per element, so neither can stand in for
+            // another step or be replaced by one
+            if (!node || !node->IsCacheable() || node->IsSink() || node->IsStreamSource()
+                || node->GetOutputSlotCount() == 0 || step.conditional || step.loopOwner)
+            {
+                continue;
+            }
+
+            // Where each connected input comes from, then the values of the unconnected ones
+            auto bindings = step.inputs;
+            std::ranges::sort(bindings, {}, &InputBinding::toSlot);
+            std::vector<uint64_t> signature{ node->GetOutputSlotCount(), bindings.size() };
+            std::vector<bool> connected(node->GetInputSlotCount());
+            for (const auto &binding : bindings)
+            {
+                signature.push_back(binding.toSlot);
+                signature.push_back(resolve(graph.connections[binding.connectionIndex].from));
+                signature.push_back(binding.fromSlot);
+                connected[binding.toSlot] = true;
+            }
+            for (SlotIndex slot = 0; slot < node->GetInputSlotCount(); ++slot)
+            {
+                if (!connected[slot])
+                {
+                    const auto value = node->GetInputSlot(slot).GetResolvedSharedData();
+                    signature.push_back(NodeOutputCache::Fingerprint(value ? *value : NodeData{}));
+                }
+            }
+
+            const auto [it, inserted] =
+                firstStepBySignature.try_emplace({ node->GetTypeId(), std::move(signature) }, i);
+            if (inserted)
+            {
+                continue;
+            }
+
+            // The duplicate waits for the step it copies, which keeps its outputs until the duplicate took them
+            const size_t first = it->second;
+            auto &original = graph.plan[first];
+            step.aliasOf = first;
+            original.aliased = true;
+            representative[step.nodeId] = resolve(original.nodeId);
+            if (std::ranges::find(original.dependentSteps, i) == original.dependentSteps.end())
+            {
+                original.dependentSteps.push_back(i);
+                ++step.dependencyCount;
+            }
+            if (std::ranges::find(original.dataConsumerSteps, i) == original.dataConsumerSteps.end())
+            {
+                original.dataConsumerSteps.push_back(i);
+                step.dataProducerSteps.push_back(first);
+            }
+            ++merged;
+        }
+        if (merged == 0)
+        {
+            return;
+        }
+
+        // A chain would discard the copied step's output or skip the duplicate's sharing
+        for (auto &step : graph.plan)
+        {
+            if (step.aliased || step.aliasOf || (step.tileSuccessor && graph.plan[*step.tileSuccessor].aliasOf))
+            {
+                step.tileSuccessor.reset();
+            }
+        }
+        LOG_HOT_INFO(
+            "Duplicate elimination: {} of {} steps share an identical step's outputs", merged, graph.plan.size());
     }
 
-    std::vector<NodeId> NodeEditor::TopologicalSort() const
+    bool NodeEditor::ShareDuplicateOutputs(const GraphSnapshot &graph, const ExecutionStep &step, Node &node)
     {
-        const auto nodeIds = GetNodeIds();
-
-        std::unordered_map<NodeId, std::vector<NodeId>> adjList;
-        std::unordered_map<NodeId, int> inDegree;
+        const Node *original = graph.stepNodes[*step.aliasOf];
+        if (!original || original->IsDirty() || original->GetProxyScale() != node.GetProxyScale()
+            || original->GetInputSlotCount() != node.GetInputSlotCount()
+            || original->GetOutputSlotCount() != node.GetOutputSlotCount())
+        {
+            return false;
+        }
 
-        for (const auto nodeId : nodeIds)
+        // Parameters may have been edited since the snapshot was taken
+        for (SlotIndex slot = 0; slot < node.GetInputSlotCount(); ++slot)
         {
-            inDegree[nodeId] = 0;
-            adjList[nodeId] = {};
+            const auto value = node.GetInputSlot(slot).GetResolvedSharedData();
+            const auto originalValue = original->GetInputSlot(slot).GetResolvedSharedData();
+            if (value != originalValue
+                && (!value || !originalValue
+                    || NodeOutputCache::Fingerprint(*value) != NodeOutputCache::Fingerprint(*originalValue)))
+            {
+                return false;
+            }
         }
 
-        for (const auto &conn : connections)
+        for (SlotIndex slot = 0; slot < node.GetOutputSlotCount(); ++slot)
         {
-            adjList[conn.from].push_back(conn.to);
-            inDegree[conn.to]++;
+            node.ShareOutputSlotData(slot, original->GetOutputSlot(slot).GetSharedData());
         }
+        return true;
+    }
 
-        // Kahn's algorithm for topological sort
-        std::queue<NodeId> queue;
-        std::vector<NodeId> executionOrder;
+    std::shared_ptr<const NodeEditor::GraphSnapshot> NodeEditor::AcquireSnapshot()
+    {
+        const auto lock = LockTraced(graphMutex, "Wait graphMutex");
+        if (snapshot && snapshot->version == graphVersion)
+        {
+            return snapshot;
+        }
 
-        for (const auto nodeId : nodeIds)
+        if (!planCurrent)
         {
-            if (inDegree[nodeId] == 0)
+            TraceScope trace("plan", "BuildExecutionPlan");
+            maintainedPlan = BuildExecutionPlan();
+            if (maintainedPlan.empty() && !nodes.empty())
             {
-                queue.push(nodeId);
+                LOG_ERROR("Failed to build execution plan (cycle detected)");
+                return nullptr;
+            }
+
+            planStepIndex.clear();
+            for (size_t i = 0; i < maintainedPlan.size(); ++i)
+            {
+                planStepIndex[maintainedPlan[i].nodeId] = i;
             }
+            planFollowsExecutionFlow = std::ranges::any_of(
+                connections, [](const Connection &c) { return c.type == ConnectionType::Execution; });
+            planCurrent = true;
+            ++planStatistics.rebuilds;
         }
 
-        while (!queue.empty())
+        auto next = std::make_shared<GraphSnapshot>();
+        next->plan = maintainedPlan;
+        next->version = graphVersion;
+        next->nodes = nodes;
+        next->connections = connections;
+        next->followsExecutionFlow = planFollowsExecutionFlow;
+        next->stepNodes.reserve(next->plan.size());
+        for (auto &step : next->plan)
         {
-            const auto currentNode = queue.front();
-            queue.pop();
-            executionOrder.push_back(currentNode);
+            auto it = nodes.find(step.nodeId);
+            next->stepNodes.push_back(it != nodes.end() ? it->second.get() : nullptr);
 
-            for (const auto neighbor : adjList[currentNode])
+            // Resolved once per snapshot, so pulling inputs looks nothing up
+            for (auto &binding : step.inputs)
             {
-                inDegree[neighbor]--;
-                if (inDegree[neighbor] == 0)
-                {
-                    queue.push(neighbor);
-                }
+                const auto producerIt = nodes.find(connections[binding.connectionIndex].from);
+                binding.producer = producerIt != nodes.end() ? producerIt->second.get() : nullptr;
             }
         }
-
-        if (executionOrder.size() != nodeIds.size())
+        if (duplicateElimination)
         {
-            LOG_ERROR("Cycle detected in node graph! Cannot execute.");
-            return {};
+            EliminateDuplicateSteps(*next);
         }
 
-        return executionOrder;
+        snapshot = std::move(next);
+        LOG_HOT_DEBUG("Graph snapshot taken at version {}", graphVersion);
+        return snapshot;
     }
 
-    std::vector<NodeEditor::ExecutionStep> NodeEditor::BuildExecutionPlan() const
+    uint64_t NodeEditor::GetGraphVersion() const
     {
         std::scoped_lock lock(graphMutex);
-        LOG_INFO("Building execution plan (compilation phase - execution flow)");
+        return graphVersion;
+    }
 
-        const auto nodeIds = GetNodeIds();
-        if (nodeIds.empty())
+    ExecutionPlanStatistics NodeEditor::GetExecutionPlanStatistics() const
+    {
+        std::scoped_lock lock(graphMutex);
+        return planStatistics;
+    }
+
+    void NodeEditor::InvalidateExecutionPlan()
+    {
+        ++graphVersion;
+        planCurrent = false;
+        if (transactionDepth > 0)
         {
-            return {};
+            transactionInvalidated = true; // Logged once at commit
+            return;
         }
+        LOG_DEBUG("Execution plan invalidated (graph structure changed)");
+    }
 
-        // Separate execution and data connections
-        std::vector<Connection> executionConnections;
-        std::unordered_map<NodeId, std::vector<size_t>> incomingDataConnections;
+    void NodeEditor::PatchPlanForAddedNode(NodeId id, bool replaced)
+    {
+        // A batch is cheaper to rebuild once than to patch edit by edit
+        if (transactionDepth > 0)
+        {
+            InvalidateExecutionPlan();
+            return;
+        }
 
-        for (size_t i = 0; i < connections.size(); ++i)
+        const auto &node = *nodes.at(id);
+        const bool hasExecutionPins = !node.GetExecutionInputPins().empty() || !node.GetExecutionOutputPins().empty();
+        const bool connected = std::ranges::any_of(
+            connections, [id](const Connection &c) { return c.from == id || c.to == id; });
+        if (replaced || hasExecutionPins || connected)
         {
-            const auto &conn = connections[i];
-            if (conn.type == ConnectionType::Execution)
-            {
-                executionConnections.push_back(conn);
-                LOG_DEBUG("Execution connection: {} ({}) -> {} ({})", conn.from, conn.fromSlot, conn.to, conn.toSlot);
-            }
-            else
-            {
-                incomingDataConnections[conn.to].push_back(i);
-                LOG_DEBUG("Data connection: {} ({}) -> {} ({})", conn.from, conn.fromSlot, conn.to, conn.toSlot);
-            }
+            InvalidateExecutionPlan();
+            return;
         }
 
-        LOG_INFO("Total connections: {} execution, {} data",
-            executionConnections.size(),
-            connections.size() - executionConnections.size());
+        ++graphVersion;
+        if (!planCurrent)
+        {
+            return;
+        }
 
-        // Determine which nodes have execution pins
-        std::unordered_set<NodeId> nodesWithExecutionPins;
-        for (const auto nodeId : nodeIds)
+        // Outside an execution flow the node is not planned; a data-flow plan runs it anywhere, so last
+        if (!planFollowsExecutionFlow)
         {
-            const auto *node = GetNode(nodeId);
-            if (node && (!node->GetExecutionInputPins().empty() || !node->GetExecutionOutputPins().empty()))
-            {
-                nodesWithExecutionPins.insert(nodeId);
-                LOG_DEBUG("Node {} (type: {}) has execution pins", nodeId, node->GetType());
-            }
+            ExecutionStep step;
+            step.nodeId = id;
+            ResolveStepInputs(step, {});
+            planStepIndex[id] = maintainedPlan.size();
+            maintainedPlan.push_back(std::move(step));
         }
+        ++planStatistics.patchedEdits;
+        LOG_DEBUG("Execution plan patched (node {} added)", id);
+    }
 
-        LOG_INFO("Nodes with execution pins: {}", nodesWithExecutionPins.size());
+    void NodeEditor::PatchPlanForDataConnection(std::optional<size_t> erased,
+        const Connection &erasedConnection,
+        bool added)
+    {
+        if (transactionDepth > 0)
+        {
+            InvalidateExecutionPlan();
+            return;
+        }
 
-        std::vector<NodeId> executionOrder;
+        ++graphVersion;
+        if (!planCurrent)
+        {
+            return;
+        }
 
-        // If there are execution connections, follow execution flow
-        if (!executionConnections.empty())
+        std::vector<const Connection *> edited;
+        if (erased)
         {
-            LOG_INFO("Building execution order from {} execution flow connections", executionConnections.size());
+            edited.push_back(&erasedConnection);
+        }
+        if (added)
+        {
+            edited.push_back(&connections.back());
+        }
 
-            // Build adjacency list for execution connections only
-            std::unordered_map<NodeId, std::vector<NodeId>> execAdjList;
-            std::unordered_map<NodeId, int> execInDegree;
+        // A data-flow plan orders every node, so a wire to a missing node fails the rebuild and is left to it
+        const bool dangling = std::ranges::any_of(edited, [this](const Connection *c) {
+            return !nodes.contains(c->from) || !nodes.contains(c->to);
+        });
+        if ((erased && erasedConnection.type == ConnectionType::Execution) || (dangling && !planFollowsExecutionFlow))
+        {
+            InvalidateExecutionPlan();
+            return;
+        }
 
-            for (const auto nodeId : nodeIds)
+        if (erased)
+        {
+            for (auto &step : maintainedPlan)
             {
-                execInDegree[nodeId] = 0;
-                execAdjList[nodeId] = {};
+                for (auto &binding : step.inputs)
+                {
+                    if (binding.connectionIndex > *erased)
+                    {
+                        --binding.connectionIndex;
+                    }
+                }
             }
+            RelinkPlanSteps(erasedConnection.from, erasedConnection.to);
+        }
 
-            for (const auto &conn : executionConnections)
+        if (added)
+        {
+            const auto &conn = connections.back();
+            const auto from = FindPlanStep(conn.from);
+            const auto to = FindPlanStep(conn.to);
+
+            // Execution wires fix the order of a flow plan; a data-flow plan must move the edge forward
+            if (!planFollowsExecutionFlow && from && to && *from >= *to
+                && (*from == *to || !ReorderPlanForEdge(*from, *to)))
             {
-                execAdjList[conn.from].push_back(conn.to);
-                execInDegree[conn.to]++;
+                InvalidateExecutionPlan();
+                return;
             }
+            RelinkPlanSteps(conn.from, conn.to);
+        }
 
-            // Find entry points: nodes with execution outputs but no execution inputs
-            // Entry points are starter nodes (e.g., ImageInput with only output execution pin)
-            std::queue<NodeId> queue;
-            for (const auto nodeId : nodeIds)
+        std::vector<NodeId> endpoints;
+        for (const auto *conn : edited)
+        {
+            if (const auto consumer = FindPlanStep(conn->to))
             {
-                const auto *node = GetNode(nodeId);
-                if (!node)
-                    continue;
+                ResolvePlanStepInputs(*consumer);
+            }
+            if (const auto producer = FindPlanStep(conn->from))
+            {
+                auto &step = maintainedPlan[*producer];
+                const auto readOutsidePlan = std::ranges::any_of(connections, [&](const Connection &c) {
+                    return c.type == ConnectionType::Data && c.from == conn->from && !planStepIndex.contains(c.to);
+                });
+                step.releasableOutputs = !step.dataConsumerSteps.empty() && !readOutsidePlan;
+            }
+            endpoints.push_back(conn->from);
+            endpoints.push_back(conn->to);
+        }
+        RelinkPlanTileChains(endpoints);
 
-                // Entry point must have:
-                // 1. Execution output pin(s)
-                // 2. NO execution input pin (it's a starter)
-                const bool hasExecutionOutput = !node->GetExecutionOutputPins().empty();
-                const bool hasExecutionInput = !node->GetExecutionInputPins().empty();
+        ++planStatistics.patchedEdits;
+        LOG_DEBUG("Execution plan patched ({} connection {} -> {})",
+            added ? "added" : "removed",
+            edited.back()->from,
+            edited.back()->to);
+    }
 
-                if (hasExecutionOutput && !hasExecutionInput)
+    bool NodeEditor::ReorderPlanForEdge(size_t from, size_t to)
+    {
+        // Only steps between the two ends can be out of order; track them relative to the window start
+        const auto windowSize = from - to + 1;
+        std::vector<size_t> forward;
+        std::vector<size_t> backward;
+        std::vector<bool> seen(windowSize);
+
+        // Steps that must follow "to" (successors, which in a data-flow plan are all dependents)
+        std::vector<size_t> pending{ to };
+        seen[0] = true;
+        while (!pending.empty())
+        {
+            const auto index = pending.back();
+            pending.pop_back();
+            forward.push_back(index);
+            for (const auto next : maintainedPlan[index].dependentSteps)
+            {
+                if (next == from)
                 {
-                    queue.push(nodeId);
-                    LOG_DEBUG("Entry point node found: {} (type: {})", nodeId, node->GetType());
+                    return false; // The new edge closes a cycle
+                }
+                if (next < from && !seen[next - to])
+                {
+                    seen[next - to] = true;
+                    pending.push_back(next);
                 }
             }
+        }
 
-            // Traverse execution flow graph (simple linear traversal, 1:1 connections prevent cycles)
-            while (!queue.empty())
+        // Steps that must precede "from" (every connection of a data-flow plan is a data connection)
+        seen.assign(windowSize, false);
+        pending.assign(1, from);
+        seen[windowSize - 1] = true;
+        while (!pending.empty())
+        {
+            const auto index = pending.back();
+            pending.pop_back();
+            backward.push_back(index);
+            for (const auto previous : maintainedPlan[index].dataProducerSteps)
             {
-                const auto currentNode = queue.front();
-                queue.pop();
-                executionOrder.push_back(currentNode);
-
-                for (const auto neighbor : execAdjList[currentNode])
+                if (previous > to && !seen[previous - to])
                 {
-                    execInDegree[neighbor]--;
-                    if (execInDegree[neighbor] == 0)
-                    {
-                        queue.push(neighbor);
-                    }
+                    seen[previous - to] = true;
+                    pending.push_back(previous);
                 }
             }
+        }
 
-            // Defensive: verify no cycles (should never fail if 1:1 enforcement works correctly)
-            if (executionOrder.size() != nodesWithExecutionPins.size())
+        // Predecessors of "from" take the lowest freed positions, then the successors of "to"
+        std::ranges::sort(forward);
+        std::ranges::sort(backward);
+        std::vector<size_t> order = backward;
+        order.insert(order.end(), forward.begin(), forward.end());
+        std::vector<size_t> positions;
+        positions.reserve(order.size());
+        std::ranges::merge(backward, forward, std::back_inserter(positions));
+
+        std::unordered_map<size_t, size_t> moves;
+        std::vector<size_t> touched;
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            moves[order[i]] = positions[i];
+            const auto &step = maintainedPlan[order[i]];
+            touched.push_back(order[i]);
+            touched.insert(touched.end(), step.dependentSteps.begin(), step.dependentSteps.end());
+            touched.insert(touched.end(), step.dataProducerSteps.begin(), step.dataProducerSteps.end());
+        }
+        std::ranges::sort(touched);
+        touched.erase(std::ranges::unique(touched).begin(), touched.end());
+
+        std::vector<ExecutionStep> moved;
+        moved.reserve(order.size());
+        for (const auto index : order)
+        {
+            moved.push_back(std::move(maintainedPlan[index]));
+        }
+        for (size_t i = 0; i < moved.size(); ++i)
+        {
+            planStepIndex[moved[i].nodeId] = positions[i];
+            maintainedPlan[positions[i]] = std::move(moved[i]);
+        }
+
+        const auto remap = [&moves](size_t &index) {
+            if (const auto it = moves.find(index); it != moves.end())
             {
-                LOG_ERROR("Execution flow cycle or disconnection detected: expected {} nodes but got {} in order",
-                    nodesWithExecutionPins.size(),
-                    executionOrder.size());
-                return {};
+                index = it->second;
+            }
+        };
+        for (auto index : touched)
+        {
+            remap(index);
+            auto &step = maintainedPlan[index];
+            std::ranges::for_each(step.dependentSteps, remap);
+            std::ranges::for_each(step.dataConsumerSteps, remap);
+            std::ranges::for_each(step.dataProducerSteps, remap);
+            if (step.tileSuccessor)
+            {
+                remap(*step.tileSuccessor);
             }
+            std::ranges::sort(step.dependentSteps);
+        }
 
-            // Verify all nodes with execution pins are in execution order
-            std::unordered_set<NodeId> nodesInExecutionOrder(executionOrder.begin(), executionOrder.end());
+        planStatistics.reorderedSteps += order.size();
+        LOG_HOT_DEBUG("Reordered {} plan steps between positions {} and {}", order.size(), to, from);
+        return true;
+    }
 
-            for (const auto nodeId : nodesWithExecutionPins)
+    void NodeEditor::RelinkPlanSteps(NodeId from, NodeId to)
+    {
+        const auto fromIndex = FindPlanStep(from);
+        const auto toIndex = FindPlanStep(to);
+        if (!fromIndex || !toIndex || *fromIndex == *toIndex)
+        {
+            return;
+        }
+
+        // Mirrors BuildStepDependencies() for this one pair
+        bool linked = false;
+        bool dataLinked = false;
+        for (const auto &conn : connections)
+        {
+            if ((conn.from == from && conn.to == to) || (conn.from == to && conn.to == from))
             {
-                if (nodesInExecutionOrder.count(nodeId) == 0)
-                {
-                    const auto *node = GetNode(nodeId);
-                    LOG_ERROR(
-                        "Node {} (type: {}) has execution pins but is not connected to execution flow. "
-                        "Please connect its execution pins (white arrows).",
-                        nodeId,
-                        node ? node->GetType() : "unknown");
-                    return {};
-                }
+                linked = true;
+                dataLinked = dataLinked || (conn.type == ConnectionType::Data && conn.from == from);
             }
+        }
 
-            LOG_INFO("Execution flow order: {} nodes", executionOrder.size());
+        const auto [first, second] = std::minmax(*fromIndex, *toIndex);
+        auto &dependents = maintainedPlan[first].dependentSteps;
+        const auto dependent = std::ranges::lower_bound(dependents, second);
+        const bool wasLinked = dependent != dependents.end() && *dependent == second;
+        if (linked && !wasLinked)
+        {
+            dependents.insert(dependent, second);
+            ++maintainedPlan[second].dependencyCount;
         }
-        else
+        else if (!linked && wasLinked)
         {
-            // No execution connections - check if any nodes have execution pins
-            if (!nodesWithExecutionPins.empty())
+            dependents.erase(dependent);
+            --maintainedPlan[second].dependencyCount;
+        }
+
+        auto &consumers = maintainedPlan[*fromIndex].dataConsumerSteps;
+        const auto consumer = std::ranges::find(consumers, *toIndex);
+        if (dataLinked && consumer == consumers.end())
+        {
+            consumers.push_back(*toIndex);
+            maintainedPlan[*toIndex].dataProducerSteps.push_back(*fromIndex);
+        }
+        else if (!dataLinked && consumer != consumers.end())
+        {
+            consumers.erase(consumer);
+            std::erase(maintainedPlan[*toIndex].dataProducerSteps, *fromIndex);
+        }
+    }
+
+    void NodeEditor::ResolvePlanStepInputs(size_t index)
+    {
+        auto &step = maintainedPlan[index];
+        std::vector<size_t> incoming;
+        for (size_t i = 0; i < connections.size(); ++i)
+        {
+            if (connections[i].type == ConnectionType::Data && connections[i].to == step.nodeId)
             {
-                LOG_ERROR(
-                    "Graph contains {} nodes with execution pins but no execution connections. "
-                    "Please connect execution pins (white arrows) to define execution flow.",
-                    nodesWithExecutionPins.size());
-                return {};
+                incoming.push_back(i);
             }
+        }
+        step.inputs.clear();
+        ResolveStepInputs(step, incoming);
+    }
 
-            // No execution pins at all - fall back to pure data dependency order (legacy graphs)
-            LOG_INFO("No execution connections found, using data dependency order (legacy mode)");
-            executionOrder = TopologicalSort();
-            if (executionOrder.empty() && !nodes.empty())
+    void NodeEditor::RelinkPlanTileChains(const std::vector<NodeId> &nodeIds)
+    {
+        // An edit changes the inputs and dependencies of its ends and the output count of its producer,
+        // which decides the links into the ends and into every other consumer of the producer
+        std::vector<size_t> consumers;
+        for (const auto id : nodeIds)
+        {
+            if (const auto index = FindPlanStep(id))
             {
-                LOG_ERROR("Failed to build execution plan (cycle detected in data dependencies)");
-                return {};
+                consumers.push_back(*index);
+                const auto &step = maintainedPlan[*index];
+                consumers.insert(consumers.end(), step.dataConsumerSteps.begin(), step.dataConsumerSteps.end());
             }
         }
+        std::ranges::sort(consumers);
+        consumers.erase(std::ranges::unique(consumers).begin(), consumers.end());
 
-        // Build execution steps with precomputed incoming data connections
-        std::vector<ExecutionStep> plan;
-        plan.reserve(executionOrder.size());
-
-        for (const auto nodeId : executionOrder)
+        const auto unlink = [&](size_t producer) {
+            auto &successor = maintainedPlan[producer].tileSuccessor;
+            if (successor && std::ranges::binary_search(consumers, *successor))
+            {
+                successor.reset();
+            }
+        };
+        for (const auto consumer : consumers)
         {
-            ExecutionStep step;
-            step.nodeId = nodeId;
+            unlink(consumer);
+            std::ranges::for_each(maintainedPlan[consumer].dataProducerSteps, unlink);
+        }
 
-            // Precompute all incoming DATA connections for this node
-            // (execution connections control flow, data connections pass parameters)
-            if (incomingDataConnections.count(nodeId))
+        for (const auto consumer : consumers)
+        {
+            const auto &step = maintainedPlan[consumer];
+            if (step.inputs.size() != 1)
             {
-                step.incomingConnectionIndices = incomingDataConnections[nodeId];
+                continue;
             }
 
-            plan.push_back(std::move(step));
+            const auto &conn = connections[step.inputs.front().connectionIndex];
+            const auto producer = FindPlanStep(conn.from);
+            const auto dataOutputs = std::ranges::count_if(connections, [&](const Connection &c) {
+                return c.type == ConnectionType::Data && c.from == conn.from;
+            });
+            if (producer
+                && CanChainTiles(maintainedPlan, *producer, consumer, conn, static_cast<size_t>(dataOutputs)))
+            {
+                maintainedPlan[*producer].tileSuccessor = consumer;
+            }
         }
-
-        LOG_INFO("Execution plan compiled: {} steps", plan.size());
-        return plan;
     }
 
-    void NodeEditor::InvalidateExecutionPlan()
+    std::optional<size_t> NodeEditor::FindPlanStep(NodeId id) const
     {
-        executionPlanValid = false;
-        LOG_DEBUG("Execution plan invalidated (graph structure changed)");
+        const auto it = planStepIndex.find(id);
+        if (it == planStepIndex.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
     }
 
-    void NodeEditor::PassDataBetweenNodes(Node *fromNode,
-        Node *toNode,
-        const std::string &fromSlotName,
-        const std::string &toSlotName)
+    void NodeEditor::PassDataBetweenNodes(const Node &fromNode,
+        Node &toNode,
+        [[maybe_unused]] const Connection &connection,
+        const InputBinding &binding)
     {
-        if (!fromNode || !toNode)
-            return;
-
-        if (!fromNode->HasOutputSlot(fromSlotName))
+        const auto &outputSlot = fromNode.GetOutputSlot(binding.fromSlot);
+        if (!outputSlot.HasData())
         {
-            LOG_WARN("Node {} has no output slot '{}'", fromNode->GetName(), fromSlotName);
+            LOG_HOT_WARN("Node {} output slot '{}' has no data", fromNode.GetName(), connection.fromSlot);
             return;
         }
 
-        const auto &outputSlot = fromNode->GetOutputSlot(fromSlotName);
-        if (!outputSlot.HasData())
+        // Share the upstream handle: no copy of strings, paths or point vectors, no cv::Mat refcount bump
+        toNode.ShareInputSlotData(binding.toSlot,
+            PlaceImage(outputSlot.GetSharedData(),
+                binding.imageMemory,
+                binding.imageLayout,
+                binding.acceptsChannelViews,
+                binding.acceptsImagePyramids,
+                binding.acceptsHalfFloatImages,
+                binding.acceptsBitMasks));
+        LOG_HOT_INFO("Passed data from {} ({}) to {} ({})",
+            fromNode.GetName(),
+            connection.fromSlot,
+            toNode.GetName(),
+            connection.toSlot);
+    }
+
+    void NodeEditor::ReplaceGraph(std::unordered_map<NodeId, std::shared_ptr<Node>> newNodes,
+        std::vector<Connection> newConnections)
+    {
+        const auto keep = FindSurvivingConnections(newConnections);
+        std::vector<Connection> kept;
+        kept.reserve(newConnections.size());
+        for (size_t i = 0; i < newConnections.size(); ++i)
         {
-            LOG_WARN("Node {} output slot '{}' has no data", fromNode->GetName(), fromSlotName);
-            return;
+            if (keep[i])
+            {
+                kept.push_back(std::move(newConnections[i]));
+            }
         }
 
-        if (!toNode->HasInputSlot(toSlotName))
+        std::unique_lock lock(graphMutex);
+        nodes = std::move(newNodes);
+        connections = std::move(kept);
+        nextId = 1;
+        for (const auto &[id, node] : nodes)
         {
-            LOG_WARN("Node {} has no input slot '{}'", toNode->GetName(), toSlotName);
-            return;
+            node->SetImageBufferPool(imagePool);
+            node->SetDerivedImageCache(derivedImages);
+            nextId = std::max(nextId, id + 1);
         }
+        InvalidateExecutionPlan(); // Graph structure changed
+
+        ConnectionDelta delta{ .reset = true, .removed = {}, .added = connections };
+        lock.unlock();
+        NotifyConnectionsChanged(delta);
+    }
+
+    std::shared_ptr<const GraphSaveSnapshot> NodeEditor::CaptureSaveSnapshot(
+        const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const
+    {
+        auto graph = std::make_shared<GraphSaveSnapshot>();
+        graph->positions = nodePositions;
+
+        std::scoped_lock lock(graphMutex);
+        graph->nodes.reserve(nodes.size());
+        for (const auto &[id, nodePtr] : nodes)
+        {
+            if (!nodePtr)
+            {
+                LOG_WARN("Skipping null node with ID: {}", id);
+                continue;
+            }
 
-        toNode->SetInputSlotData(toSlotName, outputSlot.GetVariantData());
-        LOG_INFO(
-            "Passed data from {} ({}) to {} ({})", fromNode->GetName(), fromSlotName, toNode->GetName(), toSlotName);
+            // Defaults are immutable and shared, so the snapshot keeps them without copying the values
+            auto &saved = graph->nodes.emplace_back();
+            saved.id = id;
+            saved.type = nodePtr->GetType();
+            saved.name = nodePtr->GetName();
+            for (const auto &slotName : nodePtr->GetInputSlotNames())
+            {
+                if (auto value = nodePtr->GetInputSlot(slotName).GetSharedDefaultValue())
+                {
+                    saved.defaults.emplace_back(slotName, std::move(value));
+                }
+            }
+        }
+        graph->connections = connections;
+        return graph;
     }
 
     bool NodeEditor::SaveToFile(const std::filesystem::path &filepath,
         const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const
+    {
+        return WriteSaveSnapshot(*CaptureSaveSnapshot(nodePositions), filepath);
+    }
+
+    std::shared_future<bool> NodeEditor::SaveToFileAsync(const std::filesystem::path &filepath,
+        const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const
+    {
+        // Written next to the target and renamed over it, so a crash mid-write never leaves a torn file
+        return WriteBehindQueue::Get().Submit([graph = CaptureSaveSnapshot(nodePositions), filepath] {
+            const auto extension = filepath.extension().string();
+            auto partial = filepath;
+            partial.replace_extension(Constants::Persistence::kPartialFileMarker + extension);
+            if (!WriteSaveSnapshot(*graph, partial))
+            {
+                return false;
+            }
+
+            std::error_code error;
+            std::filesystem::rename(partial, filepath, error);
+            if (error)
+            {
+                LOG_ERROR("Failed to replace {}: {}", filepath.string(), error.message());
+                std::filesystem::remove(partial, error);
+                return false;
+            }
+            return true;
+        });
+    }
+
+    bool NodeEditor::WriteSaveSnapshot(const GraphSaveSnapshot &graph, const std::filesystem::path &filepath)
     {
         try
         {
+            if (filepath.extension() == Constants::Persistence::kBinaryGraphExtension)
+            {
+                return WriteBinaryGraph(graph, filepath);
+            }
+
             nlohmann::json j;
             j["version"] = "1.0";
 
             // Serialize nodes
             nlohmann::json nodesArray = nlohmann::json::array();
-            for (const auto &[id, nodePtr] : nodes)
+            for (const auto &node : graph.nodes)
             {
-                if (!nodePtr)
+                nlohmann::json nodeJson;
+                nodeJson["id"] = node.id;
+                nodeJson["type"] = node.type;
+                nodeJson["name"] = node.name;
+
+                // Serialize tuned parameters (older files have no "defaults" and load with the node's own)
+                nlohmann::json defaultsJson = nlohmann::json::object();
+                for (const auto &[slotName, value] : node.defaults)
                 {
-                    LOG_WARN("Skipping null node with ID: {}", id);
-                    continue;
+                    if (const auto valueJson = DefaultToJson(*value))
+                    {
+                        defaultsJson[slotName] = *valueJson;
+                    }
+                }
+                if (!defaultsJson.empty())
+                {
+                    nodeJson["defaults"] = std::move(defaultsJson);
                 }
-
-                nlohmann::json nodeJson;
-                nodeJson["id"] = id;
-                nodeJson["type"] = nodePtr->GetType();
-                nodeJson["name"] = nodePtr->GetName();
                 nodesArray.push_back(nodeJson);
             }
             j["nodes"] = nodesArray;
 
             // Serialize connections
             nlohmann::json connectionsArray = nlohmann::json::array();
-            for (const auto &conn : connections)
+            for (const auto &conn : graph.connections)
             {
                 nlohmann::json connJson;
                 connJson["from"] = conn.from;
-                connJson["fromSlot"] = conn.fromSlot;
+                connJson["fromSlot"] = conn.fromSlot.Str();
                 connJson["to"] = conn.to;
-                connJson["toSlot"] = conn.toSlot;
+                connJson["toSlot"] = conn.toSlot.Str();
                 connectionsArray.push_back(connJson);
             }
             j["connections"] = connectionsArray;
 
             // Serialize node positions
             nlohmann::json positionsArray = nlohmann::json::array();
-            for (const auto &[id, pos] : nodePositions)
+            for (const auto &[id, pos] : graph.positions)
             {
                 nlohmann::json posJson;
                 posJson["id"] = id;
@@ -618,164 +5037,340 @@ namespace VisionCraft::Nodes
         }
     }
 
+    bool NodeEditor::WriteBinaryGraph(const GraphSaveSnapshot &graph, const std::filesystem::path &filepath)
+    {
+        GraphBinaryWriter writer;
+        for (const auto &node : graph.nodes)
+        {
+            writer.AddNode(node.id, node.type, node.name);
+            for (const auto &[slotName, value] : node.defaults)
+            {
+                writer.AddDefault(node.id, slotName, *value);
+            }
+        }
+
+        for (const auto &conn : graph.connections)
+        {
+            const bool execution = conn.type == ConnectionType::Execution;
+            writer.AddConnection(conn.from, conn.fromSlot.Str(), conn.to, conn.toSlot.Str(), execution);
+        }
+
+        for (const auto &[id, pos] : graph.positions)
+        {
+            writer.AddPosition(id, pos.first, pos.second);
+        }
+
+        if (!writer.WriteTo(filepath))
+        {
+            return false;
+        }
+
+        LOG_INFO("Saved graph to: {}", filepath.string());
+        return true;
+    }
+
     bool NodeEditor::LoadFromFile(const std::filesystem::path &filepath,
         std::unordered_map<NodeId, std::pair<float, float>> &nodePositions)
     {
         try
         {
-            std::ifstream file(filepath);
-            if (!file.is_open())
+            MappedFile file;
+            if (!file.Open(filepath))
             {
-                LOG_ERROR("Failed to open file for reading: {}", filepath.string());
                 return false;
             }
 
-            nlohmann::json j;
-            file >> j;
-            file.close();
+            const auto bytes = file.GetBytes();
+            auto arena = NodeArena::Create();
+            bool loaded = false;
+            {
+                NodeArena::Scope scope(arena);
+                loaded = GraphBinaryReader::IsBinaryGraph(bytes) ? LoadBinaryGraph(bytes, nodePositions)
+                                                                 : LoadJsonGraph(bytes, nodePositions);
+            }
+            if (!loaded)
+            {
+                LOG_ERROR("Failed to load graph: {}", filepath.string());
+                return false;
+            }
+            {
+                std::scoped_lock lock(graphMutex);
+                nodeArena = std::move(arena);
+            }
+
+            LOG_INFO("Loaded graph from: {}", filepath.string());
+            return true;
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("Failed to load graph: {}", e.what());
+            return false;
+        }
+    }
+
+    bool NodeEditor::LoadJsonGraph(std::span<const std::byte> bytes,
+        std::unordered_map<NodeId, std::pair<float, float>> &nodePositions)
+    {
+        // Impose limits on element counts to prevent DoS via memory exhaustion
+        constexpr size_t kMaxNodes = 10000;
+        constexpr size_t kMaxConnections = 50000;
+
+        // Elements are validated as they stream in; the current graph is only replaced once the whole file is read
+        std::unordered_map<NodeId, std::shared_ptr<Node>> loadedNodes;
+        std::vector<Connection> loadedConnections;
+        std::unordered_map<NodeId, std::pair<float, float>> loadedPositions;
+        size_t nodeCount = 0;
+        size_t connectionCount = 0;
+
+        const auto validId = [](int64_t id) { return id >= 0 && id <= Constants::Persistence::kMaxNodeId; };
+
+        const auto onNode = [&](GraphJson::NodeRecord &&record) {
+            if (++nodeCount > kMaxNodes)
+            {
+                LOG_ERROR("Graph contains more than {} nodes. File may be corrupted or malicious.", kMaxNodes);
+                return false;
+            }
 
-            // Clear existing graph
-            Clear();
-            nodePositions.clear();
+            // Validate node type is registered
+            if (!Vision::NodeFactory::IsRegistered(record.type))
+            {
+                LOG_ERROR("Attempted to load unregistered node type: {} - skipping", record.type);
+                return true;
+            }
+
+            // Validate node ID is reasonable
+            if (!validId(record.id))
+            {
+                LOG_ERROR("Invalid node ID: {} - skipping", record.id);
+                return true;
+            }
+
+            // Validate name length to prevent excessive memory usage
+            if (record.name.length() > Constants::Persistence::kMaxNameLength)
+            {
+                LOG_ERROR("Node name too long ({} chars), max is {} - skipping",
+                    record.name.length(),
+                    Constants::Persistence::kMaxNameLength);
+                return true;
+            }
 
-            // Deserialize nodes
-            if (j.contains("nodes"))
+            const auto id = static_cast<NodeId>(record.id);
+            auto node = Vision::NodeFactory::CreateNode(record.type, id, record.name);
+            if (!node)
             {
-                const auto &nodesArray = j["nodes"];
+                LOG_ERROR("Failed to create node of type: {}", record.type);
+                return true;
+            }
 
-                // Impose limit on number of nodes to prevent DoS via memory exhaustion
-                constexpr size_t kMaxNodes = 10000;
-                if (nodesArray.size() > kMaxNodes)
+            // Restore tuned parameters, converted to the type each slot's default holds
+            for (const auto &[slotName, valueJson] : record.defaults)
+            {
+                if (!node->HasInputSlot(slotName))
                 {
-                    LOG_ERROR("Graph contains {} nodes, exceeding maximum of {}. File may be corrupted or malicious.",
-                        nodesArray.size(),
-                        kMaxNodes);
-                    return false;
+                    LOG_WARN("Node {} has no input slot '{}' - skipping saved default", record.name, slotName);
+                    continue;
                 }
 
-                for (const auto &nodeJson : nodesArray)
+                const auto current = node->GetInputSlot(slotName).GetSharedDefaultValue();
+                if (auto value = current ? DefaultFromJson(valueJson, *current) : std::nullopt)
                 {
-                    NodeId id = nodeJson["id"];
-                    std::string type = nodeJson["type"];
-                    std::string name = nodeJson["name"];
+                    node->SetInputSlotDefault(slotName, std::move(*value));
+                }
+                else
+                {
+                    LOG_WARN("Saved default of {}.{} has a different type - skipping", record.name, slotName);
+                }
+            }
+            loadedNodes[id] = std::move(node);
+            return true;
+        };
 
-                    // Validate node type is registered
-                    if (!Vision::NodeFactory::IsRegistered(type))
-                    {
-                        LOG_ERROR("Attempted to load unregistered node type: {} - skipping", type);
-                        continue;
-                    }
+        const auto onConnection = [&](GraphJson::ConnectionRecord &&record) {
+            if (++connectionCount > kMaxConnections)
+            {
+                LOG_ERROR("Graph contains more than {} connections. File may be corrupted or malicious.",
+                    kMaxConnections);
+                return false;
+            }
 
-                    // Validate node ID is reasonable
-                    constexpr NodeId kMaxNodeId = 1000000;
-                    if (id < 0 || id > kMaxNodeId)
-                    {
-                        LOG_ERROR("Invalid node ID: {} - skipping", id);
-                        continue;
-                    }
+            // Validate slot name lengths
+            if (record.fromSlot.length() > Constants::Persistence::kMaxSlotNameLength
+                || record.toSlot.length() > Constants::Persistence::kMaxSlotNameLength)
+            {
+                LOG_WARN("Skipping connection with excessively long slot names");
+                return true;
+            }
 
-                    // Validate name length to prevent excessive memory usage
-                    constexpr size_t kMaxNameLength = 256;
-                    if (name.length() > kMaxNameLength)
-                    {
-                        LOG_ERROR("Node name too long ({} chars), max is {} - skipping", name.length(), kMaxNameLength);
-                        continue;
-                    }
+            // IDs outside the node range can never match a loaded node
+            if (!validId(record.from) || !validId(record.to))
+            {
+                LOG_WARN("Skipping connection from {} to {} - node(s) not found", record.from, record.to);
+                return true;
+            }
 
-                    auto node = Vision::NodeFactory::CreateNode(type, id, name);
-                    if (node)
-                    {
-                        AddNode(std::move(node));
-                    }
-                    else
-                    {
-                        LOG_ERROR("Failed to create node of type: {}", type);
-                    }
-                }
+            loadedConnections.push_back({ .from = static_cast<NodeId>(record.from),
+                .fromSlot = record.fromSlot,
+                .to = static_cast<NodeId>(record.to),
+                .toSlot = record.toSlot });
+            return true;
+        };
+
+        const auto onPosition = [&](const GraphJson::PositionRecord &record) {
+            // Validate position values (reject NaN, Inf, and unreasonable coordinates)
+            if (!validId(record.id) || !std::isfinite(record.x) || !std::isfinite(record.y)
+                || std::abs(record.x) > Constants::Persistence::kMaxCoordinate
+                || std::abs(record.y) > Constants::Persistence::kMaxCoordinate)
+            {
+                LOG_WARN("Skipping node {} with invalid position ({}, {})", record.id, record.x, record.y);
+                return true;
             }
+            loadedPositions[static_cast<NodeId>(record.id)] = { record.x, record.y };
+            return true;
+        };
+
+        GraphJsonReader reader(onNode, onConnection, onPosition);
+        if (!reader.Parse(bytes))
+        {
+            return false;
+        }
 
-            // Deserialize connections
-            if (j.contains("connections"))
+        // Saved files list connections before nodes, so endpoints are only checked once everything is read
+        std::erase_if(loadedConnections, [&](const Connection &c) {
+            if (loadedNodes.contains(c.from) && loadedNodes.contains(c.to))
             {
-                const auto &connectionsArray = j["connections"];
+                return false;
+            }
+            LOG_WARN("Skipping connection from {} to {} - node(s) not found", c.from, c.to);
+            return true;
+        });
 
-                // Impose limit on number of connections to prevent DoS
-                constexpr size_t kMaxConnections = 50000;
-                if (connectionsArray.size() > kMaxConnections)
-                {
-                    LOG_ERROR(
-                        "Graph contains {} connections, exceeding maximum of {}. File may be corrupted or malicious.",
-                        connectionsArray.size(),
-                        kMaxConnections);
-                    return false;
-                }
+        ReplaceGraph(std::move(loadedNodes), std::move(loadedConnections));
+        nodePositions = std::move(loadedPositions);
+        return true;
+    }
 
-                for (const auto &connJson : connectionsArray)
-                {
-                    NodeId from = connJson["from"];
-                    NodeId to = connJson["to"];
+    bool NodeEditor::LoadBinaryGraph(std::span<const std::byte> bytes,
+        std::unordered_map<NodeId, std::pair<float, float>> &nodePositions)
+    {
+        GraphBinaryReader reader;
+        if (!reader.Open(bytes))
+        {
+            return false;
+        }
+        const auto &header = reader.GetHeader();
 
-                    // Support both old and new formats
-                    std::string fromSlot =
-                        connJson.contains("fromSlot") ? connJson["fromSlot"].get<std::string>() : "Output";
-                    std::string toSlot = connJson.contains("toSlot") ? connJson["toSlot"].get<std::string>() : "Input";
+        // Everything is read and validated before the current graph is touched. Record counts need no limit
+        // of their own: Open() checked that every record is present in the file.
+        std::unordered_map<NodeId, std::shared_ptr<Node>> loadedNodes;
+        loadedNodes.reserve(header.nodeCount);
+        for (size_t i = 0; i < header.nodeCount; ++i)
+        {
+            const auto record = reader.GetNode(i);
+            const auto type = reader.GetString(record.type);
+            const auto name = reader.GetString(record.name);
+            if (!type || !name)
+            {
+                LOG_ERROR("Binary graph node record {} points outside the file", i);
+                return false;
+            }
 
-                    // Validate slot name lengths
-                    constexpr size_t kMaxSlotNameLength = 128;
-                    if (fromSlot.length() > kMaxSlotNameLength || toSlot.length() > kMaxSlotNameLength)
-                    {
-                        LOG_WARN("Skipping connection with excessively long slot names");
-                        continue;
-                    }
+            if (!Vision::NodeFactory::IsRegistered(*type))
+            {
+                LOG_ERROR("Attempted to load unregistered node type: {} - skipping", *type);
+                continue;
+            }
 
-                    // Validate that both nodes exist before adding connection
-                    if (nodes.find(from) != nodes.end() && nodes.find(to) != nodes.end())
-                    {
-                        AddConnection(from, fromSlot, to, toSlot);
-                    }
-                    else
-                    {
-                        LOG_WARN("Skipping connection from {} to {} - node(s) not found", from, to);
-                    }
-                }
+            if (record.id < 0 || record.id > Constants::Persistence::kMaxNodeId)
+            {
+                LOG_ERROR("Invalid node ID: {} - skipping", record.id);
+                continue;
             }
 
-            // Deserialize node positions
-            if (j.contains("nodePositions"))
+            if (name->length() > Constants::Persistence::kMaxNameLength)
             {
-                for (const auto &posJson : j["nodePositions"])
-                {
-                    NodeId id = posJson["id"];
-                    float x = posJson["x"];
-                    float y = posJson["y"];
+                LOG_ERROR("Node name too long ({} chars), max is {} - skipping",
+                    name->length(),
+                    Constants::Persistence::kMaxNameLength);
+                continue;
+            }
 
-                    // Validate position values (reject NaN, Inf, and unreasonable coordinates)
-                    if (!std::isfinite(x) || !std::isfinite(y))
-                    {
-                        LOG_WARN("Skipping node {} with invalid position ({}, {})", id, x, y);
-                        continue;
-                    }
+            auto node = Vision::NodeFactory::CreateNode(*type, record.id, *name);
+            if (!node)
+            {
+                LOG_ERROR("Failed to create node of type: {}", *type);
+                continue;
+            }
+            loadedNodes[record.id] = std::move(node);
+        }
 
-                    // Reject extremely large coordinates (likely corrupted data)
-                    constexpr float kMaxCoordinate = 1000000.0f;
-                    if (std::abs(x) > kMaxCoordinate || std::abs(y) > kMaxCoordinate)
-                    {
-                        LOG_WARN("Skipping node {} with unreasonable position ({}, {})", id, x, y);
-                        continue;
-                    }
+        for (size_t i = 0; i < header.defaultCount; ++i)
+        {
+            const auto record = reader.GetDefault(i);
+            const auto slotName = reader.GetString(record.slot);
+            auto value = reader.GetValue(record);
+            if (!slotName || !value)
+            {
+                LOG_ERROR("Binary graph default record {} is corrupted", i);
+                return false;
+            }
 
-                    nodePositions[id] = { x, y };
-                }
+            if (const auto it = loadedNodes.find(record.node); it != loadedNodes.end())
+            {
+                RestoreSlotDefault(*it->second, std::string(*slotName), std::move(*value));
+            }
+        }
+
+        std::vector<Connection> loadedConnections;
+        loadedConnections.reserve(header.connectionCount);
+        for (size_t i = 0; i < header.connectionCount; ++i)
+        {
+            const auto record = reader.GetConnection(i);
+            const auto fromSlot = reader.GetString(record.fromSlot);
+            const auto toSlot = reader.GetString(record.toSlot);
+            if (!fromSlot || !toSlot)
+            {
+                LOG_ERROR("Binary graph connection record {} points outside the file", i);
+                return false;
             }
 
-            LOG_INFO("Loaded graph from: {}", filepath.string());
-            return true;
+            if (fromSlot->length() > Constants::Persistence::kMaxSlotNameLength
+                || toSlot->length() > Constants::Persistence::kMaxSlotNameLength)
+            {
+                LOG_WARN("Skipping connection with excessively long slot names");
+                continue;
+            }
+
+            if (!loadedNodes.contains(record.from) || !loadedNodes.contains(record.to))
+            {
+                LOG_WARN("Skipping connection from {} to {} - node(s) not found", record.from, record.to);
+                continue;
+            }
+
+            loadedConnections.push_back({ .from = record.from,
+                .fromSlot = *fromSlot,
+                .to = record.to,
+                .toSlot = *toSlot,
+                .type = record.execution != 0 ? ConnectionType::Execution : ConnectionType::Data });
         }
-        catch (const std::exception &e)
+
+        std::unordered_map<NodeId, std::pair<float, float>> loadedPositions;
+        loadedPositions.reserve(header.positionCount);
+        for (size_t i = 0; i < header.positionCount; ++i)
         {
-            LOG_ERROR("Failed to load graph: {}", e.what());
-            return false;
+            const auto record = reader.GetPosition(i);
+            if (!std::isfinite(record.x) || !std::isfinite(record.y)
+                || std::abs(record.x) > Constants::Persistence::kMaxCoordinate
+                || std::abs(record.y) > Constants::Persistence::kMaxCoordinate)
+            {
+                LOG_WARN("Skipping node {} with invalid position ({}, {})", record.id, record.x, record.y);
+                continue;
+            }
+            loadedPositions[record.id] = { record.x, record.y };
         }
+
+        ReplaceGraph(std::move(loadedNodes), std::move(loadedConnections));
+        nodePositions = std::move(loadedPositions);
+        return true;
     }
 
 } // namespace VisionCraft::Nodes
@@ -1,16 +1,35 @@
 #pragma once
+#include "Nodes/Core/ColorLut.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/ExecutionContext.h"
+#include "Nodes/Core/ExecutionStatistics.h"
+#include "Nodes/Core/ExecutorService.h"
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/ImageSlab.h"
+#include "Nodes/Core/MemoryPlanner.h"
 #include "Nodes/Core/Node.h"
+#include "Nodes/Core/NodeArena.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/ProgressChannel.h"
+#include "Nodes/Core/SlotName.h"
+#include "Nodes/Core/StopCondition.h"
 
 #include <nlohmann/json.hpp>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <span>
 #include <stop_token>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace VisionCraft::Nodes
@@ -24,6 +43,13 @@ namespace VisionCraft::Nodes
      */
     using ExecutionProgressCallback = std::function<void(int current, int total, const std::string &nodeName)>;
 
+    /**
+     * @brief Callback invoked after each streamed frame completes.
+     * @param frameIndex Zero-based frame number
+     * @return False to end the stream
+     */
+    using StreamFrameCallback = std::function<bool(size_t frameIndex)>;
+
     /**
      * @brief Type of connection between nodes.
      */
@@ -33,6 +59,77 @@ namespace VisionCraft::Nodes
         Data       ///< Data connection (colored wire) - transfers data between slots
     };
 
+    /**
+     * @brief Scheduling strategy used by NodeEditor::Execute().
+     */
+    enum class ExecutionMode
+    {
+        Sequential, ///< Run plan steps one after another on the calling thread
+        Parallel    ///< Dispatch ready steps to a work-stealing thread pool
+    };
+
+    /**
+     * @brief Which graphs NodeEditor::Execute() evaluates backward from their sinks.
+     *
+     * Pull-based evaluation runs only the sinks (see Node::IsSink(), NodeEditor::SetOutputNodes()) and the
+     * nodes they transitively read data from; branches whose results nothing observable consumes are skipped.
+     */
+    enum class PullEvaluation
+    {
+        DataFlowGraphs, ///< Legacy graphs without execution wires (default)
+        Always,         ///< Also graphs following execution wires
+        Off             ///< Run every planned node
+    };
+
+    /**
+     * @brief Settings for tiled and fused execution of node chains.
+     *
+     * A chain follows "Output" -> "Input" connections for as long as a node's output feeds only the next
+     * node and that node depends on nothing else. When enabled, Execute() splits images of at least
+     * minImagePixels into tiles and runs chains of tileable nodes (see Node::PrepareTileOperation()) over
+     * them on all cores, one tile through the whole chain at a time. Independently of that, runs of two or
+     * more pointwise nodes (halo 0) are fused into one pass over cache-sized row strips. A chain ending in a
+     * node that reads only part of its input (see Node::GetInputRegion(), e.g. a crop) runs only on that
+     * region, widened by each node's context and mapped through resizes (see Node::PrepareRegionOperation()).
+     * Either way no intermediate image is built at full size. Within a tiled or fused chain, two or more
+     * consecutive color transforms (see TileOperation::colorTransform) on an 8-bit image become a single
+     * lookup in a ColorLut, kept until their parameters change.
+     */
+    struct TilingOptions
+    {
+        bool enabled = false;                                              ///< Tile large images in Execute()
+        int tileSize = Constants::Tiling::kDefaultTileSize;                ///< Output tile edge in pixels
+        size_t minImagePixels = Constants::Tiling::kDefaultMinImagePixels; ///< Smaller images run whole
+        bool fusePointwise = true;                                         ///< Fuse pointwise runs of any size
+        bool propagateRegions = true;                                      ///< Compute only regions read downstream
+        bool collapseColorTransforms = true;                               ///< Look up color transforms in a ColorLut
+
+        bool operator==(const TilingOptions &) const = default;
+    };
+
+    /**
+     * @brief Counts how the editor kept its execution plan in step with graph edits.
+     *
+     * Adding a node or adding or removing a single data connection patches the plan in place; any other
+     * structural change makes the next run compile the whole plan again.
+     */
+    struct ExecutionPlanStatistics
+    {
+        size_t rebuilds = 0;       ///< Plans compiled from scratch
+        size_t patchedEdits = 0;   ///< Edits applied to the existing plan
+        size_t reorderedSteps = 0; ///< Steps moved by local reordering after a patched edit
+    };
+
+    /**
+     * @brief Image shapes NodeEditor::InferImageShapes() derived without running the graph.
+     */
+    struct ShapeInference
+    {
+        std::unordered_map<NodeId, ImageShape> shapes;          ///< "Output" shape of each node with a known one
+        std::vector<NodeId> derived;                            ///< Nodes whose shape came from their "Input"
+        std::vector<std::pair<NodeId, std::string>> mismatches; ///< Nodes rejecting their input shape, and why
+    };
+
     /**
      * @brief Connection between two node slots.
      *
@@ -43,10 +140,94 @@ namespace VisionCraft::Nodes
     struct Connection
     {
         NodeId from;                                ///< Source node ID
-        std::string fromSlot;                       ///< Source slot name
+        SlotName fromSlot;                          ///< Source slot name
         NodeId to;                                  ///< Destination node ID
-        std::string toSlot;                         ///< Destination slot name
+        SlotName toSlot;                            ///< Destination slot name
         ConnectionType type = ConnectionType::Data; ///< NEW: Connection type (execution or data)
+
+        bool operator==(const Connection &) const = default;
+    };
+
+    /**
+     * @brief Connections one graph edit removed and added, in that order.
+     */
+    struct ConnectionDelta
+    {
+        bool reset = false;              ///< Every previous connection was dropped (removed is left empty)
+        std::vector<Connection> removed; ///< Connections that no longer exist
+        std::vector<Connection> added;   ///< Connections that now exist
+
+        [[nodiscard]] bool Empty() const
+        {
+            return !reset && removed.empty() && added.empty();
+        }
+    };
+
+    /**
+     * @brief Everything NodeEditor::SaveToFile() writes, copied out of the graph under one short lock.
+     *
+     * Owns its data, so it can be serialized on another thread while the graph keeps changing. Slot
+     * defaults are shared rather than copied: they are immutable and replaced as a whole when edited.
+     */
+    struct GraphSaveSnapshot
+    {
+        /**
+         * @brief Saved state of one node.
+         */
+        struct SavedNode
+        {
+            NodeId id = 0;                                                                 ///< Node ID
+            std::string type;                                                              ///< Node::GetType()
+            std::string name;                                                              ///< Node::GetName()
+            std::vector<std::pair<std::string, std::shared_ptr<const NodeData>>> defaults; ///< Slot defaults
+        };
+
+        std::vector<SavedNode> nodes;                                  ///< Nodes in no particular order
+        std::vector<Connection> connections;                           ///< Connections in insertion order
+        std::unordered_map<NodeId, std::pair<float, float>> positions; ///< Canvas positions (x, y)
+    };
+
+    /**
+     * @brief Callback told about every change to a graph's connections.
+     * @note Called on the thread that made the edit, after the graph lock is released.
+     */
+    using ConnectionObserver = std::function<void(const ConnectionDelta &delta)>;
+
+    /**
+     * @brief Callback told when a run started by one of the *Async() methods finishes.
+     * @note Called on the job thread running it, just before the run's future becomes ready.
+     */
+    using RunFinishedObserver = std::function<void(bool succeeded)>;
+
+    /**
+     * @brief Immutable node IDs and connections of a graph at one version, shared by every reader of it.
+     *
+     * Taking a view of an unchanged graph copies nothing; a reader holding the view from an earlier frame
+     * can compare its version against NodeEditor::GetGraphVersion() and skip work entirely.
+     */
+    struct GraphView
+    {
+        uint64_t version = 0;                ///< Graph version the view was taken at
+        std::vector<NodeId> nodeIds;         ///< Node IDs in ascending order
+        std::vector<Connection> connections; ///< Connections in insertion order
+
+        /**
+         * @brief Returns the node IDs.
+         * @return Node IDs in ascending order
+         */
+        [[nodiscard]] std::span<const NodeId> NodeIds() const
+        {
+            return nodeIds;
+        }
+
+        /**
+         * @brief Returns the connections.
+         * @return Connections in insertion order
+         */
+        [[nodiscard]] std::span<const Connection> Connections() const
+        {
+            return connections;
+        }
     };
 
     /**
@@ -80,6 +261,15 @@ namespace VisionCraft::Nodes
          */
         [[nodiscard]] bool RemoveNode(NodeId id);
 
+        /**
+         * @brief Removes node from editor without destroying it.
+         * @param id Node ID
+         * @return Removed node with its parameters and slot data, or nullptr if not found
+         * @note Connections to the node are removed as by RemoveNode(). AddNode() reinserts the node
+         *       with its outputs intact, so it does not run again unless its inputs change.
+         */
+        [[nodiscard]] NodePtr DetachNode(NodeId id);
+
         /**
          * @brief Returns pointer to node.
          * @param id Node ID
@@ -97,9 +287,20 @@ namespace VisionCraft::Nodes
         /**
          * @brief Returns all node IDs.
          * @return Vector of node IDs
+         * @note Builds a new vector on every call; per-frame readers use GetGraphView().
          */
         [[nodiscard]] std::vector<NodeId> GetNodeIds() const;
 
+        /**
+         * @brief Returns the node IDs and connections at the current graph version.
+         *
+         * The view is built once per graph version and shared, so repeated calls between edits only take
+         * the lock and copy a pointer. It stays valid (and unchanged) after later edits.
+         *
+         * @return Shared immutable view
+         */
+        [[nodiscard]] std::shared_ptr<const GraphView> GetGraphView() const;
+
         /**
          * @brief Adds connection between node slots.
          * @param from Source node ID
@@ -109,9 +310,9 @@ namespace VisionCraft::Nodes
          * @param type Connection type (Execution or Data)
          */
         void AddConnection(NodeId from,
-            const std::string &fromSlot,
+            SlotName fromSlot,
             NodeId to,
-            const std::string &toSlot,
+            SlotName toSlot,
             ConnectionType type = ConnectionType::Data);
 
         /**
@@ -122,8 +323,7 @@ namespace VisionCraft::Nodes
          * @param toSlot Destination slot name
          * @return True if removed
          */
-        [[nodiscard]] bool
-            RemoveConnection(NodeId from, const std::string &fromSlot, NodeId to, const std::string &toSlot);
+        [[nodiscard]] bool RemoveConnection(NodeId from, SlotName fromSlot, NodeId to, SlotName toSlot);
 
         /**
          * @brief Returns a copy of all connections.
@@ -133,31 +333,186 @@ namespace VisionCraft::Nodes
          * invalidated by concurrent modifications to the graph.
          *
          * @return Vector containing copies of all connections
+         * @note Per-frame readers use GetGraphView(), which copies only when the graph changed.
          */
         [[nodiscard]] std::vector<Connection> GetConnections() const;
 
+        /**
+         * @brief Adds many nodes and connections under one lock, with a single plan invalidation.
+         *
+         * Same result as AddNode() for every node followed by AddConnection() for every connection, but
+         * linear in the size of the graph: storage is reserved once, connection conflicts are resolved in
+         * one pass, and the execution plan is rebuilt once on the next run instead of patched per call.
+         *
+         * @param newNodes Nodes to add; each replaces an existing node with the same ID
+         * @param newConnections Connections in insertion order; a later connection replaces an earlier (or
+         *        existing) one into the same slot, as with AddConnection()
+         * @return Number of connections added; those with an endpoint missing from the graph are dropped
+         */
+        size_t InsertGraph(std::vector<NodePtr> newNodes, std::vector<Connection> newConnections);
+
         /**
          * @brief Removes all nodes and connections.
+         * @note Nodes created afterwards go to a fresh NodeArena; the old one lives on while undo history or a
+         *       run snapshot still holds its nodes.
          */
         void Clear();
 
+        /**
+         * @brief Returns the arena this graph's nodes are allocated from.
+         * @return Arena to activate with a NodeArena::Scope while creating nodes for this graph
+         */
+        [[nodiscard]] std::shared_ptr<NodeArena> GetNodeArena() const;
+
+        /**
+         * @brief Starts a batch of edits that holds graphMutex until the matching CommitTransaction().
+         *
+         * Edits inside the batch skip incremental plan patching and invalidate the plan at most once, and
+         * the connection observer hears one combined delta at commit instead of one per edit. Other threads
+         * block on the graph until then. Transactions nest; only the outermost commit takes effect.
+         *
+         * @note Prefer GraphTransaction, which commits when it goes out of scope.
+         */
+        void BeginTransaction();
+
+        /**
+         * @brief Ends the batch opened by the matching BeginTransaction().
+         * @note Releases graphMutex before notifying the connection observer, like any other edit.
+         */
+        void CommitTransaction();
+
+        /**
+         * @brief Sets the callback told about connection changes.
+         *
+         * The editor is the only store of connections; views such as the canvas mirror them by applying each
+         * delta instead of tracking edits themselves. Every edit reports what it removed and added, including
+         * connections replaced by AddConnection() or dropped with a removed node. Clear() and loading a file
+         * report a reset followed by the new connections.
+         *
+         * @param observer Callback, or nullptr to stop notifications
+         */
+        void SetConnectionObserver(ConnectionObserver observer);
+
+        /**
+         * @brief Sets the callback told when an asynchronous run finishes.
+         *
+         * Lets a UI sleep until a run is done instead of polling its future every frame.
+         *
+         * @param observer Callback, or nullptr to stop notifications
+         */
+        void SetRunFinishedObserver(RunFinishedObserver observer);
+
         /**
          * @brief Executes node graph in dependency order.
          * @param progressCallback Optional callback for progress updates
          * @param stopToken Token to check for cancellation requests
-         * @return True if succeeded, false if cycle detected or cancelled
+         * @return True if succeeded, false if cycle detected, cancelled or past the execution timeout
          * @note Performs topological sort, passes data between nodes, and calls Process() in order.
+         *       Runs against a snapshot of the graph; the graph lock is only held while taking it, so
+         *       GetNode(), GetNodeIds() and edits from other threads never wait for nodes to finish.
+         *       Concurrent executions are serialized.
          */
         bool Execute(const ExecutionProgressCallback &progressCallback = nullptr, std::stop_token stopToken = {});
 
         /**
-         * @brief Executes node graph asynchronously in background thread.
+         * @brief Executes node graph asynchronously on a job thread of the executor service.
          * @param progressCallback Optional callback for progress updates
          * @return Future that will contain execution result
          * @note Use this to prevent UI blocking. Check future.valid() and future.wait_for() to poll status.
+         *       Job threads are reused, so repeated runs start no new threads.
          */
         std::shared_future<bool> ExecuteAsync(const ExecutionProgressCallback &progressCallback = nullptr);
 
+        /**
+         * @brief Executes node graph at full resolution, whatever the proxy scale.
+         * @param progressCallback Optional callback for progress updates
+         * @param stopToken Token to check for cancellation requests
+         * @return True if succeeded, as for Execute()
+         * @note The run a proxy-scale session saves its results with (see SetProxyScale()). The next proxy run
+         *       re-runs every node at the proxy scale again, or restores it from the output cache.
+         */
+        bool ExecuteFullResolution(
+            const ExecutionProgressCallback &progressCallback = nullptr, std::stop_token stopToken = {});
+
+        /**
+         * @brief Runs ExecuteFullResolution() on a job thread of the executor service.
+         * @param progressCallback Optional callback for progress updates
+         * @return Future that will contain execution result
+         */
+        std::shared_future<bool> ExecuteFullResolutionAsync(
+            const ExecutionProgressCallback &progressCallback = nullptr);
+
+        /**
+         * @brief Executes only a node and the nodes it reads data from, directly or indirectly.
+         *
+         * Prunes the plan to the target's upstream cone along data connections (execution wires only
+         * order the remaining steps) and runs it like Execute(). Other branches, such as outputs saving
+         * to disk, do not run; nodes reading an output that changed are marked dirty for the next run.
+         *
+         * @param target Node to bring up to date
+         * @param progressCallback Optional callback for progress updates (totals count pruned steps)
+         * @param stopToken Token to check for cancellation requests
+         * @return True if succeeded, false if the target is not in the plan, or as for Execute()
+         */
+        bool ExecuteUpTo(NodeId target,
+            const ExecutionProgressCallback &progressCallback = nullptr,
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Runs ExecuteUpTo() on a job thread of the executor service.
+         * @param target Node to bring up to date
+         * @param progressCallback Optional callback for progress updates
+         * @return Future that will contain execution result
+         */
+        std::shared_future<bool> ExecuteUpToAsync(NodeId target,
+            const ExecutionProgressCallback &progressCallback = nullptr);
+
+        /**
+         * @brief Executes node graph once per frame until a stream source ends.
+         *
+         * The compiled plan is reused for every frame and only rebuilt if the graph changed. Stream source
+         * nodes (see Node::IsStreamSource()) are re-run each frame; clean downstream nodes are still skipped.
+         * In parallel mode frames are pipelined on the thread pool: a step may start frame N+1 while later
+         * steps are still working on frame N. Graph edits are picked up between short segments of frames.
+         *
+         * @param frameCallback Optional callback after each frame. Nodes without downstream steps (previews,
+         *        outputs) hold that frame's results while it runs; upstream nodes may already be on later frames.
+         * @param maxFrames Stop after this many frames (0 = until a source ends)
+         * @param stopToken Token to check for cancellation requests
+         * @return Number of completed frames (also when cancelled), or std::nullopt if the plan could not be
+         *         built, the graph has no stream source, or a node threw
+         */
+        std::optional<size_t> ExecuteStream(const StreamFrameCallback &frameCallback = nullptr,
+            size_t maxFrames = 0,
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Executes the graph with every slot value held in an ExecutionContext.
+         *
+         * The graph's own slots, dirty flags, output cache and statistics are left alone, and the execution
+         * lock is not taken: any number of threads may run contexts at once, alongside Execute(). Steps run
+         * in plan order on the calling thread with the context bound, at full resolution; nodes whose outputs
+         * the context supplies are skipped. Tiling, output caching and incremental skipping apply to the
+         * editor's own runs only.
+         *
+         * @param context Overrides and supplied outputs on entry; every slot value of the run on return
+         * @param stopToken Token to check for cancellation requests (CancelExecution() does not reach it)
+         * @return True if every node ran; otherwise the context holds the error and whether it timed out
+         */
+        bool ExecuteInContext(ExecutionContext &context, std::stop_token stopToken = {});
+
+        /**
+         * @brief Returns the graph version, bumped by every structural change.
+         * @return Version compared against execution snapshots
+         */
+        [[nodiscard]] uint64_t GetGraphVersion() const;
+
+        /**
+         * @brief Returns how often the execution plan was rebuilt or patched.
+         * @return Counters since construction
+         */
+        [[nodiscard]] ExecutionPlanStatistics GetExecutionPlanStatistics() const;
+
         /**
          * @brief Requests cancellation of current execution.
          * @note This is thread-safe and can be called from any thread.
@@ -165,146 +520,1437 @@ namespace VisionCraft::Nodes
         void CancelExecution();
 
         /**
-         * @brief Serializes graph to JSON file.
-         * @param filepath Path to save file
-         * @param nodePositions Map of node IDs to positions (x,y coordinates)
-         * @return True if succeeded
+         * @brief Selects how Execute() schedules nodes.
+         * @param mode Execution mode
+         * @note Parallel mode runs independent branches concurrently, so Process() implementations must not share
+         *       mutable state across nodes.
          */
-        bool SaveToFile(const std::filesystem::path &filepath,
-            const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const;
+        void SetExecutionMode(ExecutionMode mode);
 
         /**
-         * @brief Deserializes graph from JSON file.
-         * @param filepath Path to load file
-         * @param nodePositions Output map for node positions
-         * @return True if succeeded
+         * @brief Returns current execution mode.
+         * @return Execution mode
          */
-        bool LoadFromFile(const std::filesystem::path &filepath,
-            std::unordered_map<NodeId, std::pair<float, float>> &nodePositions);
+        [[nodiscard]] ExecutionMode GetExecutionMode() const;
 
-    private:
         /**
-         * @brief Execution step in cached execution plan.
-         *
-         * Represents a single "instruction" in the execution plan, containing a node to execute
-         * and the data connections that feed into it. This structure enables cache-friendly
-         * linear execution without recomputing topological sort or searching connections.
+         * @brief Sets number of worker threads used in parallel mode.
+         * @param count Worker count (0 selects hardware concurrency)
+         * @note Resizes the executor service's worker pool, so a shared service changes for all its users.
+         *       The pool is recreated lazily; a running execution finishes on the old one.
          */
-        struct ExecutionStep
-        {
-            NodeId nodeId;                                 ///< Node to execute at this step
-            std::vector<size_t> incomingConnectionIndices; ///< Indices into connections vector
-        };
+        void SetWorkerCount(size_t count);
 
         /**
-         * @brief Execution frame tracking current execution state.
-         *
-         * Manages the "instruction pointer" (current step index) for graph execution,
-         * implementing lookahead advancement pattern where the instruction pointer
-         * advances BEFORE node execution, not after.
+         * @brief Enables or disables critical-path scheduling of parallel runs.
+         * @param enabled When true (the default), ready steps start in order of their estimated remaining
+         *        critical path: their own moving-average Process() time plus the longest chain of estimates
+         *        below them. Steps feeding a visible node (see SetVisibleNodes()) go first. When false, ready
+         *        steps start in the order their dependencies finished.
          */
-        struct ExecutionFrame
-        {
-            size_t nextInstructionIndex = 0;                          ///< Next instruction pointer (step index)
-            const ExecutionStep *currentStep = nullptr;               ///< Pointer to current step
-            std::chrono::high_resolution_clock::time_point startTime; ///< Execution start time
+        void SetCriticalPathScheduling(bool enabled);
 
-            // Execution statistics for profiling
-            struct Statistics
-            {
-                std::vector<std::chrono::microseconds> nodeExecutionTimes; ///< Per-node execution times
-                size_t nodesExecuted = 0;                                  ///< Total nodes executed
-                size_t dataPassOperations = 0;                             ///< Total data transfer operations
-            } stats;
+        /**
+         * @brief Checks if critical-path scheduling is enabled.
+         * @return True if ready steps are ranked by remaining critical path
+         */
+        [[nodiscard]] bool IsCriticalPathSchedulingEnabled() const;
 
-            /**
-             * @brief Advances instruction pointer to next step (lookahead pattern).
-             *
-             * The instruction pointer advances BEFORE the node executes, not after.
-             * This "lookahead advancement" enables efficient bytecode-style execution.
-             *
-             * @param plan Execution plan to advance through
-             */
-            void AdvanceToNext(const std::vector<ExecutionStep> &plan)
-            {
-                if (nextInstructionIndex < plan.size())
-                {
-                    currentStep = &plan[nextInstructionIndex];
-                    ++nextInstructionIndex; // Lookahead advancement!
-                }
-                else
-                {
-                    currentStep = nullptr;
-                }
-            }
+        /**
+         * @brief Tells the scheduler which nodes the user is looking at.
+         * @param nodeIds Visible result nodes (e.g. previews on screen); empty to rank every branch alike
+         * @note Steps these nodes read from, directly or indirectly, start before other ready steps in
+         *       parallel runs, so the visible results finish first.
+         */
+        void SetVisibleNodes(std::vector<NodeId> nodeIds);
 
-            /**
-             * @brief Checks if execution is finished.
-             * @param plan Execution plan being executed
-             * @return True if all steps executed
-             */
-            [[nodiscard]] bool IsFinished(const std::vector<ExecutionStep> &plan) const
-            {
-                return nextInstructionIndex >= plan.size();
-            }
+        /**
+         * @brief Returns the moving-average Process() times the scheduler ranks steps by.
+         * @return Cost model fed by every recorded run
+         */
+        [[nodiscard]] const NodeCostModel &GetNodeCosts() const;
 
-            /**
-             * @brief Records execution time for a node (for profiling).
-             * @param duration Time taken to execute node
-             */
-            void RecordNodeExecution(std::chrono::microseconds duration)
-            {
-                stats.nodeExecutionTimes.push_back(duration);
-                stats.nodesExecuted++;
-            }
-        };
+        /**
+         * @brief Replaces the executor service runs, parallel steps and stream stages are submitted to.
+         * @param service Service to use (typically owned by the application and shared with batch processing)
+         * @note Waits for a running execution. Without a call the editor creates a private service.
+         */
+        void SetExecutorService(std::shared_ptr<ExecutorService> service);
 
         /**
-         * @brief Performs topological sort on node graph.
-         * @return Node IDs in execution order, or empty if cycle detected
+         * @brief Returns the executor service.
+         * @return Service shared by this editor's runs and any batch launched on it
          */
-        [[nodiscard]] std::vector<NodeId> TopologicalSort() const;
+        [[nodiscard]] ExecutorService &GetExecutorService();
 
         /**
-         * @brief Builds cached execution plan from current graph topology.
-         *
-         * Performs topological sort and precomputes incoming connections for each node,
-         * enabling fast repeated execution without reanalysis. This is the "compilation"
-         * phase in the execution model.
-         *
-         * @return Vector of execution steps in dependency order
+         * @brief Enables or disables incremental execution.
+         * @param enabled When true, Execute() skips clean nodes and keeps their last output slot data
          */
-        [[nodiscard]] std::vector<ExecutionStep> BuildExecutionPlan() const;
+        void SetIncrementalExecution(bool enabled);
 
         /**
-         * @brief Invalidates cached execution plan, forcing recompilation on next execute.
-         *
-         * Called automatically when graph structure changes (add/remove nodes/connections).
-         * This implements the invalidation phase of the cache-aside pattern.
+         * @brief Checks if incremental execution is enabled.
+         * @return True if clean nodes are skipped
          */
-        void InvalidateExecutionPlan();
+        [[nodiscard]] bool IsIncrementalExecution() const;
 
         /**
-         * @brief Passes data between nodes using slot system.
-         * @param fromNode Source node
-         * @param toNode Destination node
-         * @param fromSlotName Source slot name
-         * @param toSlotName Destination slot name
-         */
-        static void PassDataBetweenNodes(Node *fromNode,
-            Node *toNode,
-            const std::string &fromSlotName,
-            const std::string &toSlotName);
-
-        std::unordered_map<NodeId, NodePtr> nodes; ///< Node storage
-        std::vector<Connection> connections;       ///< Connections
-        NodeId nextId;                             ///< Next available ID
-
-        mutable std::recursive_mutex graphMutex;                ///< Mutex for thread safety
-        std::stop_source stopSource;                            ///< Source for cancellation requests
-        std::shared_future<bool> currentExecution;              ///< Handle to current async execution
-        mutable std::vector<ExecutionStep> cachedExecutionPlan; ///< Cached execution plan (mutable for lazy init)
-        mutable bool executionPlanValid = false;                ///< Cache validity flag
+         * @brief Flags node for re-execution on the next run.
+         * @param id Node ID
+         */
+        void MarkNodeDirty(NodeId id);
+
+        /**
+         * @brief Flags every node for re-execution (e.g. after source files changed on disk).
+         */
+        void MarkAllNodesDirty();
+
+        /**
+         * @brief Enables or disables the content-addressed output cache.
+         * @param enabled When true, dirty nodes whose inputs match a cached evaluation restore outputs instead of
+         * processing
+         */
+        void SetOutputCacheEnabled(bool enabled);
+
+        /**
+         * @brief Checks if the output cache is enabled.
+         * @return True if cached outputs are reused
+         */
+        [[nodiscard]] bool IsOutputCacheEnabled() const;
+
+        /**
+         * @brief Drops intermediate results as soon as every node reading them has run.
+         * @param enabled When true, Execute() clears a node's connected inputs once it ran and its outputs once its
+         * last consumer ran, so peak memory follows the live images only
+         * @note Nodes without data consumers keep inputs and outputs. Released nodes are marked dirty, so the next
+         *       incremental run rebuilds them; prefer this for headless runs. Stream runs keep their outputs.
+         */
+        void SetIntermediateRelease(bool enabled);
+
+        /**
+         * @brief Checks if intermediate results are released during Execute().
+         * @return True if outputs are cleared after their last consumer
+         */
+        [[nodiscard]] bool IsIntermediateReleaseEnabled() const;
+
+        /**
+         * @brief Selects which graphs Execute() prunes to the nodes their sinks read from.
+         * @param mode Pull-based evaluation mode
+         * @note A graph without any sink runs in full. Skipped nodes stay dirty and run once something observable
+         *       reads them again. Stream runs also keep their stream sources; ExecuteUpTo() is not affected.
+         */
+        void SetPullEvaluation(PullEvaluation mode);
+
+        /**
+         * @brief Returns the pull-based evaluation mode.
+         * @return Mode
+         */
+        [[nodiscard]] PullEvaluation GetPullEvaluation() const;
+
+        /**
+         * @brief Declares nodes whose outputs are results even though they are not sinks (e.g. read by a caller).
+         * @param ids Nodes pull-based evaluation keeps in addition to Node::IsSink() nodes (unknown IDs are ignored)
+         */
+        void SetOutputNodes(std::vector<NodeId> ids);
+
+        /**
+         * @brief Returns the nodes declared with SetOutputNodes().
+         * @return Node IDs
+         */
+        [[nodiscard]] std::vector<NodeId> GetOutputNodes() const;
+
+        /**
+         * @brief Runs only one of several identical nodes and lets the others share its outputs.
+         * @param enabled When true, a node of the same type as an earlier one, reading the same upstream slots
+         * and holding the same parameters, takes that node's outputs instead of processing (e.g. a branch
+         * duplicated by copy and paste)
+         * @note Off by default. Only cacheable nodes are merged (see Node::IsCacheable()). Parameters are compared
+         *       again before each run, so editing one duplicate makes it process on its own. Recorded as
+         *       StepOutcome::Aliased.
+         */
+        void SetDuplicateElimination(bool enabled);
+
+        /**
+         * @brief Checks if identical nodes share one evaluation.
+         * @return True if duplicates are merged
+         */
+        [[nodiscard]] bool IsDuplicateEliminationEnabled() const;
+
+        /**
+         * @brief Limits how long each Execute() may run.
+         * @param timeout Time from the start of a run after which it stops (zero = no limit)
+         * @note Checked between steps, between tiles of tiled chains and by nodes polling their stop condition
+         *       (see Node::ThrowIfStopRequested()); a single OpenCV call still runs to completion. The stopped
+         *       node stays dirty and RunStatistics::timedOut is set. Stream runs have no deadline.
+         */
+        void SetExecutionTimeout(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Returns the per-run execution timeout.
+         * @return Timeout (zero = no limit)
+         */
+        [[nodiscard]] std::chrono::milliseconds GetExecutionTimeout() const;
+
+        /**
+         * @brief Configures tiled execution of large images and fusion of pointwise nodes.
+         * @param options Tiling settings, used from the next Execute() on
+         * @note Only a chain's last node keeps its output image; the others re-run with the chain when
+         *       anything in it changes. Stream runs never tile or fuse.
+         */
+        void SetTilingOptions(const TilingOptions &options);
+
+        /**
+         * @brief Returns tiled execution settings.
+         * @return Current settings
+         */
+        [[nodiscard]] TilingOptions GetTilingOptions() const;
+
+        /**
+         * @brief Keeps images in device memory (OpenCL through cv::UMat) between nodes that support it.
+         * @param enabled When true, images are uploaded once before the first device node of a chain and
+         * downloaded only where a node without device support reads them
+         * @note Without an OpenCL device, OpenCV runs cv::UMat operations on the CPU; results are unchanged.
+         */
+        void SetDeviceExecution(bool enabled);
+
+        /**
+         * @brief Checks if device execution is enabled.
+         * @return True if images stay on the device between supporting nodes
+         */
+        [[nodiscard]] bool IsDeviceExecutionEnabled() const;
+
+        /**
+         * @brief Keeps nodes of the given types on the CPU even when device execution is enabled.
+         * @param nodeTypes Node::GetType() values; their images are read from host memory
+         * @note For nodes whose OpenCL kernels lose to the CPU on this machine (see Vision::IO::Autotuner).
+         */
+        void SetHostOnlyNodeTypes(std::vector<std::string> nodeTypes);
+
+        /**
+         * @brief Returns the node types kept on the CPU under device execution.
+         * @return Types set with SetHostOnlyNodeTypes(), sorted
+         */
+        [[nodiscard]] std::vector<std::string> GetHostOnlyNodeTypes() const;
+
+        /**
+         * @brief Runs Execute() and ExecuteUpTo() on reduced-resolution proxies of the source images.
+         *
+         * For interactive tuning of large images: image inputs downscale what they load, and nodes scale
+         * their kernel sizes along (see Node::ScaleKernelSize()), so a proxy run looks like a shrunk
+         * full-resolution run at a fraction of the cost. Proxy runs never save; ImageOutputNode AutoSave
+         * writes only in full-resolution runs such as ExecuteFullResolution().
+         *
+         * @param scale Fraction of full resolution, clamped to Constants::Proxy::kMinScale; 1 turns proxies off
+         * @note A run at a different scale than a node last ran at re-runs that node. Output cache entries are
+         *       keyed by scale, so switching back and forth restores both. Stream runs stay at full resolution.
+         */
+        void SetProxyScale(double scale);
+
+        /**
+         * @brief Returns the proxy scale of Execute() and ExecuteUpTo().
+         * @return Fraction of full resolution (1 = proxies off)
+         */
+        [[nodiscard]] double GetProxyScale() const;
+
+        /**
+         * @brief Sets the depth nodes store intermediate results in (see PrecisionPolicy).
+         *
+         * Trades precision nobody looks at for memory bandwidth: under PrecisionPolicy::Prefer16 a Sobel
+         * writes its signed CV_16S derivative instead of a float one and a gradient magnitude is stored as
+         * CV_16F, half the bytes of CV_32F. Nodes that cannot read CV_16F receive such images widened to CV_32F.
+         *
+         * @param policy Policy of every later run, stream runs included
+         * @note A node last run under another policy re-runs; output cache entries are keyed by policy.
+         */
+        void SetPrecisionPolicy(PrecisionPolicy policy);
+
+        /**
+         * @brief Returns the depth policy of later runs.
+         * @return Policy (PrecisionPolicy::Native by default)
+         */
+        [[nodiscard]] PrecisionPolicy GetPrecisionPolicy() const;
+
+        /**
+         * @brief Returns the output cache (budget, statistics, clearing).
+         * @return Reference to the cache
+         */
+        [[nodiscard]] NodeOutputCache &GetOutputCache();
+
+        /**
+         * @brief Returns the pool node output images are allocated from (budget, statistics, clearing).
+         * @return Reference to the pool
+         * @note Buffers of released outputs are reused by later runs and stream frames of the same size.
+         */
+        [[nodiscard]] ImageBufferPool &GetImageBufferPool();
+
+        /**
+         * @brief Infers the image shape every node will output, from source shapes and node parameters.
+         *
+         * Follows "Output" to "Input" connections from the sources down, asking each node for its output
+         * shape (see Node::InferOutputShape()). Nothing runs, so this works on a graph that never ran.
+         *
+         * @param sourceShapes Output shapes to assume for given nodes, e.g. sources whose images are not
+         *        loaded yet (a camera's resolution); they override what those nodes report
+         * @return Known shapes and the nodes that cannot process the shape they would receive
+         */
+        [[nodiscard]] ShapeInference InferImageShapes(
+            const std::unordered_map<NodeId, ImageShape> &sourceShapes = {}) const;
+
+        /**
+         * @brief Checks whether a connection would feed a node an image it cannot process.
+         * @param connection Data connection to check (need not exist yet)
+         * @return Reason if the producer's shape is known and the consumer rejects it, otherwise std::nullopt
+         * @note Only "Output" to "Input" connections carry a shape; others always pass.
+         */
+        [[nodiscard]] std::optional<std::string> CheckConnectionShapes(const Connection &connection) const;
+
+        /**
+         * @brief Checks whether a connection joins slots whose declared data types differ (see Slot::SetDataType()).
+         * @param connection Data connection to check (need not exist yet)
+         * @return Reason if both slots exist and their types are incompatible, otherwise std::nullopt
+         * @note Plan compilation leaves such connections unbound, so the consumer reads its default.
+         */
+        [[nodiscard]] std::optional<std::string> CheckConnectionTypes(const Connection &connection) const;
+
+        /**
+         * @brief Lists every data connection that fails CheckConnectionTypes().
+         * @return Each mismatched connection with its reason
+         */
+        [[nodiscard]] std::vector<std::pair<Connection, std::string>> FindTypeMismatches() const;
+
+        /**
+         * @brief Fills the image pool with one buffer per inferred intermediate image, before the first run.
+         * @param sourceShapes As for InferImageShapes()
+         * @return Bytes allocated into the pool, bounded by its idle byte budget
+         * @note Nodes allocating their outputs through CreateOutputImage() then find their buffers ready, so the
+         *       first run faults no fresh pages in and the footprint is fixed up front.
+         */
+        size_t PreallocateImages(const std::unordered_map<NodeId, ImageShape> &sourceShapes = {});
+
+        /**
+         * @brief Places intermediate images in one preallocated slab, sharing memory between images never alive
+         *        at the same time.
+         *
+         * Lifetimes come from the plan's step order and each image's last consumer, sizes from
+         * InferImageShapes(); MemoryPlanner packs them like a register allocator. Only outputs released within a
+         * run share memory, so intermediate release must be on (see SetIntermediateRelease()); images of other
+         * nodes, and any image that does not fit its placement at run time, come from the image pool as before.
+         *
+         * @param sourceShapes As for InferImageShapes()
+         * @return The plan (empty without intermediate release or known shapes)
+         * @note Replaces any earlier plan. Graph edits leave the plan in place; placements stay safe but may
+         *       fall back to the pool more often until it is planned again.
+         */
+        MemoryPlan PlanImageMemory(const std::unordered_map<NodeId, ImageShape> &sourceShapes = {});
+
+        /**
+         * @brief Drops the memory plan; every node allocates from the image pool again.
+         * @note The slab is freed once the last image placed in it is released.
+         */
+        void ClearImageMemoryPlan();
+
+        /**
+         * @brief Returns placement counters of the current memory plan.
+         * @return Counters, or std::nullopt without a plan
+         */
+        [[nodiscard]] std::optional<ImageSlab::Statistics> GetImageSlabStatistics() const;
+
+        /**
+         * @brief Returns the cache nodes share gray, float and integral images of their inputs through.
+         * @return Reference to the cache
+         * @note Cleared after every run and every stream segment.
+         */
+        [[nodiscard]] DerivedImageCache &GetDerivedImageCache();
+
+        /**
+         * @brief Returns the progress of the current or last run, for polling once per UI frame.
+         * @return Channel updated lock-free by every run in both execution modes
+         * @note Cheaper than a progress callback: no strings are built and no lock is taken per node.
+         */
+        [[nodiscard]] const ProgressChannel &GetProgressChannel() const;
+
+        /**
+         * @brief Returns per-run execution statistics (node timings, cache hits, skipped nodes).
+         * @return History recorded by every Execute() call, including failed and cancelled runs
+         * @note Stream runs are not recorded.
+         */
+        [[nodiscard]] ExecutionStatisticsHistory &GetExecutionStatistics();
+
+        /**
+         * @brief Returns per-run execution statistics.
+         * @return History recorded by every Execute() call
+         */
+        [[nodiscard]] const ExecutionStatisticsHistory &GetExecutionStatistics() const;
+
+        /**
+         * @brief Serializes graph, slot defaults and node positions to file.
+         * @param filepath Path to save file; a ".vcgb" extension selects the binary format, anything else JSON
+         * @param nodePositions Map of node IDs to positions (x,y coordinates)
+         * @return True if succeeded
+         * @note Defaults holding images are not saved. The binary format (GraphBinaryFormat.h) also keeps
+         *       connection types and is the one to use for large generated graphs.
+         */
+        bool SaveToFile(const std::filesystem::path &filepath,
+            const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const;
+
+        /**
+         * @brief Copies what SaveToFile() writes, holding graphMutex only for the copy.
+         * @param nodePositions Map of node IDs to positions (x,y coordinates)
+         * @return Snapshot to pass to WriteSaveSnapshot(), on any thread
+         */
+        [[nodiscard]] std::shared_ptr<const GraphSaveSnapshot> CaptureSaveSnapshot(
+            const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const;
+
+        /**
+         * @brief Serializes a snapshot to file, in the format SaveToFile() picks from the extension.
+         * @param graph Snapshot taken by CaptureSaveSnapshot()
+         * @param filepath Path to save file
+         * @return True if succeeded
+         */
+        static bool WriteSaveSnapshot(const GraphSaveSnapshot &graph, const std::filesystem::path &filepath);
+
+        /**
+         * @brief Saves like SaveToFile(), serializing and writing on a WriteBehindQueue worker.
+         *
+         * Only the snapshot is taken on the calling thread. The file is written under a temporary name
+         * (Constants::Persistence::kPartialFileMarker before the extension) and renamed over filepath, so
+         * an interrupted save leaves the previous file intact.
+         *
+         * @param filepath Path to save file
+         * @param nodePositions Map of node IDs to positions (x,y coordinates)
+         * @return Future of the save's result
+         */
+        std::shared_future<bool> SaveToFileAsync(const std::filesystem::path &filepath,
+            const std::unordered_map<NodeId, std::pair<float, float>> &nodePositions) const;
+
+        /**
+         * @brief Deserializes graph from a JSON or binary file, detected from its first bytes.
+         * @param filepath Path to load file
+         * @param nodePositions Output map for node positions
+         * @return True if succeeded
+         * @note The file is memory-mapped and the graph is left unchanged when it is rejected. Both formats
+         *       are read straight from the mapping (JSON by a streaming GraphJsonReader, without a document
+         *       tree) and installed in one step. Binary graphs have no node count limit beyond the node ID
+         *       range; JSON graphs are limited to 10000 nodes. Saved defaults whose type no longer matches
+         *       the slot are skipped. Loaded nodes are allocated from a fresh NodeArena that replaces the
+         *       graph's arena.
+         */
+        bool LoadFromFile(const std::filesystem::path &filepath,
+            std::unordered_map<NodeId, std::pair<float, float>> &nodePositions);
+
+    private:
+        /// @brief Benchmarks time plan compilation and data passing without running whole graphs
+        friend struct NodeEditorBenchmarkAccess;
+
+        /**
+         * @brief Data connection with both slot names resolved to indices at plan build time.
+         */
+        struct InputBinding
+        {
+            size_t connectionIndex = 0;                         ///< Index into connections vector
+            const Node *producer = nullptr;                     ///< Producing node (set when a snapshot is taken)
+            SlotIndex fromSlot = 0;                             ///< Producer output slot
+            SlotIndex toSlot = 0;                               ///< Consumer input slot
+            ImageMemory imageMemory = ImageMemory::Host;        ///< Where the consumer reads images
+            ImageLayout imageLayout = ImageLayout::Interleaved; ///< Channel layout the consumer reads
+            bool acceptsChannelViews = false;                   ///< Consumer reads ChannelView inputs in place
+            bool acceptsImagePyramids = false;                  ///< Consumer reads ImagePyramid inputs
+            bool acceptsHalfFloatImages = false;                ///< Consumer reads CV_16F images unwidened
+            bool acceptsBitMasks = false;                       ///< Consumer reads BitMask inputs packed
+        };
+
+        /**
+         * @brief Execution connection into a step, resolved to the plan index of the step it comes from.
+         */
+        struct ExecutionWire
+        {
+            size_t producerStep = 0; ///< Plan index of the step the wire leaves
+            SlotName pin;            ///< Execution output pin of that step
+        };
+
+        /**
+         * @brief Execution step in cached execution plan.
+         *
+         * Represents a single "instruction" in the execution plan, containing a node to execute
+         * and the data connections that feed into it. This structure enables cache-friendly
+         * linear execution without recomputing topological sort, searching connections or
+         * hashing slot names.
+         * The dependency fields keep the DAG behind the linear order so the parallel scheduler
+         * can dispatch a step as soon as every step it depends on has finished.
+         */
+        struct ExecutionStep
+        {
+            NodeId nodeId;                              ///< Node to execute at this step
+            std::vector<InputBinding> inputs;           ///< Incoming data connections with resolved slots
+            std::vector<size_t> dependentSteps;         ///< Plan indices of steps waiting on this one
+            std::vector<size_t> dataConsumerSteps;      ///< Plan indices of steps reading this step's outputs
+            size_t dependencyCount = 0;                 ///< Number of steps this one waits on
+            std::optional<size_t> tileSuccessor;        ///< Step a tiled chain can continue into (see LinkTileChains())
+            bool readsDeviceImages = false;             ///< Inputs are placed in OpenCL or CUDA memory (never tiled)
+            std::vector<size_t> dataProducerSteps;      ///< Plan indices of steps whose outputs this one reads
+            bool releasableOutputs = false;             ///< Outputs are read only by plan steps (see AnalyzeLiveness())
+            std::vector<NodeId> prunedConsumers;        ///< Data consumers left out of a pruned plan (PruneSnapshot())
+            std::optional<size_t> aliasOf;              ///< Identical earlier step whose outputs this one shares
+            bool aliased = false;                       ///< A later identical step shares this one's outputs
+            std::vector<ExecutionWire> executionInputs; ///< Incoming execution connections
+            bool branches = false;                      ///< Node picks its execution outputs at runtime
+            bool conditional = false;                   ///< Runs only if a taken execution wire reaches it
+            std::vector<size_t> loopBody;               ///< Steps run once per element, nested ones included
+            std::optional<size_t> loopOwner;            ///< Innermost loop step running this one per element
+        };
+
+        /**
+         * @brief Part a plan step played in a tiled chain during one run.
+         */
+        enum class TileRole : uint8_t
+        {
+            None,   ///< Ran on its own, or not at all
+            First,  ///< Started a chain; its output image was not kept
+            Middle, ///< Inside a chain; its output image was not kept
+            Last    ///< Ended a chain and holds its result
+        };
+
+        /**
+         * @brief Tiling state of one Execute() run.
+         */
+        struct TiledRun
+        {
+            TilingOptions options;            ///< Settings captured when the run started
+            std::vector<TileRole> roles;      ///< Role of each plan step (written before its dependents start)
+            std::vector<uint8_t> regionSteps; ///< Nonzero for steps that ran in a region chain (as roles)
+
+            /**
+             * @brief Checks if a step already ran inside an earlier step's chain.
+             * @param index Plan index
+             * @return True if the step must not run again in this pass
+             */
+            [[nodiscard]] bool IsFused(size_t index) const
+            {
+                return roles[index] == TileRole::Middle || roles[index] == TileRole::Last;
+            }
+
+            /**
+             * @brief Checks if large images are split into tiles.
+             * @return True if tiling is enabled with a usable tile size
+             */
+            [[nodiscard]] bool TilesImages() const
+            {
+                return options.enabled && options.tileSize > 0;
+            }
+
+            /**
+             * @brief Checks if the run executes chains at all (tiled or fused).
+             * @return True if chains may replace individual steps
+             */
+            [[nodiscard]] bool RunsChains() const
+            {
+                return TilesImages() || options.fusePointwise;
+            }
+        };
+
+        /**
+         * @brief Intermediate release state of one Execute() run.
+         */
+        struct LivenessRun
+        {
+            bool enabled = false;                            ///< Release outputs after their last consumer
+            std::vector<std::atomic<size_t>> pendingReaders; ///< Consumers yet to finish, by producer plan index
+            bool spilling = false;                           ///< A MemoryBudget limit applies (enabled runs only)
+            std::mutex spillMutex;                           ///< Guards the spill members below
+            std::vector<uint64_t> spillTickets;              ///< MemoryBudget ticket by plan index (0 = in memory)
+            std::vector<size_t> pins;                        ///< Started steps still reading each step's outputs
+            std::vector<uint8_t> started;                    ///< Nonzero once a step pinned its producers
+            std::vector<uint8_t> finished;                   ///< Nonzero once a step's outputs are complete
+            std::vector<std::vector<size_t>> pinned;         ///< Producers each step pinned
+            size_t reportedBytes = 0;                        ///< Share of MemoryBudget usage reported last
+            size_t spills = 0;                               ///< Outputs spilled during the run
+        };
+
+        /**
+         * @brief Slot memory high-water mark of one Execute() run.
+         */
+        struct MemoryRun
+        {
+            std::mutex mutex;      ///< Guards the members below (workers finish steps concurrently)
+            size_t peakBytes = 0;  ///< Largest graph-wide slot total measured after a step
+            NodeId peakNodeId = 0; ///< Node of the step that reached it
+        };
+
+        /**
+         * @brief Immutable, versioned copy of the graph that execution runs against.
+         *
+         * Taken under graphMutex when a run starts and reused until the graph changes. It keeps its
+         * own references to the nodes and a copy of the connections, so edits made by the UI while
+         * nodes are processing neither block nor affect the run; they take effect on the next one.
+         */
+        struct GraphSnapshot
+        {
+            uint64_t version = 0;                                    ///< Graph version the snapshot was taken at
+            std::unordered_map<NodeId, std::shared_ptr<Node>> nodes; ///< Nodes, kept alive for the run
+            std::vector<Connection> connections;                     ///< Connections (InputBinding indices)
+            std::vector<ExecutionStep> plan;                         ///< Compiled execution plan
+            std::vector<Node *> stepNodes;                           ///< Node of each plan step
+            bool followsExecutionFlow = false;                       ///< Plan order comes from execution wires
+        };
+
+        /**
+         * @brief PullFromSinks() result, kept for the snapshot it was computed from.
+         */
+        struct PulledSnapshot
+        {
+            std::shared_ptr<const GraphSnapshot> source; ///< Snapshot that was pruned
+            std::vector<NodeId> outputs;                 ///< Explicit outputs at the time
+            std::shared_ptr<const GraphSnapshot> result; ///< Pruned snapshot (or source itself)
+        };
+
+        /**
+         * @brief Execution frame tracking current execution state.
+         *
+         * Manages the "instruction pointer" (current step index) for graph execution,
+         * implementing lookahead advancement pattern where the instruction pointer
+         * advances BEFORE node execution, not after.
+         */
+        struct ExecutionFrame
+        {
+            size_t nextInstructionIndex = 0;                          ///< Next instruction pointer (step index)
+            const ExecutionStep *currentStep = nullptr;               ///< Pointer to current step
+            std::chrono::high_resolution_clock::time_point startTime; ///< Execution start time
+
+            /**
+             * @brief Advances instruction pointer to next step (lookahead pattern).
+             *
+             * The instruction pointer advances BEFORE the node executes, not after.
+             * This "lookahead advancement" enables efficient bytecode-style execution.
+             *
+             * @param plan Execution plan to advance through
+             */
+            void AdvanceToNext(const std::vector<ExecutionStep> &plan)
+            {
+                if (nextInstructionIndex < plan.size())
+                {
+                    currentStep = &plan[nextInstructionIndex];
+                    ++nextInstructionIndex; // Lookahead advancement!
+                }
+                else
+                {
+                    currentStep = nullptr;
+                }
+            }
+
+            /**
+             * @brief Checks if execution is finished.
+             * @param plan Execution plan being executed
+             * @return True if all steps executed
+             */
+            [[nodiscard]] bool IsFinished(const std::vector<ExecutionStep> &plan) const
+            {
+                return nextInstructionIndex >= plan.size();
+            }
+        };
+
+        /**
+         * @brief Performs topological sort on node graph.
+         * @return Node IDs in execution order, or empty if cycle detected
+         */
+        [[nodiscard]] std::vector<NodeId> TopologicalSort() const;
+
+        /**
+         * @brief Builds cached execution plan from current graph topology.
+         *
+         * Performs topological sort and precomputes incoming connections for each node,
+         * enabling fast repeated execution without reanalysis. This is the "compilation"
+         * phase in the execution model.
+         *
+         * @return Vector of execution steps in dependency order
+         */
+        [[nodiscard]] std::vector<ExecutionStep> BuildExecutionPlan() const;
+
+        /**
+         * @brief Links plan steps with the execution and data edges between them.
+         *
+         * Every edge is oriented along the linear plan order, so a data wire that runs against the
+         * execution flow still observes the same value it would in sequential mode.
+         *
+         * @param plan Execution plan to annotate
+         */
+        void BuildStepDependencies(std::vector<ExecutionStep> &plan) const;
+
+        /**
+         * @brief Links steps that tiled execution can chain without building the image in between.
+         *
+         * A step continues into the step reading its "Output" slot if that is the step's only outgoing
+         * data connection, it ends at the consumer's "Input" slot, and it is the consumer's only dependency.
+         * The consumer can then run right after the step, tile by tile, without waiting for anything else.
+         *
+         * @param plan Execution plan with dependencies already built
+         */
+        void LinkTileChains(std::vector<ExecutionStep> &plan) const;
+
+        /**
+         * @brief Resolves execution connections into steps and marks the steps a branch may bypass.
+         *
+         * A step is conditional if any execution wire reaches it from a branching step or from another
+         * conditional step; plan order follows the execution wires, so one pass settles every step.
+         *
+         * @param plan Execution plan in execution flow order
+         */
+        void LinkExecutionBranches(std::vector<ExecutionStep> &plan) const;
+
+        /**
+         * @brief Collects the steps each loop step runs once per element (see Node::GetLoopBodyPin()).
+         *
+         * A step joins the body of the innermost loop all its execution wires come from: the loop's body pin,
+         * or a step already in that body. Its other pins (e.g. "Completed") continue the enclosing flow.
+         *
+         * @param plan Execution plan in execution flow order, with execution inputs resolved
+         */
+        void LinkLoopBodies(std::vector<ExecutionStep> &plan) const;
+
+        /**
+         * @brief Finds the steps whose outputs nothing reads once their consumers in the plan have run.
+         *
+         * A step's outputs are releasable if it has data consumers and every data connection leaving it ends
+         * at a plan step. Steps without consumers hold the graph's results and are never released. At run
+         * time each step counts down its consumers, and the last one to finish clears the outputs.
+         *
+         * @param plan Execution plan with dependencies already built
+         */
+        void AnalyzeLiveness(std::vector<ExecutionStep> &plan) const;
+
+        /**
+         * @brief Returns a snapshot of the current graph, compiling a new one if the graph changed.
+         * @return Snapshot, or nullptr if the plan could not be built (cycle or disconnected execution flow)
+         */
+        [[nodiscard]] std::shared_ptr<const GraphSnapshot> AcquireSnapshot();
+
+        /**
+         * @brief Marks steps that repeat an earlier step's computation (common-subexpression elimination).
+         *
+         * Two steps are duplicates if their nodes have the same type, read the same output slots of the same
+         * (or already merged) producers and hold equal unconnected inputs, so merging one propagates down a
+         * duplicated branch. A duplicate depends on and reads from the step it copies, and neither is chained.
+         *
+         * @param graph Snapshot to annotate (ExecutionStep::aliasOf, ExecutionStep::aliased)
+         */
+        static void EliminateDuplicateSteps(GraphSnapshot &graph);
+
+        /**
+         * @brief Gives a duplicate step the outputs of the step it copies, if their inputs still match.
+         * @param graph Snapshot being run
+         * @param step Step with ExecutionStep::aliasOf set, inputs already pulled
+         * @param node Node of the step
+         * @return True if the outputs were shared; false if the node must process itself
+         */
+        static bool ShareDuplicateOutputs(const GraphSnapshot &graph, const ExecutionStep &step, Node &node);
+
+        /**
+         * @brief Copies a snapshot keeping only some steps and the steps they transitively read data from.
+         *
+         * Steps keep their relative order; links to dropped steps are removed and dependency counts
+         * recounted. A step whose outputs a dropped step also reads is never released, and the dropped
+         * readers are listed in ExecutionStep::prunedConsumers so they are marked dirty if it runs.
+         *
+         * @param graph Full snapshot
+         * @param targets Plan indices of the steps to keep with their upstream cones
+         * @return Pruned snapshot at the same graph version
+         */
+        [[nodiscard]] static std::shared_ptr<const GraphSnapshot> PruneSnapshot(const GraphSnapshot &graph,
+            const std::vector<size_t> &targets);
+
+        /**
+         * @brief Prunes a snapshot to its sinks, explicit outputs and stream sources if pull-based evaluation applies.
+         * @param graph Full snapshot
+         * @return The pruned snapshot, or graph itself if the mode excludes it, it has no sinks or nothing is dead
+         */
+        [[nodiscard]] std::shared_ptr<const GraphSnapshot> PullFromSinks(
+            std::shared_ptr<const GraphSnapshot> graph) const;
+
+        /**
+         * @brief Prunes a snapshot to its sinks, explicit outputs and stream sources (PullFromSinks() work).
+         * @param graph Full snapshot
+         * @param explicitOutputs Nodes declared as outputs besides the sinks
+         * @return The pruned snapshot, or graph itself if it has no sinks or nothing is dead
+         */
+        [[nodiscard]] static std::shared_ptr<const GraphSnapshot> PruneToSinks(
+            const std::shared_ptr<const GraphSnapshot> &graph,
+            const std::unordered_set<NodeId> &explicitOutputs);
+
+        /**
+         * @brief Runs the whole graph (shared by Execute() and ExecuteFullResolution()).
+         * @param progressCallback Optional callback for progress updates
+         * @param stopToken Token to check for cancellation requests
+         * @param scale Proxy scale to run at (1 = full resolution)
+         * @return True if succeeded
+         */
+        bool ExecuteAtScale(const ExecutionProgressCallback &progressCallback, std::stop_token stopToken, double scale);
+
+        /**
+         * @brief Runs a snapshot and records its statistics (shared by Execute() and ExecuteUpTo()).
+         * @param graph Snapshot to run
+         * @param progressCallback Optional callback for progress updates
+         * @param stopToken Token to check for cancellation requests
+         * @param targetNode Node the plan was pruned to, if any
+         * @param scale Proxy scale to run at (1 = full resolution)
+         * @return True if every step succeeded
+         * @note Caller must hold executionMutex.
+         */
+        bool RunSnapshot(const GraphSnapshot &graph,
+            const ExecutionProgressCallback &progressCallback,
+            std::stop_token stopToken,
+            std::optional<NodeId> targetNode,
+            double scale);
+
+        /**
+         * @brief Hands the run's proxy scale to every planned node, marking those that last ran at another dirty.
+         * @param graph Snapshot about to run
+         * @param scale Proxy scale of the run (1 = full resolution)
+         * @note Caller must hold executionMutex, so no node is processing.
+         */
+        static void ApplyProxyScale(const GraphSnapshot &graph, double scale);
+
+        /**
+         * @brief Hands the graph's depth policy to every planned node, marking those that last ran under another dirty.
+         * @param graph Snapshot about to run
+         * @param policy Editor's policy
+         * @note Caller must hold executionMutex, so no node is processing.
+         */
+        static void ApplyPrecisionPolicy(const GraphSnapshot &graph, PrecisionPolicy policy);
+
+        /**
+         * @brief Runs plan sequentially on the calling thread.
+         * @param graph Snapshot to execute
+         * @param progressCallback Optional callback for progress updates
+         * @param stop Cancellation and deadline of this run
+         * @param records Receives the outcome of each step (one record per plan step)
+         * @param tiled Tiling settings and chain roles of this run
+         * @param liveness Consumer countdown for releasing intermediates
+         * @param memory Slot memory high-water mark of this run
+         * @return True if all steps succeeded
+         */
+        bool ExecuteSequential(const GraphSnapshot &graph,
+            const ExecutionProgressCallback &progressCallback,
+            const StopCondition &stop,
+            std::vector<NodeExecutionRecord> &records,
+            TiledRun &tiled,
+            LivenessRun &liveness,
+            MemoryRun &memory);
+
+        /**
+         * @brief Runs plan on the thread pool, dispatching steps whose dependencies have completed.
+         * @param graph Snapshot to execute
+         * @param progressCallback Optional callback for progress updates (serialized across workers)
+         * @param stop Cancellation and deadline of this run
+         * @param records Receives the outcome of each step (each worker writes only its step's record)
+         * @param tiled Tiling settings and chain roles of this run
+         * @param liveness Consumer countdown for releasing intermediates
+         * @param memory Slot memory high-water mark of this run
+         * @return True if all steps succeeded
+         */
+        bool ExecuteParallel(const GraphSnapshot &graph,
+            const ExecutionProgressCallback &progressCallback,
+            const StopCondition &stop,
+            std::vector<NodeExecutionRecord> &records,
+            TiledRun &tiled,
+            LivenessRun &liveness,
+            MemoryRun &memory);
+
+        /**
+         * @brief Completes per-step records with node details and adds the run to the history.
+         * @param graph Snapshot the run executed
+         * @param run Statistics with one record per plan step
+         */
+        void RecordRunStatistics(const GraphSnapshot &graph, RunStatistics run);
+
+        /**
+         * @brief Runs up to frameCount stream frames one after another on the calling thread.
+         * @param graph Snapshot to execute
+         * @param firstFrame Stream frame number of the first frame in this segment
+         * @param frameCount Maximum frames to run
+         * @param frameCallback Optional per-frame callback
+         * @param stop Cancellation of the stream
+         * @param streamEnded Set when a source ran out of frames or the callback ended the stream
+         * @return Frames completed, or std::nullopt if a node threw
+         */
+        std::optional<size_t> ExecuteStreamSegmentSequential(const GraphSnapshot &graph,
+            size_t firstFrame,
+            size_t frameCount,
+            const StreamFrameCallback &frameCallback,
+            const StopCondition &stop,
+            bool &streamEnded);
+
+        /**
+         * @brief Runs up to frameCount stream frames with consecutive frames overlapping on the thread pool.
+         *
+         * A step starts frame F once it finished frame F-1, the steps it depends on finished frame F, and every
+         * step reading its outputs has pulled frame F-1. Steps without dependents wait until frame F-1 has been
+         * reported, so the frame callback sees consistent results there.
+         *
+         * @param graph Snapshot to execute
+         * @param firstFrame Stream frame number of the first frame in this segment
+         * @param frameCount Maximum frames to run
+         * @param frameCallback Optional per-frame callback (serialized, in frame order)
+         * @param stop Cancellation of the stream
+         * @param streamEnded Set when a source ran out of frames or the callback ended the stream
+         * @return Frames completed, or std::nullopt if a node threw
+         */
+        std::optional<size_t> ExecuteStreamSegmentPipelined(const GraphSnapshot &graph,
+            size_t firstFrame,
+            size_t frameCount,
+            const StreamFrameCallback &frameCallback,
+            const StopCondition &stop,
+            bool &streamEnded);
+
+        /**
+         * @brief Pulls incoming data into node and processes it.
+         *
+         * On success the node is marked clean and every step consuming its outputs is marked dirty.
+         *
+         * @param graph Snapshot the step belongs to
+         * @param step Plan step to run
+         * @param node Node belonging to step
+         * @param stop Condition Process() polls (see Node::ThrowIfStopRequested())
+         * @param inputsPulled Optional hook invoked once inputs are copied in and the dirty flag is cleared
+         * @param record Optional record receiving outcome, processing time and data pass count
+         * @return Processing time, or std::nullopt if the node threw or stopped early
+         */
+        std::optional<std::chrono::microseconds> RunExecutionStep(const GraphSnapshot &graph,
+            const ExecutionStep &step,
+            Node &node,
+            const StopCondition &stop,
+            const std::function<void()> &inputsPulled = nullptr,
+            NodeExecutionRecord *record = nullptr) const;
+
+        /**
+         * @brief Pulls a step's inputs and processes its node inside the bound ExecutionContext.
+         * @param graph Snapshot the step belongs to
+         * @param step Plan step to run
+         * @param node Node belonging to step
+         * @param error Receives a description of the failure
+         * @return True if the node processed without throwing
+         */
+        static bool RunContextStep(const GraphSnapshot &graph,
+            const ExecutionStep &step,
+            Node &node,
+            std::string &error);
+
+        /**
+         * @brief Ranks steps for critical-path scheduling.
+         * @param graph Snapshot to rank
+         * @return Per-step priority, higher first: remaining critical path in microseconds, with steps feeding a
+         *         visible node ranked above all others (empty when critical-path scheduling is off)
+         */
+        [[nodiscard]] std::vector<double> RankSteps(const GraphSnapshot &graph) const;
+
+        /**
+         * @brief Image a region chain starts from: one in memory, or a deferred output read by region.
+         */
+        struct RegionInput
+        {
+            ImageShape shape;                              ///< Size and type of the whole image
+            std::function<cv::Mat(const cv::Rect &)> read; ///< Returns the pixels of a region of it
+            bool deferred = false;                         ///< Not in memory, so even a lone region node reads it
+        };
+
+        /**
+         * @brief Runs the tiled or fused chain starting at a step, if either applies there.
+         *
+         * Each tile is cut from the first node's input with the chain's combined halo, passed through every
+         * node's TileOperation (trimming context that is no longer needed after each one) and copied into
+         * the last node's output image. Tiles run in parallel. Images below the tiling threshold still run
+         * the chain's leading pointwise nodes, if there are at least two, as full-width row strips of about
+         * kFusedStripBytes. If a tile throws, the chain's nodes are marked dirty and run normally, so each
+         * one handles the error as its Process() would. Remaining tiles are skipped once the run is stopped.
+         *
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the chain's first step
+         * @param tiled Settings and roles of this run; roles of the chain's steps are filled in
+         * @param stop Cancellation and deadline of this run, checked before each tile
+         * @param records Receives the outcome of every step in the chain
+         * @return Whether the chain succeeded, or std::nullopt if the step should run normally
+         */
+        std::optional<bool> RunTiledChain(const GraphSnapshot &graph,
+            size_t index,
+            TiledRun &tiled,
+            const StopCondition &stop,
+            std::vector<NodeExecutionRecord> &records) const;
+
+        /**
+         * @brief Runs a chain only on the region its last node reads, if the chain ends in such a node.
+         *
+         * The region is mapped back through the chain, each node widening it by its halo and dividing it by
+         * its scale, and the first node's input is cut to the result with a cv::Mat ROI header (or, for an
+         * output its producer deferred, read by region; see Node::GetDeferredOutputShape()). Each node then
+         * processes the region it was given and the part the next node needs is kept. The chain stops at the
+         * first node declaring an input region (see Node::GetInputRegion()), whose output is set to the region.
+         *
+         * @param graph Snapshot the chain belongs to
+         * @param chain Plan indices the chain may reach, starting with its first step
+         * @param input Image of the first step's "Input" slot (inputs already pulled)
+         * @param tiled Roles of this run; roles of the chain's steps are filled in
+         * @param stop Cancellation and deadline of this run, checked before each node
+         * @param records Receives the outcome of every step in the chain
+         * @return Whether the chain succeeded, or std::nullopt if no region chain starts here or it failed and
+         *         the steps should run normally
+         */
+        std::optional<bool> RunRegionChain(const GraphSnapshot &graph,
+            const std::vector<size_t> &chain,
+            const RegionInput &input,
+            TiledRun &tiled,
+            const StopCondition &stop,
+            std::vector<NodeExecutionRecord> &records) const;
+
+        /**
+         * @brief Records a finished chain: roles, outcomes, the last node's output and discarded intermediates.
+         * @param graph Snapshot the chain belongs to
+         * @param chain Plan indices of the steps that ran in the chain
+         * @param durations Time spent in each step's operation
+         * @param tiled Roles of this run; roles of the chain's steps are filled in
+         * @param records Receives the outcome of every step in the chain
+         * @param output Result of the chain, stored in the last node's "Output" slot
+         */
+        static void CompleteChain(const GraphSnapshot &graph,
+            const std::vector<size_t> &chain,
+            const std::vector<std::chrono::microseconds> &durations,
+            TiledRun &tiled,
+            std::vector<NodeExecutionRecord> &records,
+            cv::Mat output);
+
+        /**
+         * @brief Marks nodes dirty whose output a tiled run discarded, unless this run can rebuild it.
+         *
+         * A discarded node stays clean only while it still starts or continues a chain; its chain's
+         * first step then re-runs the chain whenever a later node in it is dirty.
+         *
+         * @param graph Snapshot about to run
+         * @param chainsEnabled Whether the run executes tiled or fused chains at all
+         * @param regionsEnabled Whether the run executes region chains
+         */
+        void ReleaseDiscardedTileOutputs(const GraphSnapshot &graph, bool chainsEnabled, bool regionsEnabled);
+
+        /**
+         * @brief Records which nodes' outputs the finished run kept and which it discarded.
+         * @param graph Snapshot the run executed
+         * @param tiled Chain roles of the run
+         * @param records Outcome of each step
+         */
+        void TrackDiscardedTileOutputs(const GraphSnapshot &graph,
+            const TiledRun &tiled,
+            const std::vector<NodeExecutionRecord> &records);
+
+        /**
+         * @brief Checks if step can be skipped because its node is clean.
+         * @param node Node belonging to step
+         * @return True if incremental execution is enabled and node is not dirty
+         */
+        [[nodiscard]] bool CanSkipStep(const Node &node) const;
+
+        /**
+         * @brief Checks if a conditional step lies on execution paths no branch took in this run.
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the step
+         * @param bypassed Tells whether an earlier step of this run was bypassed
+         * @return True if no execution wire into the step comes from a step that ran and took it
+         * @note Every execution producer of the step must have finished.
+         */
+        [[nodiscard]] static bool IsStepBypassed(const GraphSnapshot &graph,
+            size_t index,
+            const std::function<bool(size_t)> &bypassed);
+
+        /**
+         * @brief Drops a bypassed step's outputs, so nothing downstream reads a result from an earlier run.
+         * @param graph Snapshot the step belongs to
+         * @param step Bypassed step
+         * @param node Node belonging to step
+         * @note The node is marked dirty, so it runs again once a branch takes the path to it.
+         */
+        static void BypassStep(const GraphSnapshot &graph, const ExecutionStep &step, Node &node);
+
+        /**
+         * @brief Runs a loop step and then its body once per element.
+         *
+         * Skipped as a whole when the loop node and every body node are clean. Body nodes are left holding the
+         * last element's outputs, and steps after the loop reading them are marked dirty.
+         *
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the loop step
+         * @param node Node belonging to step
+         * @param stop Condition checked between iterations and passed to the nodes
+         * @param records Records of the run (nullptr for stream runs), written for the loop and its body
+         * @return False if the loop node or an iteration failed or the run was stopped
+         */
+        bool RunLoopStep(const GraphSnapshot &graph,
+            size_t index,
+            Node &node,
+            const StopCondition &stop,
+            std::vector<NodeExecutionRecord> *records);
+
+        /**
+         * @brief Runs a processed loop node's body once per element, each iteration in its own ExecutionContext.
+         *
+         * Outputs the body reads from outside are captured once in the calling scope and shared into every
+         * iteration, so the compiled plan and the graph's slots are reused without copying or rebuilding.
+         * Iterations run concurrently unless the node asks otherwise; nested loops run inside their iteration.
+         *
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the loop step
+         * @param node Node belonging to step (already processed)
+         * @param stop Condition checked before every body step
+         * @param error Receives a description of the first failure
+         * @return Number of iterations, or std::nullopt if one failed or the run was stopped
+         */
+        [[nodiscard]] static std::optional<size_t> RunLoopIterations(const GraphSnapshot &graph,
+            size_t index,
+            Node &node,
+            const StopCondition &stop,
+            std::string &error);
+
+        /**
+         * @brief Drops data a finished step no longer needs: its connected inputs (unless it holds results),
+         *        and the outputs of producers it was the last consumer of.
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the finished step (processed, skipped, cached or run in a chain)
+         * @param liveness Consumer countdown of this run
+         * @note Released producers are marked dirty so that the next run rebuilds their outputs.
+         */
+        static void ReleaseConsumedData(const GraphSnapshot &graph, size_t index, LivenessRun &liveness);
+
+        /**
+         * @brief Accounts the slot memory of a finished step, releases the data it consumed, then enforces the
+         *        MemoryBudget.
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the finished step
+         * @param record Receives the bytes held in the step node's slots
+         * @param liveness Consumer countdown of this run
+         * @param memory Updated when the graph-wide slot total reaches a new peak
+         * @note Measured before the release, while the step's inputs and outputs are both alive.
+         */
+        void FinishStep(const GraphSnapshot &graph,
+            size_t index,
+            NodeExecutionRecord &record,
+            LivenessRun &liveness,
+            MemoryRun &memory) const;
+
+        /**
+         * @brief Pins the producers a step is about to read and reads back the outputs of spilled ones.
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the step (its tiled chain's later steps are covered too)
+         * @param liveness Spill state of this run
+         * @return False if spilled outputs could not be read back (the step must not run)
+         * @note Call before the step pulls its inputs, whether it then runs, is skipped or ran in a chain.
+         */
+        static bool FaultInProducers(const GraphSnapshot &graph, size_t index, LivenessRun &liveness);
+
+        /**
+         * @brief Reports this run's slot and output cache bytes to the MemoryBudget and, while the process is
+         *        over the limit, trims the output cache and spills finished intermediates to disk.
+         * @param graph Snapshot of the run
+         * @param liveness Spill state of this run
+         * @note Spills the intermediates whose next consumer comes last in the plan first. Pinned, aliased and
+         *       result outputs stay in memory.
+         */
+        void EnforceMemoryBudget(const GraphSnapshot &graph, LivenessRun &liveness) const;
+
+        /**
+         * @brief Writes a finished step's outputs to the scratch directory and clears its output slots.
+         * @param graph Snapshot the step belongs to
+         * @param index Plan index of the step
+         * @param liveness Spill state of this run (spillMutex held)
+         * @return In-memory bytes of the spilled outputs (0 if nothing was spilled)
+         */
+        static size_t SpillStepOutputs(const GraphSnapshot &graph, size_t index, LivenessRun &liveness);
+
+        /**
+         * @brief Deletes spills no step read back (after a failed or stopped run) and withdraws the run's
+         *        MemoryBudget usage.
+         * @param graph Snapshot of the run
+         * @param liveness Spill state of this run
+         * @note Nodes whose spills are deleted are marked dirty, like released ones.
+         */
+        static void DiscardSpilledOutputs(const GraphSnapshot &graph, LivenessRun &liveness);
+
+        /**
+         * @brief Sums the bytes held in the slots of every node in the snapshot.
+         * @param graph Snapshot to measure
+         * @return Total bytes, counting data shared between slots once
+         */
+        [[nodiscard]] static size_t MeasureSlotBytes(const GraphSnapshot &graph);
+
+        /**
+         * @brief Marks nodes reading the step's outputs as dirty.
+         * @param graph Snapshot the step belongs to
+         * @param step Step whose outputs changed
+         */
+        static void MarkDataConsumersDirty(const GraphSnapshot &graph, const ExecutionStep &step);
+
+        /**
+         * @brief Re-marks nodes whose connections were edited while a run used an older snapshot.
+         *
+         * Edits mark the affected nodes dirty immediately, but the running snapshot may then process
+         * those nodes and clear the flag with results from the old graph.
+         *
+         * @param graph Snapshot the finished run executed
+         */
+        void MarkNodesEditedDuringRun(const GraphSnapshot &graph);
+
+        /**
+         * @brief Invalidates cached execution plan, forcing recompilation on next execute.
+         *
+         * Called automatically when graph structure changes (add/remove nodes/connections).
+         * This implements the invalidation phase of the cache-aside pattern: the graph version
+         * moves on, so the next run takes a fresh snapshot.
+         */
+        void InvalidateExecutionPlan();
+
+        /**
+         * @brief Replaces whole graph under one lock, with a single plan invalidation.
+         * @param newNodes Nodes to install
+         * @param newConnections Connections in insertion order, between nodes in newNodes; a later connection
+         *        replaces an earlier one into the same slot, as with AddConnection()
+         * @note Bulk counterpart of Clear() plus AddNode()/AddConnection(), which are linear per connection.
+         */
+        void ReplaceGraph(std::unordered_map<NodeId, std::shared_ptr<Node>> newNodes,
+            std::vector<Connection> newConnections);
+
+        /**
+         * @brief Writes a snapshot in the binary format.
+         * @param graph Snapshot to write
+         * @param filepath Destination file
+         * @return True if written
+         */
+        static bool WriteBinaryGraph(const GraphSaveSnapshot &graph, const std::filesystem::path &filepath);
+
+        /**
+         * @brief Replaces graph with a binary graph.
+         * @param bytes Mapped file contents
+         * @param nodePositions Output map for node positions
+         * @return True if loaded; the graph is left unchanged when the file is rejected
+         */
+        bool LoadBinaryGraph(std::span<const std::byte> bytes,
+            std::unordered_map<NodeId, std::pair<float, float>> &nodePositions);
+
+        /**
+         * @brief Replaces graph with a JSON graph.
+         * @param bytes Mapped file contents
+         * @param nodePositions Output map for node positions
+         * @return True if loaded; the graph is left unchanged when the file is rejected
+         */
+        bool LoadJsonGraph(std::span<const std::byte> bytes,
+            std::unordered_map<NodeId, std::pair<float, float>> &nodePositions);
+
+        /**
+         * @brief Adds a new node to the maintained plan, or invalidates it if that is not possible.
+         * @param id Node just added to nodes
+         * @param replaced True if the node replaced one with the same ID
+         * @note Caller must hold graphMutex.
+         */
+        void PatchPlanForAddedNode(NodeId id, bool replaced);
+
+        /**
+         * @brief Updates the maintained plan after one data connection was replaced or removed.
+         *
+         * Shifts the connection indices past the erased one, moves the affected steps with a local
+         * reordering if the new edge runs against the plan order (legacy data-flow plans only), and
+         * recomputes the dependencies, inputs, liveness and tile links of the steps at both ends.
+         * Anything else (execution wires, cycles, dangling endpoints) invalidates the plan instead.
+         *
+         * @param erased Index the removed connection had, if one was removed
+         * @param erasedConnection Connection that was removed (valid if erased is set)
+         * @param added True if a connection was appended to connections
+         * @note Caller must hold graphMutex and have already updated connections.
+         */
+        void PatchPlanForDataConnection(std::optional<size_t> erased,
+            const Connection &erasedConnection,
+            bool added);
+
+        /**
+         * @brief Moves steps so that the edge from -> to runs forward in a legacy data-flow plan.
+         *
+         * Only the steps between the two ends that are reachable from "to" or reach "from" move (the
+         * Pearce-Kelly dynamic topological order), keeping their relative order.
+         *
+         * @param from Producer step index (after to)
+         * @param to Consumer step index
+         * @return False if the edge closes a cycle
+         * @note Caller must hold graphMutex.
+         */
+        bool ReorderPlanForEdge(size_t from, size_t to);
+
+        /**
+         * @brief Recomputes the dependency and data links between two planned nodes from connections.
+         * @param from Producer node of an edited connection
+         * @param to Consumer node of an edited connection
+         * @note Caller must hold graphMutex.
+         */
+        void RelinkPlanSteps(NodeId from, NodeId to);
+
+        /**
+         * @brief Recomputes one step's resolved inputs from the data connections ending at its node.
+         * @param index Plan index of the step
+         * @note Caller must hold graphMutex.
+         */
+        void ResolvePlanStepInputs(size_t index);
+
+        /**
+         * @brief Recomputes the tile links into the steps an edit can have affected.
+         * @param nodeIds Nodes at the ends of edited connections
+         * @note Caller must hold graphMutex.
+         */
+        void RelinkPlanTileChains(const std::vector<NodeId> &nodeIds);
+
+        /**
+         * @brief Checks if a tiled chain can continue from a producer step into a consumer step.
+         * @param plan Execution plan with dependencies already built
+         * @param producer Plan index of the producer
+         * @param consumer Plan index of the consumer
+         * @param connection Consumer's only data input
+         * @param producerDataOutputs Number of data connections leaving the producer
+         * @return True if LinkTileChains() links the two steps
+         */
+        [[nodiscard]] static bool CanChainTiles(const std::vector<ExecutionStep> &plan,
+            size_t producer,
+            size_t consumer,
+            const Connection &connection,
+            size_t producerDataOutputs);
+
+        /**
+         * @brief Finds the plan index of a node in the maintained plan.
+         * @param id Node ID
+         * @return Plan index, or nullopt if the node is not planned
+         * @note Caller must hold graphMutex.
+         */
+        [[nodiscard]] std::optional<size_t> FindPlanStep(NodeId id) const;
+
+        /**
+         * @brief Resolves a step's incoming data connections to slot indices.
+         * @param step Step whose inputs are filled in
+         * @param connectionIndices Indices of the data connections ending at the step's node
+         * @note Connections naming a missing slot or joining mismatched slot types are logged once here and
+         *       skipped during execution.
+         */
+        void ResolveStepInputs(ExecutionStep &step, const std::vector<size_t> &connectionIndices) const;
+
+        /**
+         * @brief Compares the declared types of the slots a connection joins (graphMutex held).
+         * @param connection Connection to check
+         * @return Description of the mismatch, or std::nullopt if compatible or a node or slot is missing
+         */
+        [[nodiscard]] std::optional<std::string> DescribeTypeMismatch(const Connection &connection) const;
+
+        /**
+         * @brief Shares every upstream output feeding a step into its node's input slots.
+         * @param graph Snapshot the step belongs to
+         * @param step Plan step whose inputs are pulled
+         * @param node Node belonging to step
+         * @param record Optional record counting the data passes
+         */
+        static void PullStepInputs(const GraphSnapshot &graph,
+            const ExecutionStep &step,
+            Node &node,
+            NodeExecutionRecord *record);
+
+        /**
+         * @brief Passes data between nodes using slot system.
+         * @param fromNode Source node
+         * @param toNode Destination node
+         * @param connection Connection being followed (slot names for logging)
+         * @param binding Resolved slot indices of the connection
+         */
+        static void PassDataBetweenNodes(const Node &fromNode,
+            Node &toNode,
+            const Connection &connection,
+            const InputBinding &binding);
+
+        /**
+         * @brief Tells the connection observer about an edit.
+         * @param delta Connections the edit removed and added
+         * @note Call without holding graphMutex, so the observer may read the graph freely. Inside a
+         *       transaction the delta is folded into the one reported at commit.
+         */
+        void NotifyConnectionsChanged(const ConnectionDelta &delta);
+
+        /**
+         * @brief Tells the run observer that an asynchronous run finished.
+         * @param succeeded Result of the run
+         * @return succeeded, so job lambdas can return it directly
+         */
+        bool NotifyRunFinished(bool succeeded) const;
+
+        std::unordered_map<NodeId, std::shared_ptr<Node>> nodes; ///< Node storage (shared with snapshots)
+        std::vector<Connection> connections;                     ///< Connections
+        NodeId nextId;                                           ///< Next available ID
+
+        mutable std::recursive_mutex graphMutex;          ///< Guards graph structure, never held while nodes run
+        std::mutex executionMutex;                        ///< Serializes executions
+        std::stop_source stopSource;                      ///< Source for cancellation requests
+        std::shared_future<bool> currentExecution;        ///< Handle to current async execution
+        uint64_t graphVersion = 0;                        ///< Bumped on every structure change
+        std::shared_ptr<const GraphSnapshot> snapshot;    ///< Latest snapshot (guarded by graphMutex)
+        mutable PulledSnapshot pulled;                    ///< Latest pull-based pruning (graphMutex)
+        TiledRun tiledRun;                                ///< Reused by each run (executionMutex)
+        LivenessRun livenessRun;                          ///< Reused by each run (executionMutex)
+        mutable std::shared_ptr<const GraphView> view;    ///< Latest graph view (graphMutex)
+        std::vector<ExecutionStep> maintainedPlan;        ///< Plan kept in step with edits (graphMutex)
+        std::unordered_map<NodeId, size_t> planStepIndex; ///< Plan index of each planned node (graphMutex)
+        bool planCurrent = false;                         ///< Plan matches the graph (else next run rebuilds)
+        bool planFollowsExecutionFlow = false;            ///< Plan order comes from execution wires
+        ExecutionPlanStatistics planStatistics;           ///< Rebuild and patch counters (graphMutex)
+        ConnectionObserver connectionObserver;            ///< Told about connection edits (graphMutex)
+        RunFinishedObserver runFinishedObserver;          ///< Told about finished async runs (graphMutex)
+        size_t transactionDepth = 0;                      ///< Open BeginTransaction() calls (graphMutex)
+        bool transactionInvalidated = false;              ///< Plan invalidated since the transaction began
+        ConnectionDelta transactionDelta;                 ///< Connection edits reported at commit (graphMutex)
+
+        std::atomic<ExecutionMode> executionMode = ExecutionMode::Sequential; ///< Scheduling strategy for Execute()
+        std::atomic<bool> incrementalExecution = true;                        ///< Skip clean nodes during Execute()
+        std::atomic<bool> outputCacheEnabled = true;                          ///< Reuse outputs for repeated inputs
+        std::atomic<bool> intermediateRelease = false;                        ///< Drop outputs after last consumer
+        std::atomic<PullEvaluation> pullEvaluation{};                         ///< Pruned graphs (DataFlowGraphs)
+        std::atomic<std::chrono::milliseconds> executionTimeout{};            ///< Per-run limit (zero = none)
+        std::atomic<double> proxyScale = 1.0;                                 ///< Scale of Execute() runs (1 = full)
+        std::atomic<PrecisionPolicy> precisionPolicy{};                       ///< Intermediate depths of all runs
+        mutable NodeOutputCache outputCache;                                  ///< Keyed by input content (thread-safe)
+        mutable ColorLutCache colorLuts;                                      ///< Tables of fused chains (thread-safe)
+        std::shared_ptr<ImageBufferPool> imagePool;                           ///< Shared by all nodes (thread-safe)
+        std::shared_ptr<ImageSlab> imageSlab;                                 ///< Current memory plan (graphMutex)
+        std::shared_ptr<DerivedImageCache> derivedImages;                     ///< Shared within a run (thread-safe)
+        std::shared_ptr<NodeArena> nodeArena;                                 ///< Backs this graph's nodes (graphMutex)
+        ExecutionStatisticsHistory executionStatistics;                       ///< Recent runs (thread-safe)
+        NodeCostModel nodeCosts;                                              ///< Smoothed step times (thread-safe)
+        std::atomic<bool> criticalPathScheduling = true;                      ///< Rank ready steps in parallel runs
+        std::unordered_set<NodeId> visibleNodes;                              ///< Ranked first (graphMutex)
+        ProgressChannel progressChannel;                                      ///< Latest run progress (lock-free)
+        TilingOptions tilingOptions;                                          ///< Tiled execution (graphMutex)
+        bool deviceExecution = false;                                         ///< cv::UMat between nodes (graphMutex)
+        std::unordered_set<std::string> hostOnlyNodeTypes;                    ///< Kept off the device (graphMutex)
+        std::vector<NodeId> outputNodes;                                      ///< Explicit outputs (graphMutex)
+        bool duplicateElimination = false;                                    ///< Merge identical steps (graphMutex)
+        std::unordered_set<NodeId> discardedTileOutputs;                      ///< Unkept chain outputs (executionMutex)
+        std::unordered_set<NodeId> discardedRegionOutputs;                    ///< Unkept region outputs (likewise)
+        std::shared_ptr<ExecutorService> executor;                            ///< Runs jobs and steps (declared last)
+    };
+
+    /**
+     * @brief Scoped NodeEditor transaction: begins on construction and commits on destruction.
+     */
+    class GraphTransaction
+    {
+    public:
+        explicit GraphTransaction(NodeEditor &editor) : editor(editor)
+        {
+            editor.BeginTransaction();
+        }
+
+        ~GraphTransaction()
+        {
+            editor.CommitTransaction();
+        }
+
+        GraphTransaction(const GraphTransaction &) = delete;
+        GraphTransaction &operator=(const GraphTransaction &) = delete;
+
+    private:
+        NodeEditor &editor; ///< Editor the transaction batches
     };
 
 } // namespace VisionCraft::Nodes
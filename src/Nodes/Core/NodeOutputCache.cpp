@@ -0,0 +1,652 @@
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/RunLengthCodec.h"
+
+#include <bit>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        constexpr uint64_t kGoldenRatio = 0x9E3779B97F4A7C15ull;
+
+        uint64_t Combine(uint64_t hash, uint64_t value)
+        {
+            hash ^= value + kGoldenRatio + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+
+        // Word-at-a-time multiply/xorshift hash; fast enough to fingerprint full frames
+        uint64_t HashBytes(const void *data, size_t size, uint64_t hash)
+        {
+            const auto *bytes = static_cast<const unsigned char *>(data);
+            size_t offset = 0;
+            for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + offset, sizeof(word));
+                hash = (hash ^ word) * kGoldenRatio;
+                hash ^= hash >> 29;
+            }
+
+            uint64_t tail = 0;
+            std::memcpy(&tail, bytes + offset, size - offset);
+            hash = (hash ^ tail ^ size) * kGoldenRatio;
+            return hash ^ (hash >> 32);
+        }
+
+        uint64_t HashString(const std::string &value, uint64_t hash)
+        {
+            return HashBytes(value.data(), value.size(), hash);
+        }
+
+        uint64_t HashMat(const cv::Mat &mat)
+        {
+            uint64_t hash = Combine(static_cast<uint64_t>(mat.rows), static_cast<uint64_t>(mat.cols));
+            hash = Combine(hash, static_cast<uint64_t>(mat.type()));
+            if (mat.empty())
+            {
+                return hash;
+            }
+
+            const size_t rowBytes = static_cast<size_t>(mat.cols) * mat.elemSize();
+            if (mat.isContinuous())
+            {
+                return HashBytes(mat.ptr(0), rowBytes * static_cast<size_t>(mat.rows), hash);
+            }
+
+            for (int row = 0; row < mat.rows; ++row)
+            {
+                hash = HashBytes(mat.ptr(row), rowBytes, hash);
+            }
+            return hash;
+        }
+
+        // Hashes the channel's elements row by row, so a view and its compact copy share one fingerprint
+        uint64_t HashChannel(const ChannelView &view)
+        {
+            const cv::Mat &source = view.source;
+            uint64_t hash = Combine(static_cast<uint64_t>(source.rows), static_cast<uint64_t>(source.cols));
+            hash = Combine(hash, static_cast<uint64_t>(source.depth()));
+            if (source.empty())
+            {
+                return hash;
+            }
+
+            const size_t elementBytes = source.elemSize1();
+            const size_t pixelBytes = source.elemSize();
+            const size_t offset = static_cast<size_t>(view.channel) * elementBytes;
+            std::vector<unsigned char> row(static_cast<size_t>(source.cols) * elementBytes);
+            for (int y = 0; y < source.rows; ++y)
+            {
+                const unsigned char *pixel = source.ptr(y) + offset;
+                for (size_t x = 0; x < row.size(); x += elementBytes, pixel += pixelBytes)
+                {
+                    std::memcpy(row.data() + x, pixel, elementBytes);
+                }
+                hash = HashBytes(row.data(), row.size(), hash);
+            }
+            return hash;
+        }
+
+        // Only pixel buffers can be mutated behind a handle; every other value is immutable once shared
+        std::shared_ptr<const NodeData> DeepCopy(const std::shared_ptr<const NodeData> &data)
+        {
+            if (const auto *mat = data ? std::get_if<cv::Mat>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(mat->clone());
+            }
+            if (const auto *umat = data ? std::get_if<cv::UMat>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(umat->clone());
+            }
+            if (const auto *planar = data ? std::get_if<PlanarImage>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(planar->Clone());
+            }
+            if (const auto *pyramid = data ? std::get_if<ImagePyramid>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(pyramid->Clone());
+            }
+            if (const auto *mask = data ? std::get_if<BitMask>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(mask->Clone());
+            }
+            if (const auto *batch = data ? std::get_if<ImageBatch>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(batch->Clone());
+            }
+            if (const auto *view = data ? std::get_if<ChannelView>(data.get()) : nullptr)
+            {
+                // Keeps only the channel, not the whole interleaved source
+                return std::make_shared<const NodeData>(ChannelView{ .source = view->Extract(), .channel = 0 });
+            }
+#if VISION_CRAFT_WITH_CUDA
+            if (const auto *gpuMat = data ? std::get_if<cv::cuda::GpuMat>(data.get()) : nullptr)
+            {
+                return std::make_shared<const NodeData>(gpuMat->clone());
+            }
+#endif
+            return data;
+        }
+
+        // False for device images and the image types with their own layout, which the compressed tier skips
+        bool IsHostValue(const NodeData &data)
+        {
+#if VISION_CRAFT_WITH_CUDA
+            if (std::holds_alternative<cv::cuda::GpuMat>(data))
+            {
+                return false;
+            }
+#endif
+            return !std::holds_alternative<cv::UMat>(data) && !std::holds_alternative<ChannelView>(data)
+                   && !std::holds_alternative<PlanarImage>(data) && !std::holds_alternative<ImagePyramid>(data)
+                   && !std::holds_alternative<BitMask>(data) && !std::holds_alternative<ContourSet>(data)
+                   && !std::holds_alternative<ImageBatch>(data);
+        }
+    } // namespace
+
+    NodeOutputCache::NodeOutputCache(size_t byteBudget) : byteBudget(byteBudget)
+    {
+    }
+
+    uint64_t NodeOutputCache::ComputeKey(const Node &node)
+    {
+        // Scope by node ID as well: parameters held outside slots must never leak between instances of one type
+        uint64_t key = HashString(node.GetType(), kGoldenRatio);
+        key = Combine(key, static_cast<uint64_t>(node.GetId()));
+        if (const double scale = node.GetProxyScale(); scale < 1.0)
+        {
+            // Proxy runs scale parameters too, so their outputs never stand in for full-resolution ones
+            key = Combine(key, std::bit_cast<uint64_t>(scale));
+        }
+        if (const auto policy = node.GetPrecisionPolicy(); policy != PrecisionPolicy::Native)
+        {
+            // The same inputs yield outputs of another depth
+            key = Combine(key, static_cast<uint64_t>(policy) + 1);
+        }
+        // Slot indices follow creation order, which is fixed per node type, so they stand in for names
+        for (SlotIndex slotIndex = 0; slotIndex < node.GetInputSlotCount(); ++slotIndex)
+        {
+            key = Combine(key, static_cast<uint64_t>(slotIndex));
+            const auto value = node.GetInputSlot(slotIndex).GetResolvedSharedData();
+            key = Combine(key, Fingerprint(value ? *value : NodeData{}));
+        }
+        return key;
+    }
+
+    uint64_t NodeOutputCache::Fingerprint(const NodeData &data)
+    {
+        const uint64_t typeTag = static_cast<uint64_t>(data.index());
+        const uint64_t valueHash = std::visit(
+            [](const auto &value) -> uint64_t {
+                using T = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<T, std::monostate>)
+                {
+                    return 0;
+                }
+                else if constexpr (std::is_same_v<T, cv::Mat>)
+                {
+                    return HashMat(value);
+                }
+                else if constexpr (std::is_same_v<T, cv::UMat>)
+                {
+                    // Maps (or downloads) the buffer so the key follows pixel content, not the device handle
+                    return HashMat(value.getMat(cv::ACCESS_READ));
+                }
+#if VISION_CRAFT_WITH_CUDA
+                else if constexpr (std::is_same_v<T, cv::cuda::GpuMat>)
+                {
+                    cv::Mat host;
+                    value.download(host);
+                    return HashMat(host);
+                }
+#endif
+                else if constexpr (std::is_same_v<T, ChannelView>)
+                {
+                    return HashChannel(value);
+                }
+                else if constexpr (std::is_same_v<T, PlanarImage>)
+                {
+                    uint64_t hash = static_cast<uint64_t>(value.GetChannelCount());
+                    for (const auto &plane : value.GetPlanes())
+                    {
+                        hash = Combine(hash, HashMat(plane));
+                    }
+                    return hash;
+                }
+                else if constexpr (std::is_same_v<T, ImagePyramid>)
+                {
+                    // Levels follow from the base image and the filter
+                    return Combine(HashMat(value.GetBase()), static_cast<uint64_t>(value.GetFilter()));
+                }
+                else if constexpr (std::is_same_v<T, BitMask>)
+                {
+                    return Combine(HashMat(value.GetWords()), static_cast<uint64_t>(value.GetSize().width));
+                }
+                else if constexpr (std::is_same_v<T, ContourSet>)
+                {
+                    // A filtered set shares its buffer with the unfiltered one, so the selection counts too
+                    const uint64_t hash = Combine(HashMat(value.GetStorage()), static_cast<uint64_t>(value.GetCount()));
+                    return Combine(hash, HashMat(value.GetSelection()));
+                }
+                else if constexpr (std::is_same_v<T, ImageBatch>)
+                {
+                    // The same rows split into other counts are other images
+                    return Combine(HashMat(value.GetStorage()), static_cast<uint64_t>(value.GetCount()));
+                }
+                else if constexpr (std::is_same_v<T, std::string>)
+                {
+                    return HashString(value, 0);
+                }
+                else if constexpr (std::is_same_v<T, std::filesystem::path>)
+                {
+                    // Size and modification time stand in for the file content, which is never read here
+                    uint64_t hash = HashString(value.string(), 0);
+                    std::error_code error;
+                    const auto size = std::filesystem::file_size(value, error);
+                    if (error)
+                    {
+                        return hash;
+                    }
+                    const auto modified = std::filesystem::last_write_time(value, error);
+                    hash = Combine(hash, static_cast<uint64_t>(size));
+                    return Combine(hash, static_cast<uint64_t>(modified.time_since_epoch().count()));
+                }
+                else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+                {
+                    uint64_t hash = value.size();
+                    for (const auto &point : value)
+                    {
+                        hash = Combine(hash, (static_cast<uint64_t>(static_cast<uint32_t>(point.x)) << 32)
+                                                 | static_cast<uint32_t>(point.y));
+                    }
+                    return hash;
+                }
+                else
+                {
+                    return HashBytes(&value, sizeof(value), 0);
+                }
+            },
+            data);
+        return Combine(typeTag, valueHash);
+    }
+
+    size_t NodeOutputCache::EstimateBytes(const NodeData &data)
+    {
+        if (const auto *mat = std::get_if<cv::Mat>(&data))
+        {
+            return mat->total() * mat->elemSize();
+        }
+        if (const auto *umat = std::get_if<cv::UMat>(&data))
+        {
+            return umat->total() * umat->elemSize();
+        }
+#if VISION_CRAFT_WITH_CUDA
+        if (const auto *gpuMat = std::get_if<cv::cuda::GpuMat>(&data))
+        {
+            return static_cast<size_t>(gpuMat->rows) * gpuMat->cols * gpuMat->elemSize();
+        }
+#endif
+        if (const auto *view = std::get_if<ChannelView>(&data))
+        {
+            return view->source.total() * view->source.elemSize1();
+        }
+        if (const auto *planar = std::get_if<PlanarImage>(&data))
+        {
+            return planar->GetByteSize();
+        }
+        if (const auto *pyramid = std::get_if<ImagePyramid>(&data))
+        {
+            return pyramid->GetByteSize();
+        }
+        if (const auto *mask = std::get_if<BitMask>(&data))
+        {
+            return mask->GetByteSize();
+        }
+        if (const auto *contours = std::get_if<ContourSet>(&data))
+        {
+            return contours->GetByteSize();
+        }
+        if (const auto *batch = std::get_if<ImageBatch>(&data))
+        {
+            return batch->GetByteSize();
+        }
+        if (const auto *text = std::get_if<std::string>(&data))
+        {
+            return text->size();
+        }
+        if (const auto *points = std::get_if<std::vector<cv::Point>>(&data))
+        {
+            return points->size() * sizeof(cv::Point);
+        }
+        return sizeof(NodeData);
+    }
+
+    bool NodeOutputCache::TryRestore(uint64_t key, Node &node)
+    {
+        const auto restore = [&node](const std::vector<std::shared_ptr<const NodeData>> &outputs) {
+            for (SlotIndex slotIndex = 0; slotIndex < outputs.size() && slotIndex < node.GetOutputSlotCount();
+                ++slotIndex)
+            {
+                node.ShareOutputSlotData(slotIndex, outputs[slotIndex]);
+            }
+        };
+
+        std::shared_ptr<PersistentOutputStore> store;
+        {
+            std::scoped_lock lock(mutex);
+            if (auto it = entries.find(key); it != entries.end())
+            {
+                restore(it->second.outputs);
+                lruOrder.splice(lruOrder.begin(), lruOrder, it->second.lruPosition);
+                stats.hits++;
+                return true;
+            }
+
+            // Decoded images are fresh copies; the entry moves back to the uncompressed tier
+            if (auto it = compressed.find(key); it != compressed.end())
+            {
+                auto outputs = Decompress(it->second);
+                EraseCompressed(it);
+                if (outputs)
+                {
+                    restore(*outputs);
+                    Entry entry;
+                    for (const auto &value : *outputs)
+                    {
+                        entry.bytes += EstimateBytes(value ? *value : NodeData{});
+                    }
+                    if (entry.bytes <= byteBudget)
+                    {
+                        entry.outputs = std::move(*outputs);
+                        Insert(key, std::move(entry));
+                    }
+                    stats.compressedHits++;
+                    return true;
+                }
+            }
+            store = persistentStore;
+        }
+
+        // Disk reads happen outside the lock; loaded images are fresh copies, so they need no deep copy
+        auto outputs = store ? store->Load(key) : std::nullopt;
+        std::scoped_lock lock(mutex);
+        if (!outputs)
+        {
+            stats.misses++;
+            return false;
+        }
+
+        restore(*outputs);
+        Entry entry;
+        for (const auto &value : *outputs)
+        {
+            entry.bytes += EstimateBytes(value ? *value : NodeData{});
+        }
+        if (entry.bytes <= byteBudget)
+        {
+            entry.outputs = std::move(*outputs);
+            Insert(key, std::move(entry));
+        }
+        stats.persistentHits++;
+        return true;
+    }
+
+    void NodeOutputCache::Store(uint64_t key, const Node &node)
+    {
+        Entry entry;
+        entry.outputs.reserve(node.GetOutputSlotCount());
+        for (SlotIndex slotIndex = 0; slotIndex < node.GetOutputSlotCount(); ++slotIndex)
+        {
+            auto value = node.GetOutputSlot(slotIndex).GetSharedData();
+            entry.bytes += EstimateBytes(value ? *value : NodeData{});
+            entry.outputs.push_back(DeepCopy(std::move(value)));
+        }
+
+        // The store keeps its own handles to the copies, which stay valid after the entry is evicted
+        std::shared_ptr<PersistentOutputStore> store;
+        std::vector<std::shared_ptr<const NodeData>> persisted;
+        {
+            std::scoped_lock lock(mutex);
+            store = persistentStore;
+            if (store)
+            {
+                persisted = entry.outputs;
+            }
+            if (entry.bytes <= byteBudget)
+            {
+                Insert(key, std::move(entry));
+            }
+        }
+
+        if (store)
+        {
+            (void)store->Save(key, persisted);
+        }
+    }
+
+    void NodeOutputCache::SetByteBudget(size_t newByteBudget)
+    {
+        std::scoped_lock lock(mutex);
+        byteBudget = newByteBudget;
+        EvictToBudget();
+    }
+
+    size_t NodeOutputCache::GetByteBudget() const
+    {
+        std::scoped_lock lock(mutex);
+        return byteBudget;
+    }
+
+    size_t NodeOutputCache::Trim(size_t targetBytes)
+    {
+        std::scoped_lock lock(mutex);
+        const size_t before = usedBytes + compressedBytes;
+        EvictTo(targetBytes > compressedBytes ? targetBytes - compressedBytes : 0, false);
+        EvictCompressedTo(targetBytes > usedBytes ? targetBytes - usedBytes : 0);
+        return before - usedBytes - compressedBytes;
+    }
+
+    void NodeOutputCache::SetCompressedTierBudget(size_t newByteBudget)
+    {
+        std::scoped_lock lock(mutex);
+        compressedBudget = newByteBudget;
+        EvictCompressedTo(compressedBudget);
+    }
+
+    size_t NodeOutputCache::GetCompressedTierBudget() const
+    {
+        std::scoped_lock lock(mutex);
+        return compressedBudget;
+    }
+
+    size_t NodeOutputCache::GetCompressedBytes() const
+    {
+        std::scoped_lock lock(mutex);
+        return compressedBytes;
+    }
+
+    size_t NodeOutputCache::GetCompressedEntryCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return compressed.size();
+    }
+
+    size_t NodeOutputCache::GetUsedBytes() const
+    {
+        std::scoped_lock lock(mutex);
+        return usedBytes;
+    }
+
+    size_t NodeOutputCache::GetEntryCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return entries.size();
+    }
+
+    NodeOutputCache::Statistics NodeOutputCache::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void NodeOutputCache::SetPersistentStore(std::shared_ptr<PersistentOutputStore> store)
+    {
+        std::scoped_lock lock(mutex);
+        persistentStore = std::move(store);
+    }
+
+    std::shared_ptr<PersistentOutputStore> NodeOutputCache::GetPersistentStore() const
+    {
+        std::scoped_lock lock(mutex);
+        return persistentStore;
+    }
+
+    void NodeOutputCache::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        entries.clear();
+        lruOrder.clear();
+        usedBytes = 0;
+        compressed.clear();
+        compressedLruOrder.clear();
+        compressedBytes = 0;
+        stats = {};
+    }
+
+    void NodeOutputCache::Insert(uint64_t key, Entry entry)
+    {
+        if (auto existing = entries.find(key); existing != entries.end())
+        {
+            usedBytes -= existing->second.bytes;
+            lruOrder.erase(existing->second.lruPosition);
+            entries.erase(existing);
+        }
+        if (auto stale = compressed.find(key); stale != compressed.end())
+        {
+            EraseCompressed(stale);
+        }
+
+        lruOrder.push_front(key);
+        entry.lruPosition = lruOrder.begin();
+        usedBytes += entry.bytes;
+        entries.emplace(key, std::move(entry));
+
+        EvictToBudget();
+    }
+
+    void NodeOutputCache::EvictToBudget()
+    {
+        EvictTo(byteBudget, true);
+    }
+
+    void NodeOutputCache::EvictTo(size_t limit, bool keepCompressed)
+    {
+        while (usedBytes > limit && !lruOrder.empty())
+        {
+            auto it = entries.find(lruOrder.back());
+            usedBytes -= it->second.bytes;
+            if (keepCompressed && compressedBudget > 0)
+            {
+                KeepCompressed(it->first, it->second);
+            }
+            entries.erase(it);
+            lruOrder.pop_back();
+            stats.evictions++;
+        }
+    }
+
+    void NodeOutputCache::KeepCompressed(uint64_t key, const Entry &entry)
+    {
+        CompressedEntry packed;
+        packed.outputs.reserve(entry.outputs.size());
+        for (const auto &value : entry.outputs)
+        {
+            CompressedOutput output;
+            if (const auto *mat = value ? std::get_if<cv::Mat>(value.get()) : nullptr; mat && !mat->empty())
+            {
+                if (mat->dims > 2)
+                {
+                    return;
+                }
+                // Cached images are deep copies, so they are continuous unless a node stored a view
+                const cv::Mat continuous = mat->isContinuous() ? *mat : mat->clone();
+                output.rows = continuous.rows;
+                output.cols = continuous.cols;
+                output.type = continuous.type();
+                output.pixels = RunLength::Encode(std::span(
+                    reinterpret_cast<const std::byte *>(continuous.data), continuous.total() * continuous.elemSize()));
+                output.pixels.shrink_to_fit();
+                packed.bytes += output.pixels.size();
+            }
+            else if (value && !IsHostValue(*value))
+            {
+                return; // Device images, planes, pyramids, masks and views are not compressed
+            }
+            else
+            {
+                // Scalars, text and point lists are small and kept as they are
+                output.value = value;
+                packed.bytes += value ? EstimateBytes(*value) : 0;
+            }
+            packed.outputs.push_back(std::move(output));
+        }
+
+        if (packed.bytes * Constants::Cache::kMinCompressionRatio > entry.bytes || packed.bytes > compressedBudget)
+        {
+            return;
+        }
+
+        compressedLruOrder.push_front(key);
+        packed.lruPosition = compressedLruOrder.begin();
+        compressedBytes += packed.bytes;
+        compressed.insert_or_assign(key, std::move(packed));
+        stats.compressions++;
+        EvictCompressedTo(compressedBudget);
+    }
+
+    std::optional<std::vector<std::shared_ptr<const NodeData>>> NodeOutputCache::Decompress(
+        const CompressedEntry &entry)
+    {
+        std::vector<std::shared_ptr<const NodeData>> outputs;
+        outputs.reserve(entry.outputs.size());
+        for (const auto &output : entry.outputs)
+        {
+            if (output.type < 0)
+            {
+                outputs.push_back(output.value);
+                continue;
+            }
+
+            cv::Mat image(output.rows, output.cols, output.type);
+            if (!RunLength::Decode(output.pixels,
+                    std::span(reinterpret_cast<std::byte *>(image.data), image.total() * image.elemSize())))
+            {
+                return std::nullopt;
+            }
+            outputs.push_back(std::make_shared<const NodeData>(std::move(image)));
+        }
+        return outputs;
+    }
+
+    void NodeOutputCache::EraseCompressed(std::unordered_map<uint64_t, CompressedEntry>::iterator it)
+    {
+        compressedBytes -= it->second.bytes;
+        compressedLruOrder.erase(it->second.lruPosition);
+        compressed.erase(it);
+    }
+
+    void NodeOutputCache::EvictCompressedTo(size_t limit)
+    {
+        while (compressedBytes > limit && !compressedLruOrder.empty())
+        {
+            EraseCompressed(compressed.find(compressedLruOrder.back()));
+        }
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Content-addressed cache of node output slots with an LRU byte budget.
+     *
+     * Entries are keyed by a hash of the node type, node ID and the resolved value of every input
+     * slot (connected data or default). Image outputs are deep-copied on store, so later in-place
+     * writes by the producing node cannot corrupt cached results; restored images are shared
+     * with the cache and must be treated as read-only by consumers.
+     *
+     * An optional PersistentOutputStore extends the cache across sessions: every stored result is also
+     * written to disk, and memory misses are looked up there before the node has to run.
+     *
+     * An optional compressed tier (SetCompressedTierBudget()) keeps entries evicted from the byte budget in
+     * memory, with their cv::Mat pixels run-length coded (see RunLength). Threshold and edge masks shrink
+     * by an order of magnitude or more, so the cache holds many more cold results; a hit decodes the
+     * images and moves the entry back to the uncompressed tier. Entries that compress poorly, or hold
+     * other image types, are dropped as before.
+     *
+     * All methods are thread-safe.
+     */
+    class NodeOutputCache
+    {
+    public:
+        /**
+         * @brief Cache counters.
+         */
+        struct Statistics
+        {
+            size_t hits = 0;           ///< Lookups served from memory
+            size_t persistentHits = 0; ///< Lookups served from the persistent store
+            size_t misses = 0;         ///< Lookups that required Process()
+            size_t evictions = 0;      ///< Entries dropped to stay under budget
+            size_t compressedHits = 0; ///< Lookups served from the compressed tier
+            size_t compressions = 0;   ///< Evicted entries kept in the compressed tier
+        };
+
+        /**
+         * @brief Constructs cache.
+         * @param byteBudget Maximum bytes held by cached outputs
+         */
+        explicit NodeOutputCache(size_t byteBudget);
+
+        /**
+         * @brief Computes cache key for node's current inputs.
+         * @param node Node with inputs already populated
+         * @return 64-bit content hash (proxy runs also hash the node's proxy scale)
+         */
+        [[nodiscard]] static uint64_t ComputeKey(const Node &node);
+
+        /**
+         * @brief Hashes a slot value.
+         * @param data Value to fingerprint
+         * @return 64-bit hash (images hash dimensions, type and pixel content; paths of existing files also
+         *         hash file size and modification time, so edited inputs never replay stale results)
+         */
+        [[nodiscard]] static uint64_t Fingerprint(const NodeData &data);
+
+        /**
+         * @brief Estimates memory held by a slot value.
+         * @param data Value to measure
+         * @return Approximate size in bytes
+         */
+        [[nodiscard]] static size_t EstimateBytes(const NodeData &data);
+
+        /**
+         * @brief Restores cached outputs into node.
+         * @param key Cache key from ComputeKey()
+         * @param node Node whose output slots receive the cached data
+         * @return True on hit (in memory, or in the persistent store)
+         */
+        bool TryRestore(uint64_t key, Node &node);
+
+        /**
+         * @brief Stores node's current outputs.
+         * @param key Cache key from ComputeKey()
+         * @param node Node that has just been processed
+         * @note Results larger than the whole budget are not cached in memory; the persistent store
+         *       applies its own budget.
+         */
+        void Store(uint64_t key, const Node &node);
+
+        /**
+         * @brief Changes byte budget, evicting entries if needed.
+         * @param byteBudget New budget in bytes
+         */
+        void SetByteBudget(size_t byteBudget);
+
+        /**
+         * @brief Returns byte budget.
+         * @return Budget in bytes
+         */
+        [[nodiscard]] size_t GetByteBudget() const;
+
+        /**
+         * @brief Drops least recently used entries, uncompressed ones first, until at most targetBytes are held
+         *        in both tiers together; the budgets are unchanged.
+         * @param targetBytes Bytes to keep
+         * @return Bytes freed
+         * @note Used by NodeEditor to make room under a MemoryBudget before it spills live intermediates.
+         */
+        size_t Trim(size_t targetBytes);
+
+        /**
+         * @brief Sets the byte budget of the compressed tier, evicting its entries if needed.
+         * @param byteBudget Maximum compressed bytes held (0 = no compressed tier, the default)
+         */
+        void SetCompressedTierBudget(size_t byteBudget);
+
+        /**
+         * @brief Returns the byte budget of the compressed tier.
+         * @return Budget in bytes (0 = off)
+         */
+        [[nodiscard]] size_t GetCompressedTierBudget() const;
+
+        /**
+         * @brief Returns bytes held by the compressed tier.
+         * @return Compressed bytes, plus the size of values stored as they are
+         */
+        [[nodiscard]] size_t GetCompressedBytes() const;
+
+        /**
+         * @brief Returns number of entries in the compressed tier.
+         * @return Entry count
+         */
+        [[nodiscard]] size_t GetCompressedEntryCount() const;
+
+        /**
+         * @brief Returns bytes held by the uncompressed tier.
+         * @return Used bytes (see GetCompressedBytes() for the compressed tier)
+         */
+        [[nodiscard]] size_t GetUsedBytes() const;
+
+        /**
+         * @brief Returns number of entries in the uncompressed tier.
+         * @return Entry count
+         */
+        [[nodiscard]] size_t GetEntryCount() const;
+
+        /**
+         * @brief Returns cache counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        /**
+         * @brief Attaches on-disk store backing the memory cache.
+         * @param store Store shared with other caches or sessions, or nullptr to detach
+         */
+        void SetPersistentStore(std::shared_ptr<PersistentOutputStore> store);
+
+        /**
+         * @brief Returns attached on-disk store.
+         * @return Store, or nullptr if none is attached
+         */
+        [[nodiscard]] std::shared_ptr<PersistentOutputStore> GetPersistentStore() const;
+
+        /**
+         * @brief Drops all entries and resets counters.
+         * @note The persistent store keeps its entries.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Cached outputs of one node evaluation.
+         */
+        struct Entry
+        {
+            std::vector<std::shared_ptr<const NodeData>> outputs; ///< Values by output SlotIndex
+            size_t bytes = 0;                                     ///< Memory held by outputs
+            std::list<uint64_t>::iterator lruPosition;            ///< Position in recency list
+        };
+
+        /**
+         * @brief One output slot value of a compressed entry.
+         */
+        struct CompressedOutput
+        {
+            std::shared_ptr<const NodeData> value; ///< Value kept as it is (everything but cv::Mat)
+            int rows = 0;                          ///< cv::Mat rows
+            int cols = 0;                          ///< cv::Mat columns
+            int type = -1;                         ///< cv::Mat::type() (-1 = value holds the output)
+            std::vector<std::byte> pixels;         ///< Run-length coded pixel rows (RunLength::Encode())
+        };
+
+        /**
+         * @brief Cached outputs of one node evaluation with run-length coded images.
+         */
+        struct CompressedEntry
+        {
+            std::vector<CompressedOutput> outputs;     ///< Values by output SlotIndex
+            size_t bytes = 0;                          ///< Memory held by outputs
+            std::list<uint64_t>::iterator lruPosition; ///< Position in compressed recency list
+        };
+
+        /**
+         * @brief Inserts entry as most recently used, replacing any entry under key.
+         * @param key Cache key
+         * @param entry Entry to insert (lruPosition is assigned)
+         * @note Caller must hold mutex.
+         */
+        void Insert(uint64_t key, Entry entry);
+
+        /**
+         * @brief Evicts least recently used entries until under budget.
+         * @note Caller must hold mutex.
+         */
+        void EvictToBudget();
+
+        /**
+         * @brief Evicts least recently used entries until at most limit bytes are held.
+         * @param limit Bytes to keep
+         * @param keepCompressed Move evicted entries to the compressed tier where they compress well
+         * @note Caller must hold mutex.
+         */
+        void EvictTo(size_t limit, bool keepCompressed);
+
+        /**
+         * @brief Compresses an evicted entry into the compressed tier.
+         * @param key Cache key
+         * @param entry Entry leaving the uncompressed tier
+         * @note Caller must hold mutex. Entries holding other images than cv::Mat, or compressing to more than
+         *       1 / Constants::Cache::kMinCompressionRatio of their size, are not kept.
+         */
+        void KeepCompressed(uint64_t key, const Entry &entry);
+
+        /**
+         * @brief Decodes a compressed entry.
+         * @param entry Compressed entry
+         * @return Values by output SlotIndex, or std::nullopt if an image does not decode
+         */
+        [[nodiscard]] static std::optional<std::vector<std::shared_ptr<const NodeData>>> Decompress(
+            const CompressedEntry &entry);
+
+        /**
+         * @brief Drops an entry of the compressed tier.
+         * @param it Entry to drop
+         * @note Caller must hold mutex.
+         */
+        void EraseCompressed(std::unordered_map<uint64_t, CompressedEntry>::iterator it);
+
+        /**
+         * @brief Evicts least recently used compressed entries until at most limit bytes are held.
+         * @param limit Bytes to keep
+         * @note Caller must hold mutex.
+         */
+        void EvictCompressedTo(size_t limit);
+
+        mutable std::mutex mutex;                                 ///< Guards all state
+        std::unordered_map<uint64_t, Entry> entries;              ///< Entries by key
+        std::list<uint64_t> lruOrder;                             ///< Keys, most recently used first
+        size_t byteBudget;                                        ///< Maximum bytes held
+        size_t usedBytes = 0;                                     ///< Bytes currently held
+        Statistics stats;                                         ///< Hit/miss counters
+        std::shared_ptr<PersistentOutputStore> persistentStore;   ///< On-disk backing (optional)
+        std::unordered_map<uint64_t, CompressedEntry> compressed; ///< Compressed entries by key
+        std::list<uint64_t> compressedLruOrder;                   ///< Compressed keys, most recently used first
+        size_t compressedBudget = 0;                              ///< Maximum compressed bytes (0 = tier off)
+        size_t compressedBytes = 0;                               ///< Bytes held by the compressed tier
+    };
+
+} // namespace VisionCraft::Nodes
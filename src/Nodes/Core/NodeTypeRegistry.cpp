@@ -0,0 +1,67 @@
+#include "Nodes/Core/NodeTypeRegistry.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        struct InternTable
+        {
+            std::shared_mutex mutex;                              ///< Guards names and ids
+            std::deque<std::string> names;                        ///< By ID - 1 (deque: names never move)
+            std::unordered_map<std::string_view, NodeTypeId> ids; ///< Views into names
+        };
+
+        InternTable &GetTable()
+        {
+            static InternTable table;
+            return table;
+        }
+    } // namespace
+
+    NodeTypeId NodeTypeRegistry::Intern(std::string_view type)
+    {
+        if (const auto id = Find(type); id != kNoNodeTypeId)
+        {
+            return id;
+        }
+
+        auto &table = GetTable();
+        std::unique_lock lock(table.mutex);
+        if (const auto it = table.ids.find(type); it != table.ids.end())
+        {
+            return it->second; // Interned by another thread in the meantime
+        }
+        const auto &name = table.names.emplace_back(type);
+        const auto id = static_cast<NodeTypeId>(table.names.size());
+        table.ids.emplace(name, id);
+        return id;
+    }
+
+    NodeTypeId NodeTypeRegistry::Find(std::string_view type)
+    {
+        auto &table = GetTable();
+        std::shared_lock lock(table.mutex);
+        const auto it = table.ids.find(type);
+        return it != table.ids.end() ? it->second : kNoNodeTypeId;
+    }
+
+    const std::string &NodeTypeRegistry::GetName(NodeTypeId id)
+    {
+        static const std::string kUnknown;
+        auto &table = GetTable();
+        std::shared_lock lock(table.mutex);
+        return id != kNoNodeTypeId && id <= table.names.size() ? table.names[id - 1] : kUnknown;
+    }
+
+    size_t NodeTypeRegistry::GetCount()
+    {
+        auto &table = GetTable();
+        std::shared_lock lock(table.mutex);
+        return table.names.size();
+    }
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Dense integer standing for a node type string, e.g. Node::GetType() or a factory key.
+     * @note Assigned in order of first use from 1, so IDs differ between processes; never save them.
+     */
+    using NodeTypeId = uint32_t;
+
+    /**
+     * @brief ID no type string maps to.
+     */
+    inline constexpr NodeTypeId kNoNodeTypeId = 0;
+
+    /**
+     * @brief Process-wide interning of node type strings into NodeTypeIds.
+     *
+     * Lets planning, loading and the factory compare and index types as integers instead of strings.
+     * Every string is interned once and kept for the process lifetime. All methods are thread-safe.
+     */
+    class NodeTypeRegistry
+    {
+    public:
+        /**
+         * @brief Returns the ID of a type string, assigning the next one on first use.
+         * @param type Type string
+         * @return ID of type (never kNoNodeTypeId)
+         */
+        [[nodiscard]] static NodeTypeId Intern(std::string_view type);
+
+        /**
+         * @brief Returns the ID of a type string without interning it.
+         * @param type Type string
+         * @return ID, or kNoNodeTypeId if type was never interned
+         */
+        [[nodiscard]] static NodeTypeId Find(std::string_view type);
+
+        /**
+         * @brief Returns the type string of an ID.
+         * @param id ID from Intern()
+         * @return Type string (valid for the process lifetime), or an empty string for an unknown ID
+         */
+        [[nodiscard]] static const std::string &GetName(NodeTypeId id);
+
+        /**
+         * @brief Returns the number of interned type strings.
+         * @return Count; IDs run from 1 to the count
+         */
+        [[nodiscard]] static size_t GetCount();
+    };
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,690 @@
+#include "Nodes/Core/PersistentOutputStore.h"
+#include "Logger.h"
+#include "Nodes/Core/MappedFile.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <variant>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        using PersistentOutput::OutputRecord;
+        using PersistentOutput::OutputType;
+
+        // Temporary files this old belong to a write that never finished
+        constexpr auto kStaleTemporaryAge = std::chrono::hours(1);
+
+        constexpr const char *kTemporaryExtension = ".tmp";
+
+        template<typename T> std::array<std::byte, 8> PackScalar(T value)
+        {
+            static_assert(sizeof(T) <= 8 && std::is_trivially_copyable_v<T>);
+            std::array<std::byte, 8> scalar{};
+            std::memcpy(scalar.data(), &value, sizeof(T));
+            return scalar;
+        }
+
+        template<typename T> T UnpackScalar(const std::array<std::byte, 8> &scalar)
+        {
+            T value;
+            std::memcpy(&value, scalar.data(), sizeof(T));
+            return value;
+        }
+
+        // One output slot reduced to a record plus the bytes it references
+        struct EncodedOutput
+        {
+            OutputRecord record;
+            cv::Mat image;                ///< Host pixels (Image, DeviceImage and GpuImage)
+            std::vector<std::byte> bytes; ///< String, Path and Points payload
+        };
+
+        std::optional<EncodedOutput> Encode(const std::shared_ptr<const NodeData> &data)
+        {
+            EncodedOutput encoded;
+            if (!data)
+            {
+                return encoded;
+            }
+
+            const auto setImage = [&encoded](OutputType type, cv::Mat image) {
+                encoded.record.type = type;
+                encoded.record.rows = image.rows;
+                encoded.record.cols = image.cols;
+                encoded.record.matType = image.type();
+                encoded.record.length = image.total() * image.elemSize();
+                encoded.image = std::move(image);
+            };
+            const auto setBytes = [&encoded](OutputType type, std::span<const std::byte> bytes) {
+                encoded.record.type = type;
+                encoded.record.length = bytes.size();
+                encoded.bytes.assign(bytes.begin(), bytes.end());
+            };
+
+            const bool supported = std::visit(
+                [&](const auto &value) {
+                    using T = std::decay_t<decltype(value)>;
+                    if constexpr (std::is_same_v<T, std::monostate>)
+                    {
+                        encoded.record.type = OutputType::Empty;
+                    }
+                    else if constexpr (std::is_same_v<T, cv::Mat>)
+                    {
+                        if (value.dims > 2)
+                        {
+                            return false;
+                        }
+                        setImage(OutputType::Image, value);
+                    }
+                    else if constexpr (std::is_same_v<T, cv::UMat>)
+                    {
+                        if (value.dims > 2)
+                        {
+                            return false;
+                        }
+                        setImage(OutputType::DeviceImage, value.getMat(cv::ACCESS_READ).clone());
+                    }
+                    else if constexpr (std::is_same_v<T, ChannelView>)
+                    {
+                        // Stored as its own plane; consumers of views also read single-channel images
+                        if (value.source.dims > 2)
+                        {
+                            return false;
+                        }
+                        setImage(OutputType::Image, value.Extract());
+                    }
+                    else if constexpr (std::is_same_v<T, PlanarImage>)
+                    {
+                        // Restored interleaved; planar consumers convert it back at the layout boundary
+                        setImage(OutputType::Image, value.ToInterleaved());
+                    }
+                    else if constexpr (std::is_same_v<T, ImagePyramid>)
+                    {
+                        // Only level 0 is stored; the loaded pyramid builds its levels again on demand
+                        const cv::Mat base = value.GetBase();
+                        if (base.dims > 2)
+                        {
+                            return false;
+                        }
+                        setImage(OutputType::Pyramid, base);
+                        encoded.record.scalar = PackScalar(static_cast<uint32_t>(value.GetFilter()));
+                    }
+                    else if constexpr (std::is_same_v<T, BitMask>)
+                    {
+                        setImage(OutputType::Mask, value.GetWords());
+                        encoded.record.scalar = PackScalar(static_cast<int32_t>(value.GetSize().width));
+                    }
+                    else if constexpr (std::is_same_v<T, ContourSet>)
+                    {
+                        setImage(OutputType::Contours, value.Compact().GetStorage());
+                    }
+                    else if constexpr (std::is_same_v<T, ImageBatch>)
+                    {
+                        setImage(OutputType::Batch, value.GetStorage());
+                        encoded.record.scalar = PackScalar(static_cast<uint64_t>(value.GetCount()));
+                    }
+#if VISION_CRAFT_WITH_CUDA
+                    else if constexpr (std::is_same_v<T, cv::cuda::GpuMat>)
+                    {
+                        cv::Mat host;
+                        value.download(host);
+                        setImage(OutputType::GpuImage, std::move(host));
+                    }
+#endif
+                    else if constexpr (std::is_same_v<T, double>)
+                    {
+                        encoded.record.type = OutputType::Double;
+                        encoded.record.scalar = PackScalar(value);
+                    }
+                    else if constexpr (std::is_same_v<T, float>)
+                    {
+                        encoded.record.type = OutputType::Float;
+                        encoded.record.scalar = PackScalar(value);
+                    }
+                    else if constexpr (std::is_same_v<T, int>)
+                    {
+                        encoded.record.type = OutputType::Int;
+                        encoded.record.scalar = PackScalar(static_cast<int32_t>(value));
+                    }
+                    else if constexpr (std::is_same_v<T, bool>)
+                    {
+                        encoded.record.type = OutputType::Bool;
+                        encoded.record.scalar = PackScalar(static_cast<uint8_t>(value ? 1 : 0));
+                    }
+                    else if constexpr (std::is_same_v<T, std::string>)
+                    {
+                        setBytes(OutputType::String, std::as_bytes(std::span(value)));
+                    }
+                    else if constexpr (std::is_same_v<T, std::filesystem::path>)
+                    {
+                        const auto utf8 = value.u8string();
+                        setBytes(OutputType::Path, std::as_bytes(std::span(utf8)));
+                    }
+                    else if constexpr (std::is_same_v<T, std::vector<cv::Point>>)
+                    {
+                        std::vector<int32_t> coordinates;
+                        coordinates.reserve(value.size() * 2);
+                        for (const auto &point : value)
+                        {
+                            coordinates.push_back(point.x);
+                            coordinates.push_back(point.y);
+                        }
+                        setBytes(OutputType::Points, std::as_bytes(std::span(coordinates)));
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    return true;
+                },
+                *data);
+
+            if (!supported)
+            {
+                return std::nullopt;
+            }
+            return encoded;
+        }
+
+        // Copies payload rows into the mapping
+        void WritePayload(const EncodedOutput &encoded, std::byte *destination)
+        {
+            if (!encoded.image.empty())
+            {
+                const size_t rowBytes = static_cast<size_t>(encoded.image.cols) * encoded.image.elemSize();
+                for (int row = 0; row < encoded.image.rows; ++row)
+                {
+                    std::memcpy(destination + static_cast<size_t>(row) * rowBytes, encoded.image.ptr(row), rowBytes);
+                }
+                return;
+            }
+            if (!encoded.bytes.empty())
+            {
+                std::memcpy(destination, encoded.bytes.data(), encoded.bytes.size());
+            }
+        }
+
+        std::optional<cv::Mat> DecodeImage(const OutputRecord &record, std::span<const std::byte> payload)
+        {
+            const int matType = record.matType;
+            if (record.rows < 0 || record.cols < 0 || matType != CV_MAKETYPE(CV_MAT_DEPTH(matType), CV_MAT_CN(matType)))
+            {
+                return std::nullopt;
+            }
+
+            // Divide rather than multiply, so a corrupt row count cannot overflow into a matching size
+            const uint64_t rows = static_cast<uint64_t>(record.rows);
+            const uint64_t rowBytes = static_cast<uint64_t>(record.cols) * CV_ELEM_SIZE(matType);
+            const bool sizeMatches = rowBytes == 0 ? payload.empty()
+                                                   : payload.size() % rowBytes == 0 && payload.size() / rowBytes == rows;
+            if (!sizeMatches)
+            {
+                return std::nullopt;
+            }
+            // Copy into a fresh (continuous) Mat so the result outlives the mapping
+            cv::Mat image(record.rows, record.cols, matType);
+            if (!payload.empty())
+            {
+                std::memcpy(image.ptr(0), payload.data(), payload.size());
+            }
+            return image;
+        }
+
+        std::optional<NodeData> Decode(const OutputRecord &record, std::span<const std::byte> payload)
+        {
+            switch (record.type)
+            {
+            case OutputType::Empty:
+                return NodeData{};
+            case OutputType::Image:
+                if (auto image = DecodeImage(record, payload))
+                {
+                    return std::move(*image);
+                }
+                return std::nullopt;
+            case OutputType::DeviceImage:
+                if (const auto image = DecodeImage(record, payload))
+                {
+                    cv::UMat device;
+                    image->copyTo(device);
+                    return device;
+                }
+                return std::nullopt;
+            case OutputType::GpuImage:
+#if VISION_CRAFT_WITH_CUDA
+                if (const auto image = DecodeImage(record, payload))
+                {
+                    cv::cuda::GpuMat device;
+                    device.upload(*image);
+                    return device;
+                }
+#endif
+                return std::nullopt;
+            case OutputType::Pyramid:
+                if (auto image = DecodeImage(record, payload))
+                {
+                    const bool area = UnpackScalar<uint32_t>(record.scalar) != 0;
+                    return ImagePyramid(
+                        std::move(*image), area ? ImagePyramid::Filter::Area : ImagePyramid::Filter::Gaussian);
+                }
+                return std::nullopt;
+            case OutputType::Mask:
+                if (auto words = DecodeImage(record, payload))
+                {
+                    try
+                    {
+                        return BitMask::FromWords(std::move(*words), UnpackScalar<int32_t>(record.scalar));
+                    }
+                    catch (const std::invalid_argument &)
+                    {
+                        return std::nullopt; // Corrupt entry; the node runs again
+                    }
+                }
+                return std::nullopt;
+            case OutputType::Contours:
+                if (auto storage = DecodeImage(record, payload))
+                {
+                    try
+                    {
+                        return ContourSet::FromStorage(std::move(*storage));
+                    }
+                    catch (const std::invalid_argument &)
+                    {
+                        return std::nullopt;
+                    }
+                }
+                return std::nullopt;
+            case OutputType::Batch:
+                if (auto storage = DecodeImage(record, payload))
+                {
+                    try
+                    {
+                        return ImageBatch::FromStorage(std::move(*storage), UnpackScalar<uint64_t>(record.scalar));
+                    }
+                    catch (const std::invalid_argument &)
+                    {
+                        return std::nullopt;
+                    }
+                }
+                return std::nullopt;
+            case OutputType::Double:
+                return UnpackScalar<double>(record.scalar);
+            case OutputType::Float:
+                return UnpackScalar<float>(record.scalar);
+            case OutputType::Int:
+                return static_cast<int>(UnpackScalar<int32_t>(record.scalar));
+            case OutputType::Bool:
+                return UnpackScalar<uint8_t>(record.scalar) != 0;
+            case OutputType::String:
+                return std::string(reinterpret_cast<const char *>(payload.data()), payload.size());
+            case OutputType::Path: {
+                const auto *text = reinterpret_cast<const char8_t *>(payload.data());
+                return std::filesystem::path(std::u8string(text, text + payload.size()));
+            }
+            case OutputType::Points: {
+                if (payload.size() % (2 * sizeof(int32_t)) != 0)
+                {
+                    return std::nullopt;
+                }
+                std::vector<cv::Point> points(payload.size() / (2 * sizeof(int32_t)));
+                for (size_t i = 0; i < points.size(); ++i)
+                {
+                    std::array<int32_t, 2> coordinates{};
+                    std::memcpy(coordinates.data(), payload.data() + i * sizeof(coordinates), sizeof(coordinates));
+                    points[i] = { coordinates[0], coordinates[1] };
+                }
+                return points;
+            }
+            }
+            return std::nullopt;
+        }
+
+        // Validates a mapped result file and decodes every output, or nothing
+        std::optional<std::vector<std::shared_ptr<const NodeData>>> DecodeFile(std::span<const std::byte> file,
+            uint64_t key)
+        {
+            PersistentOutput::Header header;
+            if (file.size() < sizeof(header))
+            {
+                return std::nullopt;
+            }
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (header.magic != PersistentOutput::kMagic || header.version != PersistentOutput::kVersion
+                || header.byteOrder != PersistentOutput::kByteOrderMark || header.key != key)
+            {
+                return std::nullopt;
+            }
+
+            // The count is 32-bit, so the record array size cannot overflow a 64-bit size_t
+            const size_t payloadOffset = sizeof(header) + size_t{ header.outputCount } * sizeof(OutputRecord);
+            if (payloadOffset > file.size() || header.payloadSize != file.size() - payloadOffset)
+            {
+                return std::nullopt;
+            }
+            const auto payload = file.subspan(payloadOffset);
+
+            std::vector<std::shared_ptr<const NodeData>> outputs;
+            outputs.reserve(header.outputCount);
+            for (size_t index = 0; index < header.outputCount; ++index)
+            {
+                OutputRecord record;
+                std::memcpy(&record, file.data() + sizeof(header) + index * sizeof(record), sizeof(record));
+                if (record.offset > payload.size() || record.length > payload.size() - record.offset)
+                {
+                    return std::nullopt;
+                }
+
+                auto value = Decode(record, payload.subspan(record.offset, record.length));
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                outputs.push_back(std::make_shared<const NodeData>(std::move(*value)));
+            }
+            return outputs;
+        }
+
+        std::optional<uint64_t> ParseKey(const std::filesystem::path &file)
+        {
+            const auto stem = file.stem().string();
+            uint64_t key = 0;
+            const auto [end, error] = std::from_chars(stem.data(), stem.data() + stem.size(), key, 16);
+            if (stem.size() != 16 || error != std::errc{} || end != stem.data() + stem.size())
+            {
+                return std::nullopt;
+            }
+            return key;
+        }
+    } // namespace
+
+    PersistentOutputStore::PersistentOutputStore(std::filesystem::path directory, size_t byteBudget)
+        : directory(std::move(directory)), byteBudget(byteBudget), nextTemporaryId(std::random_device{}())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(this->directory, error);
+        if (error)
+        {
+            LOG_ERROR("Failed to create result cache directory {}: {}", this->directory.string(), error.message());
+            return;
+        }
+
+        // Newest files first, so the index's recency order matches the previous sessions'
+        struct Found
+        {
+            uint64_t key;
+            size_t bytes;
+            std::filesystem::file_time_type modified;
+        };
+        std::vector<Found> found;
+        const auto now = std::filesystem::file_time_type::clock::now();
+        for (const auto &file : std::filesystem::directory_iterator(this->directory, error))
+        {
+            if (!file.is_regular_file(error))
+            {
+                continue;
+            }
+            const auto modified = file.last_write_time(error);
+            if (file.path().extension() == kTemporaryExtension)
+            {
+                if (!error && now - modified > kStaleTemporaryAge)
+                {
+                    std::filesystem::remove(file.path(), error);
+                }
+                continue;
+            }
+            const auto key = file.path().extension() == PersistentOutput::kExtension ? ParseKey(file.path())
+                                                                                      : std::nullopt;
+            const auto bytes = file.file_size(error);
+            if (key && !error)
+            {
+                found.push_back({ *key, static_cast<size_t>(bytes), modified });
+            }
+        }
+        std::ranges::sort(found, [](const Found &a, const Found &b) { return a.modified > b.modified; });
+
+        std::scoped_lock lock(mutex);
+        for (const auto &file : found)
+        {
+            lruOrder.push_back(file.key);
+            entries.emplace(file.key, Entry{ .bytes = file.bytes, .lruPosition = std::prev(lruOrder.end()) });
+            usedBytes += file.bytes;
+        }
+        EvictToBudget();
+        LOG_INFO("Result cache {} holds {} entries ({} MB)",
+            this->directory.string(),
+            entries.size(),
+            usedBytes / (1024 * 1024));
+    }
+
+    bool PersistentOutputStore::CanPersist(const NodeData &data)
+    {
+        if (const auto *mat = std::get_if<cv::Mat>(&data))
+        {
+            return mat->dims <= 2;
+        }
+        if (const auto *umat = std::get_if<cv::UMat>(&data))
+        {
+            return umat->dims <= 2;
+        }
+        if (const auto *view = std::get_if<ChannelView>(&data))
+        {
+            return view->source.dims <= 2;
+        }
+        return true;
+    }
+
+    std::optional<std::vector<std::shared_ptr<const NodeData>>> PersistentOutputStore::Load(uint64_t key)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            if (!entries.contains(key))
+            {
+                stats.misses++;
+                return std::nullopt;
+            }
+        }
+
+        const auto path = GetEntryPath(key);
+        MappedFile file;
+        auto outputs = file.Open(path) ? DecodeFile(file.GetBytes(), key) : std::nullopt;
+        file.Close();
+
+        std::scoped_lock lock(mutex);
+        if (!outputs)
+        {
+            LOG_WARN("Discarding unreadable result cache entry {}", path.string());
+            Remove(key);
+            stats.failures++;
+            stats.misses++;
+            return std::nullopt;
+        }
+
+        // Other sessions sharing the directory see the hit through the modification time
+        std::error_code error;
+        std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+        if (auto it = entries.find(key); it != entries.end())
+        {
+            lruOrder.splice(lruOrder.begin(), lruOrder, it->second.lruPosition);
+        }
+        stats.hits++;
+        return outputs;
+    }
+
+    bool PersistentOutputStore::Save(uint64_t key, const std::vector<std::shared_ptr<const NodeData>> &outputs)
+    {
+        if (outputs.size() > std::numeric_limits<uint32_t>::max())
+        {
+            return false;
+        }
+
+        std::vector<EncodedOutput> encoded;
+        encoded.reserve(outputs.size());
+        uint64_t payloadSize = 0;
+        for (const auto &output : outputs)
+        {
+            auto value = Encode(output);
+            if (!value)
+            {
+                return false;
+            }
+            value->record.offset = payloadSize;
+            payloadSize += value->record.length;
+            encoded.push_back(std::move(*value));
+        }
+
+        const size_t fileSize = sizeof(PersistentOutput::Header) + encoded.size() * sizeof(OutputRecord) + payloadSize;
+        if (fileSize > byteBudget)
+        {
+            return false;
+        }
+
+        const PersistentOutput::Header header{ .magic = PersistentOutput::kMagic,
+            .version = PersistentOutput::kVersion,
+            .byteOrder = PersistentOutput::kByteOrderMark,
+            .outputCount = static_cast<uint32_t>(encoded.size()),
+            .key = key,
+            .payloadSize = payloadSize };
+
+        const auto path = GetEntryPath(key);
+        auto temporaryPath = path;
+        temporaryPath.replace_extension(
+            std::to_string(nextTemporaryId.fetch_add(1, std::memory_order_relaxed)) + kTemporaryExtension);
+
+        MappedFile file;
+        bool written = file.Create(temporaryPath, fileSize);
+        if (written)
+        {
+            auto *destination = file.GetWritableBytes().data();
+            std::memcpy(destination, &header, sizeof(header));
+            auto *records = destination + sizeof(header);
+            auto *payload = records + encoded.size() * sizeof(OutputRecord);
+            for (size_t index = 0; index < encoded.size(); ++index)
+            {
+                std::memcpy(records + index * sizeof(OutputRecord), &encoded[index].record, sizeof(OutputRecord));
+                WritePayload(encoded[index], payload + encoded[index].record.offset);
+            }
+            file.Close();
+
+            std::error_code error;
+            std::filesystem::rename(temporaryPath, path, error);
+            if (error)
+            {
+                LOG_ERROR("Failed to store result cache entry {}: {}", path.string(), error.message());
+                std::filesystem::remove(temporaryPath, error);
+                written = false;
+            }
+        }
+
+        std::scoped_lock lock(mutex);
+        if (!written)
+        {
+            stats.failures++;
+            return false;
+        }
+        Insert(key, fileSize);
+        stats.writes++;
+        return true;
+    }
+
+    void PersistentOutputStore::Erase(uint64_t key)
+    {
+        std::scoped_lock lock(mutex);
+        Remove(key);
+    }
+
+    const std::filesystem::path &PersistentOutputStore::GetDirectory() const
+    {
+        return directory;
+    }
+
+    size_t PersistentOutputStore::GetByteBudget() const
+    {
+        return byteBudget;
+    }
+
+    size_t PersistentOutputStore::GetUsedBytes() const
+    {
+        std::scoped_lock lock(mutex);
+        return usedBytes;
+    }
+
+    size_t PersistentOutputStore::GetEntryCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return entries.size();
+    }
+
+    PersistentOutputStore::Statistics PersistentOutputStore::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void PersistentOutputStore::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        while (!lruOrder.empty())
+        {
+            Remove(lruOrder.front());
+        }
+        stats = {};
+    }
+
+    std::filesystem::path PersistentOutputStore::GetEntryPath(uint64_t key) const
+    {
+        return directory / fmt::format("{:016x}{}", key, PersistentOutput::kExtension);
+    }
+
+    void PersistentOutputStore::Insert(uint64_t key, size_t bytes)
+    {
+        if (auto existing = entries.find(key); existing != entries.end())
+        {
+            usedBytes -= existing->second.bytes;
+            lruOrder.erase(existing->second.lruPosition);
+            entries.erase(existing);
+        }
+
+        lruOrder.push_front(key);
+        entries.emplace(key, Entry{ .bytes = bytes, .lruPosition = lruOrder.begin() });
+        usedBytes += bytes;
+        EvictToBudget();
+    }
+
+    void PersistentOutputStore::Remove(uint64_t key)
+    {
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            return;
+        }
+        usedBytes -= it->second.bytes;
+        lruOrder.erase(it->second.lruPosition);
+        entries.erase(it);
+
+        std::error_code error;
+        std::filesystem::remove(GetEntryPath(key), error);
+    }
+
+    void PersistentOutputStore::EvictToBudget()
+    {
+        while (usedBytes > byteBudget && !lruOrder.empty())
+        {
+            Remove(lruOrder.back());
+            stats.evictions++;
+        }
+    }
+
+} // namespace VisionCraft::Nodes
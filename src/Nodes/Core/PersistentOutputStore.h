@@ -0,0 +1,242 @@
+#pragma once
+
+#include "Nodes/Core/NodeData.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief On-disk records of a persisted node result (one "<key>.vcout" file per NodeOutputCache key).
+     *
+     * A file is a Header, then one OutputRecord per output slot, then the payload holding pixel rows,
+     * strings, paths and point lists. Records are fixed-size and padding-free in host byte order; pixels
+     * are stored raw (not re-encoded), so float images and every Mat type round-trip exactly and loading
+     * costs one copy out of the page cache.
+     */
+    namespace PersistentOutput
+    {
+        /// @brief First bytes of every result file
+        constexpr std::array<char, 4> kMagic{ 'V', 'C', 'O', 'C' };
+
+        /// @brief Format version written by PersistentOutputStore
+        constexpr uint32_t kVersion = 1;
+
+        /// @brief Reads back as a different value when the file was written in the other byte order
+        constexpr uint32_t kByteOrderMark = 0x01020304;
+
+        /// @brief Extension of result files in the store directory
+        constexpr const char *kExtension = ".vcout";
+
+        /**
+         * @brief File header; the payload follows the record array.
+         */
+        struct Header
+        {
+            std::array<char, 4> magic{}; ///< kMagic
+            uint32_t version = 0;        ///< kVersion of the writer
+            uint32_t byteOrder = 0;      ///< kByteOrderMark in the writer's byte order
+            uint32_t outputCount = 0;    ///< OutputRecord entries
+            uint64_t key = 0;            ///< Cache key, repeated from the file name
+            uint64_t payloadSize = 0;    ///< Bytes after the record array
+        };
+
+        /**
+         * @brief NodeData alternative stored in an OutputRecord.
+         */
+        enum class OutputType : uint32_t
+        {
+            Empty = 0,   ///< Slot held no data
+            Image,       ///< cv::Mat pixels in the payload
+            DeviceImage, ///< cv::UMat pixels in the payload (uploaded again on load)
+            GpuImage,    ///< cv::cuda::GpuMat pixels in the payload (CUDA builds only)
+            Double,      ///< double in OutputRecord::scalar
+            Float,       ///< float in OutputRecord::scalar
+            Int,         ///< int in OutputRecord::scalar
+            Bool,        ///< bool in OutputRecord::scalar
+            String,      ///< std::string bytes in the payload
+            Path,        ///< UTF-8 std::filesystem::path in the payload
+            Points,      ///< std::vector<cv::Point> as int32 x,y pairs in the payload
+            Pyramid,     ///< ImagePyramid level 0 pixels in the payload, filter in OutputRecord::scalar
+            Mask,        ///< BitMask words as a CV_8UC1 image in the payload, width in OutputRecord::scalar
+            Contours,    ///< ContourSet buffer (selected contours only) as a CV_32SC1 row in the payload
+            Batch        ///< ImageBatch buffer in the payload, image count in OutputRecord::scalar
+        };
+
+        /**
+         * @brief One output slot value.
+         */
+        struct OutputRecord
+        {
+            OutputType type = OutputType::Empty; ///< Stored alternative
+            int32_t rows = 0;                    ///< Image rows
+            int32_t cols = 0;                    ///< Image columns
+            int32_t matType = 0;                 ///< Image cv::Mat::type()
+            uint64_t offset = 0;                 ///< First payload byte, relative to the payload start
+            uint64_t length = 0;                 ///< Payload byte count
+            std::array<std::byte, 8> scalar{};   ///< Fixed-size value (Double, Float, Int, Bool)
+        };
+
+        static_assert(sizeof(Header) == 32);
+        static_assert(sizeof(OutputRecord) == 40);
+    } // namespace PersistentOutput
+
+    /**
+     * @brief Content-addressed store of node outputs on disk, shared across sessions and processes.
+     *
+     * Backs a NodeOutputCache: results evicted from memory, or computed in an earlier session, are
+     * replayed from "<directory>/<key>.vcout" instead of being recomputed. Keys are NodeOutputCache
+     * keys, which cover node type, node ID and every input value (paths include file size and
+     * modification time), so a stale entry is simply never looked up again and ages out of the LRU
+     * byte budget. Files are written through a writable MappedFile into a temporary name and renamed
+     * into place, so readers in other processes never observe a partial entry.
+     *
+     * All methods are thread-safe; file I/O runs outside the index lock.
+     */
+    class PersistentOutputStore
+    {
+    public:
+        /**
+         * @brief Store counters.
+         */
+        struct Statistics
+        {
+            size_t hits = 0;      ///< Loads served from disk
+            size_t misses = 0;    ///< Loads without an entry
+            size_t writes = 0;    ///< Entries written
+            size_t evictions = 0; ///< Entries deleted to stay under budget
+            size_t failures = 0;  ///< Unreadable entries (deleted) and failed writes
+        };
+
+        /**
+         * @brief Opens store, creating the directory and indexing existing entries.
+         * @param directory Directory holding result files
+         * @param byteBudget Maximum bytes of result files kept on disk
+         * @note Existing entries beyond the budget are evicted oldest first; leftover temporary files are removed.
+         */
+        PersistentOutputStore(std::filesystem::path directory, size_t byteBudget);
+
+        PersistentOutputStore(const PersistentOutputStore &) = delete;
+        PersistentOutputStore &operator=(const PersistentOutputStore &) = delete;
+
+        /**
+         * @brief Checks if a value can be persisted.
+         * @param data Value to check
+         * @return False for images with more than two dimensions
+         */
+        [[nodiscard]] static bool CanPersist(const NodeData &data);
+
+        /**
+         * @brief Loads outputs stored under key.
+         * @param key Cache key from NodeOutputCache::ComputeKey()
+         * @return Values by output SlotIndex (images are copied out of the file), or std::nullopt on a miss
+         */
+        [[nodiscard]] std::optional<std::vector<std::shared_ptr<const NodeData>>> Load(uint64_t key);
+
+        /**
+         * @brief Writes outputs under key, replacing any existing entry.
+         * @param key Cache key from NodeOutputCache::ComputeKey()
+         * @param outputs Values by output SlotIndex (null entries are stored as empty)
+         * @return True if written; false if a value cannot be persisted, the entry exceeds the budget, or I/O failed
+         */
+        bool Save(uint64_t key, const std::vector<std::shared_ptr<const NodeData>> &outputs);
+
+        /**
+         * @brief Deletes the entry stored under key, if any.
+         * @param key Cache key
+         */
+        void Erase(uint64_t key);
+
+        /**
+         * @brief Returns directory holding result files.
+         * @return Store directory
+         */
+        [[nodiscard]] const std::filesystem::path &GetDirectory() const;
+
+        /**
+         * @brief Returns byte budget.
+         * @return Budget in bytes
+         */
+        [[nodiscard]] size_t GetByteBudget() const;
+
+        /**
+         * @brief Returns bytes of indexed result files.
+         * @return Used bytes
+         */
+        [[nodiscard]] size_t GetUsedBytes() const;
+
+        /**
+         * @brief Returns number of indexed entries.
+         * @return Entry count
+         */
+        [[nodiscard]] size_t GetEntryCount() const;
+
+        /**
+         * @brief Returns store counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        /**
+         * @brief Deletes every entry and resets counters.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief Indexed result file.
+         */
+        struct Entry
+        {
+            size_t bytes = 0;                          ///< File size
+            std::list<uint64_t>::iterator lruPosition; ///< Position in recency list
+        };
+
+        /**
+         * @brief Returns result file path for key.
+         * @param key Cache key
+         * @return "<directory>/<16 hex digits>.vcout"
+         */
+        [[nodiscard]] std::filesystem::path GetEntryPath(uint64_t key) const;
+
+        /**
+         * @brief Adds (or refreshes) key as most recently used and evicts to budget.
+         * @param key Cache key
+         * @param bytes File size
+         * @note Caller must hold mutex.
+         */
+        void Insert(uint64_t key, size_t bytes);
+
+        /**
+         * @brief Drops key from the index and deletes its file.
+         * @param key Cache key
+         * @note Caller must hold mutex.
+         */
+        void Remove(uint64_t key);
+
+        /**
+         * @brief Deletes least recently used entries until under budget.
+         * @note Caller must hold mutex.
+         */
+        void EvictToBudget();
+
+        const std::filesystem::path directory;       ///< Store directory
+        const size_t byteBudget;                     ///< Maximum bytes kept on disk
+        mutable std::mutex mutex;                    ///< Guards index and counters
+        std::unordered_map<uint64_t, Entry> entries; ///< Indexed files by key
+        std::list<uint64_t> lruOrder;                ///< Keys, most recently used first
+        size_t usedBytes = 0;                        ///< Bytes of indexed files
+        Statistics stats;                            ///< Hit/miss counters
+        std::atomic<uint64_t> nextTemporaryId;       ///< Temporary file suffix (randomly seeded per store)
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,719 @@
+#include "Nodes/Core/PipelineCompiler.h"
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <queue>
+#include <system_error>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        constexpr std::string_view kBodyIndent = "        ";          // Statements of Run()
+        constexpr std::string_view kStripIndent = "                "; // Statements inside a strip loop
+
+        const std::string kGrayHelper = R"(        // Single-channel images pass as they are, as in the engine
+        cv::Mat ToGray(const cv::Mat &image)
+        {
+            if (image.channels() == 1)
+            {
+                return image;
+            }
+            cv::Mat gray;
+            cv::cvtColor(image, gray, cv::COLOR_BGR2GRAY);
+            return gray;
+        }
+)";
+
+        const std::string kStripHelper = R"(        // Rows per strip, so every stage of a fused run stays in cache
+        int StripRows(const cv::Mat &image)
+        {
+            return std::max(1, static_cast<int>(kStripBytes / std::max<size_t>(1, image.step[0])));
+        }
+)";
+
+        // Shortest text that reads back as the same double, always with a decimal point or exponent
+        std::string FormatDouble(double value)
+        {
+            char buffer[64];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            std::string text(buffer, result.ptr);
+            if (text.find_first_of(".e") == std::string::npos)
+            {
+                text += ".0";
+            }
+            return text;
+        }
+
+        std::string PascalCase(std::string_view text)
+        {
+            std::string identifier = PipelineCompiler::MakeIdentifier(text);
+            identifier[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(identifier[0])));
+            return identifier;
+        }
+
+        std::string VariableName(NodeId id, std::string_view slotName)
+        {
+            return "n" + std::to_string(id) + PascalCase(slotName);
+        }
+
+        std::string StripName(NodeId id)
+        {
+            return "n" + std::to_string(id) + "Strip";
+        }
+
+        // C++ type of a declared slot type, or empty if such values are not compiled
+        std::string_view GetCppType(SlotDataType type)
+        {
+            switch (type)
+            {
+            case SlotDataType::Image:
+                return "cv::Mat";
+            case SlotDataType::Double:
+                return "double";
+            case SlotDataType::Float:
+                return "float";
+            case SlotDataType::Int:
+                return "int";
+            case SlotDataType::Bool:
+                return "bool";
+            default:
+                return {};
+            }
+        }
+
+        std::string DescribeNode(const Node &node)
+        {
+            return "Node '" + node.GetName() + "' (" + std::to_string(node.GetId()) + ", " + node.GetType() + ")";
+        }
+
+        // A field name unique within its struct; clashing node names get the node ID appended
+        std::string MakeFieldName(const Node &node, std::vector<std::string> &taken)
+        {
+            std::string name = PipelineCompiler::MakeIdentifier(node.GetName());
+            if (std::ranges::find(taken, name) != taken.end())
+            {
+                name += std::to_string(node.GetId());
+            }
+            taken.push_back(name);
+            return name;
+        }
+
+        struct NodeCode
+        {
+            const Node *node = nullptr;
+            PipelineFragment fragment;
+            bool compiled = false;
+        };
+
+        // Everything the generated source collects at file scope, in order of first use
+        struct FileScope
+        {
+            std::set<std::string> includes;
+            std::vector<std::pair<std::string, std::string>> helpers;
+            std::vector<std::string> constants;
+
+            void Add(const PipelineFragment &fragment)
+            {
+                includes.insert(fragment.includes.begin(), fragment.includes.end());
+                for (const auto &helper : fragment.helpers)
+                {
+                    const bool known = std::ranges::any_of(
+                        helpers, [&helper](const auto &existing) { return existing.first == helper.first; });
+                    if (!known)
+                    {
+                        helpers.push_back(helper);
+                    }
+                }
+                constants.insert(constants.end(), fragment.constants.begin(), fragment.constants.end());
+            }
+        };
+    } // namespace
+
+    PipelineCodeWriter::PipelineCodeWriter(const Node &node,
+        std::unordered_map<std::string, std::string> inputs,
+        std::unordered_map<std::string, std::string> outputs)
+        : node(node), inputs(std::move(inputs)), outputs(std::move(outputs))
+    {
+    }
+
+    std::string PipelineCodeWriter::Input(const std::string &slotName)
+    {
+        const auto found = inputs.find(slotName);
+        if (found == inputs.end())
+        {
+            return {};
+        }
+        if (std::ranges::find(fragment.consumedInputs, slotName) == fragment.consumedInputs.end())
+        {
+            fragment.consumedInputs.push_back(slotName);
+        }
+        return found->second;
+    }
+
+    std::string PipelineCodeWriter::Output(const std::string &slotName)
+    {
+        if (std::ranges::find(fragment.outputs, slotName) == fragment.outputs.end())
+        {
+            fragment.outputs.push_back(slotName);
+        }
+        const auto found = outputs.find(slotName);
+        return found != outputs.end() ? found->second : VariableName(node.GetId(), slotName);
+    }
+
+    std::string PipelineCodeWriter::Constant(const std::string &name, double value)
+    {
+        if (!std::isfinite(value))
+        {
+            Fail("parameter " + name + " is not finite");
+            return "0.0";
+        }
+        return DeclareConstant(name, "double", FormatDouble(value));
+    }
+
+    std::string PipelineCodeWriter::Constant(const std::string &name, int value)
+    {
+        return DeclareConstant(name, "int", std::to_string(value));
+    }
+
+    std::string PipelineCodeWriter::Constant(const std::string &name, bool value)
+    {
+        return DeclareConstant(name, "bool", value ? "true" : "false");
+    }
+
+    std::string PipelineCodeWriter::Static(const std::string &name,
+        const std::string &type,
+        const std::string &initializer)
+    {
+        const std::string identifier = "kNode" + std::to_string(node.GetId()) + PascalCase(name);
+        fragment.constants.push_back("const " + type + " " + identifier + " = " + initializer + ";");
+        return identifier;
+    }
+
+    std::string PipelineCodeWriter::Gray(const std::string &image)
+    {
+        Include("<opencv2/imgproc.hpp>");
+        const bool known = std::ranges::any_of(
+            fragment.helpers, [](const auto &helper) { return helper.first == "ToGray"; });
+        if (!known)
+        {
+            fragment.helpers.emplace_back("ToGray", kGrayHelper);
+        }
+        return "ToGray(" + image + ")";
+    }
+
+    void PipelineCodeWriter::Include(std::string header)
+    {
+        fragment.includes.insert(std::move(header));
+    }
+
+    void PipelineCodeWriter::Line(std::string line)
+    {
+        fragment.lines.push_back(std::move(line));
+    }
+
+    void PipelineCodeWriter::SetPointwise()
+    {
+        fragment.pointwise = true;
+    }
+
+    void PipelineCodeWriter::BindPipelineInput(const std::string &slotName)
+    {
+        [[maybe_unused]] const auto variable = Output(slotName);
+        fragment.pipelineInput = slotName;
+    }
+
+    void PipelineCodeWriter::BindPipelineOutput(const std::string &slotName)
+    {
+        [[maybe_unused]] const auto expression = Input(slotName);
+        fragment.pipelineOutput = slotName;
+    }
+
+    bool PipelineCodeWriter::Fail(std::string reason)
+    {
+        if (fragment.error.empty())
+        {
+            fragment.error = std::move(reason);
+        }
+        return false;
+    }
+
+    std::string PipelineCodeWriter::DeclareConstant(const std::string &name,
+        const std::string &type,
+        const std::string &value)
+    {
+        const std::string identifier = "kNode" + std::to_string(node.GetId()) + PascalCase(name);
+        fragment.constants.push_back("constexpr " + type + " " + identifier + " = " + value + ";");
+        return identifier;
+    }
+
+    std::optional<CompiledPipeline> PipelineCompiler::Compile(const NodeEditor &editor,
+        const PipelineCompileOptions &options,
+        std::string &error)
+    {
+        std::vector<Connection> connections;
+        for (auto &connection : editor.GetConnections())
+        {
+            if (connection.type != ConnectionType::Data)
+            {
+                continue;
+            }
+            if (const auto mismatch = editor.CheckConnectionTypes(connection))
+            {
+                error = *mismatch;
+                return std::nullopt;
+            }
+            connections.push_back(std::move(connection));
+        }
+
+        // Data dependencies decide the order; ties go to the lower node ID so the output is reproducible
+        const auto ids = editor.GetNodeIds();
+        std::unordered_map<NodeId, size_t> pendingInputs;
+        for (const auto &connection : connections)
+        {
+            ++pendingInputs[connection.to];
+        }
+        std::priority_queue<NodeId, std::vector<NodeId>, std::greater<>> ready;
+        for (const auto id : ids)
+        {
+            if (pendingInputs[id] == 0)
+            {
+                ready.push(id);
+            }
+        }
+        std::vector<NodeId> order;
+        while (!ready.empty())
+        {
+            const NodeId id = ready.top();
+            ready.pop();
+            order.push_back(id);
+            for (const auto &connection : connections)
+            {
+                if (connection.from == id && --pendingInputs[connection.to] == 0)
+                {
+                    ready.push(connection.to);
+                }
+            }
+        }
+        if (order.size() != ids.size())
+        {
+            error = "Graph has a cycle";
+            return std::nullopt;
+        }
+
+        // Whole-image bindings: every connected input reads its producer's variable
+        const auto wholeImageInputs = [&connections](NodeId id) {
+            std::unordered_map<std::string, std::string> inputs;
+            for (const auto &connection : connections)
+            {
+                if (connection.to == id)
+                {
+                    inputs[connection.toSlot.Str()] = VariableName(connection.from, connection.fromSlot.Str());
+                }
+            }
+            return inputs;
+        };
+        const auto generate = [](const Node &node, std::unordered_map<std::string, std::string> inputs,
+                                  std::unordered_map<std::string, std::string> outputs) {
+            PipelineCodeWriter writer(node, std::move(inputs), std::move(outputs));
+            NodeCode code{ .node = &node };
+            try
+            {
+                code.compiled = node.GeneratePipelineCode(writer) && writer.GetFragment().error.empty();
+            }
+            catch (const std::exception &e)
+            {
+                writer.Fail(e.what());
+            }
+            code.fragment = writer.GetFragment();
+            return code;
+        };
+
+        std::unordered_map<NodeId, NodeCode> codes;
+        for (const auto id : order)
+        {
+            codes.emplace(id, generate(*editor.GetNode(id), wholeImageInputs(id), {}));
+        }
+
+        // Only nodes some pipeline output depends on are compiled; unknown nodes count every input as read
+        std::vector<NodeId> pending;
+        for (const auto id : order)
+        {
+            if (codes[id].compiled && codes[id].fragment.pipelineOutput)
+            {
+                pending.push_back(id);
+            }
+        }
+        if (pending.empty())
+        {
+            error = "Graph has no output node to compile";
+            return std::nullopt;
+        }
+        std::set<NodeId> live;
+        while (!pending.empty())
+        {
+            const NodeId id = pending.back();
+            pending.pop_back();
+            if (!live.insert(id).second)
+            {
+                continue;
+            }
+            const auto &code = codes[id];
+            for (const auto &connection : connections)
+            {
+                if (connection.to == id &&
+                    (!code.compiled || std::ranges::find(code.fragment.consumedInputs, connection.toSlot.Str()) !=
+                                           code.fragment.consumedInputs.end()))
+                {
+                    pending.push_back(connection.from);
+                }
+            }
+        }
+
+        CompiledPipeline pipeline;
+        pipeline.name = MakeIdentifier(options.name);
+        for (const auto id : order)
+        {
+            (live.contains(id) ? pipeline.nodes : pipeline.skipped).push_back(id);
+        }
+
+        for (const auto id : pipeline.nodes)
+        {
+            const auto &code = codes[id];
+            const Node &node = *code.node;
+            if (!code.compiled)
+            {
+                error = DescribeNode(node) + " cannot be compiled" +
+                        (code.fragment.error.empty() ? std::string(": no compiled form") : ": " + code.fragment.error);
+                return std::nullopt;
+            }
+            for (const auto &connection : connections)
+            {
+                const auto &slot = connection.toSlot.Str();
+                if (connection.to == id && std::ranges::find(code.fragment.consumedInputs, slot) ==
+                                               code.fragment.consumedInputs.end())
+                {
+                    error = DescribeNode(node) + ": connected input '" + slot +
+                            "' cannot be compiled (parameters are baked in as constants)";
+                    return std::nullopt;
+                }
+            }
+            for (const auto &slot : code.fragment.outputs)
+            {
+                if (!node.HasOutputSlot(slot) || GetCppType(node.GetOutputSlot(slot).GetDataType()).empty())
+                {
+                    error = DescribeNode(node) + ": output '" + slot + "' has no compiled type";
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Runs of pointwise nodes, each output feeding only the next node's "Input" (left-out nodes do not count)
+        const auto fusable = [&codes, &live](NodeId id) {
+            const auto &fragment = codes[id].fragment;
+            return live.contains(id) && fragment.pointwise && !fragment.pipelineInput && !fragment.pipelineOutput &&
+                   fragment.consumedInputs == std::vector<std::string>{ "Input" } &&
+                   fragment.outputs == std::vector<std::string>{ "Output" };
+        };
+        const auto nextInChain = [&connections, &fusable, &live](NodeId id) -> std::optional<NodeId> {
+            std::optional<NodeId> next;
+            for (const auto &connection : connections)
+            {
+                if (connection.from != id || !live.contains(connection.to))
+                {
+                    continue;
+                }
+                if (next || connection.toSlot.Str() != "Input" || !fusable(connection.to))
+                {
+                    return std::nullopt;
+                }
+                next = connection.to;
+            }
+            return next;
+        };
+        std::unordered_map<NodeId, std::vector<NodeId>> chains;
+        std::set<NodeId> chained;
+        if (options.fusePointwise)
+        {
+            for (const auto id : pipeline.nodes)
+            {
+                if (chained.contains(id) || !fusable(id))
+                {
+                    continue;
+                }
+                std::vector<NodeId> chain{ id };
+                while (const auto next = nextInChain(chain.back()))
+                {
+                    chain.push_back(*next);
+                }
+                if (chain.size() >= 2)
+                {
+                    chained.insert(chain.begin(), chain.end());
+                    chains.emplace(id, std::move(chain));
+                }
+            }
+        }
+        pipeline.fusedChains = chains.size();
+
+        FileScope scope;
+        std::vector<std::string> inputFields;
+        std::vector<std::string> outputFields;
+        std::vector<std::string> inputNames;
+        std::vector<std::string> outputNames;
+        std::vector<std::string> body;
+        const auto emit = [&body](std::string_view indent, const std::vector<std::string> &lines) {
+            for (const auto &line : lines)
+            {
+                body.push_back(std::string(indent) + line);
+            }
+        };
+        const auto outputType = [&codes](NodeId id, const std::string &slot) {
+            return std::string(GetCppType(codes[id].node->GetOutputSlot(slot).GetDataType()));
+        };
+
+        for (const auto id : pipeline.nodes)
+        {
+            const auto &code = codes[id];
+            const Node &node = *code.node;
+            if (chained.contains(id) && !chains.contains(id))
+            {
+                continue;
+            }
+
+            if (const auto chain = chains.find(id); chain != chains.end())
+            {
+                std::string title;
+                for (const auto member : chain->second)
+                {
+                    title += (title.empty() ? "" : " -> ") + codes[member].node->GetName() + " (" +
+                             std::to_string(member) + ")";
+                }
+                const NodeId last = chain->second.back();
+                const std::string result = VariableName(last, "Output");
+                body.push_back(std::string(kBodyIndent) + "// " + title + ", fused over row strips");
+                body.push_back(std::string(kBodyIndent) + "cv::Mat " + result + ";");
+                body.push_back(std::string(kBodyIndent) + "{");
+                body.push_back(std::string(kBodyIndent) + "    const cv::Mat &source = " +
+                               wholeImageInputs(id).at("Input") + ";");
+                body.push_back(std::string(kBodyIndent) + "    const int stripRows = StripRows(source);");
+                for (const auto member : chain->second)
+                {
+                    body.push_back(std::string(kBodyIndent) + "    cv::Mat " + StripName(member) + ";");
+                }
+                body.push_back(std::string(kBodyIndent) + "    for (int row = 0; row < source.rows; row += stripRows)");
+                body.push_back(std::string(kBodyIndent) + "    {");
+                body.push_back(std::string(kStripIndent) +
+                               "const cv::Range rows(row, std::min(row + stripRows, source.rows));");
+                std::string stripInput = "source.rowRange(rows)";
+                for (const auto member : chain->second)
+                {
+                    const auto stripCode = generate(*codes[member].node,
+                        { { "Input", stripInput } },
+                        { { "Output", StripName(member) } });
+                    scope.Add(stripCode.fragment);
+                    emit(kStripIndent, stripCode.fragment.lines);
+                    stripInput = StripName(member);
+                }
+                body.push_back(std::string(kStripIndent) + "if (row == 0)");
+                body.push_back(std::string(kStripIndent) + "{");
+                body.push_back(std::string(kStripIndent) + "    " + result + ".create(source.rows, " + stripInput +
+                               ".cols, " + stripInput + ".type());");
+                body.push_back(std::string(kStripIndent) + "}");
+                body.push_back(std::string(kStripIndent) + stripInput + ".copyTo(" + result + ".rowRange(rows));");
+                body.push_back(std::string(kBodyIndent) + "    }");
+                body.push_back(std::string(kBodyIndent) + "}");
+                continue;
+            }
+
+            scope.Add(code.fragment);
+            body.push_back(std::string(kBodyIndent) + "// " + node.GetName() + " (" + std::to_string(id) + ")");
+            for (const auto &slot : code.fragment.outputs)
+            {
+                const std::string type = outputType(id, slot);
+                if (code.fragment.pipelineInput == slot)
+                {
+                    const std::string field = MakeFieldName(node, inputNames);
+                    inputFields.push_back(type + " " + field + "; ///< " + node.GetName() + " (node " +
+                                          std::to_string(id) + ")");
+                    body.push_back(std::string(kBodyIndent) + "const " + type + " &" + VariableName(id, slot) +
+                                   " = inputs." + field + ";");
+                }
+                else
+                {
+                    body.push_back(std::string(kBodyIndent) + type + " " + VariableName(id, slot) +
+                                   (type == "cv::Mat" ? ";" : "{};"));
+                }
+            }
+            emit(kBodyIndent, code.fragment.lines);
+            if (const auto &slot = code.fragment.pipelineOutput)
+            {
+                const auto source = std::ranges::find_if(connections, [id, &slot](const auto &connection) {
+                    return connection.to == id && connection.toSlot.Str() == *slot;
+                });
+                if (source == connections.end())
+                {
+                    error = DescribeNode(node) + ": input '" + *slot + "' is not connected";
+                    return std::nullopt;
+                }
+                const std::string field = MakeFieldName(node, outputNames);
+                outputFields.push_back(outputType(source->from, source->fromSlot.Str()) + " " + field + "; ///< " +
+                                       node.GetName() + " (node " + std::to_string(id) + ")");
+                body.push_back(std::string(kBodyIndent) + "outputs." + field + " = " +
+                               VariableName(source->from, source->fromSlot.Str()) + ";");
+            }
+        }
+
+        if (!chains.empty())
+        {
+            scope.includes.insert("<algorithm>");
+            scope.includes.insert("<cstddef>");
+            scope.constants.insert(scope.constants.begin(),
+                "constexpr size_t kStripBytes = " + std::to_string(Constants::Tiling::kFusedStripBytes) + ";");
+            scope.helpers.emplace_back("StripRows", kStripHelper);
+        }
+
+        const std::string banner = "// Generated by VisionCraft" +
+                                   (options.source.empty() ? std::string() : " from " + options.source) +
+                                   ". Do not edit; compile the graph again instead.\n";
+        const auto fieldLines = [](const std::vector<std::string> &fields) {
+            std::string text;
+            for (const auto &field : fields)
+            {
+                text += "        " + field + "\n";
+            }
+            return text;
+        };
+
+        pipeline.header = banner + "#pragma once\n\n#include <opencv2/core.hpp>\n\nnamespace " + pipeline.name +
+                          "\n{\n"
+                          "    /**\n"
+                          "     * @brief Images the pipeline reads, one per image input node.\n"
+                          "     */\n"
+                          "    struct Inputs\n    {\n" +
+                          fieldLines(inputFields) +
+                          "    };\n\n"
+                          "    /**\n"
+                          "     * @brief Results the pipeline returns, one per image output node.\n"
+                          "     */\n"
+                          "    struct Outputs\n    {\n" +
+                          fieldLines(outputFields) +
+                          "    };\n\n"
+                          "    /**\n"
+                          "     * @brief Runs the compiled graph once.\n"
+                          "     * @param inputs Pipeline inputs\n"
+                          "     * @param outputs Receives the results\n"
+                          "     * @note Keeps no state between calls; concurrent calls need their own Outputs.\n"
+                          "     */\n"
+                          "    void Run(const Inputs &inputs, Outputs &outputs);\n"
+                          "} // namespace " +
+                          pipeline.name + "\n";
+
+        std::string source = banner + "#include \"" + pipeline.name + ".h\"\n\n";
+        for (const auto &include : scope.includes)
+        {
+            source += "#include " + include + "\n";
+        }
+        source += "\nnamespace " + pipeline.name + "\n{\n";
+        if (!scope.constants.empty() || !scope.helpers.empty())
+        {
+            source += "    namespace\n    {\n";
+            for (const auto &constant : scope.constants)
+            {
+                source += "        " + constant + "\n";
+            }
+            for (const auto &[name, definition] : scope.helpers)
+            {
+                source += "\n" + definition;
+            }
+            source += "    } // namespace\n\n";
+        }
+        source += "    void Run([[maybe_unused]] const Inputs &inputs, Outputs &outputs)\n    {\n";
+        for (const auto &line : body)
+        {
+            source += line + "\n";
+        }
+        source += "    }\n} // namespace " + pipeline.name + "\n";
+        pipeline.source = std::move(source);
+
+        pipeline.cmakeLists = "#" + banner.substr(2) +
+                              "cmake_minimum_required(VERSION 3.16)\n"
+                              "project(" + pipeline.name + " LANGUAGES CXX)\n\n"
+                              "find_package(OpenCV REQUIRED COMPONENTS core imgproc)\n\n"
+                              "add_library(" + pipeline.name + " STATIC " + pipeline.name + ".cpp)\n"
+                              "target_include_directories(" + pipeline.name + " PUBLIC ${CMAKE_CURRENT_SOURCE_DIR})\n"
+                              "target_link_libraries(" + pipeline.name + " PUBLIC opencv_core opencv_imgproc)\n"
+                              "target_compile_features(" + pipeline.name + " PUBLIC cxx_std_17)\n";
+        return pipeline;
+    }
+
+    bool PipelineCompiler::WriteFiles(const CompiledPipeline &pipeline,
+        const std::filesystem::path &directory,
+        std::string &error)
+    {
+        std::error_code fileError;
+        std::filesystem::create_directories(directory, fileError);
+        if (fileError)
+        {
+            error = "Cannot create " + directory.string() + ": " + fileError.message();
+            return false;
+        }
+
+        const std::pair<std::filesystem::path, const std::string *> files[] = {
+            { directory / (pipeline.name + ".h"), &pipeline.header },
+            { directory / (pipeline.name + ".cpp"), &pipeline.source },
+            { directory / "CMakeLists.txt", &pipeline.cmakeLists },
+        };
+        for (const auto &[path, text] : files)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << *text;
+            if (!file)
+            {
+                error = "Cannot write " + path.string();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::string PipelineCompiler::MakeIdentifier(std::string_view text)
+    {
+        std::string identifier;
+        bool wordStart = false;
+        for (const char character : text)
+        {
+            const auto byte = static_cast<unsigned char>(character);
+            if (!std::isalnum(byte))
+            {
+                wordStart = !identifier.empty();
+                continue;
+            }
+            if (identifier.empty())
+            {
+                identifier += static_cast<char>(std::tolower(byte));
+            }
+            else
+            {
+                identifier += wordStart ? static_cast<char>(std::toupper(byte)) : character;
+            }
+            wordStart = false;
+        }
+        if (identifier.empty())
+        {
+            return "node";
+        }
+        if (std::isdigit(static_cast<unsigned char>(identifier[0])))
+        {
+            identifier.insert(0, "n");
+        }
+        return identifier;
+    }
+} // namespace VisionCraft::Nodes
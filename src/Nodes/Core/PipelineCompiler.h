@@ -0,0 +1,227 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    class NodeEditor;
+
+    /**
+     * @brief Code one node contributed to a compiled pipeline, collected by PipelineCodeWriter.
+     */
+    struct PipelineFragment
+    {
+        std::vector<std::string> lines;                           ///< Statements, in order (relative indentation)
+        std::set<std::string> includes;                           ///< Headers in include syntax
+        std::vector<std::pair<std::string, std::string>> helpers; ///< Shared helper functions (name, definition)
+        std::vector<std::string> constants;                       ///< File-scope constant declarations
+        std::vector<std::string> consumedInputs;                  ///< Input slots read through Input()
+        std::vector<std::string> outputs;                         ///< Output slots written through Output()
+        std::optional<std::string> pipelineInput;                 ///< Output slot fed from the pipeline's inputs
+        std::optional<std::string> pipelineOutput;                ///< Input slot returned in the pipeline's outputs
+        bool pointwise = false;                                   ///< Output pixels depend only on the same input pixel
+        std::string error;                                        ///< Why the node cannot be compiled
+    };
+
+    /**
+     * @brief Interface through which a node writes its part of a compiled pipeline.
+     *
+     * Passed to Node::GeneratePipelineCode(). Statements refer to data only through the expressions Input()
+     * and Output() return, so PipelineCompiler can bind them to whole images or, for fused pointwise runs, to
+     * row strips. Parameters are baked in with Constant(): the generated function contains no Node objects,
+     * slots or variants, only the calls the node would make with its current settings.
+     */
+    class PipelineCodeWriter
+    {
+    public:
+        /**
+         * @brief Creates a writer for one node.
+         * @param node Node being compiled
+         * @param inputs Expression of each connected input slot
+         * @param outputs Variable of each output slot
+         */
+        PipelineCodeWriter(const Node &node,
+            std::unordered_map<std::string, std::string> inputs,
+            std::unordered_map<std::string, std::string> outputs);
+
+        /**
+         * @brief Returns the expression holding a connected input's value.
+         * @param slotName Input slot name
+         * @return Expression, or an empty string if the slot is not connected
+         * @note Connected inputs a node never reads through here make the graph fail to compile.
+         */
+        [[nodiscard]] std::string Input(const std::string &slotName);
+
+        /**
+         * @brief Returns the variable an output's value is assigned to.
+         * @param slotName Output slot name
+         * @return Variable name
+         */
+        [[nodiscard]] std::string Output(const std::string &slotName);
+
+        /**
+         * @brief Declares a file-scope constexpr parameter.
+         * @param name Parameter name (unique within the node)
+         * @param value Value to bake in
+         * @return Identifier of the constant
+         */
+        [[nodiscard]] std::string Constant(const std::string &name, double value);
+        [[nodiscard]] std::string Constant(const std::string &name, int value);
+        [[nodiscard]] std::string Constant(const std::string &name, bool value);
+
+        /**
+         * @brief Declares a file-scope constant built once when the library loads (e.g. a structuring element).
+         * @param name Constant name (unique within the node)
+         * @param type C++ type
+         * @param initializer Initializing expression
+         * @return Identifier of the constant
+         */
+        [[nodiscard]] std::string Static(const std::string &name,
+            const std::string &type,
+            const std::string &initializer);
+
+        /**
+         * @brief Returns an expression converting an image to one channel, as Node::GetDerivedImage() does.
+         * @param image Image expression
+         * @return Expression of the gray image (single-channel images pass as they are)
+         */
+        [[nodiscard]] std::string Gray(const std::string &image);
+
+        /**
+         * @brief Adds a header the node's statements need.
+         * @param header Header in include syntax, e.g. "<opencv2/imgproc.hpp>"
+         */
+        void Include(std::string header);
+
+        /**
+         * @brief Appends one statement line; leading spaces indent it relative to the node's block.
+         * @param line Statement text
+         */
+        void Line(std::string line);
+
+        /**
+         * @brief Marks the node pointwise, so runs of such nodes are fused into one pass over row strips.
+         * @note Only for nodes reading "Input" and writing "Output" with no context around a pixel.
+         */
+        void SetPointwise();
+
+        /**
+         * @brief Makes an output slot an image the pipeline's caller passes in.
+         * @param slotName Output slot name
+         */
+        void BindPipelineInput(const std::string &slotName);
+
+        /**
+         * @brief Makes an input slot an image the pipeline returns to its caller.
+         * @param slotName Input slot name
+         */
+        void BindPipelineOutput(const std::string &slotName);
+
+        /**
+         * @brief Records why the node cannot be compiled.
+         * @param reason Description
+         * @return False, for `return writer.Fail(...)`
+         */
+        bool Fail(std::string reason);
+
+        /**
+         * @brief Returns the code collected so far.
+         * @return Fragment
+         */
+        [[nodiscard]] const PipelineFragment &GetFragment() const
+        {
+            return fragment;
+        }
+
+    private:
+        std::string DeclareConstant(const std::string &name, const std::string &type, const std::string &value);
+
+        const Node &node;                                     ///< Node being compiled
+        std::unordered_map<std::string, std::string> inputs;  ///< Connected input slot -> expression
+        std::unordered_map<std::string, std::string> outputs; ///< Output slot -> variable
+        PipelineFragment fragment;                            ///< Collected code
+    };
+
+    /**
+     * @brief Settings of PipelineCompiler::Compile().
+     */
+    struct PipelineCompileOptions
+    {
+        std::string name = "pipeline"; ///< Namespace, file and library name (made a valid identifier)
+        std::string source;            ///< Where the graph came from, named in the generated comments
+        bool fusePointwise = true;     ///< Fuse runs of pointwise nodes into one pass over row strips
+    };
+
+    /**
+     * @brief Generated sources of one compiled graph.
+     */
+    struct CompiledPipeline
+    {
+        std::string name;            ///< Identifier used for the namespace, files and library
+        std::string header;          ///< <name>.h: Inputs, Outputs and Run()
+        std::string source;          ///< <name>.cpp: constants and the straight-line Run()
+        std::string cmakeLists;      ///< CMakeLists.txt building a static library
+        std::vector<NodeId> nodes;   ///< Nodes compiled, in emission order
+        std::vector<NodeId> skipped; ///< Nodes left out because no pipeline output depends on them
+        size_t fusedChains = 0;      ///< Pointwise runs fused into strip loops
+    };
+
+    /**
+     * @brief Compiles a frozen graph ahead of time into C++ with no dependency on the engine.
+     *
+     * Each node writes its own code through Node::GeneratePipelineCode(); the compiler orders the nodes by
+     * their data connections, drops those no pipeline output depends on, and emits one function, Run(), that
+     * calls the nodes' OpenCV operations directly on local cv::Mat variables with every parameter a constexpr.
+     * Image input nodes become fields of an Inputs struct and image output nodes fields of an Outputs struct.
+     * Runs of two or more pointwise nodes linked "Output" -> "Input" (each output feeding only the next node)
+     * are fused the way NodeEditor fuses them: one loop over row strips of Constants::Tiling::kFusedStripBytes,
+     * so no full-size intermediate image is built.
+     *
+     * A graph compiles only if every node that contributes to an output can (nodes without a compiled form,
+     * such as Branch, ForEach or contour nodes, are rejected by name) and every connection into such a node
+     * feeds an input it reads as data; parameters driven by other nodes are not compiled.
+     */
+    class PipelineCompiler
+    {
+    public:
+        /**
+         * @brief Compiles a graph.
+         * @param editor Editor holding the graph (parameters are read as currently set)
+         * @param options Naming and fusion settings
+         * @param error Receives a description of the first problem on failure
+         * @return Generated sources, or std::nullopt if the graph cannot be compiled
+         */
+        [[nodiscard]] static std::optional<CompiledPipeline> Compile(const NodeEditor &editor,
+            const PipelineCompileOptions &options,
+            std::string &error);
+
+        /**
+         * @brief Writes the header, source and CMakeLists.txt of a compiled pipeline into a directory.
+         * @param pipeline Compiled pipeline
+         * @param directory Target directory (created if missing)
+         * @param error Receives a description of the problem on failure
+         * @return True if all files were written
+         */
+        [[nodiscard]] static bool WriteFiles(const CompiledPipeline &pipeline,
+            const std::filesystem::path &directory,
+            std::string &error);
+
+        /**
+         * @brief Turns arbitrary text into a lowerCamelCase C++ identifier.
+         * @param text Text such as a node or file name
+         * @return Identifier ("node" if the text holds no letters or digits)
+         */
+        [[nodiscard]] static std::string MakeIdentifier(std::string_view text);
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,86 @@
+#include "Nodes/Core/PlanarImage.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    PlanarImage::PlanarImage(std::vector<cv::Mat> planes) : planes(std::move(planes))
+    {
+        for (auto &plane : this->planes)
+        {
+            const cv::Mat &first = this->planes.front();
+            if (plane.channels() != 1 || plane.size() != first.size() || plane.depth() != first.depth())
+            {
+                throw std::invalid_argument("PlanarImage planes must be single-channel with one size and depth");
+            }
+            if (!plane.isContinuous())
+            {
+                plane = plane.clone();
+            }
+        }
+    }
+
+    PlanarImage PlanarImage::FromInterleaved(const cv::Mat &image)
+    {
+        if (image.empty())
+        {
+            return {};
+        }
+        if (image.channels() == 1)
+        {
+            return PlanarImage({ image });
+        }
+
+        std::vector<cv::Mat> planes(static_cast<size_t>(image.channels()));
+        for (auto &plane : planes)
+        {
+            plane.create(image.size(), image.depth());
+        }
+        cv::split(image, planes);
+        return PlanarImage(std::move(planes));
+    }
+
+    void PlanarImage::ToInterleaved(cv::Mat &destination) const
+    {
+        if (planes.empty())
+        {
+            destination.release();
+            return;
+        }
+        cv::merge(planes, destination);
+    }
+
+    cv::Mat PlanarImage::ToInterleaved() const
+    {
+        if (planes.size() == 1)
+        {
+            return planes.front();
+        }
+        cv::Mat image;
+        ToInterleaved(image);
+        return image;
+    }
+
+    PlanarImage PlanarImage::Clone() const
+    {
+        std::vector<cv::Mat> copies;
+        copies.reserve(planes.size());
+        for (const auto &plane : planes)
+        {
+            copies.push_back(plane.clone());
+        }
+        return PlanarImage(std::move(copies));
+    }
+
+    size_t PlanarImage::GetByteSize() const
+    {
+        size_t bytes = 0;
+        for (const auto &plane : planes)
+        {
+            bytes += plane.total() * plane.elemSize();
+        }
+        return bytes;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Multi-channel image stored as separate single-channel planes (structure of arrays).
+     *
+     * Every plane is a continuous cv::Mat with its own buffer from OpenCV's aligned allocator, so per-channel
+     * loops run over unit-stride memory and vectorize without shuffles. Planes are shared, not copied, when
+     * an image is copied; NodeEditor converts between layouts only where a consumer's
+     * Node::GetPreferredImageLayout() differs from what its producer wrote.
+     */
+    class PlanarImage
+    {
+    public:
+        PlanarImage() = default;
+
+        /**
+         * @brief Wraps existing planes without copying them.
+         * @param planes Single-channel images of one size and depth; non-continuous ones are compacted
+         * @throws std::invalid_argument if planes differ in size or depth or have more than one channel
+         */
+        explicit PlanarImage(std::vector<cv::Mat> planes);
+
+        /**
+         * @brief Splits an interleaved image into planes.
+         * @param image Source image (a single-channel image is shared, not copied)
+         * @return Planar copy of image
+         */
+        [[nodiscard]] static PlanarImage FromInterleaved(const cv::Mat &image);
+
+        /**
+         * @brief Interleaves the planes into one image.
+         * @param destination Output image; its buffer is reused when size and type match
+         */
+        void ToInterleaved(cv::Mat &destination) const;
+
+        /**
+         * @brief Interleaves the planes into a new image.
+         * @return Interleaved image (a single plane is shared, not copied)
+         */
+        [[nodiscard]] cv::Mat ToInterleaved() const;
+
+        /**
+         * @brief Returns deep copy with freshly allocated planes.
+         * @return Copy that shares no buffer with this image
+         */
+        [[nodiscard]] PlanarImage Clone() const;
+
+        /**
+         * @brief Returns whether the image has no pixels.
+         * @return True if there are no planes
+         */
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return planes.empty();
+        }
+
+        /**
+         * @brief Returns number of planes.
+         * @return Channel count
+         */
+        [[nodiscard]] int GetChannelCount() const
+        {
+            return static_cast<int>(planes.size());
+        }
+
+        /**
+         * @brief Returns image size.
+         * @return Size of every plane (empty size if there are none)
+         */
+        [[nodiscard]] cv::Size GetSize() const
+        {
+            return planes.empty() ? cv::Size() : planes.front().size();
+        }
+
+        /**
+         * @brief Returns element depth.
+         * @return OpenCV depth of every plane (CV_8U if there are none)
+         */
+        [[nodiscard]] int GetDepth() const
+        {
+            return planes.empty() ? CV_8U : planes.front().depth();
+        }
+
+        /**
+         * @brief Returns total pixel bytes.
+         * @return Sum of plane sizes in bytes
+         */
+        [[nodiscard]] size_t GetByteSize() const;
+
+        /**
+         * @brief Returns one plane.
+         * @param channel Channel index (0 <= channel < GetChannelCount())
+         * @return Single-channel image sharing the plane buffer
+         */
+        [[nodiscard]] const cv::Mat &GetPlane(int channel) const
+        {
+            return planes[static_cast<size_t>(channel)];
+        }
+
+        /**
+         * @brief Returns all planes in channel order.
+         * @return Planes
+         */
+        [[nodiscard]] const std::vector<cv::Mat> &GetPlanes() const
+        {
+            return planes;
+        }
+
+    private:
+        std::vector<cv::Mat> planes; ///< One continuous single-channel image per channel
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,31 @@
+#include "Nodes/Core/PrecisionPolicy.h"
+
+#include <opencv2/core.hpp>
+
+#include <cstddef>
+
+namespace VisionCraft::Nodes
+{
+    std::string_view GetPrecisionPolicyName(PrecisionPolicy policy)
+    {
+        return kPrecisionPolicyNames[static_cast<size_t>(policy)];
+    }
+
+    std::optional<PrecisionPolicy> ParsePrecisionPolicy(std::string_view name)
+    {
+        for (size_t i = 0; i < kPrecisionPolicyNames.size(); ++i)
+        {
+            if (kPrecisionPolicyNames[i] == name)
+            {
+                return static_cast<PrecisionPolicy>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    int GetFloatStorageDepth(PrecisionPolicy policy)
+    {
+        return policy == PrecisionPolicy::Prefer16 ? CV_16F : CV_32F;
+    }
+
+} // namespace VisionCraft::Nodes
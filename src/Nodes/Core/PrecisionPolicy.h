@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <string_view>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Graph-wide choice of the pixel depth nodes store intermediate results in.
+     *
+     * Nodes that compute at a wider depth than their result needs (a derivative in 16-bit or float, a
+     * magnitude in float) read the policy through Node::GetPrecisionPolicy() and pick their output depth from
+     * it; nodes whose output depth follows their input ignore it. Narrower results halve or quarter the bytes
+     * every downstream node streams through, at the cost of precision a preview or threshold rarely needs.
+     */
+    enum class PrecisionPolicy
+    {
+        Native,   ///< Each node's own output depth (the default)
+        Prefer8U, ///< 8-bit wherever a result fits it (absolute derivatives, saturated magnitudes)
+        Prefer16, ///< 16-bit: CV_16S for integer results, CV_16F storage for float ones
+        Float32   ///< CV_32F for every computed result, including signed derivatives of 8-bit images
+    };
+
+    /// @brief Command line and UI names, in PrecisionPolicy order
+    inline constexpr std::array<std::string_view, 4> kPrecisionPolicyNames{ "native", "8u", "16", "32f" };
+
+    /**
+     * @brief Returns the name of a policy.
+     * @param policy Policy
+     * @return Entry of kPrecisionPolicyNames
+     */
+    [[nodiscard]] std::string_view GetPrecisionPolicyName(PrecisionPolicy policy);
+
+    /**
+     * @brief Parses a policy name.
+     * @param name One of kPrecisionPolicyNames
+     * @return Policy, or std::nullopt for an unknown name
+     */
+    [[nodiscard]] std::optional<PrecisionPolicy> ParsePrecisionPolicy(std::string_view name);
+
+    /**
+     * @brief Returns the depth a node stores a float result in (magnitudes, angles, float derivatives).
+     * @param policy Policy of the run
+     * @return CV_16F under PrecisionPolicy::Prefer16, CV_32F otherwise
+     * @note Prefer8U nodes decide themselves whether a float result fits 8 bits; this is their fallback.
+     */
+    [[nodiscard]] int GetFloatStorageDepth(PrecisionPolicy policy);
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Latest execution progress, published by the threads running steps and sampled by the UI.
+     *
+     * A progress bar drawn once per frame only needs the newest state, so instead of queuing one message per
+     * node the channel keeps that state in two atomics: the started/total counters packed into one word (read
+     * together, so the bar never mixes two runs) and the ID of the node started last. Publishing is one store
+     * and one fetch_add, with no locks, strings or allocation, and any number of workers may publish at once.
+     * Readers resolve the ID to a name themselves, and only when they draw.
+     */
+    class ProgressChannel
+    {
+    public:
+        /**
+         * @brief One reading of the channel.
+         */
+        struct Sample
+        {
+            int started = 0; ///< Steps started in the current run
+            int total = 0;   ///< Steps in the current run (0 before the first run)
+            NodeId node = 0; ///< Node started last (0 = none yet)
+        };
+
+        /**
+         * @brief Resets counters for a new run.
+         * @param total Steps the run will start
+         */
+        void BeginRun(int total) noexcept
+        {
+            node.store(0, std::memory_order_relaxed);
+            state.store(static_cast<uint64_t>(static_cast<uint32_t>(total)) << kTotalShift, std::memory_order_release);
+        }
+
+        /**
+         * @brief Records that a step started.
+         * @param id Node the step runs
+         */
+        void Advance(NodeId id) noexcept
+        {
+            node.store(id, std::memory_order_relaxed);
+            state.fetch_add(1, std::memory_order_release);
+        }
+
+        /**
+         * @brief Reads the latest state.
+         * @return Counters and the last started node
+         * @note The node may belong to a step started just after the counters were read.
+         */
+        [[nodiscard]] Sample Read() const noexcept
+        {
+            const uint64_t packed = state.load(std::memory_order_acquire);
+            return { static_cast<int>(packed & kStartedMask),
+                static_cast<int>(packed >> kTotalShift),
+                node.load(std::memory_order_relaxed) };
+        }
+
+    private:
+        static constexpr unsigned kTotalShift = 32;
+        static constexpr uint64_t kStartedMask = (uint64_t{ 1 } << kTotalShift) - 1;
+
+        std::atomic<uint64_t> state{ 0 }; ///< Total in the high half, started steps in the low half
+        std::atomic<NodeId> node{ 0 };    ///< Node started last
+    };
+
+} // namespace VisionCraft::Nodes
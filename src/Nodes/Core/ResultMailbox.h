@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Latest result of a node, handed from the thread running it to the render thread (triple buffer).
+     *
+     * The publisher fills its own back slot and swaps it into the middle; the reader swaps the middle with
+     * its front slot when a new value arrived. Both sides only exchange one atomic index, so neither ever
+     * waits: a publisher running ahead of the frame rate overwrites results the reader never saw, and the
+     * reader keeps showing its front value until a newer one is published.
+     *
+     * One publisher and one reader: Publish() calls must not overlap, and Refresh()/Latest() belong to a
+     * single reading thread. HasUpdate() may be called from anywhere.
+     *
+     * @tparam T Result type (cheap to move; cv::Mat shares pixels)
+     */
+    template<typename T> class ResultMailbox
+    {
+    public:
+        /**
+         * @brief Publishes a result, replacing any the reader has not taken yet.
+         * @param value New result
+         */
+        void Publish(T value)
+        {
+            slots[back] = std::move(value);
+            back = middle.exchange(static_cast<uint8_t>(back | kFresh), std::memory_order_acq_rel) & kIndexMask;
+            slots[back] = T{}; // The reader is done with this slot; free what it held
+        }
+
+        /**
+         * @brief Checks if a result was published since the last Refresh().
+         * @return True if Refresh() would take a new result
+         */
+        [[nodiscard]] bool HasUpdate() const noexcept
+        {
+            return (middle.load(std::memory_order_acquire) & kFresh) != 0;
+        }
+
+        /**
+         * @brief Takes the newest published result, if any (reader thread).
+         * @return True if Latest() changed
+         */
+        bool Refresh() noexcept
+        {
+            if (!HasUpdate())
+            {
+                return false;
+            }
+            front = middle.exchange(front, std::memory_order_acq_rel) & kIndexMask;
+            return true;
+        }
+
+        /**
+         * @brief Returns the result taken by the last Refresh() (reader thread).
+         * @return Latest taken result (default-constructed before the first one)
+         */
+        [[nodiscard]] const T &Latest() const noexcept
+        {
+            return slots[front];
+        }
+
+    private:
+        static constexpr uint8_t kIndexMask = 0x3;
+        static constexpr uint8_t kFresh = 0x4;
+
+        std::array<T, 3> slots{};         ///< Back, middle and front values, in some order
+        uint8_t back = 0;                 ///< Slot the publisher fills next (publisher only)
+        std::atomic<uint8_t> middle{ 1 }; ///< Slot waiting for the reader, with kFresh if not taken yet
+        uint8_t front = 2;                ///< Slot Latest() returns (reader only)
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,83 @@
+#include "Nodes/Core/RunLengthCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace VisionCraft::Nodes::RunLength
+{
+    std::vector<std::byte> Encode(std::span<const std::byte> input)
+    {
+        std::vector<std::byte> encoded;
+        encoded.reserve(input.size() / 16 + 16);
+
+        size_t literalStart = 0;
+        const auto flushLiterals = [&](size_t end) {
+            while (literalStart < end)
+            {
+                const size_t count = std::min(kMaxLiteral, end - literalStart);
+                encoded.push_back(static_cast<std::byte>(count - 1));
+                encoded.insert(encoded.end(),
+                    input.begin() + static_cast<std::ptrdiff_t>(literalStart),
+                    input.begin() + static_cast<std::ptrdiff_t>(literalStart + count));
+                literalStart += count;
+            }
+        };
+
+        size_t position = 0;
+        while (position < input.size())
+        {
+            const std::byte value = input[position];
+            const size_t limit = std::min(input.size(), position + kMaxRun);
+            size_t end = position + 1;
+            while (end < limit && input[end] == value)
+            {
+                ++end;
+            }
+
+            const size_t run = end - position;
+            if (run >= kMinRun)
+            {
+                flushLiterals(position);
+                encoded.push_back(static_cast<std::byte>(128 + run - kMinRun));
+                encoded.push_back(value);
+                literalStart = end;
+            }
+            position = end;
+        }
+        flushLiterals(input.size());
+        return encoded;
+    }
+
+    bool Decode(std::span<const std::byte> encoded, std::span<std::byte> output)
+    {
+        size_t in = 0;
+        size_t out = 0;
+        while (in < encoded.size())
+        {
+            const auto control = static_cast<size_t>(encoded[in++]);
+            if (control < 128)
+            {
+                const size_t count = control + 1;
+                if (in + count > encoded.size() || out + count > output.size())
+                {
+                    return false;
+                }
+                std::memcpy(output.data() + out, encoded.data() + in, count);
+                in += count;
+                out += count;
+            }
+            else
+            {
+                const size_t count = control - 128 + kMinRun;
+                if (in >= encoded.size() || out + count > output.size())
+                {
+                    return false;
+                }
+                std::memset(output.data() + out, static_cast<int>(encoded[in++]), count);
+                out += count;
+            }
+        }
+        return out == output.size();
+    }
+
+} // namespace VisionCraft::Nodes::RunLength
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Byte-oriented run-length codec (PackBits layout) for low-entropy pixel buffers.
+     *
+     * Each block starts with a control byte: values below 128 are followed by that many plus one literal
+     * bytes, values from 128 up repeat the next byte (value - 128 + kMinRun) times. Binary masks from a
+     * threshold or an edge detector are mostly long runs of 0 and 255 and shrink by well over an order of
+     * magnitude, while noisy images grow by at most one byte per 128. Both directions run at close to
+     * memory speed, so a cache can compress on eviction and decompress on a hit without a worker pool.
+     */
+    namespace RunLength
+    {
+        /// @brief Shortest run stored as a run block (shorter repeats stay in literal blocks)
+        constexpr size_t kMinRun = 3;
+
+        /// @brief Longest run of one block
+        constexpr size_t kMaxRun = 127 + kMinRun;
+
+        /// @brief Longest literal block
+        constexpr size_t kMaxLiteral = 128;
+
+        /**
+         * @brief Compresses bytes.
+         * @param input Bytes to compress
+         * @return Encoded blocks (empty for empty input)
+         */
+        [[nodiscard]] std::vector<std::byte> Encode(std::span<const std::byte> input);
+
+        /**
+         * @brief Decompresses blocks written by Encode().
+         * @param encoded Encoded blocks
+         * @param output Receives the decoded bytes; must be exactly the original size
+         * @return False if the blocks are malformed or do not decode to exactly output.size() bytes
+         */
+        [[nodiscard]] bool Decode(std::span<const std::byte> encoded, std::span<std::byte> output);
+    } // namespace RunLength
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,341 @@
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Logger.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Prometheus label values; node types are identifiers, but plugin packs choose their own
+        std::string EscapeLabel(std::string_view value)
+        {
+            std::string escaped;
+            escaped.reserve(value.size());
+            for (const char c : value)
+            {
+                if (c == '\\' || c == '"')
+                {
+                    escaped += '\\';
+                    escaped += c;
+                }
+                else if (c == '\n')
+                {
+                    escaped += "\\n";
+                }
+                else
+                {
+                    escaped += c;
+                }
+            }
+            return escaped;
+        }
+
+        const char *OutcomeLabel(StepOutcome outcome)
+        {
+            switch (outcome)
+            {
+            case StepOutcome::Processed:
+                return "processed";
+            case StepOutcome::CacheHit:
+                return "cache_hit";
+            case StepOutcome::Aliased:
+                return "aliased";
+            case StepOutcome::Skipped:
+                return "skipped";
+            case StepOutcome::Bypassed:
+                return "bypassed";
+            case StepOutcome::Failed:
+                return "failed";
+            case StepOutcome::Cancelled:
+                return "cancelled";
+            case StepOutcome::NotRun:
+                return "not_run";
+            }
+            return "unknown";
+        }
+
+        const char *StageLabel(PipelineStage stage)
+        {
+            switch (stage)
+            {
+            case PipelineStage::Decode:
+                return "decode";
+            case PipelineStage::Compute:
+                return "compute";
+            case PipelineStage::Encode:
+                return "encode";
+            }
+            return "unknown";
+        }
+
+        // Largest resident set of the process so far (0 where unknown)
+        size_t GetPeakResidentBytes()
+        {
+#if defined(_WIN32)
+            PROCESS_MEMORY_COUNTERS counters{};
+            if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            {
+                return counters.PeakWorkingSetSize;
+            }
+            return 0;
+#else
+            rusage usage{};
+            if (getrusage(RUSAGE_SELF, &usage) != 0)
+            {
+                return 0;
+            }
+#if defined(__APPLE__)
+            return static_cast<size_t>(usage.ru_maxrss); // Bytes
+#else
+            return static_cast<size_t>(usage.ru_maxrss) * 1024; // Kilobytes
+#endif
+#endif
+        }
+
+        void AppendFamily(std::string &text, std::string_view name, std::string_view type, std::string_view help)
+        {
+            fmt::format_to(std::back_inserter(text), "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+        }
+    } // namespace
+
+    RuntimeMetrics &RuntimeMetrics::Get()
+    {
+        static RuntimeMetrics metrics;
+        return metrics;
+    }
+
+    RuntimeMetrics::RuntimeMetrics() : origin(Clock::now())
+    {
+    }
+
+    void RuntimeMetrics::SetEnabled(bool enable)
+    {
+        enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    void RuntimeMetrics::RecordRun(const RunStatistics &run)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        const auto now = Clock::now();
+        std::scoped_lock lock(mutex);
+        ++(run.succeeded ? imagesSucceeded : imagesFailed);
+        imagesTimedOut += run.timedOut ? 1 : 0;
+        runTime += run.totalTime;
+        peakSlotBytes = std::max(peakSlotBytes, run.peakSlotBytes);
+
+        for (const auto &record : run.nodes)
+        {
+            ++stepOutcomes[static_cast<size_t>(record.outcome)];
+            if (record.outcome != StepOutcome::Processed)
+            {
+                continue;
+            }
+
+            auto &latency = nodeLatencies[record.nodeId];
+            if (latency.nodeType != record.nodeType)
+            {
+                latency = { .nodeType = record.nodeType };
+            }
+            const double seconds = std::chrono::duration<double>(record.duration).count();
+            const auto &bounds = Constants::Metrics::kLatencyBucketsSeconds;
+            const auto bucket = static_cast<size_t>(std::lower_bound(std::begin(bounds), std::end(bounds), seconds) -
+                                                    std::begin(bounds));
+            if (bucket < kBucketCount)
+            {
+                ++latency.buckets[bucket];
+            }
+            ++latency.count;
+            latency.sumSeconds += seconds;
+        }
+
+        if (run.succeeded)
+        {
+            const int64_t second = SecondsSinceOrigin(now);
+            auto &slot = throughputWindow[static_cast<size_t>(second) % throughputWindow.size()];
+            if (slot.second != second)
+            {
+                slot = { .second = second };
+            }
+            ++slot.images;
+        }
+    }
+
+    void RuntimeMetrics::SetQueueDepth(PipelineStage stage, size_t depth)
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        std::scoped_lock lock(mutex);
+        queueDepths[static_cast<size_t>(stage)] = depth;
+    }
+
+    double RuntimeMetrics::GetThroughput() const
+    {
+        const auto now = Clock::now();
+        std::scoped_lock lock(mutex);
+        return ComputeThroughput(now);
+    }
+
+    std::string RuntimeMetrics::FormatPrometheus() const
+    {
+        const auto now = Clock::now();
+        const size_t peakResidentBytes = GetPeakResidentBytes();
+        std::scoped_lock lock(mutex);
+        std::string text;
+        auto out = std::back_inserter(text);
+
+        AppendFamily(text, "visioncraft_images_total", "counter",
+            "Graph runs by result; each run processes one image, frame or request");
+        fmt::format_to(out, "visioncraft_images_total{{result=\"succeeded\"}} {}\n", imagesSucceeded);
+        fmt::format_to(out, "visioncraft_images_total{{result=\"failed\"}} {}\n", imagesFailed);
+
+        AppendFamily(text, "visioncraft_images_timed_out_total", "counter", "Failed runs stopped by the timeout");
+        fmt::format_to(out, "visioncraft_images_timed_out_total {}\n", imagesTimedOut);
+
+        AppendFamily(text, "visioncraft_throughput_images_per_second", "gauge",
+            fmt::format("Successful runs per second over the last {} s", Constants::Metrics::kThroughputWindowSeconds));
+        fmt::format_to(out, "visioncraft_throughput_images_per_second {}\n", ComputeThroughput(now));
+
+        AppendFamily(text, "visioncraft_run_seconds_total", "counter", "Wall-clock time spent in graph runs");
+        fmt::format_to(out, "visioncraft_run_seconds_total {}\n", std::chrono::duration<double>(runTime).count());
+
+        AppendFamily(text, "visioncraft_node_steps_total", "counter", "Plan steps by outcome");
+        for (size_t i = 0; i < kOutcomeCount; ++i)
+        {
+            fmt::format_to(out, "visioncraft_node_steps_total{{outcome=\"{}\"}} {}\n",
+                OutcomeLabel(static_cast<StepOutcome>(i)), stepOutcomes[i]);
+        }
+
+        // Steps that had to process are the misses; skipped and aliased steps never consulted the cache
+        const auto hits = stepOutcomes[static_cast<size_t>(StepOutcome::CacheHit)];
+        const auto lookups = hits + stepOutcomes[static_cast<size_t>(StepOutcome::Processed)];
+        AppendFamily(text, "visioncraft_cache_hit_ratio", "gauge", "Steps restored from the output cache per step "
+                                                                   "that was restored or processed");
+        fmt::format_to(out, "visioncraft_cache_hit_ratio {}\n",
+            lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0);
+
+        AppendFamily(text, "visioncraft_node_duration_seconds", "histogram", "Process() time per node");
+        for (const auto &[nodeId, latency] : nodeLatencies)
+        {
+            const std::string labels = fmt::format("node=\"{}\",type=\"{}\"", nodeId, EscapeLabel(latency.nodeType));
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < kBucketCount; ++i)
+            {
+                cumulative += latency.buckets[i];
+                fmt::format_to(out, "visioncraft_node_duration_seconds_bucket{{{},le=\"{}\"}} {}\n", labels,
+                    Constants::Metrics::kLatencyBucketsSeconds[i], cumulative);
+            }
+            fmt::format_to(out, "visioncraft_node_duration_seconds_bucket{{{},le=\"+Inf\"}} {}\n", labels,
+                latency.count);
+            fmt::format_to(out, "visioncraft_node_duration_seconds_sum{{{}}} {}\n", labels, latency.sumSeconds);
+            fmt::format_to(out, "visioncraft_node_duration_seconds_count{{{}}} {}\n", labels, latency.count);
+        }
+
+        AppendFamily(text, "visioncraft_stage_queue_depth", "gauge", "Items waiting for each batch pipeline stage");
+        for (size_t i = 0; i < kStageCount; ++i)
+        {
+            fmt::format_to(out, "visioncraft_stage_queue_depth{{stage=\"{}\"}} {}\n",
+                StageLabel(static_cast<PipelineStage>(i)), queueDepths[i]);
+        }
+
+        AppendFamily(text, "visioncraft_slot_memory_peak_bytes", "gauge",
+            "Highest bytes held in the slots of one graph during a run");
+        fmt::format_to(out, "visioncraft_slot_memory_peak_bytes {}\n", peakSlotBytes);
+
+        AppendFamily(text, "visioncraft_process_resident_peak_bytes", "gauge", "Peak resident memory of the process");
+        fmt::format_to(out, "visioncraft_process_resident_peak_bytes {}\n", peakResidentBytes);
+        return text;
+    }
+
+    bool RuntimeMetrics::WriteFile(const std::filesystem::path &path) const
+    {
+        // Written beside the target and renamed over it, so a scraper never reads half a file; the
+        // textfile collector only reads *.prom, so it also ignores the temporary
+        auto temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file << FormatPrometheus();
+            if (!file)
+            {
+                LOG_ERROR("Failed to write metrics file: {}", temporary.string());
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+        {
+            LOG_ERROR("Failed to replace metrics file {}: {}", path.string(), error.message());
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
+
+    void RuntimeMetrics::Reset()
+    {
+        std::scoped_lock lock(mutex);
+        origin = Clock::now();
+        imagesSucceeded = 0;
+        imagesFailed = 0;
+        imagesTimedOut = 0;
+        runTime = {};
+        stepOutcomes = {};
+        peakSlotBytes = 0;
+        queueDepths = {};
+        nodeLatencies.clear();
+        throughputWindow = {};
+    }
+
+    int64_t RuntimeMetrics::SecondsSinceOrigin(Clock::time_point time) const
+    {
+        return std::chrono::duration_cast<std::chrono::seconds>(time - origin).count();
+    }
+
+    double RuntimeMetrics::ComputeThroughput(Clock::time_point now) const
+    {
+        // The window covers its completed seconds and the elapsed part of the current one
+        const int64_t current = SecondsSinceOrigin(now);
+        const auto window = static_cast<int64_t>(throughputWindow.size());
+        uint64_t images = 0;
+        for (const auto &slot : throughputWindow)
+        {
+            images += slot.second > current - window && slot.second <= current ? slot.images : 0;
+        }
+
+        // At least a second, so a run finishing right after Reset() does not read as a huge rate
+        const double elapsed = std::chrono::duration<double>(now - origin).count();
+        const double partial = elapsed - static_cast<double>(current);
+        const double span = std::min(elapsed, static_cast<double>(window - 1) + partial);
+        return static_cast<double>(images) / std::max(span, 1.0);
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/ExecutionStatistics.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Stage of the decode → compute → encode batch pipeline.
+     */
+    enum class PipelineStage
+    {
+        Decode,  ///< Files not yet read
+        Compute, ///< Decoded images waiting for the graph
+        Encode   ///< Results waiting to be written
+    };
+
+    /**
+     * @brief Process-wide, opt-in service metrics in the Prometheus text exposition format.
+     *
+     * Every NodeEditor feeds its RunStatistics in through RecordRun() as runs finish, which yields image
+     * throughput (each successful run is one image, frame or request), a latency histogram per node,
+     * step outcome counters from which the cache hit ratio follows, and the slot memory high-water mark.
+     * The batch pipeline reports its stage queue depths, and the process's peak resident memory is read
+     * when formatting. The headless runner serves FormatPrometheus() at `/metrics` and writes it to a
+     * file periodically (WriteFile(), readable by node_exporter's textfile collector).
+     *
+     * While disabled, RecordRun() and SetQueueDepth() cost one relaxed atomic load. All methods are
+     * thread-safe.
+     */
+    class RuntimeMetrics
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Returns the process-wide metrics.
+         * @return Metrics instance
+         */
+        [[nodiscard]] static RuntimeMetrics &Get();
+
+        /**
+         * @brief Starts or stops collecting; collected values are kept.
+         * @param enable True to collect
+         */
+        void SetEnabled(bool enable);
+
+        /**
+         * @brief Checks if runs are being collected.
+         * @return True while enabled
+         */
+        [[nodiscard]] bool IsEnabled() const
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Folds one finished run into the counters and histograms.
+         * @param run Statistics of the run
+         */
+        void RecordRun(const RunStatistics &run);
+
+        /**
+         * @brief Sets the number of items waiting for a pipeline stage.
+         * @param stage Stage
+         * @param depth Items waiting
+         */
+        void SetQueueDepth(PipelineStage stage, size_t depth);
+
+        /**
+         * @brief Returns the image rate over the last Constants::Metrics::kThroughputWindowSeconds.
+         * @return Successful runs per second (over the time collected so far while it is shorter, but at
+         *         least a second)
+         */
+        [[nodiscard]] double GetThroughput() const;
+
+        /**
+         * @brief Formats every metric in the Prometheus text exposition format (version 0.0.4).
+         * @return Metric families, each with HELP and TYPE lines
+         */
+        [[nodiscard]] std::string FormatPrometheus() const;
+
+        /**
+         * @brief Writes FormatPrometheus() to a file, replacing it atomically.
+         * @param path Output file (conventionally *.prom)
+         * @return True if the file was written
+         */
+        bool WriteFile(const std::filesystem::path &path) const;
+
+        /**
+         * @brief Forgets every value and restarts the throughput window (for tests).
+         */
+        void Reset();
+
+    private:
+        static constexpr size_t kBucketCount = std::size(Constants::Metrics::kLatencyBucketsSeconds);
+        static constexpr size_t kOutcomeCount = static_cast<size_t>(StepOutcome::NotRun) + 1;
+        static constexpr size_t kStageCount = static_cast<size_t>(PipelineStage::Encode) + 1;
+
+        /**
+         * @brief Process() time histogram of one node.
+         */
+        struct NodeLatency
+        {
+            std::string nodeType;                         ///< Node::GetType()
+            std::array<uint64_t, kBucketCount> buckets{}; ///< Samples at or below each bound (not cumulative)
+            uint64_t count = 0;                           ///< Samples
+            double sumSeconds = 0.0;                      ///< Total Process() time
+        };
+
+        /**
+         * @brief Successful runs within one second of the throughput window.
+         */
+        struct SecondBucket
+        {
+            int64_t second = -1; ///< Second since the origin the count belongs to
+            uint64_t images = 0; ///< Successful runs in that second
+        };
+
+        /**
+         * @brief The window's seconds, the current one included, indexed by second modulo the size.
+         */
+        using ThroughputWindow = std::array<SecondBucket, Constants::Metrics::kThroughputWindowSeconds>;
+
+        RuntimeMetrics();
+
+        /**
+         * @brief Returns whole seconds since the origin.
+         * @param time Time point
+         * @return Seconds
+         */
+        [[nodiscard]] int64_t SecondsSinceOrigin(Clock::time_point time) const;
+
+        /**
+         * @brief Computes GetThroughput() (mutex must be held).
+         * @param now Current time
+         * @return Successful runs per second
+         */
+        [[nodiscard]] double ComputeThroughput(Clock::time_point now) const;
+
+        std::atomic<bool> enabled = false;                  ///< Collection flag
+        mutable std::mutex mutex;                           ///< Guards all members below
+        Clock::time_point origin;                           ///< Time of construction or Reset()
+        uint64_t imagesSucceeded = 0;                       ///< Successful runs
+        uint64_t imagesFailed = 0;                          ///< Failed runs (timeouts included)
+        uint64_t imagesTimedOut = 0;                        ///< Runs stopped by the execution timeout
+        std::chrono::microseconds runTime{ 0 };             ///< Total run wall-clock time
+        std::array<uint64_t, kOutcomeCount> stepOutcomes{}; ///< Steps per StepOutcome
+        size_t peakSlotBytes = 0;                           ///< Highest RunStatistics::peakSlotBytes
+        std::array<size_t, kStageCount> queueDepths{};      ///< Items waiting per PipelineStage
+        std::map<NodeId, NodeLatency> nodeLatencies;        ///< Histograms by node, in ID order
+        ThroughputWindow throughputWindow{};                ///< Successful runs per recent second
+    };
+
+} // namespace VisionCraft::Nodes
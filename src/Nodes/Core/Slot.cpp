@@ -1,39 +1,143 @@
 #include "Nodes/Core/Slot.h"
+#include "Nodes/Core/NodeDataPool.h"
 
 namespace VisionCraft::Nodes
 {
-    Slot::Slot(std::optional<NodeData> defaultValue) : defaultValue(std::move(defaultValue))
+    Slot::Slot(std::optional<NodeData> defaultValue)
+        : dataType(defaultValue ? GetSlotDataType(*defaultValue) : SlotDataType::Any),
+          defaultValue(defaultValue ? std::make_shared<const NodeData>(std::move(*defaultValue)) : nullptr)
     {
     }
 
+    Slot::Slot(const Slot &other)
+    {
+        std::scoped_lock lock(other.handleMutex);
+        dataType = other.dataType;
+        data = other.data;
+        defaultValue = other.defaultValue;
+    }
+
+    Slot &Slot::operator=(const Slot &other)
+    {
+        if (this != &other)
+        {
+            std::scoped_lock lock(handleMutex, other.handleMutex);
+            dataType = other.dataType;
+            data = other.data;
+            defaultValue = other.defaultValue;
+        }
+        return *this;
+    }
+
+    Slot &Slot::SetDataType(SlotDataType type)
+    {
+        dataType = type;
+        return *this;
+    }
+
+    SlotDataType Slot::GetDataType() const
+    {
+        return dataType;
+    }
+
     void Slot::SetData(NodeData newData)
     {
-        this->data = std::move(newData);
+        SetSharedData(newData.index() == 0 ? nullptr : NodeDataPool::Get().Make(std::move(newData)));
+    }
+
+    void Slot::SetSharedData(std::shared_ptr<const NodeData> sharedData)
+    {
+        if (sharedData && sharedData->index() == 0)
+        {
+            sharedData.reset();
+        }
+
+        if (auto *context = ExecutionContext::Current())
+        {
+            context->SetData(*this, std::move(sharedData));
+            return;
+        }
+
+        // Release the previous value outside the lock; destroying a large image can take a while
+        {
+            std::scoped_lock lock(handleMutex);
+            data.swap(sharedData);
+        }
+    }
+
+    std::shared_ptr<const NodeData> Slot::GetSharedData() const
+    {
+        if (const auto *context = ExecutionContext::Current())
+        {
+            return context->GetData(*this);
+        }
+
+        std::scoped_lock lock(handleMutex);
+        return data;
+    }
+
+    std::shared_ptr<const NodeData> Slot::GetResolvedSharedData() const
+    {
+        if (const auto *context = ExecutionContext::Current())
+        {
+            auto handle = context->GetData(*this);
+            return handle ? handle : GetSharedDefaultValue();
+        }
+
+        std::scoped_lock lock(handleMutex);
+        return data ? data : defaultValue;
+    }
+
+    std::shared_ptr<const NodeData> Slot::GetSharedDefaultValue() const
+    {
+        if (const auto *context = ExecutionContext::Current())
+        {
+            bool overridden = false;
+            auto handle = context->FindDefault(*this, overridden);
+            if (overridden)
+            {
+                return handle;
+            }
+        }
+
+        std::scoped_lock lock(handleMutex);
+        return defaultValue;
     }
 
     bool Slot::HasData() const
     {
-        return data.index() != 0;
+        return GetSharedData() != nullptr;
     }
 
     void Slot::Clear()
     {
-        data = std::monostate{};
+        SetSharedData(nullptr);
     }
 
     size_t Slot::GetTypeIndex() const
     {
-        return data.index();
+        const auto handle = GetSharedData();
+        return handle ? handle->index() : 0;
     }
 
     void Slot::SetDefaultValue(NodeData newDefaultValue)
     {
-        this->defaultValue = std::move(newDefaultValue);
+        auto handle = std::make_shared<const NodeData>(std::move(newDefaultValue));
+        if (auto *context = ExecutionContext::Current())
+        {
+            context->SetDefault(*this, std::move(handle));
+            return;
+        }
+
+        {
+            std::scoped_lock lock(handleMutex);
+            defaultValue.swap(handle);
+        }
     }
 
     bool Slot::HasDefaultValue() const
     {
-        return defaultValue.has_value();
+        return GetSharedDefaultValue() != nullptr;
     }
 
     bool Slot::IsConnected() const
@@ -41,9 +145,16 @@ namespace VisionCraft::Nodes
         return HasData();
     }
 
-    const NodeData &Slot::GetVariantData() const
+    NodeData Slot::GetVariantData() const
     {
-        return data;
+        const auto handle = GetSharedData();
+        return handle ? *handle : NodeData{};
+    }
+
+    NodeData Slot::GetResolvedVariantData() const
+    {
+        const auto handle = GetResolvedSharedData();
+        return handle ? *handle : NodeData{};
     }
 
 } // namespace VisionCraft::Nodes
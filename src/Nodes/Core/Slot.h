@@ -1,7 +1,10 @@
 #pragma once
 
+#include "Nodes/Core/ExecutionContext.h"
 #include "Nodes/Core/NodeData.h"
 #include <concepts>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -23,8 +26,92 @@ namespace VisionCraft::Nodes
     concept ValidNodeDataType = requires { requires std::constructible_from<NodeData, T>; }
                                 || std::same_as<T, std::monostate>; // cppcheck-suppress internalAstError ;
 
+    /**
+     * @brief Read-only view of a slot value that neither copies it nor lets it be freed.
+     *
+     * Holds the slot's aliasing handle, so the value stays valid after the slot is rewritten or its default
+     * edited. Dereferencing costs nothing; only creating the view takes the slot lock once.
+     *
+     * @tparam T Value type
+     */
+    template<ValidNodeDataType T> class SlotView
+    {
+    public:
+        /**
+         * @brief Creates view over a handle.
+         * @param handle Value handle (nullptr = no value of type T)
+         */
+        explicit SlotView(std::shared_ptr<const T> handle = nullptr) : handle(std::move(handle))
+        {
+        }
+
+        /**
+         * @brief Checks whether the slot held a T.
+         * @return True if the view has a value
+         */
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return handle != nullptr;
+        }
+
+        /**
+         * @brief Returns the value.
+         * @return Reference valid for the view's lifetime
+         * @note The view must hold a value.
+         */
+        [[nodiscard]] const T &operator*() const noexcept
+        {
+            return *handle;
+        }
+
+        /**
+         * @brief Accesses members of the value.
+         * @return Pointer valid for the view's lifetime
+         * @note The view must hold a value.
+         */
+        [[nodiscard]] const T *operator->() const noexcept
+        {
+            return handle.get();
+        }
+
+        /**
+         * @brief Returns the value, or fallback if the slot held no T.
+         * @param fallback Value used when the view is empty
+         * @return Reference to the viewed value or to fallback; valid while both the view and fallback live
+         * @note Like std::min, storing the result of a call with a temporary fallback dangles. Pass it
+         *       straight to a function or use a named fallback.
+         */
+        [[nodiscard]] const T &ValueOr(const T &fallback) const noexcept
+        {
+            return handle ? *handle : fallback;
+        }
+
+        /**
+         * @brief Returns the value, or an empty T if the slot held none.
+         * @return Reference to the viewed value or to a shared default-constructed T
+         */
+        [[nodiscard]] const T &ValueOrEmpty() const noexcept
+        {
+            static const T empty{};
+            return handle ? *handle : empty;
+        }
+
+    private:
+        std::shared_ptr<const T> handle; ///< Keeps the viewed value alive
+    };
+
     /**
      * @brief Type-safe data slot with optional default values.
+     *
+     * Runtime data is held through a shared immutable handle, so passing a value along a
+     * connection shares it with the upstream output instead of copying the variant.
+     *
+     * Data and default handles are swapped under a per-slot lock, so the render thread can read
+     * values and edit defaults while the executor writes them. Readers that skip the copy get a
+     * handle that keeps the value alive even if the slot is rewritten meanwhile.
+     *
+     * On a thread with an ExecutionContext bound, data and default writes go to the context and reads
+     * come from it (defaults falling back to the slot's own), so concurrent runs never see each other.
      */
     class Slot
     {
@@ -36,16 +123,61 @@ namespace VisionCraft::Nodes
 
         /**
          * @brief Constructs slot with default value.
-         * @param defaultValue Default value when not connected
+         * @param defaultValue Default value when not connected (also declares the slot's data type)
          */
         explicit Slot(std::optional<NodeData> defaultValue);
 
+        /**
+         * @brief Copies slot, sharing the source's data and default handles.
+         * @param other Slot to copy
+         */
+        Slot(const Slot &other);
+
+        /**
+         * @brief Copy-assigns slot, sharing the source's data and default handles.
+         * @param other Slot to copy
+         * @return This slot
+         */
+        Slot &operator=(const Slot &other);
+
+        /**
+         * @brief Declares the kind of value the slot carries, checked when a plan is compiled.
+         * @param type Declared kind (SlotDataType::Any accepts or produces anything)
+         * @return This slot, for chaining after Node::CreateInputSlot() or Node::CreateOutputSlot()
+         * @note Set while the node is constructed; the type is not guarded by the slot's lock.
+         */
+        Slot &SetDataType(SlotDataType type);
+
+        /**
+         * @brief Returns the declared kind of value.
+         * @return Declared kind, Any if undeclared
+         */
+        [[nodiscard]] SlotDataType GetDataType() const;
+
         /**
          * @brief Sets data in slot.
-         * @param data Data to store
+         * @param data Data to store (in a handle from NodeDataPool)
          */
         void SetData(NodeData data);
 
+        /**
+         * @brief Shares an existing data handle without copying the value.
+         * @param sharedData Handle to share (nullptr clears the slot)
+         */
+        void SetSharedData(std::shared_ptr<const NodeData> sharedData);
+
+        /**
+         * @brief Returns the handle holding the slot's data.
+         * @return Shared handle, or nullptr if the slot is empty
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetSharedData() const;
+
+        /**
+         * @brief Returns the handle a node would read from this slot.
+         * @return Data handle if present, otherwise the default handle (nullptr if neither)
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetResolvedSharedData() const;
+
         /**
          * @brief Returns typed data from slot.
          * @tparam T Type to retrieve (must be a valid NodeData type)
@@ -53,13 +185,23 @@ namespace VisionCraft::Nodes
          */
         template<ValidNodeDataType T> [[nodiscard]] std::optional<T> GetData() const
         {
-            if (std::holds_alternative<T>(data))
+            if (const auto value = GetDataIf<T>())
             {
-                return std::get<T>(data);
+                return *value;
             }
             return std::nullopt;
         }
 
+        /**
+         * @brief Returns typed data from slot without copying it.
+         * @tparam T Type to retrieve (must be a valid NodeData type)
+         * @return Handle to the value, or nullptr if type does not match
+         */
+        template<ValidNodeDataType T> [[nodiscard]] std::shared_ptr<const T> GetDataIf() const
+        {
+            return Alias<T>(GetSharedData());
+        }
+
         /**
          * @brief Checks if slot contains data.
          * @return True if slot has data
@@ -84,7 +226,7 @@ namespace VisionCraft::Nodes
          */
         template<ValidNodeDataType T> [[nodiscard]] bool HoldsType() const
         {
-            return std::holds_alternative<T>(data);
+            return GetDataIf<T>() != nullptr;
         }
 
         /**
@@ -100,9 +242,9 @@ namespace VisionCraft::Nodes
          */
         template<ValidNodeDataType T> [[nodiscard]] std::optional<T> GetDefaultValue() const
         {
-            if (defaultValue && std::holds_alternative<T>(*defaultValue))
+            if (const auto value = Alias<T>(GetSharedDefaultValue()))
             {
-                return std::get<T>(*defaultValue);
+                return *value;
             }
             return std::nullopt;
         }
@@ -113,6 +255,13 @@ namespace VisionCraft::Nodes
          */
         [[nodiscard]] bool HasDefaultValue() const;
 
+        /**
+         * @brief Returns the handle holding the default value.
+         * @return Shared handle, or nullptr if no default is set
+         * @note Read by graph saving, which stores defaults of any type without naming it.
+         */
+        [[nodiscard]] std::shared_ptr<const NodeData> GetSharedDefaultValue() const;
+
         /**
          * @brief Returns value with automatic fallback to default.
          * @tparam T Type to retrieve (must be a valid NodeData type)
@@ -120,14 +269,31 @@ namespace VisionCraft::Nodes
          */
         template<ValidNodeDataType T> [[nodiscard]] std::optional<T> GetValueOrDefault() const
         {
-            if (HasData())
+            if (const auto value = GetValueOrDefaultIf<T>())
             {
-                auto connectedData = GetData<T>();
-                if (connectedData)
-                    return connectedData;
+                return *value;
             }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Returns value with fallback to default, without copying it.
+         * @tparam T Type to retrieve (must be a valid NodeData type)
+         * @return Handle to connected data if it holds T, otherwise to a matching default, otherwise nullptr
+         */
+        template<ValidNodeDataType T> [[nodiscard]] std::shared_ptr<const T> GetValueOrDefaultIf() const
+        {
+            return Alias<T>(ResolveHandle<T>());
+        }
 
-            return GetDefaultValue<T>();
+        /**
+         * @brief Returns a view of the value with fallback to default, without copying it.
+         * @tparam T Type to retrieve (must be a valid NodeData type)
+         * @return View of connected data if it holds T, otherwise of a matching default, otherwise empty
+         */
+        template<ValidNodeDataType T> [[nodiscard]] SlotView<T> GetValueOrDefaultView() const
+        {
+            return SlotView<T>(Alias<T>(ResolveHandle<T>()));
         }
 
         /**
@@ -137,14 +303,52 @@ namespace VisionCraft::Nodes
         [[nodiscard]] bool IsConnected() const;
 
         /**
-         * @brief Returns raw variant data.
-         * @return NodeData variant
+         * @brief Returns copy of raw variant data.
+         * @return NodeData variant (std::monostate if empty)
+         */
+        [[nodiscard]] NodeData GetVariantData() const;
+
+        /**
+         * @brief Returns copy of the value a node would read from this slot.
+         * @return Connected data if present, otherwise the default value (std::monostate if neither)
          */
-        [[nodiscard]] const NodeData &GetVariantData() const;
+        [[nodiscard]] NodeData GetResolvedVariantData() const;
 
     private:
-        NodeData data;                        ///< Runtime data from connected node
-        std::optional<NodeData> defaultValue; ///< UI-editable default value
+        /**
+         * @brief Picks the handle a T reader should see, under one lock.
+         * @tparam T Requested alternative
+         * @return Data handle if it holds T, otherwise the default handle (which may hold another type)
+         */
+        template<ValidNodeDataType T> [[nodiscard]] std::shared_ptr<const NodeData> ResolveHandle() const
+        {
+            if (const auto *context = ExecutionContext::Current())
+            {
+                auto handle = context->GetData(*this);
+                return handle && std::holds_alternative<T>(*handle) ? handle : GetSharedDefaultValue();
+            }
+
+            std::scoped_lock lock(handleMutex);
+            return data && std::holds_alternative<T>(*data) ? data : defaultValue;
+        }
+
+        /**
+         * @brief Narrows a variant handle to one alternative, keeping the variant alive.
+         * @tparam T Alternative to select
+         * @param handle Variant handle
+         * @return Aliasing handle to the T value, or nullptr if handle is empty or holds another type
+         */
+        template<ValidNodeDataType T>
+        [[nodiscard]] static std::shared_ptr<const T> Alias(std::shared_ptr<const NodeData> handle)
+        {
+            const auto *value = handle ? std::get_if<T>(handle.get()) : nullptr;
+            return value ? std::shared_ptr<const T>(std::move(handle), value) : nullptr;
+        }
+
+        SlotDataType dataType = SlotDataType::Any;    ///< Declared kind of value (see SetDataType())
+        mutable std::mutex handleMutex;               ///< Guards data and defaultValue handles
+        std::shared_ptr<const NodeData> data;         ///< Runtime data, possibly shared with upstream output
+        std::shared_ptr<const NodeData> defaultValue; ///< UI-editable default value (nullptr = none)
     };
 
 } // namespace VisionCraft::Nodes
@@ -0,0 +1,58 @@
+#include "Nodes/Core/SlotName.h"
+
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        struct NameHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(std::string_view name) const
+            {
+                return std::hash<std::string_view>{}(name);
+            }
+        };
+
+        struct InternTable
+        {
+            std::shared_mutex mutex;                                           ///< Guards names
+            std::unordered_set<std::string, NameHash, std::equal_to<>> names; ///< Node-based: names never move
+        };
+
+        // Slot names repeat across every node, connection and pin, so each is stored once per process
+        const std::string *Intern(std::string_view name)
+        {
+            static InternTable table;
+            {
+                std::shared_lock lock(table.mutex);
+                if (const auto it = table.names.find(name); it != table.names.end())
+                {
+                    return &*it;
+                }
+            }
+            std::unique_lock lock(table.mutex);
+            return &*table.names.emplace(name).first;
+        }
+    } // namespace
+
+    SlotName::SlotName()
+    {
+        static const std::string *const empty = Intern({});
+        name = empty;
+    }
+
+    SlotName::SlotName(std::string_view name) : name(Intern(name))
+    {
+    }
+
+    std::ostream &operator<<(std::ostream &stream, SlotName slotName)
+    {
+        return stream << slotName.Str();
+    }
+} // namespace VisionCraft::Nodes
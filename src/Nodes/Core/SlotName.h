@@ -0,0 +1,130 @@
+#pragma once
+
+#include <spdlog/fmt/fmt.h>
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Interned slot or execution pin name, e.g. "Input", "Output", "Execute" or "Then".
+     *
+     * The same few names appear in every node, connection, pin ID and clipboard entry. A SlotName is one
+     * pointer into a process-wide table holding each distinct name once, so copies are free, equality and
+     * hashing compare the pointer, and a connection no longer carries two heap strings. Ordering still
+     * follows the characters, so sorted containers and saved files keep their order.
+     *
+     * Converts implicitly from and to strings, so code that spells names as literals keeps working;
+     * constructing one from text looks the name up in the table, so keep handles instead of re-creating
+     * them in hot loops. Thread-safe.
+     */
+    class SlotName
+    {
+    public:
+        /**
+         * @brief Constructs the empty name.
+         */
+        SlotName();
+
+        /**
+         * @brief Interns a name.
+         * @param name Slot or pin name
+         */
+        SlotName(std::string_view name);
+
+        /**
+         * @brief Interns a name.
+         * @param name Slot or pin name
+         */
+        SlotName(const std::string &name) : SlotName(std::string_view(name))
+        {
+        }
+
+        /**
+         * @brief Interns a name.
+         * @param name Slot or pin name (null-terminated)
+         */
+        SlotName(const char *name) : SlotName(std::string_view(name))
+        {
+        }
+
+        /**
+         * @brief Returns the name.
+         * @return Interned string (valid for the process lifetime)
+         */
+        [[nodiscard]] const std::string &Str() const
+        {
+            return *name;
+        }
+
+        /**
+         * @brief Checks whether this is the empty name.
+         * @return True if empty
+         */
+        [[nodiscard]] bool Empty() const
+        {
+            return name->empty();
+        }
+
+        /**
+         * @brief Converts to the name, for APIs that take strings.
+         */
+        operator const std::string &() const
+        {
+            return *name;
+        }
+
+        /**
+         * @brief Compares two names by identity (one pointer comparison).
+         */
+        friend bool operator==(SlotName lhs, SlotName rhs)
+        {
+            return lhs.name == rhs.name;
+        }
+
+        /**
+         * @brief Orders two names by their characters.
+         */
+        friend std::strong_ordering operator<=>(SlotName lhs, SlotName rhs)
+        {
+            return lhs.name == rhs.name ? std::strong_ordering::equal : *lhs.name <=> *rhs.name;
+        }
+
+        /**
+         * @brief Writes the name to a stream.
+         */
+        friend std::ostream &operator<<(std::ostream &stream, SlotName slotName);
+
+    private:
+        friend struct std::hash<SlotName>;
+
+        const std::string *name; ///< Entry of the intern table; never null
+    };
+} // namespace VisionCraft::Nodes
+
+/**
+ * @brief Hashes a SlotName by identity.
+ */
+template<> struct std::hash<VisionCraft::Nodes::SlotName>
+{
+    [[nodiscard]] size_t operator()(VisionCraft::Nodes::SlotName slotName) const noexcept
+    {
+        return std::hash<const void *>{}(slotName.name);
+    }
+};
+
+/**
+ * @brief Lets fmt (and so the loggers) print a SlotName.
+ */
+template<> struct fmt::formatter<VisionCraft::Nodes::SlotName> : fmt::formatter<std::string_view>
+{
+    auto format(VisionCraft::Nodes::SlotName slotName, format_context &context) const
+    {
+        return fmt::formatter<std::string_view>::format(slotName.Str(), context);
+    }
+};
@@ -0,0 +1,55 @@
+#include "Nodes/Core/SlotNameTable.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace VisionCraft::Nodes
+{
+    SlotNameTable::SlotNameTable(std::pmr::memory_resource *resource) : entries(resource)
+    {
+    }
+
+    std::pmr::vector<SlotNameTable::Entry>::const_iterator SlotNameTable::LowerBound(SlotKind kind,
+        std::string_view name) const
+    {
+        return std::ranges::lower_bound(entries, std::pair(kind, name), std::less<>{}, [](const Entry &entry) {
+            return std::pair(entry.kind, std::string_view(entry.name.Str()));
+        });
+    }
+
+    std::optional<size_t> SlotNameTable::Find(SlotKind kind, std::string_view name) const
+    {
+        const auto it = LowerBound(kind, name);
+        if (it == entries.end() || it->kind != kind || it->name.Str() != name)
+        {
+            return std::nullopt;
+        }
+        return it->index;
+    }
+
+    bool SlotNameTable::Contains(SlotKind kind, std::string_view name) const
+    {
+        return Find(kind, name).has_value();
+    }
+
+    std::pair<size_t, bool> SlotNameTable::Insert(SlotKind kind, std::string_view name, size_t index)
+    {
+        const auto it = LowerBound(kind, name);
+        if (it != entries.end() && it->kind == kind && it->name.Str() == name)
+        {
+            return { it->index, false };
+        }
+        entries.insert(it, { .name = SlotName(name), .index = static_cast<uint32_t>(index), .kind = kind });
+        return { index, true };
+    }
+
+    std::vector<std::string> SlotNameTable::GetNames(SlotKind kind) const
+    {
+        std::vector<std::string> names;
+        for (auto it = LowerBound(kind, {}); it != entries.end() && it->kind == kind; ++it)
+        {
+            names.push_back(it->name);
+        }
+        return names;
+    }
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Nodes/Core/NodeArena.h"
+#include "Nodes/Core/SlotName.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Kind of named connection point on a node.
+     */
+    enum class SlotKind : uint8_t
+    {
+        Input,          ///< Data input slot
+        Output,         ///< Data output slot
+        ExecutionInput, ///< Execution input pin
+        ExecutionOutput ///< Execution output pin
+    };
+
+    /**
+     * @brief Name lookup for a node's slots and execution pins in one small sorted array.
+     *
+     * Nodes have a handful of slots, so four hash tables per node (one per SlotKind) cost far more in
+     * allocations and memory than they save in lookups. Each entry is an interned name pointer and an
+     * index, sorted by kind and name: a node's whole table is one allocation, and a lookup is a binary
+     * search over a few cache lines. Names are SlotNames, interned once per process and shared by all nodes.
+     */
+    class SlotNameTable
+    {
+    public:
+        /**
+         * @brief Constructs an empty table.
+         * @param resource Memory for the entries (defaults to the calling thread's NodeArena, if any)
+         */
+        explicit SlotNameTable(std::pmr::memory_resource *resource = NodeArena::GetCurrentResource());
+
+        /**
+         * @brief Looks up a name.
+         * @param kind Kind to search
+         * @param name Slot or pin name
+         * @return Index stored with the name, or std::nullopt if there is none
+         */
+        [[nodiscard]] std::optional<size_t> Find(SlotKind kind, std::string_view name) const;
+
+        /**
+         * @brief Checks whether a name exists.
+         * @param kind Kind to search
+         * @param name Slot or pin name
+         * @return True if present
+         */
+        [[nodiscard]] bool Contains(SlotKind kind, std::string_view name) const;
+
+        /**
+         * @brief Adds a name unless it exists.
+         * @param kind Kind of the name
+         * @param name Slot or pin name
+         * @param index Index to store with a new name
+         * @return Index stored with the name (the existing one if it was present), and whether it was added
+         */
+        std::pair<size_t, bool> Insert(SlotKind kind, std::string_view name, size_t index);
+
+        /**
+         * @brief Returns the names of one kind.
+         * @param kind Kind to list
+         * @return Names in sorted order
+         */
+        [[nodiscard]] std::vector<std::string> GetNames(SlotKind kind) const;
+
+    private:
+        /**
+         * @brief One name; 16 bytes.
+         */
+        struct Entry
+        {
+            SlotName name;                   ///< Interned name
+            uint32_t index = 0;              ///< Slot index, or 0 for execution pins
+            SlotKind kind = SlotKind::Input; ///< Kind of the name
+        };
+
+        /**
+         * @brief Returns the first entry not ordered before (kind, name).
+         * @param kind Kind to search
+         * @param name Name to search
+         * @return Insertion position
+         */
+        [[nodiscard]] std::pmr::vector<Entry>::const_iterator LowerBound(SlotKind kind, std::string_view name) const;
+
+        std::pmr::vector<Entry> entries; ///< Sorted by kind, then name
+    };
+} // namespace VisionCraft::Nodes
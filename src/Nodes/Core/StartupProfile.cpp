@@ -0,0 +1,116 @@
+#include "Nodes/Core/StartupProfile.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <spdlog/fmt/fmt.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        double ToMilliseconds(std::chrono::microseconds duration)
+        {
+            return static_cast<double>(duration.count()) / 1000.0;
+        }
+    } // namespace
+
+    StartupProfile &StartupProfile::Get()
+    {
+        static StartupProfile profile;
+        return profile;
+    }
+
+    StartupProfile::StartupProfile() : origin(Clock::now())
+    {
+    }
+
+    void StartupProfile::Record(std::string_view name, Clock::time_point start, Clock::time_point end)
+    {
+        auto &tracer = Tracer::Get();
+        if (tracer.IsEnabled())
+        {
+            tracer.Record("startup", name, {}, start, end);
+        }
+
+        std::scoped_lock lock(mutex);
+        phases.push_back({ .name = std::string(name),
+            .start = std::chrono::duration_cast<std::chrono::microseconds>(start - origin),
+            .length = std::chrono::duration_cast<std::chrono::microseconds>(end - start),
+            .afterReady = readyTime.has_value() });
+    }
+
+    bool StartupProfile::MarkReady()
+    {
+        std::chrono::microseconds timeToReady{};
+        {
+            std::scoped_lock lock(mutex);
+            if (readyTime)
+            {
+                return false;
+            }
+            timeToReady = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - origin);
+            readyTime = timeToReady;
+        }
+
+        LOG_INFO("Startup: ready after {:.1f} ms\n{}", ToMilliseconds(timeToReady), FormatSummary());
+        if (timeToReady > std::chrono::milliseconds(Constants::Startup::kReadyBudgetMs))
+        {
+            LOG_WARN("Startup: {:.1f} ms exceeds the {} ms budget", ToMilliseconds(timeToReady),
+                Constants::Startup::kReadyBudgetMs);
+        }
+        return true;
+    }
+
+    std::optional<std::chrono::microseconds> StartupProfile::GetTimeToReady() const
+    {
+        std::scoped_lock lock(mutex);
+        return readyTime;
+    }
+
+    std::vector<StartupProfile::Phase> StartupProfile::GetPhases() const
+    {
+        std::scoped_lock lock(mutex);
+        return phases;
+    }
+
+    std::string StartupProfile::FormatSummary() const
+    {
+        auto sorted = GetPhases();
+        std::ranges::stable_sort(sorted, {}, &Phase::start);
+        const auto slowest = std::ranges::max_element(sorted, {}, &Phase::length);
+
+        std::string summary;
+        for (auto it = sorted.begin(); it != sorted.end(); ++it)
+        {
+            summary += fmt::format("  {:>8.1f} ms +{:>7.1f} ms  {}{}{}\n",
+                ToMilliseconds(it->start),
+                ToMilliseconds(it->length),
+                it->name,
+                it->afterReady ? " (after ready)" : "",
+                it == slowest ? " (slowest)" : "");
+        }
+        return summary;
+    }
+
+    void StartupProfile::Reset()
+    {
+        std::scoped_lock lock(mutex);
+        phases.clear();
+        readyTime.reset();
+        origin = Clock::now();
+    }
+
+    StartupScope::StartupScope(std::string name) : name(std::move(name)), start(StartupProfile::Clock::now())
+    {
+    }
+
+    StartupScope::~StartupScope()
+    {
+        StartupProfile::Get().Record(name, start, StartupProfile::Clock::now());
+    }
+
+} // namespace VisionCraft::Nodes
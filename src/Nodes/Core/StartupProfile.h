@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Process-wide record of how long each part of application startup took.
+     *
+     * StartupScope times one phase (layer construction, node registration, ImGui setup, ...) against the
+     * profile's origin, which is when the profile was first used, normally the first line of main(). The
+     * application calls MarkReady() once its first frame is on screen; that logs every phase, the time to
+     * ready, and a warning when it exceeds Constants::Startup::kReadyBudgetMs. Phases that end after ready
+     * (deferred or background work such as the OpenCV warm-up) are recorded and flagged, so they can be
+     * told apart from work the user waited for. Phases also appear in a running Tracer recording.
+     *
+     * All methods are thread-safe.
+     */
+    class StartupProfile
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief One timed startup phase.
+         */
+        struct Phase
+        {
+            std::string name;                   ///< Phase label
+            std::chrono::microseconds start{};  ///< Start, relative to the origin
+            std::chrono::microseconds length{}; ///< Duration
+            bool afterReady = false;            ///< Ended after MarkReady() (deferred or background work)
+        };
+
+        /**
+         * @brief Returns the process-wide profile, setting its origin on first use.
+         * @return Profile instance
+         */
+        [[nodiscard]] static StartupProfile &Get();
+
+        /**
+         * @brief Records a phase.
+         * @param name Phase label
+         * @param start Phase start
+         * @param end Phase end
+         */
+        void Record(std::string_view name, Clock::time_point start, Clock::time_point end);
+
+        /**
+         * @brief Marks the application ready and logs the summary; later calls do nothing.
+         * @return True for the call that marked it
+         */
+        bool MarkReady();
+
+        /**
+         * @brief Returns the time from the origin to MarkReady().
+         * @return Time to ready, or std::nullopt before MarkReady()
+         */
+        [[nodiscard]] std::optional<std::chrono::microseconds> GetTimeToReady() const;
+
+        /**
+         * @brief Returns the phases recorded so far.
+         * @return Phases in the order they ended
+         */
+        [[nodiscard]] std::vector<Phase> GetPhases() const;
+
+        /**
+         * @brief Formats the phases as one line each, slowest marked, for logs and bug reports.
+         * @return Multi-line summary
+         */
+        [[nodiscard]] std::string FormatSummary() const;
+
+        /**
+         * @brief Forgets every phase and the ready mark and restarts the clock (for tests).
+         */
+        void Reset();
+
+    private:
+        StartupProfile();
+
+        mutable std::mutex mutex;                           ///< Guards all members below
+        Clock::time_point origin;                           ///< Time zero
+        std::vector<Phase> phases;                          ///< Phases in the order they ended
+        std::optional<std::chrono::microseconds> readyTime; ///< Set by MarkReady()
+    };
+
+    /**
+     * @brief RAII helper recording the lifetime of a scope as one startup phase.
+     */
+    class StartupScope
+    {
+    public:
+        /**
+         * @brief Starts timing the phase.
+         * @param name Phase label
+         */
+        explicit StartupScope(std::string name);
+
+        /**
+         * @brief Records the phase.
+         */
+        ~StartupScope();
+
+        StartupScope(const StartupScope &) = delete;
+        StartupScope &operator=(const StartupScope &) = delete;
+
+    private:
+        std::string name;                        ///< Phase label
+        StartupProfile::Clock::time_point start; ///< Scope start
+    };
+
+} // namespace VisionCraft::Nodes
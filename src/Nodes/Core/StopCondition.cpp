@@ -0,0 +1,34 @@
+#include "Nodes/Core/StopCondition.h"
+
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    StopCondition::StopCondition(std::stop_token callerToken,
+        std::stop_token editorToken,
+        std::optional<Clock::time_point> deadline)
+        : callerToken(std::move(callerToken)), editorToken(std::move(editorToken)), deadline(deadline)
+    {
+    }
+
+    bool StopCondition::IsCancelled() const
+    {
+        return callerToken.stop_requested() || editorToken.stop_requested();
+    }
+
+    bool StopCondition::IsDeadlineExceeded() const
+    {
+        return deadline && Clock::now() >= *deadline;
+    }
+
+    bool StopCondition::IsStopRequested() const
+    {
+        return IsCancelled() || IsDeadlineExceeded();
+    }
+
+    std::optional<StopCondition::Clock::time_point> StopCondition::GetDeadline() const
+    {
+        return deadline;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Thrown by Node::ThrowIfStopRequested() to abandon Process() once the run is cancelled or out of time.
+     */
+    class ExecutionStopped : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @brief Cancellation requests and deadline of one run.
+     *
+     * The editor checks it between steps; long-running nodes and tiled chains poll it between units of work
+     * (row strips, tiles, iterations), since a single OpenCV call cannot be interrupted. Cheap to copy.
+     */
+    class StopCondition
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Constructs condition that never stops.
+         */
+        StopCondition() = default;
+
+        /**
+         * @brief Constructs condition for a run.
+         * @param callerToken Token of the caller (e.g. ExecuteAsync() or a batch job)
+         * @param editorToken Token of NodeEditor::CancelExecution()
+         * @param deadline Time after which the run stops (std::nullopt = no deadline)
+         */
+        StopCondition(std::stop_token callerToken,
+            std::stop_token editorToken,
+            std::optional<Clock::time_point> deadline = std::nullopt);
+
+        /**
+         * @brief Checks whether either token requested a stop.
+         * @return True if the run was cancelled
+         */
+        [[nodiscard]] bool IsCancelled() const;
+
+        /**
+         * @brief Checks whether the deadline has passed.
+         * @return True if the run is out of time
+         */
+        [[nodiscard]] bool IsDeadlineExceeded() const;
+
+        /**
+         * @brief Checks whether the run should stop, for either reason.
+         * @return True if cancelled or out of time
+         */
+        [[nodiscard]] bool IsStopRequested() const;
+
+        /**
+         * @brief Returns the deadline.
+         * @return Deadline, or std::nullopt if the run has none
+         */
+        [[nodiscard]] std::optional<Clock::time_point> GetDeadline() const;
+
+    private:
+        std::stop_token callerToken;               ///< Caller's cancellation token
+        std::stop_token editorToken;               ///< Editor's cancellation token
+        std::optional<Clock::time_point> deadline; ///< Stop time (std::nullopt = none)
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,86 @@
+#include "Nodes/Core/ThreadBudget.h"
+#include "Logger.h"
+
+#include <opencv2/core.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace VisionCraft::Nodes
+{
+    ThreadBudget::ActiveTask::ActiveTask(ThreadBudget &budget) : budget(budget)
+    {
+        std::scoped_lock lock(budget.mutex);
+        ++budget.activeTasks;
+        budget.Rebalance();
+    }
+
+    ThreadBudget::ActiveTask::~ActiveTask()
+    {
+        std::scoped_lock lock(budget.mutex);
+        --budget.activeTasks;
+        budget.Rebalance();
+    }
+
+    ThreadBudget &ThreadBudget::Get()
+    {
+        static ThreadBudget budget;
+        return budget;
+    }
+
+    void ThreadBudget::SetMaxCores(size_t cores)
+    {
+        std::scoped_lock lock(mutex);
+        maxCores = cores;
+        LOG_INFO("Thread budget set to {} cores", cores == 0 ? std::thread::hardware_concurrency() : cores);
+        Rebalance();
+    }
+
+    size_t ThreadBudget::GetMaxCores() const
+    {
+        std::scoped_lock lock(mutex);
+        return maxCores;
+    }
+
+    void ThreadBudget::SetMaxOpenCvThreads(size_t threads)
+    {
+        std::scoped_lock lock(mutex);
+        maxOpenCvThreads = threads;
+        Rebalance();
+    }
+
+    size_t ThreadBudget::GetMaxOpenCvThreads() const
+    {
+        std::scoped_lock lock(mutex);
+        return maxOpenCvThreads;
+    }
+
+    size_t ThreadBudget::GetActiveTasks() const
+    {
+        std::scoped_lock lock(mutex);
+        return activeTasks;
+    }
+
+    size_t ThreadBudget::GetOpenCvThreads() const
+    {
+        std::scoped_lock lock(mutex);
+        return openCvThreads;
+    }
+
+    void ThreadBudget::Rebalance()
+    {
+        const size_t cores = maxCores != 0 ? maxCores : std::max<size_t>(1, std::thread::hardware_concurrency());
+        // Idle counts as one task, so a lone task starting or finishing never reconfigures OpenCV
+        size_t share = std::max<size_t>(1, cores / std::max<size_t>(1, activeTasks));
+        if (maxOpenCvThreads != 0)
+        {
+            share = std::min(share, maxOpenCvThreads);
+        }
+        if (share != openCvThreads)
+        {
+            openCvThreads = share;
+            cv::setNumThreads(static_cast<int>(share));
+        }
+    }
+
+} // namespace VisionCraft::Nodes
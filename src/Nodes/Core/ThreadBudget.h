@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Process-wide core budget shared by graph-level parallelism and OpenCV's own thread pool.
+     *
+     * OpenCV spreads calls such as cv::resize or cv::Canny over its own threads. Once several graph tasks run
+     * at once - parallel branches, pipelined stream stages, batch images - each of them doing that would
+     * oversubscribe the cores. NodeEditor therefore holds an ActiveTask while a node or tiled chain runs, and
+     * the budget gives OpenCV (cv::setNumThreads(), a process-wide setting) an equal share of the cores per
+     * active task: all of them for a lone task, one each once tasks fill the budget.
+     *
+     * A limit set with SetMaxCores() also caps ExecutorService worker pools, so it bounds the CPU one process
+     * uses: the single "max cores" setting behind the CLI's --max-cores and the editor's Cores field.
+     * SetMaxOpenCvThreads() additionally caps the OpenCV share, for machines where OpenCV's parallel loops
+     * stop scaling well before the core count (Vision::IO::Autotuner measures this).
+     *
+     * All methods are thread-safe.
+     */
+    class ThreadBudget
+    {
+    public:
+        /**
+         * @brief Marks one graph task as running until destroyed.
+         */
+        class ActiveTask
+        {
+        public:
+            explicit ActiveTask(ThreadBudget &budget);
+            ~ActiveTask();
+
+            ActiveTask(const ActiveTask &) = delete;
+            ActiveTask &operator=(const ActiveTask &) = delete;
+
+        private:
+            ThreadBudget &budget; ///< Budget the task is counted in
+        };
+
+        /**
+         * @brief Returns the process-wide budget.
+         * @return Budget instance
+         */
+        [[nodiscard]] static ThreadBudget &Get();
+
+        /**
+         * @brief Limits the cores graph work and OpenCV may use together.
+         * @param cores Core count (0 removes the limit: hardware concurrency)
+         */
+        void SetMaxCores(size_t cores);
+
+        /**
+         * @brief Returns the core limit.
+         * @return Cores set with SetMaxCores() (0 = no limit)
+         */
+        [[nodiscard]] size_t GetMaxCores() const;
+
+        /**
+         * @brief Limits the threads OpenCV gets per active task.
+         * @param threads Thread cap (0 removes it: the equal share of the core budget)
+         */
+        void SetMaxOpenCvThreads(size_t threads);
+
+        /**
+         * @brief Returns the per-task OpenCV thread cap.
+         * @return Threads set with SetMaxOpenCvThreads() (0 = no cap)
+         */
+        [[nodiscard]] size_t GetMaxOpenCvThreads() const;
+
+        /**
+         * @brief Returns how many graph tasks hold an ActiveTask.
+         * @return Active task count
+         */
+        [[nodiscard]] size_t GetActiveTasks() const;
+
+        /**
+         * @brief Returns the thread count last handed to cv::setNumThreads().
+         * @return OpenCV threads per active task (0 until the first task or SetMaxCores())
+         */
+        [[nodiscard]] size_t GetOpenCvThreads() const;
+
+    private:
+        ThreadBudget() = default;
+
+        /**
+         * @brief Gives OpenCV its share for the current task count if that share changed (mutex held).
+         */
+        void Rebalance();
+
+        mutable std::mutex mutex;    ///< Guards every member below
+        size_t maxCores = 0;         ///< Requested budget (0 = hardware concurrency)
+        size_t maxOpenCvThreads = 0; ///< Per-task OpenCV cap (0 = none)
+        size_t activeTasks = 0;      ///< Tasks holding an ActiveTask
+        size_t openCvThreads = 0;    ///< Share last applied (0 = never applied)
+    };
+
+} // namespace VisionCraft::Nodes
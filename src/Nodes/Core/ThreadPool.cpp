@@ -0,0 +1,193 @@
+#include "Nodes/Core/ThreadPool.h"
+#include "Logger.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        thread_local const ThreadPool *currentPool = nullptr; ///< Pool owning the calling worker thread
+        thread_local size_t currentWorkerIndex = 0;           ///< Index of the calling worker thread
+    } // namespace
+
+    ThreadPool::ThreadPool(size_t workerCount, bool pinWorkers) : ThreadPool(workerCount, pinWorkers, std::nullopt)
+    {
+    }
+
+    ThreadPool::ThreadPool(size_t workerCount, const CpuTopology &topology) : ThreadPool(workerCount, false, topology)
+    {
+    }
+
+    ThreadPool::ThreadPool(size_t workerCount, bool pinWorkers, std::optional<CpuTopology> numaTopology)
+        : topology(std::move(numaTopology))
+    {
+        if (workerCount == 0)
+        {
+            workerCount = std::max<size_t>(1, std::thread::hardware_concurrency());
+        }
+
+        // Contiguous blocks per node, so worker i lands on node i * nodes / workers
+        const size_t nodeCount = topology ? topology->GetNodeCount() : 1;
+        workerNodes.resize(workerCount);
+        nodeFirstWorker.assign(nodeCount + 1, workerCount);
+        for (size_t i = workerCount; i-- > 0;)
+        {
+            workerNodes[i] = i * nodeCount / workerCount;
+            nodeFirstWorker[workerNodes[i]] = i;
+        }
+        for (size_t node = nodeCount; node-- > 0;)
+        {
+            nodeFirstWorker[node] = std::min(nodeFirstWorker[node], nodeFirstWorker[node + 1]);
+        }
+
+        queues.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+
+        workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i)
+        {
+            workers.emplace_back(
+                [this, i, pinWorkers](std::stop_token stopToken) { WorkerLoop(stopToken, i, pinWorkers); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        for (auto &worker : workers)
+        {
+            worker.request_stop();
+        }
+        wakeCondition.notify_all();
+        workers.clear(); // jthread joins on destruction
+    }
+
+    void ThreadPool::Submit(Task task)
+    {
+        // Keep successors on the submitting worker when possible, otherwise spread round-robin
+        const size_t index = currentPool == this ? currentWorkerIndex : PickExternalQueue();
+
+        // Count the task before it becomes visible so a concurrent steal can never drive the counter below zero
+        {
+            std::scoped_lock lock(wakeMutex);
+            pendingTasks.fetch_add(1, std::memory_order_release);
+        }
+
+        {
+            std::scoped_lock lock(queues[index]->mutex);
+            queues[index]->tasks.push_back(std::move(task));
+        }
+        wakeCondition.notify_one();
+    }
+
+    std::optional<size_t> ThreadPool::GetWorkerNode(size_t index) const
+    {
+        if (!topology)
+        {
+            return std::nullopt;
+        }
+        return workerNodes.at(index);
+    }
+
+    size_t ThreadPool::PickExternalQueue()
+    {
+        const size_t turn = nextQueue.fetch_add(1, std::memory_order_relaxed);
+
+        // A thread bound to a node keeps its run on that node's workers, if it has any
+        if (const auto node = CpuTopology::GetCurrentNode(); topology && node && *node < topology->GetNodeCount())
+        {
+            const size_t first = nodeFirstWorker[*node];
+            const size_t count = nodeFirstWorker[*node + 1] - first;
+            if (count > 0)
+            {
+                return first + turn % count;
+            }
+        }
+        return turn % queues.size();
+    }
+
+    void ThreadPool::WorkerLoop(std::stop_token stopToken, size_t index, bool pin)
+    {
+        currentPool = this;
+        currentWorkerIndex = index;
+        Tracer::Get().SetCurrentThreadName("Worker " + std::to_string(index));
+        if (topology)
+        {
+            const size_t node = workerNodes[index];
+            if (!topology->BindCurrentThread(node))
+            {
+                LOG_WARN("Could not bind worker {} to NUMA node {}", index, topology->GetNodes()[node].id);
+            }
+        }
+        else if (pin)
+        {
+            const size_t core = index % std::max<size_t>(1, std::thread::hardware_concurrency());
+            if (!CpuTopology::PinCurrentThread(std::span(&core, 1)))
+            {
+                LOG_WARN("Could not pin worker {} to core {}", index, core);
+            }
+        }
+
+        while (!stopToken.stop_requested())
+        {
+            Task task;
+            if (TryPopLocal(index, task) || TrySteal(index, task))
+            {
+                pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+                task();
+                continue;
+            }
+
+            std::unique_lock lock(wakeMutex);
+            wakeCondition.wait(
+                lock, stopToken, [this]() { return pendingTasks.load(std::memory_order_acquire) > 0; });
+        }
+    }
+
+    bool ThreadPool::TryPopLocal(size_t index, Task &task)
+    {
+        auto &queue = *queues[index];
+        std::scoped_lock lock(queue.mutex);
+        if (queue.tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool ThreadPool::TrySteal(size_t thiefIndex, Task &task)
+    {
+        // Workers on the thief's own node first; crossing sockets only when they are all dry
+        for (const bool sameNode : { true, false })
+        {
+            for (size_t offset = 1; offset < queues.size(); ++offset)
+            {
+                const size_t victimIndex = (thiefIndex + offset) % queues.size();
+                if ((workerNodes[victimIndex] == workerNodes[thiefIndex]) != sameNode)
+                {
+                    continue;
+                }
+                auto &victim = *queues[victimIndex];
+                std::scoped_lock lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Nodes/Core/CpuTopology.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Work-stealing thread pool used by the parallel graph scheduler.
+     *
+     * Every worker owns a double-ended task queue. Workers pop their own queue from the back (LIFO, cache-warm)
+     * and steal from the front of other queues (FIFO) when they run dry. Tasks submitted from inside a worker
+     * are pushed to that worker's own queue, so a node that unblocks its successors tends to keep them local.
+     *
+     * With NUMA placement, workers are bound to memory nodes in contiguous blocks. Idle workers steal from
+     * their own node before crossing sockets, and tasks submitted by a thread bound to a node (see
+     * CpuTopology::BindCurrentThread()) go to that node's workers, so one run stays on one socket.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @brief Task executed by the pool.
+         */
+        using Task = std::function<void()>;
+
+        /**
+         * @brief Starts worker threads.
+         * @param workerCount Number of workers (0 selects std::thread::hardware_concurrency())
+         * @param pinWorkers Pin worker i to CPU core i (modulo the core count) so its caches stay warm
+         */
+        explicit ThreadPool(size_t workerCount = 0, bool pinWorkers = false);
+
+        /**
+         * @brief Starts worker threads bound to NUMA nodes.
+         * @param workerCount Number of workers (0 selects std::thread::hardware_concurrency())
+         * @param topology Nodes to spread workers over, a contiguous block each
+         */
+        ThreadPool(size_t workerCount, const CpuTopology &topology);
+
+        /**
+         * @brief Stops and joins all workers.
+         * @note Tasks still queued at destruction are discarded.
+         */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief Queues task for execution.
+         * @param task Task to run
+         */
+        void Submit(Task task);
+
+        /**
+         * @brief Returns number of worker threads.
+         * @return Worker count
+         */
+        [[nodiscard]] size_t GetWorkerCount() const
+        {
+            return workers.size();
+        }
+
+        /**
+         * @brief Returns the NUMA node a worker is bound to.
+         * @param index Worker index
+         * @return Index into CpuTopology::GetNodes(), or std::nullopt without NUMA placement
+         */
+        [[nodiscard]] std::optional<size_t> GetWorkerNode(size_t index) const;
+
+    private:
+        /**
+         * @brief Per-worker task deque.
+         */
+        struct WorkerQueue
+        {
+            std::mutex mutex;       ///< Protects tasks
+            std::deque<Task> tasks; ///< Pending tasks
+        };
+
+        /**
+         * @brief Creates queues and starts workers.
+         * @param workerCount Number of workers (0 selects std::thread::hardware_concurrency())
+         * @param pinWorkers Pin worker i to core i
+         * @param topology Nodes to bind workers to, or std::nullopt
+         */
+        ThreadPool(size_t workerCount, bool pinWorkers, std::optional<CpuTopology> topology);
+
+        /**
+         * @brief Picks the queue of an external submission.
+         * @return Queue index
+         */
+        size_t PickExternalQueue();
+
+        /**
+         * @brief Worker main loop.
+         * @param stopToken Token signalled on pool destruction
+         * @param index Worker index
+         * @param pin Pin the worker to a core before taking tasks
+         */
+        void WorkerLoop(std::stop_token stopToken, size_t index, bool pin);
+
+        /**
+         * @brief Pops task from worker's own queue.
+         * @param index Worker index
+         * @param task Output task
+         * @return True if a task was taken
+         */
+        bool TryPopLocal(size_t index, Task &task);
+
+        /**
+         * @brief Steals task from another worker's queue.
+         * @param thiefIndex Index of stealing worker
+         * @param task Output task
+         * @return True if a task was stolen
+         */
+        bool TrySteal(size_t thiefIndex, Task &task);
+
+        std::optional<CpuTopology> topology;              ///< Nodes workers are bound to (NUMA placement only)
+        std::vector<size_t> workerNodes;                  ///< Node of each worker (all 0 without NUMA placement)
+        std::vector<size_t> nodeFirstWorker;              ///< First worker of each node, plus the worker count
+        std::vector<std::unique_ptr<WorkerQueue>> queues; ///< One queue per worker
+        std::vector<std::jthread> workers;                ///< Worker threads
+        std::mutex wakeMutex;                             ///< Guards sleeping workers
+        std::condition_variable_any wakeCondition;        ///< Signalled when tasks are queued
+        std::atomic<size_t> pendingTasks{ 0 };            ///< Tasks queued but not yet taken
+        std::atomic<size_t> nextQueue{ 0 };               ///< Round-robin cursor for external submissions
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,205 @@
+#include "Nodes/Core/Tracer.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <nlohmann/json.hpp>
+#include <fstream>
+
+namespace VisionCraft::Nodes
+{
+    namespace
+    {
+        // Chrome trace timestamps are microseconds; fractions keep sub-microsecond events visible
+        double ToTraceMicroseconds(std::chrono::nanoseconds duration)
+        {
+            return static_cast<double>(duration.count()) / 1000.0;
+        }
+    } // namespace
+
+    Tracer &Tracer::Get()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    Tracer::Tracer() : epoch(Clock::now())
+    {
+    }
+
+    void Tracer::Start()
+    {
+        {
+            std::scoped_lock lock(buffersMutex);
+            for (const auto &buffer : buffers)
+            {
+                std::scoped_lock bufferLock(buffer->mutex);
+                buffer->events.clear();
+                buffer->dropped = 0;
+            }
+            epoch = Clock::now();
+        }
+        enabled.store(true, std::memory_order_release);
+        LOG_INFO("Trace recording started");
+    }
+
+    void Tracer::Stop()
+    {
+        enabled.store(false, std::memory_order_release);
+        LOG_INFO("Trace recording stopped ({} events)", GetEventCount());
+    }
+
+    void Tracer::Record(const char *category,
+        std::string_view name,
+        std::string_view detail,
+        Clock::time_point start,
+        Clock::time_point end)
+    {
+        auto &buffer = GetThreadBuffer();
+        std::scoped_lock lock(buffer.mutex);
+        if (buffer.events.size() >= Constants::Tracing::kMaxEventsPerThread)
+        {
+            ++buffer.dropped;
+            return;
+        }
+        buffer.events.push_back({ category, std::string(name), std::string(detail), start, end - start });
+    }
+
+    void Tracer::SetCurrentThreadName(std::string name)
+    {
+        auto &buffer = GetThreadBuffer();
+        std::scoped_lock lock(buffer.mutex);
+        buffer.threadName = std::move(name);
+    }
+
+    size_t Tracer::GetEventCount() const
+    {
+        std::scoped_lock lock(buffersMutex);
+        size_t count = 0;
+        for (const auto &buffer : buffers)
+        {
+            std::scoped_lock bufferLock(buffer->mutex);
+            count += buffer->events.size();
+        }
+        return count;
+    }
+
+    size_t Tracer::GetDroppedEventCount() const
+    {
+        std::scoped_lock lock(buffersMutex);
+        size_t count = 0;
+        for (const auto &buffer : buffers)
+        {
+            std::scoped_lock bufferLock(buffer->mutex);
+            count += buffer->dropped;
+        }
+        return count;
+    }
+
+    std::string Tracer::ToChromeTraceJson() const
+    {
+        auto events = nlohmann::json::array();
+
+        std::scoped_lock lock(buffersMutex);
+        for (const auto &buffer : buffers)
+        {
+            std::scoped_lock bufferLock(buffer->mutex);
+            if (buffer->events.empty())
+            {
+                continue;
+            }
+
+            const std::string threadName =
+                buffer->threadName.empty() ? "Thread " + std::to_string(buffer->threadId) : buffer->threadName;
+            events.push_back({ { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", 1 },
+                { "tid", buffer->threadId },
+                { "args", { { "name", threadName } } } });
+
+            for (const auto &event : buffer->events)
+            {
+                nlohmann::json entry = { { "name", event.name },
+                    { "cat", event.category },
+                    { "ph", "X" },
+                    { "ts", ToTraceMicroseconds(event.start - epoch) },
+                    { "dur", ToTraceMicroseconds(event.duration) },
+                    { "pid", 1 },
+                    { "tid", buffer->threadId } };
+                if (!event.detail.empty())
+                {
+                    entry["args"] = { { "detail", event.detail } };
+                }
+                events.push_back(std::move(entry));
+            }
+        }
+
+        return nlohmann::json{ { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } }.dump();
+    }
+
+    bool Tracer::WriteChromeTrace(const std::filesystem::path &path) const
+    {
+        std::ofstream file(path);
+        if (!file)
+        {
+            LOG_ERROR("Failed to open trace file for writing: {}", path.string());
+            return false;
+        }
+
+        file << ToChromeTraceJson();
+        if (!file)
+        {
+            LOG_ERROR("Failed to write trace file: {}", path.string());
+            return false;
+        }
+
+        const auto dropped = GetDroppedEventCount();
+        if (dropped > 0)
+        {
+            LOG_WARN("Trace dropped {} events after reaching the per-thread limit", dropped);
+        }
+        LOG_INFO("Wrote {} trace events to {}", GetEventCount(), path.string());
+        return true;
+    }
+
+    Tracer::ThreadBuffer &Tracer::GetThreadBuffer()
+    {
+        // The tracer is a process-wide singleton, so one cached buffer per thread is enough
+        thread_local std::shared_ptr<ThreadBuffer> threadBuffer;
+        if (!threadBuffer)
+        {
+            threadBuffer = std::make_shared<ThreadBuffer>();
+            std::scoped_lock lock(buffersMutex);
+            threadBuffer->threadId = static_cast<uint32_t>(buffers.size() + 1);
+            buffers.push_back(threadBuffer);
+        }
+        return *threadBuffer;
+    }
+
+    TraceScope::TraceScope(const char *category, std::string_view name)
+    {
+        if (Tracer::Get().IsEnabled())
+        {
+            active = true;
+            this->category = category;
+            this->name = name;
+            start = Tracer::Clock::now();
+        }
+    }
+
+    TraceScope::~TraceScope()
+    {
+        if (active)
+        {
+            Tracer::Get().Record(category, name, detail, start, Tracer::Clock::now());
+        }
+    }
+
+    void TraceScope::SetDetail(std::string text)
+    {
+        if (active)
+        {
+            detail = std::move(text);
+        }
+    }
+
+} // namespace VisionCraft::Nodes
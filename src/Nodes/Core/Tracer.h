@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Process-wide, opt-in recorder of timed events exported as Chrome trace JSON.
+     *
+     * While recording, TraceScope instances on any thread append complete ("X") events to a
+     * per-thread buffer, so threads never contend with each other. The result opens in Perfetto
+     * (ui.perfetto.dev) or chrome://tracing and shows plan compilation, data passes, node
+     * processing, lock waits and I/O stages on one timeline per thread.
+     *
+     * When not recording, a TraceScope costs one relaxed atomic load.
+     */
+    class Tracer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Returns the process-wide tracer.
+         * @return Tracer instance
+         */
+        [[nodiscard]] static Tracer &Get();
+
+        /**
+         * @brief Discards previously recorded events and starts recording.
+         */
+        void Start();
+
+        /**
+         * @brief Stops recording; recorded events are kept until the next Start().
+         */
+        void Stop();
+
+        /**
+         * @brief Checks if events are being recorded.
+         * @return True between Start() and Stop()
+         */
+        [[nodiscard]] bool IsEnabled() const
+        {
+            return enabled.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Records a complete event on the calling thread.
+         * @param category Event category (string literal, e.g. "node")
+         * @param name Event name shown on the timeline
+         * @param detail Optional text shown in the event's args
+         * @param start Event start
+         * @param end Event end
+         */
+        void Record(const char *category,
+            std::string_view name,
+            std::string_view detail,
+            Clock::time_point start,
+            Clock::time_point end);
+
+        /**
+         * @brief Names the calling thread in exported traces (e.g. "Worker 2").
+         * @param name Thread name
+         */
+        void SetCurrentThreadName(std::string name);
+
+        /**
+         * @brief Returns recorded event count across all threads.
+         * @return Event count
+         */
+        [[nodiscard]] size_t GetEventCount() const;
+
+        /**
+         * @brief Returns events discarded because a thread buffer was full.
+         * @return Dropped event count
+         */
+        [[nodiscard]] size_t GetDroppedEventCount() const;
+
+        /**
+         * @brief Serializes recorded events in the Chrome trace event format.
+         * @return JSON document with a traceEvents array
+         */
+        [[nodiscard]] std::string ToChromeTraceJson() const;
+
+        /**
+         * @brief Writes recorded events to a Chrome trace file.
+         * @param path Output file (conventionally *.json)
+         * @return True if the file was written
+         */
+        bool WriteChromeTrace(const std::filesystem::path &path) const;
+
+    private:
+        /**
+         * @brief Recorded complete event.
+         */
+        struct Event
+        {
+            const char *category;              ///< Category literal
+            std::string name;                  ///< Timeline label
+            std::string detail;                ///< Optional args text
+            Clock::time_point start;           ///< Start time
+            std::chrono::nanoseconds duration; ///< Duration
+        };
+
+        /**
+         * @brief Events of one thread (the lock is only contended while exporting).
+         */
+        struct ThreadBuffer
+        {
+            std::mutex mutex;          ///< Guards all members below
+            uint32_t threadId = 0;     ///< Sequential ID used as the trace tid
+            std::string threadName;    ///< Name from SetCurrentThreadName()
+            std::vector<Event> events; ///< Recorded events
+            size_t dropped = 0;        ///< Events discarded at capacity
+        };
+
+        Tracer();
+
+        /**
+         * @brief Returns the calling thread's buffer, registering it on first use.
+         * @return Thread buffer (kept alive by the tracer after the thread exits)
+         */
+        ThreadBuffer &GetThreadBuffer();
+
+        std::atomic<bool> enabled = false;                  ///< Recording flag
+        mutable std::mutex buffersMutex;                    ///< Guards buffers
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers; ///< One buffer per thread that recorded
+        Clock::time_point epoch;                            ///< Time of the last Start() (trace time zero)
+    };
+
+    /**
+     * @brief RAII helper recording the lifetime of a scope as one trace event.
+     *
+     * Does nothing unless the tracer was recording when the scope began.
+     */
+    class TraceScope
+    {
+    public:
+        /**
+         * @brief Starts timing the scope.
+         * @param category Event category (string literal)
+         * @param name Event name (copied only while recording)
+         */
+        TraceScope(const char *category, std::string_view name);
+
+        /**
+         * @brief Records the event.
+         */
+        ~TraceScope();
+
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+
+        /**
+         * @brief Checks if the event will be recorded.
+         * @return True if the tracer was recording when the scope began
+         */
+        [[nodiscard]] bool IsActive() const
+        {
+            return active;
+        }
+
+        /**
+         * @brief Attaches extra text to the event (check IsActive() before building expensive strings).
+         * @param text Text shown in the event's args
+         */
+        void SetDetail(std::string text);
+
+    private:
+        bool active = false;               ///< Recording when the scope began
+        const char *category = nullptr;    ///< Event category
+        std::string name;                  ///< Event name
+        std::string detail;                ///< Optional args text
+        Tracer::Clock::time_point start{}; ///< Scope start
+    };
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,133 @@
+#include "Nodes/Core/WriteBehindQueue.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace VisionCraft::Nodes
+{
+    WriteBehindQueue &WriteBehindQueue::Get()
+    {
+        static WriteBehindQueue queue(Constants::Output::kWriteBehindThreads, Constants::Output::kWriteBehindCapacity);
+        return queue;
+    }
+
+    WriteBehindQueue::WriteBehindQueue(size_t workerCount, size_t capacity)
+        : workerCount(workerCount > 0 ? workerCount : 1), jobs(capacity)
+    {
+        std::promise<void> done;
+        done.set_value();
+        idle = done.get_future().share();
+    }
+
+    WriteBehindQueue::~WriteBehindQueue()
+    {
+        // Workers drain what is still queued before Pop() reports the close
+        jobs.Close();
+        workers.clear();
+    }
+
+    std::shared_future<bool> WriteBehindQueue::Submit(Write write)
+    {
+        auto job = std::make_shared<Job>();
+        job->write = std::move(write);
+        auto result = job->result.get_future().share();
+        {
+            std::scoped_lock lock(mutex);
+            job->id = ++lastSubmittedId;
+            pendingIds.insert(job->id);
+            ++stats.submitted;
+        }
+
+        StartWorkers();
+        auto queued = job;
+        if (jobs.TryPush(queued))
+        {
+            return result;
+        }
+
+        {
+            std::scoped_lock lock(mutex);
+            ++stats.stalls;
+        }
+        TraceScope trace("io", "WriteBehindStall");
+        if (!jobs.Push(job))
+        {
+            // Closed while the queue is being destroyed; nobody is left to run it
+            Run(*job);
+        }
+        return result;
+    }
+
+    std::shared_future<void> WriteBehindQueue::Flush()
+    {
+        std::scoped_lock lock(mutex);
+        if (pendingIds.empty())
+        {
+            return idle; // Shared, so runs that write nothing do not allocate a promise each
+        }
+
+        auto &waiter = waiters.emplace_back();
+        waiter.lastId = lastSubmittedId;
+        return waiter.flushed.get_future().share();
+    }
+
+    WriteBehindQueue::Statistics WriteBehindQueue::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void WriteBehindQueue::StartWorkers()
+    {
+        std::call_once(workersStarted, [this]() {
+            workers.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                workers.emplace_back([this]() {
+                    while (auto job = jobs.Pop())
+                    {
+                        Run(**job);
+                    }
+                });
+            }
+        });
+    }
+
+    void WriteBehindQueue::Run(Job &job)
+    {
+        bool succeeded = false;
+        {
+            TraceScope trace("io", "WriteBehind");
+            try
+            {
+                succeeded = job.write();
+            }
+            catch (const std::exception &e)
+            {
+                LOG_ERROR("WriteBehindQueue: Write {} threw: {}", job.id, e.what());
+            }
+            catch (...)
+            {
+                LOG_ERROR("WriteBehindQueue: Write {} threw an unknown exception", job.id);
+            }
+        }
+        job.result.set_value(succeeded);
+
+        std::scoped_lock lock(mutex);
+        ++(succeeded ? stats.completed : stats.failed);
+        pendingIds.erase(job.id);
+
+        // Waiters are ordered by lastId, so the satisfied ones are at the front
+        const uint64_t oldestPending = pendingIds.empty() ? lastSubmittedId + 1 : *pendingIds.begin();
+        while (!waiters.empty() && waiters.front().lastId < oldestPending)
+        {
+            waiters.front().flushed.set_value();
+            waiters.pop_front();
+        }
+    }
+
+} // namespace VisionCraft::Nodes
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Nodes/Core/BoundedQueue.h"
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace VisionCraft::Nodes
+{
+    /**
+     * @brief Runs file writes on background threads so execution does not wait for encoding.
+     *
+     * Nodes that save results (ImageOutputNode's AutoSave) submit a write and return; the next image can be
+     * processed while the previous one encodes. The queue is bounded: once it holds its capacity of
+     * writes, Submit() waits for a worker to take one, so a graph producing faster than the disk drains
+     * slows down instead of buffering images without limit.
+     *
+     * Flush() signals when every write submitted so far is done. NodeEditor stores it on each run's
+     * RunStatistics::writesFlushed.
+     *
+     * All methods are thread-safe. Worker threads start on the first Submit().
+     */
+    class WriteBehindQueue
+    {
+    public:
+        /**
+         * @brief Write to run; returns true on success. Exceptions count as failures.
+         */
+        using Write = std::function<bool()>;
+
+        /**
+         * @brief Queue counters.
+         */
+        struct Statistics
+        {
+            size_t submitted = 0; ///< Submit() calls
+            size_t completed = 0; ///< Writes that succeeded
+            size_t failed = 0;    ///< Writes that returned false or threw
+            size_t stalls = 0;    ///< Submit() calls that waited for room in a full queue
+        };
+
+        /**
+         * @brief Returns the process-wide queue.
+         * @return Queue with Constants::Output::kWriteBehindThreads workers and kWriteBehindCapacity slots
+         */
+        [[nodiscard]] static WriteBehindQueue &Get();
+
+        /**
+         * @brief Constructs queue.
+         * @param workerCount Threads running writes (at least 1)
+         * @param capacity Writes queued before Submit() waits (at least 1)
+         */
+        WriteBehindQueue(size_t workerCount, size_t capacity);
+
+        /**
+         * @brief Finishes every queued write, then stops the workers.
+         */
+        ~WriteBehindQueue();
+
+        WriteBehindQueue(const WriteBehindQueue &) = delete;
+        WriteBehindQueue &operator=(const WriteBehindQueue &) = delete;
+
+        /**
+         * @brief Queues a write, waiting while the queue is full.
+         * @param write Write to run on a worker thread (must own everything it touches)
+         * @return Future of the write's result
+         */
+        std::shared_future<bool> Submit(Write write);
+
+        /**
+         * @brief Returns a signal for the writes submitted so far.
+         * @return Future that becomes ready once all of them are done (already ready if none are pending)
+         */
+        [[nodiscard]] std::shared_future<void> Flush();
+
+        /**
+         * @brief Returns queue counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        /**
+         * @brief Queued write.
+         */
+        struct Job
+        {
+            uint64_t id = 0;           ///< Submission number
+            Write write;               ///< Write to run
+            std::promise<bool> result; ///< Completed by the worker
+        };
+
+        /**
+         * @brief Flush() waiting for every write up to a submission number.
+         */
+        struct FlushWaiter
+        {
+            uint64_t lastId = 0;        ///< Newest write submitted before the Flush() call
+            std::promise<void> flushed; ///< Set once no write up to lastId is pending
+        };
+
+        /**
+         * @brief Starts the worker threads on first use.
+         */
+        void StartWorkers();
+
+        /**
+         * @brief Runs a write and completes its future and any flushes it was holding up.
+         * @param job Write to run
+         */
+        void Run(Job &job);
+
+        mutable std::mutex mutex;        ///< Guards members below up to workers
+        uint64_t lastSubmittedId = 0;    ///< Newest submission number
+        std::set<uint64_t> pendingIds;   ///< Writes submitted but not finished
+        std::deque<FlushWaiter> waiters; ///< Pending flushes, oldest (smallest lastId) first
+        std::shared_future<void> idle;   ///< Ready signal Flush() hands out while nothing is pending
+        Statistics stats;                ///< Counters
+
+        size_t workerCount;                      ///< Threads started by StartWorkers()
+        BoundedQueue<std::shared_ptr<Job>> jobs; ///< Writes waiting for a worker (shared so a failed push keeps them)
+        std::once_flag workersStarted;           ///< Guards workers creation
+        std::vector<std::jthread> workers;       ///< Threads running writes
+    };
+
+} // namespace VisionCraft::Nodes
@@ -87,6 +87,15 @@ namespace VisionCraft::UI::Canvas
             return zoomLevel;
         }
 
+        /**
+         * @brief Checks if the zoom level shows node detail (text, pins, widgets, previews, curved wires).
+         * @return False when zoomed out to the overview level of detail
+         */
+        [[nodiscard]] bool IsDetailVisible() const
+        {
+            return zoomLevel >= Constants::Zoom::kMinForDetail;
+        }
+
         /**
          * @brief Sets zoom level.
          * @param newZoom Target zoom level
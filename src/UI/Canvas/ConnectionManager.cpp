@@ -1,5 +1,6 @@
 #include "UI/Canvas/ConnectionManager.h"
 #include "UI/Layers/NodeEditorLayer.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "UI/Rendering/NodeRenderer.h"
 #include "Logger.h"
 
@@ -11,6 +12,31 @@
 
 namespace VisionCraft::UI::Canvas
 {
+    namespace
+    {
+        Widgets::NodeConnection ToNodeConnection(const Nodes::Connection &connection)
+        {
+            return { { connection.from, connection.fromSlot }, { connection.to, connection.toSlot } };
+        }
+
+        /**
+         * @brief Returns the horizontal control point offset of a wire's Bezier curve.
+         * @param startPos Output pin in screen coordinates
+         * @param endPos Input pin in screen coordinates
+         * @param canvas Canvas (zoom level)
+         * @return Offset, or 0 (a straight segment) when zoomed out past the detail level
+         */
+        float ConnectionTension(const ImVec2 &startPos, const ImVec2 &endPos, const CanvasController &canvas)
+        {
+            if (!canvas.IsDetailVisible())
+            {
+                return 0.0f;
+            }
+            const auto distance = std::abs(endPos.x - startPos.x);
+            return std::min(distance * 0.5f, Constants::Connection::kBezierTension * canvas.GetZoomLevel());
+        }
+    } // namespace
+
     ConnectionManager::ConnectionManager() : connectionState{}
     {
     }
@@ -21,6 +47,7 @@ namespace VisionCraft::UI::Canvas
 
     void ConnectionManager::HandleConnectionInteractions(Nodes::NodeEditor &nodeEditor,
         const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions,
+        const NodeSpatialIndex &nodeIndex,
         const CanvasController &canvas)
     {
         const auto &io = ImGui::GetIO();
@@ -37,7 +64,7 @@ namespace VisionCraft::UI::Canvas
                 return;
             }
 
-            const auto clickedPin = FindPinAtPosition(mousePos, nodeEditor, nodePositions, canvas);
+            const auto clickedPin = FindPinAtPosition(mousePos, nodeEditor, nodePositions, nodeIndex, canvas);
             if (clickedPin.nodeId != Constants::Special::kInvalidNodeId)
             {
                 if (!connectionState.isCreating)
@@ -113,11 +140,33 @@ namespace VisionCraft::UI::Canvas
         const CanvasController &canvas,
         const std::optional<Widgets::NodeConnection> &hoveredConnection)
     {
+        Rendering::FrameScope frameScope(Rendering::FrameSection::RenderConnections);
         auto *drawList = ImGui::GetWindowDrawList();
+        ImVec2 visibleMin;
+        ImVec2 visibleMax;
+        canvas.GetVisibleWorldBounds(visibleMin, visibleMax);
+
+        const WireCurve *hoveredCurve = nullptr;
         for (const auto &connection : connections)
         {
-            const bool isHovered = hoveredConnection.has_value() && hoveredConnection.value() == connection;
-            RenderConnection(connection, nodeEditor, nodePositions, canvas, isHovered);
+            const auto *curve = GetWireCurve(connection, nodeEditor, nodePositions);
+            if (!curve || curve->max.x < visibleMin.x || curve->min.x > visibleMax.x || curve->max.y < visibleMin.y
+                || curve->min.y > visibleMax.y)
+            {
+                continue;
+            }
+
+            // The highlighted wire is drawn last, on top of the others
+            if (hoveredConnection.has_value() && hoveredConnection.value() == connection)
+            {
+                hoveredCurve = curve;
+                continue;
+            }
+            RenderWire(*curve, canvas, false);
+        }
+        if (hoveredCurve)
+        {
+            RenderWire(*hoveredCurve, canvas, true);
         }
 
         if (connectionState.isCreating)
@@ -141,14 +190,26 @@ namespace VisionCraft::UI::Canvas
             return false;
         }
 
+        // Rejects images the consumer cannot process, when the producer's shape is known before any run
+        const Nodes::Connection candidate{
+            .from = outputPin.nodeId, .fromSlot = outputPin.pinName, .to = inputPin.nodeId, .toSlot = inputPin.pinName
+        };
+        if (const auto mismatch = nodeEditor.CheckConnectionShapes(candidate))
+        {
+            LOG_WARN("Connection rejected: {}", *mismatch);
+            return false;
+        }
+        if (const auto mismatch = nodeEditor.CheckConnectionTypes(candidate))
+        {
+            LOG_WARN("Connection rejected: {}", *mismatch);
+            return false;
+        }
+
         const Widgets::NodeConnection newConnection{ outputPin, inputPin };
 
         // If callback is enabled, let the command handle the actual connection creation
         if (notifyCallback && onConnectionCreated)
         {
-            // Remove existing connection to input first
-            RemoveConnectionToInput(inputPin);
-            // Notify callback BEFORE adding connection
             // The callback will create a command which will call this method again with notifyCallback=false
             onConnectionCreated(newConnection);
             return true;
@@ -158,29 +219,12 @@ namespace VisionCraft::UI::Canvas
 
         // Determine connection type based on pin type (execution vs data)
         const auto *outputNode = nodeEditor.GetNode(outputPin.nodeId);
-        Nodes::ConnectionType connectionType = Nodes::ConnectionType::Data;
-        bool isExecutionConnection = false;
-
-        if (outputNode)
-        {
-            // Check if this is an execution pin
-            if (outputNode->HasExecutionOutputPin(outputPin.pinName))
-            {
-                connectionType = Nodes::ConnectionType::Execution;
-                isExecutionConnection = true;
-            }
-        }
-
-        // For execution pins: remove BOTH existing connections (1:1 rule)
-        // For data pins: remove only connection to input (1:N rule - one input, many outputs)
-        if (isExecutionConnection)
-        {
-            // Remove any existing connection FROM this execution output pin (1:1)
-            RemoveConnectionFromOutput(outputPin);
-        }
-        RemoveConnectionToInput(inputPin);
+        const auto connectionType = outputNode && outputNode->HasExecutionOutputPin(outputPin.pinName)
+                                        ? Nodes::ConnectionType::Execution
+                                        : Nodes::ConnectionType::Data;
 
-        connections.push_back(newConnection);
+        // The editor replaces conflicting connections (1:1 for execution pins, one per input for data pins)
+        // and reports the change back through ApplyConnectionDelta()
         nodeEditor.AddConnection(
             outputPin.nodeId, outputPin.pinName, inputPin.nodeId, inputPin.pinName, connectionType);
 
@@ -246,14 +290,7 @@ namespace VisionCraft::UI::Canvas
 
     bool ConnectionManager::IsPinConnected(const Widgets::PinId &pin) const
     {
-        for (const auto &connection : connections)
-        {
-            if (connection.inputPin == pin || connection.outputPin == pin)
-            {
-                return true;
-            }
-        }
-        return false;
+        return pinConnections.contains(pin);
     }
 
     bool ConnectionManager::PinNeedsInputWidget(Nodes::NodeId nodeId, const Widgets::NodePin &pin) const
@@ -266,33 +303,29 @@ namespace VisionCraft::UI::Canvas
     Widgets::PinId ConnectionManager::FindPinAtPosition(const ImVec2 &mousePos,
         const Nodes::NodeEditor &nodeEditor,
         const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions,
+        const NodeSpatialIndex &nodeIndex,
         const CanvasController &canvas) const
     {
-        Widgets::PinId closestPin = { Constants::Special::kInvalidNodeId, "" };
-        // closestDistanceSquared was unused
-
-        const auto nodeIds = nodeEditor.GetNodeIds();
-        for (const auto nodeId : nodeIds)
-        {
-            const auto *node = nodeEditor.GetNode(nodeId);
-            if (!node || nodePositions.find(nodeId) == nodePositions.end())
-            {
-                continue;
-            }
+        Rendering::FrameScope frameScope(Rendering::FrameSection::HitTesting);
 
-            const auto pins = GetNodePins(node);
-            // dimensions variable was unused here
-            const auto &nodePos = nodePositions.at(nodeId);
-            // nodeWorldPos was unused
+        // Pins lie inside their node's bounds, so only nodes within a pin radius of the mouse can be hit
+        const auto worldPos = canvas.ScreenToWorld(mousePos);
+        const auto pinRadius = Constants::Pin::kRadius;
+        nodeIndex.Query(ImVec2(worldPos.x - pinRadius, worldPos.y - pinRadius),
+            ImVec2(worldPos.x + pinRadius, worldPos.y + pinRadius),
+            hitCandidates);
 
-            const auto pinInNode = FindPinAtPositionInNode(mousePos, nodeId, nodeEditor, nodePositions, canvas);
+        // Nodes are drawn in ascending ID order, so the last candidate is on top
+        for (auto it = hitCandidates.rbegin(); it != hitCandidates.rend(); ++it)
+        {
+            const auto pinInNode = FindPinAtPositionInNode(mousePos, *it, nodeEditor, nodePositions, canvas);
             if (pinInNode.nodeId != Constants::Special::kInvalidNodeId)
             {
                 return pinInNode;
             }
         }
 
-        return closestPin;
+        return { Constants::Special::kInvalidNodeId, "" };
     }
 
     Widgets::PinId ConnectionManager::FindPinAtPositionInNode(const ImVec2 &mousePos,
@@ -302,105 +335,28 @@ namespace VisionCraft::UI::Canvas
         const CanvasController &canvas) const
     {
         const auto *node = nodeEditor.GetNode(nodeId);
-        if (!node || nodePositions.find(nodeId) == nodePositions.end())
+        const auto posIt = nodePositions.find(nodeId);
+        if (!node || posIt == nodePositions.end() || !canvas.IsDetailVisible())
         {
-            return { Constants::Special::kInvalidNodeId, "" };
+            return { Constants::Special::kInvalidNodeId, "" }; // Overview nodes draw no pins
         }
 
-        const auto pins = GetNodePins(node);
-        const auto dimensions = Rendering::NodeRenderer::CalculateNodeDimensions(pins, canvas.GetZoomLevel(), node);
-        const auto &nodePos = nodePositions.at(nodeId);
-        const auto nodeWorldPos = canvas.WorldToScreen(ImVec2(nodePos.x, nodePos.y));
-
-        // Separate pins into execution and data pins
-        const auto [executionInputPins, executionOutputPins, dataInputPins, dataOutputPins] =
-            Widgets::SeparatePinsByType(pins);
-
-        const auto titleHeight = Constants::Node::kTitleHeight * canvas.GetZoomLevel();
-        const auto compactPinHeight = Constants::Pin::kCompactHeight * canvas.GetZoomLevel();
-        const auto extendedPinHeight = Constants::Pin::kHeight * canvas.GetZoomLevel();
-        const auto compactSpacing = Constants::Pin::kCompactSpacing * canvas.GetZoomLevel();
-        const auto normalSpacing = Constants::Pin::kSpacing * canvas.GetZoomLevel();
-        const auto padding = Constants::Node::kPadding * canvas.GetZoomLevel();
-        const auto pinRadius = Constants::Pin::kRadius * canvas.GetZoomLevel();
+        // Compare in world units against the zoom-independent layout
+        const auto worldPos = canvas.ScreenToWorld(mousePos);
+        const auto localX = worldPos.x - posIt->second.x;
+        const auto localY = worldPos.y - posIt->second.y;
+        const auto pinRadius = Constants::Pin::kRadius;
 
-        const bool hasExecutionPins = !executionInputPins.empty() || !executionOutputPins.empty();
-        const auto executionRowHeight = Constants::Pin::kCompactHeight * canvas.GetZoomLevel();
-
-        // Check execution input pins (horizontal row at top left)
-        if (hasExecutionPins)
+        for (const auto &[pinName, offset] : GetPinLayout(nodeId, node).anchors)
         {
-            const auto executionRowY = nodeWorldPos.y + titleHeight + padding + (executionRowHeight * 0.5f);
-
-            for (const auto &pin : executionInputPins)
-            {
-                const auto pinPos = ImVec2(nodeWorldPos.x + padding, executionRowY);
-                const auto distance = ImVec2(mousePos.x - pinPos.x, mousePos.y - pinPos.y);
-                const auto distanceSquared = distance.x * distance.x + distance.y * distance.y;
-                if (distanceSquared <= pinRadius * pinRadius)
-                {
-                    return { nodeId, pin.name };
-                }
-            }
-
-            // Check execution output pins (horizontal row at top right)
-            for (const auto &pin : executionOutputPins)
+            const auto dx = localX - offset.x;
+            const auto dy = localY - offset.y;
+            if (dx * dx + dy * dy <= pinRadius * pinRadius)
             {
-                const auto pinPos = ImVec2(nodeWorldPos.x + dimensions.size.x - padding, executionRowY);
-                const auto distance = ImVec2(mousePos.x - pinPos.x, mousePos.y - pinPos.y);
-                const auto distanceSquared = distance.x * distance.x + distance.y * distance.y;
-                if (distanceSquared <= pinRadius * pinRadius)
-                {
-                    return { nodeId, pin.name };
-                }
+                return { nodeId, pinName };
             }
         }
 
-        // Check data input pins using dynamic spacing (column below execution row)
-        const auto leftColumnX = nodeWorldPos.x + padding;
-        const auto executionRowOffset = hasExecutionPins ? (executionRowHeight + compactSpacing) : 0.0f;
-        const auto startY = nodeWorldPos.y + titleHeight + padding + executionRowOffset;
-        float currentY = startY;
-
-        for (std::size_t i = 0; i < dataInputPins.size(); ++i)
-        {
-            const auto &pin = dataInputPins[i];
-            const bool needsInputWidget = PinNeedsInputWidget(nodeId, pin);
-            const auto currentPinHeight = needsInputWidget ? extendedPinHeight : compactPinHeight;
-            const auto currentSpacing = needsInputWidget ? normalSpacing : compactSpacing;
-
-            const auto pinPos = ImVec2(leftColumnX, currentY + currentPinHeight * 0.5f);
-            const auto distance = ImVec2(mousePos.x - pinPos.x, mousePos.y - pinPos.y);
-            const auto distanceSquared = distance.x * distance.x + distance.y * distance.y;
-            if (distanceSquared <= pinRadius * pinRadius)
-            {
-                return { nodeId, pin.name };
-            }
-
-            currentY += currentPinHeight + currentSpacing;
-        }
-
-        // Check data output pins (column below execution row)
-        const auto rightColumnX = nodeWorldPos.x + dimensions.size.x - padding;
-        currentY = startY;
-
-        for (std::size_t i = 0; i < dataOutputPins.size(); ++i)
-        {
-            const auto &pin = dataOutputPins[i];
-            const auto currentPinHeight = compactPinHeight;
-            const auto currentSpacing = compactSpacing;
-
-            const auto pinPos = ImVec2(rightColumnX, currentY + currentPinHeight * 0.5f);
-            const auto distance = ImVec2(mousePos.x - pinPos.x, mousePos.y - pinPos.y);
-            const auto distanceSquared = distance.x * distance.x + distance.y * distance.y;
-            if (distanceSquared <= pinRadius * pinRadius)
-            {
-                return { nodeId, pin.name };
-            }
-
-            currentY += currentPinHeight + currentSpacing;
-        }
-
         return { Constants::Special::kInvalidNodeId, "" };
     }
 
@@ -409,94 +365,85 @@ namespace VisionCraft::UI::Canvas
         const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions,
         const CanvasController &canvas) const
     {
-        if (pinId.nodeId == Constants::Special::kInvalidNodeId
-            || nodePositions.find(pinId.nodeId) == nodePositions.end())
+        if (pinId.nodeId == Constants::Special::kInvalidNodeId)
         {
             return ImVec2(0, 0);
         }
 
-        const auto *node = nodeEditor.GetNode(pinId.nodeId);
-        if (!node)
+        const auto anchor = FindPinAnchor(pinId, nodeEditor, nodePositions);
+        return anchor ? canvas.WorldToScreen(*anchor) : ImVec2(0, 0);
+    }
+
+    const ConnectionManager::PinLayout &ConnectionManager::GetPinLayout(Nodes::NodeId nodeId,
+        const Nodes::Node *node) const
+    {
+        const auto it = pinLayouts.find(nodeId);
+        if (it != pinLayouts.end())
         {
-            return ImVec2(0, 0);
+            return it->second;
         }
+        return pinLayouts.emplace(nodeId, BuildPinLayout(nodeId, node)).first->second;
+    }
 
+    ConnectionManager::PinLayout ConnectionManager::BuildPinLayout(Nodes::NodeId nodeId,
+        const Nodes::Node *node) const
+    {
         const auto pins = GetNodePins(node);
-        const auto dimensions = Rendering::NodeRenderer::CalculateNodeDimensions(pins, canvas.GetZoomLevel(), node);
-        const auto &nodePos = nodePositions.at(pinId.nodeId);
-        const auto nodeWorldPos = canvas.WorldToScreen(ImVec2(nodePos.x, nodePos.y));
+        const auto nodeWidth = Constants::Node::kWidth;
 
-        const auto titleHeight = Constants::Node::kTitleHeight * canvas.GetZoomLevel();
-        const auto compactPinHeight = Constants::Pin::kCompactHeight * canvas.GetZoomLevel();
-        const auto extendedPinHeight = Constants::Pin::kHeight * canvas.GetZoomLevel();
-        const auto compactSpacing = Constants::Pin::kCompactSpacing * canvas.GetZoomLevel();
-        const auto normalSpacing = Constants::Pin::kSpacing * canvas.GetZoomLevel();
-        const auto padding = Constants::Node::kPadding * canvas.GetZoomLevel();
+        const auto titleHeight = Constants::Node::kTitleHeight;
+        const auto compactPinHeight = Constants::Pin::kCompactHeight;
+        const auto extendedPinHeight = Constants::Pin::kHeight;
+        const auto compactSpacing = Constants::Pin::kCompactSpacing;
+        const auto normalSpacing = Constants::Pin::kSpacing;
+        const auto padding = Constants::Node::kPadding;
 
         // Separate pins into execution and data pins
         const auto [executionInputPins, executionOutputPins, dataInputPins, dataOutputPins] =
             Widgets::SeparatePinsByType(pins);
 
         const bool hasExecutionPins = !executionInputPins.empty() || !executionOutputPins.empty();
-        const auto executionRowHeight = Constants::Pin::kCompactHeight * canvas.GetZoomLevel();
+        const auto executionRowHeight = Constants::Pin::kCompactHeight;
 
-        // Check if requested pin is an execution input pin (horizontal row at top left)
+        PinLayout layout;
+        layout.anchors.reserve(pins.size());
+
+        // Execution pins share a horizontal row at the top (inputs left, outputs right)
         if (hasExecutionPins)
         {
-            const auto executionRowY = nodeWorldPos.y + titleHeight + padding + (executionRowHeight * 0.5f);
-
+            const auto executionRowY = titleHeight + padding + (executionRowHeight * 0.5f);
             for (const auto &pin : executionInputPins)
             {
-                if (pin.name == pinId.pinName)
-                {
-                    return ImVec2(nodeWorldPos.x + padding, executionRowY);
-                }
+                layout.anchors.emplace_back(pin.name, ImVec2(padding, executionRowY));
             }
-
-            // Check if requested pin is an execution output pin (horizontal row at top right)
             for (const auto &pin : executionOutputPins)
             {
-                if (pin.name == pinId.pinName)
-                {
-                    return ImVec2(nodeWorldPos.x + dimensions.size.x - padding, executionRowY);
-                }
+                layout.anchors.emplace_back(pin.name, ImVec2(nodeWidth - padding, executionRowY));
             }
         }
 
-        const auto leftColumnX = nodeWorldPos.x + padding;
-        const auto rightColumnX = nodeWorldPos.x + dimensions.size.x - padding;
+        // Data pins are stacked in columns below the execution row
         const auto executionRowOffset = hasExecutionPins ? (executionRowHeight + compactSpacing) : 0.0f;
-        const auto startY = nodeWorldPos.y + titleHeight + padding + executionRowOffset;
+        const auto startY = titleHeight + padding + executionRowOffset;
 
-        // Check data input pins
         float currentY = startY;
         for (const auto &pin : dataInputPins)
         {
-            if (pin.name == pinId.pinName)
-            {
-                const bool needsInputWidget = PinNeedsInputWidget(pinId.nodeId, pin);
-                const auto currentPinHeight = needsInputWidget ? extendedPinHeight : compactPinHeight;
-                return ImVec2(leftColumnX, currentY + currentPinHeight * 0.5f);
-            }
-
-            const bool needsInputWidget = PinNeedsInputWidget(pinId.nodeId, pin);
+            const bool needsInputWidget = PinNeedsInputWidget(nodeId, pin);
             const auto currentPinHeight = needsInputWidget ? extendedPinHeight : compactPinHeight;
             const auto currentSpacing = needsInputWidget ? normalSpacing : compactSpacing;
+            layout.anchors.emplace_back(pin.name, ImVec2(padding, currentY + currentPinHeight * 0.5f));
             currentY += currentPinHeight + currentSpacing;
         }
 
-        // Check data output pins
         currentY = startY;
         for (const auto &pin : dataOutputPins)
         {
-            if (pin.name == pinId.pinName)
-            {
-                return ImVec2(rightColumnX, currentY + compactPinHeight * 0.5f);
-            }
+            layout.anchors.emplace_back(pin.name, ImVec2(nodeWidth - padding, currentY + compactPinHeight * 0.5f));
             currentY += compactPinHeight + compactSpacing;
         }
 
-        return ImVec2(0, 0);
+        return layout;
     }
 
     const std::vector<Widgets::NodeConnection> &ConnectionManager::GetConnections() const
@@ -521,12 +468,16 @@ namespace VisionCraft::UI::Canvas
         static const std::unordered_map<std::string, std::vector<Widgets::NodePin>> nodePinDefinitions = {
             { "Image Input",
                 { { "FilePath", Widgets::PinType::Data, Widgets::PinDataType::Path, true },
+                    { "MemoryMap", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             { "Image Output",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "SavePath", Widgets::PinType::Data, Widgets::PinDataType::Path, true },
                     { "AutoSave", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
-                    { "Format", Widgets::PinType::Data, Widgets::PinDataType::String, true } } },
+                    { "Format", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "Profile", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "ThumbnailPath", Widgets::PinType::Data, Widgets::PinDataType::Path, true },
+                    { "ThumbnailSize", Widgets::PinType::Data, Widgets::PinDataType::Int, true } } },
             { "Grayscale",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Method", Widgets::PinType::Data, Widgets::PinDataType::String, true },
@@ -538,12 +489,16 @@ namespace VisionCraft::UI::Canvas
                     { "HighThreshold", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "ApertureSize", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
                     { "L2Gradient", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
+                    { "PackMask", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             { "Threshold",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Threshold", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "MaxValue", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "Type", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "Levels", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Thresholds", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "PackMask", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             { "Preview",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
@@ -556,6 +511,16 @@ namespace VisionCraft::UI::Canvas
                     { "scale", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "delta", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
+            { "Gradient",
+                { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
+                    { "ksize", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Norm", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "OutputComponents", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
+                    { "OutputAngle", Widgets::PinType::Data, Widgets::PinDataType::Bool, true },
+                    { "Magnitude", Widgets::PinType::Data, Widgets::PinDataType::Image, false },
+                    { "Gx", Widgets::PinType::Data, Widgets::PinDataType::Image, false },
+                    { "Gy", Widgets::PinType::Data, Widgets::PinDataType::Image, false },
+                    { "Angle", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             { "Convert Color",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Conversion", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
@@ -571,6 +536,7 @@ namespace VisionCraft::UI::Canvas
                     { "Channel 2", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Channel 3", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Channel 4", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
+                    { "Layout", Widgets::PinType::Data, Widgets::PinDataType::String, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             { "Median Blur",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
@@ -579,9 +545,16 @@ namespace VisionCraft::UI::Canvas
             { "Morphology",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Operation", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Shape", Widgets::PinType::Data, Widgets::PinDataType::String, true },
                     { "ksize", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
                     { "iterations", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
+            { "Mask Logic",
+                { { "A", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
+                    { "B", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
+                    { "Operation", Widgets::PinType::Data, Widgets::PinDataType::String, true },
+                    { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false },
+                    { "Count", Widgets::PinType::Data, Widgets::PinDataType::Int, false } } },
             { "Resize",
                 { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
                     { "Width", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
@@ -590,6 +563,13 @@ namespace VisionCraft::UI::Canvas
                     { "ScaleY", Widgets::PinType::Data, Widgets::PinDataType::Float, true },
                     { "Interpolation", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
                     { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
+            { "Crop",
+                { { "Input", Widgets::PinType::Data, Widgets::PinDataType::Image, true },
+                    { "X", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Y", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Width", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Height", Widgets::PinType::Data, Widgets::PinDataType::Int, true },
+                    { "Output", Widgets::PinType::Data, Widgets::PinDataType::Image, false } } },
             // Execution flow nodes - pins are dynamically queried from Node, but we still need entries for proper
             // rendering
             { "BeginPlay", {} },
@@ -632,54 +612,175 @@ namespace VisionCraft::UI::Canvas
         return connectionState.startPin;
     }
 
-    void ConnectionManager::RemoveConnectionToInput(const Widgets::PinId &inputPin)
+    void ConnectionManager::InsertConnection(const Widgets::NodeConnection &connection)
     {
-        connections.erase(std::remove_if(connections.begin(),
-                              connections.end(),
-                              [&inputPin](const Widgets::NodeConnection &conn) { return conn.inputPin == inputPin; }),
-            connections.end());
+        if (!connectionSlots.try_emplace(connection, connections.size()).second)
+        {
+            return;
+        }
+
+        connections.push_back(connection);
+        pinConnections[connection.outputPin].push_back(connection);
+        pinConnections[connection.inputPin].push_back(connection);
+        nodeConnections[connection.outputPin.nodeId].push_back(connection);
+        nodeConnections[connection.inputPin.nodeId].push_back(connection);
+
+        // The input pin loses its widget row, which moves the pins below it
+        InvalidatePinLayout(connection.inputPin.nodeId);
     }
 
-    void ConnectionManager::RemoveConnectionFromOutput(const Widgets::PinId &outputPin)
+    void ConnectionManager::EraseConnection(Widgets::NodeConnection connection)
     {
-        connections.erase(
-            std::remove_if(connections.begin(),
-                connections.end(),
-                [&outputPin](const Widgets::NodeConnection &conn) { return conn.outputPin == outputPin; }),
-            connections.end());
+        const auto slot = connectionSlots.find(connection);
+        if (slot == connectionSlots.end())
+        {
+            return;
+        }
+
+        const auto index = slot->second;
+        connectionSlots.erase(slot);
+        if (index + 1 != connections.size())
+        {
+            connections[index] = std::move(connections.back());
+            connectionSlots[connections[index]] = index;
+        }
+        connections.pop_back();
+
+        const auto eraseFrom = [&connection](auto &adjacency, const auto &key) {
+            const auto it = adjacency.find(key);
+            if (it == adjacency.end())
+            {
+                return;
+            }
+            auto &attached = it->second;
+            if (const auto entry = std::ranges::find(attached, connection); entry != attached.end())
+            {
+                *entry = std::move(attached.back());
+                attached.pop_back();
+            }
+            if (attached.empty())
+            {
+                adjacency.erase(it);
+            }
+        };
+        eraseFrom(pinConnections, connection.outputPin);
+        eraseFrom(pinConnections, connection.inputPin);
+        eraseFrom(nodeConnections, connection.outputPin.nodeId);
+        eraseFrom(nodeConnections, connection.inputPin.nodeId);
+        wireCurves.erase(connection);
+
+        InvalidatePinLayout(connection.inputPin.nodeId);
     }
 
-    void ConnectionManager::RenderConnection(const Widgets::NodeConnection &connection,
+    std::optional<ImVec2> ConnectionManager::FindPinAnchor(const Widgets::PinId &pinId,
         const Nodes::NodeEditor &nodeEditor,
-        const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions,
-        const CanvasController &canvas,
-        bool isHovered)
+        const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions) const
     {
-        auto *drawList = ImGui::GetWindowDrawList();
-        const auto startPos = GetPinWorldPosition(connection.outputPin, nodeEditor, nodePositions, canvas);
-        const auto endPos = GetPinWorldPosition(connection.inputPin, nodeEditor, nodePositions, canvas);
+        const auto posIt = nodePositions.find(pinId.nodeId);
+        if (posIt == nodePositions.end())
+        {
+            return std::nullopt;
+        }
 
-        if (startPos.x == 0 && startPos.y == 0)
+        // Only a missing layout needs the node (and with it the graph lock)
+        auto layoutIt = pinLayouts.find(pinId.nodeId);
+        if (layoutIt == pinLayouts.end())
         {
-            return;
+            const auto *node = nodeEditor.GetNode(pinId.nodeId);
+            if (!node)
+            {
+                return std::nullopt;
+            }
+            layoutIt = pinLayouts.emplace(pinId.nodeId, BuildPinLayout(pinId.nodeId, node)).first;
         }
 
-        if (endPos.x == 0 && endPos.y == 0)
+        for (const auto &[pinName, offset] : layoutIt->second.anchors)
         {
-            return;
+            if (pinName == pinId.pinName)
+            {
+                return ImVec2(posIt->second.x + offset.x, posIt->second.y + offset.y);
+            }
+        }
+        return std::nullopt;
+    }
+
+    const ConnectionManager::WireCurve *ConnectionManager::GetWireCurve(const Widgets::NodeConnection &connection,
+        const Nodes::NodeEditor &nodeEditor,
+        const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions)
+    {
+        const auto start = FindPinAnchor(connection.outputPin, nodeEditor, nodePositions);
+        const auto end = FindPinAnchor(connection.inputPin, nodeEditor, nodePositions);
+        if (!start || !end)
+        {
+            return nullptr;
+        }
+
+        auto &curve = wireCurves[connection];
+        const auto moved = [](const ImVec2 &a, const ImVec2 &b) { return a.x != b.x || a.y != b.y; };
+        if (curve.points.empty() || moved(curve.start, *start) || moved(curve.end, *end))
+        {
+            BuildWireCurve(*start, *end, curve);
+        }
+        return &curve;
+    }
+
+    void ConnectionManager::BuildWireCurve(const ImVec2 &start, const ImVec2 &end, WireCurve &curve)
+    {
+        // Same curve as ConnectionTension() at any zoom: its offsets scale with zoom like everything else
+        const auto tension = std::min(std::abs(end.x - start.x) * 0.5f, Constants::Connection::kBezierTension);
+        const auto cp1 = ImVec2(start.x + tension, start.y);
+        const auto cp2 = ImVec2(end.x - tension, end.y);
+
+        curve.start = start;
+        curve.end = end;
+        curve.min = start;
+        curve.max = start;
+        curve.points.clear();
+        curve.points.reserve(Constants::Connection::kCurveSegments + 1);
+        for (int i = 0; i <= Constants::Connection::kCurveSegments; ++i)
+        {
+            const float t = static_cast<float>(i) / Constants::Connection::kCurveSegments;
+            const float u = 1.0f - t;
+            const float a = u * u * u;
+            const float b = 3.0f * u * u * t;
+            const float c = 3.0f * u * t * t;
+            const float d = t * t * t;
+            const ImVec2 point(a * start.x + b * cp1.x + c * cp2.x + d * end.x,
+                a * start.y + b * cp1.y + c * cp2.y + d * end.y);
+            curve.points.push_back(point);
+            curve.min = ImVec2(std::min(curve.min.x, point.x), std::min(curve.min.y, point.y));
+            curve.max = ImVec2(std::max(curve.max.x, point.x), std::max(curve.max.y, point.y));
         }
+    }
+
+    void ConnectionManager::RenderWire(const WireCurve &curve, const CanvasController &canvas, bool isHovered)
+    {
+        auto *drawList = ImGui::GetWindowDrawList();
 
         // Highlight hovered connections with brighter color and thicker line
         const auto connectionColor = isHovered ? IM_COL32(255, 255, 100, 255) : Constants::Colors::Connection::kActive;
         const auto connectionThickness =
             isHovered ? Constants::Connection::kThickness * 2.0f : Constants::Connection::kThickness;
 
-        const auto bezierTension = Constants::Connection::kBezierTension;
-        const auto distance = std::abs(endPos.x - startPos.x);
-        const auto tension = std::min(distance * 0.5f, bezierTension * canvas.GetZoomLevel());
-        const auto cp1 = ImVec2(startPos.x + tension, startPos.y);
-        const auto cp2 = ImVec2(endPos.x - tension, endPos.y);
-        drawList->AddBezierCubic(startPos, cp1, cp2, endPos, connectionColor, connectionThickness);
+        // Overview: one segment per wire instead of the curve
+        if (!canvas.IsDetailVisible())
+        {
+            const auto startPos = canvas.WorldToScreen(curve.start);
+            const auto endPos = canvas.WorldToScreen(curve.end);
+            drawList->AddLine(startPos, endPos, connectionColor, connectionThickness);
+            return;
+        }
+
+        wireScreenPoints.clear();
+        for (const auto &point : curve.points)
+        {
+            wireScreenPoints.push_back(canvas.WorldToScreen(point));
+        }
+        drawList->AddPolyline(wireScreenPoints.data(),
+            static_cast<int>(wireScreenPoints.size()),
+            connectionColor,
+            ImDrawFlags_None,
+            connectionThickness);
     }
 
     std::optional<Widgets::NodeConnection> ConnectionManager::FindConnectionAtPosition(const ImVec2 &mousePos,
@@ -687,6 +788,8 @@ namespace VisionCraft::UI::Canvas
         const std::unordered_map<Nodes::NodeId, Widgets::NodePosition> &nodePositions,
         const CanvasController &canvas) const
     {
+        Rendering::FrameScope frameScope(Rendering::FrameSection::HitTesting);
+
         const float clickThreshold = 10.0f; // Distance threshold for clicking on a connection
 
         for (const auto &connection : connections)
@@ -696,9 +799,7 @@ namespace VisionCraft::UI::Canvas
             const auto endPos = GetPinWorldPosition(connection.inputPin, nodeEditor, nodePositions, canvas);
 
             // Calculate bezier curve parameters (same as in RenderConnection)
-            const auto distance = std::abs(endPos.x - startPos.x);
-            const auto bezierTension = Constants::Connection::kBezierTension;
-            const auto tension = std::min(distance * 0.5f, bezierTension * canvas.GetZoomLevel());
+            const auto tension = ConnectionTension(startPos, endPos, canvas);
             const auto cp1 = ImVec2(startPos.x + tension, startPos.y);
             const auto cp2 = ImVec2(endPos.x - tension, endPos.y);
 
@@ -731,23 +832,51 @@ namespace VisionCraft::UI::Canvas
         return std::nullopt;
     }
 
-    void ConnectionManager::RemoveConnection(const Widgets::NodeConnection &connection)
+    void ConnectionManager::RemoveConnection(const Widgets::NodeConnection &connection, Nodes::NodeEditor &nodeEditor)
     {
-        connections.erase(std::remove(connections.begin(), connections.end(), connection), connections.end());
+        // The editor reports the removal back through ApplyConnectionDelta()
+        (void)nodeEditor.RemoveConnection(connection.outputPin.nodeId,
+            connection.outputPin.pinName,
+            connection.inputPin.nodeId,
+            connection.inputPin.pinName);
     }
 
-    void ConnectionManager::RemoveConnectionsForNode(Nodes::NodeId nodeId)
+    void ConnectionManager::ApplyConnectionDelta(const Nodes::ConnectionDelta &delta)
     {
-        connections.erase(std::remove_if(connections.begin(),
-                              connections.end(),
-                              [nodeId](const Widgets::NodeConnection &conn) {
-                                  return conn.outputPin.nodeId == nodeId || conn.inputPin.nodeId == nodeId;
-                              }),
-            connections.end());
+        if (delta.reset)
+        {
+            connections.clear();
+            connectionSlots.clear();
+            pinConnections.clear();
+            nodeConnections.clear();
+            wireCurves.clear();
+            ClearPinLayouts();
+        }
+
+        for (const auto &connection : delta.removed)
+        {
+            EraseConnection(ToNodeConnection(connection));
+        }
+
+        connections.reserve(connections.size() + delta.added.size());
+        for (const auto &connection : delta.added)
+        {
+            InsertConnection(ToNodeConnection(connection));
+        }
     }
 
     void ConnectionManager::SetConnectionCreatedCallback(ConnectionCreatedCallback callback)
     {
         onConnectionCreated = std::move(callback);
     }
+
+    void ConnectionManager::InvalidatePinLayout(Nodes::NodeId nodeId)
+    {
+        pinLayouts.erase(nodeId);
+    }
+
+    void ConnectionManager::ClearPinLayouts()
+    {
+        pinLayouts.clear();
+    }
 } // namespace VisionCraft::UI::Canvas
@@ -1,13 +1,17 @@
 #pragma once
 
 #include "UI/Canvas/CanvasController.h"
+#include "UI/Canvas/NodeSpatialIndex.h"
 #include "UI/Widgets/NodeEditorConstants.h"
 #include "UI/Widgets/NodeEditorTypes.h"
 #include "Nodes/Core/NodeEditor.h"
 
 #include <imgui.h>
 #include <functional>
+#include <optional>
+#include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace VisionCraft::UI::Canvas
@@ -37,14 +41,20 @@ namespace VisionCraft::UI::Canvas
          * @brief Handles mouse interactions for connection creation.
          * @param nodeEditor Nodes::Node editor backend
          * @param nodePositions Map of node positions
+         * @param nodeIndex Spatial index of node bounds
          * @param canvas Canvas controller
          */
         void HandleConnectionInteractions(Nodes::NodeEditor &nodeEditor,
             const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &nodePositions,
+            const NodeSpatialIndex &nodeIndex,
             const CanvasController &canvas);
 
         /**
          * @brief Renders connections and connection preview.
+         *
+         * Wires whose curve bounds miss the visible canvas are skipped. Each curve is tessellated once in
+         * world units and redrawn from the cache until one of its pins moves.
+         *
          * @param nodeEditor Nodes::Node editor backend
          * @param nodePositions Map of node positions
          * @param canvas Canvas controller
@@ -99,12 +109,14 @@ namespace VisionCraft::UI::Canvas
          * @param mousePos Mouse position
          * @param nodeEditor Nodes::Node editor backend
          * @param nodePositions Map of node positions
+         * @param nodeIndex Spatial index of node bounds, used to visit only the nodes under the mouse
          * @param canvas Canvas controller
-         * @return PinId if found, invalid otherwise
+         * @return PinId if found (topmost node first), invalid otherwise
          */
         [[nodiscard]] UI::Widgets::PinId FindPinAtPosition(const ImVec2 &mousePos,
             const Nodes::NodeEditor &nodeEditor,
             const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &nodePositions,
+            const NodeSpatialIndex &nodeIndex,
             const CanvasController &canvas) const;
 
         /**
@@ -114,7 +126,7 @@ namespace VisionCraft::UI::Canvas
          * @param nodeEditor Nodes::Node editor backend
          * @param nodePositions Map of node positions
          * @param canvas Canvas controller
-         * @return PinId if found, invalid otherwise
+         * @return PinId if found, invalid otherwise (always when the canvas is zoomed out past the detail level)
          */
         [[nodiscard]] UI::Widgets::PinId FindPinAtPositionInNode(const ImVec2 &mousePos,
             Nodes::NodeId nodeId,
@@ -180,16 +192,18 @@ namespace VisionCraft::UI::Canvas
             const CanvasController &canvas) const;
 
         /**
-         * @brief Removes a connection.
+         * @brief Removes a connection from the graph.
          * @param connection Connection to remove
+         * @param nodeEditor Nodes::Node editor that owns the connection
          */
-        void RemoveConnection(const UI::Widgets::NodeConnection &connection);
+        void RemoveConnection(const UI::Widgets::NodeConnection &connection, Nodes::NodeEditor &nodeEditor);
 
         /**
-         * @brief Removes all connections associated with a node.
-         * @param nodeId ID of the node whose connections should be removed
+         * @brief Mirrors a change the node editor made to its connections.
+         * @param delta Connections the editor removed and added (see Nodes::NodeEditor::SetConnectionObserver())
+         * @note The node editor is the only store of connections; this is the only way the list here changes.
          */
-        void RemoveConnectionsForNode(Nodes::NodeId nodeId);
+        void ApplyConnectionDelta(const Nodes::ConnectionDelta &delta);
 
         /**
          * @brief Sets callback for connection creation.
@@ -197,37 +211,132 @@ namespace VisionCraft::UI::Canvas
          */
         void SetConnectionCreatedCallback(ConnectionCreatedCallback callback);
 
+        /**
+         * @brief Drops the cached pin layout of a node.
+         * @param nodeId Nodes::Node ID
+         * @note Call when a node is removed, so a later node reusing the ID gets its own layout.
+         */
+        void InvalidatePinLayout(Nodes::NodeId nodeId);
+
+        /**
+         * @brief Drops all cached pin layouts.
+         */
+        void ClearPinLayouts();
+
     private:
         /**
-         * @brief Removes connection to input pin.
-         * @param inputPin Input pin to disconnect
+         * @brief Pin centres of a node relative to its top-left corner, at zoom 1.
+         *
+         * Every pin offset scales linearly with zoom, so one layout serves all zoom levels. Input pin heights
+         * depend on whether the pin is connected, so a node's layout is dropped when its inputs are (dis)connected.
+         */
+        struct PinLayout
+        {
+            std::vector<std::pair<Nodes::SlotName, ImVec2>> anchors; ///< Pin name and offset, in hit-test order
+        };
+
+        /**
+         * @brief Returns the cached pin layout of a node, building it on first use.
+         * @param nodeId Nodes::Node ID
+         * @param node Nodes::Node
+         * @return Pin layout
+         */
+        [[nodiscard]] const PinLayout &GetPinLayout(Nodes::NodeId nodeId, const Nodes::Node *node) const;
+
+        /**
+         * @brief Computes the pin layout of a node.
+         * @param nodeId Nodes::Node ID
+         * @param node Nodes::Node
+         * @return Pin layout
+         */
+        [[nodiscard]] PinLayout BuildPinLayout(Nodes::NodeId nodeId, const Nodes::Node *node) const;
+
+        /**
+         * @brief Appends a connection and records it in the adjacency indices.
+         * @param connection Connection to add
+         */
+        void InsertConnection(const UI::Widgets::NodeConnection &connection);
+
+        /**
+         * @brief Removes a connection and its adjacency entries (no-op if absent).
+         * @param connection Connection to remove (taken by value; callers often pass an index entry)
+         * @note Swaps the last connection into the freed slot, so connection order is not preserved.
          */
-        void RemoveConnectionToInput(const UI::Widgets::PinId &inputPin);
+        void EraseConnection(UI::Widgets::NodeConnection connection);
 
         /**
-         * @brief Removes connection from output pin (for 1:1 execution connections).
-         * @param outputPin Output pin to disconnect
+         * @brief Wire curve tessellated in world units, with its bounds for culling.
+         *
+         * The curve's tension is zoom-independent in world units, so the points serve every zoom level.
+         */
+        struct WireCurve
+        {
+            ImVec2 start;               ///< Output pin centre the points were built for
+            ImVec2 end;                 ///< Input pin centre the points were built for
+            ImVec2 min;                 ///< Top-left of the curve's bounds
+            ImVec2 max;                 ///< Bottom-right of the curve's bounds
+            std::vector<ImVec2> points; ///< Polyline from start to end
+        };
+
+        /**
+         * @brief Returns the world position of a pin centre.
+         * @param pinId Pin to locate
+         * @param nodeEditor Nodes::Node editor backend (only read to build a missing pin layout)
+         * @param nodePositions Map of node positions
+         * @return Pin centre, or std::nullopt if the node or pin is unknown
          */
-        void RemoveConnectionFromOutput(const UI::Widgets::PinId &outputPin);
+        [[nodiscard]] std::optional<ImVec2> FindPinAnchor(const UI::Widgets::PinId &pinId,
+            const Nodes::NodeEditor &nodeEditor,
+            const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &nodePositions) const;
 
         /**
-         * @brief Renders single connection.
-         * @param connection Connection to render
+         * @brief Returns the cached curve of a connection, rebuilding it if a pin moved.
+         * @param connection Connection
          * @param nodeEditor Nodes::Node editor backend
          * @param nodePositions Map of node positions
+         * @return Curve, or nullptr if an endpoint cannot be located
+         */
+        [[nodiscard]] const WireCurve *GetWireCurve(const UI::Widgets::NodeConnection &connection,
+            const Nodes::NodeEditor &nodeEditor,
+            const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &nodePositions);
+
+        /**
+         * @brief Tessellates a wire between two pin centres.
+         * @param start Output pin centre in world coordinates
+         * @param end Input pin centre in world coordinates
+         * @param curve Receives the points and bounds (its point storage is reused)
+         */
+        static void BuildWireCurve(const ImVec2 &start, const ImVec2 &end, WireCurve &curve);
+
+        /**
+         * @brief Draws a cached wire.
+         * @param curve Curve to draw
          * @param canvas Canvas controller
          * @param isHovered Whether connection is hovered
          */
-        void RenderConnection(const UI::Widgets::NodeConnection &connection,
-            const Nodes::NodeEditor &nodeEditor,
-            const std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> &nodePositions,
-            const CanvasController &canvas,
-            bool isHovered = false);
+        void RenderWire(const WireCurve &curve, const CanvasController &canvas, bool isHovered);
 
         // Connection data
-        std::vector<UI::Widgets::NodeConnection> connections; ///< All active connections
+        std::vector<UI::Widgets::NodeConnection> connections; ///< Mirror of the node editor's connections
         UI::Widgets::ConnectionState connectionState;         ///< Current connection creation state
         ConnectionCreatedCallback onConnectionCreated;        ///< Callback for connection creation
+
+        // Adjacency indices over connections (kept in sync by InsertConnection/EraseConnection)
+        std::unordered_map<UI::Widgets::NodeConnection, size_t, UI::Widgets::NodeConnectionHash>
+            connectionSlots; ///< Position of each connection in connections
+        std::unordered_map<UI::Widgets::PinId, std::vector<UI::Widgets::NodeConnection>, UI::Widgets::PinIdHash>
+            pinConnections; ///< Connections attached to each pin
+        std::unordered_map<Nodes::NodeId, std::vector<UI::Widgets::NodeConnection>>
+            nodeConnections; ///< Connections attached to each node
+
+        // Rendering caches
+        std::unordered_map<UI::Widgets::NodeConnection, WireCurve, UI::Widgets::NodeConnectionHash>
+            wireCurves;                       ///< Tessellated curve of each drawn connection
+        std::vector<ImVec2> wireScreenPoints; ///< Curve points in screen coordinates (reused)
+
+        // Hit-testing caches
+        mutable std::unordered_map<Nodes::NodeId, PinLayout> pinLayouts; ///< Pin layouts built so far
+        mutable std::vector<Nodes::NodeId> hitCandidates;                ///< Nodes under the mouse (reused)
     };
 
 } // namespace VisionCraft::UI::Canvas
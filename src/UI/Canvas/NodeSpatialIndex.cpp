@@ -0,0 +1,162 @@
+#include "UI/Canvas/NodeSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace VisionCraft::UI::Canvas
+{
+    namespace
+    {
+        bool Intersects(const NodeSpatialIndex::Bounds &bounds, const ImVec2 &min, const ImVec2 &max)
+        {
+            return bounds.min.x <= max.x && bounds.max.x >= min.x && bounds.min.y <= max.y && bounds.max.y >= min.y;
+        }
+    } // namespace
+
+    NodeSpatialIndex::NodeSpatialIndex(float cellSize) : cellSize(std::max(cellSize, 1.0f))
+    {
+    }
+
+    void NodeSpatialIndex::Update(Nodes::NodeId nodeId, const ImVec2 &position, const ImVec2 &size)
+    {
+        const Bounds updated{ position,
+            ImVec2(position.x + std::max(size.x, 0.0f), position.y + std::max(size.y, 0.0f)) };
+        const CellRange range = RangeOf(updated.min, updated.max);
+
+        const auto [it, inserted] = bounds.try_emplace(nodeId, updated);
+        if (inserted)
+        {
+            AddToCells(nodeId, range);
+            return;
+        }
+
+        // Moves within the same cells, the common case while dragging, leave the grid alone
+        const CellRange previous = RangeOf(it->second.min, it->second.max);
+        it->second = updated;
+        if (previous != range)
+        {
+            RemoveFromCells(nodeId, previous);
+            AddToCells(nodeId, range);
+        }
+    }
+
+    void NodeSpatialIndex::Remove(Nodes::NodeId nodeId)
+    {
+        const auto it = bounds.find(nodeId);
+        if (it == bounds.end())
+        {
+            return;
+        }
+        RemoveFromCells(nodeId, RangeOf(it->second.min, it->second.max));
+        bounds.erase(it);
+    }
+
+    void NodeSpatialIndex::Clear()
+    {
+        bounds.clear();
+        cells.clear();
+    }
+
+    const NodeSpatialIndex::Bounds *NodeSpatialIndex::Find(Nodes::NodeId nodeId) const
+    {
+        const auto it = bounds.find(nodeId);
+        return it != bounds.end() ? &it->second : nullptr;
+    }
+
+    void NodeSpatialIndex::Query(const ImVec2 &min, const ImVec2 &max, std::vector<Nodes::NodeId> &result) const
+    {
+        result.clear();
+        const CellRange range = RangeOf(min, max);
+
+        // Zoomed far out the rectangle covers more cells than there are nodes; checking every node is cheaper
+        if (range.Count() > bounds.size())
+        {
+            for (const auto &[nodeId, nodeBounds] : bounds)
+            {
+                if (Intersects(nodeBounds, min, max))
+                {
+                    result.push_back(nodeId);
+                }
+            }
+            std::ranges::sort(result);
+            return;
+        }
+
+        for (int64_t y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int64_t x = range.minX; x <= range.maxX; ++x)
+            {
+                const auto cell = cells.find(CellKey(x, y));
+                if (cell == cells.end())
+                {
+                    continue;
+                }
+                for (const auto nodeId : cell->second)
+                {
+                    if (Intersects(bounds.at(nodeId), min, max))
+                    {
+                        result.push_back(nodeId);
+                    }
+                }
+            }
+        }
+
+        // Nodes spanning several cells were found once per cell
+        std::ranges::sort(result);
+        const auto duplicates = std::ranges::unique(result);
+        result.erase(duplicates.begin(), duplicates.end());
+    }
+
+    NodeSpatialIndex::CellRange NodeSpatialIndex::RangeOf(const ImVec2 &min, const ImVec2 &max) const
+    {
+        if (max.x < min.x || max.y < min.y)
+        {
+            return {};
+        }
+        return { static_cast<int64_t>(std::floor(min.x / cellSize)),
+            static_cast<int64_t>(std::floor(min.y / cellSize)),
+            static_cast<int64_t>(std::floor(max.x / cellSize)),
+            static_cast<int64_t>(std::floor(max.y / cellSize)) };
+    }
+
+    uint64_t NodeSpatialIndex::CellKey(int64_t x, int64_t y)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+
+    void NodeSpatialIndex::AddToCells(Nodes::NodeId nodeId, const CellRange &range)
+    {
+        for (int64_t y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int64_t x = range.minX; x <= range.maxX; ++x)
+            {
+                cells[CellKey(x, y)].push_back(nodeId);
+            }
+        }
+    }
+
+    void NodeSpatialIndex::RemoveFromCells(Nodes::NodeId nodeId, const CellRange &range)
+    {
+        for (int64_t y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int64_t x = range.minX; x <= range.maxX; ++x)
+            {
+                const auto cell = cells.find(CellKey(x, y));
+                if (cell == cells.end())
+                {
+                    continue;
+                }
+                auto &ids = cell->second;
+                if (const auto it = std::ranges::find(ids, nodeId); it != ids.end())
+                {
+                    *it = ids.back();
+                    ids.pop_back();
+                }
+                if (ids.empty())
+                {
+                    cells.erase(cell);
+                }
+            }
+        }
+    }
+} // namespace VisionCraft::UI::Canvas
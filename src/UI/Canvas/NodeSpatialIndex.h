@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <imgui.h>
+
+namespace VisionCraft::UI::Canvas
+{
+    /**
+     * @brief Uniform grid over node bounds in world coordinates, for culling and hit-testing.
+     *
+     * Each node is listed in every cell its bounds overlap, so a query only visits the cells of the
+     * queried rectangle instead of every node. Moving a node within its cells only updates its bounds.
+     */
+    class NodeSpatialIndex
+    {
+    public:
+        /**
+         * @brief Axis-aligned node bounds in world coordinates.
+         */
+        struct Bounds
+        {
+            ImVec2 min; ///< Top-left corner (the node position)
+            ImVec2 max; ///< Bottom-right corner
+        };
+
+        /**
+         * @brief Constructs empty index.
+         * @param cellSize Cell edge in world units
+         */
+        explicit NodeSpatialIndex(float cellSize = Constants::Canvas::kSpatialIndexCellSize);
+
+        /**
+         * @brief Inserts a node or replaces its bounds.
+         * @param nodeId Node ID
+         * @param position Top-left corner in world coordinates
+         * @param size Node size in world units
+         */
+        void Update(Nodes::NodeId nodeId, const ImVec2 &position, const ImVec2 &size);
+
+        /**
+         * @brief Removes a node (no-op if absent).
+         * @param nodeId Node ID
+         */
+        void Remove(Nodes::NodeId nodeId);
+
+        /**
+         * @brief Removes all nodes.
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the bounds of a node.
+         * @param nodeId Node ID
+         * @return Bounds, or nullptr if the node is not indexed
+         */
+        [[nodiscard]] const Bounds *Find(Nodes::NodeId nodeId) const;
+
+        /**
+         * @brief Collects nodes whose bounds intersect a rectangle.
+         * @param min Top-left corner in world coordinates
+         * @param max Bottom-right corner in world coordinates
+         * @param result Receives the node IDs in ascending order (cleared first; reuse it to avoid allocating)
+         */
+        void Query(const ImVec2 &min, const ImVec2 &max, std::vector<Nodes::NodeId> &result) const;
+
+        /**
+         * @brief Returns number of indexed nodes.
+         * @return Node count
+         */
+        [[nodiscard]] size_t Size() const
+        {
+            return bounds.size();
+        }
+
+    private:
+        /**
+         * @brief Inclusive range of cell coordinates.
+         */
+        struct CellRange
+        {
+            int64_t minX = 0;
+            int64_t minY = 0;
+            int64_t maxX = -1;
+            int64_t maxY = -1;
+
+            bool operator==(const CellRange &) const = default;
+
+            [[nodiscard]] size_t Count() const
+            {
+                return static_cast<size_t>(maxX - minX + 1) * static_cast<size_t>(maxY - minY + 1);
+            }
+        };
+
+        [[nodiscard]] CellRange RangeOf(const ImVec2 &min, const ImVec2 &max) const;
+
+        [[nodiscard]] static uint64_t CellKey(int64_t x, int64_t y);
+
+        void AddToCells(Nodes::NodeId nodeId, const CellRange &range);
+
+        void RemoveFromCells(Nodes::NodeId nodeId, const CellRange &range);
+
+        float cellSize;                                                 ///< Cell edge in world units
+        std::unordered_map<Nodes::NodeId, Bounds> bounds;               ///< Bounds of each node
+        std::unordered_map<uint64_t, std::vector<Nodes::NodeId>> cells; ///< Nodes overlapping each cell
+    };
+} // namespace VisionCraft::UI::Canvas
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Event.h"
+#include "Nodes/Core/NodeEditor.h"
+
+namespace VisionCraft::UI::Events
+{
+    /**
+     * @brief Event emitted when the node editor adds or removes connections.
+     * @note Published synchronously by the thread that edited the graph; the delta is only valid during dispatch.
+     */
+    class ConnectionsChangedEvent : public Kappa::Event
+    {
+    public:
+        /**
+         * @brief Constructs connections changed event.
+         * @param delta Connections the edit removed and added
+         */
+        explicit ConnectionsChangedEvent(const Nodes::ConnectionDelta &delta) : delta(delta)
+        {
+        }
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~ConnectionsChangedEvent() = default;
+
+        /**
+         * @brief Gets the connections the edit removed and added.
+         * @return Connection delta
+         */
+        [[nodiscard]] const Nodes::ConnectionDelta &GetDelta() const
+        {
+            return delta;
+        }
+
+    private:
+        const Nodes::ConnectionDelta &delta; ///< Owned by the notifying editor for the duration of dispatch
+    };
+} // namespace VisionCraft::UI::Events
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "Event.h"
+#include "Nodes/Core/Node.h"
+
+#include <optional>
 
 namespace VisionCraft::UI::Events
 {
     /**
-     * @brief Event for triggering graph execution.
+     * @brief Event for triggering graph execution, optionally only up to one node.
      */
     class GraphExecuteEvent : public Kappa::Event
     {
@@ -15,9 +18,29 @@ namespace VisionCraft::UI::Events
          */
         GraphExecuteEvent() = default;
 
+        /**
+         * @brief Constructs event running only a node and its upstream nodes.
+         * @param targetNode Node to execute up to (see Nodes::NodeEditor::ExecuteUpTo())
+         */
+        explicit GraphExecuteEvent(Nodes::NodeId targetNode) : targetNode(targetNode)
+        {
+        }
+
         /**
          * @brief Virtual destructor.
          */
         virtual ~GraphExecuteEvent() = default;
+
+        /**
+         * @brief Gets the node the run is limited to.
+         * @return Target node, or nullopt to run the whole graph
+         */
+        [[nodiscard]] std::optional<Nodes::NodeId> GetTargetNode() const
+        {
+            return targetNode;
+        }
+
+    private:
+        std::optional<Nodes::NodeId> targetNode; ///< Node to execute up to (whole graph if unset)
     };
 } // namespace VisionCraft::UI::Events
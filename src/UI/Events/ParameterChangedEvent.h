@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Event.h"
+#include "Nodes/Core/Node.h"
+
+#include <string>
+#include <utility>
+
+namespace VisionCraft::UI::Events
+{
+    /**
+     * @brief Event emitted when a parameter widget on the canvas changes a node's input default.
+     */
+    class ParameterChangedEvent : public Kappa::Event
+    {
+    public:
+        /**
+         * @brief Constructs parameter changed event.
+         * @param nodeId Node whose parameter changed
+         * @param parameterName Input slot whose default was set
+         */
+        ParameterChangedEvent(Nodes::NodeId nodeId, std::string parameterName)
+            : nodeId(nodeId), parameterName(std::move(parameterName))
+        {
+        }
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~ParameterChangedEvent() = default;
+
+        /**
+         * @brief Gets the node whose parameter changed.
+         * @return Node ID
+         */
+        [[nodiscard]] Nodes::NodeId GetNodeId() const
+        {
+            return nodeId;
+        }
+
+        /**
+         * @brief Gets the changed parameter.
+         * @return Input slot name
+         */
+        [[nodiscard]] const std::string &GetParameterName() const
+        {
+            return parameterName;
+        }
+
+    private:
+        Nodes::NodeId nodeId;      ///< Node whose parameter changed
+        std::string parameterName; ///< Input slot whose default was set
+    };
+} // namespace VisionCraft::UI::Events
@@ -0,0 +1,56 @@
+#include "UI/Layers/AutoRunScheduler.h"
+
+namespace VisionCraft::UI::Layers
+{
+    AutoRunScheduler::AutoRunScheduler(Clock::duration delay) : delay(delay)
+    {
+    }
+
+    void AutoRunScheduler::SetEnabled(bool isEnabled)
+    {
+        enabled = isEnabled;
+        if (!enabled)
+        {
+            due.reset();
+        }
+    }
+
+    bool AutoRunScheduler::IsEnabled() const
+    {
+        return enabled;
+    }
+
+    bool AutoRunScheduler::ScheduleAfterEdit(Clock::time_point now, RunningExecution running)
+    {
+        if (!enabled)
+        {
+            return false;
+        }
+
+        due = now + delay;
+
+        // The running result is already stale; a batch or autotune is left to finish
+        return running == RunningExecution::Graph;
+    }
+
+    bool AutoRunScheduler::TakeDueRun(Clock::time_point now, bool executing)
+    {
+        if (!due || executing || now < *due)
+        {
+            return false;
+        }
+
+        due.reset();
+        return true;
+    }
+
+    bool AutoRunScheduler::IsPending() const
+    {
+        return due.has_value();
+    }
+
+    std::optional<AutoRunScheduler::Clock::time_point> AutoRunScheduler::GetDueTime() const
+    {
+        return due;
+    }
+} // namespace VisionCraft::UI::Layers
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+
+#include <chrono>
+#include <optional>
+
+namespace VisionCraft::UI::Layers
+{
+    /**
+     * @brief Decides when the editor's auto-run starts, debouncing bursts of edits into one run.
+     *
+     * Each edit schedules a run a fixed delay later, pushing back a run already scheduled. A graph run in
+     * flight when an edit arrives is stale and should be cancelled; a batch or autotune is left to finish.
+     * The scheduled run starts on the first poll after its due time at which nothing is executing.
+     *
+     * The scheduler knows nothing about ImGui or the editor: GraphExecutionLayer passes in the time and what
+     * is running, and performs the cancel and the run itself.
+     */
+    class AutoRunScheduler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Execution in progress when an edit arrives.
+         */
+        enum class RunningExecution
+        {
+            None,  ///< Nothing is executing
+            Graph, ///< A graph run, which the edit makes stale
+            Batch  ///< A batch or autotune, which runs to completion
+        };
+
+        /**
+         * @brief Constructs a disabled scheduler.
+         * @param delay Quiet time after the last edit before the run starts
+         */
+        explicit AutoRunScheduler(
+            Clock::duration delay = std::chrono::milliseconds(Constants::AutoRun::kDebounceMilliseconds));
+
+        /**
+         * @brief Enables or disables auto-run.
+         * @param isEnabled False also drops a scheduled run
+         */
+        void SetEnabled(bool isEnabled);
+
+        /**
+         * @brief Checks if auto-run is enabled.
+         * @return True if edits schedule runs
+         */
+        [[nodiscard]] bool IsEnabled() const;
+
+        /**
+         * @brief Schedules a run one delay after an edit, replacing the previous due time.
+         * @param now Time of the edit
+         * @param running Execution in progress
+         * @return True if the running graph run should be cancelled
+         * @note Does nothing while disabled.
+         */
+        [[nodiscard]] bool ScheduleAfterEdit(Clock::time_point now, RunningExecution running);
+
+        /**
+         * @brief Takes the scheduled run if it is due and nothing is executing.
+         * @param now Current time
+         * @param executing Whether any execution is in progress
+         * @return True if the run should start now; it is then no longer scheduled
+         */
+        [[nodiscard]] bool TakeDueRun(Clock::time_point now, bool executing);
+
+        /**
+         * @brief Checks if a run is scheduled.
+         * @return True until the run is taken or auto-run is disabled
+         */
+        [[nodiscard]] bool IsPending() const;
+
+        /**
+         * @brief Returns when the scheduled run becomes due.
+         * @return Due time, or nullopt if nothing is scheduled
+         */
+        [[nodiscard]] std::optional<Clock::time_point> GetDueTime() const;
+
+    private:
+        Clock::duration delay;                ///< Quiet time after the last edit
+        bool enabled = false;                 ///< Whether edits schedule runs
+        std::optional<Clock::time_point> due; ///< When the scheduled run starts
+    };
+} // namespace VisionCraft::UI::Layers
@@ -1,8 +1,10 @@
 #include "UI/Layers/DockSpaceLayer.h"
+#include "Nodes/Core/StartupProfile.h"
 #include "UI/Events/FileOpenedEvent.h"
 #include "UI/Events/LoadGraphEvent.h"
 #include "UI/Events/NewGraphEvent.h"
 #include "UI/Events/SaveGraphEvent.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "UI/Widgets/DockingLayoutHelper.h"
 #include "Application.h"
 
@@ -71,6 +73,7 @@ namespace VisionCraft::UI::Layers
             if (isFirstFrame)
             {
                 isFirstFrame = false;
+                Nodes::StartupScope scope("Docking layout");
                 Widgets::DockingLayoutHelper::SetupDefaultLayout();
             }
         }
@@ -78,10 +81,13 @@ namespace VisionCraft::UI::Layers
         if (ImGui::BeginMenuBar())
         {
             RenderFileMenu();
+            RenderViewMenu();
             ImGui::EndMenuBar();
         }
 
         ImGui::End();
+
+        Rendering::FrameProfiler::Get().RenderOverlay();
     }
 
     void DockSpaceLayer::RenderFileMenu()
@@ -120,6 +126,20 @@ namespace VisionCraft::UI::Layers
         }
     }
 
+    void DockSpaceLayer::RenderViewMenu()
+    {
+        if (ImGui::BeginMenu("View"))
+        {
+            auto &profiler = Rendering::FrameProfiler::Get();
+            bool profiling = profiler.IsEnabled();
+            if (ImGui::MenuItem("Frame Profiler", nullptr, &profiling))
+            {
+                profiler.SetEnabled(profiling);
+            }
+            ImGui::EndMenu();
+        }
+    }
+
     void DockSpaceLayer::RenderRecentFilesMenu()
     {
         if (ImGui::BeginMenu("Recent Files"))
@@ -41,6 +41,7 @@ namespace VisionCraft::UI::Layers
     private:
         void RenderFileMenu();
         void RenderRecentFilesMenu();
+        void RenderViewMenu();
 
         bool dockspaceOpen = true; ///< Flag indicating if the dockspace is open
         bool isFirstFrame = true;  ///< Flag to detect first frame for default layout setup
@@ -2,16 +2,142 @@
 
 #include <imgui.h>
 
+#include "UI/Events/ConnectionsChangedEvent.h"
 #include "UI/Events/GraphExecuteEvent.h"
+#include "UI/Events/ParameterChangedEvent.h"
+#include "UI/Rendering/FramePacer.h"
 #include "Application.h"
 #include "Logger.h"
+#include "Nodes/Core/ThreadBudget.h"
+#include "Nodes/Core/Tracer.h"
+#include "Vision/IO/Autotuner.h"
+#include "Vision/IO/BatchProcessor.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
 
 namespace VisionCraft::UI::Layers
 {
+    namespace
+    {
+        // Column user IDs of the profiler table (stable across column reordering)
+        enum ProfilerColumn : ImGuiID
+        {
+            kColumnNode,
+            kColumnId,
+            kColumnType,
+            kColumnOutcome,
+            kColumnLast,
+            kColumnAverage,
+            kColumnMax,
+            kColumnShare,
+            kColumnInputBytes,
+            kColumnOutputBytes,
+            kColumnMaxOutputBytes,
+            kColumnCount
+        };
+
+        float ToMilliseconds(std::chrono::microseconds duration)
+        {
+            return static_cast<float>(duration.count()) / 1000.0f;
+        }
+
+        float ToMegabytes(size_t bytes)
+        {
+            return static_cast<float>(bytes) / (1024.0f * 1024.0f);
+        }
+
+        // Strict ordering of two rows by a single column (share of the run follows the last time)
+        bool IsLess(const Nodes::NodeTimingSummary &a, const Nodes::NodeTimingSummary &b, ImGuiID column)
+        {
+            switch (column)
+            {
+            case kColumnNode:
+                return a.nodeName < b.nodeName;
+            case kColumnId:
+                return a.nodeId < b.nodeId;
+            case kColumnType:
+                return a.nodeType < b.nodeType;
+            case kColumnOutcome:
+                return static_cast<int>(a.lastOutcome) < static_cast<int>(b.lastOutcome);
+            case kColumnAverage:
+                return a.averageTime < b.averageTime;
+            case kColumnMax:
+                return a.maxTime < b.maxTime;
+            case kColumnInputBytes:
+                return a.lastInputBytes < b.lastInputBytes;
+            case kColumnOutputBytes:
+                return a.lastOutputBytes < b.lastOutputBytes;
+            case kColumnMaxOutputBytes:
+                return a.maxOutputBytes < b.maxOutputBytes;
+            default:
+                return a.lastTime < b.lastTime;
+            }
+        }
+
+        void SortRows(std::vector<Nodes::NodeTimingSummary> &rows, const ImGuiTableSortSpecs &specs)
+        {
+            std::ranges::stable_sort(rows, [&specs](const auto &a, const auto &b) {
+                for (int i = 0; i < specs.SpecsCount; ++i)
+                {
+                    const auto &spec = specs.Specs[i];
+                    const bool ascending = spec.SortDirection == ImGuiSortDirection_Ascending;
+                    if (IsLess(a, b, spec.ColumnUserID))
+                    {
+                        return ascending;
+                    }
+                    if (IsLess(b, a, spec.ColumnUserID))
+                    {
+                        return !ascending;
+                    }
+                }
+                return false;
+            });
+        }
+    } // namespace
+
     GraphExecutionLayer::GraphExecutionLayer(Nodes::NodeEditor &nodeEditor) : nodeEditor(nodeEditor)
     {
         Kappa::Application::Get().GetEventBus().Subscribe<Events::GraphExecuteEvent>(
-            [this]([[maybe_unused]] const Events::GraphExecuteEvent &event) { ExecuteGraph(); });
+            [this](const Events::GraphExecuteEvent &event) { ExecuteGraph(event.GetTargetNode()); });
+        Kappa::Application::Get().GetEventBus().Subscribe<Events::ParameterChangedEvent>(
+            [this](const Events::ParameterChangedEvent &) { ScheduleAutoRun(); });
+        Kappa::Application::Get().GetEventBus().Subscribe<Events::ConnectionsChangedEvent>(
+            [this](const Events::ConnectionsChangedEvent &) { ScheduleAutoRun(); });
+        nodeEditor.SetRunFinishedObserver([this](bool) { SignalExecutionFinished(); });
+
+        // Settings an earlier autotune found for this machine (here or with vision_craft_cli --autotune)
+        const auto profilePath = Vision::IO::Autotuner::GetDefaultProfilePath();
+        std::error_code fileError;
+        if (!profilePath.empty() && std::filesystem::exists(profilePath, fileError))
+        {
+            std::string error;
+            if (const auto profile = Vision::IO::Autotuner::LoadProfile(profilePath, error))
+            {
+                Vision::IO::Autotuner::Apply(*profile, nodeEditor);
+                LOG_INFO("Loaded tuning profile {}", profilePath.string());
+            }
+            else
+            {
+                LOG_WARN("Ignoring tuning profile: {}", error);
+            }
+        }
+    }
+
+    GraphExecutionLayer::~GraphExecutionLayer()
+    {
+        // The batch task captures this, so let it finish its current file before members are destroyed
+        batchStopSource.request_stop();
+        nodeEditor.SetRunFinishedObserver(nullptr);
+        if (executionFuture.valid())
+        {
+            executionFuture.wait();
+        }
     }
 
     void GraphExecutionLayer::OnEvent([[maybe_unused]] Kappa::Event &event)
@@ -20,24 +146,58 @@ namespace VisionCraft::UI::Layers
 
     void GraphExecutionLayer::OnUpdate([[maybe_unused]] float deltaTime)
     {
-        if (isExecuting && executionFuture.valid())
+        // The run signals its end instead of the future being polled every frame; get() then only waits out
+        // the last instructions of its job
+        if (isExecuting && executionFinished.exchange(false, std::memory_order_acq_rel) && executionFuture.valid())
         {
-            // Check if execution is finished (timeout of 0 means just check status)
-            if (executionFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-            {
-                bool success = executionFuture.get();
-                isExecuting = false;
+            bool success = executionFuture.get();
+            isExecuting = false;
+            Rendering::FramePacer::Get().SetBusy(false);
 
-                if (success)
-                {
-                    LOG_INFO("Async graph execution completed successfully");
-                }
-                else
-                {
-                    LOG_ERROR("Async graph execution failed or was cancelled");
-                }
+            if (success)
+            {
+                LOG_INFO("Async graph execution completed successfully");
             }
+            else
+            {
+                LOG_ERROR("Async graph execution failed or was cancelled");
+            }
+        }
+
+        UpdateAutoRun();
+    }
+
+    void GraphExecutionLayer::ScheduleAutoRun()
+    {
+        using RunningExecution = AutoRunScheduler::RunningExecution;
+        auto running = RunningExecution::None;
+        if (isExecuting)
+        {
+            running = batchRunning || autotuneRunning ? RunningExecution::Batch : RunningExecution::Graph;
+        }
+        if (autoRunScheduler.ScheduleAfterEdit(AutoRunScheduler::Clock::now(), running))
+        {
+            nodeEditor.CancelExecution();
+        }
+    }
+
+    void GraphExecutionLayer::UpdateAutoRun()
+    {
+        if (!autoRunScheduler.IsPending())
+        {
+            return;
+        }
+
+        if (!autoRunScheduler.TakeDueRun(AutoRunScheduler::Clock::now(), isExecuting))
+        {
+            // Keep frames coming so the due time is noticed while the editor would otherwise sleep
+            Rendering::FramePacer::Get().RequestFrames();
+            return;
         }
+
+        const bool resultsShown = showResultsWindow;
+        ExecuteGraph();
+        showResultsWindow = resultsShown; // Automatic runs leave the results window as the user left it
     }
 
     void GraphExecutionLayer::OnRender()
@@ -49,6 +209,31 @@ namespace VisionCraft::UI::Layers
             Kappa::Application::Get().GetEventBus().Publish(Events::GraphExecuteEvent{});
         }
 
+        if (proxyExecution)
+        {
+            ImGui::SameLine();
+            if (ImGui::Button("Run Full Resolution"))
+            {
+                ExecuteGraph(std::nullopt, true);
+            }
+            if (ImGui::IsItemHovered())
+            {
+                ImGui::SetTooltip("Run the whole graph at full resolution; only this run saves outputs");
+            }
+        }
+
+        ImGui::SameLine();
+        bool autoRun = autoRunScheduler.IsEnabled();
+        if (ImGui::Checkbox("Auto-run", &autoRun))
+        {
+            autoRunScheduler.SetEnabled(autoRun);
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Re-run the graph shortly after each parameter or connection edit; with Incremental "
+                              "on, only the edited nodes and those downstream of them run");
+        }
+
         ImGui::SameLine();
 
         if (ImGui::Button("Show Results"))
@@ -56,19 +241,166 @@ namespace VisionCraft::UI::Layers
             showResultsWindow = !showResultsWindow;
         }
 
+        ImGui::SameLine();
+
+        // Mode changes need the graph lock, so only offer them while idle
+        ImGui::BeginDisabled(isExecuting);
+        if (ImGui::Checkbox("Parallel", &parallelExecution))
+        {
+            nodeEditor.SetExecutionMode(
+                parallelExecution ? Nodes::ExecutionMode::Parallel : Nodes::ExecutionMode::Sequential);
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Incremental", &incrementalExecution))
+        {
+            nodeEditor.SetIncrementalExecution(incrementalExecution);
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Cache", &outputCache))
+        {
+            nodeEditor.SetOutputCacheEnabled(outputCache);
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Merge Duplicates", &duplicateElimination))
+        {
+            nodeEditor.SetDuplicateElimination(duplicateElimination);
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Run identical nodes reading the same inputs once and share their outputs");
+        }
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Proxy", &proxyExecution))
+        {
+            nodeEditor.SetProxyScale(proxyExecution ? static_cast<double>(proxyScale) : 1.0);
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Run on downscaled source images for fast feedback; outputs are not saved");
+        }
+        if (proxyExecution)
+        {
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(Constants::Proxy::kScaleSliderWidth);
+            if (ImGui::SliderFloat("##ProxyScale",
+                    &proxyScale,
+                    static_cast<float>(Constants::Proxy::kMinScale),
+                    1.0f,
+                    "%.2fx"))
+            {
+                nodeEditor.SetProxyScale(static_cast<double>(proxyScale));
+            }
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(Constants::Precision::kComboWidth);
+        if (ImGui::BeginCombo("Precision",
+                Nodes::GetPrecisionPolicyName(static_cast<Nodes::PrecisionPolicy>(precisionPolicy)).data()))
+        {
+            for (int i = 0; i < static_cast<int>(Nodes::kPrecisionPolicyNames.size()); ++i)
+            {
+                const auto name = Nodes::kPrecisionPolicyNames[static_cast<size_t>(i)];
+                if (ImGui::Selectable(name.data(), i == precisionPolicy))
+                {
+                    precisionPolicy = i;
+                    nodeEditor.SetPrecisionPolicy(static_cast<Nodes::PrecisionPolicy>(i));
+                }
+            }
+            ImGui::EndCombo();
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Depth of intermediate images: narrower ones halve memory traffic at some precision");
+        }
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(Constants::Cores::kFieldWidth);
+        if (ImGui::InputInt("Cores", &maxCores))
+        {
+            const int hardwareCores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+            maxCores = std::clamp(maxCores, 0, hardwareCores);
+            Nodes::ThreadBudget::Get().SetMaxCores(static_cast<size_t>(maxCores));
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Cores graph workers and OpenCV may use together (0 = all)");
+        }
+        ImGui::EndDisabled();
+
+        // Tracing is independent of the graph, so it may be toggled mid-run
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Trace", &recordTrace))
+        {
+            auto &tracer = Nodes::Tracer::Get();
+            if (recordTrace)
+            {
+                tracer.SetCurrentThreadName("UI");
+                tracer.Start();
+            }
+            else
+            {
+                tracer.Stop();
+                tracer.WriteChromeTrace(Constants::Tracing::kDefaultTraceFile);
+            }
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Record a timeline of graph runs; unchecking writes %s",
+                Constants::Tracing::kDefaultTraceFile);
+        }
+
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(Constants::Cores::kFieldWidth);
+        auto &pacer = Rendering::FramePacer::Get();
+        int maxBusyFps = pacer.GetMaxBusyFps();
+        if (ImGui::InputInt("Max FPS", &maxBusyFps))
+        {
+            pacer.SetMaxBusyFps(maxBusyFps);
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Frames drawn per second while a run is in progress (0 = unlimited)");
+        }
+
+        ImGui::SameLine();
+        ImGui::BeginDisabled(isExecuting);
+        if (ImGui::Button("Autotune"))
+        {
+            ExecuteAutotune();
+        }
+        ImGui::EndDisabled();
+        if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled))
+        {
+            ImGui::SetTooltip("Run this graph under different worker, thread, tiling, fusion and OpenCL settings, "
+                              "keep the fastest and load them at every start on this machine");
+        }
+
+        RenderBatchControls();
+
         if (isExecuting)
         {
             ImGui::Separator();
             ImGui::Text("Executing Graph...");
 
-            // Thread-safe progress reading - atomics are lock-free
-            int current = currentNode.load(std::memory_order_relaxed);
-            int total = totalNodes.load(std::memory_order_relaxed);
+            int current = 0;
+            int total = 0;
             std::string name;
+            if (batchRunning || autotuneRunning)
             {
+                current = currentNode.load(std::memory_order_relaxed);
+                total = totalNodes.load(std::memory_order_relaxed);
                 std::lock_guard<std::mutex> lock(nameMutex);
                 name = currentNodeName;
             }
+            else
+            {
+                // One lock-free read per frame; only the node shown is resolved to a name
+                const auto sample = nodeEditor.GetProgressChannel().Read();
+                current = sample.started;
+                total = sample.total;
+                if (const auto *node = sample.node != 0 ? nodeEditor.GetNode(sample.node) : nullptr)
+                {
+                    name = node->GetName();
+                }
+            }
 
             if (total > 0)
             {
@@ -99,17 +431,28 @@ namespace VisionCraft::UI::Layers
         {
             ImGui::Begin("Results", &showResultsWindow);
 
-            ImGui::Text("Execution Results");
-            ImGui::Separator();
-
-            // TODO: Show actual results/images
-            ImGui::Text("No results to display");
+            if (ImGui::BeginTabBar("ResultsTabs"))
+            {
+                if (ImGui::BeginTabItem("Execution Profiler"))
+                {
+                    RenderProfiler();
+                    ImGui::EndTabItem();
+                }
+                const ImGuiTabItemFlags galleryFlags =
+                    std::exchange(selectBatchResults, false) ? ImGuiTabItemFlags_SetSelected : ImGuiTabItemFlags_None;
+                if (ImGui::BeginTabItem("Batch Results", nullptr, galleryFlags))
+                {
+                    resultsGallery.Render();
+                    ImGui::EndTabItem();
+                }
+                ImGui::EndTabBar();
+            }
 
             ImGui::End();
         }
     }
 
-    void GraphExecutionLayer::ExecuteGraph()
+    void GraphExecutionLayer::ExecuteGraph(std::optional<Nodes::NodeId> targetNode, bool fullResolution)
     {
         LOG_INFO("Graph execution triggered via EventBus!");
 
@@ -120,24 +463,289 @@ namespace VisionCraft::UI::Layers
         }
 
         isExecuting = true;
+        executionFinished = false;
         showResultsWindow = true;
+        batchRunning = false;
+        autotuneRunning = false;
+        Rendering::FramePacer::Get().SetBusy(true);
+
+        // The progress callback only wakes the render loop, which samples GetProgressChannel() itself
+        const auto wake = [](int, int, const std::string &) { Rendering::FramePacer::Get().Wake(); };
+        if (fullResolution)
+        {
+            executionFuture = nodeEditor.ExecuteFullResolutionAsync(wake);
+        }
+        else
+        {
+            executionFuture =
+                targetNode ? nodeEditor.ExecuteUpToAsync(*targetNode, wake) : nodeEditor.ExecuteAsync(wake);
+        }
+    }
+
+    void GraphExecutionLayer::RenderBatchControls()
+    {
+        if (!ImGui::CollapsingHeader("Batch Processing"))
+        {
+            return;
+        }
+
+        ImGui::BeginDisabled(isExecuting);
+        ImGui::InputText("Input Folder", batchInputBuffer, sizeof(batchInputBuffer));
+        ImGui::InputText("Output Folder", batchOutputBuffer, sizeof(batchOutputBuffer));
+        ImGui::Checkbox("Include Subfolders", &batchRecursive);
+        ImGui::SameLine();
+        if (ImGui::Button("Run Batch"))
+        {
+            ExecuteBatch();
+        }
+        ImGui::EndDisabled();
+    }
+
+    void GraphExecutionLayer::RenderProfiler()
+    {
+        const bool rowsChanged = RefreshProfilerData();
+        if (!lastRun)
+        {
+            ImGui::TextDisabled("No runs recorded yet - execute the graph to profile it");
+            return;
+        }
+
+        ImGui::Text("Run #%llu %s in %.2f ms (%s)",
+            static_cast<unsigned long long>(lastRun->runNumber),
+            lastRun->succeeded ? "completed" : "failed",
+            ToMilliseconds(lastRun->totalTime),
+            lastRun->parallel ? "parallel" : "sequential");
+        ImGui::Text("Processed %zu, cached %zu, shared %zu, skipped %zu, bypassed %zu, data passes %zu",
+            lastRun->nodesExecuted,
+            lastRun->cacheHits,
+            lastRun->nodesAliased,
+            lastRun->nodesSkipped,
+            lastRun->nodesBypassed,
+            lastRun->dataPassOperations);
+        ImGui::Text("Peak slot memory %.1f MB after node %d, %.1f MB retained",
+            ToMegabytes(lastRun->peakSlotBytes),
+            lastRun->peakNodeId,
+            ToMegabytes(lastRun->retainedSlotBytes));
+        if (lastRun->proxyScale < 1.0)
+        {
+            ImGui::Text("Proxy run at %.0f%% resolution", lastRun->proxyScale * 100.0);
+        }
+        if (lastRun->targetNode)
+        {
+            ImGui::Text("Executed up to node %d (%zu steps)", *lastRun->targetNode, lastRun->nodes.size());
+        }
+
+        if (runTimesMs.size() > 1)
+        {
+            ImGui::PlotLines("Run time (ms)",
+                runTimesMs.data(),
+                static_cast<int>(runTimesMs.size()),
+                0,
+                nullptr,
+                0.0f,
+                FLT_MAX,
+                ImVec2(0.0f, 40.0f));
+        }
+
+        if (ImGui::Button("Clear History"))
+        {
+            nodeEditor.GetExecutionStatistics().Clear();
+            return; // Next frame reloads the (now empty) history
+        }
+
+        constexpr ImGuiTableFlags kTableFlags = ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti
+                                                | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable
+                                                | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+                                                | ImGuiTableFlags_ScrollY;
+        if (!ImGui::BeginTable("ProfilerTable", kColumnCount, kTableFlags))
+        {
+            return;
+        }
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Node", ImGuiTableColumnFlags_None, 0.0f, kColumnNode);
+        ImGui::TableSetupColumn("ID", ImGuiTableColumnFlags_None, 0.0f, kColumnId);
+        ImGui::TableSetupColumn("Type", ImGuiTableColumnFlags_None, 0.0f, kColumnType);
+        ImGui::TableSetupColumn("Last Outcome", ImGuiTableColumnFlags_None, 0.0f, kColumnOutcome);
+        ImGui::TableSetupColumn("Last (ms)",
+            ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending,
+            0.0f,
+            kColumnLast);
+        ImGui::TableSetupColumn("Avg (ms)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnAverage);
+        ImGui::TableSetupColumn("Max (ms)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnMax);
+        ImGui::TableSetupColumn("% of Run", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnShare);
+        ImGui::TableSetupColumn("In (MB)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnInputBytes);
+        ImGui::TableSetupColumn("Out (MB)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnOutputBytes);
+        ImGui::TableSetupColumn(
+            "Max Out (MB)", ImGuiTableColumnFlags_PreferSortDescending, 0.0f, kColumnMaxOutputBytes);
+        ImGui::TableHeadersRow();
+
+        if (ImGuiTableSortSpecs *sortSpecs = ImGui::TableGetSortSpecs();
+            sortSpecs && (sortSpecs->SpecsDirty || rowsChanged))
+        {
+            SortRows(profilerRows, *sortSpecs);
+            sortSpecs->SpecsDirty = false;
+        }
+
+        const float runMs = ToMilliseconds(lastRun->totalTime);
+        for (const auto &row : profilerRows)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(row.nodeName.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", row.nodeId);
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(row.nodeType.c_str());
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(Nodes::ToString(row.lastOutcome));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", ToMilliseconds(row.lastTime));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", ToMilliseconds(row.averageTime));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", ToMilliseconds(row.maxTime));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.1f%%", runMs > 0.0f ? 100.0f * ToMilliseconds(row.lastTime) / runMs : 0.0f);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", ToMegabytes(row.lastInputBytes));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", ToMegabytes(row.lastOutputBytes));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.2f", ToMegabytes(row.maxOutputBytes));
+        }
+
+        ImGui::EndTable();
+    }
+
+    bool GraphExecutionLayer::RefreshProfilerData()
+    {
+        const auto &statistics = nodeEditor.GetExecutionStatistics();
+        const uint64_t runCount = statistics.GetRunCount();
+        if (runCount == profiledRunCount)
+        {
+            return false;
+        }
+
+        profiledRunCount = runCount;
+        profilerRows = statistics.SummarizeNodes();
+        lastRun = statistics.GetLatest();
+        runTimesMs.clear();
+        for (const auto &run : statistics.GetRuns())
+        {
+            runTimesMs.push_back(ToMilliseconds(run.totalTime));
+        }
+        return true;
+    }
+
+    void GraphExecutionLayer::ExecuteBatch()
+    {
+        if (isExecuting)
+        {
+            LOG_WARN("Graph is already executing");
+            return;
+        }
+
+        Vision::IO::BatchOptions options;
+        options.inputDirectory = batchInputBuffer;
+        options.outputDirectory = batchOutputBuffer;
+        options.recursive = batchRecursive;
+        options.itemCallback = [this](const Vision::IO::BatchItem &item) { resultsGallery.Add(item); };
+
+        resultsGallery.Clear();
+        showResultsWindow = true;
+        selectBatchResults = true;
+        isExecuting = true;
+        executionFinished = false;
+        batchRunning = true;
+        autotuneRunning = false;
+        Rendering::FramePacer::Get().SetBusy(true);
         currentNode.store(0, std::memory_order_relaxed);
         totalNodes.store(0, std::memory_order_relaxed);
         {
             std::lock_guard<std::mutex> lock(nameMutex);
-            currentNodeName = "Initializing...";
+            currentNodeName = "Scanning folder...";
         }
 
-        executionFuture = nodeEditor.ExecuteAsync([this](int current, int total, const std::string &name) {
-            // Use atomics for numeric values to avoid mutex overhead
-            currentNode.store(current, std::memory_order_relaxed);
-            totalNodes.store(total, std::memory_order_relaxed);
-            // Only lock for string update
+        batchStopSource = std::stop_source{};
+        auto progress = [this](size_t completed, size_t total, const std::filesystem::path &file) {
+            currentNode.store(static_cast<int>(completed), std::memory_order_relaxed);
+            totalNodes.store(static_cast<int>(total), std::memory_order_relaxed);
             {
                 std::lock_guard<std::mutex> lock(nameMutex);
-                currentNodeName = name;
+                currentNodeName = file.filename().string();
             }
-        });
+            Rendering::FramePacer::Get().Wake();
+        };
+
+        auto runBatch = [this, options, progress, stopToken = batchStopSource.get_token()]() {
+            Vision::IO::BatchProcessor processor(nodeEditor);
+            const auto result = processor.Run(options, progress, stopToken);
+            SignalExecutionFinished();
+            return result.has_value() && result->failed == 0 && !result->cancelled;
+        };
+        executionFuture = nodeEditor.GetExecutorService().Launch(std::move(runBatch));
+    }
+
+    void GraphExecutionLayer::ExecuteAutotune()
+    {
+        if (isExecuting)
+        {
+            LOG_WARN("Graph is already executing");
+            return;
+        }
+
+        const auto profilePath = Vision::IO::Autotuner::GetDefaultProfilePath();
+        if (profilePath.empty())
+        {
+            LOG_ERROR("No configuration directory to keep the tuning profile in");
+            return;
+        }
+
+        isExecuting = true;
+        executionFinished = false;
+        batchRunning = false;
+        autotuneRunning = true;
+        Rendering::FramePacer::Get().SetBusy(true);
+        currentNode.store(0, std::memory_order_relaxed);
+        totalNodes.store(0, std::memory_order_relaxed);
+
+        batchStopSource = std::stop_source{};
+        auto progress = [this](size_t done, size_t planned, const std::string &setting) {
+            currentNode.store(static_cast<int>(done), std::memory_order_relaxed);
+            totalNodes.store(static_cast<int>(planned), std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(nameMutex);
+                currentNodeName = setting;
+            }
+            Rendering::FramePacer::Get().Wake();
+        };
+
+        auto runAutotune = [this, profilePath, progress, stopToken = batchStopSource.get_token()]() {
+            std::string error;
+            const auto profile = Vision::IO::Autotuner::Tune(nodeEditor, {}, error, progress, stopToken);
+            const bool saved = profile && Vision::IO::Autotuner::SaveProfile(*profile, profilePath, error);
+            if (saved)
+            {
+                LOG_INFO("Autotune: {} us -> {} us, profile saved to {}",
+                    profile->baselineTime.count(),
+                    profile->tunedTime.count(),
+                    profilePath.string());
+            }
+            else
+            {
+                LOG_ERROR("Autotune failed: {}", error);
+            }
+            SignalExecutionFinished();
+            return saved;
+        };
+        executionFuture = nodeEditor.GetExecutorService().Launch(std::move(runAutotune));
+    }
+
+    void GraphExecutionLayer::SignalExecutionFinished()
+    {
+        executionFinished.store(true, std::memory_order_release);
+        Rendering::FramePacer::Get().Wake();
     }
 
     void GraphExecutionLayer::CancelExecution()
@@ -146,6 +754,7 @@ namespace VisionCraft::UI::Layers
         {
             LOG_INFO("Cancelling graph execution...");
             nodeEditor.CancelExecution();
+            batchStopSource.request_stop();
         }
     }
 } // namespace VisionCraft::UI::Layers
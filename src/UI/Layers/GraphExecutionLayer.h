@@ -1,18 +1,25 @@
 #pragma once
 
 #include "Layer.h"
+#include "Nodes/Core/EngineConstants.h"
 #include "Nodes/Core/Node.h"
 #include "Nodes/Core/NodeEditor.h"
+#include "UI/Layers/AutoRunScheduler.h"
+#include "UI/Widgets/ResultsGallery.h"
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
 #include <mutex>
+#include <optional>
+#include <stop_token>
 #include <vector>
 
 namespace VisionCraft::UI::Layers
 {
     /**
-     * @brief Layer for graph execution and results display.
+     * @brief Layer for graph execution and the results window (profiler and batch results gallery).
      */
     class GraphExecutionLayer : public Kappa::Layer
     {
@@ -24,9 +31,9 @@ namespace VisionCraft::UI::Layers
         explicit GraphExecutionLayer(Nodes::NodeEditor &nodeEditor);
 
         /**
-         * @brief Virtual destructor.
+         * @brief Stops a running batch before the layer goes away.
          */
-        virtual ~GraphExecutionLayer() = default;
+        ~GraphExecutionLayer() override;
 
         /**
          * @brief Handles execution events.
@@ -48,22 +55,95 @@ namespace VisionCraft::UI::Layers
     private:
         /**
          * @brief Executes node graph.
+         * @param targetNode If set, runs only this node and its upstream nodes
+         * @param fullResolution Runs the whole graph at full resolution regardless of the proxy setting
          */
-        void ExecuteGraph();
+        void ExecuteGraph(std::optional<Nodes::NodeId> targetNode = std::nullopt, bool fullResolution = false);
+
+        /**
+         * @brief Schedules an automatic run after the debounce delay, cancelling a graph run in flight.
+         * @note Does nothing unless auto-run is enabled. Each edit pushes the run back by the full delay.
+         */
+        void ScheduleAutoRun();
+
+        /**
+         * @brief Starts the scheduled automatic run once it is due and no execution is running.
+         */
+        void UpdateAutoRun();
+
+        /**
+         * @brief Runs the graph over every image in the batch input folder on a background thread.
+         */
+        void ExecuteBatch();
+
+        /**
+         * @brief Tunes execution settings on the current graph on a background thread and saves the profile.
+         * @note The profile goes to Vision::IO::Autotuner::GetDefaultProfilePath(), which the constructor loads.
+         */
+        void ExecuteAutotune();
+
+        /**
+         * @brief Renders batch folder inputs and the Run Batch button.
+         */
+        void RenderBatchControls();
+
+        /**
+         * @brief Renders the latest run summary and the sortable per-node timing table.
+         */
+        void RenderProfiler();
+
+        /**
+         * @brief Reloads profiler data from the editor's statistics history if a run was recorded.
+         * @return True if the rows changed
+         */
+        bool RefreshProfilerData();
 
         Nodes::NodeEditor &nodeEditor; ///< Reference to the shared node editor instance
 
         // Execution state
         std::shared_future<bool> executionFuture;
         std::atomic<bool> isExecuting = false; ///< Whether the graph is currently executing
+        std::atomic<bool> executionFinished = false; ///< Set by the job when executionFuture is about to be ready
         bool showResultsWindow = false;        ///< Whether to display the results window
+        bool parallelExecution = false;        ///< Whether independent branches run on the thread pool
+        bool incrementalExecution = true;      ///< Whether clean nodes are skipped
+        bool outputCache = true;               ///< Whether cached node outputs are reused
+        bool duplicateElimination = true;      ///< Whether identical nodes share one evaluation
+        bool recordTrace = false;              ///< Whether a Chrome trace is being recorded
+        AutoRunScheduler autoRunScheduler;     ///< Debounces edits into incremental runs
+        bool proxyExecution = false;           ///< Whether runs use downscaled source images
+        float proxyScale = static_cast<float>(Constants::Proxy::kDefaultScale); ///< Proxy scale offered by the slider
+        int precisionPolicy = 0;               ///< Nodes::PrecisionPolicy offered by the combo
+        int maxCores = 0;                      ///< ThreadBudget core limit (0 = all cores)
+        std::stop_source batchStopSource;      ///< Cancels the running batch or autotune
 
-        // Progress tracking - using atomics to avoid mutex overhead
+        // Batch settings (ImGui needs fixed buffers)
+        char batchInputBuffer[Constants::Buffers::kFilePathBufferSize] = "";  ///< Folder with input images
+        char batchOutputBuffer[Constants::Buffers::kFilePathBufferSize] = ""; ///< Folder receiving results
+        bool batchRecursive = false;                                          ///< Include subfolders
+
+        // Batch and autotune progress, reported per file or setting; graph runs sample the editor's ProgressChannel
+        bool batchRunning = false;    ///< Whether the running execution is a batch
+        bool autotuneRunning = false; ///< Whether the running execution is an autotune
         std::atomic<int> currentNode = 0;
         std::atomic<int> totalNodes = 0;
         std::mutex nameMutex; ///< Only for currentNodeName (strings can't be atomic)
         std::string currentNodeName;
 
+        // Profiler data, reloaded only when a new run is recorded
+        std::vector<Nodes::NodeTimingSummary> profilerRows; ///< Per-node timings in display order
+        std::optional<Nodes::RunStatistics> lastRun;        ///< Latest recorded run
+        std::vector<float> runTimesMs;                      ///< Total time of each retained run
+        uint64_t profiledRunCount = 0;                      ///< Run count the profiler data was loaded at
+
+        Widgets::ResultsGallery resultsGallery; ///< Files of the latest batch (filled by pipeline threads)
+        bool selectBatchResults = false;        ///< Bring the gallery tab to front on the next frame
+
+        /**
+         * @brief Marks the running execution finished and wakes the render loop (job thread).
+         */
+        void SignalExecutionFinished();
+
         /**
          * @brief Requests cancellation of current execution.
          */
@@ -1,15 +1,22 @@
 #include "NodeEditorLayer.h"
+#include "Editor/Commands/CompositeCommand.h"
 #include "Editor/Commands/ConnectionCommands.h"
 #include "Editor/Commands/NodeCommands.h"
+#include "Nodes/Core/StartupProfile.h"
+#include "UI/Events/ConnectionsChangedEvent.h"
 #include "UI/Events/FileOpenedEvent.h"
+#include "UI/Events/GraphExecuteEvent.h"
 #include "UI/Events/LoadGraphEvent.h"
 #include "UI/Events/NewGraphEvent.h"
+#include "UI/Events/ParameterChangedEvent.h"
 #include "UI/Events/SaveGraphEvent.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "UI/Rendering/NodeRenderer.h"
 #include "UI/Widgets/NodeEditorConstants.h"
 #include "Logger.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstring>
 #include <iterator>
@@ -19,51 +26,98 @@
 
 #include "Application.h"
 
+#include "Vision/Factory/NodePluginLoader.h"
 #include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/PreviewNode.h"
+#include "Vision/IO/PreviewTexture.h"
 
 
 namespace VisionCraft::UI::Layers
 {
+    namespace
+    {
+        /**
+         * @brief Calls a function with the node as the node type that shows an image preview.
+         * @param node Node (may be null)
+         * @param function Called with Vision::IO::ImageInputNode & or Vision::IO::PreviewNode &
+         * @return False if the node shows no image preview
+         */
+        template<typename Function> bool VisitImagePreviewNode(Nodes::Node *node, Function &&function)
+        {
+            if (auto *imageNode = dynamic_cast<Vision::IO::ImageInputNode *>(node))
+            {
+                function(*imageNode);
+                return true;
+            }
+            if (auto *previewNode = dynamic_cast<Vision::IO::PreviewNode *>(node))
+            {
+                function(*previewNode);
+                return true;
+            }
+            return false;
+        }
+    } // namespace
+
     NodeEditorLayer::NodeEditorLayer(Nodes::NodeEditor &nodeEditor)
         : nodeEditor(nodeEditor), nodeRenderer(canvas, connectionManager),
           inputHandler(selectionManager, contextMenuRenderer, canvas)
     {
         // Register all available node types with the factory
-        Vision::NodeFactory::RegisterAllNodes();
+        {
+            Nodes::StartupScope scope("Node registration");
+            Vision::NodeFactory::RegisterAllNodes();
+        }
 
-        // Register node types for context menu
-        contextMenuRenderer.SetAvailableNodeTypes({
+        // Node types for the context menu and the search palette
+        std::vector<Widgets::ContextMenuRenderer::NodeTypeInfo> nodeTypes{
             { .typeId = "ImageInput", .displayName = "Image Input", .category = "Input/Output" },
             { .typeId = "ImageOutput", .displayName = "Image Output", .category = "Input/Output" },
             { .typeId = "Preview", .displayName = "Preview", .category = "Input/Output" },
+            { .typeId = "VideoInput", .displayName = "Video Input", .category = "Input/Output" },
+            { .typeId = "SharedMemoryInput", .displayName = "Shared Memory Input", .category = "Input/Output" },
+            { .typeId = "SharedMemoryOutput", .displayName = "Shared Memory Output", .category = "Input/Output" },
+            { .typeId = "TiledImageInput", .displayName = "Tiled Image Input", .category = "Input/Output" },
             { .typeId = "Grayscale", .displayName = "Grayscale", .category = "Processing" },
             { .typeId = "CannyEdge", .displayName = "Canny Edge Detection", .category = "Processing" },
             { .typeId = "Threshold", .displayName = "Threshold", .category = "Processing" },
             { .typeId = "Sobel", .displayName = "Sobel Edge Detection", .category = "Processing" },
+            { .typeId = "Gradient", .displayName = "Gradient", .category = "Processing" },
             { .typeId = "MedianBlur", .displayName = "Median Blur", .category = "Processing" },
             { .typeId = "Morphology", .displayName = "Morphology", .category = "Processing" },
             { .typeId = "CvtColor", .displayName = "Convert Color", .category = "Processing" },
             { .typeId = "Resize", .displayName = "Resize", .category = "Processing" },
+            { .typeId = "ImagePyramid", .displayName = "Image Pyramid", .category = "Processing" },
+            { .typeId = "Crop", .displayName = "Crop", .category = "Processing" },
             { .typeId = "SplitChannels", .displayName = "Split Channels", .category = "Processing" },
             { .typeId = "MergeChannels", .displayName = "Merge Channels", .category = "Processing" },
-        });
+            { .typeId = "MaskLogic", .displayName = "Mask Logic", .category = "Processing" },
+            { .typeId = "FindContours", .displayName = "Find Contours", .category = "Processing" },
+            { .typeId = "FilterContours", .displayName = "Filter Contours", .category = "Processing" },
+            { .typeId = "DrawContours", .displayName = "Draw Contours", .category = "Processing" },
+            { .typeId = "Branch", .displayName = "Branch", .category = "Flow" },
+            { .typeId = "ForEach", .displayName = "For Each", .category = "Flow" },
+        };
 
-        // Register node types for search palette
-        searchPalette.SetAvailableNodeTypes({
-            { .typeId = "ImageInput", .displayName = "Image Input", .category = "Input/Output" },
-            { .typeId = "ImageOutput", .displayName = "Image Output", .category = "Input/Output" },
-            { .typeId = "Preview", .displayName = "Preview", .category = "Input/Output" },
-            { .typeId = "Grayscale", .displayName = "Grayscale", .category = "Processing" },
-            { .typeId = "CannyEdge", .displayName = "Canny Edge Detection", .category = "Processing" },
-            { .typeId = "Threshold", .displayName = "Threshold", .category = "Processing" },
-            { .typeId = "Sobel", .displayName = "Sobel Edge Detection", .category = "Processing" },
-            { .typeId = "MedianBlur", .displayName = "Median Blur", .category = "Processing" },
-            { .typeId = "Morphology", .displayName = "Morphology", .category = "Processing" },
-            { .typeId = "CvtColor", .displayName = "Convert Color", .category = "Processing" },
-            { .typeId = "Resize", .displayName = "Resize", .category = "Processing" },
-            { .typeId = "SplitChannels", .displayName = "Split Channels", .category = "Processing" },
-            { .typeId = "MergeChannels", .displayName = "Merge Channels", .category = "Processing" },
-        });
+        // Plugin packs are listed from their manifests; a pack loads when one of its types is first created
+        {
+            Nodes::StartupScope scope("Plugin manifests");
+            for (const auto &type : Vision::NodePluginLoader::GetDeclaredTypes())
+            {
+                nodeTypes.push_back(
+                    { .typeId = type.typeId, .displayName = type.displayName, .category = type.category });
+            }
+        }
+
+        contextMenuRenderer.SetAvailableNodeTypes(nodeTypes);
+
+        std::vector<Widgets::SearchableNodeInfo> searchableTypes;
+        searchableTypes.reserve(nodeTypes.size());
+        for (const auto &type : nodeTypes)
+        {
+            searchableTypes.push_back(
+                { .typeId = type.typeId, .displayName = type.displayName, .category = type.category });
+        }
+        searchPalette.SetAvailableNodeTypes(searchableTypes);
 
         // Set connection creation callback for undo/redo
         connectionManager.SetConnectionCreatedCallback([this](const Widgets::NodeConnection &connection) {
@@ -74,10 +128,53 @@ namespace VisionCraft::UI::Layers
                     // Pass false to avoid triggering callback again
                     connectionManager.CreateConnection(outputPin, inputPin, this->nodeEditor, false);
                 },
-                [this](const Widgets::NodeConnection &conn) { connectionManager.RemoveConnection(conn); });
+                [this](const Widgets::NodeConnection &conn) { connectionManager.RemoveConnection(conn, nodeEditor); });
+
+            commandHistory.ExecuteCommand(std::move(command));
+        });
 
+        // Parameter widgets edit through undoable commands; a scrub merges into one step until released
+        nodeRenderer.SetParameterEditCallback([this](Nodes::NodeId nodeId,
+                                                  const std::string &name,
+                                                  const Nodes::NodeData &previous,
+                                                  Nodes::NodeData value) {
+            auto command = std::make_unique<Editor::Commands::SetParameterCommand>(nodeId,
+                name,
+                previous,
+                std::move(value),
+                [this](Nodes::NodeId id, const std::string &slotName, const Nodes::NodeData &data) {
+                    auto *node = nodeEditor.GetNode(id);
+                    if (!node)
+                    {
+                        return;
+                    }
+                    node->SetInputSlotDefault(slotName, data);
+                    // Undo and redo announce the change at once; a held widget announces it when released
+                    if (!ImGui::IsAnyItemActive())
+                    {
+                        Kappa::Application::Get().GetEventBus().Publish(Events::ParameterChangedEvent{ id, slotName });
+                    }
+                });
             commandHistory.ExecuteCommand(std::move(command));
         });
+        Kappa::Application::Get().GetEventBus().Subscribe<Events::ParameterChangedEvent>(
+            [this](const Events::ParameterChangedEvent &) { commandHistory.SealLastCommand(); });
+
+        // The node editor owns the connections; mirror its changes onto the canvas through the event bus
+        nodeEditor.SetConnectionObserver([](const Nodes::ConnectionDelta &delta) {
+            Events::ConnectionsChangedEvent event(delta);
+            Kappa::Application::Get().GetEventBus().Publish(event);
+        });
+        Kappa::Application::Get().GetEventBus().Subscribe<Events::ConnectionsChangedEvent>(
+            [this](const Events::ConnectionsChangedEvent &event) {
+                connectionManager.ApplyConnectionDelta(event.GetDelta());
+            });
+        connectionManager.ApplyConnectionDelta({ .reset = true, .removed = {}, .added = nodeEditor.GetConnections() });
+    }
+
+    NodeEditorLayer::~NodeEditorLayer()
+    {
+        nodeEditor.SetConnectionObserver(nullptr);
     }
 
     void NodeEditorLayer::OnEvent(Kappa::Event &event)
@@ -100,14 +197,18 @@ namespace VisionCraft::UI::Layers
         }
     }
 
-    void NodeEditorLayer::OnUpdate([[maybe_unused]] float deltaTime)
+    void NodeEditorLayer::OnUpdate(float deltaTime)
     {
+        UpdateAutosave(deltaTime);
     }
 
     void NodeEditorLayer::OnRender()
     {
+        Rendering::FrameScope frameScope(Rendering::FrameSection::EditorRender);
         ImGui::Begin("Node Editor");
 
+        RenderCostOverlayControls();
+
         auto *drawList = ImGui::GetWindowDrawList();
         const auto canvasPos = ImGui::GetCursorScreenPos();
         const auto canvasSize = ImGui::GetContentRegionAvail();
@@ -117,7 +218,7 @@ namespace VisionCraft::UI::Layers
         const auto &io = ImGui::GetIO();
         canvas.HandleImGuiInput(io, ImGui::IsWindowHovered());
 
-        if (nodeEditor.GetNodeIds().empty())
+        if (nodeEditor.GetGraphView()->nodeIds.empty())
         {
             const auto nodeId = AllocateNodeId();
             if (nodeId == 0)
@@ -126,14 +227,15 @@ namespace VisionCraft::UI::Layers
             }
             auto starterNode = std::make_unique<Vision::IO::ImageInputNode>(nodeId);
             nodeEditor.AddNode(std::move(starterNode));
-            nodePositions[nodeId] = { 100.0f, 100.0f };
+            SetNodePosition(nodeId, { 100.0f, 100.0f });
 
             selectionManager.ClearSelection();
         }
 
+        MeasurePendingNodes();
         HandleMouseInteractions();
         DetectHoveredPin();
-        connectionManager.HandleConnectionInteractions(nodeEditor, nodePositions, canvas);
+        connectionManager.HandleConnectionInteractions(nodeEditor, nodePositions, nodeIndex, canvas);
 
         connectionManager.RenderConnections(nodeEditor, nodePositions, canvas, hoveredConnection);
         RenderNodes();
@@ -149,24 +251,127 @@ namespace VisionCraft::UI::Layers
         // Render file dialogs
         RenderSaveDialog();
         RenderLoadDialog();
+
+        RenderImageInspector();
+
+        // Free textures of previews scrolled off screen once they exceed the video memory budget
+        Vision::IO::PreviewTexture::ReleaseOverBudget();
+    }
+
+    void NodeEditorLayer::RenderCostOverlayControls()
+    {
+        auto &overlay = nodeRenderer.GetCostOverlay();
+        constexpr const char *kModeNames[] = { "Off", "Run time", "Memory" };
+        int mode = static_cast<int>(overlay.GetMode());
+        ImGui::SetNextItemWidth(Constants::CostOverlay::kModeComboWidth);
+        if (ImGui::Combo("Cost Heatmap", &mode, kModeNames, IM_ARRAYSIZE(kModeNames)))
+        {
+            overlay.SetMode(static_cast<Rendering::CostOverlayMode>(mode));
+        }
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Tint nodes by their share of the latest run; the critical path is outlined");
+        }
+
+        overlay.Refresh(nodeEditor);
     }
 
     void NodeEditorLayer::RenderNodes()
     {
-        for (const auto nodeId : nodeEditor.GetNodeIds())
+        Rendering::FrameScope frameScope(Rendering::FrameSection::RenderNodes);
+        ImVec2 visibleMin;
+        ImVec2 visibleMax;
+        canvas.GetVisibleWorldBounds(visibleMin, visibleMax);
+        constexpr float margin = Constants::Canvas::kCullingMargin;
+        nodeIndex.Query(ImVec2(visibleMin.x - margin, visibleMin.y - margin),
+            ImVec2(visibleMax.x + margin, visibleMax.y + margin),
+            visibleNodes);
+
+        const float zoom = canvas.GetZoomLevel();
+        visiblePreviews.clear();
+        for (const auto nodeId : visibleNodes)
         {
             auto *node = nodeEditor.GetNode(nodeId);
-            if (node && nodePositions.find(nodeId) != nodePositions.end())
+            const auto posIt = nodePositions.find(nodeId);
+            if (!node || posIt == nodePositions.end())
+            {
+                continue;
+            }
+            if (dynamic_cast<const Vision::IO::PreviewNode *>(node))
+            {
+                visiblePreviews.push_back(nodeId);
+            }
+
+            // Nodes grow and shrink with their content; keep the index at the size just drawn
+            const auto screenSize = RenderNode(node, posIt->second);
+            nodeIndex.Update(
+                nodeId, ImVec2(posIt->second.x, posIt->second.y), ImVec2(screenSize.x / zoom, screenSize.y / zoom));
+        }
+
+        // Parallel runs finish the branches feeding the previews on screen first
+        std::ranges::sort(visiblePreviews);
+        if (visiblePreviews != scheduledPreviews)
+        {
+            scheduledPreviews = visiblePreviews;
+            nodeEditor.SetVisibleNodes(scheduledPreviews);
+        }
+
+        nodeRenderer.RenderFileBrowser();
+    }
+
+    void NodeEditorLayer::MeasurePendingNodes()
+    {
+        for (const auto nodeId : unmeasuredNodes)
+        {
+            const auto *node = nodeEditor.GetNode(nodeId);
+            const auto posIt = nodePositions.find(nodeId);
+            if (!node || posIt == nodePositions.end())
             {
-                RenderNode(node, nodePositions[nodeId]);
+                continue;
             }
+
+            nodeIndex.Update(nodeId, ImVec2(posIt->second.x, posIt->second.y), nodeRenderer.MeasureNode(*node));
+        }
+        unmeasuredNodes.clear();
+    }
+
+    void NodeEditorLayer::SetNodePosition(Nodes::NodeId nodeId, const Widgets::NodePosition &pos)
+    {
+        nodePositions[nodeId] = pos;
+
+        // Moving keeps the measured size; new nodes get a placeholder until MeasurePendingNodes()
+        const auto *bounds = nodeIndex.Find(nodeId);
+        const ImVec2 size = bounds ? ImVec2(bounds->max.x - bounds->min.x, bounds->max.y - bounds->min.y)
+                                   : ImVec2(Constants::Node::kWidth, Constants::Node::kMinHeight);
+        if (!bounds)
+        {
+            unmeasuredNodes.insert(nodeId);
         }
+        nodeIndex.Update(nodeId, ImVec2(pos.x, pos.y), size);
+    }
+
+    void NodeEditorLayer::EraseNodePosition(Nodes::NodeId nodeId)
+    {
+        nodePositions.erase(nodeId);
+        nodeIndex.Remove(nodeId);
+        unmeasuredNodes.erase(nodeId);
+        connectionManager.InvalidatePinLayout(nodeId);
+        nodeRenderer.InvalidateNodeLayout(nodeId);
+    }
+
+    void NodeEditorLayer::ClearNodePositions()
+    {
+        nodePositions.clear();
+        nodeIndex.Clear();
+        unmeasuredNodes.clear();
+        connectionManager.ClearPinLayouts();
+        nodeRenderer.ClearNodeLayouts();
     }
 
-    void NodeEditorLayer::RenderNode(Nodes::Node *node, const Widgets::NodePosition &nodePos)
+    ImVec2 NodeEditorLayer::RenderNode(Nodes::Node *node, const Widgets::NodePosition &nodePos)
     {
         auto getPinInteractionState = [this](Nodes::NodeId nodeId,
-                                          const std::string &pinName) -> Rendering::PinInteractionState {
+                                          Nodes::SlotName pinName) -> Rendering::PinInteractionState {
             return this->GetPinInteractionState(nodeId, pinName);
         };
 
@@ -174,17 +379,7 @@ namespace VisionCraft::UI::Layers
         const bool isSelected = selectionManager.IsNodeSelected(node->GetId());
         const Nodes::NodeId displaySelectedId = isSelected ? node->GetId() : Constants::Special::kInvalidNodeId;
 
-        nodeRenderer.RenderNode(node, nodePos, displaySelectedId, getPinInteractionState);
-    }
-
-    bool NodeEditorLayer::IsMouseOverNode(const ImVec2 &mousePos,
-        const Widgets::NodePosition &nodePos,
-        const ImVec2 &nodeSize) const
-    {
-        const auto worldPos = canvas.WorldToScreen(ImVec2(nodePos.x, nodePos.y));
-
-        return mousePos.x >= worldPos.x && mousePos.x <= worldPos.x + nodeSize.x && mousePos.y >= worldPos.y
-               && mousePos.y <= worldPos.y + nodeSize.y;
+        return nodeRenderer.RenderNode(node, nodePos, displaySelectedId, getPinInteractionState);
     }
 
     void NodeEditorLayer::HandleMouseInteractions()
@@ -199,11 +394,11 @@ namespace VisionCraft::UI::Layers
         auto updateBoxSelection = [this]() { UpdateBoxSelection(); };
 
         // Process input and get actions
-        const auto actions =
+        auto actions =
             inputHandler.ProcessInput(nodePositions, hoveredPin, findNode, findConnection, updateBoxSelection);
 
         // Handle actions
-        for (const auto &action : actions)
+        for (auto &action : actions)
         {
             switch (action.type)
             {
@@ -218,17 +413,19 @@ namespace VisionCraft::UI::Layers
                         nodeId,
                         [this](Nodes::NodeId id) -> Nodes::Node * { return nodeEditor.GetNode(id); },
                         [this](Nodes::NodeId id) {
-                            (void)nodeEditor.RemoveNode(id);
-                            nodePositions.erase(id);
+                            auto detached = nodeEditor.DetachNode(id);
+                            EraseNodePosition(id);
                             if (selectionManager.IsNodeSelected(id))
                             {
                                 selectionManager.RemoveFromSelection(id);
                             }
+                            return detached;
                         },
                         [this](std::unique_ptr<Nodes::Node> node) { nodeEditor.AddNode(std::move(node)); },
                         [this](Nodes::NodeId id) -> Widgets::NodePosition { return nodePositions[id]; },
-                        [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { nodePositions[id] = pos; },
+                        [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { SetNodePosition(id, pos); },
                         [this](const std::string &type, Nodes::NodeId id, const std::string &name) {
+                            Nodes::NodeArena::Scope scope(nodeEditor.GetNodeArena());
                             return Vision::NodeFactory::CreateNode(NodeTypeToFactoryKey(type), id, name);
                         });
 
@@ -245,7 +442,9 @@ namespace VisionCraft::UI::Layers
                         [this](const Widgets::PinId &outputPin, const Widgets::PinId &inputPin) {
                             connectionManager.CreateConnection(outputPin, inputPin, nodeEditor, false);
                         },
-                        [this](const Widgets::NodeConnection &conn) { connectionManager.RemoveConnection(conn); });
+                        [this](const Widgets::NodeConnection &conn) {
+                            connectionManager.RemoveConnection(conn, nodeEditor);
+                        });
 
                     commandHistory.ExecuteCommand(std::move(command));
                 }
@@ -254,7 +453,7 @@ namespace VisionCraft::UI::Layers
             case Canvas::InputActionType::UpdateNodePositions:
                 for (const auto &[nodeId, pos] : action.nodePositions)
                 {
-                    nodePositions[nodeId] = pos;
+                    SetNodePosition(nodeId, pos);
                 }
                 break;
 
@@ -326,94 +525,9 @@ namespace VisionCraft::UI::Layers
                 break;
             }
 
-            case Canvas::InputActionType::PasteNodes: {
-                if (!clipboardManager.HasData())
-                {
-                    break;
-                }
-
-                // Convert mouse position to world coordinates
-                const auto pasteWorldPos = canvas.ScreenToWorld(action.pastePosition);
-
-                // Get copied nodes once and store reference
-                const auto &copiedNodes = clipboardManager.GetCopiedNodes();
-                if (copiedNodes.empty())
-                {
-                    break;
-                }
-
-                // Calculate center of copied nodes
-                float centerX = 0.0f, centerY = 0.0f;
-                for (const auto &copiedNode : copiedNodes)
-                {
-                    centerX += copiedNode.position.x;
-                    centerY += copiedNode.position.y;
-                }
-                centerX /= copiedNodes.size();
-                centerY /= copiedNodes.size();
-
-                // Map old IDs to new IDs for connection remapping
-                std::unordered_map<Nodes::NodeId, Nodes::NodeId> idMapping;
-
-                // Create new nodes
-                for (const auto &copiedNode : copiedNodes)
-                {
-                    const auto newNodeId = AllocateNodeId();
-                    if (newNodeId == 0)
-                    {
-                        break; // Stop if we can't allocate more IDs
-                    }
-                    idMapping[copiedNode.originalId] = newNodeId;
-
-                    // Create node using factory
-                    auto newNode = Vision::NodeFactory::CreateNode(copiedNode.type, newNodeId, copiedNode.name);
-                    if (newNode)
-                    {
-                        // Calculate offset from center and apply to paste position
-                        const auto offsetX = copiedNode.position.x - centerX;
-                        const auto offsetY = copiedNode.position.y - centerY;
-                        const auto newX = pasteWorldPos.x + offsetX;
-                        const auto newY = pasteWorldPos.y + offsetY;
-                        nodePositions[newNodeId] = { newX, newY };
-
-                        nodeEditor.AddNode(std::move(newNode));
-                    }
-                }
-
-                // Recreate connections using new IDs
-                for (const auto &copiedConnection : clipboardManager.GetCopiedConnections())
-                {
-                    // Validate that both node IDs exist in the mapping
-                    if (idMapping.find(copiedConnection.fromNodeId) == idMapping.end()
-                        || idMapping.find(copiedConnection.toNodeId) == idMapping.end())
-                    {
-                        continue; // Skip this connection if nodes weren't created
-                    }
-
-                    const auto newFromId = idMapping[copiedConnection.fromNodeId];
-                    const auto newToId = idMapping[copiedConnection.toNodeId];
-
-                    Widgets::PinId outputPin{ newFromId, copiedConnection.fromSlot };
-                    Widgets::PinId inputPin{ newToId, copiedConnection.toSlot };
-
-                    connectionManager.CreateConnection(outputPin, inputPin, nodeEditor);
-                }
-
-                // Select the newly pasted nodes
-                selectionManager.ClearSelection();
-                for (const auto &[oldId, newId] : idMapping)
-                {
-                    selectionManager.ToggleNodeSelection(newId);
-                }
-
-                // After first paste of cut operation, convert to copy
-                if (clipboardManager.GetOperation() == Editor::State::ClipboardOperation::Cut)
-                {
-                    clipboardManager.CompleteCutOperation();
-                }
-
+            case Canvas::InputActionType::PasteNodes:
+                PasteClipboard(action.pastePosition);
                 break;
-            }
 
             case Canvas::InputActionType::Undo:
                 commandHistory.Undo();
@@ -426,9 +540,10 @@ namespace VisionCraft::UI::Layers
             case Canvas::InputActionType::FinishNodeMove:
                 if (!action.oldNodePositions.empty() && !action.nodePositions.empty())
                 {
-                    auto command = std::make_unique<Editor::Commands::MoveNodesCommand>(action.oldNodePositions,
-                        action.nodePositions,
-                        [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { nodePositions[id] = pos; });
+                    auto command =
+                        std::make_unique<Editor::Commands::MoveNodesCommand>(std::move(action.oldNodePositions),
+                            std::move(action.nodePositions),
+                            [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { SetNodePosition(id, pos); });
 
                     commandHistory.ExecuteCommand(std::move(command));
                 }
@@ -442,6 +557,7 @@ namespace VisionCraft::UI::Layers
 
     void NodeEditorLayer::DetectHoveredPin()
     {
+        Rendering::FrameScope frameScope(Rendering::FrameSection::DetectHoveredPin);
         const auto &io = ImGui::GetIO();
         const auto mousePos = io.MousePos;
 
@@ -463,7 +579,7 @@ namespace VisionCraft::UI::Layers
     }
 
     Rendering::PinInteractionState NodeEditorLayer::GetPinInteractionState(Nodes::NodeId nodeId,
-        const std::string &pinName) const
+        Nodes::SlotName pinName) const
     {
         Rendering::PinInteractionState state;
         state.isHovered = (hoveredPin.nodeId == nodeId && hoveredPin.pinName == pinName);
@@ -475,7 +591,8 @@ namespace VisionCraft::UI::Layers
 
     void NodeEditorLayer::RenderContextMenu()
     {
-        const auto result = contextMenuRenderer.Render(selectionManager.HasSelection(), clipboardManager.HasData());
+        const auto result = contextMenuRenderer.Render(
+            selectionManager.HasSelection(), clipboardManager.HasData(), selectionManager.GetSelectionCount() == 1);
 
         switch (result.action)
         {
@@ -492,17 +609,19 @@ namespace VisionCraft::UI::Layers
                     nodeId,
                     [this](Nodes::NodeId id) -> Nodes::Node * { return nodeEditor.GetNode(id); },
                     [this](Nodes::NodeId id) {
-                        (void)nodeEditor.RemoveNode(id);
-                        nodePositions.erase(id);
+                        auto detached = nodeEditor.DetachNode(id);
+                        EraseNodePosition(id);
                         if (selectionManager.IsNodeSelected(id))
                         {
                             selectionManager.RemoveFromSelection(id);
                         }
+                        return detached;
                     },
                     [this](std::unique_ptr<Nodes::Node> node) { nodeEditor.AddNode(std::move(node)); },
                     [this](Nodes::NodeId id) -> Widgets::NodePosition { return nodePositions[id]; },
-                    [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { nodePositions[id] = pos; },
+                    [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { SetNodePosition(id, pos); },
                     [this](const std::string &type, Nodes::NodeId id, const std::string &name) {
+                        Nodes::NodeArena::Scope scope(nodeEditor.GetNodeArena());
                         return Vision::NodeFactory::CreateNode(NodeTypeToFactoryKey(type), id, name);
                     });
 
@@ -514,6 +633,10 @@ namespace VisionCraft::UI::Layers
         case Widgets::ContextMenuResult::Action::CreateNode:
             CreateNodeAtPosition(result.nodeType, inputHandler.GetContextMenuPos());
             break;
+        case Widgets::ContextMenuResult::Action::ExecuteUpToNode:
+            Kappa::Application::Get().GetEventBus().Publish(
+                Events::GraphExecuteEvent{ *selectionManager.GetSelectedNodes().begin() });
+            break;
         case Widgets::ContextMenuResult::Action::CopyNodes: {
             // Get node types and names from Nodes::NodeEditor
             std::unordered_map<Nodes::NodeId, std::string> nodeTypes;
@@ -567,94 +690,9 @@ namespace VisionCraft::UI::Layers
             selectionManager.ClearSelection();
             break;
         }
-        case Widgets::ContextMenuResult::Action::PasteNodes: {
-            if (!clipboardManager.HasData())
-            {
-                break;
-            }
-
-            // Convert context menu position to world coordinates
-            const auto pasteWorldPos = canvas.ScreenToWorld(inputHandler.GetContextMenuPos());
-
-            // Get copied nodes once and store reference
-            const auto &copiedNodes = clipboardManager.GetCopiedNodes();
-            if (copiedNodes.empty())
-            {
-                break;
-            }
-
-            // Calculate center of copied nodes
-            float centerX = 0.0f, centerY = 0.0f;
-            for (const auto &copiedNode : copiedNodes)
-            {
-                centerX += copiedNode.position.x;
-                centerY += copiedNode.position.y;
-            }
-            centerX /= copiedNodes.size();
-            centerY /= copiedNodes.size();
-
-            // Map old IDs to new IDs for connection remapping
-            std::unordered_map<Nodes::NodeId, Nodes::NodeId> idMapping;
-
-            // Create new nodes
-            for (const auto &copiedNode : copiedNodes)
-            {
-                const auto newNodeId = AllocateNodeId();
-                if (newNodeId == 0)
-                {
-                    break; // Stop if we can't allocate more IDs
-                }
-                idMapping[copiedNode.originalId] = newNodeId;
-
-                // Create node using factory
-                auto newNode = Vision::NodeFactory::CreateNode(copiedNode.type, newNodeId, copiedNode.name);
-                if (newNode)
-                {
-                    // Calculate offset from center and apply to paste position
-                    const auto offsetX = copiedNode.position.x - centerX;
-                    const auto offsetY = copiedNode.position.y - centerY;
-                    const auto newX = pasteWorldPos.x + offsetX;
-                    const auto newY = pasteWorldPos.y + offsetY;
-                    nodePositions[newNodeId] = { newX, newY };
-
-                    nodeEditor.AddNode(std::move(newNode));
-                }
-            }
-
-            // Recreate connections using new IDs
-            for (const auto &copiedConnection : clipboardManager.GetCopiedConnections())
-            {
-                // Validate that both node IDs exist in the mapping
-                if (idMapping.find(copiedConnection.fromNodeId) == idMapping.end()
-                    || idMapping.find(copiedConnection.toNodeId) == idMapping.end())
-                {
-                    continue; // Skip this connection if nodes weren't created
-                }
-
-                const auto newFromId = idMapping[copiedConnection.fromNodeId];
-                const auto newToId = idMapping[copiedConnection.toNodeId];
-
-                Widgets::PinId outputPin{ newFromId, copiedConnection.fromSlot };
-                Widgets::PinId inputPin{ newToId, copiedConnection.toSlot };
-
-                connectionManager.CreateConnection(outputPin, inputPin, nodeEditor);
-            }
-
-            // Select the newly pasted nodes
-            selectionManager.ClearSelection();
-            for (const auto &[oldId, newId] : idMapping)
-            {
-                selectionManager.ToggleNodeSelection(newId);
-            }
-
-            // After first paste of cut operation, convert to copy
-            if (clipboardManager.GetOperation() == Editor::State::ClipboardOperation::Cut)
-            {
-                clipboardManager.CompleteCutOperation();
-            }
-
+        case Widgets::ContextMenuResult::Action::PasteNodes:
+            PasteClipboard(inputHandler.GetContextMenuPos());
             break;
-        }
         case Widgets::ContextMenuResult::Action::None:
             break;
         }
@@ -680,13 +718,26 @@ namespace VisionCraft::UI::Layers
             { "CannyEdge", "Canny Edge" },
             { "Threshold", "Threshold" },
             { "Preview", "Preview" },
+            { "VideoInput", "Video Input" },
+            { "SharedMemoryInput", "Shared Memory Input" },
+            { "SharedMemoryOutput", "Shared Memory Output" },
+            { "TiledImageInput", "Tiled Image Input" },
             { "Sobel", "Sobel Edge Detection" },
+            { "Gradient", "Gradient" },
             { "MedianBlur", "Median Blur" },
             { "Morphology", "Morphology" },
             { "CvtColor", "Convert Color" },
             { "Resize", "Resize" },
+            { "ImagePyramid", "Image Pyramid" },
+            { "Crop", "Crop" },
             { "SplitChannels", "Split Channels" },
-            { "MergeChannels", "Merge Channels" } };
+            { "MergeChannels", "Merge Channels" },
+            { "MaskLogic", "Mask Logic" },
+            { "FindContours", "Find Contours" },
+            { "FilterContours", "Filter Contours" },
+            { "DrawContours", "Draw Contours" },
+            { "Branch", "Branch" },
+            { "ForEach", "For Each" } };
 
         // Get display name or use type as fallback
         const auto displayName = displayNames.contains(nodeType) ? displayNames.at(nodeType) : nodeType;
@@ -694,11 +745,15 @@ namespace VisionCraft::UI::Layers
         // Create command for node creation
         auto command = std::make_unique<Editor::Commands::CreateNodeCommand>(
             [this, nodeType, nodeId, displayName]() {
+                Nodes::NodeArena::Scope scope(nodeEditor.GetNodeArena());
                 return Vision::NodeFactory::CreateNode(nodeType, nodeId, displayName);
             },
             [this](std::unique_ptr<Nodes::Node> node) { nodeEditor.AddNode(std::move(node)); },
-            [this](Nodes::NodeId id) { [[maybe_unused]] bool removed = nodeEditor.RemoveNode(id); },
-            [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { nodePositions[id] = pos; },
+            [this](Nodes::NodeId id) {
+                [[maybe_unused]] bool removed = nodeEditor.RemoveNode(id);
+                EraseNodePosition(id);
+            },
+            [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { SetNodePosition(id, pos); },
             Widgets::NodePosition{ worldX, worldY },
             nodeType);
 
@@ -706,6 +761,103 @@ namespace VisionCraft::UI::Layers
         selectionManager.ClearSelection();
     }
 
+    void NodeEditorLayer::PasteClipboard(const ImVec2 &screenPosition)
+    {
+        const auto &copiedNodes = clipboardManager.GetCopiedNodes();
+        if (!clipboardManager.HasData() || copiedNodes.empty())
+        {
+            return;
+        }
+
+        // Keep the copied layout, centered on the paste position
+        const auto pasteWorldPos = canvas.ScreenToWorld(screenPosition);
+        float centerX = 0.0f, centerY = 0.0f;
+        for (const auto &copiedNode : copiedNodes)
+        {
+            centerX += copiedNode.position.x;
+            centerY += copiedNode.position.y;
+        }
+        centerX /= copiedNodes.size();
+        centerY /= copiedNodes.size();
+
+        // Map old IDs to new IDs for connection remapping
+        std::unordered_map<Nodes::NodeId, Nodes::NodeId> idMapping;
+        std::vector<std::unique_ptr<Editor::Commands::Command>> parts;
+        parts.reserve(copiedNodes.size() + clipboardManager.GetCopiedConnections().size());
+        for (const auto &copiedNode : copiedNodes)
+        {
+            if (!Vision::NodeFactory::IsRegistered(copiedNode.type))
+            {
+                continue;
+            }
+            const auto newNodeId = AllocateNodeId();
+            if (newNodeId == 0)
+            {
+                break; // Stop if we can't allocate more IDs
+            }
+            idMapping[copiedNode.originalId] = newNodeId;
+
+            const Widgets::NodePosition position{ pasteWorldPos.x + copiedNode.position.x - centerX,
+                pasteWorldPos.y + copiedNode.position.y - centerY };
+            parts.push_back(std::make_unique<Editor::Commands::CreateNodeCommand>(
+                [this, type = copiedNode.type, name = copiedNode.name, newNodeId]() {
+                    Nodes::NodeArena::Scope scope(nodeEditor.GetNodeArena());
+                    return Vision::NodeFactory::CreateNode(type, newNodeId, name);
+                },
+                [this](std::unique_ptr<Nodes::Node> node) { nodeEditor.AddNode(std::move(node)); },
+                [this](Nodes::NodeId id) {
+                    [[maybe_unused]] bool removed = nodeEditor.RemoveNode(id);
+                    EraseNodePosition(id);
+                },
+                [this](Nodes::NodeId id, const Widgets::NodePosition &pos) { SetNodePosition(id, pos); },
+                position,
+                copiedNode.type));
+        }
+
+        for (const auto &copiedConnection : clipboardManager.GetCopiedConnections())
+        {
+            const auto from = idMapping.find(copiedConnection.fromNodeId);
+            const auto to = idMapping.find(copiedConnection.toNodeId);
+            if (from == idMapping.end() || to == idMapping.end())
+            {
+                continue; // Skip this connection if nodes weren't created
+            }
+
+            parts.push_back(std::make_unique<Editor::Commands::CreateConnectionCommand>(
+                Widgets::PinId{ from->second, copiedConnection.fromSlot },
+                Widgets::PinId{ to->second, copiedConnection.toSlot },
+                [this](const Widgets::PinId &outputPin, const Widgets::PinId &inputPin) {
+                    connectionManager.CreateConnection(outputPin, inputPin, nodeEditor, false);
+                },
+                [this](const Widgets::NodeConnection &conn) { connectionManager.RemoveConnection(conn, nodeEditor); }));
+        }
+
+        if (parts.empty())
+        {
+            return;
+        }
+
+        // One lock, one plan invalidation and one canvas update for the whole paste, undone as one step
+        commandHistory.ExecuteCommand(std::make_unique<Editor::Commands::CompositeCommand>(
+            "Paste Nodes", std::move(parts), [this](const std::function<void()> &body) {
+                Nodes::GraphTransaction transaction(nodeEditor);
+                body();
+            }));
+
+        // Select the newly pasted nodes
+        selectionManager.ClearSelection();
+        for (const auto &[oldId, newId] : idMapping)
+        {
+            selectionManager.ToggleNodeSelection(newId);
+        }
+
+        // After first paste of cut operation, convert to copy
+        if (clipboardManager.GetOperation() == Editor::State::ClipboardOperation::Cut)
+        {
+            clipboardManager.CompleteCutOperation();
+        }
+    }
+
     void NodeEditorLayer::RenderSearchPalette()
     {
         if (!searchPalette.IsOpen())
@@ -722,6 +874,11 @@ namespace VisionCraft::UI::Layers
             CreateNodeAtPosition(selectedNodeType, ImVec2(posX, posY));
             searchPalette.RecordNodeUsage(selectedNodeType);
         }
+        else if (searchPalette.IsOpen())
+        {
+            // Start loading the plugin pack of the highlighted result while the user is still typing
+            Vision::NodePluginLoader::Prefetch(searchPalette.GetHighlightedType());
+        }
     }
 
     ImU32 NodeEditorLayer::GetDataTypeColor(Widgets::PinDataType dataType) const
@@ -748,22 +905,16 @@ namespace VisionCraft::UI::Layers
 
     Nodes::NodeId NodeEditorLayer::FindNodeAtPosition(const ImVec2 &mousePos) const
     {
-        const auto nodeIds = nodeEditor.GetNodeIds();
+        Rendering::FrameScope frameScope(Rendering::FrameSection::HitTesting);
+        const auto worldPos = canvas.ScreenToWorld(mousePos);
+        nodeIndex.Query(worldPos, worldPos, hitNodes);
 
-        for (auto it = nodeIds.rbegin(); it != nodeIds.rend(); ++it)
+        // Nodes are drawn in ascending ID order, so the last hit is on top
+        for (auto it = hitNodes.rbegin(); it != hitNodes.rend(); ++it)
         {
-            const auto nodeId = *it;
-            const auto *node = nodeEditor.GetNode(nodeId);
-
-            if (!node || nodePositions.find(nodeId) == nodePositions.end())
-                continue;
-
-            const auto pins = connectionManager.GetNodePins(node);
-            const auto dimensions = Rendering::NodeRenderer::CalculateNodeDimensions(pins, canvas.GetZoomLevel(), node);
-
-            if (IsMouseOverNode(mousePos, nodePositions.at(nodeId), dimensions.size))
+            if (nodeEditor.GetNode(*it))
             {
-                return nodeId;
+                return *it;
             }
         }
 
@@ -779,15 +930,11 @@ namespace VisionCraft::UI::Layers
         }
         else
         {
-            std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
-            for (const auto &[id, pos] : nodePositions)
-            {
-                positions[id] = { pos.x, pos.y };
-            }
-
-            if (nodeEditor.SaveToFile(currentFilePath, positions))
+            const auto revision = commandHistory.GetRevision();
+            if (nodeEditor.SaveToFile(currentFilePath, GetSavedPositions()))
             {
                 LOG_INFO("Graph saved successfully to: {}", currentFilePath);
+                autosavedRevision = revision;
 
                 Events::FileOpenedEvent fileEvent(currentFilePath);
                 Kappa::Application::Get().GetEventBus().Publish(fileEvent);
@@ -799,6 +946,54 @@ namespace VisionCraft::UI::Layers
         }
     }
 
+    void NodeEditorLayer::UpdateAutosave(float deltaTime)
+    {
+        autosaveElapsed += deltaTime;
+        if (autosaveElapsed < Constants::Autosave::kIntervalSeconds)
+        {
+            return;
+        }
+
+        // Never queue a second autosave behind one that is still writing
+        if (pendingAutosave.valid() && pendingAutosave.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+        autosaveElapsed = 0.0f;
+
+        const auto revision = commandHistory.GetRevision();
+        if (revision == autosavedRevision)
+        {
+            return;
+        }
+        pendingAutosave = nodeEditor.SaveToFileAsync(GetAutosavePath(), GetSavedPositions());
+        autosavedRevision = revision;
+    }
+
+    std::filesystem::path NodeEditorLayer::GetAutosavePath() const
+    {
+        std::filesystem::path path = currentFilePath;
+        if (path.empty())
+        {
+            std::error_code error;
+            path = std::filesystem::temp_directory_path(error) / Constants::Autosave::kUntitledName;
+        }
+        path.replace_extension(
+            std::string(Constants::Autosave::kSuffix) + Constants::Persistence::kBinaryGraphExtension);
+        return path;
+    }
+
+    std::unordered_map<Nodes::NodeId, std::pair<float, float>> NodeEditorLayer::GetSavedPositions() const
+    {
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+        positions.reserve(nodePositions.size());
+        for (const auto &[id, pos] : nodePositions)
+        {
+            positions[id] = { pos.x, pos.y };
+        }
+        return positions;
+    }
+
     void NodeEditorLayer::HandleLoadGraph()
     {
         fileDialogManager.OpenLoadDialog();
@@ -810,22 +1005,17 @@ namespace VisionCraft::UI::Layers
 
         if (nodeEditor.LoadFromFile(filePath, positions))
         {
-            nodePositions.clear();
+            ClearNodePositions();
             for (const auto &[id, pos] : positions)
             {
-                nodePositions[id] = Widgets::NodePosition{ pos.first, pos.second };
+                SetNodePosition(id, Widgets::NodePosition{ pos.first, pos.second });
             }
 
             currentFilePath = filePath;
             selectionManager.ClearSelection();
 
-            Nodes::NodeId maxId = 0;
-            for (const auto &id : nodeEditor.GetNodeIds())
-            {
-                if (id > maxId)
-                    maxId = id;
-            }
-            nextNodeId = maxId + 1;
+            const auto graph = nodeEditor.GetGraphView();
+            nextNodeId = graph->nodeIds.empty() ? 1 : graph->nodeIds.back() + 1; // IDs are ascending
 
             LOG_INFO("Graph loaded successfully from: {}", currentFilePath);
 
@@ -841,7 +1031,7 @@ namespace VisionCraft::UI::Layers
     void NodeEditorLayer::HandleNewGraph()
     {
         nodeEditor.Clear();
-        nodePositions.clear();
+        ClearNodePositions();
         currentFilePath.clear();
         selectionManager.ClearSelection();
         nextNodeId = 1;
@@ -856,15 +1046,11 @@ namespace VisionCraft::UI::Layers
         {
             currentFilePath = result.filepath;
 
-            std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
-            for (const auto &[id, pos] : nodePositions)
-            {
-                positions[id] = { pos.x, pos.y };
-            }
-
-            if (nodeEditor.SaveToFile(currentFilePath, positions))
+            const auto revision = commandHistory.GetRevision();
+            if (nodeEditor.SaveToFile(currentFilePath, GetSavedPositions()))
             {
                 LOG_INFO("Graph saved successfully to: {}", currentFilePath);
+                autosavedRevision = revision;
 
                 Events::FileOpenedEvent fileEvent(currentFilePath);
                 Kappa::Application::Get().GetEventBus().Publish(fileEvent);
@@ -876,6 +1062,70 @@ namespace VisionCraft::UI::Layers
         }
     }
 
+    void NodeEditorLayer::RenderImageInspector()
+    {
+        const auto releaseTexture = [this](Nodes::NodeId nodeId) {
+            VisitImagePreviewNode(nodeEditor.GetNode(nodeId), [](auto &node) { node.ReleaseFullResolutionTexture(); });
+        };
+
+        if (const auto requested = nodeRenderer.TakeInspectorRequest(); requested && *requested != inspectedNodeId)
+        {
+            releaseTexture(inspectedNodeId);
+            inspectedNodeId = *requested;
+        }
+        if (inspectedNodeId == Constants::Special::kInvalidNodeId)
+        {
+            return;
+        }
+
+        auto *node = nodeEditor.GetNode(inspectedNodeId);
+        cv::Mat image;
+        GLuint textureId = 0;
+        if (!VisitImagePreviewNode(node, [&image, &textureId](auto &previewNode) {
+                image = previewNode.GetOutputImage();
+                textureId = image.empty() ? 0 : previewNode.GetFullResolutionTextureId();
+            }))
+        {
+            // Deleted nodes free their textures themselves
+            inspectedNodeId = Constants::Special::kInvalidNodeId;
+            return;
+        }
+
+        bool open = true;
+        ImGui::SetNextWindowSize(
+            ImVec2(Constants::Inspector::kDefaultWidth, Constants::Inspector::kDefaultHeight), ImGuiCond_FirstUseEver);
+        const std::string title = "Inspect: " + node->GetName() + "###ImageInspector";
+        if (ImGui::Begin(title.c_str(), &open, ImGuiWindowFlags_HorizontalScrollbar))
+        {
+            if (textureId == 0)
+            {
+                ImGui::TextUnformatted("No image");
+            }
+            else
+            {
+                ImGui::Text("%dx%d pixels", image.cols, image.rows);
+                ImGui::SameLine();
+                ImGui::Checkbox("Actual size", &inspectorActualSize);
+
+                ImVec2 size(static_cast<float>(image.cols), static_cast<float>(image.rows));
+                if (!inspectorActualSize)
+                {
+                    const ImVec2 available = ImGui::GetContentRegionAvail();
+                    const float scale = std::min(available.x / size.x, available.y / size.y);
+                    size = ImVec2(std::max(1.0f, size.x * scale), std::max(1.0f, size.y * scale));
+                }
+                ImGui::Image(static_cast<ImTextureID>(textureId), size);
+            }
+        }
+        ImGui::End();
+
+        if (!open)
+        {
+            releaseTexture(inspectedNodeId);
+            inspectedNodeId = Constants::Special::kInvalidNodeId;
+        }
+    }
+
     void NodeEditorLayer::RenderLoadDialog()
     {
         const auto result = fileDialogManager.RenderLoadDialog();
@@ -886,23 +1136,18 @@ namespace VisionCraft::UI::Layers
 
             if (nodeEditor.LoadFromFile(result.filepath, positions))
             {
-                nodePositions.clear();
+                ClearNodePositions();
                 for (const auto &[id, pos] : positions)
                 {
-                    nodePositions[id] = Widgets::NodePosition{ pos.first, pos.second };
+                    SetNodePosition(id, Widgets::NodePosition{ pos.first, pos.second });
                 }
 
                 currentFilePath = result.filepath;
                 selectionManager.ClearSelection();
 
-                // Update nextNodeId to be higher than any loaded ID
-                Nodes::NodeId maxId = 0;
-                for (const auto &id : nodeEditor.GetNodeIds())
-                {
-                    if (id > maxId)
-                        maxId = id;
-                }
-                nextNodeId = maxId + 1;
+                // Update nextNodeId to be higher than any loaded ID (view IDs are ascending)
+                const auto graph = nodeEditor.GetGraphView();
+                nextNodeId = graph->nodeIds.empty() ? 1 : graph->nodeIds.back() + 1;
 
                 LOG_INFO("Graph loaded successfully from: {}", currentFilePath);
 
@@ -929,10 +1174,7 @@ namespace VisionCraft::UI::Layers
             selectionManager.RemoveFromSelection(nodeId);
         }
 
-        // Remove connections from UI layer
-        connectionManager.RemoveConnectionsForNode(nodeId);
-
-        // Remove node (also removes connections from core layer)
+        // Remove node (the connection delta also removes its wires from the canvas)
         const bool removed = nodeEditor.RemoveNode(nodeId);
         if (!removed)
         {
@@ -940,7 +1182,7 @@ namespace VisionCraft::UI::Layers
         }
 
         // Remove node position
-        nodePositions.erase(nodeId);
+        EraseNodePosition(nodeId);
     }
 
     void NodeEditorLayer::RenderBoxSelection()
@@ -972,21 +1214,11 @@ namespace VisionCraft::UI::Layers
         const ImVec2 minPos(std::min(start.x, end.x), std::min(start.y, end.y));
         const ImVec2 maxPos(std::max(start.x, end.x), std::max(start.y, end.y));
 
-        // Check each node
-        for (const auto &[nodeId, nodePos] : nodePositions)
+        // Select every node whose bounds overlap the box
+        nodeIndex.Query(canvas.ScreenToWorld(minPos), canvas.ScreenToWorld(maxPos), hitNodes);
+        for (const auto nodeId : hitNodes)
         {
-            const auto screenPos = canvas.WorldToScreen(ImVec2(nodePos.x, nodePos.y));
-            const auto nodeSize = ImVec2(
-                Constants::Node::kWidth * canvas.GetZoomLevel(), Constants::Node::kMinHeight * canvas.GetZoomLevel());
-
-            // Check if node overlaps with selection box
-            const bool overlapsX = screenPos.x < maxPos.x && (screenPos.x + nodeSize.x) > minPos.x;
-            const bool overlapsY = screenPos.y < maxPos.y && (screenPos.y + nodeSize.y) > minPos.y;
-
-            if (overlapsX && overlapsY)
-            {
-                selectionManager.AddToSelection(nodeId);
-            }
+            selectionManager.AddToSelection(nodeId);
         }
     }
 
@@ -6,6 +6,7 @@
 #include "UI/Canvas/CanvasController.h"
 #include "UI/Canvas/ConnectionManager.h"
 #include "UI/Canvas/InputHandler.h"
+#include "UI/Canvas/NodeSpatialIndex.h"
 #include "UI/Rendering/NodeRenderer.h"
 #include "UI/Widgets/ContextMenuRenderer.h"
 #include "UI/Widgets/FileDialogManager.h"
@@ -15,9 +16,13 @@
 #include "Nodes/Core/NodeEditor.h"
 #include "Vision/Factory/NodeFactory.h"
 
+#include <cstdint>
+#include <filesystem>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <imgui.h>
 
@@ -36,9 +41,9 @@ namespace VisionCraft::UI::Layers
         explicit NodeEditorLayer(Nodes::NodeEditor &nodeEditor);
 
         /**
-         * @brief Virtual destructor.
+         * @brief Destructor that stops mirroring the node editor's connections.
          */
-        virtual ~NodeEditorLayer() = default;
+        virtual ~NodeEditorLayer();
 
         /**
          * @brief Handles input events.
@@ -59,7 +64,13 @@ namespace VisionCraft::UI::Layers
 
     private:
         /**
-         * @brief Renders all nodes.
+         * @brief Renders the cost heatmap mode selector above the canvas and reloads the overlay's costs.
+         */
+        void RenderCostOverlayControls();
+
+        /**
+         * @brief Renders the nodes overlapping the visible canvas area.
+         * @note Nodes are culled through nodeIndex; sizes are refreshed as nodes are drawn.
          */
         void RenderNodes();
 
@@ -67,18 +78,33 @@ namespace VisionCraft::UI::Layers
          * @brief Renders single node.
          * @param node Nodes::Node to render
          * @param nodePos Nodes::Node position
+         * @return Rendered node size in screen pixels
          */
-        void RenderNode(Nodes::Node *node, const Widgets::NodePosition &nodePos);
+        ImVec2 RenderNode(Nodes::Node *node, const Widgets::NodePosition &nodePos);
 
         /**
-         * @brief Checks if mouse is over node.
-         * @param mousePos Mouse position
-         * @param nodePos Nodes::Node position
-         * @param nodeSize Nodes::Node size
-         * @return True if over node
+         * @brief Sets the position of a node and keeps the spatial index in sync.
+         * @param nodeId Nodes::Node ID
+         * @param pos New world position
          */
-        [[nodiscard]] bool
-            IsMouseOverNode(const ImVec2 &mousePos, const Widgets::NodePosition &nodePos, const ImVec2 &nodeSize) const;
+        void SetNodePosition(Nodes::NodeId nodeId, const Widgets::NodePosition &pos);
+
+        /**
+         * @brief Forgets the position of a node and removes it from the spatial index.
+         * @param nodeId Nodes::Node ID
+         */
+        void EraseNodePosition(Nodes::NodeId nodeId);
+
+        /**
+         * @brief Forgets all node positions.
+         */
+        void ClearNodePositions();
+
+        /**
+         * @brief Indexes nodes added since the last frame at their real size.
+         * @note A new node's size is measured once at zoom 1, so it is found even if it starts off-screen.
+         */
+        void MeasurePendingNodes();
 
         /**
          * @brief Handles mouse interactions.
@@ -97,7 +123,7 @@ namespace VisionCraft::UI::Layers
          * @return Pin interaction state
          */
         [[nodiscard]] Rendering::PinInteractionState GetPinInteractionState(Nodes::NodeId nodeId,
-            const std::string &pinName) const;
+            Nodes::SlotName pinName) const;
 
         /**
          * @brief Renders pin with label.
@@ -132,6 +158,12 @@ namespace VisionCraft::UI::Layers
          */
         void CreateNodeAtPosition(const std::string &nodeType, const ImVec2 &position);
 
+        /**
+         * @brief Pastes the clipboard as one undoable step, applied in a single graph transaction.
+         * @param screenPosition Screen position the pasted nodes are centered on
+         */
+        void PasteClipboard(const ImVec2 &screenPosition);
+
         /**
          * @brief Deletes a node.
          * @param nodeId Nodes::Node ID to delete
@@ -146,7 +178,7 @@ namespace VisionCraft::UI::Layers
         [[nodiscard]] ImU32 GetDataTypeColor(Widgets::PinDataType dataType) const;
 
         /**
-         * @brief Finds node at position.
+         * @brief Finds the topmost node at position through the spatial index.
          * @param mousePos Mouse position
          * @return Nodes::Node ID or -1
          */
@@ -175,6 +207,25 @@ namespace VisionCraft::UI::Layers
          */
         void HandleSaveGraph();
 
+        /**
+         * @brief Saves a changed graph to its autosave file every Constants::Autosave::kIntervalSeconds.
+         * @param deltaTime Time since last update
+         * @note Only the snapshot is taken on the UI thread; serializing and writing run in the background.
+         */
+        void UpdateAutosave(float deltaTime);
+
+        /**
+         * @brief Returns where the current graph is autosaved.
+         * @return Binary graph next to the document, or in the temp directory for an unsaved graph
+         */
+        [[nodiscard]] std::filesystem::path GetAutosavePath() const;
+
+        /**
+         * @brief Converts node positions to the form NodeEditor saves.
+         * @return Positions (x, y) of every node
+         */
+        [[nodiscard]] std::unordered_map<Nodes::NodeId, std::pair<float, float>> GetSavedPositions() const;
+
         /**
          * @brief Handles load graph event (opens file dialog).
          */
@@ -201,6 +252,12 @@ namespace VisionCraft::UI::Layers
          */
         void RenderLoadDialog();
 
+        /**
+         * @brief Renders the full-resolution image of the inspected node in its own window.
+         * @note Frees the node's full-resolution texture when the window is closed or another node is inspected.
+         */
+        void RenderImageInspector();
+
         /**
          * @brief Converts node class type to factory registration key.
          * @param nodeType Nodes::Node class type (e.g., "GrayscaleNode")
@@ -229,6 +286,14 @@ namespace VisionCraft::UI::Layers
         std::unordered_map<Nodes::NodeId, Widgets::NodePosition> nodePositions; ///< Visual positions of nodes
         Nodes::NodeId nextNodeId = 1;                                           ///< Next available node ID
 
+        // Culling state (positions are written through SetNodePosition/EraseNodePosition only)
+        Canvas::NodeSpatialIndex nodeIndex;                 ///< World-space node bounds for culling
+        std::unordered_set<Nodes::NodeId> unmeasuredNodes; ///< Nodes indexed with a placeholder size
+        std::vector<Nodes::NodeId> visibleNodes;            ///< Nodes drawn this frame (reused between frames)
+        std::vector<Nodes::NodeId> visiblePreviews;         ///< Preview nodes drawn this frame, sorted
+        std::vector<Nodes::NodeId> scheduledPreviews;       ///< Previews last passed to SetVisibleNodes()
+        mutable std::vector<Nodes::NodeId> hitNodes;        ///< Nodes under the mouse or box (reused between queries)
+
         // Pin interaction state
         Widgets::PinId hoveredPin = { Constants::Special::kInvalidNodeId, "" }; ///< Currently hovered pin
 
@@ -236,6 +301,13 @@ namespace VisionCraft::UI::Layers
         std::optional<Widgets::NodeConnection> hoveredConnection = std::nullopt; ///< Currently hovered connection
 
         // File management state
-        std::string currentFilePath; ///< Current file path
+        std::string currentFilePath;              ///< Current file path
+        float autosaveElapsed = 0.0f;             ///< Seconds since the last autosave check
+        uint64_t autosavedRevision = 0;           ///< Command history revision last saved
+        std::shared_future<bool> pendingAutosave; ///< Autosave being written, if any
+
+        // Image inspector state
+        Nodes::NodeId inspectedNodeId = Constants::Special::kInvalidNodeId; ///< Node shown in the inspector
+        bool inspectorActualSize = false; ///< Inspector shows one image pixel per screen pixel instead of fitting
     };
 } // namespace VisionCraft::UI::Layers
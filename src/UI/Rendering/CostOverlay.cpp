@@ -0,0 +1,152 @@
+#include "UI/Rendering/CostOverlay.h"
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <algorithm>
+
+namespace VisionCraft::UI::Rendering
+{
+    void CostOverlay::Refresh(const Nodes::NodeEditor &editor)
+    {
+        if (mode == CostOverlayMode::Off)
+        {
+            return;
+        }
+
+        const auto &statistics = editor.GetExecutionStatistics();
+        const uint64_t runCount = statistics.GetRunCount();
+        const uint64_t graphVersion = editor.GetGraphVersion();
+        if (runCount == loadedRunCount && graphVersion == loadedGraphVersion)
+        {
+            return;
+        }
+
+        loadedRunCount = runCount;
+        loadedGraphVersion = graphVersion;
+        const auto latest = statistics.GetLatest();
+        if (!latest)
+        {
+            costs.clear();
+            return;
+        }
+        Update(statistics.SummarizeNodes(), *latest, editor.GetGraphView()->Connections());
+    }
+
+    void CostOverlay::Update(std::span<const Nodes::NodeTimingSummary> summaries,
+        const Nodes::RunStatistics &latest,
+        std::span<const Nodes::Connection> connections)
+    {
+        costs.clear();
+
+        int64_t totalTime = 0;
+        size_t totalBytes = 0;
+        int64_t maxTime = 0;
+        size_t maxBytes = 0;
+        for (const auto &record : latest.nodes)
+        {
+            auto &cost = costs[record.nodeId];
+            cost.lastTime = record.duration;
+            cost.outputBytes = record.outputBytes;
+            totalTime += record.duration.count();
+            totalBytes += record.outputBytes;
+            maxTime = std::max<int64_t>(maxTime, record.duration.count());
+            maxBytes = std::max(maxBytes, record.outputBytes);
+        }
+
+        for (auto &[nodeId, cost] : costs)
+        {
+            const auto time = static_cast<float>(cost.lastTime.count());
+            const auto bytes = static_cast<float>(cost.outputBytes);
+            cost.timeShare = totalTime > 0 ? time / static_cast<float>(totalTime) : 0.0f;
+            cost.memoryShare = totalBytes > 0 ? bytes / static_cast<float>(totalBytes) : 0.0f;
+            cost.timeHeat = maxTime > 0 ? time / static_cast<float>(maxTime) : 0.0f;
+            cost.memoryHeat = maxBytes > 0 ? bytes / static_cast<float>(maxBytes) : 0.0f;
+        }
+
+        for (const auto &summary : summaries)
+        {
+            if (const auto it = costs.find(summary.nodeId); it != costs.end())
+            {
+                it->second.medianTime = summary.medianTime;
+            }
+        }
+
+        for (const auto nodeId : FindCriticalPath(latest, connections))
+        {
+            costs[nodeId].onCriticalPath = true;
+        }
+    }
+
+    const NodeCost *CostOverlay::Find(Nodes::NodeId nodeId) const
+    {
+        if (mode == CostOverlayMode::Off)
+        {
+            return nullptr;
+        }
+        const auto it = costs.find(nodeId);
+        return it != costs.end() ? &it->second : nullptr;
+    }
+
+    ImU32 CostOverlay::Tint(ImU32 base, float heat)
+    {
+        const float t = std::clamp(heat, 0.0f, 1.0f) * Constants::CostOverlay::kMaxTint;
+        const auto blend = [base, t](int shift) {
+            const auto from = static_cast<float>((base >> shift) & 0xFF);
+            const auto to = static_cast<float>((Constants::Colors::CostOverlay::kHot >> shift) & 0xFF);
+            return static_cast<ImU32>(from + (to - from) * t + 0.5f) << shift;
+        };
+        return blend(IM_COL32_R_SHIFT) | blend(IM_COL32_G_SHIFT) | blend(IM_COL32_B_SHIFT)
+               | (base & IM_COL32_A_MASK);
+    }
+
+    std::vector<Nodes::NodeId> CostOverlay::FindCriticalPath(const Nodes::RunStatistics &run,
+        std::span<const Nodes::Connection> connections)
+    {
+        // Steps are recorded in plan order, which is topological, so one pass in that order settles
+        // the longest chain ending at each step
+        std::unordered_map<Nodes::NodeId, size_t> stepIndex;
+        for (size_t i = 0; i < run.nodes.size(); ++i)
+        {
+            stepIndex.emplace(run.nodes[i].nodeId, i);
+        }
+
+        std::vector<std::vector<size_t>> predecessors(run.nodes.size());
+        for (const auto &connection : connections)
+        {
+            const auto from = stepIndex.find(connection.from);
+            const auto to = stepIndex.find(connection.to);
+            if (from != stepIndex.end() && to != stepIndex.end() && from->second < to->second)
+            {
+                predecessors[to->second].push_back(from->second);
+            }
+        }
+
+        constexpr size_t kNone = static_cast<size_t>(-1);
+        std::vector<int64_t> finish(run.nodes.size(), 0);
+        std::vector<size_t> previous(run.nodes.size(), kNone);
+        size_t last = kNone;
+        for (size_t i = 0; i < run.nodes.size(); ++i)
+        {
+            for (const auto p : predecessors[i])
+            {
+                if (finish[p] > finish[i])
+                {
+                    finish[i] = finish[p];
+                    previous[i] = p;
+                }
+            }
+            finish[i] += run.nodes[i].duration.count();
+            if (finish[i] > 0 && (last == kNone || finish[i] > finish[last]))
+            {
+                last = i;
+            }
+        }
+
+        std::vector<Nodes::NodeId> path;
+        for (size_t i = last; i != kNone; i = previous[i])
+        {
+            path.push_back(run.nodes[i].nodeId);
+        }
+        std::ranges::reverse(path);
+        return path;
+    }
+} // namespace VisionCraft::UI::Rendering
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Nodes/Core/ExecutionStatistics.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <imgui.h>
+
+namespace VisionCraft::UI::Rendering
+{
+    /**
+     * @brief What the cost overlay tints nodes by.
+     */
+    enum class CostOverlayMode
+    {
+        Off,    ///< Nodes drawn normally
+        Time,   ///< Share of the latest run's processing time
+        Memory  ///< Share of the latest run's output slot bytes
+    };
+
+    /**
+     * @brief Cost of one node in the latest run, as drawn by the overlay.
+     */
+    struct NodeCost
+    {
+        std::chrono::microseconds lastTime{ 0 };   ///< Process() time in the latest run
+        std::chrono::microseconds medianTime{ 0 }; ///< Median over retained runs in which Process() ran
+        size_t outputBytes = 0;                    ///< Output slot bytes in the latest run
+        float timeShare = 0.0f;                    ///< Fraction of the summed step times of the latest run
+        float memoryShare = 0.0f;                  ///< Fraction of the summed output bytes of the latest run
+        float timeHeat = 0.0f;                     ///< Time relative to the slowest node (1 = slowest)
+        float memoryHeat = 0.0f;                   ///< Bytes relative to the largest node (1 = largest)
+        bool onCriticalPath = false;               ///< On the longest chain of step times through the graph
+    };
+
+    /**
+     * @brief Per-node costs of the latest run, for tinting nodes on the canvas.
+     *
+     * Costs are rebuilt from NodeEditor::GetExecutionStatistics() only when a run was recorded or the
+     * graph changed, so Refresh() can run every frame. Heat is relative to the costliest node, so the
+     * node that dominates a run always glows fully whatever the absolute times.
+     */
+    class CostOverlay
+    {
+    public:
+        /**
+         * @brief Sets what nodes are tinted by.
+         * @param overlayMode Overlay mode (Off hides the overlay)
+         */
+        void SetMode(CostOverlayMode overlayMode)
+        {
+            mode = overlayMode;
+        }
+
+        /**
+         * @brief Returns what nodes are tinted by.
+         * @return Overlay mode
+         */
+        [[nodiscard]] CostOverlayMode GetMode() const
+        {
+            return mode;
+        }
+
+        /**
+         * @brief Reloads costs if a run was recorded or the graph changed since the last load.
+         * @param editor Editor whose statistics and connections are read
+         * @note Does nothing while the overlay is off.
+         */
+        void Refresh(const Nodes::NodeEditor &editor);
+
+        /**
+         * @brief Rebuilds costs from statistics.
+         * @param summaries Per-node summaries over the retained runs
+         * @param latest Latest run (shares and the critical path come from it)
+         * @param connections Graph connections
+         */
+        void Update(std::span<const Nodes::NodeTimingSummary> summaries,
+            const Nodes::RunStatistics &latest,
+            std::span<const Nodes::Connection> connections);
+
+        /**
+         * @brief Returns the cost of a node.
+         * @param nodeId Node ID
+         * @return Cost, or nullptr if the overlay is off or the node was not in the latest run
+         */
+        [[nodiscard]] const NodeCost *Find(Nodes::NodeId nodeId) const;
+
+        /**
+         * @brief Returns the heat of a node in the current mode.
+         * @param cost Node cost
+         * @return 0 (cheapest) to 1 (costliest)
+         */
+        [[nodiscard]] float Heat(const NodeCost &cost) const
+        {
+            return mode == CostOverlayMode::Memory ? cost.memoryHeat : cost.timeHeat;
+        }
+
+        /**
+         * @brief Blends a node color toward the overlay's hot color.
+         * @param base Color of a cold node
+         * @param heat 0 (keeps base) to 1 (hottest tint)
+         * @return Tinted color
+         */
+        [[nodiscard]] static ImU32 Tint(ImU32 base, float heat);
+
+        /**
+         * @brief Finds the chain of connected steps with the largest summed time (the run's critical path).
+         * @param run Run whose step times and plan order are used
+         * @param connections Graph connections (edges between nodes outside the run are ignored)
+         * @return Node IDs from the first to the last step of the path; empty if no step took time
+         */
+        [[nodiscard]] static std::vector<Nodes::NodeId> FindCriticalPath(const Nodes::RunStatistics &run,
+            std::span<const Nodes::Connection> connections);
+
+    private:
+        CostOverlayMode mode = CostOverlayMode::Off;       ///< What nodes are tinted by
+        std::unordered_map<Nodes::NodeId, NodeCost> costs; ///< Nodes of the latest run
+        uint64_t loadedRunCount = 0;                       ///< Statistics run count costs were built at
+        uint64_t loadedGraphVersion = 0;                   ///< Graph version costs were built at
+    };
+} // namespace VisionCraft::UI::Rendering
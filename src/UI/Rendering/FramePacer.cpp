@@ -0,0 +1,106 @@
+#include "UI/Rendering/FramePacer.h"
+
+#include <utility>
+
+namespace VisionCraft::UI::Rendering
+{
+    FramePacer &FramePacer::Get()
+    {
+        static FramePacer instance;
+        return instance;
+    }
+
+    void FramePacer::SetPlatform(Platform hooks)
+    {
+        platform = std::move(hooks);
+    }
+
+    void FramePacer::SetIdleWait(bool enabled)
+    {
+        idleWait = enabled;
+    }
+
+    bool FramePacer::IsIdleWait() const
+    {
+        return idleWait;
+    }
+
+    void FramePacer::SetMaxBusyFps(int fps)
+    {
+        maxBusyFps = fps > 0 ? fps : 0;
+    }
+
+    int FramePacer::GetMaxBusyFps() const
+    {
+        return maxBusyFps;
+    }
+
+    void FramePacer::SetBusy(bool isBusy)
+    {
+        busy = isBusy;
+    }
+
+    void FramePacer::RequestFrames(int frames)
+    {
+        int pending = pendingFrames.load(std::memory_order_acquire);
+        while (pending < frames && !pendingFrames.compare_exchange_weak(pending, frames, std::memory_order_acq_rel))
+        {
+        }
+    }
+
+    void FramePacer::Wake()
+    {
+        RequestFrames(Constants::FramePacing::kFramesPerWake);
+        if (platform.wake)
+        {
+            platform.wake();
+        }
+    }
+
+    void FramePacer::WaitForNextFrame()
+    {
+        if (platform.wait && idleWait && pendingFrames.load(std::memory_order_acquire) == 0)
+        {
+            // Nothing owed: sleep until input or a Wake(). A Wake() racing this check still posts its event,
+            // so the wait returns at once
+            const auto waitStart = Clock::now();
+            platform.wait(Constants::FramePacing::kIdleTimeoutSeconds);
+
+            // Returning early means an event arrived; a timeout only redraws this one frame
+            const std::chrono::duration<double> waited = Clock::now() - waitStart;
+            if (waited.count() < Constants::FramePacing::kIdleTimeoutSeconds)
+            {
+                RequestFrames(Constants::FramePacing::kFramesPerWake);
+            }
+        }
+
+        if (platform.wait && busy)
+        {
+            ThrottleBusyFrame();
+        }
+
+        // Take this frame from the owed ones; a concurrent Wake() raising the count keeps its request
+        int pending = pendingFrames.load(std::memory_order_acquire);
+        while (pending > 0
+               && !pendingFrames.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+        {
+        }
+        lastFrame = Clock::now();
+    }
+
+    void FramePacer::ThrottleBusyFrame()
+    {
+        if (maxBusyFps == 0)
+        {
+            return;
+        }
+
+        // Events arriving meanwhile are queued for the next frame, so wakes cannot shorten the interval
+        const auto interval = std::chrono::duration<double>(1.0 / maxBusyFps);
+        const auto nextFrame = lastFrame + std::chrono::duration_cast<Clock::duration>(interval);
+        for (auto now = Clock::now(); now < nextFrame; now = Clock::now())
+        {
+            platform.wait(std::chrono::duration<double>(nextFrame - now).count());
+        }
+    }
+} // namespace VisionCraft::UI::Rendering
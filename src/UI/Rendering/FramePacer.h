@@ -0,0 +1,119 @@
+#pragma once
+
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+namespace VisionCraft::UI::Rendering
+{
+    /**
+     * @brief Decides when the editor draws its next frame, so an idle editor sleeps instead of redrawing.
+     *
+     * With idle waiting on, the main loop blocks in WaitForNextFrame() until input arrives or a thread calls
+     * Wake() (execution progress, a finished run). Each wake is followed by a few frames so ImGui settles
+     * hover and click state; RequestFrames() asks for more while something animates, such as a background
+     * decode or an active widget. While busy (a run in progress) frames are additionally spaced to at most
+     * the configured rate, and a wait is bounded by the idle timeout so timers such as tooltips still fire.
+     *
+     * The pacer knows nothing about the window system: the application supplies the blocking wait and the
+     * cross-thread wake (glfwWaitEventsTimeout() and glfwPostEmptyEvent()).
+     *
+     * Wake() and RequestFrames() are thread-safe; everything else belongs to the main thread.
+     */
+    class FramePacer
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Window system hooks.
+         */
+        struct Platform
+        {
+            std::function<void(double timeoutSeconds)> wait; ///< Blocks until an event or the timeout passes
+            std::function<void()> wake;                      ///< Interrupts wait() from any thread
+        };
+
+        /**
+         * @brief Returns the pacer of the editor's main loop.
+         * @return Pacer instance
+         */
+        [[nodiscard]] static FramePacer &Get();
+
+        /**
+         * @brief Sets the window system hooks (without them the pacer never waits).
+         * @param hooks Wait and wake functions
+         */
+        void SetPlatform(Platform hooks);
+
+        /**
+         * @brief Enables blocking between frames while nothing changes.
+         * @param enabled False redraws continuously, as without a pacer
+         */
+        void SetIdleWait(bool enabled);
+
+        /**
+         * @brief Checks if idle waiting is enabled.
+         * @return True if the loop sleeps while idle
+         */
+        [[nodiscard]] bool IsIdleWait() const;
+
+        /**
+         * @brief Limits the frame rate while busy.
+         * @param fps Frames per second (0 = unlimited)
+         */
+        void SetMaxBusyFps(int fps);
+
+        /**
+         * @brief Returns the frame rate limit while busy.
+         * @return Frames per second (0 = unlimited)
+         */
+        [[nodiscard]] int GetMaxBusyFps() const;
+
+        /**
+         * @brief Marks work in progress whose frames are rate-limited (a graph run or batch).
+         * @param isBusy True while the work runs
+         */
+        void SetBusy(bool isBusy);
+
+        /**
+         * @brief Asks for frames to be drawn without waiting for an event.
+         * @param frames Frames owed from now (never lowers frames already requested)
+         */
+        void RequestFrames(int frames = 1);
+
+        /**
+         * @brief Requests frames and interrupts a waiting main loop; call from any thread.
+         */
+        void Wake();
+
+        /**
+         * @brief Blocks until the next frame is due (call once per frame, before starting it).
+         */
+        void WaitForNextFrame();
+
+        /**
+         * @brief Returns frames still owed before the loop waits again.
+         * @return Pending frame count
+         */
+        [[nodiscard]] int GetPendingFrames() const
+        {
+            return pendingFrames.load(std::memory_order_acquire);
+        }
+
+    private:
+        /**
+         * @brief Waits until the busy frame interval since the last frame has passed.
+         */
+        void ThrottleBusyFrame();
+
+        Platform platform;                                                        ///< Window system hooks
+        bool idleWait = true;                                                     ///< Sleep while nothing changes
+        bool busy = false;                                                        ///< Work in progress (rate-limited)
+        int maxBusyFps = Constants::FramePacing::kDefaultMaxBusyFps;              ///< Busy frame rate limit (0 = none)
+        Clock::time_point lastFrame{};                                            ///< Start of the previous frame
+        std::atomic<int> pendingFrames{ Constants::FramePacing::kFramesPerWake }; ///< Frames owed without an event
+    };
+} // namespace VisionCraft::UI::Rendering
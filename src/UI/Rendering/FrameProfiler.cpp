@@ -0,0 +1,291 @@
+#include "UI/Rendering/FrameProfiler.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <imgui.h>
+
+namespace VisionCraft::UI::Rendering
+{
+    namespace
+    {
+        constexpr const char *kSectionNames[kFrameSectionCount] = {
+            "Editor render", "Render nodes", "Render connections", "Detect hovered pin", "Hit testing", "Texture upload"
+        };
+
+        float ToMilliseconds(std::chrono::microseconds time)
+        {
+            return static_cast<float>(time.count()) / 1000.0f;
+        }
+
+        // Summarizes the frames for which value() returns a time; frames without one are skipped
+        template<typename Projection>
+        FrameStatistic Summarize(const std::deque<FrameSample> &history, Projection value)
+        {
+            FrameStatistic statistic;
+            std::chrono::microseconds total{ 0 };
+            size_t count = 0;
+            for (const auto &sample : history)
+            {
+                const std::optional<std::chrono::microseconds> time = value(sample);
+                if (!time.has_value())
+                {
+                    continue;
+                }
+                statistic.last = *time;
+                statistic.max = std::max(statistic.max, *time);
+                total += *time;
+                ++count;
+            }
+            if (count > 0)
+            {
+                statistic.average = total / static_cast<int64_t>(count);
+            }
+            return statistic;
+        }
+
+        void PlotSeries(const char *label, const std::vector<float> &values, const std::string &overlay)
+        {
+            ImGui::PlotLines(label,
+                values.data(),
+                static_cast<int>(values.size()),
+                0,
+                overlay.c_str(),
+                0.0f,
+                FLT_MAX,
+                ImVec2(-1.0f, Constants::FrameProfiler::kGraphHeight));
+        }
+
+        std::string FormatStatistic(const char *name, const FrameStatistic &statistic)
+        {
+            char buffer[128];
+            std::snprintf(buffer,
+                sizeof(buffer),
+                "%s %.2f ms (avg %.2f, max %.2f)",
+                name,
+                ToMilliseconds(statistic.last),
+                ToMilliseconds(statistic.average),
+                ToMilliseconds(statistic.max));
+            return buffer;
+        }
+    } // namespace
+
+    const char *GetFrameSectionName(FrameSection section)
+    {
+        const auto index = static_cast<size_t>(section);
+        return index < kFrameSectionCount ? kSectionNames[index] : "Unknown";
+    }
+
+    FrameProfiler &FrameProfiler::Get()
+    {
+        static FrameProfiler instance;
+        return instance;
+    }
+
+    void FrameProfiler::SetEnabled(bool isEnabled)
+    {
+        if (isEnabled && !enabled)
+        {
+            history.clear();
+        }
+        enabled = isEnabled;
+        inFrame = false;
+    }
+
+    void FrameProfiler::BeginFrame()
+    {
+        if (!enabled)
+        {
+            return;
+        }
+
+        const uint64_t frame = current.frame;
+        current = FrameSample{};
+        current.frame = frame;
+        frameStart = Clock::now();
+        inFrame = true;
+    }
+
+    void FrameProfiler::AddSectionTime(FrameSection section, Clock::duration duration)
+    {
+        const auto index = static_cast<size_t>(section);
+        if (!inFrame || index >= kFrameSectionCount)
+        {
+            return;
+        }
+        current.sections[index] += std::chrono::duration_cast<std::chrono::microseconds>(duration);
+        ++current.calls[index];
+    }
+
+    void FrameProfiler::EndFrame(const DrawStats &draw)
+    {
+        if (!inFrame)
+        {
+            return;
+        }
+        inFrame = false;
+
+        current.cpuTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - frameStart);
+        current.draw = draw;
+        history.push_back(current);
+        while (history.size() > Constants::FrameProfiler::kHistoryFrames)
+        {
+            history.pop_front();
+        }
+        ++current.frame;
+    }
+
+    void FrameProfiler::RecordGpuTime(uint64_t frame, std::chrono::microseconds gpuTime)
+    {
+        // Frame numbers are consecutive, so the sample sits at a known offset from the oldest one
+        if (history.empty() || frame < history.front().frame)
+        {
+            return;
+        }
+        const auto offset = static_cast<size_t>(frame - history.front().frame);
+        if (offset < history.size() && history[offset].frame == frame)
+        {
+            history[offset].gpuTime = gpuTime;
+        }
+    }
+
+    FrameStatistic FrameProfiler::GetCpuStatistic() const
+    {
+        return Summarize(history, [](const FrameSample &sample) {
+            return std::optional<std::chrono::microseconds>(sample.cpuTime);
+        });
+    }
+
+    FrameStatistic FrameProfiler::GetGpuStatistic() const
+    {
+        return Summarize(history, [](const FrameSample &sample) { return sample.gpuTime; });
+    }
+
+    FrameStatistic FrameProfiler::GetSectionStatistic(FrameSection section) const
+    {
+        const auto index = std::min(static_cast<size_t>(section), kFrameSectionCount - 1);
+        return Summarize(history, [index](const FrameSample &sample) {
+            return std::optional<std::chrono::microseconds>(sample.sections[index]);
+        });
+    }
+
+    DrawStats FrameProfiler::MeasureDrawData()
+    {
+        DrawStats stats;
+        for (const auto *viewport : ImGui::GetPlatformIO().Viewports)
+        {
+            const ImDrawData *drawData = viewport->DrawData;
+            if (!drawData || !drawData->Valid)
+            {
+                continue;
+            }
+            stats.vertices += static_cast<size_t>(drawData->TotalVtxCount);
+            stats.indices += static_cast<size_t>(drawData->TotalIdxCount);
+            stats.drawLists += static_cast<size_t>(drawData->CmdListsCount);
+            for (int list = 0; list < drawData->CmdListsCount; ++list)
+            {
+                stats.commands += static_cast<size_t>(drawData->CmdLists[list]->CmdBuffer.Size);
+            }
+        }
+        return stats;
+    }
+
+    void FrameProfiler::RenderOverlay()
+    {
+        if (!enabled)
+        {
+            return;
+        }
+
+        ImGui::SetNextWindowSize(
+            ImVec2(Constants::FrameProfiler::kWindowWidth, Constants::FrameProfiler::kWindowHeight),
+            ImGuiCond_FirstUseEver);
+        bool open = true;
+        if (ImGui::Begin("Frame Profiler", &open))
+        {
+            std::vector<float> cpuValues;
+            std::vector<float> gpuValues;
+            std::vector<float> vertexValues;
+            cpuValues.reserve(history.size());
+            gpuValues.reserve(history.size());
+            vertexValues.reserve(history.size());
+            for (const auto &sample : history)
+            {
+                cpuValues.push_back(ToMilliseconds(sample.cpuTime));
+                // Frames still waiting for their query plot as zero at the right edge
+                gpuValues.push_back(sample.gpuTime ? ToMilliseconds(*sample.gpuTime) : 0.0f);
+                vertexValues.push_back(static_cast<float>(sample.draw.vertices));
+            }
+
+            PlotSeries("##CpuFrameTime", cpuValues, FormatStatistic("CPU", GetCpuStatistic()));
+            const bool hasGpuTime = std::any_of(
+                history.begin(), history.end(), [](const auto &sample) { return sample.gpuTime.has_value(); });
+            if (hasGpuTime)
+            {
+                PlotSeries("##GpuFrameTime", gpuValues, FormatStatistic("GPU", GetGpuStatistic()));
+            }
+            else
+            {
+                ImGui::TextDisabled("GPU: no timer results (queries unsupported or pending)");
+            }
+
+            const DrawStats draw = history.empty() ? DrawStats{} : history.back().draw;
+            PlotSeries("##Vertices", vertexValues, std::to_string(draw.vertices) + " vertices");
+            ImGui::Text("Indices %zu   Draw lists %zu   Draw calls %zu", draw.indices, draw.drawLists, draw.commands);
+
+            constexpr ImGuiTableFlags kTableFlags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+            if (ImGui::BeginTable("FrameSections", 5, kTableFlags))
+            {
+                ImGui::TableSetupColumn("Section (ms)");
+                ImGui::TableSetupColumn("Last");
+                ImGui::TableSetupColumn("Avg");
+                ImGui::TableSetupColumn("Max");
+                ImGui::TableSetupColumn("Calls");
+                ImGui::TableHeadersRow();
+                for (size_t index = 0; index < kFrameSectionCount; ++index)
+                {
+                    const auto section = static_cast<FrameSection>(index);
+                    const auto statistic = GetSectionStatistic(section);
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(GetFrameSectionName(section));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", ToMilliseconds(statistic.last));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", ToMilliseconds(statistic.average));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", ToMilliseconds(statistic.max));
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", history.empty() ? 0u : history.back().calls[index]);
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TextDisabled("Section times include nested sections; the table covers %zu frames", history.size());
+        }
+        ImGui::End();
+
+        if (!open)
+        {
+            SetEnabled(false);
+        }
+    }
+
+    FrameScope::FrameScope(FrameSection section) : section(section)
+    {
+        if (FrameProfiler::Get().IsEnabled())
+        {
+            start = FrameProfiler::Clock::now();
+        }
+    }
+
+    FrameScope::~FrameScope()
+    {
+        if (start.has_value())
+        {
+            FrameProfiler::Get().AddSectionTime(section, FrameProfiler::Clock::now() - *start);
+        }
+    }
+} // namespace VisionCraft::UI::Rendering
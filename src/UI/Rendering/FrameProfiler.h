@@ -0,0 +1,210 @@
+#pragma once
+
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace VisionCraft::UI::Rendering
+{
+    /**
+     * @brief Editor code paths timed by FrameScope.
+     */
+    enum class FrameSection : uint8_t
+    {
+        EditorRender,      ///< NodeEditorLayer::OnRender()
+        RenderNodes,       ///< NodeEditorLayer::RenderNodes()
+        RenderConnections, ///< ConnectionManager::RenderConnections()
+        DetectHoveredPin,  ///< NodeEditorLayer::DetectHoveredPin()
+        HitTesting,        ///< Node, pin and wire lookups under the mouse
+        TextureUpload,     ///< Image and preview texture uploads
+        Count
+    };
+
+    inline constexpr size_t kFrameSectionCount = static_cast<size_t>(FrameSection::Count);
+
+    /**
+     * @brief Returns the display name of a section.
+     * @param section Section to name
+     * @return Name as shown in the overlay
+     */
+    [[nodiscard]] const char *GetFrameSectionName(FrameSection section);
+
+    /**
+     * @brief Geometry ImGui submitted for one frame, summed over all viewports.
+     */
+    struct DrawStats
+    {
+        size_t vertices = 0;  ///< Vertex buffer entries
+        size_t indices = 0;   ///< Index buffer entries
+        size_t drawLists = 0; ///< Command lists (one per window layer)
+        size_t commands = 0;  ///< Draw calls
+    };
+
+    /**
+     * @brief Timings and geometry of one recorded frame.
+     */
+    struct FrameSample
+    {
+        uint64_t frame = 0;                                                   ///< Frame number (see GetCurrentFrame())
+        std::chrono::microseconds cpuTime{ 0 };                               ///< BeginFrame() to EndFrame()
+        std::optional<std::chrono::microseconds> gpuTime;                     ///< GPU time, once its query resolved
+        std::array<std::chrono::microseconds, kFrameSectionCount> sections{}; ///< Time inside each section
+        std::array<uint32_t, kFrameSectionCount> calls{};                     ///< Scopes entered per section
+        DrawStats draw;                                                       ///< Submitted geometry
+    };
+
+    /**
+     * @brief Latest, mean and worst value of one series over the history.
+     */
+    struct FrameStatistic
+    {
+        std::chrono::microseconds last{ 0 };    ///< Most recent frame
+        std::chrono::microseconds average{ 0 }; ///< Mean over frames with a value
+        std::chrono::microseconds max{ 0 };     ///< Slowest frame
+    };
+
+    /**
+     * @brief Records CPU section timers, GPU frame time and draw-list sizes of recent editor frames.
+     *
+     * The application brackets each frame with BeginFrame() and EndFrame(); FrameScope objects placed in hot
+     * UI paths add their time to the frame in progress. GPU time arrives a few frames late from timer queries
+     * and is attached to its frame by number with RecordGpuTime(). The last
+     * Constants::FrameProfiler::kHistoryFrames frames are kept for RenderOverlay(), which draws rolling graphs
+     * and a section table, so UI work such as culling can be checked on graphs that never leave the machine.
+     *
+     * Section times are inclusive: RenderNodes also contains the texture uploads it triggered. While disabled
+     * nothing is recorded and a FrameScope costs one branch. Everything here belongs to the main thread.
+     */
+    class FrameProfiler
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Returns the profiler of the editor's main loop.
+         * @return Profiler instance
+         */
+        [[nodiscard]] static FrameProfiler &Get();
+
+        /**
+         * @brief Turns recording and the overlay on or off; enabling starts with an empty history.
+         * @param isEnabled True to record frames
+         */
+        void SetEnabled(bool isEnabled);
+
+        /**
+         * @brief Checks if frames are recorded.
+         * @return True while enabled
+         */
+        [[nodiscard]] bool IsEnabled() const
+        {
+            return enabled;
+        }
+
+        /**
+         * @brief Starts timing a frame (call after any idle wait, before the UI is built).
+         */
+        void BeginFrame();
+
+        /**
+         * @brief Adds time spent in a section to the frame in progress.
+         * @param section Section the time belongs to
+         * @param duration Time spent
+         */
+        void AddSectionTime(FrameSection section, Clock::duration duration);
+
+        /**
+         * @brief Finishes the frame in progress and appends it to the history.
+         * @param draw Geometry submitted for the frame
+         */
+        void EndFrame(const DrawStats &draw);
+
+        /**
+         * @brief Attaches a resolved GPU timing to its frame, if that frame is still in the history.
+         * @param frame Frame number the timing was started for
+         * @param gpuTime GPU time of the frame
+         */
+        void RecordGpuTime(uint64_t frame, std::chrono::microseconds gpuTime);
+
+        /**
+         * @brief Returns the number of the frame being recorded (or the next one, between frames).
+         * @return Frame number
+         */
+        [[nodiscard]] uint64_t GetCurrentFrame() const
+        {
+            return current.frame;
+        }
+
+        /**
+         * @brief Returns the recorded frames, oldest first.
+         * @return Frame history
+         */
+        [[nodiscard]] const std::deque<FrameSample> &GetHistory() const
+        {
+            return history;
+        }
+
+        /**
+         * @brief Summarizes the whole-frame CPU time over the history.
+         * @return Latest, mean and worst CPU frame time
+         */
+        [[nodiscard]] FrameStatistic GetCpuStatistic() const;
+
+        /**
+         * @brief Summarizes GPU time over the frames whose query resolved.
+         * @return Latest, mean and worst GPU frame time
+         */
+        [[nodiscard]] FrameStatistic GetGpuStatistic() const;
+
+        /**
+         * @brief Summarizes one section over the history.
+         * @param section Section to summarize
+         * @return Latest, mean and worst time in the section
+         */
+        [[nodiscard]] FrameStatistic GetSectionStatistic(FrameSection section) const;
+
+        /**
+         * @brief Sums the geometry of the draw data ImGui::Render() just produced.
+         * @return Vertex, index, list and command counts of all viewports
+         */
+        [[nodiscard]] static DrawStats MeasureDrawData();
+
+        /**
+         * @brief Draws the profiler window while enabled; closing it disables the profiler.
+         */
+        void RenderOverlay();
+
+    private:
+        bool enabled = false;            ///< Frames are recorded
+        bool inFrame = false;            ///< BeginFrame() ran without its EndFrame()
+        Clock::time_point frameStart{};  ///< BeginFrame() time of the frame in progress
+        FrameSample current;             ///< Frame in progress
+        std::deque<FrameSample> history; ///< Recorded frames, oldest first
+    };
+
+    /**
+     * @brief Adds the time until it goes out of scope to a FrameProfiler section.
+     */
+    class FrameScope
+    {
+    public:
+        /**
+         * @brief Starts timing when the profiler is enabled.
+         * @param section Section to add the time to
+         */
+        explicit FrameScope(FrameSection section);
+
+        ~FrameScope();
+
+        FrameScope(const FrameScope &) = delete;
+        FrameScope &operator=(const FrameScope &) = delete;
+
+    private:
+        FrameSection section;                                  ///< Section the time is added to
+        std::optional<FrameProfiler::Clock::time_point> start; ///< Set only while the profiler is enabled
+    };
+} // namespace VisionCraft::UI::Rendering
@@ -0,0 +1,51 @@
+#include "UI/Rendering/NodeLayoutCache.h"
+#include "UI/Canvas/ConnectionManager.h"
+#include "UI/Rendering/NodeDimensionCalculator.h"
+#include "UI/Widgets/NodeEditorConstants.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace VisionCraft::UI::Rendering
+{
+    const NodeLayout &NodeLayoutCache::Get(const Nodes::Node &node)
+    {
+        const auto it = layouts.find(node.GetId());
+        if (it != layouts.end())
+        {
+            return it->second;
+        }
+        return layouts.emplace(node.GetId(), Build(node)).first->second;
+    }
+
+    void NodeLayoutCache::Invalidate(Nodes::NodeId nodeId)
+    {
+        layouts.erase(nodeId);
+    }
+
+    void NodeLayoutCache::Clear()
+    {
+        layouts.clear();
+    }
+
+    NodeLayout NodeLayoutCache::Build(const Nodes::Node &node)
+    {
+        NodeLayout layout;
+        layout.pins = Canvas::ConnectionManager::GetNodePins(&node);
+        layout.separated = Widgets::SeparatePinsByType(layout.pins);
+
+        std::vector<Widgets::NodePin> inputPins, outputPins;
+        std::ranges::partition_copy(layout.pins,
+            std::back_inserter(inputPins),
+            std::back_inserter(outputPins),
+            [](const auto &pin) { return pin.isInput; });
+
+        const auto dimensions = NodeDimensionCalculator::CalculateNodeDimensions(layout.pins, 1.0f, &node);
+        layout.inputPinCount = dimensions.inputPinCount;
+        layout.outputPinCount = dimensions.outputPinCount;
+        layout.size = dimensions.size;
+        layout.parameterAreaHeight = NodeDimensionCalculator::CalculateBaseContentHeight(inputPins, outputPins, 1.0f)
+                                     - (Constants::Node::kPadding * 2);
+        return layout;
+    }
+} // namespace VisionCraft::UI::Rendering
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "UI/Widgets/NodeEditorTypes.h"
+#include "Nodes/Core/Node.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include <imgui.h>
+
+namespace VisionCraft::UI::Rendering
+{
+    /**
+     * @brief Pins and size of a node at zoom 1, as laid out by NodeDimensionCalculator.
+     *
+     * Every length scales linearly with zoom, so one layout serves all zoom levels.
+     */
+    struct NodeLayout
+    {
+        std::vector<Widgets::NodePin> pins; ///< All pins, in ConnectionManager::GetNodePins() order
+        Widgets::SeparatedPins separated;   ///< Pins split by type and direction
+        size_t inputPinCount = 0;           ///< Input pins (execution and data)
+        size_t outputPinCount = 0;          ///< Output pins (execution and data)
+        float parameterAreaHeight = 0.0f;   ///< Height of the pin columns, without padding
+        ImVec2 size;                        ///< Node size, including any image preview
+
+        /**
+         * @brief Returns the node dimensions at a zoom level.
+         * @param zoomLevel Zoom level
+         * @return Dimensions as NodeDimensionCalculator::CalculateNodeDimensions() computes them
+         */
+        [[nodiscard]] Widgets::NodeDimensions Dimensions(float zoomLevel) const
+        {
+            return { ImVec2(size.x * zoomLevel, size.y * zoomLevel), inputPinCount, outputPinCount, 0 };
+        }
+    };
+
+    /**
+     * @brief Per-node layouts, computed once and reused every frame until invalidated.
+     *
+     * A node's pins never change after construction, so a layout only goes stale when the node is
+     * replaced or removed, or when its preview image changes size (the owner invalidates it then).
+     */
+    class NodeLayoutCache
+    {
+    public:
+        /**
+         * @brief Returns the layout of a node, computing it on first use.
+         * @param node Node
+         * @return Layout, valid until the node's entry is invalidated
+         */
+        [[nodiscard]] const NodeLayout &Get(const Nodes::Node &node);
+
+        /**
+         * @brief Drops the layout of a node (no-op if absent).
+         * @param nodeId Node ID
+         */
+        void Invalidate(Nodes::NodeId nodeId);
+
+        /**
+         * @brief Drops all layouts.
+         */
+        void Clear();
+
+        /**
+         * @brief Returns number of cached layouts.
+         * @return Layout count
+         */
+        [[nodiscard]] size_t Size() const
+        {
+            return layouts.size();
+        }
+
+        /**
+         * @brief Computes the layout of a node.
+         * @param node Node
+         * @return Layout at zoom 1
+         */
+        [[nodiscard]] static NodeLayout Build(const Nodes::Node &node);
+
+    private:
+        std::unordered_map<Nodes::NodeId, NodeLayout> layouts; ///< Layout of each node drawn so far
+    };
+} // namespace VisionCraft::UI::Rendering
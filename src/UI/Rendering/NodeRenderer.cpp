@@ -1,9 +1,11 @@
 #include "UI/Rendering/NodeRenderer.h"
+#include "UI/Events/ParameterChangedEvent.h"
 #include "UI/Rendering/NodeDimensionCalculator.h"
 #include "UI/Rendering/Strategies/DefaultNodeRenderingStrategy.h"
 #include "UI/Rendering/Strategies/ImageInputNodeRenderingStrategy.h"
 #include "UI/Rendering/Strategies/PreviewNodeRenderingStrategy.h"
 #include "UI/Widgets/NodeEditorConstants.h"
+#include "Application.h"
 #include "Logger.h"
 #include "Vision/IO/ImageInputNode.h"
 #include "Vision/IO/PreviewNode.h"
@@ -12,8 +14,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
 #include <filesystem>
 #include <iterator>
+#include <utility>
 
 namespace VisionCraft::UI::Rendering
 {
@@ -22,28 +26,39 @@ namespace VisionCraft::UI::Rendering
     {
     }
 
-    void NodeRenderer::RenderNode(Nodes::Node *node,
+    ImVec2 NodeRenderer::RenderNode(Nodes::Node *node,
         const Widgets::NodePosition &nodePos,
         Nodes::NodeId selectedNodeId,
-        std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState)
+        std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState)
     {
         const auto worldPos = canvas_.WorldToScreen(ImVec2(nodePos.x, nodePos.y));
-        const auto pins = connectionManager_.GetNodePins(node);
-        const auto dimensions = NodeRenderer::CalculateNodeDimensions(pins, canvas_.GetZoomLevel(), node);
+        const auto &layout = layouts.Get(*node);
+        const auto dimensions = layout.Dimensions(canvas_.GetZoomLevel());
         const auto isSelected = (node->GetId() == selectedNodeId);
+        const auto *cost = costOverlay.Find(node->GetId());
 
-        RenderNodeBackground(worldPos, dimensions.size, isSelected);
-        RenderNodeTitleBar(worldPos, dimensions.size);
+        // Overview: text, pins, widgets and previews would be illegible, so draw a plain box
+        if (!canvas_.IsDetailVisible())
+        {
+            RenderNodeSummary(worldPos, dimensions.size, isSelected, cost);
+            return dimensions.size;
+        }
+
+        RenderNodeBackground(worldPos, dimensions.size, isSelected, cost);
+        RenderNodeTitleBar(worldPos, dimensions.size, cost);
         RenderNodeTitleText(node, worldPos);
+        if (cost)
+        {
+            RenderNodeCostLabel(*cost, worldPos);
+        }
 
-        // Separate execution pins from data pins
-        const auto [executionInputPins, executionOutputPins, dataInputPins, dataOutputPins] =
-            Widgets::SeparatePinsByType(pins);
+        // Execution pins and data pins, separated once when the layout was built
+        const auto &[executionInputPins, executionOutputPins, dataInputPins, dataOutputPins] = layout.separated;
 
         // Debug logging
         LOG_DEBUG("Node {}: Total pins={}, ExecIn={}, ExecOut={}, DataIn={}, DataOut={}",
             node->GetName(),
-            pins.size(),
+            layout.pins.size(),
             executionInputPins.size(),
             executionOutputPins.size(),
             dataInputPins.size(),
@@ -60,23 +75,61 @@ namespace VisionCraft::UI::Rendering
         RenderPinsInColumn(node, dataInputPins, worldPos, dimensions, true, hasExecutionPins, getPinInteractionState);
         RenderPinsInColumn(node, dataOutputPins, worldPos, dimensions, false, hasExecutionPins, getPinInteractionState);
 
-        RenderCustomNodeContent(node, worldPos, dimensions.size);
-        RenderFileBrowser();
+        RenderCustomNodeContent(node, worldPos, dimensions.size, layout);
+        return dimensions.size;
+    }
+
+    ImVec2 NodeRenderer::MeasureNode(const Nodes::Node &node)
+    {
+        return layouts.Get(node).size;
+    }
+
+    void NodeRenderer::InvalidateNodeLayout(Nodes::NodeId nodeId)
+    {
+        layouts.Invalidate(nodeId);
+    }
+
+    void NodeRenderer::ClearNodeLayouts()
+    {
+        layouts.Clear();
     }
 
-    void NodeRenderer::RenderNodeBackground(const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected)
+    namespace
+    {
+        // Selection wins over the critical path, which wins over the normal border
+        ImU32 BorderColor(bool isSelected, const NodeCost *cost)
+        {
+            if (isSelected)
+            {
+                return Constants::Colors::Node::kBorderSelected;
+            }
+            return cost && cost->onCriticalPath ? Constants::Colors::CostOverlay::kCriticalPath
+                                                : Constants::Colors::Node::kBorderNormal;
+        }
+
+        float BorderThickness(bool isSelected, const NodeCost *cost)
+        {
+            if (isSelected)
+            {
+                return Constants::Node::Border::kThicknessSelected;
+            }
+            return cost && cost->onCriticalPath ? Constants::CostOverlay::kCriticalPathThickness
+                                                : Constants::Node::Border::kThicknessNormal;
+        }
+    } // namespace
+
+    void NodeRenderer::RenderNodeBackground(
+        const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected, const NodeCost *cost)
     {
         auto *drawList = ImGui::GetWindowDrawList();
-        const auto borderColor =
-            isSelected ? Constants::Colors::Node::kBorderSelected : Constants::Colors::Node::kBorderNormal;
-        const auto borderThickness =
-            isSelected ? Constants::Node::Border::kThicknessSelected : Constants::Node::Border::kThicknessNormal;
+        const auto borderColor = BorderColor(isSelected, cost);
+        const auto borderThickness = BorderThickness(isSelected, cost);
         const auto nodeRounding = Constants::Node::kRounding * canvas_.GetZoomLevel();
+        const auto background = cost ? CostOverlay::Tint(Constants::Colors::Node::kBackground, costOverlay.Heat(*cost))
+                                     : Constants::Colors::Node::kBackground;
 
-        drawList->AddRectFilled(worldPos,
-            ImVec2(worldPos.x + nodeSize.x, worldPos.y + nodeSize.y),
-            Constants::Colors::Node::kBackground,
-            nodeRounding);
+        drawList->AddRectFilled(
+            worldPos, ImVec2(worldPos.x + nodeSize.x, worldPos.y + nodeSize.y), background, nodeRounding);
 
         drawList->AddRect(worldPos,
             ImVec2(worldPos.x + nodeSize.x, worldPos.y + nodeSize.y),
@@ -86,19 +139,73 @@ namespace VisionCraft::UI::Rendering
             borderThickness * canvas_.GetZoomLevel());
     }
 
-    void NodeRenderer::RenderNodeTitleBar(const ImVec2 &worldPos, const ImVec2 &nodeSize)
+    void NodeRenderer::RenderNodeSummary(
+        const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected, const NodeCost *cost)
+    {
+        // Square corners: rounded rectangles cost many more vertices, invisible at this size
+        auto *drawList = ImGui::GetWindowDrawList();
+        const auto nodeMax = ImVec2(worldPos.x + nodeSize.x, worldPos.y + nodeSize.y);
+        const auto titleHeight = Constants::Node::kTitleHeight * canvas_.GetZoomLevel();
+        const auto heat = cost ? costOverlay.Heat(*cost) : 0.0f;
+
+        drawList->AddRectFilled(worldPos, nodeMax, CostOverlay::Tint(Constants::Colors::Node::kBackground, heat));
+        drawList->AddRectFilled(worldPos,
+            ImVec2(nodeMax.x, worldPos.y + titleHeight),
+            CostOverlay::Tint(Constants::Colors::Node::kTitle, heat));
+        drawList->AddRect(worldPos, nodeMax, BorderColor(isSelected, cost));
+    }
+
+    void NodeRenderer::RenderNodeTitleBar(const ImVec2 &worldPos, const ImVec2 &nodeSize, const NodeCost *cost)
     {
         auto *drawList = ImGui::GetWindowDrawList();
         const auto titleHeight = Constants::Node::kTitleHeight * canvas_.GetZoomLevel();
         const auto nodeRounding = Constants::Node::kRounding * canvas_.GetZoomLevel();
+        const auto titleColor = cost ? CostOverlay::Tint(Constants::Colors::Node::kTitle, costOverlay.Heat(*cost))
+                                     : Constants::Colors::Node::kTitle;
 
         drawList->AddRectFilled(worldPos,
             ImVec2(worldPos.x + nodeSize.x, worldPos.y + titleHeight),
-            Constants::Colors::Node::kTitle,
+            titleColor,
             nodeRounding,
             ImDrawFlags_RoundCornersTop);
     }
 
+    void NodeRenderer::RenderNodeCostLabel(const NodeCost &cost, const ImVec2 &worldPos)
+    {
+        if (canvas_.GetZoomLevel() <= Constants::Zoom::kMinForText)
+        {
+            return;
+        }
+
+        char label[96];
+        const auto lastMs = static_cast<double>(cost.lastTime.count()) / 1000.0;
+        const auto medianMs = static_cast<double>(cost.medianTime.count()) / 1000.0;
+        if (costOverlay.GetMode() == CostOverlayMode::Memory)
+        {
+            snprintf(label,
+                sizeof(label),
+                "%.1f MB (%.0f%%)  last %.2f ms, median %.2f ms",
+                static_cast<double>(cost.outputBytes) / (1024.0 * 1024.0),
+                cost.memoryShare * 100.0,
+                lastMs,
+                medianMs);
+        }
+        else
+        {
+            snprintf(label,
+                sizeof(label),
+                "last %.2f ms (%.0f%%), median %.2f ms",
+                lastMs,
+                cost.timeShare * 100.0,
+                medianMs);
+        }
+
+        // Above the node, so the label never changes the node's layout
+        const auto labelPos = ImVec2(worldPos.x,
+            worldPos.y - ImGui::GetFontSize() - Constants::CostOverlay::kLabelOffset * canvas_.GetZoomLevel());
+        ImGui::GetWindowDrawList()->AddText(labelPos, Constants::Colors::CostOverlay::kLabel, label);
+    }
+
     void NodeRenderer::RenderNodeTitleText(Nodes::Node *node, const ImVec2 &worldPos)
     {
         if (canvas_.GetZoomLevel() > Constants::Zoom::kMinForText)
@@ -182,7 +289,7 @@ namespace VisionCraft::UI::Rendering
         const Widgets::NodeDimensions &dimensions,
         bool isInputColumn,
         bool hasExecutionPins,
-        std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState)
+        std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState)
     {
         if (pins.empty())
         {
@@ -249,7 +356,7 @@ namespace VisionCraft::UI::Rendering
         const std::vector<Widgets::NodePin> &executionOutputPins,
         const ImVec2 &nodeWorldPos,
         const Widgets::NodeDimensions &dimensions,
-        std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState)
+        std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState)
     {
         // If no execution pins, skip rendering
         if (executionInputPins.empty() && executionOutputPins.empty())
@@ -524,7 +631,7 @@ namespace VisionCraft::UI::Rendering
 
         ImGui::SetCursorScreenPos(ImVec2(position.x + padding, inputY));
 
-        const auto widgetId = "##" + std::to_string(node->GetId()) + "_" + pin.name;
+        const auto widgetId = "##" + std::to_string(node->GetId()) + "_" + pin.name.Str();
 
         switch (pin.dataType)
         {
@@ -571,7 +678,7 @@ namespace VisionCraft::UI::Rendering
 
         ImGui::SetCursorScreenPos(inputPos);
 
-        const auto widgetId = "##" + std::to_string(node->GetId()) + "_" + pin.name;
+        const auto widgetId = "##" + std::to_string(node->GetId()) + "_" + pin.name.Str();
 
         switch (pin.dataType)
         {
@@ -595,6 +702,31 @@ namespace VisionCraft::UI::Rendering
         }
     }
 
+    void NodeRenderer::SetParameter(Nodes::Node *node, const std::string &name, Nodes::NodeData value)
+    {
+        if (!parameterEditCallback)
+        {
+            node->SetInputSlotDefault(name, std::move(value));
+            return;
+        }
+        const auto previous = node->GetInputSlot(name).GetSharedDefaultValue();
+        parameterEditCallback(node->GetId(), name, previous ? *previous : Nodes::NodeData{}, std::move(value));
+    }
+
+    void NodeRenderer::FinishParameterEdit(const Nodes::Node *node, const std::string &name)
+    {
+        // Typing or dragging only sets the value; the edit is announced once, when the widget lets go
+        if (ImGui::IsItemDeactivatedAfterEdit())
+        {
+            NotifyParameterChanged(node->GetId(), name);
+        }
+    }
+
+    void NodeRenderer::NotifyParameterChanged(Nodes::NodeId nodeId, const std::string &name)
+    {
+        Kappa::Application::Get().GetEventBus().Publish(Events::ParameterChangedEvent{ nodeId, name });
+    }
+
     void NodeRenderer::RenderStringInput(Nodes::Node *node,
         const Widgets::NodePin &pin,
         const std::string &widgetId,
@@ -608,8 +740,9 @@ namespace VisionCraft::UI::Rendering
         ImGui::PushItemWidth(inputWidth);
         if (ImGui::InputText(widgetId.c_str(), buffer, sizeof(buffer)))
         {
-            node->SetInputSlotDefault(pin.name, std::string(buffer));
+            SetParameter(node, pin.name, std::string(buffer));
         }
+        FinishParameterEdit(node, pin.name);
         ImGui::PopItemWidth();
     }
 
@@ -628,8 +761,9 @@ namespace VisionCraft::UI::Rendering
                 Constants::NodeRenderer::ParameterInput::kFloatFastStep,
                 Constants::NodeRenderer::ParameterInput::kFloatFormat))
         {
-            node->SetInputSlotDefault(pin.name, static_cast<double>(value));
+            SetParameter(node, pin.name, static_cast<double>(value));
         }
+        FinishParameterEdit(node, pin.name);
         ImGui::PopItemWidth();
     }
 
@@ -643,8 +777,9 @@ namespace VisionCraft::UI::Rendering
         ImGui::PushItemWidth(inputWidth);
         if (ImGui::InputInt(widgetId.c_str(), &value))
         {
-            node->SetInputSlotDefault(pin.name, value);
+            SetParameter(node, pin.name, value);
         }
+        FinishParameterEdit(node, pin.name);
         ImGui::PopItemWidth();
     }
 
@@ -654,8 +789,9 @@ namespace VisionCraft::UI::Rendering
 
         if (ImGui::Checkbox(widgetId.c_str(), &value))
         {
-            node->SetInputSlotDefault(pin.name, value);
+            SetParameter(node, pin.name, value);
         }
+        FinishParameterEdit(node, pin.name);
     }
 
     void NodeRenderer::RenderPathInput(Nodes::Node *node,
@@ -679,8 +815,9 @@ namespace VisionCraft::UI::Rendering
             ImGui::PushItemWidth(inputWidth);
             if (ImGui::InputText(widgetId.c_str(), buffer, sizeof(buffer)))
             {
-                node->SetInputSlotDefault(pin.name, std::filesystem::path(buffer));
+                SetParameter(node, pin.name, std::filesystem::path(buffer));
             }
+            FinishParameterEdit(node, pin.name);
             ImGui::PopItemWidth();
 
             const float buttonWidth = Constants::NodeRenderer::ParameterInput::kButtonWidth * canvas_.GetZoomLevel();
@@ -705,7 +842,9 @@ namespace VisionCraft::UI::Rendering
             const std::string loadId = "Load";
             if (ImGui::Button(loadId.c_str(), ImVec2(buttonWidth, buttonHeight)))
             {
-                node->Process();
+                // Decodes in the background instead of running Process() on the UI thread
+                static_cast<Vision::IO::ImageInputNode *>(node)->SelectFile(pathValue);
+                NotifyParameterChanged(node->GetId(), pin.name);
             }
         }
         else
@@ -713,19 +852,37 @@ namespace VisionCraft::UI::Rendering
             ImGui::PushItemWidth(inputWidth);
             if (ImGui::InputText(widgetId.c_str(), buffer, sizeof(buffer)))
             {
-                node->SetInputSlotDefault(pin.name, std::filesystem::path(buffer));
+                SetParameter(node, pin.name, std::filesystem::path(buffer));
             }
+            FinishParameterEdit(node, pin.name);
             ImGui::PopItemWidth();
         }
     }
 
-    void NodeRenderer::RenderCustomNodeContent(Nodes::Node *node, const ImVec2 &nodePos, const ImVec2 &nodeSize)
+    void NodeRenderer::RenderCustomNodeContent(Nodes::Node *node,
+        const ImVec2 &nodePos,
+        const ImVec2 &nodeSize,
+        const NodeLayout &layout)
     {
         if (!node)
             return;
 
         auto strategy = CreateRenderingStrategy(node);
-        strategy->RenderCustomContent(*node, nodePos, nodeSize, canvas_.GetZoomLevel());
+        strategy->RenderCustomContent(*node, nodePos, nodeSize, layout, canvas_.GetZoomLevel());
+        if (strategy->IsInspectorRequested())
+        {
+            inspectorRequest = node->GetId();
+        }
+        if (strategy->IsLayoutChanged())
+        {
+            // The preview may have changed size; the layout (and with it the node) is remeasured next frame
+            layouts.Invalidate(node->GetId());
+        }
+    }
+
+    std::optional<Nodes::NodeId> NodeRenderer::TakeInspectorRequest()
+    {
+        return std::exchange(inspectorRequest, std::nullopt);
     }
 
     Widgets::NodeDimensions NodeRenderer::CalculateNodeDimensions(const std::vector<Widgets::NodePin> &pins,
@@ -778,10 +935,11 @@ namespace VisionCraft::UI::Rendering
             {
                 std::string selectedPath = ImGuiFileDialog::Instance()->GetFilePathName();
 
-                if (!selectedPath.empty() && fileBrowserTargetNode)
+                auto *imageNode = dynamic_cast<Vision::IO::ImageInputNode *>(fileBrowserTargetNode);
+                if (!selectedPath.empty() && imageNode)
                 {
-                    fileBrowserTargetNode->SetInputSlotDefault("FilePath", std::filesystem::path(selectedPath));
-                    fileBrowserTargetNode->Process();
+                    imageNode->SelectFile(std::filesystem::path(selectedPath));
+                    NotifyParameterChanged(imageNode->GetId(), "FilePath");
                 }
 
                 fileBrowserTargetNode = nullptr;
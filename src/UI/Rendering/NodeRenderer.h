@@ -2,11 +2,14 @@
 
 #include "UI/Canvas/CanvasController.h"
 #include "UI/Canvas/ConnectionManager.h"
+#include "UI/Rendering/CostOverlay.h"
+#include "UI/Rendering/NodeLayoutCache.h"
 #include "UI/Rendering/Strategies/NodeRenderingStrategy.h"
 #include "UI/Widgets/NodeEditorTypes.h"
 #include "Nodes/Core/Node.h"
 
 #include <functional>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -29,6 +32,10 @@ namespace VisionCraft::UI::Rendering
     class NodeRenderer
     {
     public:
+        /** @brief Function that applies a parameter edit: node, input slot, previous and new default */
+        using ParameterEditCallback =
+            std::function<void(Nodes::NodeId, const std::string &, const Nodes::NodeData &, Nodes::NodeData)>;
+
         /**
          * @brief Constructs renderer.
          * @param canvas Canvas controller
@@ -42,11 +49,39 @@ namespace VisionCraft::UI::Rendering
          * @param nodePos Nodes::Node position
          * @param selectedNodeId Selected node ID
          * @param getPinInteractionState Pin interaction state function
+         * @return Rendered node size in screen pixels
          */
-        void RenderNode(Nodes::Node *node,
+        ImVec2 RenderNode(Nodes::Node *node,
             const Widgets::NodePosition &nodePos,
             Nodes::NodeId selectedNodeId,
-            std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState);
+            std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState);
+
+        /**
+         * @brief Returns the size of a node at zoom 1, from its cached layout.
+         * @param node Node
+         * @return Node size in world units
+         */
+        [[nodiscard]] ImVec2 MeasureNode(const Nodes::Node &node);
+
+        /**
+         * @brief Drops the cached layout of a node, e.g. when it was removed or replaced.
+         * @param nodeId Node ID
+         */
+        void InvalidateNodeLayout(Nodes::NodeId nodeId);
+
+        /**
+         * @brief Drops all cached layouts, e.g. when the graph was replaced.
+         */
+        void ClearNodeLayouts();
+
+        /**
+         * @brief Returns the cost heatmap overlay drawn over nodes.
+         * @return Cost overlay (off by default)
+         */
+        [[nodiscard]] CostOverlay &GetCostOverlay()
+        {
+            return costOverlay;
+        }
 
         /**
          * @brief Renders parameters in columns.
@@ -77,7 +112,7 @@ namespace VisionCraft::UI::Rendering
             const Widgets::NodeDimensions &dimensions,
             bool isInputColumn,
             bool hasExecutionPins,
-            std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState);
+            std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState);
 
         /**
          * @brief Renders execution pins in a horizontal row at the top of the node.
@@ -93,7 +128,7 @@ namespace VisionCraft::UI::Rendering
             const std::vector<Widgets::NodePin> &executionOutputPins,
             const ImVec2 &nodeWorldPos,
             const Widgets::NodeDimensions &dimensions,
-            std::function<PinInteractionState(Nodes::NodeId, const std::string &)> getPinInteractionState);
+            std::function<PinInteractionState(Nodes::NodeId, Nodes::SlotName)> getPinInteractionState);
 
     private:
         /**
@@ -248,20 +283,62 @@ namespace VisionCraft::UI::Rendering
             const std::string &widgetId,
             float inputWidth);
 
+        /**
+         * @brief Sets a parameter's input default, through the parameter edit callback when one is set.
+         * @param node Node
+         * @param name Input slot name
+         * @param value New default
+         */
+        void SetParameter(Nodes::Node *node, const std::string &name, Nodes::NodeData value);
+
+        /**
+         * @brief Announces a parameter edit (ParameterChangedEvent) once the widget just drawn is released.
+         * @param node Node
+         * @param name Input slot name
+         */
+        static void FinishParameterEdit(const Nodes::Node *node, const std::string &name);
+
+        /**
+         * @brief Publishes a ParameterChangedEvent, e.g. for auto-run.
+         * @param nodeId Node whose parameter changed
+         * @param name Input slot name
+         */
+        static void NotifyParameterChanged(Nodes::NodeId nodeId, const std::string &name);
+
         /**
          * @brief Renders node background.
          * @param worldPos World position
          * @param nodeSize Nodes::Node size
          * @param isSelected Whether selected
+         * @param cost Node cost while the cost overlay is on (tints the body, marks the critical path)
          */
-        void RenderNodeBackground(const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected);
+        void RenderNodeBackground(
+            const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected, const NodeCost *cost = nullptr);
+
+        /**
+         * @brief Renders node as a plain box with its title band, for the zoomed-out level of detail.
+         * @param worldPos World position
+         * @param nodeSize Nodes::Node size
+         * @param isSelected Whether selected
+         * @param cost Node cost while the cost overlay is on
+         */
+        void RenderNodeSummary(
+            const ImVec2 &worldPos, const ImVec2 &nodeSize, bool isSelected, const NodeCost *cost = nullptr);
 
         /**
          * @brief Renders title bar.
          * @param worldPos World position
          * @param nodeSize Nodes::Node size
+         * @param cost Node cost while the cost overlay is on (tints the bar)
          */
-        void RenderNodeTitleBar(const ImVec2 &worldPos, const ImVec2 &nodeSize);
+        void RenderNodeTitleBar(const ImVec2 &worldPos, const ImVec2 &nodeSize, const NodeCost *cost = nullptr);
+
+        /**
+         * @brief Renders the last and median duration (and output bytes in memory mode) above a node.
+         * @param cost Node cost
+         * @param worldPos World position
+         */
+        void RenderNodeCostLabel(const NodeCost &cost, const ImVec2 &worldPos);
 
         /**
          * @brief Renders title text.
@@ -283,8 +360,12 @@ namespace VisionCraft::UI::Rendering
          * @param node Nodes::Node
          * @param nodePos Nodes::Node position
          * @param nodeSize Nodes::Node size
+         * @param layout Cached node layout
          */
-        void RenderCustomNodeContent(Nodes::Node *node, const ImVec2 &nodePos, const ImVec2 &nodeSize);
+        void RenderCustomNodeContent(Nodes::Node *node,
+            const ImVec2 &nodePos,
+            const ImVec2 &nodeSize,
+            const NodeLayout &layout);
 
     public:
         /**
@@ -298,6 +379,28 @@ namespace VisionCraft::UI::Rendering
             float zoomLevel,
             const Nodes::Node *node = nullptr);
 
+        /**
+         * @brief Returns the node whose preview was double-clicked since the last call, and forgets it.
+         * @return Node ID, or std::nullopt if no inspector was requested
+         */
+        [[nodiscard]] std::optional<Nodes::NodeId> TakeInspectorRequest();
+
+        /**
+         * @brief Routes parameter widget edits, e.g. into undoable commands.
+         * @param callback Receives node ID, input slot name, previous default and new default; it must set
+         *                 the default. Without a callback, widgets set defaults directly.
+         */
+        void SetParameterEditCallback(ParameterEditCallback callback)
+        {
+            parameterEditCallback = std::move(callback);
+        }
+
+        /**
+         * @brief Renders file browser dialog opened from an image input node.
+         * @note Call once per frame, independently of which nodes are visible.
+         */
+        void RenderFileBrowser();
+
     private:
         /**
          * @brief Creates rendering strategy.
@@ -307,17 +410,17 @@ namespace VisionCraft::UI::Rendering
         [[nodiscard]] static std::unique_ptr<Rendering::Strategies::NodeRenderingStrategy> CreateRenderingStrategy(
             const Nodes::Node *node);
 
-        /**
-         * @brief Renders file browser dialog.
-         */
-        void RenderFileBrowser();
-
         Canvas::CanvasController &canvas_;
         Canvas::ConnectionManager &connectionManager_;
+        NodeLayoutCache layouts; ///< Pins and zoom-1 size of each drawn node
+        CostOverlay costOverlay; ///< Tints nodes by their cost in the latest run
 
         bool fileBrowserOpen = false;
         Nodes::Node *fileBrowserTargetNode = nullptr;
         char *fileBrowserTargetBuffer = nullptr;
+
+        std::optional<Nodes::NodeId> inspectorRequest; ///< Node whose preview was double-clicked
+        ParameterEditCallback parameterEditCallback;   ///< Applies parameter widget edits
     };
 
 } // namespace VisionCraft::UI::Rendering
@@ -5,6 +5,7 @@ namespace VisionCraft::UI::Rendering::Strategies
     void DefaultNodeRenderingStrategy::RenderCustomContent(Nodes::Node &node,
         const ImVec2 &nodePos,
         const ImVec2 &nodeSize,
+        const NodeLayout &layout,
         float zoomLevel)
     {
     }
@@ -1,9 +1,8 @@
 #include "UI/Rendering/Strategies/ImageInputNodeRenderingStrategy.h"
-#include "UI/Canvas/ConnectionManager.h"
-#include "UI/Rendering/NodeDimensionCalculator.h"
+#include "UI/Rendering/FramePacer.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "UI/Widgets/NodeEditorConstants.h"
 #include "Vision/IO/ImageInputNode.h"
-#include <algorithm>
 
 namespace VisionCraft::UI::Rendering::Strategies
 {
@@ -18,20 +17,11 @@ namespace VisionCraft::UI::Rendering::Strategies
             float contentY;
         };
 
-        ContentAreaInfo CalculateContentArea(const Nodes::Node &node, const ImVec2 &nodePos, float zoomLevel)
+        ContentAreaInfo CalculateContentArea(const NodeLayout &layout, const ImVec2 &nodePos, float zoomLevel)
         {
             const float titleHeight = Constants::Node::kTitleHeight * zoomLevel;
             const float padding = Constants::Node::kPadding * zoomLevel;
-
-            const auto pins = Canvas::ConnectionManager::GetNodePins(&node);
-            std::vector<Widgets::NodePin> inputPins, outputPins;
-            std::copy_if(
-                pins.begin(), pins.end(), std::back_inserter(inputPins), [](const auto &pin) { return pin.isInput; });
-            std::copy_if(
-                pins.begin(), pins.end(), std::back_inserter(outputPins), [](const auto &pin) { return !pin.isInput; });
-
-            const float parameterAreaHeight =
-                NodeDimensionCalculator::CalculateBaseContentHeight(inputPins, outputPins, zoomLevel) - (padding * 2);
+            const float parameterAreaHeight = layout.parameterAreaHeight * zoomLevel;
 
             const float contentY =
                 nodePos.y + titleHeight + padding + parameterAreaHeight + (kExtraSpacing * zoomLevel);
@@ -43,12 +33,20 @@ namespace VisionCraft::UI::Rendering::Strategies
     void ImageInputNodeRenderingStrategy::RenderCustomContent(Nodes::Node &node,
         const ImVec2 &nodePos,
         const ImVec2 &nodeSize,
+        const NodeLayout &layout,
         float zoomLevel)
     {
         auto &imageNode = static_cast<Vision::IO::ImageInputNode &>(node);
 
         const float padding = Constants::Node::kPadding * zoomLevel;
-        const auto [parameterAreaHeight, contentY] = CalculateContentArea(node, nodePos, zoomLevel);
+        const auto [parameterAreaHeight, contentY] = CalculateContentArea(layout, nodePos, zoomLevel);
+
+        // Show background decodes of a newly selected file: reduced first paint, then full resolution
+        imageNode.UpdatePreview();
+        if (imageNode.IsDecoding())
+        {
+            FramePacer::Get().RequestFrames(); // Nothing wakes the loop when a decode finishes, so keep drawing
+        }
 
         // Show error message if present
         if (imageNode.HasError())
@@ -60,14 +58,17 @@ namespace VisionCraft::UI::Rendering::Strategies
             return;
         }
 
-        // Update texture on main thread if image was loaded but texture doesn't exist yet
-        // This happens after async graph execution where images are loaded but textures can't be created
-        if (!imageNode.GetOutputImage().empty() && imageNode.GetTextureId() == 0)
+        // Update texture on main thread whenever the image changed (selected file or async graph execution),
+        // since worker threads cannot make OpenGL calls
+        if (imageNode.NeedsTextureUpdate())
         {
             // SAFETY: This is running on the main thread (rendering), so OpenGL calls are safe
+            FrameScope frameScope(FrameSection::TextureUpload);
             imageNode.UpdateTexture();
+            layoutChanged = true;
         }
 
+        imageNode.MarkTextureDrawn();
         if (!imageNode.HasValidImage() || imageNode.GetTextureId() == 0)
         {
             return;
@@ -91,9 +92,12 @@ namespace VisionCraft::UI::Rendering::Strategies
                 if (outputImage.rows > 0 && outputImage.cols > 0)
                 {
                     float imageAspect = static_cast<float>(outputImage.cols) / static_cast<float>(outputImage.rows);
-                    ImGui::SetTooltip(
-                        "%dx%d pixels\nAspect ratio: %.2f", outputImage.cols, outputImage.rows, imageAspect);
+                    ImGui::SetTooltip("%dx%d pixels\nAspect ratio: %.2f\nDouble-click to inspect",
+                        outputImage.cols,
+                        outputImage.rows,
+                        imageAspect);
                 }
+                inspectorRequested = ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left);
             }
         }
     }
@@ -13,6 +13,7 @@ namespace VisionCraft::UI::Rendering::Strategies
         void RenderCustomContent(Nodes::Node &node,
             const ImVec2 &nodePos,
             const ImVec2 &nodeSize,
+            const NodeLayout &layout,
             float zoomLevel) override;
     };
 
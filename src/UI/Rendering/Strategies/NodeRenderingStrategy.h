@@ -1,5 +1,6 @@
 #pragma once
 
+#include "UI/Rendering/NodeLayoutCache.h"
 #include "Nodes/Core/Node.h"
 #include <imgui.h>
 
@@ -18,10 +19,36 @@ namespace VisionCraft::UI::Rendering::Strategies
          * @param node Nodes::Node
          * @param nodePos Nodes::Node position
          * @param nodeSize Nodes::Node size
+         * @param layout Cached node layout at zoom 1
          * @param zoomLevel Zoom level
          */
-        virtual void
-            RenderCustomContent(Nodes::Node &node, const ImVec2 &nodePos, const ImVec2 &nodeSize, float zoomLevel) = 0;
+        virtual void RenderCustomContent(Nodes::Node &node,
+            const ImVec2 &nodePos,
+            const ImVec2 &nodeSize,
+            const NodeLayout &layout,
+            float zoomLevel) = 0;
+
+        /**
+         * @brief Checks if RenderCustomContent() asked to inspect the node's image at full resolution.
+         * @return True if the preview was double-clicked
+         */
+        [[nodiscard]] bool IsInspectorRequested() const
+        {
+            return inspectorRequested;
+        }
+
+        /**
+         * @brief Checks if RenderCustomContent() changed what the node's size depends on.
+         * @return True if a new preview image was uploaded, so the cached layout is stale
+         */
+        [[nodiscard]] bool IsLayoutChanged() const
+        {
+            return layoutChanged;
+        }
+
+    protected:
+        bool inspectorRequested = false; ///< Set by RenderCustomContent() on a double-click of the preview
+        bool layoutChanged = false;      ///< Set by RenderCustomContent() when the preview image was replaced
     };
 
 } // namespace VisionCraft::UI::Rendering::Strategies
@@ -1,27 +1,29 @@
 #include "UI/Rendering/Strategies/PreviewNodeRenderingStrategy.h"
-#include "UI/Canvas/ConnectionManager.h"
-#include "UI/Rendering/NodeDimensionCalculator.h"
+#include "UI/Rendering/FrameProfiler.h"
 #include "UI/Widgets/NodeEditorConstants.h"
 #include "Vision/IO/PreviewNode.h"
-#include <algorithm>
 
 namespace VisionCraft::UI::Rendering::Strategies
 {
     void PreviewNodeRenderingStrategy::RenderCustomContent(Nodes::Node &node,
         const ImVec2 &nodePos,
         const ImVec2 &nodeSize,
+        const NodeLayout &layout,
         float zoomLevel)
     {
         auto &previewNode = static_cast<Vision::IO::PreviewNode &>(node);
 
-        // Update texture on main thread if image was loaded but texture doesn't exist yet
-        // This happens after async graph execution where images are loaded but textures can't be created
-        if (!previewNode.GetOutputImage().empty() && previewNode.GetTextureId() == 0)
+        // Upload on the main thread whenever a run published a new image; worker threads cannot call OpenGL
+        if (previewNode.NeedsTextureUpdate())
         {
             // SAFETY: This is running on the main thread (rendering), so OpenGL calls are safe
+            FrameScope frameScope(FrameSection::TextureUpload);
             previewNode.UpdateTexture();
+            layoutChanged = true;
         }
 
+        // Previews scrolled back into view get the thumbnail the budget released off screen
+        previewNode.MarkTextureDrawn();
         if (!previewNode.HasValidImage() || previewNode.GetTextureId() == 0)
         {
             return;
@@ -30,15 +32,7 @@ namespace VisionCraft::UI::Rendering::Strategies
         const float titleHeight = Constants::Node::kTitleHeight * zoomLevel;
         const float padding = Constants::Node::kPadding * zoomLevel;
 
-        const auto pins = Canvas::ConnectionManager::GetNodePins(&node);
-        std::vector<Widgets::NodePin> inputPins, outputPins;
-        std::copy_if(
-            pins.begin(), pins.end(), std::back_inserter(inputPins), [](const auto &pin) { return pin.isInput; });
-        std::copy_if(
-            pins.begin(), pins.end(), std::back_inserter(outputPins), [](const auto &pin) { return !pin.isInput; });
-
-        const float parameterAreaHeight =
-            NodeDimensionCalculator::CalculateBaseContentHeight(inputPins, outputPins, zoomLevel) - (padding * 2);
+        const float parameterAreaHeight = layout.parameterAreaHeight * zoomLevel;
 
         const float extraSpacing = 10.0f * zoomLevel;
         const float previewY = nodePos.y + titleHeight + padding + parameterAreaHeight + extraSpacing;
@@ -60,9 +54,12 @@ namespace VisionCraft::UI::Rendering::Strategies
                 if (outputImage.rows > 0 && outputImage.cols > 0)
                 {
                     float imageAspect = static_cast<float>(outputImage.cols) / static_cast<float>(outputImage.rows);
-                    ImGui::SetTooltip(
-                        "%dx%d pixels\nAspect ratio: %.2f", outputImage.cols, outputImage.rows, imageAspect);
+                    ImGui::SetTooltip("%dx%d pixels\nAspect ratio: %.2f\nDouble-click to inspect",
+                        outputImage.cols,
+                        outputImage.rows,
+                        imageAspect);
                 }
+                inspectorRequested = ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left);
             }
         }
     }
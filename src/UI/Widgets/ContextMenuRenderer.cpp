@@ -5,7 +5,7 @@
 
 namespace VisionCraft::UI::Widgets
 {
-    ContextMenuResult ContextMenuRenderer::Render(bool hasSelection, bool hasClipboardData)
+    ContextMenuResult ContextMenuRenderer::Render(bool hasSelection, bool hasClipboardData, bool canExecuteUpTo)
     {
         ContextMenuResult result;
 
@@ -43,6 +43,15 @@ namespace VisionCraft::UI::Widgets
 
             ImGui::Separator();
 
+            // Run only the selected node and what feeds it (disabled unless one node is selected)
+            if (ImGui::MenuItem("Execute up to here", nullptr, false, canExecuteUpTo))
+            {
+                result.action = ContextMenuResult::Action::ExecuteUpToNode;
+                ImGui::CloseCurrentPopup();
+            }
+
+            ImGui::Separator();
+
             // Nested "Add Node" submenu
             const auto selectedNodeType = RenderAddNodeSubmenu();
             if (!selectedNodeType.empty())
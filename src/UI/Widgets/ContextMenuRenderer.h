@@ -20,7 +20,8 @@ namespace VisionCraft::UI::Widgets
             CreateNode,
             CopyNodes,
             CutNodes,
-            PasteNodes
+            PasteNodes,
+            ExecuteUpToNode
         };
 
         Action action = Action::None;
@@ -31,7 +32,7 @@ namespace VisionCraft::UI::Widgets
      * @brief Renders context menu for node editor.
      *
      * Separates context menu UI rendering from layer logic.
-     * Supports delete operations and node creation via categorized submenu.
+     * Supports delete operations, partial execution and node creation via categorized submenu.
      */
     class ContextMenuRenderer
     {
@@ -50,9 +51,12 @@ namespace VisionCraft::UI::Widgets
          * @brief Renders the context menu and returns user action.
          * @param hasSelection Whether any nodes are selected
          * @param hasClipboardData Whether clipboard has data for paste
+         * @param canExecuteUpTo Whether exactly one node is selected to execute up to
          * @return Result indicating what action was taken
          */
-        [[nodiscard]] ContextMenuResult Render(bool hasSelection, bool hasClipboardData = false);
+        [[nodiscard]] ContextMenuResult Render(bool hasSelection,
+            bool hasClipboardData = false,
+            bool canExecuteUpTo = false);
 
         /**
          * @brief Registers available node types for creation menu.
@@ -1,4 +1,5 @@
 #include "UI/Widgets/FileDialogManager.h"
+#include "Nodes/Core/EngineConstants.h"
 
 #include <cstring>
 
@@ -29,7 +30,7 @@ namespace VisionCraft::UI::Widgets
                 if (!filepath.empty())
                 {
                     result.action = FileDialogResult::Action::Save;
-                    result.filepath = EnsureJsonExtension(filepath);
+                    result.filepath = EnsureGraphExtension(filepath);
                     showSaveDialog = false;
                     ClearBuffer();
                 }
@@ -73,7 +74,7 @@ namespace VisionCraft::UI::Widgets
                 if (!filepath.empty())
                 {
                     result.action = FileDialogResult::Action::Load;
-                    result.filepath = EnsureJsonExtension(filepath);
+                    result.filepath = EnsureGraphExtension(filepath);
                     showLoadDialog = false;
                     ClearBuffer();
                 }
@@ -116,9 +117,9 @@ namespace VisionCraft::UI::Widgets
         return showLoadDialog;
     }
 
-    std::string FileDialogManager::EnsureJsonExtension(const std::string &filepath)
+    std::string FileDialogManager::EnsureGraphExtension(const std::string &filepath)
     {
-        if (filepath.ends_with(".json"))
+        if (filepath.ends_with(".json") || filepath.ends_with(Constants::Persistence::kBinaryGraphExtension))
         {
             return filepath;
         }
@@ -72,11 +72,11 @@ namespace VisionCraft::UI::Widgets
         char filePathBuffer[512] = "";
 
         /**
-         * @brief Ensures filepath has .json extension.
+         * @brief Ensures filepath has a graph extension.
          * @param filepath Input filepath
-         * @return Filepath with .json extension
+         * @return Filepath unchanged if it ends in .json or .vcgb (binary graph), otherwise with .json appended
          */
-        [[nodiscard]] static std::string EnsureJsonExtension(const std::string &filepath);
+        [[nodiscard]] static std::string EnsureGraphExtension(const std::string &filepath);
 
         /**
          * @brief Clears file path buffer.
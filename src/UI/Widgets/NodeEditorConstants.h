@@ -35,6 +35,9 @@ namespace VisionCraft::Constants
 
         /// @brief Minimum zoom level at which text is rendered (performance optimization)
         constexpr float kMinForText = 0.5f;
+
+        /// @brief Minimum zoom level for full node detail; below it nodes are plain boxes and wires straight lines
+        constexpr float kMinForDetail = kMinForText;
     } // namespace Zoom
 
     /**
@@ -50,6 +53,12 @@ namespace VisionCraft::Constants
 
         /// @brief Alpha transparency value for grid lines (0-255)
         constexpr int kGridAlpha = 40;
+
+        /// @brief Edge of a node spatial index cell in world units (a default node spans one or two cells)
+        constexpr float kSpatialIndexCellSize = 512.0f;
+
+        /// @brief World units the culling rectangle extends past the view, covering nodes whose size changed unseen
+        constexpr float kCullingMargin = 128.0f;
     } // namespace Canvas
 
     // ========================================
@@ -176,6 +185,9 @@ namespace VisionCraft::Constants
 
         /// @brief Bezier curve tension for connection curves
         constexpr float kBezierTension = 100.0f;
+
+        /// @brief Line segments per cached connection curve
+        constexpr int kCurveSegments = 24;
     } // namespace Connection
 
     // ========================================
@@ -266,6 +278,21 @@ namespace VisionCraft::Constants
             constexpr ImU32 kCreating = IM_COL32(200, 200, 200, 255);
         } // namespace Connection
 
+        /**
+         * @brief Cost heatmap overlay colors.
+         */
+        namespace CostOverlay
+        {
+            /// @brief Color the costliest node is tinted toward
+            constexpr ImU32 kHot = IM_COL32(230, 40, 30, 255);
+
+            /// @brief Border color for nodes on the critical path
+            constexpr ImU32 kCriticalPath = IM_COL32(255, 70, 200, 255);
+
+            /// @brief Text color for cost labels above nodes
+            constexpr ImU32 kLabel = IM_COL32(230, 230, 230, 255);
+        } // namespace CostOverlay
+
         /**
          * @brief Grid rendering colors.
          */
@@ -390,4 +417,83 @@ namespace VisionCraft::Constants
         } // namespace ParameterInput
     }     // namespace NodeRenderer
 
+    /**
+     * @brief Full-resolution image inspector constants.
+     */
+    namespace Inspector
+    {
+        /// @brief Initial inspector window width
+        constexpr float kDefaultWidth = 640.0f;
+
+        /// @brief Initial inspector window height
+        constexpr float kDefaultHeight = 480.0f;
+    } // namespace Inspector
+
+    /**
+     * @brief Cost heatmap overlay constants (see UI::Rendering::CostOverlay).
+     */
+    namespace CostOverlay
+    {
+        /// @brief Blend toward the hot color of the costliest node (0 = no tint, 1 = fully hot color)
+        constexpr float kMaxTint = 0.85f;
+
+        /// @brief Border thickness of nodes on the critical path in pixels
+        constexpr float kCriticalPathThickness = 3.0f;
+
+        /// @brief Gap between a node's top edge and its cost label in pixels
+        constexpr float kLabelOffset = 4.0f;
+
+        /// @brief Width of the overlay mode combo above the canvas
+        constexpr float kModeComboWidth = 110.0f;
+    } // namespace CostOverlay
+
+    /**
+     * @brief Main loop frame pacing constants (see UI::Rendering::FramePacer).
+     */
+    namespace FramePacing
+    {
+        /// @brief Default frame rate limit while a run or batch is in progress
+        constexpr int kDefaultMaxBusyFps = 30;
+
+        /// @brief Frames drawn after each event or wake, so ImGui settles hover and click state
+        constexpr int kFramesPerWake = 3;
+
+        /// @brief Longest idle wait in seconds, so ImGui timers such as tooltip delays still fire
+        constexpr double kIdleTimeoutSeconds = 0.5;
+    } // namespace FramePacing
+
+    /**
+     * @brief Frame-time profiler overlay constants (see UI::Rendering::FrameProfiler).
+     */
+    namespace FrameProfiler
+    {
+        /// @brief Frames kept for the rolling graphs and section averages
+        constexpr size_t kHistoryFrames = 240;
+
+        /// @brief GPU timer queries in flight; results are read this many frames late so the CPU never stalls
+        constexpr size_t kGpuQueryCount = 4;
+
+        /// @brief Height of each rolling graph in pixels
+        constexpr float kGraphHeight = 60.0f;
+
+        /// @brief Initial size of the overlay window in pixels
+        constexpr float kWindowWidth = 420.0f;
+        constexpr float kWindowHeight = 420.0f;
+    } // namespace FrameProfiler
+
+    /**
+     * @brief Periodic background save constants (see NodeEditorLayer::UpdateAutosave()).
+     */
+    namespace Autosave
+    {
+        /// @brief Seconds between autosaves of a changed graph
+        constexpr float kIntervalSeconds = 60.0f;
+
+        /// @brief Inserted before the extension of the document's path to name its autosave file
+        constexpr const char *kSuffix = ".autosave";
+
+        /// @brief Autosave file name, in the temp directory, of a graph that was never saved
+        constexpr const char *kUntitledName = "VisionCraft-untitled";
+    } // namespace Autosave
+
 } // namespace VisionCraft::Constants
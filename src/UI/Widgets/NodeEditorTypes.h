@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Nodes/Core/NodeEditor.h"
+#include <cstddef>
+#include <functional>
 #include <imgui.h>
 #include <string>
 
@@ -47,7 +49,7 @@ namespace VisionCraft::UI::Widgets
      */
     struct NodePin
     {
-        std::string name;
+        Nodes::SlotName name;
         PinType pinType;      // NEW: Execution or Data pin
         PinDataType dataType; // Only relevant for Data pins
         bool isInput;
@@ -110,12 +112,25 @@ namespace VisionCraft::UI::Widgets
     struct PinId
     {
         Nodes::NodeId nodeId;
-        std::string pinName;
+        Nodes::SlotName pinName;
 
         // C++20 spaceship operator - automatically generates all comparison operators
         auto operator<=>(const PinId &other) const = default;
     };
 
+    /**
+     * @brief Hash for PinId, for keying unordered containers by pin.
+     */
+    struct PinIdHash
+    {
+        [[nodiscard]] std::size_t operator()(const PinId &pin) const noexcept
+        {
+            const auto nameHash = std::hash<Nodes::SlotName>{}(pin.pinName);
+            return nameHash ^ (std::hash<Nodes::NodeId>{}(pin.nodeId) + 0x9e3779b97f4a7c15ULL + (nameHash << 6)
+                                  + (nameHash >> 2));
+        }
+    };
+
     /**
      * @brief Connection between two pins.
      *
@@ -132,6 +147,19 @@ namespace VisionCraft::UI::Widgets
         auto operator<=>(const NodeConnection &other) const = default;
     };
 
+    /**
+     * @brief Hash for NodeConnection, for keying unordered containers by connection.
+     */
+    struct NodeConnectionHash
+    {
+        [[nodiscard]] std::size_t operator()(const NodeConnection &connection) const noexcept
+        {
+            const auto outputHash = PinIdHash{}(connection.outputPin);
+            return outputHash ^ (PinIdHash{}(connection.inputPin) + 0x9e3779b97f4a7c15ULL + (outputHash << 6)
+                                    + (outputHash >> 2));
+        }
+    };
+
     /**
      * @brief Connection creation state.
      */
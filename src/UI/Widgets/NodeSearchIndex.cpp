@@ -0,0 +1,267 @@
+#include "UI/Widgets/NodeSearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+namespace VisionCraft::UI::Widgets
+{
+    namespace
+    {
+        std::string ToLower(std::string_view text)
+        {
+            std::string lower(text);
+            std::ranges::transform(lower, lower.begin(), [](unsigned char c) { return std::tolower(c); });
+            return lower;
+        }
+
+        void AddPosting(std::vector<uint32_t> &postings, uint32_t entry)
+        {
+            // Entries are indexed in ascending order, so a repeat is always the last element
+            if (postings.empty() || postings.back() != entry)
+            {
+                postings.push_back(entry);
+            }
+        }
+    } // namespace
+
+    void NodeSearchIndex::Build(std::vector<SearchableNodeInfo> nodeTypes)
+    {
+        entries = std::move(nodeTypes);
+        lowerNames.clear();
+        charMasks.clear();
+        for (auto &postings : charPostings)
+        {
+            postings.clear();
+        }
+        trigrams.clear();
+        entryByType.clear();
+        lastQuery.clear();
+        lastMatches.clear();
+
+        const auto count = static_cast<uint32_t>(entries.size());
+        lowerNames.reserve(count);
+        charMasks.reserve(count);
+        for (uint32_t entry = 0; entry < count; ++entry)
+        {
+            const auto &name = lowerNames.emplace_back(ToLower(entries[entry].displayName));
+            uint64_t mask = 0;
+            for (const unsigned char c : name)
+            {
+                const auto bit = CharBit(c);
+                mask |= uint64_t{ 1 } << bit;
+                AddPosting(charPostings[bit], entry);
+            }
+            charMasks.push_back(mask);
+            for (size_t i = 0; i + 3 <= name.size(); ++i)
+            {
+                AddPosting(trigrams[TrigramKey(name, i)], entry);
+            }
+            entryByType.emplace(entries[entry].typeId, entry);
+        }
+
+        rankOrder.resize(count);
+        for (uint32_t entry = 0; entry < count; ++entry)
+        {
+            rankOrder[entry] = entry;
+        }
+        std::ranges::stable_sort(rankOrder, [this](uint32_t a, uint32_t b) { return RanksBefore(a, b); });
+        rankOf.resize(count);
+        for (uint32_t rank = 0; rank < count; ++rank)
+        {
+            rankOf[rankOrder[rank]] = rank;
+        }
+    }
+
+    bool NodeSearchIndex::RecordUsage(const std::string &typeId)
+    {
+        const auto it = entryByType.find(typeId);
+        if (it == entryByType.end())
+        {
+            return false;
+        }
+
+        const uint32_t entry = it->second;
+        ++entries[entry].useCount;
+
+        // One more use can only move the entry forward; shift it past the entries it now outranks
+        uint32_t rank = rankOf[entry];
+        while (rank > 0 && RanksBefore(entry, rankOrder[rank - 1]))
+        {
+            rankOrder[rank] = rankOrder[rank - 1];
+            rankOf[rankOrder[rank]] = rank;
+            --rank;
+        }
+        rankOrder[rank] = entry;
+        rankOf[entry] = rank;
+        return true;
+    }
+
+    void NodeSearchIndex::Search(std::string_view query, std::vector<Match> &results)
+    {
+        results.clear();
+        const std::string lowerQuery = ToLower(query);
+
+        if (lowerQuery.empty())
+        {
+            results.reserve(rankOrder.size());
+            for (const auto entry : rankOrder)
+            {
+                results.push_back({ entry, 1.0f });
+            }
+            lastQuery.clear();
+            lastMatches.clear();
+            return;
+        }
+
+        // Anything matching the longer query also matches its prefix, so typing only rescores the
+        // previous matches
+        candidates.clear();
+        if (!lastQuery.empty() && lowerQuery.starts_with(lastQuery))
+        {
+            for (const auto &match : lastMatches)
+            {
+                candidates.push_back(match.entry);
+            }
+        }
+        else
+        {
+            uint64_t queryMask = 0;
+            const std::vector<uint32_t> *shortest = nullptr;
+            for (const unsigned char c : lowerQuery)
+            {
+                const auto bit = CharBit(c);
+                queryMask |= uint64_t{ 1 } << bit;
+                if (!shortest || charPostings[bit].size() < shortest->size())
+                {
+                    shortest = &charPostings[bit];
+                }
+            }
+            for (const auto entry : *shortest)
+            {
+                if ((charMasks[entry] & queryMask) == queryMask)
+                {
+                    candidates.push_back(entry);
+                }
+            }
+        }
+
+        const bool useTrigrams = lowerQuery.size() >= 3;
+        if (useTrigrams)
+        {
+            CollectTrigramCandidates(lowerQuery, trigramCandidates);
+        }
+
+        for (const auto entry : candidates)
+        {
+            const bool mayContain = !useTrigrams || std::ranges::binary_search(trigramCandidates, entry);
+            const float score = Score(lowerQuery, lowerNames[entry], mayContain);
+            if (score > 0.0f)
+            {
+                results.push_back({ entry, score });
+            }
+        }
+
+        lastQuery = lowerQuery;
+        lastMatches = results;
+
+        std::ranges::sort(results, [this](const Match &a, const Match &b) {
+            const int aUses = entries[a.entry].useCount;
+            const int bUses = entries[b.entry].useCount;
+            if (aUses != bUses)
+                return aUses > bUses;
+            if (a.score != b.score)
+                return a.score > b.score;
+            return rankOf[a.entry] < rankOf[b.entry];
+        });
+    }
+
+    float NodeSearchIndex::Score(std::string_view query, std::string_view target, bool mayContain)
+    {
+        if (query.empty())
+            return 1.0f;
+        if (target.empty())
+            return 0.0f;
+
+        const size_t pos = mayContain ? target.find(query) : std::string_view::npos;
+        if (pos != std::string_view::npos)
+        {
+            // Higher score for matches at the beginning and for shorter targets
+            const float positionBonus = 1.0f - (static_cast<float>(pos) / static_cast<float>(target.length()));
+            const float lengthBonus = static_cast<float>(query.length()) / static_cast<float>(target.length());
+            return positionBonus * 0.5f + lengthBonus * 0.5f;
+        }
+
+        // Fuzzy matching: all query characters appear in order in the target
+        size_t queryIdx = 0;
+        size_t targetIdx = 0;
+        while (queryIdx < query.length() && targetIdx < target.length())
+        {
+            if (query[queryIdx] == target[targetIdx])
+            {
+                ++queryIdx;
+            }
+            ++targetIdx;
+        }
+
+        if (queryIdx == query.length())
+        {
+            const float compactness = static_cast<float>(query.length()) / static_cast<float>(targetIdx);
+            return 0.3f + compactness * 0.2f; // Lower score than substring match
+        }
+
+        return 0.0f;
+    }
+
+    uint32_t NodeSearchIndex::CharBit(unsigned char c)
+    {
+        if (c >= 'a' && c <= 'z')
+            return c - 'a';
+        if (c >= '0' && c <= '9')
+            return 26 + (c - '0');
+        return 36 + (c % 28);
+    }
+
+    uint32_t NodeSearchIndex::TrigramKey(std::string_view text, size_t offset)
+    {
+        return (static_cast<uint32_t>(static_cast<unsigned char>(text[offset])) << 16)
+               | (static_cast<uint32_t>(static_cast<unsigned char>(text[offset + 1])) << 8)
+               | static_cast<uint32_t>(static_cast<unsigned char>(text[offset + 2]));
+    }
+
+    bool NodeSearchIndex::RanksBefore(uint32_t a, uint32_t b) const
+    {
+        if (entries[a].useCount != entries[b].useCount)
+            return entries[a].useCount > entries[b].useCount;
+        return entries[a].displayName < entries[b].displayName;
+    }
+
+    void NodeSearchIndex::CollectTrigramCandidates(std::string_view query, std::vector<uint32_t> &result) const
+    {
+        result.clear();
+        bool first = true;
+        std::vector<uint32_t> intersection;
+        for (size_t i = 0; i + 3 <= query.size(); ++i)
+        {
+            const auto it = trigrams.find(TrigramKey(query, i));
+            if (it == trigrams.end())
+            {
+                result.clear();
+                return;
+            }
+            if (first)
+            {
+                result = it->second;
+                first = false;
+                continue;
+            }
+            intersection.clear();
+            std::ranges::set_intersection(result, it->second, std::back_inserter(intersection));
+            result.swap(intersection);
+            if (result.empty())
+            {
+                return;
+            }
+        }
+    }
+} // namespace VisionCraft::UI::Widgets
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::UI::Widgets
+{
+    /**
+     * @brief Information about a node type for search palette.
+     */
+    struct SearchableNodeInfo
+    {
+        std::string typeId;      ///< Factory type ID (e.g., "Grayscale")
+        std::string displayName; ///< User-friendly name (e.g., "Grayscale")
+        std::string category;    ///< Category (e.g., "Processing")
+        int useCount = 0;        ///< Number of times this node type has been used
+    };
+
+    /**
+     * @brief Prebuilt search index over node type display names.
+     *
+     * Build() lowercases every name once and indexes it three ways: a mask of the characters it
+     * contains, a posting list per character and a posting list per trigram. A query is matched as a
+     * substring (scored higher, earlier and tighter matches first) or as an in-order subsequence of a
+     * name. Candidates come from the shortest posting list of the query's characters, filtered by the
+     * character mask; only names holding every query trigram are searched for the substring. While the
+     * query grows by typing, only the previous query's matches are rescored.
+     *
+     * Usage order (use count descending, then name) is kept in a rank list that RecordUsage() updates by
+     * moving one entry forward, so an empty query lists the catalogue without sorting it.
+     */
+    class NodeSearchIndex
+    {
+    public:
+        /**
+         * @brief One search result.
+         */
+        struct Match
+        {
+            uint32_t entry = 0; ///< Index into Entry()
+            float score = 0.0f; ///< Match score (see Score())
+        };
+
+        /**
+         * @brief Replaces the indexed node types.
+         * @param nodeTypes Node types (use counts are kept as given)
+         */
+        void Build(std::vector<SearchableNodeInfo> nodeTypes);
+
+        /**
+         * @brief Returns an indexed node type.
+         * @param entry Entry index
+         * @return Node type
+         */
+        [[nodiscard]] const SearchableNodeInfo &Entry(uint32_t entry) const
+        {
+            return entries[entry];
+        }
+
+        /**
+         * @brief Returns the number of indexed node types.
+         * @return Entry count
+         */
+        [[nodiscard]] size_t Size() const
+        {
+            return entries.size();
+        }
+
+        /**
+         * @brief Counts one use of a node type and moves it up the usage order.
+         * @param typeId Factory type ID
+         * @return False if the type is not indexed
+         */
+        bool RecordUsage(const std::string &typeId);
+
+        /**
+         * @brief Finds node types matching a query, most used first, then best match, then by name.
+         * @param query Search text (case-insensitive; empty lists every type)
+         * @param results Receives the matches (cleared first; reuse it to avoid allocating)
+         */
+        void Search(std::string_view query, std::vector<Match> &results);
+
+        /**
+         * @brief Scores a lowercase query against a lowercase name.
+         * @param query Lowercase query
+         * @param target Lowercase name
+         * @param mayContain False skips the substring test (the name lacks one of the query's trigrams)
+         * @return 0 for no match, otherwise up to 1 (substring matches generally outscore subsequence matches)
+         */
+        [[nodiscard]] static float Score(std::string_view query, std::string_view target, bool mayContain = true);
+
+    private:
+        /**
+         * @brief Returns the bit a character sets in a name's character mask.
+         * @param c Lowercase character
+         * @return Bit index (letters and digits have their own; other characters share the rest)
+         */
+        [[nodiscard]] static uint32_t CharBit(unsigned char c);
+
+        /**
+         * @brief Packs three characters into a trigram key.
+         * @param text Text holding at least three characters at offset
+         * @param offset First character
+         * @return Trigram key
+         */
+        [[nodiscard]] static uint32_t TrigramKey(std::string_view text, size_t offset);
+
+        /**
+         * @brief Checks if entry a comes before entry b in usage order.
+         */
+        [[nodiscard]] bool RanksBefore(uint32_t a, uint32_t b) const;
+
+        /**
+         * @brief Collects entries holding every trigram of a query.
+         * @param query Lowercase query of at least three characters
+         * @param result Receives ascending entry indices
+         */
+        void CollectTrigramCandidates(std::string_view query, std::vector<uint32_t> &result) const;
+
+        std::vector<SearchableNodeInfo> entries;                      ///< Indexed node types
+        std::vector<std::string> lowerNames;                          ///< Lowercase display name per entry
+        std::vector<uint64_t> charMasks;                              ///< Characters present per entry
+        std::array<std::vector<uint32_t>, 64> charPostings;           ///< Entries holding each CharBit()
+        std::unordered_map<uint32_t, std::vector<uint32_t>> trigrams; ///< Entries holding each trigram
+        std::unordered_map<std::string, uint32_t> entryByType;        ///< Entry of each type ID
+        std::vector<uint32_t> rankOrder;                              ///< Entries in usage order
+        std::vector<uint32_t> rankOf;                                 ///< Position of each entry in rankOrder
+        std::string lastQuery;                                        ///< Lowercase query of the last search
+        std::vector<Match> lastMatches;                               ///< Matches of lastQuery (narrowed next)
+        std::vector<uint32_t> candidates;                             ///< Scratch: entries to score
+        std::vector<uint32_t> trigramCandidates;                      ///< Scratch: entries holding all trigrams
+    };
+} // namespace VisionCraft::UI::Widgets
@@ -1,9 +1,8 @@
 #include "NodeSearchPalette.h"
-
-#include <algorithm>
-#include <cctype>
+#include "Nodes/Core/StartupProfile.h"
 
 #include <imgui.h>
+#include <utility>
 
 namespace VisionCraft::UI::Widgets
 {
@@ -17,6 +16,7 @@ namespace VisionCraft::UI::Widgets
         m_searchBuffer[0] = '\0';
         m_selectedIndex = 0;
         m_focusSearchInput = true;
+        EnsureIndex();
 
         // Initialize filtered results with all nodes
         UpdateSearchResults();
@@ -61,16 +61,16 @@ namespace VisionCraft::UI::Widgets
             // Handle keyboard navigation
             if (ImGui::IsKeyPressed(ImGuiKey_DownArrow))
             {
-                m_selectedIndex = (m_selectedIndex + 1) % static_cast<int>(m_filteredNodes.size());
+                m_selectedIndex = (m_selectedIndex + 1) % static_cast<int>(m_results.size());
             }
             else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow))
             {
-                m_selectedIndex = (m_selectedIndex - 1 + static_cast<int>(m_filteredNodes.size()))
-                                  % static_cast<int>(m_filteredNodes.size());
+                m_selectedIndex = (m_selectedIndex - 1 + static_cast<int>(m_results.size()))
+                                  % static_cast<int>(m_results.size());
             }
-            else if (ImGui::IsKeyPressed(ImGuiKey_Enter) && !m_filteredNodes.empty())
+            else if (ImGui::IsKeyPressed(ImGuiKey_Enter) && !m_results.empty())
             {
-                selectedNodeType = m_filteredNodes[m_selectedIndex].typeId;
+                selectedNodeType = m_index.Entry(m_results[m_selectedIndex].entry).typeId;
                 RecordNodeUsage(selectedNodeType);
                 Close();
                 ImGui::CloseCurrentPopup();
@@ -86,15 +86,15 @@ namespace VisionCraft::UI::Widgets
             // Results list
             ImGui::BeginChild("##SearchResults", ImVec2(0, 0), false);
 
-            if (m_filteredNodes.empty())
+            if (m_results.empty())
             {
                 ImGui::TextDisabled("No nodes found");
             }
             else
             {
-                for (int i = 0; i < static_cast<int>(m_filteredNodes.size()); ++i)
+                for (int i = 0; i < static_cast<int>(m_results.size()); ++i)
                 {
-                    const auto &node = m_filteredNodes[i];
+                    const auto &node = m_index.Entry(m_results[i].entry);
                     bool isSelected = (i == m_selectedIndex);
 
                     // Format: "Display Name (Category)" or just "Display Name" if no category
@@ -145,24 +145,19 @@ namespace VisionCraft::UI::Widgets
 
     void NodeSearchPalette::SetAvailableNodeTypes(const std::vector<SearchableNodeInfo> &nodeTypes)
     {
-        m_availableNodes = nodeTypes;
+        m_pendingTypes = nodeTypes;
+        m_indexPending = true;
         if (m_isOpen)
         {
+            EnsureIndex();
             UpdateSearchResults();
         }
     }
 
     void NodeSearchPalette::RecordNodeUsage(const std::string &typeId)
     {
-        // Find and increment use count
-        for (auto &node : m_availableNodes)
-        {
-            if (node.typeId == typeId)
-            {
-                node.useCount++;
-                break;
-            }
-        }
+        EnsureIndex();
+        m_index.RecordUsage(typeId);
     }
 
     void NodeSearchPalette::GetOpenPosition(float &outX, float &outY) const
@@ -171,98 +166,29 @@ namespace VisionCraft::UI::Widgets
         outY = m_openPosY;
     }
 
-    void NodeSearchPalette::UpdateSearchResults()
+    std::string_view NodeSearchPalette::GetHighlightedType() const
     {
-        m_filteredNodes.clear();
-
-        std::string query(m_searchBuffer);
-        // Convert query to lowercase for case-insensitive search
-        std::transform(query.begin(), query.end(), query.begin(), [](unsigned char c) { return std::tolower(c); });
-
-        // If query is empty, show all nodes
-        if (query.empty())
+        if (m_selectedIndex < 0 || m_selectedIndex >= static_cast<int>(m_results.size()))
         {
-            m_filteredNodes = m_availableNodes;
+            return {};
         }
-        else
-        {
-            // Filter and score nodes
-            for (auto node : m_availableNodes)
-            {
-                float score = CalculateFuzzyScore(query, node.displayName);
-                if (score > 0.0f)
-                {
-                    node.matchScore = score;
-                    m_filteredNodes.push_back(node);
-                }
-            }
-        }
-
-        // Sort results
-        SortSearchResults();
+        return m_index.Entry(m_results[m_selectedIndex].entry).typeId;
     }
 
-    float NodeSearchPalette::CalculateFuzzyScore(const std::string &query, const std::string &target)
+    void NodeSearchPalette::UpdateSearchResults()
     {
-        if (query.empty())
-            return 1.0f;
-        if (target.empty())
-            return 0.0f;
-
-        // Convert target to lowercase
-        std::string lowerTarget = target;
-        std::transform(lowerTarget.begin(), lowerTarget.end(), lowerTarget.begin(), [](unsigned char c) {
-            return std::tolower(c);
-        });
-
-        // Check if target contains the query as a substring
-        size_t pos = lowerTarget.find(query);
-        if (pos != std::string::npos)
-        {
-            // Higher score for matches at the beginning
-            float positionBonus = 1.0f - (static_cast<float>(pos) / static_cast<float>(lowerTarget.length()));
-            // Higher score for exact matches (shorter targets)
-            float lengthBonus = static_cast<float>(query.length()) / static_cast<float>(lowerTarget.length());
-            return positionBonus * 0.5f + lengthBonus * 0.5f;
-        }
-
-        // Fuzzy matching: check if all query characters appear in order in target
-        size_t queryIdx = 0;
-        size_t targetIdx = 0;
-        int matchedChars = 0;
-
-        while (queryIdx < query.length() && targetIdx < lowerTarget.length())
-        {
-            if (query[queryIdx] == lowerTarget[targetIdx])
-            {
-                matchedChars++;
-                queryIdx++;
-            }
-            targetIdx++;
-        }
-
-        if (queryIdx == query.length())
-        {
-            // All characters matched in order
-            float completeness = static_cast<float>(matchedChars) / static_cast<float>(query.length());
-            float compactness = static_cast<float>(matchedChars) / static_cast<float>(targetIdx);
-            return completeness * 0.3f + compactness * 0.2f; // Lower score than substring match
-        }
-
-        return 0.0f; // No match
+        m_index.Search(m_searchBuffer, m_results);
     }
 
-    void NodeSearchPalette::SortSearchResults()
+    void NodeSearchPalette::EnsureIndex()
     {
-        std::sort(m_filteredNodes.begin(),
-            m_filteredNodes.end(),
-            [](const SearchableNodeInfo &a, const SearchableNodeInfo &b) {
-                // Sort by: 1. Use count (descending), 2. Match score (descending), 3. Display name (ascending)
-                if (a.useCount != b.useCount)
-                    return a.useCount > b.useCount;
-                if (a.matchScore != b.matchScore)
-                    return a.matchScore > b.matchScore;
-                return a.displayName < b.displayName;
-            });
+        if (!m_indexPending)
+        {
+            return;
+        }
+        Nodes::StartupScope scope("Search palette index");
+        m_index.Build(std::move(m_pendingTypes));
+        m_pendingTypes = {};
+        m_indexPending = false;
     }
 } // namespace VisionCraft::UI::Widgets
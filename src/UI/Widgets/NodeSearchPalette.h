@@ -1,29 +1,22 @@
 #pragma once
 
+#include "UI/Widgets/NodeSearchIndex.h"
+
 #include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace VisionCraft::UI::Widgets
 {
-    /**
-     * @brief Information about a node type for search palette.
-     */
-    struct SearchableNodeInfo
-    {
-        std::string typeId;      ///< Factory type ID (e.g., "Grayscale")
-        std::string displayName; ///< User-friendly name (e.g., "Grayscale")
-        std::string category;    ///< Category (e.g., "Processing")
-        int useCount = 0;        ///< Number of times this node type has been used
-        float matchScore = 0.0f; ///< Fuzzy search match score (0.0 = no match, 1.0 = perfect match)
-    };
-
     /**
      * @brief Searchable node creation palette widget.
      *
      * Provides a fuzzy-searchable dialog for quick node creation,
      * similar to Blender's Shift+A menu or quick search dialogs in other node editors.
      * Tracks recently used nodes and displays them first in search results.
+     * Matching runs against a NodeSearchIndex built once per SetAvailableNodeTypes() call, on the first
+     * Open() or RecordNodeUsage() after it, so startup does not pay for a palette nobody has opened yet.
      */
     class NodeSearchPalette
     {
@@ -79,32 +72,32 @@ namespace VisionCraft::UI::Widgets
          */
         void GetOpenPosition(float &outX, float &outY) const;
 
-    private:
         /**
-         * @brief Performs fuzzy search on node types.
+         * @brief Returns the type of the highlighted result, the one Enter would create.
+         * @return Factory type ID, or empty if there are no results
          */
-        void UpdateSearchResults();
+        [[nodiscard]] std::string_view GetHighlightedType() const;
 
+    private:
         /**
-         * @brief Calculates fuzzy match score between query and target string.
-         * @param query Search query (lowercase)
-         * @param target Target string to match against (will be converted to lowercase)
-         * @return Match score (0.0 = no match, 1.0 = perfect match)
+         * @brief Searches the index for the current query.
          */
-        [[nodiscard]] static float CalculateFuzzyScore(const std::string &query, const std::string &target);
+        void UpdateSearchResults();
 
         /**
-         * @brief Sorts search results by match score and usage count.
+         * @brief Builds the index from the pending node types, if SetAvailableNodeTypes() left any.
          */
-        void SortSearchResults();
+        void EnsureIndex();
 
-        bool m_isOpen = false;                            ///< Whether the palette is currently open
-        float m_openPosX = 0.0f;                          ///< Screen X position where palette was opened
-        float m_openPosY = 0.0f;                          ///< Screen Y position where palette was opened
-        char m_searchBuffer[256] = { 0 };                 ///< Input buffer for search query
-        std::vector<SearchableNodeInfo> m_availableNodes; ///< All available node types
-        std::vector<SearchableNodeInfo> m_filteredNodes;  ///< Filtered search results
-        int m_selectedIndex = 0;                          ///< Currently selected index in filtered results
-        bool m_focusSearchInput = false;                  ///< Flag to focus search input next frame
+        bool m_isOpen = false;                          ///< Whether the palette is currently open
+        float m_openPosX = 0.0f;                        ///< Screen X position where palette was opened
+        float m_openPosY = 0.0f;                        ///< Screen Y position where palette was opened
+        char m_searchBuffer[256] = { 0 };               ///< Input buffer for search query
+        NodeSearchIndex m_index;                        ///< Index over all available node types
+        std::vector<SearchableNodeInfo> m_pendingTypes; ///< Types not yet indexed
+        bool m_indexPending = false;                    ///< m_pendingTypes replaces the index on next use
+        std::vector<NodeSearchIndex::Match> m_results;  ///< Matches of the current query
+        int m_selectedIndex = 0;                        ///< Currently selected index in filtered results
+        bool m_focusSearchInput = false;                ///< Flag to focus search input next frame
     };
 } // namespace VisionCraft::UI::Widgets
@@ -0,0 +1,213 @@
+#include "UI/Widgets/ResultsGallery.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <imgui.h>
+
+#include <algorithm>
+#include <utility>
+
+namespace VisionCraft::UI::Widgets
+{
+    namespace
+    {
+        float ToMilliseconds(std::chrono::microseconds duration)
+        {
+            return static_cast<float>(duration.count()) / 1000.0f;
+        }
+    } // namespace
+
+    ResultsGallery::ResultsGallery()
+        : loader(Constants::Gallery::kThumbnailEdge, Constants::Gallery::kMaxPendingThumbnails)
+    {
+    }
+
+    void ResultsGallery::Add(Vision::IO::BatchItem item)
+    {
+        std::scoped_lock lock(incomingMutex);
+        incoming.push_back(std::move(item));
+    }
+
+    void ResultsGallery::Clear()
+    {
+        {
+            std::scoped_lock lock(incomingMutex);
+            incoming.clear();
+        }
+        loader.Cancel();
+        items.clear();
+        rows.clear();
+        failedCount = 0;
+        executedCount = 0;
+        totalTime = {};
+        maxTime = {};
+        textures.clear();
+        textureOrder.clear();
+        unreadable.clear();
+    }
+
+    void ResultsGallery::Render()
+    {
+        MergeIncoming();
+        UploadReady();
+
+        if (items.empty())
+        {
+            ImGui::TextDisabled("No batch results yet - run a batch to list its outputs here");
+            return;
+        }
+
+        ImGui::Text("%zu files: %zu written, %zu failed; graph time avg %.2f ms, max %.2f ms",
+            items.size(),
+            items.size() - failedCount,
+            failedCount,
+            executedCount > 0 ? ToMilliseconds(totalTime) / static_cast<float>(executedCount) : 0.0f,
+            ToMilliseconds(maxTime));
+        if (ImGui::Checkbox("Failed Only", &failedOnly))
+        {
+            RebuildRows();
+        }
+
+        constexpr ImGuiTableFlags kTableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+                                                | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+        if (!ImGui::BeginTable("ResultsGallery", 4, kTableFlags))
+        {
+            return;
+        }
+
+        const auto edge = static_cast<float>(Constants::Gallery::kThumbnailEdge);
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Preview", ImGuiTableColumnFlags_WidthFixed, edge);
+        ImGui::TableSetupColumn("File", ImGuiTableColumnFlags_WidthStretch);
+        ImGui::TableSetupColumn("Status", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableSetupColumn("Graph (ms)", ImGuiTableColumnFlags_WidthFixed);
+        ImGui::TableHeadersRow();
+
+        // Rows have a fixed height, so the clipper lays out only the ones on screen
+        const float rowHeight = edge + ImGui::GetStyle().CellPadding.y * 2.0f;
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()), rowHeight);
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const size_t index = rows[static_cast<size_t>(row)];
+                const auto &item = items[index];
+                ImGui::TableNextRow(ImGuiTableRowFlags_None, rowHeight);
+
+                ImGui::TableNextColumn();
+                if (const auto *cached = item.succeeded ? AcquireTexture(index) : nullptr)
+                {
+                    ImGui::Image(
+                        static_cast<ImTextureID>(cached->texture->Get()), ImVec2(cached->width, cached->height));
+                }
+                else
+                {
+                    ImGui::Dummy(ImVec2(edge, edge));
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(item.source.filename().string().c_str());
+                if (ImGui::IsItemHovered())
+                {
+                    ImGui::SetTooltip("%s\n-> %s",
+                        item.source.string().c_str(),
+                        item.succeeded ? item.destination.string().c_str() : "(not written)");
+                }
+
+                ImGui::TableNextColumn();
+                if (item.succeeded)
+                {
+                    ImGui::TextUnformatted("Written");
+                }
+                else
+                {
+                    ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Failed");
+                }
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%.2f", ToMilliseconds(item.executionTime));
+            }
+        }
+        ImGui::EndTable();
+
+        EvictTextures();
+    }
+
+    void ResultsGallery::MergeIncoming()
+    {
+        std::vector<Vision::IO::BatchItem> added;
+        {
+            std::scoped_lock lock(incomingMutex);
+            added.swap(incoming);
+        }
+
+        for (auto &item : added)
+        {
+            failedCount += item.succeeded ? 0 : 1;
+            executedCount += item.executionTime.count() > 0 ? 1 : 0;
+            totalTime += item.executionTime;
+            maxTime = std::max(maxTime, item.executionTime);
+            if (!failedOnly || !item.succeeded)
+            {
+                rows.push_back(items.size());
+            }
+            items.push_back(std::move(item));
+        }
+    }
+
+    void ResultsGallery::UploadReady()
+    {
+        for (auto &thumbnail : loader.TakeReady())
+        {
+            const auto index = static_cast<size_t>(thumbnail.key);
+            auto texture = std::make_unique<Vision::IO::StreamingTexture>();
+            if (thumbnail.image.empty() || !texture->Upload(thumbnail.image))
+            {
+                unreadable.insert(index);
+                continue;
+            }
+
+            textureOrder.push_front(index);
+            textures.insert_or_assign(index,
+                CachedTexture{ .texture = std::move(texture),
+                    .width = static_cast<float>(thumbnail.image.cols),
+                    .height = static_cast<float>(thumbnail.image.rows),
+                    .lruPosition = textureOrder.begin() });
+        }
+    }
+
+    const ResultsGallery::CachedTexture *ResultsGallery::AcquireTexture(size_t index)
+    {
+        if (auto it = textures.find(index); it != textures.end())
+        {
+            textureOrder.splice(textureOrder.begin(), textureOrder, it->second.lruPosition);
+            return &it->second;
+        }
+        if (!unreadable.contains(index))
+        {
+            loader.Request(index, items[index].destination);
+        }
+        return nullptr;
+    }
+
+    void ResultsGallery::EvictTextures()
+    {
+        while (textureOrder.size() > Constants::Gallery::kMaxTextures)
+        {
+            textures.erase(textureOrder.back());
+            textureOrder.pop_back();
+        }
+    }
+
+    void ResultsGallery::RebuildRows()
+    {
+        rows.clear();
+        for (size_t index = 0; index < items.size(); ++index)
+        {
+            if (!failedOnly || !items[index].succeeded)
+            {
+                rows.push_back(index);
+            }
+        }
+    }
+} // namespace VisionCraft::UI::Widgets
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Vision/IO/BatchProcessor.h"
+#include "Vision/IO/StreamingTexture.h"
+#include "Vision/IO/ThumbnailLoader.h"
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace VisionCraft::UI::Widgets
+{
+    /**
+     * @brief Scrollable list of batch results with thumbnails and per-file graph times.
+     *
+     * Batches may write tens of thousands of files, so the list is virtualized with ImGuiListClipper: only
+     * the rows on screen are laid out, and only they request thumbnails. A ThumbnailLoader decodes the
+     * written files on its own thread, newest request first; the render thread only uploads the finished
+     * thumbnails. At most Constants::Gallery::kMaxTextures thumbnail textures are kept, the least recently
+     * drawn ones are freed first, and scrolling back to a row decodes its thumbnail again.
+     *
+     * Add() may be called from any thread (batch pipeline callbacks); every other method must be called on
+     * the thread owning the OpenGL context.
+     */
+    class ResultsGallery
+    {
+    public:
+        /**
+         * @brief Constructs an empty gallery.
+         */
+        ResultsGallery();
+
+        /**
+         * @brief Appends a finished file; shown from the next Render().
+         * @param item Outcome of the file
+         */
+        void Add(Vision::IO::BatchItem item);
+
+        /**
+         * @brief Drops every result and thumbnail, e.g. when a new batch starts.
+         */
+        void Clear();
+
+        /**
+         * @brief Renders the summary line and the result list (call every frame while visible).
+         */
+        void Render();
+
+    private:
+        /**
+         * @brief Thumbnail texture of one result.
+         */
+        struct CachedTexture
+        {
+            std::unique_ptr<Vision::IO::StreamingTexture> texture; ///< Uploaded thumbnail
+            float width = 0.0f;                                    ///< Thumbnail width in pixels
+            float height = 0.0f;                                   ///< Thumbnail height in pixels
+            std::list<size_t>::iterator lruPosition;               ///< Position in textureOrder
+        };
+
+        /**
+         * @brief Moves results added by other threads into items and updates the totals.
+         */
+        void MergeIncoming();
+
+        /**
+         * @brief Uploads thumbnails the loader finished.
+         */
+        void UploadReady();
+
+        /**
+         * @brief Returns a result's thumbnail, requesting it if it is not uploaded.
+         * @param index Index into items
+         * @return Cached texture, or nullptr while it is decoding (or if the file is unreadable)
+         */
+        const CachedTexture *AcquireTexture(size_t index);
+
+        /**
+         * @brief Frees the least recently drawn textures beyond Constants::Gallery::kMaxTextures.
+         */
+        void EvictTextures();
+
+        /**
+         * @brief Rebuilds rows from items and the filter.
+         */
+        void RebuildRows();
+
+        std::mutex incomingMutex;                           ///< Guards incoming
+        std::vector<Vision::IO::BatchItem> incoming;        ///< Added since the last frame
+        std::vector<Vision::IO::BatchItem> items;           ///< Results in completion order
+        std::vector<size_t> rows;                           ///< Indices into items that are listed
+        bool failedOnly = false;                            ///< List only failed files
+        size_t failedCount = 0;                             ///< Failed items
+        size_t executedCount = 0;                           ///< Items whose graph ran
+        std::chrono::microseconds totalTime{ 0 };           ///< Sum of graph run times
+        std::chrono::microseconds maxTime{ 0 };             ///< Longest graph run time
+        std::unordered_map<size_t, CachedTexture> textures; ///< Thumbnails by item index
+        std::list<size_t> textureOrder;                     ///< Item indices, most recently drawn first
+        std::unordered_set<size_t> unreadable;              ///< Items whose file could not be decoded
+        Vision::IO::ThumbnailLoader loader;                 ///< Decodes thumbnails off the render thread
+    };
+} // namespace VisionCraft::UI::Widgets
@@ -0,0 +1,54 @@
+#include "Vision/Algorithms/BranchNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+namespace VisionCraft::Vision::Algorithms
+{
+    BranchNode::BranchNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin(kTruePin);
+        CreateExecutionOutputPin(kFalsePin);
+
+        // Data pins
+        CreateInputSlot("Condition", false).SetDataType(Nodes::SlotDataType::Any); // Numbers are read too
+        CreateOutputSlot("Result").SetDataType(Nodes::SlotDataType::Bool);
+    }
+
+    void BranchNode::Process()
+    {
+        const bool condition = ReadCondition();
+        LOG_HOT_DEBUG("BranchNode {}: Taking {}", GetName(), condition ? kTruePin : kFalsePin);
+        SetOutputSlotData("Result", condition);
+    }
+
+    bool BranchNode::IsCacheable() const
+    {
+        return false;
+    }
+
+    bool BranchNode::BranchesExecution() const
+    {
+        return true;
+    }
+
+    bool BranchNode::IsExecutionOutputTaken(const std::string &pinName) const
+    {
+        // The output slot, unlike a member, is private to the ExecutionContext that ran the node
+        const auto result = GetOutputSlot("Result").GetData<bool>();
+        return result && pinName == (*result ? kTruePin : kFalsePin);
+    }
+
+    bool BranchNode::ReadCondition() const
+    {
+        // Numbers first: a bool read falls back to the default when a number is connected
+        if (const auto count = GetInputValue<int>("Condition"))
+            return *count != 0;
+        if (const auto value = GetInputValue<double>("Condition"))
+            return *value != 0.0;
+        if (const auto value = GetInputValue<float>("Condition"))
+            return *value != 0.0f;
+        return GetInputValue<bool>("Condition").value_or(false);
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <string>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node continuing the execution flow through True or False depending on its Condition input.
+     *
+     * Condition takes a bool or a number (nonzero = true), e.g. the Count of a cheap MaskLogic pre-check, so
+     * an expensive analysis wired to True only runs for the frames that need it. Steps reached only through
+     * the untaken pin are bypassed: they do not run and their outputs are cleared. Result repeats the decision.
+     */
+    class BranchNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs branch node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        BranchNode(Nodes::NodeId id, const std::string &name = "Branch");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "BranchNode";
+        }
+
+        /**
+         * @brief Evaluates Condition into Result.
+         */
+        void Process() override;
+
+        /**
+         * @brief Re-evaluates the condition on every run it is reached.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override;
+
+        /**
+         * @brief Picks True or False at runtime.
+         * @return Always true
+         */
+        [[nodiscard]] bool BranchesExecution() const override;
+
+        /**
+         * @brief Checks a pin against the last decision.
+         * @param pinName "True" or "False"
+         * @return True if pinName matches Result (neither pin is taken before the first run)
+         */
+        [[nodiscard]] bool IsExecutionOutputTaken(const std::string &pinName) const override;
+
+        inline static const std::string kTruePin{ "True" };   ///< Execution output taken for a true condition
+        inline static const std::string kFalsePin{ "False" }; ///< Execution output taken for a false condition
+
+    private:
+        /**
+         * @brief Reads the Condition slot.
+         * @return Condition as bool (false if the slot holds neither a bool nor a number)
+         */
+        [[nodiscard]] bool ReadCondition() const;
+    };
+} // namespace VisionCraft::Vision::Algorithms
@@ -1,6 +1,9 @@
 #include "Vision/Algorithms/CannyEdgeNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
 #include <stdexcept>
+#include <utility>
 
 namespace VisionCraft::Vision::Algorithms
 {
@@ -11,80 +14,131 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("LowThreshold", 50.0);
         CreateInputSlot("HighThreshold", 150.0);
         CreateInputSlot("ApertureSize", 3);
         CreateInputSlot("L2Gradient", false);
-        CreateOutputSlot("Output");
+        CreateInputSlot("PackMask", false);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void CannyEdgeNode::Process()
     {
-        auto inputData = GetInputValue<cv::Mat>("Input");
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty())
         {
-            LOG_WARN("CannyEdgeNode {}: No input image provided", GetName());
-            inputImage = cv::Mat();
-            outputImage = cv::Mat();
+            LOG_HOT_WARN("CannyEdgeNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
 
-        inputImage = *inputData;
+        const cv::Mat &inputImage = *inputData;
 
         try
         {
-            const auto lowThreshold = GetInputValue<double>("LowThreshold").value_or(50.0);
-            const auto highThreshold = GetInputValue<double>("HighThreshold").value_or(150.0);
-            auto apertureSize = GetInputValue<int>("ApertureSize").value_or(3);
-            const auto l2Gradient = GetInputValue<bool>("L2Gradient").value_or(false);
+            const auto parameters = ReadParameters();
 
-            if (apertureSize != 3 && apertureSize != 5 && apertureSize != 7) [[unlikely]]
-            {
-                LOG_WARN("CannyEdgeNode {}: Invalid aperture size ({}), using 3", GetName(), apertureSize);
-                apertureSize = 3;
-            }
-
-            if (lowThreshold >= highThreshold)
-            {
-                LOG_WARN("CannyEdgeNode {}: Low threshold ({}) should be less than high threshold ({})",
-                    GetName(),
-                    lowThreshold,
-                    highThreshold);
-            }
+            // Shared with every other node reading this input; single-channel images pass as they are
+            const cv::Mat grayImage = GetDerivedImage(inputImage, Nodes::DerivedImage::Gray);
 
-            cv::Mat grayImage;
-            if (inputImage.channels() > 1)
+            // A fresh buffer each run: the previous output may still be shared downstream
+            cv::Mat result = CreateOutputImage();
+            cv::Canny(grayImage,
+                result,
+                parameters.lowThreshold,
+                parameters.highThreshold,
+                parameters.apertureSize,
+                parameters.l2Gradient);
+            if (parameters.packMask)
             {
-                cv::cvtColor(inputImage, grayImage, cv::COLOR_BGR2GRAY);
+                SetOutputSlotData("Output", Nodes::BitMask::FromImage(result));
             }
             else
             {
-                grayImage = inputImage; // Shallow copy - cv::Mat uses reference counting
+                SetOutputSlotData("Output", std::move(result));
             }
 
-            cv::Canny(grayImage, outputImage, lowThreshold, highThreshold, apertureSize, l2Gradient);
-            SetOutputSlotData("Output", outputImage);
-
-            LOG_INFO("CannyEdgeNode {}: Applied Canny edge detection (low: {}, high: {}, aperture: {}, l2: {})",
+            LOG_HOT_INFO("CannyEdgeNode {}: Applied Canny edge detection (low: {}, high: {}, aperture: {}, l2: {})",
                 GetName(),
-                lowThreshold,
-                highThreshold,
-                apertureSize,
-                l2Gradient);
+                parameters.lowThreshold,
+                parameters.highThreshold,
+                parameters.apertureSize,
+                parameters.l2Gradient);
         }
         catch (const cv::Exception &e)
         {
             LOG_ERROR("CannyEdgeNode {}: OpenCV error: {}", GetName(), e.what());
-            outputImage = cv::Mat();
             ClearOutputSlot("Output");
         }
         catch (const std::exception &e)
         {
             LOG_ERROR("CannyEdgeNode {}: Error processing image: {}", GetName(), e.what());
-            outputImage = cv::Mat();
             ClearOutputSlot("Output");
         }
     }
+
+    CannyEdgeNode::Parameters CannyEdgeNode::ReadParameters() const
+    {
+        const auto lowThreshold = GetInputValue<double>("LowThreshold").value_or(50.0);
+        const auto highThreshold = GetInputValue<double>("HighThreshold").value_or(150.0);
+        auto apertureSize = GetInputValue<int>("ApertureSize").value_or(3);
+        const auto l2Gradient = GetInputValue<bool>("L2Gradient").value_or(false);
+        const auto packMask = GetInputValue<bool>("PackMask").value_or(false);
+
+        if (apertureSize != 3 && apertureSize != 5 && apertureSize != 7) [[unlikely]]
+        {
+            LOG_HOT_WARN("CannyEdgeNode {}: Invalid aperture size ({}), using 3", GetName(), apertureSize);
+            apertureSize = 3;
+        }
+
+        if (lowThreshold >= highThreshold)
+        {
+            LOG_HOT_WARN("CannyEdgeNode {}: Low threshold ({}) should be less than high threshold ({})",
+                GetName(),
+                lowThreshold,
+                highThreshold);
+        }
+        return Parameters{ .lowThreshold = lowThreshold,
+            .highThreshold = highThreshold,
+            .apertureSize = apertureSize,
+            .l2Gradient = l2Gradient,
+            .packMask = packMask };
+    }
+
+    std::optional<Nodes::ImageShape> CannyEdgeNode::InferOutputShape(
+        const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+        if (CV_MAT_DEPTH(input->type) != CV_8U)
+        {
+            throw std::invalid_argument("Canny edge detection needs an 8-bit image");
+        }
+        return Nodes::ImageShape{ .size = input->size, .type = CV_8UC1 };
+    }
+
+    bool CannyEdgeNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const auto parameters = ReadParameters();
+        if (parameters.packMask)
+        {
+            return writer.Fail("PackMask has no compiled form");
+        }
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("cv::Canny(" + writer.Gray(input) + ", " + writer.Output("Output") + ", " +
+                    writer.Constant("LowThreshold", parameters.lowThreshold) + ", " +
+                    writer.Constant("HighThreshold", parameters.highThreshold) + ", " +
+                    writer.Constant("ApertureSize", parameters.apertureSize) + ", " +
+                    writer.Constant("L2Gradient", parameters.l2Gradient) + ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
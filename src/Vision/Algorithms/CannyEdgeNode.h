@@ -7,6 +7,9 @@ namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for Canny edge detection.
+     *
+     * With PackMask set, the edge map is output as a Nodes::BitMask, an eighth of the bytes for mask nodes
+     * downstream; other consumers still read a 0/255 image.
      */
     class CannyEdgeNode : public Nodes::Node
     {
@@ -37,22 +40,38 @@ namespace VisionCraft::Vision::Algorithms
          */
         void Process() override;
 
+        /**
+         * @brief Keeps the input's size as an 8-bit single-channel edge map.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         * @throws std::invalid_argument for images that are not 8-bit, which cv::Canny rejects
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Writes the edge detection as a cv::Canny call on the gray input.
+         * @param writer Receives the node's code
+         * @return False with PackMask set
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
         /**
          * @brief Sets input image.
          * @param image Input image
          */
         void SetInputImage(const cv::Mat &image)
         {
-            inputImage = image;
+            SetInputSlotData("Input", image);
         }
 
         /**
          * @brief Returns processed edge image.
-         * @return Edge-detected image
+         * @return Edge-detected image held by the Output slot (empty if none)
          */
-        const cv::Mat &GetOutputImage() const
+        [[nodiscard]] cv::Mat GetOutputImage() const
         {
-            return outputImage;
+            return GetOutputSlot("Output").GetData<cv::Mat>().value_or(cv::Mat{});
         }
 
         /**
@@ -61,11 +80,27 @@ namespace VisionCraft::Vision::Algorithms
          */
         bool HasValidOutput() const
         {
-            return !outputImage.empty();
+            const auto output = GetOutputSlot("Output").GetDataIf<cv::Mat>();
+            return output && !output->empty();
         }
 
-    private:
-        cv::Mat inputImage;  ///< Input image for edge detection
-        cv::Mat outputImage; ///< Resulting edge-detected image
+    protected:
+        /**
+         * @brief Validated edge detection parameters.
+         */
+        struct Parameters
+        {
+            double lowThreshold = 50.0;   ///< Hysteresis lower threshold
+            double highThreshold = 150.0; ///< Hysteresis upper threshold
+            int apertureSize = 3;         ///< Sobel aperture (3, 5 or 7)
+            bool l2Gradient = false;      ///< Use the L2 gradient norm
+            bool packMask = false;        ///< Output the edges as a Nodes::BitMask
+        };
+
+        /**
+         * @brief Reads parameters, replacing an invalid aperture size with 3.
+         * @return Parameters safe to pass to cv::Canny
+         */
+        [[nodiscard]] Parameters ReadParameters() const;
     };
 } // namespace VisionCraft::Vision::Algorithms
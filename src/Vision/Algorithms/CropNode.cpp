@@ -0,0 +1,143 @@
+#include "Vision/Algorithms/CropNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    CropNode::CropNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("X", 0);
+        CreateInputSlot("Y", 0);
+        CreateInputSlot("Width", 0);  // 0 means up to the right edge
+        CreateInputSlot("Height", 0); // 0 means up to the bottom edge
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    void CropNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CropNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        try
+        {
+            const auto region = GetInputRegion(inputData->size());
+            if (!region)
+            {
+                LOG_WARN("CropNode {}: Crop rectangle is empty or outside the {}x{} image",
+                    GetName(),
+                    inputData->cols,
+                    inputData->rows);
+                ClearOutputSlot("Output");
+                return;
+            }
+
+            cv::Mat outputImage = CreateOutputImage();
+            (*inputData)(*region).copyTo(outputImage);
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CropNode {}: Cropped {}x{} at ({}, {})",
+                GetName(),
+                region->width,
+                region->height,
+                region->x,
+                region->y);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CropNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CropNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    std::optional<cv::Rect> CropNode::GetInputRegion(const cv::Size &inputSize) const
+    {
+        const auto x = GetInputValue<int>("X").value_or(0);
+        const auto y = GetInputValue<int>("Y").value_or(0);
+        const auto width = GetInputValue<int>("Width").value_or(0);
+        const auto height = GetInputValue<int>("Height").value_or(0);
+        if (width < 0 || height < 0) [[unlikely]]
+        {
+            return std::nullopt;
+        }
+
+        // Proxy runs see a smaller image; cover at least the same part of the scene
+        const double scale = GetProxyScale();
+        const int left = static_cast<int>(std::floor(x * scale));
+        const int top = static_cast<int>(std::floor(y * scale));
+        const int right = width > 0 ? static_cast<int>(std::ceil((x + width) * scale)) : inputSize.width;
+        const int bottom = height > 0 ? static_cast<int>(std::ceil((y + height) * scale)) : inputSize.height;
+
+        const cv::Rect region =
+            cv::Rect(left, top, right - left, bottom - top) & cv::Rect(0, 0, inputSize.width, inputSize.height);
+        if (region.empty())
+        {
+            return std::nullopt;
+        }
+        return region;
+    }
+
+    std::optional<Nodes::ImageShape> CropNode::InferOutputShape(const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+        const auto region = GetInputRegion(input->size);
+        if (!region)
+        {
+            throw std::invalid_argument("Crop rectangle is empty or outside the image");
+        }
+        return Nodes::ImageShape{ .size = region->size(), .type = input->type };
+    }
+
+    bool CropNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const auto x = GetInputValue<int>("X").value_or(0);
+        const auto y = GetInputValue<int>("Y").value_or(0);
+        const auto width = GetInputValue<int>("Width").value_or(0);
+        const auto height = GetInputValue<int>("Height").value_or(0);
+        if (width < 0 || height < 0)
+        {
+            return writer.Fail("Width and Height must not be negative");
+        }
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        // Zero extents reach the image edge, as in GetInputRegion(); an empty overlap leaves the output empty
+        const std::string left = writer.Constant("X", x);
+        const std::string top = writer.Constant("Y", y);
+        const std::string right = width > 0 ? writer.Constant("Right", x + width) : "image.cols";
+        const std::string bottom = height > 0 ? writer.Constant("Bottom", y + height) : "image.rows";
+        writer.Line("{");
+        writer.Line("    const cv::Mat &image = " + input + ";");
+        writer.Line("    const cv::Rect region = cv::Rect(" + left + ", " + top + ", " + right + " - " + left + ", " +
+                    bottom + " - " + top + ") & cv::Rect(0, 0, image.cols, image.rows);");
+        writer.Line("    image(region).copyTo(" + writer.Output("Output") + ");");
+        writer.Line("}");
+        return true;
+    }
+} // namespace VisionCraft::Vision::Algorithms
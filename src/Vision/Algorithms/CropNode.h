@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+#include <optional>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node cutting a rectangle out of its input image.
+     *
+     * X, Y, Width and Height are in full-resolution pixels (scaled in proxy runs); a Width or Height of 0
+     * extends the rectangle to the image edge, and a rectangle reaching outside the image is clipped to it.
+     * The node declares the rectangle through GetInputRegion(), so a chain of nodes feeding it computes
+     * only the pixels under the rectangle (see TilingOptions::propagateRegions).
+     */
+    class CropNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs crop node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CropNode(Nodes::NodeId id, const std::string &name = "Crop");
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~CropNode() = default;
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CropNode";
+        }
+
+        /**
+         * @brief Copies the cropped region of the input image to the output.
+         */
+        void Process() override;
+
+        /**
+         * @brief Takes the size of the crop rectangle inside the input, and keeps the type.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         * @throws std::invalid_argument if the rectangle is empty or outside the input
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Writes the crop as a copy of the rectangle clipped to the image.
+         * @param writer Receives the node's code
+         * @return False if Width or Height is negative
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Returns the rectangle the node reads.
+         * @param inputSize Size of the input image
+         * @return Crop rectangle clipped to the image, or std::nullopt if nothing of it lies inside
+         */
+        [[nodiscard]] std::optional<cv::Rect> GetInputRegion(const cv::Size &inputSize) const override;
+    };
+} // namespace VisionCraft::Vision::Algorithms
@@ -1,11 +1,25 @@
 #include "Vision/Algorithms/CvtColorNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
 #include <array>
 #include <stdexcept>
+#include <string>
 #include <utility>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        // Conversion requirements, indexed by ColorConversion
+        constexpr std::array<ConversionInfo, 6> conversions{ ConversionInfo{ cv::COLOR_BGR2GRAY, 3, 1, "BGR2GRAY" },
+            ConversionInfo{ cv::COLOR_GRAY2BGR, 1, 3, "GRAY2BGR" },
+            ConversionInfo{ cv::COLOR_BGR2RGB, 3, 3, "BGR2RGB" },
+            ConversionInfo{ cv::COLOR_RGB2BGR, 3, 3, "RGB2BGR" },
+            ConversionInfo{ cv::COLOR_BGR2HSV, 3, 3, "BGR2HSV" },
+            ConversionInfo{ cv::COLOR_HSV2BGR, 3, 3, "HSV2BGR" } };
+    } // namespace
+
     CvtColorNode::CvtColorNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -13,42 +27,42 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("Conversion", static_cast<int>(ColorConversion::BGR2GRAY));
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void CvtColorNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
-        if (!inputData || inputData->empty()) [[unlikely]]
+        const auto deviceInput = GetInputValueIf<cv::UMat>("Input");
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if ((!deviceInput || deviceInput->empty()) && (!inputData || inputData->empty())) [[unlikely]]
         {
-            LOG_WARN("CvtColorNode {}: No input image provided", GetName());
+            LOG_HOT_WARN("CvtColorNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
 
-        const cv::Mat &inputImage = *inputData;
-
-        try
+        if (deviceInput)
         {
-            auto conversion = GetInputValue<int>("Conversion").value_or(static_cast<int>(ColorConversion::BGR2GRAY));
-
-            // Define conversion requirements using constexpr array
-            constexpr std::array<ConversionInfo, 6> conversions{ ConversionInfo{ cv::COLOR_BGR2GRAY, 3, "BGR2GRAY" },
-                ConversionInfo{ cv::COLOR_GRAY2BGR, 1, "GRAY2BGR" },
-                ConversionInfo{ cv::COLOR_BGR2RGB, 3, "BGR2RGB" },
-                ConversionInfo{ cv::COLOR_RGB2BGR, 3, "RGB2BGR" },
-                ConversionInfo{ cv::COLOR_BGR2HSV, 3, "BGR2HSV" },
-                ConversionInfo{ cv::COLOR_HSV2BGR, 3, "HSV2BGR" } };
+            ConvertImage(*deviceInput, cv::UMat{});
+        }
+        else
+        {
+            ConvertImage(*inputData, CreateOutputImage());
+        }
+    }
 
-            if (conversion < 0 || conversion >= static_cast<int>(conversions.size())) [[unlikely]]
-            {
-                LOG_WARN("CvtColorNode {}: Invalid conversion code ({}), using BGR2GRAY", GetName(), conversion);
-                conversion = static_cast<int>(ColorConversion::BGR2GRAY);
-            }
+    bool CvtColorNode::SupportsDeviceImages() const
+    {
+        return true;
+    }
 
-            const auto &convInfo = conversions[conversion];
+    template<typename Image> void CvtColorNode::ConvertImage(const Image &inputImage, Image outputImage)
+    {
+        try
+        {
+            const auto &convInfo = GetConversion();
 
             // Validate channel count
             if (inputImage.channels() != convInfo.requiredChannels) [[unlikely]]
@@ -62,11 +76,10 @@ namespace VisionCraft::Vision::Algorithms
                 return;
             }
 
-            cv::Mat outputImage;
             cv::cvtColor(inputImage, outputImage, convInfo.code);
             SetOutputSlotData("Output", std::move(outputImage));
 
-            LOG_INFO("CvtColorNode {}: Applied Color Conversion ({})", GetName(), convInfo.name);
+            LOG_HOT_INFO("CvtColorNode {}: Applied Color Conversion ({})", GetName(), convInfo.name);
         }
         catch (const cv::Exception &e)
         {
@@ -79,4 +92,70 @@ namespace VisionCraft::Vision::Algorithms
             ClearOutputSlot("Output");
         }
     }
+
+    std::optional<Nodes::TileOperation> CvtColorNode::PrepareTileOperation(int inputType) const
+    {
+        const auto &convInfo = GetConversion();
+        // Let Process() report the mismatch
+        if (CV_MAT_CN(inputType) != convInfo.requiredChannels)
+        {
+            return std::nullopt;
+        }
+
+        auto apply = [code = convInfo.code](const cv::Mat &tile) {
+            cv::Mat result;
+            cv::cvtColor(tile, result, code);
+            return result;
+        };
+        const int outputType = CV_MAKETYPE(CV_MAT_DEPTH(inputType), convInfo.outputChannels);
+        return Nodes::TileOperation{ .halo = 0,
+            .outputType = outputType,
+            .apply = std::move(apply),
+            .colorTransform = "cvtColor " + std::to_string(convInfo.code) };
+    }
+
+    const ConversionInfo &CvtColorNode::GetConversion() const
+    {
+        auto conversion = GetInputValue<int>("Conversion").value_or(static_cast<int>(ColorConversion::BGR2GRAY));
+        if (conversion < 0 || conversion >= static_cast<int>(conversions.size())) [[unlikely]]
+        {
+            LOG_HOT_WARN("CvtColorNode {}: Invalid conversion code ({}), using BGR2GRAY", GetName(), conversion);
+            conversion = static_cast<int>(ColorConversion::BGR2GRAY);
+        }
+        return conversions[static_cast<size_t>(conversion)];
+    }
+
+    std::optional<Nodes::ImageShape> CvtColorNode::InferOutputShape(const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+
+        const auto &convInfo = GetConversion();
+        if (CV_MAT_CN(input->type) != convInfo.requiredChannels)
+        {
+            throw std::invalid_argument(std::string(convInfo.name) + " requires "
+                                        + std::to_string(convInfo.requiredChannels) + "-channel input");
+        }
+        return Nodes::ImageShape{ .size = input->size,
+            .type = CV_MAKETYPE(CV_MAT_DEPTH(input->type), convInfo.outputChannels) };
+    }
+
+    bool CvtColorNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        const auto &convInfo = GetConversion();
+        writer.SetPointwise();
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("CV_Assert(" + input + ".channels() == " + std::to_string(convInfo.requiredChannels) + ");");
+        writer.Line("cv::cvtColor(" + input + ", " + writer.Output("Output") + ", cv::COLOR_" +
+                    std::string(convInfo.name) + ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -25,6 +25,7 @@ namespace VisionCraft::Vision::Algorithms
     {
         cv::ColorConversionCodes code;
         int requiredChannels;
+        int outputChannels;
         std::string_view name;
     };
 
@@ -59,5 +60,50 @@ namespace VisionCraft::Vision::Algorithms
          * @brief Processes input image using Color Conversion.
          */
         void Process() override;
+
+        /**
+         * @brief Keeps the input's size and depth with the conversion's channel count.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         * @throws std::invalid_argument if the input's channel count does not fit the conversion
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the conversion as a pointwise tile operation.
+         * @param inputType Type of the input image
+         * @return Tile operation, or std::nullopt if the input has the wrong channel count
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the conversion as a pointwise cv::cvtColor call behind a channel count check.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Color conversion runs on cv::UMat inputs as well.
+         * @return Always true
+         */
+        [[nodiscard]] bool SupportsDeviceImages() const override;
+
+    protected:
+        /**
+         * @brief Reads the Conversion input, falling back to BGR2GRAY for unknown values.
+         * @return Conversion to apply
+         */
+        [[nodiscard]] const ConversionInfo &GetConversion() const;
+
+    private:
+        /**
+         * @brief Converts an image with the selected conversion and stores the result.
+         * @tparam Image cv::Mat or cv::UMat
+         * @param inputImage Non-empty input image
+         * @param outputImage Image the conversion writes into (from CreateOutputImage() for cv::Mat)
+         */
+        template<typename Image> void ConvertImage(const Image &inputImage, Image outputImage);
     };
 } // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,91 @@
+#include "Vision/Algorithms/DrawContoursNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    DrawContoursNode::DrawContoursNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Contours").SetDataType(Nodes::SlotDataType::Contours);
+        CreateInputSlot("Color", 0x00FF00);
+        CreateInputSlot("Thickness", 2);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    void DrawContoursNode::Process()
+    {
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if (!inputData || inputData->empty())
+        {
+            LOG_HOT_WARN("DrawContoursNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        try
+        {
+            cv::Mat result = CreateOutputImage();
+            if (inputData->channels() == 1)
+            {
+                cv::cvtColor(*inputData, result, cv::COLOR_GRAY2BGR);
+            }
+            else
+            {
+                inputData->copyTo(result);
+            }
+
+            const auto contours = GetInputValueIf<Nodes::ContourSet>("Contours");
+            if (contours && !contours->IsEmpty())
+            {
+                const int color = GetInputValue<int>("Color").value_or(0x00FF00);
+                const int thickness = GetInputValue<int>("Thickness").value_or(2);
+                const cv::Scalar bgr((color & 0xFF), ((color >> 8) & 0xFF), ((color >> 16) & 0xFF));
+
+                // Pointers into the set's buffer; OpenCV reads the points where they are
+                std::vector<const cv::Point *> polygons;
+                std::vector<int> sizes;
+                polygons.reserve(contours->GetCount());
+                sizes.reserve(contours->GetCount());
+                for (size_t i = 0; i < contours->GetCount(); ++i)
+                {
+                    const auto contour = contours->GetContour(i);
+                    if (!contour.empty())
+                    {
+                        polygons.push_back(contour.data());
+                        sizes.push_back(static_cast<int>(contour.size()));
+                    }
+                }
+
+                if (thickness < 0)
+                {
+                    cv::fillPoly(result, polygons.data(), sizes.data(), static_cast<int>(polygons.size()), bgr);
+                }
+                else
+                {
+                    cv::polylines(result,
+                        polygons.data(),
+                        sizes.data(),
+                        static_cast<int>(polygons.size()),
+                        true,
+                        bgr,
+                        std::max(thickness, 1));
+                }
+            }
+            SetOutputSlotData("Output", std::move(result));
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("DrawContoursNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+} // namespace VisionCraft::Vision::Algorithms
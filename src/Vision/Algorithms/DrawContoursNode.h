@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node drawing a Nodes::ContourSet over a copy of its input image.
+     *
+     * Color is 0xRRGGBB (gray images are drawn on in color); a negative Thickness fills the contours. The
+     * points are handed to OpenCV straight from the set's buffer.
+     */
+    class DrawContoursNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs contour drawing node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        DrawContoursNode(Nodes::NodeId id, const std::string &name = "Draw Contours");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "DrawContoursNode";
+        }
+
+        /**
+         * @brief Draws the contours.
+         */
+        void Process() override;
+    };
+} // namespace VisionCraft::Vision::Algorithms
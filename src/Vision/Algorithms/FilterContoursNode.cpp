@@ -0,0 +1,61 @@
+#include "Vision/Algorithms/FilterContoursNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+#include <vector>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    FilterContoursNode::FilterContoursNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Contours").SetDataType(Nodes::SlotDataType::Contours);
+        CreateInputSlot("MinArea", 0.0);
+        CreateInputSlot("MaxArea", 0.0);
+        CreateInputSlot("MinPerimeter", 0.0);
+        CreateOutputSlot("Contours").SetDataType(Nodes::SlotDataType::Contours);
+        CreateOutputSlot("Count").SetDataType(Nodes::SlotDataType::Int);
+    }
+
+    void FilterContoursNode::Process()
+    {
+        const auto contours = GetInputValueIf<Nodes::ContourSet>("Contours");
+        if (!contours)
+        {
+            LOG_HOT_WARN("FilterContoursNode {}: No contours provided", GetName());
+            ClearOutputSlot("Contours");
+            ClearOutputSlot("Count");
+            return;
+        }
+
+        const auto minArea = GetInputValue<double>("MinArea").value_or(0.0);
+        const auto maxArea = GetInputValue<double>("MaxArea").value_or(0.0);
+        const auto minPerimeter = GetInputValue<double>("MinPerimeter").value_or(0.0);
+
+        std::vector<int> kept;
+        kept.reserve(contours->GetCount());
+        for (size_t i = 0; i < contours->GetCount(); ++i)
+        {
+            const cv::Mat contour = contours->GetContourMat(i);
+            const double area = contour.empty() ? 0.0 : cv::contourArea(contour);
+            if (area < minArea || (maxArea > 0.0 && area > maxArea))
+            {
+                continue;
+            }
+            // The perimeter costs a square root per segment, so it is only measured for contours still in
+            if (minPerimeter > 0.0 && (contour.empty() || cv::arcLength(contour, true) < minPerimeter))
+            {
+                continue;
+            }
+            kept.push_back(static_cast<int>(i));
+        }
+
+        LOG_HOT_INFO("FilterContoursNode {}: Kept {} of {} contours", GetName(), kept.size(), contours->GetCount());
+        SetOutputSlotData("Count", static_cast<int>(kept.size()));
+        SetOutputSlotData("Contours", contours->Select(kept, CreateOutputImage()));
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node keeping the contours of a Nodes::ContourSet whose area and perimeter lie in range.
+     *
+     * Shapes are measured straight from the set's point buffer, and the output shares that buffer with
+     * only the kept indices listed (ContourSet::Select()), so filtering never copies points. MaxArea of 0
+     * means no upper bound.
+     */
+    class FilterContoursNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs contour filter node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        FilterContoursNode(Nodes::NodeId id, const std::string &name = "Filter Contours");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "FilterContoursNode";
+        }
+
+        /**
+         * @brief Selects the contours within the limits.
+         */
+        void Process() override;
+    };
+} // namespace VisionCraft::Vision::Algorithms
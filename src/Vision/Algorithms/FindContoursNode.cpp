@@ -0,0 +1,79 @@
+#include "Vision/Algorithms/FindContoursNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+namespace VisionCraft::Vision::Algorithms
+{
+    FindContoursNode::FindContoursNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Mode", static_cast<int>(cv::RETR_EXTERNAL));
+        CreateInputSlot("Approximation", static_cast<int>(cv::CHAIN_APPROX_SIMPLE));
+        CreateOutputSlot("Contours").SetDataType(Nodes::SlotDataType::Contours);
+        CreateOutputSlot("Count").SetDataType(Nodes::SlotDataType::Int);
+    }
+
+    void FindContoursNode::Process()
+    {
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if (!inputData || inputData->empty())
+        {
+            LOG_HOT_WARN("FindContoursNode {}: No input image provided", GetName());
+            ClearOutputSlot("Contours");
+            ClearOutputSlot("Count");
+            return;
+        }
+
+        try
+        {
+            const auto [mode, approximation] = ReadParameters();
+            cv::Mat binary = GetDerivedImage(*inputData, Nodes::DerivedImage::Gray);
+            if (binary.depth() != CV_8U)
+            {
+                binary.convertTo(binary, CV_8U);
+            }
+
+            // Per thread, so the per-contour vectors keep their capacity from one frame to the next
+            thread_local std::vector<std::vector<cv::Point>> scratch;
+            cv::findContours(binary, scratch, mode, approximation);
+
+            auto contours = Nodes::ContourSet::FromContours(scratch, CreateOutputImage());
+            LOG_HOT_INFO("FindContoursNode {}: Found {} contours ({} points)",
+                GetName(),
+                contours.GetCount(),
+                contours.GetPointCount());
+            SetOutputSlotData("Count", static_cast<int>(contours.GetCount()));
+            SetOutputSlotData("Contours", std::move(contours));
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("FindContoursNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Contours");
+            ClearOutputSlot("Count");
+        }
+    }
+
+    std::pair<int, int> FindContoursNode::ReadParameters() const
+    {
+        auto mode = GetInputValue<int>("Mode").value_or(cv::RETR_EXTERNAL);
+        auto approximation = GetInputValue<int>("Approximation").value_or(cv::CHAIN_APPROX_SIMPLE);
+        if (mode < cv::RETR_EXTERNAL || mode > cv::RETR_TREE) [[unlikely]]
+        {
+            LOG_HOT_WARN("FindContoursNode {}: Invalid mode ({}), using RETR_EXTERNAL", GetName(), mode);
+            mode = cv::RETR_EXTERNAL;
+        }
+        if (approximation < cv::CHAIN_APPROX_NONE || approximation > cv::CHAIN_APPROX_TC89_KCOS) [[unlikely]]
+        {
+            LOG_HOT_WARN("FindContoursNode {}: Invalid approximation ({}), using CHAIN_APPROX_SIMPLE",
+                GetName(),
+                approximation);
+            approximation = cv::CHAIN_APPROX_SIMPLE;
+        }
+        return { mode, approximation };
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node extracting the contours of a binary image into a Nodes::ContourSet.
+     *
+     * Nonzero pixels count as foreground; color images are converted to gray first. Mode and Approximation
+     * take the cv::RETR_* and cv::CHAIN_APPROX_* values. The contours are flattened into one buffer from the
+     * node's image pool, so a frame with thousands of specks costs one recycled allocation downstream.
+     */
+    class FindContoursNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs contour extraction node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        FindContoursNode(Nodes::NodeId id, const std::string &name = "Find Contours");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "FindContoursNode";
+        }
+
+        /**
+         * @brief Finds the contours of the input image.
+         */
+        void Process() override;
+
+    private:
+        /**
+         * @brief Reads Mode and Approximation, replacing unknown values with the defaults.
+         * @return cv::RETR_* mode and cv::CHAIN_APPROX_* method
+         */
+        [[nodiscard]] std::pair<int, int> ReadParameters() const;
+    };
+} // namespace VisionCraft::Vision::Algorithms
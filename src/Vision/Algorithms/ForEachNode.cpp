@@ -0,0 +1,257 @@
+#include "Vision/Algorithms/ForEachNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <sstream>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    namespace
+    {
+        using Elements = std::vector<std::shared_ptr<const Nodes::NodeData>>;
+
+        Elements SplitMat(const cv::Mat &list)
+        {
+            Elements elements;
+            elements.reserve(static_cast<size_t>(list.rows));
+            const bool scalars = list.cols == 1 && list.channels() == 1;
+            for (int row = 0; row < list.rows; ++row)
+            {
+                if (scalars)
+                {
+                    cv::Mat value;
+                    list.row(row).convertTo(value, CV_64F);
+                    elements.push_back(std::make_shared<const Nodes::NodeData>(value.at<double>(0, 0)));
+                }
+                else
+                {
+                    elements.push_back(std::make_shared<const Nodes::NodeData>(list.row(row)));
+                }
+            }
+            return elements;
+        }
+
+        Elements SplitPoints(const std::vector<cv::Point> &list)
+        {
+            Elements elements;
+            elements.reserve(list.size());
+            for (const auto &point : list)
+            {
+                const cv::Mat row = (cv::Mat_<int>(1, 2) << point.x, point.y);
+                elements.push_back(std::make_shared<const Nodes::NodeData>(row));
+            }
+            return elements;
+        }
+
+        Elements SplitLines(const std::string &list)
+        {
+            Elements elements;
+            std::istringstream stream(list);
+            for (std::string line; std::getline(stream, line);)
+            {
+                if (!line.empty() && line.back() == '\r')
+                {
+                    line.pop_back();
+                }
+                if (!line.empty())
+                {
+                    elements.push_back(std::make_shared<const Nodes::NodeData>(std::move(line)));
+                }
+            }
+            return elements;
+        }
+
+        Elements SplitDirectory(const std::filesystem::path &list)
+        {
+            std::error_code error;
+            if (!std::filesystem::is_directory(list, error))
+            {
+                return { std::make_shared<const Nodes::NodeData>(list) };
+            }
+
+            std::vector<std::filesystem::path> files;
+            for (const auto &entry : std::filesystem::directory_iterator(list, error))
+            {
+                if (entry.is_regular_file(error))
+                {
+                    files.push_back(entry.path());
+                }
+            }
+            std::ranges::sort(files);
+
+            Elements elements;
+            elements.reserve(files.size());
+            for (auto &file : files)
+            {
+                elements.push_back(std::make_shared<const Nodes::NodeData>(std::move(file)));
+            }
+            return elements;
+        }
+
+        Elements SplitRange(int count)
+        {
+            Elements elements;
+            elements.reserve(static_cast<size_t>(std::max(count, 0)));
+            for (int value = 0; value < count; ++value)
+            {
+                elements.push_back(std::make_shared<const Nodes::NodeData>(value));
+            }
+            return elements;
+        }
+
+        std::optional<double> AsNumber(const Nodes::NodeData &value)
+        {
+            if (const auto *number = std::get_if<double>(&value))
+                return *number;
+            if (const auto *number = std::get_if<float>(&value))
+                return *number;
+            if (const auto *number = std::get_if<int>(&value))
+                return *number;
+            if (const auto *flag = std::get_if<bool>(&value))
+                return *flag ? 1.0 : 0.0;
+            return std::nullopt;
+        }
+
+        std::optional<std::string> AsText(const Nodes::NodeData &value)
+        {
+            if (const auto *text = std::get_if<std::string>(&value))
+                return *text;
+            if (const auto *path = std::get_if<std::filesystem::path>(&value))
+                return path->string();
+            return std::nullopt;
+        }
+
+        // Returns the joined results, or std::monostate if they share no representation
+        Nodes::NodeData JoinResults(const Elements &results)
+        {
+            auto present = results | std::views::filter([](const auto &result) { return result != nullptr; });
+            if (std::ranges::empty(present))
+            {
+                return std::monostate{};
+            }
+
+            if (std::ranges::all_of(present, [](const auto &result) { return AsNumber(*result).has_value(); }))
+            {
+                cv::Mat column(static_cast<int>(results.size()), 1, CV_64F);
+                for (size_t i = 0; i < results.size(); ++i)
+                {
+                    column.at<double>(static_cast<int>(i), 0) =
+                        results[i] ? *AsNumber(*results[i]) : std::numeric_limits<double>::quiet_NaN();
+                }
+                return column;
+            }
+
+            if (std::ranges::all_of(present, [](const auto &result) { return AsText(*result).has_value(); }))
+            {
+                std::string text;
+                for (size_t i = 0; i < results.size(); ++i)
+                {
+                    text += (i > 0 ? "\n" : "") + (results[i] ? *AsText(*results[i]) : std::string{});
+                }
+                return text;
+            }
+
+            std::vector<cv::Mat> rows;
+            for (const auto &result : results)
+            {
+                const auto *row = result ? std::get_if<cv::Mat>(result.get()) : nullptr;
+                const bool matches = row && row->rows == 1
+                                     && (rows.empty() || (row->cols == rows[0].cols && row->type() == rows[0].type()));
+                if (!matches)
+                {
+                    return std::monostate{};
+                }
+                rows.push_back(*row);
+            }
+            cv::Mat stacked;
+            cv::vconcat(rows, stacked);
+            return stacked;
+        }
+    } // namespace
+
+    ForEachNode::ForEachNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin(kBodyPin);
+        CreateExecutionOutputPin(kCompletedPin);
+
+        // Data pins
+        CreateInputSlot("List");
+        CreateInputSlot("Result");
+        CreateInputSlot("Parallel", true);
+        CreateOutputSlot("Element");
+        CreateOutputSlot("Index").SetDataType(Nodes::SlotDataType::Int);
+        CreateOutputSlot("Count").SetDataType(Nodes::SlotDataType::Int);
+        CreateOutputSlot("Results");
+    }
+
+    void ForEachNode::Process()
+    {
+        for (const char *slot : { "Element", "Index", "Count", "Results" })
+        {
+            ClearOutputSlot(slot);
+        }
+    }
+
+    bool ForEachNode::IsCacheable() const
+    {
+        return false;
+    }
+
+    std::optional<std::string> ForEachNode::GetLoopBodyPin() const
+    {
+        return kBodyPin;
+    }
+
+    Nodes::LoopElements ForEachNode::GetLoopElements() const
+    {
+        Nodes::LoopElements elements;
+        elements.parallel = GetInputValue<bool>("Parallel").value_or(true);
+
+        const auto list = GetInputSlot("List").GetSharedData();
+        if (!list)
+        {
+            return elements;
+        }
+        if (const auto *mat = std::get_if<cv::Mat>(list.get()))
+            elements.values = SplitMat(*mat);
+        else if (const auto *points = std::get_if<std::vector<cv::Point>>(list.get()))
+            elements.values = SplitPoints(*points);
+        else if (const auto *text = std::get_if<std::string>(list.get()))
+            elements.values = SplitLines(*text);
+        else if (const auto *path = std::get_if<std::filesystem::path>(list.get()))
+            elements.values = SplitDirectory(*path);
+        else if (const auto *count = std::get_if<int>(list.get()))
+            elements.values = SplitRange(*count);
+        else
+            LOG_HOT_WARN("ForEachNode {}: List holds no supported collection", GetName());
+        return elements;
+    }
+
+    void ForEachNode::BeginLoopIteration(size_t index, const std::shared_ptr<const Nodes::NodeData> &element)
+    {
+        ShareOutputSlotData("Element", element);
+        SetOutputSlotData("Index", static_cast<int>(index));
+    }
+
+    void ForEachNode::FinishLoop(std::vector<std::shared_ptr<const Nodes::NodeData>> results)
+    {
+        SetOutputSlotData("Count", static_cast<int>(results.size()));
+
+        auto joined = JoinResults(results);
+        if (std::holds_alternative<std::monostate>(joined))
+        {
+            if (std::ranges::any_of(results, [](const auto &result) { return result != nullptr; }))
+            {
+                LOG_HOT_WARN("ForEachNode {}: Results of {} elements cannot be joined", GetName(), results.size());
+            }
+            ClearOutputSlot("Results");
+            return;
+        }
+        SetOutputSlotData("Results", std::move(joined));
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+
+#include <string>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node running the chain wired to its Body pin once per element of its List input.
+     *
+     * List takes the collections the graph already carries: the rows of a Mat (a single-column Mat yields
+     * numbers), the points of a contour, the lines of a string, the files of a directory, or a count n
+     * (elements 0..n-1). Each iteration sees Element and Index; whatever the body wires back into Result is
+     * collected into Results, stacked into a column Mat for numbers, a Mat for equally shaped rows, or lines
+     * of text. The body's plan is compiled once and reused by every iteration (see NodeEditor::RunLoopStep()).
+     */
+    class ForEachNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs for-each node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        ForEachNode(Nodes::NodeId id, const std::string &name = "ForEach");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "ForEachNode";
+        }
+
+        /**
+         * @brief Clears the outputs of the previous run; the iterations fill them.
+         */
+        void Process() override;
+
+        /**
+         * @brief Results depend on the body, which the cache key does not cover.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override;
+
+        /**
+         * @brief Names the pin the body hangs off.
+         * @return "Body"
+         */
+        [[nodiscard]] std::optional<std::string> GetLoopBodyPin() const override;
+
+        /**
+         * @brief Splits List into elements.
+         * @return Elements, run in parallel unless the Parallel input is false
+         */
+        [[nodiscard]] Nodes::LoopElements GetLoopElements() const override;
+
+        /**
+         * @brief Publishes Element and Index.
+         * @param index Position of the element
+         * @param element Element value
+         */
+        void BeginLoopIteration(size_t index, const std::shared_ptr<const Nodes::NodeData> &element) override;
+
+        /**
+         * @brief Joins the per-element results into Results and sets Count.
+         * @param results Value of Result after each iteration
+         */
+        void FinishLoop(std::vector<std::shared_ptr<const Nodes::NodeData>> results) override;
+
+        inline static const std::string kBodyPin{ "Body" };           ///< Execution output run per element
+        inline static const std::string kCompletedPin{ "Completed" }; ///< Execution output run after the loop
+    };
+} // namespace VisionCraft::Vision::Algorithms
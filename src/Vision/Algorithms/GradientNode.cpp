@@ -0,0 +1,360 @@
+#include "Vision/Algorithms/GradientNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Kernels/Kernels.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    namespace
+    {
+        // Separable Sobel factors: the x derivative is deriv along rows times smooth down columns
+        template<int KSize> struct SobelFactors;
+        template<> struct SobelFactors<3>
+        {
+            static constexpr std::array<int, 3> smooth{ 1, 2, 1 };
+            static constexpr std::array<int, 3> deriv{ -1, 0, 1 };
+        };
+        template<> struct SobelFactors<5>
+        {
+            static constexpr std::array<int, 5> smooth{ 1, 4, 6, 4, 1 };
+            static constexpr std::array<int, 5> deriv{ -1, -2, 0, 2, 1 };
+        };
+
+        constexpr float kDegreesPerRadian = 57.2957795f;
+
+        // cv::BORDER_REFLECT_101 index
+        int Reflect101(int index, int size)
+        {
+            if (size == 1)
+            {
+                return 0;
+            }
+            while (index < 0 || index >= size)
+            {
+                index = index < 0 ? -index : 2 * (size - 1) - index;
+            }
+            return index;
+        }
+
+        // Writes a float row into row y of an output of any depth, rounding and saturating like cv::Mat::convertTo
+        void StoreRow(const std::vector<float> &row, cv::Mat &target, int y)
+        {
+            if (target.depth() == CV_32F)
+            {
+                std::copy(row.begin(), row.end(), target.ptr<float>(y));
+                return;
+            }
+            cv::Mat targetRow = target.row(y);
+            cv::Mat(1, static_cast<int>(row.size()), CV_32F, const_cast<float *>(row.data()))
+                .convertTo(targetRow, target.depth());
+        }
+
+        struct GradientTargets
+        {
+            cv::Mat *gx = nullptr;        ///< Gx output (nullptr = not requested)
+            cv::Mat *gy = nullptr;        ///< Gy output (nullptr = not requested)
+            cv::Mat *magnitude = nullptr; ///< Magnitude output
+            cv::Mat *angle = nullptr;     ///< Angle output (nullptr = not requested)
+        };
+
+        // One output row at a time: the vertical pass smooths and differentiates the KSize input rows into
+        // padded row buffers, the horizontal pass turns them into Gx and Gy, and magnitude and angle are
+        // derived from those rows while they are in cache. Every loop is unit-stride and branch-free. Outputs
+        // narrower than CV_32F (PrecisionPolicy) are converted a row at a time, never as a separate pass.
+        template<int KSize, typename T, typename Acc>
+        void GradientRows(const cv::Mat &image, bool l2, const GradientTargets &targets, int rowBegin, int rowEnd)
+        {
+            constexpr int kRadius = KSize / 2;
+            constexpr auto smooth = SobelFactors<KSize>::smooth;
+            constexpr auto deriv = SobelFactors<KSize>::deriv;
+            const int cols = image.cols;
+
+            std::vector<Acc> smoothed(static_cast<size_t>(cols + 2 * kRadius));
+            std::vector<Acc> differentiated(smoothed.size());
+            std::vector<float> gxRow(static_cast<size_t>(cols));
+            std::vector<float> gyRow(gxRow.size());
+            std::vector<float> narrowRow(gxRow.size()); // Magnitude or angle bound for a narrower output
+            std::array<const T *, KSize> rows{};
+            Acc *s = smoothed.data() + kRadius;
+            Acc *d = differentiated.data() + kRadius;
+
+            for (int y = rowBegin; y < rowEnd; ++y)
+            {
+                for (int k = 0; k < KSize; ++k)
+                {
+                    rows[static_cast<size_t>(k)] = image.ptr<T>(Reflect101(y + k - kRadius, image.rows));
+                }
+
+                for (int x = 0; x < cols; ++x)
+                {
+                    Acc smoothSum = 0;
+                    Acc derivSum = 0;
+                    for (size_t k = 0; k < KSize; ++k)
+                    {
+                        const auto value = static_cast<Acc>(rows[k][x]);
+                        smoothSum += static_cast<Acc>(smooth[k]) * value;
+                        derivSum += static_cast<Acc>(deriv[k]) * value;
+                    }
+                    s[x] = smoothSum;
+                    d[x] = derivSum;
+                }
+                for (int i = 1; i <= kRadius; ++i)
+                {
+                    s[-i] = s[Reflect101(-i, cols)];
+                    d[-i] = d[Reflect101(-i, cols)];
+                    s[cols - 1 + i] = s[Reflect101(cols - 1 + i, cols)];
+                    d[cols - 1 + i] = d[Reflect101(cols - 1 + i, cols)];
+                }
+
+                for (int x = 0; x < cols; ++x)
+                {
+                    Acc gx = 0;
+                    Acc gy = 0;
+                    for (size_t k = 0; k < KSize; ++k)
+                    {
+                        const int column = x + static_cast<int>(k) - kRadius;
+                        gx += static_cast<Acc>(deriv[k]) * s[column];
+                        gy += static_cast<Acc>(smooth[k]) * d[column];
+                    }
+                    gxRow[static_cast<size_t>(x)] = static_cast<float>(gx);
+                    gyRow[static_cast<size_t>(x)] = static_cast<float>(gy);
+                }
+
+                const bool floatMagnitude = targets.magnitude->depth() == CV_32F;
+                float *magnitude = floatMagnitude ? targets.magnitude->ptr<float>(y) : narrowRow.data();
+                if (l2)
+                {
+                    Kernels::MagnitudeL2(gxRow.data(), gyRow.data(), magnitude, gxRow.size());
+                }
+                else
+                {
+                    Kernels::MagnitudeL1(gxRow.data(), gyRow.data(), magnitude, gxRow.size());
+                }
+                if (!floatMagnitude)
+                {
+                    StoreRow(narrowRow, *targets.magnitude, y);
+                }
+
+                if (targets.gx)
+                {
+                    StoreRow(gxRow, *targets.gx, y);
+                    StoreRow(gyRow, *targets.gy, y);
+                }
+
+                if (targets.angle)
+                {
+                    const bool floatAngle = targets.angle->depth() == CV_32F;
+                    float *angle = floatAngle ? targets.angle->ptr<float>(y) : narrowRow.data();
+                    for (size_t x = 0; x < gxRow.size(); ++x)
+                    {
+                        const float degrees = std::atan2(gyRow[x], gxRow[x]) * kDegreesPerRadian;
+                        angle[x] = degrees < 0.0f ? degrees + 360.0f : degrees;
+                    }
+                    if (!floatAngle)
+                    {
+                        StoreRow(narrowRow, *targets.angle, y);
+                    }
+                }
+            }
+        }
+
+        template<int KSize>
+        void GradientRows(const cv::Mat &image, bool l2, const GradientTargets &targets, int rowBegin, int rowEnd)
+        {
+            switch (image.depth())
+            {
+            case CV_8U:
+                GradientRows<KSize, uint8_t, int32_t>(image, l2, targets, rowBegin, rowEnd);
+                break;
+            case CV_16U:
+                GradientRows<KSize, uint16_t, int64_t>(image, l2, targets, rowBegin, rowEnd);
+                break;
+            case CV_16F:
+                GradientRows<KSize, cv::float16_t, float>(image, l2, targets, rowBegin, rowEnd);
+                break;
+            default:
+                GradientRows<KSize, float, float>(image, l2, targets, rowBegin, rowEnd);
+                break;
+            }
+        }
+    } // namespace
+
+    GradientNode::GradientNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("ksize", 3);
+        CreateInputSlot("Norm", kDefaultNorm);
+        CreateInputSlot("OutputComponents", false);
+        CreateInputSlot("OutputAngle", false);
+        CreateOutputSlot("Magnitude").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("Gx").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("Gy").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("Angle").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    void GradientNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("GradientNode {}: No input image provided", GetName());
+            ClearOutputs();
+            return;
+        }
+
+        try
+        {
+            const auto parameters = ReadParameters();
+            const cv::Mat gray = GetDerivedImage(*inputData, Nodes::DerivedImage::Gray);
+            const int depth = gray.depth();
+            if (depth != CV_8U && depth != CV_16U && depth != CV_16F && depth != CV_32F)
+            {
+                throw std::invalid_argument("Gradient supports 8-bit, 16-bit, half-float and float images");
+            }
+
+            const auto depths = GetOutputDepths(depth);
+            cv::Mat magnitude = CreateOutputImage();
+            magnitude.create(gray.size(), CV_MAKETYPE(depths.magnitude, 1));
+            cv::Mat gx;
+            cv::Mat gy;
+            cv::Mat angle;
+            GradientTargets targets{ .magnitude = &magnitude };
+            if (parameters.components)
+            {
+                const int componentType = CV_MAKETYPE(depths.components, 1);
+                gx = CreateOutputImage();
+                gx.create(gray.size(), componentType);
+                gy = CreateOutputImage();
+                gy.create(gray.size(), componentType);
+                targets.gx = &gx;
+                targets.gy = &gy;
+            }
+            if (parameters.angle)
+            {
+                angle = CreateOutputImage();
+                angle.create(gray.size(), CV_MAKETYPE(depths.angle, 1));
+                targets.angle = &angle;
+            }
+
+            cv::parallel_for_(cv::Range(0, gray.rows), [&](const cv::Range &range) {
+                if (parameters.ksize == 5)
+                {
+                    GradientRows<5>(gray, parameters.l2, targets, range.start, range.end);
+                }
+                else
+                {
+                    GradientRows<3>(gray, parameters.l2, targets, range.start, range.end);
+                }
+            });
+
+            ClearOutputs();
+            SetOutputSlotData("Magnitude", std::move(magnitude));
+            if (parameters.components)
+            {
+                SetOutputSlotData("Gx", std::move(gx));
+                SetOutputSlotData("Gy", std::move(gy));
+            }
+            if (parameters.angle)
+            {
+                SetOutputSlotData("Angle", std::move(angle));
+            }
+
+            LOG_HOT_INFO("GradientNode {}: Computed gradient (ksize: {}, norm: {}, components: {}, angle: {})",
+                GetName(),
+                parameters.ksize,
+                parameters.l2 ? "L2" : "L1",
+                parameters.components,
+                parameters.angle);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("GradientNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputs();
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("GradientNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputs();
+        }
+    }
+
+    GradientNode::Parameters GradientNode::ReadParameters() const
+    {
+        auto ksize = GetInputValue<int>("ksize").value_or(3);
+        if (ksize != 3 && ksize != 5) [[unlikely]]
+        {
+            LOG_HOT_WARN("GradientNode {}: Invalid ksize ({}), using 3", GetName(), ksize);
+            ksize = 3;
+        }
+        ksize = ScaleKernelSize(ksize, 3);
+
+        const auto normView = GetInputView<std::string>("Norm");
+        const auto &norm = normView.ValueOr(kDefaultNorm);
+        if (norm != "L1" && norm != "L2") [[unlikely]]
+        {
+            LOG_HOT_WARN("GradientNode {}: Unknown norm '{}', using L2", GetName(), norm);
+        }
+
+        return Parameters{ .ksize = ksize,
+            .l2 = norm != "L1",
+            .components = GetInputValue<bool>("OutputComponents").value_or(false),
+            .angle = GetInputValue<bool>("OutputAngle").value_or(false) };
+    }
+
+    bool GradientNode::AcceptsHalfFloatImages() const
+    {
+        return true;
+    }
+
+    GradientNode::OutputDepths GradientNode::GetOutputDepths(int inputDepth) const
+    {
+        const auto policy = GetPrecisionPolicy();
+        const int floatDepth = Nodes::GetFloatStorageDepth(policy);
+        OutputDepths depths{ .magnitude = floatDepth, .components = floatDepth, .angle = floatDepth };
+        switch (policy)
+        {
+        case Nodes::PrecisionPolicy::Prefer8U:
+            // Magnitudes of 8-bit edges saturate where they matter least; signs and angles do not fit 8 bits
+            depths.magnitude = CV_8U;
+            depths.components = inputDepth == CV_8U ? CV_16S : CV_16F;
+            depths.angle = CV_16F;
+            break;
+        case Nodes::PrecisionPolicy::Float32:
+            break;
+        default:
+            // Derivatives of 8-bit images are exact in CV_16S
+            if (inputDepth == CV_8U)
+            {
+                depths.components = CV_16S;
+            }
+            break;
+        }
+        if (inputDepth == CV_16U)
+        {
+            // Derivatives of 16-bit images exceed CV_16F's largest value (65504)
+            depths.components = depths.components == CV_16F ? CV_32F : depths.components;
+            depths.magnitude = depths.magnitude == CV_16F ? CV_32F : depths.magnitude;
+        }
+        return depths;
+    }
+
+    void GradientNode::ClearOutputs()
+    {
+        ClearOutputSlot("Magnitude");
+        ClearOutputSlot("Gx");
+        ClearOutputSlot("Gy");
+        ClearOutputSlot("Angle");
+    }
+} // namespace VisionCraft::Vision::Algorithms
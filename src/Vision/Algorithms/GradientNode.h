@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node computing Sobel gradients, their magnitude and orientation in one sweep.
+     *
+     * Each output row is produced from the input rows under the kernel: a vertical pass smooths and
+     * differentiates them into two row buffers, and a horizontal pass turns those into Gx and Gy, which
+     * are written out or consumed straight away by the magnitude and angle. No full-size intermediate image
+     * is built, and rows are spread over OpenCV's thread pool.
+     *
+     * Outputs: "Magnitude" (CV_32F), "Gx" and "Gy" (CV_16S for 8-bit input, CV_32F otherwise) when
+     * OutputComponents is set, and "Angle" (CV_32F degrees in [0, 360), as cv::phase) when OutputAngle is
+     * set. Color input is converted to gray through Node::GetDerivedImage(). Borders reflect as in cv::Sobel.
+     *
+     * Those are the PrecisionPolicy::Native depths. Prefer16 stores every float output as CV_16F, Prefer8U
+     * additionally saturates the magnitude to CV_8U, and Float32 writes CV_32F components for 8-bit input too.
+     * Derivatives of 16-bit images stay CV_32F, as they overflow CV_16F.
+     */
+    class GradientNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs gradient node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        GradientNode(Nodes::NodeId id, const std::string &name = "Gradient");
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~GradientNode() = default;
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "GradientNode";
+        }
+
+        /**
+         * @brief Computes the selected gradient outputs of the input image.
+         */
+        void Process() override;
+
+        /**
+         * @brief Gradient reads half-float images (a Prefer16 magnitude, for second derivatives) directly.
+         * @return Always true
+         */
+        [[nodiscard]] bool AcceptsHalfFloatImages() const override;
+
+    protected:
+        /**
+         * @brief Validated gradient parameters.
+         */
+        struct Parameters
+        {
+            int ksize = 3;           ///< Sobel aperture (3 or 5)
+            bool l2 = true;          ///< Euclidean magnitude; false sums absolute values
+            bool components = false; ///< Write Gx and Gy (OutputComponents)
+            bool angle = false;      ///< Write gradient orientation (OutputAngle)
+        };
+
+        /**
+         * @brief Reads parameters, replacing invalid ones with defaults.
+         * @return Parameters with ksize 3 or 5 (scaled to proxy runs)
+         */
+        [[nodiscard]] Parameters ReadParameters() const;
+
+        /**
+         * @brief Depths of the outputs under the node's precision policy.
+         */
+        struct OutputDepths
+        {
+            int magnitude = CV_32F;  ///< Magnitude depth
+            int components = CV_32F; ///< Gx and Gy depth
+            int angle = CV_32F;      ///< Angle depth
+        };
+
+        /**
+         * @brief Returns the output depths for an input depth under the node's precision policy.
+         * @param inputDepth Depth of the grayscale input
+         * @return Output depths
+         */
+        [[nodiscard]] OutputDepths GetOutputDepths(int inputDepth) const;
+
+        inline static const std::string kDefaultNorm{ "L2" }; ///< Norm slot default and fallback
+
+    private:
+        /**
+         * @brief Clears every output slot.
+         */
+        void ClearOutputs();
+    };
+} // namespace VisionCraft::Vision::Algorithms
@@ -1,8 +1,84 @@
 #include "Vision/Algorithms/GrayscaleNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        constexpr int kShift = 14;
+        constexpr int32_t kRed = 4899;   // 0.299 * 2^14
+        constexpr int32_t kGreen = 9617; // 0.587 * 2^14
+        constexpr int32_t kBlue = 1868;  // 0.114 * 2^14
+
+        // Converts 4-channel pixels to interleaved gray + alpha in one pass over each row. Integer depths use
+        // OpenCV's 14-bit fixed-point luma weights with rounding, so results match cv::cvtColor to within one
+        // level. Iterations are independent, so the compiler can vectorize the loop.
+        template<typename T> void ConvertRowsToGrayAlpha(const cv::Mat &image, cv::Mat &outputImage, bool rgbOrder)
+        {
+            const int32_t firstWeight = rgbOrder ? kRed : kBlue;
+            const int32_t lastWeight = rgbOrder ? kBlue : kRed;
+            const float firstWeightF = rgbOrder ? 0.299f : 0.114f;
+            const float lastWeightF = rgbOrder ? 0.114f : 0.299f;
+
+            const bool continuous = image.isContinuous() && outputImage.isContinuous();
+            const int rows = continuous ? 1 : image.rows;
+            const int cols = continuous ? static_cast<int>(image.total()) : image.cols;
+            for (int y = 0; y < rows; ++y)
+            {
+                const T *source = image.ptr<T>(y);
+                T *destination = outputImage.ptr<T>(y);
+                for (int x = 0; x < cols; ++x)
+                {
+                    const T *pixel = source + 4 * x;
+                    if constexpr (std::is_floating_point_v<T>)
+                    {
+                        destination[2 * x] = pixel[0] * firstWeightF + pixel[1] * 0.587f + pixel[2] * lastWeightF;
+                    }
+                    else
+                    {
+                        const int32_t gray = pixel[0] * firstWeight + pixel[1] * kGreen + pixel[2] * lastWeight;
+                        destination[2 * x] = static_cast<T>((gray + (1 << (kShift - 1))) >> kShift);
+                    }
+                    destination[2 * x + 1] = pixel[3];
+                }
+            }
+        }
+        // Weighted sum of three continuous planes with the same weights as ConvertRowsToGrayAlpha(). Every
+        // operand is unit-stride, so the loop vectorizes without the shuffles interleaved pixels need.
+        template<typename T>
+        void ConvertPlanesToGray(const Nodes::PlanarImage &image, cv::Mat &outputImage, bool rgbOrder)
+        {
+            const int32_t firstWeight = rgbOrder ? kRed : kBlue;
+            const int32_t lastWeight = rgbOrder ? kBlue : kRed;
+            const float firstWeightF = rgbOrder ? 0.299f : 0.114f;
+            const float lastWeightF = rgbOrder ? 0.114f : 0.299f;
+
+            const T *first = image.GetPlane(0).ptr<T>(0);
+            const T *green = image.GetPlane(1).ptr<T>(0);
+            const T *last = image.GetPlane(2).ptr<T>(0);
+            T *destination = outputImage.ptr<T>(0);
+            const size_t count = image.GetPlane(0).total();
+            for (size_t i = 0; i < count; ++i)
+            {
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    destination[i] = first[i] * firstWeightF + green[i] * 0.587f + last[i] * lastWeightF;
+                }
+                else
+                {
+                    const int32_t gray = first[i] * firstWeight + green[i] * kGreen + last[i] * lastWeight;
+                    destination[i] = static_cast<T>((gray + (1 << (kShift - 1))) >> kShift);
+                }
+            }
+        }
+    } // namespace
+
     GrayscaleNode::GrayscaleNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -10,18 +86,29 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
-        CreateInputSlot("Method", std::string{ "BGR2GRAY" });
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Method", kDefaultMethod);
         CreateInputSlot("PreserveAlpha", false);
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    Nodes::ImageLayout GrayscaleNode::GetPreferredImageLayout() const
+    {
+        return Nodes::ImageLayout::Any;
     }
 
     void GrayscaleNode::Process()
     {
-        auto inputData = GetInputValue<cv::Mat>("Input");
+        if (const auto planar = GetInputValueIf<Nodes::PlanarImage>("Input"); planar && !planar->IsEmpty())
+        {
+            ProcessPlanar(*planar);
+            return;
+        }
+
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty())
         {
-            LOG_WARN("GrayscaleNode {}: No input image provided", GetName());
+            LOG_HOT_WARN("GrayscaleNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
@@ -30,7 +117,6 @@ namespace VisionCraft::Vision::Algorithms
 
         try
         {
-            const auto methodStr = GetInputValue<std::string>("Method").value_or("BGR2GRAY");
             const auto preserveAlpha = GetInputValue<bool>("PreserveAlpha").value_or(false);
 
             cv::Mat outputImage;
@@ -38,36 +124,20 @@ namespace VisionCraft::Vision::Algorithms
             if (inputImage.channels() == 1)
             {
                 outputImage = inputImage; // Shallow copy - cv::Mat uses reference counting
-                LOG_INFO("GrayscaleNode {}: Input already grayscale, passing through", GetName());
+                LOG_HOT_INFO("GrayscaleNode {}: Input already grayscale, passing through", GetName());
             }
             else
             {
-                int conversionCode = GetConversionMethod(methodStr);
+                const int conversionCode = GetPrepared(preparedConversion, [this] { return ReadConversionMethod(); });
+                outputImage = ConvertToGray(inputImage, conversionCode, preserveAlpha, CreateOutputImage());
 
                 if (inputImage.channels() == 4 && preserveAlpha)
                 {
-                    std::vector<cv::Mat> channels;
-                    cv::split(inputImage, channels);
-
-                    cv::Mat colorPart;
-                    if (inputImage.channels() == 4)
-                    {
-                        cv::Mat rgb;
-                        cv::merge(std::vector<cv::Mat>{ channels[0], channels[1], channels[2] }, rgb);
-                        cv::cvtColor(rgb,
-                            colorPart,
-                            conversionCode == cv::COLOR_BGRA2GRAY ? cv::COLOR_BGR2GRAY : cv::COLOR_RGB2GRAY);
-                    }
-
-                    std::vector<cv::Mat> grayAlpha = { colorPart, channels[3] };
-                    cv::merge(grayAlpha, outputImage);
-
-                    LOG_INFO("GrayscaleNode {}: Converted to grayscale with alpha preservation", GetName());
+                    LOG_HOT_INFO("GrayscaleNode {}: Converted to grayscale with alpha preservation", GetName());
                 }
                 else
                 {
-                    cv::cvtColor(inputImage, outputImage, conversionCode);
-                    LOG_INFO("GrayscaleNode {}: Converted to grayscale using method '{}'", GetName(), methodStr);
+                    LOG_HOT_INFO("GrayscaleNode {}: Converted to grayscale (code {})", GetName(), conversionCode);
                 }
             }
 
@@ -85,6 +155,126 @@ namespace VisionCraft::Vision::Algorithms
         }
     }
 
+    void GrayscaleNode::ProcessPlanar(const Nodes::PlanarImage &image)
+    {
+        try
+        {
+            if (image.GetChannelCount() == 1)
+            {
+                SetOutputSlotData("Output", image.GetPlane(0));
+                LOG_HOT_INFO("GrayscaleNode {}: Input already grayscale, passing through", GetName());
+                return;
+            }
+            if (image.GetChannelCount() < 3)
+            {
+                throw std::invalid_argument("Grayscale conversion needs 3 or 4 channels");
+            }
+
+            const int conversionCode = GetPrepared(preparedConversion, [this] { return ReadConversionMethod(); });
+            const bool rgbOrder = conversionCode == cv::COLOR_RGB2GRAY || conversionCode == cv::COLOR_RGBA2GRAY;
+
+            cv::Mat gray = CreateOutputImage();
+            gray.create(image.GetSize(), image.GetDepth());
+            switch (image.GetDepth())
+            {
+            case CV_8U:
+                ConvertPlanesToGray<uint8_t>(image, gray, rgbOrder);
+                break;
+            case CV_16U:
+                ConvertPlanesToGray<uint16_t>(image, gray, rgbOrder);
+                break;
+            case CV_32F:
+                ConvertPlanesToGray<float>(image, gray, rgbOrder);
+                break;
+            default:
+                throw std::invalid_argument("Planar conversion supports 8-bit, 16-bit and float images");
+            }
+
+            // The alpha plane is shared with the input, so preserving it copies nothing
+            if (image.GetChannelCount() == 4 && GetInputValue<bool>("PreserveAlpha").value_or(false))
+            {
+                SetOutputSlotData("Output", Nodes::PlanarImage({ std::move(gray), image.GetPlane(3) }));
+                LOG_HOT_INFO("GrayscaleNode {}: Converted planar image with alpha preservation", GetName());
+                return;
+            }
+            SetOutputSlotData("Output", std::move(gray));
+            LOG_HOT_INFO("GrayscaleNode {}: Converted planar image to grayscale", GetName());
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("GrayscaleNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("GrayscaleNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    std::optional<Nodes::TileOperation> GrayscaleNode::PrepareTileOperation(int inputType) const
+    {
+        const int channels = CV_MAT_CN(inputType);
+        if (channels == 1)
+        {
+            auto passThrough = [](const cv::Mat &tile) { return tile; };
+            return Nodes::TileOperation{
+                .halo = 0, .outputType = inputType, .apply = passThrough, .colorTransform = "identity"
+            };
+        }
+
+        const int conversionCode = GetPrepared(preparedConversion, [this] { return ReadConversionMethod(); });
+        const bool preserveAlpha = channels == 4 && GetInputValue<bool>("PreserveAlpha").value_or(false);
+        auto apply = [conversionCode, preserveAlpha](const cv::Mat &tile) {
+            return ConvertToGray(tile, conversionCode, preserveAlpha);
+        };
+        const int outputType = CV_MAKETYPE(CV_MAT_DEPTH(inputType), preserveAlpha ? 2 : 1);
+        return Nodes::TileOperation{ .halo = 0,
+            .outputType = outputType,
+            .apply = std::move(apply),
+            .colorTransform = "Grayscale " + std::to_string(conversionCode) + (preserveAlpha ? " alpha" : "") };
+    }
+
+    cv::Mat GrayscaleNode::ConvertToGray(
+        const cv::Mat &image, int conversionCode, bool preserveAlpha, cv::Mat outputImage)
+    {
+        if (image.channels() == 4 && preserveAlpha)
+        {
+            // Written straight into the 2-channel output; no per-channel planes are built
+            const bool rgbOrder = conversionCode == cv::COLOR_RGB2GRAY || conversionCode == cv::COLOR_RGBA2GRAY;
+            outputImage.create(image.size(), CV_MAKETYPE(image.depth(), 2));
+            switch (image.depth())
+            {
+            case CV_8U:
+                ConvertRowsToGrayAlpha<uint8_t>(image, outputImage, rgbOrder);
+                break;
+            case CV_16U:
+                ConvertRowsToGrayAlpha<uint16_t>(image, outputImage, rgbOrder);
+                break;
+            case CV_32F:
+                ConvertRowsToGrayAlpha<float>(image, outputImage, rgbOrder);
+                break;
+            default:
+                throw std::invalid_argument("PreserveAlpha supports 8-bit, 16-bit and float images");
+            }
+        }
+        else
+        {
+            cv::cvtColor(image, outputImage, conversionCode);
+        }
+        return outputImage;
+    }
+
+    void GrayscaleNode::Prepare()
+    {
+        preparedConversion = ReadConversionMethod();
+    }
+
+    int GrayscaleNode::ReadConversionMethod() const
+    {
+        return GetConversionMethod(GetInputView<std::string>("Method").ValueOr(kDefaultMethod));
+    }
+
     int GrayscaleNode::GetConversionMethod(const std::string &methodStr) const
     {
         if (methodStr == "BGR2GRAY")
@@ -96,7 +286,75 @@ namespace VisionCraft::Vision::Algorithms
         if (methodStr == "RGBA2GRAY")
             return cv::COLOR_RGBA2GRAY;
 
-        LOG_WARN("GrayscaleNode {}: Unknown conversion method '{}', using BGR2GRAY", GetName(), methodStr);
+        LOG_HOT_WARN("GrayscaleNode {}: Unknown conversion method '{}', using BGR2GRAY", GetName(), methodStr);
         return cv::COLOR_BGR2GRAY;
     }
+
+    std::optional<Nodes::ImageShape> GrayscaleNode::InferOutputShape(
+        const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+
+        const int channels = CV_MAT_CN(input->type);
+        const int depth = CV_MAT_DEPTH(input->type);
+        if (channels == 1)
+        {
+            return input;
+        }
+        if (channels != 3 && channels != 4)
+        {
+            throw std::invalid_argument("Grayscale conversion needs 1, 3 or 4 channels");
+        }
+
+        const bool preserveAlpha = channels == 4 && GetInputValue<bool>("PreserveAlpha").value_or(false);
+        if (preserveAlpha && depth != CV_8U && depth != CV_16U && depth != CV_32F)
+        {
+            throw std::invalid_argument("PreserveAlpha supports 8-bit, 16-bit and float images");
+        }
+        return Nodes::ImageShape{ .size = input->size, .type = CV_MAKETYPE(depth, preserveAlpha ? 2 : 1) };
+    }
+
+    bool GrayscaleNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        if (GetInputValue<bool>("PreserveAlpha").value_or(false))
+        {
+            return writer.Fail("PreserveAlpha has no compiled form");
+        }
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        const char *code = "cv::COLOR_BGR2GRAY";
+        switch (ReadConversionMethod())
+        {
+        case cv::COLOR_RGB2GRAY:
+            code = "cv::COLOR_RGB2GRAY";
+            break;
+        case cv::COLOR_BGRA2GRAY:
+            code = "cv::COLOR_BGRA2GRAY";
+            break;
+        case cv::COLOR_RGBA2GRAY:
+            code = "cv::COLOR_RGBA2GRAY";
+            break;
+        default:
+            break;
+        }
+        const std::string output = writer.Output("Output");
+        writer.SetPointwise();
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("if (" + input + ".channels() == 1)");
+        writer.Line("{");
+        writer.Line("    " + output + " = " + input + ";");
+        writer.Line("}");
+        writer.Line("else");
+        writer.Line("{");
+        writer.Line("    cv::cvtColor(" + input + ", " + output + ", " + code + ");");
+        writer.Line("}");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
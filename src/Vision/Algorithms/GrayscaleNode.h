@@ -32,17 +32,78 @@ namespace VisionCraft::Vision::Algorithms
             return "GrayscaleNode";
         }
 
+        /**
+         * @brief Reads interleaved and planar images alike.
+         * @return ImageLayout::Any
+         */
+        [[nodiscard]] Nodes::ImageLayout GetPreferredImageLayout() const override;
+
         /**
          * @brief Processes input image by converting to grayscale.
          */
         void Process() override;
 
+        /**
+         * @brief Keeps the input's size and depth with one channel, or two when alpha is preserved.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         * @throws std::invalid_argument for 2-channel inputs, or alpha preservation at an unsupported depth
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the conversion as a pointwise tile operation.
+         * @param inputType Type of the input image
+         * @return Tile operation using the current method
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the conversion as a pointwise cv::cvtColor call; gray input passes through.
+         * @param writer Receives the node's code
+         * @return False with PreserveAlpha set
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
     private:
+        /**
+         * @brief Converts a planar image; alpha is kept as a shared second plane when PreserveAlpha is set.
+         * @param image Input with 1, 3 or 4 planes
+         */
+        void ProcessPlanar(const Nodes::PlanarImage &image);
+
+        /**
+         * @brief Converts a multi-channel image to grayscale.
+         * @param image Input image with 3 or 4 channels
+         * @param conversionCode Code returned by GetConversionMethod()
+         * @param preserveAlpha Keep the alpha channel of 4-channel input as a second channel
+         * @param outputImage Image the result is written into (e.g. from CreateOutputImage())
+         * @return Grayscale image, with alpha when preserved
+         */
+        [[nodiscard]] static cv::Mat ConvertToGray(
+            const cv::Mat &image, int conversionCode, bool preserveAlpha, cv::Mat outputImage = {});
+
         /**
          * @brief Converts method string to OpenCV constant.
          * @param methodStr Conversion method string
          * @return OpenCV color conversion constant
          */
         int GetConversionMethod(const std::string &methodStr) const;
+
+        /**
+         * @brief Resolves the Method slot, so runs skip the string comparisons.
+         */
+        void Prepare() override;
+
+        /**
+         * @brief Reads the Method slot as an OpenCV constant.
+         * @return OpenCV color conversion constant
+         */
+        [[nodiscard]] int ReadConversionMethod() const;
+
+        inline static const std::string kDefaultMethod{ "BGR2GRAY" }; ///< Method slot default and fallback
+
+        int preparedConversion = cv::COLOR_BGR2GRAY; ///< Method slot resolved by Prepare()
     };
 } // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,56 @@
+#include "Vision/Algorithms/ImagePyramidNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+
+namespace VisionCraft::Vision::Algorithms
+{
+    ImagePyramidNode::ImagePyramidNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Filter", kDefaultFilter);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    void ImagePyramidNode::Process()
+    {
+        const auto filter = GetFilter();
+        if (const auto pyramid = GetInputValueIf<Nodes::ImagePyramid>("Input"); pyramid && !pyramid->IsEmpty())
+        {
+            SetOutputSlotData("Output",
+                pyramid->GetFilter() == filter ? *pyramid : Nodes::ImagePyramid(pyramid->GetBase(), filter));
+            return;
+        }
+
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("ImagePyramidNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+        SetOutputSlotData("Output", Nodes::ImagePyramid(*inputData, filter));
+    }
+
+    bool ImagePyramidNode::AcceptsImagePyramids() const
+    {
+        return true;
+    }
+
+    Nodes::ImagePyramid::Filter ImagePyramidNode::GetFilter() const
+    {
+        const auto filterView = GetInputView<std::string>("Filter");
+        const auto &filter = filterView.ValueOr(kDefaultFilter);
+        if (filter == "Area")
+            return Nodes::ImagePyramid::Filter::Area;
+        if (filter != "Gaussian")
+        {
+            LOG_HOT_WARN("ImagePyramidNode {}: Unknown filter '{}', using Gaussian", GetName(), filter);
+        }
+        return Nodes::ImagePyramid::Filter::Gaussian;
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Nodes/Core/ImagePyramid.h"
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+
+#include <string>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node wrapping its input image in a Nodes::ImagePyramid.
+     *
+     * No level is built here: every consumer that samples the pyramid (Resize, coarse-to-fine nodes) builds
+     * only the levels it reads, once, and shares them with the others. Consumers that do not read pyramids
+     * receive the input image itself. Filter selects "Gaussian" (cv::pyrDown) or "Area" (INTER_AREA) levels.
+     */
+    class ImagePyramidNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs image pyramid node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        ImagePyramidNode(Nodes::NodeId id, const std::string &name = "Image Pyramid");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "ImagePyramidNode";
+        }
+
+        /**
+         * @brief Outputs a pyramid over the input image.
+         */
+        void Process() override;
+
+        /**
+         * @brief Reads pyramid inputs, passing one on when its filter matches so its levels stay shared.
+         * @return Always true
+         */
+        [[nodiscard]] bool AcceptsImagePyramids() const override;
+
+    private:
+        /**
+         * @brief Reads the Filter slot.
+         * @return Selected filter (Gaussian for unknown names)
+         */
+        [[nodiscard]] Nodes::ImagePyramid::Filter GetFilter() const;
+
+        inline static const std::string kDefaultFilter{ "Gaussian" }; ///< Filter slot default and fallback
+    };
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,80 @@
+#include "Vision/Algorithms/MaskLogicNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    MaskLogicNode::MaskLogicNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("A").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("B").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Operation", kDefaultOperation);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("Count").SetDataType(Nodes::SlotDataType::Int);
+    }
+
+    void MaskLogicNode::Process()
+    {
+        try
+        {
+            const auto a = ReadMask("A");
+            const auto b = ReadMask("B");
+            if (a.IsEmpty() || b.IsEmpty()) [[unlikely]]
+            {
+                LOG_HOT_WARN("MaskLogicNode {}: Masks A and B are required", GetName());
+                ClearOutputSlot("Output");
+                ClearOutputSlot("Count");
+                return;
+            }
+
+            auto combined = Kernels::CombineMasks(a, b, GetOperation());
+            SetOutputSlotData("Count", static_cast<int>(Kernels::CountMaskPixels(combined)));
+            SetOutputSlotData("Output", std::move(combined));
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("MaskLogicNode {}: Error combining masks: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+            ClearOutputSlot("Count");
+        }
+    }
+
+    bool MaskLogicNode::AcceptsBitMasks() const
+    {
+        return true;
+    }
+
+    Nodes::BitMask MaskLogicNode::ReadMask(const std::string &slotName) const
+    {
+        if (const auto mask = GetInputValueIf<Nodes::BitMask>(slotName))
+        {
+            return *mask;
+        }
+        if (const auto image = GetInputValueIf<cv::Mat>(slotName))
+        {
+            return Nodes::BitMask::FromImage(*image);
+        }
+        return {};
+    }
+
+    Kernels::MaskOperation MaskLogicNode::GetOperation() const
+    {
+        const auto operationView = GetInputView<std::string>("Operation");
+        const auto &operation = operationView.ValueOr(kDefaultOperation);
+        if (operation == "OR")
+            return Kernels::MaskOperation::Or;
+        if (operation == "XOR")
+            return Kernels::MaskOperation::Xor;
+        if (operation != "AND")
+        {
+            LOG_HOT_WARN("MaskLogicNode {}: Unknown operation '{}', using AND", GetName(), operation);
+        }
+        return Kernels::MaskOperation::And;
+    }
+} // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Nodes/Core/BitMask.h"
+#include "Nodes/Core/Node.h"
+#include "Vision/Kernels/BitMaskOps.h"
+#include <opencv2/opencv.hpp>
+
+#include <string>
+
+namespace VisionCraft::Vision::Algorithms
+{
+    /**
+     * @brief Node combining two binary masks with AND, OR or XOR.
+     *
+     * Works on Nodes::BitMask values 64 pixels per word; single-channel 8-bit inputs (any nonzero pixel set)
+     * are packed first. Output is the combined mask, Count the number of its set pixels.
+     */
+    class MaskLogicNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs mask logic node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        MaskLogicNode(Nodes::NodeId id, const std::string &name = "Mask Logic");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "MaskLogicNode";
+        }
+
+        /**
+         * @brief Combines the A and B masks.
+         */
+        void Process() override;
+
+        /**
+         * @brief Reads bit masks without unpacking them.
+         * @return Always true
+         */
+        [[nodiscard]] bool AcceptsBitMasks() const override;
+
+    private:
+        /**
+         * @brief Reads one input as a mask.
+         * @param slotName Input slot
+         * @return Packed mask (empty if the slot holds none)
+         * @throws std::invalid_argument for images that are not single-channel 8-bit
+         */
+        [[nodiscard]] Nodes::BitMask ReadMask(const std::string &slotName) const;
+
+        /**
+         * @brief Reads the Operation slot.
+         * @return Selected operation (And for unknown names)
+         */
+        [[nodiscard]] Kernels::MaskOperation GetOperation() const;
+
+        inline static const std::string kDefaultOperation{ "AND" }; ///< Operation slot default and fallback
+    };
+} // namespace VisionCraft::Vision::Algorithms
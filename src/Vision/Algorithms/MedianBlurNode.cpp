@@ -1,9 +1,306 @@
 #include "Vision/Algorithms/MedianBlurNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <optional>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        // Source offset of every padded column: columns outside the image repeat the border one, as in
+        // cv::medianBlur's BORDER_REPLICATE
+        std::vector<int> PaddedColumnOffsets(const cv::Mat &image, int radius, int channel)
+        {
+            std::vector<int> offsets(static_cast<size_t>(image.cols + 2 * radius));
+            for (size_t column = 0; column < offsets.size(); ++column)
+            {
+                const int x = std::clamp(static_cast<int>(column) - radius, 0, image.cols - 1);
+                offsets[column] = x * image.channels() + channel;
+            }
+            return offsets;
+        }
+
+        template<typename T> const T *ClampedRow(const cv::Mat &image, int y)
+        {
+            return image.ptr<T>(std::clamp(y, 0, image.rows - 1));
+        }
+
+        // Perreault & Hebert, "Median Filtering in Constant Time" (2007). Each padded column keeps a 256-bin
+        // histogram of its ksize pixels; moving down a row swaps one pixel per column, and moving right adds
+        // one column histogram to the kernel's and subtracts another. Per-pixel cost does not depend on
+        // ksize, and the 256-bin additions vectorize. A 16-bin coarse histogram narrows the search.
+        void MedianRows8U(const cv::Mat &image, cv::Mat &output, int ksize, int channel, int rowBegin, int rowEnd)
+        {
+            constexpr size_t kBins = 256;
+            constexpr size_t kCoarseBins = 16;
+            constexpr int kCoarseShift = 4;
+            const int radius = ksize / 2;
+            const auto rank = static_cast<uint32_t>(ksize * ksize / 2);
+            const auto offsets = PaddedColumnOffsets(image, radius, channel);
+
+            std::vector<uint16_t> columnFine(offsets.size() * kBins);
+            std::vector<uint16_t> columnCoarse(offsets.size() * kCoarseBins);
+            const auto addRow = [&](const uint8_t *row) {
+                for (size_t column = 0; column < offsets.size(); ++column)
+                {
+                    const uint8_t value = row[offsets[column]];
+                    ++columnFine[column * kBins + value];
+                    ++columnCoarse[column * kCoarseBins + (value >> kCoarseShift)];
+                }
+            };
+            const auto removeRow = [&](const uint8_t *row) {
+                for (size_t column = 0; column < offsets.size(); ++column)
+                {
+                    const uint8_t value = row[offsets[column]];
+                    --columnFine[column * kBins + value];
+                    --columnCoarse[column * kCoarseBins + (value >> kCoarseShift)];
+                }
+            };
+
+            for (int y = rowBegin - radius; y <= rowBegin + radius; ++y)
+            {
+                addRow(ClampedRow<uint8_t>(image, y));
+            }
+
+            std::array<uint32_t, kBins> kernelFine{};
+            std::array<uint32_t, kCoarseBins> kernelCoarse{};
+            // Slides the kernel one column right: column enters, column - ksize leaves
+            const auto slide = [&](size_t entering, std::optional<size_t> leaving) {
+                const uint16_t *fineIn = &columnFine[entering * kBins];
+                const uint16_t *coarseIn = &columnCoarse[entering * kCoarseBins];
+                if (!leaving)
+                {
+                    for (size_t bin = 0; bin < kBins; ++bin)
+                        kernelFine[bin] += fineIn[bin];
+                    for (size_t bin = 0; bin < kCoarseBins; ++bin)
+                        kernelCoarse[bin] += coarseIn[bin];
+                    return;
+                }
+                const uint16_t *fineOut = &columnFine[*leaving * kBins];
+                const uint16_t *coarseOut = &columnCoarse[*leaving * kCoarseBins];
+                for (size_t bin = 0; bin < kBins; ++bin)
+                    kernelFine[bin] = kernelFine[bin] + fineIn[bin] - fineOut[bin];
+                for (size_t bin = 0; bin < kCoarseBins; ++bin)
+                    kernelCoarse[bin] = kernelCoarse[bin] + coarseIn[bin] - coarseOut[bin];
+            };
+
+            const auto kernelColumns = static_cast<size_t>(ksize);
+            const int channels = image.channels();
+            for (int y = rowBegin; y < rowEnd; ++y)
+            {
+                if (y > rowBegin)
+                {
+                    removeRow(ClampedRow<uint8_t>(image, y - radius - 1));
+                    addRow(ClampedRow<uint8_t>(image, y + radius));
+                }
+
+                kernelFine.fill(0);
+                kernelCoarse.fill(0);
+                for (size_t column = 0; column < kernelColumns; ++column)
+                {
+                    slide(column, std::nullopt);
+                }
+
+                uint8_t *destination = output.ptr<uint8_t>(y) + channel;
+                for (int x = 0; x < image.cols; ++x)
+                {
+                    const auto first = static_cast<size_t>(x);
+                    if (x > 0)
+                    {
+                        slide(first + kernelColumns - 1, first - 1);
+                    }
+
+                    uint32_t below = 0;
+                    size_t block = 0;
+                    while (below + kernelCoarse[block] <= rank)
+                    {
+                        below += kernelCoarse[block++];
+                    }
+                    size_t bin = block << kCoarseShift;
+                    while (below + kernelFine[bin] <= rank)
+                    {
+                        below += kernelFine[bin++];
+                    }
+                    destination[x * channels] = static_cast<uint8_t>(bin);
+                }
+            }
+        }
+
+        // Huang's sliding window over a two-level histogram (256 coarse bins over 65536 fine ones): moving
+        // right swaps one kernel column, O(ksize) per pixel, and the search scans at most 256 + 256 bins.
+        void MedianRows16U(const cv::Mat &image, cv::Mat &output, int ksize, int channel, int rowBegin, int rowEnd)
+        {
+            constexpr size_t kFineBins = 65536;
+            constexpr size_t kCoarseBins = 256;
+            constexpr int kCoarseShift = 8;
+            const int radius = ksize / 2;
+            const auto rank = static_cast<uint32_t>(ksize * ksize / 2);
+            const auto offsets = PaddedColumnOffsets(image, radius, channel);
+
+            std::vector<uint32_t> fine(kFineBins);
+            std::array<uint32_t, kCoarseBins> coarse{};
+            std::vector<const uint16_t *> rows(static_cast<size_t>(ksize));
+            const auto add = [&](size_t column) {
+                for (const uint16_t *row : rows)
+                {
+                    const uint16_t value = row[offsets[column]];
+                    ++fine[value];
+                    ++coarse[value >> kCoarseShift];
+                }
+            };
+            const auto remove = [&](size_t column) {
+                for (const uint16_t *row : rows)
+                {
+                    const uint16_t value = row[offsets[column]];
+                    --fine[value];
+                    --coarse[value >> kCoarseShift];
+                }
+            };
+
+            const auto kernelColumns = static_cast<size_t>(ksize);
+            const int channels = image.channels();
+            for (int y = rowBegin; y < rowEnd; ++y)
+            {
+                for (size_t row = 0; row < rows.size(); ++row)
+                {
+                    rows[row] = ClampedRow<uint16_t>(image, y - radius + static_cast<int>(row));
+                }
+                for (size_t column = 0; column < kernelColumns; ++column)
+                {
+                    add(column);
+                }
+
+                uint16_t *destination = output.ptr<uint16_t>(y) + channel;
+                for (int x = 0; x < image.cols; ++x)
+                {
+                    const auto first = static_cast<size_t>(x);
+                    if (x > 0)
+                    {
+                        remove(first - 1);
+                        add(first + kernelColumns - 1);
+                    }
+
+                    uint32_t below = 0;
+                    size_t block = 0;
+                    while (below + coarse[block] <= rank)
+                    {
+                        below += coarse[block++];
+                    }
+                    size_t bin = block << kCoarseShift;
+                    while (below + fine[bin] <= rank)
+                    {
+                        below += fine[bin++];
+                    }
+                    destination[x * channels] = static_cast<uint16_t>(bin);
+                }
+
+                // Emptying the last window is cheaper than clearing 65536 bins
+                for (size_t column = offsets.size() - kernelColumns; column < offsets.size(); ++column)
+                {
+                    remove(column);
+                }
+            }
+        }
+
+        // Gathers each window and selects its middle element: O(ksize^2) per pixel, for depths no histogram
+        // covers
+        template<typename T>
+        void MedianRowsBySelection(const cv::Mat &image, cv::Mat &output, int ksize, int channel, int rowBegin,
+            int rowEnd)
+        {
+            const int radius = ksize / 2;
+            const auto offsets = PaddedColumnOffsets(image, radius, channel);
+            const auto kernelColumns = static_cast<size_t>(ksize);
+            const auto middle = static_cast<std::ptrdiff_t>(kernelColumns * kernelColumns / 2);
+            std::vector<const T *> rows(kernelColumns);
+            std::vector<T> window(kernelColumns * kernelColumns);
+            const int channels = image.channels();
+            for (int y = rowBegin; y < rowEnd; ++y)
+            {
+                for (size_t row = 0; row < rows.size(); ++row)
+                {
+                    rows[row] = ClampedRow<T>(image, y - radius + static_cast<int>(row));
+                }
+
+                T *destination = output.ptr<T>(y) + channel;
+                for (int x = 0; x < image.cols; ++x)
+                {
+                    auto value = window.begin();
+                    for (const T *row : rows)
+                    {
+                        for (size_t column = 0; column < kernelColumns; ++column)
+                        {
+                            *value++ = row[offsets[static_cast<size_t>(x) + column]];
+                        }
+                    }
+                    std::nth_element(window.begin(), window.begin() + middle, window.end());
+                    destination[x * channels] = window[static_cast<size_t>(middle)];
+                }
+            }
+        }
+
+        // Kernels cv::medianBlur handles slowly (large 8-bit) or not at all (above 5 for 16-bit and float)
+        bool UsesStripEngine(int depth, int ksize)
+        {
+            if (depth == CV_8U)
+            {
+                return ksize >= Constants::Median::kHistogramMinKernel;
+            }
+            return (depth == CV_16U || depth == CV_32F) && ksize > Constants::Median::kMaxOpenCvWideKernel;
+        }
+
+        // Filters row strips in parallel on OpenCV's thread pool; each strip reads its halo rows straight from
+        // the image. Returns false if stopRequested() reported true before every strip ran.
+        bool MedianBlurInStrips(
+            const cv::Mat &image, cv::Mat &output, int ksize, const std::function<bool()> &stopRequested = {})
+        {
+            output.create(image.size(), image.type());
+            const int stripRows = std::max(Constants::Median::kMinStripRows, 2 * ksize);
+            const int stripCount = (image.rows + stripRows - 1) / stripRows;
+            std::atomic<bool> stopped{ false };
+
+            cv::parallel_for_(cv::Range(0, stripCount), [&](const cv::Range &range) {
+                for (int strip = range.start; strip < range.end; ++strip)
+                {
+                    if (stopped.load(std::memory_order_relaxed) || (stopRequested && stopRequested()))
+                    {
+                        stopped.store(true, std::memory_order_relaxed);
+                        return;
+                    }
+
+                    const int rowBegin = strip * stripRows;
+                    const int rowEnd = std::min(image.rows, rowBegin + stripRows);
+                    for (int channel = 0; channel < image.channels(); ++channel)
+                    {
+                        switch (image.depth())
+                        {
+                        case CV_8U:
+                            MedianRows8U(image, output, ksize, channel, rowBegin, rowEnd);
+                            break;
+                        case CV_16U:
+                            MedianRows16U(image, output, ksize, channel, rowBegin, rowEnd);
+                            break;
+                        default:
+                            MedianRowsBySelection<float>(image, output, ksize, channel, rowBegin, rowEnd);
+                            break;
+                        }
+                    }
+                }
+            });
+            return !stopped.load();
+        }
+    } // namespace
+
     MedianBlurNode::MedianBlurNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -11,17 +308,17 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("ksize", 3);
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void MedianBlurNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty()) [[unlikely]]
         {
-            LOG_WARN("MedianBlurNode {}: No input image provided", GetName());
+            LOG_HOT_WARN("MedianBlurNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
@@ -30,25 +327,49 @@ namespace VisionCraft::Vision::Algorithms
 
         try
         {
-            auto ksize = GetInputValue<int>("ksize").value_or(3);
+            const int ksize = GetKernelSize();
 
-            // Validate ksize (must be odd and >= 3)
-            if (ksize < 3) [[unlikely]]
+            cv::Mat outputImage = CreateOutputImage();
+            if (UsesStripEngine(inputImage.depth(), ksize))
             {
-                ksize = 3;
-                LOG_WARN("MedianBlurNode {}: ksize must be >= 3, adjusting to {}", GetName(), ksize);
+                if (!MedianBlurInStrips(inputImage, outputImage, ksize, [this]() { return IsStopRequested(); }))
+                {
+                    ThrowIfStopRequested();
+                }
             }
-            if (ksize % 2 == 0) [[unlikely]]
+            else if (inputImage.total() <= Constants::Cancellation::kStripPixels)
             {
-                ksize++;
-                LOG_WARN("MedianBlurNode {}: ksize must be odd, adjusting to {}", GetName(), ksize);
+                cv::medianBlur(inputImage, outputImage, ksize);
             }
+            else
+            {
+                // Large kernels on large scans take seconds; row strips let the run stop in between
+                outputImage.create(inputImage.size(), inputImage.type());
+                const int halo = ksize / 2;
+                const int stripRows = std::max(
+                    1, static_cast<int>(Constants::Cancellation::kStripPixels / static_cast<size_t>(inputImage.cols)));
+                for (int y = 0; y < inputImage.rows; y += stripRows)
+                {
+                    ThrowIfStopRequested();
 
-            cv::Mat outputImage;
-            cv::medianBlur(inputImage, outputImage, ksize);
+                    // Filtered with halo rows of context on each side, so strip borders match a whole-image run
+                    const int rows = std::min(stripRows, inputImage.rows - y);
+                    const int top = std::max(0, y - halo);
+                    const int bottom = std::min(inputImage.rows, y + rows + halo);
+                    cv::Mat strip;
+                    cv::medianBlur(inputImage(cv::Rect(0, top, inputImage.cols, bottom - top)), strip, ksize);
+                    cv::Mat destination = outputImage(cv::Rect(0, y, inputImage.cols, rows));
+                    strip(cv::Rect(0, y - top, inputImage.cols, rows)).copyTo(destination);
+                }
+            }
             SetOutputSlotData("Output", std::move(outputImage));
 
-            LOG_INFO("MedianBlurNode {}: Applied Median Blur (ksize: {})", GetName(), ksize);
+            LOG_HOT_INFO("MedianBlurNode {}: Applied Median Blur (ksize: {})", GetName(), ksize);
+        }
+        catch (const Nodes::ExecutionStopped &)
+        {
+            ClearOutputSlot("Output");
+            throw;
         }
         catch (const cv::Exception &e)
         {
@@ -61,4 +382,60 @@ namespace VisionCraft::Vision::Algorithms
             ClearOutputSlot("Output");
         }
     }
+
+    std::optional<Nodes::TileOperation> MedianBlurNode::PrepareTileOperation(int inputType) const
+    {
+        const int ksize = GetKernelSize();
+        auto apply = [ksize](const cv::Mat &tile) {
+            cv::Mat result;
+            if (UsesStripEngine(tile.depth(), ksize))
+            {
+                MedianBlurInStrips(tile, result, ksize);
+            }
+            else
+            {
+                cv::medianBlur(tile, result, ksize);
+            }
+            return result;
+        };
+        return Nodes::TileOperation{ .halo = ksize / 2, .outputType = inputType, .apply = std::move(apply) };
+    }
+
+    int MedianBlurNode::GetKernelSize() const
+    {
+        auto ksize = GetInputValue<int>("ksize").value_or(3);
+
+        // Validate ksize (must be odd and >= 3)
+        if (ksize < 3) [[unlikely]]
+        {
+            ksize = 3;
+            LOG_HOT_WARN("MedianBlurNode {}: ksize must be >= 3, adjusting to {}", GetName(), ksize);
+        }
+        if (ksize % 2 == 0) [[unlikely]]
+        {
+            ksize++;
+            LOG_HOT_WARN("MedianBlurNode {}: ksize must be odd, adjusting to {}", GetName(), ksize);
+        }
+        return ScaleKernelSize(ksize, 3);
+    }
+
+    std::optional<Nodes::ImageShape> MedianBlurNode::InferOutputShape(
+        const std::optional<Nodes::ImageShape> &input) const
+    {
+        return input;
+    }
+
+    bool MedianBlurNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("cv::medianBlur(" + input + ", " + writer.Output("Output") + ", " +
+                    writer.Constant("KernelSize", GetKernelSize()) + ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -7,6 +7,9 @@ namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for Median Blur.
+     *
+     * Large 8-bit kernels and 16-bit or float kernels above 5 run on a histogram engine in parallel row
+     * strips (see Constants::Median); other kernels use cv::medianBlur.
      */
     class MedianBlurNode : public Nodes::Node
     {
@@ -36,5 +39,34 @@ namespace VisionCraft::Vision::Algorithms
          * @brief Processes input image using Median Blur.
          */
         void Process() override;
+
+        /**
+         * @brief Keeps the input's shape.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the blur as a tile operation; the halo is half the kernel size.
+         * @param inputType Type of the input image
+         * @return Tile operation using the current ksize
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the blur as a cv::medianBlur call with the validated kernel size.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+    protected:
+        /**
+         * @brief Reads ksize, adjusted to the nearest valid value and scaled to proxy runs.
+         * @return Odd kernel size of at least 3
+         */
+        [[nodiscard]] int GetKernelSize() const;
     };
 } // namespace VisionCraft::Vision::Algorithms
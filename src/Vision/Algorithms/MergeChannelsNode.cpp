@@ -1,6 +1,8 @@
 #include "Vision/Algorithms/MergeChannelsNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
 #include <stdexcept>
+#include <vector>
 
 namespace VisionCraft::Vision::Algorithms
 {
@@ -13,55 +15,165 @@ namespace VisionCraft::Vision::Algorithms
         // Data pins
         for (const auto &slotName : kChannelSlots)
         {
-            CreateInputSlot(slotName);
+            CreateInputSlot(slotName).SetDataType(Nodes::SlotDataType::Image);
         }
-        CreateOutputSlot("Output");
+        CreateInputSlot("Layout", kDefaultLayout);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
-    void MergeChannelsNode::Process()
+    Nodes::ImageLayout MergeChannelsNode::GetOutputLayout() const
     {
-        std::vector<cv::Mat> channels;
-
-        // Get all channel inputs
-        const std::array channelInputs{ GetInputValue<cv::Mat>(kChannelSlots[0]),
-            GetInputValue<cv::Mat>(kChannelSlots[1]),
-            GetInputValue<cv::Mat>(kChannelSlots[2]),
-            GetInputValue<cv::Mat>(kChannelSlots[3]) };
-
-        // Channel 1 is required
-        if (!channelInputs[0] || channelInputs[0]->empty()) [[unlikely]]
+        const auto layoutView = GetInputView<std::string>("Layout");
+        const auto &layout = layoutView.ValueOr(kDefaultLayout);
+        if (layout == "Planar")
+            return Nodes::ImageLayout::Planar;
+        if (layout != "Interleaved")
         {
-            LOG_WARN("MergeChannelsNode {}: Channel 1 is required", GetName());
-            ClearOutputSlot("Output");
-            return;
+            LOG_HOT_WARN("MergeChannelsNode {}: Unknown layout '{}', using Interleaved", GetName(), layout);
         }
+        return Nodes::ImageLayout::Interleaved;
+    }
 
-        channels.push_back(*channelInputs[0]);
+    bool MergeChannelsNode::AcceptsChannelViews() const
+    {
+        return true;
+    }
 
-        // Check compatibility and add other channels
-        auto checkCompat = [&](const cv::Mat &m) {
-            return !m.empty() && m.size() == channels[0].size() && m.depth() == channels[0].depth();
+    Nodes::ImageLayout MergeChannelsNode::GetPreferredImageLayout() const
+    {
+        return Nodes::ImageLayout::Any;
+    }
+
+    void MergeChannelsNode::Process()
+    {
+        // Each output channel is one channel of one source: a view gives its channel, an image or a planar
+        // image all of theirs
+        std::vector<cv::Mat> sources;
+        std::vector<ChannelPick> picks;
+        bool viewsOfOneImage = true; // Every input is a view of the same image
+
+        const auto addSource = [&](const cv::Mat &source, int firstChannel, int lastChannel) {
+            for (int channel = firstChannel; channel < lastChannel; ++channel)
+            {
+                picks.push_back({ .source = sources.size(), .channel = channel });
+            }
+            sources.push_back(source);
         };
 
-        for (size_t i = 1; i < channelInputs.size(); ++i)
+        for (size_t i = 0; i < kChannelSlots.size(); ++i)
         {
-            if (channelInputs[i] && checkCompat(*channelInputs[i]))
+            const auto view = GetInputValueIf<Nodes::ChannelView>(kChannelSlots[i]);
+            const auto planar = view ? nullptr : GetInputValueIf<Nodes::PlanarImage>(kChannelSlots[i]);
+            const auto image = view || planar ? nullptr : GetInputValueIf<cv::Mat>(kChannelSlots[i]);
+            const cv::Mat *input = view ? &view->source : image.get();
+            if (planar && !planar->IsEmpty())
+            {
+                input = &planar->GetPlane(0);
+            }
+
+            // Channel 1 is required
+            if ((!input || input->empty()) && i == 0) [[unlikely]]
             {
-                channels.push_back(*channelInputs[i]);
+                LOG_HOT_WARN("MergeChannelsNode {}: Channel 1 is required", GetName());
+                ClearOutputSlot("Output");
+                return;
             }
-            else if (channelInputs[i] && !channelInputs[i]->empty()) [[unlikely]]
+            if (!input || input->empty())
+            {
+                continue;
+            }
+
+            // Check compatibility with Channel 1
+            if (!sources.empty() && (input->size() != sources[0].size() || input->depth() != sources[0].depth()))
+                [[unlikely]]
             {
-                LOG_WARN("MergeChannelsNode {}: {} size/depth mismatch, ignoring", GetName(), kChannelSlots[i]);
+                LOG_HOT_WARN("MergeChannelsNode {}: {} size/depth mismatch, ignoring", GetName(), kChannelSlots[i]);
+                continue;
+            }
+
+            viewsOfOneImage = viewsOfOneImage && view
+                              && (sources.empty()
+                                  || (input->data == sources[0].data && input->step1() == sources[0].step1()
+                                      && input->type() == sources[0].type()));
+            if (view)
+            {
+                addSource(view->source, view->channel, view->channel + 1);
+            }
+            else if (planar)
+            {
+                for (const auto &plane : planar->GetPlanes())
+                {
+                    addSource(plane, 0, 1);
+                }
+            }
+            else
+            {
+                addSource(*input, 0, input->channels());
             }
         }
 
+        const int channelCount = static_cast<int>(picks.size());
         try
         {
-            cv::Mat outputImage;
-            cv::merge(channels, outputImage);
+            // Views of channels 0..n-1 of one n-channel image merge back into that image
+            bool identity = viewsOfOneImage && channelCount == sources[0].channels();
+            for (int channel = 0; identity && channel < channelCount; ++channel)
+            {
+                identity = picks[static_cast<size_t>(channel)].channel == channel;
+            }
+            if (identity)
+            {
+                // Split → Merge round trip with every channel untouched: no pixels move
+                SetOutputSlotData("Output", sources[0]);
+                LOG_HOT_INFO("MergeChannelsNode {}: Passed through {} channels", GetName(), channelCount);
+                return;
+            }
+
+            if (GetOutputLayout() == Nodes::ImageLayout::Planar)
+            {
+                // Single-channel sources become planes as they are; only views and image channels are copied
+                std::vector<cv::Mat> planes;
+                planes.reserve(picks.size());
+                for (const auto &pick : picks)
+                {
+                    const cv::Mat &source = sources[pick.source];
+                    if (source.channels() == 1)
+                    {
+                        planes.push_back(source);
+                        continue;
+                    }
+                    cv::Mat plane = CreateOutputImage();
+                    cv::extractChannel(source, plane, pick.channel);
+                    planes.push_back(std::move(plane));
+                }
+                SetOutputSlotData("Output", Nodes::PlanarImage(std::move(planes)));
+                LOG_HOT_INFO("MergeChannelsNode {}: Merged {} channels into planes", GetName(), channelCount);
+                return;
+            }
+
+            // Interleaves straight from strided views and planes into the output, in a single pass
+            std::vector<int> firstChannels;
+            int sourceChannels = 0;
+            for (const auto &source : sources)
+            {
+                firstChannels.push_back(sourceChannels);
+                sourceChannels += source.channels();
+            }
+            std::vector<int> fromTo;
+            fromTo.reserve(2 * picks.size());
+            for (size_t channel = 0; channel < picks.size(); ++channel)
+            {
+                fromTo.push_back(firstChannels[picks[channel].source] + picks[channel].channel);
+                fromTo.push_back(static_cast<int>(channel));
+            }
+
+            cv::Mat outputImage = CreateOutputImage();
+            outputImage.create(sources[0].size(), CV_MAKETYPE(sources[0].depth(), channelCount));
+            std::vector<cv::Mat> destination{ outputImage };
+            cv::mixChannels(sources, destination, fromTo);
             SetOutputSlotData("Output", std::move(outputImage));
 
-            LOG_INFO("MergeChannelsNode {}: Merged {} channels", GetName(), channels.size());
+            LOG_HOT_INFO("MergeChannelsNode {}: Merged {} channels", GetName(), channelCount);
         }
         catch (const cv::Exception &e)
         {
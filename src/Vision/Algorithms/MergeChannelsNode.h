@@ -7,6 +7,11 @@ namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for merging image channels.
+     *
+     * Inputs may be single-channel images, multi-channel images or Nodes::PlanarImage values (all channels
+     * taken) or Nodes::ChannelView values. Views of one image that cover all its channels in order are passed
+     * through without a copy. With Layout "Planar" the output is a Nodes::PlanarImage whose single-channel
+     * inputs are shared rather than interleaved.
      */
     class MergeChannelsNode : public Nodes::Node
     {
@@ -32,12 +37,40 @@ namespace VisionCraft::Vision::Algorithms
             return "MergeChannelsNode";
         }
 
+        /**
+         * @brief Reads channel views from SplitChannelsNode without extracting them first.
+         * @return True
+         */
+        [[nodiscard]] bool AcceptsChannelViews() const override;
+
+        /**
+         * @brief Reads interleaved and planar images alike.
+         * @return ImageLayout::Any
+         */
+        [[nodiscard]] Nodes::ImageLayout GetPreferredImageLayout() const override;
+
         /**
          * @brief Processes input channels and merges them.
          */
         void Process() override;
 
     private:
+        /**
+         * @brief One output channel: a channel of one source image.
+         */
+        struct ChannelPick
+        {
+            size_t source = 0; ///< Index into the source images
+            int channel = 0;   ///< Channel within that image
+        };
+
+        /**
+         * @brief Returns layout selected by the Layout slot.
+         * @return ImageLayout::Planar for "Planar", otherwise ImageLayout::Interleaved
+         */
+        [[nodiscard]] Nodes::ImageLayout GetOutputLayout() const;
+
         static constexpr std::array kChannelSlots{ "Channel 1", "Channel 2", "Channel 3", "Channel 4" };
+        inline static const std::string kDefaultLayout{ "Interleaved" }; ///< Layout slot default and fallback
     };
 } // namespace VisionCraft::Vision::Algorithms
@@ -1,12 +1,327 @@
 #include "Vision/Algorithms/MorphologyNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Vision/Kernels/BitMaskOps.h"
+#include "Vision/Kernels/Kernels.h"
 #include <algorithm>
 #include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        // Rectangle of a structuring element, as inclusive offsets from the anchor (shared with the mask kernels)
+        using ElementRectangle = Kernels::MaskRectangle;
+
+        // Writes the element as a union of rectangles: one per distinct row run, spanning every row whose run
+        // contains it. Exact for rectangles, crosses and ellipses, whose rows are single nested runs; any
+        // other element returns nullopt.
+        std::optional<std::vector<ElementRectangle>> DecomposeElement(const cv::Mat &element, cv::Point anchor)
+        {
+            struct Run
+            {
+                int first = 0;
+                int last = -1;
+            };
+            std::vector<Run> runs(static_cast<size_t>(element.rows));
+            for (int y = 0; y < element.rows; ++y)
+            {
+                const auto *row = element.ptr<uint8_t>(y);
+                const auto *first = std::find_if(row, row + element.cols, [](uint8_t value) { return value != 0; });
+                const auto *end = std::find(first, row + element.cols, uint8_t{ 0 });
+                if (std::find_if(end, row + element.cols, [](uint8_t value) { return value != 0; }) !=
+                    row + element.cols)
+                {
+                    return std::nullopt;
+                }
+                runs[static_cast<size_t>(y)] =
+                    Run{ static_cast<int>(first - row), static_cast<int>(end - row) - 1 };
+            }
+
+            std::vector<ElementRectangle> rectangles;
+            for (const auto &run : runs)
+            {
+                const int left = run.first - anchor.x;
+                const int right = run.last - anchor.x;
+                if (run.last < run.first || std::any_of(rectangles.begin(), rectangles.end(), [&](const auto &r) {
+                        return r.left == left && r.right == right;
+                    }))
+                {
+                    continue;
+                }
+
+                int top = -1;
+                int bottom = -1;
+                int count = 0;
+                for (int y = 0; y < element.rows; ++y)
+                {
+                    const Run &other = runs[static_cast<size_t>(y)];
+                    if (other.first <= run.first && other.last >= run.last)
+                    {
+                        top = top < 0 ? y : top;
+                        bottom = y;
+                        ++count;
+                    }
+                }
+                if (bottom - top + 1 != count)
+                {
+                    return std::nullopt;
+                }
+                rectangles.push_back(
+                    { .left = left, .right = right, .top = top - anchor.y, .bottom = bottom - anchor.y });
+            }
+            if (rectangles.empty())
+            {
+                return std::nullopt;
+            }
+            return rectangles;
+        }
+
+        // Erosion and dilation operators: op(a, b) for one element, Op::Rows() for whole rows through the SIMD kernels
+        template<typename T> struct MinimumOp
+        {
+            T operator()(T a, T b) const
+            {
+                return std::min(a, b);
+            }
+
+            static void Rows(const T *a, const T *b, T *dst, size_t count)
+            {
+                Kernels::Minimum(a, b, dst, count);
+            }
+        };
+
+        template<typename T> struct MaximumOp
+        {
+            T operator()(T a, T b) const
+            {
+                return std::max(a, b);
+            }
+
+            static void Rows(const T *a, const T *b, T *dst, size_t count)
+            {
+                Kernels::Maximum(a, b, dst, count);
+            }
+        };
+
+        // van Herk/Gil-Werman: out[i] = op over in[i .. i + window - 1] for i < count, at three comparisons per
+        // element whatever the window. Blocks of window elements keep running extrema from their start
+        // (prefix) and to their end (suffix); every window covers the tail of one block and the head of the
+        // next, so out[i] = op(suffix[i], prefix[i + window - 1]).
+        template<typename T, typename Op>
+        void SlidingExtremum(const T *in, size_t count, size_t window, T *prefix, T *suffix, T *out, Op op)
+        {
+            const size_t length = count + window - 1;
+            for (size_t i = 0; i < length; ++i)
+            {
+                prefix[i] = i % window == 0 ? in[i] : op(prefix[i - 1], in[i]);
+            }
+            for (size_t i = length; i-- > 0;)
+            {
+                suffix[i] = (i + 1) % window == 0 || i + 1 == length ? in[i] : op(suffix[i + 1], in[i]);
+            }
+            for (size_t i = 0; i < count; ++i)
+            {
+                out[i] = op(suffix[i], prefix[i + window - 1]);
+            }
+        }
+
+        // Erodes or dilates (op = min or max) with one rectangle, as a horizontal pass then a vertical one.
+        // Pixels outside the image read as border, which op never picks, as in cv::morphologyEx.
+        template<typename T, typename Op>
+        void ExtremumOverRectangle(
+            const cv::Mat &image, cv::Mat &output, const ElementRectangle &rectangle, T border, Op op)
+        {
+            const int channels = image.channels();
+            const auto width = static_cast<size_t>(image.cols * channels);
+            const auto rows = static_cast<size_t>(image.rows);
+            cv::Mat horizontal(image.size(), image.type());
+
+            // Rows: one channel at a time through a padded line
+            const auto rowWindow = static_cast<size_t>(rectangle.right - rectangle.left + 1);
+            const auto rowLength = static_cast<size_t>(image.cols) + rowWindow - 1;
+            std::vector<T> line(rowLength), prefix(rowLength), suffix(rowLength);
+            std::vector<T> filtered(static_cast<size_t>(image.cols));
+            for (int y = 0; y < image.rows; ++y)
+            {
+                const T *source = image.ptr<T>(y);
+                T *destination = horizontal.ptr<T>(y);
+                for (int channel = 0; channel < channels; ++channel)
+                {
+                    for (size_t i = 0; i < rowLength; ++i)
+                    {
+                        const int x = static_cast<int>(i) + rectangle.left;
+                        line[i] = x >= 0 && x < image.cols ? source[x * channels + channel] : border;
+                    }
+                    SlidingExtremum(line.data(), filtered.size(), rowWindow, prefix.data(), suffix.data(),
+                        filtered.data(), op);
+                    for (int x = 0; x < image.cols; ++x)
+                    {
+                        destination[x * channels + channel] = filtered[static_cast<size_t>(x)];
+                    }
+                }
+            }
+
+            // Columns: the same recurrences a whole row at a time, so every inner loop is unit-stride
+            const auto columnWindow = static_cast<size_t>(rectangle.bottom - rectangle.top + 1);
+            const size_t columnLength = rows + columnWindow - 1;
+            const std::vector<T> borderRow(width, border);
+            const auto paddedRow = [&](size_t i) {
+                const int y = static_cast<int>(i) + rectangle.top;
+                return y >= 0 && y < image.rows ? horizontal.ptr<T>(y) : borderRow.data();
+            };
+            std::vector<T> prefixRows(columnLength * width), suffixRows(columnLength * width);
+            for (size_t i = 0; i < columnLength; ++i)
+            {
+                const T *row = paddedRow(i);
+                T *current = &prefixRows[i * width];
+                if (i % columnWindow == 0)
+                {
+                    std::copy(row, row + width, current);
+                    continue;
+                }
+                Op::Rows(current - width, row, current, width);
+            }
+            for (size_t i = columnLength; i-- > 0;)
+            {
+                const T *row = paddedRow(i);
+                T *current = &suffixRows[i * width];
+                if ((i + 1) % columnWindow == 0 || i + 1 == columnLength)
+                {
+                    std::copy(row, row + width, current);
+                    continue;
+                }
+                Op::Rows(current + width, row, current, width);
+            }
+
+            output.create(image.size(), image.type());
+            for (size_t y = 0; y < rows; ++y)
+            {
+                Op::Rows(&suffixRows[y * width], &prefixRows[(y + columnWindow - 1) * width],
+                    output.ptr<T>(static_cast<int>(y)), width);
+            }
+        }
+
+        // Repeats the element's erosion or dilation `iterations` times; the element's result is op over its
+        // rectangles' results
+        template<typename T, typename Op>
+        void ExtremumFilter(const cv::Mat &image, cv::Mat &output,
+            const std::vector<ElementRectangle> &rectangles, int iterations, T border, Op op)
+        {
+            cv::Mat source = image;
+            cv::Mat partial;
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                cv::Mat result = iteration + 1 == iterations ? output : cv::Mat();
+                ExtremumOverRectangle<T>(source, result, rectangles.front(), border, op);
+                for (size_t r = 1; r < rectangles.size(); ++r)
+                {
+                    ExtremumOverRectangle<T>(source, partial, rectangles[r], border, op);
+                    const auto width = static_cast<size_t>(result.cols * result.channels());
+                    for (int y = 0; y < result.rows; ++y)
+                    {
+                        Op::Rows(result.ptr<T>(y), partial.ptr<T>(y), result.ptr<T>(y), width);
+                    }
+                }
+                source = result;
+            }
+            output = source;
+        }
+
+        template<typename T>
+        void Extremum(const cv::Mat &image, cv::Mat &output, const std::vector<ElementRectangle> &rectangles,
+            int iterations, bool erode)
+        {
+            if (erode)
+            {
+                ExtremumFilter<T>(image, output, rectangles, iterations, std::numeric_limits<T>::max(), MinimumOp<T>{});
+            }
+            else
+            {
+                ExtremumFilter<T>(
+                    image, output, rectangles, iterations, std::numeric_limits<T>::lowest(), MaximumOp<T>{});
+            }
+        }
+
+        void Extremum(const cv::Mat &image, cv::Mat &output, const std::vector<ElementRectangle> &rectangles,
+            int iterations, bool erode)
+        {
+            switch (image.depth())
+            {
+            case CV_8U:
+                Extremum<uint8_t>(image, output, rectangles, iterations, erode);
+                break;
+            case CV_16U:
+                Extremum<uint16_t>(image, output, rectangles, iterations, erode);
+                break;
+            default:
+                Extremum<float>(image, output, rectangles, iterations, erode);
+                break;
+            }
+        }
+
+        // Composes every operation from erosions and dilations, as cv::morphologyEx does
+        void ApplyLargeMorphology(const cv::Mat &image, cv::Mat &outputImage, cv::MorphTypes op,
+            const std::vector<ElementRectangle> &rectangles, int iterations)
+        {
+            constexpr bool kErode = true;
+            constexpr bool kDilate = false;
+            cv::Mat pass;
+            switch (op)
+            {
+            case cv::MORPH_ERODE:
+                Extremum(image, outputImage, rectangles, iterations, kErode);
+                break;
+            case cv::MORPH_DILATE:
+                Extremum(image, outputImage, rectangles, iterations, kDilate);
+                break;
+            case cv::MORPH_OPEN:
+                Extremum(image, pass, rectangles, iterations, kErode);
+                Extremum(pass, outputImage, rectangles, iterations, kDilate);
+                break;
+            case cv::MORPH_CLOSE:
+                Extremum(image, pass, rectangles, iterations, kDilate);
+                Extremum(pass, outputImage, rectangles, iterations, kErode);
+                break;
+            case cv::MORPH_GRADIENT:
+                Extremum(image, pass, rectangles, iterations, kErode);
+                Extremum(image, outputImage, rectangles, iterations, kDilate);
+                cv::subtract(outputImage, pass, outputImage);
+                break;
+            case cv::MORPH_TOPHAT:
+                Extremum(image, outputImage, rectangles, iterations, kErode);
+                Extremum(outputImage, pass, rectangles, iterations, kDilate);
+                cv::subtract(image, pass, outputImage);
+                break;
+            default: // MORPH_BLACKHAT
+                Extremum(image, outputImage, rectangles, iterations, kDilate);
+                Extremum(outputImage, pass, rectangles, iterations, kErode);
+                cv::subtract(pass, image, outputImage);
+                break;
+            }
+        }
+
+        Nodes::BitMask MaskExtremum(
+            const Nodes::BitMask &mask, const std::vector<ElementRectangle> &rectangles, int iterations, bool erode)
+        {
+            Nodes::BitMask result = mask;
+            for (int iteration = 0; iteration < iterations; ++iteration)
+            {
+                result = erode ? Kernels::ErodeMask(result, rectangles) : Kernels::DilateMask(result, rectangles);
+            }
+            return result;
+        }
+    } // namespace
+
     MorphologyNode::MorphologyNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -14,66 +329,62 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("Operation", static_cast<int>(MorphOperation::Erode));
+        CreateInputSlot("Shape", kDefaultShape);
         CreateInputSlot("ksize", 3);
         CreateInputSlot("iterations", 1);
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void MorphologyNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
-        if (!inputData || inputData->empty()) [[unlikely]]
+        if (const auto mask = GetInputValueIf<Nodes::BitMask>("Input"); mask && !mask->IsEmpty())
         {
-            LOG_WARN("MorphologyNode {}: No input image provided", GetName());
-            ClearOutputSlot("Output");
+            try
+            {
+                const auto parameters = GetParameters();
+                SetOutputSlotData("Output", ApplyMaskMorphology(*mask, parameters));
+                LOG_HOT_INFO("MorphologyNode {}: Applied packed Morphology (Op: {}, ksize: {}, iter: {})",
+                    GetName(),
+                    parameters.operation,
+                    parameters.ksize,
+                    parameters.iterations);
+            }
+            catch (const std::exception &e)
+            {
+                LOG_ERROR("MorphologyNode {}: Error processing mask: {}", GetName(), e.what());
+                ClearOutputSlot("Output");
+            }
             return;
         }
 
-        const cv::Mat &inputImage = *inputData;
+        const auto deviceInput = GetInputValueIf<cv::UMat>("Input");
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if ((!deviceInput || deviceInput->empty()) && (!inputData || inputData->empty())) [[unlikely]]
+        {
+            LOG_HOT_WARN("MorphologyNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
 
         try
         {
-            auto op = GetInputValue<int>("Operation").value_or(static_cast<int>(MorphOperation::Erode));
-            auto ksize = GetInputValue<int>("ksize").value_or(3);
-            auto iterations = GetInputValue<int>("iterations").value_or(1);
-
-            // Validate and clamp parameters
-            ksize = std::max(1, ksize);
-            iterations = std::max(1, iterations);
-
-            // Map int to cv::MorphTypes using constexpr array
-            constexpr std::array<cv::MorphTypes, 7> morphMapping{ cv::MORPH_ERODE,
-                cv::MORPH_DILATE,
-                cv::MORPH_OPEN,
-                cv::MORPH_CLOSE,
-                cv::MORPH_GRADIENT,
-                cv::MORPH_TOPHAT,
-                cv::MORPH_BLACKHAT };
-
-            cv::MorphTypes morphOp;
-            if (op >= 0 && op < static_cast<int>(morphMapping.size()))
+            const auto parameters = GetParameters();
+            if (deviceInput)
             {
-                morphOp = morphMapping[op];
+                SetOutputSlotData("Output", ApplyMorphology(*deviceInput, parameters));
             }
-            else [[unlikely]]
+            else
             {
-                LOG_WARN("MorphologyNode {}: Invalid operation ({}), using Erode", GetName(), op);
-                morphOp = cv::MORPH_ERODE;
+                SetOutputSlotData("Output", ApplyMorphology(*inputData, parameters, CreateOutputImage()));
             }
 
-            cv::Mat element = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(ksize, ksize));
-
-            cv::Mat outputImage;
-            cv::morphologyEx(inputImage, outputImage, morphOp, element, cv::Point(-1, -1), iterations);
-            SetOutputSlotData("Output", std::move(outputImage));
-
-            LOG_INFO("MorphologyNode {}: Applied Morphology (Op: {}, ksize: {}, iter: {})",
+            LOG_HOT_INFO("MorphologyNode {}: Applied Morphology (Op: {}, ksize: {}, iter: {})",
                 GetName(),
-                op,
-                ksize,
-                iterations);
+                parameters.operation,
+                parameters.ksize,
+                parameters.iterations);
         }
         catch (const cv::Exception &e)
         {
@@ -86,4 +397,199 @@ namespace VisionCraft::Vision::Algorithms
             ClearOutputSlot("Output");
         }
     }
+
+    std::optional<Nodes::TileOperation> MorphologyNode::PrepareTileOperation(int inputType) const
+    {
+        const auto parameters = GetParameters();
+
+        // Open, Close, TopHat and BlackHat chain an erosion and a dilation, doubling the reach
+        const bool twoPasses = parameters.morphOp == cv::MORPH_OPEN || parameters.morphOp == cv::MORPH_CLOSE ||
+                               parameters.morphOp == cv::MORPH_TOPHAT || parameters.morphOp == cv::MORPH_BLACKHAT;
+        const int halo = (parameters.ksize / 2) * parameters.iterations * (twoPasses ? 2 : 1);
+
+        return Nodes::TileOperation{ .halo = halo,
+            .outputType = inputType,
+            .apply = [parameters](const cv::Mat &tile) { return ApplyMorphology(tile, parameters); } };
+    }
+
+    bool MorphologyNode::SupportsDeviceImages() const
+    {
+        return true;
+    }
+
+    bool MorphologyNode::AcceptsBitMasks() const
+    {
+        return true;
+    }
+
+    MorphologyNode::Parameters MorphologyNode::ReadParameters() const
+    {
+        auto op = GetInputValue<int>("Operation").value_or(static_cast<int>(MorphOperation::Erode));
+        auto ksize = GetInputValue<int>("ksize").value_or(3);
+        auto iterations = GetInputValue<int>("iterations").value_or(1);
+
+        // Validate and clamp parameters
+        const int requestedKsize = std::max(1, ksize);
+        ksize = ScaleKernelSize(requestedKsize);
+        iterations = std::max(1, iterations);
+
+        // Map int to cv::MorphTypes using constexpr array
+        constexpr std::array<cv::MorphTypes, 7> morphMapping{ cv::MORPH_ERODE,
+            cv::MORPH_DILATE,
+            cv::MORPH_OPEN,
+            cv::MORPH_CLOSE,
+            cv::MORPH_GRADIENT,
+            cv::MORPH_TOPHAT,
+            cv::MORPH_BLACKHAT };
+
+        cv::MorphTypes morphOp;
+        if (op >= 0 && op < static_cast<int>(morphMapping.size()))
+        {
+            morphOp = morphMapping[op];
+        }
+        else [[unlikely]]
+        {
+            LOG_HOT_WARN("MorphologyNode {}: Invalid operation ({}), using Erode", GetName(), op);
+            morphOp = cv::MORPH_ERODE;
+        }
+
+        const auto shapeView = GetInputView<std::string>("Shape");
+        const auto &shapeName = shapeView.ValueOr(kDefaultShape);
+        cv::MorphShapes shape = cv::MORPH_RECT;
+        if (shapeName == "Ellipse")
+        {
+            shape = cv::MORPH_ELLIPSE;
+        }
+        else if (shapeName == "Cross")
+        {
+            shape = cv::MORPH_CROSS;
+        }
+        else if (shapeName != "Rect") [[unlikely]]
+        {
+            LOG_HOT_WARN("MorphologyNode {}: Unknown shape '{}', using Rect", GetName(), shapeName);
+        }
+
+        return Parameters{ .operation = op,
+            .morphOp = morphOp,
+            .shape = shape,
+            .ksize = ksize,
+            .requestedKsize = requestedKsize,
+            .iterations = iterations,
+            .element = cv::getStructuringElement(shape, cv::Size(ksize, ksize)) };
+    }
+
+    void MorphologyNode::Prepare()
+    {
+        preparedParameters = ReadParameters();
+    }
+
+    MorphologyNode::Parameters MorphologyNode::GetParameters() const
+    {
+        auto parameters = GetPrepared(preparedParameters, [this] { return ReadParameters(); });
+        if (ScaleKernelSize(parameters.requestedKsize) != parameters.ksize) // Prepared at another proxy scale
+        {
+            return ReadParameters();
+        }
+        return parameters;
+    }
+
+    template<typename Image> Image MorphologyNode::ApplyMorphology(
+        const Image &image, const Parameters &parameters, Image outputImage)
+    {
+        const cv::Mat &element = parameters.element;
+
+        if constexpr (std::is_same_v<Image, cv::Mat>)
+        {
+            const int depth = image.depth();
+            if (parameters.ksize >= Constants::Morphology::kLargeKernel &&
+                (depth == CV_8U || depth == CV_16U || depth == CV_32F))
+            {
+                const cv::Point anchor(parameters.ksize / 2, parameters.ksize / 2);
+                if (const auto rectangles = DecomposeElement(element, anchor))
+                {
+                    ApplyLargeMorphology(image, outputImage, parameters.morphOp, *rectangles, parameters.iterations);
+                    return outputImage;
+                }
+            }
+        }
+
+        cv::morphologyEx(
+            image, outputImage, parameters.morphOp, element, cv::Point(-1, -1), parameters.iterations);
+        return outputImage;
+    }
+
+    Nodes::BitMask MorphologyNode::ApplyMaskMorphology(const Nodes::BitMask &mask, const Parameters &parameters)
+    {
+        const cv::Point anchor(parameters.ksize / 2, parameters.ksize / 2);
+        const auto rectangles = DecomposeElement(parameters.element, anchor);
+        if (!rectangles)
+        {
+            throw std::invalid_argument("Structuring element is not a union of rectangles");
+        }
+
+        // On 0/255 images the differences of cv::morphologyEx are set differences of nested masks
+        constexpr bool kErode = true;
+        constexpr bool kDilate = false;
+        const int iterations = parameters.iterations;
+        switch (parameters.morphOp)
+        {
+        case cv::MORPH_ERODE:
+            return MaskExtremum(mask, *rectangles, iterations, kErode);
+        case cv::MORPH_DILATE:
+            return MaskExtremum(mask, *rectangles, iterations, kDilate);
+        case cv::MORPH_OPEN:
+            return MaskExtremum(MaskExtremum(mask, *rectangles, iterations, kErode), *rectangles, iterations, kDilate);
+        case cv::MORPH_CLOSE:
+            return MaskExtremum(MaskExtremum(mask, *rectangles, iterations, kDilate), *rectangles, iterations, kErode);
+        case cv::MORPH_GRADIENT:
+            return Kernels::CombineMasks(MaskExtremum(mask, *rectangles, iterations, kDilate),
+                MaskExtremum(mask, *rectangles, iterations, kErode),
+                Kernels::MaskOperation::Xor);
+        case cv::MORPH_TOPHAT:
+            return Kernels::CombineMasks(mask,
+                MaskExtremum(MaskExtremum(mask, *rectangles, iterations, kErode), *rectangles, iterations, kDilate),
+                Kernels::MaskOperation::Xor);
+        default: // MORPH_BLACKHAT
+            return Kernels::CombineMasks(
+                MaskExtremum(MaskExtremum(mask, *rectangles, iterations, kDilate), *rectangles, iterations, kErode),
+                mask,
+                Kernels::MaskOperation::Xor);
+        }
+    }
+
+    std::optional<Nodes::ImageShape> MorphologyNode::InferOutputShape(
+        const std::optional<Nodes::ImageShape> &input) const
+    {
+        return input;
+    }
+
+    bool MorphologyNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        const auto parameters = ReadParameters();
+        constexpr std::array<const char *, 7> kOperationNames{ "cv::MORPH_ERODE",
+            "cv::MORPH_DILATE",
+            "cv::MORPH_OPEN",
+            "cv::MORPH_CLOSE",
+            "cv::MORPH_GRADIENT",
+            "cv::MORPH_TOPHAT",
+            "cv::MORPH_BLACKHAT" };
+        const char *shape = parameters.shape == cv::MORPH_ELLIPSE ? "cv::MORPH_ELLIPSE"
+                            : parameters.shape == cv::MORPH_CROSS ? "cv::MORPH_CROSS"
+                                                                  : "cv::MORPH_RECT";
+        const std::string size = std::to_string(parameters.ksize);
+        const std::string element = writer.Static("Element",
+            "cv::Mat",
+            std::string("cv::getStructuringElement(") + shape + ", cv::Size(" + size + ", " + size + "))");
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("cv::morphologyEx(" + input + ", " + writer.Output("Output") + ", " +
+                    kOperationNames[static_cast<size_t>(parameters.morphOp)] + ", " + element +
+                    ", cv::Point(-1, -1), " + writer.Constant("Iterations", parameters.iterations) + ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -21,6 +21,11 @@ namespace VisionCraft::Vision::Algorithms
 
     /**
      * @brief Node for Morphological operations (Erode, Dilate, Open, Close, etc.).
+     *
+     * The Shape slot selects a "Rect", "Ellipse" or "Cross" structuring element. From
+     * Constants::Morphology::kLargeKernel up, host images are filtered with the van Herk/Gil-Werman algorithm
+     * on the element's rectangle decomposition, so cost no longer grows with the element's area. Nodes::BitMask
+     * inputs are filtered packed, 64 pixels per word, through the same decomposition and stay packed.
      */
     class MorphologyNode : public Nodes::Node
     {
@@ -50,5 +55,100 @@ namespace VisionCraft::Vision::Algorithms
          * @brief Processes input image using Morphological operations.
          */
         void Process() override;
+
+        /**
+         * @brief Keeps the input's shape.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the operation as a tile operation; the halo covers every erosion and dilation pass.
+         * @param inputType Type of the input image
+         * @return Tile operation using the current parameters
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the operation as cv::morphologyEx, with the structuring element built once at load.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Morphology runs on cv::UMat inputs as well.
+         * @return Always true
+         */
+        [[nodiscard]] bool SupportsDeviceImages() const override;
+
+        /**
+         * @brief Morphology filters bit masks without unpacking them.
+         * @return Always true
+         */
+        [[nodiscard]] bool AcceptsBitMasks() const override;
+
+    protected:
+        /**
+         * @brief Validated morphology parameters.
+         */
+        struct Parameters
+        {
+            int operation = 0;                        ///< Raw Operation input (for logging)
+            cv::MorphTypes morphOp = cv::MORPH_ERODE; ///< Mapped OpenCV operation
+            cv::MorphShapes shape = cv::MORPH_RECT;   ///< Structuring element shape
+            int ksize = 3;                            ///< Structuring element size
+            int requestedKsize = 3;                   ///< ksize before proxy scaling
+            int iterations = 1;                       ///< Number of passes
+            cv::Mat element;                          ///< Structuring element of shape and ksize
+        };
+
+        /**
+         * @brief Reads parameters, clamping sizes and replacing an unknown operation with Erode and an unknown
+         * shape with Rect.
+         * @note ksize is scaled to proxy runs (see Node::ScaleKernelSize()); iterations are not.
+         * @return Parameters safe to pass to cv::morphologyEx
+         */
+        [[nodiscard]] Parameters ReadParameters() const;
+
+        /**
+         * @brief Resolves parameters and builds the structuring element once per change instead of every run.
+         */
+        void Prepare() override;
+
+        /**
+         * @brief Returns the parameters of the current run.
+         * @return Parameters from Prepare() if still valid at the run's proxy scale, otherwise ReadParameters()
+         */
+        [[nodiscard]] Parameters GetParameters() const;
+
+        inline static const std::string kDefaultShape{ "Rect" }; ///< Shape slot default and fallback
+
+    private:
+        /**
+         * @brief Applies the morphological operation to an image.
+         * @tparam Image cv::Mat or cv::UMat
+         * @param image Input image
+         * @param parameters Validated parameters
+         * @param outputImage Image the result is written into (e.g. from CreateOutputImage())
+         * @return Processed image of the same size and type, in the same memory as the input
+         */
+        template<typename Image>
+        [[nodiscard]] static Image ApplyMorphology(
+            const Image &image, const Parameters &parameters, Image outputImage = {});
+
+        /**
+         * @brief Applies the morphological operation to a packed mask.
+         * @param mask Input mask
+         * @param parameters Validated parameters
+         * @return Processed mask of the same size
+         * @throws std::invalid_argument if the element does not decompose into rectangles
+         */
+        [[nodiscard]] static Nodes::BitMask ApplyMaskMorphology(
+            const Nodes::BitMask &mask, const Parameters &parameters);
+
+        Parameters preparedParameters; ///< Parameters resolved by Prepare()
     };
 } // namespace VisionCraft::Vision::Algorithms
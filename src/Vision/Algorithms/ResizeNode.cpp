@@ -1,12 +1,40 @@
 #include "Vision/Algorithms/ResizeNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <stdexcept>
 #include <utility>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        bool IsPowerOfTwo(double value)
+        {
+            int exponent = 0;
+            return value > 0.0 && std::frexp(value, &exponent) == 0.5;
+        }
+
+        // Input pixels each side of a sample the interpolation reads, plus one for rounding
+        int RegionHalo(cv::InterpolationFlags flags)
+        {
+            switch (flags)
+            {
+            case cv::INTER_NEAREST:
+                return 1;
+            case cv::INTER_CUBIC:
+                return 3;
+            case cv::INTER_LANCZOS4:
+                return 5;
+            default:
+                return 2; // Linear, and area when enlarging
+            }
+        }
+    } // namespace
+
     ResizeNode::ResizeNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -14,84 +42,93 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("Width", 0);  // 0 means use scale
         CreateInputSlot("Height", 0); // 0 means use scale
         CreateInputSlot("ScaleX", 1.0);
         CreateInputSlot("ScaleY", 1.0);
         CreateInputSlot("Interpolation", static_cast<int>(InterpolationMethod::Linear));
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void ResizeNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
-        if (!inputData || inputData->empty()) [[unlikely]]
+        if (const auto pyramid = GetInputValueIf<Nodes::ImagePyramid>("Input"); pyramid && !pyramid->IsEmpty())
         {
-            LOG_WARN("ResizeNode {}: No input image provided", GetName());
-            ClearOutputSlot("Output");
+            ResizePyramid(*pyramid);
             return;
         }
 
-        const cv::Mat &inputImage = *inputData;
+        const auto deviceInput = GetInputValueIf<cv::UMat>("Input");
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if ((!deviceInput || deviceInput->empty()) && (!inputData || inputData->empty())) [[unlikely]]
+        {
+            LOG_HOT_WARN("ResizeNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
 
-        try
+        if (deviceInput)
         {
-            auto width = GetInputValue<int>("Width").value_or(0);
-            auto height = GetInputValue<int>("Height").value_or(0);
-            auto scaleX = GetInputValue<double>("ScaleX").value_or(1.0);
-            auto scaleY = GetInputValue<double>("ScaleY").value_or(1.0);
-            auto interp = GetInputValue<int>("Interpolation").value_or(static_cast<int>(InterpolationMethod::Linear));
+            ResizeImage(*deviceInput, cv::UMat{});
+        }
+        else
+        {
+            ResizeImage(*inputData, CreateOutputImage());
+        }
+    }
 
-            // Map interpolation using constexpr array
-            constexpr std::array<cv::InterpolationFlags, 5> interpMapping{
-                cv::INTER_LINEAR, cv::INTER_NEAREST, cv::INTER_CUBIC, cv::INTER_AREA, cv::INTER_LANCZOS4
-            };
+    bool ResizeNode::SupportsDeviceImages() const
+    {
+        return true;
+    }
 
-            cv::InterpolationFlags flags;
-            if (interp >= 0 && interp < static_cast<int>(interpMapping.size()))
-            {
-                flags = interpMapping[interp];
-            }
-            else [[unlikely]]
-            {
-                flags = cv::INTER_LINEAR;
-            }
+    bool ResizeNode::AcceptsImagePyramids() const
+    {
+        return true;
+    }
 
-            cv::Size dsize{ 0, 0 };
-            double fx = scaleX;
-            double fy = scaleY;
+    std::optional<Nodes::RegionOperation> ResizeNode::PrepareRegionOperation(int inputType,
+        const cv::Size &inputSize) const
+    {
+        const auto parameters = GetPrepared(preparedParameters, [this] { return ReadParameters(); });
+        const double scaleX = parameters.size.empty() ? parameters.fx
+                                                      : static_cast<double>(parameters.size.width) / inputSize.width;
+        const double scaleY = parameters.size.empty() ? parameters.fy
+                                                      : static_cast<double>(parameters.size.height) / inputSize.height;
+        if (!IsPowerOfTwo(scaleX) || !IsPowerOfTwo(scaleY))
+        {
+            return std::nullopt;
+        }
 
-            // If width/height are specified, they take precedence over scale
-            if (width > 0 && height > 0)
-            {
-                dsize = cv::Size{ width, height };
-                fx = fy = 0;
-            }
-            else if (width > 0 || height > 0) [[unlikely]]
-            {
-                LOG_WARN("ResizeNode {}: Both width and height must be specified or both zero, using scale", GetName());
-                fx = std::clamp(fx, 0.01, 100.0);
-                fy = std::clamp(fy, 0.01, 100.0);
-            }
-            else
-            {
-                // Use scale factors with clamping
-                fx = std::clamp(fx, 0.01, 100.0);
-                fy = std::clamp(fy, 0.01, 100.0);
-            }
+        return Nodes::RegionOperation{ .halo = RegionHalo(parameters.flags),
+            .scaleX = scaleX,
+            .scaleY = scaleY,
+            .outputType = inputType,
+            .apply = [scaleX, scaleY, flags = parameters.flags](const cv::Mat &region) {
+                cv::Mat result;
+                cv::resize(region, result, cv::Size(), scaleX, scaleY, flags);
+                return result;
+            } };
+    }
 
-            cv::Mat outputImage;
-            cv::resize(inputImage, outputImage, dsize, fx, fy, flags);
+    template<typename Image> void ResizeNode::ResizeImage(const Image &inputImage, Image outputImage)
+    {
+        try
+        {
+            const auto parameters = GetPrepared(preparedParameters, [this] { return ReadParameters(); });
+
+            cv::resize(inputImage, outputImage, parameters.size, parameters.fx, parameters.fy, parameters.flags);
+            [[maybe_unused]] const cv::Size outputSize = outputImage.size();
             SetOutputSlotData("Output", std::move(outputImage));
 
-            LOG_INFO("ResizeNode {}: Resized (Size: {}x{}, Scale: {:.2f}x{:.2f}, Interp: {})",
+            LOG_HOT_INFO("ResizeNode {}: Resized (Size: {}x{}, Scale: {:.2f}x{:.2f}, Interp: {})",
                 GetName(),
-                outputImage.cols,
-                outputImage.rows,
-                fx,
-                fy,
-                interp);
+                outputSize.width,
+                outputSize.height,
+                parameters.fx,
+                parameters.fy,
+                parameters.interpolation);
         }
         catch (const cv::Exception &e)
         {
@@ -104,4 +141,125 @@ namespace VisionCraft::Vision::Algorithms
             ClearOutputSlot("Output");
         }
     }
+
+    void ResizeNode::ResizePyramid(const Nodes::ImagePyramid &pyramid)
+    {
+        try
+        {
+            const auto parameters = GetPrepared(preparedParameters, [this] { return ReadParameters(); });
+            const cv::Size size = GetOutputSize(parameters, pyramid.GetBase().size());
+            SetOutputSlotData("Output", pyramid.Sample(size, parameters.flags));
+
+            LOG_HOT_INFO("ResizeNode {}: Sampled pyramid level {} (Size: {}x{}, Interp: {})",
+                GetName(),
+                pyramid.SelectLevel(size),
+                size.width,
+                size.height,
+                parameters.interpolation);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("ResizeNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    void ResizeNode::Prepare()
+    {
+        preparedParameters = ReadParameters();
+    }
+
+    ResizeNode::Parameters ResizeNode::ReadParameters() const
+    {
+        const auto width = GetInputValue<int>("Width").value_or(0);
+        const auto height = GetInputValue<int>("Height").value_or(0);
+        const auto interp =
+            GetInputValue<int>("Interpolation").value_or(static_cast<int>(InterpolationMethod::Linear));
+
+        // Map interpolation using constexpr array
+        constexpr std::array<cv::InterpolationFlags, 5> interpMapping{
+            cv::INTER_LINEAR, cv::INTER_NEAREST, cv::INTER_CUBIC, cv::INTER_AREA, cv::INTER_LANCZOS4
+        };
+
+        Parameters parameters{ .interpolation = interp };
+        if (interp >= 0 && interp < static_cast<int>(interpMapping.size()))
+        {
+            parameters.flags = interpMapping[interp];
+        }
+
+        // If width/height are specified, they take precedence over scale
+        if (width > 0 && height > 0)
+        {
+            parameters.size = cv::Size{ width, height };
+            return parameters;
+        }
+
+        if (width > 0 || height > 0) [[unlikely]]
+        {
+            LOG_HOT_WARN("ResizeNode {}: Both width and height must be specified or both zero, using scale", GetName());
+        }
+
+        // Use scale factors with clamping
+        parameters.fx = std::clamp(GetInputValue<double>("ScaleX").value_or(1.0), 0.01, 100.0);
+        parameters.fy = std::clamp(GetInputValue<double>("ScaleY").value_or(1.0), 0.01, 100.0);
+        return parameters;
+    }
+
+    std::optional<Nodes::ImageShape> ResizeNode::InferOutputShape(const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+
+        return Nodes::ImageShape{ .size = GetOutputSize(ReadParameters(), input->size), .type = input->type };
+    }
+
+    cv::Size ResizeNode::GetOutputSize(const Parameters &parameters, const cv::Size &inputSize)
+    {
+        // cv::resize rounds the scaled size to the nearest pixel
+        return parameters.size.empty() ? cv::Size(cv::saturate_cast<int>(inputSize.width * parameters.fx),
+                                             cv::saturate_cast<int>(inputSize.height * parameters.fy))
+                                       : parameters.size;
+    }
+
+    bool ResizeNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        const auto parameters = ReadParameters();
+        const char *flags = "cv::INTER_LINEAR";
+        switch (parameters.flags)
+        {
+        case cv::INTER_NEAREST:
+            flags = "cv::INTER_NEAREST";
+            break;
+        case cv::INTER_CUBIC:
+            flags = "cv::INTER_CUBIC";
+            break;
+        case cv::INTER_AREA:
+            flags = "cv::INTER_AREA";
+            break;
+        case cv::INTER_LANCZOS4:
+            flags = "cv::INTER_LANCZOS4";
+            break;
+        default:
+            break;
+        }
+        std::string size = "cv::Size()";
+        if (!parameters.size.empty())
+        {
+            size = "cv::Size(" + writer.Constant("Width", parameters.size.width) + ", " +
+                   writer.Constant("Height", parameters.size.height) + ")";
+        }
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("cv::resize(" + input + ", " + writer.Output("Output") + ", " + size + ", " +
+                    writer.Constant("ScaleX", parameters.fx) + ", " + writer.Constant("ScaleY", parameters.fy) + ", " +
+                    flags + ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -3,6 +3,8 @@
 #include "Nodes/Core/Node.h"
 #include <opencv2/opencv.hpp>
 
+#include <optional>
+
 namespace VisionCraft::Vision::Algorithms
 {
     /**
@@ -19,6 +21,9 @@ namespace VisionCraft::Vision::Algorithms
 
     /**
      * @brief Node for Image Resizing.
+     *
+     * Nodes::ImagePyramid inputs are sampled from the coarsest level still at least the target size, so
+     * repeated downscales of one image share the halvings instead of each reading the full image.
      */
     class ResizeNode : public Nodes::Node
     {
@@ -48,5 +53,94 @@ namespace VisionCraft::Vision::Algorithms
          * @brief Processes input image using Resize.
          */
         void Process() override;
+
+        /**
+         * @brief Takes the target size, or the input size times the scale factors, and keeps the type.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Writes the resize as a cv::resize call with the explicit size or the clamped scale factors.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Resize runs on cv::UMat inputs as well.
+         * @return Always true
+         */
+        [[nodiscard]] bool SupportsDeviceImages() const override;
+
+        /**
+         * @brief Resize samples pyramid inputs at the level nearest the target size.
+         * @return Always true
+         */
+        [[nodiscard]] bool AcceptsImagePyramids() const override;
+
+        /**
+         * @brief Returns the resize as a region operation when both scales are powers of two.
+         *
+         * Other scales would put a region's first output pixel at a fractional input position, so rows and
+         * columns would not match a full-image resize.
+         *
+         * @param inputType Type of the input image
+         * @param inputSize Size of the input image
+         * @return Region operation, or std::nullopt for other scales
+         */
+        [[nodiscard]] std::optional<Nodes::RegionOperation> PrepareRegionOperation(int inputType,
+            const cv::Size &inputSize) const override;
+
+    protected:
+        /**
+         * @brief Validated resize parameters.
+         */
+        struct Parameters
+        {
+            cv::Size size{ 0, 0 };                           ///< Target size (empty = use the scale factors)
+            double fx = 0.0;                                 ///< Horizontal scale (0 when size is set)
+            double fy = 0.0;                                 ///< Vertical scale (0 when size is set)
+            cv::InterpolationFlags flags = cv::INTER_LINEAR; ///< Mapped OpenCV interpolation
+            int interpolation = 0;                           ///< Raw Interpolation input (for logging)
+        };
+
+        /**
+         * @brief Reads parameters; an explicit size wins over the scale factors, which are clamped.
+         * @return Parameters safe to pass to cv::resize
+         */
+        [[nodiscard]] Parameters ReadParameters() const;
+
+        /**
+         * @brief Returns the size cv::resize produces for an input.
+         * @param parameters Resize parameters
+         * @param inputSize Input image size
+         * @return Target size, or the input size times the scale factors rounded as cv::resize rounds
+         */
+        [[nodiscard]] static cv::Size GetOutputSize(const Parameters &parameters, const cv::Size &inputSize);
+
+        /**
+         * @brief Validates parameters once per change instead of every run.
+         */
+        void Prepare() override;
+
+    private:
+        /**
+         * @brief Resizes an image using the current parameters and stores the result.
+         * @tparam Image cv::Mat or cv::UMat
+         * @param inputImage Non-empty input image
+         * @param outputImage Image the result is written into (from CreateOutputImage() for cv::Mat)
+         */
+        template<typename Image> void ResizeImage(const Image &inputImage, Image outputImage);
+
+        /**
+         * @brief Samples a pyramid at the current target size and stores the result.
+         * @param pyramid Non-empty input pyramid
+         */
+        void ResizePyramid(const Nodes::ImagePyramid &pyramid);
+
+        Parameters preparedParameters; ///< Parameters resolved by Prepare()
     };
 } // namespace VisionCraft::Vision::Algorithms
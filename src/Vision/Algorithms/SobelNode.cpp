@@ -1,5 +1,7 @@
 #include "Vision/Algorithms/SobelNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/PipelineCompiler.h"
 #include <algorithm>
 #include <array>
 #include <ranges>
@@ -14,71 +16,45 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("dx", 1);
         CreateInputSlot("dy", 1);
         CreateInputSlot("ksize", 3);
         CreateInputSlot("scale", 1.0);
         CreateInputSlot("delta", 0.0);
-        CreateOutputSlot("Output");
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void SobelNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
-        if (!inputData || inputData->empty()) [[unlikely]]
+        const auto deviceInput = GetInputValueIf<cv::UMat>("Input");
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
+        if ((!deviceInput || deviceInput->empty()) && (!inputData || inputData->empty())) [[unlikely]]
         {
-            LOG_WARN("SobelNode {}: No input image provided", GetName());
+            LOG_HOT_WARN("SobelNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
 
-        const cv::Mat &inputImage = *inputData;
-
         try
         {
-            auto dx = GetInputValue<int>("dx").value_or(1);
-            auto dy = GetInputValue<int>("dy").value_or(1);
-            auto ksize = GetInputValue<int>("ksize").value_or(3);
-            auto scale = GetInputValue<double>("scale").value_or(1.0);
-            auto delta = GetInputValue<double>("delta").value_or(0.0);
-
-            // Validate dx and dy (must satisfy: dx + dy > 0 and dx + dy <= 2)
-            if (dx < 0 || dy < 0 || (dx + dy) == 0 || (dx + dy) > 2) [[unlikely]]
+            const auto parameters = ReadParameters();
+            if (deviceInput)
             {
-                LOG_WARN("SobelNode {}: Invalid dx ({}) or dy ({}), using dx=1, dy=1", GetName(), dx, dy);
-                dx = 1;
-                dy = 1;
+                SetOutputSlotData("Output", ApplySobel(*deviceInput, parameters));
             }
-
-            // Validate ksize (must be 1, 3, 5, or 7)
-            constexpr std::array validKsizes{ 1, 3, 5, 7 };
-            if (std::ranges::find(validKsizes, ksize) == validKsizes.end()) [[unlikely]]
+            else
             {
-                LOG_WARN("SobelNode {}: Invalid ksize ({}), using 3", GetName(), ksize);
-                ksize = 3;
+                // The gray image is shared with every other node reading this input
+                const cv::Mat grayImage = GetDerivedImage(*inputData, Nodes::DerivedImage::Gray);
+                SetOutputSlotData("Output", ApplySobel(grayImage, parameters, CreateOutputImage()));
             }
 
-            const cv::Mat grayImage = [&]() {
-                if (inputImage.channels() > 1)
-                {
-                    cv::Mat result;
-                    cv::cvtColor(inputImage, result, cv::COLOR_BGR2GRAY);
-                    return result;
-                }
-                return inputImage;
-            }();
-
-            // Use CV_16S to avoid overflow, then convert back to 8U
-            cv::Mat grad;
-            cv::Sobel(grayImage, grad, CV_16S, dx, dy, ksize, scale, delta, cv::BORDER_DEFAULT);
-
-            cv::Mat outputImage;
-            cv::convertScaleAbs(grad, outputImage);
-
-            SetOutputSlotData("Output", std::move(outputImage));
-
-            LOG_INFO("SobelNode {}: Applied Sobel (dx: {}, dy: {}, ksize: {})", GetName(), dx, dy, ksize);
+            LOG_HOT_INFO("SobelNode {}: Applied Sobel (dx: {}, dy: {}, ksize: {})",
+                GetName(),
+                parameters.dx,
+                parameters.dy,
+                parameters.ksize);
         }
         catch (const cv::Exception &e)
         {
@@ -91,4 +67,147 @@ namespace VisionCraft::Vision::Algorithms
             ClearOutputSlot("Output");
         }
     }
+
+    std::optional<Nodes::TileOperation> SobelNode::PrepareTileOperation([[maybe_unused]] int inputType) const
+    {
+        const auto parameters = ReadParameters();
+        // A 1-wide kernel still smooths over a 3-pixel window (3x1 or 1x3)
+        const int halo = parameters.ksize == 1 ? 1 : parameters.ksize / 2;
+        return Nodes::TileOperation{ .halo = halo,
+            .outputType = CV_MAKETYPE(parameters.depth, 1),
+            .apply = [parameters](const cv::Mat &tile) { return ApplySobel(tile, parameters); } };
+    }
+
+    bool SobelNode::SupportsDeviceImages() const
+    {
+        return true;
+    }
+
+    SobelNode::Parameters SobelNode::ReadParameters() const
+    {
+        auto dx = GetInputValue<int>("dx").value_or(1);
+        auto dy = GetInputValue<int>("dy").value_or(1);
+        auto ksize = GetInputValue<int>("ksize").value_or(3);
+        const auto scale = GetInputValue<double>("scale").value_or(1.0);
+        const auto delta = GetInputValue<double>("delta").value_or(0.0);
+
+        // Validate dx and dy (must satisfy: dx + dy > 0 and dx + dy <= 2)
+        if (dx < 0 || dy < 0 || (dx + dy) == 0 || (dx + dy) > 2) [[unlikely]]
+        {
+            LOG_HOT_WARN("SobelNode {}: Invalid dx ({}) or dy ({}), using dx=1, dy=1", GetName(), dx, dy);
+            dx = 1;
+            dy = 1;
+        }
+
+        // Validate ksize (must be 1, 3, 5, or 7)
+        constexpr std::array validKsizes{ 1, 3, 5, 7 };
+        if (std::ranges::find(validKsizes, ksize) == validKsizes.end()) [[unlikely]]
+        {
+            LOG_HOT_WARN("SobelNode {}: Invalid ksize ({}), using 3", GetName(), ksize);
+            ksize = 3;
+        }
+        ksize = ScaleKernelSize(ksize, 3);
+        return Parameters{ .dx = dx,
+            .dy = dy,
+            .ksize = ksize,
+            .scale = scale,
+            .delta = delta,
+            .depth = GetOutputDepth() };
+    }
+
+    int SobelNode::GetOutputDepth() const
+    {
+        switch (GetPrecisionPolicy())
+        {
+        case Nodes::PrecisionPolicy::Prefer16:
+            return CV_16S;
+        case Nodes::PrecisionPolicy::Float32:
+            return CV_32F;
+        default:
+            return CV_8U;
+        }
+    }
+
+    template<typename Image> Image SobelNode::ApplySobel(
+        const Image &image, const Parameters &parameters, Image outputImage)
+    {
+        const Image grayImage = [&]() {
+            if (image.channels() > 1)
+            {
+                Image result;
+                cv::cvtColor(image, result, cv::COLOR_BGR2GRAY);
+                return result;
+            }
+            return image;
+        }();
+
+        if (parameters.depth != CV_8U)
+        {
+            // Signed derivative written straight into the output
+            cv::Sobel(grayImage,
+                outputImage,
+                parameters.depth,
+                parameters.dx,
+                parameters.dy,
+                parameters.ksize,
+                parameters.scale,
+                parameters.delta,
+                cv::BORDER_DEFAULT);
+            return outputImage;
+        }
+
+        // Use CV_16S to avoid overflow, then convert back to 8U
+        Image grad;
+        cv::Sobel(grayImage,
+            grad,
+            CV_16S,
+            parameters.dx,
+            parameters.dy,
+            parameters.ksize,
+            parameters.scale,
+            parameters.delta,
+            cv::BORDER_DEFAULT);
+
+        cv::convertScaleAbs(grad, outputImage);
+        return outputImage;
+    }
+
+    std::optional<Nodes::ImageShape> SobelNode::InferOutputShape(const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+        return Nodes::ImageShape{ .size = input->size, .type = CV_MAKETYPE(GetOutputDepth(), 1) };
+    }
+
+    bool SobelNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        const auto parameters = ReadParameters();
+        const std::string gray = writer.Gray(input);
+        const std::string output = writer.Output("Output");
+        const std::string arguments = writer.Constant("Dx", parameters.dx) + ", " +
+                                      writer.Constant("Dy", parameters.dy) + ", " +
+                                      writer.Constant("KernelSize", parameters.ksize) + ", " +
+                                      writer.Constant("Scale", parameters.scale) + ", " +
+                                      writer.Constant("Delta", parameters.delta) + ", cv::BORDER_DEFAULT";
+        if (parameters.depth != CV_8U)
+        {
+            const char *depth = parameters.depth == CV_16S ? "CV_16S" : "CV_32F";
+            writer.Line("cv::Sobel(" + gray + ", " + output + ", " + depth + ", " + arguments + ");");
+            return true;
+        }
+        writer.Line("{");
+        writer.Line("    cv::Mat gradient;");
+        writer.Line("    cv::Sobel(" + gray + ", gradient, CV_16S, " + arguments + ");");
+        writer.Line("    cv::convertScaleAbs(gradient, " + output + ");");
+        writer.Line("}");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -7,6 +7,10 @@ namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for Sobel edge detection.
+     *
+     * The output depth follows the graph's PrecisionPolicy: the absolute derivative saturated to CV_8U by
+     * default and under Prefer8U, the signed CV_16S derivative under Prefer16 (no conversion pass), and the
+     * signed CV_32F derivative under Float32.
      */
     class SobelNode : public Nodes::Node
     {
@@ -36,5 +40,71 @@ namespace VisionCraft::Vision::Algorithms
          * @brief Processes input image using Sobel operator.
          */
         void Process() override;
+
+        /**
+         * @brief Keeps the input's size as a single-channel image of the policy's depth.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the operator as a tile operation; the halo is half the kernel size.
+         * @param inputType Type of the input image
+         * @return Tile operation using the current parameters
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the derivative as cv::Sobel on the gray input, at the current precision policy's depth.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Sobel runs on cv::UMat inputs as well.
+         * @return Always true
+         */
+        [[nodiscard]] bool SupportsDeviceImages() const override;
+
+    protected:
+        /**
+         * @brief Validated derivative parameters.
+         */
+        struct Parameters
+        {
+            int dx = 1;         ///< Derivative order in x
+            int dy = 1;         ///< Derivative order in y
+            int ksize = 3;      ///< Kernel size (1, 3, 5 or 7)
+            double scale = 1.0; ///< Scale applied to derivatives
+            double delta = 0.0; ///< Offset added to results
+            int depth = CV_8U;  ///< Output depth (CV_8U is the absolute derivative)
+        };
+
+        /**
+         * @brief Reads parameters, replacing invalid ones with defaults.
+         * @return Parameters safe to pass to cv::Sobel (ksize scaled to proxy runs, at least 3 unless set lower)
+         */
+        [[nodiscard]] Parameters ReadParameters() const;
+
+        /**
+         * @brief Returns the output depth under the node's precision policy.
+         * @return CV_8U, CV_16S or CV_32F
+         */
+        [[nodiscard]] int GetOutputDepth() const;
+
+    private:
+        /**
+         * @brief Computes the derivative of an image at the parameters' depth.
+         * @tparam Image cv::Mat or cv::UMat
+         * @param image Input image (converted to grayscale if it has several channels)
+         * @param parameters Validated parameters
+         * @param outputImage Image the result is written into (e.g. from CreateOutputImage())
+         * @return Single-channel derivative (absolute if 8-bit), in the same memory as the input
+         */
+        template<typename Image>
+        [[nodiscard]] static Image ApplySobel(const Image &image, const Parameters &parameters, Image outputImage = {});
     };
 } // namespace VisionCraft::Vision::Algorithms
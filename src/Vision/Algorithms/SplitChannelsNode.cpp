@@ -1,5 +1,6 @@
 #include "Vision/Algorithms/SplitChannelsNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
 #include <stdexcept>
 
 namespace VisionCraft::Vision::Algorithms
@@ -11,19 +12,43 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         for (const auto &slotName : kChannelSlots)
         {
-            CreateOutputSlot(slotName);
+            CreateOutputSlot(slotName).SetDataType(Nodes::SlotDataType::Image);
         }
     }
 
+    Nodes::ImageLayout SplitChannelsNode::GetPreferredImageLayout() const
+    {
+        return Nodes::ImageLayout::Any;
+    }
+
     void SplitChannelsNode::Process()
     {
-        const auto inputData = GetInputValue<cv::Mat>("Input");
+        // Planar images already hold one buffer per channel: the planes are the outputs
+        if (const auto planar = GetInputValueIf<Nodes::PlanarImage>("Input"); planar && !planar->IsEmpty())
+        {
+            for (size_t i = 0; i < kChannelSlots.size(); ++i)
+            {
+                if (i < planar->GetPlanes().size())
+                {
+                    SetOutputSlotData(kChannelSlots[i], planar->GetPlanes()[i]);
+                }
+                else
+                {
+                    ClearOutputSlot(kChannelSlots[i]);
+                }
+            }
+            LOG_HOT_INFO(
+                "SplitChannelsNode {}: Split planar image into {} channels", GetName(), planar->GetChannelCount());
+            return;
+        }
+
+        const auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty()) [[unlikely]]
         {
-            LOG_WARN("SplitChannelsNode {}: No input image provided", GetName());
+            LOG_HOT_WARN("SplitChannelsNode {}: No input image provided", GetName());
             for (const auto &slotName : kChannelSlots)
             {
                 ClearOutputSlot(slotName);
@@ -35,15 +60,15 @@ namespace VisionCraft::Vision::Algorithms
 
         try
         {
-            std::vector<cv::Mat> channels;
-            cv::split(inputImage, channels);
-
-            // Set outputs based on available channels
+            // Each channel is a view into the input; consumers that need a plane of their own get it from
+            // NodeEditor, so channels that only pass through to MergeChannelsNode are never copied
+            const auto channelCount = static_cast<size_t>(inputImage.channels());
             for (size_t i = 0; i < kChannelSlots.size(); ++i)
             {
-                if (i < channels.size())
+                if (i < channelCount)
                 {
-                    SetOutputSlotData(kChannelSlots[i], channels[i]);
+                    SetOutputSlotData(
+                        kChannelSlots[i], Nodes::ChannelView{ .source = inputImage, .channel = static_cast<int>(i) });
                 }
                 else
                 {
@@ -51,7 +76,7 @@ namespace VisionCraft::Vision::Algorithms
                 }
             }
 
-            LOG_INFO("SplitChannelsNode {}: Split into {} channels", GetName(), channels.size());
+            LOG_HOT_INFO("SplitChannelsNode {}: Split into {} channels", GetName(), channelCount);
         }
         catch (const cv::Exception &e)
         {
@@ -7,6 +7,9 @@ namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for splitting image channels.
+     *
+     * Outputs Nodes::ChannelView values that share the input buffer instead of deinterleaved copies; the
+     * planes of a Nodes::PlanarImage input are output as they are.
      */
     class SplitChannelsNode : public Nodes::Node
     {
@@ -32,6 +35,12 @@ namespace VisionCraft::Vision::Algorithms
             return "SplitChannelsNode";
         }
 
+        /**
+         * @brief Reads interleaved and planar images alike.
+         * @return ImageLayout::Any
+         */
+        [[nodiscard]] Nodes::ImageLayout GetPreferredImageLayout() const override;
+
         /**
          * @brief Processes input image and splits channels.
          */
@@ -1,9 +1,201 @@
 #include "Vision/Algorithms/ThresholdNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include <algorithm>
+#include <cfloat>
+#include <charconv>
+#include <cmath>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
 
 namespace VisionCraft::Vision::Algorithms
 {
+    namespace
+    {
+        using Histogram = std::array<uint32_t, 256>;
+        constexpr int kBins = 256;
+
+        // Port of OpenCV's getThreshVal_Otsu_8u, so results match cv::threshold with THRESH_OTSU
+        int OtsuThreshold(const Histogram &counts, size_t total)
+        {
+            const double scale = 1.0 / static_cast<double>(total);
+            double mu = 0.0;
+            for (int i = 0; i < kBins; ++i)
+            {
+                mu += i * static_cast<double>(counts[static_cast<size_t>(i)]);
+            }
+            mu *= scale;
+
+            double mu1 = 0.0;
+            double q1 = 0.0;
+            double maxSigma = 0.0;
+            int threshold = 0;
+            for (int i = 0; i < kBins; ++i)
+            {
+                const double p = counts[static_cast<size_t>(i)] * scale;
+                mu1 *= q1;
+                q1 += p;
+                const double q2 = 1.0 - q1;
+                if (std::min(q1, q2) < FLT_EPSILON || std::max(q1, q2) > 1.0 - FLT_EPSILON)
+                {
+                    continue;
+                }
+                mu1 = (mu1 + i * p) / q1;
+                const double mu2 = (mu - q1 * mu1) / q2;
+                const double sigma = q1 * q2 * (mu1 - mu2) * (mu1 - mu2);
+                if (sigma > maxSigma)
+                {
+                    maxSigma = sigma;
+                    threshold = i;
+                }
+            }
+            return threshold;
+        }
+
+        // Port of OpenCV's getThreshVal_Triangle_8u, so results match cv::threshold with THRESH_TRIANGLE
+        int TriangleThreshold(Histogram counts)
+        {
+            int leftBound = 0;
+            int rightBound = 0;
+            int peak = 0;
+            uint32_t peakCount = 0;
+            for (int i = 0; i < kBins; ++i)
+            {
+                if (counts[static_cast<size_t>(i)] > 0)
+                {
+                    leftBound = i;
+                    break;
+                }
+            }
+            if (leftBound > 0)
+            {
+                --leftBound;
+            }
+            for (int i = kBins - 1; i > 0; --i)
+            {
+                if (counts[static_cast<size_t>(i)] > 0)
+                {
+                    rightBound = i;
+                    break;
+                }
+            }
+            if (rightBound < kBins - 1)
+            {
+                ++rightBound;
+            }
+            for (int i = 0; i < kBins; ++i)
+            {
+                if (counts[static_cast<size_t>(i)] > peakCount)
+                {
+                    peakCount = counts[static_cast<size_t>(i)];
+                    peak = i;
+                }
+            }
+
+            // The line runs from the peak to the end of the longer tail
+            const bool flipped = peak - leftBound < rightBound - peak;
+            if (flipped)
+            {
+                std::ranges::reverse(counts);
+                leftBound = kBins - 1 - rightBound;
+                peak = kBins - 1 - peak;
+            }
+
+            const double a = peakCount;
+            const double b = leftBound - peak;
+            double distance = 0.0;
+            int threshold = leftBound;
+            for (int i = leftBound + 1; i <= peak; ++i)
+            {
+                const double candidate = a * i + b * counts[static_cast<size_t>(i)];
+                if (candidate > distance)
+                {
+                    distance = candidate;
+                    threshold = i;
+                }
+            }
+            --threshold;
+            return flipped ? kBins - 1 - threshold : threshold;
+        }
+
+        // Multi-level Otsu: the split into `levels` non-empty bin ranges maximising the between-class variance,
+        // found by dynamic programming over the histogram prefix sums in O(levels * 256^2)
+        std::vector<int> MultiOtsuThresholds(const Histogram &counts, int levels)
+        {
+            std::array<double, kBins + 1> pixels{};
+            std::array<double, kBins + 1> moments{};
+            for (size_t i = 0; i < static_cast<size_t>(kBins); ++i)
+            {
+                pixels[i + 1] = pixels[i] + counts[i];
+                moments[i + 1] = moments[i] + static_cast<double>(i) * counts[i];
+            }
+            // Bins [begin, end) as one class; sum of w * mu^2 is what the split maximises
+            const auto classScore = [&](int begin, int end) {
+                const double weight = pixels[static_cast<size_t>(end)] - pixels[static_cast<size_t>(begin)];
+                const double moment = moments[static_cast<size_t>(end)] - moments[static_cast<size_t>(begin)];
+                return weight > 0.0 ? moment * moment / weight : 0.0;
+            };
+
+            const auto classes = static_cast<size_t>(levels);
+            std::vector<std::array<double, kBins + 1>> best(classes);
+            std::vector<std::array<int, kBins + 1>> split(classes);
+            for (int end = 1; end <= kBins; ++end)
+            {
+                best[0][static_cast<size_t>(end)] = classScore(0, end);
+            }
+            for (size_t k = 1; k < classes; ++k)
+            {
+                for (int end = static_cast<int>(k) + 1; end <= kBins; ++end)
+                {
+                    double bestScore = -1.0;
+                    int bestSplit = static_cast<int>(k);
+                    for (int begin = static_cast<int>(k); begin < end; ++begin)
+                    {
+                        const double score = best[k - 1][static_cast<size_t>(begin)] + classScore(begin, end);
+                        if (score > bestScore)
+                        {
+                            bestScore = score;
+                            bestSplit = begin;
+                        }
+                    }
+                    best[k][static_cast<size_t>(end)] = bestScore;
+                    split[k][static_cast<size_t>(end)] = bestSplit;
+                }
+            }
+
+            // A class starting at bin b puts pixels above b - 1 on its level
+            std::vector<int> thresholds(classes - 1);
+            int end = kBins;
+            for (size_t k = classes - 1; k > 0; --k)
+            {
+                end = split[k][static_cast<size_t>(end)];
+                thresholds[k - 1] = end - 1;
+            }
+            return thresholds;
+        }
+
+        // Pixels above thresholds[i - 1] and up to thresholds[i] land on level i, spread evenly over [0, maxValue]
+        cv::Mat LevelTable(const std::vector<int> &thresholds, double maxValue)
+        {
+            cv::Mat table(1, kBins, CV_8UC1);
+            auto *entry = table.ptr<uchar>();
+            const double step = maxValue / static_cast<double>(thresholds.size());
+            size_t level = 0;
+            for (int value = 0; value < kBins; ++value)
+            {
+                while (level < thresholds.size() && value > thresholds[level])
+                {
+                    ++level;
+                }
+                entry[value] = cv::saturate_cast<uchar>(std::round(static_cast<double>(level) * step));
+            }
+            return table;
+        }
+    } // namespace
+
     ThresholdNode::ThresholdNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
     {
         // Execution pins
@@ -11,69 +203,122 @@ namespace VisionCraft::Vision::Algorithms
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("Threshold", 127.0);
         CreateInputSlot("MaxValue", 255.0);
-        CreateInputSlot("Type", std::string{ "THRESH_BINARY" });
-        CreateOutputSlot("Output");
+        CreateInputSlot("Type", kDefaultType);
+        CreateInputSlot("Levels", 3);
+        CreateInputSlot("Thresholds", std::string{});
+        CreateInputSlot("PackMask", false);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void ThresholdNode::Process()
     {
-        auto inputData = GetInputValue<cv::Mat>("Input");
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty())
         {
-            LOG_WARN("ThresholdNode {}: No input image provided", GetName());
-            inputImage = cv::Mat();
-            outputImage = cv::Mat();
+            LOG_HOT_WARN("ThresholdNode {}: No input image provided", GetName());
             ClearOutputSlot("Output");
             return;
         }
 
-        inputImage = *inputData;
+        const cv::Mat &inputImage = *inputData;
 
         try
         {
             const auto threshold = GetInputValue<double>("Threshold").value_or(127.0);
             const auto maxValue = GetInputValue<double>("MaxValue").value_or(255.0);
-            const auto typeStr = GetInputValue<std::string>("Type").value_or("THRESH_BINARY");
-            int thresholdType = GetThresholdType(typeStr);
+            const int thresholdType = GetPrepared(preparedType, [this] { return ReadThresholdType(); });
 
-            cv::Mat grayImage;
-            if (inputImage.channels() > 1)
+            // A fresh buffer each run: the previous output may still be shared downstream
+            cv::Mat result = CreateOutputImage();
+            [[maybe_unused]] double actualThreshold = threshold;
+            const bool fromHistogram = thresholdType == cv::THRESH_OTSU || thresholdType == cv::THRESH_TRIANGLE ||
+                                       thresholdType == kThreshMulti;
+            if (fromHistogram && inputImage.depth() == CV_8U)
             {
-                cv::cvtColor(inputImage, grayImage, cv::COLOR_BGR2GRAY);
+                actualThreshold = ApplyHistogramThreshold(inputImage, thresholdType, maxValue, result);
             }
             else
             {
-                grayImage = inputImage.clone();
-            }
+                if (thresholdType == kThreshMulti)
+                {
+                    throw std::invalid_argument("THRESH_MULTI supports 8-bit images");
+                }
+                {
+                    std::scoped_lock lock(histogramMutex);
+                    histogram.reset();
+                }
 
-            double actualThreshold = cv::threshold(grayImage, outputImage, threshold, maxValue, thresholdType);
-
-            SetOutputSlotData("Output", outputImage);
+                // Shared with every other node reading this input; cv::threshold never writes its source
+                const cv::Mat grayImage = GetDerivedImage(inputImage, Nodes::DerivedImage::Gray);
+                actualThreshold = cv::threshold(grayImage, result, threshold, maxValue, thresholdType);
+            }
+            if (GetInputValue<bool>("PackMask").value_or(false))
+            {
+                const cv::Mat bytes = result.depth() == CV_8U ? result : cv::Mat(result != 0);
+                SetOutputSlotData("Output", Nodes::BitMask::FromImage(bytes));
+            }
+            else
+            {
+                SetOutputSlotData("Output", std::move(result));
+            }
 
-            LOG_INFO("ThresholdNode {}: Applied thresholding (threshold: {}, actual: {}, max: {}, type: {})",
+            LOG_HOT_INFO("ThresholdNode {}: Applied thresholding (threshold: {}, actual: {}, max: {}, type: {})",
                 GetName(),
                 threshold,
                 actualThreshold,
                 maxValue,
-                typeStr);
+                thresholdType);
         }
         catch (const cv::Exception &e)
         {
             LOG_ERROR("ThresholdNode {}: OpenCV error: {}", GetName(), e.what());
-            outputImage = cv::Mat();
             ClearOutputSlot("Output");
         }
         catch (const std::exception &e)
         {
             LOG_ERROR("ThresholdNode {}: Error processing image: {}", GetName(), e.what());
-            outputImage = cv::Mat();
             ClearOutputSlot("Output");
         }
     }
 
+    std::optional<Nodes::TileOperation> ThresholdNode::PrepareTileOperation(int inputType) const
+    {
+        const auto threshold = GetInputValue<double>("Threshold").value_or(127.0);
+        const auto maxValue = GetInputValue<double>("MaxValue").value_or(255.0);
+        const int thresholdType = GetPrepared(preparedType, [this] { return ReadThresholdType(); });
+        if (thresholdType == cv::THRESH_OTSU || thresholdType == cv::THRESH_TRIANGLE || thresholdType == kThreshMulti
+            || GetInputValue<bool>("PackMask").value_or(false))
+        {
+            return std::nullopt;
+        }
+
+        auto apply = [threshold, maxValue, thresholdType](const cv::Mat &tile) {
+            cv::Mat grayTile = tile;
+            if (tile.channels() > 1)
+            {
+                cv::cvtColor(tile, grayTile, cv::COLOR_BGR2GRAY);
+            }
+            cv::Mat result;
+            cv::threshold(grayTile, result, threshold, maxValue, thresholdType);
+            return result;
+        };
+        const int outputType = CV_MAKETYPE(CV_MAT_DEPTH(inputType), 1);
+        return Nodes::TileOperation{ .halo = 0, .outputType = outputType, .apply = std::move(apply) };
+    }
+
+    void ThresholdNode::Prepare()
+    {
+        preparedType = ReadThresholdType();
+    }
+
+    int ThresholdNode::ReadThresholdType() const
+    {
+        return GetThresholdType(GetInputView<std::string>("Type").ValueOr(kDefaultType));
+    }
+
     int ThresholdNode::GetThresholdType(const std::string &typeStr) const
     {
         if (typeStr == "THRESH_BINARY")
@@ -90,8 +335,177 @@ namespace VisionCraft::Vision::Algorithms
             return cv::THRESH_OTSU;
         if (typeStr == "THRESH_TRIANGLE")
             return cv::THRESH_TRIANGLE;
+        if (typeStr == "THRESH_MULTI")
+            return kThreshMulti;
 
-        LOG_WARN("ThresholdNode {}: Unknown threshold type '{}', using THRESH_BINARY", GetName(), typeStr);
+        LOG_HOT_WARN("ThresholdNode {}: Unknown threshold type '{}', using THRESH_BINARY", GetName(), typeStr);
         return cv::THRESH_BINARY;
     }
+
+    std::vector<int> ThresholdNode::ReadLevelThresholds() const
+    {
+        const auto thresholdsView = GetInputView<std::string>("Thresholds");
+        std::string_view text = thresholdsView.ValueOr(std::string{});
+        std::vector<int> thresholds;
+        while (!text.empty())
+        {
+            const auto comma = text.find(',');
+            auto token = text.substr(0, comma);
+            text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+            while (!token.empty() && token.front() == ' ')
+            {
+                token.remove_prefix(1);
+            }
+            while (!token.empty() && token.back() == ' ')
+            {
+                token.remove_suffix(1);
+            }
+
+            int value = 0;
+            const auto [end, error] = std::from_chars(token.data(), token.data() + token.size(), value);
+            const bool ascending = thresholds.empty() || value > thresholds.back();
+            if (token.empty() || error != std::errc{} || end != token.data() + token.size() || value < 0 ||
+                value >= 255 || !ascending ||
+                thresholds.size() + 1 >= static_cast<size_t>(Constants::Threshold::kMaxLevels)) [[unlikely]]
+            {
+                LOG_HOT_WARN("ThresholdNode {}: Invalid thresholds '{}', expected up to {} ascending values below 255",
+                    GetName(),
+                    thresholdsView.ValueOr(std::string{}),
+                    Constants::Threshold::kMaxLevels - 1);
+                return {};
+            }
+            thresholds.push_back(value);
+        }
+        return thresholds;
+    }
+
+    std::shared_ptr<const ThresholdNode::HistogramState> ThresholdNode::GetHistogramState(const cv::Mat &image)
+    {
+        std::shared_ptr<const HistogramState> kept;
+        {
+            std::scoped_lock lock(histogramMutex);
+            kept = histogram;
+        }
+        if (kept && kept->source.data == image.data && kept->source.size() == image.size() &&
+            kept->source.type() == image.type() && kept->source.step1() == image.step1())
+        {
+            return kept;
+        }
+
+        // Built outside the lock; concurrent runs on other inputs each build their own and the last one is kept
+        auto state = std::make_shared<HistogramState>();
+        state->source = image;
+        state->gray = GetDerivedImage(image, Nodes::DerivedImage::Gray);
+        for (int y = 0; y < state->gray.rows; ++y)
+        {
+            const auto *row = state->gray.ptr<uchar>(y);
+            for (int x = 0; x < state->gray.cols; ++x)
+            {
+                ++state->counts[row[x]];
+            }
+        }
+        histogramBuilds.fetch_add(1, std::memory_order_relaxed);
+
+        std::scoped_lock lock(histogramMutex);
+        histogram = state;
+        return state;
+    }
+
+    double ThresholdNode::ApplyHistogramThreshold(
+        const cv::Mat &image, int thresholdType, double maxValue, cv::Mat &result)
+    {
+        const auto state = GetHistogramState(image);
+        std::vector<int> thresholds;
+        if (thresholdType == kThreshMulti)
+        {
+            thresholds = ReadLevelThresholds();
+            if (thresholds.empty())
+            {
+                auto levels = GetInputValue<int>("Levels").value_or(3);
+                if (levels < 2 || levels > Constants::Threshold::kMaxLevels) [[unlikely]]
+                {
+                    const int clamped = std::clamp(levels, 2, Constants::Threshold::kMaxLevels);
+                    LOG_HOT_WARN("ThresholdNode {}: Invalid levels ({}), using {}", GetName(), levels, clamped);
+                    levels = clamped;
+                }
+                thresholds = MultiOtsuThresholds(state->counts, levels);
+            }
+        }
+        else if (thresholdType == cv::THRESH_TRIANGLE)
+        {
+            thresholds.push_back(TriangleThreshold(state->counts));
+        }
+        else
+        {
+            thresholds.push_back(OtsuThreshold(state->counts, state->gray.total()));
+        }
+
+        // One table lookup per pixel; the histogram is only rebuilt for a new input buffer
+        cv::LUT(state->gray, LevelTable(thresholds, maxValue), result);
+        return thresholds.empty() ? 0.0 : static_cast<double>(thresholds.back());
+    }
+
+    std::optional<Nodes::ImageShape> ThresholdNode::InferOutputShape(
+        const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!input)
+        {
+            return std::nullopt;
+        }
+        if (ReadThresholdType() == kThreshMulti && CV_MAT_DEPTH(input->type) != CV_8U)
+        {
+            throw std::invalid_argument("THRESH_MULTI supports 8-bit images");
+        }
+        return Nodes::ImageShape{ .size = input->size, .type = CV_MAKETYPE(CV_MAT_DEPTH(input->type), 1) };
+    }
+
+    bool ThresholdNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const int thresholdType = ReadThresholdType();
+        if (thresholdType == kThreshMulti || GetInputValue<bool>("PackMask").value_or(false))
+        {
+            return writer.Fail("THRESH_MULTI and PackMask have no compiled form");
+        }
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+
+        // OTSU and TRIANGLE read the whole image's histogram, so only fixed thresholds run on strips
+        if (thresholdType != cv::THRESH_OTSU && thresholdType != cv::THRESH_TRIANGLE)
+        {
+            writer.SetPointwise();
+        }
+        const char *typeName = "cv::THRESH_BINARY";
+        switch (thresholdType)
+        {
+        case cv::THRESH_BINARY_INV:
+            typeName = "cv::THRESH_BINARY_INV";
+            break;
+        case cv::THRESH_TRUNC:
+            typeName = "cv::THRESH_TRUNC";
+            break;
+        case cv::THRESH_TOZERO:
+            typeName = "cv::THRESH_TOZERO";
+            break;
+        case cv::THRESH_TOZERO_INV:
+            typeName = "cv::THRESH_TOZERO_INV";
+            break;
+        case cv::THRESH_OTSU:
+            typeName = "cv::THRESH_OTSU";
+            break;
+        case cv::THRESH_TRIANGLE:
+            typeName = "cv::THRESH_TRIANGLE";
+            break;
+        default:
+            break;
+        }
+        writer.Include("<opencv2/imgproc.hpp>");
+        writer.Line("cv::threshold(" + writer.Gray(input) + ", " + writer.Output("Output") + ", " +
+                    writer.Constant("Threshold", GetInputValue<double>("Threshold").value_or(127.0)) + ", " +
+                    writer.Constant("MaxValue", GetInputValue<double>("MaxValue").value_or(255.0)) + ", " + typeName +
+                    ");");
+        return true;
+    }
 } // namespace VisionCraft::Vision::Algorithms
@@ -3,10 +3,29 @@
 #include "Nodes/Core/Node.h"
 #include <opencv2/opencv.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace VisionCraft::Vision::Algorithms
 {
     /**
      * @brief Node for image thresholding operations.
+     *
+     * On 8-bit images, THRESH_OTSU, THRESH_TRIANGLE and THRESH_MULTI work from a gray histogram the node
+     * keeps for its input buffer: while the input is unchanged (e.g. dragging a threshold slider with
+     * incremental execution), a rerun only derives thresholds from the kept histogram and applies a
+     * 256-entry lookup table in one pass. THRESH_MULTI maps pixels to Levels evenly spaced values between
+     * 0 and MaxValue, split at the comma-separated Thresholds or, if those are empty, at multi-level Otsu
+     * thresholds.
+     *
+     * With PackMask set, the result is output as a Nodes::BitMask of its nonzero pixels, meant for the binary
+     * types; other consumers still read a 0/255 image.
      */
     class ThresholdNode : public Nodes::Node
     {
@@ -37,22 +56,49 @@ namespace VisionCraft::Vision::Algorithms
          */
         void Process() override;
 
+        /**
+         * @brief Keeps the input's size and depth with one channel.
+         * @param input Shape of the input image
+         * @return Output shape, or std::nullopt if the input shape is unknown
+         * @throws std::invalid_argument for THRESH_MULTI on images that are not 8-bit
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the threshold as a pointwise tile operation.
+         *
+         * OTSU, TRIANGLE and MULTI pick thresholds from the whole image's histogram and are not tiled, nor are
+         * packed masks.
+         *
+         * @param inputType Type of the input image
+         * @return Tile operation, or std::nullopt for automatic threshold types and PackMask
+         */
+        [[nodiscard]] std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override;
+
+        /**
+         * @brief Writes the threshold as one cv::threshold call; fixed thresholds are pointwise.
+         * @param writer Receives the node's code
+         * @return False for THRESH_MULTI and PackMask, which have no compiled form
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
         /**
          * @brief Sets input image.
          * @param image Input image
          */
         void SetInputImage(const cv::Mat &image)
         {
-            inputImage = image;
+            SetInputSlotData("Input", image);
         }
 
         /**
          * @brief Returns processed image.
-         * @return Thresholded image
+         * @return Thresholded image held by the Output slot (empty if none)
          */
-        const cv::Mat &GetOutputImage() const
+        [[nodiscard]] cv::Mat GetOutputImage() const
         {
-            return outputImage;
+            return GetOutputSlot("Output").GetData<cv::Mat>().value_or(cv::Mat{});
         }
 
         /**
@@ -61,12 +107,21 @@ namespace VisionCraft::Vision::Algorithms
          */
         bool HasValidOutput() const
         {
-            return !outputImage.empty();
+            const auto output = GetOutputSlot("Output").GetDataIf<cv::Mat>();
+            return output && !output->empty();
         }
 
-    private:
-        cv::Mat inputImage;  ///< Input image
-        cv::Mat outputImage; ///< Thresholded image
+    protected:
+        /**
+         * @brief Resolves the Type slot, so runs skip the string comparisons.
+         */
+        void Prepare() override;
+
+        /**
+         * @brief Reads the Type slot as an OpenCV constant.
+         * @return OpenCV threshold type constant, or kThreshMulti
+         */
+        [[nodiscard]] int ReadThresholdType() const;
 
         /**
          * @brief Converts threshold type string to OpenCV constant.
@@ -74,5 +129,56 @@ namespace VisionCraft::Vision::Algorithms
          * @return OpenCV threshold type constant
          */
         int GetThresholdType(const std::string &typeStr) const;
+
+        /**
+         * @brief Parses the Thresholds slot.
+         * @return Ascending thresholds in [0, 255) (empty if the slot is empty or invalid)
+         */
+        [[nodiscard]] std::vector<int> ReadLevelThresholds() const;
+
+        /**
+         * @brief Returns how many histograms the node has computed.
+         * @return Histogram count (unchanged by reruns on the same input buffer)
+         */
+        [[nodiscard]] size_t GetHistogramBuildCount() const
+        {
+            return histogramBuilds.load(std::memory_order_relaxed);
+        }
+
+        static constexpr int kThreshMulti = 32; ///< "THRESH_MULTI" type (a bit cv::ThresholdTypes leaves unused)
+        inline static const std::string kDefaultType{ "THRESH_BINARY" }; ///< Type slot default and fallback
+
+    private:
+        /**
+         * @brief Gray image and histogram of one input buffer.
+         */
+        struct HistogramState
+        {
+            cv::Mat source;                     ///< Input the state was built from (keeps its buffer alive)
+            cv::Mat gray;                       ///< 8-bit gray version of source
+            std::array<uint32_t, 256> counts{}; ///< Pixels per gray level
+        };
+
+        /**
+         * @brief Returns the histogram state of an 8-bit input, rebuilding it only for a new buffer.
+         * @param image 8-bit input image
+         * @return State for image, kept alive by the handle even if another run replaces it meanwhile
+         */
+        std::shared_ptr<const HistogramState> GetHistogramState(const cv::Mat &image);
+
+        /**
+         * @brief Thresholds an 8-bit image through a lookup table built from its kept histogram.
+         * @param image 8-bit input image
+         * @param thresholdType OpenCV threshold type with THRESH_OTSU or THRESH_TRIANGLE, or kThreshMulti
+         * @param maxValue Value of the top level
+         * @param result Output image
+         * @return Threshold used (the highest one for kThreshMulti)
+         */
+        double ApplyHistogramThreshold(const cv::Mat &image, int thresholdType, double maxValue, cv::Mat &result);
+
+        mutable std::mutex histogramMutex;               ///< Guards histogram (concurrent context runs)
+        std::shared_ptr<const HistogramState> histogram; ///< Kept for the last 8-bit input (nullptr = none)
+        std::atomic<size_t> histogramBuilds = 0;         ///< Histograms computed so far
+        int preparedType = cv::THRESH_BINARY;            ///< Type slot resolved by Prepare()
     };
 } // namespace VisionCraft::Vision::Algorithms
@@ -0,0 +1,74 @@
+#include "Vision/Cuda/CudaCannyEdgeNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudaimgproc.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaCannyEdgeNode::CudaCannyEdgeNode(Nodes::NodeId id, const std::string &name) : CannyEdgeNode(id, name)
+    {
+    }
+
+    void CudaCannyEdgeNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaCannyEdgeNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const auto parameters = ReadParameters();
+
+            auto &stream = GetThreadStream();
+            cv::cuda::GpuMat grayImage;
+            if (inputImage.channels() > 1)
+            {
+                cv::cuda::cvtColor(inputImage, grayImage, cv::COLOR_BGR2GRAY, 0, stream);
+            }
+            else
+            {
+                grayImage = inputImage;
+            }
+
+            const auto detector = cv::cuda::createCannyEdgeDetector(parameters.lowThreshold,
+                parameters.highThreshold,
+                parameters.apertureSize,
+                parameters.l2Gradient);
+            cv::cuda::GpuMat outputImage;
+            detector->detect(grayImage, outputImage, stream);
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO(
+                "CudaCannyEdgeNode {}: Applied Canny edge detection (low: {}, high: {}, aperture: {}, l2: {})",
+                GetName(),
+                parameters.lowThreshold,
+                parameters.highThreshold,
+                parameters.apertureSize,
+                parameters.l2Gradient);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaCannyEdgeNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaCannyEdgeNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaCannyEdgeNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/CannyEdgeNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief CannyEdgeNode variant that detects edges on the GPU (cv::cuda::createCannyEdgeDetector).
+     */
+    class CudaCannyEdgeNode : public Algorithms::CannyEdgeNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Canny Edge Detection node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaCannyEdgeNode(Nodes::NodeId id, const std::string &name = "Canny Edge Detection (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaCannyEdgeNode";
+        }
+
+        /**
+         * @brief Detects edges in the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,64 @@
+#include "Vision/Cuda/CudaCvtColorNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudaimgproc.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaCvtColorNode::CudaCvtColorNode(Nodes::NodeId id, const std::string &name) : CvtColorNode(id, name)
+    {
+    }
+
+    void CudaCvtColorNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaCvtColorNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const auto &convInfo = GetConversion();
+            if (inputImage.channels() != convInfo.requiredChannels) [[unlikely]]
+            {
+                LOG_ERROR("CudaCvtColorNode {}: {} requires {}-channel input, got {}",
+                    GetName(),
+                    convInfo.name,
+                    convInfo.requiredChannels,
+                    inputImage.channels());
+                ClearOutputSlot("Output");
+                return;
+            }
+
+            auto &stream = GetThreadStream();
+            cv::cuda::GpuMat outputImage;
+            cv::cuda::cvtColor(inputImage, outputImage, convInfo.code, 0, stream);
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaCvtColorNode {}: Applied Color Conversion ({})", GetName(), convInfo.name);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaCvtColorNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaCvtColorNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaCvtColorNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/CvtColorNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief CvtColorNode variant that converts color spaces on the GPU (cv::cuda::cvtColor).
+     */
+    class CudaCvtColorNode : public Algorithms::CvtColorNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Convert Color node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaCvtColorNode(Nodes::NodeId id, const std::string &name = "Convert Color (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaCvtColorNode";
+        }
+
+        /**
+         * @brief Converts the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,67 @@
+#include "Vision/Cuda/CudaMedianBlurNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudaarithm.hpp>
+#include <opencv2/cudafilters.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaMedianBlurNode::CudaMedianBlurNode(Nodes::NodeId id, const std::string &name) : MedianBlurNode(id, name)
+    {
+    }
+
+    void CudaMedianBlurNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaMedianBlurNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const int ksize = GetKernelSize();
+
+            // The CUDA median filter takes single-channel 8-bit images; filter channels one by one
+            auto &stream = GetThreadStream();
+            const auto filter = cv::cuda::createMedianFilter(CV_8UC1, ksize);
+            std::vector<cv::cuda::GpuMat> channels;
+            cv::cuda::split(inputImage, channels, stream);
+            for (auto &channel : channels)
+            {
+                cv::cuda::GpuMat filtered;
+                filter->apply(channel, filtered, stream);
+                channel = filtered;
+            }
+
+            cv::cuda::GpuMat outputImage;
+            cv::cuda::merge(channels, outputImage, stream);
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaMedianBlurNode {}: Applied Median Blur (ksize: {})", GetName(), ksize);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaMedianBlurNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaMedianBlurNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaMedianBlurNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/MedianBlurNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief MedianBlurNode variant that applies the median filter on the GPU (cv::cuda::createMedianFilter).
+     */
+    class CudaMedianBlurNode : public Algorithms::MedianBlurNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Median Blur node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaMedianBlurNode(Nodes::NodeId id, const std::string &name = "Median Blur (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaMedianBlurNode";
+        }
+
+        /**
+         * @brief Filters the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
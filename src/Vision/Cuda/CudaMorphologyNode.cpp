@@ -0,0 +1,83 @@
+#include "Vision/Cuda/CudaMorphologyNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudafilters.hpp>
+#include <opencv2/cudaimgproc.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaMorphologyNode::CudaMorphologyNode(Nodes::NodeId id, const std::string &name) : MorphologyNode(id, name)
+    {
+    }
+
+    void CudaMorphologyNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaMorphologyNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const auto parameters = GetParameters();
+
+            // CUDA morphology filters take one or four channels
+            auto &stream = GetThreadStream();
+            const bool addAlpha = inputImage.channels() == 3;
+            cv::cuda::GpuMat source;
+            if (addAlpha)
+            {
+                cv::cuda::cvtColor(inputImage, source, cv::COLOR_BGR2BGRA, 0, stream);
+            }
+            else
+            {
+                source = inputImage;
+            }
+
+            const auto filter = cv::cuda::createMorphologyFilter(
+                parameters.morphOp, source.type(), parameters.element, cv::Point(-1, -1), parameters.iterations);
+            cv::cuda::GpuMat filtered;
+            filter->apply(source, filtered, stream);
+
+            cv::cuda::GpuMat outputImage;
+            if (addAlpha)
+            {
+                cv::cuda::cvtColor(filtered, outputImage, cv::COLOR_BGRA2BGR, 0, stream);
+            }
+            else
+            {
+                outputImage = filtered;
+            }
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaMorphologyNode {}: Applied Morphology (Op: {}, ksize: {}, iter: {})",
+                GetName(),
+                parameters.operation,
+                parameters.ksize,
+                parameters.iterations);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaMorphologyNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaMorphologyNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaMorphologyNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
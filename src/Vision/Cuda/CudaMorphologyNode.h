@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/MorphologyNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief MorphologyNode variant that applies morphology on the GPU (cv::cuda::createMorphologyFilter).
+     */
+    class CudaMorphologyNode : public Algorithms::MorphologyNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Morphology node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaMorphologyNode(Nodes::NodeId id, const std::string &name = "Morphology (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaMorphologyNode";
+        }
+
+        /**
+         * @brief Filters the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,67 @@
+#include "Vision/Cuda/CudaResizeNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudawarping.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaResizeNode::CudaResizeNode(Nodes::NodeId id, const std::string &name) : ResizeNode(id, name)
+    {
+    }
+
+    void CudaResizeNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaResizeNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            auto parameters = ReadParameters();
+            if (parameters.flags == cv::INTER_LANCZOS4) [[unlikely]]
+            {
+                LOG_HOT_WARN("CudaResizeNode {}: Lanczos4 is not available on the GPU, using Cubic", GetName());
+                parameters.flags = cv::INTER_CUBIC;
+            }
+
+            auto &stream = GetThreadStream();
+            cv::cuda::GpuMat outputImage;
+            cv::cuda::resize(
+                inputImage, outputImage, parameters.size, parameters.fx, parameters.fy, parameters.flags, stream);
+            stream.waitForCompletion();
+            [[maybe_unused]] const cv::Size outputSize = outputImage.size();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaResizeNode {}: Resized (Size: {}x{}, Scale: {:.2f}x{:.2f}, Interp: {})",
+                GetName(),
+                outputSize.width,
+                outputSize.height,
+                parameters.fx,
+                parameters.fy,
+                parameters.interpolation);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaResizeNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaResizeNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaResizeNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/ResizeNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief ResizeNode variant that resizes the input on the GPU (cv::cuda::resize).
+     */
+    class CudaResizeNode : public Algorithms::ResizeNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Resize node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaResizeNode(Nodes::NodeId id, const std::string &name = "Resize (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaResizeNode";
+        }
+
+        /**
+         * @brief Resizes the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
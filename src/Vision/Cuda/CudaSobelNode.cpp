@@ -0,0 +1,94 @@
+#include "Vision/Cuda/CudaSobelNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudaarithm.hpp>
+#include <opencv2/cudafilters.hpp>
+#include <opencv2/cudaimgproc.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaSobelNode::CudaSobelNode(Nodes::NodeId id, const std::string &name) : SobelNode(id, name)
+    {
+    }
+
+    void CudaSobelNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaSobelNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const auto parameters = ReadParameters();
+
+            auto &stream = GetThreadStream();
+            cv::cuda::GpuMat grayImage;
+            if (inputImage.channels() > 1)
+            {
+                cv::cuda::cvtColor(inputImage, grayImage, cv::COLOR_BGR2GRAY, 0, stream);
+            }
+            else
+            {
+                grayImage = inputImage;
+            }
+
+            // Use CV_16S to avoid overflow, then convert back to 8U like cv::convertScaleAbs; wider policies
+            // keep the signed derivative
+            const bool absolute = parameters.depth == CV_8U;
+            const auto filter = cv::cuda::createSobelFilter(grayImage.type(),
+                absolute ? CV_16SC1 : CV_MAKETYPE(parameters.depth, 1),
+                parameters.dx,
+                parameters.dy,
+                parameters.ksize,
+                parameters.scale,
+                cv::BORDER_DEFAULT);
+            cv::cuda::GpuMat grad;
+            filter->apply(grayImage, grad, stream);
+            if (parameters.delta != 0.0)
+            {
+                cv::cuda::add(grad, cv::Scalar::all(parameters.delta), grad, cv::noArray(), -1, stream);
+            }
+            cv::cuda::GpuMat outputImage;
+            if (absolute)
+            {
+                cv::cuda::abs(grad, grad, stream);
+                grad.convertTo(outputImage, CV_8U, stream);
+            }
+            else
+            {
+                outputImage = grad;
+            }
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaSobelNode {}: Applied Sobel (dx: {}, dy: {}, ksize: {})",
+                GetName(),
+                parameters.dx,
+                parameters.dy,
+                parameters.ksize);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaSobelNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaSobelNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaSobelNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
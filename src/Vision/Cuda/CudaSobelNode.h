@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/SobelNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief SobelNode variant that computes Sobel gradients on the GPU (cv::cuda::createSobelFilter).
+     */
+    class CudaSobelNode : public Algorithms::SobelNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Sobel Operator node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaSobelNode(Nodes::NodeId id, const std::string &name = "Sobel Operator (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaSobelNode";
+        }
+
+        /**
+         * @brief Filters the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
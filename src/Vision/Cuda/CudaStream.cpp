@@ -0,0 +1,16 @@
+#include "Vision/Cuda/CudaStream.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    bool IsAvailable()
+    {
+        static const bool available = cv::cuda::getCudaEnabledDeviceCount() > 0;
+        return available;
+    }
+
+    cv::cuda::Stream &GetThreadStream()
+    {
+        thread_local cv::cuda::Stream stream;
+        return stream;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <opencv2/core/cuda.hpp>
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief Checks whether CUDA nodes can run on this machine.
+     * @return True if OpenCV reports at least one CUDA device
+     */
+    [[nodiscard]] bool IsAvailable();
+
+    /**
+     * @brief Returns the CUDA stream of the calling thread.
+     *
+     * The parallel scheduler runs independent branches on different workers, so each branch enqueues its
+     * kernels and copies on its own stream and they overlap on the device. A node waits for its stream before
+     * returning, because the consumer of its output may run on another worker.
+     *
+     * @return Stream owned by the calling thread
+     */
+    [[nodiscard]] cv::cuda::Stream &GetThreadStream();
+} // namespace VisionCraft::Vision::Cuda
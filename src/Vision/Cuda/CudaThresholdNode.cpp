@@ -0,0 +1,90 @@
+#include "Vision/Cuda/CudaThresholdNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Vision/Cuda/CudaStream.h"
+#include <opencv2/cudaarithm.hpp>
+#include <opencv2/cudaimgproc.hpp>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::Cuda
+{
+    CudaThresholdNode::CudaThresholdNode(Nodes::NodeId id, const std::string &name) : ThresholdNode(id, name)
+    {
+    }
+
+    void CudaThresholdNode::Process()
+    {
+        const auto inputData = GetInputValueIf<cv::cuda::GpuMat>("Input");
+        if (!inputData || inputData->empty()) [[unlikely]]
+        {
+            LOG_HOT_WARN("CudaThresholdNode {}: No input image provided", GetName());
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        const cv::cuda::GpuMat &inputImage = *inputData;
+
+        try
+        {
+            const auto threshold = GetInputValue<double>("Threshold").value_or(127.0);
+            const auto maxValue = GetInputValue<double>("MaxValue").value_or(255.0);
+            const auto typeView = GetInputView<std::string>("Type");
+            const auto &typeStr = typeView.ValueOr(kDefaultType);
+            int thresholdType = GetThresholdType(typeStr);
+            if (thresholdType == kThreshMulti)
+            {
+                throw std::invalid_argument("THRESH_MULTI is not available on CUDA images");
+            }
+
+            auto &stream = GetThreadStream();
+            cv::cuda::GpuMat grayImage;
+            if (inputImage.channels() > 1)
+            {
+                cv::cuda::cvtColor(inputImage, grayImage, cv::COLOR_BGR2GRAY, 0, stream);
+            }
+            else
+            {
+                grayImage = inputImage;
+            }
+
+            // cv::cuda::threshold has no automatic levels; pick the level on the host, then binarize on the GPU
+            double actualThreshold = threshold;
+            if (thresholdType == cv::THRESH_OTSU || thresholdType == cv::THRESH_TRIANGLE)
+            {
+                cv::Mat hostImage;
+                cv::Mat unused;
+                grayImage.download(hostImage, stream);
+                stream.waitForCompletion();
+                actualThreshold = cv::threshold(hostImage, unused, threshold, maxValue, thresholdType);
+                thresholdType = cv::THRESH_BINARY;
+            }
+
+            cv::cuda::GpuMat outputImage;
+            cv::cuda::threshold(grayImage, outputImage, actualThreshold, maxValue, thresholdType, stream);
+            stream.waitForCompletion();
+            SetOutputSlotData("Output", std::move(outputImage));
+
+            LOG_HOT_INFO("CudaThresholdNode {}: Applied thresholding (threshold: {}, actual: {}, max: {}, type: {})",
+                GetName(),
+                threshold,
+                actualThreshold,
+                maxValue,
+                typeStr);
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("CudaThresholdNode {}: OpenCV error: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+        catch (const std::exception &e)
+        {
+            LOG_ERROR("CudaThresholdNode {}: Error processing image: {}", GetName(), e.what());
+            ClearOutputSlot("Output");
+        }
+    }
+
+    bool CudaThresholdNode::UsesCudaImages() const
+    {
+        return true;
+    }
+} // namespace VisionCraft::Vision::Cuda
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Vision/Algorithms/ThresholdNode.h"
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief ThresholdNode variant that thresholds on the GPU (cv::cuda::threshold).
+     */
+    class CudaThresholdNode : public Algorithms::ThresholdNode
+    {
+    public:
+        /**
+         * @brief Constructs CUDA Threshold node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        CudaThresholdNode(Nodes::NodeId id, const std::string &name = "Threshold (CUDA)");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "CudaThresholdNode";
+        }
+
+        /**
+         * @brief Thresholds the input cv::cuda::GpuMat on the calling thread's stream.
+         */
+        void Process() override;
+
+        /**
+         * @brief Inputs arrive as cv::cuda::GpuMat.
+         * @return Always true
+         */
+        [[nodiscard]] bool UsesCudaImages() const override;
+    };
+} // namespace VisionCraft::Vision::Cuda
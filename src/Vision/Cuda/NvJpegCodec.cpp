@@ -0,0 +1,176 @@
+#include "Vision/Cuda/NvJpegCodec.h"
+#include "Vision/Cuda/CudaStream.h"
+
+#include <opencv2/core/cuda.hpp>
+#include <opencv2/core/cuda_stream_accessor.hpp>
+
+#include <nvjpeg.h>
+
+namespace VisionCraft::Vision::Cuda
+{
+    namespace
+    {
+        // The library handle is shared; it is created once and kept for the life of the process
+        nvjpegHandle_t GetHandle()
+        {
+            static const nvjpegHandle_t handle = []() -> nvjpegHandle_t {
+                nvjpegHandle_t created = nullptr;
+                return nvjpegCreateSimple(&created) == NVJPEG_STATUS_SUCCESS ? created : nullptr;
+            }();
+            return handle;
+        }
+
+        // Decoder and encoder state must not be shared between concurrent calls, so each thread owns its own
+        struct ThreadState
+        {
+            nvjpegJpegState_t decoder = nullptr;
+            nvjpegEncoderState_t encoder = nullptr;
+            nvjpegEncoderParams_t encoderParams = nullptr;
+
+            ThreadState() = default;
+            ThreadState(const ThreadState &) = delete;
+            ThreadState &operator=(const ThreadState &) = delete;
+
+            ~ThreadState()
+            {
+                if (encoderParams)
+                {
+                    nvjpegEncoderParamsDestroy(encoderParams);
+                }
+                if (encoder)
+                {
+                    nvjpegEncoderStateDestroy(encoder);
+                }
+                if (decoder)
+                {
+                    nvjpegJpegStateDestroy(decoder);
+                }
+            }
+        };
+
+        ThreadState &GetThreadState()
+        {
+            thread_local ThreadState state;
+            return state;
+        }
+    } // namespace
+
+    bool IsNvJpegAvailable()
+    {
+        static const bool available = IsAvailable() && GetHandle() != nullptr;
+        return available;
+    }
+
+    cv::Mat DecodeJpeg(std::span<const unsigned char> data)
+    {
+        if (!IsNvJpegAvailable())
+        {
+            return {};
+        }
+
+        const nvjpegHandle_t handle = GetHandle();
+        auto &state = GetThreadState();
+        if (!state.decoder && nvjpegJpegStateCreate(handle, &state.decoder) != NVJPEG_STATUS_SUCCESS)
+        {
+            state.decoder = nullptr;
+            return {};
+        }
+
+        int components = 0;
+        nvjpegChromaSubsampling_t subsampling{};
+        int widths[NVJPEG_MAX_COMPONENT] = {};
+        int heights[NVJPEG_MAX_COMPONENT] = {};
+        if (nvjpegGetImageInfo(handle, data.data(), data.size(), &components, &subsampling, widths, heights) !=
+                NVJPEG_STATUS_SUCCESS
+            || widths[0] <= 0 || heights[0] <= 0)
+        {
+            return {};
+        }
+
+        auto &stream = GetThreadStream();
+        const cudaStream_t cudaStream = cv::cuda::StreamAccessor::getStream(stream);
+        cv::cuda::GpuMat decoded(heights[0], widths[0], CV_8UC3);
+        nvjpegImage_t output{};
+        output.channel[0] = decoded.ptr<unsigned char>();
+        output.pitch[0] = decoded.step;
+        if (nvjpegDecode(handle, state.decoder, data.data(), data.size(), NVJPEG_OUTPUT_BGRI, &output, cudaStream) !=
+            NVJPEG_STATUS_SUCCESS)
+        {
+            return {};
+        }
+
+        cv::Mat image;
+        decoded.download(image, stream);
+        stream.waitForCompletion();
+        return image;
+    }
+
+    bool EncodeJpeg(const cv::Mat &image, int quality, bool optimize, std::vector<unsigned char> &encoded)
+    {
+        if (!IsNvJpegAvailable() || image.type() != CV_8UC3 || image.empty())
+        {
+            return false;
+        }
+
+        const nvjpegHandle_t handle = GetHandle();
+        auto &state = GetThreadState();
+        auto &stream = GetThreadStream();
+        const cudaStream_t cudaStream = cv::cuda::StreamAccessor::getStream(stream);
+        if (!state.encoder)
+        {
+            if (nvjpegEncoderStateCreate(handle, &state.encoder, cudaStream) != NVJPEG_STATUS_SUCCESS)
+            {
+                state.encoder = nullptr;
+                return false;
+            }
+            if (nvjpegEncoderParamsCreate(handle, &state.encoderParams, cudaStream) != NVJPEG_STATUS_SUCCESS)
+            {
+                state.encoderParams = nullptr;
+                return false;
+            }
+        }
+        if (!state.encoderParams)
+        {
+            return false;
+        }
+
+        const bool configured =
+            nvjpegEncoderParamsSetQuality(state.encoderParams, quality, cudaStream) == NVJPEG_STATUS_SUCCESS &&
+            nvjpegEncoderParamsSetOptimizedHuffman(state.encoderParams, optimize ? 1 : 0, cudaStream) ==
+                NVJPEG_STATUS_SUCCESS &&
+            nvjpegEncoderParamsSetSamplingFactors(state.encoderParams, NVJPEG_CSS_420, cudaStream) ==
+                NVJPEG_STATUS_SUCCESS;
+        if (!configured)
+        {
+            return false;
+        }
+
+        cv::cuda::GpuMat source;
+        source.upload(image, stream);
+        nvjpegImage_t input{};
+        input.channel[0] = source.ptr<unsigned char>();
+        input.pitch[0] = source.step;
+        size_t length = 0;
+        if (nvjpegEncodeImage(handle,
+                state.encoder,
+                state.encoderParams,
+                &input,
+                NVJPEG_INPUT_BGRI,
+                image.cols,
+                image.rows,
+                cudaStream) != NVJPEG_STATUS_SUCCESS
+            || nvjpegEncodeRetrieveBitstream(handle, state.encoder, nullptr, &length, cudaStream) !=
+                   NVJPEG_STATUS_SUCCESS)
+        {
+            return false;
+        }
+
+        encoded.resize(length);
+        const bool retrieved =
+            nvjpegEncodeRetrieveBitstream(handle, state.encoder, encoded.data(), &length, cudaStream) ==
+            NVJPEG_STATUS_SUCCESS;
+        stream.waitForCompletion();
+        encoded.resize(retrieved ? length : 0);
+        return retrieved;
+    }
+} // namespace VisionCraft::Vision::Cuda
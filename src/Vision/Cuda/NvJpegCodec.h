@@ -0,0 +1,35 @@
+#pragma once
+
+#include <opencv2/core.hpp>
+
+#include <span>
+#include <vector>
+
+namespace VisionCraft::Vision::Cuda
+{
+    /**
+     * @brief Checks whether nvJPEG can decode and encode on this machine.
+     * @return True if a CUDA device is present and the nvJPEG library initialized
+     */
+    [[nodiscard]] bool IsNvJpegAvailable();
+
+    /**
+     * @brief Decodes a JPEG file's bytes to 8-bit BGR on the GPU and downloads the result.
+     * @param data Complete JPEG file
+     * @return Image in stored orientation (EXIF is not applied), or empty if nvJPEG declined or failed
+     */
+    [[nodiscard]] cv::Mat DecodeJpeg(std::span<const unsigned char> data);
+
+    /**
+     * @brief Encodes an 8-bit BGR image to JPEG on the GPU with 4:2:0 chroma.
+     * @param image 8-bit three-channel image
+     * @param quality JPEG quality, 1 to 100
+     * @param optimize Build optimized Huffman tables
+     * @param encoded Receives the JPEG file
+     * @return True on success
+     */
+    [[nodiscard]] bool EncodeJpeg(const cv::Mat &image,
+        int quality,
+        bool optimize,
+        std::vector<unsigned char> &encoded);
+} // namespace VisionCraft::Vision::Cuda
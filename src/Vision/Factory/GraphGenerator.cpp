@@ -0,0 +1,206 @@
+#include "Vision/Factory/GraphGenerator.h"
+#include "Vision/Factory/NodeFactory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace VisionCraft::Vision
+{
+    namespace
+    {
+        // Random tries per input before it is left open; bounded so generation stays linear in node count
+        constexpr int kPickAttempts = 8;
+
+        /**
+         * @brief Slots of one node type, found by creating a sample node.
+         */
+        struct TypeProfile
+        {
+            std::string type;                          ///< Factory type
+            std::vector<std::string> dataInputs;       ///< Inputs without a default value
+            std::vector<std::string> dataOutputs;      ///< Output slots
+            std::vector<std::string> executionInputs;  ///< Execution input pins
+            std::vector<std::string> executionOutputs; ///< Execution output pins
+        };
+
+        /**
+         * @brief Node placed in a layer.
+         */
+        struct PlacedNode
+        {
+            const TypeProfile *profile = nullptr; ///< Slots of its type
+            size_t fanOut = 0;                    ///< Connections leaving it so far
+        };
+
+        std::vector<TypeProfile> ProbeTypes(const std::vector<std::string> &requested)
+        {
+            const auto types = requested.empty() ? NodeFactory::GetRegisteredTypes() : requested;
+            std::vector<TypeProfile> profiles;
+            for (const auto &type : types)
+            {
+                const auto sample = NodeFactory::CreateNode(type, 0, type);
+                if (!sample)
+                {
+                    continue;
+                }
+
+                TypeProfile profile{ .type = type,
+                    .dataOutputs = sample->GetOutputSlotNames(),
+                    .executionInputs = sample->GetExecutionInputPins(),
+                    .executionOutputs = sample->GetExecutionOutputPins() };
+                for (auto &name : sample->GetInputSlotNames())
+                {
+                    if (!sample->GetInputSlot(name).HasDefaultValue())
+                    {
+                        profile.dataInputs.push_back(std::move(name));
+                    }
+                }
+                profiles.push_back(std::move(profile));
+            }
+            return profiles;
+        }
+    } // namespace
+
+    std::optional<GeneratedGraph> GraphGenerator::Generate(Nodes::NodeEditor &editor,
+        const GraphGeneratorOptions &options)
+    {
+        const auto profiles = ProbeTypes(options.nodeTypes);
+        if (profiles.empty())
+        {
+            return std::nullopt;
+        }
+
+        // First layer draws from types with outputs, later layers from types with inputs, so edges can form
+        std::vector<const TypeProfile *> sources;
+        std::vector<const TypeProfile *> consumers;
+        for (const auto &profile : profiles)
+        {
+            if (!profile.dataOutputs.empty() || !profile.executionOutputs.empty())
+            {
+                sources.push_back(&profile);
+            }
+            if (!profile.dataInputs.empty() || !profile.executionInputs.empty())
+            {
+                consumers.push_back(&profile);
+            }
+        }
+        std::vector<const TypeProfile *> everyType;
+        for (const auto &profile : profiles)
+        {
+            everyType.push_back(&profile);
+        }
+
+        const size_t nodeCount = options.nodeCount;
+        size_t depth =
+            options.depth != 0 ? options.depth : static_cast<size_t>(std::sqrt(static_cast<double>(nodeCount)));
+        depth = std::clamp<size_t>(depth, 1, std::max<size_t>(nodeCount, 1));
+
+        // Layer l holds nodes [layerStart[l], layerStart[l + 1]); the first layers take the remainder
+        std::vector<size_t> layerStart(depth + 1, 0);
+        for (size_t layer = 0; layer < depth; ++layer)
+        {
+            layerStart[layer + 1] = layerStart[layer] + nodeCount / depth + (layer < nodeCount % depth ? 1 : 0);
+        }
+
+        std::mt19937 random(options.seed);
+        const auto pick = [&random](size_t first, size_t last) {
+            return std::uniform_int_distribution<size_t>(first, last)(random);
+        };
+        std::bernoulli_distribution executionEdge(std::clamp(options.executionEdgeRatio, 0.0, 1.0));
+
+        GeneratedGraph result;
+        result.nodeCount = nodeCount;
+        result.depth = nodeCount == 0 ? 0 : depth;
+        result.positions.reserve(nodeCount);
+
+        editor.Clear();
+        std::vector<PlacedNode> placed(nodeCount);
+        std::vector<Nodes::NodePtr> nodes;
+        nodes.reserve(nodeCount);
+        std::vector<Nodes::Connection> connections;
+
+        // Returns a node of layers [firstLayer, lastLayer] with a free output of the requested kind
+        const auto pickSource = [&](size_t firstLayer, size_t lastLayer, bool execution) -> size_t {
+            for (int attempt = 0; attempt < kPickAttempts; ++attempt)
+            {
+                const size_t index = pick(layerStart[firstLayer], layerStart[lastLayer + 1] - 1);
+                const auto &outputs =
+                    execution ? placed[index].profile->executionOutputs : placed[index].profile->dataOutputs;
+                if (!outputs.empty() && placed[index].fanOut < options.maxFanOut)
+                {
+                    ++placed[index].fanOut;
+                    return index;
+                }
+            }
+            return nodeCount;
+        };
+
+        Nodes::NodeArena::Scope scope(editor.GetNodeArena());
+        for (size_t layer = 0; layer < depth; ++layer)
+        {
+            const auto &pool = layer == 0 ? (sources.empty() ? everyType : sources)
+                                          : (consumers.empty() ? everyType : consumers);
+            for (size_t index = layerStart[layer]; index < layerStart[layer + 1]; ++index)
+            {
+                const auto *profile = pool[pick(0, pool.size() - 1)];
+                const auto id = static_cast<Nodes::NodeId>(index + 1);
+                placed[index].profile = profile;
+                nodes.push_back(NodeFactory::CreateNode(profile->type, id, profile->type + " " + std::to_string(id)));
+                result.positions[id] = { static_cast<float>(layer) * Constants::Generator::kLayerSpacing,
+                    static_cast<float>(index - layerStart[layer]) * Constants::Generator::kRowSpacing };
+                if (layer == 0)
+                {
+                    continue;
+                }
+
+                const auto connect = [&](size_t source, const std::string &input, Nodes::ConnectionType type) {
+                    const auto &outputs = type == Nodes::ConnectionType::Execution
+                                              ? placed[source].profile->executionOutputs
+                                              : placed[source].profile->dataOutputs;
+                    connections.push_back({ .from = static_cast<Nodes::NodeId>(source + 1),
+                        .fromSlot = Nodes::SlotName(outputs[pick(0, outputs.size() - 1)]),
+                        .to = id,
+                        .toSlot = Nodes::SlotName(input),
+                        .type = type });
+                };
+
+                if (!profile->executionInputs.empty() && executionEdge(random))
+                {
+                    if (const size_t source = pickSource(layer - 1, layer - 1, true); source < nodeCount)
+                    {
+                        connect(source, profile->executionInputs.front(), Nodes::ConnectionType::Execution);
+                        ++result.executionEdges;
+                    }
+                }
+
+                // The first input comes from the layer above, which is what makes the graph depth layers deep
+                for (size_t input = 0; input < profile->dataInputs.size(); ++input)
+                {
+                    const size_t source = pickSource(input == 0 ? layer - 1 : 0, layer - 1, false);
+                    if (source < nodeCount)
+                    {
+                        connect(source, profile->dataInputs[input], Nodes::ConnectionType::Data);
+                        ++result.dataEdges;
+                    }
+                }
+            }
+        }
+
+        editor.InsertGraph(std::move(nodes), std::move(connections));
+        return result;
+    }
+
+    std::optional<GeneratedGraph> GraphGenerator::GenerateFile(const std::filesystem::path &filepath,
+        const GraphGeneratorOptions &options)
+    {
+        Nodes::NodeEditor editor;
+        auto result = Generate(editor, options);
+        if (!result || !editor.SaveToFile(filepath, result->positions))
+        {
+            return std::nullopt;
+        }
+        return result;
+    }
+
+} // namespace VisionCraft::Vision
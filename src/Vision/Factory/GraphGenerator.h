@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Vision
+{
+    /**
+     * @brief Shape of a generated graph.
+     */
+    struct GraphGeneratorOptions
+    {
+        size_t nodeCount = 100;                                     ///< Nodes to create
+        size_t depth = 0;                                           ///< Layers (0 = about sqrt(nodeCount))
+        size_t maxFanOut = Constants::Generator::kDefaultMaxFanOut; ///< Edges leaving one node at most
+        std::vector<std::string> nodeTypes;                         ///< Types to use (empty = all registered)
+        uint32_t seed = 1;                                          ///< Same seed, same graph
+
+        double executionEdgeRatio = Constants::Generator::kDefaultExecutionEdgeRatio; ///< Execution share of edges
+    };
+
+    /**
+     * @brief What GraphGenerator produced.
+     */
+    struct GeneratedGraph
+    {
+        size_t nodeCount = 0;                                                 ///< Nodes created
+        size_t dataEdges = 0;                                                 ///< Data connections
+        size_t executionEdges = 0;                                            ///< Execution connections
+        size_t depth = 0;                                                     ///< Layers actually used
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions; ///< Canvas position per node
+    };
+
+    /**
+     * @brief Builds random valid graphs from the registered NodeFactory types, for scaling tests and benchmarks.
+     *
+     * Nodes are laid out in layers. Every node past the first layer takes its first data input from the
+     * layer right above it, so the plan is as deep as the layer count, and its other inputs from any earlier
+     * layer. Edges only point down, so the graph is acyclic; each input is fed at most once and no output
+     * feeds more than maxFanOut inputs. Only inputs without a default value are connected, as those are the
+     * ones a node expects upstream data in. A node with an execution input is also linked, with probability
+     * executionEdgeRatio, from an execution output in the layer above.
+     *
+     * Types are probed once by creating a sample node; types the factory cannot create are skipped. Node IDs
+     * run from 1 to nodeCount in layer order, and positions follow the layers left to right.
+     */
+    class GraphGenerator
+    {
+    public:
+        /**
+         * @brief Fills an editor with a generated graph.
+         * @param editor Editor to fill (its current graph is replaced)
+         * @param options Size, shape, node types and seed
+         * @return Summary and node positions, or std::nullopt if no usable node type is registered
+         */
+        [[nodiscard]] static std::optional<GeneratedGraph> Generate(Nodes::NodeEditor &editor,
+            const GraphGeneratorOptions &options);
+
+        /**
+         * @brief Generates a graph and saves it with its node positions.
+         * @param filepath Destination; the extension picks JSON or the binary format, as with SaveToFile() (only
+         *        the binary format keeps which edges are execution edges)
+         * @param options Size, shape, node types and seed
+         * @return Summary, or std::nullopt if no usable node type is registered or the file cannot be written
+         */
+        [[nodiscard]] static std::optional<GeneratedGraph> GenerateFile(const std::filesystem::path &filepath,
+            const GraphGeneratorOptions &options);
+    };
+
+} // namespace VisionCraft::Vision
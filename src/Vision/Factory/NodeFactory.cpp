@@ -1,8 +1,18 @@
 #include "Vision/Factory/NodeFactory.h"
+#include "Vision/Factory/NodePluginLoader.h"
 
+#include "Vision/Algorithms/BranchNode.h"
 #include "Vision/Algorithms/CannyEdgeNode.h"
+#include "Vision/Algorithms/CropNode.h"
 #include "Vision/Algorithms/CvtColorNode.h"
+#include "Vision/Algorithms/DrawContoursNode.h"
+#include "Vision/Algorithms/FilterContoursNode.h"
+#include "Vision/Algorithms/FindContoursNode.h"
+#include "Vision/Algorithms/ForEachNode.h"
+#include "Vision/Algorithms/GradientNode.h"
 #include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/Algorithms/ImagePyramidNode.h"
+#include "Vision/Algorithms/MaskLogicNode.h"
 #include "Vision/Algorithms/MedianBlurNode.h"
 #include "Vision/Algorithms/MergeChannelsNode.h"
 #include "Vision/Algorithms/MorphologyNode.h"
@@ -13,106 +23,261 @@
 #include "Vision/IO/ImageInputNode.h"
 #include "Vision/IO/ImageOutputNode.h"
 #include "Vision/IO/PreviewNode.h"
+#include "Vision/IO/SharedMemoryInputNode.h"
+#include "Vision/IO/SharedMemoryOutputNode.h"
+#include "Vision/IO/TiledImageInputNode.h"
+#include "Vision/IO/VideoInputNode.h"
+
+#if VISION_CRAFT_WITH_CUDA
+#include "Vision/Cuda/CudaCannyEdgeNode.h"
+#include "Vision/Cuda/CudaCvtColorNode.h"
+#include "Vision/Cuda/CudaMedianBlurNode.h"
+#include "Vision/Cuda/CudaMorphologyNode.h"
+#include "Vision/Cuda/CudaResizeNode.h"
+#include "Vision/Cuda/CudaSobelNode.h"
+#include "Vision/Cuda/CudaStream.h"
+#include "Vision/Cuda/CudaThresholdNode.h"
+#endif
+
+#include "Logger.h"
 
 #include <algorithm>
+#include <mutex>
 #include <ranges>
 
 namespace VisionCraft::Vision
 {
-    std::unordered_map<std::string, NodeFactory::NodeCreator> &NodeFactory::GetRegistry()
+    namespace
     {
-        static std::unordered_map<std::string, NodeCreator> registry;
+        constexpr std::string_view kCudaPrefix = "Cuda";
+        constexpr std::string_view kTypeSuffix = "Node";
+    } // namespace
+
+    NodeFactory::Registry &NodeFactory::GetRegistry()
+    {
+        static Registry registry;
         return registry;
     }
 
+    std::atomic<NodeBackend> &NodeFactory::GetBackendSetting()
+    {
+        static std::atomic<NodeBackend> backend = NodeBackend::Cpu;
+        return backend;
+    }
+
     void NodeFactory::Register(std::string_view type, NodeCreator creator)
     {
-        GetRegistry()[std::string(type)] = std::move(creator);
+        AddEntry(type, nullptr, std::move(creator));
     }
 
-    std::unique_ptr<Nodes::Node> NodeFactory::CreateNode(std::string_view type, Nodes::NodeId id, std::string_view name)
+    void NodeFactory::AddEntry(std::string_view type, CreateFunction function, NodeCreator creator)
     {
         auto &registry = GetRegistry();
-        if (const auto it = registry.find(std::string(type)); it != registry.end())
+        const auto key = Nodes::NodeTypeRegistry::Intern(type);
+        const auto alias = Nodes::NodeTypeRegistry::Intern(std::string(type) + std::string(kTypeSuffix));
+
+        std::unique_lock lock(registry.mutex);
+        registry.entryByTypeId.resize(std::max<size_t>(registry.entryByTypeId.size(), std::max(key, alias) + 1), -1);
+
+        auto index = registry.entryByTypeId[key];
+        const bool replaced = index >= 0 && registry.entries[index].key == type;
+        if (!replaced)
+        {
+            index = static_cast<int32_t>(registry.entries.size());
+            registry.entries.push_back({ .key = std::string(type) });
+        }
+        auto &entry = registry.entries[index];
+        entry.function = function;
+        entry.creator = std::move(creator);
+        registry.entryByTypeId[key] = index;
+
+        // Saved graphs store Node::GetType() (e.g. "GrayscaleNode"); a key registered under that name wins
+        const auto aliased = registry.entryByTypeId[alias];
+        if (aliased < 0 || registry.entries[aliased].key != Nodes::NodeTypeRegistry::GetName(alias))
+        {
+            registry.entryByTypeId[alias] = index;
+        }
+    }
+
+    const NodeFactory::Entry *NodeFactory::FindEntry(const Registry &registry, Nodes::NodeTypeId type)
+    {
+        if (type < registry.entryByTypeId.size())
         {
-            return it->second(id, name);
+            if (const auto index = registry.entryByTypeId[type]; index >= 0)
+            {
+                return &registry.entries[index];
+            }
+        }
+
+        // Graphs saved with CUDA nodes still load where the CUDA backend is missing
+        const std::string_view name = Nodes::NodeTypeRegistry::GetName(type);
+        if (name.size() > kCudaPrefix.size() && name.starts_with(kCudaPrefix))
+        {
+            return FindEntry(registry, name.substr(kCudaPrefix.size()));
         }
         return nullptr;
     }
 
-    bool NodeFactory::IsRegistered(std::string_view type)
+    const NodeFactory::Entry *NodeFactory::FindEntry(const Registry &registry, std::string_view type)
     {
-        return GetRegistry().contains(std::string(type));
+        if (const auto id = Nodes::NodeTypeRegistry::Find(type); id != Nodes::kNoNodeTypeId)
+        {
+            return FindEntry(registry, id);
+        }
+        if (type.size() > kCudaPrefix.size() && type.starts_with(kCudaPrefix))
+        {
+            return FindEntry(registry, type.substr(kCudaPrefix.size()));
+        }
+        return nullptr;
     }
 
-    std::vector<std::string> NodeFactory::GetRegisteredTypes()
+    const NodeFactory::Entry *NodeFactory::FindOrLoadEntry(std::string_view type)
     {
-        auto &registry = GetRegistry();
-        std::vector<std::string> types;
-        types.reserve(registry.size());
+        const auto &registry = GetRegistry();
+        {
+            std::shared_lock lock(registry.mutex);
+            if (const auto *entry = FindEntry(registry, type))
+            {
+                return entry;
+            }
+        }
 
-        for (const auto &[type, _] : registry)
+        // The pack's entry point registers its types, which takes the registry mutex exclusively
+        if (!NodePluginLoader::LoadFor(type))
         {
-            types.push_back(type);
+            return nullptr;
         }
+        std::shared_lock lock(registry.mutex);
+        return FindEntry(registry, type);
+    }
 
-        std::ranges::sort(types);
-        return types;
+    std::unique_ptr<Nodes::Node> NodeFactory::Create(const Entry &entry, Nodes::NodeId id, std::string_view name)
+    {
+        return entry.function ? entry.function(id, name) : entry.creator(id, name);
     }
 
-    void NodeFactory::RegisterAllNodes()
+    std::unique_ptr<Nodes::Node> NodeFactory::CreateNode(std::string_view type, Nodes::NodeId id, std::string_view name)
     {
-        // Register all available node types with the factory
-        Register("ImageInput", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<IO::ImageInputNode>(id, std::string(name));
-        });
+        // Without a registered CUDA variant, FindEntry() falls back to the CPU node
+        if (GetBackend() == NodeBackend::Cuda && !type.starts_with(kCudaPrefix))
+        {
+            const auto *entry = FindOrLoadEntry(std::string(kCudaPrefix) + std::string(type));
+            return entry ? Create(*entry, id, name) : nullptr;
+        }
 
-        Register("ImageOutput", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<IO::ImageOutputNode>(id, std::string(name));
-        });
+        const auto *entry = FindOrLoadEntry(type);
+        return entry ? Create(*entry, id, name) : nullptr;
+    }
 
-        Register("Preview", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<IO::PreviewNode>(id, std::string(name));
-        });
+    std::unique_ptr<Nodes::Node> NodeFactory::CreateNode(Nodes::NodeTypeId type,
+        Nodes::NodeId id,
+        std::string_view name)
+    {
+        if (GetBackend() == NodeBackend::Cuda)
+        {
+            return CreateNode(Nodes::NodeTypeRegistry::GetName(type), id, name);
+        }
 
-        Register("Grayscale", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::GrayscaleNode>(id, std::string(name));
-        });
+        const Entry *entry = nullptr;
+        {
+            const auto &registry = GetRegistry();
+            std::shared_lock lock(registry.mutex);
+            entry = FindEntry(registry, type);
+        }
+        if (!entry)
+        {
+            entry = FindOrLoadEntry(Nodes::NodeTypeRegistry::GetName(type));
+        }
+        return entry ? Create(*entry, id, name) : nullptr;
+    }
 
-        Register("CannyEdge", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::CannyEdgeNode>(id, std::string(name));
-        });
+    void NodeFactory::SetBackend(NodeBackend backend)
+    {
+#if VISION_CRAFT_WITH_CUDA
+        const bool cudaAvailable = Cuda::IsAvailable();
+#else
+        constexpr bool cudaAvailable = false;
+#endif
+        if (backend == NodeBackend::Cuda && !cudaAvailable)
+        {
+            LOG_WARN("CUDA backend not available (no device, or built without VISION_CRAFT_WITH_CUDA), "
+                     "creating CPU nodes");
+        }
+        GetBackendSetting().store(backend);
+    }
 
-        Register("Threshold", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::ThresholdNode>(id, std::string(name));
-        });
+    NodeBackend NodeFactory::GetBackend()
+    {
+        return GetBackendSetting().load();
+    }
 
-        Register("Sobel", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::SobelNode>(id, std::string(name));
-        });
+    bool NodeFactory::IsRegistered(std::string_view type)
+    {
+        return FindOrLoadEntry(type) != nullptr;
+    }
 
-        Register("MedianBlur", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::MedianBlurNode>(id, std::string(name));
-        });
+    std::vector<std::string> NodeFactory::GetRegisteredTypes()
+    {
+        const auto &registry = GetRegistry();
+        std::shared_lock lock(registry.mutex);
+        std::vector<std::string> types;
+        types.reserve(registry.entries.size());
 
-        Register("Morphology", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::MorphologyNode>(id, std::string(name));
-        });
+        for (const auto &entry : registry.entries)
+        {
+            types.push_back(entry.key);
+        }
 
-        Register("CvtColor", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::CvtColorNode>(id, std::string(name));
-        });
+        std::ranges::sort(types);
+        return types;
+    }
 
-        Register("Resize", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::ResizeNode>(id, std::string(name));
-        });
+    void NodeFactory::RegisterAllNodes()
+    {
+        // Register all available node types with the factory
+        RegisterNode<IO::ImageInputNode>("ImageInput");
+        RegisterNode<IO::ImageOutputNode>("ImageOutput");
+        RegisterNode<IO::PreviewNode>("Preview");
+        RegisterNode<IO::VideoInputNode>("VideoInput");
+        RegisterNode<IO::SharedMemoryInputNode>("SharedMemoryInput");
+        RegisterNode<IO::SharedMemoryOutputNode>("SharedMemoryOutput");
+        RegisterNode<IO::TiledImageInputNode>("TiledImageInput");
+        RegisterNode<Algorithms::GrayscaleNode>("Grayscale");
+        RegisterNode<Algorithms::CannyEdgeNode>("CannyEdge");
+        RegisterNode<Algorithms::ThresholdNode>("Threshold");
+        RegisterNode<Algorithms::SobelNode>("Sobel");
+        RegisterNode<Algorithms::GradientNode>("Gradient");
+        RegisterNode<Algorithms::MedianBlurNode>("MedianBlur");
+        RegisterNode<Algorithms::MorphologyNode>("Morphology");
+        RegisterNode<Algorithms::CvtColorNode>("CvtColor");
+        RegisterNode<Algorithms::ResizeNode>("Resize");
+        RegisterNode<Algorithms::ImagePyramidNode>("ImagePyramid");
+        RegisterNode<Algorithms::CropNode>("Crop");
+        RegisterNode<Algorithms::SplitChannelsNode>("SplitChannels");
+        RegisterNode<Algorithms::MergeChannelsNode>("MergeChannels");
+        RegisterNode<Algorithms::MaskLogicNode>("MaskLogic");
+        RegisterNode<Algorithms::FindContoursNode>("FindContours");
+        RegisterNode<Algorithms::FilterContoursNode>("FilterContours");
+        RegisterNode<Algorithms::DrawContoursNode>("DrawContours");
+        RegisterNode<Algorithms::BranchNode>("Branch");
+        RegisterNode<Algorithms::ForEachNode>("ForEach");
 
-        Register("SplitChannels", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::SplitChannelsNode>(id, std::string(name));
-        });
+#if VISION_CRAFT_WITH_CUDA
+        // Each CUDA node derives from its CPU node and keeps its slots and parameter validation, so graphs can
+        // switch between them; without a device the "Cuda" types resolve to their CPU nodes instead
+        if (Cuda::IsAvailable())
+        {
+            RegisterNode<Cuda::CudaCannyEdgeNode>("CudaCannyEdge");
+            RegisterNode<Cuda::CudaCvtColorNode>("CudaCvtColor");
+            RegisterNode<Cuda::CudaMedianBlurNode>("CudaMedianBlur");
+            RegisterNode<Cuda::CudaMorphologyNode>("CudaMorphology");
+            RegisterNode<Cuda::CudaResizeNode>("CudaResize");
+            RegisterNode<Cuda::CudaSobelNode>("CudaSobel");
+            RegisterNode<Cuda::CudaThresholdNode>("CudaThreshold");
+        }
+#endif
 
-        Register("MergeChannels", [](Nodes::NodeId id, std::string_view name) {
-            return std::make_unique<Algorithms::MergeChannelsNode>(id, std::string(name));
-        });
+        // Plugin packs only declare their types here; each library loads on first use of one of them
+        NodePluginLoader::DiscoverPlugins();
     }
 } // namespace VisionCraft::Vision
@@ -1,13 +1,17 @@
 #pragma once
 
 #include "Nodes/Core/Node.h"
+#include "Nodes/Core/NodeTypeRegistry.h"
 
+#include <atomic>
 #include <concepts>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace VisionCraft::Vision
@@ -23,17 +27,21 @@ namespace VisionCraft::Vision
      *
      * Requirements:
      * - T must be derived from VisionCraft::Nodes::Node
-     * - T must have a valid constructor taking (NodeId, std::string_view)
+     * - T must have a valid constructor taking (NodeId, std::string)
      *
      * Example valid types: ImageInputNode, GrayscaleNode, ThresholdNode
      * Example invalid types: int, std::string, custom classes not derived from Node
      */
     template<typename T>
-    concept NodeType = std::derived_from<T, Nodes::Node> && requires(Nodes::NodeId id, std::string_view name) {
-        // T must be constructible with NodeId and string_view
-        {
-            T(id, name)
-        } -> std::convertible_to<T>;
+    concept NodeType = std::derived_from<T, Nodes::Node> && std::constructible_from<T, Nodes::NodeId, std::string>;
+
+    /**
+     * @brief Implementation family CreateNode() prefers for a node type.
+     */
+    enum class NodeBackend
+    {
+        Cpu, ///< OpenCV on the host
+        Cuda ///< "Cuda" variants where registered (VISION_CRAFT_WITH_CUDA and a device), CPU nodes otherwise
     };
 
     /**
@@ -41,6 +49,15 @@ namespace VisionCraft::Vision
      *
      * This class follows the Open/Closed Principle - new node types can be added
      * without modifying existing code by registering them with the factory.
+     *
+     * The registry is flat: entries live in one vector, and a table indexed by Nodes::NodeTypeId maps both
+     * the registry key ("Grayscale") and the matching Node::GetType() value ("GrayscaleNode") to an entry.
+     * Lookups by string intern nothing and allocate nothing; CreateNode() by type ID is a table index.
+     * Types registered with RegisterNode<T>() are created through a plain function pointer.
+     *
+     * Types a plugin manifest declares are registered on first use: a lookup that misses asks
+     * NodePluginLoader to load the pack declaring the type, then looks again. Registration and lookup are
+     * thread-safe, since a pack may load on any thread that creates a node.
      */
     class NodeFactory
     {
@@ -53,6 +70,11 @@ namespace VisionCraft::Vision
          */
         using NodeCreator = std::function<std::unique_ptr<Nodes::Node>(Nodes::NodeId id, std::string_view name)>;
 
+        /**
+         * @brief Creator of a type registered with RegisterNode<T>().
+         */
+        using CreateFunction = std::unique_ptr<Nodes::Node> (*)(Nodes::NodeId id, std::string_view name);
+
         /**
          * @brief Registers a node type with the factory.
          * @param type Node type identifier
@@ -78,40 +100,139 @@ namespace VisionCraft::Vision
          */
         template<NodeType T> static void RegisterNode(std::string_view type)
         {
-            Register(type,
-                [](Nodes::NodeId id, std::string_view name) { return std::make_unique<T>(id, std::string(name)); });
+            AddEntry(type, &CreateAs<T>, nullptr);
         }
 
         /**
          * @brief Creates a node of the specified type.
-         * @param type Node type identifier
+         * @param type Node type identifier (registry key, or Node::GetType() value such as "GrayscaleNode")
          * @param id Node ID
          * @param name Node display name
          * @return Unique pointer to created node, or nullptr if type not found
+         * @note With the CUDA backend, the "Cuda" variant of type is created when one is registered.
          */
         [[nodiscard]] static std::unique_ptr<Nodes::Node>
             CreateNode(std::string_view type, Nodes::NodeId id, std::string_view name);
 
+        /**
+         * @brief Creates a node of an interned type, without looking up any string.
+         * @param type Interned registry key or Node::GetType() value (e.g. another node's GetTypeId())
+         * @param id Node ID
+         * @param name Node display name
+         * @return Unique pointer to created node, or nullptr if type not found
+         * @note With the CUDA backend this resolves the "Cuda" variant by name, like the string overload.
+         */
+        [[nodiscard]] static std::unique_ptr<Nodes::Node>
+            CreateNode(Nodes::NodeTypeId type, Nodes::NodeId id, std::string_view name);
+
+        /**
+         * @brief Selects the backend for nodes created from now on (e.g. while loading a graph).
+         * @param backend Preferred implementation family
+         * @note Types that already name a backend, such as "CudaSobelNode", are created as named.
+         */
+        static void SetBackend(NodeBackend backend);
+
+        /**
+         * @brief Returns the preferred backend.
+         * @return Backend used by CreateNode()
+         */
+        [[nodiscard]] static NodeBackend GetBackend();
+
         /**
          * @brief Checks if a node type is registered.
          * @param type Node type identifier
          * @return True if type is registered
+         * @note A type only a plugin manifest declares loads its pack here, so true means CreateNode() works.
          */
         [[nodiscard]] static bool IsRegistered(std::string_view type);
 
         /**
          * @brief Returns all registered node types.
          * @return Vector of registered type names
+         * @note Types of plugin packs not loaded yet are listed by NodePluginLoader::GetDeclaredTypes().
          */
         [[nodiscard]] static std::vector<std::string> GetRegisteredTypes();
 
         /**
-         * @brief Registers all available node types.
+         * @brief Registers all available node types and declares the packs of the default plugin directories.
          * @note This must be called before using the factory.
          */
         static void RegisterAllNodes();
 
     private:
-        static std::unordered_map<std::string, NodeCreator> &GetRegistry();
+        /**
+         * @brief A registered node type.
+         */
+        struct Entry
+        {
+            std::string key;                   ///< Registry key
+            CreateFunction function = nullptr; ///< Creator from RegisterNode<T>()
+            NodeCreator creator;               ///< Creator from Register(), if function is not set
+        };
+
+        /**
+         * @brief Registered types and their lookup table.
+         */
+        struct Registry
+        {
+            std::deque<Entry> entries;          ///< In registration order (stable addresses)
+            std::vector<int32_t> entryByTypeId; ///< Entry index by Nodes::NodeTypeId (-1 = none)
+            mutable std::shared_mutex mutex;    ///< Exclusive for registration, shared for lookups
+        };
+
+        static Registry &GetRegistry();
+        static std::atomic<NodeBackend> &GetBackendSetting();
+
+        /**
+         * @brief Creates a T; the function RegisterNode<T>() registers.
+         * @param id Node ID
+         * @param name Node display name
+         * @return New node
+         */
+        template<NodeType T> static std::unique_ptr<Nodes::Node> CreateAs(Nodes::NodeId id, std::string_view name)
+        {
+            return std::make_unique<T>(id, std::string(name));
+        }
+
+        /**
+         * @brief Adds or replaces the entry of a registry key and maps its type IDs to it.
+         * @param type Registry key; "<type>Node" (the Node::GetType() convention) is mapped too
+         * @param function Creator function, or nullptr to use creator
+         * @param creator Creator used when function is nullptr
+         */
+        static void AddEntry(std::string_view type, CreateFunction function, NodeCreator creator);
+
+        /**
+         * @brief Looks up an entry by interned registry key or Node::GetType() value.
+         * @param registry Registry, with its mutex held
+         * @param type Type ID; unregistered "Cuda" variants resolve to their CPU node
+         * @return Entry, or nullptr if type not found
+         */
+        [[nodiscard]] static const Entry *FindEntry(const Registry &registry, Nodes::NodeTypeId type);
+
+        /**
+         * @brief Looks up an entry by registry key or by Node::GetType() value.
+         * @param registry Registry, with its mutex held
+         * @param type Node type identifier; unregistered "Cuda" variants resolve to their CPU node
+         * @return Entry, or nullptr if type not found
+         */
+        [[nodiscard]] static const Entry *FindEntry(const Registry &registry, std::string_view type);
+
+        /**
+         * @brief Looks up an entry, loading the plugin pack that declares the type if it is not registered.
+         * @param type Node type identifier
+         * @return Entry, or nullptr if neither the registry nor a pack has the type
+         */
+        [[nodiscard]] static const Entry *FindOrLoadEntry(std::string_view type);
+
+        /**
+         * @brief Runs an entry's creator.
+         * @param entry Entry to create from
+         * @param id Node ID
+         * @param name Node display name
+         * @return Created node
+         */
+        [[nodiscard]] static std::unique_ptr<Nodes::Node>
+            Create(const Entry &entry, Nodes::NodeId id, std::string_view name);
     };
 } // namespace VisionCraft::Vision
@@ -0,0 +1,306 @@
+#include "Vision/Factory/NodePluginLoader.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <nlohmann/json.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace VisionCraft::Vision
+{
+    namespace
+    {
+        constexpr std::string_view kCudaPrefix = "Cuda";
+        constexpr std::string_view kTypeSuffix = "Node";
+
+#if defined(_WIN32)
+        constexpr char kPathSeparator = ';';
+#else
+        constexpr char kPathSeparator = ':';
+#endif
+
+        using EntryPoint = bool (*)(int hostApiVersion);
+
+        /**
+         * @brief A declared pack and its load state.
+         */
+        struct Pack
+        {
+            NodePluginManifest manifest; ///< Manifest it was declared from
+            std::once_flag loadOnce;     ///< Guards the one load attempt
+            bool loaded = false;         ///< Entry point ran and succeeded (written under loadOnce)
+            std::future<void> prefetch;  ///< Background load started by Prefetch() (under PluginTable::mutex)
+        };
+
+        /**
+         * @brief Declared packs and the type lookup.
+         */
+        struct PluginTable
+        {
+            std::mutex mutex;                                   ///< Guards packs and packByType
+            std::deque<Pack> packs;                             ///< Declared packs (stable addresses)
+            std::unordered_map<std::string, Pack *> packByType; ///< Type ID and its "<type>Node" alias to pack
+        };
+
+        PluginTable &GetTable()
+        {
+            static PluginTable table;
+            return table;
+        }
+
+        Pack *FindPack(std::string_view type)
+        {
+            auto &table = GetTable();
+            std::scoped_lock lock(table.mutex);
+            if (const auto it = table.packByType.find(std::string(type)); it != table.packByType.end())
+            {
+                return it->second;
+            }
+            // Mirrors NodeFactory, which falls back from a missing "Cuda" variant to the CPU node
+            if (type.size() > kCudaPrefix.size() && type.starts_with(kCudaPrefix))
+            {
+                const auto it = table.packByType.find(std::string(type.substr(kCudaPrefix.size())));
+                return it != table.packByType.end() ? it->second : nullptr;
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Opens a pack's library and runs its entry point.
+         * @param manifest Pack to load
+         * @return True if the entry point registered the pack's types
+         */
+        bool OpenLibrary(const NodePluginManifest &manifest)
+        {
+#if defined(_WIN32)
+            HMODULE library = LoadLibraryW(manifest.library.c_str());
+            if (!library)
+            {
+                LOG_ERROR("Node plugin '{}': cannot load {} (error {})",
+                    manifest.name,
+                    manifest.library.string(),
+                    GetLastError());
+                return false;
+            }
+            const auto entryPoint =
+                reinterpret_cast<EntryPoint>(reinterpret_cast<void *>(GetProcAddress(library, kNodePluginEntryPoint)));
+#else
+            void *library = dlopen(manifest.library.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if (!library)
+            {
+                LOG_ERROR("Node plugin '{}': cannot load {} ({})", manifest.name, manifest.library.string(), dlerror());
+                return false;
+            }
+            const auto entryPoint = reinterpret_cast<EntryPoint>(dlsym(library, kNodePluginEntryPoint));
+#endif
+            // The library stays open even on failure: its static constructors may have registered state already
+            if (!entryPoint)
+            {
+                LOG_ERROR("Node plugin '{}': {} does not export {}",
+                    manifest.name,
+                    manifest.library.string(),
+                    kNodePluginEntryPoint);
+                return false;
+            }
+            if (!entryPoint(kNodePluginApiVersion))
+            {
+                LOG_ERROR("Node plugin '{}' refused plugin interface version {}", manifest.name, kNodePluginApiVersion);
+                return false;
+            }
+
+            LOG_INFO("Loaded node plugin '{}' ({} types)", manifest.name, manifest.types.size());
+            return true;
+        }
+
+        bool Load(Pack &pack)
+        {
+            std::call_once(pack.loadOnce, [&pack]() { pack.loaded = OpenLibrary(pack.manifest); });
+            return pack.loaded;
+        }
+    } // namespace
+
+    std::optional<NodePluginManifest> NodePluginLoader::ReadManifest(const std::filesystem::path &path,
+        std::string &error)
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            error = "cannot open " + path.string();
+            return std::nullopt;
+        }
+
+        const auto json = nlohmann::json::parse(file, nullptr, false);
+        if (json.is_discarded() || !json.is_object())
+        {
+            error = path.string() + " is not a JSON object";
+            return std::nullopt;
+        }
+
+        const auto library = json.find("library");
+        const auto nodes = json.find("nodes");
+        if (library == json.end() || !library->is_string() || nodes == json.end() || !nodes->is_array())
+        {
+            error = path.string() + " needs a \"library\" string and a \"nodes\" array";
+            return std::nullopt;
+        }
+
+        NodePluginManifest manifest;
+        manifest.name = json.value("name", path.stem().string());
+        manifest.library = library->get<std::string>();
+        if (manifest.library.is_relative())
+        {
+            manifest.library = path.parent_path() / manifest.library;
+        }
+
+        for (const auto &node : *nodes)
+        {
+            const auto type = node.is_object() ? node.find("type") : node.end();
+            if (type == node.end() || !type->is_string() || type->get_ref<const std::string &>().empty())
+            {
+                error = path.string() + ": every node needs a \"type\" string";
+                return std::nullopt;
+            }
+            auto &declared = manifest.types.emplace_back();
+            declared.typeId = type->get<std::string>();
+            declared.displayName = node.value("displayName", declared.typeId);
+            declared.category = node.value("category", manifest.name);
+        }
+        return manifest;
+    }
+
+    bool NodePluginLoader::AddManifest(NodePluginManifest manifest)
+    {
+        if (manifest.types.empty())
+        {
+            return false;
+        }
+
+        auto &table = GetTable();
+        std::scoped_lock lock(table.mutex);
+        auto &pack = table.packs.emplace_back();
+        pack.manifest = std::move(manifest);
+        for (const auto &type : pack.manifest.types)
+        {
+            // Saved graphs name nodes by Node::GetType(), conventionally the type ID plus "Node"
+            for (auto name : { type.typeId, type.typeId + std::string(kTypeSuffix) })
+            {
+                const auto [it, inserted] = table.packByType.try_emplace(std::move(name), &pack);
+                if (!inserted && it->second != &pack)
+                {
+                    LOG_WARN("Node plugin '{}': type {} is declared by '{}' already",
+                        pack.manifest.name,
+                        it->first,
+                        it->second->manifest.name);
+                }
+            }
+        }
+        return true;
+    }
+
+    size_t NodePluginLoader::AddManifestDirectory(const std::filesystem::path &directory)
+    {
+        std::error_code ec;
+        if (!std::filesystem::is_directory(directory, ec))
+        {
+            return 0;
+        }
+
+        size_t added = 0;
+        for (const auto &file : std::filesystem::directory_iterator(directory, ec))
+        {
+            if (file.path().extension() != Constants::Plugins::kManifestExtension)
+            {
+                continue;
+            }
+
+            std::string error;
+            auto manifest = ReadManifest(file.path(), error);
+            if (!manifest)
+            {
+                LOG_WARN("Skipping node plugin manifest: {}", error);
+                continue;
+            }
+            added += AddManifest(std::move(*manifest)) ? 1 : 0;
+        }
+        return added;
+    }
+
+    void NodePluginLoader::DiscoverPlugins()
+    {
+        static std::once_flag discovered;
+        std::call_once(discovered, []() {
+            if (const char *paths = std::getenv(Constants::Plugins::kPathVariable))
+            {
+                std::string_view remaining = paths;
+                while (!remaining.empty())
+                {
+                    const auto separator = remaining.find(kPathSeparator);
+                    if (const auto directory = remaining.substr(0, separator); !directory.empty())
+                    {
+                        AddManifestDirectory(std::filesystem::path(directory));
+                    }
+                    remaining =
+                        separator == std::string_view::npos ? std::string_view{} : remaining.substr(separator + 1);
+                }
+            }
+            AddManifestDirectory(Constants::Plugins::kDirectoryName);
+        });
+    }
+
+    bool NodePluginLoader::LoadFor(std::string_view type)
+    {
+        auto *pack = FindPack(type);
+        return pack && Load(*pack);
+    }
+
+    void NodePluginLoader::Prefetch(std::string_view type)
+    {
+        auto *pack = FindPack(type);
+        if (!pack)
+        {
+            return;
+        }
+
+        auto &table = GetTable();
+        std::scoped_lock lock(table.mutex);
+        if (!pack->prefetch.valid())
+        {
+            pack->prefetch = std::async(std::launch::async, [pack]() { Load(*pack); });
+        }
+    }
+
+    bool NodePluginLoader::Declares(std::string_view type)
+    {
+        return FindPack(type) != nullptr;
+    }
+
+    std::vector<NodePluginType> NodePluginLoader::GetDeclaredTypes()
+    {
+        auto &table = GetTable();
+        std::scoped_lock lock(table.mutex);
+        std::vector<NodePluginType> types;
+        for (const auto &pack : table.packs)
+        {
+            types.insert(types.end(), pack.manifest.types.begin(), pack.manifest.types.end());
+        }
+        return types;
+    }
+} // namespace VisionCraft::Vision
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Exports a plugin pack's entry point from its shared library.
+ *
+ * @code
+ * VISION_CRAFT_NODE_PLUGIN(hostApiVersion)
+ * {
+ *     if (hostApiVersion != VisionCraft::Vision::kNodePluginApiVersion)
+ *         return false;
+ *     VisionCraft::Vision::NodeFactory::RegisterNode<AcmeDetectNode>("AcmeDetect");
+ *     return true;
+ * }
+ * @endcode
+ */
+#if defined(_WIN32)
+#define VISION_CRAFT_NODE_PLUGIN(hostApiVersion)                                                                      \
+    extern "C" __declspec(dllexport) bool VisionCraftRegisterNodes(int hostApiVersion)
+#else
+#define VISION_CRAFT_NODE_PLUGIN(hostApiVersion)                                                                      \
+    extern "C" __attribute__((visibility("default"))) bool VisionCraftRegisterNodes(int hostApiVersion)
+#endif
+
+namespace VisionCraft::Vision
+{
+    /// @brief Plugin interface version passed to a pack's entry point; packs refuse versions they were not built for
+    inline constexpr int kNodePluginApiVersion = 1;
+
+    /// @brief Symbol VISION_CRAFT_NODE_PLUGIN() exports
+    inline constexpr const char *kNodePluginEntryPoint = "VisionCraftRegisterNodes";
+
+    /**
+     * @brief Node type a plugin pack declares in its manifest.
+     */
+    struct NodePluginType
+    {
+        std::string typeId;      ///< Factory type ID the pack registers (e.g., "AcmeDetect")
+        std::string displayName; ///< User-facing name for menus and the search palette
+        std::string category;    ///< Menu category
+    };
+
+    /**
+     * @brief Contents of a plugin manifest (a JSON file with the Constants::Plugins::kManifestExtension extension).
+     *
+     * @code
+     * {
+     *     "name": "Acme Vision",
+     *     "library": "libacme_nodes.so",
+     *     "nodes": [ { "type": "AcmeDetect", "displayName": "Acme Detect", "category": "Acme" } ]
+     * }
+     * @endcode
+     */
+    struct NodePluginManifest
+    {
+        std::string name;                  ///< Pack name for log messages
+        std::filesystem::path library;     ///< Shared library (relative paths are against the manifest's directory)
+        std::vector<NodePluginType> types; ///< Node types the library registers
+    };
+
+    /**
+     * @brief Loads node plugin packs, shared libraries that register node types with NodeFactory, on first use.
+     *
+     * Startup only reads manifests: the declared types go to menus and the search palette, and the library
+     * stays closed. NodeFactory asks LoadFor() when it is asked for a type it does not know, so the first
+     * CreateNode() or IsRegistered() of a declared type (from a menu, the palette or a graph being loaded)
+     * opens the library and calls its VISION_CRAFT_NODE_PLUGIN() entry point. Prefetch() starts that load on a
+     * background thread, for a palette result the user is about to pick.
+     *
+     * Packs call NodeFactory and link against the host's Nodes and Vision symbols, so the executables export
+     * them. Libraries are never unloaded: nodes created from them may live until exit.
+     *
+     * All methods are thread-safe. A pack is loaded at most once; a failed load is not retried.
+     */
+    class NodePluginLoader
+    {
+    public:
+        /**
+         * @brief Reads a plugin manifest.
+         * @param path Manifest file
+         * @param error Set to the reason on failure
+         * @return Manifest with library made absolute, or std::nullopt if it could not be read
+         */
+        [[nodiscard]] static std::optional<NodePluginManifest> ReadManifest(const std::filesystem::path &path,
+            std::string &error);
+
+        /**
+         * @brief Declares a pack's types without loading its library.
+         * @param manifest Pack manifest
+         * @return False if the manifest declares no types; types another pack declared already stay with it
+         */
+        static bool AddManifest(NodePluginManifest manifest);
+
+        /**
+         * @brief Declares the packs of every manifest in a directory (not recursive).
+         * @param directory Directory to scan; a missing directory is skipped
+         * @return Number of packs declared
+         */
+        static size_t AddManifestDirectory(const std::filesystem::path &directory);
+
+        /**
+         * @brief Declares the packs of the default plugin directories.
+         *
+         * Scans the directories listed in the Constants::Plugins::kPathVariable environment variable, then
+         * Constants::Plugins::kDirectoryName below the working directory. Runs once per process.
+         */
+        static void DiscoverPlugins();
+
+        /**
+         * @brief Loads the pack declaring a type, unless it was loaded (or failed to load) already.
+         * @param type Factory type ID, Node::GetType() value or "Cuda" variant of a declared type
+         * @return True if the pack is loaded
+         */
+        static bool LoadFor(std::string_view type);
+
+        /**
+         * @brief Starts loading the pack declaring a type on a background thread.
+         * @param type Factory type ID; undeclared types and loaded packs are ignored
+         */
+        static void Prefetch(std::string_view type);
+
+        /**
+         * @brief Checks whether a pack declares a type.
+         * @param type Factory type ID, Node::GetType() value or "Cuda" variant of a declared type
+         * @return True if a manifest declared it
+         */
+        [[nodiscard]] static bool Declares(std::string_view type);
+
+        /**
+         * @brief Returns the types of every declared pack, loaded or not.
+         * @return Declared types in declaration order
+         */
+        [[nodiscard]] static std::vector<NodePluginType> GetDeclaredTypes();
+    };
+} // namespace VisionCraft::Vision
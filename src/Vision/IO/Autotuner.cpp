@@ -0,0 +1,436 @@
+#include "Vision/IO/Autotuner.h"
+#include "Logger.h"
+#include "Nodes/Core/ThreadBudget.h"
+
+#include <nlohmann/json.hpp>
+#include <opencv2/core/ocl.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr int kProfileVersion = 1;
+
+        /**
+         * @brief Medians of one candidate's timed runs.
+         */
+        struct Measurement
+        {
+            std::chrono::microseconds total{ 0 };               ///< Median wall-clock time of a run
+            std::unordered_map<std::string, int64_t> typeTimes; ///< Summed median Process() microseconds per type
+        };
+
+        int64_t Median(std::vector<int64_t> values)
+        {
+            if (values.empty())
+            {
+                return 0;
+            }
+            const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+            std::ranges::nth_element(values, middle);
+            return *middle;
+        }
+
+        // One untimed run first: a changed setting recompiles the plan, and OpenCL compiles its kernels
+        std::optional<Measurement> Measure(Nodes::NodeEditor &editor, size_t runs, std::string &error)
+        {
+            std::vector<int64_t> totals;
+            std::unordered_map<Nodes::NodeId, std::pair<std::string, std::vector<int64_t>>> nodeTimes;
+            for (size_t run = 0; run <= std::max<size_t>(runs, 1); ++run)
+            {
+                editor.MarkAllNodesDirty();
+                const bool executed = editor.Execute();
+                const auto statistics = editor.GetExecutionStatistics().GetLatest();
+                if (statistics && statistics->writesFlushed.valid())
+                {
+                    statistics->writesFlushed.wait();
+                }
+                if (!executed || !statistics)
+                {
+                    error = "A run of the graph failed";
+                    return std::nullopt;
+                }
+                if (run == 0)
+                {
+                    continue;
+                }
+
+                totals.push_back(statistics->totalTime.count());
+                for (const auto &record : statistics->nodes)
+                {
+                    if (record.outcome == Nodes::StepOutcome::Processed)
+                    {
+                        auto &[type, times] = nodeTimes[record.nodeId];
+                        type = record.nodeType;
+                        times.push_back(record.duration.count());
+                    }
+                }
+            }
+
+            Measurement measurement;
+            measurement.total = std::chrono::microseconds{ Median(std::move(totals)) };
+            for (auto &[id, samples] : nodeTimes)
+            {
+                measurement.typeTimes[samples.first] += Median(std::move(samples.second));
+            }
+            return measurement;
+        }
+
+        // Powers of two below the core count, then the core count itself
+        std::vector<size_t> PowersUpTo(size_t cores)
+        {
+            std::vector<size_t> counts;
+            for (size_t count = 1; count < cores; count *= 2)
+            {
+                counts.push_back(count);
+            }
+            counts.push_back(cores);
+            return counts;
+        }
+
+        bool SameSettings(const TuningProfile &a, const TuningProfile &b)
+        {
+            return a.workerCount == b.workerCount && a.openCvThreads == b.openCvThreads && a.tiling == b.tiling
+                   && a.deviceExecution == b.deviceExecution && a.hostOnlyNodeTypes == b.hostOnlyNodeTypes;
+        }
+
+        bool IsFaster(const Measurement &candidate, const Measurement &best, double minimumGain)
+        {
+            return static_cast<double>(candidate.total.count())
+                   < static_cast<double>(best.total.count()) * (1.0 - minimumGain);
+        }
+
+        int64_t TypeTime(const Measurement &measurement, const std::string &type)
+        {
+            const auto found = measurement.typeTimes.find(type);
+            return found != measurement.typeTimes.end() ? found->second : 0;
+        }
+    } // namespace
+
+    std::optional<TuningProfile> Autotuner::Tune(Nodes::NodeEditor &editor,
+        const AutotuneOptions &options,
+        std::string &error,
+        const AutotuneProgressCallback &progress,
+        std::stop_token stopToken)
+    {
+        const auto original = Capture(editor);
+        const bool cacheEnabled = editor.IsOutputCacheEnabled();
+        editor.SetOutputCacheEnabled(false);
+        const auto fail = [&] {
+            Apply(original, editor);
+            editor.SetOutputCacheEnabled(cacheEnabled);
+            return std::optional<TuningProfile>{};
+        };
+
+        const size_t maxCores = Nodes::ThreadBudget::Get().GetMaxCores();
+        const size_t cores = maxCores != 0 ? maxCores : std::max(1u, std::thread::hardware_concurrency());
+        const auto workerCounts = PowersUpTo(cores);
+        auto openCvThreads = PowersUpTo(cores);
+        openCvThreads.back() = 0; // No cap gives every task its full share
+
+        std::vector<std::string> deviceTypes;
+        for (const auto id : editor.GetNodeIds())
+        {
+            const auto *node = editor.GetNode(id);
+            if (node && node->SupportsDeviceImages())
+            {
+                deviceTypes.push_back(node->GetType());
+            }
+        }
+        std::ranges::sort(deviceTypes);
+        deviceTypes.erase(std::ranges::unique(deviceTypes).begin(), deviceTypes.end());
+        const bool tuneDevice = options.tuneDevice && !deviceTypes.empty() && cv::ocl::haveOpenCL();
+
+        const size_t planned = 1 + workerCounts.size() + openCvThreads.size() + 1
+                               + std::size(Constants::Autotune::kTileSizes) + 2 + (tuneDevice ? 3 : 0);
+        size_t done = 0;
+        const auto measure = [&](const TuningProfile &candidate, const std::string &description) {
+            if (stopToken.stop_requested())
+            {
+                error = "Tuning was stopped";
+                return std::optional<Measurement>{};
+            }
+            if (progress)
+            {
+                progress(done, planned, description);
+            }
+            ++done;
+            Apply(candidate, editor);
+            return Measure(editor, options.runs, error);
+        };
+
+        TuningProfile best = original;
+        auto bestMeasurement = measure(best, "current settings");
+        if (!bestMeasurement)
+        {
+            return fail();
+        }
+        const auto baselineTime = bestMeasurement->total;
+
+        // Keeps a faster candidate; false only when its run failed or tuning was stopped
+        const auto consider = [&](const TuningProfile &candidate, const std::string &description) {
+            if (SameSettings(candidate, best))
+            {
+                return true;
+            }
+            auto measurement = measure(candidate, description);
+            if (!measurement)
+            {
+                return false;
+            }
+            if (IsFaster(*measurement, *bestMeasurement, options.minimumGain))
+            {
+                best = candidate;
+                bestMeasurement = std::move(measurement);
+            }
+            return true;
+        };
+
+        for (const auto count : workerCounts)
+        {
+            auto candidate = best;
+            candidate.workerCount = count;
+            if (!consider(candidate, std::to_string(count) + " workers"))
+            {
+                return fail();
+            }
+        }
+
+        for (const auto threads : openCvThreads)
+        {
+            auto candidate = best;
+            candidate.openCvThreads = threads;
+            const auto description =
+                threads == 0 ? std::string("full OpenCV share") : std::to_string(threads) + " OpenCV threads per task";
+            if (!consider(candidate, description))
+            {
+                return fail();
+            }
+        }
+
+        auto untiled = best;
+        untiled.tiling.enabled = false;
+        if (!consider(untiled, "no tiling"))
+        {
+            return fail();
+        }
+        for (const int tileSize : Constants::Autotune::kTileSizes)
+        {
+            auto candidate = best;
+            candidate.tiling.enabled = true;
+            candidate.tiling.tileSize = tileSize;
+            if (!consider(candidate, std::to_string(tileSize) + " pixel tiles"))
+            {
+                return fail();
+            }
+        }
+
+        for (const bool fuse : { true, false })
+        {
+            auto candidate = best;
+            candidate.tiling.fusePointwise = fuse;
+            if (!consider(candidate, fuse ? "pointwise fusion" : "no pointwise fusion"))
+            {
+                return fail();
+            }
+        }
+
+        // The device as a whole first; types whose kernels lost to the CPU there then go back to it
+        if (tuneDevice)
+        {
+            auto host = best;
+            host.deviceExecution = false;
+            host.hostOnlyNodeTypes.clear();
+            auto device = host;
+            device.deviceExecution = true;
+
+            const auto hostMeasurement = SameSettings(host, best) ? bestMeasurement : measure(host, "CPU execution");
+            const auto deviceMeasurement =
+                SameSettings(device, best) ? bestMeasurement : measure(device, "OpenCL device execution");
+            if (!hostMeasurement || !deviceMeasurement)
+            {
+                return fail();
+            }
+            for (const auto &[candidate, measurement] : { std::pair{ &host, &*hostMeasurement },
+                     std::pair{ &device, &*deviceMeasurement } })
+            {
+                if (!SameSettings(*candidate, best) && IsFaster(*measurement, *bestMeasurement, options.minimumGain))
+                {
+                    best = *candidate;
+                    bestMeasurement = *measurement;
+                }
+            }
+
+            auto mixed = device;
+            for (const auto &type : deviceTypes)
+            {
+                if (TypeTime(*deviceMeasurement, type) > TypeTime(*hostMeasurement, type))
+                {
+                    mixed.hostOnlyNodeTypes.push_back(type);
+                }
+            }
+            if (!mixed.hostOnlyNodeTypes.empty() && mixed.hostOnlyNodeTypes.size() < deviceTypes.size()
+                && !consider(mixed,
+                    "OpenCL for " + std::to_string(deviceTypes.size() - mixed.hostOnlyNodeTypes.size()) + " of "
+                        + std::to_string(deviceTypes.size()) + " node types"))
+            {
+                return fail();
+            }
+        }
+
+        best.hardwareThreads = std::thread::hardware_concurrency();
+        best.baselineTime = baselineTime;
+        best.tunedTime = bestMeasurement->total;
+        Apply(best, editor);
+        editor.SetOutputCacheEnabled(cacheEnabled);
+        LOG_INFO("Tuned execution settings over {} candidates: {} us -> {} us",
+            done,
+            best.baselineTime.count(),
+            best.tunedTime.count());
+        return best;
+    }
+
+    TuningProfile Autotuner::Capture(Nodes::NodeEditor &editor)
+    {
+        TuningProfile profile;
+        profile.workerCount = editor.GetExecutorService().GetWorkerCount();
+        profile.openCvThreads = Nodes::ThreadBudget::Get().GetMaxOpenCvThreads();
+        profile.tiling = editor.GetTilingOptions();
+        profile.deviceExecution = editor.IsDeviceExecutionEnabled();
+        profile.hostOnlyNodeTypes = editor.GetHostOnlyNodeTypes();
+        profile.hardwareThreads = std::thread::hardware_concurrency();
+        return profile;
+    }
+
+    void Autotuner::Apply(const TuningProfile &profile, Nodes::NodeEditor &editor)
+    {
+        editor.SetWorkerCount(profile.workerCount);
+        Nodes::ThreadBudget::Get().SetMaxOpenCvThreads(profile.openCvThreads);
+        editor.SetTilingOptions(profile.tiling);
+        editor.SetDeviceExecution(profile.deviceExecution);
+        editor.SetHostOnlyNodeTypes(profile.hostOnlyNodeTypes);
+    }
+
+    bool Autotuner::SaveProfile(const TuningProfile &profile, const std::filesystem::path &path, std::string &error)
+    {
+        std::error_code fileError;
+        if (path.has_parent_path())
+        {
+            std::filesystem::create_directories(path.parent_path(), fileError);
+            if (fileError)
+            {
+                error = "Cannot create '" + path.parent_path().string() + "': " + fileError.message();
+                return false;
+            }
+        }
+
+        const nlohmann::json json = { { "version", kProfileVersion },
+            { "hardwareThreads", profile.hardwareThreads },
+            { "graph", profile.graphName },
+            { "workerCount", profile.workerCount },
+            { "openCvThreads", profile.openCvThreads },
+            { "tiling",
+                { { "enabled", profile.tiling.enabled },
+                    { "tileSize", profile.tiling.tileSize },
+                    { "minImagePixels", profile.tiling.minImagePixels },
+                    { "fusePointwise", profile.tiling.fusePointwise },
+                    { "propagateRegions", profile.tiling.propagateRegions } } },
+            { "deviceExecution", profile.deviceExecution },
+            { "hostOnlyNodeTypes", profile.hostOnlyNodeTypes },
+            { "baselineMicroseconds", profile.baselineTime.count() },
+            { "tunedMicroseconds", profile.tunedTime.count() } };
+
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if (!stream || !(stream << json.dump(2)) || !stream.flush())
+        {
+            error = "Cannot write '" + path.string() + "'";
+            return false;
+        }
+        return true;
+    }
+
+    std::optional<TuningProfile> Autotuner::LoadProfile(const std::filesystem::path &path, std::string &error)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            error = "Cannot read '" + path.string() + "'";
+            return std::nullopt;
+        }
+        const auto json = nlohmann::json::parse(stream, nullptr, false);
+        if (json.is_discarded() || !json.is_object() || json.value("version", 0) != kProfileVersion)
+        {
+            error = "'" + path.string() + "' is not a tuning profile";
+            return std::nullopt;
+        }
+
+        try
+        {
+            TuningProfile profile;
+            const Nodes::TilingOptions defaults;
+            const auto tiling = json.value("tiling", nlohmann::json::object());
+            profile.workerCount = json.value("workerCount", size_t{ 0 });
+            profile.openCvThreads = json.value("openCvThreads", size_t{ 0 });
+            profile.tiling.enabled = tiling.value("enabled", defaults.enabled);
+            profile.tiling.tileSize = std::max(1, tiling.value("tileSize", defaults.tileSize));
+            profile.tiling.minImagePixels = tiling.value("minImagePixels", defaults.minImagePixels);
+            profile.tiling.fusePointwise = tiling.value("fusePointwise", defaults.fusePointwise);
+            profile.tiling.propagateRegions = tiling.value("propagateRegions", defaults.propagateRegions);
+            profile.deviceExecution = json.value("deviceExecution", false);
+            profile.hostOnlyNodeTypes = json.value("hostOnlyNodeTypes", std::vector<std::string>{});
+            profile.hardwareThreads = json.value("hardwareThreads", size_t{ 0 });
+            profile.graphName = json.value("graph", std::string{});
+            profile.baselineTime = std::chrono::microseconds{ json.value("baselineMicroseconds", int64_t{ 0 }) };
+            profile.tunedTime = std::chrono::microseconds{ json.value("tunedMicroseconds", int64_t{ 0 }) };
+
+            if (profile.hardwareThreads != std::thread::hardware_concurrency())
+            {
+                LOG_WARN("Tuning profile '{}' was measured on a machine with {} hardware threads, this one has {}",
+                    path.string(),
+                    profile.hardwareThreads,
+                    std::thread::hardware_concurrency());
+            }
+            return profile;
+        }
+        catch (const nlohmann::json::exception &exception)
+        {
+            error = "Invalid tuning profile '" + path.string() + "': " + exception.what();
+            return std::nullopt;
+        }
+    }
+
+    std::filesystem::path Autotuner::GetDefaultProfilePath()
+    {
+        std::filesystem::path directory;
+#if defined(_WIN32)
+        if (const char *appData = std::getenv("APPDATA"); appData && *appData)
+        {
+            directory = appData;
+        }
+#else
+        if (const char *configHome = std::getenv("XDG_CONFIG_HOME"); configHome && *configHome)
+        {
+            directory = configHome;
+        }
+        else if (const char *home = std::getenv("HOME"); home && *home)
+        {
+            directory = std::filesystem::path(home) / ".config";
+        }
+#endif
+        if (directory.empty())
+        {
+            return {};
+        }
+        return directory / Constants::Autotune::kConfigDirectory / Constants::Autotune::kProfileFile;
+    }
+
+} // namespace VisionCraft::Vision::IO
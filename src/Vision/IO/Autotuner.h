@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Execution settings that ran a graph fastest on one machine.
+     */
+    struct TuningProfile
+    {
+        size_t workerCount = 0;                      ///< ExecutorService workers (0 = hardware concurrency)
+        size_t openCvThreads = 0;                    ///< ThreadBudget per-task OpenCV cap (0 = none)
+        Nodes::TilingOptions tiling;                 ///< Tile size and pointwise fusion
+        bool deviceExecution = false;                ///< OpenCL images between supporting nodes
+        std::vector<std::string> hostOnlyNodeTypes;  ///< Node types kept on the CPU under device execution
+        size_t hardwareThreads = 0;                  ///< Hardware concurrency of the machine tuned on
+        std::string graphName;                       ///< File name of the graph tuned on (informational)
+        std::chrono::microseconds baselineTime{ 0 }; ///< Median run time with the settings tuning started from
+        std::chrono::microseconds tunedTime{ 0 };    ///< Median run time with these settings
+    };
+
+    /**
+     * @brief Settings of Autotuner::Tune().
+     */
+    struct AutotuneOptions
+    {
+        size_t runs = Constants::Autotune::kDefaultRuns;        ///< Timed runs per candidate (after one warm-up)
+        double minimumGain = Constants::Autotune::kMinimumGain; ///< Fraction a candidate must be faster by
+        bool tuneDevice = true;                                 ///< Try OpenCL when a device is present
+    };
+
+    /**
+     * @brief Called before each candidate is measured: candidates done, candidates planned, and a description.
+     */
+    using AutotuneProgressCallback = std::function<void(size_t, size_t, const std::string &)>;
+
+    /**
+     * @brief Benchmarks a representative graph under different execution settings and keeps the fastest.
+     *
+     * Tune() walks the settings one at a time, each starting from the best combination found so far: worker
+     * count, OpenCV threads per task, tile size (or no tiling), pointwise fusion, then OpenCL device execution.
+     * Every node type with a device path is then compared by its summed Process() time on and off the device;
+     * types that ran faster on the CPU are kept there, and that mix is measured as one more candidate. A
+     * candidate replaces the best only when its median run is faster by AutotuneOptions::minimumGain, so
+     * timer noise never flips a setting.
+     *
+     * Profiles are JSON files in a per-user configuration directory (GetDefaultProfilePath()); the CLI and the
+     * editor load that file at startup, so a machine is tuned once. Output caching is off while measuring
+     * and the execution mode is the editor's, as for RunRecorder.
+     */
+    class Autotuner
+    {
+    public:
+        /**
+         * @brief Measures candidates on the editor's graph and leaves the fastest settings applied.
+         * @param editor Editor holding the graph, with any overrides applied
+         * @param options Runs per candidate and noise margin
+         * @param error Receives a description of the problem on failure
+         * @param progress Called before each candidate (may be empty)
+         * @param stopToken Stops tuning before the next candidate; the editor's settings are restored
+         * @return Best settings, or std::nullopt if a run failed or tuning was stopped
+         */
+        [[nodiscard]] static std::optional<TuningProfile> Tune(Nodes::NodeEditor &editor,
+            const AutotuneOptions &options,
+            std::string &error,
+            const AutotuneProgressCallback &progress = {},
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Reads the settings a profile applies from an editor and the process-wide ThreadBudget.
+         * @param editor Editor to read
+         * @return Profile without timings
+         */
+        [[nodiscard]] static TuningProfile Capture(Nodes::NodeEditor &editor);
+
+        /**
+         * @brief Applies a profile to an editor, its executor and the process-wide ThreadBudget.
+         * @param profile Settings to apply
+         * @param editor Editor to configure
+         */
+        static void Apply(const TuningProfile &profile, Nodes::NodeEditor &editor);
+
+        /**
+         * @brief Writes a profile as JSON, creating its directory.
+         * @param profile Profile to write
+         * @param path Destination file
+         * @param error Receives a description of the problem on failure
+         * @return True if the file was written
+         */
+        [[nodiscard]] static bool SaveProfile(const TuningProfile &profile,
+            const std::filesystem::path &path,
+            std::string &error);
+
+        /**
+         * @brief Reads a profile written by SaveProfile().
+         * @param path Profile file
+         * @param error Receives a description of the problem on failure
+         * @return Profile, or std::nullopt if the file is missing or malformed
+         * @note A profile tuned on a machine with another hardware thread count loads with a warning.
+         */
+        [[nodiscard]] static std::optional<TuningProfile> LoadProfile(const std::filesystem::path &path,
+            std::string &error);
+
+        /**
+         * @brief Returns where this user's profile lives.
+         * @return %APPDATA%\\visioncraft\\tuning.json on Windows, $XDG_CONFIG_HOME/visioncraft/tuning.json or
+         *         ~/.config/visioncraft/tuning.json elsewhere; empty if no such directory is known
+         */
+        [[nodiscard]] static std::filesystem::path GetDefaultProfilePath();
+    };
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,811 @@
+#include "Vision/IO/BatchFarm.h"
+#include "Logger.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr const char *kJobFile = "job.json";
+        constexpr const char *kGraphFile = "graph.vcgb";
+        constexpr const char *kCompleteMarker = "complete";
+        constexpr const char *kPendingDirectory = "pending";
+        constexpr const char *kRunningDirectory = "running";
+        constexpr const char *kFinishingDirectory = "finishing";
+        constexpr const char *kDoneDirectory = "done";
+        constexpr const char *kFailedDirectory = "failed";
+        constexpr const char *kWorkersDirectory = "workers";
+        constexpr const char *kStagingDirectory = "staging";
+        constexpr char kClaimSeparator = '@';
+        constexpr int kJobVersion = 1;
+
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Files handed to one worker at a time.
+         */
+        struct Shard
+        {
+            std::string id;                           ///< Zero-padded index; the file stem in every directory
+            std::vector<std::filesystem::path> files; ///< Input files left to process
+            size_t attempt = 0;                       ///< Attempts made before this one
+            std::string lastWorker;                   ///< Worker of the previous attempt (others go first)
+        };
+
+        /**
+         * @brief Shard a worker renamed into running/.
+         */
+        struct Claim
+        {
+            std::filesystem::path path; ///< running/<shard>@<worker>.json
+            Shard shard;                ///< Its contents
+        };
+
+        /**
+         * @brief Job settings every worker reads.
+         */
+        struct JobSettings
+        {
+            BatchOptions batch;     ///< Directories, nodes, format and timeout
+            size_t maxAttempts = 0; ///< Tries per shard
+            size_t totalFiles = 0;  ///< Files over all shards
+        };
+
+        /**
+         * @brief What a worker reports in its heartbeat file.
+         */
+        struct WorkerState
+        {
+            std::mutex mutex;      ///< Guards the fields below (encode threads report progress)
+            uint64_t beat = 0;     ///< Heartbeats written; the coordinator watches it change
+            std::string shard;     ///< Shard in progress (empty when idle)
+            size_t completed = 0;  ///< Files of that shard finished
+            size_t total = 0;      ///< Files of that shard
+            size_t shardsDone = 0; ///< Shards finished by this worker
+        };
+
+        // Sleeps for interval, waking early when stopToken is triggered
+        void SleepFor(std::chrono::milliseconds interval, std::stop_token stopToken)
+        {
+            std::mutex mutex;
+            std::condition_variable_any wake;
+            std::unique_lock lock(mutex);
+            wake.wait_for(lock, stopToken, interval, [] { return false; });
+        }
+
+        std::optional<nlohmann::json> ReadJson(const std::filesystem::path &path)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream)
+            {
+                return std::nullopt;
+            }
+            auto json = nlohmann::json::parse(stream, nullptr, false);
+            if (json.is_discarded())
+            {
+                return std::nullopt;
+            }
+            return json;
+        }
+
+        // Unique per process, so temporary names written by different machines never collide
+        const std::string &GetProcessToken()
+        {
+            static const std::string token = [] {
+                std::random_device device;
+                return std::to_string((uint64_t{ device() } << 32) | device());
+            }();
+            return token;
+        }
+
+        // Writes under a temporary name in staging/ and renames into place, so readers never see partial files
+        bool WriteJsonAtomically(const std::filesystem::path &jobDirectory,
+            const std::filesystem::path &target,
+            const nlohmann::json &value)
+        {
+            static std::atomic<uint64_t> counter{ 0 };
+            const auto temporary = jobDirectory / kStagingDirectory
+                                   / (target.filename().string() + "." + GetProcessToken() + "."
+                                      + std::to_string(counter.fetch_add(1, std::memory_order_relaxed)) + ".tmp");
+            bool written = false;
+            {
+                std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+                written = stream && (stream << value.dump()) && stream.flush();
+            }
+
+            std::error_code error;
+            if (written)
+            {
+                std::filesystem::rename(temporary, target, error);
+            }
+            if (!written || error)
+            {
+                LOG_ERROR("Farm: failed to write '{}'", target.string());
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+            return true;
+        }
+
+        // JSON files of a directory, sorted by name
+        std::vector<std::filesystem::path> ListJsonFiles(const std::filesystem::path &directory)
+        {
+            std::vector<std::filesystem::path> files;
+            std::error_code error;
+            for (std::filesystem::directory_iterator it(directory, error), end; !error && it != end;
+                it.increment(error))
+            {
+                if (it->path().extension() == ".json")
+                {
+                    files.push_back(it->path());
+                }
+            }
+            std::ranges::sort(files);
+            return files;
+        }
+
+        // Claims are named "<shard>@<worker>.json"
+        std::pair<std::string, std::string> ParseClaimName(const std::filesystem::path &claim)
+        {
+            const auto stem = claim.stem().string();
+            const auto separator = stem.find(kClaimSeparator);
+            if (separator == std::string::npos)
+            {
+                return { stem, {} };
+            }
+            return { stem.substr(0, separator), stem.substr(separator + 1) };
+        }
+
+        std::string SanitizeWorkerName(std::string_view name)
+        {
+            std::string sanitized;
+            for (const char c : name)
+            {
+                const bool safe = std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.';
+                sanitized += safe ? c : '_';
+            }
+            return sanitized.empty() ? "worker" : sanitized;
+        }
+
+        std::string FormatShardId(size_t index)
+        {
+            auto id = std::to_string(index);
+            constexpr size_t kDigits = 6; // Keeps listings in shard order for up to a million shards
+            return id.size() < kDigits ? std::string(kDigits - id.size(), '0') + id : id;
+        }
+
+        nlohmann::json ToJson(const Shard &shard)
+        {
+            nlohmann::json files = nlohmann::json::array();
+            for (const auto &file : shard.files)
+            {
+                files.push_back(file.string());
+            }
+            return { { "files", std::move(files) }, { "attempt", shard.attempt }, { "lastWorker", shard.lastWorker } };
+        }
+
+        std::optional<Shard> ShardFromJson(std::string id, const nlohmann::json &json)
+        {
+            if (!json.is_object())
+            {
+                return std::nullopt;
+            }
+            const auto files = json.find("files");
+            if (files == json.end() || !files->is_array())
+            {
+                return std::nullopt;
+            }
+
+            Shard shard;
+            shard.id = std::move(id);
+            for (const auto &file : *files)
+            {
+                if (!file.is_string())
+                {
+                    return std::nullopt;
+                }
+                shard.files.emplace_back(file.get<std::string>());
+            }
+
+            const auto attempt = json.find("attempt");
+            const auto lastWorker = json.find("lastWorker");
+            shard.attempt = attempt != json.end() && attempt->is_number_unsigned() ? attempt->get<size_t>() : 0;
+            if (lastWorker != json.end() && lastWorker->is_string())
+            {
+                shard.lastWorker = lastWorker->get<std::string>();
+            }
+            return shard;
+        }
+
+        std::optional<JobSettings> ParseJob(const nlohmann::json &json)
+        {
+            if (!json.is_object() || json.value("version", 0) != kJobVersion)
+            {
+                return std::nullopt;
+            }
+
+            try
+            {
+                const auto nodeId = [&](const char *key) -> std::optional<Nodes::NodeId> {
+                    const auto it = json.find(key);
+                    return it != json.end() && it->is_number_integer() ? std::optional(it->get<Nodes::NodeId>())
+                                                                       : std::nullopt;
+                };
+
+                JobSettings settings;
+                settings.batch.inputDirectory = json.at("inputDirectory").get<std::string>();
+                settings.batch.outputDirectory = json.at("outputDirectory").get<std::string>();
+                settings.batch.inputNodeId = nodeId("inputNodeId");
+                settings.batch.outputNodeId = nodeId("outputNodeId");
+                settings.batch.outputFormat = json.value("outputFormat", std::string{});
+                settings.batch.fileTimeout = std::chrono::milliseconds(json.value("fileTimeoutMs", int64_t{ 0 }));
+                settings.maxAttempts = std::max<size_t>(1, json.value("maxAttempts", size_t{ 1 }));
+                settings.totalFiles = json.value("files", size_t{ 0 });
+                return settings;
+            }
+            catch (const nlohmann::json::exception &)
+            {
+                return std::nullopt;
+            }
+        }
+
+        std::optional<JobSettings> ReadJob(const std::filesystem::path &jobDirectory)
+        {
+            const auto json = ReadJson(jobDirectory / kJobFile);
+            return json ? ParseJob(*json) : std::nullopt;
+        }
+
+        // Records what is left of a shard after an attempt: a new attempt in pending/, or failed/ after the last
+        bool Requeue(const std::filesystem::path &jobDirectory,
+            Shard shard,
+            const std::string &worker,
+            size_t maxAttempts)
+        {
+            ++shard.attempt;
+            shard.lastWorker = worker;
+            const bool exhausted = shard.attempt >= maxAttempts;
+            if (exhausted)
+            {
+                LOG_WARN("Farm: shard {} failed {} times; its {} remaining files count as failed",
+                    shard.id,
+                    shard.attempt,
+                    shard.files.size());
+            }
+            const auto directory = jobDirectory / (exhausted ? kFailedDirectory : kPendingDirectory);
+            return WriteJsonAtomically(jobDirectory, directory / (shard.id + ".json"), ToJson(shard));
+        }
+
+        std::optional<Claim> ClaimShard(const std::filesystem::path &jobDirectory, const std::string &worker)
+        {
+            const auto pending = ListJsonFiles(jobDirectory / kPendingDirectory);
+
+            // Retries go to other workers first; a worker takes its own failures back only when nothing else is left
+            for (const bool ownRetries : { false, true })
+            {
+                for (const auto &candidate : pending)
+                {
+                    if (!ownRetries)
+                    {
+                        const auto json = ReadJson(candidate);
+                        if (!json || (json->is_object() && json->value("lastWorker", std::string{}) == worker))
+                        {
+                            continue;
+                        }
+                    }
+
+                    // Renaming is atomic, so exactly one worker wins each shard
+                    const auto id = candidate.stem().string();
+                    const auto claimPath = jobDirectory / kRunningDirectory / (id + kClaimSeparator + worker + ".json");
+                    std::error_code error;
+                    std::filesystem::rename(candidate, claimPath, error);
+                    if (error)
+                    {
+                        continue;
+                    }
+
+                    const auto json = ReadJson(claimPath);
+                    auto shard = json ? ShardFromJson(id, *json) : std::nullopt;
+                    if (!shard)
+                    {
+                        LOG_ERROR("Farm: shard {} is unreadable; moving it to failed", id);
+                        std::filesystem::rename(claimPath, jobDirectory / kFailedDirectory / (id + ".json"), error);
+                        continue;
+                    }
+                    return Claim{ claimPath, std::move(*shard) };
+                }
+            }
+            return std::nullopt;
+        }
+
+        // Records an attempt; false if the coordinator gave the shard to another worker meanwhile
+        bool FinishShard(const std::filesystem::path &jobDirectory,
+            const Claim &claim,
+            const BatchResult &result,
+            const std::string &worker,
+            size_t maxAttempts)
+        {
+            // Out of running/, the coordinator no longer requeues it; it still does if this worker dies here
+            const auto finishing = jobDirectory / kFinishingDirectory / claim.path.filename();
+            std::error_code error;
+            std::filesystem::rename(claim.path, finishing, error);
+            if (error)
+            {
+                LOG_WARN("Farm: shard {} was reassigned while {} ran it; its results are not counted",
+                    claim.shard.id,
+                    worker);
+                return false;
+            }
+
+            // Failed files first: if they cannot be requeued, nothing is recorded and the whole shard runs again
+            if (!result.failedFiles.empty())
+            {
+                Shard rest = claim.shard;
+                rest.files = result.failedFiles;
+                if (!Requeue(jobDirectory, std::move(rest), worker, maxAttempts))
+                {
+                    std::filesystem::rename(
+                        finishing, jobDirectory / kPendingDirectory / (claim.shard.id + ".json"), error);
+                    return false;
+                }
+            }
+
+            if (result.succeeded > 0)
+            {
+                const auto done = jobDirectory / kDoneDirectory
+                                  / (claim.shard.id + ".a" + std::to_string(claim.shard.attempt) + ".json");
+                WriteJsonAtomically(jobDirectory, done, { { "succeeded", result.succeeded }, { "worker", worker } });
+            }
+
+            std::filesystem::remove(finishing, error);
+            return true;
+        }
+
+        // Takes a silent worker's claim back; false if the worker finished it after all
+        bool RequeueClaim(const std::filesystem::path &jobDirectory,
+            const std::filesystem::path &claim,
+            const std::string &worker,
+            size_t maxAttempts)
+        {
+            const auto taken =
+                jobDirectory / kStagingDirectory / (claim.filename().string() + "." + GetProcessToken() + ".requeue");
+            std::error_code error;
+            std::filesystem::rename(claim, taken, error);
+            if (error)
+            {
+                return false;
+            }
+
+            const auto id = ParseClaimName(claim).first;
+            const auto json = ReadJson(taken);
+            auto shard = json ? ShardFromJson(id, *json) : std::nullopt;
+            if (!shard)
+            {
+                LOG_ERROR("Farm: shard {} is unreadable; moving it to failed", id);
+                std::filesystem::rename(taken, jobDirectory / kFailedDirectory / (id + ".json"), error);
+                return false;
+            }
+            if (!Requeue(jobDirectory, std::move(*shard), worker, maxAttempts))
+            {
+                std::filesystem::rename(taken, claim, error); // Tried again on the next scan
+                return false;
+            }
+            std::filesystem::remove(taken, error);
+            return true;
+        }
+
+        // Nothing is waiting or running, or the coordinator has declared the job done
+        bool IsJobFinished(const std::filesystem::path &jobDirectory)
+        {
+            std::error_code error;
+            return std::filesystem::exists(jobDirectory / kCompleteMarker, error)
+                   || (ListJsonFiles(jobDirectory / kPendingDirectory).empty()
+                       && ListJsonFiles(jobDirectory / kRunningDirectory).empty()
+                       && ListJsonFiles(jobDirectory / kFinishingDirectory).empty());
+        }
+    } // namespace
+
+    bool BatchFarm::CreateJob(Nodes::NodeEditor &editor,
+        const std::filesystem::path &jobDirectory,
+        const BatchOptions &options,
+        const FarmOptions &farmOptions)
+    {
+        std::error_code error;
+        if (std::filesystem::exists(jobDirectory / kJobFile, error))
+        {
+            LOG_ERROR("Farm: '{}' already holds a job", jobDirectory.string());
+            return false;
+        }
+        if (!std::filesystem::is_directory(options.inputDirectory, error))
+        {
+            LOG_ERROR("Batch input directory does not exist: {}", options.inputDirectory.string());
+            return false;
+        }
+        if (options.outputDirectory.empty())
+        {
+            LOG_ERROR("Batch output directory is not set");
+            return false;
+        }
+
+        for (const char *directory : { kPendingDirectory,
+                 kRunningDirectory,
+                 kFinishingDirectory,
+                 kDoneDirectory,
+                 kFailedDirectory,
+                 kWorkersDirectory,
+                 kStagingDirectory })
+        {
+            std::filesystem::create_directories(jobDirectory / directory, error);
+            if (error)
+            {
+                LOG_ERROR("Farm: cannot create '{}': {}", (jobDirectory / directory).string(), error.message());
+                return false;
+            }
+        }
+
+        // Serialized once; every worker loads this file instead of the original graph and its overrides
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+        if (!editor.SaveToFile(jobDirectory / kGraphFile, nodePositions))
+        {
+            LOG_ERROR("Farm: failed to save the graph to '{}'", jobDirectory.string());
+            return false;
+        }
+
+        // Workers run elsewhere, so paths must not depend on this process's working directory
+        const auto inputDirectory = std::filesystem::absolute(options.inputDirectory);
+        const auto outputDirectory = std::filesystem::absolute(options.outputDirectory);
+        const auto files = BatchProcessor::CollectImageFiles(inputDirectory, options.recursive);
+        const size_t shardFiles = std::max<size_t>(1, farmOptions.shardFiles);
+        size_t shardCount = 0;
+        for (size_t first = 0; first < files.size(); first += shardFiles)
+        {
+            Shard shard;
+            shard.id = FormatShardId(shardCount++);
+            const auto last = files.begin() + static_cast<std::ptrdiff_t>(std::min(files.size(), first + shardFiles));
+            shard.files.assign(files.begin() + static_cast<std::ptrdiff_t>(first), last);
+            const auto path = jobDirectory / kPendingDirectory / (shard.id + ".json");
+            if (!WriteJsonAtomically(jobDirectory, path, ToJson(shard)))
+            {
+                return false;
+            }
+        }
+
+        const auto nodeIdJson = [](const std::optional<Nodes::NodeId> &id) {
+            return id ? nlohmann::json(*id) : nlohmann::json(nullptr);
+        };
+        const nlohmann::json job{ { "version", kJobVersion },
+            { "inputDirectory", inputDirectory.string() },
+            { "outputDirectory", outputDirectory.string() },
+            { "inputNodeId", nodeIdJson(options.inputNodeId) },
+            { "outputNodeId", nodeIdJson(options.outputNodeId) },
+            { "outputFormat", options.outputFormat },
+            { "fileTimeoutMs", options.fileTimeout.count() },
+            { "maxAttempts", std::max<size_t>(1, farmOptions.maxAttempts) },
+            { "files", files.size() },
+            { "shards", shardCount } };
+
+        // Written last: workers wait for it, so they never see a half-created job
+        if (!WriteJsonAtomically(jobDirectory, jobDirectory / kJobFile, job))
+        {
+            return false;
+        }
+        LOG_INFO("Farm: job '{}' has {} images in {} shards", jobDirectory.string(), files.size(), shardCount);
+        return true;
+    }
+
+    std::optional<BatchResult> BatchFarm::Coordinate(const std::filesystem::path &jobDirectory,
+        const FarmOptions &farmOptions,
+        const FarmProgressCallback &progressCallback,
+        std::stop_token stopToken)
+    {
+        const auto settings = ReadJob(jobDirectory);
+        if (!settings)
+        {
+            LOG_ERROR("Farm: no readable job in '{}'", jobDirectory.string());
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Last heartbeat seen from a worker, on this machine's clock (worker clocks may differ).
+         */
+        struct Heartbeat
+        {
+            uint64_t beat = 0;           ///< Counter from the worker's file
+            Clock::time_point changedAt; ///< When it last changed
+        };
+
+        const auto startTime = Clock::now();
+        std::unordered_map<std::string, Heartbeat> heartbeats;
+        std::unordered_map<std::string, Clock::time_point> claimsSeenAt;
+        std::unordered_set<std::string> countedOutcomes; // Outcome files are written once, so each is read once
+        std::vector<std::filesystem::path> failedFiles;
+        FarmProgress progress{ .totalFiles = settings->totalFiles };
+        bool cancelled = false;
+
+        while (true)
+        {
+            const auto now = Clock::now();
+            progress.activeWorkers = 0;
+            for (const auto &file : ListJsonFiles(jobDirectory / kWorkersDirectory))
+            {
+                const auto status = ReadJson(file);
+                if (!status || !status->is_object())
+                {
+                    continue;
+                }
+                const auto beat = status->value("beat", uint64_t{ 0 });
+                auto [it, inserted] = heartbeats.try_emplace(file.stem().string(), Heartbeat{ beat, now });
+                if (!inserted && it->second.beat != beat)
+                {
+                    it->second = { beat, now };
+                }
+                if (now - it->second.changedAt < farmOptions.leaseTimeout)
+                {
+                    ++progress.activeWorkers;
+                }
+            }
+
+            // A claim lives while its worker's heartbeat changes; one never heard from gets a lease from first sight
+            std::unordered_set<std::string> currentClaims;
+            progress.runningShards = 0;
+            for (const char *directory : { kRunningDirectory, kFinishingDirectory })
+            {
+                for (const auto &claim : ListJsonFiles(jobDirectory / directory))
+                {
+                    const auto name = claim.filename().string();
+                    currentClaims.insert(name);
+                    auto lastSign = claimsSeenAt.try_emplace(name, now).first->second;
+                    const auto [shardId, worker] = ParseClaimName(claim);
+                    if (const auto it = heartbeats.find(worker); it != heartbeats.end())
+                    {
+                        lastSign = std::max(lastSign, it->second.changedAt);
+                    }
+                    if (now - lastSign < farmOptions.leaseTimeout)
+                    {
+                        ++progress.runningShards;
+                        continue;
+                    }
+
+                    LOG_WARN("Farm: worker {} fell silent; requeuing shard {}", worker, shardId);
+                    if (RequeueClaim(jobDirectory, claim, worker, settings->maxAttempts))
+                    {
+                        ++progress.requeuedShards;
+                    }
+                }
+            }
+            std::erase_if(claimsSeenAt, [&](const auto &entry) { return !currentClaims.contains(entry.first); });
+
+            for (const auto &file : ListJsonFiles(jobDirectory / kDoneDirectory))
+            {
+                const auto json = countedOutcomes.contains(file.string()) ? std::nullopt : ReadJson(file);
+                if (json && json->is_object())
+                {
+                    progress.succeededFiles += json->value("succeeded", size_t{ 0 });
+                    countedOutcomes.insert(file.string());
+                }
+            }
+            for (const auto &file : ListJsonFiles(jobDirectory / kFailedDirectory))
+            {
+                const auto json = countedOutcomes.contains(file.string()) ? std::nullopt : ReadJson(file);
+                if (json)
+                {
+                    const auto shard = ShardFromJson(file.stem().string(), *json);
+                    if (shard)
+                    {
+                        progress.failedFiles += shard->files.size();
+                        failedFiles.insert(failedFiles.end(), shard->files.begin(), shard->files.end());
+                    }
+                    countedOutcomes.insert(file.string());
+                }
+            }
+
+            progress.pendingShards = ListJsonFiles(jobDirectory / kPendingDirectory).size();
+            if (progressCallback)
+            {
+                progressCallback(progress);
+            }
+
+            if (progress.pendingShards == 0 && progress.runningShards == 0 && currentClaims.empty())
+            {
+                break;
+            }
+            if (stopToken.stop_requested())
+            {
+                cancelled = true;
+                break;
+            }
+            SleepFor(farmOptions.pollInterval, stopToken);
+        }
+
+        if (!cancelled)
+        {
+            std::ofstream(jobDirectory / kCompleteMarker) << "done\n"; // Lets idle workers exit
+        }
+
+        BatchResult result;
+        result.total = settings->totalFiles;
+        result.succeeded = progress.succeededFiles;
+        result.failed = progress.failedFiles;
+        result.cancelled = cancelled;
+        result.failedFiles = std::move(failedFiles);
+        result.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - startTime);
+
+        LOG_INFO("Farm finished: {} written, {} failed, {} total in {} ms ({} shards requeued){}",
+            result.succeeded,
+            result.failed,
+            result.total,
+            result.elapsed.count(),
+            progress.requeuedShards,
+            result.cancelled ? " (stopped watching)" : "");
+        return result;
+    }
+
+    std::optional<size_t> BatchFarm::Work(Nodes::NodeEditor &editor,
+        const std::filesystem::path &jobDirectory,
+        const std::string &workerName,
+        const FarmOptions &farmOptions,
+        std::stop_token stopToken)
+    {
+        const auto worker = SanitizeWorkerName(workerName);
+
+        // Workers may start before the coordinator has written the job
+        auto settings = ReadJob(jobDirectory);
+        while (!settings && !stopToken.stop_requested())
+        {
+            SleepFor(farmOptions.pollInterval, stopToken);
+            settings = ReadJob(jobDirectory);
+        }
+        if (!settings)
+        {
+            return std::nullopt;
+        }
+        if (farmOptions.ioWorkers > 0)
+        {
+            settings->batch.decodeWorkers = farmOptions.ioWorkers;
+            settings->batch.encodeWorkers = farmOptions.ioWorkers;
+        }
+
+        // Loaded once: the plan, executor and caches stay warm across shards
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+        if (!editor.LoadFromFile(jobDirectory / kGraphFile, nodePositions))
+        {
+            LOG_ERROR("Farm: worker {} cannot load the graph of '{}'", worker, jobDirectory.string());
+            return std::nullopt;
+        }
+        BatchProcessor processor(editor);
+
+        WorkerState state;
+        const auto statusPath = jobDirectory / kWorkersDirectory / (worker + ".json");
+        std::jthread heartbeat([&](std::stop_token heartbeatStop) {
+            do
+            {
+                nlohmann::json status;
+                {
+                    std::scoped_lock lock(state.mutex);
+                    status = { { "beat", ++state.beat },
+                        { "shard", state.shard },
+                        { "completed", state.completed },
+                        { "total", state.total },
+                        { "shards", state.shardsDone } };
+                }
+                WriteJsonAtomically(jobDirectory, statusPath, status);
+                SleepFor(farmOptions.heartbeatInterval, heartbeatStop);
+            } while (!heartbeatStop.stop_requested());
+        });
+
+        LOG_INFO("Farm: worker {} joined '{}'", worker, jobDirectory.string());
+        size_t shardsDone = 0;
+        bool usable = true;
+        while (!stopToken.stop_requested())
+        {
+            auto claim = ClaimShard(jobDirectory, worker);
+            if (!claim)
+            {
+                // Running shards may still come back if their worker dies, so wait until the job is over
+                if (IsJobFinished(jobDirectory))
+                {
+                    break;
+                }
+                SleepFor(farmOptions.pollInterval, stopToken);
+                continue;
+            }
+
+            {
+                std::scoped_lock lock(state.mutex);
+                state.shard = claim->shard.id;
+                state.completed = 0;
+                state.total = claim->shard.files.size();
+            }
+            const auto result = processor.RunFiles(
+                claim->shard.files,
+                settings->batch,
+                [&state](size_t completed, size_t, const std::filesystem::path &) {
+                    std::scoped_lock lock(state.mutex);
+                    state.completed = completed;
+                },
+                stopToken);
+            {
+                std::scoped_lock lock(state.mutex);
+                state.shard.clear();
+            }
+
+            if (!result || result->cancelled)
+            {
+                // Not the shard's fault: it goes back unchanged
+                std::error_code error;
+                std::filesystem::rename(
+                    claim->path, jobDirectory / kPendingDirectory / (claim->shard.id + ".json"), error);
+                if (!result)
+                {
+                    LOG_ERROR("Farm: worker {} cannot run the job's graph", worker);
+                    usable = false;
+                }
+                break;
+            }
+
+            if (FinishShard(jobDirectory, *claim, *result, worker, settings->maxAttempts))
+            {
+                ++shardsDone;
+                std::scoped_lock lock(state.mutex);
+                state.shardsDone = shardsDone;
+            }
+        }
+
+        heartbeat.request_stop();
+        heartbeat.join();
+        std::error_code error;
+        std::filesystem::remove(statusPath, error);
+
+        LOG_INFO("Farm: worker {} processed {} shards", worker, shardsDone);
+        return usable ? std::optional(shardsDone) : std::nullopt;
+    }
+
+    std::string BatchFarm::GetDefaultWorkerName()
+    {
+        std::string host;
+#if defined(_WIN32)
+        char buffer[MAX_COMPUTERNAME_LENGTH + 1]{};
+        DWORD size = sizeof(buffer);
+        if (GetComputerNameA(buffer, &size))
+        {
+            host.assign(buffer, size);
+        }
+        const auto processId = static_cast<unsigned long>(GetCurrentProcessId());
+#else
+        char buffer[256]{};
+        if (gethostname(buffer, sizeof(buffer) - 1) == 0)
+        {
+            host = buffer;
+        }
+        const auto processId = static_cast<unsigned long>(getpid());
+#endif
+        return SanitizeWorkerName((host.empty() ? "worker" : host) + "-" + std::to_string(processId));
+    }
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/IO/BatchProcessor.h"
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Settings of a distributed batch job.
+     */
+    struct FarmOptions
+    {
+        size_t shardFiles = Constants::Farm::kDefaultShardFiles;   ///< Files per shard (coordinator)
+        size_t maxAttempts = Constants::Farm::kDefaultMaxAttempts; ///< Tries per shard (coordinator, saved in job)
+        size_t ioWorkers = 0;                                      ///< Worker decode/encode threads each (0 = default)
+
+        std::chrono::milliseconds leaseTimeout{ Constants::Farm::kDefaultLeaseMilliseconds };   ///< Silence = dead
+        std::chrono::milliseconds heartbeatInterval{ Constants::Farm::kHeartbeatMilliseconds }; ///< Worker reports
+        std::chrono::milliseconds pollInterval{ Constants::Farm::kPollMilliseconds };           ///< Job scans
+    };
+
+    /**
+     * @brief Job state the coordinator reports after each scan.
+     */
+    struct FarmProgress
+    {
+        size_t totalFiles = 0;     ///< Files in the job
+        size_t succeededFiles = 0; ///< Files written
+        size_t failedFiles = 0;    ///< Files that failed on every attempt
+        size_t pendingShards = 0;  ///< Shards waiting for a worker
+        size_t runningShards = 0;  ///< Shards claimed by a worker
+        size_t activeWorkers = 0;  ///< Workers whose heartbeat is current
+        size_t requeuedShards = 0; ///< Shards taken back from silent workers so far
+    };
+
+    /**
+     * @brief Progress callback, invoked on the coordinator's thread.
+     * @param progress Job state after the latest scan
+     */
+    using FarmProgressCallback = std::function<void(const FarmProgress &progress)>;
+
+    /**
+     * @brief Spreads one batch over many machines through a job directory on shared storage.
+     *
+     * The coordinator saves the graph once (binary format) and splits the input files into shards. Workers
+     * on any machine that mounts the job directory claim shards by renaming them, which is atomic, so no
+     * two workers get the same shard and no server process is needed. Each worker loads the graph once and
+     * runs its shards through a BatchProcessor, so the compiled plan and the executor stay warm between
+     * shards, and writes results straight into the output directory. Input and output directories must
+     * therefore be reachable under the same paths on every machine.
+     *
+     * Workers report progress in a heartbeat file. When a worker falls silent for leaseTimeout, the
+     * coordinator puts its shards back; files that fail are retried in a new attempt that other workers
+     * are preferred for. After maxAttempts, a shard's remaining files count as failed.
+     *
+     * Job directory layout: job.json and graph.vcgb, then pending/, running/ and finishing/ for shards
+     * waiting, claimed and being recorded, done/ and failed/ for outcomes, workers/ for heartbeats, and a
+     * "complete" marker once the coordinator is done.
+     */
+    class BatchFarm
+    {
+    public:
+        /**
+         * @brief Creates a job: saves the editor's graph and shards the input directory.
+         * @param editor Editor holding the graph, with any overrides applied
+         * @param jobDirectory New or empty directory on shared storage
+         * @param options Batch settings (directories, nodes, format, timeout); I/O thread counts are not saved
+         * @param farmOptions Shard size and attempts
+         * @return True if the job was written
+         */
+        [[nodiscard]] static bool CreateJob(Nodes::NodeEditor &editor,
+            const std::filesystem::path &jobDirectory,
+            const BatchOptions &options,
+            const FarmOptions &farmOptions = {});
+
+        /**
+         * @brief Watches a job until every shard is done or failed, requeuing shards of silent workers.
+         * @param jobDirectory Directory from CreateJob()
+         * @param farmOptions Lease timeout and scan interval
+         * @param progressCallback Optional progress reporter
+         * @param stopToken Token to stop watching (workers keep going; calling again resumes)
+         * @return Totals over all workers (timedOut is not tracked), or std::nullopt if the job is unreadable
+         */
+        [[nodiscard]] static std::optional<BatchResult> Coordinate(const std::filesystem::path &jobDirectory,
+            const FarmOptions &farmOptions = {},
+            const FarmProgressCallback &progressCallback = nullptr,
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Loads a job's graph and processes shards until none are left.
+         * @param editor Editor to run the graph in (execution settings are kept, its graph is replaced)
+         * @param jobDirectory Directory from CreateJob(); waited for if the job does not exist yet
+         * @param workerName Name unique among the job's workers (see GetDefaultWorkerName())
+         * @param farmOptions Heartbeat and scan intervals and I/O threads
+         * @param stopToken Token to stop; a shard in progress goes back to pending
+         * @return Shards processed, or std::nullopt if the job or its graph is unusable
+         */
+        [[nodiscard]] static std::optional<size_t> Work(Nodes::NodeEditor &editor,
+            const std::filesystem::path &jobDirectory,
+            const std::string &workerName,
+            const FarmOptions &farmOptions = {},
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Returns a worker name from the host name and process ID.
+         * @return Name usable in file names
+         */
+        [[nodiscard]] static std::string GetDefaultWorkerName();
+    };
+
+} // namespace VisionCraft::Vision::IO
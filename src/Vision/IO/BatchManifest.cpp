@@ -0,0 +1,490 @@
+#include "Vision/IO/BatchManifest.h"
+#include "Logger.h"
+#include "Nodes/Core/NodeOutputCache.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <fstream>
+#include <random>
+#include <system_error>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr int kManifestVersion = 1;
+        constexpr std::string_view kClaimRecord = "claim";
+        constexpr std::string_view kSucceededRecord = "done";
+        constexpr std::string_view kFailedRecord = "failed";
+        constexpr std::string_view kAliveRecord = "alive";
+        constexpr std::string_view kLeaveRecord = "leave";
+        constexpr std::string_view kCutShortMarker = "#"; // Appended to a cut-short record so it never parses
+
+        // Sleeps for interval, waking early when stopToken is triggered
+        void SleepFor(std::chrono::milliseconds interval, std::stop_token stopToken)
+        {
+            std::mutex mutex;
+            std::condition_variable_any wake;
+            std::unique_lock lock(mutex);
+            wake.wait_for(lock, stopToken, interval, [] { return false; });
+        }
+
+        std::string MakeOwnerToken()
+        {
+            std::random_device device;
+            const uint64_t value = (uint64_t{ device() } << 32) | device();
+            char buffer[17]{};
+            std::to_chars(buffer, buffer + 16, value, 16);
+            return buffer;
+        }
+
+        // Splits a record into its space-separated fields
+        std::vector<std::string_view> SplitRecord(std::string_view line)
+        {
+            std::vector<std::string_view> fields;
+            while (!line.empty())
+            {
+                const auto space = line.find(' ');
+                fields.push_back(line.substr(0, space));
+                line = space == std::string_view::npos ? std::string_view{} : line.substr(space + 1);
+            }
+            return fields;
+        }
+
+        std::optional<uint64_t> ParseIndex(std::string_view text)
+        {
+            uint64_t value = 0;
+            const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (error != std::errc{} || end != text.data() + text.size() || text.empty())
+            {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        // Publishes the header without overwriting a manifest another process created meanwhile
+        bool CreateManifest(const std::filesystem::path &manifestPath, const nlohmann::json &header)
+        {
+            std::error_code error;
+            if (manifestPath.has_parent_path())
+            {
+                std::filesystem::create_directories(manifestPath.parent_path(), error);
+            }
+
+            auto temporary = manifestPath;
+            temporary += "." + MakeOwnerToken() + ".tmp";
+            bool written = false;
+            {
+                std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+                written = stream && (stream << header.dump() << '\n') && stream.flush();
+            }
+
+            // A hard link fails if the manifest exists, unlike rename; fall back where links are unsupported
+            if (written)
+            {
+                std::filesystem::create_hard_link(temporary, manifestPath, error);
+                if (error && !std::filesystem::exists(manifestPath))
+                {
+                    error.clear();
+                    std::filesystem::rename(temporary, manifestPath, error);
+                }
+            }
+            std::filesystem::remove(temporary, error);
+            return written && std::filesystem::exists(manifestPath, error);
+        }
+    } // namespace
+
+    std::unique_ptr<BatchManifest> BatchManifest::Open(const std::filesystem::path &manifestPath,
+        uint64_t graphHash,
+        const std::vector<std::filesystem::path> &files,
+        const ManifestOptions &options)
+    {
+        std::error_code error;
+        if (!std::filesystem::exists(manifestPath, error))
+        {
+            nlohmann::json fileList = nlohmann::json::array();
+            for (const auto &file : files)
+            {
+                fileList.push_back(file.string());
+            }
+            const nlohmann::json header{ { "version", kManifestVersion },
+                { "graphHash", graphHash },
+                { "chunkFiles", std::max<size_t>(1, options.chunkFiles) },
+                { "files", std::move(fileList) } };
+            if (!CreateManifest(manifestPath, header))
+            {
+                LOG_ERROR("Batch: cannot create manifest '{}'", manifestPath.string());
+                return nullptr;
+            }
+        }
+
+        std::ifstream stream(manifestPath, std::ios::binary);
+        std::string headerLine;
+        if (!stream || !std::getline(stream, headerLine) || stream.eof())
+        {
+            LOG_ERROR("Batch: manifest '{}' has no header", manifestPath.string());
+            return nullptr;
+        }
+
+        const auto header = nlohmann::json::parse(headerLine, nullptr, false);
+        if (header.is_discarded() || !header.is_object() || header.value("version", 0) != kManifestVersion)
+        {
+            LOG_ERROR("Batch: manifest '{}' is not a version {} manifest", manifestPath.string(), kManifestVersion);
+            return nullptr;
+        }
+        if (header.value("graphHash", uint64_t{ 0 }) != graphHash)
+        {
+            LOG_ERROR("Batch: manifest '{}' was written for a different graph; remove it to start over",
+                manifestPath.string());
+            return nullptr;
+        }
+
+        std::vector<std::filesystem::path> manifestFiles;
+        const auto fileList = header.find("files");
+        if (fileList == header.end() || !fileList->is_array())
+        {
+            LOG_ERROR("Batch: manifest '{}' has no file list", manifestPath.string());
+            return nullptr;
+        }
+        manifestFiles.reserve(fileList->size());
+        for (const auto &file : *fileList)
+        {
+            if (!file.is_string())
+            {
+                LOG_ERROR("Batch: manifest '{}' has an invalid file list", manifestPath.string());
+                return nullptr;
+            }
+            manifestFiles.emplace_back(file.get<std::string>());
+        }
+        if (manifestFiles.size() != files.size())
+        {
+            LOG_INFO("Batch: resuming manifest '{}' with its {} files (the input now has {})",
+                manifestPath.string(),
+                manifestFiles.size(),
+                files.size());
+        }
+
+        const size_t chunkFiles = std::max<size_t>(1, header.value("chunkFiles", size_t{ 1 }));
+        std::unique_ptr<BatchManifest> manifest(
+            new BatchManifest(manifestPath, std::move(manifestFiles), chunkFiles, options));
+        manifest->readOffset = headerLine.size() + 1;
+
+        {
+            std::scoped_lock lock(manifest->mutex);
+            manifest->journal = std::fopen(manifestPath.string().c_str(), "ab");
+            if (!manifest->journal || !manifest->Refresh())
+            {
+                LOG_ERROR("Batch: cannot open manifest '{}' for writing", manifestPath.string());
+                return nullptr;
+            }
+
+            // Ends a record a crash cut short, so a truncated index (say "done 1" of "done 12") is not applied
+            if (std::filesystem::file_size(manifestPath, error) > manifest->readOffset)
+            {
+                manifest->Append(std::string(kCutShortMarker));
+            }
+
+            // First beat before any claim, so other processes never see a claim without its owner's beat
+            manifest->Beat();
+            manifest->Refresh();
+        }
+        manifest->StartHeartbeat();
+
+        LOG_INFO("Batch: manifest '{}' has {} of {} files handled",
+            manifestPath.string(),
+            manifest->handled,
+            manifest->files.size());
+        return manifest;
+    }
+
+    BatchManifest::BatchManifest(std::filesystem::path manifestPath,
+        std::vector<std::filesystem::path> files,
+        size_t chunkFiles,
+        const ManifestOptions &options)
+        : manifestPath(std::move(manifestPath)), files(std::move(files)), chunkFiles(chunkFiles), options(options),
+          owner(MakeOwnerToken()), states(this->files.size(), FileState::Unhandled),
+          chunks((this->files.size() + chunkFiles - 1) / chunkFiles)
+    {
+        for (size_t chunk = 0; chunk < chunks.size(); ++chunk)
+        {
+            chunks[chunk].unhandled = std::min(chunkFiles, this->files.size() - chunk * chunkFiles);
+        }
+    }
+
+    BatchManifest::~BatchManifest()
+    {
+        if (heartbeat.joinable())
+        {
+            heartbeat.request_stop();
+            heartbeat.join();
+        }
+        if (journal)
+        {
+            // Releases this process's chunks at once, e.g. for the rerun after a cancelled batch
+            Append(std::string(kLeaveRecord) + " " + owner);
+            std::fclose(journal);
+        }
+    }
+
+    size_t BatchManifest::GetHandledCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return handled;
+    }
+
+    std::optional<size_t> BatchManifest::Next(std::stop_token stopToken)
+    {
+        std::unique_lock lock(mutex);
+        while (true)
+        {
+            Refresh();
+
+            // Another process may have taken the chunk over if this one looked dead
+            if (currentChunk && chunks[*currentChunk].owner == owner)
+            {
+                const size_t end = std::min(files.size(), (*currentChunk + 1) * chunkFiles);
+                while (cursor < end)
+                {
+                    const size_t index = cursor++;
+                    if (states[index] == FileState::Unhandled)
+                    {
+                        return index;
+                    }
+                }
+            }
+            currentChunk.reset();
+
+            if (const auto chunk = FindClaimableChunk(Clock::now()))
+            {
+                // Every process appends its claim and reads back; the first claim of a generation wins
+                const uint64_t generation = chunks[*chunk].generation + 1;
+                Append(std::string(kClaimRecord) + " " + std::to_string(*chunk) + " " + std::to_string(generation) + " "
+                       + owner);
+                if (writeFailed)
+                {
+                    return std::nullopt;
+                }
+                Refresh();
+                if (chunks[*chunk].generation == generation && chunks[*chunk].owner == owner)
+                {
+                    currentChunk = chunk;
+                    cursor = *chunk * chunkFiles;
+                }
+                continue;
+            }
+
+            // Files still held by live processes come back here if their owner falls silent
+            const bool othersBusy = std::ranges::any_of(chunks, [&](const ChunkClaim &claim) {
+                return claim.unhandled > 0 && claim.generation > 0 && claim.owner != owner;
+            });
+            if (!othersBusy || stopToken.stop_requested())
+            {
+                return std::nullopt;
+            }
+
+            lock.unlock();
+            SleepFor(options.pollInterval, stopToken);
+            lock.lock();
+        }
+    }
+
+    void BatchManifest::Record(size_t index, bool succeeded)
+    {
+        std::scoped_lock lock(mutex);
+        if (index >= files.size())
+        {
+            return;
+        }
+        Append(std::string(succeeded ? kSucceededRecord : kFailedRecord) + " " + std::to_string(index) + " " + owner);
+        SetState(index, succeeded ? FileState::Succeeded : FileState::Failed);
+    }
+
+    uint64_t BatchManifest::HashGraph(const Nodes::NodeEditor &editor,
+        Nodes::NodeId inputNodeId,
+        Nodes::NodeId outputNodeId)
+    {
+        const auto snapshot = editor.CaptureSaveSnapshot({});
+        auto nodes = snapshot->nodes;
+        std::ranges::sort(nodes, {}, &Nodes::GraphSaveSnapshot::SavedNode::id);
+
+        // Canonical text of the graph; node names and positions do not change results
+        std::string canonical;
+        for (auto &node : nodes)
+        {
+            canonical += "node " + std::to_string(node.id) + " " + node.type + "\n";
+            std::ranges::sort(node.defaults, {}, [](const auto &entry) -> const std::string & { return entry.first; });
+            for (const auto &[slotName, value] : node.defaults)
+            {
+                const bool perFile = (node.id == inputNodeId && slotName == "FilePath")
+                                     || (node.id == outputNodeId && (slotName == "SavePath" || slotName == "AutoSave"));
+                if (perFile || !value)
+                {
+                    continue;
+                }
+                const auto *path = std::get_if<std::filesystem::path>(value.get());
+                const auto fingerprint = path ? Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ path->string() })
+                                              : Nodes::NodeOutputCache::Fingerprint(*value);
+                canonical += "default " + slotName + " " + std::to_string(fingerprint) + "\n";
+            }
+        }
+
+        std::vector<std::string> connections;
+        for (const auto &connection : snapshot->connections)
+        {
+            connections.push_back("connection " + std::to_string(connection.from) + " " + connection.fromSlot.Str()
+                                  + " " + std::to_string(connection.to) + " " + connection.toSlot.Str() + " "
+                                  + std::to_string(static_cast<int>(connection.type)) + "\n");
+        }
+        std::ranges::sort(connections);
+        for (const auto &connection : connections)
+        {
+            canonical += connection;
+        }
+
+        return Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ canonical });
+    }
+
+    void BatchManifest::StartHeartbeat()
+    {
+        // A process working on one slow file appends nothing else, so it beats to keep its chunk
+        heartbeat = std::jthread([this](std::stop_token stopToken) {
+            while (true)
+            {
+                SleepFor(options.heartbeatInterval, stopToken);
+                if (stopToken.stop_requested())
+                {
+                    break;
+                }
+                std::scoped_lock lock(mutex);
+                Beat();
+            }
+        });
+    }
+
+    void BatchManifest::Beat()
+    {
+        const auto wallTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch());
+        Append(std::string(kAliveRecord) + " " + owner + " " + std::to_string(wallTime.count()));
+    }
+
+    bool BatchManifest::Refresh()
+    {
+        std::ifstream stream(manifestPath, std::ios::binary);
+        if (!stream || !stream.seekg(static_cast<std::streamoff>(readOffset)))
+        {
+            return false;
+        }
+        const std::string appended{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+
+        // Only whole lines: a record without its newline is still being written or was cut short
+        const auto now = Clock::now();
+        size_t start = 0;
+        for (size_t newline = appended.find('\n'); newline != std::string::npos;
+            newline = appended.find('\n', start))
+        {
+            Apply(std::string_view(appended).substr(start, newline - start), now);
+            start = newline + 1;
+        }
+        readOffset += start;
+        return true;
+    }
+
+    void BatchManifest::Apply(std::string_view line, Clock::time_point now)
+    {
+        const auto fields = SplitRecord(line);
+        if (fields.size() == 3 && fields[0] == kAliveRecord)
+        {
+            // Beats carry wall-clock time, so a manifest opened after a crash sees how long ago its owner died
+            const auto wallTime = ParseIndex(fields[2]);
+            if (wallTime)
+            {
+                const auto age = std::chrono::system_clock::now().time_since_epoch()
+                                 - std::chrono::milliseconds(static_cast<int64_t>(*wallTime));
+                const auto beatTime = now - std::chrono::duration_cast<Clock::duration>(std::max(age, age.zero()));
+                auto [seen, inserted] = lastSeen.try_emplace(std::string(fields[1]), beatTime);
+                seen->second = std::max(seen->second, beatTime);
+            }
+        }
+        else if (fields.size() == 2 && fields[0] == kLeaveRecord)
+        {
+            lastSeen.erase(std::string(fields[1]));
+        }
+        else if (fields.size() == 3 && (fields[0] == kSucceededRecord || fields[0] == kFailedRecord))
+        {
+            const auto index = ParseIndex(fields[1]);
+            if (index && *index < files.size())
+            {
+                SetState(*index, fields[0] == kSucceededRecord ? FileState::Succeeded : FileState::Failed);
+            }
+        }
+        else if (fields.size() == 4 && fields[0] == kClaimRecord)
+        {
+            const auto chunk = ParseIndex(fields[1]);
+            const auto generation = ParseIndex(fields[2]);
+            if (chunk && generation && *chunk < chunks.size() && *generation == chunks[*chunk].generation + 1)
+            {
+                chunks[*chunk].generation = *generation;
+                chunks[*chunk].owner = std::string(fields[3]);
+            }
+        }
+        // Anything else is a record a crash cut short; its file is simply processed again
+    }
+
+    void BatchManifest::SetState(size_t index, FileState state)
+    {
+        if (states[index] != FileState::Unhandled)
+        {
+            return;
+        }
+        states[index] = state;
+        ++handled;
+        --chunks[index / chunkFiles].unhandled;
+    }
+
+    void BatchManifest::Append(const std::string &record)
+    {
+        const auto line = record + "\n";
+        const bool written =
+            journal && std::fwrite(line.data(), 1, line.size(), journal) == line.size() && std::fflush(journal) == 0;
+        if (!written && !writeFailed)
+        {
+            LOG_ERROR("Batch: cannot append to manifest '{}'; progress is no longer checkpointed",
+                manifestPath.string());
+        }
+        writeFailed = writeFailed || !written;
+    }
+
+    std::optional<size_t> BatchManifest::FindClaimableChunk(Clock::time_point now) const
+    {
+        std::optional<size_t> abandoned;
+        for (size_t chunk = 0; chunk < chunks.size(); ++chunk)
+        {
+            const auto &claim = chunks[chunk];
+            if (claim.unhandled == 0)
+            {
+                continue;
+            }
+            if (claim.generation == 0)
+            {
+                return chunk;
+            }
+
+            // This process's own chunks with unhandled files are still in its pipeline; owners that never
+            // beat are dead, as every process beats before its first claim
+            if (!abandoned && claim.owner != owner)
+            {
+                const auto seen = lastSeen.find(claim.owner);
+                if (seen == lastSeen.end() || now - seen->second >= options.leaseTimeout)
+                {
+                    abandoned = chunk;
+                }
+            }
+        }
+        return abandoned;
+    }
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Settings of a checkpoint manifest.
+     */
+    struct ManifestOptions
+    {
+        size_t chunkFiles = Constants::Batch::kManifestChunkFiles; ///< Files per claim (used when creating)
+
+        std::chrono::milliseconds leaseTimeout{ Constants::Batch::kManifestLeaseMilliseconds };           ///< Silence
+        std::chrono::milliseconds heartbeatInterval{ Constants::Batch::kManifestHeartbeatMilliseconds }; ///< Liveness
+        std::chrono::milliseconds pollInterval{ Constants::Batch::kManifestPollMilliseconds };           ///< Waiting
+    };
+
+    /**
+     * @brief Checkpoint of a batch job: its graph, its input files and which of them are handled.
+     *
+     * The manifest is one append-only file. The first line records the graph hash, the chunk size and the
+     * input list; every later line is one short record appended and flushed on its own: a chunk claim, a
+     * file that succeeded or failed, a liveness beat, or a process leaving. A record cut short by a crash
+     * lacks its newline; the next process to open the manifest marks it invalid, so the file is always
+     * consistent, and updating it costs one small write per file instead of rewriting a 200k-entry list.
+     *
+     * Opening an existing manifest resumes it: files already handled are never handed out again. Several
+     * processes may open the same manifest at once (appends to one local file do not interleave). Each
+     * claims chunks of files by appending a claim and reading the file back; the first claim of a chunk
+     * wins. Processes beat every heartbeatInterval with their wall-clock time; a chunk whose owner has not
+     * beaten for leaseTimeout, e.g. after a crash, is claimed again, and only its unhandled files are
+     * processed. A process that closes the manifest releases its chunks at once. Use BatchFarm for
+     * machines sharing network storage, where appends from different hosts may interleave and clocks differ.
+     *
+     * All methods are thread-safe.
+     */
+    class BatchManifest
+    {
+    public:
+        /**
+         * @brief Opens a manifest, creating it if it does not exist.
+         * @param manifestPath Manifest file
+         * @param graphHash HashGraph() of the graph about to run; must match an existing manifest's
+         * @param files Input files (ignored when resuming: the manifest's own list is used)
+         * @param options Chunk size and lease timing
+         * @return Manifest, or nullptr if it is unreadable, unwritable or was made for another graph
+         */
+        [[nodiscard]] static std::unique_ptr<BatchManifest> Open(const std::filesystem::path &manifestPath,
+            uint64_t graphHash,
+            const std::vector<std::filesystem::path> &files,
+            const ManifestOptions &options = {});
+
+        /**
+         * @brief Stops the liveness beat, releases this process's chunks and closes the file.
+         */
+        ~BatchManifest();
+
+        BatchManifest(const BatchManifest &) = delete;
+        BatchManifest &operator=(const BatchManifest &) = delete;
+
+        /**
+         * @brief Returns the job's input files.
+         * @return Files in manifest order; indices refer to this list
+         */
+        [[nodiscard]] const std::vector<std::filesystem::path> &GetFiles() const
+        {
+            return files;
+        }
+
+        /**
+         * @brief Returns files with a recorded outcome, from any process.
+         * @return Handled file count as of the last read of the manifest
+         */
+        [[nodiscard]] size_t GetHandledCount() const;
+
+        /**
+         * @brief Hands out the next unhandled file, claiming a new chunk when the current one runs out.
+         * @param stopToken Token to stop waiting for other processes' chunks
+         * @return Index into GetFiles(), or std::nullopt once every file is handled or handed out
+         * @note Blocks while the only unhandled files belong to live processes, as they may still fall silent.
+         */
+        [[nodiscard]] std::optional<size_t> Next(std::stop_token stopToken);
+
+        /**
+         * @brief Records a file's outcome.
+         * @param index Index from Next()
+         * @param succeeded True if the result was written
+         */
+        void Record(size_t index, bool succeeded);
+
+        /**
+         * @brief Hashes what a batch's results depend on: node types, connections and slot defaults.
+         * @param editor Editor holding the graph
+         * @param inputNodeId Batch input node, whose FilePath changes with every file
+         * @param outputNodeId Batch output node, whose SavePath and AutoSave the batch does not use
+         * @return Hash, stable across processes and sessions
+         * @note Path defaults are hashed by their text only, not the file behind them.
+         */
+        [[nodiscard]] static uint64_t HashGraph(const Nodes::NodeEditor &editor,
+            Nodes::NodeId inputNodeId,
+            Nodes::NodeId outputNodeId);
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Outcome recorded for a file.
+         */
+        enum class FileState : uint8_t
+        {
+            Unhandled,
+            Succeeded,
+            Failed
+        };
+
+        /**
+         * @brief Current claim of a chunk.
+         */
+        struct ChunkClaim
+        {
+            uint64_t generation = 0; ///< Claims made so far (0 = never claimed)
+            std::string owner;       ///< Process holding it
+            size_t unhandled = 0;    ///< Files of the chunk without an outcome
+        };
+
+        BatchManifest(std::filesystem::path manifestPath,
+            std::vector<std::filesystem::path> files,
+            size_t chunkFiles,
+            const ManifestOptions &options);
+
+        /**
+         * @brief Starts appending liveness beats.
+         */
+        void StartHeartbeat();
+
+        /**
+         * @brief Appends one liveness beat with the current wall-clock time.
+         */
+        void Beat();
+
+        /**
+         * @brief Reads records appended since the last call, by any process.
+         * @return False if the file cannot be read
+         */
+        bool Refresh();
+
+        /**
+         * @brief Applies one record line.
+         * @param line Record without its newline
+         * @param now Time the record was read, to place beats on the steady clock
+         */
+        void Apply(std::string_view line, Clock::time_point now);
+
+        /**
+         * @brief Marks a file handled.
+         * @param index File index
+         * @param state Outcome
+         */
+        void SetState(size_t index, FileState state);
+
+        /**
+         * @brief Appends one record line and flushes it.
+         * @param record Record without its newline
+         */
+        void Append(const std::string &record);
+
+        /**
+         * @brief Picks a chunk another process could not be working on.
+         * @param now Current time
+         * @return Unclaimed chunk, or one whose owner fell silent; std::nullopt if there is none
+         */
+        [[nodiscard]] std::optional<size_t> FindClaimableChunk(Clock::time_point now) const;
+
+        std::filesystem::path manifestPath;       ///< Manifest file
+        std::vector<std::filesystem::path> files; ///< Input files from the header
+        size_t chunkFiles;                        ///< Files per chunk, from the header
+        ManifestOptions options;                  ///< Lease timing
+        std::string owner;                        ///< This process's token in claims and outcomes
+
+        mutable std::mutex mutex;                                    ///< Guards everything below
+        std::FILE *journal = nullptr;                                ///< Opened for appending
+        uint64_t readOffset = 0;                                     ///< Bytes of the manifest already applied
+        std::vector<FileState> states;                               ///< Outcome of every file
+        std::vector<ChunkClaim> chunks;                              ///< Claim of every chunk
+        std::unordered_map<std::string, Clock::time_point> lastSeen; ///< Latest beat of each owner
+        size_t handled = 0;                                          ///< Files with an outcome
+        std::optional<size_t> currentChunk;                          ///< Chunk being handed out
+        size_t cursor = 0;                                           ///< Next file of currentChunk
+        bool writeFailed = false;                                    ///< An append failed (logged once)
+
+        std::jthread heartbeat; ///< Appends liveness beats
+    };
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,472 @@
+#include "Vision/IO/BatchProcessor.h"
+#include "Logger.h"
+#include "Nodes/Core/BoundedQueue.h"
+#include "Nodes/Core/NodeTypeRegistry.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Nodes/Core/Tracer.h"
+#include "Vision/IO/BatchManifest.h"
+#include "Vision/IO/ImageCodec.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <opencv2/opencv.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <future>
+#include <mutex>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr std::array<std::string_view, 7> kImageExtensions = {
+            ".png", ".jpg", ".jpeg", ".bmp", ".tif", ".tiff", ".webp"
+        };
+
+        /**
+         * @brief Image decoded by the first stage, waiting for graph execution.
+         */
+        struct DecodedImage
+        {
+            size_t index = 0;             ///< Position in the run's file list
+            std::filesystem::path source; ///< Input file
+            cv::Mat image;                ///< Decoded pixels
+        };
+
+        /**
+         * @brief Graph result waiting for the encode stage.
+         */
+        struct EncodeJob
+        {
+            size_t index = 0;                             ///< Position in the run's file list
+            std::filesystem::path source;                 ///< Input file (for progress reporting)
+            std::filesystem::path destination;            ///< Output file
+            cv::Mat image;                                ///< Result owned by the job
+            std::chrono::microseconds executionTime{ 0 }; ///< Graph run time of the file
+        };
+
+        // Mirrors the file's location below inputDirectory, falling back to the bare file name
+        std::filesystem::path MakeOutputPath(const std::filesystem::path &file,
+            const BatchOptions &options,
+            const std::string &format)
+        {
+            std::filesystem::path relative = file.filename();
+            if (!options.inputDirectory.empty())
+            {
+                const auto candidate = file.lexically_relative(options.inputDirectory);
+                if (!candidate.empty() && *candidate.begin() != "..")
+                {
+                    relative = candidate;
+                }
+            }
+
+            auto destination = options.outputDirectory / relative;
+            destination.replace_extension("." + format);
+            return destination;
+        }
+    } // namespace
+
+    BatchProcessor::BatchProcessor(Nodes::NodeEditor &nodeEditor) : nodeEditor(nodeEditor)
+    {
+    }
+
+    std::optional<BatchResult> BatchProcessor::Run(const BatchOptions &options,
+        const BatchProgressCallback &progressCallback,
+        std::stop_token stopToken)
+    {
+        std::error_code error;
+        if (!std::filesystem::is_directory(options.inputDirectory, error))
+        {
+            LOG_ERROR("Batch input directory does not exist: {}", options.inputDirectory.string());
+            return std::nullopt;
+        }
+
+        const auto files = CollectImageFiles(options.inputDirectory, options.recursive);
+        LOG_INFO("Batch found {} images in {}", files.size(), options.inputDirectory.string());
+        return RunFiles(files, options, progressCallback, stopToken);
+    }
+
+    std::optional<BatchResult> BatchProcessor::RunFiles(const std::vector<std::filesystem::path> &files,
+        const BatchOptions &options,
+        const BatchProgressCallback &progressCallback,
+        std::stop_token stopToken)
+    {
+        if (options.outputDirectory.empty())
+        {
+            LOG_ERROR("Batch output directory is not set");
+            return std::nullopt;
+        }
+
+        auto *inputNode = dynamic_cast<ImageInputNode *>(FindNode(options.inputNodeId, "ImageInputNode"));
+        auto *outputNode = dynamic_cast<ImageOutputNode *>(FindNode(options.outputNodeId, "ImageOutputNode"));
+        if (!inputNode || !outputNode)
+        {
+            return std::nullopt;
+        }
+
+        const std::string format = !options.outputFormat.empty()
+                                       ? options.outputFormat
+                                       : outputNode->GetInputValue<std::string>("Format").value_or("png");
+        const auto profile =
+            ImageOutputNode::ParseEncodeProfile(outputNode->GetInputValue<std::string>("Profile").value_or(""));
+        const auto encodeParams = ImageOutputNode::GetEncodeParams(format, profile.value_or(EncodeProfile::Balanced));
+
+        // A manifest that exists already brings its own file list and the outcomes of earlier runs
+        std::unique_ptr<BatchManifest> manifest;
+        if (!options.manifestPath.empty())
+        {
+            manifest = BatchManifest::Open(options.manifestPath,
+                BatchManifest::HashGraph(nodeEditor, inputNode->GetId(), outputNode->GetId()),
+                files);
+            if (!manifest)
+            {
+                return std::nullopt;
+            }
+        }
+        const auto &jobFiles = manifest ? manifest->GetFiles() : files;
+        const size_t skipped = manifest ? manifest->GetHandledCount() : 0;
+
+        // Encoding belongs to the pipeline; per-file results are only reused by a later rerun of the batch,
+        // so the cache stays on only when a persistent store can carry them over
+        const bool previousAutoSave = outputNode->GetInputValue<bool>("AutoSave").value_or(false);
+        const bool previousOutputCache = nodeEditor.IsOutputCacheEnabled();
+        const auto previousTimeout = nodeEditor.GetExecutionTimeout();
+        outputNode->SetInputSlotDefault("AutoSave", false);
+        nodeEditor.SetOutputCacheEnabled(previousOutputCache && nodeEditor.GetOutputCache().GetPersistentStore());
+        nodeEditor.SetExecutionTimeout(options.fileTimeout);
+
+        const auto startTime = std::chrono::steady_clock::now();
+        std::atomic<size_t> nextFile{ 0 };
+        std::atomic<size_t> dispatched{ 0 };
+        std::atomic<bool> exhausted{ false };
+        std::atomic<size_t> completed{ 0 };
+        std::atomic<size_t> succeeded{ 0 };
+        std::atomic<size_t> failed{ 0 };
+        size_t timedOut = 0; // Only touched by the execute stage
+        std::mutex progressMutex;
+        std::vector<std::filesystem::path> failedFiles; // Guarded by progressMutex
+
+        // Hands out files from the manifest, or in order; std::nullopt when none are left or on stop
+        auto takeFile = [&]() -> std::optional<size_t> {
+            std::optional<size_t> index;
+            if (manifest)
+            {
+                index = manifest->Next(stopToken);
+            }
+            else if (const size_t next = nextFile.fetch_add(1); next < jobFiles.size())
+            {
+                index = next;
+            }
+
+            if (stopToken.stop_requested())
+            {
+                return std::nullopt;
+            }
+            if (!index)
+            {
+                exhausted.store(true);
+                return std::nullopt;
+            }
+            dispatched.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        };
+
+        auto finishFile = [&](size_t index,
+                              bool success,
+                              const std::filesystem::path &destination = {},
+                              std::chrono::microseconds executionTime = {}) {
+            const auto &file = jobFiles[index];
+            if (options.itemCallback)
+            {
+                options.itemCallback({ file, success ? destination : std::filesystem::path{}, success, executionTime });
+            }
+            if (manifest)
+            {
+                manifest->Record(index, success);
+            }
+            (success ? succeeded : failed).fetch_add(1, std::memory_order_relaxed);
+            const size_t done = completed.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (progressCallback || !success)
+            {
+                std::scoped_lock lock(progressMutex);
+                if (!success)
+                {
+                    failedFiles.push_back(file);
+                }
+                if (progressCallback)
+                {
+                    progressCallback(skipped + done, jobFiles.size(), file);
+                }
+            }
+        };
+
+        Nodes::BoundedQueue<DecodedImage> decodedQueue(options.queueCapacity);
+        Nodes::BoundedQueue<EncodeJob> encodeQueue(options.queueCapacity);
+
+        // Stage backlogs for the runner's metrics, sampled once per file by the execute stage. Decode counts
+        // the files this process has not taken yet; processes sharing a manifest take some of them.
+        auto &metrics = Nodes::RuntimeMetrics::Get();
+        auto reportQueueDepths = [&]() {
+            if (!metrics.IsEnabled())
+            {
+                return;
+            }
+            const size_t taken = std::min(jobFiles.size(), skipped + dispatched.load(std::memory_order_relaxed));
+            metrics.SetQueueDepth(Nodes::PipelineStage::Decode, jobFiles.size() - taken);
+            metrics.SetQueueDepth(Nodes::PipelineStage::Compute, decodedQueue.Size());
+            metrics.SetQueueDepth(Nodes::PipelineStage::Encode, encodeQueue.Size());
+        };
+
+        // Decode and encode loops run as jobs on the editor's executor service, whose threads outlive the batch
+        auto &executor = nodeEditor.GetExecutorService();
+        auto waitFor = [](const std::vector<std::shared_future<void>> &stages) {
+            for (const auto &stage : stages)
+            {
+                stage.wait();
+            }
+        };
+
+        // Stage 3: encode
+        std::vector<std::shared_future<void>> encoders;
+        for (size_t i = 0; i < std::max<size_t>(1, options.encodeWorkers); ++i)
+        {
+            encoders.push_back(executor.Launch([&, i]() {
+                Nodes::Tracer::Get().SetCurrentThreadName("Batch encode " + std::to_string(i));
+                while (auto job = encodeQueue.Pop())
+                {
+                    Nodes::TraceScope trace("io", "Encode");
+                    if (trace.IsActive())
+                    {
+                        trace.SetDetail(job->destination.filename().string());
+                    }
+
+                    bool written = false;
+                    try
+                    {
+                        std::error_code directoryError;
+                        std::filesystem::create_directories(job->destination.parent_path(), directoryError);
+                        written = ImageCodec::Write(job->destination, job->image, encodeParams);
+                    }
+                    catch (const cv::Exception &e)
+                    {
+                        LOG_ERROR("Batch: OpenCV error writing '{}': {}", job->destination.string(), e.what());
+                    }
+
+                    if (!written)
+                    {
+                        LOG_ERROR("Batch: failed to write '{}'", job->destination.string());
+                    }
+                    finishFile(job->index, written, job->destination, job->executionTime);
+                }
+            }));
+        }
+
+        // Stage 1: decode
+        const size_t decoderCount = std::max<size_t>(1, options.decodeWorkers);
+        std::atomic<size_t> activeDecoders{ decoderCount };
+        std::vector<std::shared_future<void>> decoders;
+        for (size_t i = 0; i < decoderCount; ++i)
+        {
+            decoders.push_back(executor.Launch([&, i]() {
+                Nodes::Tracer::Get().SetCurrentThreadName("Batch decode " + std::to_string(i));
+                while (const auto next = takeFile())
+                {
+                    const size_t index = *next;
+                    cv::Mat image;
+                    {
+                        Nodes::TraceScope trace("io", "Decode");
+                        if (trace.IsActive())
+                        {
+                            trace.SetDetail(jobFiles[index].filename().string());
+                        }
+
+                        try
+                        {
+                            image = ImageCodec::Read(jobFiles[index]);
+                        }
+                        catch (const cv::Exception &e)
+                        {
+                            LOG_ERROR("Batch: OpenCV error reading '{}': {}", jobFiles[index].string(), e.what());
+                        }
+                    }
+
+                    if (image.empty())
+                    {
+                        LOG_ERROR("Batch: failed to read '{}'", jobFiles[index].string());
+                        finishFile(index, false);
+                        continue;
+                    }
+
+                    if (!decodedQueue.Push({ index, jobFiles[index], std::move(image) }))
+                    {
+                        break;
+                    }
+                }
+
+                if (activeDecoders.fetch_sub(1) == 1)
+                {
+                    decodedQueue.Close();
+                }
+            }));
+        }
+
+        // Stage 2: execute the graph on this thread (the editor runs one execution at a time)
+        while (auto decoded = decodedQueue.Pop())
+        {
+            reportQueueDepths();
+            if (stopToken.stop_requested())
+            {
+                break;
+            }
+
+            inputNode->SetPreloadedImage(decoded->source, std::move(decoded->image));
+            // Batches write their results, so they never run at the editor's proxy scale
+            const auto executionStart = std::chrono::steady_clock::now();
+            const bool executed = nodeEditor.ExecuteFullResolution(nullptr, stopToken);
+            const auto executionTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - executionStart);
+            if (!executed && stopToken.stop_requested())
+            {
+                break;
+            }
+            if (const auto run = nodeEditor.GetExecutionStatistics().GetLatest(); !executed && run && run->timedOut)
+            {
+                LOG_ERROR(
+                    "Batch: '{}' exceeded the {} ms timeout", decoded->source.string(), options.fileTimeout.count());
+                ++timedOut;
+                finishFile(decoded->index, false, {}, executionTime);
+                continue;
+            }
+
+            // Clone: nodes reuse their output buffers, so the next file would overwrite a queued result
+            cv::Mat result = executed ? outputNode->GetDisplayImage().clone() : cv::Mat{};
+            if (result.empty())
+            {
+                LOG_ERROR("Batch: graph produced no output for '{}'", decoded->source.string());
+                finishFile(decoded->index, false, {}, executionTime);
+                continue;
+            }
+
+            encodeQueue.Push({ decoded->index,
+                decoded->source,
+                MakeOutputPath(decoded->source, options, format),
+                std::move(result),
+                executionTime });
+        }
+
+        // Unblock decoders waiting on a full queue after cancellation, then drain the encoders
+        decodedQueue.Close();
+        waitFor(decoders);
+        encodeQueue.Close();
+        waitFor(encoders);
+        reportQueueDepths();
+
+        outputNode->SetInputSlotDefault("AutoSave", previousAutoSave);
+        nodeEditor.SetOutputCacheEnabled(previousOutputCache);
+        nodeEditor.SetExecutionTimeout(previousTimeout);
+
+        BatchResult result;
+        result.total = jobFiles.size();
+        result.skipped = skipped;
+        result.succeeded = succeeded.load();
+        result.failed = failed.load();
+        result.timedOut = timedOut;
+        result.failedFiles = std::move(failedFiles);
+        result.cancelled = !exhausted.load() || completed.load() < dispatched.load();
+        result.elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+
+        LOG_INFO("Batch finished: {} written, {} failed ({} timed out), {} done before, {} total in {} ms{}",
+            result.succeeded,
+            result.failed,
+            result.timedOut,
+            result.skipped,
+            result.total,
+            result.elapsed.count(),
+            result.cancelled ? " (cancelled)" : "");
+        return result;
+    }
+
+    std::vector<std::filesystem::path> BatchProcessor::CollectImageFiles(const std::filesystem::path &directory,
+        bool recursive)
+    {
+        std::vector<std::filesystem::path> files;
+        std::error_code error;
+        const auto options = std::filesystem::directory_options::skip_permission_denied;
+
+        auto collect = [&](auto iterator) {
+            for (const auto &entry : iterator)
+            {
+                if (entry.is_regular_file(error) && IsSupportedImageFile(entry.path()))
+                {
+                    files.push_back(entry.path());
+                }
+            }
+        };
+
+        if (recursive)
+        {
+            collect(std::filesystem::recursive_directory_iterator(directory, options, error));
+        }
+        else
+        {
+            collect(std::filesystem::directory_iterator(directory, options, error));
+        }
+
+        if (error)
+        {
+            LOG_WARN("Batch: error scanning '{}': {}", directory.string(), error.message());
+        }
+
+        std::ranges::sort(files);
+        return files;
+    }
+
+    bool BatchProcessor::IsSupportedImageFile(const std::filesystem::path &path)
+    {
+        auto extension = path.extension().string();
+        std::ranges::transform(
+            extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return std::ranges::find(kImageExtensions, extension) != kImageExtensions.end();
+    }
+
+    Nodes::Node *BatchProcessor::FindNode(std::optional<Nodes::NodeId> nodeId, const std::string &nodeType) const
+    {
+        const auto typeId = Nodes::NodeTypeRegistry::Intern(nodeType);
+        if (nodeId)
+        {
+            auto *node = nodeEditor.GetNode(*nodeId);
+            if (!node || node->GetTypeId() != typeId)
+            {
+                LOG_ERROR("Batch: node {} is not a {}", *nodeId, nodeType);
+                return nullptr;
+            }
+            return node;
+        }
+
+        Nodes::Node *match = nullptr;
+        for (const auto id : nodeEditor.GetNodeIds())
+        {
+            auto *node = nodeEditor.GetNode(id);
+            if (node && node->GetTypeId() == typeId)
+            {
+                if (match)
+                {
+                    LOG_ERROR("Batch: graph has several {}s, choose one explicitly", nodeType);
+                    return nullptr;
+                }
+                match = node;
+            }
+        }
+
+        if (!match)
+        {
+            LOG_ERROR("Batch: graph has no {}", nodeType);
+        }
+        return match;
+    }
+
+} // namespace VisionCraft::Vision::IO
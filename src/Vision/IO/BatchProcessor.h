@@ -0,0 +1,157 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Outcome of one file of a batch run.
+     */
+    struct BatchItem
+    {
+        std::filesystem::path source;                 ///< Input file
+        std::filesystem::path destination;            ///< Written result (empty if the file failed)
+        bool succeeded = false;                       ///< Result written
+        std::chrono::microseconds executionTime{ 0 }; ///< Graph run time (zero if the file was not decoded)
+    };
+
+    /**
+     * @brief Per-file callback, invoked from pipeline threads once a file is written or has failed.
+     * @param item Outcome of the file
+     */
+    using BatchItemCallback = std::function<void(const BatchItem &item)>;
+
+    /**
+     * @brief Settings for a batch run.
+     */
+    struct BatchOptions
+    {
+        std::filesystem::path inputDirectory;                           ///< Directory scanned for images
+        std::filesystem::path outputDirectory;                          ///< Results, mirroring input layout
+        std::optional<Nodes::NodeId> inputNodeId;                       ///< Input node (empty = the only one)
+        std::optional<Nodes::NodeId> outputNodeId;                      ///< Output node (empty = the only one)
+        std::string outputFormat;                                       ///< Extension (empty = node's Format)
+        bool recursive = false;                                         ///< Include subdirectories
+        size_t decodeWorkers = Constants::Batch::kDefaultDecodeWorkers; ///< Threads decoding (ImageCodec::Read)
+        size_t encodeWorkers = Constants::Batch::kDefaultEncodeWorkers; ///< Threads encoding (ImageCodec::Write)
+        size_t queueCapacity = Constants::Batch::kDefaultQueueCapacity; ///< Images buffered per queue
+        std::chrono::milliseconds fileTimeout{ 0 };                     ///< Execution limit per file (zero = none)
+        std::filesystem::path manifestPath;                             ///< Checkpoint to resume (empty = none)
+        BatchItemCallback itemCallback;                                 ///< Receives each file's outcome (optional)
+    };
+
+    /**
+     * @brief Outcome of a batch run.
+     */
+    struct BatchResult
+    {
+        size_t total = 0;                               ///< Files scheduled
+        size_t skipped = 0;                             ///< Files the manifest already had an outcome for
+        size_t succeeded = 0;                           ///< Files written
+        size_t failed = 0;                              ///< Files that failed to decode, execute or encode
+        size_t timedOut = 0;                            ///< Failed files whose execution hit fileTimeout
+        bool cancelled = false;                         ///< Stopped before all files were handled
+        std::chrono::milliseconds elapsed{ 0 };         ///< Wall-clock duration
+        std::vector<std::filesystem::path> failedFiles; ///< Inputs that failed, in completion order
+    };
+
+    /**
+     * @brief Progress callback, invoked from pipeline threads.
+     * @param completed Files finished so far (succeeded or failed)
+     * @param total Files scheduled
+     * @param file Input file just finished
+     */
+    using BatchProgressCallback =
+        std::function<void(size_t completed, size_t total, const std::filesystem::path &file)>;
+
+    /**
+     * @brief Runs one graph over many image files as a three-stage pipeline.
+     *
+     * Decoding, graph execution and encoding (ImageCodec, accelerated for JPEG) run on separate threads
+     * connected by bounded queues, so disk I/O overlaps with compute and memory stays bounded.
+     * The decode and encode loops are jobs on the editor's ExecutorService, so batches reuse its threads.
+     * The graph itself executes on the calling thread, one file at a time, with the decoded image
+     * handed to its ImageInputNode and the ImageOutputNode result passed on for encoding with the
+     * node's encoder Profile (thumbnails are not written by batches).
+     *
+     * While running, the output node's AutoSave is disabled (encoding happens in the pipeline), the
+     * editor's output cache is disabled unless it has a PersistentOutputStore (per-file results are only
+     * reused by a later rerun of the batch), and the editor's execution timeout is set to fileTimeout so
+     * one pathological image fails instead of stalling the batch; all three are restored afterwards.
+     *
+     * With a manifestPath, files are taken from a BatchManifest and every outcome is appended to it, so a
+     * crashed or stopped run started again with the same manifest processes only the files left, and
+     * several processes given the same manifest share its files.
+     */
+    class BatchProcessor
+    {
+    public:
+        /**
+         * @brief Constructs processor for a graph.
+         * @param nodeEditor Editor holding the graph (must outlive the processor)
+         */
+        explicit BatchProcessor(Nodes::NodeEditor &nodeEditor);
+
+        /**
+         * @brief Processes every supported image in options.inputDirectory.
+         * @param options Batch settings
+         * @param progressCallback Optional progress reporter
+         * @param stopToken Token for cancellation between files
+         * @return Result, or std::nullopt if the graph or directories are unusable
+         */
+        [[nodiscard]] std::optional<BatchResult> Run(const BatchOptions &options,
+            const BatchProgressCallback &progressCallback = nullptr,
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Processes an explicit list of files.
+         * @param files Input image files (with a manifest that exists already, its own list is used)
+         * @param options Batch settings (inputDirectory only used to mirror the layout)
+         * @param progressCallback Optional progress reporter
+         * @param stopToken Token for cancellation between files
+         * @return Result, or std::nullopt if the graph or the manifest is unusable
+         */
+        [[nodiscard]] std::optional<BatchResult> RunFiles(const std::vector<std::filesystem::path> &files,
+            const BatchOptions &options,
+            const BatchProgressCallback &progressCallback = nullptr,
+            std::stop_token stopToken = {});
+
+        /**
+         * @brief Lists supported image files in a directory, sorted by path.
+         * @param directory Directory to scan
+         * @param recursive Include subdirectories
+         * @return Image file paths
+         */
+        [[nodiscard]] static std::vector<std::filesystem::path> CollectImageFiles(
+            const std::filesystem::path &directory,
+            bool recursive);
+
+        /**
+         * @brief Checks if a file has an image extension handled by OpenCV.
+         * @param path File path
+         * @return True for png, jpg, jpeg, bmp, tif, tiff and webp (case-insensitive)
+         */
+        [[nodiscard]] static bool IsSupportedImageFile(const std::filesystem::path &path);
+
+    private:
+        /**
+         * @brief Finds the graph's node of a type, or validates the requested one.
+         * @param nodeId Requested node (empty = the only node of that type)
+         * @param nodeType Node::GetType() value
+         * @return Node, or nullptr (error is logged)
+         */
+        [[nodiscard]] Nodes::Node *FindNode(std::optional<Nodes::NodeId> nodeId, const std::string &nodeType) const;
+
+        Nodes::NodeEditor &nodeEditor; ///< Graph being executed
+    };
+
+} // namespace VisionCraft::Vision::IO
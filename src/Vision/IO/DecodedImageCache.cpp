@@ -0,0 +1,223 @@
+#include "Vision/IO/DecodedImageCache.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/Tracer.h"
+#include "Vision/IO/ImageCodec.h"
+
+#include <exception>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        int DecodeFlags(int reduction)
+        {
+            switch (reduction)
+            {
+            case 2:
+                return cv::IMREAD_REDUCED_COLOR_2;
+            case 4:
+                return cv::IMREAD_REDUCED_COLOR_4;
+            case 8:
+                return cv::IMREAD_REDUCED_COLOR_8;
+            default:
+                return cv::IMREAD_COLOR;
+            }
+        }
+    } // namespace
+
+    DecodedImageCache &DecodedImageCache::Get()
+    {
+        static DecodedImageCache cache(Constants::Cache::kDefaultDecodedImageBytes);
+        return cache;
+    }
+
+    DecodedImageCache::DecodedImageCache(size_t byteBudget) : byteBudget(byteBudget)
+    {
+    }
+
+    cv::Mat DecodedImageCache::Load(const std::filesystem::path &path, int reduction)
+    {
+        std::error_code error;
+        FileStamp stamp;
+        stamp.size = std::filesystem::file_size(path, error);
+        if (!error)
+        {
+            stamp.modified = std::filesystem::last_write_time(path, error);
+        }
+        if (error)
+        {
+            return {};
+        }
+
+        // Relative and absolute spellings of one file share an entry; reduced decodes get their own
+        const int flags = DecodeFlags(reduction);
+        const auto absolute = std::filesystem::absolute(path, error);
+        std::string key = (error ? path : absolute).lexically_normal().string();
+        if (flags != cv::IMREAD_COLOR)
+        {
+            key += "#1/" + std::to_string(reduction);
+        }
+
+        std::promise<cv::Mat> decoded;
+        {
+            std::unique_lock lock(mutex);
+            if (const auto found = entries.find(key); found != entries.end())
+            {
+                if (found->second.stamp == stamp)
+                {
+                    ++stats.hits;
+                    lruOrder.splice(lruOrder.begin(), lruOrder, found->second.lruPosition);
+                    return found->second.image;
+                }
+                ++stats.evictions;
+                Remove(found);
+            }
+
+            if (const auto decoding = pending.find(key); decoding != pending.end() && decoding->second.stamp == stamp)
+            {
+                ++stats.hits;
+                const auto result = decoding->second.result;
+                lock.unlock();
+                return result.get(); // Rethrows the decoding thread's exception
+            }
+
+            ++stats.misses;
+            pending.insert_or_assign(key, PendingDecode{ stamp, decoded.get_future().share() });
+        }
+
+        // Only the newest decode of a path publishes its result; a decode overtaken by a file change does not
+        const auto finish = [&](const cv::Mat *image) {
+            std::scoped_lock lock(mutex);
+            const auto decoding = pending.find(key);
+            if (decoding == pending.end() || decoding->second.stamp != stamp)
+            {
+                return;
+            }
+            pending.erase(decoding);
+
+            const size_t bytes = image ? image->total() * image->elemSize() : 0;
+            if (bytes == 0 || bytes > byteBudget)
+            {
+                return;
+            }
+            if (const auto found = entries.find(key); found != entries.end())
+            {
+                Remove(found);
+            }
+            lruOrder.push_front(key);
+            entries.emplace(key, Entry{ stamp, *image, bytes, lruOrder.begin() });
+            usedBytes += bytes;
+            EvictToBudget();
+        };
+
+        cv::Mat image;
+        try
+        {
+            Nodes::TraceScope trace("io", "DecodeImage");
+            if (trace.IsActive())
+            {
+                trace.SetDetail(key);
+            }
+            image = ImageCodec::Read(path, reduction);
+        }
+        catch (...)
+        {
+            decoded.set_exception(std::current_exception());
+            finish(nullptr);
+            throw;
+        }
+
+        decoded.set_value(image);
+        finish(&image);
+        return image;
+    }
+
+    std::shared_future<cv::Mat> DecodedImageCache::Prefetch(const std::filesystem::path &path, int reduction)
+    {
+        {
+            std::scoped_lock lock(mutex);
+            ++stats.prefetches;
+        }
+
+        auto decoded = std::make_shared<std::promise<cv::Mat>>();
+        auto result = decoded->get_future().share();
+        GetPrefetchPool().Submit([this, path, reduction, decoded]() {
+            try
+            {
+                decoded->set_value(Load(path, reduction));
+            }
+            catch (...)
+            {
+                decoded->set_exception(std::current_exception());
+            }
+        });
+        return result;
+    }
+
+    void DecodedImageCache::SetByteBudget(size_t newByteBudget)
+    {
+        std::scoped_lock lock(mutex);
+        byteBudget = newByteBudget;
+        EvictToBudget();
+    }
+
+    size_t DecodedImageCache::GetByteBudget() const
+    {
+        std::scoped_lock lock(mutex);
+        return byteBudget;
+    }
+
+    size_t DecodedImageCache::GetUsedBytes() const
+    {
+        std::scoped_lock lock(mutex);
+        return usedBytes;
+    }
+
+    size_t DecodedImageCache::GetEntryCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return entries.size();
+    }
+
+    DecodedImageCache::Statistics DecodedImageCache::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    void DecodedImageCache::Clear()
+    {
+        std::scoped_lock lock(mutex);
+        entries.clear();
+        lruOrder.clear();
+        usedBytes = 0;
+        stats = {};
+    }
+
+    Nodes::ThreadPool &DecodedImageCache::GetPrefetchPool()
+    {
+        std::call_once(prefetchPoolCreated,
+            [this]() { prefetchPool = std::make_unique<Nodes::ThreadPool>(Constants::Cache::kPrefetchThreads); });
+        return *prefetchPool;
+    }
+
+    void DecodedImageCache::Remove(std::unordered_map<std::string, Entry>::iterator position)
+    {
+        usedBytes -= position->second.bytes;
+        lruOrder.erase(position->second.lruPosition);
+        entries.erase(position);
+    }
+
+    void DecodedImageCache::EvictToBudget()
+    {
+        while (usedBytes > byteBudget && !lruOrder.empty())
+        {
+            Remove(entries.find(lruOrder.back()));
+            ++stats.evictions;
+        }
+    }
+
+} // namespace VisionCraft::Vision::IO
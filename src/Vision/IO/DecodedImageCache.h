@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Nodes/Core/ThreadPool.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Process-wide cache of decoded image files with an LRU byte budget.
+     *
+     * Shared by every ImageInputNode in every graph: rerunning a graph, or several nodes reading the same
+     * file, decodes it once. Entries are keyed by path and validated against the file's size and modification
+     * time on every lookup, so an edited file is decoded again. Concurrent lookups of a file being decoded
+     * wait for that decode instead of starting their own.
+     *
+     * Prefetch() starts a decode on the cache's own I/O threads, so a file can be read as soon as it is chosen
+     * rather than when the graph reaches it. Reduced-resolution decodes (cv::IMREAD_REDUCED_COLOR_2/4/8, which
+     * JPEG decodes at a fraction of the full cost) are separate entries of the same file, for fast first
+     * paint of previews.
+     *
+     * Returned images share pixels with the cache and must be treated as read-only.
+     *
+     * All methods are thread-safe; decoding runs outside the cache lock.
+     */
+    class DecodedImageCache
+    {
+    public:
+        /**
+         * @brief Cache counters.
+         */
+        struct Statistics
+        {
+            size_t hits = 0;       ///< Lookups served without decoding (including waits on another decode)
+            size_t misses = 0;     ///< Lookups that decoded the file
+            size_t evictions = 0;  ///< Entries dropped to stay under budget or replaced by a newer file
+            size_t prefetches = 0; ///< Prefetch() requests
+        };
+
+        /**
+         * @brief Returns the process-wide cache.
+         * @return Cache with a Constants::Cache::kDefaultDecodedImageBytes budget
+         */
+        [[nodiscard]] static DecodedImageCache &Get();
+
+        /**
+         * @brief Constructs cache.
+         * @param byteBudget Maximum bytes of cached pixels (0 disables caching)
+         */
+        explicit DecodedImageCache(size_t byteBudget);
+
+        DecodedImageCache(const DecodedImageCache &) = delete;
+        DecodedImageCache &operator=(const DecodedImageCache &) = delete;
+
+        /**
+         * @brief Returns decoded image of a file, decoding it on a miss.
+         * @param path Image file path
+         * @param reduction Downscale factor applied while decoding: 1 (full resolution), 2, 4 or 8
+         * @return Image decoded by ImageCodec::Read(), as cv::IMREAD_COLOR or the matching
+         *         cv::IMREAD_REDUCED_COLOR_* flag would; empty if the file is missing or unreadable
+         * @throws cv::Exception from cv::imread (failed decodes are not cached)
+         */
+        [[nodiscard]] cv::Mat Load(const std::filesystem::path &path, int reduction = 1);
+
+        /**
+         * @brief Starts decoding a file in the background.
+         * @param path Image file path
+         * @param reduction Downscale factor, as for Load()
+         * @return Future of the Load() result; a Load() of the same file meanwhile waits for this decode
+         * @note Prefetches still queued when the cache is destroyed are dropped (broken promise).
+         */
+        std::shared_future<cv::Mat> Prefetch(const std::filesystem::path &path, int reduction = 1);
+
+        /**
+         * @brief Changes byte budget, evicting entries if needed.
+         * @param byteBudget New budget in bytes
+         */
+        void SetByteBudget(size_t byteBudget);
+
+        /**
+         * @brief Returns byte budget.
+         * @return Budget in bytes
+         */
+        [[nodiscard]] size_t GetByteBudget() const;
+
+        /**
+         * @brief Returns bytes of cached pixels.
+         * @return Used bytes
+         */
+        [[nodiscard]] size_t GetUsedBytes() const;
+
+        /**
+         * @brief Returns number of cached images.
+         * @return Entry count
+         */
+        [[nodiscard]] size_t GetEntryCount() const;
+
+        /**
+         * @brief Returns cache counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+        /**
+         * @brief Drops every entry and resets counters.
+         */
+        void Clear();
+
+    private:
+        /**
+         * @brief File state an entry was decoded from.
+         */
+        struct FileStamp
+        {
+            uintmax_t size = 0;                         ///< File size in bytes
+            std::filesystem::file_time_type modified{}; ///< Last write time
+
+            bool operator==(const FileStamp &) const = default;
+        };
+
+        /**
+         * @brief Cached image.
+         */
+        struct Entry
+        {
+            FileStamp stamp;                              ///< File state at decode time
+            cv::Mat image;                                ///< Decoded pixels
+            size_t bytes = 0;                             ///< Pixel bytes
+            std::list<std::string>::iterator lruPosition; ///< Position in recency list
+        };
+
+        /**
+         * @brief Decode in progress.
+         */
+        struct PendingDecode
+        {
+            FileStamp stamp;                    ///< File state being decoded
+            std::shared_future<cv::Mat> result; ///< Completed by the decoding thread
+        };
+
+        /**
+         * @brief Returns thread pool running prefetches, creating it on first use.
+         * @return Pool with Constants::Cache::kPrefetchThreads workers
+         */
+        Nodes::ThreadPool &GetPrefetchPool();
+
+        /**
+         * @brief Drops entry and its recency position.
+         * @param position Entry to remove
+         * @note Caller must hold mutex.
+         */
+        void Remove(std::unordered_map<std::string, Entry>::iterator position);
+
+        /**
+         * @brief Drops least recently used entries until under budget.
+         * @note Caller must hold mutex.
+         */
+        void EvictToBudget();
+
+        mutable std::mutex mutex;                               ///< Guards all members below
+        size_t byteBudget;                                      ///< Maximum bytes of cached pixels
+        size_t usedBytes = 0;                                   ///< Bytes of cached pixels
+        std::unordered_map<std::string, Entry> entries;         ///< Cached images by path and reduction
+        std::unordered_map<std::string, PendingDecode> pending; ///< Decodes in progress, keyed like entries
+        std::list<std::string> lruOrder;                        ///< Entry keys, most recently used first
+        Statistics stats;                                       ///< Hit/miss counters
+
+        std::once_flag prefetchPoolCreated;              ///< Guards prefetchPool creation
+        std::unique_ptr<Nodes::ThreadPool> prefetchPool; ///< Prefetch threads (declared last: joined first)
+    };
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,488 @@
+#include "Vision/IO/ImageCodec.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#if VISION_CRAFT_WITH_NVJPEG
+#include "Vision/Cuda/NvJpegCodec.h"
+#endif
+
+#if VISION_CRAFT_WITH_TURBOJPEG
+#include <turbojpeg.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        std::atomic<bool> accelerationEnabled{ true };
+
+        int ReadFlags(int reduction)
+        {
+            switch (reduction)
+            {
+            case 2:
+                return cv::IMREAD_REDUCED_COLOR_2;
+            case 4:
+                return cv::IMREAD_REDUCED_COLOR_4;
+            case 8:
+                return cv::IMREAD_REDUCED_COLOR_8;
+            default:
+                return cv::IMREAD_COLOR;
+            }
+        }
+
+        /**
+         * @brief What Read() needs from a JPEG file before choosing a decoder.
+         */
+        struct JpegHeader
+        {
+            int width = 0;       ///< Stored width
+            int height = 0;      ///< Stored height
+            int orientation = 1; ///< EXIF orientation (1 = as stored)
+        };
+
+        // EXIF orientation from a TIFF structure (the APP1 payload after "Exif\0\0"); 1 when absent or invalid
+        int ReadExifOrientation(std::span<const unsigned char> tiff)
+        {
+            if (tiff.size() < 8)
+            {
+                return 1;
+            }
+            const bool littleEndian = tiff[0] == 'I' && tiff[1] == 'I';
+            if (!littleEndian && !(tiff[0] == 'M' && tiff[1] == 'M'))
+            {
+                return 1;
+            }
+            const auto read16 = [&](size_t at) -> uint32_t {
+                return littleEndian ? tiff[at] | (tiff[at + 1] << 8) : (tiff[at] << 8) | tiff[at + 1];
+            };
+            const auto read32 = [&](size_t at) -> uint32_t {
+                return littleEndian ? read16(at) | (read16(at + 2) << 16) : (read16(at) << 16) | read16(at + 2);
+            };
+
+            const size_t directory = read32(4);
+            if (directory > tiff.size() - 2)
+            {
+                return 1;
+            }
+            const size_t entries = read16(directory);
+            for (size_t index = 0; index < entries; ++index)
+            {
+                const size_t entry = directory + 2 + index * 12;
+                if (entry + 12 > tiff.size())
+                {
+                    break;
+                }
+                if (read16(entry) == 0x0112) // Orientation, a SHORT stored in the value field
+                {
+                    const auto orientation = static_cast<int>(read16(entry + 8));
+                    return orientation >= 1 && orientation <= 8 ? orientation : 1;
+                }
+            }
+            return 1;
+        }
+
+        // Walks the marker segments up to the first scan for the frame size and the EXIF orientation
+        std::optional<JpegHeader> ParseJpegHeader(std::span<const unsigned char> data)
+        {
+            if (data.size() < 4 || data[0] != 0xFF || data[1] != 0xD8)
+            {
+                return std::nullopt;
+            }
+
+            JpegHeader header;
+            size_t position = 2;
+            while (position + 4 <= data.size() && data[position] == 0xFF)
+            {
+                const unsigned char marker = data[position + 1];
+                if (marker == 0xFF) // Fill byte
+                {
+                    ++position;
+                    continue;
+                }
+                if (marker == 0xDA || marker == 0xD9) // Start of scan, end of image
+                {
+                    break;
+                }
+                const size_t length = (static_cast<size_t>(data[position + 2]) << 8) | data[position + 3];
+                if (length < 2 || position + 2 + length > data.size())
+                {
+                    return std::nullopt;
+                }
+                const auto segment = data.subspan(position + 4, length - 2);
+
+                // SOF0-SOF15, except DHT (C4), JPG (C8) and DAC (CC), which share the range
+                const bool startOfFrame = marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+                                          marker != 0xCC;
+                if (startOfFrame && segment.size() >= 5)
+                {
+                    header.height = (segment[1] << 8) | segment[2];
+                    header.width = (segment[3] << 8) | segment[4];
+                }
+                else if (marker == 0xE1 && segment.size() >= 6 && std::memcmp(segment.data(), "Exif\0\0", 6) == 0)
+                {
+                    header.orientation = ReadExifOrientation(segment.subspan(6));
+                }
+                position += 2 + length;
+            }
+
+            if (header.width <= 0 || header.height <= 0)
+            {
+                return std::nullopt;
+            }
+            return header;
+        }
+
+        // Same transforms, in the same order, as cv::imread applies for each orientation
+        void ApplyOrientation(cv::Mat &image, int orientation)
+        {
+            if (orientation >= 5)
+            {
+                cv::Mat transposed;
+                cv::transpose(image, transposed);
+                image = transposed;
+            }
+            switch (orientation)
+            {
+            case 2:
+            case 6:
+                cv::flip(image, image, 1);
+                break;
+            case 3:
+            case 7:
+                cv::flip(image, image, -1);
+                break;
+            case 4:
+            case 8:
+                cv::flip(image, image, 0);
+                break;
+            default:
+                break;
+            }
+        }
+
+        std::vector<unsigned char> ReadFile(const std::filesystem::path &path)
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            if (!file)
+            {
+                return {};
+            }
+            const auto size = static_cast<std::streamsize>(file.tellg());
+            std::vector<unsigned char> data(static_cast<size_t>(std::max<std::streamsize>(size, 0)));
+            file.seekg(0);
+            if (!file.read(reinterpret_cast<char *>(data.data()), size))
+            {
+                return {};
+            }
+            return data;
+        }
+
+        bool WriteFile(const std::filesystem::path &path, const std::vector<unsigned char> &data)
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+            return static_cast<bool>(file);
+        }
+
+        /**
+         * @brief JPEG settings of a cv::imwrite parameter list.
+         */
+        struct JpegSettings
+        {
+            int quality = 95;      ///< cv::IMWRITE_JPEG_QUALITY (cv::imwrite's default when absent)
+            bool optimize = false; ///< cv::IMWRITE_JPEG_OPTIMIZE
+        };
+
+        // Parameters the accelerated encoders cannot honour (progressive, restart intervals, ...) leave them out
+        std::optional<JpegSettings> ParseJpegSettings(const std::vector<int> &params)
+        {
+            JpegSettings settings;
+            for (size_t index = 0; index + 1 < params.size(); index += 2)
+            {
+                switch (params[index])
+                {
+                case cv::IMWRITE_JPEG_QUALITY:
+                    settings.quality = std::clamp(params[index + 1], 1, 100);
+                    break;
+                case cv::IMWRITE_JPEG_OPTIMIZE:
+                    settings.optimize = params[index + 1] != 0;
+                    break;
+                default:
+                    return std::nullopt;
+                }
+            }
+            return settings;
+        }
+
+#if VISION_CRAFT_WITH_TURBOJPEG
+        // TurboJPEG handles are not thread-safe, so each thread keeps its own
+        struct TurboJpegHandles
+        {
+            tjhandle decompressor = nullptr;
+            tjhandle compressor = nullptr;
+
+            TurboJpegHandles() = default;
+            TurboJpegHandles(const TurboJpegHandles &) = delete;
+            TurboJpegHandles &operator=(const TurboJpegHandles &) = delete;
+
+            ~TurboJpegHandles()
+            {
+                if (decompressor)
+                {
+                    tjDestroy(decompressor);
+                }
+                if (compressor)
+                {
+                    tjDestroy(compressor);
+                }
+            }
+        };
+
+        TurboJpegHandles &GetTurboJpegHandles()
+        {
+            thread_local TurboJpegHandles handles;
+            return handles;
+        }
+
+        // A 1/reduction scaling factor makes libjpeg-turbo skip the high-frequency part of each block's IDCT
+        cv::Mat DecodeTurboJpeg(std::span<const unsigned char> data, const JpegHeader &header, int reduction)
+        {
+            auto &handles = GetTurboJpegHandles();
+            if (!handles.decompressor)
+            {
+                handles.decompressor = tjInitDecompress();
+            }
+            if (!handles.decompressor)
+            {
+                return {};
+            }
+
+            int width = 0;
+            int height = 0;
+            int subsampling = 0;
+            int colorspace = 0;
+            const auto size = static_cast<unsigned long>(data.size());
+            if (tjDecompressHeader3(handles.decompressor, data.data(), size, &width, &height, &subsampling, &colorspace)
+                    != 0
+                || colorspace == TJCS_CMYK || colorspace == TJCS_YCCK || width != header.width
+                || height != header.height)
+            {
+                return {}; // OpenCV converts CMYK its own way
+            }
+
+            const int scaledWidth = (width + reduction - 1) / reduction;
+            const int scaledHeight = (height + reduction - 1) / reduction;
+            cv::Mat image(scaledHeight, scaledWidth, CV_8UC3);
+            if (tjDecompress2(handles.decompressor,
+                    data.data(),
+                    size,
+                    image.data,
+                    scaledWidth,
+                    static_cast<int>(image.step),
+                    scaledHeight,
+                    TJPF_BGR,
+                    0) != 0)
+            {
+                return {};
+            }
+            return image;
+        }
+
+        bool EncodeTurboJpeg(const cv::Mat &image, int quality, std::vector<unsigned char> &encoded)
+        {
+            auto &handles = GetTurboJpegHandles();
+            if (!handles.compressor)
+            {
+                handles.compressor = tjInitCompress();
+            }
+            if (!handles.compressor)
+            {
+                return false;
+            }
+
+            const bool gray = image.channels() == 1;
+            unsigned char *buffer = nullptr;
+            unsigned long size = 0;
+            const int result = tjCompress2(handles.compressor,
+                image.data,
+                image.cols,
+                static_cast<int>(image.step),
+                image.rows,
+                gray ? TJPF_GRAY : TJPF_BGR,
+                &buffer,
+                &size,
+                gray ? TJSAMP_GRAY : TJSAMP_420,
+                quality,
+                0);
+            if (result == 0)
+            {
+                encoded.assign(buffer, buffer + size);
+            }
+            tjFree(buffer);
+            return result == 0;
+        }
+#endif
+    } // namespace
+
+    cv::Mat ImageCodec::Read(const std::filesystem::path &path, int reduction)
+    {
+        const int flags = ReadFlags(reduction);
+        if (flags == cv::IMREAD_COLOR)
+        {
+            reduction = 1;
+        }
+        // Not even the largest image would leave OpenCV, so the file is not read here first
+        constexpr size_t kAnySize = std::numeric_limits<size_t>::max();
+        if (!IsJpegPath(path) || GetDecodeBackend(kAnySize, reduction) == JpegBackend::OpenCv)
+        {
+            return cv::imread(path.string(), flags);
+        }
+
+        const auto data = ReadFile(path);
+        const auto header = ParseJpegHeader(data);
+        if (!header)
+        {
+            return cv::imread(path.string(), flags);
+        }
+
+        cv::Mat image;
+        [[maybe_unused]] const JpegBackend backend =
+            GetDecodeBackend(static_cast<size_t>(header->width) * static_cast<size_t>(header->height), reduction);
+#if VISION_CRAFT_WITH_NVJPEG
+        if (backend == JpegBackend::NvJpeg)
+        {
+            image = Cuda::DecodeJpeg(data);
+        }
+#endif
+#if VISION_CRAFT_WITH_TURBOJPEG
+        if (image.empty() && backend != JpegBackend::OpenCv)
+        {
+            image = DecodeTurboJpeg(data, *header, reduction);
+        }
+#endif
+        if (image.empty() || image.cols != (header->width + reduction - 1) / reduction)
+        {
+            return cv::imread(path.string(), flags);
+        }
+        ApplyOrientation(image, header->orientation);
+        return image;
+    }
+
+    bool ImageCodec::Write(const std::filesystem::path &path, const cv::Mat &image, const std::vector<int> &params)
+    {
+        if (!IsJpegPath(path))
+        {
+            return cv::imwrite(path.string(), image, params);
+        }
+
+        const JpegBackend backend = GetEncodeBackend(image, params);
+        if (backend != JpegBackend::OpenCv)
+        {
+            [[maybe_unused]] const JpegSettings settings = ParseJpegSettings(params).value_or(JpegSettings{});
+            [[maybe_unused]] std::vector<unsigned char> encoded;
+            bool encodedHere = false;
+#if VISION_CRAFT_WITH_NVJPEG
+            if (backend == JpegBackend::NvJpeg)
+            {
+                encodedHere = Cuda::EncodeJpeg(image, settings.quality, settings.optimize, encoded);
+            }
+#endif
+#if VISION_CRAFT_WITH_TURBOJPEG
+            if (!encodedHere && !settings.optimize)
+            {
+                encodedHere = EncodeTurboJpeg(image, settings.quality, encoded);
+            }
+#endif
+            if (encodedHere)
+            {
+                return WriteFile(path, encoded);
+            }
+        }
+        return cv::imwrite(path.string(), image, params);
+    }
+
+    JpegBackend ImageCodec::GetDecodeBackend([[maybe_unused]] size_t pixels, [[maybe_unused]] int reduction)
+    {
+        if (!IsAccelerationEnabled())
+        {
+            return JpegBackend::OpenCv;
+        }
+#if VISION_CRAFT_WITH_NVJPEG
+        // nvJPEG has no DCT-domain scaling; reduced decodes stay on the CPU
+        if (reduction <= 1 && pixels >= Constants::Codec::kMinGpuJpegPixels && Cuda::IsNvJpegAvailable())
+        {
+            return JpegBackend::NvJpeg;
+        }
+#endif
+#if VISION_CRAFT_WITH_TURBOJPEG
+        return JpegBackend::TurboJpeg;
+#else
+        return JpegBackend::OpenCv;
+#endif
+    }
+
+    JpegBackend ImageCodec::GetEncodeBackend(const cv::Mat &image, const std::vector<int> &params)
+    {
+        const auto settings = ParseJpegSettings(params);
+        if (!IsAccelerationEnabled() || !settings || image.empty() || image.depth() != CV_8U
+            || (image.channels() != 1 && image.channels() != 3))
+        {
+            return JpegBackend::OpenCv;
+        }
+#if VISION_CRAFT_WITH_NVJPEG
+        if (image.channels() == 3 && Cuda::IsNvJpegAvailable())
+        {
+            return JpegBackend::NvJpeg;
+        }
+#endif
+#if VISION_CRAFT_WITH_TURBOJPEG
+        // The TurboJPEG 2 API cannot build optimized Huffman tables
+        if (!settings->optimize)
+        {
+            return JpegBackend::TurboJpeg;
+        }
+#endif
+        return JpegBackend::OpenCv;
+    }
+
+    void ImageCodec::SetAccelerationEnabled(bool enabled)
+    {
+        accelerationEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool ImageCodec::IsAccelerationEnabled()
+    {
+        return accelerationEnabled.load(std::memory_order_relaxed);
+    }
+
+    bool ImageCodec::IsJpegPath(const std::filesystem::path &path)
+    {
+        std::string extension = path.extension().string();
+        std::ranges::transform(
+            extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension == ".jpg" || extension == ".jpeg" || extension == ".jpe" || extension == ".jfif";
+    }
+
+    const char *ImageCodec::GetBackendName(JpegBackend backend)
+    {
+        switch (backend)
+        {
+        case JpegBackend::TurboJpeg:
+            return "TurboJPEG";
+        case JpegBackend::NvJpeg:
+            return "nvJPEG";
+        default:
+            return "OpenCV";
+        }
+    }
+} // namespace VisionCraft::Vision::IO
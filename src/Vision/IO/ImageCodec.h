@@ -0,0 +1,110 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Library that decoded or encoded a JPEG file.
+     */
+    enum class JpegBackend : uint8_t
+    {
+        OpenCv,    ///< cv::imread / cv::imwrite
+        TurboJpeg, ///< libjpeg-turbo's TurboJPEG API on the CPU
+        NvJpeg     ///< nvJPEG on an NVIDIA GPU
+    };
+
+    /**
+     * @brief Reads and writes image files, taking accelerated JPEG paths where the machine has them.
+     *
+     * Drop-in for cv::imread(path, cv::IMREAD_COLOR / cv::IMREAD_REDUCED_COLOR_*) and cv::imwrite(). JPEG
+     * files are routed to the fastest backend available at runtime; everything else, and every JPEG an
+     * accelerated backend declines or fails on (CMYK, 12-bit, corrupt data, unsupported encoder settings),
+     * goes to OpenCV, so results and failures stay those of cv::imread and cv::imwrite.
+     *
+     * - Full-resolution decodes of at least Constants::Codec::kMinGpuJpegPixels use nvJPEG when the build has
+     *   it (VISION_CRAFT_WITH_NVJPEG) and a CUDA device is present; smaller images use TurboJPEG, as the
+     *   host-device copies would cost more than the GPU saves.
+     * - Reduced decodes (previews, first paint) use TurboJPEG's DCT-domain scaling, which skips most of the
+     *   inverse transform instead of decoding full size and shrinking (VISION_CRAFT_WITH_TURBOJPEG).
+     * - 8-bit BGR encodes use nvJPEG, else TurboJPEG; gray encodes use TurboJPEG. Quality and Huffman
+     *   optimization come from the usual cv::IMWRITE_JPEG_* parameters, with 4:2:0 chroma as cv::imwrite
+     *   uses by default.
+     *
+     * Accelerated decodes apply the EXIF orientation as cv::imread does. The pixels may differ from OpenCV's
+     * by the rounding of a different IDCT, never by more than a few levels.
+     *
+     * All functions are thread-safe; GPU state is kept per thread.
+     */
+    class ImageCodec
+    {
+    public:
+        /**
+         * @brief Reads an image file as 8-bit BGR, as cv::imread with cv::IMREAD_COLOR does.
+         * @param path Image file path
+         * @param reduction Downscale factor applied while decoding: 1 (full resolution), 2, 4 or 8
+         * @return Image (dimensions rounded up, as cv::IMREAD_REDUCED_COLOR_* does), or empty if the file is
+         *         missing or unreadable
+         * @throws cv::Exception from cv::imread
+         */
+        [[nodiscard]] static cv::Mat Read(const std::filesystem::path &path, int reduction = 1);
+
+        /**
+         * @brief Writes an image file, as cv::imwrite does.
+         * @param path Destination; the extension picks the format
+         * @param image Image to encode
+         * @param params cv::imwrite parameters
+         * @return True if the file was written
+         * @throws cv::Exception from cv::imwrite
+         */
+        [[nodiscard]] static bool Write(const std::filesystem::path &path,
+            const cv::Mat &image,
+            const std::vector<int> &params);
+
+        /**
+         * @brief Returns the backend Read() would try first for a JPEG file of a given size.
+         * @param pixels Width times height of the image
+         * @param reduction Downscale factor, as for Read()
+         * @return Preferred available backend
+         */
+        [[nodiscard]] static JpegBackend GetDecodeBackend(size_t pixels, int reduction = 1);
+
+        /**
+         * @brief Returns the backend Write() would try first for a JPEG image.
+         * @param image Image to encode
+         * @param params cv::imwrite parameters
+         * @return Preferred available backend
+         */
+        [[nodiscard]] static JpegBackend GetEncodeBackend(const cv::Mat &image, const std::vector<int> &params);
+
+        /**
+         * @brief Turns the accelerated backends on or off for the whole process (on by default).
+         * @param enabled False to send every file to OpenCV
+         */
+        static void SetAccelerationEnabled(bool enabled);
+
+        /**
+         * @brief Checks if the accelerated backends may be used.
+         * @return True unless disabled with SetAccelerationEnabled()
+         */
+        [[nodiscard]] static bool IsAccelerationEnabled();
+
+        /**
+         * @brief Checks if a path names a JPEG file by its extension.
+         * @param path File path
+         * @return True for .jpg, .jpeg, .jpe and .jfif (any case)
+         */
+        [[nodiscard]] static bool IsJpegPath(const std::filesystem::path &path);
+
+        /**
+         * @brief Returns the display name of a backend.
+         * @param backend Backend to name
+         * @return Name such as "nvJPEG"
+         */
+        [[nodiscard]] static const char *GetBackendName(JpegBackend backend);
+    };
+} // namespace VisionCraft::Vision::IO
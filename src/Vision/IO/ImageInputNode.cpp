@@ -1,10 +1,16 @@
 #include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/DecodedImageCache.h"
+#include "Vision/IO/MappedImageReader.h"
 #include "Logger.h"
 #include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Nodes/Core/Tracer.h"
 
 #include <opencv2/opencv.hpp>
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <cmath>
 #include <cstring>
 #include <filesystem>
 
@@ -31,6 +37,11 @@ namespace VisionCraft::Vision::IO
     {
         // Use special prefix in lastLoadedPath to store error messages
         inline constexpr std::string_view kErrorPrefix = "ERROR:";
+
+        bool IsReady(const std::shared_future<cv::Mat> &decode)
+        {
+            return decode.valid() && decode.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
     } // namespace
 
     ImageInputNode::ImageInputNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
@@ -40,12 +51,14 @@ namespace VisionCraft::Vision::IO
 
         // Data pins
         CreateInputSlot("FilePath", std::filesystem::path{});
-        CreateOutputSlot("Output");
+        CreateInputSlot("MemoryMap", false);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
         filePathBuffer[0] = '\0';
     }
 
     std::string ImageInputNode::GetErrorMessage() const
     {
+        std::scoped_lock lock(displayMutex);
         if (lastLoadedPath.starts_with(kErrorPrefix))
         {
             return lastLoadedPath.substr(kErrorPrefix.length());
@@ -55,174 +68,300 @@ namespace VisionCraft::Vision::IO
 
     bool ImageInputNode::HasError() const
     {
+        std::scoped_lock lock(displayMutex);
         return lastLoadedPath.starts_with(kErrorPrefix);
     }
 
     void ImageInputNode::Process()
     {
-        auto filepath = GetInputValue<std::filesystem::path>("FilePath").value_or(std::filesystem::path{});
+        const auto filepathView = GetInputView<std::filesystem::path>("FilePath");
+        const auto &filepath = filepathView.ValueOrEmpty();
 
         if (filepath.empty())
         {
-            outputImage = cv::Mat{};
-            lastLoadedPath.clear();
+            PublishImage(cv::Mat{}, {});
             ClearOutputSlot("Output");
             return;
         }
 
-        LoadImageFromPath(filepath.string());
-
-        if (!outputImage.empty())
+        // A preloaded image belongs to the editor's own next run, not to concurrent ExecutionContext runs
+        cv::Mat image;
+        if (!Nodes::ExecutionContext::Current() && !preloadedImage.empty() && preloadedPath == filepath)
         {
-            SetOutputSlotData("Output", outputImage);
+            image = std::move(preloadedImage);
+            preloadedImage = cv::Mat{};
+            PublishImage(image, filepath.string());
         }
         else
+        {
+            image = LoadImageFromPath(filepath.string());
+        }
+
+        if (image.empty())
         {
             ClearOutputSlot("Output");
+            return;
+        }
+
+        // Proxy runs reduce the image once here, from pyramid levels the thumbnail and other scales share;
+        // the preview keeps the full-resolution image
+        if (const double scale = GetProxyScale(); scale < 1.0)
+        {
+            const cv::Size size(std::max(1, static_cast<int>(std::lround(image.cols * scale))),
+                std::max(1, static_cast<int>(std::lround(image.rows * scale))));
+            image = GetPyramid(image).Sample(size, cv::INTER_AREA);
+        }
+        SetOutputSlotData("Output", std::move(image));
+    }
+
+    void ImageInputNode::SetPreloadedImage(const std::filesystem::path &filepath, cv::Mat image)
+    {
+        preloadedPath = filepath;
+        preloadedImage = std::move(image);
+        SetInputSlotDefault("FilePath", filepath);
+        MarkDirty(); // Same path can carry new content
+    }
+
+    void ImageInputNode::SelectFile(const std::filesystem::path &filepath)
+    {
+        SetInputSlotDefault("FilePath", filepath);
+        selectedPath = filepath;
+        PublishImage(cv::Mat{}, {});
+
+        // Mapped files bypass the cache; mapping defers the reads to page faults, so load right away
+        if (GetInputValue<bool>("MemoryMap").value_or(false))
+        {
+            firstPaintDecode = {};
+            fullDecode = {};
+            Process();
+            return;
+        }
+
+        // First-paint decode is queued first so it is not stuck behind the slower full decode
+        auto &cache = DecodedImageCache::Get();
+        firstPaintDecode = cache.Prefetch(filepath, Constants::ImageInputNode::Preview::kFirstPaintReduction);
+        fullDecode = cache.Prefetch(filepath);
+    }
+
+    bool ImageInputNode::UpdatePreview()
+    {
+        if (!fullDecode.valid())
+        {
+            return false;
+        }
+
+        // The slot was edited since; the next Process() loads whatever it names now
+        const auto currentPath = GetInputValue<std::filesystem::path>("FilePath").value_or(std::filesystem::path{});
+        if (currentPath != selectedPath)
+        {
+            firstPaintDecode = {};
+            fullDecode = {};
+            return false;
         }
+
+        const auto take = [this](std::shared_future<cv::Mat> &decode) {
+            cv::Mat image;
+            try
+            {
+                image = decode.get();
+            }
+            catch (const std::exception &e)
+            {
+                LOG_ERROR("ImageInputNode {}: Error decoding '{}': {}", GetName(), selectedPath.string(), e.what());
+            }
+            decode = {};
+            return image;
+        };
+
+        if (IsReady(fullDecode))
+        {
+            firstPaintDecode = {};
+            cv::Mat image = take(fullDecode);
+            if (image.empty())
+            {
+                LOG_ERROR("ImageInputNode {}: Failed to load image from '{}'", GetName(), selectedPath.string());
+                PublishImage(cv::Mat{}, std::string(kErrorPrefix) + "Failed to load image");
+            }
+            else
+            {
+                PublishImage(std::move(image), selectedPath.string());
+            }
+            return true;
+        }
+
+        if (IsReady(firstPaintDecode))
+        {
+            cv::Mat preview = take(firstPaintDecode);
+            std::scoped_lock lock(displayMutex);
+            // A Process() that already finished shows full resolution; keep it
+            if (!preview.empty() && outputImage.empty())
+            {
+                outputImage = std::move(preview);
+                pyramid = Nodes::ImagePyramid(outputImage, Nodes::ImagePyramid::Filter::Area);
+                lastLoadedPath = selectedPath.string();
+                textureStale = true;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ImageInputNode::IsDecoding() const
+    {
+        return fullDecode.valid();
+    }
+
+    bool ImageInputNode::NeedsTextureUpdate() const
+    {
+        std::scoped_lock lock(displayMutex);
+        return textureStale;
+    }
+
+    cv::Mat ImageInputNode::GetOutputImage() const
+    {
+        std::scoped_lock lock(displayMutex);
+        return outputImage;
     }
 
     bool ImageInputNode::HasValidImage() const
     {
+        std::scoped_lock lock(displayMutex);
         return !outputImage.empty() && texture.IsValid();
     }
 
     GLuint ImageInputNode::GetTextureId() const
     {
-        return texture.Get();
+        return texture.GetThumbnailId();
+    }
+
+    GLuint ImageInputNode::GetFullResolutionTextureId()
+    {
+        return texture.GetFullResolutionId();
     }
 
-    void ImageInputNode::LoadImageFromPath(const std::string &filepath)
+    void ImageInputNode::MarkTextureDrawn()
+    {
+        texture.MarkDrawn();
+    }
+
+    void ImageInputNode::ReleaseFullResolutionTexture()
+    {
+        texture.ReleaseFullResolution();
+    }
+
+    void ImageInputNode::PublishImage(cv::Mat image, std::string loadedPath)
+    {
+        std::scoped_lock lock(displayMutex);
+        outputImage = std::move(image);
+        pyramid = Nodes::ImagePyramid(outputImage, Nodes::ImagePyramid::Filter::Area);
+        lastLoadedPath = std::move(loadedPath);
+        textureStale = true;
+    }
+
+    Nodes::ImagePyramid ImageInputNode::GetPyramid(const cv::Mat &image) const
+    {
+        {
+            std::scoped_lock lock(displayMutex);
+            const cv::Mat base = pyramid.GetBase();
+            if (base.data == image.data && base.size() == image.size() && base.type() == image.type())
+            {
+                return pyramid;
+            }
+        }
+        return Nodes::ImagePyramid(image, Nodes::ImagePyramid::Filter::Area);
+    }
+
+    cv::Mat ImageInputNode::LoadImageFromPath(const std::string &filepath)
     {
         auto setError = [this](std::string_view errorMsg) {
-            lastLoadedPath = std::string(kErrorPrefix) + std::string(errorMsg);
-            outputImage = cv::Mat{};
+            PublishImage(cv::Mat{}, std::string(kErrorPrefix) + std::string(errorMsg));
+            return cv::Mat{};
         };
 
         try
         {
-            outputImage = cv::imread(filepath, cv::IMREAD_COLOR);
+            // Decode outside the display lock so the render thread is never held up by disk I/O; unchanged
+            // files are served from the shared cache without decoding, mapped files read in place
+            const bool memoryMap = GetInputValue<bool>("MemoryMap").value_or(false);
+            cv::Mat image = memoryMap ? MappedImageReader::Read(filepath) : DecodedImageCache::Get().Load(filepath);
 
-            if (outputImage.empty()) [[unlikely]]
+            if (image.empty()) [[unlikely]]
             {
-                setError("Failed to load image");
                 LOG_ERROR(
                     "ImageInputNode {}: Failed to load image from '{}' - file may be corrupted or unsupported format",
                     GetName(),
                     filepath);
-                return;
+                return setError("Failed to load image");
             }
 
-            // Note: Texture update is deferred to the main thread (rendering)
-            // OpenGL operations cannot be performed from worker threads
-            lastLoadedPath = filepath;
-
             LOG_INFO("ImageInputNode {}: Successfully loaded image from '{}' ({}x{}, {} channels)",
                 GetName(),
                 filepath,
-                outputImage.cols,
-                outputImage.rows,
-                outputImage.channels());
+                image.cols,
+                image.rows,
+                image.channels());
+
+            // Note: Texture update is deferred to the main thread (rendering)
+            // OpenGL operations cannot be performed from worker threads
+            PublishImage(image, filepath);
+            return image;
         }
         catch (const cv::Exception &e)
         {
-            setError("OpenCV error");
             LOG_ERROR("ImageInputNode {}: OpenCV error loading image '{}': {}", GetName(), filepath, e.what());
+            return setError("OpenCV error");
         }
         catch (const std::exception &e)
         {
-            setError("Error loading image");
             LOG_ERROR("ImageInputNode {}: Unexpected error loading image '{}': {}", GetName(), filepath, e.what());
+            return setError("Error loading image");
         }
     }
 
     void ImageInputNode::UpdateTexture()
     {
-        if (outputImage.empty())
+        Nodes::TraceScope trace("gpu", "UpdateTexture");
+        if (trace.IsActive())
         {
-            texture.Reset();
-            return;
+            trace.SetDetail(GetName());
         }
 
-        // Safety check: ensure we have valid image data
-        // Note: empty() already checks data, cols, and rows, so this is comprehensive
-        if (outputImage.cols <= 0 || outputImage.rows <= 0)
+        Nodes::ImagePyramid image;
+        {
+            std::scoped_lock lock(displayMutex);
+            image = pyramid;
+            textureStale = false;
+        }
+        if (image.IsEmpty())
         {
-            LOG_ERROR("ImageInputNode {}: Invalid image dimensions, cannot create texture", GetName());
             texture.Reset();
             return;
         }
 
-        cv::Mat rgbImage;
         try
         {
-            cv::cvtColor(outputImage, rgbImage, cv::COLOR_BGR2RGB);
-
-            // Verify conversion succeeded
-            if (rgbImage.empty())
+            if (!texture.Update(image))
             {
-                LOG_ERROR("ImageInputNode {}: RGB conversion produced invalid image", GetName());
-                texture.Reset();
-                return;
+                LOG_ERROR("ImageInputNode {}: Failed to upload image texture", GetName());
             }
         }
         catch (const cv::Exception &e)
         {
-            LOG_ERROR("ImageInputNode {}: Failed to convert image to RGB: {}", GetName(), e.what());
+            LOG_ERROR("ImageInputNode {}: Failed to convert image for display: {}", GetName(), e.what());
             texture.Reset();
-            return;
         }
-        catch (const std::exception &e)
-        {
-            LOG_ERROR("ImageInputNode {}: Standard exception during RGB conversion: {}", GetName(), e.what());
-            texture.Reset();
-            return;
-        }
-
-        if (!texture.Create())
-        {
-            LOG_ERROR("ImageInputNode {}: Failed to create OpenGL texture", GetName());
-            texture.Reset();
-            return;
-        }
-
-        GLuint textureId = texture.Get();
-        if (textureId == 0)
-        {
-            LOG_ERROR("ImageInputNode {}: Invalid texture ID", GetName());
-            texture.Reset();
-            return;
-        }
-
-        glBindTexture(GL_TEXTURE_2D, textureId);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RGB, rgbImage.cols, rgbImage.rows, 0, GL_RGB, GL_UNSIGNED_BYTE, rgbImage.data);
-
-        GLenum error = glGetError();
-        if (error != GL_NO_ERROR)
-        {
-            LOG_ERROR("ImageInputNode {}: OpenGL error after texture upload: 0x{:x}", GetName(), error);
-            glBindTexture(GL_TEXTURE_2D, 0);
-            texture.Reset();
-            return;
-        }
-
-        glBindTexture(GL_TEXTURE_2D, 0);
     }
 
     std::pair<float, float> ImageInputNode::CalculatePreviewDimensions(float nodeContentWidth,
         [[maybe_unused]] float maxHeight) const
     {
-        if (!HasValidImage() || outputImage.rows <= 0 || outputImage.cols <= 0)
+        const cv::Mat image = GetOutputImage();
+        if (image.rows <= 0 || image.cols <= 0 || !texture.IsValid())
         {
             return { 0.0f, 0.0f };
         }
 
-        float imageAspect = static_cast<float>(outputImage.cols) / static_cast<float>(outputImage.rows);
+        float imageAspect = static_cast<float>(image.cols) / static_cast<float>(image.rows);
 
         float previewWidth = nodeContentWidth;
         float previewHeight = previewWidth / imageAspect;
@@ -244,4 +383,20 @@ namespace VisionCraft::Vision::IO
         return actualPreviewHeight + imagePreviewSpacing;
     }
 
+    std::optional<Nodes::ImageShape> ImageInputNode::InferOutputShape(
+        [[maybe_unused]] const std::optional<Nodes::ImageShape> &input) const
+    {
+        std::scoped_lock lock(displayMutex);
+        if (outputImage.empty())
+        {
+            return std::nullopt;
+        }
+        return Nodes::ImageShape{ .size = outputImage.size(), .type = outputImage.type() };
+    }
+
+    bool ImageInputNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        writer.BindPipelineInput("Output");
+        return true;
+    }
 } // namespace VisionCraft::Vision::IO
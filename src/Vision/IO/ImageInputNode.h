@@ -1,17 +1,35 @@
 #pragma once
 
+#include "Nodes/Core/ImagePyramid.h"
 #include "Nodes/Core/Node.h"
 #include <glad/glad.h>
 #include <opencv2/opencv.hpp>
+#include <filesystem>
+#include <future>
+#include <mutex>
 #include <string>
 
 #include "Nodes/Core/EngineConstants.h"
-#include "Texture.h"
+#include "Vision/IO/PreviewTexture.h"
 
 namespace VisionCraft::Vision::IO
 {
     /**
      * @brief Node for loading images from file system.
+     *
+     * The loaded image and load status are read by the render thread while execution may be running,
+     * so they are published under a mutex and handed out by value.
+     *
+     * Files chosen in the editor are decoded in the background (SelectFile()): a reduced-resolution decode
+     * paints the preview first, the full-resolution decode replaces it, and a Process() started meanwhile
+     * waits for that decode instead of decoding the file again.
+     *
+     * The loaded image is wrapped in an INTER_AREA Nodes::ImagePyramid that proxy runs and the thumbnail both
+     * sample, so changing the proxy scale or redrawing the preview never downscales the full image again.
+     *
+     * With the MemoryMap slot set, files are read through MappedImageReader instead of DecodedImageCache:
+     * raw PGM and TIFF files become zero-copy views of the file, everything else is decoded from the
+     * mapping, and pixels keep their stored depth and channel count.
      */
     class ImageInputNode : public Nodes::Node
     {
@@ -32,19 +50,85 @@ namespace VisionCraft::Vision::IO
             return "ImageInputNode";
         }
 
+        /**
+         * @brief Excludes node from the output cache; it reads from disk, so its file may change between runs.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
         /**
          * @brief Processes node by loading specified image.
+         * @note In proxy runs (NodeEditor::SetProxyScale()) the output is sampled from the image's pyramid.
          */
         void Process() override;
 
+        /**
+         * @brief Returns the shape of the loaded image; the node has no image input.
+         * @param input Unused
+         * @return Output shape, or std::nullopt before an image is loaded
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Makes the image an input the compiled pipeline's caller passes in; FilePath is not read.
+         * @param writer Receives the node's code
+         * @return True
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
+        /**
+         * @brief Supplies an already decoded image for the next Process() call.
+         *
+         * Sets the FilePath slot to @p filepath and makes Process() use @p image instead of
+         * reading the file, so decoding can run on a separate pipeline stage.
+         *
+         * @param filepath Path the image was decoded from
+         * @param image Decoded image
+         * @note Call between executions only.
+         */
+        void SetPreloadedImage(const std::filesystem::path &filepath, cv::Mat image);
+
+        /**
+         * @brief Selects a file and starts decoding it in the background.
+         *
+         * Sets the FilePath slot and prefetches a Constants::ImageInputNode::Preview::kFirstPaintReduction
+         * decode for fast first paint alongside the full-resolution one. UpdatePreview() shows each when ready.
+         * With MemoryMap set the file is read immediately through Process() instead.
+         *
+         * @param filepath Image file path
+         * @note UI thread only.
+         */
+        void SelectFile(const std::filesystem::path &filepath);
+
+        /**
+         * @brief Shows background decodes started by SelectFile() that have finished.
+         * @return True if the displayed image changed
+         * @note UI thread only; never blocks, so it can run every frame.
+         */
+        bool UpdatePreview();
+
+        /**
+         * @brief Checks if a decode started by SelectFile() has not been shown yet.
+         * @return True while UpdatePreview() still has a decode to show
+         * @note UI thread only.
+         */
+        [[nodiscard]] bool IsDecoding() const;
+
+        /**
+         * @brief Checks if the displayed image changed since the last UpdateTexture().
+         * @return True if UpdateTexture() should run
+         */
+        [[nodiscard]] bool NeedsTextureUpdate() const;
+
         /**
          * @brief Returns loaded image.
-         * @return Loaded image
+         * @return Loaded image (shares pixel data with the node)
          */
-        [[nodiscard]] const cv::Mat &GetOutputImage() const
-        {
-            return outputImage;
-        }
+        [[nodiscard]] cv::Mat GetOutputImage() const;
 
         /**
          * @brief Checks if image is loaded and texture is ready.
@@ -53,11 +137,30 @@ namespace VisionCraft::Vision::IO
         [[nodiscard]] bool HasValidImage() const;
 
         /**
-         * @brief Returns OpenGL texture ID.
+         * @brief Returns OpenGL texture ID of the in-canvas thumbnail.
          * @return Texture ID
          */
         [[nodiscard]] GLuint GetTextureId() const;
 
+        /**
+         * @brief Returns OpenGL texture ID of the full-resolution image, uploading it on first use.
+         * @return Texture ID (0 if there is no image)
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        [[nodiscard]] GLuint GetFullResolutionTextureId();
+
+        /**
+         * @brief Records that the thumbnail is drawn this frame, uploading it again if the budget released it.
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        void MarkTextureDrawn();
+
+        /**
+         * @brief Frees the full-resolution texture once nothing shows it.
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        void ReleaseFullResolutionTexture();
+
         /**
          * @brief Calculates preview dimensions for rendering.
          * @param nodeContentWidth Available content width
@@ -87,22 +190,44 @@ namespace VisionCraft::Vision::IO
         [[nodiscard]] bool HasError() const;
 
         /**
-         * @brief Updates OpenGL texture from loaded image.
+         * @brief Uploads a thumbnail of the loaded image, reusing the texture storage if its size is unchanged.
          * @note Must be called on the main thread (OpenGL context thread).
          */
         void UpdateTexture();
 
     private:
         /**
-         * @brief Loads image from file path.
+         * @brief Loads image from file path and publishes it (or the error) for display.
          * @param filepath Image file path
+         * @return Loaded image (shared with DecodedImageCache or the file mapping), empty on failure
          */
-        void LoadImageFromPath(const std::string &filepath);
+        cv::Mat LoadImageFromPath(const std::string &filepath);
 
+        /**
+         * @brief Replaces the image and status shown by the render thread.
+         * @param image New image (empty to clear)
+         * @param loadedPath Loaded file path, error-prefixed message or empty
+         */
+        void PublishImage(cv::Mat image, std::string loadedPath);
 
-        cv::Mat outputImage;        ///< Loaded image data
-        Kappa::Texture texture;     ///< RAII-managed OpenGL texture for display
-        std::string lastLoadedPath; ///< Last successfully loaded file path
+        /**
+         * @brief Returns the pyramid of an image, reusing the published one when it wraps that image.
+         * @param image Image Process() outputs
+         * @return Pyramid whose level 0 is @p image
+         */
+        [[nodiscard]] Nodes::ImagePyramid GetPyramid(const cv::Mat &image) const;
+
+        mutable std::mutex displayMutex;              ///< Guards outputImage, pyramid, lastLoadedPath, textureStale
+        cv::Mat outputImage;                          ///< Loaded image data
+        Nodes::ImagePyramid pyramid;                  ///< Levels of outputImage built for proxies and thumbnails
+        cv::Mat preloadedImage;                       ///< Image decoded ahead of Process() (consumed once)
+        std::filesystem::path preloadedPath;          ///< File preloadedImage was decoded from
+        PreviewTexture texture;                       ///< Thumbnail and full-resolution textures (render thread)
+        std::string lastLoadedPath;                   ///< Last successfully loaded file path
+        bool textureStale = false;                    ///< Displayed image changed since UpdateTexture()
+        std::filesystem::path selectedPath;           ///< File chosen by SelectFile() (UI thread)
+        std::shared_future<cv::Mat> firstPaintDecode; ///< Reduced decode of selectedPath (UI thread)
+        std::shared_future<cv::Mat> fullDecode;       ///< Full-resolution decode of selectedPath (UI thread)
         char filePathBuffer[Constants::Buffers::kFilePathBufferSize] =
             ""; ///< Buffer for file path input (ImGui requirement)
     };
@@ -1,5 +1,13 @@
 #include "Vision/IO/ImageOutputNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Nodes/Core/Tracer.h"
+#include "Nodes/Core/WriteBehindQueue.h"
+#include "Vision/IO/ImageCodec.h"
+#include <algorithm>
+#include <cctype>
 #include <filesystem>
 
 namespace VisionCraft::Vision::IO
@@ -11,116 +19,277 @@ namespace VisionCraft::Vision::IO
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
         CreateInputSlot("SavePath", std::filesystem::path{});
         CreateInputSlot("AutoSave", false);
-        CreateInputSlot("Format", std::string{ "png" });
+        CreateInputSlot("Format", kDefaultFormat);
+        CreateInputSlot("Profile", kDefaultProfile);
+        CreateInputSlot("ThumbnailPath", std::filesystem::path{});
+        CreateInputSlot("ThumbnailSize", Constants::Output::kDefaultThumbnailEdge);
     }
 
     void ImageOutputNode::Process()
     {
-        auto inputData = GetInputValue<cv::Mat>("Input");
+        auto inputData = GetInputValueIf<cv::Mat>("Input");
         if (!inputData || inputData->empty())
         {
-            LOG_WARN("ImageOutputNode {}: No input image provided", GetName());
-            inputImage = cv::Mat();
-            displayImage = cv::Mat();
+            LOG_HOT_WARN("ImageOutputNode {}: No input image provided", GetName());
+            PublishResult(cv::Mat{}, {});
             return;
         }
 
-        inputImage = *inputData;
+        // Shallow copy - cv::Mat uses reference counting
+        const cv::Mat &image = *inputData;
 
         try
         {
-            displayImage = inputImage; // Shallow copy - cv::Mat uses reference counting
-
             const auto autoSave = GetInputValue<bool>("AutoSave").value_or(false);
-            const auto savePath = GetInputValue<std::filesystem::path>("SavePath").value_or(std::filesystem::path{});
+            const auto savePathView = GetInputView<std::filesystem::path>("SavePath");
+            const auto &savePath = savePathView.ValueOrEmpty();
 
-            if (autoSave && !savePath.empty())
+            std::shared_future<bool> save;
+            if (autoSave && !savePath.empty() && GetProxyScale() < 1.0)
             {
-                lastSaveSuccessful = SaveImage(savePath.string());
+                // A proxy image is a preview; the full-resolution run writes the file
+                LOG_HOT_INFO("ImageOutputNode {}: Proxy run, not saving to '{}'", GetName(), savePath.string());
             }
-            else
+            else if (autoSave && !savePath.empty())
             {
-                lastSaveSuccessful = false;
+                // Encoding runs behind execution, so it gets its own copy: upstream nodes write their next
+                // result into the buffer they output now
+                save = Nodes::WriteBehindQueue::Get().Submit(
+                    [name = GetName(), targets = GetEncodeTargets(savePath), copy = image.clone()]() {
+                        return SaveImage(name, targets, copy);
+                    });
             }
+            PublishResult(image, std::move(save));
 
-            LOG_INFO("ImageOutputNode {}: Processed image ({}x{}, {} channels)",
+            LOG_HOT_INFO("ImageOutputNode {}: Processed image ({}x{}, {} channels)",
                 GetName(),
-                displayImage.cols,
-                displayImage.rows,
-                displayImage.channels());
+                image.cols,
+                image.rows,
+                image.channels());
         }
         catch (const cv::Exception &e)
         {
             LOG_ERROR("ImageOutputNode {}: OpenCV error: {}", GetName(), e.what());
-            displayImage = cv::Mat();
-            lastSaveSuccessful = false;
+            PublishResult(cv::Mat{}, {});
         }
         catch (const std::exception &e)
         {
             LOG_ERROR("ImageOutputNode {}: Error processing image: {}", GetName(), e.what());
-            displayImage = cv::Mat();
-            lastSaveSuccessful = false;
+            PublishResult(cv::Mat{}, {});
         }
     }
 
-    bool ImageOutputNode::SaveImage(const std::string &filepath)
+    cv::Mat ImageOutputNode::GetDisplayImage() const
     {
-        if (displayImage.empty())
+        std::scoped_lock lock(resultMutex);
+        return displayImage;
+    }
+
+    bool ImageOutputNode::HasValidImage() const
+    {
+        std::scoped_lock lock(resultMutex);
+        return !displayImage.empty();
+    }
+
+    std::shared_future<bool> ImageOutputNode::GetPendingSave() const
+    {
+        std::scoped_lock lock(resultMutex);
+        return pendingSave;
+    }
+
+    void ImageOutputNode::PublishResult(cv::Mat image, std::shared_future<bool> save)
+    {
+        std::scoped_lock lock(resultMutex);
+        displayImage = std::move(image);
+        pendingSave = std::move(save);
+    }
+
+    std::vector<int> ImageOutputNode::GetEncodeParams(std::string_view format, EncodeProfile profile)
+    {
+        std::string extension(format);
+        std::ranges::transform(
+            extension, extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        // Fastest / balanced / smallest; balanced keeps the settings used before profiles existed
+        const auto pick = [profile](int fastest, int balanced, int smallest) {
+            switch (profile)
+            {
+            case EncodeProfile::Fastest:
+                return fastest;
+            case EncodeProfile::Smallest:
+                return smallest;
+            default:
+                return balanced;
+            }
+        };
+
+        if (extension == "jpg" || extension == "jpeg")
         {
-            LOG_ERROR("ImageOutputNode {}: Cannot save empty image", GetName());
-            return false;
+            // Optimized Huffman tables cost an extra pass over the coefficients
+            return { cv::IMWRITE_JPEG_QUALITY,
+                pick(90, 95, 85),
+                cv::IMWRITE_JPEG_OPTIMIZE,
+                profile == EncodeProfile::Smallest ? 1 : 0 };
+        }
+        if (extension == "png")
+        {
+            return { cv::IMWRITE_PNG_COMPRESSION, pick(1, 3, 9) };
+        }
+        if (extension == "webp")
+        {
+            return { cv::IMWRITE_WEBP_QUALITY, pick(75, 90, 70) };
+        }
+        if (extension == "tif" || extension == "tiff")
+        {
+            // libtiff schemes: 1 = none (raw strips), 5 = LZW, 8 = Deflate
+            return { cv::IMWRITE_TIFF_COMPRESSION, pick(1, 5, 8) };
+        }
+        if (extension == "pgm" || extension == "ppm" || extension == "pnm")
+        {
+            return { cv::IMWRITE_PXM_BINARY, 1 };
         }
+        return {};
+    }
 
-        try
+    std::optional<EncodeProfile> ImageOutputNode::ParseEncodeProfile(std::string_view name)
+    {
+        std::string lowered(name);
+        std::ranges::transform(
+            lowered, lowered.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        if (lowered == "fastest")
+        {
+            return EncodeProfile::Fastest;
+        }
+        if (lowered == "balanced")
+        {
+            return EncodeProfile::Balanced;
+        }
+        if (lowered == "smallest")
         {
-            std::filesystem::path path(filepath);
-            std::filesystem::path dir = path.parent_path();
+            return EncodeProfile::Smallest;
+        }
+        return std::nullopt;
+    }
 
-            if (!dir.empty() && !std::filesystem::exists(dir))
+    std::vector<ImageOutputNode::EncodeTarget> ImageOutputNode::GetEncodeTargets(
+        const std::filesystem::path &savePath) const
+    {
+        const auto profileName = GetInputView<std::string>("Profile");
+        const auto &name = profileName.ValueOr(kDefaultProfile);
+        auto profile = ParseEncodeProfile(name);
+        if (!profile)
+        {
+            LOG_HOT_WARN("ImageOutputNode {}: Unknown encoder profile '{}', using balanced", GetName(), name);
+            profile = EncodeProfile::Balanced;
+        }
+
+        // The extension picks the encoder; Format only fills it in for paths without one
+        const auto format = GetInputView<std::string>("Format");
+        const auto withExtension = [&format](std::filesystem::path path) {
+            if (!path.has_extension())
             {
-                std::filesystem::create_directories(dir);
-                LOG_INFO("ImageOutputNode {}: Created directory '{}'", GetName(), dir.string());
+                path += "." + format.ValueOr(kDefaultFormat);
             }
+            return path;
+        };
+        const auto targetFor = [&](const std::filesystem::path &path, int maxEdge) {
+            auto file = withExtension(path);
+            auto params = GetEncodeParams(file.extension().string().substr(1), *profile);
+            return EncodeTarget{ std::move(file), std::move(params), maxEdge };
+        };
 
-            const auto format = GetInputValue<std::string>("Format").value_or("png");
+        std::vector<EncodeTarget> targets{ targetFor(savePath, 0) };
+        const auto thumbnailView = GetInputView<std::filesystem::path>("ThumbnailPath");
+        if (const auto &thumbnailPath = thumbnailView.ValueOrEmpty(); !thumbnailPath.empty())
+        {
+            const int edge = GetInputValue<int>("ThumbnailSize").value_or(Constants::Output::kDefaultThumbnailEdge);
+            targets.push_back(targetFor(thumbnailPath, std::max(edge, 1)));
+        }
+        return targets;
+    }
+
+    bool ImageOutputNode::GetLastSaveStatus() const
+    {
+        const auto save = GetPendingSave();
+        return save.valid() && save.get();
+    }
+
+    bool ImageOutputNode::SaveImage(const std::string &nodeName,
+        const std::vector<EncodeTarget> &targets,
+        const cv::Mat &image)
+    {
+        if (image.empty())
+        {
+            LOG_ERROR("ImageOutputNode {}: Cannot save empty image", nodeName);
+            return false;
+        }
 
-            std::vector<int> compressionParams;
-            if (format == "jpg" || format == "jpeg")
+        bool allWritten = true;
+        for (const auto &target : targets)
+        {
+            Nodes::TraceScope trace("io", "EncodeImage");
+            if (trace.IsActive())
             {
-                compressionParams.push_back(cv::IMWRITE_JPEG_QUALITY);
-                compressionParams.push_back(95);
+                trace.SetDetail(target.path.filename().string());
             }
-            else if (format == "png")
+
+            try
             {
-                compressionParams.push_back(cv::IMWRITE_PNG_COMPRESSION);
-                compressionParams.push_back(3);
-            }
+                const std::filesystem::path dir = target.path.parent_path();
+
+                if (!dir.empty() && !std::filesystem::exists(dir))
+                {
+                    std::filesystem::create_directories(dir);
+                    LOG_INFO("ImageOutputNode {}: Created directory '{}'", nodeName, dir.string());
+                }
 
-            bool success = cv::imwrite(filepath, displayImage, compressionParams);
+                // Thumbnails are area-averaged from the full image; smaller images are written as they are
+                cv::Mat encoded = image;
+                const int longestEdge = std::max(image.cols, image.rows);
+                if (target.maxEdge > 0 && longestEdge > target.maxEdge)
+                {
+                    const double scale = static_cast<double>(target.maxEdge) / longestEdge;
+                    cv::resize(image, encoded, cv::Size(), scale, scale, cv::INTER_AREA);
+                }
 
-            if (success)
+                const bool success = ImageCodec::Write(target.path, encoded, target.params);
+
+                if (success)
+                {
+                    LOG_INFO("ImageOutputNode {}: Successfully saved image to '{}'", nodeName, target.path.string());
+                }
+                else
+                {
+                    LOG_ERROR("ImageOutputNode {}: Failed to save image to '{}'", nodeName, target.path.string());
+                }
+                allWritten = allWritten && success;
+            }
+            catch (const cv::Exception &e)
             {
-                LOG_INFO("ImageOutputNode {}: Successfully saved image to '{}'", GetName(), filepath);
+                LOG_ERROR(
+                    "ImageOutputNode {}: OpenCV error saving to '{}': {}", nodeName, target.path.string(), e.what());
+                allWritten = false;
             }
-            else
+            catch (const std::exception &e)
             {
-                LOG_ERROR("ImageOutputNode {}: Failed to save image to '{}'", GetName(), filepath);
+                LOG_ERROR("ImageOutputNode {}: Error saving to '{}': {}", nodeName, target.path.string(), e.what());
+                allWritten = false;
             }
-
-            return success;
-        }
-        catch (const cv::Exception &e)
-        {
-            LOG_ERROR("ImageOutputNode {}: OpenCV error saving to '{}': {}", GetName(), filepath, e.what());
-            return false;
         }
-        catch (const std::exception &e)
+        return allWritten;
+    }
+
+    bool ImageOutputNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        if (writer.Input("Input").empty())
         {
-            LOG_ERROR("ImageOutputNode {}: Error saving to '{}': {}", GetName(), filepath, e.what());
-            return false;
+            return writer.Fail("Input is not connected");
         }
+        writer.BindPipelineOutput("Input");
+        return true;
     }
 } // namespace VisionCraft::Vision::IO
@@ -2,11 +2,39 @@
 
 #include "Nodes/Core/Node.h"
 #include <opencv2/opencv.hpp>
+#include <filesystem>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace VisionCraft::Vision::IO
 {
+    /**
+     * @brief Encoder speed/size trade-off, selected by ImageOutputNode's Profile slot.
+     */
+    enum class EncodeProfile
+    {
+        Fastest,  ///< Least encoder time (light or no compression)
+        Balanced, ///< Default settings (PNG level 3, JPEG quality 95, TIFF LZW)
+        Smallest  ///< Smallest files (strongest compression, lower lossy quality)
+    };
+
     /**
      * @brief Node for displaying and saving processed images.
+     *
+     * AutoSave writes are submitted to Nodes::WriteBehindQueue::Get(), so Process() returns while the image
+     * is still being encoded and the graph moves on. GetPendingSave() or the run's
+     * RunStatistics::writesFlushed signal when the file is written. Proxy runs (NodeEditor::SetProxyScale())
+     * never save.
+     *
+     * The encoder is chosen by SavePath's extension, or by the Format slot when SavePath has none (which is
+     * then appended): png, jpg/jpeg, webp, tif/tiff, or binary pgm/ppm/pnm for raw pixels. The Profile slot
+     * ("fastest", "balanced", "smallest") picks the encoder settings; files are written through ImageCodec, so
+     * JPEG uses nvJPEG or TurboJPEG where available. Setting ThumbnailPath also writes a
+     * copy downscaled to ThumbnailSize pixels on its longest edge, in the same write-behind job.
      */
     class ImageOutputNode : public Nodes::Node
     {
@@ -32,57 +60,127 @@ namespace VisionCraft::Vision::IO
             return "ImageOutputNode";
         }
 
+        /**
+         * @brief Excludes node from the output cache; it writes to disk as a side effect.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Marks node as a graph result; it writes to disk and shows the image.
+         * @return Always true
+         */
+        [[nodiscard]] bool IsSink() const override
+        {
+            return true;
+        }
+
         /**
          * @brief Processes input image for display/saving.
          */
         void Process() override;
 
+        /**
+         * @brief Makes the input an image the compiled pipeline returns; nothing is saved.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
         /**
          * @brief Sets input image.
          * @param image Input image
          */
         void SetInputImage(const cv::Mat &image)
         {
-            inputImage = image;
+            SetInputSlotData("Input", image);
         }
 
         /**
          * @brief Returns display image.
-         * @return Image to display
+         * @return Image of the last Process(), from whichever run or ExecutionContext finished last
          */
-        [[nodiscard]] const cv::Mat &GetDisplayImage() const
-        {
-            return displayImage;
-        }
+        [[nodiscard]] cv::Mat GetDisplayImage() const;
 
         /**
          * @brief Checks if node has valid image.
          * @return True if display image is valid
          */
-        [[nodiscard]] bool HasValidImage() const
-        {
-            return !displayImage.empty();
-        }
+        [[nodiscard]] bool HasValidImage() const;
 
         /**
-         * @brief Returns last save status.
-         * @return True if last save was successful
+         * @brief Returns last save status, waiting for the write if it is still queued.
+         * @return True if the last Process() saved its image successfully
          */
-        [[nodiscard]] bool GetLastSaveStatus() const
-        {
-            return lastSaveSuccessful;
-        }
+        [[nodiscard]] bool GetLastSaveStatus() const;
+
+        /**
+         * @brief Returns the write queued by the last Process().
+         * @return Future of the save result (invalid if that Process() did not save)
+         */
+        [[nodiscard]] std::shared_future<bool> GetPendingSave() const;
+
+        /**
+         * @brief Returns cv::imwrite parameters used for a file format.
+         * @param format File extension without dot, any case (e.g. "png", "JPG")
+         * @param profile Speed/size trade-off
+         * @return Encoder parameters (empty for formats without tuned settings)
+         */
+        [[nodiscard]] static std::vector<int> GetEncodeParams(std::string_view format,
+            EncodeProfile profile = EncodeProfile::Balanced);
+
+        /**
+         * @brief Parses a Profile slot value.
+         * @param name "fastest", "balanced" or "smallest" (any case)
+         * @return Profile, or std::nullopt if unknown
+         */
+        [[nodiscard]] static std::optional<EncodeProfile> ParseEncodeProfile(std::string_view name);
 
     private:
-        cv::Mat inputImage;              ///< Input image to process
-        cv::Mat displayImage;            ///< Image prepared for display
-        bool lastSaveSuccessful = false; ///< Status of last save operation
+        inline static const std::string kDefaultFormat{ "png" };       ///< Format slot default and fallback
+        inline static const std::string kDefaultProfile{ "balanced" }; ///< Profile slot default and fallback
+
+        /**
+         * @brief One file written from the node's image.
+         */
+        struct EncodeTarget
+        {
+            std::filesystem::path path; ///< Destination file
+            std::vector<int> params;    ///< cv::imwrite parameters
+            int maxEdge = 0;            ///< Downscale so the longest edge fits (0 = full size)
+        };
+
+        mutable std::mutex resultMutex;       ///< Guards displayImage and pendingSave (concurrent context runs)
+        cv::Mat displayImage;                 ///< Image prepared for display
+        std::shared_future<bool> pendingSave; ///< Result of the last queued save (invalid if none)
+
+        /**
+         * @brief Replaces the results of the last Process().
+         * @param image Display image (empty if none)
+         * @param save Queued write (invalid if none)
+         */
+        void PublishResult(cv::Mat image, std::shared_future<bool> save);
+
+        /**
+         * @brief Builds the files the next save writes from the slots.
+         * @param savePath SavePath slot value (not empty)
+         * @return Full-size target followed by the thumbnail target, if any
+         */
+        [[nodiscard]] std::vector<EncodeTarget> GetEncodeTargets(const std::filesystem::path &savePath) const;
 
         /**
-         * @brief Saves image to file.
-         * @param filepath Save path
-         * @return True if successful
+         * @brief Saves image to every target, creating their directories if needed.
+         * @param nodeName Node name for log messages
+         * @param targets Files to write
+         * @param image Image to encode
+         * @return True if every file was written
+         * @note Runs on a write-behind thread, so it only uses its arguments.
          */
-        bool SaveImage(const std::string &filepath);
+        static bool SaveImage(const std::string &nodeName,
+            const std::vector<EncodeTarget> &targets,
+            const cv::Mat &image);
     };
 } // namespace VisionCraft::Vision::IO
@@ -0,0 +1,365 @@
+#include "Vision/IO/MappedImageReader.h"
+#include "Nodes/Core/MappedFile.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        /**
+         * @brief Stored pixels that already form a continuous cv::Mat.
+         */
+        struct PixelLayout
+        {
+            int rows = 0;      ///< Image rows
+            int cols = 0;      ///< Image columns
+            int type = 0;      ///< cv::Mat type
+            size_t offset = 0; ///< First pixel byte in the file
+        };
+
+        /**
+         * @brief Owner of the mapping behind zero-copy views.
+         *
+         * Views are adopted like cv2's NumPy bridge adopts arrays: the UMatData points at the mapped pixels and
+         * carries the MappedFile in userdata, so the last cv::Mat released unmaps the file. The allocator itself
+         * is never destroyed, so headers copied from a view stay valid however long they live.
+         */
+        class MappingAllocator final : public cv::MatAllocator
+        {
+        public:
+            static MappingAllocator &Get()
+            {
+                static MappingAllocator allocator;
+                return allocator;
+            }
+
+            cv::UMatData *Adopt(Nodes::MappedFile mapping, uchar *pixels, size_t bytes) const
+            {
+                auto *u = new cv::UMatData(this);
+                u->data = u->origdata = pixels;
+                u->size = bytes;
+                u->flags |= cv::UMatData::USER_ALLOCATED;
+                u->userdata = new Nodes::MappedFile(std::move(mapping));
+                return u;
+            }
+
+            // Only reached if a caller installs this allocator on a header; new buffers get ordinary memory
+            cv::UMatData *allocate(int dims,
+                const int *sizes,
+                int type,
+                void *data,
+                size_t *step,
+                cv::AccessFlag flags,
+                cv::UMatUsageFlags usageFlags) const override
+            {
+                return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data, step, flags, usageFlags);
+            }
+
+            bool allocate(cv::UMatData *data,
+                [[maybe_unused]] cv::AccessFlag accessFlags,
+                [[maybe_unused]] cv::UMatUsageFlags usageFlags) const override
+            {
+                return data != nullptr;
+            }
+
+            void deallocate(cv::UMatData *u) const override
+            {
+                if (!u)
+                {
+                    return;
+                }
+                delete static_cast<Nodes::MappedFile *>(u->userdata);
+                delete u;
+            }
+        };
+
+        template <typename T>
+        std::optional<T> ReadNative(std::span<const std::byte> bytes, size_t offset)
+        {
+            if (offset > bytes.size() || bytes.size() - offset < sizeof(T))
+            {
+                return std::nullopt;
+            }
+            T value;
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            return value;
+        }
+
+        bool IsPgmSpace(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        // "P5" width height maxval, separated by whitespace or '#' comments, then one whitespace byte and samples
+        std::optional<PixelLayout> ParsePgm(std::span<const std::byte> bytes)
+        {
+            const auto at = [&](size_t index) { return static_cast<char>(bytes[index]); };
+            if (bytes.size() < 3 || at(0) != 'P' || at(1) != '5')
+            {
+                return std::nullopt;
+            }
+
+            size_t position = 2;
+            const auto readNumber = [&]() -> std::optional<uint32_t> {
+                while (position < bytes.size() && (IsPgmSpace(at(position)) || at(position) == '#'))
+                {
+                    if (at(position) == '#')
+                    {
+                        while (position < bytes.size() && at(position) != '\n')
+                        {
+                            ++position;
+                        }
+                    }
+                    else
+                    {
+                        ++position;
+                    }
+                }
+
+                uint32_t value = 0;
+                size_t digits = 0;
+                while (position < bytes.size() && at(position) >= '0' && at(position) <= '9')
+                {
+                    if (++digits > 9)
+                    {
+                        return std::nullopt;
+                    }
+                    value = value * 10 + static_cast<uint32_t>(at(position) - '0');
+                    ++position;
+                }
+                return digits > 0 ? std::optional(value) : std::nullopt;
+            };
+
+            const auto width = readNumber();
+            const auto height = readNumber();
+            const auto maxValue = readNumber();
+            if (!width || !height || !maxValue || position >= bytes.size() || !IsPgmSpace(at(position)))
+            {
+                return std::nullopt;
+            }
+            if (*width == 0 || *height == 0 || *maxValue == 0 || *maxValue > 65535)
+            {
+                return std::nullopt;
+            }
+
+            // 16-bit samples are big-endian; elsewhere they need swapping, which imdecode does
+            const bool wide = *maxValue > 255;
+            if (wide && std::endian::native != std::endian::big)
+            {
+                return std::nullopt;
+            }
+            return PixelLayout{ static_cast<int>(*height),
+                static_cast<int>(*width),
+                wide ? CV_16UC1 : CV_8UC1,
+                position + 1 };
+        }
+
+        // Baseline TIFF, first image only: uncompressed, one sample per pixel, strips back to back
+        std::optional<PixelLayout> ParseTiff(std::span<const std::byte> bytes)
+        {
+            // Samples in the other byte order need swapping, so only the host's order is viewable
+            constexpr char kHostOrder = std::endian::native == std::endian::little ? 'I' : 'M';
+            if (bytes.size() < 8 || static_cast<char>(bytes[0]) != kHostOrder
+                || static_cast<char>(bytes[1]) != kHostOrder || ReadNative<uint16_t>(bytes, 2) != 42)
+            {
+                return std::nullopt;
+            }
+
+            struct Field
+            {
+                uint16_t type = 0;      ///< 3 = SHORT, 4 = LONG
+                uint32_t count = 0;     ///< Values (0 = absent)
+                size_t valueOffset = 0; ///< File offset of the first value
+            };
+            Field width, height, bitsPerSample, compression, photometric, stripOffsets, samplesPerPixel,
+                stripByteCounts, sampleFormat;
+
+            const auto directory = ReadNative<uint32_t>(bytes, 4);
+            const auto entryCount = directory ? ReadNative<uint16_t>(bytes, *directory) : std::nullopt;
+            if (!entryCount)
+            {
+                return std::nullopt;
+            }
+            for (size_t index = 0; index < *entryCount; ++index)
+            {
+                const size_t entry = *directory + 2 + (index * 12);
+                const auto tag = ReadNative<uint16_t>(bytes, entry);
+                const auto type = ReadNative<uint16_t>(bytes, entry + 2);
+                const auto count = ReadNative<uint32_t>(bytes, entry + 4);
+                const auto inlineOrOffset = ReadNative<uint32_t>(bytes, entry + 8);
+                if (!tag || !type || !count || !inlineOrOffset)
+                {
+                    return std::nullopt;
+                }
+
+                // Values fitting in four bytes are stored in the entry itself
+                const size_t typeSize = *type == 3 ? 2 : 4;
+                const Field field{ *type,
+                    *count,
+                    static_cast<uint64_t>(*count) * typeSize <= 4 ? entry + 8 : size_t{ *inlineOrOffset } };
+                switch (*tag)
+                {
+                case 256:
+                    width = field;
+                    break;
+                case 257:
+                    height = field;
+                    break;
+                case 258:
+                    bitsPerSample = field;
+                    break;
+                case 259:
+                    compression = field;
+                    break;
+                case 262:
+                    photometric = field;
+                    break;
+                case 273:
+                    stripOffsets = field;
+                    break;
+                case 277:
+                    samplesPerPixel = field;
+                    break;
+                case 279:
+                    stripByteCounts = field;
+                    break;
+                case 339:
+                    sampleFormat = field;
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            const auto value = [&](const Field &field, uint32_t index) -> std::optional<uint32_t> {
+                if (index >= field.count)
+                {
+                    return std::nullopt;
+                }
+                if (field.type == 3)
+                {
+                    const auto shortValue = ReadNative<uint16_t>(bytes, field.valueOffset + (size_t{ index } * 2));
+                    return shortValue ? std::optional<uint32_t>(*shortValue) : std::nullopt;
+                }
+                if (field.type == 4)
+                {
+                    return ReadNative<uint32_t>(bytes, field.valueOffset + (size_t{ index } * 4));
+                }
+                return std::nullopt;
+            };
+            const auto single = [&](const Field &field, uint32_t fallback) {
+                return field.count == 0 ? std::optional(fallback) : value(field, 0);
+            };
+
+            const auto cols = single(width, 0);
+            const auto rows = single(height, 0);
+            const auto bits = single(bitsPerSample, 1);
+            const auto format = single(sampleFormat, 1);
+            // Compression 1 = none, photometric 1 = BlackIsZero grayscale
+            if (!cols || !rows || !bits || !format || single(compression, 1) != 1u || single(photometric, 1) != 1u
+                || single(samplesPerPixel, 1) != 1u)
+            {
+                return std::nullopt;
+            }
+            if (*cols == 0 || *rows == 0 || *cols > INT_MAX || *rows > INT_MAX)
+            {
+                return std::nullopt;
+            }
+
+            int type = -1;
+            if (*format == 1 && *bits == 8)
+            {
+                type = CV_8UC1;
+            }
+            else if (*format == 1 && *bits == 16)
+            {
+                type = CV_16UC1;
+            }
+            else if (*format == 3 && *bits == 32)
+            {
+                type = CV_32FC1;
+            }
+            if (type < 0 || stripOffsets.count == 0 || stripByteCounts.count != stripOffsets.count)
+            {
+                return std::nullopt;
+            }
+
+            const auto first = value(stripOffsets, 0);
+            if (!first)
+            {
+                return std::nullopt;
+            }
+            uint64_t next = *first;
+            for (uint32_t strip = 0; strip < stripOffsets.count; ++strip)
+            {
+                const auto offset = value(stripOffsets, strip);
+                const auto length = value(stripByteCounts, strip);
+                if (!offset || !length || *offset != next)
+                {
+                    return std::nullopt;
+                }
+                next += *length;
+            }
+            return PixelLayout{ static_cast<int>(*rows), static_cast<int>(*cols), type, *first };
+        }
+
+        bool FitsInFile(const PixelLayout &layout, size_t fileSize)
+        {
+            const size_t rowBytes = static_cast<size_t>(layout.cols) * CV_ELEM_SIZE(layout.type);
+            return layout.offset <= fileSize
+                && static_cast<size_t>(layout.rows) <= (fileSize - layout.offset) / rowBytes;
+        }
+    } // namespace
+
+    cv::Mat MappedImageReader::Read(const std::filesystem::path &path)
+    {
+        Nodes::TraceScope trace("io", "MapImage");
+        if (trace.IsActive())
+        {
+            trace.SetDetail(path.filename().string());
+        }
+
+        Nodes::MappedFile mapping;
+        if (!mapping.Open(path, true) || mapping.GetBytes().empty())
+        {
+            return {};
+        }
+
+        const auto bytes = mapping.GetBytes();
+        auto layout = ParsePgm(bytes);
+        if (!layout)
+        {
+            layout = ParseTiff(bytes);
+        }
+
+        if (layout && FitsInFile(*layout, bytes.size()))
+        {
+            auto *pixels = reinterpret_cast<uchar *>(mapping.GetWritableBytes().data() + layout->offset);
+            cv::Mat view(layout->rows, layout->cols, layout->type, pixels);
+            view.u = MappingAllocator::Get().Adopt(std::move(mapping), pixels, view.total() * view.elemSize());
+            view.addref();
+            return view;
+        }
+
+        // cv::Mat sizes are int; anything larger goes through the stream decoder
+        if (bytes.size() > static_cast<size_t>(INT_MAX))
+        {
+            return cv::imread(path.string(), cv::IMREAD_UNCHANGED);
+        }
+        const cv::Mat encoded(1, static_cast<int>(bytes.size()), CV_8UC1, const_cast<std::byte *>(bytes.data()));
+        return cv::imdecode(encoded, cv::IMREAD_UNCHANGED);
+    }
+
+    bool MappedImageReader::IsMappedView(const cv::Mat &image)
+    {
+        return image.u && image.u->currAllocator == &MappingAllocator::Get();
+    }
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <filesystem>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Reads image files through a memory mapping instead of cv::imread's buffered stream.
+     *
+     * Files whose pixels are stored exactly as a cv::Mat lays them out come back as a cv::Mat header over
+     * the mapping, with no copy at all: binary PGM (8-bit; 16-bit only on big-endian hosts, as PGM samples
+     * are big-endian) and uncompressed single-channel TIFF (8/16-bit unsigned or 32-bit float, host byte
+     * order, contiguous strips), which covers raw sensor dumps. The mapping is copy-on-write, so a consumer
+     * writing into the image never touches the file, and it stays mapped until the last cv::Mat sharing
+     * it is released. Every other file is decoded by cv::imdecode straight from the mapped bytes, which
+     * skips the stream buffer cv::imread copies through.
+     *
+     * Pixels are returned as stored (cv::IMREAD_UNCHANGED): 16-bit and single-channel files keep their
+     * depth and channel count. Color PPM and TIFF store RGB order, so they are decoded into BGR rather
+     * than viewed.
+     *
+     * @note A view reads the file's pages on demand; replace files by renaming rather than rewriting them
+     *       in place while their images are in use.
+     */
+    class MappedImageReader
+    {
+    public:
+        /**
+         * @brief Reads image file.
+         * @param path Image file path
+         * @return Image (a view of the mapping when the layout allows it), or empty if missing or unreadable
+         * @throws cv::Exception from cv::imdecode
+         */
+        [[nodiscard]] static cv::Mat Read(const std::filesystem::path &path);
+
+        /**
+         * @brief Checks if an image shares pixels with a file mapping.
+         * @param image Image returned by Read() (or a copy of its header)
+         * @return True for zero-copy views
+         */
+        [[nodiscard]] static bool IsMappedView(const cv::Mat &image);
+    };
+} // namespace VisionCraft::Vision::IO
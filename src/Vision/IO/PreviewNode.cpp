@@ -1,6 +1,9 @@
 #include "Vision/IO/PreviewNode.h"
 #include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
 #include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Nodes/Core/Tracer.h"
 
 namespace VisionCraft::Vision::IO
 {
@@ -11,90 +14,110 @@ namespace VisionCraft::Vision::IO
         CreateExecutionOutputPin("Then");
 
         // Data pins
-        CreateInputSlot("Input");
-        CreateOutputSlot("Output");
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
     }
 
     void PreviewNode::Process()
     {
-        auto inputData = GetInputSlot("Input").GetData<cv::Mat>();
+        auto inputData = GetInputSlot("Input").GetDataIf<cv::Mat>();
         if (!inputData || inputData->empty())
         {
-            LOG_WARN("PreviewNode {}: No input image to preview", GetName());
-            inputImage = cv::Mat{};
-            outputImage = cv::Mat{};
+            LOG_HOT_WARN("PreviewNode {}: No input image to preview", GetName());
+            results.Publish(cv::Mat{});
             ClearOutputSlot("Output");
             return;
         }
 
-        inputImage = *inputData;
-        outputImage = inputImage; // Shallow copy - cv::Mat uses reference counting
-        // Note: Texture update is deferred to the main thread (rendering)
-        // OpenGL operations cannot be performed from worker threads
-        SetOutputSlotData("Output", outputImage);
+        const cv::Mat image = *inputData; // Shallow copy - cv::Mat uses reference counting
+        // The render thread takes the image and uploads it; OpenGL cannot be called from worker threads
+        results.Publish(image);
+        SetOutputSlotData("Output", image);
 
-        LOG_INFO("PreviewNode {}: Processing image ({}x{}, {} channels)",
+        LOG_HOT_INFO("PreviewNode {}: Processing image ({}x{}, {} channels)",
             GetName(),
-            outputImage.cols,
-            outputImage.rows,
-            outputImage.channels());
+            image.cols,
+            image.rows,
+            image.channels());
     }
 
     void PreviewNode::SetInputImage(const cv::Mat &image)
     {
-        inputImage = image;
+        SetInputSlotData("Input", image);
     }
 
-    const cv::Mat &PreviewNode::GetOutputImage() const
+    cv::Mat PreviewNode::GetOutputImage() const
     {
-        return outputImage;
+        return results.Latest();
     }
 
     bool PreviewNode::HasValidImage() const
     {
-        return !outputImage.empty() && texture.IsValid();
+        return !results.Latest().empty() && texture.IsValid();
     }
 
     GLuint PreviewNode::GetTextureId() const
     {
-        return texture.Get();
+        return texture.GetThumbnailId();
+    }
+
+    GLuint PreviewNode::GetFullResolutionTextureId()
+    {
+        return texture.GetFullResolutionId();
+    }
+
+    void PreviewNode::MarkTextureDrawn()
+    {
+        texture.MarkDrawn();
+    }
+
+    void PreviewNode::ReleaseFullResolutionTexture()
+    {
+        texture.ReleaseFullResolution();
+    }
+
+    bool PreviewNode::NeedsTextureUpdate() const
+    {
+        return results.HasUpdate();
     }
 
     void PreviewNode::UpdateTexture()
     {
-        if (outputImage.empty())
+        Nodes::TraceScope trace("gpu", "UpdateTexture");
+        if (trace.IsActive())
         {
-            texture.Reset();
-            return;
+            trace.SetDetail(GetName());
         }
 
-        cv::Mat rgbImage;
-        cv::cvtColor(outputImage, rgbImage, cv::COLOR_BGR2RGB);
+        // Unchanged results keep the uploaded texture
+        if (!results.Refresh())
+        {
+            return;
+        }
 
-        if (!texture.Create())
+        const cv::Mat &image = results.Latest();
+        if (image.empty())
         {
+            texture.Reset();
             return;
         }
 
-        glBindTexture(GL_TEXTURE_2D, texture.Get());
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RGB, rgbImage.cols, rgbImage.rows, 0, GL_RGB, GL_UNSIGNED_BYTE, rgbImage.data);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        if (!texture.Update(image))
+        {
+            LOG_ERROR("PreviewNode {}: Failed to upload preview texture", GetName());
+        }
     }
 
     std::pair<float, float> PreviewNode::CalculatePreviewDimensions(float nodeContentWidth,
         [[maybe_unused]] float maxHeight) const
     {
-        if (!HasValidImage() || outputImage.rows <= 0 || outputImage.cols <= 0)
+        const cv::Mat image = GetOutputImage();
+        if (image.rows <= 0 || image.cols <= 0 || !texture.IsValid())
         {
             return { 0.0f, 0.0f };
         }
 
-        float imageAspect = static_cast<float>(outputImage.cols) / static_cast<float>(outputImage.rows);
+        float imageAspect = static_cast<float>(image.cols) / static_cast<float>(image.rows);
 
         float previewWidth = nodeContentWidth;
         float previewHeight = previewWidth / imageAspect;
@@ -115,4 +138,14 @@ namespace VisionCraft::Vision::IO
         return actualPreviewHeight + imagePreviewSpacing;
     }
 
+    bool PreviewNode::GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const
+    {
+        const std::string input = writer.Input("Input");
+        if (input.empty())
+        {
+            return writer.Fail("Input is not connected");
+        }
+        writer.Line(writer.Output("Output") + " = " + input + ";");
+        return true;
+    }
 } // namespace VisionCraft::Vision::IO
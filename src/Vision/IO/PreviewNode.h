@@ -1,7 +1,8 @@
 #pragma once
 
 #include "Nodes/Core/Node.h"
-#include "Texture.h"
+#include "Nodes/Core/ResultMailbox.h"
+#include "Vision/IO/PreviewTexture.h"
 #include <glad/glad.h>
 #include <opencv2/opencv.hpp>
 
@@ -9,6 +10,10 @@ namespace VisionCraft::Vision::IO
 {
     /**
      * @brief Node for previewing images while passing them through.
+     *
+     * Process() publishes each image to a Nodes::ResultMailbox, and the render thread takes the newest one
+     * in UpdateTexture() once per frame, so neither side locks or waits and only changed images are uploaded.
+     * GetOutputImage() and the texture accessors belong to the render thread.
      */
     class PreviewNode : public Nodes::Node
     {
@@ -34,11 +39,36 @@ namespace VisionCraft::Vision::IO
             return "PreviewNode";
         }
 
+        /**
+         * @brief Excludes node from the output cache; it uploads a GPU texture as a side effect.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Marks node as a graph result; it shows the image in the editor.
+         * @return Always true
+         */
+        [[nodiscard]] bool IsSink() const override
+        {
+            return true;
+        }
+
         /**
          * @brief Processes node by passing input to output.
          */
         void Process() override;
 
+        /**
+         * @brief Passes the input through; compiled pipelines show no previews.
+         * @param writer Receives the node's code
+         * @return True once Input is connected
+         */
+        [[nodiscard]] bool GeneratePipelineCode(Nodes::PipelineCodeWriter &writer) const override;
+
         /**
          * @brief Sets input image.
          * @param image Input image
@@ -46,10 +76,11 @@ namespace VisionCraft::Vision::IO
         void SetInputImage(const cv::Mat &image);
 
         /**
-         * @brief Returns output image.
-         * @return Pass-through image
+         * @brief Returns the image the editor shows.
+         * @return Image taken by the last UpdateTexture() (shares pixel data with the node)
+         * @note Render thread only; the newest processed image is in the Output slot.
          */
-        [[nodiscard]] const cv::Mat &GetOutputImage() const;
+        [[nodiscard]] cv::Mat GetOutputImage() const;
 
         /**
          * @brief Checks if image is available for preview.
@@ -58,11 +89,36 @@ namespace VisionCraft::Vision::IO
         [[nodiscard]] bool HasValidImage() const;
 
         /**
-         * @brief Returns OpenGL texture ID.
+         * @brief Returns OpenGL texture ID of the in-canvas thumbnail.
          * @return Texture ID
          */
         [[nodiscard]] GLuint GetTextureId() const;
 
+        /**
+         * @brief Returns OpenGL texture ID of the full-resolution image, uploading it on first use.
+         * @return Texture ID (0 if there is no image)
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        [[nodiscard]] GLuint GetFullResolutionTextureId();
+
+        /**
+         * @brief Records that the thumbnail is drawn this frame, uploading it again if the budget released it.
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        void MarkTextureDrawn();
+
+        /**
+         * @brief Frees the full-resolution texture once nothing shows it.
+         * @note Must be called on the main thread (OpenGL context thread).
+         */
+        void ReleaseFullResolutionTexture();
+
+        /**
+         * @brief Checks if the previewed image changed since the last UpdateTexture().
+         * @return True if UpdateTexture() should run
+         */
+        [[nodiscard]] bool NeedsTextureUpdate() const;
+
         /**
          * @brief Calculates preview dimensions for rendering.
          * @param nodeContentWidth Available content width
@@ -80,14 +136,16 @@ namespace VisionCraft::Vision::IO
         [[nodiscard]] float CalculateExtraHeight(float nodeContentWidth, float zoomLevel) const override;
 
         /**
-         * @brief Updates OpenGL texture from current image.
+         * @brief Takes the newest processed image, if any, and uploads its thumbnail.
+         *
+         * The texture storage is reused while the image size is unchanged; without a new image nothing is uploaded.
+         *
          * @note Must be called on the main thread (OpenGL context thread).
          */
         void UpdateTexture();
 
     private:
-        cv::Mat inputImage;     ///< Input image from connected node
-        cv::Mat outputImage;    ///< Output image (same as input)
-        Kappa::Texture texture; ///< RAII-managed OpenGL texture for display
+        Nodes::ResultMailbox<cv::Mat> results; ///< Processed images handed to the render thread
+        PreviewTexture texture;                ///< Thumbnail and full-resolution textures (render thread)
     };
 } // namespace VisionCraft::Vision::IO
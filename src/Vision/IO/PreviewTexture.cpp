@@ -0,0 +1,150 @@
+#include "Vision/IO/PreviewTexture.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        // Thumbnail size keeping the aspect ratio, or std::nullopt if the image already fits
+        std::optional<cv::Size> ThumbnailSize(const cv::Size &imageSize, int maxEdge)
+        {
+            const int longestEdge = std::max(imageSize.width, imageSize.height);
+            if (imageSize.empty() || maxEdge <= 0 || longestEdge <= maxEdge)
+            {
+                return std::nullopt;
+            }
+
+            const double scale = static_cast<double>(maxEdge) / longestEdge;
+            return cv::Size(std::max(1, static_cast<int>(std::lround(imageSize.width * scale))),
+                std::max(1, static_cast<int>(std::lround(imageSize.height * scale))));
+        }
+    } // namespace
+
+    cv::Mat PreviewTexture::MakeThumbnail(const cv::Mat &image, int maxEdge)
+    {
+        const auto size = ThumbnailSize(image.size(), maxEdge);
+        if (!size)
+        {
+            return image;
+        }
+        cv::Mat thumbnailImage;
+        cv::resize(image, thumbnailImage, *size, 0.0, 0.0, cv::INTER_AREA);
+        return thumbnailImage;
+    }
+
+    cv::Mat PreviewTexture::MakeThumbnail(const Nodes::ImagePyramid &pyramid, int maxEdge)
+    {
+        const cv::Mat base = pyramid.GetBase();
+        const auto size = ThumbnailSize(base.size(), maxEdge);
+        return size ? pyramid.Sample(*size, cv::INTER_AREA) : base;
+    }
+
+    TextureBudget &PreviewTexture::GetBudget()
+    {
+        static TextureBudget budget(Constants::PreviewTexture::kVideoMemoryBudget);
+        return budget;
+    }
+
+    void PreviewTexture::ReleaseOverBudget()
+    {
+        for (void *owner : GetBudget().EndFrame())
+        {
+            // Only PreviewTexture registers with the budget; the images stay for MarkDrawn() to upload again
+            auto *texture = static_cast<PreviewTexture *>(owner);
+            texture->thumbnail.Reset();
+            texture->fullResolution.Reset();
+            texture->fullResolutionStale = true;
+        }
+    }
+
+    PreviewTexture::~PreviewTexture()
+    {
+        GetBudget().Remove(this);
+    }
+
+    bool PreviewTexture::Update(const cv::Mat &image)
+    {
+        if (image.empty())
+        {
+            Reset();
+            return true;
+        }
+
+        source = image;
+        fullResolutionStale = true;
+        return UploadThumbnail(MakeThumbnail(image, Constants::PreviewTexture::kThumbnailEdge));
+    }
+
+    bool PreviewTexture::Update(const Nodes::ImagePyramid &pyramid)
+    {
+        if (pyramid.IsEmpty())
+        {
+            Reset();
+            return true;
+        }
+
+        source = pyramid.GetBase();
+        fullResolutionStale = true;
+        return UploadThumbnail(MakeThumbnail(pyramid, Constants::PreviewTexture::kThumbnailEdge));
+    }
+
+    void PreviewTexture::MarkDrawn()
+    {
+        if (!thumbnailImage.empty() && !thumbnail.IsValid() && !thumbnail.Upload(thumbnailImage))
+        {
+            thumbnailImage = cv::Mat{};
+        }
+        GetBudget().Touch(this, GetResidentBytes());
+    }
+
+    GLuint PreviewTexture::GetFullResolutionId()
+    {
+        if (fullResolutionStale && !source.empty())
+        {
+            fullResolutionStale = false;
+            fullResolution.Upload(source);
+        }
+        // The inspector shows it whether or not the node is on screen
+        GetBudget().Touch(this, GetResidentBytes());
+        return fullResolution.Get();
+    }
+
+    void PreviewTexture::ReleaseFullResolution()
+    {
+        fullResolution.Reset();
+        fullResolutionStale = true;
+        GetBudget().SetBytes(this, GetResidentBytes());
+    }
+
+    void PreviewTexture::Reset()
+    {
+        thumbnail.Reset();
+        fullResolution.Reset();
+        fullResolutionStale = true;
+        source = cv::Mat{};
+        thumbnailImage = cv::Mat{};
+        GetBudget().Remove(this);
+    }
+
+    bool PreviewTexture::UploadThumbnail(cv::Mat image)
+    {
+        thumbnailImage = std::move(image);
+        const bool uploaded = thumbnail.Upload(thumbnailImage);
+        if (!uploaded)
+        {
+            thumbnailImage = cv::Mat{};
+        }
+        GetBudget().Touch(this, GetResidentBytes());
+        return uploaded;
+    }
+
+    size_t PreviewTexture::GetResidentBytes() const
+    {
+        return thumbnail.GetStorageBytes() + fullResolution.GetStorageBytes();
+    }
+} // namespace VisionCraft::Vision::IO
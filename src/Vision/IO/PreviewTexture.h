@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Nodes/Core/ImagePyramid.h"
+#include "Vision/IO/StreamingTexture.h"
+#include "Vision/IO/TextureBudget.h"
+
+#include <opencv2/opencv.hpp>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Textures showing one node's image: a thumbnail for the canvas and full resolution on demand.
+     *
+     * In-canvas previews are drawn a few hundred pixels wide, so Update() uploads only a thumbnail whose
+     * longest edge is Constants::PreviewTexture::kThumbnailEdge (downscaled with INTER_AREA). The
+     * full-resolution texture is uploaded by GetFullResolutionId() when an inspector asks for it, and its
+     * video memory is freed again by ReleaseFullResolution().
+     *
+     * All preview textures share one TextureBudget of Constants::PreviewTexture::kVideoMemoryBudget. Callers
+     * report each draw with MarkDrawn() (uploads count as draws), and ReleaseOverBudget() frees the textures
+     * of the least recently drawn previews once per frame while the total exceeds the budget. Released
+     * previews keep their image and thumbnail in memory, so MarkDrawn() uploads them again when they scroll
+     * back into view.
+     *
+     * Not thread-safe; every method must be called on the thread owning the OpenGL context.
+     */
+    class PreviewTexture
+    {
+    public:
+        /**
+         * @brief Downscales an image to thumbnail size.
+         * @param image Source image
+         * @param maxEdge Longest edge of the thumbnail in pixels
+         * @return @p image itself if it already fits, else an INTER_AREA downscale keeping the aspect ratio
+         */
+        [[nodiscard]] static cv::Mat MakeThumbnail(const cv::Mat &image, int maxEdge);
+
+        /**
+         * @brief Samples a pyramid at thumbnail size, building only the levels down to it.
+         * @param pyramid Source pyramid (levels built here stay with it for other readers)
+         * @param maxEdge Longest edge of the thumbnail in pixels
+         * @return Level 0 if it already fits, else an INTER_AREA sample keeping the aspect ratio
+         */
+        [[nodiscard]] static cv::Mat MakeThumbnail(const Nodes::ImagePyramid &pyramid, int maxEdge);
+
+        /**
+         * @brief Returns the video memory budget shared by all preview textures.
+         * @return Budget (render thread only)
+         */
+        [[nodiscard]] static TextureBudget &GetBudget();
+
+        /**
+         * @brief Frees the textures of the least recently drawn previews while the budget is exceeded.
+         * @note Call once per frame after everything was drawn; previews drawn this frame are kept.
+         */
+        static void ReleaseOverBudget();
+
+        PreviewTexture() = default;
+
+        /**
+         * @brief Deletes the textures and leaves the budget.
+         */
+        ~PreviewTexture();
+
+        PreviewTexture(const PreviewTexture &) = delete;
+        PreviewTexture &operator=(const PreviewTexture &) = delete;
+
+        /**
+         * @brief Shows a new image: uploads its thumbnail and marks the full-resolution texture stale.
+         * @param image Image to show (shares pixel data; empty resets both textures)
+         * @return False if the thumbnail could not be uploaded
+         */
+        bool Update(const cv::Mat &image);
+
+        /**
+         * @brief Shows a pyramid's image, taking the thumbnail from its levels.
+         * @param pyramid Pyramid to show (shares pixel data; empty resets both textures)
+         * @return False if the thumbnail could not be uploaded
+         */
+        bool Update(const Nodes::ImagePyramid &pyramid);
+
+        /**
+         * @brief Records that the preview is drawn this frame, uploading a released thumbnail again.
+         */
+        void MarkDrawn();
+
+        /**
+         * @brief Returns the thumbnail texture ID.
+         * @return Texture ID (0 if nothing is uploaded or the thumbnail was released since MarkDrawn())
+         */
+        [[nodiscard]] GLuint GetThumbnailId() const
+        {
+            return thumbnail.Get();
+        }
+
+        /**
+         * @brief Checks if there is a thumbnail to show.
+         * @return True if the thumbnail was uploaded; it may be released off screen until the next MarkDrawn()
+         */
+        [[nodiscard]] bool IsValid() const
+        {
+            return !thumbnailImage.empty();
+        }
+
+        /**
+         * @brief Returns the full-resolution texture ID, uploading the current image first if needed.
+         * @return Texture ID (0 if there is no image or the upload failed)
+         */
+        [[nodiscard]] GLuint GetFullResolutionId();
+
+        /**
+         * @brief Frees the full-resolution texture, e.g. when its inspector closes.
+         */
+        void ReleaseFullResolution();
+
+        /**
+         * @brief Frees both textures.
+         */
+        void Reset();
+
+    private:
+        /**
+         * @brief Keeps and uploads a new thumbnail.
+         * @param image Thumbnail image
+         * @return False if the upload failed (nothing is shown then)
+         */
+        bool UploadThumbnail(cv::Mat image);
+
+        /**
+         * @brief Returns the video memory both textures hold.
+         * @return Bytes of texture storage
+         */
+        [[nodiscard]] size_t GetResidentBytes() const;
+
+        StreamingTexture thumbnail;      ///< Canvas preview texture
+        StreamingTexture fullResolution; ///< Inspector texture (uploaded on demand)
+        cv::Mat source;                  ///< Image shown (shares pixel data with the node)
+        cv::Mat thumbnailImage;          ///< Pixels of thumbnail, kept to upload it again after a release
+        bool fullResolutionStale = true; ///< source changed since fullResolution was uploaded
+    };
+} // namespace VisionCraft::Vision::IO
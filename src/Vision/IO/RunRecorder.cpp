@@ -0,0 +1,319 @@
+#include "Vision/IO/RunRecorder.h"
+#include "Logger.h"
+#include "Nodes/Core/NodeOutputCache.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr const char *kRecordingFile = "recording.json";
+        constexpr const char *kGraphFile = "graph.json";
+        constexpr const char *kInputsDirectory = "inputs";
+        constexpr const char *kImageInputType = "ImageInputNode";
+        constexpr int kBundleVersion = 1;
+
+        /**
+         * @brief Process() times of one node over the timed runs.
+         */
+        struct NodeSamples
+        {
+            std::string nodeName;       ///< Name in the latest run
+            std::string nodeType;       ///< Node::GetType()
+            std::vector<int64_t> times; ///< Microseconds per run in which Process() ran
+            size_t outputBytes = 0;     ///< Output slot bytes in the latest such run
+        };
+
+        /**
+         * @brief Medians of the timed runs.
+         */
+        struct Measurement
+        {
+            std::chrono::microseconds total{ 0 };                 ///< Median wall-clock time of a run
+            size_t peakBytes = 0;                                 ///< Highest slot memory over the runs
+            std::vector<Nodes::NodeId> order;                     ///< Nodes in plan order
+            std::unordered_map<Nodes::NodeId, NodeSamples> nodes; ///< Samples per node
+        };
+
+        std::chrono::microseconds Median(std::vector<int64_t> values)
+        {
+            if (values.empty())
+            {
+                return std::chrono::microseconds{ 0 };
+            }
+            const auto middle = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+            std::ranges::nth_element(values, middle);
+            return std::chrono::microseconds{ *middle };
+        }
+
+        // Runs the graph with every node executing each time; the output cache would turn later runs into hits
+        std::optional<Measurement> Measure(Nodes::NodeEditor &editor, size_t runs, std::string &error)
+        {
+            const bool cacheEnabled = editor.IsOutputCacheEnabled();
+            editor.SetOutputCacheEnabled(false);
+
+            Measurement measurement;
+            std::vector<int64_t> totals;
+            for (size_t run = 0; run < std::max<size_t>(runs, 1); ++run)
+            {
+                editor.MarkAllNodesDirty();
+                const bool executed = editor.Execute();
+                const auto statistics = editor.GetExecutionStatistics().GetLatest();
+                if (statistics && statistics->writesFlushed.valid())
+                {
+                    statistics->writesFlushed.wait(); // Saves of one run must not overlap the next
+                }
+                if (!executed || !statistics)
+                {
+                    error = "Run " + std::to_string(run + 1) + " of the graph failed";
+                    editor.SetOutputCacheEnabled(cacheEnabled);
+                    return std::nullopt;
+                }
+
+                totals.push_back(statistics->totalTime.count());
+                measurement.peakBytes = std::max(measurement.peakBytes, statistics->peakSlotBytes);
+                for (const auto &record : statistics->nodes)
+                {
+                    auto [entry, inserted] = measurement.nodes.try_emplace(record.nodeId);
+                    if (inserted)
+                    {
+                        measurement.order.push_back(record.nodeId);
+                    }
+                    entry->second.nodeName = record.nodeName;
+                    entry->second.nodeType = record.nodeType;
+                    if (record.outcome == Nodes::StepOutcome::Processed)
+                    {
+                        entry->second.times.push_back(record.duration.count());
+                        entry->second.outputBytes = record.outputBytes;
+                    }
+                }
+            }
+
+            editor.SetOutputCacheEnabled(cacheEnabled);
+            measurement.total = Median(std::move(totals));
+            return measurement;
+        }
+
+        std::optional<nlohmann::json> ReadJson(const std::filesystem::path &path)
+        {
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream)
+            {
+                return std::nullopt;
+            }
+            auto json = nlohmann::json::parse(stream, nullptr, false);
+            if (json.is_discarded())
+            {
+                return std::nullopt;
+            }
+            return json;
+        }
+    } // namespace
+
+    bool RunRecorder::Record(Nodes::NodeEditor &editor,
+        const std::filesystem::path &bundleDirectory,
+        const RecordOptions &options,
+        std::string &error)
+    {
+        std::error_code fileError;
+        std::filesystem::create_directories(bundleDirectory / kInputsDirectory, fileError);
+        if (fileError)
+        {
+            error = "Cannot create '" + bundleDirectory.string() + "': " + fileError.message();
+            return false;
+        }
+
+        // Inputs first: a bundle whose images cannot be identified is useless for comparison
+        nlohmann::json inputs = nlohmann::json::array();
+        for (const auto id : editor.GetNodeIds())
+        {
+            const auto *node = editor.GetNode(id);
+            if (!node || node->GetType() != kImageInputType)
+            {
+                continue;
+            }
+            const auto path = node->GetInputValue<std::filesystem::path>("FilePath").value_or(std::filesystem::path{});
+            if (path.empty())
+            {
+                continue;
+            }
+
+            const auto hash = HashFile(path);
+            if (!hash)
+            {
+                error = "Cannot read input '" + path.string() + "' of node " + std::to_string(id);
+                return false;
+            }
+
+            nlohmann::json input = {
+                { "node", id }, { "path", std::filesystem::absolute(path).string() }, { "hash", *hash }
+            };
+            if (options.embedInputs)
+            {
+                const auto embedded = std::to_string(id) + path.extension().string();
+                std::filesystem::copy_file(path,
+                    bundleDirectory / kInputsDirectory / embedded,
+                    std::filesystem::copy_options::overwrite_existing,
+                    fileError);
+                if (fileError)
+                {
+                    error = "Cannot copy input '" + path.string() + "': " + fileError.message();
+                    return false;
+                }
+                input["file"] = embedded;
+            }
+            inputs.push_back(std::move(input));
+        }
+
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+        if (!editor.SaveToFile(bundleDirectory / kGraphFile, nodePositions))
+        {
+            error = "Cannot save the graph to '" + bundleDirectory.string() + "'";
+            return false;
+        }
+
+        const auto measurement = Measure(editor, options.runs, error);
+        if (!measurement)
+        {
+            return false;
+        }
+
+        nlohmann::json nodes = nlohmann::json::array();
+        for (const auto id : measurement->order)
+        {
+            const auto &samples = measurement->nodes.at(id);
+            nodes.push_back({ { "id", id },
+                { "name", samples.nodeName },
+                { "type", samples.nodeType },
+                { "samples", samples.times.size() },
+                { "microseconds", Median(samples.times).count() },
+                { "outputBytes", samples.outputBytes } });
+        }
+
+        const nlohmann::json recording = { { "version", kBundleVersion },
+            { "runs", std::max<size_t>(options.runs, 1) },
+            { "parallel", editor.GetExecutionMode() == Nodes::ExecutionMode::Parallel },
+            { "totalMicroseconds", measurement->total.count() },
+            { "peakSlotBytes", measurement->peakBytes },
+            { "inputs", std::move(inputs) },
+            { "nodes", std::move(nodes) } };
+
+        std::ofstream stream(bundleDirectory / kRecordingFile, std::ios::binary | std::ios::trunc);
+        if (!stream || !(stream << recording.dump(2)) || !stream.flush())
+        {
+            error = "Cannot write '" + (bundleDirectory / kRecordingFile).string() + "'";
+            return false;
+        }
+
+        LOG_INFO("Recorded {} nodes over {} runs into '{}'",
+            measurement->order.size(),
+            std::max<size_t>(options.runs, 1),
+            bundleDirectory.string());
+        return true;
+    }
+
+    std::optional<ReplayReport> RunRecorder::Replay(Nodes::NodeEditor &editor,
+        const std::filesystem::path &bundleDirectory,
+        const ReplayOptions &options,
+        std::string &error)
+    {
+        const auto recording = ReadJson(bundleDirectory / kRecordingFile);
+        if (!recording || recording->value("version", 0) != kBundleVersion)
+        {
+            error = "'" + bundleDirectory.string() + "' is not a run recording";
+            return std::nullopt;
+        }
+
+        std::unordered_map<Nodes::NodeId, std::pair<float, float>> nodePositions;
+        if (!editor.LoadFromFile(bundleDirectory / kGraphFile, nodePositions))
+        {
+            error = "Cannot load the recorded graph from '" + bundleDirectory.string() + "'";
+            return std::nullopt;
+        }
+
+        // Different images would make every timing incomparable, so a changed input fails the replay
+        for (const auto &input : recording->value("inputs", nlohmann::json::array()))
+        {
+            const auto id = input.value("node", Nodes::NodeId{ 0 });
+            auto *node = editor.GetNode(id);
+            if (!node || node->GetType() != kImageInputType)
+            {
+                error = "Recorded input node " + std::to_string(id) + " is missing from the graph";
+                return std::nullopt;
+            }
+
+            const auto path = input.contains("file")
+                                  ? bundleDirectory / kInputsDirectory / input.value("file", std::string{})
+                                  : std::filesystem::path(input.value("path", std::string{}));
+            if (HashFile(path) != input.value("hash", uint64_t{ 0 }))
+            {
+                error = "Input '" + path.string() + "' of node " + std::to_string(id) + " differs from the recording";
+                return std::nullopt;
+            }
+            node->SetInputSlotDefault("FilePath", path);
+        }
+
+        const auto measurement = Measure(editor, options.runs, error);
+        if (!measurement)
+        {
+            return std::nullopt;
+        }
+
+        ReplayReport report;
+        report.baselineTotal = std::chrono::microseconds{ recording->value("totalMicroseconds", int64_t{ 0 }) };
+        report.replayTotal = measurement->total;
+        report.baselinePeakBytes = recording->value("peakSlotBytes", size_t{ 0 });
+        report.replayPeakBytes = measurement->peakBytes;
+
+        for (const auto &recorded : recording->value("nodes", nlohmann::json::array()))
+        {
+            NodeComparison comparison;
+            comparison.nodeId = recorded.value("id", Nodes::NodeId{ 0 });
+            comparison.nodeName = recorded.value("name", std::string{});
+            comparison.nodeType = recorded.value("type", std::string{});
+            comparison.baselineTime = std::chrono::microseconds{ recorded.value("microseconds", int64_t{ 0 }) };
+            comparison.baselineOutputBytes = recorded.value("outputBytes", size_t{ 0 });
+
+            const auto replayed = measurement->nodes.find(comparison.nodeId);
+            if (replayed != measurement->nodes.end() && !replayed->second.times.empty())
+            {
+                comparison.processed = true;
+                comparison.replayTime = Median(replayed->second.times);
+                comparison.replayOutputBytes = replayed->second.outputBytes;
+
+                const auto slowdown = comparison.replayTime - comparison.baselineTime;
+                comparison.regressed =
+                    slowdown >= options.minimumSlowdown
+                    && static_cast<double>(comparison.replayTime.count())
+                           > static_cast<double>(comparison.baselineTime.count()) * (1.0 + options.slowdownThreshold);
+            }
+            report.regressions += comparison.regressed ? 1 : 0;
+            report.nodes.push_back(std::move(comparison));
+        }
+
+        std::ranges::stable_sort(report.nodes, [](const NodeComparison &a, const NodeComparison &b) {
+            return a.replayTime - a.baselineTime > b.replayTime - b.baselineTime;
+        });
+        return report;
+    }
+
+    std::optional<uint64_t> RunRecorder::HashFile(const std::filesystem::path &path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+        std::string bytes{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+        return Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ std::move(bytes) });
+    }
+
+} // namespace VisionCraft::Vision::IO
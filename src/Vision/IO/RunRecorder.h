@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Settings of RunRecorder::Record().
+     */
+    struct RecordOptions
+    {
+        size_t runs = Constants::Replay::kDefaultRuns; ///< Timed runs the baseline is the median of
+        bool embedInputs = true;                       ///< Copy input images into the bundle (false = hashes only)
+    };
+
+    /**
+     * @brief Settings of RunRecorder::Replay().
+     */
+    struct ReplayOptions
+    {
+        size_t runs = Constants::Replay::kDefaultRuns;                           ///< Timed runs to take medians of
+        double slowdownThreshold = Constants::Replay::kDefaultSlowdownThreshold; ///< Allowed fraction slower
+        std::chrono::microseconds minimumSlowdown{ Constants::Replay::kMinimumSlowdownMicroseconds }; ///< Noise
+    };
+
+    /**
+     * @brief Recorded and replayed cost of one node.
+     */
+    struct NodeComparison
+    {
+        Nodes::NodeId nodeId = 0;                    ///< Node ID
+        std::string nodeName;                        ///< Name at recording time
+        std::string nodeType;                        ///< Node::GetType()
+        std::chrono::microseconds baselineTime{ 0 }; ///< Recorded median Process() time
+        std::chrono::microseconds replayTime{ 0 };   ///< Replayed median Process() time
+        size_t baselineOutputBytes = 0;              ///< Output slot bytes when recorded
+        size_t replayOutputBytes = 0;                ///< Output slot bytes when replayed
+        bool processed = false;                      ///< Process() ran during replay
+        bool regressed = false;                      ///< Slower beyond both ReplayOptions limits
+    };
+
+    /**
+     * @brief Outcome of replaying a bundle against its recorded baseline.
+     */
+    struct ReplayReport
+    {
+        std::chrono::microseconds baselineTotal{ 0 }; ///< Recorded median wall-clock time of a run
+        std::chrono::microseconds replayTotal{ 0 };   ///< Replayed median wall-clock time of a run
+        size_t baselinePeakBytes = 0;                 ///< Recorded slot memory high-water mark
+        size_t replayPeakBytes = 0;                   ///< Replayed slot memory high-water mark
+        std::vector<NodeComparison> nodes;            ///< Recorded nodes, largest slowdown first
+        size_t regressions = 0;                       ///< Nodes with regressed set
+    };
+
+    /**
+     * @brief Records a graph run into a bundle and replays it later to catch performance regressions.
+     *
+     * Record() saves the graph with its parameters, the image files its ImageInputNodes read (or only their
+     * hashes), and the median Process() time and output memory of every node over several runs. Replay()
+     * loads the bundle into another editor, possibly built from newer code, runs it the same number of
+     * times and compares node by node. Medians keep one descheduled run from raising a false alarm, and a
+     * slowdown must exceed both a ratio and an absolute floor so that microsecond nodes stay quiet.
+     *
+     * The output cache is switched off for the timed runs, so every run executes every node; other settings
+     * (execution mode, tiling, workers) are the editor's, and should match between recording and replay for
+     * timings to be comparable.
+     *
+     * Bundle layout: recording.json, graph.json, and inputs/ holding one copy per input node when embedded.
+     */
+    class RunRecorder
+    {
+    public:
+        /**
+         * @brief Runs the editor's graph and writes a bundle describing it.
+         * @param editor Editor holding the graph, with any overrides applied
+         * @param bundleDirectory New or empty directory
+         * @param options Run count and whether to copy inputs
+         * @param error Receives a description of the problem on failure
+         * @return True if every run succeeded and the bundle was written
+         */
+        [[nodiscard]] static bool Record(Nodes::NodeEditor &editor,
+            const std::filesystem::path &bundleDirectory,
+            const RecordOptions &options,
+            std::string &error);
+
+        /**
+         * @brief Loads a bundle, runs it and compares against the recorded baseline.
+         * @param editor Editor to run in (execution settings are kept, its graph is replaced)
+         * @param bundleDirectory Directory written by Record()
+         * @param options Run count and regression limits
+         * @param error Receives a description of the problem on failure
+         * @return Comparison, or std::nullopt if the bundle is unusable, an input changed or a run failed
+         */
+        [[nodiscard]] static std::optional<ReplayReport> Replay(Nodes::NodeEditor &editor,
+            const std::filesystem::path &bundleDirectory,
+            const ReplayOptions &options,
+            std::string &error);
+
+        /**
+         * @brief Hashes a file's contents the way bundles identify inputs.
+         * @param path File to read
+         * @return Hash, or std::nullopt if the file cannot be read
+         */
+        [[nodiscard]] static std::optional<uint64_t> HashFile(const std::filesystem::path &path);
+    };
+
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,533 @@
+#include "Vision/IO/SharedFrameRing.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <ctime>
+#endif
+#endif
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        constexpr uint32_t kMagic = 0x56435246; // "VCRF"
+        constexpr uint32_t kVersion = 1;
+        constexpr size_t kAlignment = 64; // Cache line: slot states never share one with pixels
+
+        // Slot states; each side waits on the state word of its next slot
+        constexpr uint32_t kFree = 0;
+        constexpr uint32_t kWritten = 1;
+        constexpr uint32_t kReading = 2;
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free, "slot states must work across processes");
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futexes wait on the state word itself");
+
+        constexpr size_t AlignUp(size_t value)
+        {
+            return (value + kAlignment - 1) / kAlignment * kAlignment;
+        }
+
+        bool IsValidName(const std::string &name)
+        {
+            return !name.empty() && std::ranges::all_of(name, [](char c) {
+                return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '-' || c == '.';
+            });
+        }
+
+        // Sleeps until the word changes from expected, is woken, or timeout passes (may wake spuriously)
+        void WaitOnWord(std::atomic<uint32_t> &word, uint32_t expected, std::chrono::microseconds timeout)
+        {
+#if defined(__linux__)
+            // Not FUTEX_PRIVATE_FLAG: the word lives in a mapping shared with another process
+            timespec relative{};
+            relative.tv_sec = static_cast<time_t>(timeout.count() / 1'000'000);
+            relative.tv_nsec = static_cast<long>(timeout.count() % 1'000'000 * 1'000);
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, &relative, nullptr, 0);
+#else
+            (void)word;
+            (void)expected;
+            std::this_thread::sleep_for(
+                std::min(timeout, std::chrono::microseconds(Constants::SharedMemory::kPollMicroseconds)));
+#endif
+        }
+
+        void WakeWord(std::atomic<uint32_t> &word)
+        {
+#if defined(__linux__)
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#else
+            (void)word;
+#endif
+        }
+
+        // Held in UMatData::userdata of read frames, so the mapping outlives every frame handed out
+        struct SlotLease
+        {
+            std::shared_ptr<const SharedFrameRing> ring;
+            size_t slot;
+        };
+    } // namespace
+
+    struct SharedFrameRing::RingHeader
+    {
+        std::atomic<uint32_t> magic;  ///< kMagic once the creator initialised the segment
+        uint32_t version;             ///< Layout version
+        uint64_t slotCount;           ///< Frames the ring holds
+        uint64_t slotBytes;           ///< Pixel capacity of a slot
+        uint64_t slotStride;          ///< Bytes from one slot header to the next
+        std::atomic<uint32_t> closed; ///< Writer ended the stream
+    };
+
+    struct SharedFrameRing::SlotHeader
+    {
+        std::atomic<uint32_t> state; ///< kFree, kWritten or kReading
+        int32_t rows;                ///< Image height
+        int32_t cols;                ///< Image width
+        int32_t type;                ///< OpenCV image type
+        int64_t frameIndex;          ///< Index the writer published the frame with
+        uint64_t sequence;           ///< Frames published before this one
+    };
+
+    std::shared_ptr<SharedFrameRing> SharedFrameRing::Create(const std::string &name,
+        size_t slotCount,
+        size_t slotBytes)
+    {
+        if (!IsValidName(name) || slotCount < 2 || slotBytes == 0)
+        {
+            LOG_ERROR("SharedFrameRing: invalid ring '{}' ({} slots of {} bytes)", name, slotCount, slotBytes);
+            return nullptr;
+        }
+
+        const size_t stride = AlignUp(sizeof(SlotHeader)) + AlignUp(slotBytes);
+        std::shared_ptr<SharedFrameRing> ring(new SharedFrameRing(name, true));
+        if (!ring->Map(AlignUp(sizeof(RingHeader)) + slotCount * stride))
+        {
+            return nullptr;
+        }
+
+        // The segment starts zeroed, so every slot is free; magic goes last so readers never see a partial header
+        ring->header->version = kVersion;
+        ring->header->slotCount = slotCount;
+        ring->header->slotBytes = slotBytes;
+        ring->header->slotStride = stride;
+        ring->header->magic.store(kMagic, std::memory_order_release);
+
+        LOG_INFO("SharedFrameRing: created '{}' ({} slots of {} bytes)", name, slotCount, slotBytes);
+        return ring;
+    }
+
+    std::shared_ptr<SharedFrameRing> SharedFrameRing::Open(const std::string &name)
+    {
+        if (!IsValidName(name))
+        {
+            LOG_ERROR("SharedFrameRing: invalid ring name '{}'", name);
+            return nullptr;
+        }
+
+        std::shared_ptr<SharedFrameRing> ring(new SharedFrameRing(name, false));
+        if (!ring->Map(0))
+        {
+            return nullptr;
+        }
+
+        // A creator that has not finished initialising looks like no ring yet; callers retry
+        const auto *header = ring->header;
+        if (ring->mappedBytes < sizeof(RingHeader) || header->magic.load(std::memory_order_acquire) != kMagic
+            || header->version != kVersion || header->slotCount < 2
+            || ring->mappedBytes < AlignUp(sizeof(RingHeader)) + header->slotCount * header->slotStride)
+        {
+            return nullptr;
+        }
+        return ring;
+    }
+
+    SharedFrameRing::SharedFrameRing(std::string name, bool creator) : name(std::move(name)), creator(creator)
+    {
+    }
+
+    SharedFrameRing::~SharedFrameRing()
+    {
+        if (creator && header)
+        {
+            Close();
+#if !defined(_WIN32)
+            // Readers keep their mapping; the name is free for the next writer
+            shm_unlink(("/" + name).c_str());
+#endif
+        }
+
+        if (base)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(base);
+#else
+            munmap(base, mappedBytes);
+#endif
+        }
+#if defined(_WIN32)
+        if (mappingHandle)
+        {
+            CloseHandle(mappingHandle);
+        }
+#endif
+    }
+
+    bool SharedFrameRing::Map(size_t bytes)
+    {
+#if defined(_WIN32)
+        const std::string objectName = "Local\\VisionCraft." + name;
+        if (creator)
+        {
+            const auto size64 = static_cast<uint64_t>(bytes);
+            mappingHandle = CreateFileMappingA(INVALID_HANDLE_VALUE,
+                nullptr,
+                PAGE_READWRITE,
+                static_cast<DWORD>(size64 >> 32),
+                static_cast<DWORD>(size64 & 0xFFFFFFFFu),
+                objectName.c_str());
+            if (mappingHandle && GetLastError() == ERROR_ALREADY_EXISTS)
+            {
+                LOG_ERROR("SharedFrameRing: ring '{}' is still open in another process", name);
+                return false;
+            }
+        }
+        else
+        {
+            mappingHandle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, objectName.c_str());
+        }
+        void *view = mappingHandle ? MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, 0) : nullptr;
+        if (!view)
+        {
+            if (creator)
+            {
+                LOG_ERROR("SharedFrameRing: failed to create ring '{}'", name);
+            }
+            return false;
+        }
+
+        MEMORY_BASIC_INFORMATION region{};
+        VirtualQuery(view, &region, sizeof(region));
+        mappedBytes = creator ? bytes : region.RegionSize;
+#else
+        const std::string objectName = "/" + name;
+        int segment = -1;
+        if (creator)
+        {
+            // A writer that crashed leaves its segment behind; its readers keep their own mapping
+            shm_unlink(objectName.c_str());
+            segment = shm_open(objectName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+            if (segment >= 0 && ftruncate(segment, static_cast<off_t>(bytes)) != 0)
+            {
+                ::close(segment);
+                shm_unlink(objectName.c_str());
+                segment = -1;
+            }
+            if (segment < 0)
+            {
+                LOG_ERROR("SharedFrameRing: failed to create ring '{}'", name);
+                return false;
+            }
+        }
+        else
+        {
+            segment = shm_open(objectName.c_str(), O_RDWR, 0);
+            struct stat status{};
+            if (segment >= 0 && fstat(segment, &status) == 0)
+            {
+                bytes = static_cast<size_t>(status.st_size);
+            }
+            if (segment < 0 || bytes == 0)
+            {
+                if (segment >= 0)
+                {
+                    ::close(segment);
+                }
+                return false;
+            }
+        }
+
+        // The mapping keeps its own reference to the segment, so the descriptor can be closed right away
+        void *view = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, segment, 0);
+        ::close(segment);
+        if (view == MAP_FAILED)
+        {
+            LOG_ERROR("SharedFrameRing: failed to map ring '{}'", name);
+            if (creator)
+            {
+                shm_unlink(objectName.c_str());
+            }
+            return false;
+        }
+        mappedBytes = bytes;
+#endif
+
+        base = static_cast<std::byte *>(view);
+        header = reinterpret_cast<RingHeader *>(base);
+        return true;
+    }
+
+    size_t SharedFrameRing::GetSlotCount() const
+    {
+        return static_cast<size_t>(header->slotCount);
+    }
+
+    size_t SharedFrameRing::GetSlotBytes() const
+    {
+        return static_cast<size_t>(header->slotBytes);
+    }
+
+    cv::Mat SharedFrameRing::AcquireWrite(int rows, int cols, int type, std::chrono::milliseconds timeout)
+    {
+        if (rows <= 0 || cols <= 0
+            || static_cast<size_t>(rows) * static_cast<size_t>(cols) * CV_ELEM_SIZE(type) > GetSlotBytes())
+        {
+            return {};
+        }
+
+        // A slot acquired but never published is simply filled again
+        const size_t slot = acquired.value_or(writeSequence % GetSlotCount());
+        if (!acquired && !WaitForState(slot, kFree, timeout))
+        {
+            return {};
+        }
+        if (header->closed.load(std::memory_order_acquire))
+        {
+            return {};
+        }
+
+        auto &slotHeader = GetSlot(slot);
+        slotHeader.rows = rows;
+        slotHeader.cols = cols;
+        slotHeader.type = type;
+        acquired = slot;
+        return cv::Mat(rows, cols, type, GetSlotData(slot));
+    }
+
+    void SharedFrameRing::Publish(int64_t frameIndex)
+    {
+        if (!acquired)
+        {
+            return;
+        }
+
+        auto &slotHeader = GetSlot(*acquired);
+        slotHeader.frameIndex = frameIndex;
+        slotHeader.sequence = writeSequence;
+        SetState(*acquired, kWritten);
+        ++writeSequence;
+        acquired.reset();
+    }
+
+    bool SharedFrameRing::Write(const cv::Mat &image, int64_t frameIndex, std::chrono::milliseconds timeout)
+    {
+        if (image.empty() || image.dims != 2)
+        {
+            return false;
+        }
+
+        cv::Mat slot = AcquireWrite(image.rows, image.cols, image.type(), timeout);
+        if (slot.empty())
+        {
+            return false;
+        }
+
+        // The only copy on the way to the reader; copyTo writes into the slot as sizes and types match
+        image.copyTo(slot);
+        Publish(frameIndex);
+        return true;
+    }
+
+    void SharedFrameRing::Close()
+    {
+        header->closed.store(1, std::memory_order_release);
+        for (size_t slot = 0; slot < GetSlotCount(); ++slot)
+        {
+            WakeWord(GetSlot(slot).state);
+        }
+    }
+
+    std::optional<SharedFrame> SharedFrameRing::Read(std::chrono::milliseconds timeout)
+    {
+        const size_t slot = readSequence % GetSlotCount();
+        if (!WaitForState(slot, kWritten, timeout))
+        {
+            return std::nullopt;
+        }
+
+        auto &slotHeader = GetSlot(slot);
+        slotHeader.state.store(kReading, std::memory_order_relaxed);
+        ++readSequence;
+
+        // Fields come from another process: a frame that does not fit its slot is dropped, not mapped
+        const int rows = slotHeader.rows;
+        const int cols = slotHeader.cols;
+        const int type = slotHeader.type;
+        if (rows <= 0 || cols <= 0 || CV_MAT_DEPTH(type) > CV_16F
+            || static_cast<size_t>(rows) * static_cast<size_t>(cols) * CV_ELEM_SIZE(type) > GetSlotBytes())
+        {
+            LOG_ERROR("SharedFrameRing: dropped malformed frame {} from '{}'", slotHeader.sequence, name);
+            SetState(slot, kFree);
+            return std::nullopt;
+        }
+
+        SharedFrame frame;
+        frame.frameIndex = slotHeader.frameIndex;
+        frame.sequence = slotHeader.sequence;
+
+        // create() asks this allocator for the buffer, which wraps the slot instead of allocating
+        handingOut = slot;
+        frame.image.allocator = this;
+        frame.image.create(rows, cols, type);
+        handingOut.reset();
+        return frame;
+    }
+
+    bool SharedFrameRing::HasEnded() const
+    {
+        return header->closed.load(std::memory_order_acquire)
+               && GetSlot(readSequence % GetSlotCount()).state.load(std::memory_order_acquire) != kWritten;
+    }
+
+    // Same layout as OpenCV's default allocator, with the buffer being the slot Read() is handing out
+    cv::UMatData *SharedFrameRing::allocate(int dims,
+        const int *sizes,
+        int type,
+        void *data,
+        size_t *step,
+        [[maybe_unused]] cv::AccessFlag flags,
+        [[maybe_unused]] cv::UMatUsageFlags usageFlags) const
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; --i)
+        {
+            if (step)
+            {
+                if (data && step[i] != CV_AUTOSTEP)
+                {
+                    total = step[i];
+                }
+                else
+                {
+                    step[i] = total;
+                }
+            }
+            total *= static_cast<size_t>(sizes[i]);
+        }
+
+        auto *u = new cv::UMatData(this);
+        u->size = total;
+        if (handingOut && !data)
+        {
+            u->data = u->origdata = GetSlotData(*handingOut);
+            u->userdata = new SlotLease{ shared_from_this(), *handingOut };
+        }
+        else
+        {
+            // A read frame recreated with another size by its holder gets ordinary memory
+            u->data = u->origdata = static_cast<uchar *>(data ? data : cv::fastMalloc(total));
+            if (data)
+            {
+                u->flags |= cv::UMatData::USER_ALLOCATED;
+            }
+        }
+        return u;
+    }
+
+    bool SharedFrameRing::allocate(cv::UMatData *data,
+        [[maybe_unused]] cv::AccessFlag accessFlags,
+        [[maybe_unused]] cv::UMatUsageFlags usageFlags) const
+    {
+        return data != nullptr;
+    }
+
+    void SharedFrameRing::deallocate(cv::UMatData *u) const
+    {
+        if (!u)
+        {
+            return;
+        }
+
+        // Released last: dropping it may unmap the segment
+        std::unique_ptr<SlotLease> lease(static_cast<SlotLease *>(u->userdata));
+        if (lease)
+        {
+            SetState(lease->slot, kFree);
+        }
+        else if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+        {
+            cv::fastFree(u->origdata);
+        }
+        u->origdata = nullptr;
+        delete u;
+    }
+
+    SharedFrameRing::SlotHeader &SharedFrameRing::GetSlot(size_t slot) const
+    {
+        return *reinterpret_cast<SlotHeader *>(base + AlignUp(sizeof(RingHeader)) + slot * header->slotStride);
+    }
+
+    uchar *SharedFrameRing::GetSlotData(size_t slot) const
+    {
+        return reinterpret_cast<uchar *>(&GetSlot(slot)) + AlignUp(sizeof(SlotHeader));
+    }
+
+    bool SharedFrameRing::WaitForState(size_t slot, uint32_t wanted, std::chrono::milliseconds timeout) const
+    {
+        auto &state = GetSlot(slot).state;
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (true)
+        {
+            const uint32_t current = state.load(std::memory_order_acquire);
+            if (current == wanted)
+            {
+                return true;
+            }
+            if (header->closed.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            const auto remaining =
+                std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+            if (remaining <= remaining.zero())
+            {
+                return false;
+            }
+
+            // Bounded, so a close that lands between the checks above and the wait is still noticed
+            WaitOnWord(state,
+                current,
+                std::min<std::chrono::microseconds>(
+                    remaining, std::chrono::milliseconds(Constants::SharedMemory::kWaitSliceMilliseconds)));
+        }
+    }
+
+    void SharedFrameRing::SetState(size_t slot, uint32_t state) const
+    {
+        auto &word = GetSlot(slot).state;
+        word.store(state, std::memory_order_release);
+        WakeWord(word);
+    }
+
+} // namespace VisionCraft::Vision::IO
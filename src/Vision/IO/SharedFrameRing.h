@@ -0,0 +1,204 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Frame taken from a SharedFrameRing.
+     */
+    struct SharedFrame
+    {
+        cv::Mat image;           ///< Pixels in the shared segment; the slot is freed when the last copy is released
+        int64_t frameIndex = 0;  ///< Index the writer published the frame with
+        uint64_t sequence = 0;   ///< Frames published before this one
+    };
+
+    /**
+     * @brief Ring of image slots in a named shared-memory segment, for moving frames between processes.
+     *
+     * One process creates the ring (Create()) and writes frames; one process opens it by name (Open()) and
+     * reads them. Frames never pass through a file or an encoder: the writer fills a slot in place through
+     * the cv::Mat header AcquireWrite() returns, and Read() returns a cv::Mat header over the same slot.
+     * The ring is its own cv::MatAllocator, so a read slot is handed back to the writer when the last
+     * cv::Mat sharing it is released, whichever thread or node holds it last. Read frames are read-only.
+     *
+     * Every slot has a state word (free, written, being read) in the segment. Each side waits on the word
+     * of its next slot: with a futex on Linux, which wakes across processes, and by polling every
+     * Constants::SharedMemory::kPollMicroseconds elsewhere. Slots are reused in order, so a reader that
+     * keeps frames holds the writer back once every slot is taken.
+     *
+     * Images are stored contiguously; a slot holds up to GetSlotBytes() bytes of pixels. The ring object
+     * may be released while frames read from it are alive: every frame keeps the mapping alive. The
+     * creator's destructor closes the ring and removes its name; readers see HasEnded() after taking the
+     * frames still queued. Methods of one side are meant to be called from one thread at a time.
+     */
+    class SharedFrameRing : public cv::MatAllocator, public std::enable_shared_from_this<SharedFrameRing>
+    {
+    public:
+        /**
+         * @brief Creates a ring, replacing a segment of the same name left behind by a previous writer.
+         * @param name Segment name (letters, digits, '_', '-' and '.')
+         * @param slotCount Frames the ring holds (at least 2)
+         * @param slotBytes Largest frame in bytes
+         * @return Ring for writing, or nullptr if the segment cannot be created
+         */
+        [[nodiscard]] static std::shared_ptr<SharedFrameRing> Create(const std::string &name,
+            size_t slotCount,
+            size_t slotBytes);
+
+        /**
+         * @brief Opens a ring another process created.
+         * @param name Segment name passed to Create()
+         * @return Ring for reading, or nullptr if no initialised ring of that name exists
+         */
+        [[nodiscard]] static std::shared_ptr<SharedFrameRing> Open(const std::string &name);
+
+        /**
+         * @brief Unmaps the segment; a creator also closes the ring and removes its name.
+         */
+        ~SharedFrameRing() override;
+
+        SharedFrameRing(const SharedFrameRing &) = delete;
+        SharedFrameRing &operator=(const SharedFrameRing &) = delete;
+
+        /**
+         * @brief Returns the segment name.
+         * @return Name passed to Create() or Open()
+         */
+        [[nodiscard]] const std::string &GetName() const
+        {
+            return name;
+        }
+
+        /**
+         * @brief Returns the number of slots.
+         * @return Frames the ring holds
+         */
+        [[nodiscard]] size_t GetSlotCount() const;
+
+        /**
+         * @brief Returns the capacity of a slot.
+         * @return Largest frame in bytes
+         */
+        [[nodiscard]] size_t GetSlotBytes() const;
+
+        /**
+         * @brief Waits for the next slot to be free and returns it for filling in place.
+         * @param rows Image height
+         * @param cols Image width
+         * @param type OpenCV image type
+         * @param timeout Longest wait for the reader to free the slot (zero = do not wait)
+         * @return Header over the slot, or an empty cv::Mat on timeout, if the image does not fit, or if closed
+         * @note Publish() makes the frame visible; the header must not be used afterwards.
+         */
+        [[nodiscard]] cv::Mat AcquireWrite(int rows, int cols, int type, std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Hands the slot filled since AcquireWrite() to the reader.
+         * @param frameIndex Index stored with the frame
+         */
+        void Publish(int64_t frameIndex);
+
+        /**
+         * @brief Copies an image into the next slot and publishes it.
+         * @param image Image to send
+         * @param frameIndex Index stored with the frame
+         * @param timeout Longest wait for a free slot (zero = do not wait)
+         * @return True if published; false on timeout, if the image does not fit, or if closed
+         */
+        bool Write(const cv::Mat &image, int64_t frameIndex, std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Marks the end of the stream and wakes the reader.
+         */
+        void Close();
+
+        /**
+         * @brief Waits for the next frame.
+         * @param timeout Longest wait (zero = do not wait)
+         * @return Frame, or std::nullopt on timeout or once HasEnded()
+         */
+        [[nodiscard]] std::optional<SharedFrame> Read(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Checks whether the writer closed the ring and every frame was read.
+         * @return True once no more frames will arrive
+         */
+        [[nodiscard]] bool HasEnded() const;
+
+        // cv::MatAllocator interface
+        cv::UMatData *allocate(int dims,
+            const int *sizes,
+            int type,
+            void *data,
+            size_t *step,
+            cv::AccessFlag flags,
+            cv::UMatUsageFlags usageFlags) const override;
+        bool allocate(cv::UMatData *data, cv::AccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const override;
+        void deallocate(cv::UMatData *data) const override;
+
+    private:
+        struct RingHeader;
+        struct SlotHeader;
+
+        SharedFrameRing(std::string name, bool creator);
+
+        /**
+         * @brief Maps the segment, creating or opening it.
+         * @param bytes Segment size when creating (ignored when opening)
+         * @return True if mapped
+         */
+        bool Map(size_t bytes);
+
+        /**
+         * @brief Returns the header of a slot.
+         * @param slot Slot index
+         * @return Header in the segment
+         */
+        [[nodiscard]] SlotHeader &GetSlot(size_t slot) const;
+
+        /**
+         * @brief Returns the pixels of a slot.
+         * @param slot Slot index
+         * @return First byte of the slot's pixels
+         */
+        [[nodiscard]] uchar *GetSlotData(size_t slot) const;
+
+        /**
+         * @brief Waits until a slot's state becomes the wanted one or the ring is closed.
+         * @param slot Slot index
+         * @param wanted State to wait for
+         * @param timeout Longest wait
+         * @return True if the slot is in the wanted state
+         */
+        bool WaitForState(size_t slot, uint32_t wanted, std::chrono::milliseconds timeout) const;
+
+        /**
+         * @brief Stores a slot's state and wakes a waiter in any process.
+         * @param slot Slot index
+         * @param state New state
+         */
+        void SetState(size_t slot, uint32_t state) const;
+
+        std::string name;               ///< Segment name
+        bool creator;                   ///< Created the segment (writes, closes and removes it)
+        std::byte *base = nullptr;      ///< Start of the mapping
+        size_t mappedBytes = 0;         ///< Size of the mapping
+        void *mappingHandle = nullptr;  ///< Section handle keeping the name alive (Windows only)
+        RingHeader *header = nullptr;   ///< Ring header at the start of the mapping
+        uint64_t writeSequence = 0;     ///< Frames this writer published
+        uint64_t readSequence = 0;      ///< Frames this reader took
+        std::optional<size_t> acquired; ///< Slot between AcquireWrite() and Publish()
+
+        mutable std::optional<size_t> handingOut; ///< Slot Read() is wrapping in a cv::Mat (read by allocate())
+    };
+
+} // namespace VisionCraft::Vision::IO
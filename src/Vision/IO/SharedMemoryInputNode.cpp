@@ -0,0 +1,89 @@
+#include "Vision/IO/SharedMemoryInputNode.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <chrono>
+#include <thread>
+
+namespace VisionCraft::Vision::IO
+{
+    SharedMemoryInputNode::SharedMemoryInputNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Name", std::string{});
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("FrameIndex").SetDataType(Nodes::SlotDataType::Int);
+    }
+
+    void SharedMemoryInputNode::Process()
+    {
+        const auto ringName = GetInputValue<std::string>("Name").value_or("");
+        if (!EnsureRingOpen(ringName))
+        {
+            streamEnded = true;
+            ClearOutputSlot("Output");
+            ClearOutputSlot("FrameIndex");
+            return;
+        }
+
+        // Waits in slices, so a cancelled or timed-out run does not hang on a stalled writer
+        const std::chrono::milliseconds slice(Constants::SharedMemory::kWaitSliceMilliseconds);
+        std::optional<SharedFrame> frame;
+        while (!(frame = ring->Read(slice)) && !ring->HasEnded())
+        {
+            ThrowIfStopRequested();
+        }
+
+        if (!frame)
+        {
+            LOG_INFO("SharedMemoryInputNode {}: Writer closed '{}'", GetName(), ringName);
+            ring.reset();
+            streamEnded = true;
+            ClearOutputSlot("Output");
+            ClearOutputSlot("FrameIndex");
+            return;
+        }
+
+        streamEnded = false;
+        SetOutputSlotData("Output", std::move(frame->image));
+        SetOutputSlotData("FrameIndex", static_cast<int>(frame->frameIndex));
+    }
+
+    bool SharedMemoryInputNode::EnsureRingOpen(const std::string &ringName)
+    {
+        if (ring && ring->GetName() == ringName && !streamEnded)
+        {
+            return true;
+        }
+
+        ring.reset();
+        if (ringName.empty())
+        {
+            return false;
+        }
+
+        // The writer usually starts first; give it a moment when it does not
+        const auto giveUp = std::chrono::steady_clock::now()
+                            + std::chrono::milliseconds(Constants::SharedMemory::kAttachTimeoutMilliseconds);
+        while (!(ring = SharedFrameRing::Open(ringName)))
+        {
+            if (std::chrono::steady_clock::now() >= giveUp)
+            {
+                LOG_ERROR("SharedMemoryInputNode {}: No ring named '{}'", GetName(), ringName);
+                return false;
+            }
+            ThrowIfStopRequested();
+            std::this_thread::sleep_for(std::chrono::milliseconds(Constants::SharedMemory::kWaitSliceMilliseconds));
+        }
+
+        LOG_INFO("SharedMemoryInputNode {}: Opened '{}' ({} slots of {} bytes)",
+            GetName(),
+            ringName,
+            ring->GetSlotCount(),
+            ring->GetSlotBytes());
+        return true;
+    }
+} // namespace VisionCraft::Vision::IO
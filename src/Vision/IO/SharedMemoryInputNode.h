@@ -0,0 +1,82 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include "Vision/IO/SharedFrameRing.h"
+#include <memory>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Node producing frames another process writes into a SharedFrameRing.
+     *
+     * Each Process() call waits for the next frame of the ring named by the Name slot, so the node is meant
+     * to drive NodeEditor::ExecuteStream() while a capture process writes. Output is a cv::Mat over the
+     * frame's slot in shared memory: nothing is decoded or copied, and the slot goes back to the writer
+     * once no node holds the frame any more. The stream ends when the writer closes the ring, or when no
+     * ring appears within Constants::SharedMemory::kAttachTimeoutMilliseconds; processing again reattaches.
+     */
+    class SharedMemoryInputNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs shared-memory input node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        SharedMemoryInputNode(Nodes::NodeId id, const std::string &name = "Shared Memory Input");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "SharedMemoryInputNode";
+        }
+
+        /**
+         * @brief Excludes node from the output cache; every call yields a different frame.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Marks node as a stream source.
+         * @return Always true
+         */
+        [[nodiscard]] bool IsStreamSource() const override
+        {
+            return true;
+        }
+
+        /**
+         * @brief Checks if the last Process() call found no more frames.
+         * @return True once the writer closed the ring, or when no ring could be opened
+         */
+        [[nodiscard]] bool HasStreamEnded() const override
+        {
+            return streamEnded;
+        }
+
+        /**
+         * @brief Waits for the next frame and puts it in the Output slot.
+         * @throws Nodes::ExecutionStopped if the run stops while waiting
+         */
+        void Process() override;
+
+    private:
+        /**
+         * @brief Opens the ring if the name changed, none is open, or the stream ended.
+         * @param ringName Name slot value
+         * @return True if a ring is open
+         */
+        bool EnsureRingOpen(const std::string &ringName);
+
+        std::shared_ptr<SharedFrameRing> ring; ///< Ring being read
+        bool streamEnded = false;              ///< Last Process() produced no frame
+    };
+} // namespace VisionCraft::Vision::IO
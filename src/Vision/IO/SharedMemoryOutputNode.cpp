@@ -0,0 +1,80 @@
+#include "Vision/IO/SharedMemoryOutputNode.h"
+#include "Logger.h"
+#include "Nodes/Core/AsyncLogger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace VisionCraft::Vision::IO
+{
+    SharedMemoryOutputNode::SharedMemoryOutputNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionInputPin("Execute");
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+        CreateInputSlot("Name", std::string{});
+        CreateInputSlot("Slots", static_cast<int>(Constants::SharedMemory::kDefaultSlots));
+        CreateInputSlot("Wait", true);
+    }
+
+    void SharedMemoryOutputNode::Process()
+    {
+        const auto image = GetInputValueIf<cv::Mat>("Input");
+        if (!image || image->empty())
+        {
+            LOG_HOT_WARN("SharedMemoryOutputNode {}: No input image provided", GetName());
+            return;
+        }
+        if (GetProxyScale() < 1.0)
+        {
+            // A proxy image is a preview; the reader expects full-resolution frames
+            return;
+        }
+
+        const auto ringName = GetInputValue<std::string>("Name").value_or("");
+        const auto slotCount = static_cast<size_t>(std::max(2, GetInputValue<int>("Slots").value_or(2)));
+        if (!EnsureRingCreated(ringName, slotCount, image->total() * image->elemSize()))
+        {
+            return;
+        }
+
+        // Waits in slices, so a cancelled or timed-out run does not hang on a stalled reader
+        const bool wait = GetInputValue<bool>("Wait").value_or(true);
+        const std::chrono::milliseconds slice(wait ? Constants::SharedMemory::kWaitSliceMilliseconds : 0);
+        while (!ring->Write(*image, sentFrames, slice))
+        {
+            if (!wait)
+            {
+                ++droppedFrames;
+                LOG_HOT_WARN("SharedMemoryOutputNode {}: Reader holds every slot, dropped frame", GetName());
+                return;
+            }
+            ThrowIfStopRequested();
+        }
+        ++sentFrames;
+    }
+
+    bool SharedMemoryOutputNode::EnsureRingCreated(const std::string &ringName, size_t slotCount, size_t imageBytes)
+    {
+        if (ring && ring->GetName() == ringName && ring->GetSlotCount() == slotCount
+            && ring->GetSlotBytes() >= imageBytes)
+        {
+            return true;
+        }
+
+        ring.reset();
+        sentFrames = 0;
+        if (ringName.empty())
+        {
+            LOG_HOT_WARN("SharedMemoryOutputNode {}: No ring name set", GetName());
+            return false;
+        }
+
+        ring = SharedFrameRing::Create(ringName, slotCount, imageBytes);
+        return ring != nullptr;
+    }
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include "Vision/IO/SharedFrameRing.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Node sending its input image to another process through a SharedFrameRing.
+     *
+     * The first image creates the ring named by the Name slot, with Slots slots sized to that image; a
+     * larger image, or a new Name or Slots value, replaces the ring (its reader sees the old one end and
+     * reopens). Each image is copied once, straight into a slot; nothing is encoded or written to disk.
+     * When every slot is still held by the reader, Wait set waits for one to free (the run's stop request
+     * and timeout still apply), and Wait unset drops the image. Proxy runs never send.
+     */
+    class SharedMemoryOutputNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs shared-memory output node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        SharedMemoryOutputNode(Nodes::NodeId id, const std::string &name = "Shared Memory Output");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "SharedMemoryOutputNode";
+        }
+
+        /**
+         * @brief Excludes node from the output cache; it sends frames as a side effect.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Marks node as a graph result; it hands frames to another process.
+         * @return Always true
+         */
+        [[nodiscard]] bool IsSink() const override
+        {
+            return true;
+        }
+
+        /**
+         * @brief Sends the input image as the next frame.
+         * @throws Nodes::ExecutionStopped if the run stops while waiting for a free slot
+         */
+        void Process() override;
+
+        /**
+         * @brief Returns frames sent since the ring was created.
+         * @return Published frame count
+         */
+        [[nodiscard]] int64_t GetSentFrames() const
+        {
+            return sentFrames;
+        }
+
+        /**
+         * @brief Returns frames dropped because the reader held every slot.
+         * @return Dropped frame count (only grows with Wait unset)
+         */
+        [[nodiscard]] int64_t GetDroppedFrames() const
+        {
+            return droppedFrames;
+        }
+
+    private:
+        /**
+         * @brief Creates the ring if none fits the slots and the image.
+         * @param ringName Name slot value
+         * @param slotCount Slots slot value
+         * @param imageBytes Size of the image to send
+         * @return True if a ring is open
+         */
+        bool EnsureRingCreated(const std::string &ringName, size_t slotCount, size_t imageBytes);
+
+        std::shared_ptr<SharedFrameRing> ring; ///< Ring being written
+        int64_t sentFrames = 0;                ///< Frames published to ring, also the next frame index
+        int64_t droppedFrames = 0;             ///< Frames not sent for lack of a free slot
+    };
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,251 @@
+#include "Vision/IO/StreamingTexture.h"
+#include "Logger.h"
+
+#include <cstring>
+
+namespace VisionCraft::Vision::IO
+{
+    std::optional<StreamingTexture::UploadLayout> StreamingTexture::LayoutFor(const cv::Mat &image)
+    {
+        if (image.empty() || image.depth() != CV_8U)
+        {
+            return std::nullopt;
+        }
+
+        UploadLayout layout;
+        layout.rowBytes = static_cast<size_t>(image.cols) * image.elemSize();
+        switch (image.channels())
+        {
+        case 1:
+            layout.format = GL_RED;
+            layout.swizzle = { GL_RED, GL_RED, GL_RED, GL_ONE };
+            return layout;
+        case 3:
+            layout.format = GL_BGR;
+            return layout;
+        case 4:
+            layout.format = GL_BGRA;
+            return layout;
+        default:
+            return std::nullopt;
+        }
+    }
+
+    StreamingTexture::~StreamingTexture()
+    {
+        Reset();
+    }
+
+    bool StreamingTexture::Upload(const cv::Mat &image)
+    {
+        // Memory-mapped files and float results keep their depth; the texture is always 8-bit
+        cv::Mat pixels = image;
+        if (pixels.depth() == CV_16U)
+        {
+            pixels.convertTo(pixels, CV_8U, 1.0 / 256.0);
+        }
+        else if (pixels.depth() == CV_32F || pixels.depth() == CV_16F)
+        {
+            pixels.convertTo(pixels, CV_8U, 255.0);
+        }
+
+        const auto layout = LayoutFor(pixels);
+        if (!layout)
+        {
+            LOG_ERROR("StreamingTexture: Cannot display image of type {}", cv::typeToString(image.type()));
+            Reset();
+            return false;
+        }
+        if (!EnsureStorage(pixels.cols, pixels.rows))
+        {
+            return false;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, textureId);
+        glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, layout->swizzle.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        const size_t bytes = layout->rowBytes * static_cast<size_t>(pixels.rows);
+        if (auto *staging = static_cast<uchar *>(MapNextBuffer(bytes)))
+        {
+            if (pixels.isContinuous())
+            {
+                std::memcpy(staging, pixels.data, bytes);
+            }
+            else
+            {
+                for (int row = 0; row < pixels.rows; ++row)
+                {
+                    std::memcpy(staging + row * layout->rowBytes, pixels.ptr(row), layout->rowBytes);
+                }
+            }
+
+            auto &buffer = buffers[nextBuffer];
+            if (!buffer.mapped)
+            {
+                glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            }
+            glTexSubImage2D(
+                GL_TEXTURE_2D, 0, 0, 0, pixels.cols, pixels.rows, layout->format, GL_UNSIGNED_BYTE, nullptr);
+            if (buffer.mapped)
+            {
+                buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            nextBuffer = (nextBuffer + 1) % buffers.size();
+        }
+        else
+        {
+            // No pixel buffer: a synchronous upload straight from the image rows
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(pixels.step[0] / pixels.elemSize()));
+            glTexSubImage2D(
+                GL_TEXTURE_2D, 0, 0, 0, pixels.cols, pixels.rows, layout->format, GL_UNSIGNED_BYTE, pixels.data);
+            glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        }
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        const GLenum error = glGetError();
+        if (error != GL_NO_ERROR)
+        {
+            LOG_ERROR("StreamingTexture: OpenGL error after texture upload: 0x{:x}", error);
+            Reset();
+            return false;
+        }
+        return true;
+    }
+
+    void StreamingTexture::Reset()
+    {
+        ReleaseBuffers();
+        if (textureId != 0)
+        {
+            glDeleteTextures(1, &textureId);
+            textureId = 0;
+        }
+        textureWidth = 0;
+        textureHeight = 0;
+    }
+
+    bool StreamingTexture::EnsureStorage(int width, int height)
+    {
+        if (textureId != 0 && width == textureWidth && height == textureHeight)
+        {
+            return true;
+        }
+
+        // Immutable storage cannot be resized, so a new size gets a new texture
+        if (textureId != 0)
+        {
+            glDeleteTextures(1, &textureId);
+            textureId = 0;
+        }
+        glGenTextures(1, &textureId);
+        if (textureId == 0)
+        {
+            LOG_ERROR("StreamingTexture: Failed to create OpenGL texture");
+            return false;
+        }
+
+        glBindTexture(GL_TEXTURE_2D, textureId);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        if (GLAD_GL_VERSION_4_2)
+        {
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+        }
+        else
+        {
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        textureWidth = width;
+        textureHeight = height;
+        return true;
+    }
+
+    void *StreamingTexture::MapNextBuffer(size_t bytes)
+    {
+        auto &buffer = buffers[nextBuffer];
+        const bool persistent = GLAD_GL_VERSION_4_4;
+
+        // Wait until the driver finished reading this buffer's previous upload
+        if (buffer.fence)
+        {
+            glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, Constants::PreviewTexture::kFenceTimeoutNs);
+            glDeleteSync(buffer.fence);
+            buffer.fence = nullptr;
+        }
+
+        // Persistent storage is immutable, so a larger image needs a new buffer
+        if (buffer.id != 0 && persistent && buffer.capacity < bytes)
+        {
+            glDeleteBuffers(1, &buffer.id);
+            buffer = UploadBuffer{};
+        }
+        if (buffer.id == 0)
+        {
+            glGenBuffers(1, &buffer.id);
+            if (buffer.id == 0)
+            {
+                return nullptr;
+            }
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+        if (persistent)
+        {
+            if (!buffer.mapped)
+            {
+                constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, flags);
+                buffer.mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes), flags);
+                buffer.capacity = buffer.mapped ? bytes : 0;
+            }
+            if (buffer.mapped)
+            {
+                return buffer.mapped;
+            }
+        }
+        else
+        {
+            // Orphaning gives the buffer fresh storage while the driver may still read the old one
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(bytes), nullptr, GL_STREAM_DRAW);
+            buffer.capacity = bytes;
+            void *mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER,
+                0,
+                static_cast<GLsizeiptr>(bytes),
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+            if (mapped)
+            {
+                return mapped;
+            }
+        }
+
+        LOG_WARN("StreamingTexture: Failed to map pixel buffer, uploading synchronously");
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return nullptr;
+    }
+
+    void StreamingTexture::ReleaseBuffers()
+    {
+        for (auto &buffer : buffers)
+        {
+            if (buffer.fence)
+            {
+                glDeleteSync(buffer.fence);
+            }
+            if (buffer.id != 0)
+            {
+                // Deleting a buffer also unmaps it
+                glDeleteBuffers(1, &buffer.id);
+            }
+            buffer = UploadBuffer{};
+        }
+        nextBuffer = 0;
+    }
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+
+#include <glad/glad.h>
+#include <opencv2/opencv.hpp>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief OpenGL texture that displays cv::Mat images, reusing its storage and streaming uploads.
+     *
+     * The texture keeps its storage while the image size stays the same (immutable glTexStorage2D storage
+     * on GL 4.2+) and only calls glTexSubImage2D afterwards. Pixels are uploaded in OpenCV's channel order
+     * (GL_BGR, GL_BGRA, or GL_RED swizzled to gray), so no color conversion runs on the render thread.
+     *
+     * Uploads go through a ring of Constants::PreviewTexture::kUploadBuffers pixel buffer objects: the
+     * render thread only copies rows into a buffer and the driver moves them to the texture asynchronously.
+     * On GL 4.4+ the buffers are persistently mapped and guarded by fences; otherwise each upload orphans
+     * and maps its buffer.
+     *
+     * Not thread-safe; every method must be called on the thread owning the OpenGL context.
+     */
+    class StreamingTexture
+    {
+    public:
+        /**
+         * @brief How an image is handed to glTexSubImage2D.
+         */
+        struct UploadLayout
+        {
+            GLenum format = GL_BGR;                                             ///< Pixel format of the rows
+            std::array<GLint, 4> swizzle{ GL_RED, GL_GREEN, GL_BLUE, GL_ONE }; ///< GL_TEXTURE_SWIZZLE_RGBA
+            size_t rowBytes = 0;                                                ///< Bytes of one packed row
+        };
+
+        /**
+         * @brief Returns the upload layout of an 8-bit image.
+         * @param image Image with 1, 3 (BGR) or 4 (BGRA) channels
+         * @return Layout; std::nullopt for other depths or channel counts
+         * @note Alpha is swizzled to one; previews show color only.
+         */
+        [[nodiscard]] static std::optional<UploadLayout> LayoutFor(const cv::Mat &image);
+
+        StreamingTexture() = default;
+
+        /**
+         * @brief Deletes the texture and upload buffers.
+         */
+        ~StreamingTexture();
+
+        StreamingTexture(const StreamingTexture &) = delete;
+        StreamingTexture &operator=(const StreamingTexture &) = delete;
+
+        /**
+         * @brief Uploads an image, keeping the texture storage if the size did not change.
+         * @param image Image to display; 16-bit and float images are converted to 8 bits first
+         * @return False if the image cannot be displayed or OpenGL reported an error (the texture is reset)
+         */
+        bool Upload(const cv::Mat &image);
+
+        /**
+         * @brief Deletes the texture and upload buffers.
+         */
+        void Reset();
+
+        /**
+         * @brief Returns OpenGL texture ID.
+         * @return Texture ID (0 if nothing is uploaded); changes when the image size changes
+         */
+        [[nodiscard]] GLuint Get() const
+        {
+            return textureId;
+        }
+
+        /**
+         * @brief Returns the video memory of the texture storage.
+         * @return Bytes of the RGBA8 storage (0 if nothing is uploaded); upload buffers are not counted
+         */
+        [[nodiscard]] size_t GetStorageBytes() const
+        {
+            return textureId == 0 ? 0 : static_cast<size_t>(textureWidth) * static_cast<size_t>(textureHeight) * 4;
+        }
+
+        /**
+         * @brief Checks if an image is uploaded.
+         * @return True if the texture exists
+         */
+        [[nodiscard]] bool IsValid() const
+        {
+            return textureId != 0;
+        }
+
+    private:
+        /**
+         * @brief Pixel buffer object of the upload ring.
+         */
+        struct UploadBuffer
+        {
+            GLuint id = 0;          ///< Buffer name
+            size_t capacity = 0;    ///< Bytes of storage
+            void *mapped = nullptr; ///< Persistent mapping (GL 4.4+ only)
+            GLsync fence = nullptr; ///< Signalled once the last upload from this buffer finished
+        };
+
+        /**
+         * @brief Creates texture storage for a size, or keeps it if the size is unchanged.
+         * @param width Image width
+         * @param height Image height
+         * @return False if the texture could not be created
+         */
+        bool EnsureStorage(int width, int height);
+
+        /**
+         * @brief Returns writable memory of the next upload buffer, bound to GL_PIXEL_UNPACK_BUFFER.
+         * @param bytes Bytes the upload needs
+         * @return Mapped memory; nullptr if no buffer could be mapped (nothing is bound then)
+         */
+        void *MapNextBuffer(size_t bytes);
+
+        /**
+         * @brief Deletes the upload buffers and their fences.
+         */
+        void ReleaseBuffers();
+
+        GLuint textureId = 0;                                                        ///< Texture name
+        int textureWidth = 0;                                                        ///< Width of the storage
+        int textureHeight = 0;                                                       ///< Height of the storage
+        std::array<UploadBuffer, Constants::PreviewTexture::kUploadBuffers> buffers; ///< Upload ring
+        size_t nextBuffer = 0;                                                       ///< Ring index of next upload
+    };
+} // namespace VisionCraft::Vision::IO
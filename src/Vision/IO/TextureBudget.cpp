@@ -0,0 +1,71 @@
+#include "Vision/IO/TextureBudget.h"
+
+#include <iterator>
+
+namespace VisionCraft::Vision::IO
+{
+    TextureBudget::TextureBudget(size_t capacityBytes) : capacity(capacityBytes)
+    {
+    }
+
+    void TextureBudget::Touch(void *owner, size_t bytes)
+    {
+        SetBytes(owner, bytes);
+        if (auto it = entries.find(owner); it != entries.end())
+        {
+            it->second.lastDrawnFrame = frame;
+            order.splice(order.begin(), order, it->second.lruPosition);
+        }
+    }
+
+    void TextureBudget::SetBytes(void *owner, size_t bytes)
+    {
+        if (bytes == 0)
+        {
+            Remove(owner);
+            return;
+        }
+
+        auto it = entries.find(owner);
+        if (it == entries.end())
+        {
+            order.push_back(owner);
+            it = entries.emplace(owner, Entry{ .lruPosition = std::prev(order.end()) }).first;
+        }
+        residentBytes = residentBytes - it->second.bytes + bytes;
+        it->second.bytes = bytes;
+    }
+
+    void TextureBudget::Remove(void *owner)
+    {
+        const auto it = entries.find(owner);
+        if (it == entries.end())
+        {
+            return;
+        }
+        residentBytes -= it->second.bytes;
+        order.erase(it->second.lruPosition);
+        entries.erase(it);
+    }
+
+    std::vector<void *> TextureBudget::EndFrame()
+    {
+        std::vector<void *> released;
+        while (residentBytes > capacity && !order.empty())
+        {
+            void *owner = order.back();
+            const auto it = entries.find(owner);
+            if (it->second.lastDrawnFrame == frame)
+            {
+                // Everything left was drawn this frame
+                break;
+            }
+            residentBytes -= it->second.bytes;
+            entries.erase(it);
+            order.pop_back();
+            released.push_back(owner);
+        }
+        ++frame;
+        return released;
+    }
+} // namespace VisionCraft::Vision::IO
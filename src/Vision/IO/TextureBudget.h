@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Video memory budget shared by preview textures, releasing the least recently drawn first.
+     *
+     * Each owner (a PreviewTexture) reports its resident bytes and is touched whenever it is drawn. At the
+     * end of a frame, EndFrame() hands back the least recently drawn owners until the resident total fits
+     * the capacity; the owners free their textures and upload them again once drawn. Owners drawn in the
+     * frame just ended are never released, so everything on screen stays resident even past the capacity.
+     *
+     * The budget only does the accounting and never touches OpenGL. Not thread-safe.
+     */
+    class TextureBudget
+    {
+    public:
+        /**
+         * @brief Constructs an empty budget.
+         * @param capacityBytes Resident bytes kept before off-screen owners are released
+         */
+        explicit TextureBudget(size_t capacityBytes);
+
+        /**
+         * @brief Records that an owner was drawn this frame.
+         * @param owner Texture owner
+         * @param bytes Video memory the owner holds now
+         */
+        void Touch(void *owner, size_t bytes);
+
+        /**
+         * @brief Updates the bytes an owner holds without marking it drawn.
+         * @param owner Texture owner; unknown owners are added as the least recently drawn
+         * @param bytes Video memory the owner holds now (0 removes it)
+         */
+        void SetBytes(void *owner, size_t bytes);
+
+        /**
+         * @brief Forgets an owner, e.g. when its textures are deleted.
+         * @param owner Texture owner
+         */
+        void Remove(void *owner);
+
+        /**
+         * @brief Ends the frame and picks the owners to release.
+         * @return Owners to release, least recently drawn first; they are removed from the budget
+         */
+        [[nodiscard]] std::vector<void *> EndFrame();
+
+        /**
+         * @brief Sets the capacity; owners over it are released at the next EndFrame().
+         * @param capacityBytes Resident bytes kept before off-screen owners are released
+         */
+        void SetCapacity(size_t capacityBytes)
+        {
+            capacity = capacityBytes;
+        }
+
+        /**
+         * @brief Returns the capacity.
+         * @return Resident bytes kept before off-screen owners are released
+         */
+        [[nodiscard]] size_t GetCapacity() const
+        {
+            return capacity;
+        }
+
+        /**
+         * @brief Returns the bytes all owners hold.
+         * @return Resident bytes
+         */
+        [[nodiscard]] size_t GetResidentBytes() const
+        {
+            return residentBytes;
+        }
+
+    private:
+        /**
+         * @brief Accounting of one owner.
+         */
+        struct Entry
+        {
+            size_t bytes = 0;                        ///< Video memory held
+            uint64_t lastDrawnFrame = 0;             ///< Frame of the last Touch()
+            std::list<void *>::iterator lruPosition; ///< Position in order
+        };
+
+        size_t capacity;                           ///< Resident bytes kept
+        size_t residentBytes = 0;                  ///< Sum of entry bytes
+        uint64_t frame = 1;                        ///< Current frame number
+        std::list<void *> order;                   ///< Owners, most recently drawn first
+        std::unordered_map<void *, Entry> entries; ///< Accounting by owner
+    };
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,121 @@
+#include "Vision/IO/ThumbnailLoader.h"
+#include "Logger.h"
+#include "Nodes/Core/Tracer.h"
+#include "Vision/IO/ImageCodec.h"
+#include "Vision/IO/PreviewTexture.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace VisionCraft::Vision::IO
+{
+    ThumbnailLoader::ThumbnailLoader(int maxEdge, size_t maxPending)
+        : maxEdge(maxEdge), maxPending(std::max<size_t>(1, maxPending))
+    {
+    }
+
+    ThumbnailLoader::~ThumbnailLoader()
+    {
+        if (worker.joinable())
+        {
+            worker.request_stop();
+            worker.join();
+        }
+    }
+
+    void ThumbnailLoader::Request(uint64_t key, const std::filesystem::path &path)
+    {
+        std::scoped_lock lock(mutex);
+        if (decoding == key || std::ranges::any_of(ready, [key](const auto &done) { return done.key == key; }))
+        {
+            return;
+        }
+
+        if (auto waiting = std::ranges::find(pending, key, &Pending::key); waiting != pending.end())
+        {
+            pending.erase(waiting);
+        }
+        pending.push_front({ key, path });
+        if (pending.size() > maxPending)
+        {
+            pending.pop_back();
+        }
+
+        if (!worker.joinable())
+        {
+            worker = std::jthread([this](std::stop_token stopToken) { Run(stopToken); });
+        }
+        wake.notify_one();
+    }
+
+    void ThumbnailLoader::Cancel()
+    {
+        std::scoped_lock lock(mutex);
+        pending.clear();
+        ready.clear();
+        ++generation;
+    }
+
+    std::vector<ThumbnailLoader::Thumbnail> ThumbnailLoader::TakeReady()
+    {
+        std::scoped_lock lock(mutex);
+        return std::exchange(ready, {});
+    }
+
+    size_t ThumbnailLoader::GetPendingCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return pending.size();
+    }
+
+    cv::Mat ThumbnailLoader::Decode(const std::filesystem::path &path, int maxEdge)
+    {
+        cv::Mat image;
+        try
+        {
+            // Reduced reads skip most of the IDCT work for JPEG; other codecs decode fully and downsample
+            image = ImageCodec::Read(path, 4);
+            if (!image.empty() && std::max(image.cols, image.rows) < maxEdge)
+            {
+                image = ImageCodec::Read(path);
+            }
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_WARN("Thumbnail of '{}' failed: {}", path.string(), e.what());
+            return {};
+        }
+        return image.empty() ? image : PreviewTexture::MakeThumbnail(image, maxEdge);
+    }
+
+    void ThumbnailLoader::Run(std::stop_token stopToken)
+    {
+        Nodes::Tracer::Get().SetCurrentThreadName("Thumbnails");
+        while (true)
+        {
+            Pending job;
+            uint64_t startedGeneration = 0;
+            {
+                std::unique_lock lock(mutex);
+                if (!wake.wait(lock, stopToken, [this]() { return !pending.empty(); }))
+                {
+                    return;
+                }
+                job = std::move(pending.front());
+                pending.pop_front();
+                decoding = job.key;
+                startedGeneration = generation;
+            }
+
+            cv::Mat image = Decode(job.path, maxEdge);
+
+            std::scoped_lock lock(mutex);
+            decoding.reset();
+            if (startedGeneration == generation)
+            {
+                ready.push_back({ job.key, std::move(job.path), std::move(image) });
+            }
+        }
+    }
+
+} // namespace VisionCraft::Vision::IO
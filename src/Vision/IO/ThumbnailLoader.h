@@ -0,0 +1,116 @@
+#pragma once
+
+#include <opencv2/opencv.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Decodes image files into thumbnails on a background thread.
+     *
+     * A gallery requests thumbnails for the rows it draws each frame and collects finished ones with
+     * TakeReady(); decoding never runs on the render thread. Requests are served newest first and at most
+     * maxPending wait, so after a fast scroll the oldest ones (rows long out of view) are dropped instead
+     * of being decoded. Files are read at a quarter of their size where the codec supports it (JPEG
+     * decodes reduced for free), and read again in full only if that is smaller than the thumbnail.
+     *
+     * All methods are thread-safe. The worker starts on the first Request().
+     */
+    class ThumbnailLoader
+    {
+    public:
+        /**
+         * @brief Decoded thumbnail.
+         */
+        struct Thumbnail
+        {
+            uint64_t key = 0;           ///< Key passed to Request()
+            std::filesystem::path path; ///< File decoded
+            cv::Mat image;              ///< Downscaled BGR image (empty if the file could not be read)
+        };
+
+        /**
+         * @brief Constructs loader.
+         * @param maxEdge Longest thumbnail edge in pixels
+         * @param maxPending Requests kept waiting before the oldest are dropped (at least 1)
+         */
+        ThumbnailLoader(int maxEdge, size_t maxPending);
+
+        /**
+         * @brief Stops the worker after the thumbnail it is decoding.
+         */
+        ~ThumbnailLoader();
+
+        ThumbnailLoader(const ThumbnailLoader &) = delete;
+        ThumbnailLoader &operator=(const ThumbnailLoader &) = delete;
+
+        /**
+         * @brief Requests a thumbnail, or moves a waiting request for the key to the front.
+         * @param key Caller's key for the file, returned with the thumbnail
+         * @param path Image file
+         * @note Does nothing while the key is being decoded or waits in TakeReady().
+         */
+        void Request(uint64_t key, const std::filesystem::path &path);
+
+        /**
+         * @brief Drops every waiting request and finished thumbnail, e.g. when a new batch starts.
+         */
+        void Cancel();
+
+        /**
+         * @brief Returns thumbnails finished since the last call.
+         * @return Thumbnails in completion order
+         */
+        [[nodiscard]] std::vector<Thumbnail> TakeReady();
+
+        /**
+         * @brief Returns number of waiting requests.
+         * @return Requests not yet decoding
+         */
+        [[nodiscard]] size_t GetPendingCount() const;
+
+        /**
+         * @brief Decodes one thumbnail (what the worker runs).
+         * @param path Image file
+         * @param maxEdge Longest thumbnail edge in pixels
+         * @return Thumbnail, or an empty image if the file cannot be read
+         */
+        [[nodiscard]] static cv::Mat Decode(const std::filesystem::path &path, int maxEdge);
+
+    private:
+        /**
+         * @brief Request waiting for the worker.
+         */
+        struct Pending
+        {
+            uint64_t key = 0;           ///< Caller's key
+            std::filesystem::path path; ///< Image file
+        };
+
+        /**
+         * @brief Decodes requests until stopped.
+         * @param stopToken Set by the destructor
+         */
+        void Run(std::stop_token stopToken);
+
+        const int maxEdge;                ///< Longest thumbnail edge
+        const size_t maxPending;          ///< Waiting requests kept
+        mutable std::mutex mutex;         ///< Guards the members below
+        std::condition_variable_any wake; ///< Signals new requests
+        std::deque<Pending> pending;      ///< Waiting requests, newest first
+        std::optional<uint64_t> decoding; ///< Key being decoded
+        uint64_t generation = 0;          ///< Bumped by Cancel(), so decodes started before it are dropped
+        std::vector<Thumbnail> ready;     ///< Finished thumbnails
+        std::jthread worker;              ///< Decode thread (started on first request)
+    };
+
+} // namespace VisionCraft::Vision::IO
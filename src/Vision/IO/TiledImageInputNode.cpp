@@ -0,0 +1,116 @@
+#include "Vision/IO/TiledImageInputNode.h"
+#include "Logger.h"
+#include "Nodes/Core/EngineConstants.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <stdexcept>
+
+namespace VisionCraft::Vision::IO
+{
+    TiledImageInputNode::TiledImageInputNode(Nodes::NodeId id, const std::string &name)
+        : Node(id, name), reader(std::make_shared<TiledTiffReader>(Constants::Tiling::kDefaultTileCacheBytes))
+    {
+        // Execution pins
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("FilePath", std::filesystem::path{});
+        CreateInputSlot("Level", 0);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+    }
+
+    void TiledImageInputNode::Process()
+    {
+        const auto filepath = GetInputValue<std::filesystem::path>("FilePath").value_or(std::filesystem::path{});
+        level.reset();
+        deferred.reset();
+        if (filepath.empty())
+        {
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        if (reader->GetPath() != filepath)
+        {
+            if (const auto error = reader->Open(filepath); !error.empty())
+            {
+                ClearOutputSlot("Output");
+                throw std::invalid_argument("Cannot read " + filepath.string() + " by tile: " + error);
+            }
+            const auto levels = reader->GetLevels();
+            LOG_INFO("TiledImageInputNode {}: Opened '{}' ({} levels, {}x{} px)",
+                GetName(),
+                filepath.string(),
+                levels.size(),
+                levels.front().size.width,
+                levels.front().size.height);
+        }
+
+        const auto levels = reader->GetLevels();
+        const int index = GetInputValue<int>("Level").value_or(0);
+        if (index < 0 || static_cast<size_t>(index) >= levels.size())
+        {
+            ClearOutputSlot("Output");
+            throw std::invalid_argument("Level " + std::to_string(index) + " does not exist; the file has " +
+                                        std::to_string(levels.size()));
+        }
+        level = static_cast<size_t>(index);
+
+        // Too large to hold: downstream region chains read what they need through ReadOutputRegion()
+        const auto &layout = levels[*level];
+        if (static_cast<size_t>(layout.size.area()) > maxWholeImagePixels)
+        {
+            deferred = Nodes::ImageShape{ .size = layout.size, .type = layout.type };
+            ClearOutputSlot("Output");
+            return;
+        }
+
+        cv::Mat image = reader->ReadRegion(*level, cv::Rect(cv::Point(), layout.size));
+        if (const double scale = GetProxyScale(); scale < 1.0)
+        {
+            cv::Mat proxy = CreateOutputImage();
+            const cv::Size size(std::max(1, static_cast<int>(std::lround(image.cols * scale))),
+                std::max(1, static_cast<int>(std::lround(image.rows * scale))));
+            cv::resize(image, proxy, size, 0, 0, cv::INTER_AREA);
+            image = std::move(proxy);
+        }
+        SetOutputSlotData("Output", std::move(image));
+    }
+
+    std::optional<Nodes::ImageShape> TiledImageInputNode::InferOutputShape(
+        [[maybe_unused]] const std::optional<Nodes::ImageShape> &input) const
+    {
+        if (!level)
+        {
+            return std::nullopt;
+        }
+        const auto layout = reader->GetLevels().at(*level);
+        return Nodes::ImageShape{ .size = layout.size, .type = layout.type };
+    }
+
+    std::optional<Nodes::ImageShape> TiledImageInputNode::GetDeferredOutputShape() const
+    {
+        return deferred;
+    }
+
+    cv::Mat TiledImageInputNode::ReadOutputRegion(const cv::Rect &region) const
+    {
+        if (!deferred)
+        {
+            throw std::runtime_error("TiledImageInputNode " + GetName() + " has no deferred level");
+        }
+        return reader->ReadRegion(*level, region);
+    }
+
+    void TiledImageInputNode::SetMaxWholeImagePixels(size_t pixels)
+    {
+        maxWholeImagePixels = pixels;
+    }
+
+    TiledTiffReader::Statistics TiledImageInputNode::GetStatistics() const
+    {
+        return reader->GetStatistics();
+    }
+} // namespace VisionCraft::Vision::IO
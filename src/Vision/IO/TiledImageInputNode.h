@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/Node.h"
+#include "Vision/IO/TiledTiffReader.h"
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Node reading one level of a tiled TIFF or BigTIFF file through TiledTiffReader.
+     *
+     * Levels up to Constants::Tiling::kMaxWholeImagePixels are loaded whole into Output, like ImageInputNode.
+     * Larger levels (the full resolution of a slide scan) are never loaded: Output stays empty and the node
+     * reports the level through GetDeferredOutputShape(), so a region chain it feeds (Crop, Resize, ...)
+     * decodes only the tiles its region covers. Choose a coarser Level to process the whole image.
+     */
+    class TiledImageInputNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs tiled image input node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        TiledImageInputNode(Nodes::NodeId id, const std::string &name = "Tiled Image Input");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "TiledImageInputNode";
+        }
+
+        /**
+         * @brief Excludes node from the output cache; it reads from disk, so its file may change between runs.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Opens the file if the path changed and loads the selected level, or defers it if too large.
+         * @throws std::invalid_argument if the file cannot be read by tile or Level does not exist
+         * @note In proxy runs a whole level is downscaled with INTER_AREA; deferred levels are not.
+         */
+        void Process() override;
+
+        /**
+         * @brief Returns the shape of the selected level; the node has no image input.
+         * @param input Unused
+         * @return Level shape, or std::nullopt before the file is opened
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> InferOutputShape(
+            const std::optional<Nodes::ImageShape> &input) const override;
+
+        /**
+         * @brief Returns the selected level's shape when Process() deferred it.
+         * @return Level shape, or std::nullopt if Output holds the level
+         */
+        [[nodiscard]] std::optional<Nodes::ImageShape> GetDeferredOutputShape() const override;
+
+        /**
+         * @brief Reads part of the deferred level.
+         * @param region Region inside the level
+         * @return Region pixels
+         * @throws std::runtime_error if no level is deferred or a tile cannot be decoded
+         */
+        [[nodiscard]] cv::Mat ReadOutputRegion(const cv::Rect &region) const override;
+
+        /**
+         * @brief Sets the largest level area loaded whole; larger levels are deferred to region reads.
+         * @param pixels Pixel count (Constants::Tiling::kMaxWholeImagePixels by default)
+         */
+        void SetMaxWholeImagePixels(size_t pixels);
+
+        /**
+         * @brief Returns tile cache counters of the open file.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] TiledTiffReader::Statistics GetStatistics() const;
+
+    private:
+        std::shared_ptr<TiledTiffReader> reader;   ///< Open file and its tile cache
+        std::optional<size_t> level;               ///< Level selected by the last Process()
+        std::optional<Nodes::ImageShape> deferred; ///< Shape of the level left to region reads
+        size_t maxWholeImagePixels = Constants::Tiling::kMaxWholeImagePixels; ///< Larger levels are deferred
+    };
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,641 @@
+#include "Vision/IO/TiledTiffReader.h"
+#include "Nodes/Core/Tracer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+namespace VisionCraft::Vision::IO
+{
+    namespace
+    {
+        // TIFF tags the reader understands
+        constexpr uint16_t kNewSubfileType = 254;
+        constexpr uint16_t kImageWidth = 256;
+        constexpr uint16_t kImageLength = 257;
+        constexpr uint16_t kBitsPerSample = 258;
+        constexpr uint16_t kCompression = 259;
+        constexpr uint16_t kPhotometric = 262;
+        constexpr uint16_t kStripOffsets = 273;
+        constexpr uint16_t kSamplesPerPixel = 277;
+        constexpr uint16_t kRowsPerStrip = 278;
+        constexpr uint16_t kStripByteCounts = 279;
+        constexpr uint16_t kPlanarConfig = 284;
+        constexpr uint16_t kPredictor = 317;
+        constexpr uint16_t kTileWidth = 322;
+        constexpr uint16_t kTileLength = 323;
+        constexpr uint16_t kTileOffsets = 324;
+        constexpr uint16_t kTileByteCounts = 325;
+        constexpr uint16_t kSubIfds = 330;
+        constexpr uint16_t kExtraSamples = 338;
+        constexpr uint16_t kSampleFormat = 339;
+        constexpr uint16_t kJpegTables = 347;
+        constexpr uint16_t kYCbCrSubsampling = 530;
+
+        constexpr size_t kMaxDirectories = 4096; ///< Guards against directory loops in corrupt files
+        constexpr size_t kMaxLevels = 1 << 16;   ///< Tile keys hold the level above bit 40
+
+        // Bytes of one value of a TIFF field type (0 = unknown type)
+        size_t TypeSize(uint16_t type)
+        {
+            switch (type)
+            {
+            case 1:  // BYTE
+            case 2:  // ASCII
+            case 6:  // SBYTE
+            case 7:  // UNDEFINED
+                return 1;
+            case 3:  // SHORT
+            case 8:  // SSHORT
+                return 2;
+            case 4:  // LONG
+            case 9:  // SLONG
+            case 11: // FLOAT
+            case 13: // IFD
+                return 4;
+            case 5:  // RATIONAL
+            case 10: // SRATIONAL
+            case 12: // DOUBLE
+            case 16: // LONG8
+            case 17: // SLONG8
+            case 18: // IFD8
+                return 8;
+            default:
+                return 0;
+            }
+        }
+
+        /**
+         * @brief Directory entry: where a tag's values are.
+         */
+        struct Field
+        {
+            uint16_t type = 0;  ///< TIFF field type
+            uint64_t count = 0; ///< Number of values
+            size_t offset = 0;  ///< File offset of the first value
+        };
+
+        /**
+         * @brief Reads classic TIFF and BigTIFF structures in either byte order; throws on truncation.
+         */
+        class TiffParser
+        {
+        public:
+            TiffParser(std::span<const std::byte> bytes, bool bigEndian, bool bigTiff)
+                : bytes(bytes), bigEndian(bigEndian), bigTiff(bigTiff)
+            {
+            }
+
+            uint64_t Read(size_t offset, size_t size) const
+            {
+                if (offset > bytes.size() || bytes.size() - offset < size)
+                {
+                    throw std::runtime_error("file is truncated");
+                }
+                uint64_t value = 0;
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const auto byte = std::to_integer<uint64_t>(bytes[offset + (bigEndian ? i : size - 1 - i)]);
+                    value = (value << 8) | byte;
+                }
+                return value;
+            }
+
+            // Tags of the directory at offset; next receives the following directory's offset (0 = none)
+            std::unordered_map<uint16_t, Field> ReadDirectory(uint64_t offset, uint64_t &next) const
+            {
+                const size_t countSize = bigTiff ? 8 : 2;
+                const size_t entrySize = bigTiff ? 20 : 12;
+                const size_t valueSize = bigTiff ? 8 : 4;
+                const uint64_t entries = Read(offset, countSize);
+                if (entries > (bytes.size() - offset) / entrySize)
+                {
+                    throw std::runtime_error("directory is truncated");
+                }
+
+                std::unordered_map<uint16_t, Field> fields;
+                for (uint64_t i = 0; i < entries; ++i)
+                {
+                    const size_t entry = offset + countSize + (i * entrySize);
+                    Field field;
+                    const auto tag = static_cast<uint16_t>(Read(entry, 2));
+                    field.type = static_cast<uint16_t>(Read(entry + 2, 2));
+                    field.count = Read(entry + 4, valueSize);
+                    const size_t typeSize = TypeSize(field.type);
+                    if (typeSize == 0 || field.count > bytes.size())
+                    {
+                        continue; // Unknown types are skipped, as readers must
+                    }
+                    // Values fitting in the entry are stored in it
+                    field.offset = field.count * typeSize <= valueSize ? entry + 4 + valueSize
+                                                                        : Read(entry + 4 + valueSize, valueSize);
+                    fields.emplace(tag, field);
+                }
+                next = Read(offset + countSize + (entries * entrySize), valueSize);
+                return fields;
+            }
+
+            std::vector<uint64_t> Values(const Field &field) const
+            {
+                const size_t typeSize = TypeSize(field.type);
+                std::vector<uint64_t> values;
+                values.reserve(field.count);
+                for (uint64_t i = 0; i < field.count; ++i)
+                {
+                    values.push_back(Read(field.offset + (i * typeSize), typeSize));
+                }
+                return values;
+            }
+
+            uint64_t Value(const std::unordered_map<uint16_t, Field> &fields, uint16_t tag, uint64_t fallback) const
+            {
+                const auto found = fields.find(tag);
+                return found == fields.end() || found->second.count == 0
+                           ? fallback
+                           : Read(found->second.offset, TypeSize(found->second.type));
+            }
+
+            std::vector<uint64_t> Values(const std::unordered_map<uint16_t, Field> &fields, uint16_t tag) const
+            {
+                const auto found = fields.find(tag);
+                return found == fields.end() ? std::vector<uint64_t>{} : Values(found->second);
+            }
+
+        private:
+            std::span<const std::byte> bytes; ///< Whole file
+            bool bigEndian;                   ///< "MM" byte order
+            bool bigTiff;                     ///< 64-bit offsets and counts
+        };
+
+        /**
+         * @brief Builds a classic single-strip TIFF in a given byte order.
+         */
+        class TiffWriter
+        {
+        public:
+            explicit TiffWriter(bool bigEndian) : bigEndian(bigEndian)
+            {
+            }
+
+            // Adds a tag with SHORT or LONG values, or UNDEFINED bytes; Finish() sorts them by tag
+            void AddShorts(uint16_t tag, std::vector<uint64_t> values)
+            {
+                entries.push_back({ tag, 3, std::move(values), {} });
+            }
+
+            void AddLong(uint16_t tag, uint64_t value)
+            {
+                entries.push_back({ tag, 4, { value }, {} });
+            }
+
+            void AddBytes(uint16_t tag, std::span<const std::byte> data)
+            {
+                entries.push_back({ tag, 7, {}, data });
+            }
+
+            // Serializes header, directory, out-of-line values and the strip; StripOffsets must have been added
+            std::vector<uchar> Finish(std::span<const std::byte> strip)
+            {
+                std::ranges::sort(entries, {}, &Entry::tag);
+                const size_t directorySize = 2 + (entries.size() * 12) + 4;
+                size_t extra = 8 + directorySize;
+                std::vector<size_t> extraOffsets;
+                for (const auto &entry : entries)
+                {
+                    extraOffsets.push_back(extra);
+                    const size_t size = EntryBytes(entry);
+                    extra += size > 4 ? (size + 1) & ~size_t{ 1 } : 0;
+                }
+                const size_t stripOffset = extra;
+
+                std::vector<uchar> out(stripOffset + strip.size());
+                const char order = bigEndian ? 'M' : 'I';
+                out[0] = static_cast<uchar>(order);
+                out[1] = static_cast<uchar>(order);
+                Put(out, 2, 42, 2);
+                Put(out, 4, 8, 4);
+                Put(out, 8, entries.size(), 2);
+                for (size_t i = 0; i < entries.size(); ++i)
+                {
+                    auto &entry = entries[i];
+                    if (entry.tag == kStripOffsets)
+                    {
+                        entry.values = { stripOffset };
+                    }
+                    const size_t at = 10 + (i * 12);
+                    const size_t size = EntryBytes(entry);
+                    const size_t valueAt = size > 4 ? extraOffsets[i] : at + 8;
+                    Put(out, at, entry.tag, 2);
+                    Put(out, at + 2, entry.type, 2);
+                    Put(out, at + 4, entry.type == 7 ? entry.bytes.size() : entry.values.size(), 4);
+                    if (size > 4)
+                    {
+                        Put(out, at + 8, valueAt, 4);
+                    }
+                    if (entry.type == 7)
+                    {
+                        std::memcpy(out.data() + valueAt, entry.bytes.data(), entry.bytes.size());
+                        continue;
+                    }
+                    const size_t width = entry.type == 3 ? 2 : 4;
+                    for (size_t v = 0; v < entry.values.size(); ++v)
+                    {
+                        Put(out, valueAt + (v * width), entry.values[v], width);
+                    }
+                }
+                std::memcpy(out.data() + stripOffset, strip.data(), strip.size());
+                return out;
+            }
+
+        private:
+            struct Entry
+            {
+                uint16_t tag = 0;                 ///< TIFF tag
+                uint16_t type = 0;                ///< 3 = SHORT, 4 = LONG, 7 = UNDEFINED
+                std::vector<uint64_t> values;     ///< SHORT or LONG values
+                std::span<const std::byte> bytes; ///< UNDEFINED bytes
+            };
+
+            static size_t EntryBytes(const Entry &entry)
+            {
+                return entry.type == 7 ? entry.bytes.size() : entry.values.size() * (entry.type == 3 ? 2 : 4);
+            }
+
+            void Put(std::vector<uchar> &out, size_t offset, uint64_t value, size_t size) const
+            {
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out[offset + (bigEndian ? size - 1 - i : i)] = static_cast<uchar>(value >> (8 * i));
+                }
+            }
+
+            bool bigEndian;             ///< "MM" byte order
+            std::vector<Entry> entries; ///< Tags to write
+        };
+
+        // cv::Mat depth of a sample layout, or -1 if OpenCV has none
+        int SampleDepth(int bitsPerSample, int sampleFormat)
+        {
+            switch (bitsPerSample)
+            {
+            case 8:
+                return sampleFormat == 2 ? CV_8S : CV_8U;
+            case 16:
+                return sampleFormat == 2 ? CV_16S : CV_16U;
+            case 32:
+                return sampleFormat == 3 ? CV_32F : (sampleFormat == 2 ? CV_32S : -1);
+            case 64:
+                return sampleFormat == 3 ? CV_64F : -1;
+            default:
+                return -1;
+            }
+        }
+    } // namespace
+
+    TiledTiffReader::TiledTiffReader(size_t cacheBytes) : cacheBytes(cacheBytes)
+    {
+    }
+
+    std::string TiledTiffReader::Open(const std::filesystem::path &newPath)
+    {
+        std::scoped_lock lock(mutex);
+        directories.clear();
+        tiles.clear();
+        recency.clear();
+        stats = Statistics{};
+        path.clear();
+        if (!file.Open(newPath))
+        {
+            return "cannot open file";
+        }
+
+        const auto bytes = file.GetBytes();
+        try
+        {
+            if (bytes.size() < 8)
+            {
+                throw std::runtime_error("not a TIFF file");
+            }
+            const auto order = static_cast<char>(bytes[0]);
+            if ((order != 'I' && order != 'M') || static_cast<char>(bytes[1]) != order)
+            {
+                throw std::runtime_error("not a TIFF file");
+            }
+            bigEndian = order == 'M';
+            const auto version = TiffParser(bytes, bigEndian, false).Read(2, 2);
+            if (version != 42 && version != 43)
+            {
+                throw std::runtime_error("not a TIFF file");
+            }
+            const bool bigTiff = version == 43;
+            const TiffParser parser(bytes, bigEndian, bigTiff);
+            if (bigTiff && (parser.Read(4, 2) != 8 || parser.Read(6, 2) != 0))
+            {
+                throw std::runtime_error("unsupported BigTIFF offset size");
+            }
+
+            // Main directory chain, with SubIFDs (pyramid levels in OME-TIFF) queued after their parent
+            std::vector<uint64_t> pending{ parser.Read(bigTiff ? 8 : 4, bigTiff ? 8 : 4) };
+            std::unordered_set<uint64_t> visited;
+            std::vector<Directory> tiled;
+            std::optional<Directory> firstStripped;
+            std::string skipped;
+            while (!pending.empty() && visited.size() < kMaxDirectories)
+            {
+                const uint64_t offset = pending.back();
+                pending.pop_back();
+                if (offset == 0 || !visited.insert(offset).second)
+                {
+                    continue;
+                }
+
+                uint64_t next = 0;
+                const auto fields = parser.ReadDirectory(offset, next);
+                pending.push_back(next);
+                for (const auto subIfd : parser.Values(fields, kSubIfds))
+                {
+                    pending.push_back(subIfd);
+                }
+                if (parser.Value(fields, kNewSubfileType, 0) & 4)
+                {
+                    continue; // Transparency mask
+                }
+
+                Directory directory;
+                directory.level.size = cv::Size(static_cast<int>(parser.Value(fields, kImageWidth, 0)),
+                    static_cast<int>(parser.Value(fields, kImageLength, 0)));
+                directory.samples = static_cast<int>(parser.Value(fields, kSamplesPerPixel, 1));
+                directory.bitsPerSample = static_cast<int>(parser.Value(fields, kBitsPerSample, 1));
+                directory.sampleFormat = static_cast<int>(parser.Value(fields, kSampleFormat, 1));
+                directory.compression = static_cast<int>(parser.Value(fields, kCompression, 1));
+                directory.photometric = static_cast<int>(parser.Value(fields, kPhotometric, 1));
+                directory.predictor = static_cast<int>(parser.Value(fields, kPredictor, 1));
+                for (const auto value : parser.Values(fields, kYCbCrSubsampling))
+                {
+                    directory.ycbcrSubsampling.push_back(static_cast<uint16_t>(value));
+                }
+                for (const auto value : parser.Values(fields, kExtraSamples))
+                {
+                    directory.extraSamples.push_back(static_cast<uint16_t>(value));
+                }
+                if (const auto tables = fields.find(kJpegTables); tables != fields.end())
+                {
+                    parser.Read(tables->second.offset + tables->second.count - 1, 1); // Throws if truncated
+                    directory.jpegTables = { tables->second.offset, tables->second.count };
+                }
+
+                const int depth = SampleDepth(directory.bitsPerSample, directory.sampleFormat);
+                const bool chunky = parser.Value(fields, kPlanarConfig, 1) == 1 || directory.samples == 1;
+                const bool colorModel = directory.photometric <= 2 || directory.photometric == 6;
+                if (directory.level.size.empty() || depth < 0 || !chunky || !colorModel || directory.samples < 1
+                    || directory.samples > 4)
+                {
+                    skipped = "unsupported sample layout or color model";
+                    continue;
+                }
+                directory.level.type = CV_MAKETYPE(depth, directory.samples);
+
+                const bool isTiled = fields.contains(kTileWidth);
+                directory.level.tileSize = isTiled
+                                               ? cv::Size(static_cast<int>(parser.Value(fields, kTileWidth, 0)),
+                                                     static_cast<int>(parser.Value(fields, kTileLength, 0)))
+                                               : cv::Size(directory.level.size.width,
+                                                     static_cast<int>(std::min<uint64_t>(
+                                                         parser.Value(fields, kRowsPerStrip, UINT32_MAX),
+                                                         static_cast<uint64_t>(directory.level.size.height))));
+                const auto offsets = parser.Values(fields, isTiled ? kTileOffsets : kStripOffsets);
+                const auto counts = parser.Values(fields, isTiled ? kTileByteCounts : kStripByteCounts);
+                const auto &tile = directory.level.tileSize;
+                if (tile.empty())
+                {
+                    skipped = "invalid tile size";
+                    continue;
+                }
+                const auto columns = static_cast<size_t>((directory.level.size.width + tile.width - 1) / tile.width);
+                const auto rows = static_cast<size_t>((directory.level.size.height + tile.height - 1) / tile.height);
+                const size_t tileCount = columns * rows;
+                if (offsets.size() < tileCount || counts.size() < tileCount)
+                {
+                    skipped = "missing tile offsets";
+                    continue;
+                }
+                for (size_t i = 0; i < tileCount; ++i)
+                {
+                    directory.tiles.emplace_back(offsets[i], counts[i]);
+                }
+
+                if (isTiled)
+                {
+                    tiled.push_back(std::move(directory));
+                }
+                else if (!firstStripped)
+                {
+                    firstStripped = std::move(directory);
+                }
+            }
+
+            if (tiled.empty() && firstStripped)
+            {
+                tiled.push_back(std::move(*firstStripped));
+            }
+            if (tiled.empty())
+            {
+                throw std::runtime_error(skipped.empty() ? "no image directory" : skipped);
+            }
+
+            // Largest first; thumbnails, labels or masks of another type are not levels of the image
+            std::ranges::stable_sort(tiled, [](const Directory &a, const Directory &b) {
+                return a.level.size.area() > b.level.size.area();
+            });
+            const int type = tiled.front().level.type;
+            std::erase_if(tiled, [&](const Directory &directory) { return directory.level.type != type; });
+            if (tiled.size() > kMaxLevels)
+            {
+                tiled.resize(kMaxLevels);
+            }
+            directories = std::move(tiled);
+        }
+        catch (const std::exception &e)
+        {
+            file.Close();
+            return e.what();
+        }
+
+        path = newPath;
+        return {};
+    }
+
+    std::filesystem::path TiledTiffReader::GetPath() const
+    {
+        std::scoped_lock lock(mutex);
+        return path;
+    }
+
+    std::vector<TiledTiffReader::Level> TiledTiffReader::GetLevels() const
+    {
+        std::scoped_lock lock(mutex);
+        std::vector<Level> levels;
+        levels.reserve(directories.size());
+        for (const auto &directory : directories)
+        {
+            levels.push_back(directory.level);
+        }
+        return levels;
+    }
+
+    cv::Mat TiledTiffReader::ReadRegion(size_t level, const cv::Rect &region)
+    {
+        std::scoped_lock lock(mutex);
+        if (level >= directories.size())
+        {
+            throw std::out_of_range("no such level");
+        }
+        const auto &directory = directories[level];
+        const auto &tile = directory.level.tileSize;
+        if (region.empty() || (region & cv::Rect(cv::Point(), directory.level.size)) != region)
+        {
+            throw std::out_of_range("region outside the image");
+        }
+
+        Nodes::TraceScope trace("io", "Read TIFF region");
+        const int columns = (directory.level.size.width + tile.width - 1) / tile.width;
+        cv::Mat out(region.size(), directory.level.type);
+        for (int row = region.y / tile.height; row <= (region.br().y - 1) / tile.height; ++row)
+        {
+            for (int column = region.x / tile.width; column <= (region.br().x - 1) / tile.width; ++column)
+            {
+                const cv::Rect tileRect(column * tile.width, row * tile.height, tile.width, tile.height);
+                const cv::Rect overlap = tileRect & region;
+                const cv::Mat pixels = AcquireTile(level, static_cast<size_t>(row) * columns + column);
+                pixels(overlap - tileRect.tl()).copyTo(out(overlap - region.tl()));
+            }
+        }
+        TrimCache();
+        return out;
+    }
+
+    void TiledTiffReader::SetCacheBytes(size_t newCacheBytes)
+    {
+        std::scoped_lock lock(mutex);
+        cacheBytes = newCacheBytes;
+        TrimCache();
+    }
+
+    TiledTiffReader::Statistics TiledTiffReader::GetStatistics() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    cv::Mat TiledTiffReader::AcquireTile(size_t level, size_t index)
+    {
+        const uint64_t key = (static_cast<uint64_t>(level) << 40) | index;
+        if (const auto found = tiles.find(key); found != tiles.end())
+        {
+            recency.splice(recency.begin(), recency, found->second.recencyEntry);
+            ++stats.cacheHits;
+            return found->second.pixels;
+        }
+
+        cv::Mat pixels = DecodeTile(directories[level], index);
+        ++stats.tilesDecoded;
+        stats.residentBytes += pixels.total() * pixels.elemSize();
+        recency.push_front(key);
+        tiles.emplace(key, CachedTile{ .pixels = pixels, .recencyEntry = recency.begin() });
+        return pixels;
+    }
+
+    void TiledTiffReader::TrimCache()
+    {
+        // Tiles of the region just read are the most recent, so they go last
+        while (stats.residentBytes > cacheBytes && !recency.empty())
+        {
+            const auto found = tiles.find(recency.back());
+            stats.residentBytes -= found->second.pixels.total() * found->second.pixels.elemSize();
+            tiles.erase(found);
+            recency.pop_back();
+        }
+    }
+
+    cv::Mat TiledTiffReader::DecodeTile(const Directory &directory, size_t index) const
+    {
+        const auto bytes = file.GetBytes();
+        const auto [offset, length] = directory.tiles[index];
+        if (offset > bytes.size() || bytes.size() - offset < length)
+        {
+            throw std::runtime_error("tile " + std::to_string(index) + " is truncated");
+        }
+        const auto data = bytes.subspan(offset, length);
+        const auto &tile = directory.level.tileSize;
+        const int type = directory.level.type;
+
+        // Uncompressed gray or RGB: copy, fix byte order and channel order
+        if (directory.compression == 1 && (directory.photometric == 1 || directory.photometric == 2))
+        {
+            cv::Mat pixels(tile, type);
+            const size_t expected = pixels.total() * pixels.elemSize();
+            // The last strip may be short; rows past the image are never read
+            std::memset(pixels.data, 0, expected);
+            std::memcpy(pixels.data, data.data(), std::min(expected, data.size()));
+            const size_t sampleBytes = CV_ELEM_SIZE1(type);
+            if (sampleBytes > 1 && bigEndian != (std::endian::native == std::endian::big))
+            {
+                for (uchar *sample = pixels.data; sample < pixels.data + expected; sample += sampleBytes)
+                {
+                    std::reverse(sample, sample + sampleBytes);
+                }
+            }
+            if (directory.photometric == 2 && directory.samples >= 3)
+            {
+                cv::cvtColor(pixels, pixels, directory.samples == 3 ? cv::COLOR_RGB2BGR : cv::COLOR_RGBA2BGRA);
+            }
+            return pixels;
+        }
+
+        // Everything else goes through OpenCV's TIFF codec, as a file holding only this tile
+        TiffWriter writer(bigEndian);
+        writer.AddLong(kImageWidth, static_cast<uint64_t>(tile.width));
+        writer.AddLong(kImageLength, static_cast<uint64_t>(tile.height));
+        writer.AddShorts(kBitsPerSample,
+            std::vector<uint64_t>(static_cast<size_t>(directory.samples), directory.bitsPerSample));
+        writer.AddShorts(kCompression, { static_cast<uint64_t>(directory.compression) });
+        writer.AddShorts(kPhotometric, { static_cast<uint64_t>(directory.photometric) });
+        writer.AddLong(kStripOffsets, 0);
+        writer.AddShorts(kSamplesPerPixel, { static_cast<uint64_t>(directory.samples) });
+        writer.AddLong(kRowsPerStrip, static_cast<uint64_t>(tile.height));
+        writer.AddLong(kStripByteCounts, data.size());
+        writer.AddShorts(kPlanarConfig, { 1 });
+        if (directory.predictor != 1)
+        {
+            writer.AddShorts(kPredictor, { static_cast<uint64_t>(directory.predictor) });
+        }
+        if (!directory.extraSamples.empty())
+        {
+            writer.AddShorts(kExtraSamples, { directory.extraSamples.begin(), directory.extraSamples.end() });
+        }
+        writer.AddShorts(kSampleFormat,
+            std::vector<uint64_t>(static_cast<size_t>(directory.samples), directory.sampleFormat));
+        if (directory.jpegTables.second > 0)
+        {
+            writer.AddBytes(kJpegTables, bytes.subspan(directory.jpegTables.first, directory.jpegTables.second));
+        }
+        if (directory.ycbcrSubsampling.size() == 2)
+        {
+            writer.AddShorts(kYCbCrSubsampling,
+                { directory.ycbcrSubsampling.front(), directory.ycbcrSubsampling.back() });
+        }
+
+        const auto encoded = writer.Finish(data);
+        cv::Mat pixels = cv::imdecode(encoded, cv::IMREAD_UNCHANGED);
+        if (pixels.size() != tile || pixels.type() != type)
+        {
+            throw std::runtime_error("tile " + std::to_string(index) + " could not be decoded");
+        }
+        return pixels;
+    }
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Nodes/Core/MappedFile.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Reads regions of tiled TIFF and BigTIFF files, decoding only the tiles a region covers.
+     *
+     * cv::imread decodes a whole image into one cv::Mat, which slide scans and other gigapixel files far
+     * exceed. The reader maps the file, parses its directories, and decodes tiles on demand into an LRU
+     * cache bounded in bytes, so the resident memory of a region read is the cache, not the image.
+     *
+     * Every tiled directory of the file (and its SubIFDs, as in OME-TIFF) is one level, largest first:
+     * pyramidal TIFF (SVS, OME, libvips) levels become coarser levels of the same image. A file without
+     * tiled directories has its first directory read strip by strip instead.
+     *
+     * Uncompressed chunky tiles are copied from the mapping directly. Other compressions (LZW, Deflate,
+     * JPEG with shared JPEGTables, ...) are handed to OpenCV's TIFF codec one tile at a time, wrapped in a
+     * minimal single-strip TIFF, so any compression OpenCV reads works. Pixels come back as
+     * cv::IMREAD_UNCHANGED would return them: stored depth, channels in BGR(A) order.
+     *
+     * All methods are thread-safe.
+     */
+    class TiledTiffReader
+    {
+    public:
+        /**
+         * @brief Layout of one resolution level.
+         */
+        struct Level
+        {
+            cv::Size size;     ///< Image size
+            cv::Size tileSize; ///< Tile (or strip) size
+            int type = 0;      ///< cv::Mat type of decoded pixels
+        };
+
+        /**
+         * @brief Tile cache counters.
+         */
+        struct Statistics
+        {
+            size_t tilesDecoded = 0;  ///< Tiles decoded since Open()
+            size_t cacheHits = 0;     ///< Tile reads served from the cache
+            size_t residentBytes = 0; ///< Decoded tile bytes currently cached
+        };
+
+        /**
+         * @brief Creates a reader with no file open.
+         * @param cacheBytes Decoded tile bytes kept resident
+         */
+        explicit TiledTiffReader(size_t cacheBytes);
+
+        /**
+         * @brief Opens a file, replacing the current one.
+         * @param path TIFF or BigTIFF file
+         * @return Empty on success, otherwise why the file cannot be read by tile
+         */
+        [[nodiscard]] std::string Open(const std::filesystem::path &path);
+
+        /**
+         * @brief Returns the open file's path.
+         * @return Path, empty before a successful Open()
+         */
+        [[nodiscard]] std::filesystem::path GetPath() const;
+
+        /**
+         * @brief Returns the resolution levels.
+         * @return Levels, largest first; empty before a successful Open()
+         */
+        [[nodiscard]] std::vector<Level> GetLevels() const;
+
+        /**
+         * @brief Reads part of one level, decoding the tiles it covers that are not cached.
+         * @param level Index into GetLevels()
+         * @param region Region inside the level
+         * @return Region pixels (a new image)
+         * @throws std::out_of_range if the level or region is outside the image
+         * @throws std::runtime_error if a tile is truncated or cannot be decoded
+         */
+        [[nodiscard]] cv::Mat ReadRegion(size_t level, const cv::Rect &region);
+
+        /**
+         * @brief Changes the tile cache budget, evicting tiles if needed.
+         * @param cacheBytes Decoded tile bytes kept resident
+         */
+        void SetCacheBytes(size_t cacheBytes);
+
+        /**
+         * @brief Returns tile cache counters.
+         * @return Statistics snapshot
+         */
+        [[nodiscard]] Statistics GetStatistics() const;
+
+    private:
+        /**
+         * @brief Level layout plus where its tiles are stored.
+         */
+        struct Directory
+        {
+            Level level;                                  ///< Public layout
+            int samples = 1;                              ///< Samples per pixel
+            int bitsPerSample = 8;                        ///< Bits per sample
+            int sampleFormat = 1;                         ///< 1 = unsigned, 2 = signed, 3 = float
+            int compression = 1;                          ///< TIFF compression code
+            int photometric = 1;                          ///< TIFF photometric interpretation
+            int predictor = 1;                            ///< TIFF predictor
+            std::vector<uint16_t> extraSamples;           ///< ExtraSamples values, if present
+            std::vector<uint16_t> ycbcrSubsampling;       ///< YCbCrSubsampling values, if present
+            std::pair<size_t, size_t> jpegTables;         ///< Offset and length of JPEGTables (length 0 = none)
+            std::vector<std::pair<size_t, size_t>> tiles; ///< Offset and byte count of each tile, row-major
+        };
+
+        /**
+         * @brief Decodes one tile.
+         * @param directory Level the tile belongs to
+         * @param index Tile index (row-major)
+         * @return Tile pixels, tileSize large
+         */
+        [[nodiscard]] cv::Mat DecodeTile(const Directory &directory, size_t index) const;
+
+        /**
+         * @brief Returns a tile from the cache, decoding it on a miss.
+         * @param level Level index
+         * @param index Tile index
+         * @return Tile pixels (shared with the cache)
+         * @note Caller must hold mutex.
+         */
+        cv::Mat AcquireTile(size_t level, size_t index);
+
+        /**
+         * @brief Evicts least recently used tiles until the cache fits its budget.
+         * @note Caller must hold mutex.
+         */
+        void TrimCache();
+
+        /**
+         * @brief Cached tile and its place in the recency list.
+         */
+        struct CachedTile
+        {
+            cv::Mat pixels;                             ///< Decoded tile
+            std::list<uint64_t>::iterator recencyEntry; ///< Position in recency
+        };
+
+        mutable std::mutex mutex;                       ///< Guards every member below
+        Nodes::MappedFile file;                         ///< Mapped file
+        std::filesystem::path path;                     ///< Open file's path
+        bool bigEndian = false;                         ///< Byte order of the file
+        std::vector<Directory> directories;             ///< Levels, largest first
+        size_t cacheBytes;                              ///< Tile cache budget
+        std::list<uint64_t> recency;                    ///< Cached tile keys, most recent first
+        std::unordered_map<uint64_t, CachedTile> tiles; ///< Cached tiles by level and index
+        Statistics stats;                               ///< Counters
+    };
+} // namespace VisionCraft::Vision::IO
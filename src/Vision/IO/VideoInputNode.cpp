@@ -0,0 +1,106 @@
+#include "Vision/IO/VideoInputNode.h"
+#include "Logger.h"
+
+namespace VisionCraft::Vision::IO
+{
+    VideoInputNode::VideoInputNode(Nodes::NodeId id, const std::string &name) : Node(id, name)
+    {
+        // Execution pins
+        CreateExecutionOutputPin("Then");
+
+        // Data pins
+        CreateInputSlot("FilePath", std::filesystem::path{});
+        CreateInputSlot("CameraIndex", -1); // -1 means use FilePath
+        CreateInputSlot("Loop", false);
+        CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+        CreateOutputSlot("FrameIndex").SetDataType(Nodes::SlotDataType::Int);
+    }
+
+    void VideoInputNode::Process()
+    {
+        const auto filepathView = GetInputView<std::filesystem::path>("FilePath");
+        const auto &filepath = filepathView.ValueOrEmpty();
+        const auto cameraIndex = GetInputValue<int>("CameraIndex").value_or(-1);
+        const auto loop = GetInputValue<bool>("Loop").value_or(false);
+
+        if (!EnsureCaptureOpen(filepath, cameraIndex))
+        {
+            streamEnded = true;
+            ClearOutputSlot("Output");
+            ClearOutputSlot("FrameIndex");
+            return;
+        }
+
+        // Decode into a fresh buffer: with pipelined streaming, downstream nodes may still read the previous frame
+        cv::Mat frame;
+        try
+        {
+            if (!capture.read(frame) && loop && cameraIndex < 0)
+            {
+                capture.set(cv::CAP_PROP_POS_FRAMES, 0);
+                frameIndex = 0;
+                capture.read(frame);
+            }
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("VideoInputNode {}: OpenCV error reading frame: {}", GetName(), e.what());
+            frame = cv::Mat{};
+        }
+
+        if (frame.empty())
+        {
+            LOG_INFO("VideoInputNode {}: End of stream after {} frames", GetName(), frameIndex);
+            streamEnded = true;
+            ClearOutputSlot("Output");
+            ClearOutputSlot("FrameIndex");
+            return;
+        }
+
+        streamEnded = false;
+        SetOutputSlotData("Output", frame);
+        SetOutputSlotData("FrameIndex", frameIndex);
+        ++frameIndex;
+    }
+
+    bool VideoInputNode::EnsureCaptureOpen(const std::filesystem::path &filepath, int cameraIndex)
+    {
+        const std::string source = cameraIndex >= 0 ? "camera:" + std::to_string(cameraIndex) : filepath.string();
+        if (capture.isOpened() && source == openedSource && !streamEnded)
+        {
+            return true;
+        }
+
+        capture.release();
+        openedSource = source;
+        frameIndex = 0;
+
+        if (cameraIndex < 0 && filepath.empty())
+        {
+            return false;
+        }
+
+        try
+        {
+            const bool opened = cameraIndex >= 0 ? capture.open(cameraIndex) : capture.open(filepath.string());
+            if (!opened)
+            {
+                LOG_ERROR("VideoInputNode {}: Failed to open '{}'", GetName(), source);
+                return false;
+            }
+        }
+        catch (const cv::Exception &e)
+        {
+            LOG_ERROR("VideoInputNode {}: OpenCV error opening '{}': {}", GetName(), source, e.what());
+            return false;
+        }
+
+        LOG_INFO("VideoInputNode {}: Opened '{}' ({}x{} at {} fps)",
+            GetName(),
+            source,
+            static_cast<int>(capture.get(cv::CAP_PROP_FRAME_WIDTH)),
+            static_cast<int>(capture.get(cv::CAP_PROP_FRAME_HEIGHT)),
+            capture.get(cv::CAP_PROP_FPS));
+        return true;
+    }
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Nodes/Core/Node.h"
+#include <opencv2/opencv.hpp>
+#include <filesystem>
+#include <string>
+
+namespace VisionCraft::Vision::IO
+{
+    /**
+     * @brief Node producing frames from a video file or camera.
+     *
+     * Each Process() call delivers the next frame, so the node is meant to drive
+     * NodeEditor::ExecuteStream(). A CameraIndex of 0 or higher selects a camera; otherwise
+     * FilePath is opened. Changing either slot reopens the capture, and processing again after
+     * the stream ended starts over from the first frame.
+     */
+    class VideoInputNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs video input node.
+         * @param id Node ID
+         * @param name Node name
+         */
+        VideoInputNode(Nodes::NodeId id, const std::string &name = "Video Input");
+
+        /**
+         * @brief Returns node type identifier.
+         * @return Type string
+         */
+        [[nodiscard]] std::string GetType() const override
+        {
+            return "VideoInputNode";
+        }
+
+        /**
+         * @brief Excludes node from the output cache; every call yields a different frame.
+         * @return Always false
+         */
+        [[nodiscard]] bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        /**
+         * @brief Marks node as a stream source.
+         * @return Always true
+         */
+        [[nodiscard]] bool IsStreamSource() const override
+        {
+            return true;
+        }
+
+        /**
+         * @brief Checks if the last Process() call found no more frames.
+         * @return True at end of file (without Loop) or when the source could not be opened
+         */
+        [[nodiscard]] bool HasStreamEnded() const override
+        {
+            return streamEnded;
+        }
+
+        /**
+         * @brief Reads the next frame into the Output slot.
+         */
+        void Process() override;
+
+    private:
+        /**
+         * @brief Opens the capture if the source changed, is closed, or the stream ended.
+         * @param filepath Video file (used when cameraIndex is negative)
+         * @param cameraIndex Camera device index, or negative for the file
+         * @return True if the capture is open
+         */
+        bool EnsureCaptureOpen(const std::filesystem::path &filepath, int cameraIndex);
+
+        cv::VideoCapture capture; ///< Open video file or camera
+        std::string openedSource; ///< Source the capture was opened with ("camera:N" or the file path)
+        int frameIndex = 0;       ///< Index of the next frame since opening
+        bool streamEnded = false; ///< Last Process() produced no frame
+    };
+} // namespace VisionCraft::Vision::IO
@@ -0,0 +1,208 @@
+#include "Vision/Kernels/BitMaskOps.h"
+#include "Vision/Kernels/Kernels.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace VisionCraft::Vision::Kernels
+{
+    namespace
+    {
+        constexpr int kWordBits = 64;
+
+        using RowKernel = void (*)(const uint64_t *, const uint64_t *, uint64_t *, size_t);
+
+        // out bit x = in bit (x + offset); bits outside [0, wordCount * 64) read as fill
+        void ShiftRow(const uint64_t *in, uint64_t *out, int wordCount, int offset, uint64_t fill)
+        {
+            const int wordShift = offset >= 0 ? offset / kWordBits : -((-offset + kWordBits - 1) / kWordBits);
+            const int bitShift = offset - wordShift * kWordBits;
+            const auto word = [&](int i) { return i >= 0 && i < wordCount ? in[i] : fill; };
+            for (int i = 0; i < wordCount; ++i)
+            {
+                const int source = i + wordShift;
+                out[i] = bitShift == 0 ? word(source)
+                                       : (word(source) >> bitShift) | (word(source + 1) << (kWordBits - bitShift));
+            }
+        }
+
+        // Words a row needs past its end so every window of the rectangle reads real bits or border
+        int RowPadding(const MaskRectangle &rectangle)
+        {
+            return (rectangle.right - rectangle.left + kWordBits) / kWordBits;
+        }
+
+        // line bit x = op over its bits x + left .. x + right. The line holds a row followed by
+        // RowPadding() words, with every bit past the row's last column set to fill. It is shifted to
+        // the window's start, then the covered span doubles: after each step bit x holds op over
+        // [x, x + span), and two overlapping spans finish any width (op is idempotent).
+        void RowWindow(std::vector<uint64_t> &line, const MaskRectangle &rectangle, uint64_t fill, RowKernel op,
+            std::vector<uint64_t> &shifted)
+        {
+            const int wordCount = static_cast<int>(line.size());
+            const int width = rectangle.right - rectangle.left + 1;
+            shifted.resize(line.size());
+            if (rectangle.left != 0)
+            {
+                ShiftRow(line.data(), shifted.data(), wordCount, rectangle.left, fill);
+                line.swap(shifted);
+            }
+            int span = 1;
+            while (span * 2 <= width)
+            {
+                ShiftRow(line.data(), shifted.data(), wordCount, span, fill);
+                op(line.data(), shifted.data(), line.data(), line.size());
+                span *= 2;
+            }
+            if (span < width)
+            {
+                ShiftRow(line.data(), shifted.data(), wordCount, width - span, fill);
+                op(line.data(), shifted.data(), line.data(), line.size());
+            }
+        }
+
+        // Applies one rectangle: rows through RowWindow, then columns by van Herk/Gil-Werman over whole rows
+        // (as MorphologyNode filters byte images), so both passes are word-wide
+        Nodes::BitMask RectangleWindow(
+            const Nodes::BitMask &mask, const MaskRectangle &rectangle, bool erode, RowKernel op)
+        {
+            const cv::Size size = mask.GetSize();
+            const int wordCount = mask.GetWordsPerRow();
+            const auto width = static_cast<size_t>(wordCount);
+            const uint64_t fill = erode ? ~uint64_t{ 0 } : 0;
+            const uint64_t tail = Nodes::BitMask::GetLastWordMask(size.width);
+
+            // Rows; bits past the last column read as border until the final pass re-clears them
+            cv::Mat horizontalWords(size.height, wordCount * static_cast<int>(sizeof(uint64_t)), CV_8UC1);
+            cv::parallel_for_(cv::Range(0, size.height), [&](const cv::Range &range) {
+                std::vector<uint64_t> line, shifted;
+                for (int y = range.start; y < range.end; ++y)
+                {
+                    line.assign(width + static_cast<size_t>(RowPadding(rectangle)), fill);
+                    std::copy(mask.GetRow(y), mask.GetRow(y) + wordCount, line.begin());
+                    line[width - 1] |= fill & ~tail;
+                    RowWindow(line, rectangle, fill, op, shifted);
+                    std::copy(line.begin(), line.begin() + wordCount,
+                        reinterpret_cast<uint64_t *>(horizontalWords.ptr(y)));
+                }
+            });
+
+            // Columns
+            const auto rows = static_cast<size_t>(size.height);
+            const auto columnWindow = static_cast<size_t>(rectangle.bottom - rectangle.top + 1);
+            const size_t columnLength = rows + columnWindow - 1;
+            const std::vector<uint64_t> borderRow(width, fill);
+            const auto paddedRow = [&](size_t i) {
+                const int y = static_cast<int>(i) + rectangle.top;
+                return y >= 0 && y < size.height ? reinterpret_cast<const uint64_t *>(horizontalWords.ptr(y))
+                                                 : borderRow.data();
+            };
+            std::vector<uint64_t> prefixRows(columnLength * width), suffixRows(columnLength * width);
+            for (size_t i = 0; i < columnLength; ++i)
+            {
+                const uint64_t *row = paddedRow(i);
+                uint64_t *current = &prefixRows[i * width];
+                if (i % columnWindow == 0)
+                {
+                    std::copy(row, row + width, current);
+                    continue;
+                }
+                op(current - width, row, current, width);
+            }
+            for (size_t i = columnLength; i-- > 0;)
+            {
+                const uint64_t *row = paddedRow(i);
+                uint64_t *current = &suffixRows[i * width];
+                if ((i + 1) % columnWindow == 0 || i + 1 == columnLength)
+                {
+                    std::copy(row, row + width, current);
+                    continue;
+                }
+                op(current + width, row, current, width);
+            }
+
+            Nodes::BitMask output(size);
+            for (size_t y = 0; y < rows; ++y)
+            {
+                uint64_t *destination = output.GetRow(static_cast<int>(y));
+                op(&suffixRows[y * width], &prefixRows[(y + columnWindow - 1) * width], destination, width);
+                destination[width - 1] &= tail;
+            }
+            return output;
+        }
+
+        Nodes::BitMask ElementWindow(
+            const Nodes::BitMask &mask, std::span<const MaskRectangle> rectangles, bool erode)
+        {
+            if (mask.IsEmpty() || rectangles.empty())
+            {
+                return mask.Clone();
+            }
+            const RowKernel op = erode ? RowKernel{ &BitwiseAnd } : RowKernel{ &BitwiseOr };
+            Nodes::BitMask result = RectangleWindow(mask, rectangles.front(), erode, op);
+            const auto width = static_cast<size_t>(result.GetWordsPerRow());
+            for (size_t r = 1; r < rectangles.size(); ++r)
+            {
+                const Nodes::BitMask partial = RectangleWindow(mask, rectangles[r], erode, op);
+                for (int y = 0; y < result.GetSize().height; ++y)
+                {
+                    op(result.GetRow(y), partial.GetRow(y), result.GetRow(y), width);
+                }
+            }
+            return result;
+        }
+    } // namespace
+
+    Nodes::BitMask CombineMasks(const Nodes::BitMask &a, const Nodes::BitMask &b, MaskOperation operation)
+    {
+        if (a.GetSize() != b.GetSize())
+        {
+            throw std::invalid_argument("Masks to combine must have the same size");
+        }
+
+        Nodes::BitMask output(a.GetSize());
+        const auto width = static_cast<size_t>(a.GetWordsPerRow());
+        cv::parallel_for_(cv::Range(0, a.GetSize().height), [&](const cv::Range &range) {
+            for (int y = range.start; y < range.end; ++y)
+            {
+                switch (operation)
+                {
+                case MaskOperation::And:
+                    BitwiseAnd(a.GetRow(y), b.GetRow(y), output.GetRow(y), width);
+                    break;
+                case MaskOperation::Or:
+                    BitwiseOr(a.GetRow(y), b.GetRow(y), output.GetRow(y), width);
+                    break;
+                case MaskOperation::Xor:
+                    BitwiseXor(a.GetRow(y), b.GetRow(y), output.GetRow(y), width);
+                    break;
+                }
+            }
+        });
+        return output;
+    }
+
+    size_t CountMaskPixels(const Nodes::BitMask &mask)
+    {
+        const auto width = static_cast<size_t>(mask.GetWordsPerRow());
+        size_t count = 0;
+        for (int y = 0; y < mask.GetSize().height; ++y)
+        {
+            count += PopCount(mask.GetRow(y), width);
+        }
+        return count;
+    }
+
+    Nodes::BitMask ErodeMask(const Nodes::BitMask &mask, std::span<const MaskRectangle> rectangles)
+    {
+        return ElementWindow(mask, rectangles, true);
+    }
+
+    Nodes::BitMask DilateMask(const Nodes::BitMask &mask, std::span<const MaskRectangle> rectangles)
+    {
+        return ElementWindow(mask, rectangles, false);
+    }
+
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Nodes/Core/BitMask.h"
+
+#include <cstddef>
+#include <span>
+
+namespace VisionCraft::Vision::Kernels
+{
+    /**
+     * @brief Word-wise combination of two masks.
+     */
+    enum class MaskOperation
+    {
+        And, ///< Pixels set in both
+        Or,  ///< Pixels set in either
+        Xor  ///< Pixels set in exactly one
+    };
+
+    /**
+     * @brief Rectangle of a structuring element, as inclusive offsets from its anchor.
+     */
+    struct MaskRectangle
+    {
+        int left = 0;   ///< First column offset
+        int right = 0;  ///< Last column offset
+        int top = 0;    ///< First row offset
+        int bottom = 0; ///< Last row offset
+    };
+
+    /**
+     * @brief Combines two masks 64 pixels per word through the SIMD kernels.
+     * @param a First mask
+     * @param b Second mask
+     * @param operation Combination
+     * @return New mask of the same size
+     * @throws std::invalid_argument if the sizes differ
+     */
+    [[nodiscard]] Nodes::BitMask CombineMasks(
+        const Nodes::BitMask &a, const Nodes::BitMask &b, MaskOperation operation);
+
+    /**
+     * @brief Counts the set pixels of a mask.
+     * @param mask Mask
+     * @return Number of set pixels
+     */
+    [[nodiscard]] size_t CountMaskPixels(const Nodes::BitMask &mask);
+
+    /**
+     * @brief Erodes a mask with a structuring element given as a union of rectangles.
+     *
+     * Each rectangle is a horizontal pass of word shifts (log2 of its width of them) and a vertical van
+     * Herk/Gil-Werman pass of whole-row ANDs; the element's result ANDs its rectangles' results. Pixels
+     * outside the mask read as set, as cv::erode's default border does.
+     *
+     * @param mask Mask to erode
+     * @param rectangles Element decomposition (at least one rectangle)
+     * @return Eroded mask of the same size
+     */
+    [[nodiscard]] Nodes::BitMask ErodeMask(const Nodes::BitMask &mask, std::span<const MaskRectangle> rectangles);
+
+    /**
+     * @brief Dilates a mask with a structuring element given as a union of rectangles.
+     * @note The dual of ErodeMask(): shifts and ORs, with pixels outside the mask reading as clear.
+     * @param mask Mask to dilate
+     * @param rectangles Element decomposition (at least one rectangle)
+     * @return Dilated mask of the same size
+     */
+    [[nodiscard]] Nodes::BitMask DilateMask(const Nodes::BitMask &mask, std::span<const MaskRectangle> rectangles);
+
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,162 @@
+#include "Vision/Kernels/CpuFeatures.h"
+#include "Vision/Kernels/KernelTable.h"
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(VISION_CRAFT_KERNELS_X86) && defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace VisionCraft::Vision::Kernels
+{
+    namespace
+    {
+        constexpr int kUndetected = -1;
+
+        std::atomic<int> activeTarget{ kUndetected }; ///< KernelTarget in use, detected on first use
+
+#if defined(VISION_CRAFT_KERNELS_X86)
+        // AVX needs the OS to save the wider registers as well as the CPU to have the instructions
+        bool CpuSupports(KernelTarget target)
+        {
+#if defined(_MSC_VER)
+            int leaf1[4] = {};
+            int leaf7[4] = {};
+            __cpuid(leaf1, 1);
+            __cpuidex(leaf7, 7, 0);
+            const bool osSavesAvx = (leaf1[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            const bool osSavesAvx512 = osSavesAvx && (_xgetbv(0) & 0xE6) == 0xE6;
+            switch (target)
+            {
+            case KernelTarget::Sse42:
+                return (leaf1[2] & (1 << 20)) != 0;
+            case KernelTarget::Avx2:
+                return osSavesAvx && (leaf7[1] & (1 << 5)) != 0;
+            case KernelTarget::Avx512:
+                return osSavesAvx512 && (leaf7[1] & (1 << 16)) != 0 && (leaf7[1] & (1 << 30)) != 0;
+            default:
+                return target == KernelTarget::Scalar;
+            }
+#else
+            __builtin_cpu_init();
+            switch (target)
+            {
+            case KernelTarget::Sse42:
+                return __builtin_cpu_supports("sse4.2");
+            case KernelTarget::Avx2:
+                return __builtin_cpu_supports("avx2");
+            case KernelTarget::Avx512:
+                return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+            default:
+                return target == KernelTarget::Scalar;
+            }
+#endif
+        }
+#else
+        bool CpuSupports(KernelTarget target)
+        {
+#if defined(VISION_CRAFT_KERNELS_NEON)
+            return target == KernelTarget::Scalar || target == KernelTarget::Neon;
+#else
+            return target == KernelTarget::Scalar;
+#endif
+        }
+#endif
+
+        const Detail::KernelTable &TableFor(KernelTarget target)
+        {
+            switch (target)
+            {
+#if defined(VISION_CRAFT_KERNELS_X86)
+            case KernelTarget::Sse42:
+                return Detail::kSse42Kernels;
+            case KernelTarget::Avx2:
+                return Detail::kAvx2Kernels;
+            case KernelTarget::Avx512:
+                return Detail::kAvx512Kernels;
+#elif defined(VISION_CRAFT_KERNELS_NEON)
+            case KernelTarget::Neon:
+                return Detail::kNeonKernels;
+#endif
+            default:
+                return Detail::kScalarKernels;
+            }
+        }
+
+        KernelTarget ActiveTarget()
+        {
+            int target = activeTarget.load(std::memory_order_acquire);
+            if (target == kUndetected) [[unlikely]]
+            {
+                const int best = static_cast<int>(GetSupportedKernelTargets().back());
+                // A SetKernelTarget() racing with detection wins
+                target = activeTarget.compare_exchange_strong(target, best, std::memory_order_acq_rel) ? best : target;
+            }
+            return static_cast<KernelTarget>(target);
+        }
+    } // namespace
+
+    std::vector<KernelTarget> GetSupportedKernelTargets()
+    {
+        static const std::vector<KernelTarget> supported = [] {
+            std::vector<KernelTarget> targets;
+            for (const auto target : { KernelTarget::Scalar,
+                     KernelTarget::Sse42,
+                     KernelTarget::Avx2,
+                     KernelTarget::Avx512,
+                     KernelTarget::Neon })
+            {
+                if (CpuSupports(target))
+                {
+                    targets.push_back(target);
+                }
+            }
+            return targets;
+        }();
+        return supported;
+    }
+
+    KernelTarget GetKernelTarget()
+    {
+        return ActiveTarget();
+    }
+
+    bool SetKernelTarget(KernelTarget target)
+    {
+        const auto supported = GetSupportedKernelTargets();
+        if (std::ranges::find(supported, target) == supported.end())
+        {
+            return false;
+        }
+        activeTarget.store(static_cast<int>(target), std::memory_order_release);
+        return true;
+    }
+
+    std::string_view ToString(KernelTarget target)
+    {
+        switch (target)
+        {
+        case KernelTarget::Scalar:
+            return "Scalar";
+        case KernelTarget::Sse42:
+            return "SSE4.2";
+        case KernelTarget::Avx2:
+            return "AVX2";
+        case KernelTarget::Avx512:
+            return "AVX-512";
+        case KernelTarget::Neon:
+            return "NEON";
+        }
+        return "Unknown";
+    }
+
+    namespace Detail
+    {
+        const KernelTable &ActiveKernels()
+        {
+            return TableFor(ActiveTarget());
+        }
+    } // namespace Detail
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+namespace VisionCraft::Vision::Kernels
+{
+    /**
+     * @brief Instruction sets the kernel library has implementations for.
+     */
+    enum class KernelTarget
+    {
+        Scalar, ///< Portable C++ (the reference implementation)
+        Sse42,  ///< x86-64 SSE4.2
+        Avx2,   ///< x86-64 AVX2
+        Avx512, ///< x86-64 AVX-512 F and BW
+        Neon    ///< AArch64 Advanced SIMD
+    };
+
+    /**
+     * @brief Returns the targets both this build and the running CPU support.
+     * @return Supported targets, slowest (Scalar) first
+     */
+    [[nodiscard]] std::vector<KernelTarget> GetSupportedKernelTargets();
+
+    /**
+     * @brief Returns the target kernels currently run with.
+     *
+     * Defaults to the fastest supported target, detected on first use.
+     *
+     * @return Active target
+     */
+    [[nodiscard]] KernelTarget GetKernelTarget();
+
+    /**
+     * @brief Selects the target kernels run with, e.g. to compare implementations or rule out a faulty one.
+     *
+     * Not meant to be called while kernels are running on other threads: a call in flight may finish on
+     * either target.
+     *
+     * @param target Target to use
+     * @return False (target unchanged) if the build or the CPU does not support target
+     */
+    bool SetKernelTarget(KernelTarget target);
+
+    /**
+     * @brief Returns a target's name.
+     * @param target Target
+     * @return Name, e.g. "AVX2"
+     */
+    [[nodiscard]] std::string_view ToString(KernelTarget target);
+
+} // namespace VisionCraft::Vision::Kernels
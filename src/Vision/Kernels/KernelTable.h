@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Internal to the kernel library. The per-target translation units are compiled with that target's
+// instruction set enabled, so they include nothing beyond this header and their intrinsics: an inline
+// function they instantiate (std::min, say) could otherwise be the copy the linker keeps for the whole
+// program and run AVX-512 code on a CPU without it.
+
+namespace VisionCraft::Vision::Kernels::Detail
+{
+    /**
+     * @brief One target's implementation of every kernel.
+     */
+    struct KernelTable
+    {
+        void (*minimum8u)(const uint8_t *, const uint8_t *, uint8_t *, size_t);
+        void (*minimum16u)(const uint16_t *, const uint16_t *, uint16_t *, size_t);
+        void (*minimum32f)(const float *, const float *, float *, size_t);
+        void (*maximum8u)(const uint8_t *, const uint8_t *, uint8_t *, size_t);
+        void (*maximum16u)(const uint16_t *, const uint16_t *, uint16_t *, size_t);
+        void (*maximum32f)(const float *, const float *, float *, size_t);
+        void (*magnitudeL2)(const float *, const float *, float *, size_t);
+        void (*magnitudeL1)(const float *, const float *, float *, size_t);
+        void (*bitwiseAnd)(const uint64_t *, const uint64_t *, uint64_t *, size_t);
+        void (*bitwiseOr)(const uint64_t *, const uint64_t *, uint64_t *, size_t);
+        void (*bitwiseXor)(const uint64_t *, const uint64_t *, uint64_t *, size_t);
+        size_t (*popCount)(const uint64_t *, size_t);
+    };
+
+    /**
+     * @brief Returns the table of the target selected with SetKernelTarget() (the best supported by default).
+     * @return Kernel table
+     */
+    [[nodiscard]] const KernelTable &ActiveKernels();
+
+    extern const KernelTable kScalarKernels;
+#if defined(VISION_CRAFT_KERNELS_X86)
+    extern const KernelTable kSse42Kernels;
+    extern const KernelTable kAvx2Kernels;
+    extern const KernelTable kAvx512Kernels;
+#elif defined(VISION_CRAFT_KERNELS_NEON)
+    extern const KernelTable kNeonKernels;
+#endif
+} // namespace VisionCraft::Vision::Kernels::Detail
@@ -0,0 +1,65 @@
+#include "Vision/Kernels/Kernels.h"
+#include "Vision/Kernels/KernelTable.h"
+
+namespace VisionCraft::Vision::Kernels
+{
+    void Minimum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().minimum8u(a, b, dst, count);
+    }
+
+    void Minimum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().minimum16u(a, b, dst, count);
+    }
+
+    void Minimum(const float *a, const float *b, float *dst, size_t count)
+    {
+        Detail::ActiveKernels().minimum32f(a, b, dst, count);
+    }
+
+    void Maximum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().maximum8u(a, b, dst, count);
+    }
+
+    void Maximum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().maximum16u(a, b, dst, count);
+    }
+
+    void Maximum(const float *a, const float *b, float *dst, size_t count)
+    {
+        Detail::ActiveKernels().maximum32f(a, b, dst, count);
+    }
+
+    void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+    {
+        Detail::ActiveKernels().magnitudeL2(x, y, dst, count);
+    }
+
+    void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+    {
+        Detail::ActiveKernels().magnitudeL1(x, y, dst, count);
+    }
+
+    void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().bitwiseAnd(a, b, dst, count);
+    }
+
+    void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().bitwiseOr(a, b, dst, count);
+    }
+
+    void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+    {
+        Detail::ActiveKernels().bitwiseXor(a, b, dst, count);
+    }
+
+    size_t PopCount(const uint64_t *words, size_t count)
+    {
+        return Detail::ActiveKernels().popCount(words, count);
+    }
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VisionCraft::Vision::Kernels
+{
+    /**
+     * @brief Element-wise and row kernels shared by nodes that do not go through OpenCV.
+     *
+     * Each kernel is implemented once per KernelTarget and dispatched at runtime (see CpuFeatures.h), so one
+     * binary runs everywhere and still uses AVX-512 where the CPU has it. The functions in
+     * Kernels::Reference are the scalar definitions every target is tested against; targets return
+     * identical results except that float results may differ in the last bits (contracted multiply-adds).
+     * Float inputs must not be NaN.
+     *
+     * Pointers need no particular alignment; outputs may alias an input but must not partially overlap one.
+     */
+
+    /**
+     * @brief dst[i] = min(a[i], b[i]).
+     * @param a First operand
+     * @param b Second operand
+     * @param dst Output
+     * @param count Elements
+     */
+    void Minimum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count);
+    void Minimum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count);
+    void Minimum(const float *a, const float *b, float *dst, size_t count);
+
+    /**
+     * @brief dst[i] = max(a[i], b[i]).
+     * @param a First operand
+     * @param b Second operand
+     * @param dst Output
+     * @param count Elements
+     */
+    void Maximum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count);
+    void Maximum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count);
+    void Maximum(const float *a, const float *b, float *dst, size_t count);
+
+    /**
+     * @brief dst[i] = sqrt(x[i]^2 + y[i]^2).
+     * @param x First components
+     * @param y Second components
+     * @param dst Output
+     * @param count Elements
+     */
+    void MagnitudeL2(const float *x, const float *y, float *dst, size_t count);
+
+    /**
+     * @brief dst[i] = |x[i]| + |y[i]|.
+     * @param x First components
+     * @param y Second components
+     * @param dst Output
+     * @param count Elements
+     */
+    void MagnitudeL1(const float *x, const float *y, float *dst, size_t count);
+
+    /**
+     * @brief dst[i] = a[i] & b[i] over 64-bit mask words (rows of Nodes::BitMask).
+     * @param a First operand
+     * @param b Second operand
+     * @param dst Output
+     * @param count Words
+     */
+    void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+
+    /**
+     * @brief dst[i] = a[i] | b[i] over 64-bit mask words.
+     * @param a First operand
+     * @param b Second operand
+     * @param dst Output
+     * @param count Words
+     */
+    void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+
+    /**
+     * @brief dst[i] = a[i] ^ b[i] over 64-bit mask words.
+     * @param a First operand
+     * @param b Second operand
+     * @param dst Output
+     * @param count Words
+     */
+    void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+
+    /**
+     * @brief Returns the number of set bits in a run of words.
+     * @param words Words
+     * @param count Words
+     * @return Set bit count
+     */
+    [[nodiscard]] size_t PopCount(const uint64_t *words, size_t count);
+
+    /**
+     * @brief Scalar definitions of the kernels above, used by KernelTarget::Scalar and by tests.
+     */
+    namespace Reference
+    {
+        void Minimum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count);
+        void Minimum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count);
+        void Minimum(const float *a, const float *b, float *dst, size_t count);
+        void Maximum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count);
+        void Maximum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count);
+        void Maximum(const float *a, const float *b, float *dst, size_t count);
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count);
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count);
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count);
+        [[nodiscard]] size_t PopCount(const uint64_t *words, size_t count);
+    } // namespace Reference
+
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,201 @@
+#include "Vision/Kernels/KernelTable.h"
+
+#include <immintrin.h>
+
+// Compiled with AVX2 enabled; see KernelTable.h for what this file may include
+
+namespace VisionCraft::Vision::Kernels::Detail
+{
+    namespace
+    {
+        __m256i Load(const uint8_t *source)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+        }
+
+        __m256i Load(const uint16_t *source)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+        }
+
+        __m256 Load(const float *source)
+        {
+            return _mm256_loadu_ps(source);
+        }
+
+        __m256i Load(const uint64_t *source)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+        }
+
+        void Store(uint8_t *destination, __m256i value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), value);
+        }
+
+        void Store(uint16_t *destination, __m256i value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), value);
+        }
+
+        void Store(float *destination, __m256 value)
+        {
+            _mm256_storeu_ps(destination, value);
+        }
+
+        void Store(uint64_t *destination, __m256i value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), value);
+        }
+
+        // Whole vectors through op, the remaining elements through the scalar kernel
+        template<typename T, typename Op>
+        void Apply(const T *a, const T *b, T *dst, size_t count, Op op, void (*tail)(const T *, const T *, T *, size_t))
+        {
+            constexpr size_t kLanes = sizeof(__m256i) / sizeof(T);
+            size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                Store(dst + i, op(Load(a + i), Load(b + i)));
+            }
+            tail(a + i, b + i, dst + i, count - i);
+        }
+
+        void Minimum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m256i x, __m256i y) { return _mm256_min_epu8(x, y); }, kScalarKernels.minimum8u);
+        }
+
+        void Minimum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m256i x, __m256i y) { return _mm256_min_epu16(x, y); },
+                kScalarKernels.minimum16u);
+        }
+
+        void Minimum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m256 x, __m256 y) { return _mm256_min_ps(x, y); }, kScalarKernels.minimum32f);
+        }
+
+        void Maximum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m256i x, __m256i y) { return _mm256_max_epu8(x, y); }, kScalarKernels.maximum8u);
+        }
+
+        void Maximum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m256i x, __m256i y) { return _mm256_max_epu16(x, y); },
+                kScalarKernels.maximum16u);
+        }
+
+        void Maximum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m256 x, __m256 y) { return _mm256_max_ps(x, y); }, kScalarKernels.maximum32f);
+        }
+
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m256 u, __m256 v) {
+                    return _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(u, u), _mm256_mul_ps(v, v)));
+                },
+                kScalarKernels.magnitudeL2);
+        }
+
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m256 u, __m256 v) {
+                    const __m256 sign = _mm256_set1_ps(-0.0f);
+                    return _mm256_add_ps(_mm256_andnot_ps(sign, u), _mm256_andnot_ps(sign, v));
+                },
+                kScalarKernels.magnitudeL1);
+        }
+
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m256i x, __m256i y) { return _mm256_and_si256(x, y); },
+                kScalarKernels.bitwiseAnd);
+        }
+
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m256i x, __m256i y) { return _mm256_or_si256(x, y); },
+                kScalarKernels.bitwiseOr);
+        }
+
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m256i x, __m256i y) { return _mm256_xor_si256(x, y); },
+                kScalarKernels.bitwiseXor);
+        }
+
+        // Bits per byte from a nibble lookup (VPSHUFB), summed per 64-bit lane by VPSADBW
+        size_t PopCount(const uint64_t *words, size_t count)
+        {
+            const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            __m256i total = _mm256_setzero_si256();
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m256i value = Load(words + i);
+                const __m256i bits = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, _mm256_and_si256(value, nibble)),
+                    _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(value, 4), nibble)));
+                total = _mm256_add_epi64(total, _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+            }
+            const __m128i pairs = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+            const auto lanes = static_cast<uint64_t>(_mm_cvtsi128_si64(pairs) + _mm_extract_epi64(pairs, 1));
+            return static_cast<size_t>(lanes) + kScalarKernels.popCount(words + i, count - i);
+        }
+    } // namespace
+
+    const KernelTable kAvx2Kernels{ .minimum8u = Minimum8u,
+        .minimum16u = Minimum16u,
+        .minimum32f = Minimum32f,
+        .maximum8u = Maximum8u,
+        .maximum16u = Maximum16u,
+        .maximum32f = Maximum32f,
+        .magnitudeL2 = MagnitudeL2,
+        .magnitudeL1 = MagnitudeL1,
+        .bitwiseAnd = BitwiseAnd,
+        .bitwiseOr = BitwiseOr,
+        .bitwiseXor = BitwiseXor,
+        .popCount = PopCount };
+} // namespace VisionCraft::Vision::Kernels::Detail
@@ -0,0 +1,197 @@
+#include "Vision/Kernels/KernelTable.h"
+
+#include <immintrin.h>
+
+// Compiled with AVX-512 F and BW enabled; see KernelTable.h for what this file may include
+
+namespace VisionCraft::Vision::Kernels::Detail
+{
+    namespace
+    {
+        __m512i Load(const uint8_t *source)
+        {
+            return _mm512_loadu_si512(source);
+        }
+
+        __m512i Load(const uint16_t *source)
+        {
+            return _mm512_loadu_si512(source);
+        }
+
+        __m512 Load(const float *source)
+        {
+            return _mm512_loadu_ps(source);
+        }
+
+        __m512i Load(const uint64_t *source)
+        {
+            return _mm512_loadu_si512(source);
+        }
+
+        void Store(uint8_t *destination, __m512i value)
+        {
+            _mm512_storeu_si512(destination, value);
+        }
+
+        void Store(uint16_t *destination, __m512i value)
+        {
+            _mm512_storeu_si512(destination, value);
+        }
+
+        void Store(float *destination, __m512 value)
+        {
+            _mm512_storeu_ps(destination, value);
+        }
+
+        void Store(uint64_t *destination, __m512i value)
+        {
+            _mm512_storeu_si512(destination, value);
+        }
+
+        // Whole vectors through op, the remaining elements through the scalar kernel
+        template<typename T, typename Op>
+        void Apply(const T *a, const T *b, T *dst, size_t count, Op op, void (*tail)(const T *, const T *, T *, size_t))
+        {
+            constexpr size_t kLanes = sizeof(__m512i) / sizeof(T);
+            size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                Store(dst + i, op(Load(a + i), Load(b + i)));
+            }
+            tail(a + i, b + i, dst + i, count - i);
+        }
+
+        void Minimum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m512i x, __m512i y) { return _mm512_min_epu8(x, y); }, kScalarKernels.minimum8u);
+        }
+
+        void Minimum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m512i x, __m512i y) { return _mm512_min_epu16(x, y); },
+                kScalarKernels.minimum16u);
+        }
+
+        void Minimum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m512 x, __m512 y) { return _mm512_min_ps(x, y); }, kScalarKernels.minimum32f);
+        }
+
+        void Maximum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m512i x, __m512i y) { return _mm512_max_epu8(x, y); }, kScalarKernels.maximum8u);
+        }
+
+        void Maximum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m512i x, __m512i y) { return _mm512_max_epu16(x, y); },
+                kScalarKernels.maximum16u);
+        }
+
+        void Maximum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m512 x, __m512 y) { return _mm512_max_ps(x, y); }, kScalarKernels.maximum32f);
+        }
+
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m512 u, __m512 v) {
+                    return _mm512_sqrt_ps(_mm512_add_ps(_mm512_mul_ps(u, u), _mm512_mul_ps(v, v)));
+                },
+                kScalarKernels.magnitudeL2);
+        }
+
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m512 u, __m512 v) { return _mm512_add_ps(_mm512_abs_ps(u), _mm512_abs_ps(v)); },
+                kScalarKernels.magnitudeL1);
+        }
+
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m512i x, __m512i y) { return _mm512_and_si512(x, y); },
+                kScalarKernels.bitwiseAnd);
+        }
+
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m512i x, __m512i y) { return _mm512_or_si512(x, y); },
+                kScalarKernels.bitwiseOr);
+        }
+
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m512i x, __m512i y) { return _mm512_xor_si512(x, y); },
+                kScalarKernels.bitwiseXor);
+        }
+
+        // Bits per byte from a nibble lookup (VPSHUFB, as VPOPCNTQ needs a newer extension), summed by VPSADBW
+        size_t PopCount(const uint64_t *words, size_t count)
+        {
+            const __m512i lookup =
+                _mm512_broadcast_i32x4(_mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+            const __m512i nibble = _mm512_set1_epi8(0x0F);
+            __m512i total = _mm512_setzero_si512();
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m512i value = Load(words + i);
+                const __m512i bits = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, _mm512_and_si512(value, nibble)),
+                    _mm512_shuffle_epi8(lookup, _mm512_and_si512(_mm512_srli_epi16(value, 4), nibble)));
+                total = _mm512_add_epi64(total, _mm512_sad_epu8(bits, _mm512_setzero_si512()));
+            }
+            const auto lanes = static_cast<uint64_t>(_mm512_reduce_add_epi64(total));
+            return static_cast<size_t>(lanes) + kScalarKernels.popCount(words + i, count - i);
+        }
+    } // namespace
+
+    const KernelTable kAvx512Kernels{ .minimum8u = Minimum8u,
+        .minimum16u = Minimum16u,
+        .minimum32f = Minimum32f,
+        .maximum8u = Maximum8u,
+        .maximum16u = Maximum16u,
+        .maximum32f = Maximum32f,
+        .magnitudeL2 = MagnitudeL2,
+        .magnitudeL1 = MagnitudeL1,
+        .bitwiseAnd = BitwiseAnd,
+        .bitwiseOr = BitwiseOr,
+        .bitwiseXor = BitwiseXor,
+        .popCount = PopCount };
+} // namespace VisionCraft::Vision::Kernels::Detail
@@ -0,0 +1,210 @@
+#include "Vision/Kernels/KernelTable.h"
+
+#include <arm_neon.h>
+
+// Advanced SIMD is part of the AArch64 baseline; see KernelTable.h for what this file may include
+
+namespace VisionCraft::Vision::Kernels::Detail
+{
+    namespace
+    {
+        uint8x16_t Load(const uint8_t *source)
+        {
+            return vld1q_u8(source);
+        }
+
+        uint16x8_t Load(const uint16_t *source)
+        {
+            return vld1q_u16(source);
+        }
+
+        float32x4_t Load(const float *source)
+        {
+            return vld1q_f32(source);
+        }
+
+        uint64x2_t Load(const uint64_t *source)
+        {
+            return vld1q_u64(source);
+        }
+
+        void Store(uint8_t *destination, uint8x16_t value)
+        {
+            vst1q_u8(destination, value);
+        }
+
+        void Store(uint16_t *destination, uint16x8_t value)
+        {
+            vst1q_u16(destination, value);
+        }
+
+        void Store(float *destination, float32x4_t value)
+        {
+            vst1q_f32(destination, value);
+        }
+
+        void Store(uint64_t *destination, uint64x2_t value)
+        {
+            vst1q_u64(destination, value);
+        }
+
+        // Whole vectors through op, the remaining elements through the scalar kernel
+        template<typename T, typename Op>
+        void Apply(const T *a, const T *b, T *dst, size_t count, Op op, void (*tail)(const T *, const T *, T *, size_t))
+        {
+            constexpr size_t kLanes = sizeof(uint8x16_t) / sizeof(T);
+            size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                Store(dst + i, op(Load(a + i), Load(b + i)));
+            }
+            tail(a + i, b + i, dst + i, count - i);
+        }
+
+        void Minimum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint8x16_t x, uint8x16_t y) { return vminq_u8(x, y); },
+                kScalarKernels.minimum8u);
+        }
+
+        void Minimum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint16x8_t x, uint16x8_t y) { return vminq_u16(x, y); },
+                kScalarKernels.minimum16u);
+        }
+
+        void Minimum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](float32x4_t x, float32x4_t y) { return vminq_f32(x, y); },
+                kScalarKernels.minimum32f);
+        }
+
+        void Maximum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint8x16_t x, uint8x16_t y) { return vmaxq_u8(x, y); },
+                kScalarKernels.maximum8u);
+        }
+
+        void Maximum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint16x8_t x, uint16x8_t y) { return vmaxq_u16(x, y); },
+                kScalarKernels.maximum16u);
+        }
+
+        void Maximum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](float32x4_t x, float32x4_t y) { return vmaxq_f32(x, y); },
+                kScalarKernels.maximum32f);
+        }
+
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](float32x4_t u, float32x4_t v) { return vsqrtq_f32(vaddq_f32(vmulq_f32(u, u), vmulq_f32(v, v))); },
+                kScalarKernels.magnitudeL2);
+        }
+
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](float32x4_t u, float32x4_t v) { return vaddq_f32(vabsq_f32(u), vabsq_f32(v)); },
+                kScalarKernels.magnitudeL1);
+        }
+
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint64x2_t x, uint64x2_t y) { return vandq_u64(x, y); },
+                kScalarKernels.bitwiseAnd);
+        }
+
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint64x2_t x, uint64x2_t y) { return vorrq_u64(x, y); },
+                kScalarKernels.bitwiseOr);
+        }
+
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](uint64x2_t x, uint64x2_t y) { return veorq_u64(x, y); },
+                kScalarKernels.bitwiseXor);
+        }
+
+        // Bits per byte (CNT), summed across the vector (UADDLV)
+        size_t PopCount(const uint64_t *words, size_t count)
+        {
+            size_t total = 0;
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+            {
+                total += vaddlvq_u8(vcntq_u8(vreinterpretq_u8_u64(Load(words + i))));
+            }
+            return total + kScalarKernels.popCount(words + i, count - i);
+        }
+    } // namespace
+
+    const KernelTable kNeonKernels{ .minimum8u = Minimum8u,
+        .minimum16u = Minimum16u,
+        .minimum32f = Minimum32f,
+        .maximum8u = Maximum8u,
+        .maximum16u = Maximum16u,
+        .maximum32f = Maximum32f,
+        .magnitudeL2 = MagnitudeL2,
+        .magnitudeL1 = MagnitudeL1,
+        .bitwiseAnd = BitwiseAnd,
+        .bitwiseOr = BitwiseOr,
+        .bitwiseXor = BitwiseXor,
+        .popCount = PopCount };
+} // namespace VisionCraft::Vision::Kernels::Detail
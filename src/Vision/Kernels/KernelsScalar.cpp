@@ -0,0 +1,126 @@
+#include "Vision/Kernels/KernelTable.h"
+#include "Vision/Kernels/Kernels.h"
+
+#include <bit>
+#include <cmath>
+
+namespace VisionCraft::Vision::Kernels
+{
+    namespace
+    {
+        template<typename T> void MinimumLoop(const T *a, const T *b, T *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = b[i] < a[i] ? b[i] : a[i];
+            }
+        }
+
+        template<typename T> void MaximumLoop(const T *a, const T *b, T *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = a[i] < b[i] ? b[i] : a[i];
+            }
+        }
+    } // namespace
+
+    namespace Reference
+    {
+        void Minimum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            MinimumLoop(a, b, dst, count);
+        }
+
+        void Minimum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            MinimumLoop(a, b, dst, count);
+        }
+
+        void Minimum(const float *a, const float *b, float *dst, size_t count)
+        {
+            MinimumLoop(a, b, dst, count);
+        }
+
+        void Maximum(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            MaximumLoop(a, b, dst, count);
+        }
+
+        void Maximum(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            MaximumLoop(a, b, dst, count);
+        }
+
+        void Maximum(const float *a, const float *b, float *dst, size_t count)
+        {
+            MaximumLoop(a, b, dst, count);
+        }
+
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+            }
+        }
+
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = std::abs(x[i]) + std::abs(y[i]);
+            }
+        }
+
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = a[i] & b[i];
+            }
+        }
+
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = a[i] | b[i];
+            }
+        }
+
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                dst[i] = a[i] ^ b[i];
+            }
+        }
+
+        size_t PopCount(const uint64_t *words, size_t count)
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                total += static_cast<size_t>(std::popcount(words[i]));
+            }
+            return total;
+        }
+    } // namespace Reference
+
+    namespace Detail
+    {
+        const KernelTable kScalarKernels{ .minimum8u = Reference::Minimum,
+            .minimum16u = Reference::Minimum,
+            .minimum32f = Reference::Minimum,
+            .maximum8u = Reference::Maximum,
+            .maximum16u = Reference::Maximum,
+            .maximum32f = Reference::Maximum,
+            .magnitudeL2 = Reference::MagnitudeL2,
+            .magnitudeL1 = Reference::MagnitudeL1,
+            .bitwiseAnd = Reference::BitwiseAnd,
+            .bitwiseOr = Reference::BitwiseOr,
+            .bitwiseXor = Reference::BitwiseXor,
+            .popCount = Reference::PopCount };
+    } // namespace Detail
+} // namespace VisionCraft::Vision::Kernels
@@ -0,0 +1,179 @@
+#include "Vision/Kernels/KernelTable.h"
+
+#include <nmmintrin.h>
+
+// Compiled with SSE4.2 enabled; see KernelTable.h for what this file may include
+
+namespace VisionCraft::Vision::Kernels::Detail
+{
+    namespace
+    {
+        __m128i Load(const uint8_t *source)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        }
+
+        __m128i Load(const uint16_t *source)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        }
+
+        __m128 Load(const float *source)
+        {
+            return _mm_loadu_ps(source);
+        }
+
+        __m128i Load(const uint64_t *source)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+        }
+
+        void Store(uint8_t *destination, __m128i value)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), value);
+        }
+
+        void Store(uint16_t *destination, __m128i value)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), value);
+        }
+
+        void Store(float *destination, __m128 value)
+        {
+            _mm_storeu_ps(destination, value);
+        }
+
+        void Store(uint64_t *destination, __m128i value)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), value);
+        }
+
+        // Whole vectors through op, the remaining elements through the scalar kernel
+        template<typename T, typename Op>
+        void Apply(const T *a, const T *b, T *dst, size_t count, Op op, void (*tail)(const T *, const T *, T *, size_t))
+        {
+            constexpr size_t kLanes = sizeof(__m128i) / sizeof(T);
+            size_t i = 0;
+            for (; i + kLanes <= count; i += kLanes)
+            {
+                Store(dst + i, op(Load(a + i), Load(b + i)));
+            }
+            tail(a + i, b + i, dst + i, count - i);
+        }
+
+        void Minimum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m128i x, __m128i y) { return _mm_min_epu8(x, y); }, kScalarKernels.minimum8u);
+        }
+
+        void Minimum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m128i x, __m128i y) { return _mm_min_epu16(x, y); }, kScalarKernels.minimum16u);
+        }
+
+        void Minimum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m128 x, __m128 y) { return _mm_min_ps(x, y); }, kScalarKernels.minimum32f);
+        }
+
+        void Maximum8u(const uint8_t *a, const uint8_t *b, uint8_t *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m128i x, __m128i y) { return _mm_max_epu8(x, y); }, kScalarKernels.maximum8u);
+        }
+
+        void Maximum16u(const uint16_t *a, const uint16_t *b, uint16_t *dst, size_t count)
+        {
+            Apply(
+                a, b, dst, count, [](__m128i x, __m128i y) { return _mm_max_epu16(x, y); }, kScalarKernels.maximum16u);
+        }
+
+        void Maximum32f(const float *a, const float *b, float *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m128 x, __m128 y) { return _mm_max_ps(x, y); }, kScalarKernels.maximum32f);
+        }
+
+        void MagnitudeL2(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m128 u, __m128 v) { return _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(u, u), _mm_mul_ps(v, v))); },
+                kScalarKernels.magnitudeL2);
+        }
+
+        void MagnitudeL1(const float *x, const float *y, float *dst, size_t count)
+        {
+            Apply(
+                x,
+                y,
+                dst,
+                count,
+                [](__m128 u, __m128 v) {
+                    const __m128 sign = _mm_set1_ps(-0.0f);
+                    return _mm_add_ps(_mm_andnot_ps(sign, u), _mm_andnot_ps(sign, v));
+                },
+                kScalarKernels.magnitudeL1);
+        }
+
+        void BitwiseAnd(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m128i x, __m128i y) { return _mm_and_si128(x, y); },
+                kScalarKernels.bitwiseAnd);
+        }
+
+        void BitwiseOr(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(a, b, dst, count, [](__m128i x, __m128i y) { return _mm_or_si128(x, y); }, kScalarKernels.bitwiseOr);
+        }
+
+        void BitwiseXor(const uint64_t *a, const uint64_t *b, uint64_t *dst, size_t count)
+        {
+            Apply(
+                a,
+                b,
+                dst,
+                count,
+                [](__m128i x, __m128i y) { return _mm_xor_si128(x, y); },
+                kScalarKernels.bitwiseXor);
+        }
+
+        // Bits per byte from a nibble lookup (PSHUFB), summed per 64-bit lane by PSADBW
+        size_t PopCount(const uint64_t *words, size_t count)
+        {
+            const __m128i lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            __m128i total = _mm_setzero_si128();
+            size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+            {
+                const __m128i value = Load(words + i);
+                const __m128i bits = _mm_add_epi8(_mm_shuffle_epi8(lookup, _mm_and_si128(value, nibble)),
+                    _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(value, 4), nibble)));
+                total = _mm_add_epi64(total, _mm_sad_epu8(bits, _mm_setzero_si128()));
+            }
+            const auto lanes = static_cast<uint64_t>(_mm_cvtsi128_si64(total) + _mm_extract_epi64(total, 1));
+            return static_cast<size_t>(lanes) + kScalarKernels.popCount(words + i, count - i);
+        }
+    } // namespace
+
+    const KernelTable kSse42Kernels{ .minimum8u = Minimum8u,
+        .minimum16u = Minimum16u,
+        .minimum32f = Minimum32f,
+        .maximum8u = Maximum8u,
+        .maximum16u = Maximum16u,
+        .maximum32f = Maximum32f,
+        .magnitudeL2 = MagnitudeL2,
+        .magnitudeL1 = MagnitudeL1,
+        .bitwiseAnd = BitwiseAnd,
+        .bitwiseOr = BitwiseOr,
+        .bitwiseXor = BitwiseXor,
+        .popCount = PopCount };
+} // namespace VisionCraft::Vision::Kernels::Detail
@@ -0,0 +1,183 @@
+#include "Nodes/Core/AsyncLogger.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Collects messages delivered on the sink thread
+    class CapturingSink
+    {
+    public:
+        void Capture(Nodes::LogLevel level, std::string_view message)
+        {
+            std::scoped_lock lock(mutex);
+            levels.push_back(level);
+            messages.emplace_back(message);
+        }
+
+        std::vector<std::string> GetMessages() const
+        {
+            std::scoped_lock lock(mutex);
+            return messages;
+        }
+
+        std::vector<Nodes::LogLevel> GetLevels() const
+        {
+            std::scoped_lock lock(mutex);
+            return levels;
+        }
+
+    private:
+        mutable std::mutex mutex;
+        std::vector<std::string> messages;
+        std::vector<Nodes::LogLevel> levels;
+    };
+} // namespace
+
+class AsyncLoggerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        logger.Flush();
+        logger.SetSink([this](Nodes::LogLevel level, std::string_view message) { sink.Capture(level, message); });
+    }
+
+    void TearDown() override
+    {
+        logger.Flush();
+        logger.SetSink(nullptr);
+    }
+
+    Nodes::AsyncLogger &logger = Nodes::AsyncLogger::Get();
+    CapturingSink sink;
+};
+
+TEST_F(AsyncLoggerTest, DeliversFormattedMessagesInOrder)
+{
+    EXPECT_TRUE(logger.Log(Nodes::LogLevel::Info, "Processing node: {} (ID: {})", "Blur", 3));
+    EXPECT_TRUE(logger.Log(Nodes::LogLevel::Warn, "Invalid ksize ({})", 4));
+    logger.Flush();
+
+    EXPECT_EQ(sink.GetMessages(), (std::vector<std::string>{ "Processing node: Blur (ID: 3)", "Invalid ksize (4)" }));
+    EXPECT_EQ(sink.GetLevels(), (std::vector{ Nodes::LogLevel::Info, Nodes::LogLevel::Warn }));
+}
+
+TEST_F(AsyncLoggerTest, TruncatesLongMessages)
+{
+    const std::string longText(Constants::Logging::kMaxMessageLength * 2, 'x');
+    logger.Log(Nodes::LogLevel::Info, "{}", longText);
+    logger.Flush();
+
+    const auto messages = sink.GetMessages();
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0].size(), Constants::Logging::kMaxMessageLength);
+}
+
+TEST_F(AsyncLoggerTest, KeepsEveryMessageFromConcurrentProducers)
+{
+    constexpr int kThreads = 4;
+    constexpr int kMessagesPerThread = 1000;
+    {
+        std::vector<std::jthread> producers;
+        for (int t = 0; t < kThreads; ++t)
+        {
+            producers.emplace_back([this, t]() {
+                for (int i = 0; i < kMessagesPerThread; ++i)
+                {
+                    // The sink keeps up with this rate, but retry rather than depend on scheduling
+                    while (!logger.Log(Nodes::LogLevel::Debug, "{} {}", t, i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+    }
+    logger.Flush();
+
+    // Each producer's messages arrive complete and in its own order
+    std::vector<int> nextIndex(kThreads, 0);
+    size_t dataMessages = 0;
+    for (const auto &message : sink.GetMessages())
+    {
+        int thread = 0;
+        int index = 0;
+        if (std::sscanf(message.c_str(), "%d %d", &thread, &index) != 2)
+        {
+            continue; // Drop reports
+        }
+        ASSERT_EQ(index, nextIndex[static_cast<size_t>(thread)]++) << message;
+        ++dataMessages;
+    }
+    EXPECT_EQ(dataMessages, static_cast<size_t>(kThreads * kMessagesPerThread));
+}
+
+TEST_F(AsyncLoggerTest, DropsInsteadOfBlockingWhenFull)
+{
+    std::mutex gateMutex;
+    std::condition_variable gateOpened;
+    bool open = false;
+    logger.SetSink([&](Nodes::LogLevel level, std::string_view message) {
+        std::unique_lock lock(gateMutex);
+        gateOpened.wait(lock, [&] { return open; });
+        sink.Capture(level, message);
+    });
+
+    const uint64_t droppedBefore = logger.GetDroppedCount();
+    size_t rejected = 0;
+    for (size_t i = 0; i < Constants::Logging::kAsyncQueueCapacity + 10; ++i)
+    {
+        rejected += logger.Log(Nodes::LogLevel::Info, "message {}", i) ? 0 : 1;
+    }
+    EXPECT_GE(rejected, 9);
+    EXPECT_EQ(logger.GetDroppedCount() - droppedBefore, rejected);
+
+    {
+        std::scoped_lock lock(gateMutex);
+        open = true;
+    }
+    gateOpened.notify_all();
+    logger.Flush();
+    EXPECT_TRUE(logger.Log(Nodes::LogLevel::Info, "after"));
+    logger.Flush();
+
+    const auto messages = sink.GetMessages();
+    EXPECT_EQ(messages.back(), "after");
+    EXPECT_NE(std::find(messages.begin(), messages.end(),
+                  "Async log buffer full, dropped " + std::to_string(rejected) + " messages"),
+        messages.end());
+}
+
+TEST_F(AsyncLoggerTest, MacrosBelowCompiledLevelDoNotEvaluateArguments)
+{
+    int evaluations = 0;
+    [[maybe_unused]] auto countEvaluation = [&evaluations]() { return ++evaluations; };
+
+    LOG_HOT_DEBUG("debug {}", countEvaluation());
+    LOG_HOT_INFO("info {}", countEvaluation());
+    LOG_HOT_WARN("warn {}", countEvaluation());
+    logger.Flush();
+
+    int expected = 0;
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_DEBUG
+    ++expected;
+#endif
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_INFO
+    ++expected;
+#endif
+#if VISION_CRAFT_HOT_LOG_LEVEL <= VISION_CRAFT_LOG_LEVEL_WARN
+    ++expected;
+#endif
+    EXPECT_EQ(evaluations, expected);
+    EXPECT_EQ(sink.GetMessages().size(), static_cast<size_t>(expected));
+}
@@ -0,0 +1,68 @@
+#include "UI/Layers/AutoRunScheduler.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+
+using namespace VisionCraft;
+using UI::Layers::AutoRunScheduler;
+using RunningExecution = AutoRunScheduler::RunningExecution;
+
+namespace
+{
+    constexpr auto kDelay = std::chrono::milliseconds(250);
+
+    AutoRunScheduler EnabledScheduler()
+    {
+        AutoRunScheduler scheduler(kDelay);
+        scheduler.SetEnabled(true);
+        return scheduler;
+    }
+} // namespace
+
+TEST(AutoRunSchedulerTest, EachEditPushesTheRunBack)
+{
+    auto scheduler = EnabledScheduler();
+    const auto start = AutoRunScheduler::Clock::now();
+
+    EXPECT_FALSE(scheduler.ScheduleAfterEdit(start, RunningExecution::None));
+    EXPECT_EQ(scheduler.GetDueTime(), start + kDelay);
+
+    // A second edit before the first run is due restarts the full delay
+    const auto secondEdit = start + kDelay / 2;
+    EXPECT_FALSE(scheduler.ScheduleAfterEdit(secondEdit, RunningExecution::None));
+    EXPECT_EQ(scheduler.GetDueTime(), secondEdit + kDelay);
+    EXPECT_FALSE(scheduler.TakeDueRun(start + kDelay, false));
+    EXPECT_TRUE(scheduler.IsPending());
+}
+
+TEST(AutoRunSchedulerTest, CancelsGraphRunsButNotBatches)
+{
+    auto scheduler = EnabledScheduler();
+    const auto now = AutoRunScheduler::Clock::now();
+
+    EXPECT_TRUE(scheduler.ScheduleAfterEdit(now, RunningExecution::Graph));
+    EXPECT_FALSE(scheduler.ScheduleAfterEdit(now, RunningExecution::Batch));
+    EXPECT_FALSE(scheduler.ScheduleAfterEdit(now, RunningExecution::None));
+    EXPECT_TRUE(scheduler.IsPending()); // A batch still gets its run once it finishes
+
+    // Disabled, edits neither schedule nor cancel
+    scheduler.SetEnabled(false);
+    EXPECT_FALSE(scheduler.IsPending());
+    EXPECT_FALSE(scheduler.ScheduleAfterEdit(now, RunningExecution::Graph));
+    EXPECT_FALSE(scheduler.IsPending());
+}
+
+TEST(AutoRunSchedulerTest, StartsOnceDueAndIdle)
+{
+    auto scheduler = EnabledScheduler();
+    const auto edit = AutoRunScheduler::Clock::now();
+    EXPECT_FALSE(scheduler.TakeDueRun(edit + kDelay, false)); // Nothing scheduled
+
+    (void)scheduler.ScheduleAfterEdit(edit, RunningExecution::None);
+    EXPECT_FALSE(scheduler.TakeDueRun(edit + kDelay / 2, false)); // Not due yet
+    EXPECT_FALSE(scheduler.TakeDueRun(edit + kDelay, true));      // Due, but an execution is running
+
+    EXPECT_TRUE(scheduler.TakeDueRun(edit + kDelay * 2, false));
+    EXPECT_FALSE(scheduler.IsPending());
+    EXPECT_FALSE(scheduler.TakeDueRun(edit + kDelay * 3, false)); // One run per burst of edits
+}
@@ -0,0 +1,181 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/ThreadBudget.h"
+#include "Vision/IO/Autotuner.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/core.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Runs fast only with a single OpenCV thread, standing in for a kernel that scales badly on this machine
+    class SingleThreadFavoringNode : public Nodes::Node
+    {
+    public:
+        explicit SingleThreadFavoringNode(Nodes::NodeId id) : Nodes::Node(id, "SingleThreadFavoring")
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SingleThreadFavoringNode";
+        }
+
+        void Process() override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(cv::getNumThreads() == 1 ? 1 : 15));
+            SetOutputSlotData("Output", 1.0);
+        }
+    };
+} // namespace
+
+class AutotunerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "visioncraft_autotuner_test";
+        std::filesystem::remove_all(directory);
+        Nodes::ThreadBudget::Get().SetMaxCores(4);
+        editor.AddNode(std::make_unique<SingleThreadFavoringNode>(1));
+    }
+
+    void TearDown() override
+    {
+        // The budget is process-wide; leave it unlimited for other tests
+        Nodes::ThreadBudget::Get().SetMaxCores(0);
+        Nodes::ThreadBudget::Get().SetMaxOpenCvThreads(0);
+        std::filesystem::remove_all(directory);
+    }
+
+    Nodes::NodeEditor editor;
+    std::filesystem::path directory;
+};
+
+TEST_F(AutotunerTest, ProfileRoundTrips)
+{
+    Vision::IO::TuningProfile profile;
+    profile.workerCount = 6;
+    profile.openCvThreads = 2;
+    profile.tiling = { .enabled = true, .tileSize = 1024, .minImagePixels = 1000, .fusePointwise = false };
+    profile.deviceExecution = true;
+    profile.hostOnlyNodeTypes = { "CannyEdgeNode", "GaussianBlurNode" };
+    profile.hardwareThreads = std::thread::hardware_concurrency();
+    profile.graphName = "graph.json";
+    profile.baselineTime = std::chrono::microseconds{ 900 };
+    profile.tunedTime = std::chrono::microseconds{ 400 };
+
+    std::string error;
+    const auto path = directory / "nested" / "tuning.json";
+    ASSERT_TRUE(Vision::IO::Autotuner::SaveProfile(profile, path, error)) << error;
+
+    const auto loaded = Vision::IO::Autotuner::LoadProfile(path, error);
+    ASSERT_TRUE(loaded.has_value()) << error;
+    EXPECT_EQ(loaded->workerCount, 6u);
+    EXPECT_EQ(loaded->openCvThreads, 2u);
+    EXPECT_EQ(loaded->tiling, profile.tiling);
+    EXPECT_TRUE(loaded->deviceExecution);
+    EXPECT_EQ(loaded->hostOnlyNodeTypes, profile.hostOnlyNodeTypes);
+    EXPECT_EQ(loaded->graphName, "graph.json");
+    EXPECT_EQ(loaded->baselineTime.count(), 900);
+    EXPECT_EQ(loaded->tunedTime.count(), 400);
+}
+
+TEST_F(AutotunerTest, RejectsFilesThatAreNotProfiles)
+{
+    std::string error;
+    EXPECT_FALSE(Vision::IO::Autotuner::LoadProfile(directory / "missing.json", error).has_value());
+    EXPECT_FALSE(error.empty());
+
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "other.json") << R"({ "version": 1, "workerCount": "many" })";
+    error.clear();
+    EXPECT_FALSE(Vision::IO::Autotuner::LoadProfile(directory / "other.json", error).has_value());
+    EXPECT_FALSE(error.empty());
+
+    std::ofstream(directory / "recording.json") << R"({ "nodes": [] })";
+    EXPECT_FALSE(Vision::IO::Autotuner::LoadProfile(directory / "recording.json", error).has_value());
+}
+
+TEST_F(AutotunerTest, ApplyConfiguresEditorAndBudget)
+{
+    Vision::IO::TuningProfile profile;
+    profile.workerCount = 3;
+    profile.openCvThreads = 2;
+    profile.tiling.enabled = true;
+    profile.tiling.tileSize = 256;
+    profile.hostOnlyNodeTypes = { "SingleThreadFavoringNode" };
+    Vision::IO::Autotuner::Apply(profile, editor);
+
+    EXPECT_EQ(editor.GetExecutorService().GetWorkerCount(), 3u);
+    EXPECT_EQ(Nodes::ThreadBudget::Get().GetMaxOpenCvThreads(), 2u);
+    EXPECT_EQ(editor.GetTilingOptions(), profile.tiling);
+    EXPECT_EQ(editor.GetHostOnlyNodeTypes(), profile.hostOnlyNodeTypes);
+
+    const auto captured = Vision::IO::Autotuner::Capture(editor);
+    EXPECT_EQ(captured.workerCount, 3u);
+    EXPECT_EQ(captured.openCvThreads, 2u);
+    EXPECT_EQ(captured.tiling, profile.tiling);
+}
+
+TEST_F(AutotunerTest, KeepsTheFasterSettingApplied)
+{
+    size_t progressCalls = 0;
+    std::string error;
+    const auto profile = Vision::IO::Autotuner::Tune(
+        editor, { .runs = 1 }, error, [&](size_t done, size_t planned, const std::string &) {
+            EXPECT_LT(done, planned);
+            ++progressCalls;
+        });
+    ASSERT_TRUE(profile.has_value()) << error;
+
+    EXPECT_EQ(profile->openCvThreads, 1u);
+    EXPECT_LT(profile->tunedTime, profile->baselineTime);
+    EXPECT_GT(progressCalls, 1u);
+    EXPECT_EQ(Nodes::ThreadBudget::Get().GetMaxOpenCvThreads(), 1u);
+    EXPECT_TRUE(editor.IsOutputCacheEnabled());
+}
+
+TEST_F(AutotunerTest, StoppedTuningRestoresSettings)
+{
+    const Nodes::TilingOptions tiling{ .enabled = true, .tileSize = 128 };
+    editor.SetTilingOptions(tiling);
+    std::stop_source stopSource;
+    stopSource.request_stop();
+
+    std::string error;
+    EXPECT_FALSE(Vision::IO::Autotuner::Tune(editor, {}, error, {}, stopSource.get_token()).has_value());
+    EXPECT_FALSE(error.empty());
+    EXPECT_EQ(editor.GetTilingOptions(), tiling);
+    EXPECT_EQ(Nodes::ThreadBudget::Get().GetMaxOpenCvThreads(), 0u);
+    EXPECT_TRUE(editor.IsOutputCacheEnabled());
+}
+
+#if !defined(_WIN32)
+TEST_F(AutotunerTest, DefaultProfileFollowsXdgConfigHome)
+{
+    const char *previous = std::getenv("XDG_CONFIG_HOME");
+    const std::string saved = previous ? previous : "";
+    setenv("XDG_CONFIG_HOME", directory.c_str(), 1);
+    EXPECT_EQ(Vision::IO::Autotuner::GetDefaultProfilePath(), directory / "visioncraft" / "tuning.json");
+
+    if (previous)
+    {
+        setenv("XDG_CONFIG_HOME", saved.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("XDG_CONFIG_HOME");
+    }
+}
+#endif
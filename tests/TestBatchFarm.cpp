@@ -0,0 +1,156 @@
+#include "Vision/Factory/NodeFactory.h"
+#include "Vision/IO/BatchFarm.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace VisionCraft;
+
+class BatchFarmTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Workers load the job's graph file, so its nodes must come from the factory
+        Vision::NodeFactory::RegisterAllNodes();
+
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_farm_test";
+        std::filesystem::remove_all(testDir);
+        inputDir = testDir / "in";
+        outputDir = testDir / "out";
+        jobDir = testDir / "job";
+        std::filesystem::create_directories(inputDir);
+
+        editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+        editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(2));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    void WriteImage(const std::filesystem::path &path, int value)
+    {
+        ASSERT_TRUE(cv::imwrite(path.string(), cv::Mat(4, 4, CV_8UC3, cv::Scalar(value, value, value))));
+    }
+
+    Vision::IO::BatchOptions MakeOptions() const
+    {
+        Vision::IO::BatchOptions options;
+        options.inputDirectory = inputDir;
+        options.outputDirectory = outputDir;
+        options.outputFormat = "png";
+        return options;
+    }
+
+    // Short intervals keep the tests fast; the lease still spans many heartbeats
+    static Vision::IO::FarmOptions MakeFarmOptions()
+    {
+        Vision::IO::FarmOptions options;
+        options.shardFiles = 2;
+        options.ioWorkers = 1;
+        options.leaseTimeout = std::chrono::milliseconds(300);
+        options.heartbeatInterval = std::chrono::milliseconds(10);
+        options.pollInterval = std::chrono::milliseconds(10);
+        return options;
+    }
+
+    std::filesystem::path testDir;
+    std::filesystem::path inputDir;
+    std::filesystem::path outputDir;
+    std::filesystem::path jobDir;
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(BatchFarmTest, WorkersShareEveryShard)
+{
+    for (int i = 0; i < 7; ++i)
+    {
+        WriteImage(inputDir / ("img" + std::to_string(i) + ".png"), i * 10);
+    }
+
+    const auto farmOptions = MakeFarmOptions();
+    ASSERT_TRUE(Vision::IO::BatchFarm::CreateJob(editor, jobDir, MakeOptions(), farmOptions));
+    EXPECT_FALSE(Vision::IO::BatchFarm::CreateJob(editor, jobDir, MakeOptions(), farmOptions));
+
+    std::optional<size_t> firstShards;
+    std::optional<size_t> secondShards;
+    std::thread first([&] {
+        Nodes::NodeEditor worker;
+        firstShards = Vision::IO::BatchFarm::Work(worker, jobDir, "first", farmOptions);
+    });
+    std::thread second([&] {
+        Nodes::NodeEditor worker;
+        secondShards = Vision::IO::BatchFarm::Work(worker, jobDir, "second", farmOptions);
+    });
+    const auto result = Vision::IO::BatchFarm::Coordinate(jobDir, farmOptions);
+    first.join();
+    second.join();
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->total, 7);
+    EXPECT_EQ(result->succeeded, 7);
+    EXPECT_EQ(result->failed, 0);
+    ASSERT_TRUE(firstShards.has_value() && secondShards.has_value());
+    EXPECT_EQ(*firstShards + *secondShards, 4);
+    for (int i = 0; i < 7; ++i)
+    {
+        const auto output = cv::imread((outputDir / ("img" + std::to_string(i) + ".png")).string());
+        ASSERT_FALSE(output.empty());
+        EXPECT_EQ(output.at<cv::Vec3b>(0, 0)[0], i * 10);
+    }
+}
+
+TEST_F(BatchFarmTest, RequeuesShardsOfSilentWorkers)
+{
+    WriteImage(inputDir / "a.png", 1);
+
+    // A worker that claimed the only shard and died before its first heartbeat
+    const auto farmOptions = MakeFarmOptions();
+    ASSERT_TRUE(Vision::IO::BatchFarm::CreateJob(editor, jobDir, MakeOptions(), farmOptions));
+    std::filesystem::rename(jobDir / "pending" / "000000.json", jobDir / "running" / "000000@lost.json");
+
+    std::thread worker([&] {
+        Nodes::NodeEditor workerEditor;
+        EXPECT_EQ(Vision::IO::BatchFarm::Work(workerEditor, jobDir, "survivor", farmOptions), 1);
+    });
+    size_t requeued = 0;
+    const auto result = Vision::IO::BatchFarm::Coordinate(
+        jobDir, farmOptions, [&](const Vision::IO::FarmProgress &progress) { requeued = progress.requeuedShards; });
+    worker.join();
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(requeued, 1);
+    EXPECT_EQ(result->succeeded, 1);
+    EXPECT_TRUE(std::filesystem::exists(outputDir / "a.png"));
+}
+
+TEST_F(BatchFarmTest, FilesFailingEveryAttemptAreReported)
+{
+    WriteImage(inputDir / "good.png", 20);
+    std::ofstream(inputDir / "broken.png") << "not really a png";
+
+    auto farmOptions = MakeFarmOptions();
+    farmOptions.maxAttempts = 2;
+    ASSERT_TRUE(Vision::IO::BatchFarm::CreateJob(editor, jobDir, MakeOptions(), farmOptions));
+
+    Nodes::NodeEditor worker;
+    EXPECT_EQ(Vision::IO::BatchFarm::Work(worker, jobDir, "only", farmOptions), 2); // First try and one retry
+    const auto result = Vision::IO::BatchFarm::Coordinate(jobDir, farmOptions);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->succeeded, 1);
+    EXPECT_EQ(result->failed, 1);
+    ASSERT_EQ(result->failedFiles.size(), 1u);
+    EXPECT_EQ(result->failedFiles[0].filename(), "broken.png");
+    EXPECT_TRUE(std::filesystem::exists(jobDir / "complete"));
+}
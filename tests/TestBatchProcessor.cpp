@@ -0,0 +1,406 @@
+#include "Nodes/Core/BoundedQueue.h"
+#include "Vision/IO/BatchProcessor.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // First pixel value of a pathological image that BrightenNode processes until the run stops
+    constexpr int kStallValue = 200;
+
+    // Adds a constant to every channel value so results can be checked per file
+    class BrightenNode : public Nodes::Node
+    {
+    public:
+        BrightenNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "BrightenNode";
+        }
+
+        void Process() override
+        {
+            auto input = GetInputValue<cv::Mat>("Input");
+            if (!input || input->empty())
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+
+            if (input->at<uchar>(0, 0) == kStallValue)
+            {
+                const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+                while (std::chrono::steady_clock::now() < giveUp)
+                {
+                    ThrowIfStopRequested();
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+
+            // Reuses its buffer on purpose, like the built-in nodes do
+            output = input->clone();
+            auto *pixels = output.ptr(0);
+            for (size_t i = 0; i < output.total() * output.elemSize(); ++i)
+            {
+                pixels[i] = static_cast<uchar>(pixels[i] + 1);
+            }
+            SetOutputSlotData("Output", output);
+        }
+
+    private:
+        cv::Mat output;
+    };
+} // namespace
+
+// ============================================================================
+// BoundedQueue Tests
+// ============================================================================
+
+TEST(BoundedQueueTest, CloseDrainsRemainingItems)
+{
+    Nodes::BoundedQueue<int> queue(4);
+    EXPECT_TRUE(queue.Push(1));
+    EXPECT_TRUE(queue.Push(2));
+    queue.Close();
+
+    EXPECT_FALSE(queue.Push(3));
+    EXPECT_EQ(queue.Pop(), 1);
+    EXPECT_EQ(queue.Pop(), 2);
+    EXPECT_EQ(queue.Pop(), std::nullopt);
+}
+
+TEST(BoundedQueueTest, PushBlocksWhileFull)
+{
+    Nodes::BoundedQueue<int> queue(1);
+    ASSERT_TRUE(queue.Push(1));
+
+    std::atomic<bool> secondPushed{ false };
+    std::thread producer([&]() {
+        queue.Push(2);
+        secondPushed.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(secondPushed.load());
+
+    EXPECT_EQ(queue.Pop(), 1);
+    producer.join();
+    EXPECT_TRUE(secondPushed.load());
+    EXPECT_EQ(queue.Pop(), 2);
+}
+
+// ============================================================================
+// BatchProcessor Tests
+// ============================================================================
+
+class BatchProcessorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_batch_test";
+        std::filesystem::remove_all(testDir);
+        inputDir = testDir / "in";
+        outputDir = testDir / "out";
+        std::filesystem::create_directories(inputDir);
+
+        editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+        editor.AddNode(std::make_unique<BrightenNode>(2, "Brighten"));
+        editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(3));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    void WriteImage(const std::filesystem::path &path, int value)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        ASSERT_TRUE(cv::imwrite(path.string(), cv::Mat(4, 4, CV_8UC3, cv::Scalar(value, value, value))));
+    }
+
+    Vision::IO::BatchOptions MakeOptions() const
+    {
+        Vision::IO::BatchOptions options;
+        options.inputDirectory = inputDir;
+        options.outputDirectory = outputDir;
+        options.outputFormat = "png";
+        options.queueCapacity = 2;
+        return options;
+    }
+
+    std::filesystem::path testDir;
+    std::filesystem::path inputDir;
+    std::filesystem::path outputDir;
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(BatchProcessorTest, RecognisesImageExtensions)
+{
+    EXPECT_TRUE(Vision::IO::BatchProcessor::IsSupportedImageFile("a.png"));
+    EXPECT_TRUE(Vision::IO::BatchProcessor::IsSupportedImageFile("dir/b.JPEG"));
+    EXPECT_TRUE(Vision::IO::BatchProcessor::IsSupportedImageFile("c.tiff"));
+    EXPECT_FALSE(Vision::IO::BatchProcessor::IsSupportedImageFile("notes.txt"));
+    EXPECT_FALSE(Vision::IO::BatchProcessor::IsSupportedImageFile("png"));
+}
+
+TEST_F(BatchProcessorTest, CollectsSortedImagesOptionallyRecursive)
+{
+    WriteImage(inputDir / "b.png", 0);
+    WriteImage(inputDir / "a.png", 0);
+    WriteImage(inputDir / "sub" / "c.png", 0);
+    std::ofstream(inputDir / "readme.txt") << "not an image";
+
+    const auto flat = Vision::IO::BatchProcessor::CollectImageFiles(inputDir, false);
+    ASSERT_EQ(flat.size(), 2);
+    EXPECT_EQ(flat[0].filename(), "a.png");
+    EXPECT_EQ(flat[1].filename(), "b.png");
+
+    EXPECT_EQ(Vision::IO::BatchProcessor::CollectImageFiles(inputDir, true).size(), 3);
+}
+
+TEST_F(BatchProcessorTest, ProcessesEveryFileThroughGraph)
+{
+    constexpr int kFileCount = 12;
+    for (int i = 0; i < kFileCount; ++i)
+    {
+        WriteImage(inputDir / ("img" + std::to_string(10 + i) + ".png"), i * 10);
+    }
+
+    size_t lastCompleted = 0;
+    Vision::IO::BatchProcessor processor(editor);
+    const auto result = processor.Run(MakeOptions(), [&](size_t completed, size_t total, const auto &) {
+        EXPECT_EQ(total, kFileCount);
+        lastCompleted = std::max(lastCompleted, completed);
+    });
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->total, kFileCount);
+    EXPECT_EQ(result->succeeded, kFileCount);
+    EXPECT_EQ(result->failed, 0);
+    EXPECT_FALSE(result->cancelled);
+    EXPECT_EQ(lastCompleted, kFileCount);
+
+    for (int i = 0; i < kFileCount; ++i)
+    {
+        const auto written = cv::imread((outputDir / ("img" + std::to_string(10 + i) + ".png")).string());
+        ASSERT_FALSE(written.empty()) << "Missing output " << i;
+        EXPECT_EQ(written.at<uchar>(0, 0), i * 10 + 1) << "Output " << i << " holds another file's result";
+    }
+}
+
+TEST_F(BatchProcessorTest, RestoresAutoSaveAndOutputCache)
+{
+    WriteImage(inputDir / "a.png", 5);
+    editor.GetNode(3)->SetInputSlotDefault("AutoSave", true);
+
+    Vision::IO::BatchProcessor processor(editor);
+    ASSERT_TRUE(processor.Run(MakeOptions()).has_value());
+
+    EXPECT_EQ(editor.GetNode(3)->GetInputValue<bool>("AutoSave"), true);
+    EXPECT_TRUE(editor.IsOutputCacheEnabled());
+}
+
+TEST_F(BatchProcessorTest, UnreadableFileCountsAsFailure)
+{
+    WriteImage(inputDir / "good.png", 20);
+    std::ofstream(inputDir / "broken.png") << "not really a png";
+
+    Vision::IO::BatchProcessor processor(editor);
+    const auto result = processor.Run(MakeOptions());
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->succeeded, 1);
+    EXPECT_EQ(result->failed, 1);
+    EXPECT_TRUE(std::filesystem::exists(outputDir / "good.png"));
+    ASSERT_EQ(result->failedFiles.size(), 1u);
+    EXPECT_EQ(result->failedFiles[0].filename(), "broken.png");
+}
+
+TEST_F(BatchProcessorTest, ReportsEachFileWithItsDestinationAndTime)
+{
+    WriteImage(inputDir / "good.png", 20);
+    std::ofstream(inputDir / "broken.png") << "not really a png";
+
+    std::mutex itemMutex;
+    std::vector<Vision::IO::BatchItem> items;
+    auto options = MakeOptions();
+    options.itemCallback = [&](const Vision::IO::BatchItem &item) {
+        std::scoped_lock lock(itemMutex);
+        items.push_back(item);
+    };
+    Vision::IO::BatchProcessor processor(editor);
+    ASSERT_TRUE(processor.Run(options).has_value());
+
+    ASSERT_EQ(items.size(), 2u);
+    std::ranges::sort(items, {}, [](const auto &item) { return item.source.filename(); });
+    EXPECT_EQ(items[0].source.filename(), "broken.png");
+    EXPECT_FALSE(items[0].succeeded);
+    EXPECT_TRUE(items[0].destination.empty());
+    EXPECT_EQ(items[0].executionTime.count(), 0); // Never decoded, so the graph did not run
+    EXPECT_EQ(items[1].source.filename(), "good.png");
+    EXPECT_TRUE(items[1].succeeded);
+    EXPECT_EQ(items[1].destination, outputDir / "good.png");
+    EXPECT_GT(items[1].executionTime.count(), 0);
+}
+
+TEST_F(BatchProcessorTest, FileTimeoutFailsOnlyThePathologicalFile)
+{
+    WriteImage(inputDir / "fine.png", 10);
+    WriteImage(inputDir / "stall.png", kStallValue);
+
+    auto options = MakeOptions();
+    options.fileTimeout = std::chrono::milliseconds(50);
+    Vision::IO::BatchProcessor processor(editor);
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = processor.Run(options);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    EXPECT_EQ(result->succeeded, 1);
+    EXPECT_EQ(result->failed, 1);
+    EXPECT_EQ(result->timedOut, 1);
+    EXPECT_FALSE(result->cancelled);
+    EXPECT_TRUE(std::filesystem::exists(outputDir / "fine.png"));
+    EXPECT_EQ(editor.GetExecutionTimeout(), std::chrono::milliseconds::zero());
+}
+
+TEST_F(BatchProcessorTest, MirrorsSubdirectoriesWhenRecursive)
+{
+    WriteImage(inputDir / "set1" / "a.png", 1);
+    WriteImage(inputDir / "set2" / "a.png", 2);
+
+    auto options = MakeOptions();
+    options.recursive = true;
+
+    Vision::IO::BatchProcessor processor(editor);
+    const auto result = processor.Run(options);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->succeeded, 2);
+    EXPECT_TRUE(std::filesystem::exists(outputDir / "set1" / "a.png"));
+    EXPECT_TRUE(std::filesystem::exists(outputDir / "set2" / "a.png"));
+}
+
+TEST_F(BatchProcessorTest, CancelledBeforeStartWritesNothing)
+{
+    WriteImage(inputDir / "a.png", 1);
+
+    std::stop_source source;
+    source.request_stop();
+
+    Vision::IO::BatchProcessor processor(editor);
+    const auto result = processor.Run(MakeOptions(), nullptr, source.get_token());
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->cancelled);
+    EXPECT_EQ(result->succeeded, 0);
+    EXPECT_FALSE(std::filesystem::exists(outputDir / "a.png"));
+}
+
+TEST_F(BatchProcessorTest, RejectsGraphWithoutOutputNode)
+{
+    ASSERT_TRUE(editor.RemoveNode(3));
+
+    Vision::IO::BatchProcessor processor(editor);
+    EXPECT_FALSE(processor.Run(MakeOptions()).has_value());
+}
+
+TEST_F(BatchProcessorTest, RejectsMissingInputDirectory)
+{
+    auto options = MakeOptions();
+    options.inputDirectory = testDir / "does_not_exist";
+
+    Vision::IO::BatchProcessor processor(editor);
+    EXPECT_FALSE(processor.Run(options).has_value());
+}
+
+TEST_F(BatchProcessorTest, ManifestResumesOnlyUnhandledFiles)
+{
+    constexpr int kFileCount = 6;
+    for (int i = 0; i < kFileCount; ++i)
+    {
+        WriteImage(inputDir / ("img" + std::to_string(i) + ".png"), i * 10);
+    }
+
+    auto options = MakeOptions();
+    options.manifestPath = testDir / "job.manifest";
+
+    // Interrupt the first run after two files
+    std::stop_source source;
+    Vision::IO::BatchProcessor processor(editor);
+    const auto first = processor.Run(
+        options,
+        [&](size_t completed, size_t, const auto &) {
+            if (completed >= 2)
+            {
+                source.request_stop();
+            }
+        },
+        source.get_token());
+    ASSERT_TRUE(first.has_value());
+    EXPECT_TRUE(first->cancelled);
+    ASSERT_GE(first->succeeded, 2u);
+
+    // Outputs of handled files are not written again
+    std::vector<std::filesystem::path> handledOutputs;
+    for (const auto &entry : std::filesystem::directory_iterator(outputDir))
+    {
+        handledOutputs.push_back(entry.path());
+        std::filesystem::remove(entry.path());
+    }
+
+    const auto second = processor.Run(options);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_FALSE(second->cancelled);
+    EXPECT_EQ(second->total, kFileCount);
+    EXPECT_EQ(second->skipped, first->succeeded + first->failed);
+    EXPECT_EQ(second->skipped + second->succeeded, kFileCount);
+    for (const auto &path : handledOutputs)
+    {
+        EXPECT_FALSE(std::filesystem::exists(path)) << path << " was processed twice";
+    }
+
+    const auto third = processor.Run(options);
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(third->skipped, kFileCount);
+    EXPECT_EQ(third->succeeded, 0);
+}
+
+TEST_F(BatchProcessorTest, ManifestOfAnotherGraphIsRejected)
+{
+    WriteImage(inputDir / "a.png", 1);
+
+    auto options = MakeOptions();
+    options.manifestPath = testDir / "job.manifest";
+    Vision::IO::BatchProcessor processor(editor);
+    ASSERT_TRUE(processor.Run(options).has_value());
+
+    editor.AddNode(std::make_unique<BrightenNode>(4, "Unconnected"));
+    EXPECT_FALSE(processor.Run(options).has_value());
+}
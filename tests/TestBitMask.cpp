@@ -0,0 +1,191 @@
+#include "Nodes/Core/BitMask.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/MaskLogicNode.h"
+#include "Vision/Algorithms/MorphologyNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "Vision/Kernels/BitMaskOps.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace VisionCraft;
+using Tests::OutputOf;
+using Tests::SameImage;
+using Tests::SourceNode;
+
+namespace
+{
+    // Random 0/255 mask with about `percent` percent of pixels set
+    cv::Mat MakeMask(int rows, int cols, int percent = 50)
+    {
+        cv::Mat noise(rows, cols, CV_8UC1);
+        cv::randu(noise, cv::Scalar::all(0), cv::Scalar::all(100));
+        return noise < percent;
+    }
+
+    cv::Mat Morphology(const Nodes::BitMask &mask, Vision::Algorithms::MorphOperation operation,
+        const std::string &shape, int ksize, int iterations = 1)
+    {
+        Vision::Algorithms::MorphologyNode node(1);
+        node.SetInputSlotData("Input", mask);
+        node.SetInputSlotData("Operation", static_cast<int>(operation));
+        node.SetInputSlotData("Shape", shape);
+        node.SetInputSlotData("ksize", ksize);
+        node.SetInputSlotData("iterations", iterations);
+        node.Process();
+        const auto output = node.GetOutputSlot("Output").GetDataIf<Nodes::BitMask>();
+        return output ? output->ToImage() : cv::Mat();
+    }
+} // namespace
+
+TEST(BitMaskTest, PacksAndUnpacksEveryWidth)
+{
+    for (const int cols : { 1, 7, 63, 64, 65, 130, 200 })
+    {
+        const cv::Mat image = MakeMask(5, cols);
+        const auto mask = Nodes::BitMask::FromImage(image);
+        EXPECT_EQ(mask.GetSize(), image.size());
+        EXPECT_EQ(mask.GetWordsPerRow(), (cols + 63) / 64);
+        EXPECT_TRUE(SameImage(mask.ToImage(), image)) << cols;
+        EXPECT_EQ(mask.Get(cols - 1, 4), image.at<uint8_t>(4, cols - 1) != 0);
+        EXPECT_EQ(Vision::Kernels::CountMaskPixels(mask), static_cast<size_t>(cv::countNonZero(image)));
+    }
+
+    // Any nonzero byte is a set pixel
+    cv::Mat gray(2, 70, CV_8UC1, cv::Scalar(0));
+    gray.at<uint8_t>(1, 69) = 3;
+    const auto mask = Nodes::BitMask::FromImage(gray);
+    EXPECT_TRUE(mask.Get(69, 1));
+    EXPECT_EQ(Vision::Kernels::CountMaskPixels(mask), 1u);
+
+    EXPECT_THROW((void)Nodes::BitMask::FromImage(cv::Mat(4, 4, CV_8UC3)), std::invalid_argument);
+    EXPECT_TRUE(Nodes::BitMask::FromImage(cv::Mat()).IsEmpty());
+}
+
+TEST(BitMaskTest, WordsRoundTripAndRejectBitsPastTheWidth)
+{
+    const auto mask = Nodes::BitMask::FromImage(MakeMask(3, 70));
+    const auto copy = Nodes::BitMask::FromWords(mask.GetWords(), 70);
+    EXPECT_EQ(copy.GetWords().data, mask.GetWords().data);
+    EXPECT_NE(mask.Clone().GetWords().data, mask.GetWords().data);
+
+    cv::Mat words = mask.GetWords().clone();
+    words.at<uint8_t>(0, 15) = 0x80; // Bit 127 of row 0, past column 69
+    EXPECT_THROW((void)Nodes::BitMask::FromWords(words, 70), std::invalid_argument);
+    EXPECT_THROW((void)Nodes::BitMask::FromWords(mask.GetWords(), 200), std::invalid_argument);
+}
+
+TEST(BitMaskTest, CombinesLikeBitwiseOperationsOnBytes)
+{
+    const cv::Mat a = MakeMask(9, 150);
+    const cv::Mat b = MakeMask(9, 150, 30);
+    const auto packedA = Nodes::BitMask::FromImage(a);
+    const auto packedB = Nodes::BitMask::FromImage(b);
+    cv::Mat expected;
+
+    cv::bitwise_and(a, b, expected);
+    EXPECT_TRUE(SameImage(
+        Vision::Kernels::CombineMasks(packedA, packedB, Vision::Kernels::MaskOperation::And).ToImage(), expected));
+    cv::bitwise_or(a, b, expected);
+    EXPECT_TRUE(SameImage(
+        Vision::Kernels::CombineMasks(packedA, packedB, Vision::Kernels::MaskOperation::Or).ToImage(), expected));
+    cv::bitwise_xor(a, b, expected);
+    EXPECT_TRUE(SameImage(
+        Vision::Kernels::CombineMasks(packedA, packedB, Vision::Kernels::MaskOperation::Xor).ToImage(), expected));
+
+    EXPECT_THROW((void)Vision::Kernels::CombineMasks(packedA, Nodes::BitMask(cv::Size(10, 9)),
+                     Vision::Kernels::MaskOperation::And),
+        std::invalid_argument);
+}
+
+TEST(BitMaskTest, PackedMorphologyMatchesOpenCv)
+{
+    using Vision::Algorithms::MorphOperation;
+    const cv::Mat image = MakeMask(37, 141, 60);
+    const auto mask = Nodes::BitMask::FromImage(image);
+    const std::pair<std::string, cv::MorphShapes> shapes[] = {
+        { "Rect", cv::MORPH_RECT }, { "Cross", cv::MORPH_CROSS }, { "Ellipse", cv::MORPH_ELLIPSE }
+    };
+
+    for (const auto &[name, shape] : shapes)
+    {
+        for (const int ksize : { 1, 3, 4, 9, 70 })
+        {
+            for (const auto operation : { MorphOperation::Erode,
+                     MorphOperation::Dilate,
+                     MorphOperation::Open,
+                     MorphOperation::Close,
+                     MorphOperation::Gradient,
+                     MorphOperation::TopHat,
+                     MorphOperation::BlackHat })
+            {
+                const int iterations = ksize == 3 ? 2 : 1;
+                cv::Mat expected;
+                cv::morphologyEx(image,
+                    expected,
+                    static_cast<int>(operation),
+                    cv::getStructuringElement(shape, cv::Size(ksize, ksize)),
+                    cv::Point(-1, -1),
+                    iterations);
+                EXPECT_TRUE(SameImage(Morphology(mask, operation, name, ksize, iterations), expected))
+                    << name << " ksize " << ksize << " operation " << static_cast<int>(operation);
+            }
+        }
+    }
+}
+
+TEST(BitMaskTest, MaskChainStaysPackedUntilAByteConsumer)
+{
+    cv::Mat gray(48, 100, CV_8UC1);
+    cv::randu(gray, cv::Scalar::all(0), cv::Scalar::all(255));
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<SourceNode>(1, gray));
+    for (const Nodes::NodeId id : { 2, 3 })
+    {
+        auto threshold = std::make_unique<Vision::Algorithms::ThresholdNode>(id);
+        threshold->SetInputSlotData("Threshold", id == 2 ? 100.0 : 160.0);
+        threshold->SetInputSlotData("PackMask", true);
+        editor.AddNode(std::move(threshold));
+        editor.AddConnection(1, "Output", id, "Input");
+    }
+    auto logic = std::make_unique<Vision::Algorithms::MaskLogicNode>(4);
+    logic->SetInputSlotData("Operation", std::string("XOR"));
+    editor.AddNode(std::move(logic));
+    auto morphology = std::make_unique<Vision::Algorithms::MorphologyNode>(5);
+    morphology->SetInputSlotData("Operation", static_cast<int>(Vision::Algorithms::MorphOperation::Dilate));
+    editor.AddNode(std::move(morphology));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(6)); // Reads bytes
+    editor.AddConnection(2, "Output", 4, "A");
+    editor.AddConnection(3, "Output", 4, "B");
+    editor.AddConnection(4, "Output", 5, "Input");
+    editor.AddConnection(5, "Output", 6, "Input");
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(3, "Then", 4, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(4, "Then", 5, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(5, "Then", 6, "Execute", Nodes::ConnectionType::Execution);
+
+    ASSERT_TRUE(editor.Execute());
+
+    cv::Mat low, high, band, expected;
+    cv::threshold(gray, low, 100.0, 255.0, cv::THRESH_BINARY);
+    cv::threshold(gray, high, 160.0, 255.0, cv::THRESH_BINARY);
+    cv::bitwise_xor(low, high, band);
+    cv::dilate(band, expected, cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3)));
+
+    const auto packed = editor.GetNode(5)->GetOutputSlot("Output").GetDataIf<Nodes::BitMask>();
+    ASSERT_TRUE(packed);
+    EXPECT_TRUE(SameImage(packed->ToImage(), expected));
+    EXPECT_EQ(editor.GetNode(4)->GetOutputSlot("Count").GetData<int>(), cv::countNonZero(band));
+
+    // The byte consumer read the dilated mask unpacked
+    const auto bytes = OutputOf(editor, 6);
+    ASSERT_TRUE(bytes);
+    EXPECT_TRUE(SameImage(*bytes, expected));
+}
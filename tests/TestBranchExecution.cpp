@@ -0,0 +1,174 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/BranchNode.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+
+using namespace VisionCraft;
+using Tests::OutcomeOf;
+using Tests::SourceNode;
+
+namespace
+{
+    // Adds one to its input and counts Process() calls
+    class CountingNode : public Nodes::Node
+    {
+    public:
+        explicit CountingNode(Nodes::NodeId id) : Nodes::Node(id, "Counting")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Value", 0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CountingNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            SetOutputSlotData("Output", GetInputValue<int>("Value").value_or(0) + 1);
+        }
+
+        std::atomic<int> processCount{ 0 };
+    };
+
+    // Joins two execution paths
+    class MergeNode : public Nodes::Node
+    {
+    public:
+        explicit MergeNode(Nodes::NodeId id) : Nodes::Node(id, "Merge")
+        {
+            CreateExecutionInputPin("A");
+            CreateExecutionInputPin("B");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "MergeNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            SetOutputSlotData("Output", processCount.load());
+        }
+
+        std::atomic<int> processCount{ 0 };
+    };
+} // namespace
+
+class BranchExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Source 1 -> Branch 2; True -> 3 -> 4, False -> 5; the branch reads the source's value
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.AddNode(std::make_unique<SourceNode>(1, 1));
+        editor.AddNode(std::make_unique<Vision::Algorithms::BranchNode>(2));
+        editor.AddNode(std::make_unique<CountingNode>(3));
+        editor.AddNode(std::make_unique<CountingNode>(4));
+        editor.AddNode(std::make_unique<CountingNode>(5));
+        editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(2, "True", 3, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(3, "Then", 4, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(2, "False", 5, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(1, "Output", 2, "Condition");
+        editor.AddConnection(3, "Output", 4, "Value");
+    }
+
+    void SetCondition(int value)
+    {
+        static_cast<SourceNode *>(editor.GetNode(1))->data = value;
+        editor.MarkNodeDirty(1);
+    }
+
+    int ProcessCount(Nodes::NodeId id)
+    {
+        return static_cast<CountingNode *>(editor.GetNode(id))->processCount;
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(BranchExecutionTest, RunsOnlyTheTakenChain)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(ProcessCount(3), 1);
+    EXPECT_EQ(ProcessCount(4), 1);
+    EXPECT_EQ(ProcessCount(5), 0);
+    EXPECT_EQ(OutcomeOf(editor, 5), Nodes::StepOutcome::Bypassed);
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->nodesBypassed, 1u);
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Result").GetData<bool>(), true);
+}
+
+TEST_P(BranchExecutionTest, FlippedConditionBypassesTheWholeChainAndClearsItsOutputs)
+{
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_EQ(editor.GetNode(4)->GetOutputSlot("Output").GetData<int>(), 2);
+
+    SetCondition(0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(ProcessCount(3), 1);
+    EXPECT_EQ(ProcessCount(4), 1);
+    EXPECT_EQ(ProcessCount(5), 1);
+    EXPECT_EQ(OutcomeOf(editor, 3), Nodes::StepOutcome::Bypassed);
+    EXPECT_EQ(OutcomeOf(editor, 4), Nodes::StepOutcome::Bypassed);
+    EXPECT_FALSE(editor.GetNode(3)->GetOutputSlot("Output").HasData());
+    EXPECT_FALSE(editor.GetNode(4)->GetOutputSlot("Output").HasData());
+
+    // Bypassed nodes stay dirty, so taking the path again runs them even with incremental execution
+    SetCondition(2);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(ProcessCount(3), 2);
+    EXPECT_EQ(ProcessCount(4), 2);
+    EXPECT_EQ(ProcessCount(5), 1);
+    EXPECT_EQ(editor.GetNode(4)->GetOutputSlot("Output").GetData<int>(), 2);
+}
+
+TEST_P(BranchExecutionTest, MergedPathsRunIfEitherWasTaken)
+{
+    editor.AddNode(std::make_unique<MergeNode>(6));
+    editor.AddConnection(4, "Then", 6, "A", Nodes::ConnectionType::Execution);
+    editor.AddConnection(5, "Then", 6, "B", Nodes::ConnectionType::Execution);
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(OutcomeOf(editor, 6), Nodes::StepOutcome::Processed);
+
+    SetCondition(0);
+    editor.MarkNodeDirty(6);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(OutcomeOf(editor, 6), Nodes::StepOutcome::Processed);
+    EXPECT_EQ(static_cast<MergeNode *>(editor.GetNode(6))->processCount, 2);
+}
+
+TEST_P(BranchExecutionTest, PartialRunKeepsTheBranchDeciding)
+{
+    // Node 4 reads only node 3, but the branch decides whether either runs
+    SetCondition(0);
+    ASSERT_TRUE(editor.ExecuteUpTo(4));
+
+    EXPECT_EQ(ProcessCount(3), 0);
+    EXPECT_EQ(ProcessCount(4), 0);
+    EXPECT_EQ(OutcomeOf(editor, 4), Nodes::StepOutcome::Bypassed);
+}
+
+TEST_P(BranchExecutionTest, NumericConditionsCompareAgainstZero)
+{
+    SetCondition(-3);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(ProcessCount(3), 1);
+    EXPECT_EQ(ProcessCount(5), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    BranchExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,170 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
+using namespace VisionCraft;
+using namespace std::chrono_literals;
+using Tests::OutcomeOf;
+
+namespace
+{
+    // Works in 1 ms slices, polling the stop condition between them
+    class PollingNode : public Nodes::Node
+    {
+    public:
+        PollingNode(Nodes::NodeId id, int slices) : Nodes::Node(id, "Polling"), slices(slices)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "PollingNode";
+        }
+
+        void Process() override
+        {
+            for (int i = 0; i < slices; ++i)
+            {
+                ThrowIfStopRequested();
+                std::this_thread::sleep_for(1ms);
+            }
+            ++processCount;
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        int slices;
+        int processCount = 0;
+    };
+
+    // Sleeps without polling, like a single long OpenCV call
+    class BlockingNode : public Nodes::Node
+    {
+    public:
+        BlockingNode(Nodes::NodeId id, std::chrono::milliseconds duration)
+            : Nodes::Node(id, "Blocking"), duration(duration)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "BlockingNode";
+        }
+
+        void Process() override
+        {
+            std::this_thread::sleep_for(duration);
+            ++processCount;
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        std::chrono::milliseconds duration;
+        int processCount = 0;
+    };
+
+    constexpr int kEndlessSlices = 10'000; // 10 s, far beyond any stop the tests request
+} // namespace
+
+class CancellationTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(CancellationTest, CancelStopsRunningNode)
+{
+    editor.AddNode(std::make_unique<PollingNode>(1, kEndlessSlices));
+    editor.AddNode(std::make_unique<PollingNode>(2, 1));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    std::stop_source stopSource;
+    std::jthread canceller([&]() {
+        std::this_thread::sleep_for(20ms);
+        stopSource.request_stop();
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(editor.Execute(nullptr, stopSource.get_token()));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+
+    EXPECT_EQ(OutcomeOf(editor, 1), Nodes::StepOutcome::Cancelled);
+    EXPECT_EQ(OutcomeOf(editor, 2), Nodes::StepOutcome::NotRun);
+    EXPECT_TRUE(editor.GetNode(1)->IsDirty());
+    EXPECT_FALSE(editor.GetNode(1)->GetOutputSlot("Output").HasData());
+    EXPECT_FALSE(editor.GetExecutionStatistics().GetLatest()->timedOut);
+}
+
+TEST_P(CancellationTest, TimeoutStopsRunningNode)
+{
+    editor.AddNode(std::make_unique<PollingNode>(1, kEndlessSlices));
+    editor.SetExecutionTimeout(30ms);
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(editor.Execute());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    EXPECT_TRUE(run->timedOut);
+    EXPECT_EQ(OutcomeOf(editor, 1), Nodes::StepOutcome::Cancelled);
+}
+
+TEST_P(CancellationTest, TimeoutIsCheckedBetweenSteps)
+{
+    editor.AddNode(std::make_unique<BlockingNode>(1, 40ms));
+    editor.AddNode(std::make_unique<BlockingNode>(2, 0ms));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.SetExecutionTimeout(10ms);
+
+    EXPECT_FALSE(editor.Execute());
+
+    // The blocking node cannot be interrupted, but nothing starts after the deadline
+    EXPECT_EQ(OutcomeOf(editor, 1), Nodes::StepOutcome::Processed);
+    EXPECT_EQ(OutcomeOf(editor, 2), Nodes::StepOutcome::NotRun);
+    EXPECT_EQ(static_cast<BlockingNode *>(editor.GetNode(2))->processCount, 0);
+    EXPECT_TRUE(editor.GetExecutionStatistics().GetLatest()->timedOut);
+}
+
+TEST_P(CancellationTest, RunsWithinTimeoutSucceed)
+{
+    editor.AddNode(std::make_unique<PollingNode>(1, 3));
+    editor.SetExecutionTimeout(50ms);
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_FALSE(editor.GetExecutionStatistics().GetLatest()->timedOut);
+
+    // The condition is reset after the run, so calling Process() past the deadline does not stop
+    std::this_thread::sleep_for(60ms);
+    auto *node = static_cast<PollingNode *>(editor.GetNode(1));
+    node->Process();
+    EXPECT_EQ(node->processCount, 2);
+}
+
+TEST_P(CancellationTest, StoppedNodeRunsAgainNextTime)
+{
+    editor.AddNode(std::make_unique<PollingNode>(1, kEndlessSlices));
+    auto *node = static_cast<PollingNode *>(editor.GetNode(1));
+    editor.SetExecutionTimeout(10ms);
+    ASSERT_FALSE(editor.Execute());
+
+    node->slices = 1;
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(node->processCount, 1);
+    EXPECT_EQ(OutcomeOf(editor, 1), Nodes::StepOutcome::Processed);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    CancellationTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,159 @@
+#include "Nodes/Core/ColorLut.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CvtColorNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace VisionCraft;
+using Nodes::ColorLut;
+using Nodes::ColorLutCache;
+using Nodes::TileOperation;
+using Tests::OutputOf;
+using Tests::SourceNode;
+using Vision::Algorithms::ColorConversion;
+
+namespace
+{
+    TileOperation Conversion(int code, int outputType)
+    {
+        return TileOperation{ .halo = 0,
+            .outputType = outputType,
+            .apply =
+                [code](const cv::Mat &tile) {
+                    cv::Mat result;
+                    cv::cvtColor(tile, result, code);
+                    return result;
+                },
+            .colorTransform = "cvtColor " + std::to_string(code) };
+    }
+
+    cv::Mat RandomImage(int rows, int cols, int type)
+    {
+        cv::Mat image(rows, cols, type);
+        cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(256));
+        return image;
+    }
+} // namespace
+
+TEST(ColorLutTest, TableMatchesTheOperations)
+{
+    const std::vector<TileOperation> roundTrip{ Conversion(cv::COLOR_BGR2HSV, CV_8UC3),
+        Conversion(cv::COLOR_HSV2BGR, CV_8UC3) };
+    const auto table = ColorLut::Build(CV_8UC3, roundTrip);
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->GetOutputType(), CV_8UC3);
+    EXPECT_EQ(table->GetBytes(), size_t{ 3 } << 24);
+
+    // A region of a larger image, so rows are not contiguous
+    const cv::Mat image = RandomImage(64, 80, CV_8UC3)(cv::Rect(3, 5, 61, 50));
+    cv::Mat hsv;
+    cv::Mat expected;
+    cv::cvtColor(image, hsv, cv::COLOR_BGR2HSV);
+    cv::cvtColor(hsv, expected, cv::COLOR_HSV2BGR);
+    EXPECT_EQ(cv::norm(table->Apply(image), expected, cv::NORM_INF), 0.0);
+}
+
+TEST(ColorLutTest, GrayInputsUseSmallTables)
+{
+    const std::vector<TileOperation> colorize{ Conversion(cv::COLOR_GRAY2BGR, CV_8UC3),
+        Conversion(cv::COLOR_BGR2HSV, CV_8UC3) };
+    const auto table = ColorLut::Build(CV_8UC1, colorize);
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->GetBytes(), 256u * 3);
+
+    const cv::Mat image = RandomImage(31, 47, CV_8UC1);
+    cv::Mat bgr;
+    cv::Mat expected;
+    cv::cvtColor(image, bgr, cv::COLOR_GRAY2BGR);
+    cv::cvtColor(bgr, expected, cv::COLOR_BGR2HSV);
+    EXPECT_EQ(cv::norm(table->Apply(image), expected, cv::NORM_INF), 0.0);
+    EXPECT_THROW((void)table->Apply(bgr), cv::Exception);
+}
+
+TEST(ColorLutTest, DeclinesUnsupportedRuns)
+{
+    const std::vector<TileOperation> toGray{ Conversion(cv::COLOR_BGR2GRAY, CV_8UC1) };
+    EXPECT_FALSE(ColorLut::Build(CV_8UC4, toGray));
+    EXPECT_FALSE(ColorLut::Build(CV_16UC3, toGray));
+
+    // Operations reading context or naming no mapping are not color transforms
+    auto blur = Conversion(cv::COLOR_BGR2GRAY, CV_8UC1);
+    blur.halo = 1;
+    auto unnamed = Conversion(cv::COLOR_BGR2GRAY, CV_8UC1);
+    unnamed.colorTransform.clear();
+    EXPECT_FALSE(ColorLut::IsColorTransformRun(std::vector{ blur }));
+    EXPECT_FALSE(ColorLut::Build(CV_8UC3, std::vector{ unnamed }));
+
+    // An operation returning another type than it declared fails the build
+    const std::vector<TileOperation> wrongType{ Conversion(cv::COLOR_BGR2GRAY, CV_8UC3) };
+    EXPECT_FALSE(ColorLut::Build(CV_8UC3, wrongType));
+}
+
+TEST(ColorLutTest, CacheRebuildsOnlyWhenTheRunChanges)
+{
+    ColorLutCache cache(1);
+    const std::vector<TileOperation> first{ Conversion(cv::COLOR_GRAY2BGR, CV_8UC3),
+        Conversion(cv::COLOR_BGR2GRAY, CV_8UC1) };
+    const auto table = cache.Get(CV_8UC1, first);
+    ASSERT_TRUE(table);
+    EXPECT_EQ(cache.Get(CV_8UC1, first), table);
+    EXPECT_EQ(cache.GetBuildCount(), 1u);
+
+    // A changed parameter changes the name, and the least recently used table makes room
+    const std::vector<TileOperation> second{ Conversion(cv::COLOR_GRAY2BGR, CV_8UC3),
+        Conversion(cv::COLOR_BGR2HSV, CV_8UC3) };
+    EXPECT_NE(cache.Get(CV_8UC1, second), table);
+    EXPECT_EQ(cache.GetBuildCount(), 2u);
+    (void)cache.Get(CV_8UC1, first);
+    EXPECT_EQ(cache.GetBuildCount(), 3u);
+
+    cache.Clear();
+    (void)cache.Get(CV_8UC1, first);
+    EXPECT_EQ(cache.GetBuildCount(), 4u);
+}
+
+TEST(ColorLutTest, FusedConversionChainsMatchSeparatePasses)
+{
+    // 1 MP, so the 3-channel run is collapsed too
+    const cv::Mat color = RandomImage(1024, 1024, CV_8UC3);
+    const cv::Mat gray = RandomImage(200, 300, CV_8UC1);
+    const std::pair<cv::Mat, std::vector<ColorConversion>> cases[] = {
+        { color, { ColorConversion::BGR2HSV, ColorConversion::HSV2BGR, ColorConversion::BGR2RGB } },
+        { gray, { ColorConversion::GRAY2BGR, ColorConversion::BGR2HSV } },
+    };
+
+    for (const auto &[image, conversions] : cases)
+    {
+        cv::Mat results[2];
+        for (const bool collapse : { false, true })
+        {
+            Nodes::NodeEditor editor;
+            editor.SetOutputCacheEnabled(false);
+            editor.SetTilingOptions({ .enabled = false, .collapseColorTransforms = collapse });
+            editor.AddNode(std::make_unique<SourceNode>(1, image));
+            Nodes::NodeId previous = 1;
+            for (const auto conversion : conversions)
+            {
+                const Nodes::NodeId id = previous + 1;
+                editor.AddNode(std::make_unique<Vision::Algorithms::CvtColorNode>(id));
+                editor.GetNode(id)->SetInputSlotDefault("Conversion", static_cast<int>(conversion));
+                editor.AddConnection(previous, "Output", id, "Input");
+                previous = id;
+            }
+
+            ASSERT_TRUE(editor.Execute());
+            const auto output = OutputOf(editor, previous);
+            ASSERT_TRUE(output);
+            results[collapse ? 1 : 0] = *output;
+        }
+        ASSERT_EQ(results[0].type(), results[1].type());
+        EXPECT_EQ(cv::norm(results[0], results[1], cv::NORM_INF), 0.0);
+    }
+}
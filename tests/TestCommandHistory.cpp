@@ -56,6 +56,101 @@ private:
     int undoCount = 0;
 };
 
+/**
+ * @brief Mock command that retains a releasable number of bytes while executed.
+ */
+class RetainingCommand : public Command
+{
+public:
+    explicit RetainingCommand(size_t bytes, bool releasable = true) : bytes(bytes), releasable(releasable)
+    {
+    }
+
+    void Execute() override
+    {
+        retained = !released;
+    }
+
+    void Undo() override
+    {
+        retained = false;
+    }
+
+    [[nodiscard]] std::string GetDescription() const override
+    {
+        return "Retain";
+    }
+
+    [[nodiscard]] size_t GetMemoryFootprint() const override
+    {
+        return retained ? bytes : 0;
+    }
+
+    void ReleaseMemory() override
+    {
+        if (releasable)
+        {
+            retained = false;
+            released = true;
+        }
+    }
+
+    bool WasReleased() const
+    {
+        return released;
+    }
+
+private:
+    size_t bytes;
+    bool releasable;
+    bool retained = false;
+    bool released = false;
+};
+
+/**
+ * @brief Mock command that sets a value and merges with following commands of the same key.
+ */
+class MergingCommand : public Command
+{
+public:
+    MergingCommand(int &target, int key, int oldValue, int newValue)
+        : target(target), key(key), oldValue(oldValue), newValue(newValue)
+    {
+    }
+
+    void Execute() override
+    {
+        target = newValue;
+    }
+
+    void Undo() override
+    {
+        target = oldValue;
+    }
+
+    [[nodiscard]] std::string GetDescription() const override
+    {
+        return "Set " + std::to_string(key);
+    }
+
+    [[nodiscard]] bool MergeWith(const Command &next) override
+    {
+        const auto *other = dynamic_cast<const MergingCommand *>(&next);
+        if (!other || other->key != key)
+        {
+            return false;
+        }
+        newValue = other->newValue;
+        return true;
+    }
+
+private:
+    int &target;
+    int key;
+    int oldValue;
+    int newValue;
+};
+
 /**
  * @brief Mock command that modifies a string.
  */
@@ -497,3 +592,158 @@ TEST_F(CommandHistoryTest, HistoryNavigationBoundaries)
     EXPECT_FALSE(history->Redo());
     EXPECT_EQ(counter, 5);
 }
+
+TEST(CommandHistoryBudgetTest, EqualCommandsReleaseOldestFirst)
+{
+    CommandHistory budgeted(100, 250);
+
+    auto first = std::make_unique<RetainingCommand>(100);
+    auto second = std::make_unique<RetainingCommand>(100);
+    auto third = std::make_unique<RetainingCommand>(100);
+    const auto *firstPtr = first.get();
+    const auto *secondPtr = second.get();
+    const auto *thirdPtr = third.get();
+
+    budgeted.ExecuteCommand(std::move(first));
+    budgeted.ExecuteCommand(std::move(second));
+    EXPECT_EQ(budgeted.GetRetainedBytes(), 200u);
+
+    budgeted.ExecuteCommand(std::move(third));
+    EXPECT_TRUE(firstPtr->WasReleased());
+    EXPECT_FALSE(secondPtr->WasReleased());
+    EXPECT_FALSE(thirdPtr->WasReleased());
+    EXPECT_EQ(budgeted.GetRetainedBytes(), 200u);
+
+    // Released commands stay undoable
+    EXPECT_EQ(budgeted.GetHistorySize(), 3u);
+    EXPECT_TRUE(budgeted.Undo());
+
+    budgeted.SetRetainedBytesBudget(0);
+    EXPECT_EQ(budgeted.GetRetainedBytes(), 0u);
+    EXPECT_TRUE(secondPtr->WasReleased());
+}
+
+TEST(CommandHistoryBudgetTest, HeaviestCommandReleasesFirst)
+{
+    CommandHistory budgeted(100, 500);
+
+    auto light = std::make_unique<RetainingCommand>(100);
+    auto heavy = std::make_unique<RetainingCommand>(400);
+    const auto *lightPtr = light.get();
+    const auto *heavyPtr = heavy.get();
+
+    budgeted.ExecuteCommand(std::move(light));
+    budgeted.ExecuteCommand(std::move(heavy));
+    budgeted.ExecuteCommand(std::make_unique<RetainingCommand>(50));
+
+    EXPECT_TRUE(heavyPtr->WasReleased());
+    EXPECT_FALSE(lightPtr->WasReleased());
+    EXPECT_EQ(budgeted.GetRetainedBytes(), 150u);
+    EXPECT_EQ(budgeted.GetHistorySize(), 3u);
+}
+
+TEST(CommandHistoryBudgetTest, UnreleasableStateDropsOldestUndoSteps)
+{
+    int counter = 0;
+    CommandHistory budgeted(100, 300);
+
+    budgeted.ExecuteCommand(std::make_unique<MockCommand>(counter, 1, "Add 1"));
+    budgeted.ExecuteCommand(std::make_unique<RetainingCommand>(200, false));
+    budgeted.ExecuteCommand(std::make_unique<MockCommand>(counter, 2, "Add 2"));
+    EXPECT_EQ(budgeted.GetHistorySize(), 3u);
+
+    budgeted.ExecuteCommand(std::make_unique<RetainingCommand>(200, false));
+    EXPECT_EQ(budgeted.GetHistorySize(), 2u);
+    EXPECT_EQ(budgeted.GetCurrentIndex(), 2u);
+    EXPECT_EQ(budgeted.GetRetainedBytes(), 200u);
+    EXPECT_EQ(budgeted.GetUndoDescription(), "Retain");
+    EXPECT_TRUE(budgeted.Undo());
+    EXPECT_EQ(budgeted.GetUndoDescription(), "Add 2");
+}
+
+TEST(CommandHistoryBudgetTest, RingBufferKeepsNewestCommandsInOrder)
+{
+    int counter = 0;
+    CommandHistory ring(3);
+
+    for (int i = 1; i <= 7; ++i)
+    {
+        ring.ExecuteCommand(std::make_unique<MockCommand>(counter, i, "Add " + std::to_string(i)));
+    }
+    EXPECT_EQ(ring.GetHistorySize(), 3u);
+
+    EXPECT_EQ(ring.GetUndoDescription(), "Add 7");
+    EXPECT_TRUE(ring.Undo());
+    EXPECT_TRUE(ring.Undo());
+    EXPECT_EQ(ring.GetUndoDescription(), "Add 5");
+
+    // New command after undo replaces the redo steps and wraps the ring again
+    ring.ExecuteCommand(std::make_unique<MockCommand>(counter, 10, "Add 10"));
+    ring.ExecuteCommand(std::make_unique<MockCommand>(counter, 11, "Add 11"));
+    EXPECT_EQ(ring.GetHistorySize(), 3u);
+    EXPECT_FALSE(ring.CanRedo());
+
+    EXPECT_TRUE(ring.Undo());
+    EXPECT_TRUE(ring.Undo());
+    EXPECT_TRUE(ring.Undo());
+    EXPECT_FALSE(ring.Undo());
+    EXPECT_EQ(ring.GetRedoDescription(), "Add 5");
+    EXPECT_EQ(counter, 1 + 2 + 3 + 4);
+}
+
+TEST(CommandHistoryMergeTest, ConsecutiveCompatibleCommandsFormOneStep)
+{
+    int value = 0;
+    CommandHistory merging;
+
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 0, 5));
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 5, 6));
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 6, 7));
+    EXPECT_EQ(merging.GetHistorySize(), 1u);
+    EXPECT_EQ(value, 7);
+
+    // A different key starts a new step
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 2, 7, 8));
+    EXPECT_EQ(merging.GetHistorySize(), 2u);
+
+    EXPECT_TRUE(merging.Undo());
+    EXPECT_TRUE(merging.Undo());
+    EXPECT_EQ(value, 0);
+}
+
+TEST(CommandHistoryMergeTest, SealedOrUndoneCommandsDoNotMerge)
+{
+    int value = 0;
+    CommandHistory merging;
+
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 0, 5));
+    merging.SealLastCommand();
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 5, 6));
+    EXPECT_EQ(merging.GetHistorySize(), 2u);
+
+    // After undo the newest step is a redo step; the new command replaces it instead of merging
+    EXPECT_TRUE(merging.Undo());
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 5, 9));
+    EXPECT_EQ(merging.GetHistorySize(), 2u);
+    EXPECT_TRUE(merging.Undo());
+    EXPECT_EQ(value, 5);
+}
+
+TEST(CommandHistoryMergeTest, RevisionAdvancesOnEveryChangeIncludingMerges)
+{
+    int value = 0;
+    CommandHistory merging;
+    EXPECT_EQ(merging.GetRevision(), 0u);
+
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 0, 5));
+    merging.ExecuteCommand(std::make_unique<MergingCommand>(value, 1, 5, 6));
+    EXPECT_EQ(merging.GetRevision(), 2u);
+
+    EXPECT_TRUE(merging.Undo());
+    EXPECT_TRUE(merging.Redo());
+    EXPECT_FALSE(merging.Redo());
+    EXPECT_EQ(merging.GetRevision(), 4u);
+
+    merging.Clear();
+    EXPECT_EQ(merging.GetRevision(), 4u);
+}
@@ -0,0 +1,464 @@
+#include "CLI/CommandLineOptions.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    std::optional<CLI::CommandLineOptions> Parse(std::vector<std::string_view> args, std::string &error)
+    {
+        return CLI::ParseCommandLine(args, error);
+    }
+
+    // Parameter-only node for --set conversions
+    class ParameterNode : public Nodes::Node
+    {
+    public:
+        ParameterNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Threshold", 127.0);
+            CreateInputSlot("KernelSize", 3);
+            CreateInputSlot("Invert", false);
+            CreateInputSlot("Mode", std::string{ "open" });
+        }
+
+        std::string GetType() const override
+        {
+            return "ParameterNode";
+        }
+
+        void Process() override
+        {
+        }
+    };
+} // namespace
+
+// ============================================================================
+// Parsing Tests
+// ============================================================================
+
+TEST(CommandLineOptionsTest, ParsesGraphAndOverrides)
+{
+    std::string error;
+    const auto options =
+        Parse({ "graph.json", "-i", "in.png", "--output", "4=out/result.png", "-s", "2.Threshold=90", "-j", "3" }, error);
+
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->graphPath, "graph.json");
+
+    ASSERT_EQ(options->inputs.size(), 1);
+    EXPECT_FALSE(options->inputs[0].nodeId.has_value());
+    EXPECT_EQ(options->inputs[0].path, "in.png");
+
+    ASSERT_EQ(options->outputs.size(), 1);
+    EXPECT_EQ(options->outputs[0].nodeId, 4);
+    EXPECT_EQ(options->outputs[0].path, "out/result.png");
+
+    ASSERT_EQ(options->parameters.size(), 1);
+    EXPECT_EQ(options->parameters[0].nodeId, 2);
+    EXPECT_EQ(options->parameters[0].slotName, "Threshold");
+    EXPECT_EQ(options->parameters[0].value, "90");
+
+    EXPECT_TRUE(options->parallel);
+    EXPECT_EQ(options->workerCount, 3);
+}
+
+TEST(CommandLineOptionsTest, PathWithEqualsSignIsNotMistakenForId)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "-i", "images/a=b.png" }, error);
+
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_FALSE(options->inputs[0].nodeId.has_value());
+    EXPECT_EQ(options->inputs[0].path, "images/a=b.png");
+}
+
+TEST(CommandLineOptionsTest, HelpNeedsNoGraph)
+{
+    std::string error;
+    const auto options = Parse({ "--help" }, error);
+
+    ASSERT_TRUE(options.has_value());
+    EXPECT_TRUE(options->showHelp);
+}
+
+TEST(CommandLineOptionsTest, RejectsInvalidArguments)
+{
+    std::string error;
+    EXPECT_FALSE(Parse({}, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--input" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--bogus" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "other.json" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "-s", "Threshold=3" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "-j", "many" }, error).has_value());
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(CommandLineOptionsTest, ParsesBatchAndStreamModes)
+{
+    std::string error;
+    const auto batch = Parse({ "graph.json", "-b", "1=photos", "--batch-output", "results", "-r" }, error);
+    ASSERT_TRUE(batch.has_value()) << error;
+    EXPECT_EQ(batch->batchInput->nodeId, 1);
+    EXPECT_EQ(batch->batchOutput->path, "results");
+    EXPECT_TRUE(batch->recursive);
+
+    const auto stream = Parse({ "graph.json", "--video", "clip.mp4", "--frames", "30" }, error);
+    ASSERT_TRUE(stream.has_value()) << error;
+    EXPECT_TRUE(stream->stream);
+    EXPECT_EQ(stream->maxFrames, 30);
+    ASSERT_EQ(stream->videos.size(), 1);
+    EXPECT_EQ(stream->videos[0].path, "clip.mp4");
+
+    EXPECT_FALSE(Parse({ "graph.json", "--batch", "photos" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--frames", "0" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--stream", "-b", "a", "--batch-output", "b" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesFarmModes)
+{
+    std::string error;
+    const auto coordinator =
+        Parse({ "graph.json", "-b", "in", "--batch-output", "out", "--farm-coordinator", "job", "--shard-size", "16" },
+            error);
+    ASSERT_TRUE(coordinator.has_value()) << error;
+    EXPECT_EQ(coordinator->farmCoordinator, "job");
+    EXPECT_EQ(coordinator->shardFiles, 16);
+
+    // Workers get graph and batch settings from the job
+    const auto worker = Parse({ "--farm-worker", "job", "--worker-name", "node7", "-p" }, error);
+    ASSERT_TRUE(worker.has_value()) << error;
+    EXPECT_EQ(worker->farmWorker, "job");
+    EXPECT_EQ(worker->workerName, "node7");
+    EXPECT_TRUE(worker->parallel);
+
+    EXPECT_FALSE(Parse({ "graph.json", "--farm-coordinator", "job" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--farm-worker", "job" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--farm-worker", "job", "--farm-coordinator", "job" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--farm-worker", "job", "--shard-size", "0" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesManifestPath)
+{
+    std::string error;
+    const auto options =
+        Parse({ "graph.json", "-b", "in", "--batch-output", "out", "--manifest", "job.manifest" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->manifestPath, "job.manifest");
+
+    EXPECT_FALSE(Parse({ "graph.json", "--manifest", "job.manifest" }, error).has_value());
+    EXPECT_FALSE(
+        Parse({ "graph.json", "-b", "in", "--batch-output", "out", "--farm-coordinator", "job", "--manifest", "m" },
+            error)
+            .has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesServe)
+{
+    std::string error;
+    auto options = Parse({ "graph.json", "--serve", "9000", "--instances", "4" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    ASSERT_TRUE(options->server.has_value());
+    EXPECT_EQ(options->server->address, "127.0.0.1");
+    EXPECT_EQ(options->server->port, 9000);
+    EXPECT_EQ(options->server->instances, 4);
+
+    options = Parse({ "graph.json", "--serve", "0.0.0.0:8081" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->server->address, "0.0.0.0");
+    EXPECT_EQ(options->server->port, 8081);
+
+    EXPECT_FALSE(Parse({ "graph.json" }, error)->server.has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--serve", "host:port" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--instances", "2" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--serve", "9000", "--stream" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--serve", "9000", "-b", "in", "--batch-output", "out" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesTracePath)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--trace", "run.json" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->tracePath, "run.json");
+
+    EXPECT_TRUE(Parse({ "graph.json" }, error)->tracePath.empty());
+    EXPECT_FALSE(Parse({ "graph.json", "--trace" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesMetricsFile)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--metrics-file", "runner.prom", "--metrics-interval", "5" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->metricsPath, "runner.prom");
+    EXPECT_EQ(options->metricsInterval, std::chrono::seconds(5));
+
+    EXPECT_EQ(Parse({ "graph.json", "--metrics-file", "runner.prom" }, error)->metricsInterval.count(), 0);
+    EXPECT_FALSE(Parse({ "graph.json", "--metrics-interval", "5" }, error).has_value());
+    EXPECT_FALSE(
+        Parse({ "graph.json", "--metrics-file", "runner.prom", "--metrics-interval", "0" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesCacheDirectory)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--cache-dir", "results" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->cacheDirectory, "results");
+
+    EXPECT_TRUE(Parse({ "graph.json" }, error)->cacheDirectory.empty());
+    EXPECT_FALSE(Parse({ "graph.json", "--cache-dir" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesTileSize)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--tile-size", "256" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->tileSize, 256);
+
+    EXPECT_EQ(Parse({ "graph.json" }, error)->tileSize, 0);
+    EXPECT_FALSE(Parse({ "graph.json", "--tile-size", "0" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--tile-size", "-8" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesTimeout)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--timeout", "1500" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->timeout, std::chrono::milliseconds(1500));
+
+    EXPECT_EQ(Parse({ "graph.json" }, error)->timeout, std::chrono::milliseconds::zero());
+    EXPECT_FALSE(Parse({ "graph.json", "--timeout", "0" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--timeout", "soon" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesOpenCL)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--opencl" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_TRUE(options->opencl);
+
+    EXPECT_FALSE(Parse({ "graph.json" }, error)->opencl);
+}
+
+TEST(CommandLineOptionsTest, ParsesPrecisionPolicy)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--precision", "16" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->precision, Nodes::PrecisionPolicy::Prefer16);
+
+    EXPECT_EQ(Parse({ "graph.json" }, error)->precision, Nodes::PrecisionPolicy::Native);
+    EXPECT_EQ(Parse({ "graph.json", "--precision", "8u" }, error)->precision, Nodes::PrecisionPolicy::Prefer8U);
+    EXPECT_FALSE(Parse({ "graph.json", "--precision", "fp16" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--precision" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesPinThreads)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "-j", "4", "--pin-threads" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_TRUE(options->pinThreads);
+    EXPECT_EQ(options->workerCount, 4u);
+
+    EXPECT_FALSE(Parse({ "graph.json" }, error)->pinThreads);
+}
+
+TEST(CommandLineOptionsTest, ParsesNuma)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--numa" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_TRUE(options->numaAware);
+
+    EXPECT_FALSE(Parse({ "graph.json" }, error)->numaAware);
+}
+
+TEST(CommandLineOptionsTest, ParsesMemoryBudget)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--memory-budget", "512", "--scratch-dir", "/scratch" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->memoryBudgetBytes, 512ull * 1024 * 1024);
+    EXPECT_EQ(options->scratchDirectory, "/scratch");
+
+    EXPECT_EQ(Parse({ "graph.json" }, error)->memoryBudgetBytes, 0u);
+    EXPECT_FALSE(Parse({ "graph.json", "--memory-budget", "0" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--scratch-dir", "/scratch" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesMaxCores)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--max-cores", "6" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_EQ(options->maxCores, 6u);
+    EXPECT_FALSE(options->parallel);
+
+    EXPECT_EQ(Parse({ "graph.json" }, error)->maxCores, 0u);
+    EXPECT_FALSE(Parse({ "graph.json", "--max-cores", "0" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--max-cores", "many" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesCuda)
+{
+    std::string error;
+    const auto options = Parse({ "graph.json", "--cuda" }, error);
+    ASSERT_TRUE(options.has_value()) << error;
+    EXPECT_TRUE(options->cuda);
+
+    EXPECT_FALSE(Parse({ "graph.json" }, error)->cuda);
+}
+
+// ============================================================================
+// Override Tests
+// ============================================================================
+
+TEST(CommandLineOptionsTest, AppliesPathsToOnlyInputAndOutput)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+    editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(2));
+
+    std::string error;
+    const auto options = Parse({ "graph.json", "-i", "in.png", "-o", "out.png" }, error);
+    ASSERT_TRUE(options.has_value());
+    ASSERT_TRUE(CLI::ApplyOverrides(editor, *options, error)) << error;
+
+    EXPECT_EQ(editor.GetNode(1)->GetInputValue<std::filesystem::path>("FilePath"), std::filesystem::path("in.png"));
+    EXPECT_EQ(editor.GetNode(2)->GetInputValue<std::filesystem::path>("SavePath"), std::filesystem::path("out.png"));
+    EXPECT_EQ(editor.GetNode(2)->GetInputValue<bool>("AutoSave"), true);
+}
+
+TEST(CommandLineOptionsTest, AmbiguousInputRequiresId)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(2));
+
+    std::string error;
+    auto options = Parse({ "graph.json", "-i", "in.png" }, error);
+    ASSERT_TRUE(options.has_value());
+    EXPECT_FALSE(CLI::ApplyOverrides(editor, *options, error));
+
+    options = Parse({ "graph.json", "-i", "2=in.png" }, error);
+    ASSERT_TRUE(options.has_value());
+    ASSERT_TRUE(CLI::ApplyOverrides(editor, *options, error)) << error;
+    EXPECT_EQ(editor.GetNode(2)->GetInputValue<std::filesystem::path>("FilePath"), std::filesystem::path("in.png"));
+}
+
+TEST(CommandLineOptionsTest, ParametersUseSlotType)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ParameterNode>(7, "Params"));
+
+    std::string error;
+    const auto options = Parse({ "graph.json",
+                                   "-s",
+                                   "7.Threshold=42.5",
+                                   "-s",
+                                   "7.KernelSize=5",
+                                   "-s",
+                                   "7.Invert=true",
+                                   "-s",
+                                   "7.Mode=close" },
+        error);
+    ASSERT_TRUE(options.has_value()) << error;
+    ASSERT_TRUE(CLI::ApplyOverrides(editor, *options, error)) << error;
+
+    const auto *node = editor.GetNode(7);
+    EXPECT_DOUBLE_EQ(node->GetInputValue<double>("Threshold").value_or(0.0), 42.5);
+    EXPECT_EQ(node->GetInputValue<int>("KernelSize"), 5);
+    EXPECT_EQ(node->GetInputValue<bool>("Invert"), true);
+    EXPECT_EQ(node->GetInputValue<std::string>("Mode"), "close");
+}
+
+TEST(CommandLineOptionsTest, RejectsUnknownSlotOrBadValue)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ParameterNode>(7, "Params"));
+
+    std::string error;
+    auto options = Parse({ "graph.json", "-s", "7.Missing=1" }, error);
+    ASSERT_TRUE(options.has_value());
+    EXPECT_FALSE(CLI::ApplyOverrides(editor, *options, error));
+
+    options = Parse({ "graph.json", "-s", "7.KernelSize=large" }, error);
+    ASSERT_TRUE(options.has_value());
+    EXPECT_FALSE(CLI::ApplyOverrides(editor, *options, error));
+
+    options = Parse({ "graph.json", "-s", "99.KernelSize=3" }, error);
+    ASSERT_TRUE(options.has_value());
+    EXPECT_FALSE(CLI::ApplyOverrides(editor, *options, error));
+}
+
+TEST(CommandLineOptionsTest, ParsesRecordAndReplay)
+{
+    std::string error;
+    const auto record = Parse({ "graph.json", "--record", "bundle", "--runs", "9", "--hash-inputs" }, error);
+    ASSERT_TRUE(record.has_value()) << error;
+    EXPECT_EQ(record->recordBundle, "bundle");
+    EXPECT_EQ(record->timedRuns, 9);
+    EXPECT_TRUE(record->hashInputsOnly);
+
+    // Replays get the graph and inputs from the bundle
+    const auto replay = Parse({ "--replay", "bundle", "--slowdown", "12.5", "-p" }, error);
+    ASSERT_TRUE(replay.has_value()) << error;
+    EXPECT_EQ(replay->replayBundle, "bundle");
+    EXPECT_DOUBLE_EQ(replay->slowdownPercent, 12.5);
+    EXPECT_TRUE(replay->parallel);
+
+    EXPECT_FALSE(Parse({ "graph.json", "--replay", "bundle" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--replay", "bundle", "-i", "a.png" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--replay", "bundle", "--hash-inputs" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--record", "bundle", "--slowdown", "10" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--record", "bundle", "--stream" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--runs", "3" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--record", "bundle", "--runs", "0" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesAutotune)
+{
+    std::string error;
+    const auto autotune =
+        Parse({ "graph.json", "--autotune", "--runs", "2", "--tuning-profile", "tuning.json" }, error);
+    ASSERT_TRUE(autotune.has_value()) << error;
+    EXPECT_TRUE(autotune->autotune);
+    EXPECT_EQ(autotune->timedRuns, 2);
+    EXPECT_EQ(autotune->tuningProfile, "tuning.json");
+
+    const auto ignored = Parse({ "graph.json", "--no-tuning-profile" }, error);
+    ASSERT_TRUE(ignored.has_value()) << error;
+    EXPECT_TRUE(ignored->ignoreTuningProfile);
+
+    EXPECT_FALSE(Parse({ "graph.json", "--autotune", "--no-tuning-profile" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--autotune", "--record", "bundle" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--autotune", "--stream" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--replay", "bundle", "--autotune" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--tuning-profile" }, error).has_value());
+}
+
+TEST(CommandLineOptionsTest, ParsesExportCpp)
+{
+    std::string error;
+    const auto exported = Parse({ "graph.json", "--export-cpp", "generated", "--set", "2.Threshold=90" }, error);
+    ASSERT_TRUE(exported.has_value()) << error;
+    EXPECT_EQ(exported->exportDirectory, "generated");
+    ASSERT_EQ(exported->parameters.size(), 1u);
+
+    EXPECT_FALSE(Parse({ "graph.json", "--export-cpp" }, error).has_value());
+    EXPECT_FALSE(Parse({ "--export-cpp", "generated" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--export-cpp", "generated", "--autotune" }, error).has_value());
+    EXPECT_FALSE(Parse({ "graph.json", "--export-cpp", "generated", "--stream" }, error).has_value());
+}
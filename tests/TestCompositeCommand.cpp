@@ -0,0 +1,99 @@
+#include "Editor/Commands/CompositeCommand.h"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft::Editor::Commands;
+
+namespace
+{
+    // Appends "+name" on execute and "-name" on undo
+    class RecordingCommand : public Command
+    {
+    public:
+        RecordingCommand(std::string name, std::vector<std::string> &log, size_t bytes = 0)
+            : name(std::move(name)), log(log), bytes(bytes)
+        {
+        }
+
+        void Execute() override
+        {
+            log.push_back("+" + name);
+        }
+
+        void Undo() override
+        {
+            log.push_back("-" + name);
+        }
+
+        [[nodiscard]] std::string GetDescription() const override
+        {
+            return name;
+        }
+
+        [[nodiscard]] size_t GetMemoryFootprint() const override
+        {
+            return bytes;
+        }
+
+        void ReleaseMemory() override
+        {
+            bytes = 0;
+        }
+
+    private:
+        std::string name;
+        std::vector<std::string> &log;
+        size_t bytes;
+    };
+} // namespace
+
+class CompositeCommandTest : public ::testing::Test
+{
+protected:
+    std::unique_ptr<CompositeCommand> MakeComposite(CompositeCommand::BatchScope batchScope = nullptr)
+    {
+        std::vector<std::unique_ptr<Command>> parts;
+        parts.push_back(std::make_unique<RecordingCommand>("a", log, 100));
+        parts.push_back(std::make_unique<RecordingCommand>("b", log));
+        parts.push_back(std::make_unique<RecordingCommand>("c", log, 20));
+        return std::make_unique<CompositeCommand>("Paste 3 Nodes", std::move(parts), std::move(batchScope));
+    }
+
+    std::vector<std::string> log;
+};
+
+TEST_F(CompositeCommandTest, UndoRevertsPartsInReverseOrder)
+{
+    auto composite = MakeComposite();
+    composite->Execute();
+    composite->Undo();
+    composite->Execute();
+
+    EXPECT_EQ(log, (std::vector<std::string>{ "+a", "+b", "+c", "-c", "-b", "-a", "+a", "+b", "+c" }));
+    EXPECT_EQ(composite->GetDescription(), "Paste 3 Nodes");
+}
+
+TEST_F(CompositeCommandTest, BatchScopeWrapsEveryExecuteAndUndo)
+{
+    auto composite = MakeComposite([this](const std::function<void()> &body) {
+        log.push_back("begin");
+        body();
+        log.push_back("commit");
+    });
+    composite->Execute();
+    composite->Undo();
+
+    EXPECT_EQ(log,
+        (std::vector<std::string>{ "begin", "+a", "+b", "+c", "commit", "begin", "-c", "-b", "-a", "commit" }));
+}
+
+TEST_F(CompositeCommandTest, FootprintAndReleaseCoverAllParts)
+{
+    auto composite = MakeComposite();
+    EXPECT_EQ(composite->GetMemoryFootprint(), 120u);
+    composite->ReleaseMemory();
+    EXPECT_EQ(composite->GetMemoryFootprint(), 0u);
+}
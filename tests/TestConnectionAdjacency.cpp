@@ -0,0 +1,90 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "UI/Canvas/ConnectionManager.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/IO/PreviewNode.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace VisionCraft;
+
+class ConnectionAdjacencyTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        nodeEditor.SetConnectionObserver(
+            [this](const Nodes::ConnectionDelta &delta) { connectionManager.ApplyConnectionDelta(delta); });
+        nodeEditor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(1));
+        nodeEditor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(2));
+        for (Nodes::NodeId id = 3; id <= 5; ++id)
+        {
+            nodeEditor.AddNode(std::make_unique<Vision::IO::PreviewNode>(id));
+        }
+    }
+
+    bool Connect(Nodes::NodeId from, Nodes::NodeId to)
+    {
+        return connectionManager.CreateConnection({ from, "Output" }, { to, "Input" }, nodeEditor);
+    }
+
+    [[nodiscard]] bool HasConnection(Nodes::NodeId from, Nodes::NodeId to) const
+    {
+        const UI::Widgets::NodeConnection connection{ { from, "Output" }, { to, "Input" } };
+        return std::ranges::find(connectionManager.GetConnections(), connection)
+               != connectionManager.GetConnections().end();
+    }
+
+    Nodes::NodeEditor nodeEditor;
+    UI::Canvas::ConnectionManager connectionManager;
+};
+
+TEST_F(ConnectionAdjacencyTest, ConnectingInputReplacesItsPreviousConnection)
+{
+    ASSERT_TRUE(Connect(1, 3));
+    EXPECT_TRUE(connectionManager.IsPinConnected({ 1, "Output" }));
+    EXPECT_TRUE(connectionManager.IsPinConnected({ 3, "Input" }));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 3, "Output" }));
+
+    ASSERT_TRUE(Connect(2, 3));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 1, "Output" }));
+    EXPECT_TRUE(connectionManager.IsPinConnected({ 2, "Output" }));
+    EXPECT_EQ(connectionManager.GetConnections().size(), 1u);
+    EXPECT_TRUE(HasConnection(2, 3));
+}
+
+TEST_F(ConnectionAdjacencyTest, RemovingNodeKeepsUnrelatedConnections)
+{
+    ASSERT_TRUE(Connect(1, 3));
+    ASSERT_TRUE(Connect(1, 4));
+    ASSERT_TRUE(Connect(2, 5));
+
+    ASSERT_TRUE(nodeEditor.RemoveNode(1));
+    EXPECT_EQ(connectionManager.GetConnections().size(), 1u);
+    EXPECT_TRUE(HasConnection(2, 5));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 1, "Output" }));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 3, "Input" }));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 4, "Input" }));
+    EXPECT_TRUE(connectionManager.IsPinConnected({ 5, "Input" }));
+}
+
+TEST_F(ConnectionAdjacencyTest, RemovingOneFanOutConnectionKeepsTheOthers)
+{
+    ASSERT_TRUE(Connect(1, 3));
+    ASSERT_TRUE(Connect(1, 4));
+    ASSERT_TRUE(Connect(1, 5));
+
+    connectionManager.RemoveConnection({ { 1, "Output" }, { 3, "Input" } }, nodeEditor);
+    connectionManager.RemoveConnection({ { 1, "Output" }, { 3, "Input" } }, nodeEditor); // Already gone: no-op
+    EXPECT_EQ(connectionManager.GetConnections().size(), 2u);
+    EXPECT_TRUE(HasConnection(1, 4));
+    EXPECT_TRUE(HasConnection(1, 5));
+    EXPECT_TRUE(connectionManager.IsPinConnected({ 1, "Output" }));
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 3, "Input" }));
+
+    connectionManager.RemoveConnection({ { 1, "Output" }, { 5, "Input" } }, nodeEditor);
+    connectionManager.RemoveConnection({ { 1, "Output" }, { 4, "Input" } }, nodeEditor);
+    EXPECT_TRUE(connectionManager.GetConnections().empty());
+    EXPECT_FALSE(connectionManager.IsPinConnected({ 1, "Output" }));
+}
@@ -0,0 +1,212 @@
+#include "Nodes/Core/ContourSet.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+#include "Vision/Algorithms/DrawContoursNode.h"
+#include "Vision/Algorithms/FilterContoursNode.h"
+#include "Vision/Algorithms/FindContoursNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    using Contours = std::vector<std::vector<cv::Point>>;
+
+    std::vector<cv::Point> ToVector(std::span<const cv::Point> contour)
+    {
+        return { contour.begin(), contour.end() };
+    }
+
+    // Black image with filled squares of the given sides along the top, 10 pixels apart
+    cv::Mat MakeSquares(const std::vector<int> &sides)
+    {
+        cv::Mat image = cv::Mat::zeros(64, 200, CV_8UC1);
+        int x = 2;
+        for (const int side : sides)
+        {
+            cv::rectangle(image, cv::Rect(x, 2, side, side), cv::Scalar(255), cv::FILLED);
+            x += side + 10;
+        }
+        return image;
+    }
+
+    Nodes::ContourSet FindContours(const cv::Mat &image)
+    {
+        Vision::Algorithms::FindContoursNode node(1);
+        node.SetInputSlotData("Input", image);
+        node.Process();
+        return node.GetOutputSlot("Contours").GetData<Nodes::ContourSet>().value_or(Nodes::ContourSet{});
+    }
+} // namespace
+
+TEST(ContourSetTest, FlattensContoursIntoOneBuffer)
+{
+    const Contours contours{ { { 0, 0 }, { 4, 0 }, { 4, 4 } }, {}, { { 7, 8 } } };
+    const auto set = Nodes::ContourSet::FromContours(contours);
+
+    ASSERT_EQ(set.GetCount(), 3u);
+    EXPECT_EQ(set.GetPointCount(), 4u);
+    EXPECT_EQ(ToVector(set.GetContour(0)), contours[0]);
+    EXPECT_TRUE(set.GetContour(1).empty());
+    EXPECT_EQ(ToVector(set.GetContour(2)), contours[2]);
+
+    // Count, four offsets and four x,y pairs in a single row
+    EXPECT_EQ(set.GetStorage().rows, 1);
+    EXPECT_EQ(set.GetStorage().total(), 1u + 4u + 8u);
+    EXPECT_TRUE(set.GetContourMat(1).empty());
+    EXPECT_EQ(set.GetContourMat(0).type(), CV_32SC2);
+}
+
+TEST(ContourSetTest, EmptySetsAreValid)
+{
+    EXPECT_TRUE(Nodes::ContourSet{}.IsEmpty());
+    EXPECT_EQ(Nodes::ContourSet{}.GetPointCount(), 0u);
+
+    const auto set = Nodes::ContourSet::FromContours({});
+    EXPECT_TRUE(set.IsEmpty());
+    EXPECT_FALSE(set.GetStorage().empty());
+}
+
+TEST(ContourSetTest, SelectionSharesThePointBuffer)
+{
+    const Contours contours{ { { 1, 1 } }, { { 2, 2 }, { 3, 3 } }, { { 4, 4 } } };
+    const auto set = Nodes::ContourSet::FromContours(contours);
+
+    const std::vector<int> keep{ 2, 0 };
+    const auto selected = set.Select(keep);
+    ASSERT_EQ(selected.GetCount(), 2u);
+    EXPECT_EQ(selected.GetStorage().data, set.GetStorage().data);
+    EXPECT_EQ(ToVector(selected.GetContour(0)), contours[2]);
+    EXPECT_EQ(ToVector(selected.GetContour(1)), contours[0]);
+
+    // Selecting from a selection indexes the selection, not the buffer
+    const std::vector<int> second{ 1 };
+    EXPECT_EQ(ToVector(selected.Select(second).GetContour(0)), contours[0]);
+
+    // Nothing selected is an empty set, not the whole buffer
+    EXPECT_TRUE(set.Select({}).IsEmpty());
+
+    const std::vector<int> outOfRange{ 3 };
+    EXPECT_THROW(static_cast<void>(set.Select(outOfRange)), std::out_of_range);
+}
+
+TEST(ContourSetTest, CompactCopiesOnlyTheSelection)
+{
+    const Contours contours{ { { 1, 1 } }, { { 2, 2 }, { 3, 3 } }, { { 4, 4 } } };
+    const std::vector<int> keep{ 1 };
+    const auto compact = Nodes::ContourSet::FromContours(contours).Select(keep).Compact();
+
+    EXPECT_TRUE(compact.GetSelection().empty());
+    ASSERT_EQ(compact.GetCount(), 1u);
+    EXPECT_EQ(ToVector(compact.GetContour(0)), contours[1]);
+    EXPECT_EQ(compact.GetStorage().total(), 1u + 2u + 4u);
+}
+
+TEST(ContourSetTest, FromStorageRejectsInconsistentBuffers)
+{
+    const auto set = Nodes::ContourSet::FromContours({ { { 1, 2 }, { 3, 4 } } });
+    EXPECT_EQ(ToVector(Nodes::ContourSet::FromStorage(set.GetStorage()).GetContour(0)), ToVector(set.GetContour(0)));
+
+    cv::Mat truncated = set.GetStorage().colRange(0, 4).clone();
+    EXPECT_THROW(static_cast<void>(Nodes::ContourSet::FromStorage(truncated)), std::invalid_argument);
+
+    cv::Mat descending = set.GetStorage().clone();
+    descending.at<int>(0, 1) = 3;
+    EXPECT_THROW(static_cast<void>(Nodes::ContourSet::FromStorage(descending)), std::invalid_argument);
+
+    EXPECT_THROW(static_cast<void>(Nodes::ContourSet::FromStorage(cv::Mat(1, 4, CV_8UC1))), std::invalid_argument);
+}
+
+TEST(ContourSetTest, FingerprintFollowsTheSelection)
+{
+    const auto set = Nodes::ContourSet::FromContours({ { { 1, 1 } }, { { 2, 2 } } });
+    const std::vector<int> both{ 0, 1 };
+    const std::vector<int> first{ 0 };
+    const std::vector<int> second{ 1 };
+
+    const auto copy = set.Select(both).Compact();
+    EXPECT_NE(copy.GetStorage().data, set.GetStorage().data);
+    EXPECT_EQ(Nodes::NodeOutputCache::Fingerprint(set), Nodes::NodeOutputCache::Fingerprint(copy));
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(set.Select(first)),
+        Nodes::NodeOutputCache::Fingerprint(set.Select(second)));
+}
+
+TEST(ContourSetTest, PersistentStoreKeepsTheSelectedContours)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "visioncraft_contour_set_test";
+    std::filesystem::remove_all(directory);
+    {
+        Nodes::PersistentOutputStore store(directory, 1024 * 1024);
+        const auto set = Nodes::ContourSet::FromContours({ { { 1, 1 } }, { { 2, 2 }, { 5, 6 } } });
+        const std::vector<int> keep{ 1 };
+        ASSERT_TRUE(store.Save(7, { std::make_shared<const Nodes::NodeData>(set.Select(keep)) }));
+
+        const auto loaded = store.Load(7);
+        ASSERT_TRUE(loaded);
+        const auto &restored = std::get<Nodes::ContourSet>(*(*loaded)[0]);
+        ASSERT_EQ(restored.GetCount(), 1u);
+        EXPECT_EQ(ToVector(restored.GetContour(0)), (std::vector<cv::Point>{ { 2, 2 }, { 5, 6 } }));
+    }
+    std::filesystem::remove_all(directory);
+}
+
+TEST(ContourNodesTest, FindContoursOutlinesEveryBlob)
+{
+    const auto contours = FindContours(MakeSquares({ 4, 8, 16 }));
+
+    ASSERT_EQ(contours.GetCount(), 3u);
+    double total = 0.0;
+    for (size_t i = 0; i < contours.GetCount(); ++i)
+    {
+        total += cv::contourArea(contours.GetContourMat(i));
+    }
+    // Contours run through the outer pixel centers, so each square of side s encloses (s - 1)^2
+    EXPECT_DOUBLE_EQ(total, 9.0 + 49.0 + 225.0);
+}
+
+TEST(ContourNodesTest, FilterKeepsContoursInRangeWithoutCopyingPoints)
+{
+    const auto contours = FindContours(MakeSquares({ 4, 8, 16 }));
+
+    Vision::Algorithms::FilterContoursNode filter(2);
+    filter.SetInputSlotData("Contours", contours);
+    filter.SetInputSlotData("MinArea", 20.0);
+    filter.SetInputSlotData("MaxArea", 100.0);
+    filter.Process();
+
+    const auto kept = filter.GetOutputSlot("Contours").GetData<Nodes::ContourSet>();
+    ASSERT_TRUE(kept);
+    ASSERT_EQ(kept->GetCount(), 1u);
+    EXPECT_DOUBLE_EQ(cv::contourArea(kept->GetContourMat(0)), 49.0);
+    EXPECT_EQ(kept->GetStorage().data, contours.GetStorage().data);
+    EXPECT_EQ(filter.GetOutputSlot("Count").GetData<int>(), 1);
+
+    filter.SetInputSlotData("MaxArea", 0.0);
+    filter.SetInputSlotData("MinPerimeter", 40.0);
+    filter.Process();
+    EXPECT_EQ(filter.GetOutputSlot("Count").GetData<int>(), 1); // Only the 16-pixel square: 4 * 15
+}
+
+TEST(ContourNodesTest, DrawContoursPaintsOverAColorCopy)
+{
+    const cv::Mat image = MakeSquares({ 8 });
+    Vision::Algorithms::DrawContoursNode draw(3);
+    draw.SetInputSlotData("Input", image);
+    draw.SetInputSlotData("Contours", FindContours(image));
+    draw.SetInputSlotData("Color", 0xFF0000);
+    draw.SetInputSlotData("Thickness", 1);
+    draw.Process();
+
+    const auto output = draw.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output);
+    ASSERT_EQ(output->type(), CV_8UC3);
+    EXPECT_EQ(output->at<cv::Vec3b>(2, 2), cv::Vec3b(0, 0, 255)); // Red in BGR on the outline
+    EXPECT_EQ(output->at<cv::Vec3b>(5, 5), cv::Vec3b(255, 255, 255));
+    EXPECT_EQ(image.at<uchar>(2, 2), 255); // Input untouched
+}
@@ -1,3 +1,5 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
 #include "Vision/Algorithms/CvtColorNode.h"
 #include "Vision/Algorithms/MergeChannelsNode.h"
 #include "Vision/Algorithms/ResizeNode.h"
@@ -6,6 +8,8 @@
 #include <gtest/gtest.h>
 
 using namespace VisionCraft;
+using Tests::Link;
+using Tests::SourceNode;
 
 class TestConversionNodes : public ::testing::Test
 {
@@ -67,13 +71,19 @@ TEST_F(TestConversionNodes, SplitMergeNodesProcessing)
     splitNode->SetInputSlotData("Input", inputImage);
     splitNode->Process();
 
-    auto c1Opt = splitNode->GetOutputSlot("Channel 1").GetData<cv::Mat>();
-    auto c2Opt = splitNode->GetOutputSlot("Channel 2").GetData<cv::Mat>();
-    auto c3Opt = splitNode->GetOutputSlot("Channel 3").GetData<cv::Mat>();
+    auto c1Opt = splitNode->GetOutputSlot("Channel 1").GetData<Nodes::ChannelView>();
+    auto c2Opt = splitNode->GetOutputSlot("Channel 2").GetData<Nodes::ChannelView>();
+    auto c3Opt = splitNode->GetOutputSlot("Channel 3").GetData<Nodes::ChannelView>();
 
     ASSERT_TRUE(c1Opt.has_value());
     ASSERT_TRUE(c2Opt.has_value());
     ASSERT_TRUE(c3Opt.has_value());
+    EXPECT_FALSE(splitNode->GetOutputSlot("Channel 4").HasData());
+
+    // Views share the input buffer
+    EXPECT_EQ(c2Opt->source.data, inputImage.data);
+    EXPECT_EQ(c2Opt->channel, 1);
+    EXPECT_EQ(c2Opt->Extract().at<uchar>(0, 0), 150);
 
     // Test Merge
     auto mergeNode = std::make_unique<Vision::Algorithms::MergeChannelsNode>(2);
@@ -92,4 +102,57 @@ TEST_F(TestConversionNodes, SplitMergeNodesProcessing)
 
     EXPECT_EQ(outputImage.channels(), 3);
     EXPECT_EQ(outputImage.size(), inputImage.size());
+
+    // All channels in their original order: the input comes back without a copy
+    EXPECT_EQ(outputImage.data, inputImage.data);
+}
+
+TEST_F(TestConversionNodes, MergeChannelsMixesViewsAndImages)
+{
+    auto mergeNode = std::make_unique<Vision::Algorithms::MergeChannelsNode>(1);
+    mergeNode->SetInputSlotData("Channel 1", Nodes::ChannelView{ .source = inputImage, .channel = 2 });
+    mergeNode->SetInputSlotData("Channel 2", cv::Mat(10, 10, CV_8UC1, cv::Scalar(7)));
+    mergeNode->SetInputSlotData("Channel 3", Nodes::ChannelView{ .source = inputImage, .channel = 0 });
+    mergeNode->Process();
+
+    const auto output = mergeNode->GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    ASSERT_EQ(output->type(), CV_8UC3);
+    EXPECT_NE(output->data, inputImage.data);
+    const auto *pixel = output->ptr<uchar>(9) + 3 * 9;
+    EXPECT_EQ(pixel[0], 200);
+    EXPECT_EQ(pixel[1], 7);
+    EXPECT_EQ(pixel[2], 100);
+}
+
+TEST_F(TestConversionNodes, ChannelViewsReachOnlyNodesThatAcceptThem)
+{
+    // Split -> Resize (reads images) -> Merge, with the other two channels passed straight to Merge
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<SourceNode>(4, inputImage));
+    editor.AddNode(std::make_unique<Vision::Algorithms::SplitChannelsNode>(1));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ResizeNode>(2));
+    editor.AddNode(std::make_unique<Vision::Algorithms::MergeChannelsNode>(3));
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(1, "Channel 1", 3, "Channel 1");
+    editor.AddConnection(1, "Channel 2", 2, "Input");
+    editor.AddConnection(2, "Output", 3, "Channel 2");
+    editor.AddConnection(1, "Channel 3", 3, "Channel 3");
+    Link(editor, 4, 1);
+
+    ASSERT_TRUE(editor.Execute());
+
+    const auto resized = editor.GetNode(2)->GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(resized.has_value());
+    EXPECT_EQ(resized->type(), CV_8UC1);
+    EXPECT_EQ(resized->at<uchar>(0, 0), 150);
+
+    const auto merged = editor.GetNode(3)->GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(merged.has_value());
+    ASSERT_EQ(merged->type(), CV_8UC3);
+    const auto *pixel = merged->ptr<uchar>(0);
+    EXPECT_EQ(pixel[0], 100);
+    EXPECT_EQ(pixel[1], 150);
+    EXPECT_EQ(pixel[2], 200);
 }
@@ -0,0 +1,98 @@
+#include "UI/Rendering/CostOverlay.h"
+#include "UI/Widgets/NodeEditorConstants.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <vector>
+
+using namespace VisionCraft;
+using namespace std::chrono_literals;
+using UI::Rendering::CostOverlay;
+using UI::Rendering::CostOverlayMode;
+
+namespace
+{
+    Nodes::NodeExecutionRecord Step(Nodes::NodeId id, std::chrono::microseconds duration, size_t outputBytes = 0)
+    {
+        Nodes::NodeExecutionRecord record;
+        record.nodeId = id;
+        record.outcome = Nodes::StepOutcome::Processed;
+        record.duration = duration;
+        record.outputBytes = outputBytes;
+        return record;
+    }
+
+    Nodes::Connection Wire(Nodes::NodeId from, Nodes::NodeId to)
+    {
+        return { .from = from, .fromSlot = "Output", .to = to, .toSlot = "Input" };
+    }
+
+    // Diamond 1 -> {2, 3} -> 4 with the slow branch through 3, plus an unconnected node 5
+    Nodes::RunStatistics DiamondRun()
+    {
+        Nodes::RunStatistics run;
+        run.nodes = { Step(1, 100us, 1000), Step(2, 50us, 1000), Step(3, 400us, 6000), Step(4, 100us, 2000),
+            Step(5, 300us) };
+        return run;
+    }
+
+    const std::vector<Nodes::Connection> kDiamond{ Wire(1, 2), Wire(1, 3), Wire(2, 4), Wire(3, 4) };
+} // namespace
+
+TEST(CostOverlayTest, CriticalPathFollowsSlowestChain)
+{
+    const auto path = CostOverlay::FindCriticalPath(DiamondRun(), kDiamond);
+    EXPECT_EQ(path, (std::vector<Nodes::NodeId>{ 1, 3, 4 }));
+}
+
+TEST(CostOverlayTest, CriticalPathIsEmptyWithoutTimedSteps)
+{
+    Nodes::RunStatistics run;
+    run.nodes = { Step(1, 0us), Step(2, 0us) };
+    const std::vector<Nodes::Connection> connections{ Wire(1, 2) };
+    EXPECT_TRUE(CostOverlay::FindCriticalPath(run, connections).empty());
+}
+
+TEST(CostOverlayTest, SharesAndHeatAreRelativeToTheRun)
+{
+    CostOverlay overlay;
+    overlay.SetMode(CostOverlayMode::Time);
+
+    Nodes::NodeTimingSummary summary;
+    summary.nodeId = 3;
+    summary.medianTime = 380us;
+    const std::vector<Nodes::NodeTimingSummary> summaries{ summary };
+    overlay.Update(summaries, DiamondRun(), kDiamond);
+
+    const auto *slowest = overlay.Find(3);
+    ASSERT_NE(slowest, nullptr);
+    EXPECT_FLOAT_EQ(slowest->timeShare, 400.0f / 950.0f);
+    EXPECT_FLOAT_EQ(slowest->timeHeat, 1.0f);
+    EXPECT_FLOAT_EQ(slowest->memoryShare, 0.6f);
+    EXPECT_EQ(slowest->medianTime, 380us);
+    EXPECT_TRUE(slowest->onCriticalPath);
+
+    const auto *isolated = overlay.Find(5);
+    ASSERT_NE(isolated, nullptr);
+    EXPECT_FLOAT_EQ(isolated->timeHeat, 0.75f);
+    EXPECT_FALSE(isolated->onCriticalPath);
+    EXPECT_EQ(overlay.Find(9), nullptr);
+
+    overlay.SetMode(CostOverlayMode::Memory);
+    EXPECT_FLOAT_EQ(overlay.Heat(*slowest), 1.0f);
+    EXPECT_FLOAT_EQ(overlay.Heat(*isolated), 0.0f);
+
+    overlay.SetMode(CostOverlayMode::Off);
+    EXPECT_EQ(overlay.Find(3), nullptr);
+}
+
+TEST(CostOverlayTest, TintKeepsColdNodesAndAlpha)
+{
+    const ImU32 base = Constants::Colors::Node::kBackground;
+    EXPECT_EQ(CostOverlay::Tint(base, 0.0f), base);
+
+    const ImU32 hot = CostOverlay::Tint(base, 1.0f);
+    EXPECT_NE(hot, base);
+    EXPECT_EQ(hot & IM_COL32_A_MASK, base & IM_COL32_A_MASK);
+    EXPECT_GT((hot >> IM_COL32_R_SHIFT) & 0xFF, (base >> IM_COL32_R_SHIFT) & 0xFF);
+}
@@ -0,0 +1,86 @@
+#include "Nodes/Core/CpuTopology.h"
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/ThreadPool.h"
+#include "gtest/gtest.h"
+
+#include <latch>
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Two nodes on core 0, so binding works on any machine
+    Nodes::CpuTopology TwoNodes()
+    {
+        return Nodes::CpuTopology({ { .id = 0, .cores = { 0 } }, { .id = 1, .cores = { 0 } } });
+    }
+} // namespace
+
+TEST(CpuTopologyTest, ParsesCpuLists)
+{
+    EXPECT_EQ(Nodes::CpuTopology::ParseCpuList("0-3,8-9\n"), (std::vector<size_t>{ 0, 1, 2, 3, 8, 9 }));
+    EXPECT_EQ(Nodes::CpuTopology::ParseCpuList("5"), (std::vector<size_t>{ 5 }));
+    EXPECT_TRUE(Nodes::CpuTopology::ParseCpuList("3-1").empty());
+    EXPECT_TRUE(Nodes::CpuTopology::ParseCpuList("a-b").empty());
+
+    // Detection always yields at least one node with cores
+    const auto &topology = Nodes::CpuTopology::Get();
+    ASSERT_GE(topology.GetNodeCount(), 1u);
+    EXPECT_FALSE(topology.GetNodes().front().cores.empty());
+}
+
+TEST(CpuTopologyTest, WorkersAreSpreadOverNodesInBlocks)
+{
+    Nodes::ThreadPool pool(4, TwoNodes());
+    EXPECT_EQ(pool.GetWorkerNode(0), 0u);
+    EXPECT_EQ(pool.GetWorkerNode(1), 0u);
+    EXPECT_EQ(pool.GetWorkerNode(2), 1u);
+    EXPECT_EQ(pool.GetWorkerNode(3), 1u);
+    EXPECT_FALSE(Nodes::ThreadPool(2).GetWorkerNode(0).has_value());
+
+    // A thread bound to node 1 only feeds node 1's workers
+    std::optional<size_t> ranOn[8];
+    std::latch done(8);
+    std::thread submitter([&]() {
+        TwoNodes().BindCurrentThread(1);
+        for (auto &node : ranOn)
+        {
+            pool.Submit([&node, &done]() {
+                node = Nodes::CpuTopology::GetCurrentNode();
+                done.count_down();
+            });
+        }
+    });
+    submitter.join();
+    done.wait();
+    for (const auto &node : ranOn)
+    {
+        EXPECT_EQ(node, 1u);
+    }
+}
+
+TEST(CpuTopologyTest, BuffersAreReusedOnTheirOwnNode)
+{
+    const auto pool = std::make_shared<Nodes::ImageBufferPool>(1024 * 1024);
+    const auto allocateOn = [&](size_t node) {
+        std::thread thread([&]() {
+            TwoNodes().BindCurrentThread(node);
+            cv::Mat image = pool->CreateImage();
+            image.create(64, 64, CV_8UC1);
+        });
+        thread.join();
+    };
+
+    allocateOn(0);
+    allocateOn(1); // Node 0's idle buffer is not handed across
+    EXPECT_EQ(pool->GetStatistics().allocated, 2u);
+    EXPECT_EQ(pool->GetStatistics().idleBuffers, 2u);
+
+    allocateOn(1);
+    EXPECT_EQ(pool->GetStatistics().reused, 1u);
+}
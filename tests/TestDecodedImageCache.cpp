@@ -0,0 +1,195 @@
+#include "Vision/IO/DecodedImageCache.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+class DecodedImageCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_decoded_image_cache_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+        imagePath = testDir / "input.png";
+        WriteImage(imagePath, 64, 64, 10);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    static void WriteImage(const std::filesystem::path &path, int rows, int cols, double value)
+    {
+        ASSERT_TRUE(cv::imwrite(path.string(), cv::Mat(rows, cols, CV_8UC3, cv::Scalar(value, value, value))));
+    }
+
+    std::filesystem::path testDir;
+    std::filesystem::path imagePath;
+};
+
+TEST_F(DecodedImageCacheTest, RepeatedLoadsShareOneDecode)
+{
+    Vision::IO::DecodedImageCache cache(1 << 20);
+    const cv::Mat first = cache.Load(imagePath);
+    ASSERT_FALSE(first.empty());
+
+    // Another spelling of the same file hits the same entry
+    const cv::Mat second = cache.Load(testDir / "." / "input.png");
+    EXPECT_EQ(second.data, first.data);
+    EXPECT_EQ(cache.GetStatistics().misses, 1u);
+    EXPECT_EQ(cache.GetStatistics().hits, 1u);
+    EXPECT_EQ(cache.GetUsedBytes(), first.total() * first.elemSize());
+
+    // Missing files are not cached
+    EXPECT_TRUE(cache.Load(testDir / "missing.png").empty());
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+}
+
+TEST_F(DecodedImageCacheTest, ChangedFileIsDecodedAgain)
+{
+    Vision::IO::DecodedImageCache cache(1 << 20);
+    const cv::Mat original = cache.Load(imagePath);
+    ASSERT_FALSE(original.empty());
+
+    WriteImage(imagePath, 32, 48, 200);
+    const cv::Mat edited = cache.Load(imagePath);
+    ASSERT_EQ(edited.rows, 32);
+    EXPECT_EQ(edited.ptr(0)[0], 200);
+    EXPECT_EQ(original.rows, 64); // Earlier results keep their own pixels
+    EXPECT_EQ(cache.GetStatistics().misses, 2u);
+    EXPECT_EQ(cache.GetEntryCount(), 1u);
+}
+
+TEST_F(DecodedImageCacheTest, EvictsLeastRecentlyUsedBeyondBudget)
+{
+    // 64x64 BGR is 12 KB; room for two
+    Vision::IO::DecodedImageCache cache(30000);
+    WriteImage(testDir / "b.png", 64, 64, 20);
+    WriteImage(testDir / "c.png", 64, 64, 30);
+
+    ASSERT_FALSE(cache.Load(imagePath).empty());
+    ASSERT_FALSE(cache.Load(testDir / "b.png").empty());
+    ASSERT_FALSE(cache.Load(imagePath).empty()); // b.png is now the oldest
+    ASSERT_FALSE(cache.Load(testDir / "c.png").empty());
+
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(cache.GetStatistics().evictions, 1u);
+    EXPECT_LE(cache.GetUsedBytes(), cache.GetByteBudget());
+
+    ASSERT_FALSE(cache.Load(imagePath).empty());
+    EXPECT_EQ(cache.GetStatistics().misses, 3u);
+
+    cache.SetByteBudget(0);
+    EXPECT_EQ(cache.GetEntryCount(), 0u);
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+}
+
+TEST_F(DecodedImageCacheTest, ConcurrentLoadsDecodeOnce)
+{
+    Vision::IO::DecodedImageCache cache(1 << 20);
+    std::vector<cv::Mat> results(8);
+    std::vector<std::thread> threads;
+    for (auto &result : results)
+    {
+        threads.emplace_back([&cache, &result, this] { result = cache.Load(imagePath); });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(cache.GetStatistics().misses, 1u);
+    EXPECT_EQ(cache.GetStatistics().hits, results.size() - 1);
+    for (const auto &result : results)
+    {
+        EXPECT_EQ(result.data, results[0].data);
+    }
+}
+
+TEST_F(DecodedImageCacheTest, PrefetchDecodesAheadOfLoad)
+{
+    Vision::IO::DecodedImageCache cache(1 << 20);
+    const auto prefetched = cache.Prefetch(imagePath);
+    const cv::Mat loaded = cache.Load(imagePath); // Waits for the prefetch or hits its entry
+    ASSERT_FALSE(loaded.empty());
+    EXPECT_EQ(prefetched.get().data, loaded.data);
+
+    const auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.prefetches, 1u);
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.hits, 1u);
+
+    EXPECT_TRUE(cache.Prefetch(testDir / "missing.png").get().empty());
+}
+
+TEST_F(DecodedImageCacheTest, ReducedDecodesAreSeparateEntries)
+{
+    Vision::IO::DecodedImageCache cache(1 << 20);
+    const cv::Mat quarter = cache.Load(imagePath, 4);
+    const cv::Mat full = cache.Load(imagePath);
+    ASSERT_EQ(quarter.rows, 16);
+    ASSERT_EQ(full.rows, 64);
+    EXPECT_EQ(cache.GetEntryCount(), 2u);
+    EXPECT_EQ(cache.Load(imagePath, 4).data, quarter.data);
+
+    // Unsupported factors decode at full resolution
+    EXPECT_EQ(cache.Load(imagePath, 3).data, full.data);
+}
+
+TEST_F(DecodedImageCacheTest, SelectedFileIsDecodedBeforeProcess)
+{
+    auto &shared = Vision::IO::DecodedImageCache::Get();
+    shared.Clear();
+
+    Vision::IO::ImageInputNode node(1);
+    node.SelectFile(imagePath);
+    EXPECT_EQ(node.GetInputValue<std::filesystem::path>("FilePath"), imagePath);
+
+    // The preview swaps in full resolution once its background decode is done
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (node.GetOutputImage().rows != 64 && std::chrono::steady_clock::now() < deadline)
+    {
+        node.UpdatePreview();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(node.GetOutputImage().rows, 64);
+    EXPECT_TRUE(node.NeedsTextureUpdate());
+    EXPECT_FALSE(node.UpdatePreview());
+
+    // Process() reuses the prefetched decode
+    node.Process();
+    EXPECT_EQ(shared.GetStatistics().prefetches, 2u); // First paint and full resolution
+    EXPECT_EQ(shared.GetStatistics().hits, 1u);
+    shared.Clear();
+}
+
+TEST_F(DecodedImageCacheTest, ImageInputNodesShareDecodedFile)
+{
+    auto &shared = Vision::IO::DecodedImageCache::Get();
+    shared.Clear();
+
+    Vision::IO::ImageInputNode first(1);
+    Vision::IO::ImageInputNode second(2);
+    for (auto *node : { &first, &second })
+    {
+        node->SetInputSlotDefault("FilePath", imagePath);
+        node->Process();
+        node->Process();
+    }
+
+    ASSERT_FALSE(first.GetOutputImage().empty());
+    EXPECT_EQ(second.GetOutputImage().data, first.GetOutputImage().data);
+    EXPECT_EQ(shared.GetStatistics().misses, 1u);
+    EXPECT_EQ(shared.GetStatistics().hits, 3u);
+    shared.Clear();
+}
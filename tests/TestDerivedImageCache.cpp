@@ -0,0 +1,103 @@
+#include "Nodes/Core/DerivedImageCache.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CannyEdgeNode.h"
+#include "Vision/Algorithms/SobelNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <memory>
+
+using namespace VisionCraft;
+using Tests::SourceNode;
+
+namespace
+{
+    cv::Mat MakeColorImage()
+    {
+        cv::Mat image(8, 10, CV_8UC3);
+        for (int y = 0; y < image.rows; ++y)
+        {
+            auto *pixel = image.ptr<uchar>(y);
+            for (int x = 0; x < image.cols * 3; ++x)
+            {
+                pixel[x] = static_cast<uchar>(y * 25 + x * 3);
+            }
+        }
+        return image;
+    }
+} // namespace
+
+TEST(DerivedImageCacheTest, SharesImagesOfOneBuffer)
+{
+    Nodes::DerivedImageCache cache(4);
+    const cv::Mat image = MakeColorImage();
+
+    const cv::Mat gray = cache.Get(image, Nodes::DerivedImage::Gray);
+    ASSERT_EQ(gray.type(), CV_8UC1);
+    EXPECT_EQ(cache.Get(image, Nodes::DerivedImage::Gray).data, gray.data);
+    EXPECT_NE(cache.Get(image.clone(), Nodes::DerivedImage::Gray).data, gray.data); // Another buffer
+
+    const cv::Mat integral = cache.Get(image, Nodes::DerivedImage::Integral);
+    EXPECT_EQ(integral.size(), cv::Size(11, 9));
+
+    // Images that already are the representation are returned without an entry
+    EXPECT_EQ(cache.Get(gray, Nodes::DerivedImage::Gray).data, gray.data);
+
+    const auto statistics = cache.GetStatistics();
+    EXPECT_EQ(statistics.hits, 1u);
+    EXPECT_EQ(statistics.misses, 3u);
+    EXPECT_EQ(statistics.entries, 3u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetStatistics().entries, 0u);
+    EXPECT_NE(cache.Get(image, Nodes::DerivedImage::Gray).data, gray.data);
+}
+
+TEST(DerivedImageCacheTest, DropsOldestEntriesBeyondCapacity)
+{
+    Nodes::DerivedImageCache cache(2);
+    const cv::Mat first = MakeColorImage();
+    const cv::Mat second = MakeColorImage();
+    const cv::Mat third = MakeColorImage();
+
+    const cv::Mat firstGray = cache.Get(first, Nodes::DerivedImage::Gray);
+    (void)cache.Get(second, Nodes::DerivedImage::Gray);
+    (void)cache.Get(third, Nodes::DerivedImage::Gray);
+    EXPECT_EQ(cache.GetStatistics().entries, 2u);
+    EXPECT_NE(cache.Get(first, Nodes::DerivedImage::Gray).data, firstGray.data);
+
+    // Capacity 0 computes every request
+    Nodes::DerivedImageCache disabled(0);
+    const cv::Mat gray = disabled.Get(first, Nodes::DerivedImage::Gray);
+    EXPECT_NE(disabled.Get(first, Nodes::DerivedImage::Gray).data, gray.data);
+    EXPECT_EQ(disabled.GetStatistics().entries, 0u);
+}
+
+TEST(DerivedImageCacheTest, FanOutConvertsToGrayOnce)
+{
+    // Source -> Threshold, Canny and Sobel, all reading the same color image
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<SourceNode>(1, MakeColorImage()));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(2));
+    editor.AddNode(std::make_unique<Vision::Algorithms::CannyEdgeNode>(3));
+    editor.AddNode(std::make_unique<Vision::Algorithms::SobelNode>(4));
+    for (Nodes::NodeId id = 2; id <= 4; ++id)
+    {
+        editor.AddConnection(1, "Output", id, "Input");
+        editor.AddConnection(id - 1, "Then", id, "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    ASSERT_TRUE(editor.Execute());
+    for (Nodes::NodeId id = 2; id <= 4; ++id)
+    {
+        EXPECT_TRUE(editor.GetNode(id)->GetOutputSlot("Output").HasData()) << "node " << id;
+    }
+
+    const auto statistics = editor.GetDerivedImageCache().GetStatistics();
+    EXPECT_EQ(statistics.misses, 1u);
+    EXPECT_EQ(statistics.hits, 2u);
+    EXPECT_EQ(statistics.entries, 0u); // Released when the run ends
+}
@@ -0,0 +1,188 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+using Tests::MakePattern;
+using Tests::OutputOf;
+using Tests::SameImage;
+using Tests::SourceNode;
+
+namespace
+{
+    // Adds one to every pixel
+    cv::Mat Increment(const cv::Mat &image)
+    {
+        cv::Mat result(image.rows, image.cols, CV_8UC1);
+        for (int r = 0; r < image.rows; ++r)
+        {
+            for (int c = 0; c < image.cols; ++c)
+            {
+                result.at<uchar>(r, c) = static_cast<uchar>(std::min(image.at<uchar>(r, c) + 1, 255));
+            }
+        }
+        return result;
+    }
+
+    // Increments its input and records which memory the image arrived in
+    class IncrementNode : public Nodes::Node
+    {
+    public:
+        IncrementNode(Nodes::NodeId id, bool deviceCapable)
+            : Nodes::Node(id, deviceCapable ? "DeviceIncrement" : "HostIncrement"), deviceCapable(deviceCapable)
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "IncrementNode";
+        }
+
+        bool SupportsDeviceImages() const override
+        {
+            return deviceCapable;
+        }
+
+        void Process() override
+        {
+            if (const auto deviceInput = GetInputValueIf<cv::UMat>("Input"))
+            {
+                receivedDevice = true;
+                cv::UMat result;
+                Increment(deviceInput->getMat(cv::ACCESS_READ)).copyTo(result);
+                SetOutputSlotData("Output", std::move(result));
+                return;
+            }
+
+            receivedDevice = false;
+            const auto input = GetInputValueIf<cv::Mat>("Input");
+            if (!input || input->empty())
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+            SetOutputSlotData("Output", Increment(*input));
+        }
+
+        std::optional<Nodes::TileOperation> PrepareTileOperation([[maybe_unused]] int inputType) const override
+        {
+            ++prepareCount;
+            return Nodes::TileOperation{ .halo = 0, .outputType = CV_8UC1, .apply = &Increment };
+        }
+
+        bool deviceCapable;
+        bool receivedDevice = false;
+        mutable int prepareCount = 0;
+    };
+} // namespace
+
+class DeviceExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+    }
+
+    // Adds Source (1) followed by one increment node per entry, true meaning device capable
+    void BuildChain(const cv::Mat &image, std::initializer_list<bool> deviceCapable)
+    {
+        editor.AddNode(std::make_unique<SourceNode>(1, image));
+        Nodes::NodeId id = 2;
+        for (const bool capable : deviceCapable)
+        {
+            editor.AddNode(std::make_unique<IncrementNode>(id, capable));
+            editor.AddConnection(id - 1, "Output", id, "Input");
+            ++id;
+        }
+    }
+
+    IncrementNode &Increments(Nodes::NodeId id)
+    {
+        return *static_cast<IncrementNode *>(editor.GetNode(id));
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(DeviceExecutionTest, KeepsImagesOnDeviceBetweenSupportingNodes)
+{
+    const cv::Mat image = MakePattern(12, 9);
+    BuildChain(image, { true, true, false, true });
+    editor.SetDeviceExecution(true);
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_TRUE(Increments(2).receivedDevice);
+    EXPECT_TRUE(Increments(3).receivedDevice);
+    EXPECT_FALSE(Increments(4).receivedDevice);
+    EXPECT_TRUE(Increments(5).receivedDevice);
+
+    // Between two device nodes the handle is shared, not transferred
+    EXPECT_EQ(editor.GetNode(3)->GetInputSlot("Input").GetSharedData(),
+        editor.GetNode(2)->GetOutputSlot("Output").GetSharedData());
+
+    const auto hostOutput = OutputOf(editor, 4);
+    ASSERT_TRUE(hostOutput);
+    EXPECT_TRUE(SameImage(*hostOutput, Increment(Increment(Increment(image)))));
+    EXPECT_TRUE(editor.GetNode(5)->GetOutputSlot("Output").GetDataIf<cv::UMat>());
+}
+
+TEST_P(DeviceExecutionTest, PassesHostImagesWhenDisabled)
+{
+    const cv::Mat image = MakePattern(8, 8);
+    BuildChain(image, { true, true });
+
+    ASSERT_FALSE(editor.IsDeviceExecutionEnabled());
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FALSE(Increments(2).receivedDevice);
+    EXPECT_FALSE(Increments(3).receivedDevice);
+    const auto output = OutputOf(editor, 3);
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(*output, Increment(Increment(image))));
+}
+
+TEST_P(DeviceExecutionTest, SwitchingOffDownloadsDeviceOutputs)
+{
+    const cv::Mat image = MakePattern(6, 10);
+    BuildChain(image, { true, true });
+    editor.SetDeviceExecution(true);
+    ASSERT_TRUE(editor.Execute());
+
+    editor.SetDeviceExecution(false);
+    editor.MarkNodeDirty(3); // Node 2 keeps its device output
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FALSE(Increments(3).receivedDevice);
+    const auto output = OutputOf(editor, 3);
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(*output, Increment(Increment(image))));
+}
+
+TEST_P(DeviceExecutionTest, DeviceNodesStayOutOfTileChains)
+{
+    const cv::Mat image = MakePattern(32, 32);
+    BuildChain(image, { false, false, true, true });
+    editor.SetTilingOptions({ .enabled = true, .tileSize = 8, .minImagePixels = 0 });
+    editor.SetDeviceExecution(true);
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_GT(Increments(2).prepareCount, 0); // The host nodes still form a chain
+    EXPECT_EQ(Increments(4).prepareCount + Increments(5).prepareCount, 0);
+    EXPECT_TRUE(Increments(4).receivedDevice);
+    EXPECT_TRUE(Increments(5).receivedDevice);
+    const auto output = editor.GetNode(5)->GetOutputSlot("Output").GetDataIf<cv::UMat>();
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(output->getMat(cv::ACCESS_READ), Increment(Increment(Increment(Increment(image))))));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    DeviceExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,172 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds "Amount" to its input and counts Process() calls
+    class AddNode : public Nodes::Node
+    {
+    public:
+        AddNode(Nodes::NodeId id, double amount, bool cacheable = true)
+            : Nodes::Node(id, "Add"), cacheable(cacheable)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateInputSlot("Amount", amount);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "AddNode";
+        }
+
+        bool IsCacheable() const override
+        {
+            return cacheable;
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            SetOutputSlotData("Output",
+                GetInputValue<double>("Input").value_or(0.0) + GetInputValue<double>("Amount").value_or(0.0));
+        }
+
+        int processCount = 0;
+
+    private:
+        bool cacheable;
+    };
+} // namespace
+
+class DuplicateEliminationTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Source 1 feeds the branch 2 -> 3 and its copy 4 -> 5
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+        editor.SetDuplicateElimination(true);
+    }
+
+    void BuildGraph(bool cacheable = true)
+    {
+        editor.AddNode(std::make_unique<AddNode>(1, 1.0, cacheable));
+        for (const Nodes::NodeId first : { 2, 4 })
+        {
+            editor.AddNode(std::make_unique<AddNode>(first, 10.0, cacheable));
+            editor.AddNode(std::make_unique<AddNode>(first + 1, 100.0, cacheable));
+            editor.AddConnection(1, "Output", first, "Input");
+            editor.AddConnection(first, "Output", first + 1, "Input");
+        }
+    }
+
+    AddNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<AddNode *>(editor.GetNode(id));
+    }
+
+    std::optional<double> ResultOf(Nodes::NodeId id)
+    {
+        return NodeAt(id).GetOutputSlot("Output").GetData<double>();
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(DuplicateEliminationTest, DuplicatedBranchRunsOnce)
+{
+    BuildGraph();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 111.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 111.0);
+    EXPECT_EQ(NodeAt(2).processCount, 1);
+    EXPECT_EQ(NodeAt(3).processCount, 1);
+    EXPECT_EQ(NodeAt(4).processCount, 0);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+    EXPECT_EQ(NodeAt(5).GetOutputSlot("Output").GetSharedData(), NodeAt(3).GetOutputSlot("Output").GetSharedData());
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    EXPECT_EQ(run->nodesAliased, 2u);
+    EXPECT_EQ(run->nodesExecuted, 3u);
+}
+
+TEST_P(DuplicateEliminationTest, DifferentParametersAreNotMerged)
+{
+    BuildGraph();
+    editor.GetNode(4)->SetInputSlotDefault("Amount", 20.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 111.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 121.0);
+    for (Nodes::NodeId id = 1; id <= 5; ++id)
+    {
+        EXPECT_EQ(NodeAt(id).processCount, 1) << "node " << id;
+    }
+}
+
+TEST_P(DuplicateEliminationTest, EditingADuplicateMakesItProcess)
+{
+    BuildGraph();
+    ASSERT_TRUE(editor.Execute());
+
+    // Parameter edits keep the snapshot, so the merge is checked again when the duplicate runs
+    editor.GetNode(4)->SetInputSlotDefault("Amount", 20.0);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 121.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 111.0);
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 1);
+
+    // Undoing the edit merges them again
+    editor.GetNode(4)->SetInputSlotDefault("Amount", 10.0);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 111.0);
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+}
+
+TEST_P(DuplicateEliminationTest, NodesWithSideEffectsAreNotMerged)
+{
+    BuildGraph(false);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->nodesAliased, 0u);
+}
+
+TEST_P(DuplicateEliminationTest, DisablingRunsEveryNode)
+{
+    editor.SetDuplicateElimination(false);
+    EXPECT_FALSE(editor.IsDuplicateEliminationEnabled());
+    BuildGraph();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 111.0);
+}
+
+TEST_P(DuplicateEliminationTest, SharedOutputsSurviveIntermediateRelease)
+{
+    editor.SetIntermediateRelease(true);
+    BuildGraph();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 111.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(5), 111.0);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+    EXPECT_FALSE(NodeAt(2).GetOutputSlot("Output").HasData());
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    DuplicateEliminationTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,179 @@
+#include "Nodes/Core/ExecutionContext.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds Offset to Input; throws on a negative input
+    class OffsetNode : public Nodes::Node
+    {
+    public:
+        explicit OffsetNode(Nodes::NodeId id) : Nodes::Node(id, "Offset")
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateInputSlot("Offset", 1.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "OffsetNode";
+        }
+
+        void Process() override
+        {
+            const double input = GetInputValue<double>("Input").value_or(0.0);
+            if (input < 0.0)
+            {
+                throw std::runtime_error("negative input");
+            }
+            ++processCount;
+            SetOutputSlotData("Output", input + GetInputValue<double>("Offset").value_or(0.0));
+        }
+
+        std::atomic<int> processCount = 0;
+    };
+
+    double ReadDouble(const std::shared_ptr<const Nodes::NodeData> &handle)
+    {
+        const auto *value = handle ? std::get_if<double>(handle.get()) : nullptr;
+        return value ? *value : -1.0;
+    }
+} // namespace
+
+TEST(ExecutionContextTest, BoundContextHoldsSlotWrites)
+{
+    Nodes::Slot slot(Nodes::NodeData{ 1.0 });
+    slot.SetData(2.0);
+
+    Nodes::ExecutionContext context;
+    {
+        const Nodes::ExecutionContext::Scope scope(context, {});
+        EXPECT_FALSE(slot.HasData());
+        EXPECT_EQ(slot.GetValueOrDefault<double>(), 1.0);
+
+        slot.SetData(3.0);
+        slot.SetDefaultValue(4.0);
+        EXPECT_EQ(slot.GetData<double>(), 3.0);
+        EXPECT_EQ(slot.GetDefaultValue<double>(), 4.0);
+    }
+
+    EXPECT_EQ(Nodes::ExecutionContext::Current(), nullptr);
+    EXPECT_EQ(slot.GetData<double>(), 2.0);
+    EXPECT_EQ(slot.GetDefaultValue<double>(), 1.0);
+    EXPECT_EQ(ReadDouble(context.GetData(slot)), 3.0);
+}
+
+TEST(ExecutionContextTest, ContextRunLeavesGraphUntouched)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<OffsetNode>(1));
+    editor.AddNode(std::make_unique<OffsetNode>(2));
+    editor.AddConnection(1, "Output", 2, "Input");
+    auto *source = editor.GetNode(1);
+    auto *offset = static_cast<OffsetNode *>(editor.GetNode(2));
+
+    Nodes::ExecutionContext context;
+    context.SupplyOutput(*source, "Output", 10.0);
+    context.SetInputDefault(*offset, "Offset", 5.0);
+    ASSERT_TRUE(editor.ExecuteInContext(context)) << context.GetError();
+
+    EXPECT_EQ(ReadDouble(context.GetOutputData(*offset, "Output")), 15.0);
+    EXPECT_EQ(ReadDouble(context.GetInputData(*offset, "Input")), 10.0);
+    EXPECT_EQ(static_cast<OffsetNode *>(source)->processCount, 0);
+    EXPECT_FALSE(offset->GetOutputSlot("Output").HasData());
+    EXPECT_FALSE(offset->GetInputSlot("Input").HasData());
+    EXPECT_EQ(offset->GetInputSlot("Offset").GetDefaultValue<double>(), 1.0);
+
+    // The editor's own run still sees only the graph
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(offset->GetOutputSlot("Output").GetData<double>(), 2.0);
+
+    context.Reset();
+    ASSERT_TRUE(editor.ExecuteInContext(context));
+    EXPECT_EQ(ReadDouble(context.GetOutputData(*offset, "Output")), 2.0);
+}
+
+TEST(ExecutionContextTest, ConcurrentContextsShareOneGraph)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(2));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    const auto *source = editor.GetNode(1);
+    const auto *threshold = editor.GetNode(2);
+
+    constexpr int kThreads = 6;
+    constexpr int kRuns = 20;
+    std::atomic<int> correct = 0;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (int r = 0; r < kRuns; ++r)
+            {
+                // Even threads threshold below the pixel value, odd ones above it
+                const int value = 40 + t * 20 + r;
+                Nodes::ExecutionContext context;
+                context.SupplyOutput(*source, "Output", cv::Mat(8, 8, CV_8UC3, cv::Scalar::all(value)));
+                const double level = t % 2 == 0 ? value - 5 : value + 5;
+                context.SetInputDefault(*threshold, "Threshold", level);
+                if (!editor.ExecuteInContext(context))
+                {
+                    continue;
+                }
+
+                const auto output = context.GetOutputData(*threshold, "Output");
+                const auto *image = output ? std::get_if<cv::Mat>(output.get()) : nullptr;
+                if (image && !image->empty() && image->at<uchar>(7, 7) == (t % 2 == 0 ? 255 : 0))
+                {
+                    ++correct;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(correct, kThreads * kRuns);
+    EXPECT_FALSE(threshold->GetOutputSlot("Output").HasData());
+    EXPECT_EQ(threshold->GetInputSlot("Threshold").GetDefaultValue<double>(), 127.0);
+}
+
+TEST(ExecutionContextTest, FailuresStayInTheirContext)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<OffsetNode>(1));
+    auto *node = editor.GetNode(1);
+
+    Nodes::ExecutionContext failing;
+    failing.SetInputDefault(*node, "Input", -1.0);
+    EXPECT_FALSE(editor.ExecuteInContext(failing));
+    EXPECT_NE(failing.GetError().find("negative input"), std::string::npos);
+    EXPECT_FALSE(failing.IsTimedOut());
+
+    std::stop_source stopSource;
+    stopSource.request_stop();
+    Nodes::ExecutionContext cancelled;
+    EXPECT_FALSE(editor.ExecuteInContext(cancelled, stopSource.get_token()));
+    EXPECT_EQ(cancelled.GetError(), "execution cancelled");
+
+    // Neither failure marks the graph or reaches the editor's own run
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(node->GetOutputSlot("Output").GetData<double>(), 1.0);
+}
@@ -0,0 +1,249 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Sums its two inputs (the first defaults to the node's seed value)
+    class SumNode : public Nodes::Node
+    {
+    public:
+        SumNode(Nodes::NodeId id, double initial) : Nodes::Node(id, "Sum")
+        {
+            CreateInputSlot("A", initial);
+            CreateInputSlot("B", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SumNode";
+        }
+
+        void Process() override
+        {
+            const auto a = GetInputValue<double>("A").value_or(0.0);
+            const auto b = GetInputValue<double>("B").value_or(0.0);
+            SetOutputSlotData("Output", a + b);
+        }
+    };
+
+    constexpr int kRandomNodes = 12;
+    constexpr int kRandomEdits = 80;
+} // namespace
+
+class ExecutionPlanMaintenanceTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        Configure(editor);
+    }
+
+    void Configure(Nodes::NodeEditor &target) const
+    {
+        target.SetExecutionMode(GetParam());
+        target.SetOutputCacheEnabled(false);
+        target.SetIntermediateRelease(true);
+    }
+
+    void AddSumNode(Nodes::NodeId id)
+    {
+        editor.AddNode(std::make_unique<SumNode>(id, static_cast<double>(id)));
+    }
+
+    std::optional<double> ResultOf(const Nodes::NodeEditor &target, Nodes::NodeId id) const
+    {
+        return target.GetNode(id)->GetOutputSlot("Output").GetData<double>();
+    }
+
+    // Runs the edited graph and a freshly compiled copy of it, expecting identical results
+    void ExpectMatchesFullRebuild()
+    {
+        Nodes::NodeEditor rebuilt;
+        Configure(rebuilt);
+        for (const auto id : editor.GetNodeIds())
+        {
+            rebuilt.AddNode(std::make_unique<SumNode>(id, static_cast<double>(id)));
+        }
+        for (const auto &conn : editor.GetConnections())
+        {
+            rebuilt.AddConnection(conn.from, conn.fromSlot, conn.to, conn.toSlot, conn.type);
+        }
+
+        // A removed wire leaves its last value in the input slot, which the copy never saw
+        for (const auto id : editor.GetNodeIds())
+        {
+            editor.GetNode(id)->ClearInputSlot("A");
+            editor.GetNode(id)->ClearInputSlot("B");
+        }
+        editor.MarkAllNodesDirty();
+        ASSERT_TRUE(editor.Execute());
+        ASSERT_TRUE(rebuilt.Execute());
+        for (const auto id : editor.GetNodeIds())
+        {
+            EXPECT_EQ(ResultOf(editor, id), ResultOf(rebuilt, id)) << "node " << id;
+        }
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(ExecutionPlanMaintenanceTest, PatchesDataConnectionEdits)
+{
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        AddSumNode(id);
+    }
+    editor.AddConnection(1, "Output", 2, "A");
+    editor.AddConnection(2, "Output", 3, "A");
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 3), 1.0);
+
+    ASSERT_TRUE(editor.RemoveConnection(2, "Output", 3, "A"));
+    editor.GetNode(3)->ClearInputSlot("A"); // Drop the value the removed wire left behind
+    editor.AddConnection(1, "Output", 3, "B");
+    editor.AddConnection(1, "Output", 2, "B");
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 3), 4.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 2), 2.0);
+    const auto stats = editor.GetExecutionPlanStatistics();
+    EXPECT_EQ(stats.rebuilds, 1u);
+    EXPECT_EQ(stats.patchedEdits, 3u);
+}
+
+TEST_P(ExecutionPlanMaintenanceTest, ReordersStepsForEdgeAgainstPlanOrder)
+{
+    AddSumNode(1);
+    AddSumNode(2);
+    editor.AddConnection(1, "Output", 2, "A");
+    ASSERT_TRUE(editor.Execute());
+
+    // Node 3 is appended after node 2, so feeding node 1 from it must move it to the front
+    AddSumNode(3);
+    editor.AddConnection(3, "Output", 1, "B");
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 2), 4.0);
+    const auto stats = editor.GetExecutionPlanStatistics();
+    EXPECT_EQ(stats.rebuilds, 1u);
+    EXPECT_EQ(stats.patchedEdits, 2u);
+    EXPECT_GT(stats.reorderedSteps, 0u);
+    ExpectMatchesFullRebuild();
+}
+
+TEST_P(ExecutionPlanMaintenanceTest, TransactionRebuildsOnceInsteadOfPatching)
+{
+    AddSumNode(1);
+    ASSERT_TRUE(editor.Execute());
+
+    {
+        Nodes::GraphTransaction transaction(editor);
+        for (Nodes::NodeId id = 2; id <= 4; ++id)
+        {
+            AddSumNode(id);
+            editor.AddConnection(id - 1, "Output", id, "B");
+        }
+    }
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 4), 10.0);
+    const auto stats = editor.GetExecutionPlanStatistics();
+    EXPECT_EQ(stats.rebuilds, 2u);
+    EXPECT_EQ(stats.patchedEdits, 0u);
+    ExpectMatchesFullRebuild();
+}
+
+TEST_P(ExecutionPlanMaintenanceTest, CycleFallsBackToRebuild)
+{
+    AddSumNode(1);
+    AddSumNode(2);
+    editor.AddConnection(1, "Output", 2, "A");
+    ASSERT_TRUE(editor.Execute());
+
+    editor.AddConnection(2, "Output", 1, "B");
+    EXPECT_FALSE(editor.Execute());
+
+    ASSERT_TRUE(editor.RemoveConnection(2, "Output", 1, "B"));
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 2), 1.0);
+    EXPECT_EQ(editor.GetExecutionPlanStatistics().rebuilds, 2u);
+}
+
+TEST_P(ExecutionPlanMaintenanceTest, ExecutionWiresRebuildAndDataEditsPatch)
+{
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        AddSumNode(id);
+        auto *node = editor.GetNode(id);
+        if (id > 1)
+        {
+            node->CreateExecutionInputPin("Execute");
+        }
+        node->CreateExecutionOutputPin("Then");
+    }
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(1, "Output", 3, "B");
+    ASSERT_TRUE(editor.Execute());
+
+    // Node 4 has no execution pins, so it stays outside the flow and keeps node 1's output alive
+    AddSumNode(4);
+    editor.AddConnection(1, "Output", 4, "B");
+    editor.AddConnection(2, "Output", 3, "A");
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(editor.GetExecutionPlanStatistics().rebuilds, 1u);
+    EXPECT_DOUBLE_EQ(*ResultOf(editor, 3), 3.0);
+    EXPECT_TRUE(editor.GetNode(1)->GetOutputSlot("Output").HasData());
+
+    ASSERT_TRUE(editor.RemoveConnection(2, "Then", 3, "Execute"));
+    EXPECT_FALSE(editor.Execute());
+    EXPECT_EQ(editor.GetExecutionPlanStatistics().rebuilds, 1u);
+}
+
+TEST_P(ExecutionPlanMaintenanceTest, RandomEditsMatchFullRebuild)
+{
+    for (Nodes::NodeId id = 1; id <= kRandomNodes; ++id)
+    {
+        AddSumNode(id);
+    }
+    ASSERT_TRUE(editor.Execute());
+
+    // Edges always run from a lower to a higher ID, so the graph stays acyclic whatever the plan order
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<Nodes::NodeId> pickNode(1, kRandomNodes);
+    for (int edit = 0; edit < kRandomEdits; ++edit)
+    {
+        auto from = pickNode(generator);
+        auto to = pickNode(generator);
+        if (from == to)
+        {
+            continue;
+        }
+        if (from > to)
+        {
+            std::swap(from, to);
+        }
+
+        const std::string slot = generator() % 2 == 0 ? "A" : "B";
+        if (generator() % 3 == 0)
+        {
+            (void)editor.RemoveConnection(from, "Output", to, slot);
+        }
+        else
+        {
+            editor.AddConnection(from, "Output", to, slot);
+        }
+        ExpectMatchesFullRebuild();
+    }
+    EXPECT_EQ(editor.GetExecutionPlanStatistics().rebuilds, 1u);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    ExecutionPlanMaintenanceTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,314 @@
+#include "Nodes/Core/ExecutionStatistics.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <opencv2/opencv.hpp>
+#include <stdexcept>
+#include <thread>
+
+using namespace VisionCraft;
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Adds its input to a bias after an optional delay
+    class DelayNode : public Nodes::Node
+    {
+    public:
+        DelayNode(Nodes::NodeId id, std::string name, std::chrono::milliseconds delay = 0ms)
+            : Nodes::Node(id, std::move(name)), delay(delay)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "DelayNode";
+        }
+
+        void Process() override
+        {
+            std::this_thread::sleep_for(delay);
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+    private:
+        std::chrono::milliseconds delay;
+    };
+
+    class ThrowingNode : public Nodes::Node
+    {
+    public:
+        ThrowingNode(Nodes::NodeId id) : Nodes::Node(id, "Thrower")
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ThrowingNode";
+        }
+
+        void Process() override
+        {
+            throw std::runtime_error("intentional failure");
+        }
+    };
+
+    // Outputs a rows x cols 8-bit image, reading its input (if any) first
+    class ImageNode : public Nodes::Node
+    {
+    public:
+        ImageNode(Nodes::NodeId id, int rows, int cols, bool hasInput)
+            : Nodes::Node(id, "Image"), rows(rows), cols(cols)
+        {
+            if (hasInput)
+            {
+                CreateInputSlot("Input");
+            }
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ImageNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", cv::Mat(rows, cols, CV_8UC1, cv::Scalar(0)));
+        }
+
+    private:
+        int rows;
+        int cols;
+    };
+
+    Nodes::RunStatistics MakeRun(Nodes::NodeId id, std::chrono::microseconds duration)
+    {
+        Nodes::RunStatistics run;
+        Nodes::NodeExecutionRecord record;
+        record.nodeId = id;
+        record.nodeName = "Node" + std::to_string(id);
+        record.outcome = Nodes::StepOutcome::Processed;
+        record.duration = duration;
+        run.nodes.push_back(record);
+        return run;
+    }
+
+    const Nodes::NodeExecutionRecord *FindRecord(const Nodes::RunStatistics &run, Nodes::NodeId id)
+    {
+        for (const auto &record : run.nodes)
+        {
+            if (record.nodeId == id)
+            {
+                return &record;
+            }
+        }
+        return nullptr;
+    }
+} // namespace
+
+// ============================================================================
+// ExecutionStatisticsHistory Tests
+// ============================================================================
+
+TEST(ExecutionStatisticsHistoryTest, KeepsMostRecentRunsUpToCapacity)
+{
+    Nodes::ExecutionStatisticsHistory history(3);
+    EXPECT_FALSE(history.GetLatest().has_value());
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        EXPECT_EQ(history.Record(MakeRun(i, 10us)), static_cast<uint64_t>(i));
+    }
+
+    const auto runs = history.GetRuns();
+    ASSERT_EQ(runs.size(), 3);
+    EXPECT_EQ(runs.front().runNumber, 3);
+    EXPECT_EQ(runs.back().runNumber, 5);
+    EXPECT_EQ(history.GetLatest()->nodes.front().nodeId, 5);
+    EXPECT_EQ(history.GetRunCount(), 5);
+
+    history.SetCapacity(1);
+    EXPECT_EQ(history.GetRuns().size(), 1);
+
+    history.Clear();
+    EXPECT_TRUE(history.GetRuns().empty());
+    EXPECT_EQ(history.GetRunCount(), 0);
+}
+
+TEST(ExecutionStatisticsHistoryTest, SummarizesProcessedTimesPerNode)
+{
+    Nodes::ExecutionStatisticsHistory history(8);
+    history.Record(MakeRun(1, 100us));
+    history.Record(MakeRun(1, 300us));
+
+    auto cached = MakeRun(1, 0us);
+    cached.nodes.front().outcome = Nodes::StepOutcome::CacheHit;
+    history.Record(cached);
+
+    const auto summaries = history.SummarizeNodes();
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_EQ(summaries[0].nodeId, 1);
+    EXPECT_EQ(summaries[0].samples, 2);
+    EXPECT_EQ(summaries[0].averageTime, 200us);
+    EXPECT_EQ(summaries[0].medianTime, 200us);
+    EXPECT_EQ(summaries[0].maxTime, 300us);
+    EXPECT_EQ(summaries[0].lastOutcome, Nodes::StepOutcome::CacheHit);
+    EXPECT_EQ(summaries[0].lastTime, 0us);
+}
+
+TEST(ExecutionStatisticsHistoryTest, MedianIgnoresOutlierRuns)
+{
+    Nodes::ExecutionStatisticsHistory history(8);
+    for (const auto duration : { 120us, 100us, 5000us, 110us, 130us })
+    {
+        history.Record(MakeRun(1, duration));
+    }
+
+    const auto summaries = history.SummarizeNodes();
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_EQ(summaries[0].medianTime, 120us);
+    EXPECT_EQ(summaries[0].averageTime, 1092us);
+}
+
+// ============================================================================
+// NodeEditor Run Statistics Tests
+// ============================================================================
+
+class RunStatisticsTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.AddNode(std::make_unique<DelayNode>(1, "Fast"));
+        editor.AddNode(std::make_unique<DelayNode>(2, "Slow", 20ms));
+        editor.AddConnection(1, "Output", 2, "Input");
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(RunStatisticsTest, RecordsEveryNodeWithItsId)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run.has_value());
+    EXPECT_TRUE(run->succeeded);
+    EXPECT_EQ(run->parallel, GetParam() == Nodes::ExecutionMode::Parallel);
+    EXPECT_EQ(run->graphVersion, editor.GetGraphVersion());
+    EXPECT_EQ(run->nodesExecuted, 2);
+    EXPECT_EQ(run->dataPassOperations, 1);
+
+    const auto *slow = FindRecord(*run, 2);
+    ASSERT_NE(slow, nullptr);
+    EXPECT_EQ(slow->nodeName, "Slow");
+    EXPECT_EQ(slow->nodeType, "DelayNode");
+    EXPECT_EQ(slow->outcome, Nodes::StepOutcome::Processed);
+    EXPECT_GE(slow->duration, 20ms);
+    EXPECT_GE(run->totalTime, slow->duration);
+}
+
+TEST_P(RunStatisticsTest, DistinguishesSkippedAndCachedNodes)
+{
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(editor.Execute());
+
+    auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run.has_value());
+    EXPECT_EQ(run->nodesSkipped, 2);
+    EXPECT_EQ(FindRecord(*run, 1)->outcome, Nodes::StepOutcome::Skipped);
+
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    run = editor.GetExecutionStatistics().GetLatest();
+    EXPECT_EQ(run->cacheHits, 2);
+    EXPECT_EQ(FindRecord(*run, 2)->outcome, Nodes::StepOutcome::CacheHit);
+    EXPECT_EQ(FindRecord(*run, 2)->duration, 0us);
+    EXPECT_EQ(editor.GetExecutionStatistics().GetRunCount(), 3);
+}
+
+TEST_P(RunStatisticsTest, RecordsFailedRuns)
+{
+    editor.AddNode(std::make_unique<ThrowingNode>(3));
+    editor.AddConnection(2, "Output", 3, "Input");
+
+    EXPECT_FALSE(editor.Execute());
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run.has_value());
+    EXPECT_FALSE(run->succeeded);
+    EXPECT_EQ(FindRecord(*run, 3)->outcome, Nodes::StepOutcome::Failed);
+    EXPECT_EQ(FindRecord(*run, 2)->outcome, Nodes::StepOutcome::Processed);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    RunStatisticsTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
+
+// ============================================================================
+// Slot Memory Accounting Tests
+// ============================================================================
+
+class SlotMemoryTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds 1 (10000 bytes) -> 2 (100 bytes) -> 3 (100 bytes)
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.AddNode(std::make_unique<ImageNode>(1, 100, 100, false));
+        editor.AddNode(std::make_unique<ImageNode>(2, 10, 10, true));
+        editor.AddNode(std::make_unique<ImageNode>(3, 10, 10, true));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(SlotMemoryTest, RecordsSlotBytesPerNode)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run.has_value());
+    EXPECT_EQ(FindRecord(*run, 1)->inputBytes, 0);
+    EXPECT_EQ(FindRecord(*run, 1)->outputBytes, 10000);
+    EXPECT_EQ(FindRecord(*run, 2)->inputBytes, 10000);
+    EXPECT_EQ(FindRecord(*run, 2)->outputBytes, 100);
+
+    // Inputs share their upstream output, so each image counts once
+    EXPECT_EQ(run->peakSlotBytes, 10200);
+    EXPECT_EQ(run->peakNodeId, 3);
+    EXPECT_EQ(run->retainedSlotBytes, 10200);
+
+    const auto summaries = editor.GetExecutionStatistics().SummarizeNodes();
+    ASSERT_EQ(summaries.size(), 3);
+    EXPECT_EQ(summaries[0].lastOutputBytes, 10000);
+    EXPECT_EQ(summaries[0].maxOutputBytes, 10000);
+}
+
+TEST_P(SlotMemoryTest, PeakCoversIntermediatesReleasedDuringTheRun)
+{
+    editor.SetIntermediateRelease(true);
+    ASSERT_TRUE(editor.Execute());
+
+    // Node 1's image is dropped once node 2 has read it
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run.has_value());
+    EXPECT_EQ(run->peakSlotBytes, 10100);
+    EXPECT_EQ(run->peakNodeId, 2);
+    EXPECT_EQ(run->retainedSlotBytes, 200);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    SlotMemoryTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
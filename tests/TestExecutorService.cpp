@@ -0,0 +1,155 @@
+#include "Nodes/Core/ExecutorService.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds one to its input and records the thread it ran on
+    class ThreadRecordingNode : public Nodes::Node
+    {
+    public:
+        explicit ThreadRecordingNode(Nodes::NodeId id) : Nodes::Node(id, "ThreadRecording")
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ThreadRecordingNode";
+        }
+
+        void Process() override
+        {
+            threads.insert(std::this_thread::get_id());
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        std::set<std::thread::id> threads; // Runs are serialized, so no lock is needed
+    };
+
+    constexpr int kRepeatedRuns = 30;
+} // namespace
+
+TEST(ExecutorServiceTest, AsyncRunsReuseOneJobThread)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ThreadRecordingNode>(1));
+    auto *node = static_cast<ThreadRecordingNode *>(editor.GetNode(1));
+
+    for (int run = 0; run < kRepeatedRuns; ++run)
+    {
+        editor.MarkAllNodesDirty();
+        ASSERT_TRUE(editor.ExecuteAsync().get());
+    }
+
+    const auto stats = editor.GetExecutorService().GetStatistics();
+    EXPECT_EQ(stats.jobsLaunched, static_cast<size_t>(kRepeatedRuns));
+    EXPECT_EQ(stats.jobThreadsStarted, 1u);
+    EXPECT_EQ(node->threads.size(), 1u);
+    EXPECT_NE(*node->threads.begin(), std::this_thread::get_id());
+}
+
+TEST(ExecutorServiceTest, LaunchReturnsResultOrException)
+{
+    Nodes::ExecutorService service;
+    EXPECT_EQ(service.Launch([]() { return 42; }).get(), 42);
+
+    auto failing = service.Launch([]() -> int { throw std::runtime_error("job failed"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ExecutorServiceTest, ConcurrentJobsDoNotWaitForEachOther)
+{
+    // Each job blocks until all three run at once, which requires a thread per job
+    constexpr size_t kJobs = 3;
+    Nodes::ExecutorService service;
+    std::latch allRunning(kJobs);
+    std::vector<std::shared_future<void>> jobs;
+    for (size_t i = 0; i < kJobs; ++i)
+    {
+        jobs.push_back(service.Launch([&allRunning]() { allRunning.arrive_and_wait(); }));
+    }
+    for (const auto &job : jobs)
+    {
+        job.wait();
+    }
+    EXPECT_EQ(service.GetStatistics().jobThreadsStarted, kJobs);
+
+    // Once they are parked, the same threads take the next jobs
+    for (size_t i = 0; i < kJobs; ++i)
+    {
+        service.Launch([]() {}).wait();
+    }
+    EXPECT_EQ(service.GetStatistics().jobThreadsStarted, kJobs);
+}
+
+TEST(ExecutorServiceTest, SharedServiceRunsEveryEditor)
+{
+    auto service = std::make_shared<Nodes::ExecutorService>(Nodes::ExecutorService::Options{ .workerCount = 2 });
+    Nodes::NodeEditor first;
+    Nodes::NodeEditor second;
+    for (auto *editor : { &first, &second })
+    {
+        editor->SetExecutorService(service);
+        editor->SetExecutionMode(Nodes::ExecutionMode::Parallel);
+        editor->AddNode(std::make_unique<ThreadRecordingNode>(1));
+        editor->AddNode(std::make_unique<ThreadRecordingNode>(2));
+    }
+
+    ASSERT_TRUE(first.ExecuteAsync().get());
+    ASSERT_TRUE(second.ExecuteAsync().get());
+    EXPECT_EQ(service->GetStatistics().jobThreadsStarted, 1u);
+    EXPECT_EQ(service->AcquireWorkerPool()->GetWorkerCount(), 2u);
+
+    // Resizing through either editor resizes the shared pool
+    second.SetWorkerCount(3);
+    EXPECT_EQ(service->GetWorkerCount(), 3u);
+    first.MarkAllNodesDirty();
+    ASSERT_TRUE(first.Execute());
+    EXPECT_EQ(service->AcquireWorkerPool()->GetWorkerCount(), 3u);
+}
+
+TEST(ExecutorServiceTest, PinnedWorkersRunTasks)
+{
+    Nodes::ExecutorService service(Nodes::ExecutorService::Options{ .workerCount = 2, .pinWorkers = true });
+    const auto pool = service.AcquireWorkerPool();
+
+    constexpr int kTasks = 16;
+    std::latch done(kTasks);
+    std::atomic<int> ran{ 0 };
+    for (int i = 0; i < kTasks; ++i)
+    {
+        pool->Submit([&]() {
+            ran.fetch_add(1);
+            done.count_down();
+        });
+    }
+    done.wait();
+    EXPECT_EQ(ran.load(), kTasks);
+}
+
+TEST(ExecutorServiceTest, DestructionFinishesQueuedJobs)
+{
+    std::atomic<int> finished{ 0 };
+    std::latch release(1);
+    {
+        Nodes::ExecutorService service;
+        service.Post([&]() {
+            release.wait();
+            finished.fetch_add(1);
+        });
+        service.Post([&]() { finished.fetch_add(1); });
+        release.count_down();
+    }
+    EXPECT_EQ(finished.load(), 2);
+}
@@ -1,11 +1,173 @@
+#include "Vision/Algorithms/GradientNode.h"
 #include "Vision/Algorithms/MedianBlurNode.h"
 #include "Vision/Algorithms/MorphologyNode.h"
 #include "Vision/Algorithms/SobelNode.h"
 #include <opencv2/imgproc.hpp>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
 using namespace VisionCraft;
 
+namespace
+{
+    // Brute-force median with replicated borders, the reference for the strip engine
+    template<typename T> cv::Mat ReferenceMedian(const cv::Mat &image, int ksize)
+    {
+        const int radius = ksize / 2;
+        const int channels = image.channels();
+        cv::Mat result(image.size(), image.type());
+        std::vector<T> window;
+        for (int y = 0; y < image.rows; ++y)
+        {
+            for (int x = 0; x < image.cols; ++x)
+            {
+                for (int c = 0; c < channels; ++c)
+                {
+                    window.clear();
+                    for (int dy = -radius; dy <= radius; ++dy)
+                    {
+                        const T *row = image.ptr<T>(std::clamp(y + dy, 0, image.rows - 1));
+                        for (int dx = -radius; dx <= radius; ++dx)
+                        {
+                            window.push_back(row[std::clamp(x + dx, 0, image.cols - 1) * channels + c]);
+                        }
+                    }
+                    std::sort(window.begin(), window.end());
+                    result.ptr<T>(y)[x * channels + c] = window[window.size() / 2];
+                }
+            }
+        }
+        return result;
+    }
+
+    template<typename T> int CountMismatches(const cv::Mat &a, const cv::Mat &b)
+    {
+        int mismatches = 0;
+        for (int y = 0; y < a.rows; ++y)
+        {
+            for (int i = 0; i < a.cols * a.channels(); ++i)
+            {
+                mismatches += a.ptr<T>(y)[i] != b.ptr<T>(y)[i] ? 1 : 0;
+            }
+        }
+        return mismatches;
+    }
+
+    template<typename T> void ExpectMedianMatchesReference(int type, int ksize, int scale)
+    {
+        cv::Mat image(75, 41, type);
+        for (int y = 0; y < image.rows; ++y)
+        {
+            for (int i = 0; i < image.cols * image.channels(); ++i)
+            {
+                image.ptr<T>(y)[i] = static_cast<T>(((y * 37 + i * 11 + (y * i) % 7) % 256) * scale);
+            }
+        }
+
+        Vision::Algorithms::MedianBlurNode node(1);
+        node.SetInputSlotData("Input", image);
+        node.SetInputSlotData("ksize", ksize);
+        node.Process();
+
+        const auto output = node.GetOutputSlot("Output").GetDataIf<cv::Mat>();
+        ASSERT_TRUE(output) << "ksize " << ksize;
+        ASSERT_EQ(output->type(), type);
+        ASSERT_EQ(output->size(), image.size());
+        EXPECT_EQ(CountMismatches<T>(*output, ReferenceMedian<T>(image, ksize)), 0) << "ksize " << ksize;
+    }
+
+    // Brute-force erosion or dilation; pixels outside the image are ignored, as in cv::morphologyEx
+    template<typename T> cv::Mat ReferenceExtremum(const cv::Mat &image, const cv::Mat &element, bool erode)
+    {
+        const int channels = image.channels();
+        const cv::Point anchor(element.cols / 2, element.rows / 2);
+        cv::Mat result(image.size(), image.type());
+        for (int y = 0; y < image.rows; ++y)
+        {
+            for (int i = 0; i < image.cols * channels; ++i)
+            {
+                T value = erode ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+                for (int ey = 0; ey < element.rows; ++ey)
+                {
+                    for (int ex = 0; ex < element.cols; ++ex)
+                    {
+                        const int sy = y + ey - anchor.y;
+                        const int sx = i / channels + ex - anchor.x;
+                        if (element.at<uchar>(ey, ex) == 0 || sy < 0 || sy >= image.rows || sx < 0 ||
+                            sx >= image.cols)
+                        {
+                            continue;
+                        }
+                        const T sample = image.ptr<T>(sy)[sx * channels + i % channels];
+                        value = erode ? std::min(value, sample) : std::max(value, sample);
+                    }
+                }
+                result.ptr<T>(y)[i] = value;
+            }
+        }
+        return result;
+    }
+
+    template<typename T>
+    void ExpectMorphologyMatchesReference(int type, const std::string &shape, int shapeCode, int ksize)
+    {
+        cv::Mat image(37, 53, type);
+        for (int y = 0; y < image.rows; ++y)
+        {
+            for (int i = 0; i < image.cols * image.channels(); ++i)
+            {
+                image.ptr<T>(y)[i] = static_cast<T>((y * 29 + i * 13 + (y * i) % 11) % 256);
+            }
+        }
+        const cv::Mat element = cv::getStructuringElement(shapeCode, cv::Size(ksize, ksize));
+        const cv::Mat eroded = ReferenceExtremum<T>(image, element, true);
+        const cv::Mat dilated = ReferenceExtremum<T>(image, element, false);
+        const cv::Mat closed = ReferenceExtremum<T>(dilated, element, true);
+
+        const auto run = [&](Vision::Algorithms::MorphOperation operation, int iterations) {
+            Vision::Algorithms::MorphologyNode node(1);
+            node.SetInputSlotData("Input", image);
+            node.SetInputSlotData("Operation", static_cast<int>(operation));
+            node.SetInputSlotData("ksize", ksize);
+            node.SetInputSlotData("iterations", iterations);
+            node.SetInputSlotDefault("Shape", shape);
+            node.Process();
+            const auto output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+            return output ? *output : cv::Mat();
+        };
+        EXPECT_EQ(CountMismatches<T>(run(Vision::Algorithms::MorphOperation::Erode, 1), eroded), 0) << shape;
+        EXPECT_EQ(CountMismatches<T>(run(Vision::Algorithms::MorphOperation::Dilate, 1), dilated), 0) << shape;
+        EXPECT_EQ(CountMismatches<T>(run(Vision::Algorithms::MorphOperation::Close, 1), closed), 0) << shape;
+        EXPECT_EQ(CountMismatches<T>(run(Vision::Algorithms::MorphOperation::Dilate, 2),
+                      ReferenceExtremum<T>(dilated, element, false)),
+            0)
+            << shape;
+    }
+
+    // Brute-force 3x3 Sobel derivative with reflected borders (cv::BORDER_DEFAULT)
+    float ReferenceSobel3(const cv::Mat &image, int y, int x, bool horizontal)
+    {
+        const auto reflect = [](int i, int n) { return i < 0 ? -i : i >= n ? 2 * (n - 1) - i : i; };
+        constexpr int kSmooth[3] = { 1, 2, 1 };
+        constexpr int kDeriv[3] = { -1, 0, 1 };
+        int sum = 0;
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const int weight = horizontal ? kSmooth[dy + 1] * kDeriv[dx + 1] : kDeriv[dy + 1] * kSmooth[dx + 1];
+                sum += weight * image.at<uchar>(reflect(y + dy, image.rows), reflect(x + dx, image.cols));
+            }
+        }
+        return static_cast<float>(sum);
+    }
+} // namespace
+
 class TestFilterNodes : public ::testing::Test
 {
 protected:
@@ -65,6 +227,49 @@ TEST_F(TestFilterNodes, MedianBlurNodeProcessing)
     EXPECT_EQ(outputImage.size(), inputImage.size());
 }
 
+TEST_F(TestFilterNodes, MedianBlurNodeStripsMatchWholeImage)
+{
+    // Above kStripPixels the node filters row strips, checking for cancellation in between
+    cv::Mat large(1500, 1000, CV_8UC1);
+    for (int r = 0; r < large.rows; ++r)
+    {
+        for (int c = 0; c < large.cols; ++c)
+        {
+            large.at<uchar>(r, c) = static_cast<uchar>((r * 31 + c * 17) % 256);
+        }
+    }
+    cv::Mat expected;
+    cv::medianBlur(large, expected, 5);
+
+    auto node = std::make_unique<Vision::Algorithms::MedianBlurNode>(1);
+    node->SetInputSlotData("Input", large);
+    node->SetInputSlotData("ksize", 5);
+    node->Process();
+
+    const auto output = node->GetOutputSlot("Output").GetDataIf<cv::Mat>();
+    ASSERT_TRUE(output);
+    ASSERT_EQ(output->size(), expected.size());
+    int mismatches = 0;
+    for (int r = 0; r < expected.rows; ++r)
+    {
+        for (int c = 0; c < expected.cols; ++c)
+        {
+            mismatches += output->at<uchar>(r, c) != expected.at<uchar>(r, c) ? 1 : 0;
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+TEST_F(TestFilterNodes, MedianBlurNodeHistogramEngineMatchesReference)
+{
+    // Large 8-bit kernels run on column histograms; 16-bit and float kernels above 5 are beyond cv::medianBlur
+    ExpectMedianMatchesReference<uchar>(CV_8UC1, 15, 1);
+    ExpectMedianMatchesReference<uchar>(CV_8UC3, 31, 1);
+    ExpectMedianMatchesReference<ushort>(CV_16UC1, 7, 257);
+    ExpectMedianMatchesReference<ushort>(CV_16UC3, 9, 251);
+    ExpectMedianMatchesReference<float>(CV_32FC1, 7, 1);
+}
+
 TEST_F(TestFilterNodes, MorphologyNodeProcessing)
 {
     auto node = std::make_unique<Vision::Algorithms::MorphologyNode>(1);
@@ -92,3 +297,69 @@ TEST_F(TestFilterNodes, MorphologyNodeProcessing)
     int outputWhitePixels = cv::countNonZero(outputImage);
     EXPECT_GT(outputWhitePixels, inputWhitePixels);
 }
+
+TEST_F(TestFilterNodes, MorphologyNodeLargeElementsMatchReference)
+{
+    // From Constants::Morphology::kLargeKernel up the node runs van Herk/Gil-Werman on rectangle decompositions
+    ExpectMorphologyMatchesReference<uchar>(CV_8UC1, "Rect", cv::MORPH_RECT, 15);
+    ExpectMorphologyMatchesReference<uchar>(CV_8UC3, "Ellipse", cv::MORPH_ELLIPSE, 21);
+    ExpectMorphologyMatchesReference<ushort>(CV_16UC1, "Cross", cv::MORPH_CROSS, 17);
+    ExpectMorphologyMatchesReference<float>(CV_32FC1, "Ellipse", cv::MORPH_ELLIPSE, 16);
+}
+
+TEST_F(TestFilterNodes, GradientNodeMatchesSobelDerivatives)
+{
+    cv::Mat image(23, 31, CV_8UC1);
+    for (int y = 0; y < image.rows; ++y)
+    {
+        for (int x = 0; x < image.cols; ++x)
+        {
+            image.at<uchar>(y, x) = static_cast<uchar>((x * x * 3 + y * 17 + (x * y) % 13) % 256);
+        }
+    }
+
+    Vision::Algorithms::GradientNode node(1);
+    node.SetInputSlotData("Input", image);
+    node.SetInputSlotData("OutputComponents", true);
+    node.SetInputSlotData("OutputAngle", true);
+    node.Process();
+
+    const auto magnitude = node.GetOutputSlot("Magnitude").GetData<cv::Mat>();
+    const auto gx = node.GetOutputSlot("Gx").GetData<cv::Mat>();
+    const auto gy = node.GetOutputSlot("Gy").GetData<cv::Mat>();
+    const auto angle = node.GetOutputSlot("Angle").GetData<cv::Mat>();
+    ASSERT_TRUE(magnitude && gx && gy && angle);
+    ASSERT_EQ(magnitude->type(), CV_32FC1);
+    ASSERT_EQ(gx->type(), CV_16SC1);
+    ASSERT_EQ(angle->type(), CV_32FC1);
+
+    int mismatches = 0;
+    for (int y = 0; y < image.rows; ++y)
+    {
+        for (int x = 0; x < image.cols; ++x)
+        {
+            const float expectedX = ReferenceSobel3(image, y, x, true);
+            const float expectedY = ReferenceSobel3(image, y, x, false);
+            float expectedAngle = std::atan2(expectedY, expectedX) * 57.2957795f;
+            expectedAngle = expectedAngle < 0.0f ? expectedAngle + 360.0f : expectedAngle;
+            const bool matches = gx->at<short>(y, x) == static_cast<short>(expectedX) &&
+                                 gy->at<short>(y, x) == static_cast<short>(expectedY) &&
+                                 std::abs(magnitude->at<float>(y, x) - std::hypot(expectedX, expectedY)) < 1e-3f &&
+                                 std::abs(angle->at<float>(y, x) - expectedAngle) < 1e-3f;
+            mismatches += matches ? 0 : 1;
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+
+    // Unselected outputs stay empty; L1 sums absolute derivatives
+    node.SetInputSlotData("OutputComponents", false);
+    node.SetInputSlotData("OutputAngle", false);
+    node.SetInputSlotDefault("Norm", std::string("L1"));
+    node.Process();
+    EXPECT_FALSE(node.GetOutputSlot("Gx").HasData());
+    EXPECT_FALSE(node.GetOutputSlot("Angle").HasData());
+    const auto l1 = node.GetOutputSlot("Magnitude").GetData<cv::Mat>();
+    ASSERT_TRUE(l1);
+    EXPECT_FLOAT_EQ(l1->at<float>(5, 7),
+        std::abs(ReferenceSobel3(image, 5, 7, true)) + std::abs(ReferenceSobel3(image, 5, 7, false)));
+}
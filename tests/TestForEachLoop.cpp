@@ -0,0 +1,235 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/ForEachNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/core.hpp>
+
+#include <atomic>
+#include <mutex>
+
+using namespace VisionCraft;
+using Tests::OutcomeOf;
+
+namespace
+{
+    // Starts the execution flow and outputs a settable list
+    class ListNode : public Nodes::Node
+    {
+    public:
+        ListNode(Nodes::NodeId id, Nodes::NodeData list) : Nodes::Node(id, "List"), list(std::move(list))
+        {
+            CreateExecutionOutputPin("Then");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ListNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", list);
+        }
+
+        Nodes::NodeData list;
+    };
+
+    // Outputs a constant without taking part in the execution flow
+    class ConstantNode : public Nodes::Node
+    {
+    public:
+        ConstantNode(Nodes::NodeId id, double value) : Nodes::Node(id, "Constant"), value(value)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ConstantNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", value);
+        }
+
+        double value;
+    };
+
+    // Squares its input, adds Offset, and records the inputs it saw
+    class SquareNode : public Nodes::Node
+    {
+    public:
+        explicit SquareNode(Nodes::NodeId id) : Nodes::Node(id, "Square")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Value", 0.0);
+            CreateInputSlot("Offset", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SquareNode";
+        }
+
+        void Process() override
+        {
+            const auto integer = GetInputValue<int>("Value");
+            const double value = integer ? *integer : GetInputValue<double>("Value").value_or(0.0);
+            {
+                std::scoped_lock lock(mutex);
+                seen.push_back(value);
+            }
+            ++processCount;
+            SetOutputSlotData("Output", value * value + GetInputValue<double>("Offset").value_or(0.0));
+        }
+
+        std::atomic<int> processCount{ 0 };
+        std::mutex mutex;
+        std::vector<double> seen;
+    };
+
+    // Sums the Mat it reads once the loop completed
+    class SumNode : public Nodes::Node
+    {
+    public:
+        explicit SumNode(Nodes::NodeId id) : Nodes::Node(id, "Sum")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateInputSlot("Values");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SumNode";
+        }
+
+        void Process() override
+        {
+            const auto values = GetInputValue<cv::Mat>("Values");
+            SetOutputSlotData("Output", values ? cv::sum(*values)[0] : -1.0);
+        }
+    };
+} // namespace
+
+class ForEachLoopTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // List 1 -> ForEach 2; Body -> Square 3 (Element in, Output back into Result); Completed -> Sum 4
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.AddNode(std::make_unique<ListNode>(1, 4));
+        editor.AddNode(std::make_unique<Vision::Algorithms::ForEachNode>(2));
+        editor.AddNode(std::make_unique<SquareNode>(3));
+        editor.AddNode(std::make_unique<SumNode>(4));
+        editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(2, "Body", 3, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(2, "Completed", 4, "Execute", Nodes::ConnectionType::Execution);
+        editor.AddConnection(1, "Output", 2, "List");
+        editor.AddConnection(2, "Element", 3, "Value");
+        editor.AddConnection(3, "Output", 2, "Result");
+        editor.AddConnection(2, "Results", 4, "Values");
+    }
+
+    void SetList(Nodes::NodeData list)
+    {
+        static_cast<ListNode *>(editor.GetNode(1))->list = std::move(list);
+        editor.MarkNodeDirty(1);
+    }
+
+    SquareNode &Square()
+    {
+        return *static_cast<SquareNode *>(editor.GetNode(3));
+    }
+
+    cv::Mat Results()
+    {
+        return editor.GetNode(2)->GetOutputSlot("Results").GetData<cv::Mat>().value_or(cv::Mat());
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(ForEachLoopTest, RunsTheBodyOncePerElement)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Square().processCount, 4);
+    const auto results = Results();
+    ASSERT_EQ(results.rows, 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_DOUBLE_EQ(results.at<double>(i, 0), i * i);
+    }
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Count").GetData<int>(), 4);
+    EXPECT_EQ(editor.GetNode(4)->GetOutputSlot("Output").GetData<double>(), 14.0);
+    EXPECT_EQ(OutcomeOf(editor, 3), Nodes::StepOutcome::Processed);
+
+    // The body keeps the last element's outputs
+    EXPECT_EQ(editor.GetNode(3)->GetOutputSlot("Output").GetData<double>(), 9.0);
+}
+
+TEST_P(ForEachLoopTest, NewListsReuseTheCompiledPlan)
+{
+    ASSERT_TRUE(editor.Execute());
+    const auto rebuilds = editor.GetExecutionPlanStatistics().rebuilds;
+
+    SetList(cv::Mat(cv::Mat_<double>(3, 1) << 1.5, 2.0, 3.0));
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(editor.GetExecutionPlanStatistics().rebuilds, rebuilds);
+    EXPECT_EQ(Square().processCount, 7);
+    EXPECT_EQ(editor.GetNode(4)->GetOutputSlot("Output").GetData<double>(), 2.25 + 4.0 + 9.0);
+}
+
+TEST_P(ForEachLoopTest, CleanLoopIsSkippedWithItsBody)
+{
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Square().processCount, 4);
+    EXPECT_EQ(OutcomeOf(editor, 2), Nodes::StepOutcome::Skipped);
+    EXPECT_EQ(OutcomeOf(editor, 3), Nodes::StepOutcome::Skipped);
+}
+
+TEST_P(ForEachLoopTest, BodyReadsValuesFromOutsideTheLoop)
+{
+    editor.AddNode(std::make_unique<ConstantNode>(5, 10.0));
+    editor.AddConnection(5, "Output", 3, "Offset");
+    ASSERT_TRUE(editor.Execute());
+
+    const auto results = Results();
+    ASSERT_EQ(results.rows, 4);
+    EXPECT_DOUBLE_EQ(results.at<double>(3, 0), 19.0);
+}
+
+TEST_P(ForEachLoopTest, SequentialIterationsRunInOrder)
+{
+    editor.GetNode(2)->SetInputSlotDefault("Parallel", false);
+    SetList(cv::Mat(cv::Mat_<double>(3, 1) << 3.0, 1.0, 2.0));
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Square().seen, (std::vector<double>{ 3.0, 1.0, 2.0 }));
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Count").GetData<int>(), 3);
+}
+
+TEST_P(ForEachLoopTest, EmptyListBypassesTheBody)
+{
+    SetList(0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Square().processCount, 0);
+    EXPECT_EQ(OutcomeOf(editor, 3), Nodes::StepOutcome::Bypassed);
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Count").GetData<int>(), 0);
+    EXPECT_FALSE(editor.GetNode(2)->GetOutputSlot("Results").HasData());
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    ForEachLoopTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,101 @@
+#include "UI/Rendering/FramePacer.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace VisionCraft;
+using UI::Rendering::FramePacer;
+
+namespace
+{
+    constexpr int kFramesPerWake = Constants::FramePacing::kFramesPerWake;
+
+    // Platform whose wait returns at once, as if an event were always queued
+    FramePacer::Platform CountingPlatform(int &waits, std::atomic<int> &wakes)
+    {
+        return { [&waits](double) { ++waits; }, [&wakes]() { wakes.fetch_add(1); } };
+    }
+} // namespace
+
+TEST(FramePacerTest, WaitsOnlyOnceOwedFramesAreDrawn)
+{
+    FramePacer pacer;
+    int waits = 0;
+    std::atomic<int> wakes = 0;
+    pacer.SetPlatform(CountingPlatform(waits, wakes));
+
+    // The first frames settle the UI without waiting
+    for (int frame = 0; frame < kFramesPerWake; ++frame)
+    {
+        pacer.WaitForNextFrame();
+    }
+    EXPECT_EQ(waits, 0);
+
+    // Then the loop blocks; an early return counts as an event and owes a few frames again
+    pacer.WaitForNextFrame();
+    EXPECT_EQ(waits, 1);
+    EXPECT_EQ(pacer.GetPendingFrames(), kFramesPerWake - 1);
+}
+
+TEST(FramePacerTest, DisabledIdleWaitNeverBlocks)
+{
+    FramePacer pacer;
+    int waits = 0;
+    std::atomic<int> wakes = 0;
+    pacer.SetPlatform(CountingPlatform(waits, wakes));
+    pacer.SetIdleWait(false);
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        pacer.WaitForNextFrame();
+    }
+    EXPECT_EQ(waits, 0);
+}
+
+TEST(FramePacerTest, WakeFromWorkerRequestsFrames)
+{
+    FramePacer pacer;
+    int waits = 0;
+    std::atomic<int> wakes = 0;
+    pacer.SetPlatform(CountingPlatform(waits, wakes));
+    for (int frame = 0; frame < kFramesPerWake; ++frame)
+    {
+        pacer.WaitForNextFrame();
+    }
+    ASSERT_EQ(pacer.GetPendingFrames(), 0);
+
+    std::jthread worker([&pacer]() { pacer.Wake(); });
+    worker.join();
+    EXPECT_EQ(wakes.load(), 1);
+    EXPECT_EQ(pacer.GetPendingFrames(), kFramesPerWake);
+
+    // Smaller requests never lower what a wake asked for
+    pacer.RequestFrames(1);
+    EXPECT_EQ(pacer.GetPendingFrames(), kFramesPerWake);
+
+    pacer.WaitForNextFrame();
+    EXPECT_EQ(waits, 0);
+}
+
+TEST(FramePacerTest, BusyFramesAreSpacedToMaxRate)
+{
+    constexpr int kFps = 100;
+
+    FramePacer pacer;
+    pacer.SetPlatform({ [](double timeoutSeconds) {
+                           std::this_thread::sleep_for(std::chrono::duration<double>(timeoutSeconds));
+                       },
+        []() {} });
+    pacer.SetMaxBusyFps(kFps);
+    pacer.SetBusy(true);
+
+    pacer.WaitForNextFrame();
+    const auto first = FramePacer::Clock::now();
+    pacer.RequestFrames(2);
+    pacer.WaitForNextFrame();
+    const auto second = FramePacer::Clock::now();
+
+    EXPECT_GE(second - first, std::chrono::microseconds(1000000 / kFps) - std::chrono::microseconds(500));
+}
@@ -0,0 +1,138 @@
+#include "UI/Rendering/FrameProfiler.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace VisionCraft;
+using UI::Rendering::DrawStats;
+using UI::Rendering::FrameProfiler;
+using UI::Rendering::FrameSection;
+
+namespace
+{
+    constexpr size_t kHistoryFrames = Constants::FrameProfiler::kHistoryFrames;
+
+    void RecordFrame(FrameProfiler &profiler, std::chrono::microseconds renderNodes, size_t vertices = 0)
+    {
+        profiler.BeginFrame();
+        profiler.AddSectionTime(FrameSection::RenderNodes, renderNodes);
+        profiler.EndFrame({ .vertices = vertices });
+    }
+} // namespace
+
+TEST(FrameProfilerTest, RecordsNothingWhileDisabled)
+{
+    FrameProfiler profiler;
+    RecordFrame(profiler, std::chrono::microseconds{ 100 });
+    EXPECT_TRUE(profiler.GetHistory().empty());
+
+    // Enabling between BeginFrame() and EndFrame() skips the partial frame
+    profiler.BeginFrame();
+    profiler.SetEnabled(true);
+    profiler.EndFrame({});
+    EXPECT_TRUE(profiler.GetHistory().empty());
+}
+
+TEST(FrameProfilerTest, AccumulatesSectionsPerFrame)
+{
+    FrameProfiler profiler;
+    profiler.SetEnabled(true);
+
+    profiler.BeginFrame();
+    profiler.AddSectionTime(FrameSection::HitTesting, std::chrono::microseconds{ 30 });
+    profiler.AddSectionTime(FrameSection::HitTesting, std::chrono::microseconds{ 20 });
+    profiler.EndFrame({ .vertices = 1200, .indices = 1800, .drawLists = 4, .commands = 9 });
+
+    ASSERT_EQ(profiler.GetHistory().size(), 1u);
+    const auto &sample = profiler.GetHistory().back();
+    EXPECT_EQ(sample.sections[static_cast<size_t>(FrameSection::HitTesting)].count(), 50);
+    EXPECT_EQ(sample.calls[static_cast<size_t>(FrameSection::HitTesting)], 2u);
+    EXPECT_EQ(sample.sections[static_cast<size_t>(FrameSection::RenderNodes)].count(), 0);
+    EXPECT_EQ(sample.draw.vertices, 1200u);
+    EXPECT_EQ(sample.draw.commands, 9u);
+    EXPECT_FALSE(sample.gpuTime.has_value());
+
+    // Times added between frames belong to no frame
+    profiler.AddSectionTime(FrameSection::HitTesting, std::chrono::microseconds{ 500 });
+    RecordFrame(profiler, std::chrono::microseconds{ 10 });
+    EXPECT_EQ(profiler.GetHistory().back().sections[static_cast<size_t>(FrameSection::HitTesting)].count(), 0);
+}
+
+TEST(FrameProfilerTest, KeepsARollingHistoryWithStatistics)
+{
+    FrameProfiler profiler;
+    profiler.SetEnabled(true);
+    for (size_t frame = 0; frame < kHistoryFrames + 10; ++frame)
+    {
+        RecordFrame(profiler, std::chrono::microseconds{ frame < 10 ? 5000 : 100 });
+    }
+
+    // The slow frames rolled out of the history
+    ASSERT_EQ(profiler.GetHistory().size(), kHistoryFrames);
+    EXPECT_EQ(profiler.GetHistory().front().frame, 10u);
+    EXPECT_EQ(profiler.GetCurrentFrame(), kHistoryFrames + 10);
+
+    const auto statistic = profiler.GetSectionStatistic(FrameSection::RenderNodes);
+    EXPECT_EQ(statistic.last.count(), 100);
+    EXPECT_EQ(statistic.average.count(), 100);
+    EXPECT_EQ(statistic.max.count(), 100);
+
+    // Re-enabling starts over
+    profiler.SetEnabled(false);
+    profiler.SetEnabled(true);
+    EXPECT_TRUE(profiler.GetHistory().empty());
+}
+
+TEST(FrameProfilerTest, AttachesLateGpuTimesToTheirFrame)
+{
+    FrameProfiler profiler;
+    profiler.SetEnabled(true);
+    const auto firstFrame = profiler.GetCurrentFrame();
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        RecordFrame(profiler, std::chrono::microseconds{ 0 });
+    }
+
+    profiler.RecordGpuTime(firstFrame + 1, std::chrono::microseconds{ 800 });
+    profiler.RecordGpuTime(firstFrame + 3, std::chrono::microseconds{ 400 });
+    profiler.RecordGpuTime(firstFrame + 99, std::chrono::microseconds{ 1 });
+
+    const auto &history = profiler.GetHistory();
+    EXPECT_FALSE(history[0].gpuTime.has_value());
+    EXPECT_EQ(history[1].gpuTime->count(), 800);
+    EXPECT_EQ(history[3].gpuTime->count(), 400);
+
+    // Only frames with a resolved query count towards the GPU statistic
+    const auto gpu = profiler.GetGpuStatistic();
+    EXPECT_EQ(gpu.last.count(), 400);
+    EXPECT_EQ(gpu.average.count(), 600);
+    EXPECT_EQ(gpu.max.count(), 800);
+}
+
+TEST(FrameProfilerTest, ScopesTimeTheSharedProfiler)
+{
+    auto &profiler = FrameProfiler::Get();
+    {
+        // Disabled: the scope records nothing and costs no clock reads
+        UI::Rendering::FrameScope scope(FrameSection::TextureUpload);
+    }
+
+    profiler.SetEnabled(true);
+    profiler.BeginFrame();
+    {
+        UI::Rendering::FrameScope scope(FrameSection::TextureUpload);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    profiler.EndFrame({});
+
+    ASSERT_EQ(profiler.GetHistory().size(), 1u);
+    const auto &sample = profiler.GetHistory().back();
+    const auto index = static_cast<size_t>(FrameSection::TextureUpload);
+    EXPECT_EQ(sample.calls[index], 1u);
+    EXPECT_GE(sample.sections[index].count(), 2000);
+    EXPECT_GE(sample.cpuTime, sample.sections[index]);
+
+    // The profiler is process-wide; leave it off for other tests
+    profiler.SetEnabled(false);
+}
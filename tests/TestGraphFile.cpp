@@ -0,0 +1,348 @@
+#include "Nodes/Core/GraphBinaryFormat.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/Factory/NodeFactory.h"
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Node with one parameter of every saved type
+    class ParameterNode : public Nodes::Node
+    {
+    public:
+        ParameterNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input");
+            CreateInputSlot("Gain", 1.0);
+            CreateInputSlot("Scale", 1.0f);
+            CreateInputSlot("Iterations", 1);
+            CreateInputSlot("Enabled", false);
+            CreateInputSlot("Label", std::string("none"));
+            CreateInputSlot("Path", std::filesystem::path());
+            CreateInputSlot("Points");
+            SetInputSlotDefault("Points", std::vector<cv::Point>{});
+            CreateOutputSlot("Output");
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+        }
+
+        std::string GetType() const override
+        {
+            return "ParameterNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", GetInputValue<double>("Gain").value_or(0.0));
+        }
+    };
+
+    using Positions = std::unordered_map<Nodes::NodeId, std::pair<float, float>>;
+} // namespace
+
+class GraphFileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Vision::NodeFactory::Register("ParameterNode", [](Nodes::NodeId id, std::string_view name) {
+            return std::make_unique<ParameterNode>(id, std::string(name));
+        });
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_graph_file_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    // Two tuned nodes with a data and an execution connection
+    void BuildTunedGraph(Nodes::NodeEditor &editor)
+    {
+        editor.AddNode(std::make_unique<ParameterNode>(1, "Source"));
+        editor.AddNode(std::make_unique<ParameterNode>(7, "Sink"));
+        auto *sink = editor.GetNode(7);
+        sink->SetInputSlotDefault("Gain", 2.5);
+        sink->SetInputSlotDefault("Scale", 0.25f);
+        sink->SetInputSlotDefault("Iterations", 4);
+        sink->SetInputSlotDefault("Enabled", true);
+        sink->SetInputSlotDefault("Label", std::string("tuned"));
+        sink->SetInputSlotDefault("Path", std::filesystem::path("images/out.png"));
+        sink->SetInputSlotDefault("Points", std::vector<cv::Point>{ { 1, 2 }, { -3, 4 } });
+        editor.AddConnection(1, "Output", 7, "Input");
+        editor.AddConnection(1, "Then", 7, "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    void ExpectTunedDefaults(const Nodes::Node &sink)
+    {
+        EXPECT_EQ(sink.GetInputSlot("Gain").GetDefaultValue<double>(), 2.5);
+        EXPECT_EQ(sink.GetInputSlot("Scale").GetDefaultValue<float>(), 0.25f);
+        EXPECT_EQ(sink.GetInputSlot("Iterations").GetDefaultValue<int>(), 4);
+        EXPECT_EQ(sink.GetInputSlot("Enabled").GetDefaultValue<bool>(), true);
+        EXPECT_EQ(sink.GetInputSlot("Label").GetDefaultValue<std::string>(), "tuned");
+        EXPECT_EQ(sink.GetInputSlot("Path").GetDefaultValue<std::filesystem::path>(),
+            std::filesystem::path("images/out.png"));
+        EXPECT_EQ(sink.GetInputSlot("Points").GetDefaultValue<std::vector<cv::Point>>(),
+            (std::vector<cv::Point>{ { 1, 2 }, { -3, 4 } }));
+    }
+
+    std::filesystem::path testDir;
+};
+
+TEST_F(GraphFileTest, BinaryRoundTripKeepsDefaultsPositionsAndConnectionTypes)
+{
+    Nodes::NodeEditor original;
+    BuildTunedGraph(original);
+    const auto path = testDir / "graph.vcgb";
+    ASSERT_TRUE(original.SaveToFile(path, { { 1, { 10.0f, 20.0f } }, { 7, { -5.5f, 40.0f } } }));
+
+    Nodes::NodeEditor loaded;
+    Positions positions;
+    ASSERT_TRUE(loaded.LoadFromFile(path, positions));
+
+    ASSERT_NE(loaded.GetNode(7), nullptr);
+    EXPECT_EQ(loaded.GetNode(7)->GetName(), "Sink");
+    ExpectTunedDefaults(*loaded.GetNode(7));
+
+    const auto connections = loaded.GetConnections();
+    ASSERT_EQ(connections.size(), 2u);
+    EXPECT_EQ(connections[0], original.GetConnections()[0]);
+    EXPECT_EQ(connections[1].type, Nodes::ConnectionType::Execution);
+
+    EXPECT_EQ(positions.size(), 2u);
+    EXPECT_EQ(positions[7], std::make_pair(-5.5f, 40.0f));
+}
+
+TEST_F(GraphFileTest, JsonRoundTripKeepsDefaults)
+{
+    Nodes::NodeEditor original;
+    BuildTunedGraph(original);
+    const auto path = testDir / "graph.json";
+    ASSERT_TRUE(original.SaveToFile(path, {}));
+
+    Nodes::NodeEditor loaded;
+    Positions positions;
+    ASSERT_TRUE(loaded.LoadFromFile(path, positions));
+    ASSERT_NE(loaded.GetNode(7), nullptr);
+    ExpectTunedDefaults(*loaded.GetNode(7));
+}
+
+TEST_F(GraphFileTest, AsyncSaveWritesTheGraphAsCaptured)
+{
+    Nodes::NodeEditor original;
+    BuildTunedGraph(original);
+    const auto path = testDir / "graph.autosave.vcgb";
+    auto saved = original.SaveToFileAsync(path, { { 7, { 3.0f, 4.0f } } });
+
+    // Edits after the call are not part of the save
+    original.GetNode(7)->SetInputSlotDefault("Gain", 9.0);
+    ASSERT_TRUE(original.RemoveNode(1));
+    ASSERT_TRUE(saved.get());
+
+    Nodes::NodeEditor loaded;
+    Positions positions;
+    ASSERT_TRUE(loaded.LoadFromFile(path, positions));
+    ASSERT_NE(loaded.GetNode(1), nullptr);
+    ExpectTunedDefaults(*loaded.GetNode(7));
+    EXPECT_EQ(loaded.GetConnections().size(), 2u);
+    EXPECT_EQ(positions[7], std::make_pair(3.0f, 4.0f));
+
+    // The file was written under a temporary name and renamed into place
+    EXPECT_EQ(std::distance(std::filesystem::directory_iterator(testDir), std::filesystem::directory_iterator()), 1);
+}
+
+TEST_F(GraphFileTest, BinaryLoadsGraphsBeyondJsonNodeLimit)
+{
+    constexpr Nodes::NodeId kNodes = 12000;
+    Nodes::NodeEditor original;
+    for (Nodes::NodeId id = 1; id <= kNodes; ++id)
+    {
+        original.AddNode(std::make_unique<ParameterNode>(id, "Node"));
+        if (id > 1)
+        {
+            original.AddConnection(id - 1, "Output", id, "Input");
+        }
+    }
+    const auto path = testDir / "large.vcgb";
+    ASSERT_TRUE(original.SaveToFile(path, {}));
+
+    Nodes::NodeEditor loaded;
+    Positions positions;
+    ASSERT_TRUE(loaded.LoadFromFile(path, positions));
+    EXPECT_EQ(loaded.GetNodeIds().size(), static_cast<size_t>(kNodes));
+    EXPECT_EQ(loaded.GetConnections().size(), static_cast<size_t>(kNodes - 1));
+}
+
+TEST_F(GraphFileTest, LaterConnectionReplacesEarlierIntoSameSlot)
+{
+    Nodes::GraphBinaryWriter writer;
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        writer.AddNode(id, "ParameterNode", "Node");
+    }
+    writer.AddConnection(1, "Output", 3, "Input", false);
+    writer.AddConnection(2, "Output", 3, "Input", false);
+    writer.AddConnection(1, "Then", 2, "Execute", true);
+    writer.AddConnection(1, "Then", 3, "Execute", true);
+    writer.AddConnection(4, "Output", 1, "Input", false); // Node 4 does not exist
+    const auto path = testDir / "duplicates.vcgb";
+    ASSERT_TRUE(writer.WriteTo(path));
+
+    Nodes::NodeEditor loaded;
+    Positions positions;
+    ASSERT_TRUE(loaded.LoadFromFile(path, positions));
+
+    // Same survivors as adding the connections one by one
+    Nodes::NodeEditor incremental;
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        incremental.AddNode(std::make_unique<ParameterNode>(id, "Node"));
+    }
+    incremental.AddConnection(1, "Output", 3, "Input");
+    incremental.AddConnection(2, "Output", 3, "Input");
+    incremental.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    incremental.AddConnection(1, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    EXPECT_EQ(loaded.GetConnections(), incremental.GetConnections());
+    ASSERT_EQ(loaded.GetConnections().size(), 2u);
+}
+
+TEST_F(GraphFileTest, CorruptedBinaryLeavesGraphUnchanged)
+{
+    Nodes::NodeEditor original;
+    BuildTunedGraph(original);
+    const auto path = testDir / "graph.vcgb";
+    ASSERT_TRUE(original.SaveToFile(path, {}));
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ParameterNode>(3, "Existing"));
+    Positions positions{ { 3, { 1.0f, 2.0f } } };
+    EXPECT_FALSE(editor.LoadFromFile(path, positions));
+    EXPECT_NE(editor.GetNode(3), nullptr);
+    EXPECT_EQ(positions.size(), 1u);
+
+    // A newer format version is rejected the same way
+    ASSERT_TRUE(original.SaveToFile(path, {}));
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        const uint32_t version = Nodes::GraphBinary::kVersion + 1;
+        file.seekp(offsetof(Nodes::GraphBinary::Header, version));
+        file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    }
+    EXPECT_FALSE(editor.LoadFromFile(path, positions));
+    EXPECT_NE(editor.GetNode(3), nullptr);
+}
+
+TEST_F(GraphFileTest, JsonLoadSkipsUnknownKeysInAnyOrder)
+{
+    // Hand-written: sections in non-saved order, foreign keys at every level, slot names omitted
+    const auto path = testDir / "handwritten.json";
+    std::ofstream(path) << R"({
+        "editor": { "zoom": 1.5, "panels": [ { "open": true }, [1, 2] ] },
+        "nodes": [
+            { "name": "Source", "id": 1, "type": "ParameterNode", "color": [255, 0, 0] },
+            { "type": "ParameterNode", "id": 2, "name": "Sink",
+              "defaults": { "Gain": 4.0, "Points": [[5, 6]], "Label": "set", "Missing": { "a": [1] } } }
+        ],
+        "connections": [ { "to": 2, "from": 1, "note": { "text": "data" } }, { "from": 1, "to": 9 } ],
+        "nodePositions": [ { "id": 2, "x": 3, "y": 4.5 } ],
+        "version": "1.0"
+    })";
+
+    Nodes::NodeEditor editor;
+    Positions positions;
+    ASSERT_TRUE(editor.LoadFromFile(path, positions));
+
+    ASSERT_NE(editor.GetNode(2), nullptr);
+    const auto &sink = *editor.GetNode(2);
+    EXPECT_EQ(sink.GetInputSlot("Gain").GetDefaultValue<double>(), 4.0);
+    EXPECT_EQ(sink.GetInputSlot("Label").GetDefaultValue<std::string>(), "set");
+    EXPECT_EQ(sink.GetInputSlot("Points").GetDefaultValue<std::vector<cv::Point>>(),
+        (std::vector<cv::Point>{ { 5, 6 } }));
+
+    const auto connections = editor.GetConnections();
+    ASSERT_EQ(connections.size(), 1u); // The connection to node 9 has no endpoint
+    EXPECT_EQ(connections[0].fromSlot, "Output");
+    EXPECT_EQ(connections[0].toSlot, "Input");
+    EXPECT_EQ(positions[2], std::make_pair(3.0f, 4.5f));
+}
+
+TEST_F(GraphFileTest, RejectedJsonLeavesGraphUnchanged)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ParameterNode>(3, "Existing"));
+    Positions positions{ { 3, { 1.0f, 2.0f } } };
+    const auto path = testDir / "bad.json";
+
+    const auto expectRejected = [&](const std::string &text) {
+        std::ofstream(path) << text;
+        EXPECT_FALSE(editor.LoadFromFile(path, positions)) << text;
+        EXPECT_NE(editor.GetNode(3), nullptr) << text;
+        EXPECT_EQ(positions.size(), 1u) << text;
+    };
+    expectRejected(R"({ "nodes": [ { "id": 1, "type": "ParameterNode", "name": "Cut )");
+    expectRejected(R"({ "nodes": [ { "id": 1, "name": "No type" } ] })");
+    expectRejected(R"({ "nodes": [ { "id": "1", "type": "ParameterNode", "name": "String ID" } ] })");
+    expectRejected(R"({ "nodes": { "id": 1 } })");
+    expectRejected(R"([ { "id": 1 } ])");
+
+    std::string tooMany = R"({ "nodes": [)";
+    for (int id = 1; id <= 10001; ++id)
+    {
+        tooMany += (id > 1 ? "," : "") + std::string(R"({"id":)") + std::to_string(id)
+                   + R"(,"type":"ParameterNode","name":"N"})";
+    }
+    expectRejected(tooMany + "] }");
+}
+
+TEST_F(GraphFileTest, InsertGraphMatchesIncrementalInsertion)
+{
+    // Existing graph: 1 -> 3 (data), 1 -> 3 (execution)
+    const auto buildExisting = [](Nodes::NodeEditor &editor) {
+        editor.AddNode(std::make_unique<ParameterNode>(1, "A"));
+        editor.AddNode(std::make_unique<ParameterNode>(3, "C"));
+        editor.AddConnection(1, "Output", 3, "Input");
+        editor.AddConnection(1, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    };
+    const std::vector<Nodes::Connection> added{
+        { .from = 4, .fromSlot = "Output", .to = 3, .toSlot = "Input" }, // Replaces 1 -> 3
+        { .from = 5, .fromSlot = "Output", .to = 4, .toSlot = "Input" },
+        { .from = 1, .fromSlot = "Then", .to = 4, .toSlot = "Execute", .type = Nodes::ConnectionType::Execution },
+        { .from = 6, .fromSlot = "Output", .to = 1, .toSlot = "Input" }, // Node 6 does not exist
+    };
+
+    Nodes::NodeEditor bulk;
+    buildExisting(bulk);
+    std::vector<Nodes::NodePtr> newNodes;
+    newNodes.push_back(std::make_unique<ParameterNode>(4, "D"));
+    newNodes.push_back(std::make_unique<ParameterNode>(5, "E"));
+    EXPECT_EQ(bulk.InsertGraph(std::move(newNodes), added), 3u);
+
+    Nodes::NodeEditor incremental;
+    buildExisting(incremental);
+    incremental.AddNode(std::make_unique<ParameterNode>(4, "D"));
+    incremental.AddNode(std::make_unique<ParameterNode>(5, "E"));
+    for (const auto &connection : added)
+    {
+        if (incremental.GetNode(connection.from) && incremental.GetNode(connection.to))
+        {
+            incremental.AddConnection(
+                connection.from, connection.fromSlot, connection.to, connection.toSlot, connection.type);
+        }
+    }
+
+    EXPECT_EQ(bulk.GetConnections(), incremental.GetConnections());
+    EXPECT_EQ(bulk.GetNodeIds().size(), 4u);
+}
@@ -0,0 +1,111 @@
+#include "Nodes/Core/EngineConstants.h"
+#include "Vision/Factory/GraphGenerator.h"
+#include "Vision/Factory/NodeFactory.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+using namespace VisionCraft;
+
+class GraphGeneratorTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Vision::NodeFactory::RegisterAllNodes();
+    }
+};
+
+TEST_F(GraphGeneratorTest, GeneratedGraphIsValid)
+{
+    Nodes::NodeEditor editor;
+    const auto generated = Vision::GraphGenerator::Generate(editor, { .nodeCount = 2'000, .maxFanOut = 3 });
+    ASSERT_TRUE(generated.has_value());
+    EXPECT_EQ(editor.GetNodeIds().size(), 2'000);
+    EXPECT_EQ(generated->positions.size(), 2'000);
+
+    const auto connections = editor.GetConnections();
+    EXPECT_EQ(connections.size(), generated->dataEdges + generated->executionEdges);
+    EXPECT_GT(generated->dataEdges, 1'000);
+    EXPECT_GT(generated->executionEdges, 0);
+
+    std::set<std::pair<Nodes::NodeId, std::string>> connectedInputs;
+    std::unordered_map<Nodes::NodeId, size_t> fanOut;
+    for (const auto &connection : connections)
+    {
+        // IDs follow the layers and edges point down, so the graph is acyclic
+        EXPECT_LT(connection.from, connection.to);
+        EXPECT_TRUE(connectedInputs.emplace(connection.to, connection.toSlot.Str()).second);
+        EXPECT_LE(++fanOut[connection.from], 3);
+
+        const auto *from = editor.GetNode(connection.from);
+        const auto *to = editor.GetNode(connection.to);
+        ASSERT_NE(from, nullptr);
+        ASSERT_NE(to, nullptr);
+        if (connection.type == Nodes::ConnectionType::Execution)
+        {
+            EXPECT_TRUE(from->HasExecutionOutputPin(connection.fromSlot.Str()));
+            EXPECT_TRUE(to->HasExecutionInputPin(connection.toSlot.Str()));
+        }
+        else
+        {
+            EXPECT_TRUE(from->HasOutputSlot(connection.fromSlot.Str()));
+            EXPECT_TRUE(to->HasInputSlot(connection.toSlot.Str()));
+        }
+    }
+}
+
+TEST_F(GraphGeneratorTest, SeedAndShapeAreHonoured)
+{
+    Nodes::NodeEditor first;
+    Nodes::NodeEditor second;
+    Nodes::NodeEditor other;
+    const Vision::GraphGeneratorOptions options{ .nodeCount = 300, .depth = 12, .seed = 7 };
+    const auto generated = Vision::GraphGenerator::Generate(first, options);
+    ASSERT_TRUE(generated.has_value());
+    ASSERT_TRUE(Vision::GraphGenerator::Generate(second, options).has_value());
+    ASSERT_TRUE(Vision::GraphGenerator::Generate(other, { .nodeCount = 300, .depth = 12, .seed = 8 }).has_value());
+
+    EXPECT_EQ(first.GetConnections(), second.GetConnections());
+    EXPECT_NE(first.GetConnections(), other.GetConnections());
+
+    EXPECT_EQ(generated->depth, 12);
+    float lastLayer = 0.0f;
+    for (const auto &[id, position] : generated->positions)
+    {
+        lastLayer = std::max(lastLayer, position.first);
+    }
+    EXPECT_FLOAT_EQ(lastLayer, 11 * Constants::Generator::kLayerSpacing);
+
+    // Restricting the types leaves only those in the graph
+    Nodes::NodeEditor restricted;
+    ASSERT_TRUE(
+        Vision::GraphGenerator::Generate(restricted, { .nodeCount = 50, .nodeTypes = { "Grayscale" } }).has_value());
+    for (const auto id : restricted.GetNodeIds())
+    {
+        EXPECT_EQ(restricted.GetNode(id)->GetType(), "GrayscaleNode");
+    }
+    EXPECT_FALSE(Vision::GraphGenerator::Generate(restricted, { .nodeTypes = { "NoSuchType" } }).has_value());
+}
+
+TEST_F(GraphGeneratorTest, SavedGraphLoadsBack)
+{
+    auto path = std::filesystem::temp_directory_path() / "visioncraft_generated_graph";
+    path += Constants::Persistence::kBinaryGraphExtension;
+    const auto generated = Vision::GraphGenerator::GenerateFile(path, { .nodeCount = 10'000 });
+    ASSERT_TRUE(generated.has_value());
+
+    Nodes::NodeEditor editor;
+    std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+    ASSERT_TRUE(editor.LoadFromFile(path, positions));
+    EXPECT_EQ(editor.GetNodeIds().size(), 10'000);
+    EXPECT_EQ(editor.GetConnections().size(), generated->dataEdges + generated->executionEdges);
+    EXPECT_EQ(positions.size(), 10'000);
+    std::filesystem::remove(path);
+}
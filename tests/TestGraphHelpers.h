@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Nodes/Core/NodeEditor.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace VisionCraft::Tests
+{
+    /**
+     * @brief Starts the execution flow and emits a fixed value, usually an image.
+     */
+    class SourceNode : public Nodes::Node
+    {
+    public:
+        /**
+         * @brief Constructs source node.
+         * @param id Node ID
+         * @param data Value written to "Output" on every run
+         * @param reportsShape Whether InferOutputShape() reports the image's shape before running
+         */
+        SourceNode(Nodes::NodeId id, Nodes::NodeData data, bool reportsShape = false)
+            : Nodes::Node(id, "Source"), data(std::move(data)), reportsShape(reportsShape)
+        {
+            CreateExecutionOutputPin("Then");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SourceNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", data);
+        }
+
+        std::optional<Nodes::ImageShape> InferOutputShape(
+            [[maybe_unused]] const std::optional<Nodes::ImageShape> &input) const override
+        {
+            const auto *image = std::get_if<cv::Mat>(&data);
+            if (!reportsShape || !image)
+            {
+                return std::nullopt;
+            }
+            return Nodes::ImageShape{ .size = image->size(), .type = image->type() };
+        }
+
+        Nodes::NodeData data; ///< Emitted value; tests may replace it between runs
+
+    private:
+        bool reportsShape; ///< InferOutputShape() answers for an image
+    };
+
+    /**
+     * @brief Connects Output -> Input and Then -> Execute.
+     * @param editor Graph to connect in
+     * @param from Producer node
+     * @param to Consumer node
+     */
+    inline void Link(Nodes::NodeEditor &editor, Nodes::NodeId from, Nodes::NodeId to)
+    {
+        editor.AddConnection(from, "Output", to, "Input");
+        editor.AddConnection(from, "Then", to, "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    /**
+     * @brief Returns the image a node wrote to an output slot.
+     * @param editor Graph holding the node
+     * @param id Node ID
+     * @param slot Output slot name
+     * @return Shared image, or nullptr if the slot holds none
+     */
+    inline std::shared_ptr<const cv::Mat> OutputOf(const Nodes::NodeEditor &editor,
+        Nodes::NodeId id,
+        const std::string &slot = "Output")
+    {
+        return editor.GetNode(id)->GetOutputSlot(slot).GetDataIf<cv::Mat>();
+    }
+
+    /**
+     * @brief Returns what the latest run did with a node.
+     * @param editor Graph that ran
+     * @param id Node ID
+     * @return Outcome of the node's step (NotRun if the run had none), or nullopt if no run was recorded
+     */
+    inline std::optional<Nodes::StepOutcome> OutcomeOf(const Nodes::NodeEditor &editor, Nodes::NodeId id)
+    {
+        const auto run = editor.GetExecutionStatistics().GetLatest();
+        if (!run)
+        {
+            return std::nullopt;
+        }
+        for (const auto &record : run->nodes)
+        {
+            if (record.nodeId == id)
+            {
+                return record.outcome;
+            }
+        }
+        return Nodes::StepOutcome::NotRun;
+    }
+
+    /**
+     * @brief Creates an 8-bit single-channel image whose pixels differ along both axes.
+     * @param rows Image height
+     * @param cols Image width
+     * @return Deterministic test pattern
+     */
+    inline cv::Mat MakePattern(int rows, int cols)
+    {
+        cv::Mat image(rows, cols, CV_8UC1);
+        for (int r = 0; r < rows; ++r)
+        {
+            for (int c = 0; c < cols; ++c)
+            {
+                image.at<uchar>(r, c) = static_cast<uchar>((r * 31 + c * 17 + (r * c) % 7) & 0xFF);
+            }
+        }
+        return image;
+    }
+
+    /**
+     * @brief Checks that two images have the same size, type and pixels.
+     * @param a First image
+     * @param b Second image
+     * @return True if the images are equal
+     */
+    inline bool SameImage(const cv::Mat &a, const cv::Mat &b)
+    {
+        return a.size() == b.size() && a.type() == b.type() && cv::norm(a, b, cv::NORM_INF) == 0;
+    }
+} // namespace VisionCraft::Tests
@@ -0,0 +1,259 @@
+#include "CLI/GraphServer.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "Vision/Factory/NodeFactory.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <opencv2/opencv.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace VisionCraft;
+
+class GraphServerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Every instance loads the graph file, so its nodes must come from the factory
+        Vision::NodeFactory::RegisterAllNodes();
+
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_server_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+        graphPath = testDir / "graph.json";
+
+        Nodes::NodeEditor editor;
+        editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+        editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(2));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+        ASSERT_TRUE(editor.SaveToFile(graphPath, {}));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    std::unique_ptr<CLI::GraphServer> CreateServer(size_t instances = 2)
+    {
+        std::string error;
+        auto server = CLI::GraphServer::Create({ .port = 0, .instances = instances },
+            std::make_shared<Nodes::ExecutorService>(),
+            [this](Nodes::NodeEditor &editor, std::string &) {
+                std::unordered_map<Nodes::NodeId, std::pair<float, float>> positions;
+                return editor.LoadFromFile(graphPath, positions);
+            },
+            error);
+        EXPECT_NE(server, nullptr) << error;
+        return server;
+    }
+
+    static std::string EncodeImage(int value)
+    {
+        std::vector<uchar> bytes;
+        cv::imencode(".png", cv::Mat(4, 6, CV_8UC3, cv::Scalar(value, value, value)), bytes);
+        return { bytes.begin(), bytes.end() };
+    }
+
+    static CLI::HttpRequest MakeRun(std::string body, std::vector<std::pair<std::string, std::string>> query = {})
+    {
+        return { .method = "POST", .path = "/run", .query = std::move(query), .body = std::move(body) };
+    }
+
+    static cv::Mat Decode(const CLI::HttpResponse &response)
+    {
+        const cv::Mat bytes(
+            1, static_cast<int>(response.body.size()), CV_8UC1, const_cast<char *>(response.body.data()));
+        return cv::imdecode(bytes, cv::IMREAD_COLOR);
+    }
+
+    std::filesystem::path testDir;
+    std::filesystem::path graphPath;
+};
+
+TEST_F(GraphServerTest, RunReturnsEncodedResult)
+{
+    auto server = CreateServer();
+    ASSERT_NE(server, nullptr);
+
+    const auto response = server->Handle(MakeRun(EncodeImage(40)));
+    ASSERT_EQ(response.status, 200) << response.body;
+    EXPECT_EQ(response.contentType, "image/png");
+    const auto image = Decode(response);
+    ASSERT_EQ(image.size(), cv::Size(6, 4));
+    EXPECT_EQ(image.at<cv::Vec3b>(3, 5)[0], 40);
+}
+
+TEST_F(GraphServerTest, OverridesLastOneRequest)
+{
+    auto server = CreateServer(1);
+    ASSERT_NE(server, nullptr);
+
+    auto response = server->Handle(MakeRun(EncodeImage(10), { { "set", "2.Format=jpg" } }));
+    ASSERT_EQ(response.status, 200) << response.body;
+    EXPECT_EQ(response.contentType, "image/jpeg");
+
+    response = server->Handle(MakeRun(EncodeImage(20)));
+    ASSERT_EQ(response.status, 200) << response.body;
+    EXPECT_EQ(response.contentType, "image/png");
+    EXPECT_EQ(Decode(response).at<cv::Vec3b>(0, 0)[0], 20);
+
+    response = server->Handle(MakeRun(EncodeImage(30), { { "format", "jpg" } }));
+    EXPECT_EQ(response.contentType, "image/jpeg");
+}
+
+TEST_F(GraphServerTest, ValuesAreReturnedAsJson)
+{
+    auto server = CreateServer();
+    ASSERT_NE(server, nullptr);
+
+    const auto response = server->Handle(MakeRun(EncodeImage(5), { { "value", "1.Output" } }));
+    ASSERT_EQ(response.status, 200) << response.body;
+    EXPECT_EQ(response.contentType, "application/json");
+    const auto json = nlohmann::json::parse(response.body);
+    EXPECT_EQ(json["1.Output"]["rows"], 4);
+    EXPECT_EQ(json["1.Output"]["cols"], 6);
+}
+
+TEST_F(GraphServerTest, BadRequestsAreRejected)
+{
+    auto server = CreateServer();
+    ASSERT_NE(server, nullptr);
+
+    EXPECT_EQ(server->Handle(MakeRun("not an image")).status, 400);
+    EXPECT_EQ(server->Handle(MakeRun(EncodeImage(1), { { "set", "2.Format" } })).status, 400);
+    EXPECT_EQ(server->Handle(MakeRun(EncodeImage(1), { { "set", "2.Missing=1" } })).status, 400);
+    EXPECT_EQ(server->Handle(MakeRun(EncodeImage(1), { { "value", "9.Output" } })).status, 400);
+    EXPECT_EQ(server->Handle(MakeRun(EncodeImage(1), { { "output", "1" } })).status, 400);
+    EXPECT_EQ(server->Handle(MakeRun(EncodeImage(1), { { "format", "nope" } })).status, 400);
+    EXPECT_EQ(server->Handle({ .method = "GET", .path = "/run" }).status, 405);
+    EXPECT_EQ(server->Handle({ .method = "GET", .path = "/missing" }).status, 404);
+
+    const auto health = server->Handle({ .method = "GET", .path = "/health" });
+    ASSERT_EQ(health.status, 200);
+    const auto json = nlohmann::json::parse(health.body);
+    EXPECT_EQ(json["instances"], 2);
+    EXPECT_EQ(json["failed"], 8);
+
+    EXPECT_EQ(server->GetStatistics().requests, 9);
+}
+
+TEST_F(GraphServerTest, MetricsAreServedInPrometheusFormat)
+{
+    auto &metrics = Nodes::RuntimeMetrics::Get();
+    metrics.Reset();
+    metrics.SetEnabled(true);
+    auto server = CreateServer();
+    ASSERT_NE(server, nullptr);
+
+    ASSERT_EQ(server->Handle(MakeRun(EncodeImage(40))).status, 200);
+    EXPECT_EQ(server->Handle(MakeRun("not an image")).status, 400);
+
+    const auto response = server->Handle({ .method = "GET", .path = "/metrics" });
+    metrics.SetEnabled(false);
+    metrics.Reset();
+    ASSERT_EQ(response.status, 200);
+    EXPECT_EQ(response.contentType, "text/plain; version=0.0.4");
+    EXPECT_NE(response.body.find("visioncraft_images_total{result=\"succeeded\"} 1\n"), std::string::npos);
+    EXPECT_NE(response.body.find("visioncraft_node_duration_seconds_count{node=\"1\",type=\"ImageInputNode\"} 1\n"),
+        std::string::npos);
+    EXPECT_NE(response.body.find("visioncraft_server_requests_total 2\n"), std::string::npos);
+    EXPECT_NE(response.body.find("visioncraft_server_failed_requests_total 1\n"), std::string::npos);
+    EXPECT_NE(response.body.find("visioncraft_server_instances 2\n"), std::string::npos);
+
+    // Scrapes are not requests
+    EXPECT_EQ(server->GetStatistics().requests, 2);
+}
+
+#if !defined(_WIN32)
+namespace
+{
+    // Sends one request on a fresh connection and returns everything the server sends before closing
+    std::string Exchange(uint16_t port, const std::string &request)
+    {
+        const int client = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+        if (connect(client, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0)
+        {
+            close(client);
+            return {};
+        }
+
+        send(client, request.data(), request.size(), 0);
+        std::string response;
+        char chunk[4096];
+        for (ssize_t received; (received = recv(client, chunk, sizeof(chunk), 0)) > 0;)
+        {
+            response.append(chunk, static_cast<size_t>(received));
+        }
+        close(client);
+        return response;
+    }
+} // namespace
+
+TEST_F(GraphServerTest, ServesConcurrentConnections)
+{
+    auto server = CreateServer();
+    ASSERT_NE(server, nullptr);
+    std::string error;
+    ASSERT_TRUE(server->Start(error)) << error;
+    ASSERT_NE(server->GetPort(), 0);
+    std::jthread serving([&server](std::stop_token stopToken) { server->Serve(stopToken); });
+
+    constexpr int kClients = 4;
+    constexpr int kRequests = 5;
+    std::atomic<int> succeeded = 0;
+    std::vector<std::thread> clients;
+    for (int c = 0; c < kClients; ++c)
+    {
+        clients.emplace_back([&, c]() {
+            for (int r = 0; r < kRequests; ++r)
+            {
+                const auto body = EncodeImage(c * 10 + r);
+                const auto response =
+                    Exchange(server->GetPort(),
+                        "POST /run?set=2.Format%3Dpng HTTP/1.1\r\nContent-Length: " + std::to_string(body.size())
+                            + "\r\nConnection: close\r\n\r\n" + body);
+                const auto bodyStart = response.find("\r\n\r\n");
+                if (response.starts_with("HTTP/1.1 200") && bodyStart != std::string::npos)
+                {
+                    const auto image = Decode({ .body = response.substr(bodyStart + 4) });
+                    if (!image.empty() && image.at<cv::Vec3b>(0, 0)[0] == c * 10 + r)
+                    {
+                        ++succeeded;
+                    }
+                }
+            }
+        });
+    }
+    for (auto &client : clients)
+    {
+        client.join();
+    }
+    EXPECT_EQ(succeeded, kClients * kRequests);
+
+    const auto health = Exchange(server->GetPort(), "GET /health HTTP/1.0\r\n\r\n");
+    EXPECT_TRUE(health.starts_with("HTTP/1.1 200")) << health;
+
+    serving.request_stop();
+    serving.join();
+    EXPECT_EQ(server->GetStatistics().busyInstances, 0);
+}
+#endif
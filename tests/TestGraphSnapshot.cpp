@@ -0,0 +1,194 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Lets the test hold a node inside Process() while it inspects or edits the graph
+    struct Gate
+    {
+        std::atomic<bool> entered{ false };
+        std::atomic<bool> released{ false };
+
+        void WaitUntilEntered() const
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!entered.load() && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    };
+
+    // Outputs a constant once the gate opens (or after a timeout so a broken test cannot hang)
+    class GatedNode : public Nodes::Node
+    {
+    public:
+        GatedNode(Nodes::NodeId id, Gate &gate, double value)
+            : Nodes::Node(id, "Gated"), gate(gate), value(value)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "GatedNode";
+        }
+
+        void Process() override
+        {
+            gate.entered.store(true);
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (!gate.released.load() && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            SetOutputSlotData("Output", value);
+        }
+
+    private:
+        Gate &gate;
+        double value;
+    };
+
+    // Copies its input to its output, counting how often it ran
+    class RelayNode : public Nodes::Node
+    {
+    public:
+        explicit RelayNode(Nodes::NodeId id) : Nodes::Node(id, "Relay")
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "RelayNode";
+        }
+
+        void Process() override
+        {
+            ++runs;
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(-1.0));
+        }
+
+        std::atomic<int> runs{ 0 };
+    };
+} // namespace
+
+class GraphSnapshotTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        editor.AddNode(std::make_unique<GatedNode>(1, gate, 7.0));
+        relay = static_cast<RelayNode *>(editor.GetNode(editor.AddNode(std::make_unique<RelayNode>(2))));
+        editor.AddConnection(1, "Output", 2, "Input");
+    }
+
+    // Starts Execute() on another thread and returns once the gated node is running
+    std::future<bool> StartBlockedExecution()
+    {
+        auto result = std::async(std::launch::async, [this]() { return editor.Execute(); });
+        gate.WaitUntilEntered();
+        return result;
+    }
+
+    Gate gate;
+    Nodes::NodeEditor editor;
+    RelayNode *relay = nullptr;
+};
+
+TEST_F(GraphSnapshotTest, GraphVersionAdvancesOnStructuralChangesOnly)
+{
+    const auto initial = editor.GetGraphVersion();
+
+    editor.AddNode(std::make_unique<RelayNode>(3));
+    EXPECT_GT(editor.GetGraphVersion(), initial);
+
+    const auto afterAdd = editor.GetGraphVersion();
+    editor.AddConnection(2, "Output", 3, "Input");
+    EXPECT_GT(editor.GetGraphVersion(), afterAdd);
+
+    const auto afterConnect = editor.GetGraphVersion();
+    gate.released.store(true);
+    ASSERT_TRUE(editor.Execute());
+    editor.GetNode(3)->SetInputSlotDefault("Input", 1.0);
+    EXPECT_EQ(editor.GetGraphVersion(), afterConnect);
+
+    ASSERT_TRUE(editor.RemoveNode(3));
+    EXPECT_GT(editor.GetGraphVersion(), afterConnect);
+}
+
+TEST_F(GraphSnapshotTest, GraphReadsDoNotWaitForRunningExecution)
+{
+    auto execution = StartBlockedExecution();
+    ASSERT_TRUE(gate.entered.load());
+
+    // Each of these used to block until the gated node finished
+    EXPECT_EQ(editor.GetNodeIds().size(), 2);
+    EXPECT_EQ(editor.GetConnections().size(), 1);
+    EXPECT_NE(editor.GetNode(1), nullptr);
+    EXPECT_FALSE(gate.released.load());
+
+    gate.released.store(true);
+    EXPECT_TRUE(execution.get());
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Output").GetData<double>(), 7.0);
+}
+
+TEST_F(GraphSnapshotTest, EditsDuringExecutionApplyToNextRun)
+{
+    auto execution = StartBlockedExecution();
+
+    editor.AddNode(std::make_unique<RelayNode>(3));
+    editor.AddConnection(2, "Output", 3, "Input");
+    auto *added = static_cast<RelayNode *>(editor.GetNode(3));
+
+    gate.released.store(true);
+    ASSERT_TRUE(execution.get());
+    EXPECT_EQ(added->runs.load(), 0); // Not part of the running snapshot
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(added->runs.load(), 1);
+    EXPECT_EQ(added->GetOutputSlot("Output").GetData<double>(), 7.0);
+}
+
+TEST_F(GraphSnapshotTest, RemovingNodeDuringExecutionIsSafe)
+{
+    editor.SetOutputCacheEnabled(false); // Count every Process() call
+    auto execution = StartBlockedExecution();
+
+    ASSERT_TRUE(editor.RemoveNode(1));
+    EXPECT_EQ(editor.GetNode(1), nullptr);
+    EXPECT_TRUE(editor.GetConnections().empty());
+
+    // The running snapshot keeps the removed node alive until it finishes
+    gate.released.store(true);
+    EXPECT_TRUE(execution.get());
+
+    EXPECT_EQ(relay->runs.load(), 1);
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(relay->runs.load(), 2); // Lost its upstream node, so it reran against the new graph
+}
+
+TEST_F(GraphSnapshotTest, ParallelExecutionRunsAgainstSnapshot)
+{
+    editor.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+    auto execution = StartBlockedExecution();
+
+    editor.AddNode(std::make_unique<RelayNode>(3));
+    EXPECT_EQ(editor.GetNodeIds().size(), 3);
+
+    gate.released.store(true);
+    EXPECT_TRUE(execution.get());
+    EXPECT_EQ(static_cast<RelayNode *>(editor.GetNode(3))->runs.load(), 0);
+    EXPECT_EQ(relay->GetOutputSlot("Output").GetData<double>(), 7.0);
+}
@@ -0,0 +1,191 @@
+#include "Nodes/Core/ImageBatch.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CvtColorNode.h"
+#include "Vision/Algorithms/MedianBlurNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace VisionCraft;
+using Nodes::ImageBatch;
+using Tests::SourceNode;
+using Vision::Algorithms::ColorConversion;
+
+namespace
+{
+    std::vector<cv::Mat> RandomImages(size_t count, int rows, int cols, int type)
+    {
+        std::vector<cv::Mat> images(count);
+        for (auto &image : images)
+        {
+            image.create(rows, cols, type);
+            cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(256));
+        }
+        return images;
+    }
+
+    // Inverts images; counts how often each path runs
+    class InvertNode : public Nodes::Node
+    {
+    public:
+        InvertNode(Nodes::NodeId id, bool tileable) : Nodes::Node(id, "Invert"), tileable(tileable)
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "InvertNode";
+        }
+
+        void Process() override
+        {
+            ++processCalls;
+            const auto input = GetInputValueIf<cv::Mat>("Input");
+            if (!input || input->empty())
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+            cv::Mat output;
+            cv::bitwise_not(*input, output);
+            SetOutputSlotData("Output", std::move(output));
+        }
+
+        std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override
+        {
+            if (!tileable)
+            {
+                return std::nullopt;
+            }
+            return Nodes::TileOperation{ .halo = 0,
+                .outputType = inputType,
+                .apply =
+                    [](const cv::Mat &tile) {
+                        cv::Mat result;
+                        cv::bitwise_not(tile, result);
+                        return result;
+                    } };
+        }
+
+        bool tileable;
+        int processCalls = 0;
+    };
+} // namespace
+
+TEST(ImageBatchTest, StacksImagesInOneBuffer)
+{
+    const auto images = RandomImages(3, 24, 32, CV_8UC3);
+    const auto batch = ImageBatch::FromImages(images);
+    ASSERT_EQ(batch.GetCount(), 3u);
+    EXPECT_EQ(batch.GetImageSize(), cv::Size(32, 24));
+    EXPECT_EQ(batch.GetType(), CV_8UC3);
+    EXPECT_EQ(batch.GetStorage().rows, 72);
+    EXPECT_EQ(batch.GetByteSize(), size_t{ 3 } * 24 * 32 * 3);
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        EXPECT_EQ(cv::norm(batch.GetImage(i), images[i], cv::NORM_INF), 0.0);
+    }
+    EXPECT_THROW((void)batch.GetImage(3), std::out_of_range);
+
+    // Wrapping the buffer again shares it
+    const auto wrapped = ImageBatch::FromStorage(batch.GetStorage(), 3);
+    EXPECT_EQ(wrapped.GetImage(2).data, batch.GetImage(2).data);
+    EXPECT_NE(batch.Clone().GetStorage().data, batch.GetStorage().data);
+
+    EXPECT_TRUE(ImageBatch::FromImages({}).IsEmpty());
+}
+
+TEST(ImageBatchTest, RejectsMismatchedImages)
+{
+    auto images = RandomImages(2, 16, 16, CV_8UC1);
+    images.push_back(RandomImages(1, 16, 17, CV_8UC1).front());
+    EXPECT_THROW((void)ImageBatch::FromImages(images), std::invalid_argument);
+
+    images.back() = RandomImages(1, 16, 16, CV_8UC3).front();
+    EXPECT_THROW((void)ImageBatch::FromImages(images), std::invalid_argument);
+
+    EXPECT_THROW((void)ImageBatch::FromStorage(cv::Mat(10, 4, CV_8UC1), 3), std::invalid_argument);
+    EXPECT_THROW((void)ImageBatch::Create(0, cv::Size(4, 4), CV_8UC1), std::invalid_argument);
+}
+
+TEST(ImageBatchTest, ImagesHaveTheirOwnBorders)
+{
+    // A filter on one image must not read the rows of its neighbours
+    const auto images = RandomImages(3, 20, 20, CV_8UC1);
+    const auto batch = ImageBatch::FromImages(images);
+    cv::Mat blurred;
+    cv::Mat expected;
+    cv::GaussianBlur(batch.GetImage(1), blurred, cv::Size(5, 5), 0);
+    cv::GaussianBlur(images[1], expected, cv::Size(5, 5), 0);
+    EXPECT_EQ(cv::norm(blurred, expected, cv::NORM_INF), 0.0);
+}
+
+TEST(ImageBatchTest, TileOperationsRunOncePerBatch)
+{
+    const auto images = RandomImages(4, 16, 16, CV_8UC3);
+    for (const bool tileable : { true, false })
+    {
+        Nodes::NodeEditor editor;
+        editor.SetOutputCacheEnabled(false);
+        editor.AddNode(std::make_unique<SourceNode>(1, ImageBatch::FromImages(images)));
+        editor.AddNode(std::make_unique<InvertNode>(2, tileable));
+        editor.AddConnection(1, "Output", 2, "Input");
+        ASSERT_TRUE(editor.Execute());
+
+        const auto *invert = dynamic_cast<InvertNode *>(editor.GetNode(2));
+        ASSERT_NE(invert, nullptr);
+        EXPECT_EQ(invert->processCalls, tileable ? 0 : 4);
+
+        const auto output = invert->GetOutputSlot("Output").GetDataIf<ImageBatch>();
+        ASSERT_TRUE(output);
+        ASSERT_EQ(output->GetCount(), images.size());
+        for (size_t i = 0; i < images.size(); ++i)
+        {
+            cv::Mat expected;
+            cv::bitwise_not(images[i], expected);
+            EXPECT_EQ(cv::norm(output->GetImage(i), expected, cv::NORM_INF), 0.0);
+        }
+
+        // The input slot holds the batch again once the per-image runs are done
+        EXPECT_TRUE(invert->GetInputSlot("Input").GetDataIf<ImageBatch>());
+    }
+}
+
+TEST(ImageBatchTest, BatchedChainsMatchPerImageRuns)
+{
+    const auto images = RandomImages(5, 32, 48, CV_8UC3);
+
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<SourceNode>(1, ImageBatch::FromImages(images)));
+    editor.AddNode(std::make_unique<Vision::Algorithms::CvtColorNode>(2));
+    editor.GetNode(2)->SetInputSlotDefault("Conversion", static_cast<int>(ColorConversion::BGR2GRAY));
+    editor.AddNode(std::make_unique<Vision::Algorithms::MedianBlurNode>(3));
+    editor.GetNode(3)->SetInputSlotDefault("ksize", 5);
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(2, "Output", 3, "Input");
+    ASSERT_TRUE(editor.Execute());
+
+    const auto output = editor.GetNode(3)->GetOutputSlot("Output").GetDataIf<ImageBatch>();
+    ASSERT_TRUE(output);
+    ASSERT_EQ(output->GetCount(), images.size());
+    EXPECT_EQ(output->GetType(), CV_8UC1);
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        cv::Mat gray;
+        cv::Mat expected;
+        cv::cvtColor(images[i], gray, cv::COLOR_BGR2GRAY);
+        cv::medianBlur(gray, expected, 5);
+        EXPECT_EQ(cv::norm(output->GetImage(i), expected, cv::NORM_INF), 0.0);
+    }
+}
@@ -0,0 +1,141 @@
+#include "Nodes/Core/ImageBufferPool.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+
+namespace
+{
+    constexpr size_t kBudget = 1024 * 1024;
+
+    // Writes a constant image into a pooled output buffer
+    class FillNode : public Nodes::Node
+    {
+    public:
+        FillNode(Nodes::NodeId id, int rows, int cols) : Nodes::Node(id, "Fill"), rows(rows), cols(cols)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "FillNode";
+        }
+
+        bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        void Process() override
+        {
+            cv::Mat image = CreateOutputImage();
+            image.create(rows, cols, CV_8UC1);
+            for (int r = 0; r < rows; ++r)
+            {
+                for (int c = 0; c < cols; ++c)
+                {
+                    image.at<uchar>(r, c) = static_cast<uchar>(processCount);
+                }
+            }
+            ++processCount;
+            SetOutputSlotData("Output", std::move(image));
+        }
+
+        int rows;
+        int cols;
+        int processCount = 0;
+    };
+} // namespace
+
+TEST(ImageBufferPoolTest, ReusesReleasedBufferOfSameSize)
+{
+    const auto pool = std::make_shared<Nodes::ImageBufferPool>(kBudget);
+
+    cv::Mat first = pool->CreateImage();
+    first.create(16, 8, CV_8UC3);
+    const uchar *firstData = first.data;
+    first.release();
+
+    cv::Mat second = pool->CreateImage();
+    second.create(16, 8, CV_8UC3);
+
+    EXPECT_EQ(second.data, firstData);
+    const auto stats = pool->GetStatistics();
+    EXPECT_EQ(stats.allocated, 1u);
+    EXPECT_EQ(stats.reused, 1u);
+    EXPECT_EQ(stats.idleBuffers, 0u);
+}
+
+TEST(ImageBufferPoolTest, NeverHandsOutBufferStillInUse)
+{
+    const auto pool = std::make_shared<Nodes::ImageBufferPool>(kBudget);
+
+    cv::Mat first = pool->CreateImage();
+    first.create(10, 10, CV_8UC1);
+    const cv::Mat sharer = first; // Still references the buffer after first is released
+    first.release();
+
+    cv::Mat second = pool->CreateImage();
+    second.create(10, 10, CV_8UC1);
+
+    EXPECT_NE(second.data, sharer.data);
+    EXPECT_EQ(pool->GetStatistics().reused, 0u);
+}
+
+TEST(ImageBufferPoolTest, FreesBuffersBeyondIdleBudget)
+{
+    const auto pool = std::make_shared<Nodes::ImageBufferPool>(150);
+
+    cv::Mat small = pool->CreateImage();
+    small.create(10, 10, CV_8UC1);
+    cv::Mat large = pool->CreateImage();
+    large.create(20, 20, CV_8UC1);
+    small.release();
+    large.release();
+
+    auto stats = pool->GetStatistics();
+    EXPECT_EQ(stats.idleBuffers, 1u);
+    EXPECT_EQ(stats.idleBytes, 100u);
+
+    pool->SetIdleByteBudget(0);
+    stats = pool->GetStatistics();
+    EXPECT_EQ(stats.idleBuffers, 0u);
+    EXPECT_EQ(stats.idleBytes, 0u);
+}
+
+TEST(ImageBufferPoolTest, ImagesOutliveThePoolHandle)
+{
+    auto pool = std::make_shared<Nodes::ImageBufferPool>(kBudget);
+    cv::Mat image = pool->CreateImage();
+    image.create(4, 4, CV_8UC1);
+    image.at<uchar>(3, 3) = 42;
+
+    pool.reset();
+
+    EXPECT_EQ(image.at<uchar>(3, 3), 42);
+    image.release(); // Destroys the pool
+}
+
+TEST(ImageBufferPoolTest, EditorReusesOutputBuffersAcrossRuns)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<FillNode>(1, 32, 32));
+
+    // The previous output is released only after its replacement is allocated, so two buffers alternate
+    for (int run = 0; run < 4; ++run)
+    {
+        editor.MarkAllNodesDirty();
+        ASSERT_TRUE(editor.Execute());
+    }
+
+    const auto stats = editor.GetImageBufferPool().GetStatistics();
+    EXPECT_EQ(stats.allocated, 2u);
+    EXPECT_EQ(stats.reused, 2u);
+    const auto output = editor.GetNode(1)->GetOutputSlot("Output").GetDataIf<cv::Mat>();
+    ASSERT_TRUE(output);
+    EXPECT_EQ(output->at<uchar>(31, 31), 3);
+}
@@ -0,0 +1,157 @@
+#include "Vision/IO/ImageCodec.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+using Vision::IO::ImageCodec;
+using Vision::IO::JpegBackend;
+
+class ImageCodecTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_image_codec_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        ImageCodec::SetAccelerationEnabled(true);
+        std::filesystem::remove_all(testDir);
+    }
+
+    // Smooth color ramps, which JPEG reproduces closely
+    static cv::Mat MakeGradient(int rows, int cols)
+    {
+        cv::Mat image(rows, cols, CV_8UC3);
+        for (int y = 0; y < rows; ++y)
+        {
+            for (int x = 0; x < cols; ++x)
+            {
+                image.at<cv::Vec3b>(y, x) = cv::Vec3b(static_cast<uint8_t>(x * 255 / cols),
+                    static_cast<uint8_t>(y * 255 / rows),
+                    static_cast<uint8_t>((x + y) * 127 / (rows + cols)));
+            }
+        }
+        return image;
+    }
+
+    static double MeanDifference(const cv::Mat &first, const cv::Mat &second)
+    {
+        cv::Mat difference;
+        cv::absdiff(first, second, difference);
+        return cv::mean(difference)[0];
+    }
+
+    std::filesystem::path testDir;
+};
+
+TEST_F(ImageCodecTest, JpegRoundTripMatchesOpenCv)
+{
+    const auto path = testDir / "ramp.jpg";
+    const cv::Mat image = MakeGradient(120, 160);
+    ASSERT_TRUE(ImageCodec::Write(path, image, { cv::IMWRITE_JPEG_QUALITY, 95 }));
+
+    const cv::Mat decoded = ImageCodec::Read(path);
+    const cv::Mat reference = cv::imread(path.string(), cv::IMREAD_COLOR);
+    ASSERT_EQ(decoded.size(), reference.size());
+    ASSERT_EQ(decoded.type(), CV_8UC3);
+    EXPECT_LE(cv::norm(decoded, reference, cv::NORM_INF), 4.0);
+    EXPECT_LT(MeanDifference(decoded, image), 3.0);
+}
+
+TEST_F(ImageCodecTest, ReducedReadsMatchOpenCvSizes)
+{
+    // Odd sizes check that reduced dimensions round up as cv::IMREAD_REDUCED_COLOR_* does
+    const auto path = testDir / "odd.jpeg";
+    ASSERT_TRUE(cv::imwrite(path.string(), MakeGradient(75, 101)));
+
+    const std::pair<int, int> reductions[] = { { 2, cv::IMREAD_REDUCED_COLOR_2 },
+        { 4, cv::IMREAD_REDUCED_COLOR_4 },
+        { 8, cv::IMREAD_REDUCED_COLOR_8 } };
+    for (const auto &[reduction, flag] : reductions)
+    {
+        const cv::Mat reduced = ImageCodec::Read(path, reduction);
+        const cv::Mat reference = cv::imread(path.string(), flag);
+        ASSERT_EQ(reduced.size(), reference.size()) << "reduction " << reduction;
+        EXPECT_LT(MeanDifference(reduced, reference), 2.0) << "reduction " << reduction;
+    }
+}
+
+TEST_F(ImageCodecTest, AppliesExifOrientationLikeImread)
+{
+    std::vector<unsigned char> encoded;
+    ASSERT_TRUE(cv::imencode(".jpg", MakeGradient(40, 64), encoded));
+
+    // APP1 "Exif" with a little-endian TIFF header and one IFD entry: Orientation (SHORT) = 6, rotate 90 CW
+    const std::vector<unsigned char> exif = { 0xFF, 0xE1, 0x00, 0x22, 'E', 'x', 'i', 'f', 0, 0, 'I', 'I', 0x2A,
+        0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x12, 0x01, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    encoded.insert(encoded.begin() + 2, exif.begin(), exif.end());
+    const auto path = testDir / "rotated.jpg";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+    }
+
+    const cv::Mat decoded = ImageCodec::Read(path);
+    const cv::Mat reference = cv::imread(path.string(), cv::IMREAD_COLOR);
+    ASSERT_EQ(reference.size(), cv::Size(40, 64));
+    ASSERT_EQ(decoded.size(), reference.size());
+    EXPECT_LE(cv::norm(decoded, reference, cv::NORM_INF), 4.0);
+}
+
+TEST_F(ImageCodecTest, OtherFormatsGoThroughOpenCv)
+{
+    const auto path = testDir / "exact.png";
+    const cv::Mat image = MakeGradient(32, 48);
+    ASSERT_TRUE(ImageCodec::Write(path, image, {}));
+    EXPECT_EQ(cv::norm(ImageCodec::Read(path), image, cv::NORM_INF), 0.0);
+    EXPECT_FALSE(ImageCodec::IsJpegPath(path));
+    EXPECT_TRUE(ImageCodec::IsJpegPath("photo.JPG"));
+    EXPECT_TRUE(ImageCodec::IsJpegPath("photo.jpeg"));
+}
+
+TEST_F(ImageCodecTest, UnreadableFilesComeBackEmpty)
+{
+    EXPECT_TRUE(ImageCodec::Read(testDir / "missing.jpg").empty());
+
+    const auto path = testDir / "garbage.jpg";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "not a jpeg at all";
+    }
+    EXPECT_TRUE(ImageCodec::Read(path).empty());
+}
+
+TEST_F(ImageCodecTest, BackendsFollowAvailabilityAndSettings)
+{
+    const cv::Mat image = MakeGradient(16, 16);
+    const std::vector<int> plain{ cv::IMWRITE_JPEG_QUALITY, 90 };
+
+    // Depths and settings only OpenCV handles never leave it
+    EXPECT_EQ(ImageCodec::GetEncodeBackend(cv::Mat(16, 16, CV_16UC3), plain), JpegBackend::OpenCv);
+    EXPECT_EQ(ImageCodec::GetEncodeBackend(image, { cv::IMWRITE_JPEG_PROGRESSIVE, 1 }), JpegBackend::OpenCv);
+
+    ImageCodec::SetAccelerationEnabled(false);
+    EXPECT_FALSE(ImageCodec::IsAccelerationEnabled());
+    EXPECT_EQ(ImageCodec::GetDecodeBackend(64 * 1024 * 1024), JpegBackend::OpenCv);
+    EXPECT_EQ(ImageCodec::GetEncodeBackend(image, plain), JpegBackend::OpenCv);
+
+    // Disabled, JPEG files are exactly what OpenCV writes and reads
+    const auto path = testDir / "opencv.jpg";
+    ASSERT_TRUE(ImageCodec::Write(path, image, plain));
+    EXPECT_EQ(cv::norm(ImageCodec::Read(path), cv::imread(path.string()), cv::NORM_INF), 0.0);
+
+    EXPECT_STREQ(ImageCodec::GetBackendName(JpegBackend::NvJpeg), "nvJPEG");
+    EXPECT_STREQ(ImageCodec::GetBackendName(JpegBackend::OpenCv), "OpenCV");
+}
@@ -1,9 +1,12 @@
 #include "Vision/IO/ImageInputNode.h"
 #include "Vision/IO/ImageOutputNode.h"
 #include "Vision/IO/PreviewNode.h"
+#include "Vision/IO/PreviewTexture.h"
+#include "Vision/IO/StreamingTexture.h"
 
 #include <opencv2/opencv.hpp>
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
@@ -302,6 +305,45 @@ TEST_F(ImageNodesTest, ImageOutputNodeProcessMultipleTimes)
     EXPECT_EQ(node.GetDisplayImage().rows, testImage2.rows);
 }
 
+TEST_F(ImageNodesTest, ImageOutputNodeEncodeProfiles)
+{
+    using Vision::IO::EncodeProfile;
+    using Vision::IO::ImageOutputNode;
+
+    EXPECT_EQ(ImageOutputNode::GetEncodeParams("png", EncodeProfile::Fastest),
+        (std::vector<int>{ cv::IMWRITE_PNG_COMPRESSION, 1 }));
+    EXPECT_EQ(ImageOutputNode::GetEncodeParams("PNG", EncodeProfile::Smallest),
+        (std::vector<int>{ cv::IMWRITE_PNG_COMPRESSION, 9 }));
+    EXPECT_EQ(ImageOutputNode::GetEncodeParams("tiff", EncodeProfile::Fastest),
+        (std::vector<int>{ cv::IMWRITE_TIFF_COMPRESSION, 1 }));
+    EXPECT_EQ(ImageOutputNode::GetEncodeParams("pgm"), (std::vector<int>{ cv::IMWRITE_PXM_BINARY, 1 }));
+    EXPECT_TRUE(ImageOutputNode::GetEncodeParams("bmp", EncodeProfile::Smallest).empty());
+
+    EXPECT_EQ(ImageOutputNode::ParseEncodeProfile("Smallest"), EncodeProfile::Smallest);
+    EXPECT_FALSE(ImageOutputNode::ParseEncodeProfile("tiny").has_value());
+}
+
+TEST_F(ImageNodesTest, ImageOutputNodeWritesThumbnail)
+{
+    Vision::IO::ImageOutputNode node(1, "Output");
+    node.SetInputSlotData("Input", cv::Mat(64, 32, CV_8UC3, cv::Scalar(10, 20, 30)));
+    node.SetInputSlotDefault("SavePath", testDir / "result");
+    node.SetInputSlotDefault("Format", std::string("png"));
+    node.SetInputSlotDefault("Profile", std::string("fastest"));
+    node.SetInputSlotDefault("ThumbnailPath", testDir / "thumbs" / "result.jpg");
+    node.SetInputSlotDefault("ThumbnailSize", 16);
+    node.SetInputSlotDefault("AutoSave", true);
+    node.Process();
+
+    // Both files come from the same queued write
+    ASSERT_TRUE(node.GetLastSaveStatus());
+    EXPECT_TRUE(std::filesystem::exists(testDir / "result.png"));
+    const cv::Mat thumbnail = cv::imread((testDir / "thumbs" / "result.jpg").string());
+    ASSERT_FALSE(thumbnail.empty());
+    EXPECT_EQ(thumbnail.rows, 16);
+    EXPECT_EQ(thumbnail.cols, 8);
+}
+
 // ============================================================================
 // Vision::IO::PreviewNode Tests
 // ============================================================================
@@ -393,6 +435,63 @@ TEST_F(ImageNodesTest, PreviewNodeSetInputImage)
     EXPECT_NO_THROW(node.SetInputImage(testImage));
 }
 
+TEST_F(ImageNodesTest, PreviewNodeFlagsNewImageForTextureUpdate)
+{
+    Vision::IO::PreviewNode node(1, "Preview");
+    EXPECT_FALSE(node.NeedsTextureUpdate());
+
+    node.SetInputSlotData("Input", CreateColorTestImage());
+    node.Process();
+
+    EXPECT_TRUE(node.NeedsTextureUpdate());
+}
+
+TEST_F(ImageNodesTest, StreamingTextureUploadsOpenCvChannelOrder)
+{
+    const auto color = Vision::IO::StreamingTexture::LayoutFor(CreateColorTestImage());
+    ASSERT_TRUE(color.has_value());
+    EXPECT_EQ(color->format, static_cast<GLenum>(GL_BGR));
+    EXPECT_EQ(color->rowBytes, static_cast<size_t>(CreateColorTestImage().cols) * 3);
+
+    const auto gray = Vision::IO::StreamingTexture::LayoutFor(CreateGrayscaleTestImage());
+    ASSERT_TRUE(gray.has_value());
+    EXPECT_EQ(gray->format, static_cast<GLenum>(GL_RED));
+    EXPECT_EQ(gray->swizzle[0], GL_RED);
+    EXPECT_EQ(gray->swizzle[1], GL_RED);
+    EXPECT_EQ(gray->swizzle[2], GL_RED);
+    EXPECT_EQ(gray->swizzle[3], GL_ONE);
+
+    const auto bgra = Vision::IO::StreamingTexture::LayoutFor(cv::Mat(4, 4, CV_8UC4));
+    ASSERT_TRUE(bgra.has_value());
+    EXPECT_EQ(bgra->format, static_cast<GLenum>(GL_BGRA));
+    EXPECT_EQ(bgra->swizzle[3], GL_ONE);
+
+    EXPECT_FALSE(Vision::IO::StreamingTexture::LayoutFor(cv::Mat(4, 4, CV_8UC2)).has_value());
+    EXPECT_FALSE(Vision::IO::StreamingTexture::LayoutFor(cv::Mat(4, 4, CV_16UC3)).has_value());
+    EXPECT_FALSE(Vision::IO::StreamingTexture::LayoutFor(cv::Mat{}).has_value());
+}
+
+TEST_F(ImageNodesTest, PreviewThumbnailFitsLongestEdge)
+{
+    const cv::Mat image(2160, 3840, CV_8UC3, cv::Scalar(10, 20, 30));
+
+    const cv::Mat thumbnail = Vision::IO::PreviewTexture::MakeThumbnail(image, 512);
+
+    EXPECT_EQ(thumbnail.cols, 512);
+    EXPECT_EQ(thumbnail.rows, 288);
+    EXPECT_EQ(thumbnail.type(), image.type());
+    EXPECT_EQ(thumbnail.at<cv::Vec3b>(100, 100), cv::Vec3b(10, 20, 30));
+}
+
+TEST_F(ImageNodesTest, PreviewThumbnailKeepsSmallImages)
+{
+    const cv::Mat image = CreateColorTestImage();
+
+    const cv::Mat thumbnail = Vision::IO::PreviewTexture::MakeThumbnail(image, std::max(image.cols, image.rows));
+
+    EXPECT_EQ(thumbnail.data, image.data);
+}
+
 TEST_F(ImageNodesTest, PreviewNodeCalculatePreviewDimensionsNoImage)
 {
     Vision::IO::PreviewNode node(1, "Preview");
@@ -0,0 +1,113 @@
+#include "Nodes/Core/ImagePyramid.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/ImagePyramidNode.h"
+#include "Vision/Algorithms/ResizeNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <stdexcept>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::OutputOf;
+using Tests::SameImage;
+using Tests::SourceNode;
+
+namespace
+{
+    cv::Mat MakeImage(int rows, int cols)
+    {
+        cv::Mat image(rows, cols, CV_8UC3);
+        cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+        return image;
+    }
+} // namespace
+
+TEST(ImagePyramidTest, BuildsLevelsLazilyAndSharesThemWithCopies)
+{
+    const cv::Mat image = MakeImage(48, 64);
+    const Nodes::ImagePyramid pyramid(image);
+    EXPECT_EQ(pyramid.GetLevelCount(), 7u); // 64x48 down to 1x1
+    EXPECT_EQ(pyramid.GetBuiltLevelCount(), 1u);
+    EXPECT_EQ(pyramid.GetBase().data, image.data);
+
+    const Nodes::ImagePyramid copy = pyramid;
+    const cv::Mat level2 = copy.GetLevel(2);
+    EXPECT_EQ(level2.size(), cv::Size(16, 12));
+    EXPECT_EQ(pyramid.GetBuiltLevelCount(), 3u);
+
+    cv::Mat expected;
+    cv::pyrDown(image, expected);
+    EXPECT_TRUE(SameImage(pyramid.GetLevel(1), expected));
+    EXPECT_EQ(Nodes::ImagePyramid::GetLevelSize(cv::Size(5, 3), 1), cv::Size(3, 2));
+    EXPECT_THROW((void)pyramid.GetLevel(7), std::out_of_range);
+
+    // A clone shares nothing, not even the levels built so far
+    const auto clone = pyramid.Clone();
+    EXPECT_NE(clone.GetBase().data, image.data);
+    EXPECT_EQ(clone.GetBuiltLevelCount(), 1u);
+    EXPECT_TRUE(Nodes::ImagePyramid().IsEmpty());
+}
+
+TEST(ImagePyramidTest, SamplesFromTheNearestLevelAboveTheSize)
+{
+    const cv::Mat image = MakeImage(64, 64);
+    const Nodes::ImagePyramid pyramid(image, Nodes::ImagePyramid::Filter::Area);
+
+    cv::Mat half;
+    cv::resize(image, half, cv::Size(32, 32), 0.0, 0.0, cv::INTER_AREA);
+    EXPECT_TRUE(SameImage(pyramid.GetLevel(1), half));
+
+    // An exact level size is the level itself
+    EXPECT_EQ(pyramid.Sample(cv::Size(16, 16)).data, pyramid.GetLevel(2).data);
+
+    EXPECT_EQ(pyramid.SelectLevel(cv::Size(20, 12)), 1u);
+    EXPECT_EQ(pyramid.Sample(cv::Size(20, 12)).size(), cv::Size(20, 12));
+    EXPECT_EQ(pyramid.SelectLevel(cv::Size(100, 100)), 0u);
+    EXPECT_THROW((void)Nodes::ImagePyramid().Sample(cv::Size(4, 4)), std::out_of_range);
+}
+
+TEST(ImagePyramidTest, ConsumersShareOnePyramid)
+{
+    const cv::Mat image = MakeImage(64, 96);
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    auto pyramidNode = std::make_unique<Vision::Algorithms::ImagePyramidNode>(2);
+    pyramidNode->SetInputSlotData("Filter", std::string("Area"));
+    editor.AddNode(std::move(pyramidNode));
+    for (const Nodes::NodeId id : { 3, 4 })
+    {
+        auto resize = std::make_unique<Vision::Algorithms::ResizeNode>(id);
+        resize->SetInputSlotData("ScaleX", id == 3 ? 0.25 : 0.5);
+        resize->SetInputSlotData("ScaleY", id == 3 ? 0.25 : 0.5);
+        resize->SetInputSlotData("Interpolation", static_cast<int>(Vision::Algorithms::InterpolationMethod::Area));
+        editor.AddNode(std::move(resize));
+    }
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(5));
+    Link(editor, 1, 2);
+    Link(editor, 2, 3);
+    Link(editor, 2, 4);
+    Link(editor, 2, 5);
+
+    ASSERT_TRUE(editor.Execute());
+
+    const auto pyramid = editor.GetNode(2)->GetOutputSlot("Output").GetDataIf<Nodes::ImagePyramid>();
+    ASSERT_TRUE(pyramid);
+    EXPECT_EQ(pyramid->GetBuiltLevelCount(), 3u); // The half-size level was built once for both resizes
+
+    const auto quarter = OutputOf(editor, 3);
+    const auto half = OutputOf(editor, 4);
+    ASSERT_TRUE(quarter);
+    ASSERT_TRUE(half);
+    EXPECT_EQ(quarter->data, pyramid->GetLevel(2).data);
+    EXPECT_EQ(half->data, pyramid->GetLevel(1).data);
+
+    // Nodes that do not read pyramids get the full-resolution image
+    const auto thresholded = OutputOf(editor, 5);
+    ASSERT_TRUE(thresholded);
+    EXPECT_EQ(thresholded->size(), image.size());
+}
@@ -0,0 +1,200 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <stdexcept>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Multiplies its input by a parameter and counts Process() calls
+    class CountingNode : public Nodes::Node
+    {
+    public:
+        CountingNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input", 1.0);
+            CreateInputSlot("Factor", 2.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CountingNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            if (shouldThrow)
+            {
+                throw std::runtime_error("intentional failure");
+            }
+            const auto input = GetInputValue<double>("Input").value_or(0.0);
+            const auto factor = GetInputValue<double>("Factor").value_or(1.0);
+            SetOutputSlotData("Output", input * factor);
+        }
+
+        int processCount = 0;
+        bool shouldThrow = false;
+    };
+} // namespace
+
+class IncrementalExecutionTest : public ::testing::Test
+{
+protected:
+    // Builds chain 1 -> 2 -> 3
+    void SetUp() override
+    {
+        editor.SetOutputCacheEnabled(false); // Process counts here measure dirty tracking alone
+        for (Nodes::NodeId id = 1; id <= 3; ++id)
+        {
+            editor.AddNode(std::make_unique<CountingNode>(id, "Node"));
+        }
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+    }
+
+    CountingNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<CountingNode *>(editor.GetNode(id));
+    }
+
+    double OutputOf(Nodes::NodeId id)
+    {
+        return NodeAt(id).GetOutputSlot("Output").GetData<double>().value_or(-1.0);
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(IncrementalExecutionTest, NewNodesAreDirty)
+{
+    EXPECT_TRUE(editor.IsIncrementalExecution());
+    EXPECT_TRUE(NodeAt(1).IsDirty());
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+}
+
+TEST_F(IncrementalExecutionTest, SecondRunSkipsCleanNodes)
+{
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 1);
+    EXPECT_EQ(NodeAt(3).processCount, 1);
+    EXPECT_FALSE(NodeAt(3).IsDirty());
+    EXPECT_DOUBLE_EQ(OutputOf(3), 8.0); // Output retained from first run
+}
+
+TEST_F(IncrementalExecutionTest, ChangingDefaultRerunsNodeAndDownstreamOnly)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    NodeAt(2).SetInputSlotDefault("Factor", 10.0);
+    EXPECT_TRUE(NodeAt(2).IsDirty());
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+    EXPECT_DOUBLE_EQ(OutputOf(3), 40.0);
+}
+
+TEST_F(IncrementalExecutionTest, ChangingLastNodeDoesNotRerunUpstream)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    NodeAt(3).SetInputSlotDefault("Factor", 3.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 1);
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+    EXPECT_DOUBLE_EQ(OutputOf(3), 12.0);
+}
+
+TEST_F(IncrementalExecutionTest, ConnectionChangeMarksTargetDirty)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    editor.AddConnection(1, "Output", 3, "Input"); // Replaces 2 -> 3
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+    EXPECT_FALSE(NodeAt(2).IsDirty());
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+    EXPECT_DOUBLE_EQ(OutputOf(3), 4.0);
+}
+
+TEST_F(IncrementalExecutionTest, RemovingConnectionMarksTargetDirty)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    ASSERT_TRUE(editor.RemoveConnection(2, "Output", 3, "Input"));
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+}
+
+TEST_F(IncrementalExecutionTest, RemovingNodeMarksConsumersDirty)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    ASSERT_TRUE(editor.RemoveNode(2));
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+    EXPECT_FALSE(NodeAt(1).IsDirty());
+}
+
+TEST_F(IncrementalExecutionTest, MarkAllNodesDirtyForcesFullRun)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 2);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+}
+
+TEST_F(IncrementalExecutionTest, DisabledIncrementalRerunsEverything)
+{
+    editor.SetIncrementalExecution(false);
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 2);
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+}
+
+TEST_F(IncrementalExecutionTest, FailedNodeStaysDirty)
+{
+    NodeAt(2).shouldThrow = true;
+    EXPECT_FALSE(editor.Execute());
+    EXPECT_TRUE(NodeAt(2).IsDirty());
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+
+    NodeAt(2).shouldThrow = false;
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+    EXPECT_EQ(NodeAt(3).processCount, 1);
+    EXPECT_DOUBLE_EQ(OutputOf(3), 8.0);
+}
+
+TEST_F(IncrementalExecutionTest, ParallelModeSkipsCleanNodes)
+{
+    editor.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+    editor.SetWorkerCount(2);
+
+    ASSERT_TRUE(editor.Execute());
+    NodeAt(2).SetInputSlotDefault("Factor", 5.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+    EXPECT_DOUBLE_EQ(OutputOf(3), 20.0);
+}
@@ -0,0 +1,133 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Sums its two inputs (the second defaults to zero) and counts Process() calls
+    class SumNode : public Nodes::Node
+    {
+    public:
+        SumNode(Nodes::NodeId id, double initial) : Nodes::Node(id, "Sum")
+        {
+            CreateInputSlot("A", initial);
+            CreateInputSlot("B", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SumNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            const auto a = GetInputValue<double>("A").value_or(0.0);
+            const auto b = GetInputValue<double>("B").value_or(0.0);
+            SetOutputSlotData("Output", a + b);
+        }
+
+        int processCount = 0;
+    };
+} // namespace
+
+class IntermediateReleaseTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds diamond 1 -> {2, 3} -> 4, where node 4 sums both branches
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+        editor.AddNode(std::make_unique<SumNode>(1, 5.0));
+        editor.AddNode(std::make_unique<SumNode>(2, 0.0));
+        editor.AddNode(std::make_unique<SumNode>(3, 0.0));
+        editor.AddNode(std::make_unique<SumNode>(4, 0.0));
+        editor.AddConnection(1, "Output", 2, "A");
+        editor.AddConnection(1, "Output", 3, "A");
+        editor.AddConnection(2, "Output", 4, "A");
+        editor.AddConnection(3, "Output", 4, "B");
+    }
+
+    SumNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<SumNode *>(editor.GetNode(id));
+    }
+
+    double ResultOf(Nodes::NodeId id)
+    {
+        return NodeAt(id).GetOutputSlot("Output").GetData<double>().value_or(-1.0);
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(IntermediateReleaseTest, KeepsIntermediatesByDefault)
+{
+    ASSERT_FALSE(editor.IsIntermediateReleaseEnabled());
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_TRUE(NodeAt(1).GetOutputSlot("Output").HasData());
+    EXPECT_TRUE(NodeAt(2).GetInputSlot("A").HasData());
+    EXPECT_DOUBLE_EQ(ResultOf(4), 10.0);
+}
+
+TEST_P(IntermediateReleaseTest, ReleasesOutputsAfterLastConsumer)
+{
+    editor.SetIntermediateRelease(true);
+    ASSERT_TRUE(editor.Execute());
+
+    // Both branches read node 1 before it was released
+    EXPECT_DOUBLE_EQ(ResultOf(4), 10.0);
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        EXPECT_FALSE(NodeAt(id).GetOutputSlot("Output").HasData()) << "node " << id;
+        EXPECT_TRUE(NodeAt(id).IsDirty()) << "node " << id;
+    }
+    EXPECT_FALSE(NodeAt(2).GetInputSlot("A").HasData());
+
+    // The result node keeps its inputs and outputs
+    EXPECT_TRUE(NodeAt(4).GetInputSlot("A").HasData());
+    EXPECT_FALSE(NodeAt(4).IsDirty());
+}
+
+TEST_P(IntermediateReleaseTest, NextRunRebuildsReleasedOutputs)
+{
+    editor.SetIntermediateRelease(true);
+    ASSERT_TRUE(editor.Execute());
+
+    editor.GetNode(1)->SetInputSlotDefault("A", 7.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(ResultOf(4), 14.0);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+    EXPECT_EQ(NodeAt(4).processCount, 2);
+}
+
+TEST_P(IntermediateReleaseTest, KeepsOutputsReadOutsideTheExecutionFlow)
+{
+    // Wire the diamond's execution flow; node 5 has no execution pins, so it is not part of the plan
+    editor.GetNode(1)->CreateExecutionOutputPin("Then");
+    for (Nodes::NodeId id = 2; id <= 4; ++id)
+    {
+        editor.GetNode(id)->CreateExecutionInputPin("Execute");
+        editor.GetNode(id)->CreateExecutionOutputPin("Then");
+        editor.AddConnection(id - 1, "Then", id, "Execute", Nodes::ConnectionType::Execution);
+    }
+    editor.AddNode(std::make_unique<SumNode>(5, 0.0));
+    editor.AddConnection(2, "Output", 5, "A");
+    editor.SetIntermediateRelease(true);
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+    EXPECT_TRUE(NodeAt(2).GetOutputSlot("Output").HasData());
+    EXPECT_FALSE(NodeAt(3).GetOutputSlot("Output").HasData());
+    EXPECT_DOUBLE_EQ(ResultOf(4), 10.0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    IntermediateReleaseTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,147 @@
+#include "Vision/Kernels/CpuFeatures.h"
+#include "Vision/Kernels/Kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace VisionCraft::Vision;
+
+namespace
+{
+    // Runs every test once per target this machine supports, restoring the default afterwards
+    class KernelsTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            defaultTarget = Kernels::GetKernelTarget();
+        }
+
+        void TearDown() override
+        {
+            Kernels::SetKernelTarget(defaultTarget);
+        }
+
+        // Lengths around every vector width, read from an odd offset so no pointer is aligned
+        template<typename T> void ForEachTargetAndLength(const auto &check)
+        {
+            std::mt19937 random(7);
+            std::mt19937_64 words(11); // Mask words use all 64 bits
+            std::uniform_int_distribution<int> values(0, sizeof(T) == 1 ? 255 : 30000);
+            for (const auto target : Kernels::GetSupportedKernelTargets())
+            {
+                ASSERT_TRUE(Kernels::SetKernelTarget(target));
+                for (size_t count = 0; count <= 130; ++count)
+                {
+                    std::vector<T> a(count + 1), b(count + 1);
+                    for (size_t i = 0; i <= count; ++i)
+                    {
+                        if constexpr (std::is_same_v<T, uint64_t>)
+                        {
+                            a[i] = words();
+                            b[i] = words();
+                            continue;
+                        }
+                        a[i] = static_cast<T>(values(random) - (std::is_floating_point_v<T> ? 15000 : 0));
+                        b[i] = static_cast<T>(values(random) - (std::is_floating_point_v<T> ? 15000 : 0));
+                    }
+                    check(a.data() + 1, b.data() + 1, count, std::string(Kernels::ToString(target)));
+                }
+            }
+        }
+
+        Kernels::KernelTarget defaultTarget = Kernels::KernelTarget::Scalar;
+    };
+
+    template<typename T> void ExpectMinimumAndMaximumMatchReference(const T *a, const T *b, size_t count,
+        const std::string &target)
+    {
+        std::vector<T> expected(count), actual(count);
+        Kernels::Reference::Minimum(a, b, expected.data(), count);
+        Kernels::Minimum(a, b, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " minimum of " << count;
+
+        Kernels::Reference::Maximum(a, b, expected.data(), count);
+        Kernels::Maximum(a, b, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " maximum of " << count;
+    }
+} // namespace
+
+TEST_F(KernelsTest, ScalarIsAlwaysSupportedAndBestIsTheDefault)
+{
+    const auto targets = Kernels::GetSupportedKernelTargets();
+    ASSERT_FALSE(targets.empty());
+    EXPECT_EQ(targets.front(), Kernels::KernelTarget::Scalar);
+    EXPECT_EQ(defaultTarget, targets.back());
+
+    // Targets missing from the build or the CPU are refused
+    for (const auto target : { Kernels::KernelTarget::Sse42,
+             Kernels::KernelTarget::Avx2,
+             Kernels::KernelTarget::Avx512,
+             Kernels::KernelTarget::Neon })
+    {
+        const bool supported = std::find(targets.begin(), targets.end(), target) != targets.end();
+        EXPECT_EQ(Kernels::SetKernelTarget(target), supported) << Kernels::ToString(target);
+    }
+    ASSERT_TRUE(Kernels::SetKernelTarget(Kernels::KernelTarget::Scalar));
+    EXPECT_EQ(Kernels::GetKernelTarget(), Kernels::KernelTarget::Scalar);
+}
+
+TEST_F(KernelsTest, MinimumAndMaximumMatchReference)
+{
+    ForEachTargetAndLength<uint8_t>(ExpectMinimumAndMaximumMatchReference<uint8_t>);
+    ForEachTargetAndLength<uint16_t>(ExpectMinimumAndMaximumMatchReference<uint16_t>);
+    ForEachTargetAndLength<float>(ExpectMinimumAndMaximumMatchReference<float>);
+
+    // In place, as the morphology engine combines rows
+    std::vector<uint8_t> a{ 1, 9, 3, 7, 5, 200, 0, 255, 6, 6, 4, 8, 2, 10, 30, 20, 17 };
+    const std::vector<uint8_t> b{ 2, 8, 4, 6, 6, 100, 1, 254, 6, 7, 3, 9, 1, 11, 29, 21, 16 };
+    Kernels::Maximum(a.data(), b.data(), a.data(), a.size());
+    EXPECT_EQ(a, (std::vector<uint8_t>{ 2, 9, 4, 7, 6, 200, 1, 255, 6, 7, 4, 9, 2, 11, 30, 21, 17 }));
+}
+
+TEST_F(KernelsTest, MagnitudesMatchReference)
+{
+    ForEachTargetAndLength<float>([](const float *x, const float *y, size_t count, const std::string &target) {
+        std::vector<float> expected(count), actual(count);
+        Kernels::Reference::MagnitudeL2(x, y, expected.data(), count);
+        Kernels::MagnitudeL2(x, y, actual.data(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_NEAR(actual[i], expected[i], 1e-6f * expected[i]) << target << " L2 at " << i << " of " << count;
+        }
+
+        Kernels::Reference::MagnitudeL1(x, y, expected.data(), count);
+        Kernels::MagnitudeL1(x, y, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " L1 of " << count;
+    });
+}
+
+TEST_F(KernelsTest, MaskWordKernelsMatchReference)
+{
+    ForEachTargetAndLength<uint64_t>([](const uint64_t *a, const uint64_t *b, size_t count, const std::string &target) {
+        std::vector<uint64_t> expected(count), actual(count);
+        Kernels::Reference::BitwiseAnd(a, b, expected.data(), count);
+        Kernels::BitwiseAnd(a, b, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " and of " << count;
+
+        Kernels::Reference::BitwiseOr(a, b, expected.data(), count);
+        Kernels::BitwiseOr(a, b, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " or of " << count;
+
+        Kernels::Reference::BitwiseXor(a, b, expected.data(), count);
+        Kernels::BitwiseXor(a, b, actual.data(), count);
+        EXPECT_EQ(actual, expected) << target << " xor of " << count;
+
+        EXPECT_EQ(Kernels::PopCount(a, count), Kernels::Reference::PopCount(a, count)) << target << " popcount";
+    });
+
+    const std::vector<uint64_t> full(9, ~uint64_t{ 0 });
+    EXPECT_EQ(Kernels::PopCount(full.data(), full.size()), 9u * 64u);
+}
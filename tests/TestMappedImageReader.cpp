@@ -0,0 +1,199 @@
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/MappedImageReader.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+
+class MappedImageReaderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_mapped_image_reader_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    static void WriteFile(const std::filesystem::path &path, const std::string &bytes)
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    static std::string ReadFile(const std::filesystem::path &path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    // 4x3 8-bit PGM with pixel value row * 10 + column
+    std::filesystem::path WritePgm()
+    {
+        std::string bytes = "P5\n# raw sensor dump\n4 3\n255\n";
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int col = 0; col < 4; ++col)
+            {
+                bytes += static_cast<char>((row * 10) + col);
+            }
+        }
+        const auto path = testDir / "frame.pgm";
+        WriteFile(path, bytes);
+        return path;
+    }
+
+    // Little-endian 16-bit grayscale TIFF, one strip
+    std::filesystem::path WriteTiff(uint16_t compression)
+    {
+        constexpr uint16_t kCols = 5;
+        constexpr uint16_t kRows = 2;
+        const auto put16 = [](std::string &bytes, uint16_t value) {
+            bytes += static_cast<char>(value & 0xFF);
+            bytes += static_cast<char>(value >> 8);
+        };
+        const auto put32 = [&](std::string &bytes, uint32_t value) {
+            put16(bytes, static_cast<uint16_t>(value & 0xFFFF));
+            put16(bytes, static_cast<uint16_t>(value >> 16));
+        };
+        const auto entry = [&](std::string &bytes, uint16_t tag, uint16_t type, uint32_t value) {
+            put16(bytes, tag);
+            put16(bytes, type);
+            put32(bytes, 1);
+            if (type == 3)
+            {
+                put16(bytes, static_cast<uint16_t>(value));
+                put16(bytes, 0);
+            }
+            else
+            {
+                put32(bytes, value);
+            }
+        };
+
+        constexpr uint16_t kEntries = 8;
+        constexpr uint32_t kPixelOffset = 8 + 2 + (kEntries * 12) + 4;
+        std::string bytes = "II";
+        put16(bytes, 42);
+        put32(bytes, 8);
+        put16(bytes, kEntries);
+        entry(bytes, 256, 3, kCols);
+        entry(bytes, 257, 3, kRows);
+        entry(bytes, 258, 3, 16);
+        entry(bytes, 259, 3, compression);
+        entry(bytes, 262, 3, 1);
+        entry(bytes, 273, 4, kPixelOffset);
+        entry(bytes, 277, 3, 1);
+        entry(bytes, 279, 4, kCols * kRows * 2);
+        put32(bytes, 0);
+        for (uint16_t pixel = 0; pixel < kCols * kRows; ++pixel)
+        {
+            put16(bytes, static_cast<uint16_t>(1000 + pixel));
+        }
+
+        const auto path = testDir / "frame.tif";
+        WriteFile(path, bytes);
+        return path;
+    }
+
+    std::filesystem::path testDir;
+};
+
+TEST_F(MappedImageReaderTest, RawPgmIsZeroCopyView)
+{
+    cv::Mat image = Vision::IO::MappedImageReader::Read(WritePgm());
+    ASSERT_FALSE(image.empty());
+    EXPECT_TRUE(Vision::IO::MappedImageReader::IsMappedView(image));
+    EXPECT_EQ(image.rows, 3);
+    EXPECT_EQ(image.cols, 4);
+    EXPECT_EQ(image.type(), CV_8UC1);
+    EXPECT_EQ(image.ptr(2)[3], 23);
+
+    // Header copies keep the mapping alive
+    const cv::Mat copy = image;
+    image = cv::Mat{};
+    EXPECT_TRUE(Vision::IO::MappedImageReader::IsMappedView(copy));
+    EXPECT_EQ(copy.ptr(1)[2], 12);
+}
+
+TEST_F(MappedImageReaderTest, WritesIntoViewLeaveFileUnchanged)
+{
+    const auto path = WritePgm();
+    const std::string original = ReadFile(path);
+    {
+        cv::Mat image = Vision::IO::MappedImageReader::Read(path);
+        ASSERT_TRUE(Vision::IO::MappedImageReader::IsMappedView(image));
+        image.ptr(0)[0] = 99;
+        EXPECT_EQ(image.ptr(0)[0], 99);
+    }
+    EXPECT_EQ(ReadFile(path), original);
+}
+
+TEST_F(MappedImageReaderTest, UncompressedTiffIsZeroCopyView)
+{
+    if constexpr (std::endian::native != std::endian::little)
+    {
+        GTEST_SKIP() << "Test file is little-endian";
+    }
+
+    const cv::Mat image = Vision::IO::MappedImageReader::Read(WriteTiff(1));
+    ASSERT_TRUE(Vision::IO::MappedImageReader::IsMappedView(image));
+    EXPECT_EQ(image.rows, 2);
+    EXPECT_EQ(image.cols, 5);
+    EXPECT_EQ(image.type(), CV_16UC1);
+    EXPECT_EQ(image.at<uint16_t>(1, 4), 1009);
+
+    // Compressed strips need decoding
+    EXPECT_FALSE(Vision::IO::MappedImageReader::IsMappedView(Vision::IO::MappedImageReader::Read(WriteTiff(5))));
+}
+
+TEST_F(MappedImageReaderTest, EncodedFilesAreDecodedFromMapping)
+{
+    const auto path = testDir / "input.png";
+    ASSERT_TRUE(cv::imwrite(path.string(), cv::Mat(8, 6, CV_8UC3, cv::Scalar(40, 40, 40))));
+
+    const cv::Mat image = Vision::IO::MappedImageReader::Read(path);
+    ASSERT_FALSE(image.empty());
+    EXPECT_FALSE(Vision::IO::MappedImageReader::IsMappedView(image));
+    EXPECT_EQ(image.rows, 8);
+    EXPECT_EQ(image.cols, 6);
+
+    EXPECT_TRUE(Vision::IO::MappedImageReader::Read(testDir / "missing.png").empty());
+    WriteFile(testDir / "empty.pgm", "");
+    EXPECT_TRUE(Vision::IO::MappedImageReader::Read(testDir / "empty.pgm").empty());
+}
+
+TEST_F(MappedImageReaderTest, TruncatedPgmIsNotViewed)
+{
+    const auto path = testDir / "short.pgm";
+    WriteFile(path, "P5 4 3 255\n" + std::string(5, '\0'));
+    EXPECT_FALSE(Vision::IO::MappedImageReader::IsMappedView(Vision::IO::MappedImageReader::Read(path)));
+}
+
+TEST_F(MappedImageReaderTest, ImageInputNodeOutputsMappedView)
+{
+    Vision::IO::ImageInputNode node(1);
+    node.SetInputSlotDefault("FilePath", WritePgm());
+    node.SetInputSlotDefault("MemoryMap", true);
+    node.Process();
+
+    const cv::Mat image = node.GetOutputImage();
+    ASSERT_FALSE(image.empty());
+    EXPECT_TRUE(Vision::IO::MappedImageReader::IsMappedView(image));
+    EXPECT_EQ(image.type(), CV_8UC1);
+    EXPECT_FALSE(node.HasError());
+}
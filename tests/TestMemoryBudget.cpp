@@ -0,0 +1,183 @@
+#include "Nodes/Core/MemoryBudget.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/core.hpp>
+
+#include <filesystem>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds its two image inputs (B is optional) to a constant and counts Process() calls
+    class AddImageNode : public Nodes::Node
+    {
+    public:
+        AddImageNode(Nodes::NodeId id, double constant) : Nodes::Node(id, "AddImage"), constant(constant)
+        {
+            CreateInputSlot("A");
+            CreateInputSlot("B");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "AddImageNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            cv::Mat result(32, 32, CV_32FC1, cv::Scalar(constant));
+            for (const char *slot : { "A", "B" })
+            {
+                if (const auto input = GetInputValue<cv::Mat>(slot))
+                {
+                    result += *input;
+                }
+            }
+            SetOutputSlotData("Output", result);
+        }
+
+        int processCount = 0;
+
+    private:
+        double constant;
+    };
+
+    size_t CountFiles(const std::filesystem::path &directory)
+    {
+        size_t files = 0;
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(directory))
+        {
+            files += entry.is_regular_file() ? 1 : 0;
+        }
+        return files;
+    }
+} // namespace
+
+class MemoryBudgetTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds diamond 1 -> {2, 3} -> 4, where node 4 sums both branches
+    void SetUp() override
+    {
+        scratch = std::filesystem::temp_directory_path() / "visioncraft_memory_budget_test";
+        std::filesystem::remove_all(scratch);
+        std::filesystem::create_directories(scratch);
+        budget.SetScratchDirectory(scratch);
+        budget.ResetStatistics();
+
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+        editor.SetIntermediateRelease(true);
+        editor.AddNode(std::make_unique<AddImageNode>(1, 1.0));
+        editor.AddNode(std::make_unique<AddImageNode>(2, 2.0));
+        editor.AddNode(std::make_unique<AddImageNode>(3, 3.0));
+        editor.AddNode(std::make_unique<AddImageNode>(4, 0.0));
+        editor.AddConnection(1, "Output", 2, "A");
+        editor.AddConnection(1, "Output", 3, "A");
+        editor.AddConnection(2, "Output", 4, "A");
+        editor.AddConnection(3, "Output", 4, "B");
+    }
+
+    void TearDown() override
+    {
+        // The budget is process-wide; leave it unlimited for other tests
+        budget.SetLimit(0);
+        budget.SetScratchDirectory({});
+        budget.ResetStatistics();
+        std::filesystem::remove_all(scratch);
+    }
+
+    float ResultOf(Nodes::NodeId id)
+    {
+        const auto image = editor.GetNode(id)->GetOutputSlot("Output").GetData<cv::Mat>();
+        return image ? image->at<float>(0, 0) : -1.0f;
+    }
+
+    Nodes::MemoryBudget &budget = Nodes::MemoryBudget::Get();
+    Nodes::NodeEditor editor;
+    std::filesystem::path scratch;
+};
+
+TEST_P(MemoryBudgetTest, NothingIsSpilledUnderTheLimit)
+{
+    budget.SetLimit(1024 * 1024 * 1024);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FLOAT_EQ(ResultOf(4), 7.0f); // (1 + 2) + (1 + 3)
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->spilledOutputs, 0u);
+    EXPECT_EQ(budget.GetStatistics().spills, 0u);
+}
+
+TEST_P(MemoryBudgetTest, SpilledIntermediatesAreReadBackForTheirConsumers)
+{
+    // Every intermediate still awaited by a consumer has to leave memory
+    budget.SetLimit(1);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FLOAT_EQ(ResultOf(4), 7.0f);
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run);
+    EXPECT_GT(run->spilledOutputs, 0u);
+    const auto stats = budget.GetStatistics();
+    EXPECT_EQ(stats.spills, run->spilledOutputs);
+    EXPECT_EQ(stats.restores, stats.spills);
+    EXPECT_EQ(stats.failures, 0u);
+    EXPECT_GE(stats.spilledBytes, stats.spills * 32 * 32 * sizeof(float));
+    for (Nodes::NodeId id = 1; id <= 4; ++id)
+    {
+        EXPECT_EQ(static_cast<AddImageNode *>(editor.GetNode(id))->processCount, 1) << "node " << id;
+    }
+
+    // Spill files are deleted as they are read back, and the run's usage is withdrawn
+    EXPECT_EQ(CountFiles(scratch), 0u);
+    EXPECT_EQ(budget.GetUsedBytes(), 0u);
+}
+
+TEST_P(MemoryBudgetTest, SequentialRunsSpillWhatIsNeededLast)
+{
+    if (GetParam() != Nodes::ExecutionMode::Sequential)
+    {
+        GTEST_SKIP() << "Parallel runs finish steps in any order";
+    }
+
+    // After node 1: node 1. After node 2: node 2 (read by node 4), then node 1 (read next, by node 3).
+    // After node 3: node 3. Node 4 holds the result.
+    budget.SetLimit(1);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->spilledOutputs, 4u);
+}
+
+TEST_P(MemoryBudgetTest, OutputCacheIsTrimmedBeforeSpilling)
+{
+    editor.SetOutputCacheEnabled(true);
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_GT(editor.GetOutputCache().GetEntryCount(), 0u);
+
+    budget.SetLimit(1);
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FLOAT_EQ(ResultOf(4), 7.0f);
+    EXPECT_EQ(editor.GetOutputCache().GetEntryCount(), 0u);
+    EXPECT_GT(budget.GetStatistics().cacheTrimBytes, 0u);
+    EXPECT_EQ(editor.GetOutputCache().GetByteBudget(), Constants::Cache::kDefaultOutputCacheBytes);
+}
+
+TEST_P(MemoryBudgetTest, BudgetNeedsIntermediateRelease)
+{
+    editor.SetIntermediateRelease(false);
+    budget.SetLimit(1);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FLOAT_EQ(ResultOf(4), 7.0f);
+    EXPECT_EQ(budget.GetStatistics().spills, 0u);
+    EXPECT_TRUE(editor.GetNode(1)->GetOutputSlot("Output").HasData());
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    MemoryBudgetTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
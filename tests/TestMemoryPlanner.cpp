@@ -0,0 +1,92 @@
+#include "Nodes/Core/MemoryPlanner.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/Algorithms/MedianBlurNode.h"
+#include "Vision/Algorithms/MorphologyNode.h"
+#include "Vision/Algorithms/SobelNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::SourceNode;
+
+TEST(MemoryPlannerTest, ChainSharesMemoryBetweenDisjointLifetimes)
+{
+    // a and c are never alive together, b overlaps both
+    const std::vector<Nodes::BufferLifetime> lifetimes{
+        { .nodeId = 1, .bytes = 300, .firstStep = 0, .lastStep = 1 },
+        { .nodeId = 2, .bytes = 100, .firstStep = 1, .lastStep = 2 },
+        { .nodeId = 3, .bytes = 200, .firstStep = 2, .lastStep = 3 },
+    };
+    const auto plan = Nodes::MemoryPlanner::Plan(lifetimes, 64);
+
+    EXPECT_EQ(plan.unsharedBytes, 320 + 128 + 256);
+    EXPECT_EQ(plan.slabBytes, 320 + 128);
+    EXPECT_EQ(plan.placements.at(1).offset, 0);
+    EXPECT_EQ(plan.placements.at(3).offset, 0);
+    EXPECT_EQ(plan.placements.at(2).offset, 320);
+}
+
+TEST(MemoryPlannerTest, OverlappingLifetimesNeverShare)
+{
+    const std::vector<Nodes::BufferLifetime> lifetimes{
+        { .nodeId = 1, .bytes = 64, .firstStep = 0, .lastStep = 3 },
+        { .nodeId = 2, .bytes = 64, .firstStep = 1, .lastStep = 2 },
+        { .nodeId = 3, .bytes = 64, .firstStep = 3, .lastStep = 4 },
+    };
+    const auto plan = Nodes::MemoryPlanner::Plan(lifetimes, 64);
+
+    // 1 overlaps both others; 2 and 3 may share
+    EXPECT_EQ(plan.slabBytes, 128);
+    EXPECT_NE(plan.placements.at(1).offset, plan.placements.at(2).offset);
+    EXPECT_NE(plan.placements.at(1).offset, plan.placements.at(3).offset);
+}
+
+TEST(MemoryPlannerTest, PlannedChainRunsFromTheSlab)
+{
+    Nodes::NodeEditor editor;
+    editor.SetIntermediateRelease(true);
+    cv::Mat input(120, 160, CV_8UC3);
+    cv::randu(input, 0, 255);
+    editor.AddNode(std::make_unique<SourceNode>(1, input, true));
+    editor.AddNode(std::make_unique<Vision::Algorithms::MorphologyNode>(2));
+    editor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(3));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(4));
+    editor.AddNode(std::make_unique<Vision::Algorithms::MedianBlurNode>(5));
+    editor.AddNode(std::make_unique<Vision::Algorithms::SobelNode>(6));
+    for (Nodes::NodeId id = 2; id <= 6; ++id)
+    {
+        Link(editor, id - 1, id);
+    }
+
+    ASSERT_TRUE(editor.Execute());
+    const cv::Mat expected = editor.GetNode(6)->GetOutputSlot("Output").GetData<cv::Mat>().value().clone();
+
+    // Morphology and Threshold outputs are never alive together; the blur feeds the retained sink
+    const auto plan = editor.PlanImageMemory();
+    ASSERT_EQ(plan.placements.size(), 3);
+    EXPECT_LT(plan.slabBytes, plan.unsharedBytes);
+    EXPECT_EQ(plan.placements.at(2).offset, plan.placements.at(4).offset);
+
+    for (int run = 0; run < 2; ++run)
+    {
+        editor.GetNode(1)->MarkDirty();
+        ASSERT_TRUE(editor.Execute());
+        const auto output = editor.GetNode(6)->GetOutputSlot("Output").GetData<cv::Mat>();
+        ASSERT_TRUE(output.has_value());
+        EXPECT_EQ(cv::norm(*output, expected, cv::NORM_INF), 0.0) << "run " << run;
+    }
+    const auto stats = editor.GetImageSlabStatistics();
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->placed, 6);
+    EXPECT_EQ(stats->fellBack, 0);
+
+    editor.ClearImageMemoryPlan();
+    EXPECT_FALSE(editor.GetImageSlabStatistics().has_value());
+}
@@ -0,0 +1,64 @@
+#include "Nodes/Core/NodeArena.h"
+#include "Nodes/Core/SlotNameTable.h"
+
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <vector>
+
+using namespace VisionCraft::Nodes;
+
+TEST(NodeArenaTest, ScopesNestAndRestoreThePreviousArena)
+{
+    EXPECT_EQ(NodeArena::GetCurrent(), nullptr);
+    EXPECT_EQ(NodeArena::GetCurrentResource(), std::pmr::new_delete_resource());
+
+    const auto outer = NodeArena::Create();
+    const auto inner = NodeArena::Create();
+    {
+        NodeArena::Scope outerScope(outer);
+        EXPECT_EQ(NodeArena::GetCurrent(), outer.get());
+        {
+            NodeArena::Scope innerScope(inner);
+            EXPECT_EQ(NodeArena::GetCurrentResource(), inner.get());
+            {
+                NodeArena::Scope heapScope(nullptr);
+                EXPECT_EQ(NodeArena::GetCurrent(), nullptr);
+            }
+            EXPECT_EQ(NodeArena::GetCurrent(), inner.get());
+        }
+        EXPECT_EQ(NodeArena::GetCurrent(), outer.get());
+    }
+    EXPECT_EQ(NodeArena::GetCurrent(), nullptr);
+}
+
+TEST(NodeArenaTest, CountsLiveAllocations)
+{
+    const auto arena = NodeArena::Create();
+    EXPECT_EQ(arena->GetLiveAllocations(), 0u);
+    {
+        std::pmr::vector<int> values(arena.get());
+        values.reserve(64);
+        EXPECT_EQ(arena->GetLiveAllocations(), 1u);
+
+        // Name tables pick up the arena of the active scope
+        NodeArena::Scope scope(arena);
+        SlotNameTable names;
+        names.Insert(SlotKind::Input, "Input", 0);
+        EXPECT_EQ(arena->GetLiveAllocations(), 2u);
+    }
+    EXPECT_EQ(arena->GetLiveAllocations(), 0u);
+}
+
+TEST(NodeArenaTest, OutlivesItsOwnerWhileAllocationsLive)
+{
+    auto arena = NodeArena::Create();
+    std::pmr::vector<std::pmr::vector<int>> rows(arena.get());
+    rows.emplace_back(100, 7);
+    arena.reset();
+
+    // Memory stays valid and keeps being reused until the last allocation is freed
+    rows.emplace_back(100, 8);
+    EXPECT_EQ(rows[0][99], 7);
+    EXPECT_EQ(rows[1][0], 8);
+}
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 using namespace VisionCraft;
 using namespace VisionCraft::Editor::Commands;
@@ -21,6 +22,7 @@ class MockNode : public Nodes::Node
 public:
     MockNode(Nodes::NodeId id, const std::string &name, const std::string &type) : Node(id, name), nodeType(type)
     {
+        CreateOutputSlot("Output");
     }
 
     [[nodiscard]] std::string GetType() const override
@@ -76,6 +78,20 @@ protected:
         nodePositions.erase(id);
     }
 
+    // Helper: Remove node from storage and return it
+    std::unique_ptr<Nodes::Node> DetachNode(Nodes::NodeId id)
+    {
+        auto it = nodeStorage.find(id);
+        if (it == nodeStorage.end())
+        {
+            return nullptr;
+        }
+        auto node = std::move(it->second);
+        nodeStorage.erase(it);
+        nodePositions.erase(id);
+        return node;
+    }
+
     // Helper: Get node pointer
     Nodes::Node *GetNode(Nodes::NodeId id)
     {
@@ -233,7 +249,7 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_Execute)
     auto cmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -255,7 +271,7 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_Undo)
     auto cmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -284,7 +300,7 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_ExecuteUndoExecute)
     auto cmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -309,7 +325,7 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_GetDescription)
     auto cmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -328,7 +344,7 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_NonExistentNode)
     auto cmd = std::make_unique<DeleteNodeCommand>(
         999,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -343,6 +359,64 @@ TEST_F(NodeCommandsTest, DeleteNodeCommand_NonExistentNode)
     cmd->Undo();
 }
 
+TEST_F(NodeCommandsTest, DeleteNodeCommand_UndoReinsertsTheSameNode)
+{
+    AddNode(CreateMockNode(1, "Processed Node", "MockNode"));
+    auto *original = GetNode(1);
+    original->SetOutputSlotData("Output", std::string(64, 'x'));
+    original->ClearDirty();
+
+    bool recreated = false;
+    auto cmd = std::make_unique<DeleteNodeCommand>(
+        1,
+        [this](Nodes::NodeId id) { return GetNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
+        [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
+        [this](Nodes::NodeId id) { return GetNodePosition(id); },
+        [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
+        [this, &recreated](const std::string &type, Nodes::NodeId id, const std::string &name) {
+            recreated = true;
+            return RecreateNode(type, id, name);
+        });
+
+    cmd->Execute();
+    EXPECT_EQ(cmd->GetMemoryFootprint(), 64u);
+
+    cmd->Undo();
+    EXPECT_FALSE(recreated);
+    EXPECT_EQ(GetNode(1), original);
+    EXPECT_TRUE(GetNode(1)->GetOutputSlot("Output").HasData());
+    EXPECT_FALSE(GetNode(1)->IsDirty());
+    EXPECT_EQ(cmd->GetMemoryFootprint(), 0u);
+}
+
+TEST_F(NodeCommandsTest, DeleteNodeCommand_ReleaseMemoryKeepsNodeButDropsOutputs)
+{
+    AddNode(CreateMockNode(1, "Processed Node", "MockNode"));
+    GetNode(1)->SetOutputSlotData("Output", std::string(64, 'x'));
+    GetNode(1)->ClearDirty();
+
+    auto cmd = std::make_unique<DeleteNodeCommand>(
+        1,
+        [this](Nodes::NodeId id) { return GetNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
+        [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
+        [this](Nodes::NodeId id) { return GetNodePosition(id); },
+        [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
+        [this](const std::string &type, Nodes::NodeId id, const std::string &name) {
+            return RecreateNode(type, id, name);
+        });
+
+    cmd->Execute();
+    cmd->ReleaseMemory();
+    EXPECT_EQ(cmd->GetMemoryFootprint(), 0u);
+
+    cmd->Undo();
+    ASSERT_NE(GetNode(1), nullptr);
+    EXPECT_FALSE(GetNode(1)->GetOutputSlot("Output").HasData());
+    EXPECT_TRUE(GetNode(1)->IsDirty());
+}
+
 // ============================================================================
 // MoveNodesCommand Tests
 // ============================================================================
@@ -504,7 +578,7 @@ TEST_F(NodeCommandsTest, Integration_CreateThenDelete)
     auto deleteCmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -551,7 +625,7 @@ TEST_F(NodeCommandsTest, Integration_CreateMoveDelete)
     auto deleteCmd = std::make_unique<DeleteNodeCommand>(
         1,
         [this](Nodes::NodeId id) { return GetNode(id); },
-        [this](Nodes::NodeId id) { RemoveNode(id); },
+        [this](Nodes::NodeId id) { return DetachNode(id); },
         [this](std::unique_ptr<Nodes::Node> node) { AddNode(std::move(node)); },
         [this](Nodes::NodeId id) { return GetNodePosition(id); },
         [this](Nodes::NodeId id, const NodePosition &pos) { SetNodePosition(id, pos); },
@@ -573,3 +647,34 @@ TEST_F(NodeCommandsTest, Integration_CreateMoveDelete)
     createCmd->Undo();
     EXPECT_EQ(nodeStorage.size(), 0);
 }
+
+// ============================================================================
+// SetParameterCommand Tests
+// ============================================================================
+
+TEST_F(NodeCommandsTest, SetParameterCommand_MergesEditsOfTheSameParameter)
+{
+    std::vector<double> applied;
+    const auto setter = [&applied](Nodes::NodeId, const std::string &, const Nodes::NodeData &value) {
+        applied.push_back(std::get<double>(value));
+    };
+
+    SetParameterCommand scrub(1, "Threshold", 10.0, 20.0, setter);
+    scrub.Execute();
+
+    SetParameterCommand next(1, "Threshold", 20.0, 30.0, setter);
+    next.Execute();
+    EXPECT_TRUE(scrub.MergeWith(next));
+
+    SetParameterCommand otherParameter(1, "MaxValue", 1.0, 2.0, setter);
+    SetParameterCommand otherNode(2, "Threshold", 1.0, 2.0, setter);
+    EXPECT_FALSE(scrub.MergeWith(otherParameter));
+    EXPECT_FALSE(scrub.MergeWith(otherNode));
+
+    // Undo restores the value before the first edit, redo the latest one
+    scrub.Undo();
+    scrub.Execute();
+    EXPECT_EQ(applied, (std::vector<double>{ 20.0, 30.0, 10.0, 30.0 }));
+    EXPECT_EQ(scrub.GetDescription(), "Set Threshold");
+    EXPECT_EQ(scrub.GetMemoryFootprint(), 0u);
+}
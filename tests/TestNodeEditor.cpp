@@ -8,6 +8,7 @@
 #include <future>
 #include <memory>
 #include <thread>
+#include <vector>
 
 using namespace VisionCraft;
 
@@ -256,6 +257,24 @@ TEST_F(NodeEditorTest, RemoveNonExistentConnection)
     EXPECT_EQ(connections[0].to, 2);
     EXPECT_EQ(connections[0].toSlot, "Input");
 }
+TEST_F(NodeEditorTest, DetachNodeReturnsTheRemovedInstance)
+{
+    auto node = std::make_unique<TestNode>(1, "Node1");
+    const auto *original = node.get();
+    editor.AddNode(std::move(node));
+    editor.AddNode(std::make_unique<TestNode>(2, "Node2"));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    auto detached = editor.DetachNode(1);
+    ASSERT_EQ(detached.get(), original);
+    EXPECT_EQ(editor.GetNode(1), nullptr);
+    EXPECT_TRUE(editor.GetConnections().empty());
+    EXPECT_EQ(editor.DetachNode(1), nullptr);
+
+    editor.AddNode(std::move(detached));
+    EXPECT_EQ(editor.GetNode(1), original);
+}
+
 
 // ============================================================================
 // Node Removal with Connection Cleanup Tests
@@ -347,6 +366,143 @@ TEST_F(NodeEditorTest, ClearWithNodesAndConnections)
     EXPECT_EQ(editor.GetNode(2), nullptr);
 }
 
+TEST_F(NodeEditorTest, GraphViewIsSharedUntilGraphChanges)
+{
+    editor.AddNode(std::make_unique<TestNode>(7, "Node7"));
+    editor.AddNode(std::make_unique<TestNode>(3, "Node3"));
+    editor.AddConnection(3, "Output", 7, "Input");
+
+    const auto first = editor.GetGraphView();
+    EXPECT_EQ(first, editor.GetGraphView()); // Unchanged graph: same view, nothing copied
+    EXPECT_EQ(first->version, editor.GetGraphVersion());
+    ASSERT_EQ(first->NodeIds().size(), 2);
+    EXPECT_EQ(first->NodeIds()[0], 3);
+    EXPECT_EQ(first->NodeIds()[1], 7);
+    ASSERT_EQ(first->Connections().size(), 1);
+
+    ASSERT_TRUE(editor.RemoveConnection(3, "Output", 7, "Input"));
+    const auto second = editor.GetGraphView();
+    EXPECT_NE(first, second);
+    EXPECT_GT(second->version, first->version);
+    EXPECT_TRUE(second->Connections().empty());
+    EXPECT_EQ(first->Connections().size(), 1); // Earlier views keep their contents
+}
+
+// ============================================================================
+// Connection Delta Tests
+// ============================================================================
+
+TEST_F(NodeEditorTest, ReplacingDataInputReportsRemovedAndAdded)
+{
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        editor.AddNode(std::make_unique<TestNode>(id, "Node" + std::to_string(id)));
+    }
+    editor.AddConnection(1, "Output", 3, "Input");
+
+    std::vector<Nodes::ConnectionDelta> deltas;
+    editor.SetConnectionObserver([&deltas](const Nodes::ConnectionDelta &delta) { deltas.push_back(delta); });
+    editor.AddConnection(2, "Output", 3, "Input");
+
+    ASSERT_EQ(deltas.size(), 1);
+    EXPECT_FALSE(deltas[0].reset);
+    ASSERT_EQ(deltas[0].removed.size(), 1);
+    EXPECT_EQ(deltas[0].removed[0].from, 1);
+    ASSERT_EQ(deltas[0].added.size(), 1);
+    EXPECT_EQ(deltas[0].added[0].from, 2);
+    EXPECT_EQ(deltas[0].added[0].to, 3);
+}
+
+TEST_F(NodeEditorTest, RemovingNodeReportsItsConnections)
+{
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        editor.AddNode(std::make_unique<TestNode>(id, "Node" + std::to_string(id)));
+    }
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(2, "Output", 3, "Input");
+    editor.AddConnection(1, "Output", 3, "Other");
+
+    std::vector<Nodes::ConnectionDelta> deltas;
+    editor.SetConnectionObserver([&deltas](const Nodes::ConnectionDelta &delta) { deltas.push_back(delta); });
+    ASSERT_TRUE(editor.RemoveNode(2));
+    EXPECT_FALSE(editor.RemoveConnection(1, "Output", 2, "Input")); // Already gone: nothing reported
+
+    ASSERT_EQ(deltas.size(), 1);
+    EXPECT_EQ(deltas[0].removed.size(), 2);
+    EXPECT_TRUE(deltas[0].added.empty());
+    EXPECT_EQ(editor.GetConnections().size(), 1);
+}
+
+TEST_F(NodeEditorTest, ClearAndInsertGraphReportResetThenAdditions)
+{
+    editor.AddNode(std::make_unique<TestNode>(1, "Node1"));
+    editor.AddNode(std::make_unique<TestNode>(2, "Node2"));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    std::vector<Nodes::ConnectionDelta> deltas;
+    editor.SetConnectionObserver([&deltas](const Nodes::ConnectionDelta &delta) { deltas.push_back(delta); });
+    editor.Clear();
+
+    std::vector<Nodes::NodePtr> nodes;
+    nodes.push_back(std::make_unique<TestNode>(5, "Node5"));
+    nodes.push_back(std::make_unique<TestNode>(6, "Node6"));
+    const std::vector<Nodes::Connection> connections{
+        { .from = 5, .fromSlot = "Output", .to = 6, .toSlot = "Input" },
+        { .from = 5, .fromSlot = "Output", .to = 7, .toSlot = "Input" }, // Node 7 is missing: dropped
+    };
+    EXPECT_EQ(editor.InsertGraph(std::move(nodes), connections), 1);
+
+    ASSERT_EQ(deltas.size(), 2);
+    EXPECT_TRUE(deltas[0].reset);
+    EXPECT_TRUE(deltas[0].added.empty());
+    EXPECT_FALSE(deltas[1].reset);
+    ASSERT_EQ(deltas[1].added.size(), 1);
+    EXPECT_EQ(deltas[1].added[0], connections[0]);
+
+    editor.SetConnectionObserver(nullptr);
+    editor.AddConnection(6, "Output", 5, "Input");
+    EXPECT_EQ(deltas.size(), 2);
+}
+
+TEST_F(NodeEditorTest, TransactionReportsOneCombinedDeltaAtCommit)
+{
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        editor.AddNode(std::make_unique<TestNode>(id, "Node" + std::to_string(id)));
+    }
+    editor.AddConnection(1, "Output", 3, "Input");
+
+    std::vector<Nodes::ConnectionDelta> deltas;
+    editor.SetConnectionObserver([&deltas](const Nodes::ConnectionDelta &delta) { deltas.push_back(delta); });
+    {
+        Nodes::GraphTransaction outer(editor);
+        editor.AddNode(std::make_unique<TestNode>(4, "Node4"));
+        editor.AddConnection(1, "Output", 2, "Input");
+        {
+            Nodes::GraphTransaction inner(editor);
+            editor.AddConnection(2, "Output", 4, "Input");
+            ASSERT_TRUE(editor.RemoveConnection(2, "Output", 4, "Input")); // Added and removed: cancels out
+        }
+        editor.AddConnection(2, "Output", 3, "Input"); // Replaces 1 -> 3
+        EXPECT_TRUE(deltas.empty());
+    }
+
+    ASSERT_EQ(deltas.size(), 1);
+    EXPECT_FALSE(deltas[0].reset);
+    ASSERT_EQ(deltas[0].removed.size(), 1);
+    EXPECT_EQ(deltas[0].removed[0].from, 1);
+    EXPECT_EQ(deltas[0].removed[0].to, 3);
+    ASSERT_EQ(deltas[0].added.size(), 2);
+    EXPECT_EQ(deltas[0].added[0].to, 2);
+    EXPECT_EQ(deltas[0].added[1].from, 2);
+    EXPECT_EQ(deltas[0].added[1].to, 3);
+    EXPECT_EQ(editor.GetConnections().size(), 2);
+
+    // The lock is released: another thread can read the graph
+    EXPECT_EQ(std::async(std::launch::async, [this] { return editor.GetNodeIds().size(); }).get(), 4u);
+}
+
 // ============================================================================
 // Edge Cases and Error Scenarios
 // ============================================================================
@@ -512,6 +668,51 @@ TEST_F(NodeEditorTest, ExecuteGraphWithSlots)
     EXPECT_DOUBLE_EQ(node2Output.value(), 30.0);
 }
 
+TEST_F(NodeEditorTest, ExecuteSharesOutputDataWithConsumers)
+{
+    auto node1 = std::make_unique<SlotTestNode>(1, "Node1");
+    auto node2 = std::make_unique<SlotTestNode>(2, "Node2");
+    auto node3 = std::make_unique<SlotTestNode>(3, "Node3");
+    node1->SetInputSlotData("Input", 1.0);
+
+    auto *node1Ptr = node1.get();
+    auto *node2Ptr = node2.get();
+    auto *node3Ptr = node3.get();
+
+    editor.AddNode(std::move(node1));
+    editor.AddNode(std::move(node2));
+    editor.AddNode(std::move(node3));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(1, "Output", 3, "Input");
+
+    ASSERT_TRUE(editor.Execute());
+
+    // Both consumers read the producer's value through the same handle instead of a copy
+    const auto *produced = node1Ptr->GetOutputSlot("Output").GetSharedData().get();
+    ASSERT_NE(produced, nullptr);
+    EXPECT_EQ(node2Ptr->GetInputSlot("Input").GetSharedData().get(), produced);
+    EXPECT_EQ(node3Ptr->GetInputSlot("Input").GetSharedData().get(), produced);
+}
+
+TEST_F(NodeEditorTest, ExecuteSkipsConnectionsToMissingSlots)
+{
+    auto node1 = std::make_unique<SlotTestNode>(1, "Node1");
+    auto node2 = std::make_unique<SlotTestNode>(2, "Node2");
+    node1->SetInputSlotData("Input", 2.0);
+    auto *node2Ptr = node2.get();
+
+    editor.AddNode(std::move(node1));
+    editor.AddNode(std::move(node2));
+    editor.AddConnection(1, "Missing", 2, "Multiplier");
+    editor.AddConnection(1, "Output", 2, "Unknown");
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    ASSERT_TRUE(editor.Execute());
+
+    // Only the valid connection delivers data; the multiplier keeps its default
+    EXPECT_EQ(node2Ptr->GetOutputSlot("Output").GetData<double>(), 8.0);
+}
+
 TEST_F(NodeEditorTest, ExecuteGraphCycleDetection)
 {
     auto node1 = std::make_unique<SlotTestNode>(1, "Node1");
@@ -781,6 +982,33 @@ TEST_F(NodeEditorTest, ExecuteAsync)
     EXPECT_TRUE(success);
 }
 
+TEST_F(NodeEditorTest, AsyncRunNotifiesRunFinishedObserver)
+{
+    editor.AddNode(std::make_unique<TestNode>(1, "AsyncNode"));
+
+    std::atomic<int> finishedRuns = 0;
+    std::atomic<bool> lastResult = false;
+    editor.SetRunFinishedObserver([&](bool succeeded) {
+        lastResult = succeeded;
+        finishedRuns.fetch_add(1);
+    });
+
+    ASSERT_TRUE(editor.ExecuteAsync().get());
+    EXPECT_EQ(finishedRuns.load(), 1); // Told before the future became ready
+    EXPECT_TRUE(lastResult.load());
+
+    ASSERT_TRUE(editor.ExecuteUpToAsync(1).get());
+    EXPECT_EQ(finishedRuns.load(), 2);
+
+    editor.SetRunFinishedObserver(nullptr);
+    ASSERT_TRUE(editor.ExecuteAsync().get());
+    EXPECT_EQ(finishedRuns.load(), 2);
+
+    // Synchronous runs report through their return value only
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(finishedRuns.load(), 2);
+}
+
 TEST_F(NodeEditorTest, ExecuteAsyncCancellation)
 {
     // Create many nodes to ensure we have time to cancel
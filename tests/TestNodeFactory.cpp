@@ -6,6 +6,10 @@
 #include "Vision/IO/ImageOutputNode.h"
 #include "Vision/IO/PreviewNode.h"
 
+#if VISION_CRAFT_WITH_CUDA
+#include "Vision/Cuda/CudaStream.h"
+#endif
+
 #include <gtest/gtest.h>
 #include <memory>
 
@@ -297,3 +301,86 @@ TEST_F(NodeFactoryTest, CreateAllAvailableNodeTypes)
         EXPECT_EQ(node->GetType(), expectedType) << "Wrong type for: " << typeName;
     }
 }
+
+TEST_F(NodeFactoryTest, CreateFromSavedTypeName)
+{
+    // Graph files store Node::GetType(), so every registered node must round-trip through it
+    for (const auto &typeName : Vision::NodeFactory::GetRegisteredTypes())
+    {
+        auto original = Vision::NodeFactory::CreateNode(typeName, 1, "Original");
+        ASSERT_NE(original, nullptr) << "Failed to create node type: " << typeName;
+
+        EXPECT_TRUE(Vision::NodeFactory::IsRegistered(original->GetType())) << original->GetType();
+        auto restored = Vision::NodeFactory::CreateNode(original->GetType(), 2, "Restored");
+        ASSERT_NE(restored, nullptr) << "Failed to create from saved type: " << original->GetType();
+        EXPECT_EQ(restored->GetType(), original->GetType());
+    }
+}
+
+TEST_F(NodeFactoryTest, CreateFromTypeIdMatchesCreateFromString)
+{
+    for (const auto &typeName : Vision::NodeFactory::GetRegisteredTypes())
+    {
+        auto original = Vision::NodeFactory::CreateNode(typeName, 1, "Original");
+        ASSERT_NE(original, nullptr) << typeName;
+
+        // Both the registry key and the node's own type ID index the same entry
+        const auto typeId = original->GetTypeId();
+        EXPECT_EQ(Nodes::NodeTypeRegistry::GetName(typeId), original->GetType());
+        auto copy = Vision::NodeFactory::CreateNode(typeId, 2, "Copy");
+        ASSERT_NE(copy, nullptr) << typeName;
+        EXPECT_EQ(copy->GetTypeId(), typeId);
+
+        auto byKey = Vision::NodeFactory::CreateNode(Nodes::NodeTypeRegistry::Find(typeName), 3, "ByKey");
+        ASSERT_NE(byKey, nullptr) << typeName;
+        EXPECT_EQ(byKey->GetTypeId(), typeId);
+    }
+
+    EXPECT_EQ(Vision::NodeFactory::CreateNode(Nodes::kNoNodeTypeId, 1, "None"), nullptr);
+    EXPECT_EQ(Vision::NodeFactory::CreateNode(Nodes::NodeTypeRegistry::Intern("NotANodeType"), 1, "None"), nullptr);
+}
+
+TEST_F(NodeFactoryTest, RegisteringAKeyAgainReplacesItsEntry)
+{
+    const auto registered = Vision::NodeFactory::GetRegisteredTypes().size();
+    Vision::NodeFactory::RegisterNode<Vision::Algorithms::ThresholdNode>("Grayscale");
+    auto node = Vision::NodeFactory::CreateNode("GrayscaleNode", 1, "Replaced");
+    Vision::NodeFactory::RegisterNode<Vision::Algorithms::GrayscaleNode>("Grayscale");
+
+    ASSERT_NE(node, nullptr);
+    EXPECT_EQ(node->GetType(), "ThresholdNode");
+    EXPECT_EQ(Vision::NodeFactory::GetRegisteredTypes().size(), registered);
+    EXPECT_EQ(Vision::NodeFactory::CreateNode("Grayscale", 2, "Restored")->GetType(), "GrayscaleNode");
+}
+
+TEST_F(NodeFactoryTest, CudaBackendFallsBackToCpuNodes)
+{
+    Vision::NodeFactory::SetBackend(Vision::NodeBackend::Cuda);
+    auto node = Vision::NodeFactory::CreateNode("Sobel", 1, "Sobel");
+    Vision::NodeFactory::SetBackend(Vision::NodeBackend::Cpu);
+
+    ASSERT_NE(node, nullptr);
+#if VISION_CRAFT_WITH_CUDA
+    const std::string expectedType = Vision::Cuda::IsAvailable() ? "CudaSobelNode" : "SobelNode";
+#else
+    const std::string expectedType = "SobelNode";
+#endif
+    EXPECT_EQ(node->GetType(), expectedType);
+    EXPECT_EQ(Vision::NodeFactory::CreateNode("CudaUnknownType", 2, "Unknown"), nullptr);
+}
+
+TEST_F(NodeFactoryTest, LoadsCudaTypesWithoutDevice)
+{
+    auto node = Vision::NodeFactory::CreateNode("CudaThresholdNode", 1, "Threshold");
+
+    ASSERT_NE(node, nullptr);
+#if VISION_CRAFT_WITH_CUDA
+    if (Vision::Cuda::IsAvailable())
+    {
+        EXPECT_TRUE(node->UsesCudaImages());
+        return;
+    }
+#endif
+    EXPECT_EQ(node->GetType(), "ThresholdNode");
+    EXPECT_FALSE(node->UsesCudaImages());
+}
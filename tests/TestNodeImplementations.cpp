@@ -152,6 +152,129 @@ TEST_F(NodeImplementationTest, ThresholdNodeInvalidType)
     EXPECT_FALSE(output->empty());
 }
 
+namespace
+{
+    // Exposes how often ThresholdNode rebuilt its histogram
+    class ThresholdProbe : public Vision::Algorithms::ThresholdNode
+    {
+    public:
+        using Vision::Algorithms::ThresholdNode::GetHistogramBuildCount;
+        using Vision::Algorithms::ThresholdNode::ThresholdNode;
+    };
+
+    // Counts pixels whose output differs from (value > threshold ? 255 : 0)
+    int CountBinaryMismatches(const cv::Mat &input, const cv::Mat &output, int threshold)
+    {
+        int mismatches = 0;
+        for (int r = 0; r < input.rows; r++)
+        {
+            for (int c = 0; c < input.cols; c++)
+            {
+                const uchar expected = input.at<uchar>(r, c) > threshold ? 255 : 0;
+                mismatches += output.at<uchar>(r, c) != expected ? 1 : 0;
+            }
+        }
+        return mismatches;
+    }
+} // namespace
+
+TEST_F(NodeImplementationTest, ThresholdNodeAutomaticThresholdsFromHistogram)
+{
+    Vision::Algorithms::ThresholdNode node(1, "Threshold");
+
+    // Two equally common levels: Otsu's first maximum of the between-class variance is the lower one
+    cv::Mat twoLevels(10, 20, CV_8UC1, cv::Scalar(40));
+    twoLevels.rowRange(5, 10).setTo(cv::Scalar(180));
+    node.SetInputSlotData("Input", twoLevels);
+    node.SetInputSlotData("Type", std::string("THRESH_OTSU"));
+    node.Process();
+    auto output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(CountBinaryMismatches(twoLevels, *output, 40), 0);
+
+    // Peak of 100 pixels at 10 and a flat tail over 11..60: the triangle threshold is 12
+    cv::Mat peakAndTail(1, 150, CV_8UC1, cv::Scalar(10));
+    for (int value = 11; value <= 60; value++)
+    {
+        peakAndTail.at<uchar>(0, 100 + value - 11) = static_cast<uchar>(value);
+    }
+    node.SetInputSlotData("Input", peakAndTail);
+    node.SetInputSlotData("Type", std::string("THRESH_TRIANGLE"));
+    node.Process();
+    output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(CountBinaryMismatches(peakAndTail, *output, 12), 0);
+}
+
+TEST_F(NodeImplementationTest, ThresholdNodeReusesHistogramOfUnchangedInput)
+{
+    ThresholdProbe node(1, "Threshold");
+    const cv::Mat inputImage = CreateTestImage();
+
+    node.SetInputSlotData("Input", inputImage);
+    node.SetInputSlotData("Type", std::string("THRESH_OTSU"));
+    node.Process();
+    ASSERT_TRUE(node.HasValidOutput());
+    EXPECT_EQ(node.GetHistogramBuildCount(), 1u);
+
+    // Changing only the parameters of the same buffer rethresholds from the kept histogram
+    node.SetInputSlotData("Type", std::string("THRESH_TRIANGLE"));
+    node.Process();
+    node.SetInputSlotData("Type", std::string("THRESH_MULTI"));
+    node.SetInputSlotData("Levels", 4);
+    node.Process();
+    ASSERT_TRUE(node.HasValidOutput());
+    EXPECT_EQ(node.GetHistogramBuildCount(), 1u);
+
+    node.SetInputSlotData("Input", inputImage.clone());
+    node.Process();
+    EXPECT_EQ(node.GetHistogramBuildCount(), 2u);
+}
+
+TEST_F(NodeImplementationTest, ThresholdNodeMultiLevelOutput)
+{
+    Vision::Algorithms::ThresholdNode node(1, "Threshold");
+
+    // Three bands: 20, 120 and 220
+    cv::Mat bands(9, 12, CV_8UC1, cv::Scalar(20));
+    bands.rowRange(3, 6).setTo(cv::Scalar(120));
+    bands.rowRange(6, 9).setTo(cv::Scalar(220));
+    node.SetInputSlotData("Input", bands);
+    node.SetInputSlotData("Type", std::string("THRESH_MULTI"));
+
+    // Multi-level Otsu separates the bands onto 0, 128 and 255 (MaxValue 255)
+    node.SetInputSlotData("Levels", 3);
+    node.Process();
+    auto output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(output->at<uchar>(0, 0), 0);
+    EXPECT_EQ(output->at<uchar>(4, 0), 128);
+    EXPECT_EQ(output->at<uchar>(8, 0), 255);
+
+    // Explicit thresholds take precedence: nothing lies above 230, so 120 and 220 share the middle level
+    node.SetInputSlotData("Thresholds", std::string("50, 230"));
+    node.SetInputSlotData("MaxValue", 100.0);
+    node.Process();
+    output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(output->at<uchar>(0, 0), 0);
+    EXPECT_EQ(output->at<uchar>(4, 0), 50);
+    EXPECT_EQ(output->at<uchar>(8, 0), 50);
+
+    // Invalid lists fall back to Otsu levels; non-8-bit input is rejected
+    node.SetInputSlotData("Thresholds", std::string("170,85"));
+    node.Process();
+    output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_EQ(output->at<uchar>(8, 0), 100);
+
+    cv::Mat floatBands;
+    bands.convertTo(floatBands, CV_32F);
+    node.SetInputSlotData("Input", floatBands);
+    node.Process();
+    EXPECT_FALSE(node.GetOutputSlot("Output").HasData());
+}
+
 // ============================================================================
 // Vision::Algorithms::CannyEdgeNode Tests
 // ============================================================================
@@ -321,6 +444,69 @@ TEST_F(NodeImplementationTest, GrayscaleNodeAlreadyGray)
     EXPECT_EQ(output->channels(), 1);
 }
 
+TEST_F(NodeImplementationTest, GrayscaleNodePreserveAlpha)
+{
+    // Distinct channel values per pixel, viewed through a column ROI so rows are not contiguous
+    cv::Mat source(4, 6, CV_8UC4);
+    for (int y = 0; y < source.rows; ++y)
+    {
+        auto *pixel = source.ptr<uchar>(y);
+        for (int i = 0; i < source.cols * 4; ++i)
+        {
+            pixel[i] = static_cast<uchar>(y * 50 + i * 9);
+        }
+    }
+    const cv::Mat bgra = source(cv::Rect(1, 0, 4, 4));
+
+    for (const auto *method : { "BGRA2GRAY", "RGBA2GRAY" })
+    {
+        Vision::Algorithms::GrayscaleNode node(1, "Grayscale");
+        node.SetInputSlotData("Input", bgra);
+        node.SetInputSlotDefault("Method", std::string(method));
+        node.SetInputSlotDefault("PreserveAlpha", true);
+        node.Process();
+
+        auto output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+        ASSERT_TRUE(output.has_value());
+        ASSERT_EQ(output->type(), CV_8UC2);
+        const bool rgb = std::string(method) == "RGBA2GRAY";
+        for (int y = 0; y < bgra.rows; ++y)
+        {
+            for (int x = 0; x < bgra.cols; ++x)
+            {
+                const uchar *in = bgra.ptr<uchar>(y) + 4 * x;
+                const uchar *out = output->ptr<uchar>(y) + 2 * x;
+                const double blue = rgb ? in[2] : in[0];
+                const double red = rgb ? in[0] : in[2];
+                EXPECT_NEAR(out[0], 0.114 * blue + 0.587 * in[1] + 0.299 * red, 1.0);
+                EXPECT_EQ(out[1], in[3]);
+            }
+        }
+    }
+}
+
+TEST_F(NodeImplementationTest, GrayscaleNodePreserveAlphaWideDepths)
+{
+    Vision::Algorithms::GrayscaleNode node(1, "Grayscale");
+    node.SetInputSlotDefault("PreserveAlpha", true);
+
+    node.SetInputSlotData("Input", cv::Mat(2, 2, CV_16UC4, cv::Scalar(1000, 2000, 3000, 65535)));
+    node.Process();
+    auto output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    ASSERT_EQ(output->type(), CV_16UC2);
+    EXPECT_NEAR(output->ptr<ushort>(1)[2], 0.114 * 1000 + 0.587 * 2000 + 0.299 * 3000, 1.0);
+    EXPECT_EQ(output->ptr<ushort>(1)[3], 65535);
+
+    node.SetInputSlotData("Input", cv::Mat(2, 2, CV_32FC4, cv::Scalar(0.5, 0.25, 1.0, 0.75)));
+    node.Process();
+    output = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    ASSERT_EQ(output->type(), CV_32FC2);
+    EXPECT_NEAR(output->ptr<float>(0)[0], 0.114 * 0.5 + 0.587 * 0.25 + 0.299 * 1.0, 1e-5);
+    EXPECT_FLOAT_EQ(output->ptr<float>(0)[1], 0.75f);
+}
+
 TEST_F(NodeImplementationTest, GrayscaleNodeNoInput)
 {
     Vision::Algorithms::GrayscaleNode node(1, "Grayscale");
@@ -0,0 +1,51 @@
+#include "UI/Canvas/ConnectionManager.h"
+#include "UI/Rendering/NodeDimensionCalculator.h"
+#include "UI/Rendering/NodeLayoutCache.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/IO/PreviewNode.h"
+#include "gtest/gtest.h"
+
+using namespace VisionCraft;
+
+TEST(NodeLayoutCacheTest, LayoutMatchesCalculatorAtEveryZoom)
+{
+    const Vision::Algorithms::GrayscaleNode node(1);
+    const auto pins = UI::Canvas::ConnectionManager::GetNodePins(&node);
+    const auto layout = UI::Rendering::NodeLayoutCache::Build(node);
+
+    for (const float zoom : { 0.25f, 1.0f, 2.0f })
+    {
+        const auto expected = UI::Rendering::NodeDimensionCalculator::CalculateNodeDimensions(pins, zoom, &node);
+        const auto actual = layout.Dimensions(zoom);
+        EXPECT_NEAR(actual.size.x, expected.size.x, 1e-3f);
+        EXPECT_NEAR(actual.size.y, expected.size.y, 1e-3f);
+        EXPECT_EQ(actual.inputPinCount, expected.inputPinCount);
+        EXPECT_EQ(actual.outputPinCount, expected.outputPinCount);
+    }
+
+    EXPECT_EQ(layout.pins.size(), pins.size());
+    EXPECT_EQ(layout.separated.dataInputPins.size() + layout.separated.executionInputPins.size(),
+        layout.inputPinCount);
+    EXPECT_GT(layout.parameterAreaHeight, 0.0f);
+}
+
+TEST(NodeLayoutCacheTest, LayoutIsReusedUntilInvalidated)
+{
+    const Vision::Algorithms::GrayscaleNode grayscale(1);
+    const Vision::IO::PreviewNode preview(2);
+    UI::Rendering::NodeLayoutCache cache;
+
+    const auto *first = &cache.Get(grayscale);
+    const auto pinCount = first->pins.size();
+    EXPECT_EQ(&cache.Get(grayscale), first); // Same entry: nothing recomputed
+    (void)cache.Get(preview);
+    EXPECT_EQ(cache.Size(), 2u);
+
+    cache.Invalidate(1);
+    EXPECT_EQ(cache.Size(), 1u);
+    EXPECT_EQ(cache.Get(grayscale).pins.size(), pinCount); // Rebuilt on next use
+    EXPECT_EQ(cache.Size(), 2u);
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0u);
+}
@@ -0,0 +1,340 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Scales its input by a parameter and counts Process() calls
+    class ScaleNode : public Nodes::Node
+    {
+    public:
+        ScaleNode(Nodes::NodeId id, std::string name, bool cacheable = true)
+            : Nodes::Node(id, std::move(name)), cacheable(cacheable)
+        {
+            CreateInputSlot("Input", 1.0);
+            CreateInputSlot("Factor", 2.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ScaleNode";
+        }
+
+        bool IsCacheable() const override
+        {
+            return cacheable;
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            const auto input = GetInputValue<double>("Input").value_or(0.0);
+            const auto factor = GetInputValue<double>("Factor").value_or(1.0);
+            SetOutputSlotData("Output", input * factor);
+        }
+
+        int processCount = 0;
+
+    private:
+        bool cacheable;
+    };
+
+    // Emits a fixed-size image so entry sizes are predictable
+    class ImageNode : public Nodes::Node
+    {
+    public:
+        ImageNode(Nodes::NodeId id, int side) : Nodes::Node(id, "Image"), side(side)
+        {
+            CreateInputSlot("Seed", 0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ImageNode";
+        }
+
+        void Process() override
+        {
+            const auto seed = GetInputValue<int>("Seed").value_or(0);
+            SetOutputSlotData("Output", cv::Mat(side, side, CV_8UC1, cv::Scalar(seed)));
+        }
+
+    private:
+        int side;
+    };
+
+    double OutputOf(const Nodes::Node &node)
+    {
+        return node.GetOutputSlot("Output").GetData<double>().value_or(-1.0);
+    }
+} // namespace
+
+TEST(NodeOutputCacheTest, TogglingParameterBackIsCacheHit)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ScaleNode>(1, "Scale"));
+    auto &node = *static_cast<ScaleNode *>(editor.GetNode(1));
+
+    ASSERT_TRUE(editor.Execute());
+    node.SetInputSlotDefault("Factor", 3.0);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(OutputOf(node), 3.0);
+
+    node.SetInputSlotDefault("Factor", 2.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(node.processCount, 2);
+    EXPECT_DOUBLE_EQ(OutputOf(node), 2.0);
+    EXPECT_EQ(editor.GetOutputCache().GetStatistics().hits, 1);
+    EXPECT_FALSE(node.IsDirty());
+}
+
+TEST(NodeOutputCacheTest, HitPropagatesDirtyToConsumers)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ScaleNode>(1, "Source"));
+    editor.AddNode(std::make_unique<ScaleNode>(2, "Sink", false));
+    editor.AddConnection(1, "Output", 2, "Input");
+    auto &source = *static_cast<ScaleNode *>(editor.GetNode(1));
+    auto &sink = *static_cast<ScaleNode *>(editor.GetNode(2));
+
+    ASSERT_TRUE(editor.Execute());
+    source.SetInputSlotDefault("Factor", 5.0);
+    ASSERT_TRUE(editor.Execute());
+    source.SetInputSlotDefault("Factor", 2.0);
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(source.processCount, 2);
+    EXPECT_EQ(sink.processCount, 3);
+    EXPECT_DOUBLE_EQ(OutputOf(sink), 4.0);
+}
+
+TEST(NodeOutputCacheTest, NonCacheableNodeAlwaysProcesses)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<ScaleNode>(1, "Scale", false));
+    auto &node = *static_cast<ScaleNode *>(editor.GetNode(1));
+
+    ASSERT_TRUE(editor.Execute());
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(node.processCount, 2);
+    EXPECT_EQ(editor.GetOutputCache().GetEntryCount(), 0);
+}
+
+TEST(NodeOutputCacheTest, DisabledCacheRecomputes)
+{
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<ScaleNode>(1, "Scale"));
+    auto &node = *static_cast<ScaleNode *>(editor.GetNode(1));
+
+    ASSERT_TRUE(editor.Execute());
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FALSE(editor.IsOutputCacheEnabled());
+    EXPECT_EQ(node.processCount, 2);
+}
+
+TEST(NodeOutputCacheTest, EvictsLeastRecentlyUsedUnderBudget)
+{
+    ImageNode node(1, 10); // 100-byte outputs
+    Nodes::NodeOutputCache cache(250);
+
+    uint64_t keys[3];
+    for (int seed = 0; seed < 3; ++seed)
+    {
+        node.SetInputSlotDefault("Seed", seed);
+        node.Process();
+        keys[seed] = Nodes::NodeOutputCache::ComputeKey(node);
+        if (seed == 2)
+        {
+            ASSERT_TRUE(cache.TryRestore(keys[0], node)); // Touch first entry so the second is oldest
+        }
+        cache.Store(keys[seed], node);
+    }
+
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_EQ(cache.GetUsedBytes(), 200);
+    EXPECT_EQ(cache.GetStatistics().evictions, 1);
+    EXPECT_TRUE(cache.TryRestore(keys[0], node));
+    EXPECT_FALSE(cache.TryRestore(keys[1], node));
+    EXPECT_TRUE(cache.TryRestore(keys[2], node));
+}
+
+TEST(NodeOutputCacheTest, OversizedResultIsNotStored)
+{
+    ImageNode node(1, 10);
+    node.Process();
+
+    Nodes::NodeOutputCache cache(50);
+    cache.Store(Nodes::NodeOutputCache::ComputeKey(node), node);
+
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetUsedBytes(), 0);
+}
+
+TEST(NodeOutputCacheTest, ShrinkingBudgetEvicts)
+{
+    ImageNode node(1, 10);
+    Nodes::NodeOutputCache cache(1000);
+    for (int seed = 0; seed < 4; ++seed)
+    {
+        node.SetInputSlotDefault("Seed", seed);
+        node.Process();
+        cache.Store(Nodes::NodeOutputCache::ComputeKey(node), node);
+    }
+    ASSERT_EQ(cache.GetEntryCount(), 4);
+
+    cache.SetByteBudget(150);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_LE(cache.GetUsedBytes(), 150);
+}
+
+TEST(NodeOutputCacheTest, StoredImagesAreDeepCopied)
+{
+    ImageNode node(1, 4);
+    node.Process();
+    const auto key = Nodes::NodeOutputCache::ComputeKey(node);
+
+    Nodes::NodeOutputCache cache(1000);
+    cache.Store(key, node);
+
+    auto produced = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(produced.has_value());
+    produced->at<uchar>(0, 0) = 255; // Shares buffer with the slot
+
+    ASSERT_TRUE(cache.TryRestore(key, node));
+    const auto restored = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored->at<uchar>(0, 0), 0);
+}
+
+TEST(NodeOutputCacheTest, FingerprintTracksContentNotIdentity)
+{
+    cv::Mat first(8, 8, CV_8UC1, cv::Scalar(7));
+    cv::Mat second = first.clone();
+    EXPECT_EQ(Nodes::NodeOutputCache::Fingerprint(first), Nodes::NodeOutputCache::Fingerprint(second));
+
+    second.at<uchar>(7, 7) = 8;
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(first), Nodes::NodeOutputCache::Fingerprint(second));
+
+    cv::Mat reshaped(4, 16, CV_8UC1, cv::Scalar(7));
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(first), Nodes::NodeOutputCache::Fingerprint(reshaped));
+}
+
+TEST(NodeOutputCacheTest, ChannelViewFingerprintFollowsChannelContent)
+{
+    const cv::Mat image(8, 8, CV_8UC3, cv::Scalar(10, 20, 30));
+    const Nodes::ChannelView green{ .source = image, .channel = 1 };
+    const Nodes::ChannelView compact{ .source = green.Extract(), .channel = 0 };
+    EXPECT_EQ(Nodes::NodeOutputCache::Fingerprint(green), Nodes::NodeOutputCache::Fingerprint(compact));
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(green),
+        Nodes::NodeOutputCache::Fingerprint(Nodes::ChannelView{ .source = image, .channel = 2 }));
+    EXPECT_EQ(Nodes::NodeOutputCache::EstimateBytes(green), 64u);
+}
+
+TEST(NodeOutputCacheTest, FingerprintDistinguishesTypes)
+{
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ 1 }),
+        Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ 1.0 }));
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ std::string("open") }),
+        Nodes::NodeOutputCache::Fingerprint(Nodes::NodeData{ std::string("close") }));
+}
+
+TEST(NodeOutputCacheTest, ClearDropsEntriesAndCounters)
+{
+    ImageNode node(1, 4);
+    node.Process();
+    const auto key = Nodes::NodeOutputCache::ComputeKey(node);
+
+    Nodes::NodeOutputCache cache(1000);
+    cache.Store(key, node);
+    ASSERT_TRUE(cache.TryRestore(key, node));
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetUsedBytes(), 0);
+    EXPECT_EQ(cache.GetStatistics().hits, 0);
+    EXPECT_FALSE(cache.TryRestore(key, node));
+}
+
+TEST(NodeOutputCacheTest, EvictedImagesAreKeptCompressed)
+{
+    ImageNode node(1, 100); // 10000-byte uniform outputs, a few dozen bytes run-length coded
+    Nodes::NodeOutputCache cache(15000);
+    cache.SetCompressedTierBudget(1000);
+
+    node.SetInputSlotDefault("Seed", 1);
+    node.Process();
+    const auto cold = Nodes::NodeOutputCache::ComputeKey(node);
+    cache.Store(cold, node);
+    node.SetInputSlotDefault("Seed", 2);
+    node.Process();
+    cache.Store(Nodes::NodeOutputCache::ComputeKey(node), node);
+
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.GetCompressedEntryCount(), 1);
+    EXPECT_LT(cache.GetCompressedBytes(), 200);
+    EXPECT_EQ(cache.GetStatistics().compressions, 1);
+
+    // The hit decodes the image and swaps it with the other entry, which moves to the compressed tier
+    ASSERT_TRUE(cache.TryRestore(cold, node));
+    const auto restored = node.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(cv::countNonZero(*restored != 1), 0);
+    EXPECT_EQ(restored->size(), cv::Size(100, 100));
+    EXPECT_EQ(cache.GetStatistics().compressedHits, 1);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.GetCompressedEntryCount(), 1);
+}
+
+TEST(NodeOutputCacheTest, PoorlyCompressingEntriesAreDropped)
+{
+    ImageNode node(1, 100);
+    Nodes::NodeOutputCache cache(15000);
+    cache.SetCompressedTierBudget(1000000);
+
+    cv::Mat noise(100, 100, CV_8UC1);
+    cv::randu(noise, 0, 256);
+    node.SetOutputSlotData("Output", noise);
+    const auto key = Nodes::NodeOutputCache::ComputeKey(node);
+    cache.Store(key, node);
+    node.SetInputSlotDefault("Seed", 2);
+    node.Process();
+    cache.Store(Nodes::NodeOutputCache::ComputeKey(node), node);
+
+    EXPECT_EQ(cache.GetCompressedEntryCount(), 0);
+    EXPECT_EQ(cache.GetStatistics().evictions, 1);
+    EXPECT_FALSE(cache.TryRestore(key, node));
+}
+
+TEST(NodeOutputCacheTest, TrimCoversBothTiers)
+{
+    ImageNode node(1, 100);
+    Nodes::NodeOutputCache cache(25000);
+    cache.SetCompressedTierBudget(1000);
+    for (int seed = 0; seed < 4; ++seed)
+    {
+        node.SetInputSlotDefault("Seed", seed);
+        node.Process();
+        cache.Store(Nodes::NodeOutputCache::ComputeKey(node), node);
+    }
+    ASSERT_EQ(cache.GetEntryCount(), 2);
+    ASSERT_EQ(cache.GetCompressedEntryCount(), 2);
+
+    // Trimming drops hot entries outright instead of compressing them
+    const size_t held = cache.GetUsedBytes() + cache.GetCompressedBytes();
+    EXPECT_EQ(cache.Trim(0), held);
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetCompressedEntryCount(), 0);
+    EXPECT_EQ(cache.GetCompressedBytes(), 0);
+}
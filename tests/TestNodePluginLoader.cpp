@@ -0,0 +1,116 @@
+#include "Nodes/Core/EngineConstants.h"
+#include "Vision/Factory/NodeFactory.h"
+#include "Vision/Factory/NodePluginLoader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace VisionCraft;
+using Vision::NodePluginLoader;
+
+namespace
+{
+    class NodePluginLoaderTest : public ::testing::Test
+    {
+    protected:
+        std::filesystem::path directory;
+
+        void SetUp() override
+        {
+            Vision::NodeFactory::RegisterAllNodes();
+            const std::string testName = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+            directory = std::filesystem::temp_directory_path() / ("vision_craft_plugins_" + testName);
+            std::filesystem::create_directories(directory);
+        }
+
+        void TearDown() override
+        {
+            std::filesystem::remove_all(directory);
+        }
+
+        std::filesystem::path WriteFile(const std::string &name, const std::string &contents) const
+        {
+            const auto path = directory / name;
+            std::ofstream(path) << contents;
+            return path;
+        }
+    };
+} // namespace
+
+TEST_F(NodePluginLoaderTest, ReadManifestResolvesTheLibraryNextToIt)
+{
+    const auto path = WriteFile("acme.vcplugin",
+        R"({ "name": "Acme", "library": "libacme.so",
+             "nodes": [ { "type": "AcmeDetect", "displayName": "Acme Detect", "category": "Detection" },
+                        { "type": "AcmeTrack" } ] })");
+
+    std::string error;
+    const auto manifest = NodePluginLoader::ReadManifest(path, error);
+    ASSERT_TRUE(manifest) << error;
+    EXPECT_EQ(manifest->name, "Acme");
+    EXPECT_EQ(manifest->library, directory / "libacme.so");
+    ASSERT_EQ(manifest->types.size(), 2u);
+    EXPECT_EQ(manifest->types[0].displayName, "Acme Detect");
+    EXPECT_EQ(manifest->types[0].category, "Detection");
+
+    // Names default to the type, categories to the pack
+    EXPECT_EQ(manifest->types[1].displayName, "AcmeTrack");
+    EXPECT_EQ(manifest->types[1].category, "Acme");
+}
+
+TEST_F(NodePluginLoaderTest, ReadManifestRejectsMalformedFiles)
+{
+    std::string error;
+    EXPECT_FALSE(NodePluginLoader::ReadManifest(WriteFile("a.vcplugin", "not json"), error));
+    EXPECT_FALSE(NodePluginLoader::ReadManifest(WriteFile("b.vcplugin", R"({ "library": "x.so" })"), error));
+    EXPECT_FALSE(NodePluginLoader::ReadManifest(
+        WriteFile("c.vcplugin", R"({ "library": "x.so", "nodes": [ { "displayName": "No Type" } ] })"), error));
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(NodePluginLoader::ReadManifest(directory / "missing.vcplugin", error));
+}
+
+TEST_F(NodePluginLoaderTest, DeclaredTypesAreListedWithoutLoadingTheLibrary)
+{
+    WriteFile("listed.vcplugin",
+        R"({ "library": "missing_library.so", "nodes": [ { "type": "ListedPluginType" } ] })");
+    WriteFile("ignored.json", R"({ "library": "missing_library.so", "nodes": [ { "type": "IgnoredPluginType" } ] })");
+
+    EXPECT_EQ(NodePluginLoader::AddManifestDirectory(directory), 1u);
+    EXPECT_EQ(NodePluginLoader::AddManifestDirectory(directory / "absent"), 0u);
+
+    EXPECT_TRUE(NodePluginLoader::Declares("ListedPluginType"));
+    EXPECT_TRUE(NodePluginLoader::Declares("ListedPluginTypeNode"));
+    EXPECT_TRUE(NodePluginLoader::Declares("CudaListedPluginType"));
+    EXPECT_FALSE(NodePluginLoader::Declares("IgnoredPluginType"));
+
+    const auto declared = NodePluginLoader::GetDeclaredTypes();
+    EXPECT_TRUE(std::ranges::any_of(declared, [](const auto &type) { return type.typeId == "ListedPluginType"; }));
+
+    // Declaring does not register: the factory only learns the type once the pack loads
+    const auto registered = Vision::NodeFactory::GetRegisteredTypes();
+    EXPECT_EQ(std::ranges::count(registered, "ListedPluginType"), 0);
+}
+
+TEST_F(NodePluginLoaderTest, PackThatFailsToLoadLeavesTheTypeUnregistered)
+{
+    ASSERT_TRUE(NodePluginLoader::AddManifest({ .name = "Broken",
+        .library = directory / "missing_library.so",
+        .types = { { .typeId = "BrokenPluginType" } } }));
+
+    EXPECT_FALSE(Vision::NodeFactory::IsRegistered("BrokenPluginType"));
+    EXPECT_EQ(Vision::NodeFactory::CreateNode("BrokenPluginTypeNode", 1, "Broken"), nullptr);
+    EXPECT_FALSE(NodePluginLoader::LoadFor("BrokenPluginType"));
+
+    // Built-in types are unaffected, and undeclared types never reach the loader
+    EXPECT_NE(Vision::NodeFactory::CreateNode("Grayscale", 2, "Gray"), nullptr);
+    EXPECT_FALSE(NodePluginLoader::LoadFor("UndeclaredPluginType"));
+}
+
+TEST_F(NodePluginLoaderTest, ManifestWithoutTypesIsNotDeclared)
+{
+    EXPECT_FALSE(NodePluginLoader::AddManifest({ .name = "Empty", .library = directory / "empty.so" }));
+}
@@ -0,0 +1,146 @@
+#include "Nodes/Core/NodeEditor.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Outputs a value set by the test
+    class ValueNode : public Nodes::Node
+    {
+    public:
+        explicit ValueNode(Nodes::NodeId id) : Nodes::Node(id, "Value")
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "PreparationValueNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", value);
+        }
+
+        double value = 1.0;
+    };
+
+    // Scales its input by a Factor parameter resolved in Prepare()
+    class ScaleNode : public Nodes::Node
+    {
+    public:
+        explicit ScaleNode(Nodes::NodeId id) : Nodes::Node(id, "Scale")
+        {
+            CreateInputSlot("Input");
+            CreateInputSlot("Factor", 2.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "PreparationScaleNode";
+        }
+
+        void Process() override
+        {
+            const double factor = GetPrepared(preparedFactor, [this] { return ReadFactor(); });
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) * factor);
+        }
+
+        int prepareCalls = 0;
+
+    protected:
+        void Prepare() override
+        {
+            ++prepareCalls;
+            preparedFactor = ReadFactor();
+        }
+
+    private:
+        double ReadFactor() const
+        {
+            return GetInputValue<double>("Factor").value_or(1.0);
+        }
+
+        double preparedFactor = 0.0;
+    };
+} // namespace
+
+class NodePreparationTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetOutputCacheEnabled(false);
+        editor.AddNode(std::make_unique<ValueNode>(1));
+        editor.AddNode(std::make_unique<ScaleNode>(2));
+        editor.AddConnection(1, "Output", 2, "Input");
+    }
+
+    // Runs the graph with a new source value and returns the scaled result
+    double Run(double value)
+    {
+        static_cast<ValueNode *>(editor.GetNode(1))->value = value;
+        editor.MarkNodeDirty(1);
+        EXPECT_TRUE(editor.Execute());
+        return editor.GetNode(2)->GetOutputSlot("Output").GetData<double>().value_or(0.0);
+    }
+
+    ScaleNode &Scale()
+    {
+        return *static_cast<ScaleNode *>(editor.GetNode(2));
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(NodePreparationTest, PreparesOncePerParameterChange)
+{
+    EXPECT_DOUBLE_EQ(Run(1.0), 2.0);
+    EXPECT_DOUBLE_EQ(Run(3.0), 6.0);
+    EXPECT_DOUBLE_EQ(Run(4.0), 8.0);
+    EXPECT_EQ(Scale().prepareCalls, 1); // New images do not re-prepare
+
+    Scale().SetInputSlotDefault("Factor", 5.0);
+    EXPECT_DOUBLE_EQ(Run(4.0), 20.0);
+    EXPECT_DOUBLE_EQ(Run(2.0), 10.0);
+    EXPECT_EQ(Scale().prepareCalls, 2);
+}
+
+TEST_F(NodePreparationTest, ConnectedParameterReprepares)
+{
+    editor.AddNode(std::make_unique<ValueNode>(3));
+    static_cast<ValueNode *>(editor.GetNode(3))->value = 3.0;
+    editor.AddConnection(3, "Output", 2, "Factor");
+    EXPECT_DOUBLE_EQ(Run(2.0), 6.0);
+    const int calls = Scale().prepareCalls;
+
+    static_cast<ValueNode *>(editor.GetNode(3))->value = 10.0;
+    editor.MarkNodeDirty(3);
+    EXPECT_DOUBLE_EQ(Run(2.0), 20.0);
+    EXPECT_EQ(Scale().prepareCalls, calls + 1);
+}
+
+TEST_F(NodePreparationTest, UnpreparedProcessReadsSlots)
+{
+    // Called directly, as tests of a single node do; the stale prepared value is never used
+    ScaleNode node(10);
+    node.SetInputSlotData("Input", 3.0);
+    node.SetInputSlotDefault("Factor", 4.0);
+    node.Process();
+    EXPECT_DOUBLE_EQ(node.GetOutputSlot("Output").GetData<double>().value_or(0.0), 12.0);
+    EXPECT_EQ(node.prepareCalls, 0);
+
+    node.PrepareIfNeeded();
+    node.PrepareIfNeeded();
+    EXPECT_EQ(node.prepareCalls, 1);
+    node.SetInputSlotDefault("Factor", 5.0);
+    node.Process();
+    EXPECT_DOUBLE_EQ(node.GetOutputSlot("Output").GetData<double>().value_or(0.0), 15.0);
+}
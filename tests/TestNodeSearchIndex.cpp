@@ -0,0 +1,108 @@
+#include "UI/Widgets/NodeSearchIndex.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+using UI::Widgets::NodeSearchIndex;
+
+class NodeSearchIndexTest : public ::testing::Test
+{
+protected:
+    NodeSearchIndex index;
+    std::vector<NodeSearchIndex::Match> results;
+
+    void SetUp() override
+    {
+        index.Build({
+            { "ImageInput", "Image Input", "Input/Output" },
+            { "ImageOutput", "Image Output", "Input/Output" },
+            { "Preview", "Preview", "Input/Output" },
+            { "Grayscale", "Grayscale", "Processing" },
+            { "CannyEdge", "Canny Edge Detection", "Processing" },
+            { "Threshold", "Threshold", "Processing" },
+            { "GaussianBlur", "Gaussian Blur", "Processing" },
+        });
+    }
+
+    std::vector<std::string> Search(const std::string &query)
+    {
+        index.Search(query, results);
+        std::vector<std::string> typeIds;
+        for (const auto &match : results)
+        {
+            typeIds.push_back(index.Entry(match.entry).typeId);
+        }
+        return typeIds;
+    }
+};
+
+TEST_F(NodeSearchIndexTest, EmptyQueryListsEverythingByName)
+{
+    EXPECT_EQ(Search(""),
+        (std::vector<std::string>{
+            "CannyEdge", "GaussianBlur", "Grayscale", "ImageInput", "ImageOutput", "Preview", "Threshold" }));
+}
+
+TEST_F(NodeSearchIndexTest, SubstringMatchesOutrankSubsequenceMatches)
+{
+    // "image" is a substring of both image nodes; "edge" only of Canny
+    EXPECT_EQ(Search("IMAGE"), (std::vector<std::string>{ "ImageInput", "ImageOutput" }));
+    EXPECT_EQ(Search("edge"), (std::vector<std::string>{ "CannyEdge" }));
+
+    // "gbl" appears only in order: G(aussian) Bl(ur)
+    EXPECT_EQ(Search("gbl"), (std::vector<std::string>{ "GaussianBlur" }));
+    EXPECT_TRUE(Search("xyz").empty());
+}
+
+TEST_F(NodeSearchIndexTest, NarrowingMatchesAFreshSearch)
+{
+    const std::vector<std::string> queries{ "g", "gr", "gra", "gray", "grays" };
+    for (const auto &query : queries)
+    {
+        const auto narrowed = Search(query);
+
+        NodeSearchIndex fresh;
+        fresh.Build({ { "Grayscale", "Grayscale", "" }, { "GaussianBlur", "Gaussian Blur", "" },
+            { "ImageInput", "Image Input", "" }, { "CannyEdge", "Canny Edge Detection", "" },
+            { "ImageOutput", "Image Output", "" }, { "Preview", "Preview", "" }, { "Threshold", "Threshold", "" } });
+        std::vector<NodeSearchIndex::Match> freshResults;
+        fresh.Search(query, freshResults);
+        ASSERT_EQ(narrowed.size(), freshResults.size()) << query;
+        for (size_t i = 0; i < narrowed.size(); ++i)
+        {
+            EXPECT_EQ(narrowed[i], fresh.Entry(freshResults[i].entry).typeId) << query;
+        }
+    }
+
+    // Backspacing drops the narrowing and finds the wider set again
+    EXPECT_EQ(Search("grays").size(), 1u);
+    EXPECT_EQ(Search("g").size(), 5u);
+}
+
+TEST_F(NodeSearchIndexTest, RecordUsageMovesTypesUpIncrementally)
+{
+    EXPECT_TRUE(index.RecordUsage("Threshold"));
+    EXPECT_TRUE(index.RecordUsage("Preview"));
+    EXPECT_TRUE(index.RecordUsage("Preview"));
+    EXPECT_FALSE(index.RecordUsage("Missing"));
+
+    EXPECT_EQ(Search(""),
+        (std::vector<std::string>{
+            "Preview", "Threshold", "CannyEdge", "GaussianBlur", "Grayscale", "ImageInput", "ImageOutput" }));
+
+    // Used types lead search results too, ahead of better matches
+    EXPECT_TRUE(index.RecordUsage("ImageOutput"));
+    EXPECT_EQ(Search("image"), (std::vector<std::string>{ "ImageOutput", "ImageInput" }));
+}
+
+TEST(NodeSearchIndexScoreTest, EarlierAndTighterMatchesScoreHigher)
+{
+    EXPECT_GT(NodeSearchIndex::Score("gray", "grayscale"), NodeSearchIndex::Score("scale", "grayscale"));
+    EXPECT_GT(NodeSearchIndex::Score("blur", "blur"), NodeSearchIndex::Score("blur", "gaussian blur"));
+    EXPECT_FLOAT_EQ(NodeSearchIndex::Score("blur", "blur"), 1.0f);
+    EXPECT_FLOAT_EQ(NodeSearchIndex::Score("gy", "grayscale", false), 0.3f + 0.2f * 2.0f / 4.0f);
+    EXPECT_FLOAT_EQ(NodeSearchIndex::Score("zz", "grayscale"), 0.0f);
+}
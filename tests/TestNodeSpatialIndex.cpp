@@ -0,0 +1,106 @@
+#include "UI/Canvas/NodeSpatialIndex.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    constexpr float kCellSize = 100.0f;
+    const ImVec2 kNodeSize(50.0f, 50.0f);
+} // namespace
+
+TEST(NodeSpatialIndexTest, QueryReturnsOnlyIntersectingNodesInAscendingOrder)
+{
+    UI::Canvas::NodeSpatialIndex index(kCellSize);
+    index.Update(3, ImVec2(0.0f, 0.0f), kNodeSize);
+    index.Update(1, ImVec2(20.0f, 20.0f), kNodeSize);
+    index.Update(2, ImVec2(1000.0f, 1000.0f), kNodeSize);
+
+    std::vector<Nodes::NodeId> result;
+    index.Query(ImVec2(-10.0f, -10.0f), ImVec2(200.0f, 200.0f), result);
+    EXPECT_EQ(result, (std::vector<Nodes::NodeId>{ 1, 3 }));
+
+    index.Query(ImVec2(500.0f, 500.0f), ImVec2(600.0f, 600.0f), result);
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(NodeSpatialIndexTest, NodeSpanningSeveralCellsIsReportedOnce)
+{
+    UI::Canvas::NodeSpatialIndex index(kCellSize);
+    index.Update(1, ImVec2(-150.0f, -150.0f), ImVec2(400.0f, 400.0f));
+
+    std::vector<Nodes::NodeId> result;
+    index.Query(ImVec2(-1000.0f, -1000.0f), ImVec2(1000.0f, 1000.0f), result);
+    EXPECT_EQ(result, (std::vector<Nodes::NodeId>{ 1 }));
+
+    index.Query(ImVec2(-120.0f, -120.0f), ImVec2(220.0f, 220.0f), result);
+    EXPECT_EQ(result, (std::vector<Nodes::NodeId>{ 1 }));
+}
+
+TEST(NodeSpatialIndexTest, MovedNodeIsFoundOnlyAtItsNewPosition)
+{
+    UI::Canvas::NodeSpatialIndex index(kCellSize);
+    index.Update(1, ImVec2(0.0f, 0.0f), kNodeSize);
+    index.Update(1, ImVec2(10.0f, 10.0f), kNodeSize); // Same cell
+    index.Update(1, ImVec2(550.0f, 550.0f), kNodeSize);
+
+    std::vector<Nodes::NodeId> result;
+    index.Query(ImVec2(0.0f, 0.0f), ImVec2(90.0f, 90.0f), result);
+    EXPECT_TRUE(result.empty());
+
+    index.Query(ImVec2(540.0f, 540.0f), ImVec2(560.0f, 560.0f), result);
+    EXPECT_EQ(result, (std::vector<Nodes::NodeId>{ 1 }));
+
+    const auto *bounds = index.Find(1);
+    ASSERT_NE(bounds, nullptr);
+    EXPECT_FLOAT_EQ(bounds->max.x, 600.0f);
+    EXPECT_EQ(index.Size(), 1u);
+}
+
+TEST(NodeSpatialIndexTest, RemovedAndClearedNodesAreNotFound)
+{
+    UI::Canvas::NodeSpatialIndex index(kCellSize);
+    index.Update(1, ImVec2(0.0f, 0.0f), kNodeSize);
+    index.Update(2, ImVec2(10.0f, 10.0f), kNodeSize);
+    index.Remove(1);
+    index.Remove(42); // Unknown IDs are ignored
+
+    std::vector<Nodes::NodeId> result;
+    index.Query(ImVec2(0.0f, 0.0f), ImVec2(100.0f, 100.0f), result);
+    EXPECT_EQ(result, (std::vector<Nodes::NodeId>{ 2 }));
+    EXPECT_EQ(index.Find(1), nullptr);
+
+    index.Clear();
+    index.Query(ImVec2(0.0f, 0.0f), ImVec2(100.0f, 100.0f), result);
+    EXPECT_TRUE(result.empty());
+    EXPECT_EQ(index.Size(), 0u);
+}
+
+TEST(NodeSpatialIndexTest, QueryCoveringMoreCellsThanNodesMatchesCellWalk)
+{
+    UI::Canvas::NodeSpatialIndex index(kCellSize);
+    for (Nodes::NodeId id = 1; id <= 20; ++id)
+    {
+        index.Update(id, ImVec2(static_cast<float>(id) * 70.0f, static_cast<float>(id % 4) * 90.0f), kNodeSize);
+    }
+
+    // Zoomed out: far more cells than nodes, answered by scanning the nodes
+    std::vector<Nodes::NodeId> wide;
+    index.Query(ImVec2(-1.0e6f, -1.0e6f), ImVec2(1.0e6f, 1.0e6f), wide);
+    EXPECT_EQ(wide.size(), 20u);
+
+    std::vector<Nodes::NodeId> narrow;
+    index.Query(ImVec2(300.0f, 0.0f), ImVec2(700.0f, 400.0f), narrow);
+    std::vector<Nodes::NodeId> expected;
+    for (Nodes::NodeId id = 1; id <= 20; ++id)
+    {
+        const float x = static_cast<float>(id) * 70.0f;
+        if (x <= 700.0f && x + kNodeSize.x >= 300.0f)
+        {
+            expected.push_back(id);
+        }
+    }
+    EXPECT_EQ(narrow, expected);
+}
@@ -244,3 +244,81 @@ TEST_F(NodeTest, SlotDoesNotExistThrows)
     EXPECT_THROW(node.SetInputSlotData("NonExistent", Nodes::NodeData(42)), std::out_of_range);
     EXPECT_THROW(node.SetOutputSlotData("NonExistent", Nodes::NodeData(42)), std::out_of_range);
 }
+
+// ============================================================================
+// Slot Index Tests
+// ============================================================================
+
+TEST_F(NodeTest, SlotIndicesFollowCreationOrder)
+{
+    node.CreateInputSlot("Zeta");
+    node.CreateInputSlot("Alpha", 1);
+    node.CreateOutputSlot("Output");
+
+    EXPECT_EQ(node.FindInputSlotIndex("Zeta"), 0);
+    EXPECT_EQ(node.FindInputSlotIndex("Alpha"), 1);
+    EXPECT_EQ(node.FindOutputSlotIndex("Output"), 0);
+    EXPECT_EQ(node.GetInputSlotCount(), 2);
+    EXPECT_EQ(node.GetOutputSlotCount(), 1);
+    EXPECT_FALSE(node.FindInputSlotIndex("Output").has_value());
+    EXPECT_FALSE(node.FindOutputSlotIndex("Missing").has_value());
+}
+
+TEST_F(NodeTest, RecreatingSlotKeepsIndex)
+{
+    node.CreateInputSlot("Input");
+    node.CreateInputSlot("Other");
+    node.CreateInputSlot("Input", 5);
+
+    EXPECT_EQ(node.GetInputSlotCount(), 2);
+    EXPECT_EQ(node.FindInputSlotIndex("Input"), 0);
+    EXPECT_EQ(node.GetInputValue<int>("Input"), 5);
+}
+
+TEST_F(NodeTest, IndexAccessMatchesNameAccess)
+{
+    node.CreateInputSlot("Input", 3);
+    node.CreateOutputSlot("Output");
+    const auto input = *node.FindInputSlotIndex("Input");
+    const auto output = *node.FindOutputSlotIndex("Output");
+
+    EXPECT_EQ(node.GetInputValue<int>(input), 3);
+    ASSERT_NE(node.GetInputValueIf<int>(input), nullptr);
+    EXPECT_EQ(*node.GetInputValueIf<int>(input), 3);
+
+    node.SetOutputSlotData(output, 7);
+    EXPECT_EQ(node.GetOutputSlot("Output").GetData<int>(), 7);
+    EXPECT_EQ(&node.GetOutputSlot(output), &node.GetOutputSlot("Output"));
+
+    node.ShareInputSlotData(input, node.GetOutputSlot(output).GetSharedData());
+    EXPECT_EQ(node.GetInputValue<int>("Input"), 7);
+
+    node.ClearOutputSlot(output);
+    EXPECT_FALSE(node.GetOutputSlot("Output").HasData());
+}
+
+TEST_F(NodeTest, InputViewReadsWithoutCopying)
+{
+    node.CreateInputSlot("Method", std::string{ "BGR2GRAY" });
+    const auto index = *node.FindInputSlotIndex("Method");
+
+    const auto byName = node.GetInputView<std::string>("Method");
+    const auto byIndex = node.GetInputView<std::string>(index);
+    ASSERT_TRUE(byName);
+    EXPECT_EQ(*byName, "BGR2GRAY");
+    EXPECT_EQ(&*byName, &*byIndex);
+    EXPECT_FALSE(node.GetInputView<double>("Method"));
+
+    node.SetInputSlotDefault("Method", std::string{ "RGB2GRAY" });
+    EXPECT_EQ(*byName, "BGR2GRAY"); // The view keeps the value it was created on
+    EXPECT_EQ(node.GetInputView<std::string>("Method").ValueOrEmpty(), "RGB2GRAY");
+}
+
+TEST_F(NodeTest, InvalidSlotIndexThrows)
+{
+    node.CreateInputSlot("Input");
+
+    EXPECT_THROW(node.GetInputSlot(Nodes::SlotIndex{ 1 }), std::out_of_range);
+    EXPECT_THROW(node.GetOutputSlot(Nodes::SlotIndex{ 0 }), std::out_of_range);
+    EXPECT_THROW(node.SetOutputSlotData(Nodes::SlotIndex{ 0 }, Nodes::NodeData(1)), std::out_of_range);
+}
@@ -0,0 +1,425 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Records completion order across worker threads
+    class CompletionLog
+    {
+    public:
+        void Record(Nodes::NodeId id)
+        {
+            std::scoped_lock lock(mutex);
+            order.push_back(id);
+        }
+
+        [[nodiscard]] size_t PositionOf(Nodes::NodeId id) const
+        {
+            std::scoped_lock lock(mutex);
+            return static_cast<size_t>(std::find(order.begin(), order.end(), id) - order.begin());
+        }
+
+        [[nodiscard]] size_t Size() const
+        {
+            std::scoped_lock lock(mutex);
+            return order.size();
+        }
+
+        void Clear()
+        {
+            std::scoped_lock lock(mutex);
+            order.clear();
+        }
+
+    private:
+        mutable std::mutex mutex;
+        std::vector<Nodes::NodeId> order;
+    };
+
+    // Adds its two inputs (missing inputs count as zero) and records completion
+    class SumNode : public Nodes::Node
+    {
+    public:
+        SumNode(Nodes::NodeId id, std::string name, CompletionLog &log, double bias = 0.0)
+            : Nodes::Node(id, std::move(name)), log(log), bias(bias)
+        {
+            CreateInputSlot("A");
+            CreateInputSlot("B");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SumNode";
+        }
+
+        void Process() override
+        {
+            const auto a = GetInputValue<double>("A").value_or(0.0);
+            const auto b = GetInputValue<double>("B").value_or(0.0);
+            SetOutputSlotData("Output", a + b + bias);
+            log.Record(GetId());
+        }
+
+    private:
+        CompletionLog &log;
+        double bias;
+    };
+
+    // SumNode that takes long enough for the cost model to notice
+    class SlowSumNode : public SumNode
+    {
+    public:
+        using SumNode::SumNode;
+
+        void Process() override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            SumNode::Process();
+        }
+    };
+
+    // Waits until a partner node is running at the same time (or times out)
+    class RendezvousNode : public Nodes::Node
+    {
+    public:
+        RendezvousNode(Nodes::NodeId id, std::string name, std::atomic<int> &arrived, std::atomic<bool> &metPartner)
+            : Nodes::Node(id, std::move(name)), arrived(arrived), metPartner(metPartner)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "RendezvousNode";
+        }
+
+        void Process() override
+        {
+            arrived.fetch_add(1);
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (arrived.load() < 2 && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+            if (arrived.load() >= 2)
+            {
+                metPartner.store(true);
+            }
+            SetOutputSlotData("Output", 1.0);
+        }
+
+    private:
+        std::atomic<int> &arrived;
+        std::atomic<bool> &metPartner;
+    };
+
+    class ThrowingNode : public Nodes::Node
+    {
+    public:
+        ThrowingNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("A");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ThrowingNode";
+        }
+
+        void Process() override
+        {
+            throw std::runtime_error("intentional failure");
+        }
+    };
+
+    class ChainNode : public Nodes::Node
+    {
+    public:
+        ChainNode(Nodes::NodeId id, std::string name, CompletionLog &log, bool hasInputPin)
+            : Nodes::Node(id, std::move(name)), log(log)
+        {
+            if (hasInputPin)
+                CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+        }
+
+        std::string GetType() const override
+        {
+            return "ChainNode";
+        }
+
+        void Process() override
+        {
+            log.Record(GetId());
+        }
+
+    private:
+        CompletionLog &log;
+    };
+} // namespace
+
+class ParallelExecutionTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+        editor.SetWorkerCount(4);
+        editor.SetOutputCacheEnabled(false); // Completion logs count real Process() calls
+    }
+
+    CompletionLog log;
+    Nodes::NodeEditor editor;
+};
+
+TEST(ParallelExecutionDefaults, DefaultModeIsSequential)
+{
+    Nodes::NodeEditor editor;
+    EXPECT_EQ(editor.GetExecutionMode(), Nodes::ExecutionMode::Sequential);
+}
+
+TEST_F(ParallelExecutionTest, DiamondRespectsDataDependencies)
+{
+    // 1 -> {2, 3} -> 4
+    editor.AddNode(std::make_unique<SumNode>(1, "Source", log, 1.0));
+    editor.AddNode(std::make_unique<SumNode>(2, "Left", log, 10.0));
+    editor.AddNode(std::make_unique<SumNode>(3, "Right", log, 100.0));
+    editor.AddNode(std::make_unique<SumNode>(4, "Join", log));
+
+    editor.AddConnection(1, "Output", 2, "A");
+    editor.AddConnection(1, "Output", 3, "A");
+    editor.AddConnection(2, "Output", 4, "A");
+    editor.AddConnection(3, "Output", 4, "B");
+
+    ASSERT_TRUE(editor.Execute());
+
+    ASSERT_EQ(log.Size(), 4);
+    EXPECT_LT(log.PositionOf(1), log.PositionOf(2));
+    EXPECT_LT(log.PositionOf(1), log.PositionOf(3));
+    EXPECT_LT(log.PositionOf(2), log.PositionOf(4));
+    EXPECT_LT(log.PositionOf(3), log.PositionOf(4));
+
+    const auto result = editor.GetNode(4)->GetOutputSlot("Output").GetData<double>();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_DOUBLE_EQ(*result, 11.0 + 101.0);
+}
+
+TEST_F(ParallelExecutionTest, ProducesSameResultAsSequential)
+{
+    Nodes::NodeEditor sequential;
+    CompletionLog sequentialLog;
+
+    for (Nodes::NodeId id = 1; id <= 8; ++id)
+    {
+        editor.AddNode(std::make_unique<SumNode>(id, "Node", log, static_cast<double>(id)));
+        sequential.AddNode(std::make_unique<SumNode>(id, "Node", sequentialLog, static_cast<double>(id)));
+    }
+
+    const std::vector<std::tuple<Nodes::NodeId, Nodes::NodeId, std::string>> wires = {
+        { 1, 3, "A" }, { 2, 3, "B" }, { 3, 5, "A" }, { 4, 5, "B" }, { 5, 7, "A" }, { 6, 7, "B" }, { 7, 8, "A" }
+    };
+    for (const auto &[from, to, slot] : wires)
+    {
+        editor.AddConnection(from, "Output", to, slot);
+        sequential.AddConnection(from, "Output", to, slot);
+    }
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(sequential.Execute());
+
+    const auto parallelResult = editor.GetNode(8)->GetOutputSlot("Output").GetData<double>();
+    const auto sequentialResult = sequential.GetNode(8)->GetOutputSlot("Output").GetData<double>();
+    ASSERT_TRUE(parallelResult.has_value());
+    ASSERT_TRUE(sequentialResult.has_value());
+    EXPECT_DOUBLE_EQ(*parallelResult, *sequentialResult);
+}
+
+TEST_F(ParallelExecutionTest, IndependentBranchesRunConcurrently)
+{
+    std::atomic<int> arrived{ 0 };
+    std::atomic<bool> firstMet{ false };
+    std::atomic<bool> secondMet{ false };
+
+    editor.AddNode(std::make_unique<RendezvousNode>(1, "BranchA", arrived, firstMet));
+    editor.AddNode(std::make_unique<RendezvousNode>(2, "BranchB", arrived, secondMet));
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_TRUE(firstMet.load());
+    EXPECT_TRUE(secondMet.load());
+}
+
+TEST_F(ParallelExecutionTest, ExecutionChainsKeepTheirOrder)
+{
+    // Two independent execution chains: 1 -> 2 -> 3 and 4 -> 5 -> 6
+    editor.AddNode(std::make_unique<ChainNode>(1, "A1", log, false));
+    editor.AddNode(std::make_unique<ChainNode>(2, "A2", log, true));
+    editor.AddNode(std::make_unique<ChainNode>(3, "A3", log, true));
+    editor.AddNode(std::make_unique<ChainNode>(4, "B1", log, false));
+    editor.AddNode(std::make_unique<ChainNode>(5, "B2", log, true));
+    editor.AddNode(std::make_unique<ChainNode>(6, "B3", log, true));
+
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(4, "Then", 5, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(5, "Then", 6, "Execute", Nodes::ConnectionType::Execution);
+
+    ASSERT_TRUE(editor.Execute());
+
+    ASSERT_EQ(log.Size(), 6);
+    EXPECT_LT(log.PositionOf(1), log.PositionOf(2));
+    EXPECT_LT(log.PositionOf(2), log.PositionOf(3));
+    EXPECT_LT(log.PositionOf(4), log.PositionOf(5));
+    EXPECT_LT(log.PositionOf(5), log.PositionOf(6));
+}
+
+TEST_F(ParallelExecutionTest, FailureStopsDownstreamNodes)
+{
+    editor.AddNode(std::make_unique<SumNode>(1, "Source", log, 1.0));
+    editor.AddNode(std::make_unique<ThrowingNode>(2, "Broken"));
+    editor.AddNode(std::make_unique<SumNode>(3, "Downstream", log));
+
+    editor.AddConnection(1, "Output", 2, "A");
+    editor.AddConnection(2, "Output", 3, "A");
+
+    EXPECT_FALSE(editor.Execute());
+    EXPECT_EQ(log.PositionOf(3), log.Size()); // Never executed
+}
+
+TEST_F(ParallelExecutionTest, CancelledTokenStopsExecution)
+{
+    editor.AddNode(std::make_unique<SumNode>(1, "Source", log));
+
+    std::stop_source source;
+    source.request_stop();
+
+    EXPECT_FALSE(editor.Execute(nullptr, source.get_token()));
+    EXPECT_EQ(log.Size(), 0);
+}
+
+TEST_F(ParallelExecutionTest, ProgressCallbackReportsEveryNode)
+{
+    for (Nodes::NodeId id = 1; id <= 5; ++id)
+    {
+        editor.AddNode(std::make_unique<SumNode>(id, "Node", log));
+    }
+
+    std::vector<int> reported;
+    int reportedTotal = 0;
+    ASSERT_TRUE(editor.Execute([&](int current, int total, const std::string &) {
+        reported.push_back(current);
+        reportedTotal = total;
+    }));
+
+    std::sort(reported.begin(), reported.end());
+    EXPECT_EQ(reported, (std::vector<int>{ 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(reportedTotal, 5);
+}
+
+TEST_F(ParallelExecutionTest, RepeatedExecutionReusesPool)
+{
+    editor.AddNode(std::make_unique<SumNode>(1, "Source", log, 1.0));
+    editor.AddNode(std::make_unique<SumNode>(2, "Sink", log));
+    editor.AddConnection(1, "Output", 2, "A");
+
+    for (int run = 0; run < 20; ++run)
+    {
+        editor.MarkAllNodesDirty();
+        ASSERT_TRUE(editor.Execute());
+    }
+    EXPECT_EQ(log.Size(), 40);
+}
+
+namespace
+{
+    // Source 1 feeds a short branch (2) and a chain 3 -> 4 -> 5; longChainFirst picks which is wired first
+    void BuildUnevenBranches(Nodes::NodeEditor &editor, CompletionLog &log, bool longChainFirst)
+    {
+        for (Nodes::NodeId id = 1; id <= 5; ++id)
+        {
+            editor.AddNode(std::make_unique<SumNode>(id, "Node", log));
+        }
+        if (!longChainFirst)
+        {
+            editor.AddConnection(1, "Output", 2, "A");
+        }
+        editor.AddConnection(1, "Output", 3, "A");
+        editor.AddConnection(3, "Output", 4, "A");
+        editor.AddConnection(4, "Output", 5, "A");
+        if (longChainFirst)
+        {
+            editor.AddConnection(1, "Output", 2, "A");
+        }
+    }
+} // namespace
+
+TEST_F(ParallelExecutionTest, LongestChainStartsFirst)
+{
+    // With one worker the order steps run in is the scheduler's choice alone
+    for (const bool longChainFirst : { false, true })
+    {
+        CompletionLog runLog;
+        Nodes::NodeEditor single;
+        single.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+        single.SetWorkerCount(1);
+        BuildUnevenBranches(single, runLog, longChainFirst);
+
+        ASSERT_TRUE(single.Execute());
+        ASSERT_EQ(runLog.Size(), 5);
+        EXPECT_LT(runLog.PositionOf(5), runLog.PositionOf(2)) << "longChainFirst=" << longChainFirst;
+    }
+}
+
+TEST_F(ParallelExecutionTest, VisibleBranchesRunFirst)
+{
+    editor.SetWorkerCount(1);
+    BuildUnevenBranches(editor, log, true);
+    editor.SetVisibleNodes({ 2 });
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_EQ(log.Size(), 5);
+    EXPECT_EQ(log.PositionOf(1), 0);
+    EXPECT_EQ(log.PositionOf(2), 1);
+}
+
+TEST_F(ParallelExecutionTest, MeasuredCostsReorderLaterRuns)
+{
+    for (const bool slowFirst : { false, true })
+    {
+        CompletionLog runLog;
+        Nodes::NodeEditor single;
+        single.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+        single.SetWorkerCount(1);
+        single.SetOutputCacheEnabled(false);
+
+        // Two single-step branches below source 1; only the history tells them apart
+        single.AddNode(std::make_unique<SumNode>(1, "Source", runLog));
+        single.AddNode(std::make_unique<SlowSumNode>(2, "Slow", runLog));
+        single.AddNode(std::make_unique<SumNode>(3, "Fast", runLog));
+        single.AddConnection(1, "Output", slowFirst ? 2 : 3, "A");
+        single.AddConnection(1, "Output", slowFirst ? 3 : 2, "A");
+
+        ASSERT_TRUE(single.Execute());
+        ASSERT_TRUE(single.GetNodeCosts().GetEstimate(2).has_value());
+        EXPECT_GT(*single.GetNodeCosts().GetEstimate(2), *single.GetNodeCosts().GetEstimate(3));
+
+        runLog.Clear();
+        single.MarkAllNodesDirty();
+        ASSERT_TRUE(single.Execute());
+        ASSERT_EQ(runLog.Size(), 3);
+        EXPECT_LT(runLog.PositionOf(2), runLog.PositionOf(3)) << "slowFirst=" << slowFirst;
+    }
+}
@@ -0,0 +1,147 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <memory>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds one to its input (seeded with the node's default) and counts Process() calls
+    class CountingNode : public Nodes::Node
+    {
+    public:
+        CountingNode(Nodes::NodeId id, double initial) : Nodes::Node(id, "Counting")
+        {
+            CreateInputSlot("Input", initial);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CountingNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        int processCount = 0;
+    };
+} // namespace
+
+class PartialExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds 1 -> 2 -> 3 with a side branch 1 -> 4 and an unconnected node 5
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+        for (Nodes::NodeId id = 1; id <= 5; ++id)
+        {
+            editor.AddNode(std::make_unique<CountingNode>(id, 0.0));
+        }
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(1, "Output", 4, "Input");
+    }
+
+    CountingNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<CountingNode *>(editor.GetNode(id));
+    }
+
+    std::optional<double> ResultOf(Nodes::NodeId id)
+    {
+        return NodeAt(id).GetOutputSlot("Output").GetData<double>();
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(PartialExecutionTest, RunsOnlyUpstreamNodes)
+{
+    ASSERT_TRUE(editor.ExecuteUpTo(3));
+
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 3.0);
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        EXPECT_EQ(NodeAt(id).processCount, 1) << "node " << id;
+    }
+    EXPECT_EQ(NodeAt(4).processCount, 0);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+    EXPECT_TRUE(NodeAt(4).IsDirty());
+    EXPECT_TRUE(NodeAt(5).IsDirty());
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    EXPECT_EQ(run->targetNode, 3);
+    EXPECT_EQ(run->nodes.size(), 3u);
+}
+
+TEST_P(PartialExecutionTest, MarksSkippedReadersDirty)
+{
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_FALSE(NodeAt(4).IsDirty());
+
+    editor.GetNode(1)->SetInputSlotDefault("Input", 10.0);
+    ASSERT_TRUE(editor.ExecuteUpTo(2));
+    EXPECT_DOUBLE_EQ(*ResultOf(2), 12.0);
+    EXPECT_TRUE(NodeAt(3).IsDirty());
+    EXPECT_TRUE(NodeAt(4).IsDirty());
+    EXPECT_DOUBLE_EQ(*ResultOf(4), 2.0); // Stale until the next full run
+
+    // The full run picks up the pruned branches and skips what is already up to date
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 13.0);
+    EXPECT_DOUBLE_EQ(*ResultOf(4), 12.0);
+    EXPECT_EQ(NodeAt(1).processCount, 2);
+    EXPECT_EQ(NodeAt(2).processCount, 2);
+}
+
+TEST_P(PartialExecutionTest, KeepsOutputsReadByPrunedSteps)
+{
+    editor.SetIntermediateRelease(true);
+    ASSERT_TRUE(editor.ExecuteUpTo(3));
+
+    // Node 2 feeds only node 3, but node 4 still needs node 1
+    EXPECT_FALSE(NodeAt(2).GetOutputSlot("Output").HasData());
+    EXPECT_TRUE(NodeAt(1).GetOutputSlot("Output").HasData());
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(4), 2.0);
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+}
+
+TEST_P(PartialExecutionTest, FollowsDataConnectionsNotExecutionWires)
+{
+    // Execution flow 1 -> 4 -> 2 -> 3; node 4 runs between them but 3 does not read it
+    const Nodes::NodeId flow[] = { 1, 4, 2, 3 };
+    editor.GetNode(1)->CreateExecutionOutputPin("Then");
+    for (size_t i = 1; i < std::size(flow); ++i)
+    {
+        editor.GetNode(flow[i])->CreateExecutionInputPin("Execute");
+        editor.GetNode(flow[i])->CreateExecutionOutputPin("Then");
+        editor.AddConnection(flow[i - 1], "Then", flow[i], "Execute", Nodes::ConnectionType::Execution);
+    }
+
+    ASSERT_TRUE(editor.ExecuteUpTo(3));
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 3.0);
+    EXPECT_EQ(NodeAt(4).processCount, 0);
+
+    // Node 5 has no execution pins, so it is not in the plan
+    EXPECT_FALSE(editor.ExecuteUpTo(5));
+}
+
+TEST_P(PartialExecutionTest, UnknownTargetFails)
+{
+    EXPECT_FALSE(editor.ExecuteUpTo(99));
+    EXPECT_EQ(NodeAt(1).processCount, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    PartialExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,211 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/PersistentOutputStore.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Multiplies two parameters and counts Process() calls
+    class ProductNode : public Nodes::Node
+    {
+    public:
+        ProductNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input", 4.0);
+            CreateInputSlot("Factor", 2.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ProductNode";
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            const auto input = GetInputValue<double>("Input").value_or(0.0);
+            const auto factor = GetInputValue<double>("Factor").value_or(1.0);
+            SetOutputSlotData("Output", input * factor);
+        }
+
+        int processCount = 0;
+    };
+
+    using Outputs = std::vector<std::shared_ptr<const Nodes::NodeData>>;
+
+    std::shared_ptr<const Nodes::NodeData> Share(Nodes::NodeData data)
+    {
+        return std::make_shared<const Nodes::NodeData>(std::move(data));
+    }
+
+    bool SamePixels(const cv::Mat &a, const cv::Mat &b)
+    {
+        if (a.rows != b.rows || a.cols != b.cols || a.type() != b.type())
+        {
+            return false;
+        }
+        const size_t rowBytes = static_cast<size_t>(a.cols) * a.elemSize();
+        for (int row = 0; row < a.rows; ++row)
+        {
+            if (std::memcmp(a.ptr(row), b.ptr(row), rowBytes) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+class PersistentOutputStoreTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_persistent_store_test";
+        std::filesystem::remove_all(testDir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    std::filesystem::path testDir;
+};
+
+TEST_F(PersistentOutputStoreTest, NewSessionReplaysResultsFromDisk)
+{
+    {
+        Nodes::NodeEditor editor;
+        editor.GetOutputCache().SetPersistentStore(std::make_shared<Nodes::PersistentOutputStore>(testDir, 1 << 20));
+        editor.AddNode(std::make_unique<ProductNode>(1, "Product"));
+        ASSERT_TRUE(editor.Execute());
+        EXPECT_EQ(static_cast<ProductNode *>(editor.GetNode(1))->processCount, 1);
+    }
+
+    Nodes::NodeEditor editor;
+    const auto store = std::make_shared<Nodes::PersistentOutputStore>(testDir, 1 << 20);
+    EXPECT_EQ(store->GetEntryCount(), 1u);
+    editor.GetOutputCache().SetPersistentStore(store);
+    editor.AddNode(std::make_unique<ProductNode>(1, "Product"));
+    ASSERT_TRUE(editor.Execute());
+
+    const auto &node = *static_cast<ProductNode *>(editor.GetNode(1));
+    EXPECT_EQ(node.processCount, 0);
+    EXPECT_DOUBLE_EQ(node.GetOutputSlot("Output").GetData<double>().value_or(0.0), 8.0);
+    EXPECT_EQ(editor.GetOutputCache().GetStatistics().persistentHits, 1u);
+
+    // A changed parameter is a different key, so the node runs again
+    editor.GetNode(1)->SetInputSlotDefault("Factor", 3.0);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(node.processCount, 1);
+    EXPECT_EQ(store->GetEntryCount(), 2u);
+}
+
+TEST_F(PersistentOutputStoreTest, RoundTripsEveryValueType)
+{
+    Nodes::PersistentOutputStore store(testDir, 1 << 20);
+    const cv::Mat floats(3, 5, CV_32FC3, cv::Scalar(7));
+    const cv::Mat wide(10, 10, CV_8UC1, cv::Scalar(9));
+    const cv::Mat region = wide(cv::Rect(2, 3, 4, 5)); // Not continuous
+
+    const Outputs outputs{ Share(floats),
+        Share(region),
+        Share(2.5),
+        Share(0.5f),
+        Share(42),
+        Share(true),
+        Share(std::string("label")),
+        Share(std::filesystem::path("images/out.png")),
+        Share(std::vector<cv::Point>{ { 1, -2 }, { 3, 4 } }),
+        nullptr };
+    ASSERT_TRUE(store.Save(7, outputs));
+
+    const auto loaded = store.Load(7);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), outputs.size());
+    EXPECT_TRUE(SamePixels(std::get<cv::Mat>(*(*loaded)[0]), floats));
+    EXPECT_TRUE(SamePixels(std::get<cv::Mat>(*(*loaded)[1]), region));
+    EXPECT_EQ(std::get<double>(*(*loaded)[2]), 2.5);
+    EXPECT_EQ(std::get<float>(*(*loaded)[3]), 0.5f);
+    EXPECT_EQ(std::get<int>(*(*loaded)[4]), 42);
+    EXPECT_EQ(std::get<bool>(*(*loaded)[5]), true);
+    EXPECT_EQ(std::get<std::string>(*(*loaded)[6]), "label");
+    EXPECT_EQ(std::get<std::filesystem::path>(*(*loaded)[7]), std::filesystem::path("images/out.png"));
+    EXPECT_EQ(std::get<std::vector<cv::Point>>(*(*loaded)[8]), (std::vector<cv::Point>{ { 1, -2 }, { 3, 4 } }));
+    EXPECT_TRUE(std::holds_alternative<std::monostate>(*(*loaded)[9]));
+
+    EXPECT_FALSE(store.Load(8).has_value());
+    EXPECT_EQ(store.GetStatistics().hits, 1u);
+    EXPECT_EQ(store.GetStatistics().misses, 1u);
+}
+
+TEST_F(PersistentOutputStoreTest, EvictsLeastRecentlyUsedFilesBeyondBudget)
+{
+    const Outputs image{ Share(cv::Mat(32, 32, CV_8UC1, cv::Scalar(1))) };
+    {
+        // Room for two 1 KB entries plus headers, not three
+        Nodes::PersistentOutputStore store(testDir, 2500);
+        ASSERT_TRUE(store.Save(1, image));
+        ASSERT_TRUE(store.Save(2, image));
+        ASSERT_TRUE(store.Load(1).has_value()); // Entry 2 is now the oldest
+        ASSERT_TRUE(store.Save(3, image));
+
+        EXPECT_EQ(store.GetEntryCount(), 2u);
+        EXPECT_EQ(store.GetStatistics().evictions, 1u);
+        EXPECT_FALSE(store.Load(2).has_value());
+        EXPECT_LE(store.GetUsedBytes(), store.GetByteBudget());
+    }
+
+    // Reopening indexes the surviving files
+    Nodes::PersistentOutputStore reopened(testDir, 2500);
+    EXPECT_EQ(reopened.GetEntryCount(), 2u);
+    EXPECT_TRUE(reopened.Load(1).has_value());
+    EXPECT_TRUE(reopened.Load(3).has_value());
+
+    // Results larger than the whole budget are not written
+    EXPECT_FALSE(reopened.Save(4, { Share(cv::Mat(64, 64, CV_8UC1, cv::Scalar(1))) }));
+}
+
+TEST_F(PersistentOutputStoreTest, CorruptEntryIsDiscarded)
+{
+    Nodes::PersistentOutputStore store(testDir, 1 << 20);
+    ASSERT_TRUE(store.Save(5, { Share(cv::Mat(8, 8, CV_8UC1, cv::Scalar(3))) }));
+    ASSERT_EQ(store.GetEntryCount(), 1u);
+
+    const auto file = std::filesystem::directory_iterator(testDir)->path();
+    std::filesystem::resize_file(file, std::filesystem::file_size(file) - 1);
+
+    EXPECT_FALSE(store.Load(5).has_value());
+    EXPECT_EQ(store.GetStatistics().failures, 1u);
+    EXPECT_EQ(store.GetEntryCount(), 0u);
+    EXPECT_FALSE(std::filesystem::exists(file));
+}
+
+TEST_F(PersistentOutputStoreTest, PathFingerprintFollowsFileContents)
+{
+    std::filesystem::create_directories(testDir);
+    const auto path = testDir / "input.txt";
+    const Nodes::NodeData data = path;
+    const auto missing = Nodes::NodeOutputCache::Fingerprint(data);
+
+    std::ofstream(path) << "first";
+    const auto written = Nodes::NodeOutputCache::Fingerprint(data);
+    EXPECT_NE(written, missing);
+    EXPECT_EQ(Nodes::NodeOutputCache::Fingerprint(data), written);
+
+    std::ofstream(path) << "second version";
+    EXPECT_NE(Nodes::NodeOutputCache::Fingerprint(data), written);
+}
@@ -0,0 +1,111 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "UI/Canvas/CanvasController.h"
+#include "UI/Canvas/ConnectionManager.h"
+#include "UI/Canvas/NodeSpatialIndex.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/IO/PreviewNode.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <unordered_map>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Pin centres of a node without execution pins, relative to its top-left corner at zoom 1
+    constexpr float kFirstPinY = Constants::Node::kTitleHeight + Constants::Node::kPadding
+                                 + Constants::Pin::kCompactHeight * 0.5f;
+    constexpr float kInputPinX = Constants::Node::kPadding;
+    constexpr float kOutputPinX = Constants::Node::kWidth - Constants::Node::kPadding;
+} // namespace
+
+class PinHitTestingTest : public ::testing::Test
+{
+protected:
+    void Place(Nodes::NodeId id, const ImVec2 &position)
+    {
+        nodePositions[id] = { position.x, position.y };
+        nodeIndex.Update(id, position, ImVec2(Constants::Node::kWidth, Constants::Node::kMinHeight * 2.0f));
+    }
+
+    [[nodiscard]] UI::Widgets::PinId PinAtWorld(const ImVec2 &worldPos) const
+    {
+        return connectionManager.FindPinAtPosition(
+            canvas.WorldToScreen(worldPos), nodeEditor, nodePositions, nodeIndex, canvas);
+    }
+
+    Nodes::NodeEditor nodeEditor;
+    UI::Canvas::CanvasController canvas;
+    UI::Canvas::ConnectionManager connectionManager;
+    UI::Canvas::NodeSpatialIndex nodeIndex;
+    std::unordered_map<Nodes::NodeId, UI::Widgets::NodePosition> nodePositions;
+};
+
+TEST_F(PinHitTestingTest, FindsPinsOfIndexedNodes)
+{
+    nodeEditor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(1));
+    Place(1, ImVec2(100.0f, 100.0f));
+
+    const auto input = PinAtWorld(ImVec2(100.0f + kInputPinX, 100.0f + kFirstPinY));
+    EXPECT_EQ(input.nodeId, 1);
+    EXPECT_EQ(input.pinName, "Input");
+
+    const auto output = PinAtWorld(ImVec2(100.0f + kOutputPinX, 100.0f + kFirstPinY));
+    EXPECT_EQ(output.nodeId, 1);
+    EXPECT_EQ(output.pinName, "Output");
+
+    EXPECT_EQ(PinAtWorld(ImVec2(200.0f, 160.0f)).nodeId, Constants::Special::kInvalidNodeId);
+    EXPECT_EQ(PinAtWorld(ImVec2(2000.0f, 2000.0f)).nodeId, Constants::Special::kInvalidNodeId);
+}
+
+TEST_F(PinHitTestingTest, CachedLayoutFollowsZoom)
+{
+    nodeEditor.AddNode(std::make_unique<Vision::IO::PreviewNode>(1));
+    Place(1, ImVec2(50.0f, 50.0f));
+    const ImVec2 outputWorld(50.0f + kOutputPinX, 50.0f + kFirstPinY);
+
+    EXPECT_EQ(PinAtWorld(outputWorld).pinName, "Output");
+
+    canvas.SetZoomLevel(2.0f);
+    EXPECT_EQ(PinAtWorld(outputWorld).pinName, "Output");
+
+    const auto screenPos = connectionManager.GetPinWorldPosition({ 1, "Output" }, nodeEditor, nodePositions, canvas);
+    const auto expected = canvas.WorldToScreen(outputWorld);
+    EXPECT_FLOAT_EQ(screenPos.x, expected.x);
+    EXPECT_FLOAT_EQ(screenPos.y, expected.y);
+}
+
+TEST_F(PinHitTestingTest, ReusedNodeIdGetsFreshLayoutAfterInvalidation)
+{
+    nodeEditor.AddNode(std::make_unique<Vision::IO::PreviewNode>(1));
+    Place(1, ImVec2(0.0f, 0.0f));
+    EXPECT_EQ(PinAtWorld(ImVec2(kInputPinX, kFirstPinY)).pinName, "Input");
+
+    // Second Grayscale input ("Method") sits below the compact "Input" row and has an input widget
+    const float methodY = kFirstPinY + Constants::Pin::kCompactHeight * 0.5f + Constants::Pin::kCompactSpacing
+                          + Constants::Pin::kHeight * 0.5f;
+
+    ASSERT_TRUE(nodeEditor.RemoveNode(1));
+    nodeEditor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(1));
+    connectionManager.InvalidatePinLayout(1);
+
+    const auto method = PinAtWorld(ImVec2(kInputPinX, methodY));
+    EXPECT_EQ(method.nodeId, 1);
+    EXPECT_EQ(method.pinName, "Method");
+}
+
+TEST_F(PinHitTestingTest, OverviewZoomHidesPins)
+{
+    nodeEditor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(1));
+    Place(1, ImVec2(0.0f, 0.0f));
+    const ImVec2 inputWorld(kInputPinX, kFirstPinY);
+
+    canvas.SetZoomLevel(Constants::Zoom::kMinForDetail * 0.5f);
+    EXPECT_FALSE(canvas.IsDetailVisible());
+    EXPECT_EQ(PinAtWorld(inputWorld).nodeId, Constants::Special::kInvalidNodeId);
+
+    canvas.SetZoomLevel(Constants::Zoom::kMinForDetail);
+    EXPECT_TRUE(canvas.IsDetailVisible());
+    EXPECT_EQ(PinAtWorld(inputWorld).pinName, "Input");
+}
@@ -0,0 +1,190 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/PipelineCompiler.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+#include "Vision/IO/PreviewNode.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Passes its input through, but has no compiled form
+    class OpaqueNode : public Nodes::Node
+    {
+    public:
+        explicit OpaqueNode(Nodes::NodeId id) : Nodes::Node(id, "Opaque")
+        {
+            CreateInputSlot("Input").SetDataType(Nodes::SlotDataType::Image);
+            CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Image);
+        }
+
+        std::string GetType() const override
+        {
+            return "OpaqueNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", GetInputSlot("Input").GetData());
+        }
+    };
+
+    // Outputs a fixed double
+    class ValueNode : public Nodes::Node
+    {
+    public:
+        explicit ValueNode(Nodes::NodeId id) : Nodes::Node(id, "Value")
+        {
+            CreateOutputSlot("Output").SetDataType(Nodes::SlotDataType::Double);
+        }
+
+        std::string GetType() const override
+        {
+            return "ValueNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", 42.0);
+        }
+    };
+
+    // Image Input (1) -> Grayscale (2) -> Threshold (3) -> Image Output (4)
+    void BuildThresholdGraph(Nodes::NodeEditor &editor)
+    {
+        editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+        editor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(2));
+        auto threshold = std::make_unique<Vision::Algorithms::ThresholdNode>(3);
+        threshold->SetInputSlotData("Threshold", 90.0);
+        editor.AddNode(std::move(threshold));
+        editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(4));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(3, "Output", 4, "Input");
+    }
+
+    bool Contains(const std::string &text, const std::string &part)
+    {
+        return text.find(part) != std::string::npos;
+    }
+} // namespace
+
+TEST(PipelineCompilerTest, CompilesAndFusesPointwiseRun)
+{
+    Nodes::NodeEditor editor;
+    BuildThresholdGraph(editor);
+
+    std::string error;
+    const auto pipeline = Nodes::PipelineCompiler::Compile(editor, { .name = "Edge Mask" }, error);
+    ASSERT_TRUE(pipeline.has_value()) << error;
+    EXPECT_EQ(pipeline->name, "edgeMask");
+    EXPECT_EQ(pipeline->nodes, (std::vector<Nodes::NodeId>{ 1, 2, 3, 4 }));
+    EXPECT_TRUE(pipeline->skipped.empty());
+    EXPECT_EQ(pipeline->fusedChains, 1u);
+
+    EXPECT_TRUE(Contains(pipeline->header, "namespace edgeMask"));
+    EXPECT_TRUE(Contains(pipeline->header, "cv::Mat imageInput;"));
+    EXPECT_TRUE(Contains(pipeline->header, "cv::Mat imageOutput;"));
+    EXPECT_TRUE(Contains(pipeline->source, "constexpr double kNode3Threshold = 90.0;"));
+    EXPECT_TRUE(Contains(pipeline->source, "cv::threshold("));
+    EXPECT_TRUE(Contains(pipeline->source, "StripRows("));
+    EXPECT_TRUE(Contains(pipeline->source, "outputs.imageOutput = "));
+    EXPECT_FALSE(Contains(pipeline->source, "Nodes::"));
+    EXPECT_TRUE(Contains(pipeline->cmakeLists, "add_library(edgeMask STATIC edgeMask.cpp)"));
+}
+
+TEST(PipelineCompilerTest, UnfusedPipelineHasNoStripLoop)
+{
+    Nodes::NodeEditor editor;
+    BuildThresholdGraph(editor);
+
+    std::string error;
+    const auto pipeline = Nodes::PipelineCompiler::Compile(editor, { .fusePointwise = false }, error);
+    ASSERT_TRUE(pipeline.has_value()) << error;
+    EXPECT_EQ(pipeline->fusedChains, 0u);
+    EXPECT_FALSE(Contains(pipeline->source, "StripRows"));
+    EXPECT_TRUE(Contains(pipeline->source, "cv::threshold(ToGray("));
+}
+
+TEST(PipelineCompilerTest, SkipsNodesNoOutputDependsOn)
+{
+    Nodes::NodeEditor editor;
+    BuildThresholdGraph(editor);
+    editor.AddNode(std::make_unique<Vision::IO::PreviewNode>(5));
+    editor.AddConnection(2, "Output", 5, "Input");
+
+    std::string error;
+    const auto pipeline = Nodes::PipelineCompiler::Compile(editor, {}, error);
+    ASSERT_TRUE(pipeline.has_value()) << error;
+    EXPECT_EQ(pipeline->skipped, (std::vector<Nodes::NodeId>{ 5 }));
+    // The left-out preview does not keep Grayscale's output from being fused away
+    EXPECT_EQ(pipeline->fusedChains, 1u);
+}
+
+TEST(PipelineCompilerTest, RejectsNodesWithoutCompiledForm)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+    editor.AddNode(std::make_unique<OpaqueNode>(2));
+    editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(3));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(2, "Output", 3, "Input");
+
+    std::string error;
+    EXPECT_FALSE(Nodes::PipelineCompiler::Compile(editor, {}, error).has_value());
+    EXPECT_TRUE(Contains(error, "Opaque")) << error;
+}
+
+TEST(PipelineCompilerTest, RejectsConnectedParameters)
+{
+    Nodes::NodeEditor editor;
+    BuildThresholdGraph(editor);
+    editor.AddNode(std::make_unique<ValueNode>(5));
+    editor.AddConnection(5, "Output", 3, "Threshold");
+
+    std::string error;
+    EXPECT_FALSE(Nodes::PipelineCompiler::Compile(editor, {}, error).has_value());
+    EXPECT_TRUE(Contains(error, "'Threshold'")) << error;
+}
+
+TEST(PipelineCompilerTest, RejectsGraphWithoutOutput)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+
+    std::string error;
+    EXPECT_FALSE(Nodes::PipelineCompiler::Compile(editor, {}, error).has_value());
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(PipelineCompilerTest, WritesLibraryFiles)
+{
+    Nodes::NodeEditor editor;
+    BuildThresholdGraph(editor);
+    std::string error;
+    const auto pipeline = Nodes::PipelineCompiler::Compile(editor, { .name = "mask" }, error);
+    ASSERT_TRUE(pipeline.has_value()) << error;
+
+    const auto directory = std::filesystem::temp_directory_path() / "visioncraft_pipeline_compiler_test";
+    std::filesystem::remove_all(directory);
+    ASSERT_TRUE(Nodes::PipelineCompiler::WriteFiles(*pipeline, directory / "out", error)) << error;
+    EXPECT_TRUE(std::filesystem::exists(directory / "out" / "mask.h"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "out" / "mask.cpp"));
+    EXPECT_TRUE(std::filesystem::exists(directory / "out" / "CMakeLists.txt"));
+    std::filesystem::remove_all(directory);
+}
+
+TEST(PipelineCompilerTest, MakesIdentifiers)
+{
+    EXPECT_EQ(Nodes::PipelineCompiler::MakeIdentifier("Image Input"), "imageInput");
+    EXPECT_EQ(Nodes::PipelineCompiler::MakeIdentifier("3d scan"), "n3dScan");
+    EXPECT_EQ(Nodes::PipelineCompiler::MakeIdentifier("--"), "node");
+}
@@ -0,0 +1,227 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/PlanarImage.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/Algorithms/MergeChannelsNode.h"
+#include "Vision/Algorithms/SplitChannelsNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::SourceNode;
+
+namespace
+{
+    // Records the layout each image arrives in and passes it on
+    class LayoutProbe : public Nodes::Node
+    {
+    public:
+        LayoutProbe(Nodes::NodeId id, Nodes::ImageLayout layout) : Nodes::Node(id, "Probe"), layout(layout)
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "LayoutProbe";
+        }
+
+        Nodes::ImageLayout GetPreferredImageLayout() const override
+        {
+            return layout;
+        }
+
+        void Process() override
+        {
+            const auto input = GetInputSlot("Input").GetResolvedSharedData();
+            receivedPlanar = input && std::holds_alternative<Nodes::PlanarImage>(*input);
+            if (input)
+            {
+                SetOutputSlotData("Output", *input);
+            }
+        }
+
+        bool receivedPlanar = false;
+
+    private:
+        Nodes::ImageLayout layout;
+    };
+
+    cv::Mat MakeImage()
+    {
+        cv::Mat image(6, 8, CV_8UC3);
+        for (int y = 0; y < image.rows; ++y)
+        {
+            auto *pixel = image.ptr<uchar>(y);
+            for (int x = 0; x < image.cols * 3; ++x)
+            {
+                pixel[x] = static_cast<uchar>(y * 40 + x);
+            }
+        }
+        return image;
+    }
+
+    bool SameContent(const cv::Mat &a, const cv::Mat &b)
+    {
+        if (a.size() != b.size() || a.type() != b.type())
+        {
+            return false;
+        }
+        const size_t rowBytes = static_cast<size_t>(a.cols) * a.elemSize();
+        for (int y = 0; y < a.rows; ++y)
+        {
+            if (std::memcmp(a.ptr(y), b.ptr(y), rowBytes) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+TEST(PlanarImageTest, RoundTripsThroughInterleavedLayout)
+{
+    const cv::Mat image = MakeImage();
+    const auto planar = Nodes::PlanarImage::FromInterleaved(image);
+    ASSERT_EQ(planar.GetChannelCount(), 3);
+    EXPECT_EQ(planar.GetSize(), image.size());
+    EXPECT_EQ(planar.GetByteSize(), image.total() * image.elemSize());
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        const cv::Mat &plane = planar.GetPlane(channel);
+        EXPECT_TRUE(plane.isContinuous());
+        EXPECT_EQ(plane.type(), CV_8UC1);
+        EXPECT_EQ(plane.at<uchar>(2, 5), image.ptr<uchar>(2)[5 * 3 + channel]);
+    }
+    EXPECT_TRUE(SameContent(planar.ToInterleaved(), image));
+
+    // Single-channel images are already planar
+    const cv::Mat gray(4, 4, CV_8UC1, cv::Scalar(9));
+    EXPECT_EQ(Nodes::PlanarImage::FromInterleaved(gray).GetPlane(0).data, gray.data);
+    EXPECT_EQ(Nodes::PlanarImage({ gray }).ToInterleaved().data, gray.data);
+}
+
+TEST(PlanarImageTest, ValidatesAndCompactsPlanes)
+{
+    const cv::Mat plane(4, 4, CV_8UC1, cv::Scalar(1));
+    EXPECT_THROW(Nodes::PlanarImage({ plane, cv::Mat(4, 5, CV_8UC1) }), std::invalid_argument);
+    EXPECT_THROW(Nodes::PlanarImage({ plane, cv::Mat(4, 4, CV_16UC1) }), std::invalid_argument);
+    EXPECT_THROW(Nodes::PlanarImage({ cv::Mat(4, 4, CV_8UC3) }), std::invalid_argument);
+
+    const cv::Mat wide(4, 8, CV_8UC1, cv::Scalar(2));
+    const cv::Mat roi = wide(cv::Rect(2, 0, 4, 4));
+    ASSERT_FALSE(roi.isContinuous());
+    const Nodes::PlanarImage image({ plane, roi });
+    EXPECT_TRUE(image.GetPlane(1).isContinuous());
+    EXPECT_EQ(image.GetPlane(0).data, plane.data); // Continuous planes are shared
+
+    const auto copy = image.Clone();
+    EXPECT_NE(copy.GetPlane(0).data, plane.data);
+    EXPECT_EQ(Nodes::NodeOutputCache::Fingerprint(copy), Nodes::NodeOutputCache::Fingerprint(image));
+    EXPECT_EQ(Nodes::NodeOutputCache::EstimateBytes(image), 32u);
+}
+
+TEST(PlanarImageTest, EditorConvertsOnlyAtLayoutBoundaries)
+{
+    // Source (interleaved) -> planar probe -> any-layout probe -> interleaved probe
+    const cv::Mat image = MakeImage();
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    editor.AddNode(std::make_unique<LayoutProbe>(2, Nodes::ImageLayout::Planar));
+    editor.AddNode(std::make_unique<LayoutProbe>(3, Nodes::ImageLayout::Any));
+    editor.AddNode(std::make_unique<LayoutProbe>(4, Nodes::ImageLayout::Interleaved));
+    for (Nodes::NodeId id = 1; id < 4; ++id)
+    {
+        Link(editor, id, id + 1);
+    }
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_TRUE(static_cast<LayoutProbe *>(editor.GetNode(2))->receivedPlanar);
+    EXPECT_TRUE(static_cast<LayoutProbe *>(editor.GetNode(3))->receivedPlanar);
+    EXPECT_FALSE(static_cast<LayoutProbe *>(editor.GetNode(4))->receivedPlanar);
+
+    const auto output = editor.GetNode(4)->GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(output.has_value());
+    EXPECT_TRUE(SameContent(*output, image));
+}
+
+TEST(PlanarImageTest, SplitAndMergeShareDataWhenPlanar)
+{
+    const auto planar = Nodes::PlanarImage::FromInterleaved(MakeImage());
+
+    Vision::Algorithms::SplitChannelsNode split(1);
+    split.SetInputSlotData("Input", planar);
+    split.Process();
+    const auto green = split.GetOutputSlot("Channel 2").GetData<cv::Mat>();
+    ASSERT_TRUE(green.has_value());
+    EXPECT_EQ(green->data, planar.GetPlane(1).data);
+
+    Vision::Algorithms::MergeChannelsNode merge(2);
+    merge.SetInputSlotData("Channel 1", planar.GetPlane(2));
+    merge.SetInputSlotData("Channel 2", *green);
+    merge.SetInputSlotData("Channel 3", Nodes::ChannelView{ .source = MakeImage(), .channel = 0 });
+    merge.SetInputSlotDefault("Layout", std::string("Planar"));
+    merge.Process();
+
+    const auto merged = merge.GetOutputSlot("Output").GetData<Nodes::PlanarImage>();
+    ASSERT_TRUE(merged.has_value());
+    ASSERT_EQ(merged->GetChannelCount(), 3);
+    EXPECT_EQ(merged->GetPlane(0).data, planar.GetPlane(2).data);
+    EXPECT_EQ(merged->GetPlane(1).data, planar.GetPlane(1).data);
+    EXPECT_TRUE(SameContent(merged->GetPlane(2), planar.GetPlane(0)));
+
+    // A planar input contributes all of its planes to an interleaved merge
+    Vision::Algorithms::MergeChannelsNode interleave(3);
+    interleave.SetInputSlotData("Channel 1", planar);
+    interleave.Process();
+    const auto interleaved = interleave.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(interleaved.has_value());
+    EXPECT_TRUE(SameContent(*interleaved, MakeImage()));
+}
+
+TEST(PlanarImageTest, GrayscaleMatchesInterleavedConversion)
+{
+    const cv::Mat image = MakeImage();
+
+    Vision::Algorithms::GrayscaleNode interleaved(1);
+    interleaved.SetInputSlotData("Input", image);
+    interleaved.Process();
+    const auto expected = interleaved.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(expected.has_value());
+
+    Vision::Algorithms::GrayscaleNode planar(2);
+    planar.SetInputSlotData("Input", Nodes::PlanarImage::FromInterleaved(image));
+    planar.Process();
+    const auto gray = planar.GetOutputSlot("Output").GetData<cv::Mat>();
+    ASSERT_TRUE(gray.has_value());
+    ASSERT_EQ(gray->type(), CV_8UC1);
+    for (int y = 0; y < gray->rows; ++y)
+    {
+        for (int x = 0; x < gray->cols; ++x)
+        {
+            EXPECT_NEAR(gray->at<uchar>(y, x), expected->at<uchar>(y, x), 1) << "at " << x << "," << y;
+        }
+    }
+
+    // Alpha stays a shared plane
+    cv::Mat alpha(image.size(), CV_8UC1, cv::Scalar(77));
+    auto planes = Nodes::PlanarImage::FromInterleaved(image).GetPlanes();
+    planes.push_back(alpha);
+    planar.SetInputSlotData("Input", Nodes::PlanarImage(std::move(planes)));
+    planar.SetInputSlotDefault("PreserveAlpha", true);
+    planar.Process();
+    const auto withAlpha = planar.GetOutputSlot("Output").GetData<Nodes::PlanarImage>();
+    ASSERT_TRUE(withAlpha.has_value());
+    ASSERT_EQ(withAlpha->GetChannelCount(), 2);
+    EXPECT_EQ(withAlpha->GetPlane(1).data, alpha.data);
+}
@@ -0,0 +1,115 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/PrecisionPolicy.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/GradientNode.h"
+#include "Vision/Algorithms/SobelNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::OutputOf;
+using Tests::SourceNode;
+
+namespace
+{
+    cv::Mat MakeImage(int rows, int cols)
+    {
+        cv::Mat image(rows, cols, CV_8UC1);
+        cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(255));
+        return image;
+    }
+} // namespace
+
+TEST(PrecisionPolicyTest, NamesRoundTrip)
+{
+    for (const auto policy : { Nodes::PrecisionPolicy::Native,
+             Nodes::PrecisionPolicy::Prefer8U,
+             Nodes::PrecisionPolicy::Prefer16,
+             Nodes::PrecisionPolicy::Float32 })
+    {
+        EXPECT_EQ(Nodes::ParsePrecisionPolicy(Nodes::GetPrecisionPolicyName(policy)), policy);
+    }
+    EXPECT_FALSE(Nodes::ParsePrecisionPolicy("half").has_value());
+    EXPECT_EQ(Nodes::GetFloatStorageDepth(Nodes::PrecisionPolicy::Prefer16), CV_16F);
+    EXPECT_EQ(Nodes::GetFloatStorageDepth(Nodes::PrecisionPolicy::Native), CV_32F);
+}
+
+TEST(PrecisionPolicyTest, SobelWritesThePolicyDepth)
+{
+    const cv::Mat image = MakeImage(32, 40);
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    editor.AddNode(std::make_unique<Vision::Algorithms::SobelNode>(2));
+    Link(editor, 1, 2);
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(OutputOf(editor, 2));
+    EXPECT_EQ(OutputOf(editor, 2)->type(), CV_8UC1);
+
+    // Switching the policy re-runs the node even though no input changed
+    editor.SetPrecisionPolicy(Nodes::PrecisionPolicy::Prefer16);
+    ASSERT_TRUE(editor.Execute());
+    cv::Mat expected;
+    cv::Sobel(image, expected, CV_16S, 1, 1, 3);
+    const auto signedOutput = OutputOf(editor, 2);
+    ASSERT_TRUE(signedOutput);
+    ASSERT_EQ(signedOutput->type(), CV_16SC1);
+    EXPECT_EQ(cv::norm(*signedOutput, expected, cv::NORM_INF), 0.0);
+    EXPECT_EQ(editor.GetNode(2)->InferOutputShape(Nodes::ImageShape{ .size = image.size(), .type = CV_8UC1 })->type,
+        CV_16SC1);
+
+    editor.SetPrecisionPolicy(Nodes::PrecisionPolicy::Float32);
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(OutputOf(editor, 2));
+    EXPECT_EQ(OutputOf(editor, 2)->type(), CV_32FC1);
+
+    // The cached 8-bit result is restored, not one of another depth
+    editor.SetPrecisionPolicy(Nodes::PrecisionPolicy::Native);
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(OutputOf(editor, 2));
+    EXPECT_EQ(OutputOf(editor, 2)->type(), CV_8UC1);
+}
+
+TEST(PrecisionPolicyTest, HalfFloatMagnitudeIsWidenedForOtherNodes)
+{
+    const cv::Mat image = MakeImage(24, 24);
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    auto gradient = std::make_unique<Vision::Algorithms::GradientNode>(2);
+    gradient->SetInputSlotData("OutputComponents", true);
+    editor.AddNode(std::move(gradient));
+    editor.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(3));
+    Link(editor, 1, 2);
+    editor.AddConnection(2, "Magnitude", 3, "Input");
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(OutputOf(editor, 2, "Magnitude"));
+    const cv::Mat reference = OutputOf(editor, 2, "Magnitude")->clone();
+    ASSERT_EQ(reference.type(), CV_32FC1);
+
+    editor.SetPrecisionPolicy(Nodes::PrecisionPolicy::Prefer16);
+    ASSERT_TRUE(editor.Execute());
+    const auto half = OutputOf(editor, 2, "Magnitude");
+    ASSERT_TRUE(half);
+    ASSERT_EQ(half->type(), CV_16FC1);
+    cv::Mat widened;
+    half->convertTo(widened, CV_32F);
+    EXPECT_LE(cv::norm(widened, reference, cv::NORM_INF), 1.0); // 11-bit mantissa over magnitudes below 2048
+    ASSERT_TRUE(OutputOf(editor, 2, "Gx"));
+    EXPECT_EQ(OutputOf(editor, 2, "Gx")->type(), CV_16SC1); // Exact for 8-bit input
+    ASSERT_TRUE(OutputOf(editor, 3));
+    EXPECT_EQ(OutputOf(editor, 3)->type(), CV_32FC1); // Threshold read the magnitude widened
+
+    editor.SetPrecisionPolicy(Nodes::PrecisionPolicy::Prefer8U);
+    ASSERT_TRUE(editor.Execute());
+    cv::Mat saturated;
+    reference.convertTo(saturated, CV_8U);
+    ASSERT_TRUE(OutputOf(editor, 2, "Magnitude"));
+    EXPECT_EQ(cv::norm(*OutputOf(editor, 2, "Magnitude"), saturated, cv::NORM_INF), 0.0);
+}
@@ -0,0 +1,126 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/ProgressChannel.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds one to its input and records the progress visible while it runs
+    class ProgressReadingNode : public Nodes::Node
+    {
+    public:
+        ProgressReadingNode(Nodes::NodeId id, const Nodes::ProgressChannel &channel)
+            : Nodes::Node(id, "ProgressReading"), channel(channel)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ProgressReadingNode";
+        }
+
+        void Process() override
+        {
+            seen = channel.Read();
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        const Nodes::ProgressChannel &channel;
+        Nodes::ProgressChannel::Sample seen;
+    };
+
+    constexpr int kPublishers = 8;
+    constexpr int kAdvancesPerPublisher = 1000;
+} // namespace
+
+TEST(ProgressChannelTest, CountsConcurrentPublishers)
+{
+    Nodes::ProgressChannel channel;
+    EXPECT_EQ(channel.Read().total, 0);
+
+    channel.BeginRun(kPublishers * kAdvancesPerPublisher);
+    {
+        std::vector<std::jthread> publishers;
+        for (int i = 0; i < kPublishers; ++i)
+        {
+            publishers.emplace_back([&channel, i]() {
+                for (int j = 0; j < kAdvancesPerPublisher; ++j)
+                {
+                    channel.Advance(i + 1);
+                }
+            });
+        }
+    }
+
+    const auto sample = channel.Read();
+    EXPECT_EQ(sample.started, kPublishers * kAdvancesPerPublisher);
+    EXPECT_EQ(sample.total, kPublishers * kAdvancesPerPublisher);
+    EXPECT_GE(sample.node, 1);
+    EXPECT_LE(sample.node, kPublishers);
+
+    channel.BeginRun(3);
+    EXPECT_EQ(channel.Read().started, 0);
+    EXPECT_EQ(channel.Read().node, 0);
+}
+
+class ProgressChannelRunTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds the chain 1 -> 2 -> 3, so every mode starts the nodes in ID order
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        for (Nodes::NodeId id = 1; id <= 3; ++id)
+        {
+            editor.AddNode(std::make_unique<ProgressReadingNode>(id, editor.GetProgressChannel()));
+        }
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+    }
+
+    const ProgressReadingNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<const ProgressReadingNode *>(editor.GetNode(id));
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(ProgressChannelRunTest, PublishesEveryStartedNode)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        EXPECT_EQ(NodeAt(id).seen.started, id);
+        EXPECT_EQ(NodeAt(id).seen.total, 3);
+        EXPECT_EQ(NodeAt(id).seen.node, id);
+    }
+    const auto sample = editor.GetProgressChannel().Read();
+    EXPECT_EQ(sample.started, 3);
+    EXPECT_EQ(sample.node, 3);
+}
+
+TEST_P(ProgressChannelRunTest, EachRunStartsFromZero)
+{
+    ASSERT_TRUE(editor.Execute());
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.ExecuteUpTo(2));
+
+    EXPECT_EQ(NodeAt(1).seen.started, 1);
+    const auto sample = editor.GetProgressChannel().Read();
+    EXPECT_EQ(sample.started, 2);
+    EXPECT_EQ(sample.total, 2);
+    EXPECT_EQ(sample.node, 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    ProgressChannelRunTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
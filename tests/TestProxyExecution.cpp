@@ -0,0 +1,187 @@
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/NodeOutputCache.h"
+#include "Nodes/Core/WriteBehindQueue.h"
+#include "Vision/Algorithms/MedianBlurNode.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/ImageOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <limits>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Records the size of each image it receives and passes it on
+    class ProbeNode : public Nodes::Node
+    {
+    public:
+        explicit ProbeNode(Nodes::NodeId id) : Nodes::Node(id, "Probe")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Input");
+            CreateInputSlot("ksize", 9);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ProbeNode";
+        }
+
+        void Process() override
+        {
+            const auto input = GetInputValue<cv::Mat>("Input");
+            lastSize = input ? input->size() : cv::Size();
+            lastKernelSize = ScaleKernelSize(GetInputValue<int>("ksize").value_or(9), 3);
+            ++processCount;
+            SetOutputSlotData("Output", input ? *input : cv::Mat());
+        }
+
+        using Nodes::Node::ScaleKernelSize;
+
+        cv::Size lastSize;
+        int lastKernelSize = 0;
+        int processCount = 0;
+    };
+
+    // Exposes the kernel size MedianBlurNode passes to OpenCV
+    class MedianProbe : public Vision::Algorithms::MedianBlurNode
+    {
+    public:
+        using Vision::Algorithms::MedianBlurNode::GetKernelSize;
+        using Vision::Algorithms::MedianBlurNode::MedianBlurNode;
+    };
+
+    class ProxyExecutionTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            testDir = std::filesystem::temp_directory_path() / "visioncraft_proxy_test";
+            std::filesystem::remove_all(testDir);
+            std::filesystem::create_directories(testDir);
+            imagePath = testDir / "scan.png";
+            ASSERT_TRUE(cv::imwrite(imagePath.string(), cv::Mat(400, 800, CV_8UC3, cv::Scalar(40, 80, 120))));
+
+            editor.AddNode(std::make_unique<Vision::IO::ImageInputNode>(1));
+            editor.AddNode(std::make_unique<ProbeNode>(2));
+            editor.AddConnection(1, "Output", 2, "Input");
+            editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+            editor.GetNode(1)->SetInputSlotDefault("FilePath", imagePath);
+            probe = static_cast<ProbeNode *>(editor.GetNode(2));
+        }
+
+        void TearDown() override
+        {
+            Nodes::WriteBehindQueue::Get().Flush().wait();
+            std::filesystem::remove_all(testDir);
+        }
+
+        Nodes::NodeEditor editor;
+        ProbeNode *probe = nullptr;
+        std::filesystem::path testDir;
+        std::filesystem::path imagePath;
+    };
+} // namespace
+
+TEST_F(ProxyExecutionTest, SetProxyScaleClampsToValidRange)
+{
+    EXPECT_EQ(editor.GetProxyScale(), 1.0);
+    editor.SetProxyScale(0.0);
+    EXPECT_EQ(editor.GetProxyScale(), Constants::Proxy::kMinScale);
+    editor.SetProxyScale(3.0);
+    EXPECT_EQ(editor.GetProxyScale(), 1.0);
+    editor.SetProxyScale(std::numeric_limits<double>::quiet_NaN());
+    EXPECT_EQ(editor.GetProxyScale(), 1.0);
+}
+
+TEST_F(ProxyExecutionTest, KernelSizesScaleToOddValues)
+{
+    EXPECT_EQ(probe->ScaleKernelSize(9, 3), 9); // Full resolution keeps the size
+
+    probe->SetProxyScale(0.5);
+    EXPECT_EQ(probe->ScaleKernelSize(9, 3), 5);
+    EXPECT_EQ(probe->ScaleKernelSize(15), 7);
+    EXPECT_EQ(probe->ScaleKernelSize(4), 3);
+    probe->SetProxyScale(0.1);
+    EXPECT_EQ(probe->ScaleKernelSize(9, 3), 3);
+    EXPECT_EQ(probe->ScaleKernelSize(9), 1);
+    EXPECT_EQ(probe->ScaleKernelSize(1, 3), 1); // Already below the minimum
+
+    MedianProbe median(5);
+    median.SetInputSlotDefault("ksize", 21);
+    median.SetProxyScale(0.25);
+    EXPECT_EQ(median.GetKernelSize(), 5);
+}
+
+TEST_F(ProxyExecutionTest, ProxyRunsDownscaleSourceImages)
+{
+    editor.SetProxyScale(0.25);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(probe->lastSize, cv::Size(200, 100));
+    EXPECT_EQ(probe->lastKernelSize, 3);
+
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run);
+    EXPECT_EQ(run->proxyScale, 0.25);
+
+    // Clean nodes are skipped at the same scale
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(probe->processCount, 1);
+}
+
+TEST_F(ProxyExecutionTest, FullResolutionRunReRunsEveryNode)
+{
+    editor.SetProxyScale(0.5);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(probe->lastSize, cv::Size(400, 200));
+
+    ASSERT_TRUE(editor.ExecuteFullResolution());
+    EXPECT_EQ(probe->lastSize, cv::Size(800, 400));
+    EXPECT_EQ(probe->lastKernelSize, 9);
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->proxyScale, 1.0);
+
+    // Back at the proxy scale the source re-runs; the probe's proxy result comes from the output cache
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(probe->lastSize, cv::Size(800, 400));
+    EXPECT_EQ(probe->processCount, 2);
+    EXPECT_EQ(editor.GetNode(2)->GetOutputSlot("Output").GetData<cv::Mat>()->size(), cv::Size(400, 200));
+}
+
+TEST_F(ProxyExecutionTest, CacheKeysDependOnProxyScale)
+{
+    probe->SetInputSlotData("Input", cv::Mat(8, 8, CV_8UC1, cv::Scalar(1)));
+    const auto fullKey = Nodes::NodeOutputCache::ComputeKey(*probe);
+    probe->SetProxyScale(0.5);
+    EXPECT_NE(Nodes::NodeOutputCache::ComputeKey(*probe), fullKey);
+    probe->SetProxyScale(1.0);
+    EXPECT_EQ(Nodes::NodeOutputCache::ComputeKey(*probe), fullKey);
+}
+
+TEST_F(ProxyExecutionTest, OnlyFullResolutionRunsSave)
+{
+    const auto savePath = testDir / "result.png";
+    editor.AddNode(std::make_unique<Vision::IO::ImageOutputNode>(3));
+    editor.AddConnection(2, "Output", 3, "Input");
+    editor.AddConnection(2, "Then", 3, "Execute", Nodes::ConnectionType::Execution);
+    auto *output = static_cast<Vision::IO::ImageOutputNode *>(editor.GetNode(3));
+    output->SetInputSlotDefault("SavePath", savePath);
+    output->SetInputSlotDefault("AutoSave", true);
+
+    editor.SetProxyScale(0.25);
+    ASSERT_TRUE(editor.Execute());
+    Nodes::WriteBehindQueue::Get().Flush().wait();
+    EXPECT_FALSE(output->GetPendingSave().valid());
+    EXPECT_FALSE(std::filesystem::exists(savePath));
+
+    ASSERT_TRUE(editor.ExecuteFullResolution());
+    ASSERT_TRUE(output->GetLastSaveStatus());
+    EXPECT_EQ(cv::imread(savePath.string()).size(), cv::Size(800, 400));
+}
@@ -0,0 +1,194 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "gtest/gtest.h"
+
+#include <iterator>
+#include <memory>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Adds one to its input (seeded with the node's default) and counts Process() calls
+    class CountingNode : public Nodes::Node
+    {
+    public:
+        CountingNode(Nodes::NodeId id, bool sink = false) : Nodes::Node(id, "Counting"), sink(sink)
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CountingNode";
+        }
+
+        bool IsSink() const override
+        {
+            return sink;
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+
+        int processCount = 0;
+
+    private:
+        bool sink;
+    };
+
+    // Reads a value and has no outputs, so it can only matter outside the graph
+    class RecordingNode : public Nodes::Node
+    {
+    public:
+        explicit RecordingNode(Nodes::NodeId id) : Nodes::Node(id, "Recording")
+        {
+            CreateInputSlot("Input", 0.0);
+        }
+
+        std::string GetType() const override
+        {
+            return "RecordingNode";
+        }
+
+        void Process() override
+        {
+            recorded = GetInputValue<double>("Input").value_or(0.0);
+        }
+
+        double recorded = 0.0;
+    };
+} // namespace
+
+class PullEvaluationTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    // Builds 1 -> 2 -> 3 (sink) with a dead branch 1 -> 4 and an unconnected node 5
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+        for (Nodes::NodeId id = 1; id <= 5; ++id)
+        {
+            editor.AddNode(std::make_unique<CountingNode>(id, id == 3));
+        }
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(1, "Output", 4, "Input");
+    }
+
+    CountingNode &NodeAt(Nodes::NodeId id)
+    {
+        return *static_cast<CountingNode *>(editor.GetNode(id));
+    }
+
+    std::optional<double> ResultOf(Nodes::NodeId id)
+    {
+        return NodeAt(id).GetOutputSlot("Output").GetData<double>();
+    }
+
+    // Turns the graph into an execution-flow graph running 1 -> 4 -> 2 -> 3 -> 5
+    void AddExecutionFlow()
+    {
+        const Nodes::NodeId flow[] = { 1, 4, 2, 3, 5 };
+        editor.GetNode(1)->CreateExecutionOutputPin("Then");
+        for (size_t i = 1; i < std::size(flow); ++i)
+        {
+            editor.GetNode(flow[i])->CreateExecutionInputPin("Execute");
+            editor.GetNode(flow[i])->CreateExecutionOutputPin("Then");
+            editor.AddConnection(flow[i - 1], "Then", flow[i], "Execute", Nodes::ConnectionType::Execution);
+        }
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(PullEvaluationTest, SkipsNodesNoSinkReads)
+{
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 3.0);
+    for (Nodes::NodeId id = 1; id <= 3; ++id)
+    {
+        EXPECT_EQ(NodeAt(id).processCount, 1) << "node " << id;
+    }
+    EXPECT_EQ(NodeAt(4).processCount, 0);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+    EXPECT_TRUE(NodeAt(4).IsDirty());
+    EXPECT_TRUE(NodeAt(5).IsDirty());
+    EXPECT_EQ(editor.GetExecutionStatistics().GetLatest()->nodes.size(), 3u);
+}
+
+TEST_P(PullEvaluationTest, GraphWithoutSinksRunsInFull)
+{
+    ASSERT_TRUE(editor.RemoveNode(3));
+    ASSERT_TRUE(editor.Execute());
+
+    for (const Nodes::NodeId id : { 1, 2, 4, 5 })
+    {
+        EXPECT_EQ(NodeAt(id).processCount, 1) << "node " << id;
+    }
+}
+
+TEST_P(PullEvaluationTest, NodesWithoutOutputsAreSinks)
+{
+    editor.AddNode(std::make_unique<RecordingNode>(6));
+    editor.AddConnection(4, "Output", 6, "Input");
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(static_cast<RecordingNode *>(editor.GetNode(6))->recorded, 2.0);
+    EXPECT_EQ(NodeAt(3).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+}
+
+TEST_P(PullEvaluationTest, ExplicitOutputsKeepTheirInputs)
+{
+    editor.SetOutputNodes({ 4 });
+    EXPECT_EQ(editor.GetOutputNodes(), std::vector<Nodes::NodeId>{ 4 });
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_DOUBLE_EQ(*ResultOf(4), 2.0);
+    EXPECT_EQ(NodeAt(1).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 0);
+}
+
+TEST_P(PullEvaluationTest, ExecutionFlowGraphsArePrunedOnlyWhenAskedTo)
+{
+    AddExecutionFlow();
+    EXPECT_EQ(editor.GetPullEvaluation(), Nodes::PullEvaluation::DataFlowGraphs);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+
+    editor.SetPullEvaluation(Nodes::PullEvaluation::Always);
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(NodeAt(3).processCount, 2);
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 3.0);
+}
+
+TEST_P(PullEvaluationTest, SkippedNodesCatchUpWhenPruningIsOff)
+{
+    ASSERT_TRUE(editor.Execute());
+    editor.GetNode(1)->SetInputSlotDefault("Input", 10.0);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(3), 13.0);
+    EXPECT_FALSE(ResultOf(4).has_value());
+
+    // The dead branch runs once against the latest upstream results, which are not recomputed
+    editor.SetPullEvaluation(Nodes::PullEvaluation::Off);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(*ResultOf(4), 12.0);
+    EXPECT_EQ(NodeAt(4).processCount, 1);
+    EXPECT_EQ(NodeAt(5).processCount, 1);
+    EXPECT_EQ(NodeAt(1).processCount, 2);
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    PullEvaluationTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
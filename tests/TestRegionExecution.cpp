@@ -0,0 +1,282 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CropNode.h"
+#include "Vision/Algorithms/MedianBlurNode.h"
+#include "Vision/Algorithms/ResizeNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::MakePattern;
+using Tests::OutputOf;
+using Tests::SameImage;
+using Tests::SourceNode;
+
+namespace
+{
+    // Adds one to every pixel, recording how many pixels each call received
+    class CountingNode : public Nodes::Node
+    {
+    public:
+        CountingNode(Nodes::NodeId id, int halo) : Nodes::Node(id, "Counting"), halo(halo)
+        {
+            CreateExecutionInputPin("Execute");
+            CreateExecutionOutputPin("Then");
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CountingNode";
+        }
+
+        void Process() override
+        {
+            const auto input = GetInputValueIf<cv::Mat>("Input");
+            if (!input || input->empty())
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+            SetOutputSlotData("Output", Apply(*input));
+        }
+
+        std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override
+        {
+            if (inputType != CV_8UC1)
+            {
+                return std::nullopt;
+            }
+            return Nodes::TileOperation{ .halo = halo,
+                .outputType = CV_8UC1,
+                .apply = [this](const cv::Mat &tile) { return Apply(tile); } };
+        }
+
+        cv::Mat Apply(const cv::Mat &image) const
+        {
+            lastPixels = image.total();
+            cv::Mat result(image.rows, image.cols, CV_8UC1);
+            for (int r = 0; r < image.rows; ++r)
+            {
+                for (int c = 0; c < image.cols; ++c)
+                {
+                    result.at<uchar>(r, c) = static_cast<uchar>(std::min(image.at<uchar>(r, c) + 1, 255));
+                }
+            }
+            return result;
+        }
+
+        int halo;
+        mutable size_t lastPixels = 0;
+    };
+} // namespace
+
+class RegionExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false);
+    }
+
+    Vision::Algorithms::CropNode &AddCrop(Nodes::NodeId id, int x, int y, int width, int height)
+    {
+        auto crop = std::make_unique<Vision::Algorithms::CropNode>(id);
+        crop->SetInputSlotData("X", x);
+        crop->SetInputSlotData("Y", y);
+        crop->SetInputSlotData("Width", width);
+        crop->SetInputSlotData("Height", height);
+        auto &node = *crop;
+        editor.AddNode(std::move(crop));
+        return node;
+    }
+
+    CountingNode &Counting(Nodes::NodeId id)
+    {
+        return *static_cast<CountingNode *>(editor.GetNode(id));
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(RegionExecutionTest, CropNodeClipsItsRectangleToTheImage)
+{
+    const cv::Mat image = MakePattern(80, 100);
+    Vision::Algorithms::CropNode crop(1);
+    crop.SetInputSlotData("Input", image);
+    crop.SetInputSlotData("X", 90);
+    crop.SetInputSlotData("Y", 70);
+    crop.SetInputSlotData("Width", 20);
+    crop.Process();
+
+    const auto output = crop.GetOutputSlot("Output").GetDataIf<cv::Mat>();
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(*output, image(cv::Rect(90, 70, 10, 10)))); // Height 0 reaches the bottom edge
+
+    crop.SetInputSlotData("X", 120);
+    crop.Process();
+    EXPECT_FALSE(crop.GetOutputSlot("Output").GetDataIf<cv::Mat>());
+}
+
+TEST_P(RegionExecutionTest, ChainComputesOnlyTheCroppedRegion)
+{
+    const cv::Mat image = MakePattern(256, 256);
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    editor.AddNode(std::make_unique<CountingNode>(2, 2));
+    editor.AddNode(std::make_unique<CountingNode>(3, 1));
+    AddCrop(4, 100, 120, 32, 16);
+    Link(editor, 1, 2);
+    Link(editor, 2, 3);
+    Link(editor, 3, 4);
+
+    ASSERT_TRUE(editor.Execute());
+
+    // Each node widens the region by the context of the nodes after it
+    EXPECT_EQ(Counting(2).lastPixels, static_cast<size_t>((32 + 6) * (16 + 6)));
+    EXPECT_EQ(Counting(3).lastPixels, static_cast<size_t>((32 + 2) * (16 + 2)));
+    EXPECT_FALSE(OutputOf(editor, 2));
+    EXPECT_FALSE(OutputOf(editor, 3));
+
+    const auto output = OutputOf(editor, 4);
+    ASSERT_TRUE(output);
+    cv::Mat expected = image(cv::Rect(100, 120, 32, 16)).clone();
+    for (int r = 0; r < expected.rows; ++r)
+    {
+        for (int c = 0; c < expected.cols; ++c)
+        {
+            expected.at<uchar>(r, c) = static_cast<uchar>(std::min(expected.at<uchar>(r, c) + 2, 255));
+        }
+    }
+    EXPECT_TRUE(SameImage(*output, expected));
+}
+
+TEST_P(RegionExecutionTest, MatchesFullFrameResultOfFilterNodes)
+{
+    const cv::Mat image = MakePattern(300, 200);
+    auto build = [&](Nodes::NodeEditor &target) {
+        target.AddNode(std::make_unique<SourceNode>(1, image));
+        auto median = std::make_unique<Vision::Algorithms::MedianBlurNode>(2);
+        median->SetInputSlotData("ksize", 5);
+        target.AddNode(std::move(median));
+        target.AddNode(std::make_unique<Vision::Algorithms::ThresholdNode>(3));
+        auto crop = std::make_unique<Vision::Algorithms::CropNode>(4);
+        crop->SetInputSlotData("X", 150);
+        crop->SetInputSlotData("Y", 10);
+        crop->SetInputSlotData("Width", 64);
+        crop->SetInputSlotData("Height", 64);
+        target.AddNode(std::move(crop));
+        Link(target, 1, 2);
+        Link(target, 2, 3);
+        Link(target, 3, 4);
+    };
+
+    build(editor);
+    Nodes::NodeEditor reference;
+    reference.SetTilingOptions({ .fusePointwise = false, .propagateRegions = false });
+    build(reference);
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(reference.Execute());
+
+    const auto output = OutputOf(editor, 4);
+    const auto expected = OutputOf(reference, 4);
+    ASSERT_TRUE(output);
+    ASSERT_TRUE(expected);
+    EXPECT_TRUE(SameImage(*output, *expected));
+    EXPECT_FALSE(OutputOf(editor, 2));
+    EXPECT_TRUE(OutputOf(reference, 2));
+}
+
+TEST_P(RegionExecutionTest, ResizeScalesTheRegion)
+{
+    const cv::Mat image = MakePattern(200, 160);
+    auto build = [&](Nodes::NodeEditor &target, double scale) {
+        target.AddNode(std::make_unique<SourceNode>(1, image));
+        target.AddNode(std::make_unique<CountingNode>(2, 0));
+        auto resize = std::make_unique<Vision::Algorithms::ResizeNode>(3);
+        resize->SetInputSlotData("ScaleX", scale);
+        resize->SetInputSlotData("ScaleY", scale);
+        target.AddNode(std::move(resize));
+        auto crop = std::make_unique<Vision::Algorithms::CropNode>(4);
+        crop->SetInputSlotData("X", 21);
+        crop->SetInputSlotData("Y", 13);
+        crop->SetInputSlotData("Width", 20);
+        crop->SetInputSlotData("Height", 10);
+        target.AddNode(std::move(crop));
+        Link(target, 1, 2);
+        Link(target, 2, 3);
+        Link(target, 3, 4);
+    };
+
+    build(editor, 0.5);
+    Nodes::NodeEditor reference;
+    reference.SetTilingOptions({ .fusePointwise = false, .propagateRegions = false });
+    build(reference, 0.5);
+
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_TRUE(reference.Execute());
+
+    const auto output = OutputOf(editor, 4);
+    const auto expected = OutputOf(reference, 4);
+    ASSERT_TRUE(output);
+    ASSERT_TRUE(expected);
+    EXPECT_TRUE(SameImage(*output, *expected));
+    EXPECT_LT(Counting(2).lastPixels, image.total() / 4);
+
+    // A scale that is not a power of two needs the whole image
+    editor.Clear();
+    build(editor, 0.3);
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_EQ(Counting(2).lastPixels, image.total());
+    EXPECT_TRUE(OutputOf(editor, 4));
+}
+
+TEST_P(RegionExecutionTest, MovingTheCropRerunsTheChain)
+{
+    const cv::Mat image = MakePattern(128, 128);
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    editor.AddNode(std::make_unique<CountingNode>(2, 1));
+    auto &crop = AddCrop(3, 0, 0, 16, 16);
+    Link(editor, 1, 2);
+    Link(editor, 2, 3);
+    editor.SetIncrementalExecution(true);
+
+    ASSERT_TRUE(editor.Execute());
+    crop.SetInputSlotData("X", 64);
+    crop.MarkDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    const auto output = OutputOf(editor, 3);
+    ASSERT_TRUE(output);
+    EXPECT_EQ(output->at<uchar>(0, 0), static_cast<uchar>(std::min(image.at<uchar>(0, 64) + 1, 255)));
+    EXPECT_EQ(Counting(2).lastPixels, static_cast<size_t>((16 + 2) * (16 + 1)));
+}
+
+TEST_P(RegionExecutionTest, SwitchingRegionsOffRestoresFullOutputs)
+{
+    const cv::Mat image = MakePattern(64, 64);
+    editor.AddNode(std::make_unique<SourceNode>(1, image));
+    editor.AddNode(std::make_unique<CountingNode>(2, 1));
+    AddCrop(3, 8, 8, 8, 8);
+    Link(editor, 1, 2);
+    Link(editor, 2, 3);
+    editor.SetIncrementalExecution(true);
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_FALSE(OutputOf(editor, 2));
+
+    editor.SetTilingOptions({ .fusePointwise = false, .propagateRegions = false });
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_TRUE(OutputOf(editor, 2));
+    EXPECT_EQ(Counting(2).lastPixels, image.total());
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    RegionExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
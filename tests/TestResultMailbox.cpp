@@ -0,0 +1,81 @@
+#include "Nodes/Core/ResultMailbox.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    constexpr int kPublished = 100000;
+} // namespace
+
+TEST(ResultMailboxTest, ReaderTakesOnlyNewResults)
+{
+    Nodes::ResultMailbox<int> mailbox;
+    EXPECT_FALSE(mailbox.HasUpdate());
+    EXPECT_FALSE(mailbox.Refresh());
+    EXPECT_EQ(mailbox.Latest(), 0);
+
+    mailbox.Publish(1);
+    EXPECT_TRUE(mailbox.HasUpdate());
+    EXPECT_TRUE(mailbox.Refresh());
+    EXPECT_EQ(mailbox.Latest(), 1);
+
+    // Nothing new: the reader keeps its value
+    EXPECT_FALSE(mailbox.HasUpdate());
+    EXPECT_FALSE(mailbox.Refresh());
+    EXPECT_EQ(mailbox.Latest(), 1);
+}
+
+TEST(ResultMailboxTest, UntakenResultsAreReplacedByNewerOnes)
+{
+    Nodes::ResultMailbox<int> mailbox;
+    for (int value = 1; value <= 5; ++value)
+    {
+        mailbox.Publish(value);
+    }
+
+    EXPECT_TRUE(mailbox.Refresh());
+    EXPECT_EQ(mailbox.Latest(), 5);
+    EXPECT_FALSE(mailbox.Refresh());
+}
+
+TEST(ResultMailboxTest, DroppedResultsAreReleased)
+{
+    Nodes::ResultMailbox<std::shared_ptr<int>> mailbox;
+    const auto first = std::make_shared<int>(1);
+    const std::weak_ptr<int> watched = first;
+
+    mailbox.Publish(first);
+    mailbox.Publish(std::make_shared<int>(2));
+    mailbox.Publish(std::make_shared<int>(3));
+    EXPECT_EQ(watched.use_count(), 1); // Only the test still holds the overwritten result
+}
+
+TEST(ResultMailboxTest, ReaderSeesIncreasingValuesWhilePublisherRuns)
+{
+    Nodes::ResultMailbox<int> mailbox;
+    std::atomic<bool> done{ false };
+
+    std::jthread publisher([&mailbox, &done]() {
+        for (int value = 1; value <= kPublished; ++value)
+        {
+            mailbox.Publish(value);
+        }
+        done.store(true);
+    });
+
+    int last = 0;
+    while (!done.load() || mailbox.HasUpdate())
+    {
+        if (mailbox.Refresh())
+        {
+            EXPECT_GT(mailbox.Latest(), last);
+            last = mailbox.Latest();
+        }
+    }
+    EXPECT_EQ(last, kPublished);
+}
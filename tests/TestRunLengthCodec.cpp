@@ -0,0 +1,75 @@
+#include "Nodes/Core/RunLengthCodec.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace VisionCraft;
+
+namespace
+{
+    std::vector<std::byte> RoundTrip(const std::vector<std::byte> &input)
+    {
+        const auto encoded = Nodes::RunLength::Encode(input);
+        std::vector<std::byte> decoded(input.size());
+        EXPECT_TRUE(Nodes::RunLength::Decode(encoded, decoded));
+        return decoded;
+    }
+} // namespace
+
+TEST(RunLengthCodecTest, EmptyInputEncodesToNothing)
+{
+    EXPECT_TRUE(Nodes::RunLength::Encode({}).empty());
+    EXPECT_TRUE(Nodes::RunLength::Decode({}, {}));
+}
+
+TEST(RunLengthCodecTest, MaskShrinksToRunBlocks)
+{
+    // One 640-pixel row: 300 background, 40 foreground, 300 background
+    std::vector<std::byte> mask(640, std::byte{ 0 });
+    std::fill(mask.begin() + 300, mask.begin() + 340, std::byte{ 255 });
+
+    const auto encoded = Nodes::RunLength::Encode(mask);
+    EXPECT_EQ(encoded.size(), 14u); // 3 + 1 + 3 run blocks of two bytes each
+    EXPECT_EQ(RoundTrip(mask), mask);
+}
+
+TEST(RunLengthCodecTest, NoiseGrowsByOneBytePerLiteralBlock)
+{
+    std::mt19937 random(7);
+    std::vector<std::byte> noise(1000);
+    for (auto &value : noise)
+    {
+        value = static_cast<std::byte>(random());
+    }
+
+    EXPECT_LE(Nodes::RunLength::Encode(noise).size(), noise.size() + noise.size() / 128 + 1);
+    EXPECT_EQ(RoundTrip(noise), noise);
+}
+
+TEST(RunLengthCodecTest, MixedRunsAndLiteralsRoundTrip)
+{
+    std::mt19937 random(11);
+    std::vector<std::byte> input;
+    for (int block = 0; block < 500; ++block)
+    {
+        const auto value = static_cast<std::byte>(random() % 4);
+        input.insert(input.end(), random() % 200 + 1, value);
+    }
+    EXPECT_EQ(RoundTrip(input), input);
+}
+
+TEST(RunLengthCodecTest, DecodeRejectsMismatchedSizes)
+{
+    const std::vector<std::byte> input(100, std::byte{ 9 });
+    const auto encoded = Nodes::RunLength::Encode(input);
+
+    std::vector<std::byte> tooSmall(99);
+    EXPECT_FALSE(Nodes::RunLength::Decode(encoded, tooSmall));
+    std::vector<std::byte> tooLarge(101);
+    EXPECT_FALSE(Nodes::RunLength::Decode(encoded, tooLarge));
+
+    // A run block without its value byte
+    const std::vector<std::byte> truncated{ std::byte{ 200 } };
+    std::vector<std::byte> output(75);
+    EXPECT_FALSE(Nodes::RunLength::Decode(truncated, output));
+}
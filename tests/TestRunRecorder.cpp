@@ -0,0 +1,134 @@
+#include "Vision/Factory/NodeFactory.h"
+#include "Vision/IO/ImageInputNode.h"
+#include "Vision/IO/RunRecorder.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    std::atomic<int> delayMilliseconds = 0; // How long every DelayNode takes; raised to simulate a regression
+
+    // Passes its input through after sleeping for delayMilliseconds
+    class DelayNode : public Nodes::Node
+    {
+    public:
+        DelayNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "DelayNode";
+        }
+
+        void Process() override
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMilliseconds.load()));
+            SetOutputSlotData("Output", GetInputValue<cv::Mat>("Input").value_or(cv::Mat{}));
+        }
+    };
+} // namespace
+
+class RunRecorderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Replays load the bundle's graph file, so its nodes must come from the factory
+        Vision::NodeFactory::RegisterAllNodes();
+        Vision::NodeFactory::Register("DelayNode", [](Nodes::NodeId id, std::string_view name) {
+            return std::make_unique<DelayNode>(id, std::string(name));
+        });
+        delayMilliseconds = 0;
+
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_recorder_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+        imagePath = testDir / "input.png";
+        ASSERT_TRUE(cv::imwrite(imagePath.string(), cv::Mat(16, 16, CV_8UC3, cv::Scalar(10, 20, 30))));
+        bundleDir = testDir / "bundle";
+
+        auto input = std::make_unique<Vision::IO::ImageInputNode>(1);
+        input->SetInputSlotDefault("FilePath", imagePath);
+        editor.AddNode(std::move(input));
+        editor.AddNode(std::make_unique<DelayNode>(2, "Delay"));
+        editor.AddConnection(1, "Output", 2, "Input");
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    std::filesystem::path testDir;
+    std::filesystem::path imagePath;
+    std::filesystem::path bundleDir;
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(RunRecorderTest, UnchangedReplayReportsNoRegression)
+{
+    std::string error;
+    ASSERT_TRUE(Vision::IO::RunRecorder::Record(editor, bundleDir, { .runs = 3 }, error)) << error;
+    EXPECT_TRUE(std::filesystem::exists(bundleDir / "recording.json"));
+    EXPECT_TRUE(std::filesystem::exists(bundleDir / "inputs" / "1.png"));
+    EXPECT_TRUE(editor.IsOutputCacheEnabled());
+
+    // Embedded inputs keep the bundle usable after the original image is gone
+    std::filesystem::remove(imagePath);
+    Nodes::NodeEditor replayEditor;
+    const auto report = Vision::IO::RunRecorder::Replay(replayEditor, bundleDir, { .runs = 3 }, error);
+    ASSERT_TRUE(report.has_value()) << error;
+    EXPECT_EQ(report->regressions, 0);
+    ASSERT_EQ(report->nodes.size(), 2);
+    for (const auto &node : report->nodes)
+    {
+        EXPECT_TRUE(node.processed) << node.nodeType;
+        EXPECT_GT(node.replayOutputBytes, 0) << node.nodeType;
+    }
+}
+
+TEST_F(RunRecorderTest, SlowerNodeIsReported)
+{
+    std::string error;
+    ASSERT_TRUE(Vision::IO::RunRecorder::Record(editor, bundleDir, { .runs = 3 }, error)) << error;
+
+    delayMilliseconds = 20;
+    Nodes::NodeEditor replayEditor;
+    const auto report = Vision::IO::RunRecorder::Replay(replayEditor, bundleDir, { .runs = 3 }, error);
+    ASSERT_TRUE(report.has_value()) << error;
+    EXPECT_EQ(report->regressions, 1);
+    ASSERT_FALSE(report->nodes.empty());
+    EXPECT_EQ(report->nodes.front().nodeId, 2);
+    EXPECT_TRUE(report->nodes.front().regressed);
+    EXPECT_GE(report->nodes.front().replayTime, std::chrono::milliseconds(20));
+    EXPECT_GT(report->replayTotal, report->baselineTotal);
+}
+
+TEST_F(RunRecorderTest, ChangedInputFailsReplay)
+{
+    std::string error;
+    ASSERT_TRUE(Vision::IO::RunRecorder::Record(editor, bundleDir, { .runs = 1, .embedInputs = false }, error))
+        << error;
+    EXPECT_FALSE(std::filesystem::exists(bundleDir / "inputs" / "1.png"));
+
+    Nodes::NodeEditor replayEditor;
+    EXPECT_TRUE(Vision::IO::RunRecorder::Replay(replayEditor, bundleDir, { .runs = 1 }, error).has_value()) << error;
+
+    ASSERT_TRUE(cv::imwrite(imagePath.string(), cv::Mat(16, 16, CV_8UC3, cv::Scalar(99, 20, 30))));
+    EXPECT_FALSE(Vision::IO::RunRecorder::Replay(replayEditor, bundleDir, { .runs = 1 }, error).has_value());
+    EXPECT_NE(error.find("differs"), std::string::npos);
+
+    EXPECT_FALSE(Vision::IO::RunRecorder::Replay(replayEditor, testDir / "missing", {}, error).has_value());
+}
@@ -0,0 +1,169 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/RuntimeMetrics.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace VisionCraft;
+
+namespace
+{
+    class IncrementNode : public Nodes::Node
+    {
+    public:
+        explicit IncrementNode(Nodes::NodeId id) : Nodes::Node(id, "Increment")
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "IncrementNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+    };
+
+    Nodes::NodeExecutionRecord MakeRecord(Nodes::NodeId id, Nodes::StepOutcome outcome, int microseconds = 0)
+    {
+        return { .nodeId = id,
+            .nodeType = "Blur",
+            .outcome = outcome,
+            .duration = std::chrono::microseconds(microseconds) };
+    }
+
+    bool Contains(const std::string &text, const std::string &line)
+    {
+        return text.find(line + "\n") != std::string::npos;
+    }
+} // namespace
+
+class RuntimeMetricsTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        metrics.Reset();
+        metrics.SetEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        // The metrics are process-wide; leave them off and empty for other tests
+        metrics.SetEnabled(false);
+        metrics.Reset();
+    }
+
+    Nodes::RuntimeMetrics &metrics = Nodes::RuntimeMetrics::Get();
+};
+
+TEST_F(RuntimeMetricsTest, EditorRunsFeedCountersAndHistograms)
+{
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    editor.AddNode(std::make_unique<IncrementNode>(1));
+    editor.AddNode(std::make_unique<IncrementNode>(2));
+    editor.AddConnection(1, "Output", 2, "Input");
+    ASSERT_TRUE(editor.Execute());
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+
+    const std::string text = metrics.FormatPrometheus();
+    EXPECT_TRUE(Contains(text, "visioncraft_images_total{result=\"succeeded\"} 2"));
+    EXPECT_TRUE(Contains(text, "visioncraft_images_total{result=\"failed\"} 0"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_steps_total{outcome=\"processed\"} 4"));
+    EXPECT_TRUE(Contains(text, "# TYPE visioncraft_node_duration_seconds histogram"));
+    for (const std::string node : { "1", "2" })
+    {
+        const std::string labels = "node=\"" + node + "\",type=\"IncrementNode\"";
+        EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"+Inf\"} 2"));
+        EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_count{" + labels + "} 2"));
+    }
+    EXPECT_GT(metrics.GetThroughput(), 0.0);
+
+    // Disabled metrics ignore runs
+    metrics.SetEnabled(false);
+    editor.MarkAllNodesDirty();
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_TRUE(Contains(metrics.FormatPrometheus(), "visioncraft_images_total{result=\"succeeded\"} 2"));
+}
+
+TEST_F(RuntimeMetricsTest, HistogramBucketsAreCumulative)
+{
+    Nodes::RunStatistics run;
+    run.succeeded = true;
+    run.nodes = { MakeRecord(7, Nodes::StepOutcome::Processed, 700),
+        MakeRecord(7, Nodes::StepOutcome::Processed, 3000),
+        MakeRecord(7, Nodes::StepOutcome::Processed, 60'000'000) };
+    metrics.RecordRun(run);
+
+    const std::string text = metrics.FormatPrometheus();
+    const std::string labels = "node=\"7\",type=\"Blur\"";
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"0.0005\"} 0"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"0.001\"} 1"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"0.005\"} 2"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"10\"} 2"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_bucket{" + labels + ",le=\"+Inf\"} 3"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_duration_seconds_count{" + labels + "} 3"));
+}
+
+TEST_F(RuntimeMetricsTest, ReportsCacheRatioQueuesAndMemory)
+{
+    Nodes::RunStatistics run;
+    run.succeeded = true;
+    run.peakSlotBytes = 4096;
+    run.nodes = { MakeRecord(1, Nodes::StepOutcome::CacheHit),
+        MakeRecord(2, Nodes::StepOutcome::CacheHit),
+        MakeRecord(3, Nodes::StepOutcome::CacheHit),
+        MakeRecord(4, Nodes::StepOutcome::Processed, 10),
+        MakeRecord(5, Nodes::StepOutcome::Skipped) };
+    metrics.RecordRun(run);
+    run.succeeded = false;
+    run.timedOut = true;
+    run.peakSlotBytes = 1024;
+    run.nodes.clear();
+    metrics.RecordRun(run);
+    metrics.SetQueueDepth(Nodes::PipelineStage::Compute, 3);
+    metrics.SetQueueDepth(Nodes::PipelineStage::Encode, 1);
+
+    const std::string text = metrics.FormatPrometheus();
+    EXPECT_TRUE(Contains(text, "visioncraft_cache_hit_ratio 0.75"));
+    EXPECT_TRUE(Contains(text, "visioncraft_node_steps_total{outcome=\"skipped\"} 1"));
+    EXPECT_TRUE(Contains(text, "visioncraft_images_total{result=\"failed\"} 1"));
+    EXPECT_TRUE(Contains(text, "visioncraft_images_timed_out_total 1"));
+    EXPECT_TRUE(Contains(text, "visioncraft_stage_queue_depth{stage=\"decode\"} 0"));
+    EXPECT_TRUE(Contains(text, "visioncraft_stage_queue_depth{stage=\"compute\"} 3"));
+    EXPECT_TRUE(Contains(text, "visioncraft_stage_queue_depth{stage=\"encode\"} 1"));
+    EXPECT_TRUE(Contains(text, "visioncraft_slot_memory_peak_bytes 4096"));
+    EXPECT_NE(text.find("visioncraft_process_resident_peak_bytes "), std::string::npos);
+}
+
+TEST_F(RuntimeMetricsTest, WriteFileReplacesTheFile)
+{
+    const auto path = std::filesystem::temp_directory_path() / "visioncraft_metrics_test.prom";
+    {
+        std::ofstream stale(path);
+        stale << "stale\n";
+    }
+
+    Nodes::RunStatistics run;
+    run.succeeded = true;
+    metrics.RecordRun(run);
+    ASSERT_TRUE(metrics.WriteFile(path));
+
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    EXPECT_EQ(contents.str().find("stale"), std::string::npos);
+    EXPECT_TRUE(Contains(contents.str(), "visioncraft_images_total{result=\"succeeded\"} 1"));
+    EXPECT_FALSE(std::filesystem::exists(std::filesystem::path(path) += ".tmp"));
+    std::filesystem::remove(path);
+}
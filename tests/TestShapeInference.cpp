@@ -0,0 +1,111 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CannyEdgeNode.h"
+#include "Vision/Algorithms/CropNode.h"
+#include "Vision/Algorithms/GrayscaleNode.h"
+#include "Vision/Algorithms/MedianBlurNode.h"
+#include "Vision/Algorithms/MorphologyNode.h"
+#include "Vision/Algorithms/ResizeNode.h"
+#include "Vision/Algorithms/SobelNode.h"
+#include "Vision/Algorithms/ThresholdNode.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <unordered_map>
+#include <vector>
+
+using namespace VisionCraft;
+using Tests::Link;
+using Tests::SourceNode;
+
+class ShapeInferenceTest : public ::testing::Test
+{
+protected:
+    // Appends a node to the chain, fed by the previous one
+    void Append(std::unique_ptr<Nodes::Node> node)
+    {
+        const auto id = node->GetId();
+        editor.AddNode(std::move(node));
+        if (id > 1)
+        {
+            Link(editor, id - 1, id);
+        }
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(ShapeInferenceTest, InferredShapesMatchProcessedImages)
+{
+    Append(std::make_unique<SourceNode>(1, cv::Mat(480, 640, CV_8UC3, cv::Scalar(10, 120, 240)), true));
+    Append(std::make_unique<Vision::Algorithms::ResizeNode>(2));
+    Append(std::make_unique<Vision::Algorithms::CropNode>(3));
+    Append(std::make_unique<Vision::Algorithms::MorphologyNode>(4));
+    Append(std::make_unique<Vision::Algorithms::MedianBlurNode>(5));
+    Append(std::make_unique<Vision::Algorithms::GrayscaleNode>(6));
+    Append(std::make_unique<Vision::Algorithms::ThresholdNode>(7));
+    Append(std::make_unique<Vision::Algorithms::SobelNode>(8));
+    editor.GetNode(2)->SetInputSlotDefault("ScaleX", 0.5);
+    editor.GetNode(2)->SetInputSlotDefault("ScaleY", 0.25);
+    editor.GetNode(3)->SetInputSlotDefault("X", 10);
+    editor.GetNode(3)->SetInputSlotDefault("Width", 100);
+    editor.GetNode(3)->SetInputSlotDefault("Height", 50);
+
+    const auto inference = editor.InferImageShapes();
+    EXPECT_TRUE(inference.mismatches.empty());
+    ASSERT_EQ(inference.shapes.size(), 8);
+    EXPECT_EQ(inference.derived.size(), 7);
+    EXPECT_EQ(inference.shapes.at(2), (Nodes::ImageShape{ .size = cv::Size(320, 120), .type = CV_8UC3 }));
+    EXPECT_EQ(inference.shapes.at(3), (Nodes::ImageShape{ .size = cv::Size(100, 50), .type = CV_8UC3 }));
+    EXPECT_EQ(inference.shapes.at(6), (Nodes::ImageShape{ .size = cv::Size(100, 50), .type = CV_8UC1 }));
+
+    // Every node then outputs exactly the shape inferred for it
+    ASSERT_TRUE(editor.Execute());
+    for (const auto &[id, shape] : inference.shapes)
+    {
+        const auto output = editor.GetNode(id)->GetOutputSlot("Output").GetData<cv::Mat>();
+        ASSERT_TRUE(output.has_value()) << "node " << id;
+        EXPECT_EQ(output->size(), shape.size) << "node " << id;
+        EXPECT_EQ(output->type(), shape.type) << "node " << id;
+    }
+}
+
+TEST_F(ShapeInferenceTest, MismatchedInputIsRejected)
+{
+    Append(std::make_unique<SourceNode>(1, cv::Mat(64, 64, CV_16UC3), true));
+    editor.AddNode(std::make_unique<Vision::Algorithms::CannyEdgeNode>(2));
+
+    // Canny needs 8-bit images, which is known before anything runs
+    const Nodes::Connection connection{ .from = 1, .fromSlot = "Output", .to = 2, .toSlot = "Input" };
+    EXPECT_TRUE(editor.CheckConnectionShapes(connection).has_value());
+    editor.AddConnection(1, "Output", 2, "Input");
+    const auto inference = editor.InferImageShapes();
+    ASSERT_EQ(inference.mismatches.size(), 1);
+    EXPECT_EQ(inference.mismatches.front().first, 2);
+
+    // A given source shape overrides the node's own, and unknown shapes never reject
+    const std::unordered_map<Nodes::NodeId, Nodes::ImageShape> eightBit{ { 1, { cv::Size(64, 64), CV_8UC3 } } };
+    EXPECT_TRUE(editor.InferImageShapes(eightBit).mismatches.empty());
+    editor.AddNode(std::make_unique<Vision::Algorithms::GrayscaleNode>(3));
+    const Nodes::Connection fromUnknown{ .from = 3, .fromSlot = "Output", .to = 2, .toSlot = "Input" };
+    EXPECT_FALSE(editor.CheckConnectionShapes(fromUnknown).has_value());
+}
+
+TEST_F(ShapeInferenceTest, PreallocationFillsThePool)
+{
+    Append(std::make_unique<SourceNode>(1, cv::Mat(240, 320, CV_8UC3), true));
+    Append(std::make_unique<Vision::Algorithms::MorphologyNode>(2));
+    Append(std::make_unique<Vision::Algorithms::GrayscaleNode>(3));
+    Append(std::make_unique<Vision::Algorithms::SobelNode>(4));
+
+    // One 3-channel and two 1-channel intermediates; the source is not pooled
+    const size_t expected = 320 * 240 * 3 + 2 * 320 * 240;
+    EXPECT_EQ(editor.PreallocateImages(), expected);
+    EXPECT_EQ(editor.GetImageBufferPool().GetStatistics().idleBuffers, 3);
+    EXPECT_EQ(editor.PreallocateImages(), 0); // Already idle
+
+    // The first run draws the intermediates from the pool
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_GE(editor.GetImageBufferPool().GetStatistics().reused, 3);
+}
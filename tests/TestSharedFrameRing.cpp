@@ -0,0 +1,241 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/IO/SharedFrameRing.h"
+#include "Vision/IO/SharedMemoryInputNode.h"
+#include "Vision/IO/SharedMemoryOutputNode.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+using namespace std::chrono_literals;
+
+namespace
+{
+    // Rings are named system-wide, so concurrent test runs must not share names
+    std::string UniqueRingName()
+    {
+        std::random_device device;
+        return "visioncraft_test_" + std::to_string(device());
+    }
+
+    cv::Mat MakeFrame(int value)
+    {
+        return cv::Mat(4, 6, CV_8UC3, cv::Scalar(value, value + 1, value + 2));
+    }
+
+    // Records the first pixel of every frame it receives
+    class FrameRecorderNode : public Nodes::Node
+    {
+    public:
+        explicit FrameRecorderNode(Nodes::NodeId id) : Nodes::Node(id, "Recorder")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateInputSlot("Input");
+        }
+
+        std::string GetType() const override
+        {
+            return "FrameRecorderNode";
+        }
+
+        void Process() override
+        {
+            if (const auto image = GetInputValueIf<cv::Mat>("Input"); image && !image->empty())
+            {
+                values.push_back(image->at<cv::Vec3b>(0, 0)[0]);
+            }
+        }
+
+        std::vector<int> values;
+    };
+} // namespace
+
+TEST(SharedFrameRingTest, RoundTripsFramesInOrder)
+{
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 4, 4 * 6 * 3);
+    ASSERT_NE(writer, nullptr);
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+    EXPECT_EQ(reader->GetSlotCount(), 4);
+    EXPECT_EQ(reader->GetSlotBytes(), 4 * 6 * 3);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(writer->Write(MakeFrame(i * 10), 100 + i, 0ms));
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const auto frame = reader->Read(0ms);
+        ASSERT_TRUE(frame.has_value());
+        EXPECT_EQ(frame->frameIndex, 100 + i);
+        EXPECT_EQ(frame->sequence, static_cast<uint64_t>(i));
+        EXPECT_EQ(cv::norm(frame->image, MakeFrame(i * 10), cv::NORM_INF), 0.0);
+    }
+    EXPECT_FALSE(reader->Read(0ms).has_value());
+    EXPECT_FALSE(reader->HasEnded());
+}
+
+TEST(SharedFrameRingTest, FilledSlotIsReadWithoutCopy)
+{
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 2, 64);
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+
+    cv::Mat slot = writer->AcquireWrite(2, 8, CV_8UC1, 0ms);
+    ASSERT_FALSE(slot.empty());
+    slot.setTo(7);
+    writer->Publish(0);
+
+    const auto frame = reader->Read(0ms);
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->image.at<uchar>(1, 7), 7);
+
+    // Both headers map the same memory
+    slot.at<uchar>(1, 7) = 9;
+    EXPECT_EQ(frame->image.at<uchar>(1, 7), 9);
+}
+
+TEST(SharedFrameRingTest, SlotIsFreedWhenLastCopyIsReleased)
+{
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 2, 4 * 6 * 3);
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+
+    ASSERT_TRUE(writer->Write(MakeFrame(1), 0, 0ms));
+    ASSERT_TRUE(writer->Write(MakeFrame(2), 1, 0ms));
+    EXPECT_FALSE(writer->Write(MakeFrame(3), 2, 0ms));
+
+    auto frame = reader->Read(0ms);
+    ASSERT_TRUE(frame.has_value());
+    cv::Mat copy = frame->image;
+    frame.reset();
+    EXPECT_FALSE(writer->Write(MakeFrame(3), 2, 0ms));
+
+    copy.release();
+    EXPECT_TRUE(writer->Write(MakeFrame(3), 2, 0ms));
+}
+
+TEST(SharedFrameRingTest, RejectsFramesLargerThanSlot)
+{
+    auto writer = Vision::IO::SharedFrameRing::Create(UniqueRingName(), 2, 16);
+    ASSERT_NE(writer, nullptr);
+    EXPECT_FALSE(writer->Write(MakeFrame(1), 0, 0ms));
+    EXPECT_TRUE(writer->AcquireWrite(100, 100, CV_8UC1, 0ms).empty());
+}
+
+TEST(SharedFrameRingTest, ClosedRingEndsAfterQueuedFrames)
+{
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 2, 4 * 6 * 3);
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+
+    ASSERT_TRUE(writer->Write(MakeFrame(1), 0, 0ms));
+    writer.reset();
+    EXPECT_EQ(Vision::IO::SharedFrameRing::Open(name), nullptr);
+
+    EXPECT_FALSE(reader->HasEnded());
+    EXPECT_TRUE(reader->Read(0ms).has_value());
+    EXPECT_TRUE(reader->HasEnded());
+    EXPECT_FALSE(reader->Read(1s).has_value());
+}
+
+TEST(SharedFrameRingTest, WriterWaitsForReader)
+{
+    constexpr int kFrameCount = 200;
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 3, 4 * 6 * 3);
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+
+    std::thread producer([&]() {
+        for (int i = 0; i < kFrameCount; ++i)
+        {
+            while (!writer->Write(MakeFrame(i % 200), i, 1s))
+            {
+            }
+        }
+        writer->Close();
+    });
+
+    int received = 0;
+    while (const auto frame = reader->Read(5s))
+    {
+        EXPECT_EQ(frame->frameIndex, received);
+        EXPECT_EQ(frame->image.at<cv::Vec3b>(0, 0)[0], received % 200);
+        ++received;
+    }
+    producer.join();
+    EXPECT_EQ(received, kFrameCount);
+    EXPECT_TRUE(reader->HasEnded());
+}
+
+TEST(SharedFrameRingTest, InputNodeStreamsUntilWriterCloses)
+{
+    const auto name = UniqueRingName();
+    auto writer = Vision::IO::SharedFrameRing::Create(name, 4, 4 * 6 * 3);
+    ASSERT_NE(writer, nullptr);
+
+    Nodes::NodeEditor editor;
+    auto input = std::make_unique<Vision::IO::SharedMemoryInputNode>(1);
+    input->SetInputSlotDefault("Name", name);
+    auto *inputPtr = input.get();
+    auto recorder = std::make_unique<FrameRecorderNode>(2);
+    auto *recorderPtr = recorder.get();
+    editor.AddNode(std::move(input));
+    editor.AddNode(std::move(recorder));
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    std::thread producer([&]() {
+        for (int i = 0; i < 5; ++i)
+        {
+            while (!writer->Write(MakeFrame(i * 10), i, 1s))
+            {
+            }
+        }
+        writer.reset();
+    });
+
+    const auto frames = editor.ExecuteStream();
+    producer.join();
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, 5);
+    EXPECT_EQ(recorderPtr->values, (std::vector<int>{ 0, 10, 20, 30, 40 }));
+    EXPECT_TRUE(inputPtr->HasStreamEnded());
+}
+
+TEST(SharedFrameRingTest, OutputNodeSendsFramesAndDropsWhenFull)
+{
+    const auto name = UniqueRingName();
+    Vision::IO::SharedMemoryOutputNode output(1);
+    output.SetInputSlotDefault("Name", name);
+    output.SetInputSlotDefault("Slots", 2);
+    output.SetInputSlotDefault("Wait", false);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        output.SetInputSlotDefault("Input", MakeFrame(i));
+        output.Process();
+    }
+    EXPECT_EQ(output.GetSentFrames(), 2);
+    EXPECT_EQ(output.GetDroppedFrames(), 1);
+
+    auto reader = Vision::IO::SharedFrameRing::Open(name);
+    ASSERT_NE(reader, nullptr);
+    const auto frame = reader->Read(0ms);
+    ASSERT_TRUE(frame.has_value());
+    EXPECT_EQ(frame->frameIndex, 0);
+    EXPECT_EQ(cv::norm(frame->image, MakeFrame(0), cv::NORM_INF), 0.0);
+}
@@ -339,3 +339,100 @@ TEST_F(SlotTest, EmptyMat)
     ASSERT_TRUE(retrieved.has_value());
     EXPECT_TRUE(retrieved->empty());
 }
+
+// ============================================================================
+// Shared Data Tests
+// ============================================================================
+
+TEST_F(SlotTest, GetDataIfPointsIntoStoredValue)
+{
+    slot.SetData(42);
+
+    const auto value = slot.GetDataIf<int>();
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 42);
+    EXPECT_EQ(slot.GetDataIf<double>(), nullptr);
+
+    slot.Clear();
+    EXPECT_EQ(slot.GetDataIf<int>(), nullptr);
+}
+
+TEST_F(SlotTest, SetSharedDataSharesHandle)
+{
+    auto shared = std::make_shared<const Nodes::NodeData>(cv::Mat(4, 4, CV_8UC1, cv::Scalar(7)));
+
+    Nodes::Slot other;
+    slot.SetSharedData(shared);
+    other.SetSharedData(slot.GetSharedData());
+
+    EXPECT_EQ(slot.GetSharedData().get(), shared.get());
+    EXPECT_EQ(other.GetSharedData().get(), shared.get());
+    EXPECT_EQ(slot.GetDataIf<cv::Mat>()->data, other.GetDataIf<cv::Mat>()->data);
+}
+
+TEST_F(SlotTest, SetSharedDataWithEmptyValueClears)
+{
+    slot.SetData(1);
+    slot.SetSharedData(std::make_shared<const Nodes::NodeData>(std::monostate{}));
+    EXPECT_FALSE(slot.HasData());
+
+    slot.SetData(2);
+    slot.SetSharedData(nullptr);
+    EXPECT_FALSE(slot.HasData());
+    EXPECT_EQ(slot.GetTypeIndex(), 0);
+}
+
+TEST_F(SlotTest, SetDataAfterSharingLeavesOtherSlotUntouched)
+{
+    Nodes::Slot other;
+    slot.SetData(1);
+    other.SetSharedData(slot.GetSharedData());
+
+    slot.SetData(2);
+
+    EXPECT_EQ(slot.GetData<int>(), 2);
+    EXPECT_EQ(other.GetData<int>(), 1);
+}
+
+// ============================================================================
+// View Tests
+// ============================================================================
+
+TEST_F(SlotTest, ViewPointsIntoConnectedValue)
+{
+    slot.SetDefaultValue(std::string("default"));
+    slot.SetData(std::string("connected"));
+
+    const auto view = slot.GetValueOrDefaultView<std::string>();
+    ASSERT_TRUE(view);
+    EXPECT_EQ(*view, "connected");
+    EXPECT_EQ(&*view, slot.GetDataIf<std::string>().get());
+}
+
+TEST_F(SlotTest, ViewFallsBackToDefault)
+{
+    slot.SetDefaultValue(std::string("default"));
+    EXPECT_EQ(slot.GetValueOrDefaultView<std::string>().ValueOr("fallback"), "default");
+
+    // Connected data of another type does not hide the default
+    slot.SetData(3);
+    EXPECT_EQ(*slot.GetValueOrDefaultView<std::string>(), "default");
+    EXPECT_EQ(*slot.GetValueOrDefaultView<int>(), 3);
+
+    Nodes::Slot empty;
+    const auto view = empty.GetValueOrDefaultView<std::filesystem::path>();
+    EXPECT_FALSE(view);
+    EXPECT_EQ(view.ValueOr("fallback"), "fallback");
+    EXPECT_TRUE(view.ValueOrEmpty().empty());
+}
+
+TEST_F(SlotTest, ViewKeepsValueAliveAfterRewrite)
+{
+    slot.SetData(cv::Mat(4, 4, CV_8UC1, cv::Scalar(9)));
+    const auto view = slot.GetValueOrDefaultView<cv::Mat>();
+
+    slot.SetData(1);
+    slot.SetDefaultValue(2);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->at<uchar>(0, 0), 9);
+}
@@ -0,0 +1,81 @@
+#include "Nodes/Core/SlotNameTable.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace VisionCraft::Nodes;
+
+TEST(SlotNameTableTest, FindsNamesPerKind)
+{
+    SlotNameTable table;
+    EXPECT_EQ(table.Insert(SlotKind::Input, "Input", 0), std::make_pair(size_t{ 0 }, true));
+    EXPECT_EQ(table.Insert(SlotKind::Input, "Threshold", 1), std::make_pair(size_t{ 1 }, true));
+    EXPECT_EQ(table.Insert(SlotKind::Output, "Output", 0), std::make_pair(size_t{ 0 }, true));
+    table.Insert(SlotKind::ExecutionInput, "Execute", 0);
+
+    EXPECT_EQ(table.Find(SlotKind::Input, "Threshold"), 1u);
+    EXPECT_EQ(table.Find(SlotKind::Output, "Output"), 0u);
+    EXPECT_FALSE(table.Find(SlotKind::Output, "Input"));
+    EXPECT_FALSE(table.Find(SlotKind::Input, "Thresh"));
+    EXPECT_TRUE(table.Contains(SlotKind::ExecutionInput, "Execute"));
+    EXPECT_FALSE(table.Contains(SlotKind::ExecutionOutput, "Execute"));
+}
+
+TEST(SlotNameTableTest, InsertingAnExistingNameKeepsItsIndex)
+{
+    SlotNameTable table;
+    table.Insert(SlotKind::Input, "Image", 0);
+    EXPECT_EQ(table.Insert(SlotKind::Input, "Image", 5), std::make_pair(size_t{ 0 }, false));
+    EXPECT_EQ(table.Find(SlotKind::Input, "Image"), 0u);
+
+    // The same name under another kind is a different entry
+    EXPECT_EQ(table.Insert(SlotKind::Output, "Image", 3), std::make_pair(size_t{ 3 }, true));
+}
+
+TEST(SlotNameTableTest, ListsNamesSortedRegardlessOfInsertionOrder)
+{
+    SlotNameTable table;
+    const std::vector<std::string> inputs{ "Method", "Input", "Threshold", "Apply", "KernelSize" };
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        table.Insert(SlotKind::Input, inputs[i], i);
+    }
+    table.Insert(SlotKind::Output, "Output", 0);
+
+    EXPECT_EQ(table.GetNames(SlotKind::Input),
+        (std::vector<std::string>{ "Apply", "Input", "KernelSize", "Method", "Threshold" }));
+    EXPECT_EQ(table.GetNames(SlotKind::Output), (std::vector<std::string>{ "Output" }));
+    EXPECT_TRUE(table.GetNames(SlotKind::ExecutionOutput).empty());
+
+    // Indices follow insertion, not the sorted order
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        EXPECT_EQ(table.Find(SlotKind::Input, inputs[i]), i) << inputs[i];
+    }
+}
+
+TEST(SlotNameTest, EqualNamesShareOneHandle)
+{
+    const SlotName input("Input");
+    const std::string text = "Input";
+    EXPECT_EQ(input, SlotName(text));
+    EXPECT_EQ(&input.Str(), &SlotName(std::string_view(text)).Str());
+    EXPECT_NE(input, SlotName("Output"));
+    EXPECT_TRUE(SlotName().Empty());
+    EXPECT_EQ(SlotName(), SlotName(""));
+
+    std::unordered_set<SlotName> names{ "Input", "Output", "Input" };
+    EXPECT_EQ(names.size(), 2u);
+}
+
+TEST(SlotNameTest, OrdersByCharacters)
+{
+    // Interned in reverse order, so handle order would differ from the characters
+    const std::set<SlotName> names{ "Zeta", "Mu", "Alpha" };
+    EXPECT_EQ(std::vector<SlotName>(names.begin(), names.end()), (std::vector<SlotName>{ "Alpha", "Mu", "Zeta" }));
+    EXPECT_LT(SlotName("Execute"), SlotName("Input"));
+}
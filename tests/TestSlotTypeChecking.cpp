@@ -0,0 +1,140 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/Algorithms/BranchNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/core.hpp>
+
+#include <string>
+
+using namespace VisionCraft;
+using Nodes::SlotDataType;
+
+namespace
+{
+    // Outputs a fixed value through an output declaring its type
+    class TypedSourceNode : public Nodes::Node
+    {
+    public:
+        TypedSourceNode(Nodes::NodeId id, Nodes::NodeData value, SlotDataType declared)
+            : Nodes::Node(id, "TypedSource"), value(std::move(value))
+        {
+            CreateOutputSlot("Output").SetDataType(declared);
+        }
+
+        std::string GetType() const override
+        {
+            return "TypedSourceNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", value);
+        }
+
+        Nodes::NodeData value;
+    };
+
+    // Copies its double input, whose default declares the slot a double
+    class DoubleSinkNode : public Nodes::Node
+    {
+    public:
+        explicit DoubleSinkNode(Nodes::NodeId id) : Nodes::Node(id, "DoubleSink")
+        {
+            CreateInputSlot("Value", -1.0);
+            CreateOutputSlot("Output").SetDataType(SlotDataType::Double);
+        }
+
+        std::string GetType() const override
+        {
+            return "DoubleSinkNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", GetInputValue<double>("Value").value_or(0.0));
+        }
+    };
+
+    double OutputOf(Nodes::NodeEditor &editor, Nodes::NodeId id)
+    {
+        return editor.GetNode(id)->GetOutputSlot("Output").GetData<double>().value_or(0.0);
+    }
+} // namespace
+
+TEST(SlotTypeCheckingTest, ClassifiesValuesByKind)
+{
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{}), SlotDataType::Any);
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{ cv::Mat() }), SlotDataType::Image);
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{ cv::UMat() }), SlotDataType::Image);
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{ 3 }), SlotDataType::Int);
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{ 3.0 }), SlotDataType::Double);
+    EXPECT_EQ(Nodes::GetSlotDataType(Nodes::NodeData{ Nodes::ContourSet{} }), SlotDataType::Contours);
+
+    EXPECT_TRUE(Nodes::AreSlotDataTypesCompatible(SlotDataType::Any, SlotDataType::Int));
+    EXPECT_TRUE(Nodes::AreSlotDataTypesCompatible(SlotDataType::Image, SlotDataType::Any));
+    EXPECT_FALSE(Nodes::AreSlotDataTypesCompatible(SlotDataType::Int, SlotDataType::Double));
+    EXPECT_STREQ(Nodes::GetSlotDataTypeName(SlotDataType::Contours), "contours");
+}
+
+TEST(SlotTypeCheckingTest, DefaultsDeclareTheInputType)
+{
+    DoubleSinkNode node(1);
+    EXPECT_EQ(node.GetInputSlot("Value").GetDataType(), SlotDataType::Double);
+
+    const Nodes::Slot copy = node.GetOutputSlot("Output");
+    EXPECT_EQ(copy.GetDataType(), SlotDataType::Double);
+    EXPECT_EQ(Nodes::Slot().GetDataType(), SlotDataType::Any);
+}
+
+TEST(SlotTypeCheckingTest, MatchingTypesPassData)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<TypedSourceNode>(1, 4.5, SlotDataType::Double));
+    editor.AddNode(std::make_unique<DoubleSinkNode>(2));
+    editor.AddConnection(1, "Output", 2, "Value");
+
+    EXPECT_FALSE(editor.CheckConnectionTypes({ .from = 1, .fromSlot = "Output", .to = 2, .toSlot = "Value" }));
+    EXPECT_TRUE(editor.FindTypeMismatches().empty());
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(OutputOf(editor, 2), 4.5);
+}
+
+TEST(SlotTypeCheckingTest, MismatchedConnectionIsLeftUnboundAtCompileTime)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<TypedSourceNode>(1, 7, SlotDataType::Int));
+    editor.AddNode(std::make_unique<DoubleSinkNode>(2));
+    editor.AddConnection(1, "Output", 2, "Value");
+
+    const auto reason = editor.CheckConnectionTypes({ .from = 1, .fromSlot = "Output", .to = 2, .toSlot = "Value" });
+    ASSERT_TRUE(reason.has_value());
+    EXPECT_NE(reason->find("int"), std::string::npos);
+    EXPECT_NE(reason->find("double"), std::string::npos);
+    ASSERT_EQ(editor.FindTypeMismatches().size(), 1u);
+
+    // The sink runs on its default, and no data is passed along the rejected connection
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(OutputOf(editor, 2), -1.0);
+    EXPECT_FALSE(editor.GetNode(2)->GetInputSlot("Value").HasData());
+    for (const auto &record : editor.GetExecutionStatistics().GetLatest()->nodes)
+    {
+        EXPECT_EQ(record.dataPassOperations, 0u);
+    }
+}
+
+TEST(SlotTypeCheckingTest, UndeclaredSlotsMatchAnything)
+{
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<TypedSourceNode>(1, 2.0, SlotDataType::Any));
+    editor.AddNode(std::make_unique<DoubleSinkNode>(2));
+    editor.AddConnection(1, "Output", 2, "Value");
+
+    EXPECT_TRUE(editor.FindTypeMismatches().empty());
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_DOUBLE_EQ(OutputOf(editor, 2), 2.0);
+
+    // The branch condition is declared Any, since numbers are read as conditions too
+    editor.AddNode(std::make_unique<TypedSourceNode>(3, 1, SlotDataType::Int));
+    editor.AddNode(std::make_unique<Vision::Algorithms::BranchNode>(4));
+    EXPECT_FALSE(editor.CheckConnectionTypes({ .from = 3, .fromSlot = "Output", .to = 4, .toSlot = "Condition" }));
+}
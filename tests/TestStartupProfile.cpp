@@ -0,0 +1,120 @@
+#include "Nodes/Core/StartupProfile.h"
+#include "UI/Widgets/NodeSearchPalette.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    size_t CountPhases(const std::string &name)
+    {
+        const auto phases = Nodes::StartupProfile::Get().GetPhases();
+        return static_cast<size_t>(
+            std::ranges::count_if(phases, [&](const auto &phase) { return phase.name == name; }));
+    }
+} // namespace
+
+class StartupProfileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        profile.Reset();
+    }
+
+    void TearDown() override
+    {
+        // The profile is process-wide; leave it empty for other tests
+        profile.Reset();
+    }
+
+    Nodes::StartupProfile &profile = Nodes::StartupProfile::Get();
+};
+
+TEST_F(StartupProfileTest, ScopesRecordPhasesInTheOrderTheyEnd)
+{
+    {
+        Nodes::StartupScope outer("Outer");
+        {
+            Nodes::StartupScope inner("Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+
+    const auto phases = profile.GetPhases();
+    ASSERT_EQ(phases.size(), 2u);
+    EXPECT_EQ(phases[0].name, "Inner");
+    EXPECT_EQ(phases[1].name, "Outer");
+    EXPECT_GE(phases[0].length, std::chrono::milliseconds(2));
+    EXPECT_GE(phases[1].length, phases[0].length);
+    EXPECT_LE(phases[1].start, phases[0].start);
+    EXPECT_FALSE(phases[0].afterReady);
+}
+
+TEST_F(StartupProfileTest, MarksReadyOnceAndFlagsLaterPhases)
+{
+    {
+        Nodes::StartupScope scope("Before");
+    }
+    EXPECT_FALSE(profile.GetTimeToReady());
+
+    EXPECT_TRUE(profile.MarkReady());
+    const auto ready = profile.GetTimeToReady();
+    ASSERT_TRUE(ready);
+    EXPECT_FALSE(profile.MarkReady());
+    EXPECT_EQ(profile.GetTimeToReady(), ready);
+
+    // Background work finishing after the first frame
+    std::thread([] { Nodes::StartupScope scope("Background"); }).join();
+
+    const auto phases = profile.GetPhases();
+    ASSERT_EQ(phases.size(), 2u);
+    EXPECT_FALSE(phases[0].afterReady);
+    EXPECT_TRUE(phases[1].afterReady);
+}
+
+TEST_F(StartupProfileTest, SummaryListsPhasesByStartAndMarksTheSlowest)
+{
+    const auto origin = Nodes::StartupProfile::Clock::now();
+    profile.Record("Fast", origin + std::chrono::milliseconds(5), origin + std::chrono::milliseconds(6));
+    profile.Record("Slow", origin, origin + std::chrono::milliseconds(4));
+
+    const std::string summary = profile.FormatSummary();
+    const auto slow = summary.find("Slow (slowest)");
+    const auto fast = summary.find("Fast");
+    ASSERT_NE(slow, std::string::npos);
+    ASSERT_NE(fast, std::string::npos);
+    EXPECT_LT(slow, fast);
+    EXPECT_EQ(summary.find("Fast (slowest)"), std::string::npos);
+    EXPECT_EQ(std::ranges::count(summary, '\n'), 2);
+
+    profile.Reset();
+    EXPECT_TRUE(profile.GetPhases().empty());
+    EXPECT_TRUE(profile.FormatSummary().empty());
+}
+
+TEST_F(StartupProfileTest, SearchPaletteBuildsItsIndexOnFirstOpen)
+{
+    UI::Widgets::NodeSearchPalette palette;
+    palette.SetAvailableNodeTypes({ { .typeId = "Threshold", .displayName = "Threshold", .category = "Processing" },
+        { .typeId = "Grayscale", .displayName = "Grayscale", .category = "Processing" } });
+    EXPECT_EQ(CountPhases("Search palette index"), 0u);
+
+    palette.Open(0.0f, 0.0f);
+    EXPECT_EQ(CountPhases("Search palette index"), 1u);
+    EXPECT_FALSE(palette.GetHighlightedType().empty());
+
+    palette.Close();
+    palette.Open(0.0f, 0.0f);
+    EXPECT_EQ(CountPhases("Search palette index"), 1u);
+
+    // New types while open are indexed at once
+    palette.SetAvailableNodeTypes({ { .typeId = "Resize", .displayName = "Resize", .category = "Processing" } });
+    EXPECT_EQ(CountPhases("Search palette index"), 2u);
+    EXPECT_EQ(palette.GetHighlightedType(), "Resize");
+}
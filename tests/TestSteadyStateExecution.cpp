@@ -0,0 +1,202 @@
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Heap allocations made on the calling thread while counting; other threads (logger, pools) are ignored
+    thread_local bool countAllocations = false;
+    thread_local size_t allocations = 0;
+
+    void *Allocate(size_t size)
+    {
+        if (countAllocations)
+        {
+            ++allocations;
+        }
+        if (void *block = std::malloc(size != 0 ? size : 1))
+        {
+            return block;
+        }
+        throw std::bad_alloc();
+    }
+} // namespace
+
+// Replaced for the whole test binary; counting is off except inside the loops below
+void *operator new(size_t size)
+{
+    return Allocate(size);
+}
+
+void *operator new[](size_t size)
+{
+    return Allocate(size);
+}
+
+void operator delete(void *block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete[](void *block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void *block, size_t) noexcept
+{
+    std::free(block);
+}
+
+void operator delete[](void *block, size_t) noexcept
+{
+    std::free(block);
+}
+
+namespace
+{
+    constexpr Nodes::SlotIndex kFirstInput = 0;
+    constexpr Nodes::SlotIndex kSecondInput = 1;
+    constexpr Nodes::SlotIndex kOutput = 0;
+
+    // Outputs a value that changes every run, like a frame source
+    class CounterNode : public Nodes::Node
+    {
+    public:
+        explicit CounterNode(Nodes::NodeId id) : Nodes::Node(id, "Frame counter feeding the chain")
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SteadyStateCounterNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData(kOutput, static_cast<double>(++count));
+        }
+
+    private:
+        int count = 0;
+    };
+
+    // Adds its two inputs
+    class AddNode : public Nodes::Node
+    {
+    public:
+        explicit AddNode(Nodes::NodeId id) : Nodes::Node(id, "Adder number " + std::to_string(id) + " of the chain")
+        {
+            CreateInputSlot("A", 0.0);
+            CreateInputSlot("B", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SteadyStateAddNode";
+        }
+
+        void Process() override
+        {
+            const double a = GetInputValue<double>(kFirstInput).value_or(0.0);
+            const double b = GetInputValue<double>(kSecondInput).value_or(0.0);
+            SetOutputSlotData(kOutput, a + b);
+        }
+    };
+
+    constexpr Nodes::NodeId kChainLength = 8;
+    constexpr size_t kMeasuredRuns = 20;
+} // namespace
+
+class SteadyStateExecutionTest : public ::testing::Test
+{
+protected:
+    // Counter 1 feeds both inputs of adder 2; each later adder takes the previous one and the counter
+    void SetUp() override
+    {
+        editor.SetOutputCacheEnabled(false);
+        editor.AddNode(std::make_unique<CounterNode>(1));
+        for (Nodes::NodeId id = 2; id <= kChainLength; ++id)
+        {
+            editor.AddNode(std::make_unique<AddNode>(id));
+            editor.AddConnection(id - 1, "Output", id, "A");
+            editor.AddConnection(1, "Output", id, "B");
+        }
+    }
+
+    // Runs the graph as a new frame would, counting allocations once warm-up is over
+    size_t MeasureRuns(size_t runs)
+    {
+        // Statistics buffers are recycled once the history is full
+        for (size_t i = 0; i < Constants::Profiling::kRunHistoryCapacity + 2; ++i)
+        {
+            editor.MarkNodeDirty(1);
+            EXPECT_TRUE(editor.Execute());
+        }
+
+        bool succeeded = true;
+        allocations = 0;
+        countAllocations = true;
+        for (size_t i = 0; i < runs; ++i)
+        {
+            editor.MarkNodeDirty(1);
+            succeeded = editor.Execute() && succeeded;
+        }
+        countAllocations = false;
+        EXPECT_TRUE(succeeded);
+        return allocations;
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_F(SteadyStateExecutionTest, CounterSeesAllocations)
+{
+    allocations = 0;
+    countAllocations = true;
+    void *block = ::operator new(64); // Called directly, as new-expressions may be optimized away
+    countAllocations = false;
+    ::operator delete(block);
+    EXPECT_EQ(allocations, 1);
+}
+
+TEST_F(SteadyStateExecutionTest, WarmGraphRunsWithoutAllocating)
+{
+    EXPECT_EQ(MeasureRuns(kMeasuredRuns), 0);
+
+    // Recycled statistics still describe the run
+    const auto latest = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(latest.has_value());
+    EXPECT_EQ(latest->nodesExecuted, kChainLength);
+    ASSERT_EQ(latest->nodes.size(), kChainLength);
+    EXPECT_EQ(latest->nodes.back().nodeName, "Adder number 8 of the chain");
+    EXPECT_EQ(latest->nodes.back().nodeType, "SteadyStateAddNode");
+    EXPECT_EQ(latest->nodes.back().outcome, Nodes::StepOutcome::Processed);
+
+    // Frame n reaches adder k as k * n: the counter twice into adder 2, then once more per adder
+    const double frame = static_cast<double>(Constants::Profiling::kRunHistoryCapacity + 2 + kMeasuredRuns);
+    const auto result = editor.GetNode(kChainLength)->GetOutputSlot("Output").GetData<double>();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_DOUBLE_EQ(*result, kChainLength * frame);
+}
+
+TEST_F(SteadyStateExecutionTest, PrunedAndReleasingRunsDoNotAllocate)
+{
+    // Only adder 4 is read, so pull-based evaluation drops the rest of the chain
+    editor.SetOutputNodes({ 4 });
+    editor.SetIntermediateRelease(true);
+    EXPECT_EQ(MeasureRuns(kMeasuredRuns), 0);
+
+    const auto latest = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(latest.has_value());
+    EXPECT_EQ(latest->nodesExecuted, 4);
+}
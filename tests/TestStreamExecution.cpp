@@ -0,0 +1,386 @@
+#include "Nodes/Core/EngineConstants.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Vision/IO/VideoInputNode.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Tracks how many Process() calls overlap across the graph
+    struct Concurrency
+    {
+        std::atomic<int> running{ 0 };
+        std::atomic<int> peak{ 0 };
+
+        void Enter()
+        {
+            const int now = running.fetch_add(1) + 1;
+            int previous = peak.load();
+            while (now > previous && !peak.compare_exchange_weak(previous, now))
+            {
+            }
+        }
+
+        void Leave()
+        {
+            running.fetch_sub(1);
+        }
+    };
+
+    // Emits 0, 1, 2, ... and ends after frameCount frames
+    class CounterSourceNode : public Nodes::Node
+    {
+    public:
+        CounterSourceNode(Nodes::NodeId id, int frameCount) : Nodes::Node(id, "Counter"), frameCount(frameCount)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "CounterSourceNode";
+        }
+
+        bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        bool IsStreamSource() const override
+        {
+            return true;
+        }
+
+        bool HasStreamEnded() const override
+        {
+            return ended;
+        }
+
+        void Process() override
+        {
+            ended = next >= frameCount;
+            if (ended)
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+            SetOutputSlotData("Output", next++);
+        }
+
+    private:
+        int frameCount;
+        int next = 0;
+        bool ended = false;
+    };
+
+    // Doubles its input, optionally sleeping to make stages overlap
+    class DoubleNode : public Nodes::Node
+    {
+    public:
+        DoubleNode(Nodes::NodeId id, Concurrency *concurrency = nullptr, bool throws = false)
+            : Nodes::Node(id, "Double"), concurrency(concurrency), throws(throws)
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "DoubleNode";
+        }
+
+        void Process() override
+        {
+            if (throws)
+            {
+                throw std::runtime_error("Double failed");
+            }
+            if (concurrency)
+            {
+                concurrency->Enter();
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                concurrency->Leave();
+            }
+            SetOutputSlotData("Output", GetInputValue<int>("Input").value_or(-1000) * 2);
+        }
+
+    private:
+        Concurrency *concurrency;
+        bool throws;
+    };
+
+    // Records every value it receives
+    class RecorderNode : public Nodes::Node
+    {
+    public:
+        RecorderNode(Nodes::NodeId id, Concurrency *concurrency = nullptr)
+            : Nodes::Node(id, "Recorder"), concurrency(concurrency)
+        {
+            CreateInputSlot("Input");
+        }
+
+        std::string GetType() const override
+        {
+            return "RecorderNode";
+        }
+
+        bool IsCacheable() const override
+        {
+            return false;
+        }
+
+        void Process() override
+        {
+            if (concurrency)
+            {
+                concurrency->Enter();
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                concurrency->Leave();
+            }
+            values.push_back(GetInputValue<int>("Input").value_or(-1));
+        }
+
+        std::vector<int> values;
+
+    private:
+        Concurrency *concurrency;
+    };
+
+    // Ends an execution flow so a lone source with an execution output pin forms a valid plan
+    class FlowSinkNode : public Nodes::Node
+    {
+    public:
+        explicit FlowSinkNode(Nodes::NodeId id) : Nodes::Node(id, "Sink")
+        {
+            CreateExecutionInputPin("Execute");
+            CreateInputSlot("Input");
+        }
+
+        std::string GetType() const override
+        {
+            return "FlowSinkNode";
+        }
+
+        void Process() override
+        {
+        }
+    };
+} // namespace
+
+class StreamExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetWorkerCount(4);
+    }
+
+    // Counter(1) -> Double(2) -> Double(3) -> Recorder(4)
+    RecorderNode *BuildChain(int frameCount, Concurrency *concurrency = nullptr)
+    {
+        editor.AddNode(std::make_unique<CounterSourceNode>(1, frameCount));
+        editor.AddNode(std::make_unique<DoubleNode>(2, concurrency));
+        editor.AddNode(std::make_unique<DoubleNode>(3, concurrency));
+        auto recorder = std::make_unique<RecorderNode>(4, concurrency);
+        auto *recorderPtr = recorder.get();
+        editor.AddNode(std::move(recorder));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(3, "Output", 4, "Input");
+        return recorderPtr;
+    }
+
+    static std::vector<int> Expected(int frameCount)
+    {
+        std::vector<int> expected;
+        for (int i = 0; i < frameCount; ++i)
+        {
+            expected.push_back(i * 4);
+        }
+        return expected;
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(StreamExecutionTest, RunsUntilSourceEnds)
+{
+    constexpr int kFrames = 20; // Spans several lock segments
+    auto *recorder = BuildChain(kFrames);
+
+    std::vector<size_t> reported;
+    const auto frames = editor.ExecuteStream([&](size_t frame) {
+        reported.push_back(frame);
+        return true;
+    });
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, kFrames);
+    EXPECT_EQ(recorder->values, Expected(kFrames));
+    ASSERT_EQ(reported.size(), kFrames);
+    for (size_t i = 0; i < reported.size(); ++i)
+    {
+        EXPECT_EQ(reported[i], i);
+    }
+}
+
+TEST_P(StreamExecutionTest, CallbackSeesCompletedFrameAtTerminalNode)
+{
+    Concurrency concurrency;
+    auto *recorder = BuildChain(30, &concurrency);
+
+    bool consistent = true;
+    editor.ExecuteStream([&](size_t frame) {
+        consistent = consistent && recorder->values.size() == frame + 1
+                     && recorder->values.back() == static_cast<int>(frame) * 4;
+        return true;
+    });
+
+    EXPECT_TRUE(consistent);
+}
+
+TEST_P(StreamExecutionTest, CallbackCanEndStream)
+{
+    auto *recorder = BuildChain(100);
+
+    const auto frames = editor.ExecuteStream([](size_t frame) { return frame < 4; });
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, 5);
+    EXPECT_LE(recorder->values.size(), 5 + Constants::Stream::kPipelineDepth);
+    EXPECT_EQ(std::vector<int>(recorder->values.begin(), recorder->values.begin() + 5), Expected(5));
+}
+
+TEST_P(StreamExecutionTest, MaxFramesLimitsStream)
+{
+    auto *recorder = BuildChain(100);
+
+    const auto frames = editor.ExecuteStream(nullptr, 11);
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, 11);
+    EXPECT_EQ(recorder->values, Expected(11));
+}
+
+TEST_P(StreamExecutionTest, CancellationStopsStream)
+{
+    BuildChain(1000);
+    std::stop_source stopSource;
+
+    const auto frames = editor.ExecuteStream(
+        [&](size_t frame) {
+            if (frame == 2)
+            {
+                stopSource.request_stop();
+            }
+            return true;
+        },
+        0,
+        stopSource.get_token());
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_GE(*frames, 3);
+    EXPECT_LT(*frames, 1000);
+}
+
+TEST_P(StreamExecutionTest, RequiresStreamSource)
+{
+    editor.AddNode(std::make_unique<DoubleNode>(1));
+    editor.AddNode(std::make_unique<RecorderNode>(2));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    EXPECT_FALSE(editor.ExecuteStream().has_value());
+}
+
+TEST_P(StreamExecutionTest, NodeFailureFailsStream)
+{
+    editor.AddNode(std::make_unique<CounterSourceNode>(1, 10));
+    editor.AddNode(std::make_unique<DoubleNode>(2, nullptr, true));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    EXPECT_FALSE(editor.ExecuteStream().has_value());
+}
+
+TEST_P(StreamExecutionTest, ParameterEditsApplyToLaterFrames)
+{
+    editor.AddNode(std::make_unique<CounterSourceNode>(1, 6));
+    auto recorder = std::make_unique<RecorderNode>(2);
+    auto *recorderPtr = recorder.get();
+    editor.AddNode(std::move(recorder));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    const auto frames = editor.ExecuteStream(nullptr, 3);
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, 3);
+
+    // A second stream continues from the source's current position
+    editor.ExecuteStream();
+    EXPECT_EQ(recorderPtr->values, (std::vector<int>{ 0, 1, 2, 3, 4, 5 }));
+}
+
+INSTANTIATE_TEST_SUITE_P(Modes,
+    StreamExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel),
+    [](const auto &info) { return info.param == Nodes::ExecutionMode::Parallel ? "Parallel" : "Sequential"; });
+
+TEST(StreamPipelineTest, ParallelModeOverlapsConsecutiveFrames)
+{
+    Nodes::NodeEditor editor;
+    editor.SetExecutionMode(Nodes::ExecutionMode::Parallel);
+    editor.SetWorkerCount(4);
+
+    Concurrency concurrency;
+    editor.AddNode(std::make_unique<CounterSourceNode>(1, 24));
+    editor.AddNode(std::make_unique<DoubleNode>(2, &concurrency));
+    editor.AddNode(std::make_unique<DoubleNode>(3, &concurrency));
+    editor.AddNode(std::make_unique<RecorderNode>(4, &concurrency));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(2, "Output", 3, "Input");
+    editor.AddConnection(3, "Output", 4, "Input");
+
+    ASSERT_EQ(editor.ExecuteStream(), 24);
+
+    // A linear chain has no parallel branches, so any overlap comes from pipelining frames
+    EXPECT_GE(concurrency.peak.load(), 2);
+}
+
+// ============================================================================
+// VideoInputNode Tests
+// ============================================================================
+
+TEST(VideoInputNodeTest, IsStreamSourceAndNotCacheable)
+{
+    Vision::IO::VideoInputNode node(1);
+    EXPECT_TRUE(node.IsStreamSource());
+    EXPECT_FALSE(node.IsCacheable());
+    EXPECT_EQ(node.GetInputValue<int>("CameraIndex"), -1);
+    EXPECT_EQ(node.GetInputValue<bool>("Loop"), false);
+}
+
+TEST(VideoInputNodeTest, MissingFileEndsStream)
+{
+    Nodes::NodeEditor editor;
+    auto video = std::make_unique<Vision::IO::VideoInputNode>(1);
+    auto *videoPtr = video.get();
+    videoPtr->SetInputSlotDefault("FilePath", std::filesystem::path("does_not_exist.mp4"));
+    editor.AddNode(std::move(video));
+    editor.AddNode(std::make_unique<FlowSinkNode>(2));
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    const auto frames = editor.ExecuteStream();
+
+    ASSERT_TRUE(frames.has_value());
+    EXPECT_EQ(*frames, 0);
+    EXPECT_TRUE(videoPtr->HasStreamEnded());
+    EXPECT_FALSE(videoPtr->GetOutputSlot("Output").HasData());
+}
@@ -0,0 +1,85 @@
+#include "Vision/IO/TextureBudget.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace VisionCraft;
+using Vision::IO::TextureBudget;
+
+TEST(TextureBudgetTest, ReleasesLeastRecentlyDrawnFirst)
+{
+    TextureBudget budget(250);
+    int first = 0;
+    int second = 0;
+    int third = 0;
+    budget.Touch(&first, 100);
+    budget.Touch(&second, 100);
+    budget.Touch(&third, 100);
+    EXPECT_EQ(budget.GetResidentBytes(), 300u);
+
+    // Everything was drawn this frame, so nothing goes even over the capacity
+    EXPECT_TRUE(budget.EndFrame().empty());
+
+    // Next frame only the first is on screen
+    budget.Touch(&first, 100);
+    EXPECT_EQ(budget.EndFrame(), std::vector<void *>{ &second });
+    EXPECT_EQ(budget.GetResidentBytes(), 200u);
+
+    // Within the capacity, off-screen textures stay
+    EXPECT_TRUE(budget.EndFrame().empty());
+}
+
+TEST(TextureBudgetTest, ReleasesUntilResidentBytesFit)
+{
+    TextureBudget budget(100);
+    int owners[4] = {};
+    for (auto &owner : owners)
+    {
+        budget.Touch(&owner, 60);
+    }
+    (void)budget.EndFrame();
+
+    budget.Touch(&owners[1], 60);
+    const auto released = budget.EndFrame();
+    EXPECT_EQ(released, (std::vector<void *>{ &owners[0], &owners[2], &owners[3] }));
+    EXPECT_EQ(budget.GetResidentBytes(), 60u);
+}
+
+TEST(TextureBudgetTest, TracksSizeChangesAndRemovals)
+{
+    TextureBudget budget(1000);
+    int thumbnail = 0;
+    int inspected = 0;
+    budget.Touch(&thumbnail, 100);
+    budget.Touch(&inspected, 100);
+
+    // A full-resolution upload grows the owner; closing the inspector shrinks it again
+    budget.Touch(&inspected, 900);
+    EXPECT_EQ(budget.GetResidentBytes(), 1000u);
+    budget.SetBytes(&inspected, 100);
+    EXPECT_EQ(budget.GetResidentBytes(), 200u);
+
+    budget.SetBytes(&thumbnail, 0);
+    budget.Remove(&inspected);
+    budget.Remove(&inspected);
+    EXPECT_EQ(budget.GetResidentBytes(), 0u);
+    EXPECT_TRUE(budget.EndFrame().empty());
+}
+
+TEST(TextureBudgetTest, LoweredCapacityReleasesOffScreenOwners)
+{
+    TextureBudget budget(1000);
+    int shown = 0;
+    int hidden = 0;
+    budget.Touch(&hidden, 300);
+    budget.Touch(&shown, 300);
+    (void)budget.EndFrame();
+
+    // Size updates alone do not count as draws
+    budget.SetBytes(&hidden, 400);
+    budget.Touch(&shown, 300);
+    budget.SetCapacity(500);
+    EXPECT_EQ(budget.GetCapacity(), 500u);
+    EXPECT_EQ(budget.EndFrame(), std::vector<void *>{ &hidden });
+    EXPECT_EQ(budget.GetResidentBytes(), 300u);
+}
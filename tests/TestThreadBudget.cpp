@@ -0,0 +1,138 @@
+#include "Nodes/Core/ExecutorService.h"
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/core.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+using namespace VisionCraft;
+
+namespace
+{
+    // Records the budget seen while it is processed
+    class BudgetRecordingNode : public Nodes::Node
+    {
+    public:
+        explicit BudgetRecordingNode(Nodes::NodeId id) : Nodes::Node(id, "BudgetRecording")
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "BudgetRecordingNode";
+        }
+
+        void Process() override
+        {
+            activeTasks = Nodes::ThreadBudget::Get().GetActiveTasks();
+            openCvThreads = cv::getNumThreads();
+            SetOutputSlotData("Output", 1.0);
+        }
+
+        size_t activeTasks = 0;
+        int openCvThreads = 0;
+    };
+
+    // The budget is process-wide; every test leaves it unlimited
+    class ThreadBudgetTest : public ::testing::Test
+    {
+    protected:
+        void TearDown() override
+        {
+            Nodes::ThreadBudget::Get().SetMaxCores(0);
+            Nodes::ThreadBudget::Get().SetMaxOpenCvThreads(0);
+        }
+    };
+} // namespace
+
+TEST_F(ThreadBudgetTest, SplitsOpenCvThreadsAmongActiveTasks)
+{
+    auto &budget = Nodes::ThreadBudget::Get();
+    budget.SetMaxCores(8);
+    EXPECT_EQ(budget.GetMaxCores(), 8u);
+    {
+        const Nodes::ThreadBudget::ActiveTask first(budget);
+        EXPECT_EQ(cv::getNumThreads(), 8);
+        {
+            const Nodes::ThreadBudget::ActiveTask second(budget);
+            std::optional<Nodes::ThreadBudget::ActiveTask> third(std::in_place, budget);
+            EXPECT_EQ(budget.GetActiveTasks(), 3u);
+            EXPECT_EQ(cv::getNumThreads(), 2);
+
+            third.reset();
+            EXPECT_EQ(cv::getNumThreads(), 4);
+        }
+        EXPECT_EQ(cv::getNumThreads(), 8);
+    }
+
+    // More tasks than cores leave one OpenCV thread each; idle keeps the whole budget
+    {
+        std::vector<std::unique_ptr<Nodes::ThreadBudget::ActiveTask>> tasks;
+        for (int i = 0; i < 10; ++i)
+        {
+            tasks.push_back(std::make_unique<Nodes::ThreadBudget::ActiveTask>(budget));
+        }
+        EXPECT_EQ(cv::getNumThreads(), 1);
+    }
+    EXPECT_EQ(budget.GetActiveTasks(), 0u);
+    EXPECT_EQ(cv::getNumThreads(), 8);
+    EXPECT_EQ(budget.GetOpenCvThreads(), 8u);
+}
+
+TEST_F(ThreadBudgetTest, OpenCvCapLimitsTheShare)
+{
+    auto &budget = Nodes::ThreadBudget::Get();
+    budget.SetMaxCores(8);
+    budget.SetMaxOpenCvThreads(3);
+    EXPECT_EQ(budget.GetMaxOpenCvThreads(), 3u);
+    EXPECT_EQ(cv::getNumThreads(), 3);
+    {
+        // A share below the cap is unaffected
+        const Nodes::ThreadBudget::ActiveTask first(budget);
+        const Nodes::ThreadBudget::ActiveTask second(budget);
+        const Nodes::ThreadBudget::ActiveTask third(budget);
+        EXPECT_EQ(cv::getNumThreads(), 2);
+    }
+
+    budget.SetMaxOpenCvThreads(0);
+    EXPECT_EQ(cv::getNumThreads(), 8);
+}
+
+TEST_F(ThreadBudgetTest, CapsExecutorWorkerPools)
+{
+    Nodes::ExecutorService executor(Nodes::ExecutorService::Options{ .workerCount = 4 });
+    EXPECT_EQ(executor.AcquireWorkerPool()->GetWorkerCount(), 4u);
+
+    Nodes::ThreadBudget::Get().SetMaxCores(2);
+    EXPECT_EQ(executor.AcquireWorkerPool()->GetWorkerCount(), 2u);
+
+    // A hardware-sized pool becomes exactly the budget
+    Nodes::ExecutorService hardwareSized;
+    EXPECT_EQ(hardwareSized.AcquireWorkerPool()->GetWorkerCount(), 2u);
+
+    Nodes::ThreadBudget::Get().SetMaxCores(0);
+    EXPECT_EQ(executor.AcquireWorkerPool()->GetWorkerCount(), 4u);
+}
+
+TEST_F(ThreadBudgetTest, NodesRunAsActiveTasks)
+{
+    Nodes::ThreadBudget::Get().SetMaxCores(3);
+    Nodes::NodeEditor editor;
+    editor.AddNode(std::make_unique<BudgetRecordingNode>(1));
+    auto *node = static_cast<BudgetRecordingNode *>(editor.GetNode(1));
+
+    for (const auto mode : { Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel })
+    {
+        editor.SetExecutionMode(mode);
+        editor.MarkAllNodesDirty();
+        ASSERT_TRUE(editor.Execute());
+        EXPECT_EQ(node->activeTasks, 1u);
+        EXPECT_EQ(node->openCvThreads, 3);
+    }
+    EXPECT_EQ(Nodes::ThreadBudget::Get().GetActiveTasks(), 0u);
+}
@@ -0,0 +1,124 @@
+#include "Vision/IO/ThumbnailLoader.h"
+
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace VisionCraft;
+
+class ThumbnailLoaderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        testDir = std::filesystem::temp_directory_path() / "visioncraft_thumbnail_test";
+        std::filesystem::remove_all(testDir);
+        std::filesystem::create_directories(testDir);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(testDir);
+    }
+
+    std::filesystem::path WriteImage(const std::string &name, int width, int height)
+    {
+        const auto path = testDir / name;
+        EXPECT_TRUE(cv::imwrite(path.string(), cv::Mat(height, width, CV_8UC3, cv::Scalar(10, 20, 30))));
+        return path;
+    }
+
+    // Collects thumbnails until count arrived or a few seconds passed
+    static std::vector<Vision::IO::ThumbnailLoader::Thumbnail> WaitFor(Vision::IO::ThumbnailLoader &loader,
+        size_t count)
+    {
+        std::vector<Vision::IO::ThumbnailLoader::Thumbnail> thumbnails;
+        const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (thumbnails.size() < count && std::chrono::steady_clock::now() < giveUp)
+        {
+            for (auto &thumbnail : loader.TakeReady())
+            {
+                thumbnails.push_back(std::move(thumbnail));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return thumbnails;
+    }
+
+    std::filesystem::path testDir;
+};
+
+TEST_F(ThumbnailLoaderTest, DecodesDownscaledThumbnails)
+{
+    Vision::IO::ThumbnailLoader loader(64, 8);
+    loader.Request(7, WriteImage("wide.png", 400, 200));
+
+    const auto thumbnails = WaitFor(loader, 1);
+    ASSERT_EQ(thumbnails.size(), 1u);
+    EXPECT_EQ(thumbnails[0].key, 7u);
+    EXPECT_EQ(thumbnails[0].path.filename(), "wide.png");
+    EXPECT_EQ(thumbnails[0].image.size(), cv::Size(64, 32));
+    EXPECT_EQ(thumbnails[0].image.type(), CV_8UC3);
+}
+
+TEST_F(ThumbnailLoaderTest, SmallImagesAreDecodedInFull)
+{
+    // A quarter-size read would be smaller than the thumbnail, so the file is read again at full size
+    const auto thumbnail = Vision::IO::ThumbnailLoader::Decode(WriteImage("small.png", 48, 40), 64);
+    EXPECT_EQ(thumbnail.size(), cv::Size(48, 40));
+}
+
+TEST_F(ThumbnailLoaderTest, UnreadableFileYieldsEmptyThumbnail)
+{
+    std::ofstream(testDir / "broken.png") << "not really a png";
+    Vision::IO::ThumbnailLoader loader(64, 8);
+    loader.Request(1, testDir / "broken.png");
+
+    const auto thumbnails = WaitFor(loader, 1);
+    ASSERT_EQ(thumbnails.size(), 1u);
+    EXPECT_TRUE(thumbnails[0].image.empty());
+}
+
+TEST_F(ThumbnailLoaderTest, OldestRequestsAreDroppedBeyondTheLimit)
+{
+    Vision::IO::ThumbnailLoader loader(64, 2);
+    const auto path = WriteImage("a.png", 128, 128);
+    for (uint64_t key = 1; key <= 6; ++key)
+    {
+        loader.Request(key, path);
+        EXPECT_LE(loader.GetPendingCount(), 2u);
+    }
+
+    // The newest request is served first once the worker is free; how many older ones it took before
+    // they were dropped depends on timing
+    std::vector<uint64_t> keys;
+    const auto giveUp = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::ranges::find(keys, 6u) == keys.end() && std::chrono::steady_clock::now() < giveUp)
+    {
+        for (const auto &thumbnail : loader.TakeReady())
+        {
+            keys.push_back(thumbnail.key);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_NE(std::ranges::find(keys, 6u), keys.end());
+    EXPECT_LT(keys.size(), 6u);
+}
+
+TEST_F(ThumbnailLoaderTest, CancelDropsWaitingAndFinishedThumbnails)
+{
+    Vision::IO::ThumbnailLoader loader(64, 8);
+    loader.Request(1, WriteImage("a.png", 128, 128));
+    ASSERT_EQ(WaitFor(loader, 1).size(), 1u);
+
+    loader.Request(2, testDir / "a.png");
+    loader.Cancel();
+    EXPECT_EQ(loader.GetPendingCount(), 0u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(loader.TakeReady().empty());
+}
@@ -0,0 +1,375 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <opencv2/opencv.hpp>
+
+using namespace VisionCraft;
+using Tests::MakePattern;
+using Tests::OutputOf;
+using Tests::SameImage;
+using Tests::SourceNode;
+
+namespace
+{
+    // Adds Amount to every pixel (saturating)
+    cv::Mat ShiftImage(const cv::Mat &image, int amount)
+    {
+        cv::Mat result(image.rows, image.cols, CV_8UC1);
+        for (int r = 0; r < image.rows; ++r)
+        {
+            for (int c = 0; c < image.cols; ++c)
+            {
+                result.at<uchar>(r, c) = static_cast<uchar>(std::clamp(image.at<uchar>(r, c) + amount, 0, 255));
+            }
+        }
+        return result;
+    }
+
+    // 3x3 maximum, replicating the border
+    cv::Mat MaxFilterImage(const cv::Mat &image)
+    {
+        cv::Mat result(image.rows, image.cols, CV_8UC1);
+        for (int r = 0; r < image.rows; ++r)
+        {
+            for (int c = 0; c < image.cols; ++c)
+            {
+                uchar value = 0;
+                for (int dr = -1; dr <= 1; ++dr)
+                {
+                    for (int dc = -1; dc <= 1; ++dc)
+                    {
+                        const int rr = std::clamp(r + dr, 0, image.rows - 1);
+                        const int cc = std::clamp(c + dc, 0, image.cols - 1);
+                        value = std::max(value, image.at<uchar>(rr, cc));
+                    }
+                }
+                result.at<uchar>(r, c) = value;
+            }
+        }
+        return result;
+    }
+
+    class ValueNode : public Nodes::Node
+    {
+    public:
+        ValueNode(Nodes::NodeId id, int value) : Nodes::Node(id, "Value"), value(value)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "ValueNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", value);
+        }
+
+        int value;
+    };
+
+    // Base for single-channel filters that count whole-image and tiled runs
+    class FilterNode : public Nodes::Node
+    {
+    public:
+        FilterNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input");
+            CreateOutputSlot("Output");
+        }
+
+        void Process() override
+        {
+            ++processCount;
+            const auto input = GetInputValueIf<cv::Mat>("Input");
+            if (!input || input->empty())
+            {
+                ClearOutputSlot("Output");
+                return;
+            }
+            SetOutputSlotData("Output", Apply(*input));
+        }
+
+        std::optional<Nodes::TileOperation> PrepareTileOperation(int inputType) const override
+        {
+            ++prepareCount;
+            if (!tileable || inputType != CV_8UC1)
+            {
+                return std::nullopt;
+            }
+            return Nodes::TileOperation{ .halo = halo,
+                .outputType = CV_8UC1,
+                .apply = [this](const cv::Mat &tile) { return Apply(tile); } };
+        }
+
+        virtual cv::Mat Apply(const cv::Mat &image) const = 0;
+
+        int halo = 0;
+        bool tileable = true;
+        int processCount = 0;
+        mutable int prepareCount = 0;
+    };
+
+    class ShiftNode : public FilterNode
+    {
+    public:
+        ShiftNode(Nodes::NodeId id) : FilterNode(id, "Shift")
+        {
+            CreateInputSlot("Amount", 10);
+        }
+
+        std::string GetType() const override
+        {
+            return "ShiftNode";
+        }
+
+        cv::Mat Apply(const cv::Mat &image) const override
+        {
+            return ShiftImage(image, GetInputValue<int>("Amount").value_or(0));
+        }
+    };
+
+    class MaxFilterNode : public FilterNode
+    {
+    public:
+        MaxFilterNode(Nodes::NodeId id) : FilterNode(id, "Max")
+        {
+            halo = 1;
+        }
+
+        std::string GetType() const override
+        {
+            return "MaxFilterNode";
+        }
+
+        cv::Mat Apply(const cv::Mat &image) const override
+        {
+            return MaxFilterImage(image);
+        }
+    };
+} // namespace
+
+class TiledExecutionTest : public ::testing::TestWithParam<Nodes::ExecutionMode>
+{
+protected:
+    void SetUp() override
+    {
+        editor.SetExecutionMode(GetParam());
+        editor.SetOutputCacheEnabled(false); // Run counts here measure tiling alone
+        editor.SetTilingOptions({ .enabled = true, .tileSize = 16, .minImagePixels = 0 });
+    }
+
+    // Builds Source -> Max (2) -> Shift (3) -> Max (4)
+    void BuildChain(const cv::Mat &image)
+    {
+        editor.AddNode(std::make_unique<SourceNode>(1, image));
+        editor.AddNode(std::make_unique<MaxFilterNode>(2));
+        editor.AddNode(std::make_unique<ShiftNode>(3));
+        editor.AddNode(std::make_unique<MaxFilterNode>(4));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(3, "Output", 4, "Input");
+    }
+
+    // Builds Source -> Shift (2) -> Shift (3) -> Max (4)
+    void BuildPointwiseChain(const cv::Mat &image)
+    {
+        editor.AddNode(std::make_unique<SourceNode>(1, image));
+        editor.AddNode(std::make_unique<ShiftNode>(2));
+        editor.AddNode(std::make_unique<ShiftNode>(3));
+        editor.AddNode(std::make_unique<MaxFilterNode>(4));
+        editor.AddConnection(1, "Output", 2, "Input");
+        editor.AddConnection(2, "Output", 3, "Input");
+        editor.AddConnection(3, "Output", 4, "Input");
+    }
+
+    FilterNode &Filter(Nodes::NodeId id)
+    {
+        return *static_cast<FilterNode *>(editor.GetNode(id));
+    }
+
+    Nodes::NodeEditor editor;
+};
+
+TEST_P(TiledExecutionTest, MatchesWholeImageResultForUnevenSizes)
+{
+    for (const auto &[rows, cols] : { std::pair{ 37, 53 }, std::pair{ 64, 64 }, std::pair{ 5, 200 } })
+    {
+        editor.Clear();
+        const cv::Mat image = MakePattern(rows, cols);
+        BuildChain(image);
+
+        ASSERT_TRUE(editor.Execute());
+
+        const auto output = OutputOf(editor, 4);
+        ASSERT_TRUE(output) << rows << "x" << cols;
+        EXPECT_TRUE(SameImage(*output, MaxFilterImage(ShiftImage(MaxFilterImage(image), 10)))) << rows << "x" << cols;
+        EXPECT_EQ(Filter(2).processCount + Filter(3).processCount + Filter(4).processCount, 0);
+    }
+}
+
+TEST_P(TiledExecutionTest, KeepsOnlyTheLastOutputOfAChain)
+{
+    BuildChain(MakePattern(40, 40));
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_FALSE(OutputOf(editor, 2));
+    EXPECT_FALSE(OutputOf(editor, 3));
+    EXPECT_TRUE(OutputOf(editor, 4));
+    EXPECT_TRUE(OutputOf(editor, 1)); // The source is not part of the chain
+
+    // Chain nodes count as processed even though Process() did not run
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run);
+    for (const auto &record : run->nodes)
+    {
+        EXPECT_EQ(record.outcome, Nodes::StepOutcome::Processed) << record.nodeName;
+    }
+}
+
+TEST_P(TiledExecutionTest, SecondRunSkipsUnchangedChain)
+{
+    BuildChain(MakePattern(40, 40));
+    ASSERT_TRUE(editor.Execute());
+    const int preparesBefore = Filter(2).prepareCount;
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).prepareCount, preparesBefore);
+    EXPECT_TRUE(OutputOf(editor, 4));
+}
+
+TEST_P(TiledExecutionTest, RerunsWholeChainWhenALaterNodeChanges)
+{
+    const cv::Mat image = MakePattern(50, 30);
+    BuildChain(image);
+    ASSERT_TRUE(editor.Execute());
+
+    editor.GetNode(3)->SetInputSlotDefault("Amount", 40);
+    ASSERT_TRUE(editor.Execute());
+
+    const auto output = OutputOf(editor, 4);
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(*output, MaxFilterImage(ShiftImage(MaxFilterImage(image), 40))));
+    EXPECT_EQ(Filter(2).processCount, 0);
+}
+
+TEST_P(TiledExecutionTest, BranchingOutputEndsTheChain)
+{
+    const cv::Mat image = MakePattern(33, 47);
+    BuildChain(image);
+    editor.AddNode(std::make_unique<ShiftNode>(5));
+    editor.AddConnection(2, "Output", 5, "Input");
+
+    ASSERT_TRUE(editor.Execute());
+
+    const cv::Mat filtered = MaxFilterImage(image);
+    ASSERT_TRUE(OutputOf(editor, 2));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 2), filtered));
+    ASSERT_TRUE(OutputOf(editor, 5));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 5), ShiftImage(filtered, 10)));
+    ASSERT_TRUE(OutputOf(editor, 4));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 4), MaxFilterImage(ShiftImage(filtered, 10))));
+    EXPECT_FALSE(OutputOf(editor, 3));
+}
+
+TEST_P(TiledExecutionTest, NodeThatDeclinesRunsOnTheWholeImage)
+{
+    const cv::Mat image = MakePattern(45, 45);
+    BuildChain(image);
+    Filter(3).tileable = false;
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 0);
+    EXPECT_EQ(Filter(3).processCount, 1);
+    EXPECT_EQ(Filter(4).processCount, 0);
+    ASSERT_TRUE(OutputOf(editor, 2)); // Needed whole by the declining node
+    ASSERT_TRUE(OutputOf(editor, 4));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 4), MaxFilterImage(ShiftImage(MaxFilterImage(image), 10))));
+}
+
+TEST_P(TiledExecutionTest, SmallImagesRunWhole)
+{
+    editor.SetTilingOptions({ .enabled = true, .tileSize = 16, .minImagePixels = 100 * 100 });
+    BuildChain(MakePattern(40, 40));
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 1);
+    EXPECT_EQ(Filter(3).processCount, 1);
+    EXPECT_EQ(Filter(4).processCount, 1);
+    EXPECT_TRUE(OutputOf(editor, 2));
+}
+
+TEST_P(TiledExecutionTest, DisablingChainsRestoresDiscardedOutputs)
+{
+    const cv::Mat image = MakePattern(40, 24);
+    BuildChain(image);
+    ASSERT_TRUE(editor.Execute());
+    ASSERT_FALSE(OutputOf(editor, 2));
+
+    editor.SetTilingOptions({ .enabled = false, .fusePointwise = false });
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 1);
+    EXPECT_EQ(Filter(3).processCount, 1);
+    ASSERT_TRUE(OutputOf(editor, 2));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 2), MaxFilterImage(image)));
+    ASSERT_TRUE(OutputOf(editor, 4));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 4), MaxFilterImage(ShiftImage(MaxFilterImage(image), 10))));
+}
+
+TEST_P(TiledExecutionTest, FusesPointwiseNodesWithoutTiling)
+{
+    editor.SetTilingOptions({ .enabled = false });
+    const cv::Mat image = MakePattern(300, 2000); // Several row strips
+    BuildPointwiseChain(image);
+    editor.GetNode(3)->SetInputSlotDefault("Amount", 200);
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 0);
+    EXPECT_EQ(Filter(3).processCount, 0);
+    EXPECT_EQ(Filter(4).processCount, 1); // Needs a halo, so it is not fused
+    EXPECT_FALSE(OutputOf(editor, 2));
+    const cv::Mat shifted = ShiftImage(ShiftImage(image, 10), 200);
+    ASSERT_TRUE(OutputOf(editor, 3));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 3), shifted));
+    ASSERT_TRUE(OutputOf(editor, 4));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 4), MaxFilterImage(shifted)));
+}
+
+TEST_P(TiledExecutionTest, ChainHeadReadsConnectedParameters)
+{
+    editor.SetTilingOptions({ .enabled = false });
+    const cv::Mat image = MakePattern(30, 30);
+    BuildPointwiseChain(image);
+    editor.AddNode(std::make_unique<ValueNode>(5, 55));
+    editor.AddConnection(5, "Output", 2, "Amount");
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 0);
+    ASSERT_TRUE(OutputOf(editor, 3));
+    EXPECT_TRUE(SameImage(*OutputOf(editor, 3), ShiftImage(ShiftImage(image, 55), 10)));
+}
+
+TEST_P(TiledExecutionTest, FusionCanBeSwitchedOff)
+{
+    editor.SetTilingOptions({ .enabled = false, .fusePointwise = false });
+    BuildPointwiseChain(MakePattern(20, 20));
+
+    ASSERT_TRUE(editor.Execute());
+
+    EXPECT_EQ(Filter(2).processCount, 1);
+    EXPECT_EQ(Filter(3).processCount, 1);
+    EXPECT_TRUE(OutputOf(editor, 2));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    TiledExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
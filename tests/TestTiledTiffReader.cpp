@@ -0,0 +1,177 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "TestGraphHelpers.h"
+#include "Vision/Algorithms/CropNode.h"
+#include "Vision/IO/TiledImageInputNode.h"
+#include "Vision/IO/TiledTiffReader.h"
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <opencv2/opencv.hpp>
+#include <string>
+#include <vector>
+
+using namespace VisionCraft;
+using Tests::MakePattern;
+using Tests::SameImage;
+
+namespace
+{
+    constexpr int kTileSize = 16;
+
+    void Put16(std::vector<uint8_t> &bytes, size_t at, uint32_t value)
+    {
+        bytes[at] = static_cast<uint8_t>(value);
+        bytes[at + 1] = static_cast<uint8_t>(value >> 8);
+    }
+
+    void Put32(std::vector<uint8_t> &bytes, size_t at, uint32_t value)
+    {
+        Put16(bytes, at, value & 0xFFFF);
+        Put16(bytes, at + 2, value >> 16);
+    }
+
+    // Writes an uncompressed, little-endian, 8-bit grayscale TIFF of kTileSize tiles
+    std::filesystem::path WriteTiledTiff(const cv::Mat &image, const std::string &name)
+    {
+        const int across = (image.cols + kTileSize - 1) / kTileSize;
+        const int down = (image.rows + kTileSize - 1) / kTileSize;
+        const uint32_t tileCount = static_cast<uint32_t>(across * down);
+        const uint32_t tileBytes = kTileSize * kTileSize;
+
+        constexpr uint32_t kEntries = 10;
+        const uint32_t offsetsAt = 8 + 2 + kEntries * 12 + 4;
+        const uint32_t countsAt = offsetsAt + tileCount * 4;
+        const uint32_t dataAt = countsAt + tileCount * 4;
+        std::vector<uint8_t> bytes(dataAt + tileCount * tileBytes, 0);
+
+        bytes[0] = 'I';
+        bytes[1] = 'I';
+        Put16(bytes, 2, 42);
+        Put32(bytes, 4, 8);
+        Put16(bytes, 8, kEntries);
+        const uint32_t entries[kEntries][4] = {
+            { 256, 3, 1, static_cast<uint32_t>(image.cols) }, // ImageWidth
+            { 257, 3, 1, static_cast<uint32_t>(image.rows) }, // ImageLength
+            { 258, 3, 1, 8 },                                 // BitsPerSample
+            { 259, 3, 1, 1 },                                 // Compression: none
+            { 262, 3, 1, 1 },                                 // Photometric: BlackIsZero
+            { 277, 3, 1, 1 },                                 // SamplesPerPixel
+            { 322, 3, 1, kTileSize },                         // TileWidth
+            { 323, 3, 1, kTileSize },                         // TileLength
+            { 324, 4, tileCount, offsetsAt },                 // TileOffsets
+            { 325, 4, tileCount, countsAt },                  // TileByteCounts
+        };
+        for (uint32_t e = 0; e < kEntries; ++e)
+        {
+            const size_t at = 10 + e * 12;
+            Put16(bytes, at, entries[e][0]);
+            Put16(bytes, at + 2, entries[e][1]);
+            Put32(bytes, at + 4, entries[e][2]);
+            if (entries[e][1] == 3)
+            {
+                Put16(bytes, at + 8, entries[e][3]);
+            }
+            else
+            {
+                Put32(bytes, at + 8, entries[e][3]);
+            }
+        }
+
+        for (uint32_t t = 0; t < tileCount; ++t)
+        {
+            const uint32_t tileAt = dataAt + t * tileBytes;
+            Put32(bytes, offsetsAt + t * 4, tileAt);
+            Put32(bytes, countsAt + t * 4, tileBytes);
+            const int left = static_cast<int>(t % across) * kTileSize;
+            const int top = static_cast<int>(t / across) * kTileSize;
+            for (int r = 0; r < kTileSize && top + r < image.rows; ++r)
+            {
+                for (int c = 0; c < kTileSize && left + c < image.cols; ++c)
+                {
+                    bytes[tileAt + r * kTileSize + c] = image.at<uchar>(top + r, left + c);
+                }
+            }
+        }
+
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return path;
+    }
+} // namespace
+
+TEST(TiledTiffReaderTest, DecodesOnlyTheTilesARegionCovers)
+{
+    const cv::Mat image = MakePattern(40, 56);
+    const auto path = WriteTiledTiff(image, "visioncraft_tiled_reader.tif");
+
+    Vision::IO::TiledTiffReader reader(1024 * 1024);
+    ASSERT_EQ(reader.Open(path), "");
+    const auto levels = reader.GetLevels();
+    ASSERT_EQ(levels.size(), 1u);
+    EXPECT_EQ(levels[0].size, cv::Size(56, 40));
+    EXPECT_EQ(levels[0].tileSize, cv::Size(kTileSize, kTileSize));
+    EXPECT_EQ(levels[0].type, CV_8UC1);
+
+    // Inside tile (1, 0) only
+    const cv::Rect inside(18, 2, 10, 10);
+    EXPECT_TRUE(SameImage(reader.ReadRegion(0, inside), image(inside)));
+    EXPECT_EQ(reader.GetStatistics().tilesDecoded, 1u);
+
+    // Across nine tiles, one of them cached; edge tiles are cut to the image
+    const cv::Rect across(24, 8, 32, 32);
+    EXPECT_TRUE(SameImage(reader.ReadRegion(0, across), image(across)));
+    EXPECT_EQ(reader.GetStatistics().tilesDecoded, 9u);
+    EXPECT_EQ(reader.GetStatistics().cacheHits, 1u);
+
+    EXPECT_THROW((void)reader.ReadRegion(0, cv::Rect(50, 0, 10, 10)), std::out_of_range);
+    EXPECT_THROW((void)reader.ReadRegion(1, inside), std::out_of_range);
+    std::filesystem::remove(path);
+}
+
+TEST(TiledTiffReaderTest, CacheStaysWithinItsBudget)
+{
+    const cv::Mat image = MakePattern(64, 64);
+    const auto path = WriteTiledTiff(image, "visioncraft_tiled_budget.tif");
+
+    Vision::IO::TiledTiffReader reader(2 * kTileSize * kTileSize);
+    ASSERT_EQ(reader.Open(path), "");
+    EXPECT_TRUE(SameImage(reader.ReadRegion(0, cv::Rect(0, 0, 64, 64)), image));
+    EXPECT_LE(reader.GetStatistics().residentBytes, static_cast<size_t>(2 * kTileSize * kTileSize));
+
+    EXPECT_NE(reader.Open(std::filesystem::temp_directory_path() / "visioncraft_missing.tif"), "");
+    EXPECT_TRUE(reader.GetLevels().empty());
+    std::filesystem::remove(path);
+}
+
+TEST(TiledTiffReaderTest, CropReadsADeferredLevelByTile)
+{
+    const cv::Mat image = MakePattern(64, 80);
+    const auto path = WriteTiledTiff(image, "visioncraft_tiled_crop.tif");
+
+    Nodes::NodeEditor editor;
+    editor.SetOutputCacheEnabled(false);
+    auto input = std::make_unique<Vision::IO::TiledImageInputNode>(1);
+    input->SetInputSlotData("FilePath", path);
+    input->SetMaxWholeImagePixels(1024); // Too large to load: the level is read by region
+    auto &source = *input;
+    editor.AddNode(std::move(input));
+    auto crop = std::make_unique<Vision::Algorithms::CropNode>(2);
+    crop->SetInputSlotData("X", 20);
+    crop->SetInputSlotData("Y", 4);
+    crop->SetInputSlotData("Width", 8);
+    crop->SetInputSlotData("Height", 8);
+    editor.AddNode(std::move(crop));
+    editor.AddConnection(1, "Output", 2, "Input");
+    editor.AddConnection(1, "Then", 2, "Execute", Nodes::ConnectionType::Execution);
+
+    ASSERT_TRUE(editor.Execute());
+    EXPECT_FALSE(source.GetOutputSlot("Output").GetDataIf<cv::Mat>());
+    const auto output = editor.GetNode(2)->GetOutputSlot("Output").GetDataIf<cv::Mat>();
+    ASSERT_TRUE(output);
+    EXPECT_TRUE(SameImage(*output, image(cv::Rect(20, 4, 8, 8))));
+    EXPECT_EQ(source.GetStatistics().tilesDecoded, 1u);
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,160 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/Tracer.h"
+#include "gtest/gtest.h"
+
+#include <nlohmann/json.hpp>
+#include <set>
+#include <string>
+#include <thread>
+
+using namespace VisionCraft;
+
+namespace
+{
+    class IncrementNode : public Nodes::Node
+    {
+    public:
+        IncrementNode(Nodes::NodeId id, std::string name) : Nodes::Node(id, std::move(name))
+        {
+            CreateInputSlot("Input", 0.0);
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "IncrementNode";
+        }
+
+        void Process() override
+        {
+            SetOutputSlotData("Output", GetInputValue<double>("Input").value_or(0.0) + 1.0);
+        }
+    };
+
+    nlohmann::json FindEvents(const nlohmann::json &trace, const std::string &category)
+    {
+        auto events = nlohmann::json::array();
+        for (const auto &event : trace["traceEvents"])
+        {
+            if (event["ph"] == "X" && event["cat"] == category)
+            {
+                events.push_back(event);
+            }
+        }
+        return events;
+    }
+} // namespace
+
+class TracerTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        // The tracer is process-wide; leave it idle and empty for other tests
+        tracer.Start();
+        tracer.Stop();
+    }
+
+    Nodes::Tracer &tracer = Nodes::Tracer::Get();
+};
+
+TEST_F(TracerTest, RecordsNothingWhileDisabled)
+{
+    tracer.Start();
+    tracer.Stop();
+    {
+        Nodes::TraceScope scope("test", "Ignored");
+        EXPECT_FALSE(scope.IsActive());
+    }
+    EXPECT_EQ(tracer.GetEventCount(), 0);
+}
+
+TEST_F(TracerTest, ExportsScopesAsCompleteEvents)
+{
+    tracer.Start();
+    {
+        Nodes::TraceScope scope("test", "Work");
+        ASSERT_TRUE(scope.IsActive());
+        scope.SetDetail("details");
+    }
+    tracer.Stop();
+
+    const auto trace = nlohmann::json::parse(tracer.ToChromeTraceJson());
+    const auto events = FindEvents(trace, "test");
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0]["name"], "Work");
+    EXPECT_EQ(events[0]["args"]["detail"], "details");
+    EXPECT_GE(events[0]["ts"].get<double>(), 0.0);
+    EXPECT_GE(events[0]["dur"].get<double>(), 0.0);
+}
+
+TEST_F(TracerTest, StartDiscardsPreviousEvents)
+{
+    tracer.Start();
+    {
+        Nodes::TraceScope scope("test", "Old");
+    }
+    EXPECT_EQ(tracer.GetEventCount(), 1);
+
+    tracer.Start();
+    EXPECT_EQ(tracer.GetEventCount(), 0);
+    tracer.Stop();
+}
+
+TEST_F(TracerTest, SeparatesThreadsAndNamesThem)
+{
+    tracer.Start();
+    {
+        Nodes::TraceScope scope("test", "Caller");
+    }
+    std::thread([]() {
+        Nodes::Tracer::Get().SetCurrentThreadName("Helper");
+        Nodes::TraceScope scope("test", "Helper work");
+    }).join();
+    tracer.Stop();
+
+    const auto trace = nlohmann::json::parse(tracer.ToChromeTraceJson());
+    const auto events = FindEvents(trace, "test");
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0]["tid"], events[1]["tid"]);
+
+    bool namedHelper = false;
+    for (const auto &event : trace["traceEvents"])
+    {
+        namedHelper |= event["ph"] == "M" && event["args"]["name"] == "Helper";
+    }
+    EXPECT_TRUE(namedHelper);
+}
+
+class TracerExecutionTest : public TracerTest, public ::testing::WithParamInterface<Nodes::ExecutionMode>
+{
+};
+
+TEST_P(TracerExecutionTest, TracesPlanDataPassesAndNodes)
+{
+    Nodes::NodeEditor editor;
+    editor.SetExecutionMode(GetParam());
+    editor.AddNode(std::make_unique<IncrementNode>(1, "First"));
+    editor.AddNode(std::make_unique<IncrementNode>(2, "Second"));
+    editor.AddConnection(1, "Output", 2, "Input");
+
+    tracer.Start();
+    ASSERT_TRUE(editor.Execute());
+    tracer.Stop();
+
+    const auto trace = nlohmann::json::parse(tracer.ToChromeTraceJson());
+    EXPECT_EQ(FindEvents(trace, "plan").size(), 1);
+    EXPECT_EQ(FindEvents(trace, "graph").size(), 1);
+    EXPECT_EQ(FindEvents(trace, "data").size(), 1);
+
+    std::set<std::string> nodeNames;
+    for (const auto &event : FindEvents(trace, "node"))
+    {
+        nodeNames.insert(event["name"].get<std::string>());
+    }
+    EXPECT_EQ(nodeNames, (std::set<std::string>{ "First", "Second" }));
+}
+
+INSTANTIATE_TEST_SUITE_P(ExecutionModes,
+    TracerExecutionTest,
+    ::testing::Values(Nodes::ExecutionMode::Sequential, Nodes::ExecutionMode::Parallel));
@@ -0,0 +1,183 @@
+#include "Nodes/Core/NodeEditor.h"
+#include "Nodes/Core/WriteBehindQueue.h"
+#include "Vision/IO/ImageOutputNode.h"
+#include "gtest/gtest.h"
+
+#include <opencv2/opencv.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <future>
+#include <latch>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+using namespace VisionCraft;
+using namespace std::chrono_literals;
+
+namespace
+{
+    bool IsReady(const auto &future)
+    {
+        return future.wait_for(0s) == std::future_status::ready;
+    }
+
+    // Queues a write to the shared queue that finishes when the test releases it
+    class SlowWriteNode : public Nodes::Node
+    {
+    public:
+        SlowWriteNode(Nodes::NodeId id, std::shared_future<void> release) : Nodes::Node(id, "Writer"), release(release)
+        {
+            CreateOutputSlot("Output");
+        }
+
+        std::string GetType() const override
+        {
+            return "SlowWriteNode";
+        }
+
+        void Process() override
+        {
+            written = Nodes::WriteBehindQueue::Get().Submit([release = release]() {
+                release.wait();
+                return true;
+            });
+            SetOutputSlotData("Output", 1.0);
+        }
+
+        std::shared_future<bool> written;
+
+    private:
+        std::shared_future<void> release;
+    };
+} // namespace
+
+TEST(WriteBehindQueueTest, SubmitReturnsBeforeWriteRuns)
+{
+    Nodes::WriteBehindQueue queue(1, 4);
+    std::promise<void> release;
+    std::atomic<bool> ran = false;
+    const auto result = queue.Submit([gate = release.get_future().share(), &ran]() {
+        gate.wait();
+        ran = true;
+        return true;
+    });
+
+    EXPECT_FALSE(ran);
+    const auto flushed = queue.Flush();
+    EXPECT_FALSE(IsReady(flushed));
+
+    release.set_value();
+    EXPECT_TRUE(result.get());
+    flushed.wait();
+    EXPECT_TRUE(ran);
+    EXPECT_TRUE(IsReady(queue.Flush())); // Nothing pending
+    EXPECT_EQ(queue.GetStatistics().completed, 1u);
+}
+
+TEST(WriteBehindQueueTest, FullQueueAppliesBackpressure)
+{
+    Nodes::WriteBehindQueue queue(1, 1);
+    std::promise<void> release;
+    const auto gate = release.get_future().share();
+    std::latch started(1);
+
+    // First write occupies the worker, second fills the queue, third has to wait
+    queue.Submit([gate, &started]() {
+        started.count_down();
+        gate.wait();
+        return true;
+    });
+    started.wait();
+    queue.Submit([]() { return true; });
+
+    std::atomic<bool> submitted = false;
+    std::thread producer([&]() {
+        queue.Submit([]() { return true; });
+        submitted = true;
+    });
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(submitted);
+
+    release.set_value();
+    producer.join();
+    queue.Flush().wait();
+    const auto statistics = queue.GetStatistics();
+    EXPECT_EQ(statistics.submitted, 3u);
+    EXPECT_EQ(statistics.completed, 3u);
+    EXPECT_EQ(statistics.stalls, 1u);
+}
+
+TEST(WriteBehindQueueTest, FailedAndThrowingWritesAreCounted)
+{
+    Nodes::WriteBehindQueue queue(2, 4);
+    const auto failed = queue.Submit([]() { return false; });
+    const auto threw = queue.Submit([]() -> bool { throw std::runtime_error("disk full"); });
+    EXPECT_FALSE(failed.get());
+    EXPECT_FALSE(threw.get());
+
+    queue.Flush().wait();
+    EXPECT_EQ(queue.GetStatistics().failed, 2u);
+}
+
+TEST(WriteBehindQueueTest, DestructorFinishesQueuedWrites)
+{
+    std::atomic<int> written = 0;
+    {
+        Nodes::WriteBehindQueue queue(1, 8);
+        for (int i = 0; i < 5; ++i)
+        {
+            queue.Submit([&written]() {
+                std::this_thread::sleep_for(1ms);
+                ++written;
+                return true;
+            });
+        }
+    }
+    EXPECT_EQ(written, 5);
+}
+
+TEST(WriteBehindQueueTest, RunStatisticsSignalWhenWritesAreDone)
+{
+    Nodes::NodeEditor editor;
+    std::promise<void> release;
+    const auto id = editor.AddNode(std::make_unique<SlowWriteNode>(1, release.get_future().share()));
+    auto *node = static_cast<SlowWriteNode *>(editor.GetNode(id));
+
+    // Execute() returns while the write is still queued
+    ASSERT_TRUE(editor.Execute());
+    const auto run = editor.GetExecutionStatistics().GetLatest();
+    ASSERT_TRUE(run && run->writesFlushed.valid());
+    EXPECT_FALSE(IsReady(run->writesFlushed));
+
+    release.set_value();
+    run->writesFlushed.wait();
+    EXPECT_TRUE(IsReady(node->written));
+    EXPECT_TRUE(node->written.get());
+}
+
+TEST(WriteBehindQueueTest, ImageOutputNodeSavesInBackground)
+{
+    const auto testDir = std::filesystem::temp_directory_path() / "visioncraft_write_behind_test";
+    std::filesystem::remove_all(testDir);
+    const auto savePath = testDir / "nested" / "result.png";
+
+    Vision::IO::ImageOutputNode node(1);
+    node.SetInputSlotData("Input", cv::Mat(16, 16, CV_8UC3, cv::Scalar(10, 20, 30)));
+    node.SetInputSlotDefault("SavePath", savePath);
+    node.SetInputSlotDefault("AutoSave", true);
+    node.Process();
+
+    ASSERT_TRUE(node.GetPendingSave().valid());
+    EXPECT_TRUE(node.GetLastSaveStatus()); // Waits for the queued write
+    EXPECT_TRUE(std::filesystem::exists(savePath));
+
+    // Without AutoSave nothing is queued
+    node.SetInputSlotDefault("AutoSave", false);
+    node.Process();
+    EXPECT_FALSE(node.GetPendingSave().valid());
+    EXPECT_FALSE(node.GetLastSaveStatus());
+    std::filesystem::remove_all(testDir);
+}